@@ -407,7 +407,11 @@ proc generate {os_handle} {
 	file copy -force [file join src Source list.c] ./src
 	file copy -force [file join src Source timers.c] ./src
 	file copy -force [file join src Source event_groups.c] ./src
-	file copy -force [file join src Source portable MemMang heap_4.c] ./src
+	if { [common::get_property CONFIG.use_region_heap $os_handle] == "true" } {
+		file copy -force [file join src Source portable MemMang heap_regions.c] ./src
+	} else {
+		file copy -force [file join src Source portable MemMang heap_4.c] ./src
+	}
         set stream_buffer_enabled [common::get_property CONFIG.stream_buffer $os_handle]
         set message_buffer_enabled [common::get_property CONFIG.message_buffer $os_handle]
         if {$stream_buffer_enabled == "true" || $message_buffer_enabled == "true"} {
@@ -486,6 +490,22 @@ proc generate {os_handle} {
 
 	}
 
+	set num_cores [common::get_property CONFIG.number_of_cores $os_handle]
+	if {$num_cores == ""} {
+		set num_cores 1
+	}
+	if {$num_cores > 1} {
+		if { $proctype != "psu_cortexa53" } {
+			error "ERROR: number_of_cores > 1 is only supported on psu_cortexa53" "mdt_error"
+		}
+		if { [common::get_property CONFIG.hypervisor_guest $os_handle] == "true" } {
+			error "ERROR: number_of_cores > 1 is not supported with hypervisor_guest" "mdt_error"
+		}
+		if { $num_cores > 4 } {
+			error "ERROR: number_of_cores must be in the range 1-4" "mdt_error"
+		}
+	}
+
 	puts $bspcfg_fh "/*"
 	puts $bspcfg_fh " * Definition to indicate that current BSP is a FreeRTOS BSP which can be used to"
 	puts $bspcfg_fh " * distinguish between standalone BSP and FreeRTOS BSP."
@@ -510,6 +530,14 @@ proc generate {os_handle} {
                         puts $bspcfg_fh "#define EL1_NONSECURE 0"
                         puts $bspcfg_fh "#define HYP_GUEST 0"
                 }
+		# Also read by the port assembly code
+		puts $bspcfg_fh "#define configNUMBER_OF_CORES $num_cores"
+		if { [common::get_property CONFIG.interrupt_nesting $os_handle] == "true" } {
+			puts $bspcfg_fh "#define configUSE_INTERRUPT_NESTING 1"
+		}
+		if { [common::get_property CONFIG.lazy_fpu_switching $os_handle] == "true" } {
+			puts $bspcfg_fh "#define configUSE_LAZY_FPU_SWITCHING 1"
+		}
 	}
 	set clocking_supported [common::get_property CONFIG.clocking $os_handle]
 	set slaves [common::get_property   SLAVES [  hsi::get_cells -hier $sw_proc_handle]]
@@ -607,6 +635,31 @@ proc generate {os_handle} {
 			puts "WARNING: STM event trace is not supported for $proctype"
 		}
 	}
+	set val [common::get_property CONFIG.enable_ram_event_trace $os_handle]
+	if { $val == "true" } {
+		if { [common::get_property CONFIG.enable_stm_event_trace $os_handle] == "true" } {
+			error "ERROR: enable_ram_event_trace and enable_stm_event_trace cannot be enabled together"
+		}
+		if { $proctype == "psu_cortexr5" || $proctype == "psu_cortexa53" } {
+			set records [common::get_property CONFIG.ram_trace_records $os_handle]
+			if { $records < 1 || ($records & ($records - 1)) != 0 } {
+				error "ERROR: ram_trace_records must be a power of two"
+			}
+			puts $file_handle "/* Enable event trace to the xil_trace ring buffers */"
+			puts $file_handle "#define FREERTOS_ENABLE_TRACE"
+			puts $file_handle "#define FREERTOS_TRACE_TO_RAM"
+			puts $file_handle "#define XIL_TRACE_ENABLE"
+			puts $file_handle "#define XIL_TRACE_RING_SIZE ${records}U"
+			if { $proctype == "psu_cortexa53" } {
+				puts $file_handle "#define EXEC_MODE64"
+			} else {
+				puts $file_handle "#define EXEC_MODE32"
+			}
+			puts $file_handle "\n/******************************************************************/\n"
+		} else {
+			puts "WARNING: RAM event trace is not supported for $proctype"
+		}
+	}
 	close $file_handle
 
 	############################################################################
@@ -876,7 +929,18 @@ proc generate {os_handle} {
 		xput_define $config_file "configUSE_PORT_OPTIMISED_TASK_SELECTION"  "1"
 	}
 
-	puts $config_file "#define configUSE_TICKLESS_IDLE	0"
+	set val [common::get_property CONFIG.use_tickless_idle $os_handle]
+	if {$val == "true"} {
+		if { $proctype != "psu_cortexa53" && $proctype != "psu_cortexr5" } {
+			error "ERROR: use_tickless_idle is only supported on psu_cortexa53 and psu_cortexr5" "mdt_error"
+		}
+		if { $num_cores > 1 } {
+			error "ERROR: use_tickless_idle is not supported with number_of_cores > 1" "mdt_error"
+		}
+		puts $config_file "#define configUSE_TICKLESS_IDLE	1"
+	} else {
+		puts $config_file "#define configUSE_TICKLESS_IDLE	0"
+	}
 	puts $config_file "#define configTASK_RETURN_ADDRESS    prvTaskExitError"
 	puts $config_file "#define INCLUDE_vTaskPrioritySet             1"
 	puts $config_file "#define INCLUDE_uxTaskPriorityGet            1"
@@ -1266,8 +1330,11 @@ proc generate {os_handle} {
 		puts $config_file "#define fabs( x ) __builtin_fabs( x )\n"
 		set max_api_call_interrupt_priority [common::get_property CONFIG.max_api_call_interrupt_priority $os_handle]
 		xput_define $config_file "configMAX_API_CALL_INTERRUPT_PRIORITY"   "($max_api_call_interrupt_priority)"
-		puts $config_file "#define portSET_INTERRUPT_MASK_FROM_ISR()	uxPortSetInterruptMask()"
-		puts $config_file "#define portCLEAR_INTERRUPT_MASK_FROM_ISR(x)	vPortClearInterruptMask(x)"
+		# With SMP the kernel also takes the ISR spin lock, see portmacro.h
+		if {$num_cores == 1} {
+			puts $config_file "#define portSET_INTERRUPT_MASK_FROM_ISR()	uxPortSetInterruptMask()"
+			puts $config_file "#define portCLEAR_INTERRUPT_MASK_FROM_ISR(x)	vPortClearInterruptMask(x)"
+		}
 
 	}
 	# end of if $proctype == "psu_cortexa53"
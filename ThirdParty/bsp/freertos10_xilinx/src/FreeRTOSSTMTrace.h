@@ -33,12 +33,24 @@
 * Contains FreeRTOS trace macros to write trace data to STM address space on
 * ZU+. STM generates STPI packets, which are consumed by SDK to generate trace
 *
+* With FREERTOS_TRACE_TO_RAM the same events are recorded instead in the
+* per-core xil_trace ring buffers of the standalone BSP, stamped with the PMU
+* cycle counter. An event is a record with ID XIL_TRACE_EVT_FREERTOS plus the
+* event number, followed by one XIL_TRACE_EVT_FREERTOS_DATA record for each
+* data item, which holds the low and high 32 bits of the item in Arg0 and
+* Arg1. The kernel emits these records with interrupts masked up to
+* configMAX_API_CALL_INTERRUPT_PRIORITY, so the data records of an event
+* follow it in the ring of the core. The interrupt entry and exit events hold
+* the interrupt ID in Arg0 of the event record itself. The rings are read back with
+* Xil_TraceDump(), or over JTAG, or printed with Xil_TracePrint().
+*
 * <pre>
 * MODIFICATION HISTORY:
 *
 * Ver   Who    Date   Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.00a sdm   07/15/16 Initial version
+* 1.01a ag    10/15/26 Add the xil_trace backend and the interrupt events
 * </pre>
 *
 ******************************************************************************/
@@ -53,6 +65,9 @@ extern "C" {
 #include "xparameters.h"
 #include "xil_io.h"
 #include "xil_types.h"
+#ifdef FREERTOS_TRACE_TO_RAM
+#include "xil_trace.h"
+#endif
 
 #ifdef FREERTOS_ENABLE_TRACE
 
@@ -131,8 +146,22 @@ enum stm_trace_events {
     FREERTOS_TASK_NOTIFY,
     FREERTOS_TASK_NOTIFY_FROM_ISR,
     FREERTOS_TASK_NOTIFY_GIVE_FROM_ISR,
+    FREERTOS_ISR_ENTER,
+    FREERTOS_ISR_EXIT,
 };
 
+#ifdef FREERTOS_TRACE_TO_RAM
+
+#define FREERTOS_EMIT_EVENT(id)         XIL_TRACE(XIL_TRACE_EVT_FREERTOS + (u32) (id), 0U, 0U)
+#define FREERTOS_EMIT_DATA(data)        XIL_TRACE(XIL_TRACE_EVT_FREERTOS_DATA, (u64) (UINTPTR) (data), (u64) (UINTPTR) (data) >> 32U)
+
+/* Interrupts can nest, so the interrupt events hold the interrupt ID in a
+single record. */
+#define traceISR_ENTER(ulInterruptID)   XIL_TRACE(XIL_TRACE_EVT_FREERTOS + (u32) FREERTOS_ISR_ENTER, ulInterruptID, 0U)
+#define traceISR_EXIT(ulInterruptID)    XIL_TRACE(XIL_TRACE_EVT_FREERTOS + (u32) FREERTOS_ISR_EXIT, ulInterruptID, 0U)
+
+#else
+
 #define STM_BASE                        0xf8000000
 
 #define FREERTOS_EMIT_EVENT(id)         Xil_Out8(STM_BASE + (FREERTOS_STM_CHAN * 0x100), id)
@@ -142,11 +171,18 @@ enum stm_trace_events {
         #define FREERTOS_EMIT_DATA(data) Xil_Out64((u64) (STM_BASE + (FREERTOS_STM_CHAN * 0x100) + 0x18), (u64) data)
 #endif
 
+#endif /* FREERTOS_TRACE_TO_RAM */
+
 /* Remove any unused trace macros. */
 #ifndef traceSTART
     /* Used to perform any necessary initialisation - for example, open a file
-    into which trace is to be written. */
-    #define traceSTART()
+    into which trace is to be written.  Called by the port on each core before
+    the first task starts. */
+    #ifdef FREERTOS_TRACE_TO_RAM
+        #define traceSTART()    Xil_TraceInit()
+    #else
+        #define traceSTART()
+    #endif
 #else
     #error "FreeRTOS Trace is already enabled"
 #endif
@@ -689,6 +725,22 @@ enum stm_trace_events {
     }
 #endif
 
+#ifndef traceISR_ENTER
+    /* Called by the port before the handler of an interrupt runs. */
+    #define traceISR_ENTER(ulInterruptID) {                         \
+        FREERTOS_EMIT_EVENT(FREERTOS_ISR_ENTER);                    \
+        FREERTOS_EMIT_DATA(ulInterruptID);                          \
+    }
+#endif
+
+#ifndef traceISR_EXIT
+    /* Called by the port after the handler of an interrupt returns. */
+    #define traceISR_EXIT(ulInterruptID) {                          \
+        FREERTOS_EMIT_EVENT(FREERTOS_ISR_EXIT);                     \
+        FREERTOS_EMIT_DATA(ulInterruptID);                          \
+    }
+#endif
+
 #endif /* ENABLE_FREERTOS_TRACE */
 
 #ifdef __cplusplus
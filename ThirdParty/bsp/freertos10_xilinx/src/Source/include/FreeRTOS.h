@@ -353,6 +353,18 @@
     #define traceEND()
 #endif
 
+#ifndef traceISR_ENTER
+
+/* Called by the port before the handler of an interrupt runs. */
+    #define traceISR_ENTER( ulInterruptID )
+#endif
+
+#ifndef traceISR_EXIT
+
+/* Called by the port after the handler of an interrupt returns. */
+    #define traceISR_EXIT( ulInterruptID )
+#endif
+
 #ifndef traceTASK_SWITCHED_IN
 
 /* Called after a task has been selected to run.  pxCurrentTCB holds a pointer
@@ -886,6 +898,10 @@
     #define configUSE_POSIX_ERRNO    0
 #endif
 
+#ifndef configNUMBER_OF_CORES
+    #define configNUMBER_OF_CORES    1
+#endif
+
 #ifndef portTICK_TYPE_IS_ATOMIC
     #define portTICK_TYPE_IS_ATOMIC    0
 #endif
@@ -938,6 +954,20 @@
     #error configUSE_MUTEXES must be set to 1 to use recursive mutexes
 #endif
 
+#if ( configNUMBER_OF_CORES > 1 )
+    #ifndef portGET_CORE_ID
+        #error portGET_CORE_ID() must be defined by the port if configNUMBER_OF_CORES is greater than 1
+    #endif
+
+    #if ( ( configUSE_TICKLESS_IDLE != 0 ) || ( configUSE_NEWLIB_REENTRANT != 0 ) || ( configUSE_POSIX_ERRNO != 0 ) || ( portUSING_MPU_WRAPPERS != 0 ) )
+        #error configUSE_TICKLESS_IDLE, configUSE_NEWLIB_REENTRANT, configUSE_POSIX_ERRNO and the MPU are not supported if configNUMBER_OF_CORES is greater than 1
+    #endif
+
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+        #error configSUPPORT_DYNAMIC_ALLOCATION must be set to 1 if configNUMBER_OF_CORES is greater than 1, the idle tasks are allocated dynamically
+    #endif
+#endif
+
 #ifndef configINITIAL_TICK_COUNT
     #define configINITIAL_TICK_COUNT    0
 #endif
@@ -1226,6 +1256,10 @@ typedef struct xSTATIC_TCB
     #if ( configUSE_POSIX_ERRNO == 1 )
         int iDummy22;
     #endif
+    #if ( configNUMBER_OF_CORES > 1 )
+        BaseType_t xDummy23;
+        UBaseType_t uxDummy24;
+    #endif
 } StaticTask_t;
 
 /*
@@ -169,6 +169,35 @@ void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions ) PRIVILEG
  */
 void vPortGetHeapStats( HeapStats_t * pxHeapStats );
 
+/* Used to pass information about one heap region out of
+ * xPortGetHeapRegionStats(). */
+typedef struct xHeapRegionStats
+{
+    size_t xTotalSizeInBytes;               /* The size of the region available for allocation. */
+    size_t xAvailableHeapSpaceInBytes;      /* The free bytes in the region, including the cached blocks. */
+    size_t xMinimumEverFreeBytesRemaining;  /* The minimum free bytes there has been in the region since the system booted. */
+    size_t xCachedBytes;                    /* The bytes held in the size class caches of the region. */
+    size_t xSizeOfLargestFreeBlockInBytes;  /* The largest block of the free list of the region, the cached blocks are not included. */
+    size_t xNumberOfFreeBlocks;             /* The number of blocks in the free list of the region. */
+    size_t xFragmentationPercent;           /* The part of the free list that is not in the largest block, in percent. */
+    size_t xNumberOfSuccessfulAllocations;  /* The number of allocations made from the region. */
+    size_t xNumberOfSuccessfulFrees;        /* The number of blocks freed to the region. */
+} HeapRegionStats_t;
+
+/* Region hint of pvPortMallocRegion() for the default placement. */
+#define portHEAP_REGION_ANY    ( ( BaseType_t ) -1 )
+
+/*
+ * Only implemented by heap_regions.c.  pvPortMallocRegion() allocates from
+ * the region of index xRegionHint in the array passed to
+ * vPortDefineHeapRegions(), or from the other regions if it is full.
+ * xPortGetHeapRegionStats() returns pdFAIL if xRegion is not defined.
+ */
+void * pvPortMallocRegion( size_t xSize,
+                           BaseType_t xRegionHint ) PRIVILEGED_FUNCTION;
+BaseType_t xPortGetHeapRegionStats( BaseType_t xRegion,
+                                    HeapRegionStats_t * pxRegionStats );
+
 /*
  * Map to the memory management routines required for the port.
  */
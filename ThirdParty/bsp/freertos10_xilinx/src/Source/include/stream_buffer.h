@@ -840,6 +840,135 @@ BaseType_t xStreamBufferSendCompletedFromISR( StreamBufferHandle_t xStreamBuffer
 BaseType_t xStreamBufferReceiveCompletedFromISR( StreamBufferHandle_t xStreamBuffer,
                                                  BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferReserve( StreamBufferHandle_t xStreamBuffer, uint8_t ** ppucData );
+ * @endcode
+ *
+ * Returns the largest contiguous free region of a stream buffer, so a writer,
+ * such as a DMA engine, can write data directly into the stream buffer instead
+ * of having it copied in by xStreamBufferSend().  The data is made available
+ * to the reader by xStreamBufferCommit() or xStreamBufferCommitFromISR().
+ *
+ * The region stops at the end of the stream buffer storage area, so it can be
+ * smaller than the free space returned by xStreamBufferSpacesAvailable().  Once
+ * it is committed, the next region starts at the beginning of the storage
+ * area.  The region remains free until it is committed, and only one region
+ * can be reserved at a time.  Cache maintenance of the region, if the writer
+ * is a DMA engine, is the responsibility of the caller.
+ *
+ * Can be called from a task or an interrupt.  Only stream buffers can be
+ * written in place, not message buffers.
+ *
+ * @param xStreamBuffer The handle of the stream buffer being written to.
+ *
+ * @param ppucData Set to the start of the region.
+ *
+ * @return The number of bytes that can be written to the region.
+ *
+ * \defgroup xStreamBufferReserve xStreamBufferReserve
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferReserve( StreamBufferHandle_t xStreamBuffer,
+                             uint8_t ** ppucData ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferCommit( StreamBufferHandle_t xStreamBuffer, size_t xCommitLength );
+ * size_t xStreamBufferCommitFromISR( StreamBufferHandle_t xStreamBuffer, size_t xCommitLength, BaseType_t *pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * Makes xCommitLength bytes written at the start of the region returned by
+ * xStreamBufferReserve() available to the reader.  As with
+ * xStreamBufferSend(), a task blocked on the stream buffer waiting for data is
+ * notified once the number of bytes in the stream buffer reaches the trigger
+ * level.
+ *
+ * xStreamBufferCommitFromISR() is the version that can be called from an
+ * interrupt, for example from the completion handler of a DMA transfer.
+ *
+ * @param xStreamBuffer The handle of the stream buffer being written to.
+ *
+ * @param xCommitLength The number of bytes written, which must not exceed the
+ * size of the reserved region.
+ *
+ * @param pxHigherPriorityTaskWoken As for xStreamBufferSendFromISR().
+ *
+ * @return xCommitLength.
+ *
+ * \defgroup xStreamBufferCommit xStreamBufferCommit
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferCommit( StreamBufferHandle_t xStreamBuffer,
+                            size_t xCommitLength ) PRIVILEGED_FUNCTION;
+
+size_t xStreamBufferCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+                                   size_t xCommitLength,
+                                   BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferClaim( StreamBufferHandle_t xStreamBuffer, uint8_t ** ppucData, TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Returns the largest contiguous region of data in a stream buffer, so the
+ * reader can use the data in place instead of having it copied out by
+ * xStreamBufferReceive().  The region is given back to the writer by
+ * vStreamBufferRelease().
+ *
+ * As with xStreamBufferReserve(), the region stops at the end of the stream
+ * buffer storage area, so it can hold fewer bytes than returned by
+ * xStreamBufferBytesAvailable().
+ *
+ * Only stream buffers can be read in place, not message buffers.  Must not be
+ * called from an interrupt.
+ *
+ * @param xStreamBuffer The handle of the stream buffer being read from.
+ *
+ * @param ppucData Set to the start of the region.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for data, as for xStreamBufferReceive().
+ *
+ * @return The number of bytes in the region, or 0 if the stream buffer was
+ * still empty when xTicksToWait expired.
+ *
+ * \defgroup xStreamBufferClaim xStreamBufferClaim
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferClaim( StreamBufferHandle_t xStreamBuffer,
+                           uint8_t ** ppucData,
+                           TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * void vStreamBufferRelease( StreamBufferHandle_t xStreamBuffer, size_t xReleaseLength );
+ * @endcode
+ *
+ * Removes the first xReleaseLength bytes of the region returned by
+ * xStreamBufferClaim() from the stream buffer, making the space available to
+ * the writer.  A task blocked on the stream buffer waiting for space is
+ * notified.  Must not be called from an interrupt.
+ *
+ * @param xStreamBuffer The handle of the stream buffer being read from.
+ *
+ * @param xReleaseLength The number of bytes consumed, which must not exceed
+ * the size of the claimed region.
+ *
+ * \defgroup vStreamBufferRelease vStreamBufferRelease
+ * \ingroup StreamBufferManagement
+ */
+void vStreamBufferRelease( StreamBufferHandle_t xStreamBuffer,
+                           size_t xReleaseLength ) PRIVILEGED_FUNCTION;
+
 /* Functions below here are not part of the public API. */
 StreamBufferHandle_t xStreamBufferGenericCreate( size_t xBufferSizeBytes,
                                                  size_t xTriggerLevelBytes,
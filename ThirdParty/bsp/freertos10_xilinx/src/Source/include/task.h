@@ -179,6 +179,16 @@ typedef enum
  */
 #define tskIDLE_PRIORITY    ( ( UBaseType_t ) 0U )
 
+/**
+ * task. h
+ *
+ * Core affinity mask that allows a task to run on any core.  Only used if
+ * configNUMBER_OF_CORES is greater than 1.
+ *
+ * \ingroup TaskUtils
+ */
+#define tskNO_AFFINITY      ( ( UBaseType_t ) -1 )
+
 /**
  * task. h
  *
@@ -733,6 +743,73 @@ void vTaskAllocateMPURegions( TaskHandle_t xTask,
  */
 void vTaskDelete( TaskHandle_t xTaskToDelete ) PRIVILEGED_FUNCTION;
 
+#if ( configNUMBER_OF_CORES > 1 )
+
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskCreateAffinitySet( TaskFunction_t pxTaskCode, const char * const pcName, const configSTACK_DEPTH_TYPE usStackDepth, void * const pvParameters, UBaseType_t uxPriority, UBaseType_t uxCoreAffinityMask, TaskHandle_t * const pxCreatedTask );
+ * @endcode
+ *
+ * Same as xTaskCreate(), but the task only runs on the cores set in
+ * uxCoreAffinityMask.  Bit n of the mask allows the task to run on core n.
+ *
+ * \defgroup xTaskCreateAffinitySet xTaskCreateAffinitySet
+ * \ingroup Tasks
+ */
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+        BaseType_t xTaskCreateAffinitySet( TaskFunction_t pxTaskCode,
+                                           const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                           const configSTACK_DEPTH_TYPE usStackDepth,
+                                           void * const pvParameters,
+                                           UBaseType_t uxPriority,
+                                           UBaseType_t uxCoreAffinityMask,
+                                           TaskHandle_t * const pxCreatedTask ) PRIVILEGED_FUNCTION;
+    #endif
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskCoreAffinitySet( const TaskHandle_t xTask, UBaseType_t uxCoreAffinityMask );
+ * @endcode
+ *
+ * Sets the cores the task is allowed to run on.  Bit n of uxCoreAffinityMask
+ * allows the task to run on core n, tskNO_AFFINITY allows any core.  The
+ * scheduler is partitioned: each task runs on a single core at a time,
+ * chosen among the allowed cores when the mask is set.  A task that is
+ * running moves to its new core the next time it is switched out.
+ *
+ * The affinity of the idle tasks cannot be changed.
+ *
+ * @param xTask The handle of the task.  Passing NULL sets the affinity of the
+ * calling task.
+ *
+ * @param uxCoreAffinityMask The cores the task is allowed to run on.
+ *
+ * \defgroup vTaskCoreAffinitySet vTaskCoreAffinitySet
+ * \ingroup Tasks
+ */
+    void vTaskCoreAffinitySet( const TaskHandle_t xTask,
+                               UBaseType_t uxCoreAffinityMask ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * @code{c}
+ * UBaseType_t vTaskCoreAffinityGet( const TaskHandle_t xTask );
+ * @endcode
+ *
+ * @param xTask The handle of the task.  Passing NULL returns the affinity of
+ * the calling task.
+ *
+ * @return The cores the task is allowed to run on.
+ *
+ * \defgroup vTaskCoreAffinityGet vTaskCoreAffinityGet
+ * \ingroup Tasks
+ */
+    UBaseType_t vTaskCoreAffinityGet( const TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+#endif /* configNUMBER_OF_CORES > 1 */
+
 /*-----------------------------------------------------------
 * TASK CONTROL API
 *----------------------------------------------------------*/
@@ -3103,6 +3180,26 @@ TaskHandle_t pvTaskIncrementMutexHeldCount( void ) PRIVILEGED_FUNCTION;
  */
 void vTaskInternalSetTimeOutState( TimeOut_t * const pxTimeOut ) PRIVILEGED_FUNCTION;
 
+#if ( configNUMBER_OF_CORES > 1 )
+
+/*
+ * For internal use only.  Critical sections that work across the cores, the
+ * port maps the taskENTER_CRITICAL() and taskEXIT_CRITICAL() macros onto
+ * them.
+ */
+    void vTaskEnterCritical( void ) PRIVILEGED_FUNCTION;
+    void vTaskExitCritical( void ) PRIVILEGED_FUNCTION;
+    UBaseType_t vTaskEnterCriticalFromISR( void ) PRIVILEGED_FUNCTION;
+    void vTaskExitCriticalFromISR( UBaseType_t uxSavedInterruptStatus ) PRIVILEGED_FUNCTION;
+
+/*
+ * For internal use only.  Yields the calling core, or defers the yield until
+ * the end of the critical section if called from within one.
+ */
+    void vTaskYieldWithinAPI( void ) PRIVILEGED_FUNCTION;
+
+#endif /* configNUMBER_OF_CORES > 1 */
+
 
 /* *INDENT-OFF* */
 #ifdef __cplusplus
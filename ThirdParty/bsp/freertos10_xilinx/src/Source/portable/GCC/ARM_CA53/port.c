@@ -129,7 +129,7 @@ point is zero. */
 
 #if defined (GICv2)
 /* Macro to unmask all interrupt priorities. */
-#define portCLEAR_INTERRUPT_MASK()									\
+#define portUNMASK_INTERRUPT_PRIORITIES()								\
 {																	\
 	portDISABLE_INTERRUPTS();										\
 	portICCPMR_PRIORITY_MASK_REGISTER = portUNMASK_VALUE;			\
@@ -138,7 +138,7 @@ point is zero. */
 	portENABLE_INTERRUPTS();										\
 }
 #else
-#define portCLEAR_INTERRUPT_MASK()									\
+#define portUNMASK_INTERRUPT_PRIORITIES()								\
 {																	\
 	portDISABLE_INTERRUPTS();										\
 	mtcp(S3_0_C4_C6_0, portUNMASK_VALUE);							\
@@ -153,6 +153,27 @@ point is zero. */
 #define portMAX_8_BIT_VALUE							( ( uint8_t ) 0xff )
 #define portBIT_0_SET								( ( uint8_t ) 0x01 )
 
+#if ( configNUMBER_OF_CORES > 1 )
+/* Distributor and CPU interface registers used to signal the other cores. */
+#define portINTERRUPT_ENABLE_SET_REGISTER_OFFSET	0x100UL
+#define portSGI_REGISTER_OFFSET						0xF00UL
+#define portSGI_TARGET_LIST_SHIFT					16UL
+#define portICCICR_CPU_INTERFACE_CONTROL_REGISTER	( *( ( volatile uint32_t * ) ( portINTERRUPT_CONTROLLER_CPU_INTERFACE_ADDRESS ) ) )
+#define portICCICR_ENABLE							( 0x07UL )
+
+/* Value of the owner of a spin lock that is free. */
+#define portLOCK_FREE								( ( uint32_t ) 0xFFFFFFFFUL )
+#define portNUM_LOCKS								2U
+#endif
+
+/* The variables shared with the ASM code have one entry per core when
+configNUMBER_OF_CORES > 1. */
+#if ( configNUMBER_OF_CORES > 1 )
+	#define portTHIS_CORE( xVariable )				( ( xVariable )[ portGET_CORE_ID() ] )
+#else
+	#define portTHIS_CORE( xVariable )				( xVariable )
+#endif
+
 /* Let the user override the pre-loading of the initial LR with the address of
 prvTaskExitError() in case is messes up unwinding of the stack in the
 debugger. */
@@ -170,6 +191,25 @@ extern void vPortRestoreTaskContext( void );
  * Used to catch tasks that attempt to return from their implementing function.
  */
 static void prvTaskExitError( void );
+
+#if ( configNUMBER_OF_CORES > 1 )
+/*
+ * Sets the priority of the interrupt used to make the calling core reschedule
+ * and enables it.  Software generated interrupts are banked per core.
+ */
+static void prvSetupYieldCoreInterrupt( void );
+
+/*
+ * Handler of the interrupt sent by vPortYieldCore().
+ */
+static void prvYieldCoreHandler( void *pvUnused );
+
+/*
+ * Releases the secondary cores from reset and waits until they are ready to
+ * run their first task.
+ */
+static void prvStartSecondaryCores( void );
+#endif
 /*-----------------------------------------------------------*/
 
 /* A variable is used to keep track of the critical section nesting.  This
@@ -177,7 +217,11 @@ variable has to be stored as part of the task context and must be initialised to
 a non zero value to ensure interrupts don't inadvertently become unmasked before
 the scheduler starts.  As it is stored as part of the task context it will
 automatically be set to 0 when the first task is started. */
+#if ( configNUMBER_OF_CORES > 1 )
+volatile uint64_t ullCriticalNesting[ configNUMBER_OF_CORES ] = { [ 0 ... ( configNUMBER_OF_CORES - 1 ) ] = 9999ULL };
+#else
 volatile uint64_t ullCriticalNesting = 9999ULL;
+#endif
 
 /*
  * The instance of the interrupt controller used by this port.  This is required
@@ -190,15 +234,50 @@ uintptr_t IntrControllerAddr = configINTERRUPT_CONTROLLER_BASE_ADDRESS;
 #endif
 
 /* Saved as part of the task context.  If ullPortTaskHasFPUContext is non-zero
-then floating point context must be saved and restored for the task. */
-uint64_t ullPortTaskHasFPUContext = pdFALSE;
+then floating point context must be saved and restored for the task.
 
-/* Set to 1 to pend a context switch from an ISR. */
-uint64_t ullPortYieldRequired = pdFALSE;
+ullPortYieldRequired is set to 1 to pend a context switch from an ISR.
+
+ullPortInterruptNesting counts the interrupt nesting depth.  A context switch is
+only performed if if the nesting depth is 0.
+
+With configUSE_LAZY_FPU_SWITCHING ullPortTaskFPUContext replaces
+ullPortTaskHasFPUContext.  It holds the address of the FPU context area of the
+running task, and ullPortFPUOwner the address of the area of the task whose
+context is in the FPU registers, or 0 if the registers hold no task context.
+
+With configNUMBER_OF_CORES > 1 each core has its own entry. */
+#if ( configNUMBER_OF_CORES > 1 )
+#if ( configUSE_LAZY_FPU_SWITCHING == 1 )
+uint64_t ullPortTaskFPUContext[ configNUMBER_OF_CORES ];
+uint64_t ullPortFPUOwner[ configNUMBER_OF_CORES ];
+#else
+uint64_t ullPortTaskHasFPUContext[ configNUMBER_OF_CORES ];
+#endif
+uint64_t ullPortYieldRequired[ configNUMBER_OF_CORES ];
+uint64_t ullPortInterruptNesting[ configNUMBER_OF_CORES ];
 
-/* Counts the interrupt nesting depth.  A context switch is only performed if
-if the nesting depth is 0. */
+/* Recursive spin locks taken by the kernel, see vPortGetLock(). */
+typedef struct
+{
+	volatile uint32_t ulOwner;	/* Core holding the lock, or portLOCK_FREE. */
+	uint32_t ulCount;			/* Number of times the owner took the lock. */
+} PortSpinLock_t;
+
+static PortSpinLock_t xPortLocks[ portNUM_LOCKS ] = { [ 0 ... ( portNUM_LOCKS - 1U ) ] = { portLOCK_FREE, 0U } };
+
+/* Set by each secondary core when it is about to start its first task. */
+static volatile uint32_t ulPortCoreStarted[ configNUMBER_OF_CORES ];
+#else
+#if ( configUSE_LAZY_FPU_SWITCHING == 1 )
+uint64_t ullPortTaskFPUContext = 0;
+uint64_t ullPortFPUOwner = 0;
+#else
+uint64_t ullPortTaskHasFPUContext = pdFALSE;
+#endif
+uint64_t ullPortYieldRequired = pdFALSE;
 uint64_t ullPortInterruptNesting = 0;
+#endif
 /*
  * Global counter used for calculation of run time statistics of tasks.
  * Defined only when the relevant option is turned on
@@ -211,6 +290,10 @@ volatile uint32_t ulHighFrequencyTimerTicks;
  * registers, that means (64 * 8) 64 double words */
 #define portFPU_REGISTER_DOUBLE_WORDS ( 64 )
 
+/* The FPU context area of a task with lazy FPU switching, reserved at the top of
+ * its stack.  This is the 32 128-bit registers followed by FPSR and FPCR. */
+#define portFPU_CONTEXT_DOUBLE_WORDS ( portFPU_REGISTER_DOUBLE_WORDS + 2 )
+
 #if defined(GICv2)
 /* Used in the ASM code. */
 __attribute__(( used )) const uint64_t ullICCEOIR = portICCEOIR_END_OF_INTERRUPT_REGISTER_ADDRESS;
@@ -240,6 +323,16 @@ StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t px
 	/* Setup the initial stack of the task.  The stack is set exactly as
 	expected by the portRESTORE_CONTEXT() macro. */
 
+	#if( configUSE_LAZY_FPU_SWITCHING == 1 )
+		StackType_t *pxFPUContext;
+
+		/* The FPU context area of the task, initialised to 0.  The task uses it
+		 * the first time it executes a floating point instruction. */
+		pxTopOfStack -= portFPU_CONTEXT_DOUBLE_WORDS;
+		memset( pxTopOfStack, 0x00, portFPU_CONTEXT_DOUBLE_WORDS * sizeof( StackType_t ) );
+		pxFPUContext = pxTopOfStack;
+	#endif
+
 	/* First all the general purpose registers. */
 	pxTopOfStack--;
 	*pxTopOfStack = 0x0101010101010101ULL;	/* R1 */
@@ -312,7 +405,16 @@ StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t px
 
 	*pxTopOfStack = ( StackType_t ) pxCode; /* Exception return address. */
 	pxTopOfStack--;
-	#if( configUSE_TASK_FPU_SUPPORT == 1 )
+	#if( configUSE_LAZY_FPU_SWITCHING == 1 )
+	{
+		/* The task will start with a critical nesting count of 0 as interrupts
+		 * are enabled.  In place of the FPU context indicator, the frame holds
+		 * the address of the FPU context area. */
+		*pxTopOfStack = portNO_CRITICAL_NESTING;
+		pxTopOfStack--;
+		*pxTopOfStack = ( StackType_t ) pxFPUContext;
+	}
+	#elif( configUSE_TASK_FPU_SUPPORT == 1 )
 	{
 	/* The task will start with a critical nesting count of 0 as interrupts are
 		enabled. */
@@ -336,7 +438,7 @@ StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t px
 		*pxTopOfStack = portNO_CRITICAL_NESTING;
 		pxTopOfStack--;
 		*pxTopOfStack = pdTRUE;
-		ullPortTaskHasFPUContext = pdTRUE;
+		portTHIS_CORE( ullPortTaskHasFPUContext ) = pdTRUE;
 	}
 	#else
 	{
@@ -487,6 +589,41 @@ int32_t lReturn;
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+#ifndef XPAR_XILTIMER_ENABLED
+void vPortDeferInterruptFromISR( uint8_t ucInterruptID, TaskHandle_t xHandlerTask )
+#else
+void vPortDeferInterruptFromISR( uint16_t ucInterruptID, TaskHandle_t xHandlerTask )
+#endif
+{
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	/* The source stays masked until the task has serviced the peripheral, a
+	level sensitive interrupt would otherwise be taken again on exit. */
+	vPortDisableInterrupt( ucInterruptID );
+	vTaskNotifyGiveFromISR( xHandlerTask, &xHigherPriorityTaskWoken );
+	portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+}
+/*-----------------------------------------------------------*/
+
+#ifndef XPAR_XILTIMER_ENABLED
+BaseType_t xPortWaitDeferredInterrupt( uint8_t ucInterruptID, TickType_t xTicksToWait )
+#else
+BaseType_t xPortWaitDeferredInterrupt( uint16_t ucInterruptID, TickType_t xTicksToWait )
+#endif
+{
+	vPortEnableInterrupt( ucInterruptID );
+
+	if( ulTaskNotifyTake( pdTRUE, xTicksToWait ) == 0UL )
+	{
+		return pdFAIL;
+	}
+
+	return pdPASS;
+}
+/*-----------------------------------------------------------*/
+#endif /* configUSE_TASK_NOTIFICATIONS */
+
 BaseType_t xPortStartScheduler( void )
 {
 uint32_t ulAPSR;
@@ -569,9 +706,21 @@ uint32_t ulBpr;
 			executing. */
 			portDISABLE_INTERRUPTS();
 
-			/* Start the timer that generates the tick ISR. */
+			/* Initialise the trace of this core, if any. */
+			traceSTART();
+
+			/* Start the timer that generates the tick ISR.  With several
+			cores, the tick is only handled by this core. */
 			configSETUP_TICK_INTERRUPT();
 
+			#if ( configNUMBER_OF_CORES > 1 )
+			{
+				xPortInstallInterruptHandler( portYIELD_CORE_SGI_ID, prvYieldCoreHandler, NULL );
+				prvSetupYieldCoreInterrupt();
+				prvStartSecondaryCores();
+			}
+			#endif
+
 			/* Start the first task executing. */
 			vPortRestoreTaskContext();
 		}
@@ -585,10 +734,13 @@ void vPortEndScheduler( void )
 {
 	/* Not implemented in ports where there is nothing to return to.
 	Artificially force an assert. */
-	configASSERT( ullCriticalNesting == 1000ULL );
+	configASSERT( portTHIS_CORE( ullCriticalNesting ) == 1000ULL );
 }
 /*-----------------------------------------------------------*/
 
+#if ( configNUMBER_OF_CORES == 1 )
+/* With several cores the kernel implements the critical sections, see
+vTaskEnterCritical(). */
 void vPortEnterCritical( void )
 {
 	/* Mask interrupts up to the max syscall interrupt priority. */
@@ -625,10 +777,11 @@ void vPortExitCritical( void )
 		{
 			/* Critical nesting has reached zero so all interrupt priorities
 			should be unmasked. */
-			portCLEAR_INTERRUPT_MASK();
+			portUNMASK_INTERRUPT_PRIORITIES();
 		}
 	}
 }
+#endif /* configNUMBER_OF_CORES */
 /*-----------------------------------------------------------*/
 
 void FreeRTOS_Tick_Handler( void )
@@ -663,6 +816,11 @@ void FreeRTOS_Tick_Handler( void )
 		}
 #endif
 
+#if ( configUSE_INTERRUPT_NESTING == 1 )
+		/* The IRQs were enabled by FreeRTOS_IRQ_Handler to allow nesting. */
+		portDISABLE_INTERRUPTS();
+#endif
+
 	/* Interrupts should not be enabled before this point. */
 #if( configASSERT_DEFINED == 1 )
 		{
@@ -692,20 +850,38 @@ void FreeRTOS_Tick_Handler( void )
 		/* Increment the RTOS tick. */
 		if( xTaskIncrementTick() != pdFALSE )
 		{
-			ullPortYieldRequired = pdTRUE;
+			portTHIS_CORE( ullPortYieldRequired ) = pdTRUE;
 		}
 	}
 
 	/* Ensure all interrupt priorities are active again. */
-	portCLEAR_INTERRUPT_MASK();
+	portUNMASK_INTERRUPT_PRIORITIES();
+}
+/*-----------------------------------------------------------*/
+#if( configUSE_LAZY_FPU_SWITCHING == 1 ) && ( configNUMBER_OF_CORES == 1 )
+void vPortCleanUpTaskFPU( StackType_t *pxTopOfStack )
+{
+	/* The saved context of the task starts with the address of its FPU
+	context area.  Forget the FPU registers if they hold the context of the
+	task, so they are not written back once its stack is freed.  With several
+	cores the registers are written back when a task is switched out, and the
+	task being deleted does not run. */
+	portENTER_CRITICAL();
+	if( ullPortFPUOwner == ( uint64_t ) *pxTopOfStack )
+	{
+		ullPortFPUOwner = 0;
+	}
+	portEXIT_CRITICAL();
 }
+#endif /* configUSE_LAZY_FPU_SWITCHING */
 /*-----------------------------------------------------------*/
-#if( configUSE_TASK_FPU_SUPPORT != 2 )
+
+#if( configUSE_TASK_FPU_SUPPORT != 2 ) && ( configUSE_LAZY_FPU_SWITCHING != 1 )
 void vPortTaskUsesFPU( void )
 {
 	/* A task is registering the fact that it needs an FPU context.  Set the
 	FPU flag (which is saved as part of the task context). */
-	ullPortTaskHasFPUContext = pdTRUE;
+	portTHIS_CORE( ullPortTaskHasFPUContext ) = pdTRUE;
 
 	/* Consider initialising the FPSR here - but probably not necessary in
 	AArch64. */
@@ -717,7 +893,7 @@ void vPortClearInterruptMask( UBaseType_t uxNewMaskValue )
 {
 	if( uxNewMaskValue == pdFALSE )
 	{
-		portCLEAR_INTERRUPT_MASK();
+		portUNMASK_INTERRUPT_PRIORITIES();
 	}
 }
 /*-----------------------------------------------------------*/
@@ -822,6 +998,124 @@ static void prvTaskExitError( void )
 #endif /* configASSERT_DEFINED */
 /*-----------------------------------------------------------*/
 
+#if ( configNUMBER_OF_CORES > 1 )
+
+void vPortGetLock( uint32_t ulLock )
+{
+PortSpinLock_t * const pxLock = &( xPortLocks[ ulLock ] );
+const uint32_t ulCoreID = ( uint32_t ) portGET_CORE_ID();
+uint32_t ulExpected;
+
+	/* Interrupts must be masked by the caller.  The locks are recursive: the
+	task lock is taken again when the core that suspended the scheduler enters
+	a critical section. */
+	if( __atomic_load_n( &( pxLock->ulOwner ), __ATOMIC_RELAXED ) == ulCoreID )
+	{
+		pxLock->ulCount++;
+	}
+	else
+	{
+		do
+		{
+			while( __atomic_load_n( &( pxLock->ulOwner ), __ATOMIC_RELAXED ) != portLOCK_FREE )
+			{
+				portNOP();
+			}
+
+			ulExpected = portLOCK_FREE;
+		} while( __atomic_compare_exchange_n( &( pxLock->ulOwner ), &ulExpected, ulCoreID, pdFALSE, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED ) == pdFALSE );
+
+		pxLock->ulCount = 1U;
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortReleaseLock( uint32_t ulLock )
+{
+PortSpinLock_t * const pxLock = &( xPortLocks[ ulLock ] );
+
+	configASSERT( pxLock->ulOwner == ( uint32_t ) portGET_CORE_ID() );
+	configASSERT( pxLock->ulCount > 0U );
+
+	pxLock->ulCount--;
+	if( pxLock->ulCount == 0U )
+	{
+		__atomic_store_n( &( pxLock->ulOwner ), portLOCK_FREE, __ATOMIC_RELEASE );
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortYieldCore( BaseType_t xCoreID )
+{
+volatile uint32_t * const pulSGIRegister = ( volatile uint32_t * ) ( configINTERRUPT_CONTROLLER_BASE_ADDRESS + portSGI_REGISTER_OFFSET );
+
+	/* The kernel lists must be up to date before the core is interrupted.
+	The CPU interface numbers of the GIC are the core numbers. */
+	__asm volatile ( "DSB ISH" ::: "memory" );
+	*pulSGIRegister = ( uint32_t ) ( ( 1UL << ( portSGI_TARGET_LIST_SHIFT + ( uint32_t ) xCoreID ) ) | portYIELD_CORE_SGI_ID );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetupYieldCoreInterrupt( void )
+{
+volatile uint8_t * const pucPriorityRegister = ( volatile uint8_t * ) ( configINTERRUPT_CONTROLLER_BASE_ADDRESS + portINTERRUPT_PRIORITY_REGISTER_OFFSET + portYIELD_CORE_SGI_ID );
+volatile uint32_t * const pulEnableRegister = ( volatile uint32_t * ) ( configINTERRUPT_CONTROLLER_BASE_ADDRESS + portINTERRUPT_ENABLE_SET_REGISTER_OFFSET );
+
+	/* The same priority as the tick, so the context switch is performed when
+	the interrupt nesting unwinds. */
+	*pucPriorityRegister = ( uint8_t ) ( portLOWEST_USABLE_INTERRUPT_PRIORITY << portPRIORITY_SHIFT );
+	*pulEnableRegister = ( uint32_t ) ( 1UL << portYIELD_CORE_SGI_ID );
+	__asm volatile ( "DSB SY" ::: "memory" );
+}
+/*-----------------------------------------------------------*/
+
+static void prvYieldCoreHandler( void *pvUnused )
+{
+	( void ) pvUnused;
+	portYIELD_FROM_ISR( pdTRUE );
+}
+/*-----------------------------------------------------------*/
+
+static void prvStartSecondaryCores( void )
+{
+BaseType_t xCoreID;
+
+	vPortStartSecondaryCores();
+
+	for( xCoreID = 1; xCoreID < configNUMBER_OF_CORES; xCoreID++ )
+	{
+		while( ulPortCoreStarted[ xCoreID ] == pdFALSE )
+		{
+			portNOP();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortSecondaryCoreMain( void )
+{
+	/* Called by vPortSecondaryCoreReset() with the MMU and the caches enabled.
+	Enable the GIC CPU interface of this core as the driver did for the first
+	core, with the interrupts masked until the first task starts. */
+	portICCPMR_PRIORITY_MASK_REGISTER = ( uint32_t ) ( configMAX_API_CALL_INTERRUPT_PRIORITY << portPRIORITY_SHIFT );
+	portICCICR_CPU_INTERFACE_CONTROL_REGISTER = portICCICR_ENABLE;
+	configASSERT( ( portICCBPR_BINARY_POINT_REGISTER & portBINARY_POINT_BITS ) <= portMAX_BINARY_POINT_VALUE );
+
+	prvSetupYieldCoreInterrupt();
+
+	traceSTART();
+
+	ulPortCoreStarted[ portGET_CORE_ID() ] = pdTRUE;
+
+	/* The kernel selected the first task of this core before the core was
+	released from reset. */
+	portDISABLE_INTERRUPTS();
+	vPortRestoreTaskContext();
+}
+
+#endif /* configNUMBER_OF_CORES */
+/*-----------------------------------------------------------*/
+
 #if( configGENERATE_RUN_TIME_STATS == 1 )
 /*
  * For Xilinx implementation this is a dummy function that does a redundant operation
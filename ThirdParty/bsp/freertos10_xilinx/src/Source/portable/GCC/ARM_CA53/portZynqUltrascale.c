@@ -36,6 +36,10 @@
 #else
 #include "xiltimer.h"
 #endif
+#if ( configNUMBER_OF_CORES > 1 )
+#include "xil_io.h"
+#include "xil_cache.h"
+#endif
 
 void vApplicationAssert( const char *pcFileName, uint32_t ulLine )
 		__attribute__((weak));
@@ -64,6 +68,40 @@ XScuGic xInterruptController;
 #else
 extern uintptr_t IntrControllerAddr;
 #endif
+
+#if ( configUSE_TICKLESS_IDLE == 1 )
+#ifdef XPAR_XILTIMER_ENABLED
+	#error configUSE_TICKLESS_IDLE requires the tick to be generated by a TTC without xiltimer
+#endif
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+	#error configUSE_TICKLESS_IDLE cannot be used with configGENERATE_RUN_TIME_STATS
+#endif
+
+/* Number of TTC counts in one tick, and the maximum number of ticks the TTC
+interval can hold. */
+static uint32_t ulTimerCountsForOneTick;
+static TickType_t xMaximumPossibleSuppressedTicks;
+
+/* Set when the TTC interval was loaded with the end of a partial tick, the
+next tick interrupt restores the interval of one tick. */
+static volatile uint32_t ulTickIntervalRestore;
+#endif
+
+#if ( configNUMBER_OF_CORES > 1 )
+/* Reset vector base address of each APU core, and the APU reset control. */
+#define portAPU_RVBAR_ADDRESS( xCoreID )		( 0xFD5C0040UL + ( ( UINTPTR ) ( xCoreID ) * 8UL ) )
+#define portCRF_APB_RST_FPD_APU				( 0xFD1A0104UL )
+#define portACPU_RESET_MASK( xCoreID )			( ( 1UL << ( xCoreID ) ) | ( 1UL << ( ( xCoreID ) + 10UL ) ) )
+
+/* EL3 stack of each secondary core, used until its first task starts and then
+by the interrupt handlers. */
+#define portSECONDARY_CORE_STACK_SIZE			( 0x2000U )
+static uint8_t ucSecondaryCoreStacks[ configNUMBER_OF_CORES - 1 ][ portSECONDARY_CORE_STACK_SIZE ] __attribute__( ( aligned( 16 ) ) );
+
+/* Top of the stacks, read by vPortSecondaryCoreReset() before it enables the
+MMU and the caches. */
+uint64_t ullPortSecondaryCoreStacks[ configNUMBER_OF_CORES ];
+#endif
 /*-----------------------------------------------------------*/
 
 #ifndef XPAR_XILTIMER_ENABLED
@@ -104,6 +142,10 @@ const uint8_t ucLevelSensitive = 1;
 
 	/* Set the interval and prescale. */
 	XTtcPs_SetInterval( &xTimerInstance, usInterval );
+#if ( configUSE_TICKLESS_IDLE == 1 )
+	ulTimerCountsForOneTick = ( uint32_t ) usInterval;
+	xMaximumPossibleSuppressedTicks = ( TickType_t ) ( XTTCPS_MAX_INTERVAL_COUNT / ulTimerCountsForOneTick );
+#endif
 	XTtcPs_SetPrescaler( &xTimerInstance, ucPrescale );
 
 	xPortInstallInterruptHandler(configTIMER_INTERRUPT_ID,
@@ -152,18 +194,143 @@ void FreeRTOS_SetupTickInterrupt( void )
 #endif
 /*-----------------------------------------------------------*/
 
+#if ( configNUMBER_OF_CORES > 1 )
+void vPortStartSecondaryCores( void )
+{
+extern void vPortSecondaryCoreReset( void );
+BaseType_t xCoreID;
+uint32_t ulReset;
+
+	for( xCoreID = 1; xCoreID < configNUMBER_OF_CORES; xCoreID++ )
+	{
+		ullPortSecondaryCoreStacks[ xCoreID ] = ( uint64_t ) ( UINTPTR ) &( ucSecondaryCoreStacks[ xCoreID - 1 ][ portSECONDARY_CORE_STACK_SIZE ] );
+		Xil_Out64( portAPU_RVBAR_ADDRESS( xCoreID ), ( uint64_t ) ( UINTPTR ) vPortSecondaryCoreReset );
+	}
+
+	/* The cores read their stack with the caches disabled. */
+	Xil_DCacheFlushRange( ( INTPTR ) ullPortSecondaryCoreStacks, sizeof( ullPortSecondaryCoreStacks ) );
+
+	/* The cores are powered up by the boot flow, release them from reset. */
+	ulReset = Xil_In32( portCRF_APB_RST_FPD_APU );
+	for( xCoreID = 1; xCoreID < configNUMBER_OF_CORES; xCoreID++ )
+	{
+		ulReset &= ~portACPU_RESET_MASK( xCoreID );
+	}
+	Xil_Out32( portCRF_APB_RST_FPD_APU, ulReset );
+}
+/*-----------------------------------------------------------*/
+#endif
+
 void FreeRTOS_ClearTickInterrupt( void )
 {
 #ifndef XPAR_XILTIMER_ENABLED
 	XTtcPs_ClearInterruptStatus( &xTimerInstance, XTtcPs_GetInterruptStatus( &xTimerInstance ) );
 	__asm volatile( "DSB SY" );
 	__asm volatile( "ISB SY" );
+#if ( configUSE_TICKLESS_IDLE == 1 )
+	if( ulTickIntervalRestore != 0U )
+	{
+		XTtcPs_SetInterval( &xTimerInstance, ulTimerCountsForOneTick );
+		ulTickIntervalRestore = 0U;
+	}
+#endif
 #else
 	XTimer_ClearTickInterrupt();
 #endif
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TICKLESS_IDLE == 1 )
+/*
+ * Called by the idle task, with the scheduler suspended, when no task is due
+ * to run for at least configEXPECTED_IDLE_TIME_BEFORE_SLEEP ticks.  The TTC is
+ * loaded with the time to the next unblock and the core waits in WFI, then the
+ * tick count is stepped by the number of ticks that elapsed in the sleep.
+ */
+void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
+{
+uint32_t ulCountAtSleep, ulReloadValue, ulCount, ulCompleteTickPeriods;
+TickType_t xModifiableIdleTime;
+
+	if( xExpectedIdleTime > xMaximumPossibleSuppressedTicks )
+	{
+		xExpectedIdleTime = xMaximumPossibleSuppressedTicks;
+	}
+
+	/* Mask the IRQs in the CPU only, a pending interrupt still ends the WFI.
+	The TTC is stopped while it is reloaded, this loses a few counts. */
+	portDISABLE_INTERRUPTS();
+	XTtcPs_Stop( &xTimerInstance );
+	ulCountAtSleep = XTtcPs_GetCounterValue( &xTimerInstance );
+
+	/* Reading the status clears the interrupt, a tick that ended since the
+	IRQs were masked is counted here instead of in the tick interrupt. */
+	if( ( XTtcPs_GetInterruptStatus( &xTimerInstance ) & XTTCPS_IXR_INTERVAL_MASK ) != 0U )
+	{
+		( void ) xTaskIncrementTick();
+		XTtcPs_Start( &xTimerInstance );
+		portENABLE_INTERRUPTS();
+		return;
+	}
+
+	if( eTaskConfirmSleepModeStatus() == eAbortSleep )
+	{
+		/* A task was readied while the scheduler was suspended, resume the
+		current tick where it stopped. */
+		XTtcPs_Start( &xTimerInstance );
+		portENABLE_INTERRUPTS();
+		return;
+	}
+
+	/* Interrupt at the end of the current tick plus the idle ticks. */
+	ulReloadValue = ( ulTimerCountsForOneTick * ( uint32_t ) xExpectedIdleTime ) - ulCountAtSleep;
+	XTtcPs_SetInterval( &xTimerInstance, ulReloadValue );
+	XTtcPs_ResetCounterValue( &xTimerInstance );
+	XTtcPs_Start( &xTimerInstance );
+
+	/* The application can stop the clocks in configPRE_SLEEP_PROCESSING(),
+	and set xModifiableIdleTime to 0 if it did the sleep itself. */
+	xModifiableIdleTime = xExpectedIdleTime;
+	configPRE_SLEEP_PROCESSING( xModifiableIdleTime );
+	if( xModifiableIdleTime > 0 )
+	{
+		__asm volatile ( "DSB SY" ::: "memory" );
+		__asm volatile ( "WFI" );
+		__asm volatile ( "ISB SY" );
+	}
+	configPOST_SLEEP_PROCESSING( xExpectedIdleTime );
+
+	XTtcPs_Stop( &xTimerInstance );
+	ulCount = XTtcPs_GetCounterValue( &xTimerInstance );
+
+	/* As above, the tick at the end of the sleep is counted here. */
+	if( ( XTtcPs_GetInterruptStatus( &xTimerInstance ) & XTTCPS_IXR_INTERVAL_MASK ) != 0U )
+	{
+		/* The counter restarted at the end of the sleep. */
+		vTaskStepTick( xExpectedIdleTime - 1 );
+		( void ) xTaskIncrementTick();
+	}
+	else
+	{
+		/* Woken by another interrupt, count the complete ticks only. */
+		ulCount += ulCountAtSleep;
+		ulCompleteTickPeriods = ulCount / ulTimerCountsForOneTick;
+		ulCount %= ulTimerCountsForOneTick;
+		vTaskStepTick( ( TickType_t ) ulCompleteTickPeriods );
+	}
+
+	/* Interrupt at the end of the tick in progress, the tick interrupt then
+	restores the interval of one tick. */
+	XTtcPs_SetInterval( &xTimerInstance, ulTimerCountsForOneTick - ( ulCount % ulTimerCountsForOneTick ) );
+	ulTickIntervalRestore = 1U;
+	XTtcPs_ResetCounterValue( &xTimerInstance );
+	XTtcPs_Start( &xTimerInstance );
+
+	portENABLE_INTERRUPTS();
+}
+/*-----------------------------------------------------------*/
+#endif
+
 void vApplicationIRQHandler( uint32_t ulICCIAR )
 {
 extern XScuGic_Config XScuGic_ConfigTable[];
@@ -171,18 +338,18 @@ static const XScuGic_VectorTableEntry *pxVectorTable = XScuGic_ConfigTable[ XPAR
 uint32_t ulInterruptID;
 const XScuGic_VectorTableEntry *pxVectorEntry;
 
-	/* Interrupts cannot be re-enabled until the source of the interrupt is
-	cleared. The ID of the interrupt is obtained by bitwise ANDing the ICCIAR
-	value with 0x3FF. */
+	/* The ID of the interrupt is obtained by bitwise ANDing the ICCIAR value
+	with 0x3FF.  The spurious interrupt ID 1023 is out of the table range. */
 	ulInterruptID = ulICCIAR & 0x3FFUL;
 
 	if( ulInterruptID < XSCUGIC_MAX_NUM_INTR_INPUTS )
 	{
 		/* Call the function installed in the array of installed handler
-		functions. */
+		functions directly, the entry is indexed by the interrupt ID. */
 		pxVectorEntry = &( pxVectorTable[ ulInterruptID ] );
-		configASSERT( pxVectorEntry );
+		traceISR_ENTER( ulInterruptID );
 		pxVectorEntry->Handler( pxVectorEntry->CallBackRef );
+		traceISR_EXIT( ulInterruptID );
 	}
 }
 /*-----------------------------------------------------------*/
@@ -85,6 +85,17 @@ typedef uint64_t TickType_t;
 /* Task utilities. */
 
 /* Called at the end of an ISR that can cause a context switch. */
+#if ( configNUMBER_OF_CORES > 1 )
+#define portEND_SWITCHING_ISR( xSwitchRequired )\
+{												\
+extern uint64_t ullPortYieldRequired[];			\
+												\
+	if( xSwitchRequired != pdFALSE )			\
+	{											\
+		ullPortYieldRequired[ portGET_CORE_ID() ] = pdTRUE;	\
+	}											\
+}
+#else
 #define portEND_SWITCHING_ISR( xSwitchRequired )\
 {												\
 extern uint64_t ullPortYieldRequired;			\
@@ -94,6 +105,7 @@ extern uint64_t ullPortYieldRequired;			\
 		ullPortYieldRequired = pdTRUE;			\
 	}											\
 }
+#endif
 
 #define portYIELD_FROM_ISR( x ) portEND_SWITCHING_ISR( x )
 #if defined(versal)
@@ -151,8 +163,88 @@ extern void vPortInstallFreeRTOSVectorTable( void );
 
 /* These macros do not globally disable/enable interrupts.  They do mask off
 interrupts that have a priority below configMAX_API_CALL_INTERRUPT_PRIORITY. */
+#if ( configNUMBER_OF_CORES > 1 )
+/* The kernel also takes the spin locks that serialise the cores. */
+extern void vTaskEnterCritical( void );
+extern void vTaskExitCritical( void );
+extern UBaseType_t vTaskEnterCriticalFromISR( void );
+extern void vTaskExitCriticalFromISR( UBaseType_t uxSavedInterruptStatus );
+extern void vTaskYieldWithinAPI( void );
+
+#define portENTER_CRITICAL()		vTaskEnterCritical();
+#define portEXIT_CRITICAL()			vTaskExitCritical();
+#define portSET_INTERRUPT_MASK_FROM_ISR()			vTaskEnterCriticalFromISR()
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR( x )		vTaskExitCriticalFromISR( x )
+#define portSET_INTERRUPT_MASK()					uxPortSetInterruptMask()
+#define portCLEAR_INTERRUPT_MASK( x )				vPortClearInterruptMask( x )
+
+/* A yield requested inside a critical section is held pending until the
+critical section is exited, as the spin locks must be released first. */
+#define portYIELD_WITHIN_API()		vTaskYieldWithinAPI()
+#else
 #define portENTER_CRITICAL()		vPortEnterCritical();
 #define portEXIT_CRITICAL()			vPortExitCritical();
+#endif
+
+/*-----------------------------------------------------------
+ * SMP support
+ *----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+#if defined (versal) || EL1_NONSECURE
+	#error configNUMBER_OF_CORES > 1 is only supported on the Zynq UltraScale+ MPSoC APU at EL3
+#endif
+
+/* The tasks are partitioned between the cores, see vTaskCoreAffinitySet().
+The core number is the affinity level 0 field of MPIDR_EL1. */
+#define portGET_CORE_ID()			( ( BaseType_t ) ( mfcp( MPIDR_EL1 ) & 0xFFU ) )
+
+/* Disable the IRQs and return the previous DAIF value, so the calling task
+cannot move to another core while it reads the data of its core.  Unlike
+portSET_INTERRUPT_MASK() this can be used with the IRQs already disabled. */
+#define portDISABLE_INTERRUPTS_SAVE()								\
+	( {																\
+		uint64_t ullDAIF;											\
+		__asm volatile ( "MRS %0, DAIF" : "=r" ( ullDAIF ) :: "memory" );	\
+		portDISABLE_INTERRUPTS();									\
+		( UBaseType_t ) ullDAIF;									\
+	} )
+#define portRESTORE_INTERRUPTS( x )									\
+	__asm volatile ( "MSR DAIF, %0" :: "r" ( ( uint64_t ) ( x ) ) : "memory" )
+
+/* Software generated interrupt sent to a core to make it reschedule. */
+#define portYIELD_CORE_SGI_ID		( 0U )
+extern void vPortYieldCore( BaseType_t xCoreID );
+#define portYIELD_CORE( xCoreID )	vPortYieldCore( xCoreID )
+
+/* The task lock serialises the access to the kernel lists from the tasks, and
+is held while the scheduler is suspended.  The ISR lock is also taken by the
+interrupt safe API functions.  The task lock is always taken first. */
+#define portTASK_LOCK				( 0U )
+#define portISR_LOCK				( 1U )
+extern void vPortGetLock( uint32_t ulLock );
+extern void vPortReleaseLock( uint32_t ulLock );
+#define portGET_TASK_LOCK()			vPortGetLock( portTASK_LOCK )
+#define portRELEASE_TASK_LOCK()		vPortReleaseLock( portTASK_LOCK )
+#define portGET_ISR_LOCK()			vPortGetLock( portISR_LOCK )
+#define portRELEASE_ISR_LOCK()		vPortReleaseLock( portISR_LOCK )
+
+/* The critical nesting count and the interrupt nesting count of each core,
+shared with the ASM code. */
+extern volatile uint64_t ullCriticalNesting[];
+extern uint64_t ullPortInterruptNesting[];
+#define portGET_CRITICAL_NESTING_COUNT()			( ullCriticalNesting[ portGET_CORE_ID() ] )
+#define portINCREMENT_CRITICAL_NESTING_COUNT()		( ullCriticalNesting[ portGET_CORE_ID() ]++ )
+#define portDECREMENT_CRITICAL_NESTING_COUNT()		( ullCriticalNesting[ portGET_CORE_ID() ]-- )
+#define portCHECK_IF_IN_ISR()						( ullPortInterruptNesting[ portGET_CORE_ID() ] != 0ULL )
+
+/* Releases the secondary cores from reset, implemented by the platform file.
+Each core then calls vPortSecondaryCoreMain() to start its first task. */
+void vPortStartSecondaryCores( void );
+void vPortSecondaryCoreMain( void );
+
+#endif /* configNUMBER_OF_CORES */
 
 /*-----------------------------------------------------------*/
 
@@ -162,10 +254,25 @@ macros is used. */
 #define portTASK_FUNCTION_PROTO( vFunction, pvParameters )	void vFunction( void *pvParameters )
 #define portTASK_FUNCTION( vFunction, pvParameters )	void vFunction( void *pvParameters )
 
+/* When set to 1 in bspconfig.h, the interrupts of a higher GIC priority can
+preempt an interrupt handler.  Only the interrupts above
+configMAX_API_CALL_INTERRUPT_PRIORITY also preempt the kernel critical
+sections. */
+#ifndef configUSE_INTERRUPT_NESTING
+	#define configUSE_INTERRUPT_NESTING		0
+#endif
+
 /* Prototype of the FreeRTOS tick handler.  This must be installed as the
 handler for whichever peripheral is used to generate the RTOS tick. */
 void FreeRTOS_Tick_Handler( void );
 
+/* Tickless idle, the TTC that generates the tick is reloaded with the idle
+time, see vPortSuppressTicksAndSleep() in portZynqUltrascale.c. */
+#if ( configUSE_TICKLESS_IDLE == 1 )
+void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime );
+#define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime )	vPortSuppressTicksAndSleep( xExpectedIdleTime )
+#endif
+
 /*
  * Installs pxHandler as the interrupt handler for the peripheral specified by
  * the ucInterruptID parameter.
@@ -229,9 +336,35 @@ void vPortDisableInterrupt( uint8_t ucInterruptID );
 void vPortDisableInterrupt( uint16_t ucInterruptID );
 #endif
 
+/*
+ * Deferred interrupt handling.  Called from the handler of the interrupt
+ * specified by the ucInterruptID parameter, vPortDeferInterruptFromISR()
+ * disables the interrupt and notifies xHandlerTask.  The task services the
+ * peripheral, then calls xPortWaitDeferredInterrupt(), which enables the
+ * interrupt again and waits for the next notification.  It returns pdFAIL if
+ * xTicksToWait expires first.  Requires configUSE_TASK_NOTIFICATIONS.
+ */
+struct tskTaskControlBlock;
+#ifndef XPAR_XILTIMER_ENABLED
+void vPortDeferInterruptFromISR( uint8_t ucInterruptID, struct tskTaskControlBlock *xHandlerTask );
+BaseType_t xPortWaitDeferredInterrupt( uint8_t ucInterruptID, TickType_t xTicksToWait );
+#else
+void vPortDeferInterruptFromISR( uint16_t ucInterruptID, struct tskTaskControlBlock *xHandlerTask );
+BaseType_t xPortWaitDeferredInterrupt( uint16_t ucInterruptID, TickType_t xTicksToWait );
+#endif
+
 /* Any task that uses the floating point unit MUST call vPortTaskUsesFPU()
 before any floating point instructions are executed. */
-#if( configUSE_TASK_FPU_SUPPORT != 2 )
+#if( configUSE_LAZY_FPU_SWITCHING == 1 )
+	/* Each task has an FPU context, loaded the first time it uses the FPU
+	after another task did. */
+	#define vPortTaskUsesFPU()
+
+	#if( configNUMBER_OF_CORES == 1 )
+		void vPortCleanUpTaskFPU( StackType_t *pxTopOfStack );
+		#define portCLEAN_UP_TCB( pxTCB ) vPortCleanUpTaskFPU( ( StackType_t * ) ( pxTCB )->pxTopOfStack )
+	#endif
+#elif( configUSE_TASK_FPU_SUPPORT != 2 )
 void vPortTaskUsesFPU( void );
 #else
 	/* Each task has an FPU context already, so define this function away to
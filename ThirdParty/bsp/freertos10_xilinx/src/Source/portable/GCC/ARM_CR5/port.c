@@ -556,6 +556,9 @@ uint32_t ulBpr;
 			executing. */
 			portCPU_IRQ_DISABLE();
 
+			/* Initialise the trace, if any. */
+			traceSTART();
+
 			/* Start the timer that generates the tick ISR. */
 			configSETUP_TICK_INTERRUPT();
 
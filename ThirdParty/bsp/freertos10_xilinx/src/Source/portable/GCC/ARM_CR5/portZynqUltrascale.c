@@ -76,6 +76,24 @@ XScuGic xInterruptController;
 #else
 extern uintptr_t IntrControllerAddr;
 #endif
+
+#if ( configUSE_TICKLESS_IDLE == 1 )
+#ifdef XPAR_XILTIMER_ENABLED
+	#error configUSE_TICKLESS_IDLE requires the tick to be generated by a TTC without xiltimer
+#endif
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+	#error configUSE_TICKLESS_IDLE cannot be used with configGENERATE_RUN_TIME_STATS
+#endif
+
+/* Number of TTC counts in one tick, and the maximum number of ticks the TTC
+interval can hold. */
+static uint32_t ulTimerCountsForOneTick;
+static TickType_t xMaximumPossibleSuppressedTicks;
+
+/* Set when the TTC interval was loaded with the end of a partial tick, the
+next tick interrupt restores the interval of one tick. */
+static volatile uint32_t ulTickIntervalRestore;
+#endif
 /*-----------------------------------------------------------*/
 
 #ifndef XPAR_XILTIMER_ENABLED
@@ -134,6 +152,10 @@ XScuGic_Config *pxInterruptControllerConfig;
 	XTtcPs_CalcIntervalFromFreq( &xTimerInstance, configTICK_RATE_HZ, &usInterval, &ucPrescaler );
 #endif
 	XTtcPs_SetInterval( &xTimerInstance, usInterval );
+#if ( configUSE_TICKLESS_IDLE == 1 )
+	ulTimerCountsForOneTick = ( uint32_t ) usInterval;
+	xMaximumPossibleSuppressedTicks = ( TickType_t ) ( XTTCPS_MAX_INTERVAL_COUNT / ulTimerCountsForOneTick );
+#endif
 	XTtcPs_SetPrescaler( &xTimerInstance, ucPrescaler );
 	/* Enable the interrupt for timer. */
 	XScuGic_EnableIntr( configINTERRUPT_CONTROLLER_BASE_ADDRESS, configTIMER_INTERRUPT_ID );
@@ -178,12 +200,118 @@ void FreeRTOS_ClearTickInterrupt( void )
 {
 #ifndef XPAR_XILTIMER_ENABLED
 	XTtcPs_ClearInterruptStatus( &xTimerInstance, XTtcPs_GetInterruptStatus( &xTimerInstance ) );
+#if ( configUSE_TICKLESS_IDLE == 1 )
+	if( ulTickIntervalRestore != 0U )
+	{
+		XTtcPs_SetInterval( &xTimerInstance, ulTimerCountsForOneTick );
+		ulTickIntervalRestore = 0U;
+	}
+#endif
 #else
 	XTimer_ClearTickInterrupt();
 #endif
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TICKLESS_IDLE == 1 )
+/*
+ * Called by the idle task, with the scheduler suspended, when no task is due
+ * to run for at least configEXPECTED_IDLE_TIME_BEFORE_SLEEP ticks.  The TTC is
+ * loaded with the time to the next unblock and the core waits in WFI, then the
+ * tick count is stepped by the number of ticks that elapsed in the sleep.
+ */
+void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
+{
+uint32_t ulCountAtSleep, ulReloadValue, ulCount, ulCompleteTickPeriods;
+TickType_t xModifiableIdleTime;
+
+	if( xExpectedIdleTime > xMaximumPossibleSuppressedTicks )
+	{
+		xExpectedIdleTime = xMaximumPossibleSuppressedTicks;
+	}
+
+	/* Mask the IRQs in the CPU only, a pending interrupt still ends the WFI.
+	The TTC is stopped while it is reloaded, this loses a few counts. */
+	__asm volatile ( "CPSID i" ::: "memory" );
+	__asm volatile ( "DSB" );
+	__asm volatile ( "ISB" );
+	XTtcPs_Stop( &xTimerInstance );
+	ulCountAtSleep = XTtcPs_GetCounterValue( &xTimerInstance );
+
+	/* Reading the status clears the interrupt, a tick that ended since the
+	IRQs were masked is counted here instead of in the tick interrupt. */
+	if( ( XTtcPs_GetInterruptStatus( &xTimerInstance ) & XTTCPS_IXR_INTERVAL_MASK ) != 0U )
+	{
+		( void ) xTaskIncrementTick();
+		XTtcPs_Start( &xTimerInstance );
+		__asm volatile ( "CPSIE i" ::: "memory" );
+		__asm volatile ( "DSB" );
+		__asm volatile ( "ISB" );
+		return;
+	}
+
+	if( eTaskConfirmSleepModeStatus() == eAbortSleep )
+	{
+		/* A task was readied while the scheduler was suspended, resume the
+		current tick where it stopped. */
+		XTtcPs_Start( &xTimerInstance );
+		__asm volatile ( "CPSIE i" ::: "memory" );
+		__asm volatile ( "DSB" );
+		__asm volatile ( "ISB" );
+		return;
+	}
+
+	/* Interrupt at the end of the current tick plus the idle ticks. */
+	ulReloadValue = ( ulTimerCountsForOneTick * ( uint32_t ) xExpectedIdleTime ) - ulCountAtSleep;
+	XTtcPs_SetInterval( &xTimerInstance, ulReloadValue );
+	XTtcPs_ResetCounterValue( &xTimerInstance );
+	XTtcPs_Start( &xTimerInstance );
+
+	/* The application can stop the clocks in configPRE_SLEEP_PROCESSING(),
+	and set xModifiableIdleTime to 0 if it did the sleep itself. */
+	xModifiableIdleTime = xExpectedIdleTime;
+	configPRE_SLEEP_PROCESSING( xModifiableIdleTime );
+	if( xModifiableIdleTime > 0 )
+	{
+		__asm volatile ( "DSB" ::: "memory" );
+		__asm volatile ( "WFI" );
+		__asm volatile ( "ISB" );
+	}
+	configPOST_SLEEP_PROCESSING( xExpectedIdleTime );
+
+	XTtcPs_Stop( &xTimerInstance );
+	ulCount = XTtcPs_GetCounterValue( &xTimerInstance );
+
+	/* As above, the tick at the end of the sleep is counted here. */
+	if( ( XTtcPs_GetInterruptStatus( &xTimerInstance ) & XTTCPS_IXR_INTERVAL_MASK ) != 0U )
+	{
+		/* The counter restarted at the end of the sleep. */
+		vTaskStepTick( xExpectedIdleTime - 1 );
+		( void ) xTaskIncrementTick();
+	}
+	else
+	{
+		/* Woken by another interrupt, count the complete ticks only. */
+		ulCount += ulCountAtSleep;
+		ulCompleteTickPeriods = ulCount / ulTimerCountsForOneTick;
+		ulCount %= ulTimerCountsForOneTick;
+		vTaskStepTick( ( TickType_t ) ulCompleteTickPeriods );
+	}
+
+	/* Interrupt at the end of the tick in progress, the tick interrupt then
+	restores the interval of one tick. */
+	XTtcPs_SetInterval( &xTimerInstance, ulTimerCountsForOneTick - ( ulCount % ulTimerCountsForOneTick ) );
+	ulTickIntervalRestore = 1U;
+	XTtcPs_ResetCounterValue( &xTimerInstance );
+	XTtcPs_Start( &xTimerInstance );
+
+	__asm volatile ( "CPSIE i" ::: "memory" );
+	__asm volatile ( "DSB" );
+	__asm volatile ( "ISB" );
+}
+/*-----------------------------------------------------------*/
+#endif
+
 void vApplicationIRQHandler( uint32_t ulICCIAR )
 {
 extern XScuGic_Config XScuGic_ConfigTable[];
@@ -199,7 +327,9 @@ const XScuGic_VectorTableEntry *pxVectorEntry;
 		/* Call the function installed in the array of installed handler
 		functions. */
 		pxVectorEntry = &( pxVectorTable[ ulInterruptID ] );
+		traceISR_ENTER( ulInterruptID );
 		pxVectorEntry->Handler( pxVectorEntry->CallBackRef );
+		traceISR_EXIT( ulInterruptID );
 	}
 }
 /*-----------------------------------------------------------*/
@@ -118,6 +118,13 @@ macros is used. */
 handler for whichever peripheral is used to generate the RTOS tick. */
 void FreeRTOS_Tick_Handler( void );
 
+/* Tickless idle, the TTC that generates the tick is reloaded with the idle
+time, see vPortSuppressTicksAndSleep() in portZynqUltrascale.c. */
+#if ( configUSE_TICKLESS_IDLE == 1 )
+void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime );
+#define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime )	vPortSuppressTicksAndSleep( xExpectedIdleTime )
+#endif
+
 /*
  * Installs pxHandler as the interrupt handler for the peripheral specified by
  * the ucInterruptID parameter.
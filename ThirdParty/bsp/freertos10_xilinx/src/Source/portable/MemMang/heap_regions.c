@@ -0,0 +1,799 @@
+/*
+ * FreeRTOS Kernel V10.4.6
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ * Copyright (C) 2026 Xilinx, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * A variant of heap_5.c where each heap region is managed separately, so that
+ * an allocation can be placed in a given memory, for example the TCM or the
+ * OCM for the small objects used by the time critical tasks, and the DDR for
+ * the large buffers.
+ *
+ * Each region has its own address ordered free list, which combines
+ * (coalescences) adjacent blocks as they are freed, like heap_5.c.  The small
+ * blocks are in addition kept in per-region size class caches when they are
+ * freed, so allocating and freeing a small block is O(1).  The blocks of a
+ * cache are returned to the free list of their region when an allocation
+ * cannot be satisfied from the free list.
+ *
+ * Usage notes:
+ *
+ * vPortDefineHeapRegions() defines the regions, as for heap_5.c.  The regions
+ * do not have to be in address order, but should be listed from the fastest
+ * memory to the largest memory.  Allocations that fit a size class are tried
+ * in the regions from the first to the last one, larger allocations from the
+ * last to the first one.  Up to configHEAP_MAX_REGIONS regions can be defined.
+ *
+ * HeapRegion_t xHeapRegions[] =
+ * {
+ *  { ( uint8_t * ) 0x00000000UL, 0x10000 },   << R5 ATCM
+ *  { ( uint8_t * ) 0x10000000UL, 0x400000 },  << DDR
+ *  { NULL, 0 }                                << Terminates the array.
+ * };
+ *
+ * If vPortDefineHeapRegions() is not called before the first allocation, a
+ * single region of configTOTAL_HEAP_SIZE bytes is used, as for heap_4.c.
+ *
+ * pvPortMallocRegion() allocates from a given region first, and falls back to
+ * the other regions.  xPortGetHeapRegionStats() returns the usage, high water
+ * mark and fragmentation of a region.
+ */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+    #error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
+#endif
+
+#ifndef configHEAP_MAX_REGIONS
+    #define configHEAP_MAX_REGIONS    4
+#endif
+
+/* Block sizes must not get too small. */
+#define heapMINIMUM_BLOCK_SIZE    ( ( size_t ) ( xHeapStructSize << 1 ) )
+
+/* Assumes 8bit bytes! */
+#define heapBITS_PER_BYTE         ( ( size_t ) 8 )
+
+/* The size classes, in bytes including the block header.  The smallest class
+ * is a power of two at least as large as heapMINIMUM_BLOCK_SIZE on 64-bit
+ * targets, and each class is twice the size of the previous one. */
+#define heapNUM_SIZE_CLASSES      ( 5 )
+#define heapSIZE_CLASS_MIN        ( ( size_t ) 32 )
+#define heapSIZE_CLASS( x )       ( heapSIZE_CLASS_MIN << ( x ) )
+#define heapSIZE_CLASS_MAX        heapSIZE_CLASS( heapNUM_SIZE_CLASSES - 1 )
+#define heapNO_SIZE_CLASS         ( ( BaseType_t ) -1 )
+
+/* Define the linked list structure.  This is used to link free blocks in order
+ * of their memory address. */
+typedef struct A_BLOCK_LINK
+{
+    struct A_BLOCK_LINK * pxNextFreeBlock; /*<< The next free block in the list. */
+    size_t xBlockSize;                     /*<< The size of the free block. */
+} BlockLink_t;
+
+/* The state of one heap region. */
+typedef struct HEAP_REGION_STATE
+{
+    uint8_t * pucStart;                                     /*<< First byte of the region, used to find the region of a block. */
+    BlockLink_t xStart;                                     /*<< Marks the start of the free list. */
+    BlockLink_t * pxEnd;                                    /*<< Marks the end of the free list, at the end of the region. */
+    BlockLink_t * pxSizeClassCache[ heapNUM_SIZE_CLASSES ]; /*<< Freed small blocks, linked by pxNextFreeBlock. */
+    size_t xTotalBytes;                                     /*<< Size of the region available for allocation. */
+    size_t xFreeBytesRemaining;                             /*<< Free bytes, including the cached blocks. */
+    size_t xMinimumEverFreeBytesRemaining;
+    size_t xCachedBytes;                                    /*<< Bytes held in the size class caches. */
+    size_t xNumberOfSuccessfulAllocations;
+    size_t xNumberOfSuccessfulFrees;
+} HeapRegionState_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Inserts a block of memory that is being freed into the correct position in
+ * the free list of its region.  The block being freed will be merged with the
+ * block in front it and/or the block behind it if the memory blocks are
+ * adjacent to each other.
+ */
+static void prvInsertBlockIntoFreeList( HeapRegionState_t * pxRegion,
+                                        BlockLink_t * pxBlockToInsert );
+
+/*
+ * Allocates a block of xWantedSize bytes, including the header, from a
+ * region.  Returns the block or NULL.
+ */
+static BlockLink_t * prvAllocateFromRegion( HeapRegionState_t * pxRegion,
+                                            size_t xWantedSize,
+                                            BaseType_t xSizeClass );
+
+/*
+ * Returns the blocks of the size class caches of a region to its free list.
+ */
+static void prvFlushSizeClassCaches( HeapRegionState_t * pxRegion );
+
+/*
+ * Returns the region that contains a block.
+ */
+static HeapRegionState_t * prvGetBlockRegion( const BlockLink_t * pxBlock );
+
+/*
+ * Defines a single region of configTOTAL_HEAP_SIZE bytes, used when the
+ * application did not call vPortDefineHeapRegions().
+ */
+static void prvHeapInit( void );
+
+/*-----------------------------------------------------------*/
+
+/* The size of the structure placed at the beginning of each allocated memory
+ * block must by correctly byte aligned. */
+static const size_t xHeapStructSize = ( sizeof( BlockLink_t ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+PRIVILEGED_DATA static HeapRegionState_t xHeapRegions[ configHEAP_MAX_REGIONS ];
+PRIVILEGED_DATA static BaseType_t xDefinedRegions = 0;
+
+/* Keeps track of the free bytes of the whole heap, the per-region counters are
+ * in HeapRegionState_t. */
+PRIVILEGED_DATA static size_t xFreeBytesRemaining = 0U;
+PRIVILEGED_DATA static size_t xMinimumEverFreeBytesRemaining = 0U;
+
+/* Gets set to the top bit of an size_t type.  When this bit in the xBlockSize
+ * member of an BlockLink_t structure is set then the block belongs to the
+ * application.  When the bit is free the block is still part of the free heap
+ * space. */
+PRIVILEGED_DATA static size_t xBlockAllocatedBit = 0;
+
+/*-----------------------------------------------------------*/
+
+void * pvPortMallocRegion( size_t xWantedSize,
+                           BaseType_t xRegionHint )
+{
+    BlockLink_t * pxBlock = NULL;
+    HeapRegionState_t * pxRegion;
+    BaseType_t xSizeClass = heapNO_SIZE_CLASS;
+    BaseType_t x, xRegion;
+    void * pvReturn = NULL;
+
+    vTaskSuspendAll();
+    {
+        /* If this is the first call to malloc and no region was defined then
+         * the heap will require initialisation to setup the default region. */
+        if( xDefinedRegions == 0 )
+        {
+            prvHeapInit();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* Check the requested block size is not so large that the top bit is
+         * set.  The top bit of the block size member of the BlockLink_t structure
+         * is used to determine who owns the block - the application or the
+         * kernel, so it must be free. */
+        if( ( xWantedSize & xBlockAllocatedBit ) == 0 )
+        {
+            /* The wanted size is increased so it can contain a BlockLink_t
+             * structure in addition to the requested amount of bytes. */
+            if( ( xWantedSize > 0 ) &&
+                ( ( xWantedSize + xHeapStructSize ) > xWantedSize ) ) /* Overflow check */
+            {
+                xWantedSize += xHeapStructSize;
+
+                /* Ensure that blocks are always aligned */
+                if( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) != 0x00 )
+                {
+                    /* Byte alignment required. Check for overflow */
+                    if( ( xWantedSize + ( portBYTE_ALIGNMENT - ( xWantedSize & portBYTE_ALIGNMENT_MASK ) ) ) >
+                        xWantedSize )
+                    {
+                        xWantedSize += ( portBYTE_ALIGNMENT - ( xWantedSize & portBYTE_ALIGNMENT_MASK ) );
+                    }
+                    else
+                    {
+                        xWantedSize = 0;
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                xWantedSize = 0;
+            }
+
+            /* Small blocks are rounded up to their size class, so they can
+             * be reused by any allocation of the same class. */
+            if( ( xWantedSize > 0 ) && ( xWantedSize <= heapSIZE_CLASS_MAX ) )
+            {
+                for( xSizeClass = 0; xWantedSize > heapSIZE_CLASS( xSizeClass ); xSizeClass++ )
+                {
+                    /* Nothing to do here, just find the smallest class. */
+                }
+
+                xWantedSize = heapSIZE_CLASS( xSizeClass );
+            }
+
+            if( ( xWantedSize > 0 ) && ( xWantedSize <= xFreeBytesRemaining ) )
+            {
+                if( ( xRegionHint >= 0 ) && ( xRegionHint < xDefinedRegions ) )
+                {
+                    pxBlock = prvAllocateFromRegion( &( xHeapRegions[ xRegionHint ] ), xWantedSize, xSizeClass );
+                }
+
+                /* Small blocks go to the fastest region that has space,
+                 * large blocks to the largest region. */
+                for( x = 0; ( x < xDefinedRegions ) && ( pxBlock == NULL ); x++ )
+                {
+                    xRegion = ( xSizeClass != heapNO_SIZE_CLASS ) ? x : ( xDefinedRegions - 1 - x );
+
+                    if( xRegion != xRegionHint )
+                    {
+                        pxBlock = prvAllocateFromRegion( &( xHeapRegions[ xRegion ] ), xWantedSize, xSizeClass );
+                    }
+                }
+
+                if( pxBlock != NULL )
+                {
+                    pxRegion = prvGetBlockRegion( pxBlock );
+
+                    pxRegion->xFreeBytesRemaining -= pxBlock->xBlockSize;
+                    xFreeBytesRemaining -= pxBlock->xBlockSize;
+
+                    if( pxRegion->xFreeBytesRemaining < pxRegion->xMinimumEverFreeBytesRemaining )
+                    {
+                        pxRegion->xMinimumEverFreeBytesRemaining = pxRegion->xFreeBytesRemaining;
+                    }
+
+                    if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+                    {
+                        xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+                    }
+
+                    /* The block is being returned - it is allocated and owned
+                     * by the application and has no "next" block. */
+                    pxBlock->xBlockSize |= xBlockAllocatedBit;
+                    pxBlock->pxNextFreeBlock = NULL;
+                    pxRegion->xNumberOfSuccessfulAllocations++;
+
+                    /* Return the memory space pointed to - jumping over the
+                     * BlockLink_t structure at its start. */
+                    pvReturn = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xHeapStructSize );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceMALLOC( pvReturn, xWantedSize );
+    }
+    ( void ) xTaskResumeAll();
+
+    #if ( configUSE_MALLOC_FAILED_HOOK == 1 )
+        {
+            if( pvReturn == NULL )
+            {
+                extern void vApplicationMallocFailedHook( void );
+                vApplicationMallocFailedHook();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    #endif /* if ( configUSE_MALLOC_FAILED_HOOK == 1 ) */
+
+    configASSERT( ( ( ( size_t ) pvReturn ) & ( size_t ) portBYTE_ALIGNMENT_MASK ) == 0 );
+    return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void * pvPortMalloc( size_t xWantedSize )
+{
+    return pvPortMallocRegion( xWantedSize, portHEAP_REGION_ANY );
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void * pv )
+{
+    uint8_t * puc = ( uint8_t * ) pv;
+    BlockLink_t * pxLink;
+    HeapRegionState_t * pxRegion;
+    BaseType_t xSizeClass;
+
+    if( pv != NULL )
+    {
+        /* The memory being freed will have an BlockLink_t structure immediately
+         * before it. */
+        puc -= xHeapStructSize;
+
+        /* This casting is to keep the compiler from issuing warnings. */
+        pxLink = ( void * ) puc;
+
+        /* Check the block is actually allocated. */
+        configASSERT( ( pxLink->xBlockSize & xBlockAllocatedBit ) != 0 );
+        configASSERT( pxLink->pxNextFreeBlock == NULL );
+
+        if( ( pxLink->xBlockSize & xBlockAllocatedBit ) != 0 )
+        {
+            if( pxLink->pxNextFreeBlock == NULL )
+            {
+                /* The block is being returned to the heap - it is no longer
+                 * allocated. */
+                pxLink->xBlockSize &= ~xBlockAllocatedBit;
+
+                vTaskSuspendAll();
+                {
+                    pxRegion = prvGetBlockRegion( pxLink );
+                    configASSERT( pxRegion != NULL );
+
+                    pxRegion->xFreeBytesRemaining += pxLink->xBlockSize;
+                    xFreeBytesRemaining += pxLink->xBlockSize;
+                    traceFREE( pv, pxLink->xBlockSize );
+
+                    if( pxLink->xBlockSize <= heapSIZE_CLASS_MAX )
+                    {
+                        /* A small block was not split further than its size
+                         * class, it is at least as large as the class.  Keep
+                         * it in the cache of the largest class it fits. */
+                        for( xSizeClass = heapNUM_SIZE_CLASSES - 1; pxLink->xBlockSize < heapSIZE_CLASS( xSizeClass ); xSizeClass-- )
+                        {
+                            /* Nothing to do here, just find the class. */
+                        }
+
+                        pxLink->pxNextFreeBlock = pxRegion->pxSizeClassCache[ xSizeClass ];
+                        pxRegion->pxSizeClassCache[ xSizeClass ] = pxLink;
+                        pxRegion->xCachedBytes += pxLink->xBlockSize;
+                    }
+                    else
+                    {
+                        /* Add this block to the list of free blocks. */
+                        prvInsertBlockIntoFreeList( pxRegion, pxLink );
+                    }
+
+                    pxRegion->xNumberOfSuccessfulFrees++;
+                }
+                ( void ) xTaskResumeAll();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+    return xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+    return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+static BlockLink_t * prvAllocateFromRegion( HeapRegionState_t * pxRegion,
+                                            size_t xWantedSize,
+                                            BaseType_t xSizeClass )
+{
+    BlockLink_t * pxBlock, * pxPreviousBlock, * pxNewBlockLink;
+
+    if( xWantedSize > pxRegion->xFreeBytesRemaining )
+    {
+        return NULL;
+    }
+
+    /* A cached block of the class is taken without searching. */
+    if( ( xSizeClass != heapNO_SIZE_CLASS ) && ( pxRegion->pxSizeClassCache[ xSizeClass ] != NULL ) )
+    {
+        pxBlock = pxRegion->pxSizeClassCache[ xSizeClass ];
+        pxRegion->pxSizeClassCache[ xSizeClass ] = pxBlock->pxNextFreeBlock;
+        pxRegion->xCachedBytes -= pxBlock->xBlockSize;
+
+        return pxBlock;
+    }
+
+    for( ; ; )
+    {
+        /* Traverse the list from the start (lowest address) block until
+         * one of adequate size is found. */
+        pxPreviousBlock = &( pxRegion->xStart );
+        pxBlock = pxRegion->xStart.pxNextFreeBlock;
+
+        while( ( pxBlock->xBlockSize < xWantedSize ) && ( pxBlock->pxNextFreeBlock != NULL ) )
+        {
+            pxPreviousBlock = pxBlock;
+            pxBlock = pxBlock->pxNextFreeBlock;
+        }
+
+        /* If the end marker was reached then a block of adequate size was
+         * not found.  The cached blocks may coalesce into one, try again
+         * once with the caches flushed. */
+        if( pxBlock != pxRegion->pxEnd )
+        {
+            break;
+        }
+        else if( pxRegion->xCachedBytes != 0U )
+        {
+            prvFlushSizeClassCaches( pxRegion );
+        }
+        else
+        {
+            return NULL;
+        }
+    }
+
+    /* This block is being returned for use so must be taken out of the list of
+     * free blocks. */
+    pxPreviousBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+
+    /* If the block is larger than required it can be split into two. */
+    if( ( pxBlock->xBlockSize - xWantedSize ) > heapMINIMUM_BLOCK_SIZE )
+    {
+        /* This block is to be split into two.  Create a new block following
+         * the number of bytes requested. The void cast is used to prevent byte
+         * alignment warnings from the compiler. */
+        pxNewBlockLink = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xWantedSize );
+
+        /* Calculate the sizes of two blocks split from the single block. */
+        pxNewBlockLink->xBlockSize = pxBlock->xBlockSize - xWantedSize;
+        pxBlock->xBlockSize = xWantedSize;
+
+        /* Insert the new block into the list of free blocks. */
+        prvInsertBlockIntoFreeList( pxRegion, pxNewBlockLink );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return pxBlock;
+}
+/*-----------------------------------------------------------*/
+
+static void prvFlushSizeClassCaches( HeapRegionState_t * pxRegion )
+{
+    BlockLink_t * pxBlock;
+    BaseType_t xSizeClass;
+
+    for( xSizeClass = 0; xSizeClass < heapNUM_SIZE_CLASSES; xSizeClass++ )
+    {
+        while( pxRegion->pxSizeClassCache[ xSizeClass ] != NULL )
+        {
+            pxBlock = pxRegion->pxSizeClassCache[ xSizeClass ];
+            pxRegion->pxSizeClassCache[ xSizeClass ] = pxBlock->pxNextFreeBlock;
+            prvInsertBlockIntoFreeList( pxRegion, pxBlock );
+        }
+    }
+
+    pxRegion->xCachedBytes = 0U;
+}
+/*-----------------------------------------------------------*/
+
+static HeapRegionState_t * prvGetBlockRegion( const BlockLink_t * pxBlock )
+{
+    BaseType_t xRegion;
+
+    for( xRegion = 0; xRegion < xDefinedRegions; xRegion++ )
+    {
+        if( ( ( const uint8_t * ) pxBlock >= xHeapRegions[ xRegion ].pucStart ) &&
+            ( pxBlock < xHeapRegions[ xRegion ].pxEnd ) )
+        {
+            return &( xHeapRegions[ xRegion ] );
+        }
+    }
+
+    return NULL;
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertBlockIntoFreeList( HeapRegionState_t * pxRegion,
+                                        BlockLink_t * pxBlockToInsert )
+{
+    BlockLink_t * pxIterator;
+    uint8_t * puc;
+
+    /* Iterate through the list until a block is found that has a higher address
+     * than the block being inserted. */
+    for( pxIterator = &( pxRegion->xStart ); pxIterator->pxNextFreeBlock < pxBlockToInsert; pxIterator = pxIterator->pxNextFreeBlock )
+    {
+        /* Nothing to do here, just iterate to the right position. */
+    }
+
+    /* Do the block being inserted, and the block it is being inserted after
+     * make a contiguous block of memory? */
+    puc = ( uint8_t * ) pxIterator;
+
+    if( ( puc + pxIterator->xBlockSize ) == ( uint8_t * ) pxBlockToInsert )
+    {
+        pxIterator->xBlockSize += pxBlockToInsert->xBlockSize;
+        pxBlockToInsert = pxIterator;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    /* Do the block being inserted, and the block it is being inserted before
+     * make a contiguous block of memory? */
+    puc = ( uint8_t * ) pxBlockToInsert;
+
+    if( ( puc + pxBlockToInsert->xBlockSize ) == ( uint8_t * ) pxIterator->pxNextFreeBlock )
+    {
+        if( pxIterator->pxNextFreeBlock != pxRegion->pxEnd )
+        {
+            /* Form one big block from the two blocks. */
+            pxBlockToInsert->xBlockSize += pxIterator->pxNextFreeBlock->xBlockSize;
+            pxBlockToInsert->pxNextFreeBlock = pxIterator->pxNextFreeBlock->pxNextFreeBlock;
+        }
+        else
+        {
+            pxBlockToInsert->pxNextFreeBlock = pxRegion->pxEnd;
+        }
+    }
+    else
+    {
+        pxBlockToInsert->pxNextFreeBlock = pxIterator->pxNextFreeBlock;
+    }
+
+    /* If the block being inserted plugged a gab, so was merged with the block
+     * before and the block after, then it's pxNextFreeBlock pointer will have
+     * already been set, and should not be set here as that would make it point
+     * to itself. */
+    if( pxIterator != pxBlockToInsert )
+    {
+        pxIterator->pxNextFreeBlock = pxBlockToInsert;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions )
+{
+    BlockLink_t * pxFirstFreeBlockInRegion;
+    HeapRegionState_t * pxRegion;
+    size_t xTotalRegionSize, xTotalHeapSize = 0;
+    size_t xAddress;
+    const HeapRegion_t * pxHeapRegion;
+
+    /* Can only call once! */
+    configASSERT( xDefinedRegions == 0 );
+
+    pxHeapRegion = &( pxHeapRegions[ xDefinedRegions ] );
+
+    while( pxHeapRegion->xSizeInBytes > 0 )
+    {
+        configASSERT( xDefinedRegions < configHEAP_MAX_REGIONS );
+        pxRegion = &( xHeapRegions[ xDefinedRegions ] );
+        xTotalRegionSize = pxHeapRegion->xSizeInBytes;
+
+        /* Ensure the heap region starts on a correctly aligned boundary. */
+        xAddress = ( size_t ) pxHeapRegion->pucStartAddress;
+
+        if( ( xAddress & portBYTE_ALIGNMENT_MASK ) != 0 )
+        {
+            xAddress += ( portBYTE_ALIGNMENT - 1 );
+            xAddress &= ~portBYTE_ALIGNMENT_MASK;
+
+            /* Adjust the size for the bytes lost to alignment. */
+            xTotalRegionSize -= xAddress - ( size_t ) pxHeapRegion->pucStartAddress;
+        }
+
+        pxRegion->pucStart = ( uint8_t * ) xAddress;
+
+        /* xStart is used to hold a pointer to the first item in the list of
+         * free blocks.  The void cast is used to prevent compiler warnings. */
+        pxRegion->xStart.pxNextFreeBlock = ( BlockLink_t * ) xAddress;
+        pxRegion->xStart.xBlockSize = ( size_t ) 0;
+
+        /* pxEnd is used to mark the end of the list of free blocks and is
+         * inserted at the end of the region space. */
+        xAddress += xTotalRegionSize;
+        xAddress -= xHeapStructSize;
+        xAddress &= ~portBYTE_ALIGNMENT_MASK;
+        pxRegion->pxEnd = ( BlockLink_t * ) xAddress;
+        pxRegion->pxEnd->xBlockSize = 0;
+        pxRegion->pxEnd->pxNextFreeBlock = NULL;
+
+        /* To start with there is a single free block in this region that is
+         * sized to take up the entire heap region minus the space taken by the
+         * free block structure. */
+        pxFirstFreeBlockInRegion = pxRegion->xStart.pxNextFreeBlock;
+        pxFirstFreeBlockInRegion->xBlockSize = xAddress - ( size_t ) pxFirstFreeBlockInRegion;
+        pxFirstFreeBlockInRegion->pxNextFreeBlock = pxRegion->pxEnd;
+
+        pxRegion->xTotalBytes = pxFirstFreeBlockInRegion->xBlockSize;
+        pxRegion->xFreeBytesRemaining = pxRegion->xTotalBytes;
+        pxRegion->xMinimumEverFreeBytesRemaining = pxRegion->xTotalBytes;
+        xTotalHeapSize += pxRegion->xTotalBytes;
+
+        /* Move onto the next HeapRegion_t structure. */
+        xDefinedRegions++;
+        pxHeapRegion = &( pxHeapRegions[ xDefinedRegions ] );
+    }
+
+    xMinimumEverFreeBytesRemaining = xTotalHeapSize;
+    xFreeBytesRemaining = xTotalHeapSize;
+
+    /* Check something was actually defined before it is accessed. */
+    configASSERT( xTotalHeapSize );
+
+    /* Work out the position of the top bit in a size_t variable. */
+    xBlockAllocatedBit = ( ( size_t ) 1 ) << ( ( sizeof( size_t ) * heapBITS_PER_BYTE ) - 1 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvHeapInit( void )
+{
+    /* Allocate the memory for the heap. */
+    #if ( configAPPLICATION_ALLOCATED_HEAP == 1 )
+
+        /* The application writer has already defined the array used for the RTOS
+        * heap - probably so it can be placed in a special segment or address. */
+        extern uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+    #else
+        PRIVILEGED_DATA static uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+    #endif /* configAPPLICATION_ALLOCATED_HEAP */
+    HeapRegion_t xDefaultRegions[ 2 ] =
+    {
+        { NULL, configTOTAL_HEAP_SIZE },
+        { NULL, 0                     }
+    };
+
+    xDefaultRegions[ 0 ].pucStartAddress = ucHeap;
+    vPortDefineHeapRegions( xDefaultRegions );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortGetHeapRegionStats( BaseType_t xRegion,
+                                    HeapRegionStats_t * pxRegionStats )
+{
+    HeapRegionState_t * pxRegion;
+    BlockLink_t * pxBlock;
+    size_t xBlocks = 0, xMaxSize = 0, xListBytes = 0;
+
+    if( ( xRegion < 0 ) || ( xRegion >= xDefinedRegions ) )
+    {
+        return pdFAIL;
+    }
+
+    pxRegion = &( xHeapRegions[ xRegion ] );
+
+    vTaskSuspendAll();
+    {
+        for( pxBlock = pxRegion->xStart.pxNextFreeBlock; pxBlock != pxRegion->pxEnd; pxBlock = pxBlock->pxNextFreeBlock )
+        {
+            xBlocks++;
+            xListBytes += pxBlock->xBlockSize;
+
+            if( pxBlock->xBlockSize > xMaxSize )
+            {
+                xMaxSize = pxBlock->xBlockSize;
+            }
+        }
+
+        pxRegionStats->xTotalSizeInBytes = pxRegion->xTotalBytes;
+        pxRegionStats->xAvailableHeapSpaceInBytes = pxRegion->xFreeBytesRemaining;
+        pxRegionStats->xMinimumEverFreeBytesRemaining = pxRegion->xMinimumEverFreeBytesRemaining;
+        pxRegionStats->xCachedBytes = pxRegion->xCachedBytes;
+        pxRegionStats->xNumberOfSuccessfulAllocations = pxRegion->xNumberOfSuccessfulAllocations;
+        pxRegionStats->xNumberOfSuccessfulFrees = pxRegion->xNumberOfSuccessfulFrees;
+    }
+    ( void ) xTaskResumeAll();
+
+    pxRegionStats->xSizeOfLargestFreeBlockInBytes = xMaxSize;
+    pxRegionStats->xNumberOfFreeBlocks = xBlocks;
+
+    /* The part of the free list that cannot be used for an allocation of the
+     * size of all of it. */
+    if( xListBytes != 0U )
+    {
+        pxRegionStats->xFragmentationPercent = 100U - ( ( xMaxSize * 100U ) / xListBytes );
+    }
+    else
+    {
+        pxRegionStats->xFragmentationPercent = 0U;
+    }
+
+    return pdPASS;
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetHeapStats( HeapStats_t * pxHeapStats )
+{
+    BlockLink_t * pxBlock;
+    BaseType_t xRegion;
+    size_t xBlocks = 0, xMaxSize = 0, xMinSize = portMAX_DELAY; /* portMAX_DELAY used as a portable way of getting the maximum value. */
+    size_t xAllocations = 0, xFrees = 0;
+
+    vTaskSuspendAll();
+    {
+        /* The cached blocks are counted in the available space, but not as
+         * free blocks. */
+        for( xRegion = 0; xRegion < xDefinedRegions; xRegion++ )
+        {
+            for( pxBlock = xHeapRegions[ xRegion ].xStart.pxNextFreeBlock; pxBlock != xHeapRegions[ xRegion ].pxEnd; pxBlock = pxBlock->pxNextFreeBlock )
+            {
+                xBlocks++;
+
+                if( pxBlock->xBlockSize > xMaxSize )
+                {
+                    xMaxSize = pxBlock->xBlockSize;
+                }
+
+                if( pxBlock->xBlockSize < xMinSize )
+                {
+                    xMinSize = pxBlock->xBlockSize;
+                }
+            }
+
+            xAllocations += xHeapRegions[ xRegion ].xNumberOfSuccessfulAllocations;
+            xFrees += xHeapRegions[ xRegion ].xNumberOfSuccessfulFrees;
+        }
+
+        pxHeapStats->xAvailableHeapSpaceInBytes = xFreeBytesRemaining;
+        pxHeapStats->xMinimumEverFreeBytesRemaining = xMinimumEverFreeBytesRemaining;
+    }
+    ( void ) xTaskResumeAll();
+
+    pxHeapStats->xSizeOfLargestFreeBlockInBytes = xMaxSize;
+    pxHeapStats->xSizeOfSmallestFreeBlockInBytes = xMinSize;
+    pxHeapStats->xNumberOfFreeBlocks = xBlocks;
+    pxHeapStats->xNumberOfSuccessfulAllocations = xAllocations;
+    pxHeapStats->xNumberOfSuccessfulFrees = xFrees;
+}
@@ -228,6 +228,13 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
                                           size_t xTriggerLevelBytes,
                                           uint8_t ucFlags ) PRIVILEGED_FUNCTION;
 
+/*
+ * Moves xHead past the xCommitLength bytes written in place in the region
+ * returned by xStreamBufferReserve().
+ */
+static void prvCommitBytes( StreamBuffer_t * const pxStreamBuffer,
+                            size_t xCommitLength ) PRIVILEGED_FUNCTION;
+
 /*-----------------------------------------------------------*/
 
 #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
@@ -1138,6 +1145,233 @@ BaseType_t xStreamBufferReceiveCompletedFromISR( StreamBufferHandle_t xStreamBuf
 }
 /*-----------------------------------------------------------*/
 
+size_t xStreamBufferReserve( StreamBufferHandle_t xStreamBuffer,
+                             uint8_t ** ppucData )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xSpace, xHead;
+
+    configASSERT( ppucData );
+    configASSERT( pxStreamBuffer );
+
+    /* Message buffers need the length written ahead of each message, so only
+     * stream buffers can be written in place. */
+    configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 );
+
+    /* Only the writer moves xHead, so the region stays free until it is
+     * committed, whatever the reader does meanwhile. */
+    xHead = pxStreamBuffer->xHead;
+    xSpace = xStreamBufferSpacesAvailable( xStreamBuffer );
+
+    /* The region must be contiguous, so it stops at the end of the buffer.
+     * Once it is committed the next reservation starts at the beginning. */
+    xSpace = configMIN( xSpace, pxStreamBuffer->xLength - xHead );
+
+    *ppucData = &( pxStreamBuffer->pucBuffer[ xHead ] );
+
+    return xSpace;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCommitBytes( StreamBuffer_t * const pxStreamBuffer,
+                            size_t xCommitLength )
+{
+    size_t xHead;
+
+    configASSERT( xCommitLength <= xStreamBufferSpacesAvailable( pxStreamBuffer ) );
+    configASSERT( ( pxStreamBuffer->xHead + xCommitLength ) <= pxStreamBuffer->xLength );
+
+    xHead = pxStreamBuffer->xHead + xCommitLength;
+
+    if( xHead >= pxStreamBuffer->xLength )
+    {
+        xHead -= pxStreamBuffer->xLength;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    pxStreamBuffer->xHead = xHead;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferCommit( StreamBufferHandle_t xStreamBuffer,
+                            size_t xCommitLength )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+
+    configASSERT( pxStreamBuffer );
+
+    if( xCommitLength > ( size_t ) 0 )
+    {
+        prvCommitBytes( pxStreamBuffer, xCommitLength );
+        traceSTREAM_BUFFER_SEND( xStreamBuffer, xCommitLength );
+
+        /* Was a task waiting for the data? */
+        if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+        {
+            sbSEND_COMPLETED( pxStreamBuffer );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xCommitLength;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+                                   size_t xCommitLength,
+                                   BaseType_t * const pxHigherPriorityTaskWoken )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+
+    configASSERT( pxStreamBuffer );
+
+    if( xCommitLength > ( size_t ) 0 )
+    {
+        prvCommitBytes( pxStreamBuffer, xCommitLength );
+
+        /* Was a task waiting for the data? */
+        if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+        {
+            sbSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    traceSTREAM_BUFFER_SEND_FROM_ISR( xStreamBuffer, xCommitLength );
+
+    return xCommitLength;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferClaim( StreamBufferHandle_t xStreamBuffer,
+                           uint8_t ** ppucData,
+                           TickType_t xTicksToWait )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xBytesAvailable, xTail;
+
+    configASSERT( ppucData );
+    configASSERT( pxStreamBuffer );
+    configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 );
+
+    if( xTicksToWait != ( TickType_t ) 0 )
+    {
+        /* Checking if there is data and clearing the notification state must be
+         * performed atomically. */
+        taskENTER_CRITICAL();
+        {
+            xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+
+            if( xBytesAvailable == ( size_t ) 0 )
+            {
+                /* Clear notification state as going to wait for data. */
+                ( void ) xTaskNotifyStateClear( NULL );
+
+                /* Should only be one reader. */
+                configASSERT( pxStreamBuffer->xTaskWaitingToReceive == NULL );
+                pxStreamBuffer->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( xBytesAvailable == ( size_t ) 0 )
+        {
+            /* Wait for data to be available. */
+            traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( xStreamBuffer );
+            ( void ) xTaskNotifyWait( ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+            pxStreamBuffer->xTaskWaitingToReceive = NULL;
+
+            /* Recheck the data available after blocking. */
+            xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+    }
+
+    /* Only the reader moves xTail.  As for xStreamBufferReserve(), the region
+     * stops at the end of the buffer. */
+    xTail = pxStreamBuffer->xTail;
+    xBytesAvailable = configMIN( xBytesAvailable, pxStreamBuffer->xLength - xTail );
+
+    *ppucData = &( pxStreamBuffer->pucBuffer[ xTail ] );
+
+    if( xBytesAvailable == ( size_t ) 0 )
+    {
+        traceSTREAM_BUFFER_RECEIVE_FAILED( xStreamBuffer );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xBytesAvailable;
+}
+/*-----------------------------------------------------------*/
+
+void vStreamBufferRelease( StreamBufferHandle_t xStreamBuffer,
+                           size_t xReleaseLength )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xTail;
+
+    configASSERT( pxStreamBuffer );
+    configASSERT( xReleaseLength <= prvBytesInBuffer( pxStreamBuffer ) );
+    configASSERT( ( pxStreamBuffer->xTail + xReleaseLength ) <= pxStreamBuffer->xLength );
+
+    if( xReleaseLength > ( size_t ) 0 )
+    {
+        xTail = pxStreamBuffer->xTail + xReleaseLength;
+
+        if( xTail >= pxStreamBuffer->xLength )
+        {
+            xTail -= pxStreamBuffer->xLength;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        pxStreamBuffer->xTail = xTail;
+
+        traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xReleaseLength );
+
+        /* Was a task waiting for space in the buffer? */
+        sbRECEIVE_COMPLETED( pxStreamBuffer );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+}
+/*-----------------------------------------------------------*/
+
 static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer,
                                      const uint8_t * pucData,
                                      size_t xCount,
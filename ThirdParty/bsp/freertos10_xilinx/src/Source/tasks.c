@@ -115,6 +115,22 @@
     #define configIDLE_TASK_NAME    "IDLE"
 #endif
 
+/* With configNUMBER_OF_CORES > 1 the scheduler is partitioned: every task
+ * belongs to one core, held in the xCoreID member of its TCB, and every core
+ * selects the tasks to run from its own set of ready lists.  The macros below
+ * hide the core index so the single core build is unchanged. */
+#if ( configNUMBER_OF_CORES == 1 )
+    #define taskCORE_OF( pxTCB )                     ( ( BaseType_t ) 0 )
+    #define taskCURRENT_TCB( xCoreID )               pxCurrentTCB
+    #define taskREADY_LIST( xCoreID, uxPriority )    ( &( pxReadyTasksLists[ ( uxPriority ) ] ) )
+    #define taskTOP_READY_PRIORITY( xCoreID )        uxTopReadyPriority
+#else
+    #define taskCORE_OF( pxTCB )                     ( ( pxTCB )->xCoreID )
+    #define taskCURRENT_TCB( xCoreID )               pxCurrentTCBs[ ( xCoreID ) ]
+    #define taskREADY_LIST( xCoreID, uxPriority )    ( &( pxReadyTasksLists[ ( xCoreID ) ][ ( uxPriority ) ] ) )
+    #define taskTOP_READY_PRIORITY( xCoreID )        uxTopReadyPriority[ ( xCoreID ) ]
+#endif
+
 #if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
 
 /* If configUSE_PORT_OPTIMISED_TASK_SELECTION is 0 then task selection is
@@ -123,31 +139,31 @@
 
 /* uxTopReadyPriority holds the priority of the highest priority ready
  * state task. */
-    #define taskRECORD_READY_PRIORITY( uxPriority ) \
-    {                                               \
-        if( ( uxPriority ) > uxTopReadyPriority )   \
-        {                                           \
-            uxTopReadyPriority = ( uxPriority );    \
-        }                                           \
+    #define taskRECORD_READY_PRIORITY( xCoreID, uxPriority )             \
+    {                                                                    \
+        if( ( uxPriority ) > taskTOP_READY_PRIORITY( xCoreID ) )         \
+        {                                                                \
+            taskTOP_READY_PRIORITY( xCoreID ) = ( uxPriority );          \
+        }                                                                \
     } /* taskRECORD_READY_PRIORITY */
 
 /*-----------------------------------------------------------*/
 
-    #define taskSELECT_HIGHEST_PRIORITY_TASK()                                \
-    {                                                                         \
-        UBaseType_t uxTopPriority = uxTopReadyPriority;                       \
-                                                                              \
-        /* Find the highest priority queue that contains ready tasks. */      \
-        while( listLIST_IS_EMPTY( &( pxReadyTasksLists[ uxTopPriority ] ) ) ) \
-        {                                                                     \
-            configASSERT( uxTopPriority );                                    \
-            --uxTopPriority;                                                  \
-        }                                                                     \
-                                                                              \
+    #define taskSELECT_HIGHEST_PRIORITY_TASK( xCoreID )                                 \
+    {                                                                                   \
+        UBaseType_t uxTopPriority = taskTOP_READY_PRIORITY( xCoreID );                  \
+                                                                                        \
+        /* Find the highest priority queue that contains ready tasks. */                \
+        while( listLIST_IS_EMPTY( taskREADY_LIST( xCoreID, uxTopPriority ) ) )          \
+        {                                                                               \
+            configASSERT( uxTopPriority );                                              \
+            --uxTopPriority;                                                            \
+        }                                                                               \
+                                                                                        \
         /* listGET_OWNER_OF_NEXT_ENTRY indexes through the list, so the tasks of \
-         * the  same priority get an equal share of the processor time. */                    \
-        listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ uxTopPriority ] ) ); \
-        uxTopReadyPriority = uxTopPriority;                                                   \
+         * the  same priority get an equal share of the processor time. */                               \
+        listGET_OWNER_OF_NEXT_ENTRY( taskCURRENT_TCB( xCoreID ), taskREADY_LIST( xCoreID, uxTopPriority ) ); \
+        taskTOP_READY_PRIORITY( xCoreID ) = uxTopPriority;                                               \
     } /* taskSELECT_HIGHEST_PRIORITY_TASK */
 
 /*-----------------------------------------------------------*/
@@ -155,7 +171,7 @@
 /* Define away taskRESET_READY_PRIORITY() and portRESET_READY_PRIORITY() as
  * they are only required when a port optimised method of task selection is
  * being used. */
-    #define taskRESET_READY_PRIORITY( uxPriority )
+    #define taskRESET_READY_PRIORITY( xCoreID, uxPriority )
     #define portRESET_READY_PRIORITY( uxPriority, uxTopReadyPriority )
 
 #else /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
@@ -165,18 +181,18 @@
  * architecture being used. */
 
 /* A port optimised version is provided.  Call the port defined macros. */
-    #define taskRECORD_READY_PRIORITY( uxPriority )    portRECORD_READY_PRIORITY( uxPriority, uxTopReadyPriority )
+    #define taskRECORD_READY_PRIORITY( xCoreID, uxPriority )    portRECORD_READY_PRIORITY( uxPriority, taskTOP_READY_PRIORITY( xCoreID ) )
 
 /*-----------------------------------------------------------*/
 
-    #define taskSELECT_HIGHEST_PRIORITY_TASK()                                                  \
-    {                                                                                           \
-        UBaseType_t uxTopPriority;                                                              \
-                                                                                                \
-        /* Find the highest priority list that contains ready tasks. */                         \
-        portGET_HIGHEST_PRIORITY( uxTopPriority, uxTopReadyPriority );                          \
-        configASSERT( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ uxTopPriority ] ) ) > 0 ); \
-        listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ uxTopPriority ] ) );   \
+    #define taskSELECT_HIGHEST_PRIORITY_TASK( xCoreID )                                                     \
+    {                                                                                                       \
+        UBaseType_t uxTopPriority;                                                                          \
+                                                                                                            \
+        /* Find the highest priority list that contains ready tasks. */                                     \
+        portGET_HIGHEST_PRIORITY( uxTopPriority, taskTOP_READY_PRIORITY( xCoreID ) );                       \
+        configASSERT( listCURRENT_LIST_LENGTH( taskREADY_LIST( xCoreID, uxTopPriority ) ) > 0 );            \
+        listGET_OWNER_OF_NEXT_ENTRY( taskCURRENT_TCB( xCoreID ), taskREADY_LIST( xCoreID, uxTopPriority ) ); \
     } /* taskSELECT_HIGHEST_PRIORITY_TASK() */
 
 /*-----------------------------------------------------------*/
@@ -184,12 +200,12 @@
 /* A port optimised version is provided, call it only if the TCB being reset
  * is being referenced from a ready list.  If it is referenced from a delayed
  * or suspended list then it won't be in a ready list. */
-    #define taskRESET_READY_PRIORITY( uxPriority )                                                     \
-    {                                                                                                  \
-        if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ ( uxPriority ) ] ) ) == ( UBaseType_t ) 0 ) \
-        {                                                                                              \
-            portRESET_READY_PRIORITY( ( uxPriority ), ( uxTopReadyPriority ) );                        \
-        }                                                                                              \
+    #define taskRESET_READY_PRIORITY( xCoreID, uxPriority )                                                \
+    {                                                                                                      \
+        if( listCURRENT_LIST_LENGTH( taskREADY_LIST( ( xCoreID ), ( uxPriority ) ) ) == ( UBaseType_t ) 0 ) \
+        {                                                                                                  \
+            portRESET_READY_PRIORITY( ( uxPriority ), taskTOP_READY_PRIORITY( xCoreID ) );                 \
+        }                                                                                                  \
     }
 
 #endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
@@ -218,10 +234,10 @@
  * Place the task represented by pxTCB into the appropriate ready list for
  * the task.  It is inserted at the end of the list.
  */
-#define prvAddTaskToReadyList( pxTCB )                                                                 \
-    traceMOVED_TASK_TO_READY_STATE( pxTCB );                                                           \
-    taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );                                                \
-    listINSERT_END( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) ); \
+#define prvAddTaskToReadyList( pxTCB )                                                                   \
+    traceMOVED_TASK_TO_READY_STATE( pxTCB );                                                             \
+    taskRECORD_READY_PRIORITY( taskCORE_OF( pxTCB ), ( pxTCB )->uxPriority );                            \
+    listINSERT_END( taskREADY_LIST( taskCORE_OF( pxTCB ), ( pxTCB )->uxPriority ), &( ( pxTCB )->xStateListItem ) ); \
     tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
 /*-----------------------------------------------------------*/
 
@@ -233,6 +249,28 @@
  */
 #define prvGetTCBFromHandle( pxHandle )    ( ( ( pxHandle ) == NULL ) ? pxCurrentTCB : ( pxHandle ) )
 
+/*
+ * taskTASK_PREEMPTS() and taskTASK_PREEMPTS_OR_EQUAL() evaluate to pdTRUE if
+ * the task represented by pxTCB, which has just been made ready, should
+ * preempt the task running on the calling core.  With several cores, a task
+ * that belongs to another core interrupts that core instead, and pdFALSE is
+ * returned.  taskYIELD_CORE() is pdTRUE if xCoreID is the calling core, else
+ * it interrupts xCoreID so it reschedules.
+ */
+#if ( configNUMBER_OF_CORES == 1 )
+    #define taskTASK_IS_RUNNING( pxTCB )            ( ( pxTCB ) == pxCurrentTCB )
+    #define taskTASK_PREEMPTS( pxTCB )              ( ( pxTCB )->uxPriority > pxCurrentTCB->uxPriority )
+    #define taskTASK_PREEMPTS_OR_EQUAL( pxTCB )     ( ( pxTCB )->uxPriority >= pxCurrentTCB->uxPriority )
+    #define taskYIELD_CORE( xCoreID )               pdTRUE
+    #define taskSCHEDULER_SUSPENDED_BY_CALLER()     ( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE )
+#else
+    #define taskTASK_IS_RUNNING( pxTCB )            ( ( pxTCB ) == pxCurrentTCBs[ ( pxTCB )->xCoreID ] )
+    #define taskTASK_PREEMPTS( pxTCB )              prvTaskPreempts( ( pxTCB ), pdFALSE )
+    #define taskTASK_PREEMPTS_OR_EQUAL( pxTCB )     prvTaskPreempts( ( pxTCB ), pdTRUE )
+    #define taskYIELD_CORE( xCoreID )               prvYieldCore( xCoreID )
+    #define taskSCHEDULER_SUSPENDED_BY_CALLER()     ( uxSchedulerSuspendedOnCore[ portGET_CORE_ID() ] != ( UBaseType_t ) pdFALSE )
+#endif
+
 /* The item value of the event list item is normally used to hold the priority
  * of the task to which it belongs (coded to allow it to be held in reverse
  * priority order).  However, it is occasionally borrowed for other purposes.  It
@@ -329,6 +367,11 @@ typedef struct tskTaskControlBlock       /* The old naming convention is used to
     #if ( configUSE_POSIX_ERRNO == 1 )
         int iTaskErrno;
     #endif
+
+    #if ( configNUMBER_OF_CORES > 1 )
+        BaseType_t xCoreID;             /*< The core the task runs on. */
+        UBaseType_t uxCoreAffinityMask; /*< The cores the task is allowed to run on, bit n set for core n. */
+    #endif
 } tskTCB;
 
 /* The old tskTCB name is maintained above then typedefed to the new TCB_t name
@@ -337,13 +380,25 @@ typedef tskTCB TCB_t;
 
 /*lint -save -e956 A manual analysis and inspection has been used to determine
  * which static variables must be declared volatile. */
-PRIVILEGED_DATA TCB_t * volatile pxCurrentTCB = NULL;
+#if ( configNUMBER_OF_CORES == 1 )
+    PRIVILEGED_DATA TCB_t * volatile pxCurrentTCB = NULL;
+#else
+    /* pxCurrentTCB is the task running on the calling core.  It is read
+     * with the interrupts masked, as the calling task could otherwise move to
+     * another core between reading the core number and the array. */
+    PRIVILEGED_DATA TCB_t * volatile pxCurrentTCBs[ configNUMBER_OF_CORES ];
+    #define pxCurrentTCB    prvGetCurrentTCB()
+#endif
 
 /* Lists for ready and blocked tasks. --------------------
  * xDelayedTaskList1 and xDelayedTaskList2 could be moved to function scope but
  * doing so breaks some kernel aware debuggers and debuggers that rely on removing
  * the static qualifier. */
-PRIVILEGED_DATA static List_t pxReadyTasksLists[ configMAX_PRIORITIES ]; /*< Prioritised ready tasks. */
+#if ( configNUMBER_OF_CORES == 1 )
+    PRIVILEGED_DATA static List_t pxReadyTasksLists[ configMAX_PRIORITIES ]; /*< Prioritised ready tasks. */
+#else
+    PRIVILEGED_DATA static List_t pxReadyTasksLists[ configNUMBER_OF_CORES ][ configMAX_PRIORITIES ]; /*< Prioritised ready tasks of each core. */
+#endif
 PRIVILEGED_DATA static List_t xDelayedTaskList1;                         /*< Delayed tasks. */
 PRIVILEGED_DATA static List_t xDelayedTaskList2;                         /*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
 PRIVILEGED_DATA static List_t * volatile pxDelayedTaskList;              /*< Points to the delayed task list currently being used. */
@@ -372,14 +427,24 @@ PRIVILEGED_DATA static List_t xPendingReadyList;                         /*< Tas
 /* Other file private variables. --------------------------------*/
 PRIVILEGED_DATA static volatile UBaseType_t uxCurrentNumberOfTasks = ( UBaseType_t ) 0U;
 PRIVILEGED_DATA static volatile TickType_t xTickCount = ( TickType_t ) configINITIAL_TICK_COUNT;
-PRIVILEGED_DATA static volatile UBaseType_t uxTopReadyPriority = tskIDLE_PRIORITY;
 PRIVILEGED_DATA static volatile BaseType_t xSchedulerRunning = pdFALSE;
 PRIVILEGED_DATA static volatile TickType_t xPendedTicks = ( TickType_t ) 0U;
-PRIVILEGED_DATA static volatile BaseType_t xYieldPending = pdFALSE;
 PRIVILEGED_DATA static volatile BaseType_t xNumOfOverflows = ( BaseType_t ) 0;
 PRIVILEGED_DATA static UBaseType_t uxTaskNumber = ( UBaseType_t ) 0U;
 PRIVILEGED_DATA static volatile TickType_t xNextTaskUnblockTime = ( TickType_t ) 0U; /* Initialised to portMAX_DELAY before the scheduler starts. */
-PRIVILEGED_DATA static TaskHandle_t xIdleTaskHandle = NULL;                          /*< Holds the handle of the idle task.  The idle task is created automatically when the scheduler is started. */
+
+#if ( configNUMBER_OF_CORES == 1 )
+    PRIVILEGED_DATA static volatile UBaseType_t uxTopReadyPriority = tskIDLE_PRIORITY;
+    PRIVILEGED_DATA static volatile BaseType_t xYieldPending = pdFALSE;
+    PRIVILEGED_DATA static TaskHandle_t xIdleTaskHandle = NULL; /*< Holds the handle of the idle task.  The idle task is created automatically when the scheduler is started. */
+#else
+    PRIVILEGED_DATA static volatile UBaseType_t uxTopReadyPriority[ configNUMBER_OF_CORES ];
+    PRIVILEGED_DATA static volatile BaseType_t xYieldPendings[ configNUMBER_OF_CORES ];
+    PRIVILEGED_DATA static TaskHandle_t xIdleTaskHandles[ configNUMBER_OF_CORES ]; /*< One idle task is created for each core. */
+    PRIVILEGED_DATA static UBaseType_t uxTasksOnCore[ configNUMBER_OF_CORES ];     /*< Number of tasks belonging to each core, used to place new tasks. */
+    #define xYieldPending      xYieldPendings[ portGET_CORE_ID() ]
+    #define xIdleTaskHandle    xIdleTaskHandles[ portGET_CORE_ID() ]
+#endif
 
 /* Improve support for OpenOCD. The kernel tracks Ready tasks via priority lists.
  * For tracking the state of remote threads, OpenOCD uses uxTopUsedPriority
@@ -396,11 +461,26 @@ const volatile UBaseType_t uxTopUsedPriority = configMAX_PRIORITIES - 1U;
  * accessed from a critical section. */
 PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspended = ( UBaseType_t ) pdFALSE;
 
+#if ( configNUMBER_OF_CORES > 1 )
+
+/* The core that suspends the scheduler holds the task lock until it resumes
+ * it, so other cores can only block on the lock or defer their context
+ * switches.  uxSchedulerSuspendedOnCore records which core did, as only that
+ * core may call the API functions that must not be called while the
+ * scheduler is suspended. */
+    PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspendedOnCore[ configNUMBER_OF_CORES ];
+#endif
+
 #if ( configGENERATE_RUN_TIME_STATS == 1 )
 
 /* Do not move these variables to function scope as doing so prevents the
  * code working with debuggers that need to remove the static qualifier. */
-    PRIVILEGED_DATA static configRUN_TIME_COUNTER_TYPE ulTaskSwitchedInTime = 0UL;    /*< Holds the value of a timer/counter the last time a task was switched in. */
+    #if ( configNUMBER_OF_CORES == 1 )
+        PRIVILEGED_DATA static configRUN_TIME_COUNTER_TYPE ulTaskSwitchedInTime = 0UL; /*< Holds the value of a timer/counter the last time a task was switched in. */
+    #else
+        PRIVILEGED_DATA static configRUN_TIME_COUNTER_TYPE ulTaskSwitchedInTimes[ configNUMBER_OF_CORES ];
+        #define ulTaskSwitchedInTime    ulTaskSwitchedInTimes[ portGET_CORE_ID() ]
+    #endif
     PRIVILEGED_DATA static volatile configRUN_TIME_COUNTER_TYPE ulTotalRunTime = 0UL; /*< Holds the total amount of execution time as defined by the run time counter clock. */
 
 #endif
@@ -557,6 +637,43 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
  */
 static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
 
+#if ( configNUMBER_OF_CORES > 1 )
+
+/*
+ * Returns the task running on the calling core.
+ */
+    static TCB_t * prvGetCurrentTCB( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Interrupts xCoreID so it reschedules.  Returns pdTRUE without interrupting
+ * anything if xCoreID is the calling core, which must then yield itself.
+ */
+    static BaseType_t prvYieldCore( BaseType_t xCoreID ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called when pxTCB has been made ready.  If pxTCB belongs to the calling
+ * core, returns pdTRUE if it should preempt the running task.  Otherwise the
+ * core of pxTCB is interrupted if the task should preempt the task running
+ * there, and pdFALSE is returned.
+ */
+    static BaseType_t prvTaskPreempts( const TCB_t * pxTCB,
+                                       BaseType_t xOrEqual ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the allowed core with the least tasks.
+ */
+    static BaseType_t prvSelectCoreForTask( UBaseType_t uxCoreAffinityMask ) PRIVILEGED_FUNCTION;
+
+/*
+ * Moves a task that is not running to the core xCoreID, moving it to the ready
+ * lists of that core if it is ready.  Returns pdTRUE if the calling core must
+ * yield.  Called from a critical section.
+ */
+    static BaseType_t prvMoveTaskToCore( TCB_t * pxTCB,
+                                         BaseType_t xCoreID ) PRIVILEGED_FUNCTION;
+
+#endif /* configNUMBER_OF_CORES > 1 */
+
 /*
  * freertos_tasks_c_additions_init() should only be called if the user definable
  * macro FREERTOS_TASKS_C_ADDITIONS_INIT() is defined, as that is the only macro
@@ -935,6 +1052,12 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
         }
     #endif /* configUSE_MUTEXES */
 
+    #if ( configNUMBER_OF_CORES > 1 )
+        {
+            pxNewTCB->uxCoreAffinityMask = tskNO_AFFINITY;
+        }
+    #endif
+
     vListInitialiseItem( &( pxNewTCB->xStateListItem ) );
     vListInitialiseItem( &( pxNewTCB->xEventListItem ) );
 
@@ -1070,12 +1193,34 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
 
 static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
 {
+    #if ( configNUMBER_OF_CORES > 1 )
+        BaseType_t xYieldRequired = pdFALSE;
+    #endif
+
     /* Ensure interrupts don't access the task lists while the lists are being
      * updated. */
     taskENTER_CRITICAL();
     {
         uxCurrentNumberOfTasks++;
 
+        #if ( configNUMBER_OF_CORES > 1 )
+            {
+                if( uxCurrentNumberOfTasks == ( UBaseType_t ) 1 )
+                {
+                    prvInitialiseTaskLists();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* The task runs on the allowed core with the least tasks.  The
+                 * task each core runs first is selected when the scheduler
+                 * starts. */
+                pxNewTCB->xCoreID = prvSelectCoreForTask( pxNewTCB->uxCoreAffinityMask );
+                uxTasksOnCore[ pxNewTCB->xCoreID ]++;
+            }
+        #else /* if ( configNUMBER_OF_CORES > 1 ) */
         if( pxCurrentTCB == NULL )
         {
             /* There are no other tasks, or all the other tasks are in
@@ -1115,6 +1260,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                 mtCOVERAGE_TEST_MARKER();
             }
         }
+        #endif /* configNUMBER_OF_CORES > 1 */
 
         uxTaskNumber++;
 
@@ -1129,6 +1275,17 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
         prvAddTaskToReadyList( pxNewTCB );
 
         portSETUP_TCB( pxNewTCB );
+
+        #if ( configNUMBER_OF_CORES > 1 )
+            {
+                /* The running tasks are only compared within the critical
+                 * section, as they can change on the other cores. */
+                if( xSchedulerRunning != pdFALSE )
+                {
+                    xYieldRequired = taskTASK_PREEMPTS( pxNewTCB );
+                }
+            }
+        #endif
     }
     taskEXIT_CRITICAL();
 
@@ -1136,7 +1293,11 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
     {
         /* If the created task is of a higher priority than the current task
          * then it should run now. */
-        if( pxCurrentTCB->uxPriority < pxNewTCB->uxPriority )
+        #if ( configNUMBER_OF_CORES > 1 )
+            if( xYieldRequired != pdFALSE )
+        #else
+            if( pxCurrentTCB->uxPriority < pxNewTCB->uxPriority )
+        #endif
         {
             taskYIELD_IF_USING_PREEMPTION();
         }
@@ -1157,6 +1318,8 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
     void vTaskDelete( TaskHandle_t xTaskToDelete )
     {
         TCB_t * pxTCB;
+        BaseType_t xTaskIsRunning;
+        BaseType_t xYieldRequired = pdFALSE;
 
         taskENTER_CRITICAL();
         {
@@ -1167,7 +1330,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
             /* Remove task from the ready/delayed list. */
             if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
             {
-                taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+                taskRESET_READY_PRIORITY( taskCORE_OF( pxTCB ), pxTCB->uxPriority );
             }
             else
             {
@@ -1190,13 +1353,24 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
              * not return. */
             uxTaskNumber++;
 
-            if( pxTCB == pxCurrentTCB )
+            #if ( configNUMBER_OF_CORES > 1 )
+                {
+                    uxTasksOnCore[ pxTCB->xCoreID ]--;
+                }
+            #endif
+
+            xTaskIsRunning = taskTASK_IS_RUNNING( pxTCB );
+
+            if( xTaskIsRunning != pdFALSE )
             {
                 /* A task is deleting itself.  This cannot complete within the
                  * task itself, as a context switch to another task is required.
                  * Place the task in the termination list.  The idle task will
                  * check the termination list and free up any memory allocated by
-                 * the scheduler for the TCB and stack of the deleted task. */
+                 * the scheduler for the TCB and stack of the deleted task.  A
+                 * task running on another core is handled in the same way, the
+                 * idle task of that core frees it once it has been switched
+                 * out. */
                 vListInsertEnd( &xTasksWaitingTermination, &( pxTCB->xStateListItem ) );
 
                 /* Increment the ucTasksDeleted variable so the idle task knows
@@ -1214,6 +1388,8 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                  * hence xYieldPending is used to latch that a context switch is
                  * required. */
                 portPRE_TASK_DELETE_HOOK( pxTCB, &xYieldPending );
+
+                xYieldRequired = taskYIELD_CORE( taskCORE_OF( pxTCB ) );
             }
             else
             {
@@ -1230,7 +1406,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
         /* If the task is not deleting itself, call prvDeleteTCB from outside of
          * critical section. If a task deletes itself, prvDeleteTCB is called
          * from prvCheckTasksWaitingTermination which is called from Idle task. */
-        if( pxTCB != pxCurrentTCB )
+        if( xTaskIsRunning == pdFALSE )
         {
             prvDeleteTCB( pxTCB );
         }
@@ -1239,9 +1415,9 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
          * been deleted. */
         if( xSchedulerRunning != pdFALSE )
         {
-            if( pxTCB == pxCurrentTCB )
+            if( xYieldRequired != pdFALSE )
             {
-                configASSERT( uxSchedulerSuspended == 0 );
+                configASSERT( !taskSCHEDULER_SUSPENDED_BY_CALLER() );
                 portYIELD_WITHIN_API();
             }
             else
@@ -1264,7 +1440,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
 
         configASSERT( pxPreviousWakeTime );
         configASSERT( ( xTimeIncrement > 0U ) );
-        configASSERT( uxSchedulerSuspended == 0 );
+        configASSERT( !taskSCHEDULER_SUSPENDED_BY_CALLER() );
 
         vTaskSuspendAll();
         {
@@ -1350,7 +1526,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
         /* A delay time of zero just forces a reschedule. */
         if( xTicksToDelay > ( TickType_t ) 0U )
         {
-            configASSERT( uxSchedulerSuspended == 0 );
+            configASSERT( !taskSCHEDULER_SUSPENDED_BY_CALLER() );
             vTaskSuspendAll();
             {
                 traceTASK_DELAY();
@@ -1396,9 +1572,10 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
 
         configASSERT( pxTCB );
 
-        if( pxTCB == pxCurrentTCB )
+        if( taskTASK_IS_RUNNING( pxTCB ) )
         {
-            /* The task calling this function is querying its own state. */
+            /* The task calling this function is querying its own state, or
+             * the task is running on another core. */
             eReturn = eRunning;
         }
         else
@@ -1590,14 +1767,20 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                  * priority than the calling task. */
                 if( uxNewPriority > uxCurrentBasePriority )
                 {
-                    if( pxTCB != pxCurrentTCB )
+                    if( taskTASK_IS_RUNNING( pxTCB ) == pdFALSE )
                     {
                         /* The priority of a task other than the currently
                          * running task is being raised.  Is the priority being
-                         * raised above that of the running task? */
-                        if( uxNewPriority >= pxCurrentTCB->uxPriority )
+                         * raised above that of the running task?  With several
+                         * cores, that is the task running on the core of the
+                         * task, and no task runs before the scheduler starts. */
+                        #if ( configNUMBER_OF_CORES > 1 )
+                            if( ( xSchedulerRunning != pdFALSE ) && ( uxNewPriority >= taskCURRENT_TCB( pxTCB->xCoreID )->uxPriority ) )
+                        #else
+                            if( uxNewPriority >= pxCurrentTCB->uxPriority )
+                        #endif
                         {
-                            xYieldRequired = pdTRUE;
+                            xYieldRequired = taskYIELD_CORE( taskCORE_OF( pxTCB ) );
                         }
                         else
                         {
@@ -1611,12 +1794,12 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                          * priority task able to run so no yield is required. */
                     }
                 }
-                else if( pxTCB == pxCurrentTCB )
+                else if( taskTASK_IS_RUNNING( pxTCB ) )
                 {
                     /* Setting the priority of the running task down means
                      * there may now be another task of higher priority that
                      * is ready to execute. */
-                    xYieldRequired = pdTRUE;
+                    xYieldRequired = taskYIELD_CORE( taskCORE_OF( pxTCB ) );
                 }
                 else
                 {
@@ -1667,7 +1850,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                  * nothing more than change its priority variable. However, if
                  * the task is in a ready list it needs to be removed and placed
                  * in the list appropriate to its new priority. */
-                if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+                if( listIS_CONTAINED_WITHIN( taskREADY_LIST( taskCORE_OF( pxTCB ), uxPriorityUsedOnEntry ), &( pxTCB->xStateListItem ) ) != pdFALSE )
                 {
                     /* The task is currently in its ready list - remove before
                      * adding it to its new ready list.  As we are in a critical
@@ -1677,7 +1860,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                         /* It is known that the task is in its ready list so
                          * there is no need to check again and the port level
                          * reset macro can be called directly. */
-                        portRESET_READY_PRIORITY( uxPriorityUsedOnEntry, uxTopReadyPriority );
+                        portRESET_READY_PRIORITY( uxPriorityUsedOnEntry, taskTOP_READY_PRIORITY( taskCORE_OF( pxTCB ) ) );
                     }
                     else
                     {
@@ -1717,6 +1900,10 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
     {
         TCB_t * pxTCB;
 
+        #if ( configNUMBER_OF_CORES > 1 )
+            BaseType_t xYieldRequired = pdFALSE;
+        #endif
+
         taskENTER_CRITICAL();
         {
             /* If null is passed in here then it is the running task that is
@@ -1729,7 +1916,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
              * suspended list. */
             if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
             {
-                taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+                taskRESET_READY_PRIORITY( taskCORE_OF( pxTCB ), pxTCB->uxPriority );
             }
             else
             {
@@ -1763,6 +1950,17 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                     }
                 }
             #endif /* if ( configUSE_TASK_NOTIFICATIONS == 1 ) */
+
+            #if ( configNUMBER_OF_CORES > 1 )
+                {
+                    /* A task running on another core is switched out by that
+                     * core. */
+                    if( taskTASK_IS_RUNNING( pxTCB ) )
+                    {
+                        xYieldRequired = taskYIELD_CORE( pxTCB->xCoreID );
+                    }
+                }
+            #endif
         }
         taskEXIT_CRITICAL();
 
@@ -1781,19 +1979,26 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
             mtCOVERAGE_TEST_MARKER();
         }
 
-        if( pxTCB == pxCurrentTCB )
+        #if ( configNUMBER_OF_CORES > 1 )
+            if( xYieldRequired != pdFALSE )
+        #else
+            if( pxTCB == pxCurrentTCB )
+        #endif
         {
             if( xSchedulerRunning != pdFALSE )
             {
                 /* The current task has just been suspended. */
-                configASSERT( uxSchedulerSuspended == 0 );
+                configASSERT( !taskSCHEDULER_SUSPENDED_BY_CALLER() );
                 portYIELD_WITHIN_API();
             }
+            #if ( configNUMBER_OF_CORES == 1 )
             else
             {
                 /* The scheduler is not running, but the task that was pointed
                  * to by pxCurrentTCB has just been suspended and pxCurrentTCB
-                 * must be adjusted to point to a different task. */
+                 * must be adjusted to point to a different task.  With several
+                 * cores, the tasks to run first are only selected when the
+                 * scheduler starts. */
                 if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == uxCurrentNumberOfTasks ) /*lint !e931 Right has no side effect, just volatile. */
                 {
                     /* No other tasks are ready, so set pxCurrentTCB back to
@@ -1807,6 +2012,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                     vTaskSwitchContext();
                 }
             }
+            #endif /* configNUMBER_OF_CORES == 1 */
         }
         else
         {
@@ -1888,7 +2094,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                     prvAddTaskToReadyList( pxTCB );
 
                     /* A higher priority task may have just been resumed. */
-                    if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+                    if( taskTASK_PREEMPTS_OR_EQUAL( pxTCB ) )
                     {
                         /* This yield may not cause the task just resumed to run,
                          * but will leave the lists in the correct state for the
@@ -1956,7 +2162,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                 {
                     /* Ready lists can be accessed so move the task from the
                      * suspended list to the ready list directly. */
-                    if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+                    if( taskTASK_PREEMPTS_OR_EQUAL( pxTCB ) )
                     {
                         xYieldRequired = pdTRUE;
 
@@ -1999,7 +2205,37 @@ void vTaskStartScheduler( void )
     BaseType_t xReturn;
 
     /* Add the idle task at the lowest priority. */
-    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    #if ( configNUMBER_OF_CORES > 1 )
+        {
+            BaseType_t xCoreID;
+
+            /* Each core has its own idle task, which never leaves the core.
+             * The idle tasks are always created using dynamically allocated
+             * RAM, as vApplicationGetIdleTaskMemory() only provides the memory
+             * for one task. */
+            xReturn = pdPASS;
+
+            for( xCoreID = 0; ( xCoreID < ( BaseType_t ) configNUMBER_OF_CORES ) && ( xReturn == pdPASS ); xCoreID++ )
+            {
+                xReturn = xTaskCreate( prvIdleTask,
+                                       configIDLE_TASK_NAME,
+                                       configMINIMAL_STACK_SIZE,
+                                       ( void * ) NULL,
+                                       portPRIVILEGE_BIT,
+                                       &( xIdleTaskHandles[ xCoreID ] ) );
+
+                if( xReturn == pdPASS )
+                {
+                    taskENTER_CRITICAL();
+                    {
+                        xIdleTaskHandles[ xCoreID ]->uxCoreAffinityMask = ( UBaseType_t ) 1U << xCoreID;
+                        ( void ) prvMoveTaskToCore( xIdleTaskHandles[ xCoreID ], xCoreID );
+                    }
+                    taskEXIT_CRITICAL();
+                }
+            }
+        }
+    #elif ( configSUPPORT_STATIC_ALLOCATION == 1 )
         {
             StaticTask_t * pxIdleTaskTCBBuffer = NULL;
             StackType_t * pxIdleTaskStackBuffer = NULL;
@@ -2035,7 +2271,7 @@ void vTaskStartScheduler( void )
                                    portPRIVILEGE_BIT,  /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
                                    &xIdleTaskHandle ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
         }
-    #endif /* configSUPPORT_STATIC_ALLOCATION */
+    #endif /* configNUMBER_OF_CORES */
 
     #if ( configUSE_TIMERS == 1 )
         {
@@ -2078,6 +2314,18 @@ void vTaskStartScheduler( void )
             }
         #endif /* configUSE_NEWLIB_REENTRANT */
 
+        #if ( configNUMBER_OF_CORES > 1 )
+            {
+                BaseType_t xCoreID;
+
+                /* Select the task each core runs first. */
+                for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+                {
+                    taskSELECT_HIGHEST_PRIORITY_TASK( xCoreID ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+                }
+            }
+        #endif
+
         xNextTaskUnblockTime = portMAX_DELAY;
         xSchedulerRunning = pdTRUE;
         xTickCount = ( TickType_t ) configINITIAL_TICK_COUNT;
@@ -2146,7 +2394,31 @@ void vTaskSuspendAll( void )
 
     /* The scheduler is suspended if uxSchedulerSuspended is non-zero.  An increment
      * is used to allow calls to vTaskSuspendAll() to nest. */
-    ++uxSchedulerSuspended;
+    #if ( configNUMBER_OF_CORES > 1 )
+        if( xSchedulerRunning != pdFALSE )
+        {
+            UBaseType_t uxSavedInterruptStatus;
+
+            /* The task lock is held until xTaskResumeAll() so the tasks of
+             * the other cores cannot access the kernel lists meanwhile.  The
+             * counts are changed with the ISR lock held so the interrupts of
+             * the other cores see them change together. */
+            uxSavedInterruptStatus = portSET_INTERRUPT_MASK();
+            portGET_TASK_LOCK();
+            portGET_ISR_LOCK();
+            ++uxSchedulerSuspended;
+            ++uxSchedulerSuspendedOnCore[ portGET_CORE_ID() ];
+            portRELEASE_ISR_LOCK();
+            portCLEAR_INTERRUPT_MASK( uxSavedInterruptStatus );
+        }
+        else
+        {
+            ++uxSchedulerSuspended;
+            ++uxSchedulerSuspendedOnCore[ portGET_CORE_ID() ];
+        }
+    #else /* if ( configNUMBER_OF_CORES > 1 ) */
+        ++uxSchedulerSuspended;
+    #endif /* configNUMBER_OF_CORES > 1 */
 
     /* Enforces ordering for ports and optimised compilers that may otherwise place
      * the above increment elsewhere. */
@@ -2224,7 +2496,7 @@ BaseType_t xTaskResumeAll( void )
 
     /* If uxSchedulerSuspended is zero then this function does not match a
      * previous call to vTaskSuspendAll(). */
-    configASSERT( uxSchedulerSuspended );
+    configASSERT( taskSCHEDULER_SUSPENDED_BY_CALLER() );
 
     /* It is possible that an ISR caused a task to be removed from an event
      * list while the scheduler was suspended.  If this was the case then the
@@ -2235,6 +2507,18 @@ BaseType_t xTaskResumeAll( void )
     {
         --uxSchedulerSuspended;
 
+        #if ( configNUMBER_OF_CORES > 1 )
+            {
+                --uxSchedulerSuspendedOnCore[ portGET_CORE_ID() ];
+
+                /* The critical section still holds the task lock. */
+                if( xSchedulerRunning != pdFALSE )
+                {
+                    portRELEASE_TASK_LOCK();
+                }
+            }
+        #endif
+
         if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
         {
             if( uxCurrentNumberOfTasks > ( UBaseType_t ) 0U )
@@ -2251,7 +2535,7 @@ BaseType_t xTaskResumeAll( void )
 
                     /* If the moved task has a priority higher than or equal to
                      * the current task then a yield must be performed. */
-                    if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+                    if( taskTASK_PREEMPTS_OR_EQUAL( pxTCB ) )
                     {
                         xYieldPending = pdTRUE;
                     }
@@ -2468,26 +2752,32 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char
 
     TaskHandle_t xTaskGetHandle( const char * pcNameToQuery ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
     {
-        UBaseType_t uxQueue = configMAX_PRIORITIES;
-        TCB_t * pxTCB;
+        UBaseType_t uxQueue;
+        BaseType_t xCoreID;
+        TCB_t * pxTCB = NULL;
 
         /* Task names will be truncated to configMAX_TASK_NAME_LEN - 1 bytes. */
         configASSERT( strlen( pcNameToQuery ) < configMAX_TASK_NAME_LEN );
 
         vTaskSuspendAll();
         {
-            /* Search the ready lists. */
-            do
+            /* Search the ready lists of each core. */
+            for( xCoreID = 0; ( xCoreID < ( BaseType_t ) configNUMBER_OF_CORES ) && ( pxTCB == NULL ); xCoreID++ )
             {
-                uxQueue--;
-                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) &( pxReadyTasksLists[ uxQueue ] ), pcNameToQuery );
+                uxQueue = configMAX_PRIORITIES;
 
-                if( pxTCB != NULL )
+                do
                 {
-                    /* Found the handle. */
-                    break;
-                }
-            } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+                    uxQueue--;
+                    pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) taskREADY_LIST( xCoreID, uxQueue ), pcNameToQuery );
+
+                    if( pxTCB != NULL )
+                    {
+                        /* Found the handle. */
+                        break;
+                    }
+                } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+            }
 
             /* Search the delayed lists. */
             if( pxTCB == NULL )
@@ -2534,7 +2824,8 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char
                                       const UBaseType_t uxArraySize,
                                       configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime )
     {
-        UBaseType_t uxTask = 0, uxQueue = configMAX_PRIORITIES;
+        UBaseType_t uxTask = 0, uxQueue;
+        BaseType_t xCoreID;
 
         vTaskSuspendAll();
         {
@@ -2542,12 +2833,17 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char
             if( uxArraySize >= uxCurrentNumberOfTasks )
             {
                 /* Fill in an TaskStatus_t structure with information on each
-                 * task in the Ready state. */
-                do
+                 * task in the Ready state, on each core. */
+                for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
                 {
-                    uxQueue--;
-                    uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxReadyTasksLists[ uxQueue ] ), eReady );
-                } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+                    uxQueue = configMAX_PRIORITIES;
+
+                    do
+                    {
+                        uxQueue--;
+                        uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), taskREADY_LIST( xCoreID, uxQueue ), eReady );
+                    } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+                }
 
                 /* Fill in an TaskStatus_t structure with information on each
                  * task in the Blocked state. */
@@ -2641,7 +2937,7 @@ BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp )
 
     /* Must not be called with the scheduler suspended as the implementation
      * relies on xPendedTicks being wound down to 0 in xTaskResumeAll(). */
-    configASSERT( uxSchedulerSuspended == 0 );
+    configASSERT( !taskSCHEDULER_SUSPENDED_BY_CALLER() );
 
     /* Use xPendedTicks to mimic xTicksToCatchUp number of ticks occurring when
      * the scheduler is suspended so the ticks are executed in xTaskResumeAll(). */
@@ -2707,7 +3003,7 @@ BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp )
                         /* Preemption is on, but a context switch should only be
                          * performed if the unblocked task has a priority that is
                          * higher than the currently executing task. */
-                        if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                        if( taskTASK_PREEMPTS( pxTCB ) )
                         {
                             /* Pend the yield to be performed when the scheduler
                              * is unsuspended. */
@@ -2739,6 +3035,14 @@ BaseType_t xTaskIncrementTick( void )
     TickType_t xItemValue;
     BaseType_t xSwitchRequired = pdFALSE;
 
+    #if ( configNUMBER_OF_CORES > 1 )
+        UBaseType_t uxSavedInterruptStatus;
+
+        /* The tick interrupt only occurs on one core, the lists must still be
+         * protected from the other cores. */
+        uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+    #endif
+
     /* Called by the portable layer each time a tick interrupt occurs.
      * Increments the tick then checks to see if the new tick value will cause any
      * tasks to be unblocked. */
@@ -2831,7 +3135,7 @@ BaseType_t xTaskIncrementTick( void )
                              * only be performed if the unblocked task has a
                              * priority that is equal to or higher than the
                              * currently executing task. */
-                            if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+                            if( taskTASK_PREEMPTS_OR_EQUAL( pxTCB ) )
                             {
                                 xSwitchRequired = pdTRUE;
                             }
@@ -2850,14 +3154,39 @@ BaseType_t xTaskIncrementTick( void )
          * writer has not explicitly turned time slicing off. */
         #if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
             {
-                if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 )
-                {
-                    xSwitchRequired = pdTRUE;
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
-                }
+                #if ( configNUMBER_OF_CORES > 1 )
+                    {
+                        BaseType_t xCoreID;
+
+                        /* The tick also ends the time slice of the tasks
+                         * running on the other cores. */
+                        for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+                        {
+                            if( listCURRENT_LIST_LENGTH( taskREADY_LIST( xCoreID, taskCURRENT_TCB( xCoreID )->uxPriority ) ) > ( UBaseType_t ) 1 )
+                            {
+                                if( taskYIELD_CORE( xCoreID ) != pdFALSE )
+                                {
+                                    xSwitchRequired = pdTRUE;
+                                }
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+                        }
+                    }
+                #else /* if ( configNUMBER_OF_CORES > 1 ) */
+                    {
+                        if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 )
+                        {
+                            xSwitchRequired = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                #endif /* if ( configNUMBER_OF_CORES > 1 ) */
             }
         #endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) ) */
 
@@ -2902,6 +3231,10 @@ BaseType_t xTaskIncrementTick( void )
         #endif
     }
 
+    #if ( configNUMBER_OF_CORES > 1 )
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+    #endif
+
     return xSwitchRequired;
 }
 /*-----------------------------------------------------------*/
@@ -3020,6 +3353,15 @@ BaseType_t xTaskIncrementTick( void )
 
 void vTaskSwitchContext( void )
 {
+    #if ( configNUMBER_OF_CORES > 1 )
+        const BaseType_t xCoreID = portGET_CORE_ID();
+
+        /* Called with the interrupts masked.  While another core has the
+         * scheduler suspended, this waits for it to resume the scheduler. */
+        portGET_TASK_LOCK();
+        portGET_ISR_LOCK();
+    #endif
+
     if( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE )
     {
         /* The scheduler is currently suspended - do not allow a context
@@ -3069,9 +3411,30 @@ void vTaskSwitchContext( void )
             }
         #endif
 
-        /* Select a new task to run using either the generic C or port
-         * optimised asm code. */
-        taskSELECT_HIGHEST_PRIORITY_TASK(); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+        #if ( configNUMBER_OF_CORES > 1 )
+            {
+                /* A running task whose affinity no longer allows this core
+                 * moves to another core once it has been switched out. */
+                if( ( pxCurrentTCBs[ xCoreID ]->uxCoreAffinityMask & ( ( UBaseType_t ) 1U << xCoreID ) ) == 0U )
+                {
+                    ( void ) prvMoveTaskToCore( pxCurrentTCBs[ xCoreID ], prvSelectCoreForTask( pxCurrentTCBs[ xCoreID ]->uxCoreAffinityMask ) );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* Select a new task to run using either the generic C or port
+                 * optimised asm code. */
+                taskSELECT_HIGHEST_PRIORITY_TASK( xCoreID ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+            }
+        #else /* if ( configNUMBER_OF_CORES > 1 ) */
+            {
+                /* Select a new task to run using either the generic C or port
+                 * optimised asm code. */
+                taskSELECT_HIGHEST_PRIORITY_TASK( 0 ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+            }
+        #endif /* if ( configNUMBER_OF_CORES > 1 ) */
         traceTASK_SWITCHED_IN();
 
         /* After the new task is switched in, update the global errno. */
@@ -3091,6 +3454,11 @@ void vTaskSwitchContext( void )
             }
         #endif /* configUSE_NEWLIB_REENTRANT */
     }
+
+    #if ( configNUMBER_OF_CORES > 1 )
+        portRELEASE_ISR_LOCK();
+        portRELEASE_TASK_LOCK();
+    #endif
 }
 /*-----------------------------------------------------------*/
 
@@ -3127,7 +3495,7 @@ void vTaskPlaceOnUnorderedEventList( List_t * pxEventList,
 
     /* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  It is used by
      * the event groups implementation. */
-    configASSERT( uxSchedulerSuspended != 0 );
+    configASSERT( taskSCHEDULER_SUSPENDED_BY_CALLER() );
 
     /* Store the item value in the event list item.  It is safe to access the
      * event list item here as interrupts won't access the event list item of a
@@ -3228,7 +3596,7 @@ BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList )
         listINSERT_END( &( xPendingReadyList ), &( pxUnblockedTCB->xEventListItem ) );
     }
 
-    if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+    if( taskTASK_PREEMPTS( pxUnblockedTCB ) )
     {
         /* Return true if the task removed from the event list has a higher
          * priority than the calling task.  This allows the calling task to know if
@@ -3255,7 +3623,7 @@ void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
 
     /* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  It is used by
      * the event flags implementation. */
-    configASSERT( uxSchedulerSuspended != pdFALSE );
+    configASSERT( taskSCHEDULER_SUSPENDED_BY_CALLER() );
 
     /* Store the new item value in the event list. */
     listSET_LIST_ITEM_VALUE( pxEventListItem, xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
@@ -3286,7 +3654,7 @@ void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
     listREMOVE_ITEM( &( pxUnblockedTCB->xStateListItem ) );
     prvAddTaskToReadyList( pxUnblockedTCB );
 
-    if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+    if( taskTASK_PREEMPTS( pxUnblockedTCB ) )
     {
         /* The unblocked task has a priority above that of the calling task, so
          * a context switch is required.  This function is called with the
@@ -3478,7 +3846,7 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
                  * the list, and an occasional incorrect value will not matter.  If
                  * the ready list at the idle priority contains more than one task
                  * then a task other than the idle task is ready to execute. */
-                if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > ( UBaseType_t ) 1 )
+                if( listCURRENT_LIST_LENGTH( taskREADY_LIST( taskCORE_OF( pxCurrentTCB ), tskIDLE_PRIORITY ) ) > ( UBaseType_t ) 1 )
                 {
                     taskYIELD();
                 }
@@ -3666,10 +4034,14 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
 static void prvInitialiseTaskLists( void )
 {
     UBaseType_t uxPriority;
+    BaseType_t xCoreID;
 
-    for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configMAX_PRIORITIES; uxPriority++ )
+    for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
     {
-        vListInitialise( &( pxReadyTasksLists[ uxPriority ] ) );
+        for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configMAX_PRIORITIES; uxPriority++ )
+        {
+            vListInitialise( taskREADY_LIST( xCoreID, uxPriority ) );
+        }
     }
 
     vListInitialise( &xDelayedTaskList1 );
@@ -3707,14 +4079,50 @@ static void prvCheckTasksWaitingTermination( void )
              * being called too often in the idle task. */
             while( uxDeletedTasksWaitingCleanUp > ( UBaseType_t ) 0U )
             {
-                taskENTER_CRITICAL();
-                {
-                    pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xTasksWaitingTermination ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-                    ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-                    --uxCurrentNumberOfTasks;
-                    --uxDeletedTasksWaitingCleanUp;
-                }
-                taskEXIT_CRITICAL();
+                #if ( configNUMBER_OF_CORES > 1 )
+                    {
+                        ListItem_t const * pxEndMarker = listGET_END_MARKER( &xTasksWaitingTermination );
+                        ListItem_t * pxIterator;
+
+                        /* A deleted task may still be running on another
+                         * core.  The tasks of the core of this idle task are
+                         * known not to be, the other tasks are freed by the
+                         * idle tasks of their cores. */
+                        pxTCB = NULL;
+
+                        taskENTER_CRITICAL();
+                        {
+                            for( pxIterator = listGET_HEAD_ENTRY( &xTasksWaitingTermination ); pxIterator != pxEndMarker; pxIterator = listGET_NEXT( pxIterator ) )
+                            {
+                                if( ( ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxIterator ) )->xCoreID == portGET_CORE_ID() )
+                                {
+                                    pxTCB = listGET_LIST_ITEM_OWNER( pxIterator ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+                                    ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                                    --uxCurrentNumberOfTasks;
+                                    --uxDeletedTasksWaitingCleanUp;
+                                    break;
+                                }
+                            }
+                        }
+                        taskEXIT_CRITICAL();
+
+                        if( pxTCB == NULL )
+                        {
+                            break;
+                        }
+                    }
+                #else /* if ( configNUMBER_OF_CORES > 1 ) */
+                    {
+                        taskENTER_CRITICAL();
+                        {
+                            pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xTasksWaitingTermination ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+                            ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                            --uxCurrentNumberOfTasks;
+                            --uxDeletedTasksWaitingCleanUp;
+                        }
+                        taskEXIT_CRITICAL();
+                    }
+                #endif /* if ( configNUMBER_OF_CORES > 1 ) */
 
                 prvDeleteTCB( pxTCB );
             }
@@ -3766,7 +4174,7 @@ static void prvCheckTasksWaitingTermination( void )
          * state is just set to whatever is passed in. */
         if( eState != eInvalid )
         {
-            if( pxTCB == pxCurrentTCB )
+            if( taskTASK_IS_RUNNING( pxTCB ) )
             {
                 pxTaskStatus->eCurrentState = eRunning;
             }
@@ -4100,14 +4508,14 @@ static void prvResetNextTaskUnblockTime( void )
 
                 /* If the task being modified is in the ready state it will need
                  * to be moved into a new list. */
-                if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxMutexHolderTCB->uxPriority ] ), &( pxMutexHolderTCB->xStateListItem ) ) != pdFALSE )
+                if( listIS_CONTAINED_WITHIN( taskREADY_LIST( taskCORE_OF( pxMutexHolderTCB ), pxMutexHolderTCB->uxPriority ), &( pxMutexHolderTCB->xStateListItem ) ) != pdFALSE )
                 {
                     if( uxListRemove( &( pxMutexHolderTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
                     {
                         /* It is known that the task is in its ready list so
                          * there is no need to check again and the port level
                          * reset macro can be called directly. */
-                        portRESET_READY_PRIORITY( pxMutexHolderTCB->uxPriority, uxTopReadyPriority );
+                        portRESET_READY_PRIORITY( pxMutexHolderTCB->uxPriority, taskTOP_READY_PRIORITY( taskCORE_OF( pxMutexHolderTCB ) ) );
                     }
                     else
                     {
@@ -4190,7 +4598,7 @@ static void prvResetNextTaskUnblockTime( void )
                      * the holding task from the ready list. */
                     if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
                     {
-                        portRESET_READY_PRIORITY( pxTCB->uxPriority, uxTopReadyPriority );
+                        portRESET_READY_PRIORITY( pxTCB->uxPriority, taskTOP_READY_PRIORITY( taskCORE_OF( pxTCB ) ) );
                     }
                     else
                     {
@@ -4305,14 +4713,14 @@ static void prvResetNextTaskUnblockTime( void )
                      * from its current state list if it is in the Ready state as
                      * the task's priority is going to change and there is one
                      * Ready list per priority. */
-                    if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+                    if( listIS_CONTAINED_WITHIN( taskREADY_LIST( taskCORE_OF( pxTCB ), uxPriorityUsedOnEntry ), &( pxTCB->xStateListItem ) ) != pdFALSE )
                     {
                         if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
                         {
                             /* It is known that the task is in its ready list so
                              * there is no need to check again and the port level
                              * reset macro can be called directly. */
-                            portRESET_READY_PRIORITY( pxTCB->uxPriority, uxTopReadyPriority );
+                            portRESET_READY_PRIORITY( pxTCB->uxPriority, taskTOP_READY_PRIORITY( taskCORE_OF( pxTCB ) ) );
                         }
                         else
                         {
@@ -4408,6 +4816,453 @@ static void prvResetNextTaskUnblockTime( void )
 #endif /* portCRITICAL_NESTING_IN_TCB */
 /*-----------------------------------------------------------*/
 
+#if ( configNUMBER_OF_CORES > 1 )
+
+    void vTaskEnterCritical( void )
+    {
+        ( void ) portSET_INTERRUPT_MASK();
+
+        portINCREMENT_CRITICAL_NESTING_COUNT();
+
+        if( portGET_CRITICAL_NESTING_COUNT() == 1U )
+        {
+            /* This is not the interrupt safe version of the enter critical
+             * function so  assert() if it is being called from an interrupt
+             * context. */
+            configASSERT( !portCHECK_IF_IN_ISR() );
+
+            /* The count is not 1 before the first task starts, so the locks are
+             * only used once the cores run tasks. */
+            if( xSchedulerRunning != pdFALSE )
+            {
+                portGET_TASK_LOCK();
+                portGET_ISR_LOCK();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* configNUMBER_OF_CORES > 1 */
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+    void vTaskExitCritical( void )
+    {
+        BaseType_t xYieldCurrentTask = pdFALSE;
+
+        configASSERT( portGET_CRITICAL_NESTING_COUNT() > 0U );
+
+        if( portGET_CRITICAL_NESTING_COUNT() == 1U )
+        {
+            if( xSchedulerRunning != pdFALSE )
+            {
+                /* A yield requested within the critical section is performed
+                 * now, unless the calling task has suspended the scheduler. */
+                if( !taskSCHEDULER_SUSPENDED_BY_CALLER() )
+                {
+                    xYieldCurrentTask = xYieldPending;
+                }
+
+                portRELEASE_ISR_LOCK();
+                portRELEASE_TASK_LOCK();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            portDECREMENT_CRITICAL_NESTING_COUNT();
+            portCLEAR_INTERRUPT_MASK( pdFALSE );
+
+            if( xYieldCurrentTask != pdFALSE )
+            {
+                portYIELD();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else if( portGET_CRITICAL_NESTING_COUNT() > 1U )
+        {
+            portDECREMENT_CRITICAL_NESTING_COUNT();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* configNUMBER_OF_CORES > 1 */
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+    UBaseType_t vTaskEnterCriticalFromISR( void )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK();
+
+        if( xSchedulerRunning != pdFALSE )
+        {
+            portGET_ISR_LOCK();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return uxSavedInterruptStatus;
+    }
+
+#endif /* configNUMBER_OF_CORES > 1 */
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+    void vTaskExitCriticalFromISR( UBaseType_t uxSavedInterruptStatus )
+    {
+        if( xSchedulerRunning != pdFALSE )
+        {
+            portRELEASE_ISR_LOCK();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        portCLEAR_INTERRUPT_MASK( uxSavedInterruptStatus );
+    }
+
+#endif /* configNUMBER_OF_CORES > 1 */
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+    void vTaskYieldWithinAPI( void )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+        BaseType_t xInCritical;
+
+        uxSavedInterruptStatus = portDISABLE_INTERRUPTS_SAVE();
+        {
+            xInCritical = ( portGET_CRITICAL_NESTING_COUNT() != 0U ) ? pdTRUE : pdFALSE;
+
+            if( xInCritical != pdFALSE )
+            {
+                /* The locks must be released first, vTaskExitCritical()
+                 * yields. */
+                xYieldPending = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        portRESTORE_INTERRUPTS( uxSavedInterruptStatus );
+
+        if( xInCritical == pdFALSE )
+        {
+            portYIELD();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* configNUMBER_OF_CORES > 1 */
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+    static TCB_t * prvGetCurrentTCB( void )
+    {
+        TCB_t * pxTCB;
+        UBaseType_t uxSavedInterruptStatus;
+
+        uxSavedInterruptStatus = portDISABLE_INTERRUPTS_SAVE();
+        {
+            pxTCB = pxCurrentTCBs[ portGET_CORE_ID() ];
+        }
+        portRESTORE_INTERRUPTS( uxSavedInterruptStatus );
+
+        return pxTCB;
+    }
+
+#endif /* configNUMBER_OF_CORES > 1 */
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+    static BaseType_t prvYieldCore( BaseType_t xCoreID )
+    {
+        BaseType_t xReturn = pdFALSE;
+
+        /* Called with the interrupts masked, so the calling core cannot
+         * change. */
+        if( xCoreID == portGET_CORE_ID() )
+        {
+            xReturn = pdTRUE;
+        }
+        else if( xSchedulerRunning != pdFALSE )
+        {
+            portYIELD_CORE( xCoreID );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+
+#endif /* configNUMBER_OF_CORES > 1 */
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+    static BaseType_t prvTaskPreempts( const TCB_t * pxTCB,
+                                       BaseType_t xOrEqual )
+    {
+        const TCB_t * const pxRunningTCB = pxCurrentTCBs[ pxTCB->xCoreID ];
+        BaseType_t xReturn = pdFALSE;
+
+        /* No task runs on the cores before the scheduler starts. */
+        if( pxRunningTCB != NULL )
+        {
+            if( ( pxTCB->uxPriority > pxRunningTCB->uxPriority ) ||
+                ( ( xOrEqual != pdFALSE ) && ( pxTCB->uxPriority == pxRunningTCB->uxPriority ) ) )
+            {
+                if( pxTCB->xCoreID == portGET_CORE_ID() )
+                {
+                    xReturn = pdTRUE;
+                }
+                else
+                {
+                    /* Without preemption the other core picks the task up at
+                     * its next context switch. */
+                    #if ( configUSE_PREEMPTION == 1 )
+                        {
+                            ( void ) prvYieldCore( pxTCB->xCoreID );
+                        }
+                    #endif
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+
+#endif /* configNUMBER_OF_CORES > 1 */
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+    static BaseType_t prvSelectCoreForTask( UBaseType_t uxCoreAffinityMask )
+    {
+        BaseType_t xCoreID;
+        BaseType_t xSelectedCore = -1;
+
+        for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+        {
+            if( ( uxCoreAffinityMask & ( ( UBaseType_t ) 1U << xCoreID ) ) != 0U )
+            {
+                if( ( xSelectedCore < 0 ) || ( uxTasksOnCore[ xCoreID ] < uxTasksOnCore[ xSelectedCore ] ) )
+                {
+                    xSelectedCore = xCoreID;
+                }
+            }
+        }
+
+        /* The mask must allow at least one of the cores. */
+        configASSERT( xSelectedCore >= 0 );
+
+        if( xSelectedCore < 0 )
+        {
+            xSelectedCore = 0;
+        }
+
+        return xSelectedCore;
+    }
+
+#endif /* configNUMBER_OF_CORES > 1 */
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+    static BaseType_t prvMoveTaskToCore( TCB_t * pxTCB,
+                                         BaseType_t xCoreID )
+    {
+        BaseType_t xYieldRequired = pdFALSE;
+
+        if( pxTCB->xCoreID != xCoreID )
+        {
+            uxTasksOnCore[ pxTCB->xCoreID ]--;
+            uxTasksOnCore[ xCoreID ]++;
+
+            /* A ready task moves to the ready lists of its new core, the
+             * other states are not held per core. */
+            if( listIS_CONTAINED_WITHIN( taskREADY_LIST( pxTCB->xCoreID, pxTCB->uxPriority ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+            {
+                if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+                {
+                    portRESET_READY_PRIORITY( pxTCB->uxPriority, taskTOP_READY_PRIORITY( pxTCB->xCoreID ) );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                pxTCB->xCoreID = xCoreID;
+                prvAddTaskToReadyList( pxTCB );
+                xYieldRequired = taskTASK_PREEMPTS( pxTCB );
+            }
+            else
+            {
+                pxTCB->xCoreID = xCoreID;
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xYieldRequired;
+    }
+
+#endif /* configNUMBER_OF_CORES > 1 */
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+    void vTaskCoreAffinitySet( const TaskHandle_t xTask,
+                               UBaseType_t uxCoreAffinityMask )
+    {
+        TCB_t * pxTCB;
+        BaseType_t xCoreID;
+        BaseType_t xYieldRequired = pdFALSE;
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+
+            /* The idle tasks never leave their cores. */
+            for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+            {
+                configASSERT( pxTCB != xIdleTaskHandles[ xCoreID ] );
+            }
+
+            pxTCB->uxCoreAffinityMask = uxCoreAffinityMask;
+
+            if( ( uxCoreAffinityMask & ( ( UBaseType_t ) 1U << pxTCB->xCoreID ) ) == 0U )
+            {
+                if( taskTASK_IS_RUNNING( pxTCB ) )
+                {
+                    /* The task is moved by its core once it has been switched
+                     * out, see vTaskSwitchContext(). */
+                    xYieldRequired = taskYIELD_CORE( pxTCB->xCoreID );
+                }
+                else
+                {
+                    xYieldRequired = prvMoveTaskToCore( pxTCB, prvSelectCoreForTask( uxCoreAffinityMask ) );
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( ( xYieldRequired != pdFALSE ) && ( xSchedulerRunning != pdFALSE ) )
+            {
+                portYIELD_WITHIN_API();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+
+#endif /* configNUMBER_OF_CORES > 1 */
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+    UBaseType_t vTaskCoreAffinityGet( const TaskHandle_t xTask )
+    {
+        UBaseType_t uxCoreAffinityMask;
+
+        taskENTER_CRITICAL();
+        {
+            uxCoreAffinityMask = prvGetTCBFromHandle( xTask )->uxCoreAffinityMask;
+        }
+        taskEXIT_CRITICAL();
+
+        return uxCoreAffinityMask;
+    }
+
+#endif /* configNUMBER_OF_CORES > 1 */
+/*-----------------------------------------------------------*/
+
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+    BaseType_t xTaskCreateAffinitySet( TaskFunction_t pxTaskCode,
+                                       const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                       const configSTACK_DEPTH_TYPE usStackDepth,
+                                       void * const pvParameters,
+                                       UBaseType_t uxPriority,
+                                       UBaseType_t uxCoreAffinityMask,
+                                       TaskHandle_t * const pxCreatedTask )
+    {
+        BaseType_t xReturn;
+        TaskHandle_t xCreatedTask;
+
+        /* The task must not start on a core its affinity excludes. */
+        vTaskSuspendAll();
+        {
+            xReturn = xTaskCreate( pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority, &xCreatedTask );
+
+            if( xReturn == pdPASS )
+            {
+                vTaskCoreAffinitySet( xCreatedTask, uxCoreAffinityMask );
+
+                if( pxCreatedTask != NULL )
+                {
+                    *pxCreatedTask = xCreatedTask;
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        ( void ) xTaskResumeAll();
+
+        return xReturn;
+    }
+
+#endif /* ( configNUMBER_OF_CORES > 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
+/*-----------------------------------------------------------*/
+
 #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
 
     static char * prvWriteNameToBuffer( char * pcBuffer,
@@ -4956,7 +5811,7 @@ TickType_t uxTaskResetEventItemValue( void )
                     }
                 #endif
 
-                if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                if( taskTASK_PREEMPTS( pxTCB ) )
                 {
                     /* The notified task has a priority above the currently
                      * executing task so a yield is required. */
@@ -5091,7 +5946,7 @@ TickType_t uxTaskResetEventItemValue( void )
                     listINSERT_END( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
                 }
 
-                if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                if( taskTASK_PREEMPTS( pxTCB ) )
                 {
                     /* The notified task has a priority above the currently
                      * executing task so a yield is required. */
@@ -5182,7 +6037,7 @@ TickType_t uxTaskResetEventItemValue( void )
                     listINSERT_END( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
                 }
 
-                if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                if( taskTASK_PREEMPTS( pxTCB ) )
                 {
                     /* The notified task has a priority above the currently
                      * executing task so a yield is required. */
@@ -5328,7 +6183,7 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
     {
         /* The current task must be in a ready list, so there is no need to
          * check, and the port reset macro can be called directly. */
-        portRESET_READY_PRIORITY( pxCurrentTCB->uxPriority, uxTopReadyPriority ); /*lint !e931 pxCurrentTCB cannot change as it is the calling task.  pxCurrentTCB->uxPriority and uxTopReadyPriority cannot change as called with scheduler suspended or in a critical section. */
+        portRESET_READY_PRIORITY( pxCurrentTCB->uxPriority, taskTOP_READY_PRIORITY( taskCORE_OF( pxCurrentTCB ) ) ); /*lint !e931 pxCurrentTCB cannot change as it is the calling task.  pxCurrentTCB->uxPriority and uxTopReadyPriority cannot change as called with scheduler suspended or in a critical section. */
     }
     else
     {
@@ -22,11 +22,18 @@ extern "C" {
  *  @{
  */
 
+/** Shared memory attributes, for metal_shmem_alloc(). */
+#define METAL_SHMEM_CACHED	(1U << 0) /**< cached, needs cache maintenance */
+#define METAL_SHMEM_NEAR_APU	(1U << 1) /**< close to the APU, e.g. DDR */
+#define METAL_SHMEM_NEAR_RPU	(1U << 2) /**< close to the RPU, e.g. TCM, OCM */
+#define METAL_SHMEM_HEAP	(1U << 31) /**< set by metal_shmem_heap_init() */
+
 /** Generic shared memory data structure. */
 struct metal_generic_shmem {
 	const char		*name; /**< shared memory name */
 	struct metal_io_region	io;    /**< shared memory I/O region */
 	struct metal_list	node;  /**< memory node */
+	unsigned int		attr;  /**< shared memory attributes */
 };
 
 /**
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2026, Xilinx Inc. and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * @file	shmem_alloc.c
+ * @brief	Shared memory allocator for libmetal.
+ */
+
+#include <metal/assert.h>
+#include <metal/atomic.h>
+#include <metal/errno.h>
+#include <metal/shmem_alloc.h>
+#include <metal/sys.h>
+#include <metal/utilities.h>
+
+#define METAL_SHMEM_HEAP_MAGIC	0x4d534850U
+#define METAL_SHMEM_POOL_MAGIC	0x4d535050U
+
+/* Free list head: ABA tag in the upper half, block index + 1 below. */
+#define POOL_HEAD_INDEX_MASK	0xFFFFU
+#define POOL_HEAD_TAG_INC	0x10000U
+
+/** Allocator state at the start of a region. */
+struct metal_shmem_heap_hdr {
+	atomic_uint	magic;
+	atomic_uint	brk;	/* offset of the free space */
+};
+
+/** Pool state, followed by the blocks. */
+struct metal_shmem_pool_hdr {
+	atomic_uint	magic;
+	atomic_uint	head;	/* first free block */
+	uint32_t	stride;
+	uint32_t	num_blocks;
+	atomic_uint	next[];	/* next free block of each free block */
+};
+
+int metal_shmem_heap_init(struct metal_generic_shmem *shmem, int create)
+{
+	struct metal_shmem_heap_hdr *hdr;
+	size_t size = metal_io_region_size(&shmem->io);
+
+	if (size < METAL_SHMEM_ALIGN)
+		return -EINVAL;
+
+	hdr = metal_io_virt(&shmem->io, 0);
+	if (!hdr)
+		return -EINVAL;
+
+	if (create) {
+		atomic_store(&hdr->brk, METAL_SHMEM_ALIGN);
+		atomic_store_explicit(&hdr->magic, METAL_SHMEM_HEAP_MAGIC,
+				      memory_order_release);
+	} else if (atomic_load_explicit(&hdr->magic, memory_order_acquire) !=
+		   METAL_SHMEM_HEAP_MAGIC) {
+		return -EAGAIN;
+	}
+
+	shmem->attr |= METAL_SHMEM_HEAP;
+	return 0;
+}
+
+static void *metal_shmem_heap_alloc(struct metal_io_region *io, size_t size)
+{
+	struct metal_shmem_heap_hdr *hdr = metal_io_virt(io, 0);
+	size_t limit = metal_io_region_size(io);
+	unsigned int brk, end;
+
+	size = metal_align_up(size, METAL_SHMEM_ALIGN);
+	brk = atomic_load(&hdr->brk);
+	do {
+		if (size > limit - brk)
+			return NULL;
+		end = brk + size;
+	} while (!atomic_compare_exchange_weak(&hdr->brk, &brk, end));
+
+	return metal_io_virt(io, brk);
+}
+
+void *metal_shmem_alloc(size_t size, unsigned int attr,
+			struct metal_io_region **io)
+{
+	struct metal_generic_shmem *shmem;
+	struct metal_list *node;
+	void *buf;
+
+	if (!size)
+		return NULL;
+
+	attr |= METAL_SHMEM_HEAP;
+	metal_list_for_each(&_metal.common.generic_shmem_list, node) {
+		shmem = metal_container_of(node, struct metal_generic_shmem, node);
+		if ((shmem->attr & attr) != attr)
+			continue;
+		buf = metal_shmem_heap_alloc(&shmem->io, size);
+		if (buf) {
+			if (io)
+				*io = &shmem->io;
+			return buf;
+		}
+	}
+
+	return NULL;
+}
+
+static void metal_shmem_pool_setup(struct metal_shmem_pool *pool,
+				   struct metal_io_region *io,
+				   struct metal_shmem_pool_hdr *hdr)
+{
+	size_t hdr_size = sizeof(*hdr) + hdr->num_blocks * sizeof(hdr->next[0]);
+
+	pool->io = io;
+	pool->hdr = hdr;
+	pool->base = (char *)hdr + metal_align_up(hdr_size, METAL_SHMEM_ALIGN);
+	pool->stride = hdr->stride;
+	pool->num_blocks = hdr->num_blocks;
+}
+
+int metal_shmem_pool_create(struct metal_shmem_pool *pool,
+			    size_t block_size, unsigned int num_blocks,
+			    unsigned int attr)
+{
+	struct metal_shmem_pool_hdr *hdr;
+	struct metal_io_region *io;
+	size_t hdr_size, stride;
+	unsigned int i;
+
+	if (!block_size || !num_blocks || num_blocks > METAL_SHMEM_POOL_MAX)
+		return -EINVAL;
+
+	/* Blocks don't share cache lines, for cached regions. */
+	stride = metal_align_up(block_size, METAL_SHMEM_ALIGN);
+	hdr_size = sizeof(*hdr) + num_blocks * sizeof(hdr->next[0]);
+	hdr = metal_shmem_alloc(metal_align_up(hdr_size, METAL_SHMEM_ALIGN) +
+				num_blocks * stride, attr, &io);
+	if (!hdr)
+		return -ENOMEM;
+
+	hdr->stride = stride;
+	hdr->num_blocks = num_blocks;
+	for (i = 0; i < num_blocks; i++)
+		atomic_store(&hdr->next[i], i + 2 <= num_blocks ? i + 2 : 0);
+	atomic_store(&hdr->head, 1);
+	atomic_store_explicit(&hdr->magic, METAL_SHMEM_POOL_MAGIC,
+			      memory_order_release);
+
+	metal_shmem_pool_setup(pool, io, hdr);
+	return 0;
+}
+
+int metal_shmem_pool_open(struct metal_shmem_pool *pool,
+			  struct metal_io_region *io,
+			  unsigned long offset)
+{
+	struct metal_shmem_pool_hdr *hdr = metal_io_virt(io, offset);
+
+	if (!hdr)
+		return -EINVAL;
+	if (atomic_load_explicit(&hdr->magic, memory_order_acquire) !=
+	    METAL_SHMEM_POOL_MAGIC)
+		return -EAGAIN;
+
+	metal_shmem_pool_setup(pool, io, hdr);
+	return 0;
+}
+
+void *metal_shmem_pool_get(struct metal_shmem_pool *pool)
+{
+	struct metal_shmem_pool_hdr *hdr = pool->hdr;
+	unsigned int head, index, next;
+
+	head = atomic_load(&hdr->head);
+	do {
+		index = head & POOL_HEAD_INDEX_MASK;
+		if (!index)
+			return NULL;
+		/* A stale next is caught by the tag of the exchange. */
+		next = atomic_load(&hdr->next[index - 1]);
+		next |= (head + POOL_HEAD_TAG_INC) & ~POOL_HEAD_INDEX_MASK;
+	} while (!atomic_compare_exchange_weak(&hdr->head, &head, next));
+
+	return (char *)pool->base + (index - 1) * pool->stride;
+}
+
+void metal_shmem_pool_put(struct metal_shmem_pool *pool, void *block)
+{
+	struct metal_shmem_pool_hdr *hdr = pool->hdr;
+	unsigned int head, index, next;
+
+	index = ((char *)block - (char *)pool->base) / pool->stride;
+	metal_assert(index < pool->num_blocks);
+	index++;
+
+	head = atomic_load(&hdr->head);
+	do {
+		atomic_store(&hdr->next[index - 1],
+			     head & POOL_HEAD_INDEX_MASK);
+		next = index | ((head + POOL_HEAD_TAG_INC) &
+				~POOL_HEAD_INDEX_MASK);
+	} while (!atomic_compare_exchange_weak(&hdr->head, &head, next));
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026, Xilinx Inc. and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * @file	shmem_alloc.h
+ * @brief	Shared memory allocator for libmetal.
+ */
+
+#ifndef __METAL_SHMEM_ALLOC__H__
+#define __METAL_SHMEM_ALLOC__H__
+
+#include <metal/shmem.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** \defgroup shmem_alloc Shared Memory Allocator Interfaces
+ *  @{
+ *
+ * Buffers are allocated from the generic shared memory regions registered
+ * with metal_shmem_register_generic(), picked by their attributes. The
+ * allocator state is kept in the regions themselves and updated with
+ * atomics, so the cores sharing a region allocate from it without locks.
+ * The atomics have to work between these cores on the region memory.
+ *
+ * Buffers allocated with metal_shmem_alloc() are never freed. Buffers that
+ * are recycled come from fixed-size pools instead, see
+ * metal_shmem_pool_create().
+ */
+
+/** Alignment of the allocated buffers and pool blocks. */
+#define METAL_SHMEM_ALIGN	64
+
+/** Maximum number of blocks in a pool. */
+#define METAL_SHMEM_POOL_MAX	0xFFFFU
+
+struct metal_shmem_pool_hdr;
+
+/** Fixed-size block pool in shared memory. */
+struct metal_shmem_pool {
+	struct metal_io_region		*io;	/**< region of the pool */
+	struct metal_shmem_pool_hdr	*hdr;	/**< shared pool state */
+	void				*base;	/**< first block */
+	size_t				stride;	/**< distance between blocks */
+	unsigned int			num_blocks; /**< number of blocks */
+};
+
+/**
+ * @brief	Enable allocation from a registered shared memory region.
+ *
+ * One of the cores sharing the region creates the allocator state at the
+ * start of the region. The other cores attach to it.
+ *
+ * @param[in]	shmem	Registered generic shmem structure.
+ * @param[in]	create	Non-zero to create the allocator state, zero to
+ *			attach to the state created by another core.
+ * @return	0 on success, -EAGAIN if the state is not created yet, or
+ *		-errno on failure.
+ */
+extern int metal_shmem_heap_init(struct metal_generic_shmem *shmem,
+				 int create);
+
+/**
+ * @brief	Allocate a shared memory buffer.
+ *
+ * The buffer is carved from the first region, in registration order,
+ * that has all the requested attributes and enough room left.
+ *
+ * @param[in]	size	Size of the buffer in bytes.
+ * @param[in]	attr	Required METAL_SHMEM_* attributes.
+ * @param[out]	io	I/O region of the buffer, if not NULL.
+ * @return	Buffer, aligned to METAL_SHMEM_ALIGN, or NULL on failure.
+ */
+extern void *metal_shmem_alloc(size_t size, unsigned int attr,
+			       struct metal_io_region **io);
+
+/**
+ * @brief	Create a fixed-size block pool in shared memory.
+ *
+ * @param[out]	pool		Pool handle.
+ * @param[in]	block_size	Size of a block in bytes.
+ * @param[in]	num_blocks	Number of blocks, up to METAL_SHMEM_POOL_MAX.
+ * @param[in]	attr		Required METAL_SHMEM_* attributes.
+ * @return	0 on success, or -errno on failure.
+ */
+extern int metal_shmem_pool_create(struct metal_shmem_pool *pool,
+				   size_t block_size, unsigned int num_blocks,
+				   unsigned int attr);
+
+/**
+ * @brief	Open a pool created by another core.
+ *
+ * @param[out]	pool	Pool handle.
+ * @param[in]	io	I/O region of the pool.
+ * @param[in]	offset	Offset of the pool, from metal_shmem_pool_offset().
+ * @return	0 on success, or -errno on failure.
+ */
+extern int metal_shmem_pool_open(struct metal_shmem_pool *pool,
+				 struct metal_io_region *io,
+				 unsigned long offset);
+
+/**
+ * @brief	Get the offset of a pool in its I/O region, to be passed to
+ *		the other cores.
+ *
+ * @param[in]	pool	Pool handle.
+ * @return	Offset of the pool.
+ */
+static inline unsigned long
+metal_shmem_pool_offset(struct metal_shmem_pool *pool)
+{
+	return metal_io_virt_to_offset(pool->io, pool->hdr);
+}
+
+/**
+ * @brief	Get a free block of a pool.
+ *
+ * @param[in]	pool	Pool handle.
+ * @return	Block, or NULL if the pool is empty.
+ */
+extern void *metal_shmem_pool_get(struct metal_shmem_pool *pool);
+
+/**
+ * @brief	Return a block to its pool. Any core sharing the pool can
+ *		return the block.
+ *
+ * @param[in]	pool	Pool handle.
+ * @param[in]	block	Block from metal_shmem_pool_get().
+ */
+extern void metal_shmem_pool_put(struct metal_shmem_pool *pool, void *block);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __METAL_SHMEM_ALLOC__H__ */
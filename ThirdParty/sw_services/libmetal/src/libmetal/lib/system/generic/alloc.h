@@ -17,19 +17,34 @@
 #define __METAL_GENERIC_ALLOC__H__
 
 #include <stdlib.h>
+#ifdef METAL_USE_XIL_POOL
+#include "xil_pool.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/*
+ * Build with METAL_USE_XIL_POOL defined to serve allocations from the
+ * standalone BSP block pools registered through Xil_PoolSetDefault.
+ */
 static inline void *metal_allocate_memory(unsigned int size)
 {
+#ifdef METAL_USE_XIL_POOL
+	return Xil_PoolMalloc(size);
+#else
 	return malloc(size);
+#endif
 }
 
 static inline void metal_free_memory(void *ptr)
 {
+#ifdef METAL_USE_XIL_POOL
+	Xil_PoolFreeAny(ptr);
+#else
 	free(ptr);
+#endif
 }
 
 #ifdef __cplusplus
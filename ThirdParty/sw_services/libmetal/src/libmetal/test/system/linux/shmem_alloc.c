@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026, Xilinx Inc. and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "metal-test.h"
+#include <metal/atomic.h>
+#include <metal/log.h>
+#include <metal/shmem_alloc.h>
+#include <metal/sys.h>
+
+static const int shmem_alloc_threads = 10;
+static const int shmem_alloc_count = 1000;
+static const unsigned int shmem_alloc_blocks = 8;
+
+static char apu_mem[16 * 1024] __attribute__((aligned(64)));
+static char rpu_mem[4 * 1024] __attribute__((aligned(64)));
+
+static struct metal_generic_shmem apu_shmem = {
+	.name = "shmem_alloc_apu",
+	.attr = METAL_SHMEM_NEAR_APU,
+};
+
+static struct metal_generic_shmem rpu_shmem = {
+	.name = "shmem_alloc_rpu",
+	.attr = METAL_SHMEM_NEAR_RPU,
+};
+
+static atomic_int nb_err = ATOMIC_VAR_INIT(0);
+static atomic_int in_use[8];
+
+static void *shmem_alloc_child(void *arg)
+{
+	struct metal_shmem_pool *pool = arg;
+	unsigned int index;
+	char *block;
+	int i;
+
+	for (i = 0; i < shmem_alloc_count; i++) {
+		block = metal_shmem_pool_get(pool);
+		if (!block)
+			continue;
+		index = (block - (char *)pool->base) / pool->stride;
+		if (atomic_fetch_add(&in_use[index], 1) != 0) {
+			metal_log(METAL_LOG_ERROR, "block %u given twice\n",
+				  index);
+			atomic_fetch_add(&nb_err, 1);
+		}
+		atomic_fetch_sub(&in_use[index], 1);
+		metal_shmem_pool_put(pool, block);
+	}
+
+	return NULL;
+}
+
+static int shmem_alloc(void)
+{
+	struct metal_shmem_pool pool, pool2;
+	struct metal_io_region *io;
+	void *blocks[8];
+	unsigned int i;
+	char *buf;
+	int error;
+
+	metal_io_init(&apu_shmem.io, apu_mem, NULL, sizeof(apu_mem),
+		      (unsigned int)-1, 0, NULL);
+	metal_io_init(&rpu_shmem.io, rpu_mem, NULL, sizeof(rpu_mem),
+		      (unsigned int)-1, 0, NULL);
+	metal_shmem_register_generic(&apu_shmem);
+	metal_shmem_register_generic(&rpu_shmem);
+
+	if (metal_shmem_heap_init(&rpu_shmem, 0) != -EAGAIN) {
+		metal_log(METAL_LOG_ERROR, "attached to no heap\n");
+		return -1;
+	}
+	error = metal_shmem_heap_init(&apu_shmem, 1);
+	if (!error)
+		error = metal_shmem_heap_init(&rpu_shmem, 1);
+	if (error) {
+		metal_log(METAL_LOG_ERROR, "heap init failed: %d\n", error);
+		return error;
+	}
+
+	/* Allocations go to the region with the requested attributes. */
+	buf = metal_shmem_alloc(100, METAL_SHMEM_NEAR_RPU, &io);
+	if (!buf || io != &rpu_shmem.io ||
+	    ((uintptr_t)buf % METAL_SHMEM_ALIGN) != 0) {
+		metal_log(METAL_LOG_ERROR, "bad RPU allocation\n");
+		return -1;
+	}
+	if (metal_shmem_alloc(sizeof(rpu_mem), METAL_SHMEM_NEAR_RPU, NULL)) {
+		metal_log(METAL_LOG_ERROR, "RPU region overcommitted\n");
+		return -1;
+	}
+	if (metal_shmem_alloc(100, METAL_SHMEM_CACHED, NULL)) {
+		metal_log(METAL_LOG_ERROR, "allocated from no region\n");
+		return -1;
+	}
+
+	error = metal_shmem_pool_create(&pool, 100, shmem_alloc_blocks,
+					METAL_SHMEM_NEAR_APU);
+	if (error) {
+		metal_log(METAL_LOG_ERROR, "pool create failed: %d\n", error);
+		return error;
+	}
+	error = metal_shmem_pool_open(&pool2, pool.io,
+				      metal_shmem_pool_offset(&pool));
+	if (error || pool2.base != pool.base) {
+		metal_log(METAL_LOG_ERROR, "pool open failed: %d\n", error);
+		return -1;
+	}
+
+	for (i = 0; i < shmem_alloc_blocks; i++) {
+		blocks[i] = metal_shmem_pool_get(&pool);
+		if (!blocks[i]) {
+			metal_log(METAL_LOG_ERROR, "pool empty at %u\n", i);
+			return -1;
+		}
+	}
+	if (metal_shmem_pool_get(&pool2)) {
+		metal_log(METAL_LOG_ERROR, "pool overcommitted\n");
+		return -1;
+	}
+	for (i = 0; i < shmem_alloc_blocks; i++)
+		metal_shmem_pool_put(&pool2, blocks[i]);
+
+	error = metal_run(shmem_alloc_threads, shmem_alloc_child, &pool);
+
+	return error ? error : atomic_load(&nb_err);
+}
+METAL_ADD_TEST(shmem_alloc);
@@ -268,6 +268,7 @@ proc get_emac_periphs {processor} {
 			|| $periphname == "axi_ethernet"
 			|| $periphname == "axi_ethernet_buffer"
 			|| $periphname == "axi_ethernetlite"
+			|| $periphname == "xxv_ethernet"
 			|| $periphname == "ps7_ethernet"
 			|| $periphname == "psu_ethernet"
 			|| $periphname == "psv_ethernet"} {
@@ -379,7 +380,7 @@ proc lwip_drc {libhandle} {
 
 		set cpuname [common::get_property NAME $processor]
 		error "ERROR: No Ethernet MAC cores are addressable from processor $cpuname. \
-			lwIP requires atleast one EMAC (xps_ethernetlite | xps_ll_temac | axi_ethernet | axi_ethernet_buffer | axi_ethernetlite | ps7_ethernet | psu_ethernet | psv_ethernet ) core \
+			lwIP requires atleast one EMAC (xps_ethernetlite | xps_ll_temac | axi_ethernet | axi_ethernet_buffer | axi_ethernetlite | xxv_ethernet | ps7_ethernet | psu_ethernet | psv_ethernet ) core \
 			with its interrupt pin connected to the interrupt controller.\n" "" "MDT_ERROR"
 		return
 	} else {
@@ -607,6 +608,18 @@ proc generate_lwip_opts {libhandle} {
 
 	# workaround for lwip mem_malloc bug
 	# puts $lwipopts_fd "\#define MEM_LIBC_MALLOC 1"
+	set mem_use_xil_pool	[common::get_property CONFIG.mem_use_xil_pool $libhandle]
+	if {$mem_use_xil_pool == true} {
+		puts $lwipopts_fd "\#include \"xil_pool.h\""
+		puts $lwipopts_fd "\#define MEM_LIBC_MALLOC 1"
+		puts $lwipopts_fd "\#define mem_clib_malloc Xil_PoolMalloc"
+		puts $lwipopts_fd "\#define mem_clib_free Xil_PoolFreeAny"
+		puts $lwipopts_fd "\#define mem_clib_calloc Xil_PoolCalloc"
+	}
+	set emacps_rx_pool_size	[common::get_property CONFIG.emacps_rx_pool_size $libhandle]
+	if {$emacps_rx_pool_size > 0} {
+		puts $lwipopts_fd "\#define LWIP_SUPPORT_CUSTOM_PBUF 1"
+	}
 	puts $lwipopts_fd ""
 
 	# seq api
@@ -1096,6 +1109,29 @@ proc update_axi_ethernet_topology {emac processor topologyvar} {
 	}
 }
 
+proc update_xxv_ethernet_topology {emac processor topologyvar} {
+	upvar $topologyvar topology
+	set sw_processor [hsi::get_sw_processor]
+	set proc_type [common::get_property IP_NAME [hsi::get_cells -hier $sw_processor]]
+	set topology(emac_baseaddr) [common::get_property CONFIG.C_BASEADDR $emac]
+	set topology(emac_type) "xemac_type_xxv_ethernet"
+
+	# the interrupts are those of the MCDMA channels, taken from the
+	# driver configuration, only the GIC is needed here
+	set topology(intc_baseaddr) "0x0"
+	set topology(emac_intr_id) "0x0"
+	set topology(scugic_emac_intr) "0x0"
+	if { $proc_type == "psu_cortexa53" } {
+		set topology(scugic_baseaddr) "0xF9020000"
+	} elseif { $proc_type == "psv_cortexa72" } {
+		set topology(scugic_baseaddr) "0xF9040000"
+	} elseif { $proc_type == "ps7_cortexa9" } {
+		set topology(scugic_baseaddr) "0xF8F00100"
+	} else {
+		set topology(scugic_baseaddr) "0xF9001000"
+	}
+}
+
 proc update_ps_ethernet_topology {emac processor topologyvar} {
 	upvar $topologyvar topology
 	set topology(emac_baseaddr) [common::get_property CONFIG.C_S_AXI_BASEADDR $emac]
@@ -1189,6 +1225,10 @@ proc generate_topology {libhandle} {
 			update_axi_ethernet_topology $emac $processor topology
 			generate_topology_per_emac $tfd topology
 			incr topology_size 1
+		} elseif {$iptype == "xxv_ethernet"} {
+			update_xxv_ethernet_topology $emac $processor topology
+			generate_topology_per_emac $tfd topology
+			incr topology_size 1
 		} elseif {$iptype == "ps7_ethernet"} {
 			update_ps_ethernet_topology $emac $processor topology
 			generate_topology_per_emac $tfd topology
@@ -1227,6 +1267,7 @@ proc generate_adapterconfig_makefile {libhandle} {
 	set have_axi_ethernet_fifo 0
 	set have_axi_ethernet_dma 0
 	set have_axi_ethernet_mcdma 0
+	set have_xxv_ethernet 0
 	set have_ps_ethernet 0
 	set force_axieth_on_zynq 0
 	set force_emaclite_on_zynq 0
@@ -1278,6 +1319,8 @@ proc generate_adapterconfig_makefile {libhandle} {
 			} else {
 				set have_axi_ethernet_dma 1
 			}
+		} elseif {$iptype == "xxv_ethernet"} {
+			set have_xxv_ethernet 1
 		} elseif {$iptype == "ps7_ethernet" || $iptype == "psu_ethernet" || $iptype == "psv_ethernet" } {
 			set have_ps_ethernet 1
 		}
@@ -1365,6 +1408,9 @@ proc generate_adapterconfig_makefile {libhandle} {
 		if {$have_axi_ethernet_fifo == 1} {
 			puts $fd "CONFIG_AXI_ETHERNET_FIFO=y"
 		}
+		if {$have_xxv_ethernet == 1} {
+			puts $fd "CONFIG_XXV_ETHERNET=y"
+		}
 	} elseif {$have_ps_ethernet == 1} {
 		puts $fd "CONFIG_PS_ETHERNET=y"
 	}
@@ -1392,6 +1438,7 @@ proc generate_adapterconfig_include {libhandle} {
 	set have_axi_ethernet_dma 0
 	set have_1588_enabled 0
 	set have_axi_ethernet_mcdma 0
+	set have_xxv_ethernet 0
 	set have_ps_ethernet 0
 	set force_axieth_on_zynq 0
 	set force_emaclite_on_zynq 0
@@ -1448,6 +1495,8 @@ proc generate_adapterconfig_include {libhandle} {
 			set have_1588_enabled [is_property_set $enable_1588]
 
 			set have_axi_ethernet 1
+		} elseif {$iptype == "xxv_ethernet"} {
+			set have_xxv_ethernet 1
 		} elseif {$iptype == "ps7_ethernet" || $iptype == "psu_ethernet" || $iptype == "psv_ethernet"} {
 			set have_ps_ethernet 1
 		}
@@ -1488,6 +1537,10 @@ proc generate_adapterconfig_include {libhandle} {
 		}
 		if {$have_axi_ethernet_dma == 1} {
 			puts $fd "\#define XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_DMA 1"
+			set busy_poll [common::get_property CONFIG.axi_dma_busy_poll $libhandle]
+			if {[is_property_set $busy_poll]} {
+				puts $fd "\#define XLWIP_CONFIG_AXI_ETHERNET_DMA_POLL 1"
+			}
 		}
 		if {$have_axi_ethernet_fifo == 1} {
 			puts $fd "\#define XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_FIFO 1"
@@ -1498,11 +1551,14 @@ proc generate_adapterconfig_include {libhandle} {
 		if {$have_axi_ethernet_mcdma == 1} {
 			puts $fd "\#define XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_MCDMA 1"
 		}
+		if {$have_xxv_ethernet == 1} {
+			puts $fd "\#define XLWIP_CONFIG_INCLUDE_XXV_ETHERNET 1"
+		}
 	} elseif {$have_ps_ethernet == 1} {
 			puts $fd "\#define XLWIP_CONFIG_INCLUDE_GEM 1"
 	}
 
-	if {$have_axi_ethernet == 1} {
+	if {$have_axi_ethernet == 1 || $have_xxv_ethernet == 1} {
 		set ndesc [common::get_property CONFIG.n_tx_descriptors $libhandle]
 		puts $fd "\#define XLWIP_CONFIG_N_TX_DESC $ndesc"
 		set ndesc [common::get_property CONFIG.n_rx_descriptors $libhandle]
@@ -1522,9 +1578,25 @@ proc generate_adapterconfig_include {libhandle} {
 		puts $fd "\#define XLWIP_CONFIG_N_TX_DESC $ndesc"
 		set ndesc [common::get_property CONFIG.n_rx_descriptors $libhandle]
 		puts $fd "\#define XLWIP_CONFIG_N_RX_DESC $ndesc"
+		set budget [common::get_property CONFIG.emacps_rx_poll_budget $libhandle]
+		puts $fd "\#define XLWIP_CONFIG_EMACPS_RX_POLL_BUDGET $budget"
+		set npool [common::get_property CONFIG.emacps_rx_pool_size $libhandle]
+		puts $fd "\#define XLWIP_CONFIG_EMACPS_RX_POOL_SIZE $npool"
+		set rxq1 [common::get_property CONFIG.emacps_rx_priority_queue $libhandle]
+		puts $fd "\#define XLWIP_CONFIG_EMACPS_RX_Q1 [is_property_set $rxq1]"
+		set udps [common::get_property CONFIG.emacps_udp_stream $libhandle]
+		puts $fd "\#define XLWIP_CONFIG_EMACPS_UDP_STREAM [is_property_set $udps]"
 		puts $fd ""
 	}
 
+	set hwts [common::get_property CONFIG.hw_timestamp $libhandle]
+	puts $fd "\#define XLWIP_CONFIG_HW_TIMESTAMP [is_property_set $hwts]"
+	set nstats [common::get_property CONFIG.netif_stats $libhandle]
+	puts $fd "\#define XLWIP_CONFIG_NETIF_STATS [is_property_set $nstats]"
+	set watermark [common::get_property CONFIG.tx_reclaim_watermark $libhandle]
+	puts $fd "\#define XLWIP_CONFIG_TX_RECLAIM_WATERMARK $watermark"
+	puts $fd ""
+
 	puts $fd "\#endif"
 
 	close $fd
@@ -45,6 +45,21 @@ extern "C" {
 #include "lwip/ip.h"
 
 #include "netif/xtopology.h"
+#include "netif/xpqueue.h"
+#include "netif/xnetif_stats.h"
+
+/*
+ * With a non zero watermark the TX done interrupts are off, the TX path
+ * frees the sent BDs once fewer than the watermark are free, and the
+ * application calls xemacif_tx_reclaim() from a periodic timer.
+ */
+#ifndef XLWIP_CONFIG_TX_RECLAIM_WATERMARK
+#define XLWIP_CONFIG_TX_RECLAIM_WATERMARK 0
+#endif
+
+#if XLWIP_CONFIG_TX_RECLAIM_WATERMARK && LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
+#error "LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE requires TX done interrupts"
+#endif
 
 struct xemac_s {
 	enum xemac_types type;
@@ -68,6 +83,9 @@ enum ethernet_link_status {
 void eth_link_detect(struct netif *netif);
 void 		lwip_raw_init();
 int 		xemacif_input(struct netif *netif);
+int		xemacif_rxq_stats(struct netif *netif, pq_stats_t *stats);
+int		xemacif_netif_stats(struct netif *netif, xnetif_stats_t *stats);
+int		xemacif_tx_reclaim(struct netif *netif);
 void 		xemacif_input_thread(struct netif *netif);
 struct netif *	xemac_add(struct netif *netif,
 	ip_addr_t *ipaddr, ip_addr_t *netmask, ip_addr_t *gw,
@@ -54,8 +54,20 @@ extern "C" {
 #endif
 
 #include "netif/xpqueue.h"
+#include "netif/xnetif_stats.h"
 #include "xlwipconfig.h"
 
+/* busy poll the DMA rings from xaxiemacif_input, with the DMA interrupts off */
+#ifndef XLWIP_CONFIG_AXI_ETHERNET_DMA_POLL
+#define XLWIP_CONFIG_AXI_ETHERNET_DMA_POLL 0
+#endif
+
+#if XLWIP_CONFIG_AXI_ETHERNET_DMA_POLL && \
+	(defined(XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_FIFO) || \
+	 defined(XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_MCDMA))
+#error "XLWIP_CONFIG_AXI_ETHERNET_DMA_POLL requires the AXI DMA"
+#endif
+
 #if XLWIP_CONFIG_INCLUDE_AXIETH_ON_ZYNQ == 1
 #define AXIDMA_TX_INTR_PRIORITY_SET_IN_GIC      0xA0
 #define AXIDMA_RX_INTR_PRIORITY_SET_IN_GIC      0xA0
@@ -69,6 +81,13 @@ void 	xaxiemacif_setmac(u32_t index, u8_t *addr);
 u8_t*	xaxiemacif_getmac(u32_t index);
 err_t 	xaxiemacif_init(struct netif *netif);
 int 	xaxiemacif_input(struct netif *netif);
+void	xaxiemacif_rxq_stats(struct netif *netif, pq_stats_t *stats);
+#if XLWIP_CONFIG_NETIF_STATS
+void	xaxiemacif_netif_stats(struct netif *netif, xnetif_stats_t *stats);
+#endif
+#if XLWIP_CONFIG_TX_RECLAIM_WATERMARK
+void	xaxiemacif_tx_reclaim(struct netif *netif);
+#endif
 
 unsigned get_IEEE_phy_speed(XAxiEthernet *xaxiemacp);
 void enable_sgmii_clock(XAxiEthernet *xaxiemacp);
@@ -98,6 +117,11 @@ typedef struct {
 	/* pointers to memory holding buffer descriptors (used only with SDMA) */
 	void *rx_bdspace;
 	void *tx_bdspace;
+
+#if XLWIP_CONFIG_NETIF_STATS
+	/* the RX interrupt and ring statistics are kept with AXI DMA only */
+	xnetif_stats_t stats;
+#endif
 } xaxiemacif_s;
 
 extern xaxiemacif_s xaxiemacif;
@@ -124,6 +148,9 @@ XStatus axidma_sgsend(xaxiemacif_s *xaxiemacif, struct pbuf *p,
 #else
 XStatus axidma_sgsend(xaxiemacif_s *xaxiemacif, struct pbuf *p);
 #endif
+#if XLWIP_CONFIG_AXI_ETHERNET_DMA_POLL
+s32_t axidma_poll(struct xemac_s *xemac);
+#endif
 #endif
 #endif
 
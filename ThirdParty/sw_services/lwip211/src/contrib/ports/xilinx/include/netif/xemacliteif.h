@@ -57,6 +57,7 @@ void 	xemacliteif_setmac(u32_t index, u8_t *addr);
 u8_t*	xemacliteif_getmac(u32_t index);
 err_t 	xemacliteif_init(struct netif *netif);
 int 	xemacliteif_input(struct netif *netif);
+void	xemacliteif_rxq_stats(struct netif *netif, pq_stats_t *stats);
 
 #ifdef __cplusplus
 }
@@ -56,6 +56,7 @@ extern "C" {
 #include "xemacps.h"		/* defines XEmacPs API */
 
 #include "netif/xpqueue.h"
+#include "netif/xnetif_stats.h"
 #include "xlwipconfig.h"
 
 #if defined (__aarch64__) && (EL1_NONSECURE == 1)
@@ -100,10 +101,86 @@ extern "C" {
 
 #define MAX_FRAME_SIZE_JUMBO (XEMACPS_MTU_JUMBO + XEMACPS_HDR_SIZE + XEMACPS_TRL_SIZE)
 
+/* Max RX BDs reaped per xemacpsif_input call, 0 reaps the RX ring in the ISR */
+#ifndef XLWIP_CONFIG_EMACPS_RX_POLL_BUDGET
+#define XLWIP_CONFIG_EMACPS_RX_POLL_BUDGET 0
+#endif
+
+/* RX buffers per interface in the netif owned pool, 0 uses PBUF_POOL */
+#ifndef XLWIP_CONFIG_EMACPS_RX_POOL_SIZE
+#define XLWIP_CONFIG_EMACPS_RX_POOL_SIZE 0
+#endif
+#if XLWIP_CONFIG_EMACPS_RX_POOL_SIZE && !LWIP_SUPPORT_CUSTOM_PBUF
+#error "The EMACPS RX buffer pool requires LWIP_SUPPORT_CUSTOM_PBUF"
+#endif
+
+/* Receive screener steered frames on priority queue 1, reaped before queue 0 */
+#ifndef XLWIP_CONFIG_EMACPS_RX_Q1
+#define XLWIP_CONFIG_EMACPS_RX_Q1 0
+#endif
+
+/* Zero copy UDP streams, see xemacpsif_udpstream.c */
+#ifndef XLWIP_CONFIG_EMACPS_UDP_STREAM
+#define XLWIP_CONFIG_EMACPS_UDP_STREAM 0
+#endif
+#if XLWIP_CONFIG_EMACPS_UDP_STREAM && !LWIP_SUPPORT_CUSTOM_PBUF
+#error "The EMACPS UDP streams require LWIP_SUPPORT_CUSTOM_PBUF"
+#endif
+
+#if XLWIP_CONFIG_EMACPS_UDP_STREAM
+/* Streams open at a time, over all interfaces */
+#define XEMACPSIF_UDPS_MAX_STREAMS	2
+/* Received datagrams a stream holds for the application, a power of two */
+#define XEMACPSIF_UDPS_RX_SLOTS		512
+/* Bytes of the Ethernet, IPv4 and UDP headers in front of a payload */
+#define XEMACPSIF_UDPS_HDR_SIZE		42
+/* Largest payload of a TX slot */
+#define XEMACPSIF_UDPS_MAX_PAYLOAD	(XEMACPS_MTU - 28)
+
+/*
+ * A datagram payload in a DMA buffer. Data and len are the payload, p owns
+ * the buffer until the slot is sent or released.
+ */
+typedef struct {
+	struct pbuf *p;
+	u8_t *data;
+	u16_t len;
+} xemacpsif_udps_slot_t;
+
+typedef struct xemacpsif_udps xemacpsif_udps_t;
+
+xemacpsif_udps_t *xemacpsif_udps_open(struct netif *netif, u16_t local_port,
+				      const ip4_addr_t *remote_ip,
+				      u16_t remote_port);
+s32_t	xemacpsif_udps_close(xemacpsif_udps_t *s);
+int	xemacpsif_udps_recv(xemacpsif_udps_t *s, xemacpsif_udps_slot_t *slots,
+			    int n);
+void	xemacpsif_udps_release(xemacpsif_udps_slot_t *slots, int n);
+int	xemacpsif_udps_tx_alloc(xemacpsif_udps_t *s,
+				xemacpsif_udps_slot_t *slots, int n);
+int	xemacpsif_udps_send(xemacpsif_udps_t *s, xemacpsif_udps_slot_t *slots,
+			    int n);
+u32_t	xemacpsif_udps_rx_drops(xemacpsif_udps_t *s);
+int	xemacpsif_udps_input(struct netif *netif, struct pbuf *p);
+#endif
+
 void 	xemacpsif_setmac(u32_t index, u8_t *addr);
 u8_t*	xemacpsif_getmac(u32_t index);
 err_t 	xemacpsif_init(struct netif *netif);
 s32_t 	xemacpsif_input(struct netif *netif);
+void	xemacpsif_rxq_stats(struct netif *netif, pq_stats_t *stats);
+#if XLWIP_CONFIG_NETIF_STATS
+void	xemacpsif_netif_stats(struct netif *netif, xnetif_stats_t *stats);
+#endif
+#if XLWIP_CONFIG_TX_RECLAIM_WATERMARK
+void	xemacpsif_tx_reclaim(struct netif *netif);
+#endif
+#if XLWIP_CONFIG_EMACPS_RX_Q1
+s32_t	xemacpsif_rx_steer_udp_port(struct netif *netif, u32_t index,
+				    u16_t port);
+s32_t	xemacpsif_rx_steer_ethertype(struct netif *netif, u32_t index,
+				     u16_t ethtype);
+#endif
 
 /* xaxiemacif_hw.c */
 void 	xemacps_error_handler(XEmacPs * Temac);
@@ -124,6 +201,20 @@ typedef struct {
 
 	unsigned int last_rx_frms_cntr;
 
+	/* set by the ISR when the RX interrupt is masked for polling */
+	volatile u32_t rx_poll_pending;
+
+#if XLWIP_CONFIG_EMACPS_RX_Q1
+	/* RX priority queue 1, active on GEM with priority queues only */
+	XEmacPs_BdRing rxq1_ring;
+	void *rxq1_bdspace;
+	u32_t rxq1_active;
+#endif
+
+#if XLWIP_CONFIG_NETIF_STATS
+	xnetif_stats_t stats;
+#endif
+
 } xemacpsif_s;
 
 extern xemacpsif_s xemacpsif;
@@ -139,10 +230,18 @@ void emacps_send_handler(void *arg);
 #if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
 XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p,
 		u32_t block_till_tx_complete, u32_t *to_block_index);
+XStatus emacps_sgqueue(xemacpsif_s *xemacpsif, struct pbuf *p,
+		u32_t block_till_tx_complete, u32_t *to_block_index);
 #else
 XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p);
+XStatus emacps_sgqueue(xemacpsif_s *xemacpsif, struct pbuf *p);
 #endif
+void emacps_tx_start(xemacpsif_s *xemacpsif);
 void emacps_recv_handler(void *arg);
+#if XLWIP_CONFIG_EMACPS_RX_Q1
+void emacps_recv_q1_handler(void *arg);
+#endif
+s32_t emacps_rx_poll(struct xemac_s *xemac, u32_t budget);
 void emacps_error_handler(void *arg,u8 Direction, u32 ErrorWord);
 void setup_rx_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring);
 void HandleTxErrors(struct xemac_s *xemac);
@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2026 Xilinx, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ * SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+ * OF SUCH DAMAGE.
+ *
+ * This file is part of the lwIP TCP/IP stack.
+ *
+ */
+
+#ifndef __NETIF_XNETIF_STATS_H__
+#define __NETIF_XNETIF_STATS_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "lwip/arch.h"
+#include "xlwipconfig.h"
+
+/* Carry the hardware RX/TX timestamps of frames in pbufs */
+#ifndef XLWIP_CONFIG_HW_TIMESTAMP
+#define XLWIP_CONFIG_HW_TIMESTAMP 0
+#endif
+
+/* Keep latency, ring occupancy and drop statistics per netif */
+#ifndef XLWIP_CONFIG_NETIF_STATS
+#define XLWIP_CONFIG_NETIF_STATS 0
+#endif
+
+/*
+ * Buckets of a histogram: bucket 0 counts the value 0, bucket i the values
+ * from 2^(i-1) to 2^i - 1, the last bucket all larger values.
+ */
+#define XNETIF_HIST_BUCKETS	16
+
+typedef struct {
+	u32_t bucket[XNETIF_HIST_BUCKETS];
+	u32_t max;
+} xnetif_hist_t;
+
+/* Reasons for which a received frame was lost */
+enum xnetif_rx_drop {
+	XNETIF_RX_DROP_RING = 0,	/* MAC found no free RX BD, or overran */
+	XNETIF_RX_DROP_NO_PBUF,		/* no pbuf to refill an RX BD */
+	XNETIF_RX_DROP_QUEUE_FULL,	/* receive queue full, input path too late */
+	XNETIF_RX_DROP_ETHTYPE,		/* frame type not handled by the stack */
+	XNETIF_RX_DROP_STACK,		/* refused by netif->input */
+	XNETIF_RX_DROP_REASONS
+};
+
+/*
+ * Statistics of a netif, see xemacif_netif_stats(). The counters only
+ * ever grow, take the difference of two snapshots for a time window.
+ */
+typedef struct {
+	/* microseconds from the RX interrupt to the input path taking frames */
+	xnetif_hist_t rx_latency_us;
+	/* RX BDs completed per reap of the RX ring */
+	xnetif_hist_t rx_ring_used;
+	/* TX BDs in flight when a frame is queued, including its own */
+	xnetif_hist_t tx_ring_used;
+	u32_t rx_drops[XNETIF_RX_DROP_REASONS];
+	/* time of the first RX interrupt not yet seen by the input path */
+	u64_t rx_pending_since;
+} xnetif_stats_t;
+
+#if XLWIP_CONFIG_NETIF_STATS
+#define XNETIF_STATS_RX_DROP(stats, reason)	((stats)->rx_drops[(reason)]++)
+#define XNETIF_STATS_HIST(hist, value)		xnetif_hist_add((hist), (value))
+#define XNETIF_STATS_RX_IRQ(stats)		xnetif_stats_rx_irq(stats)
+#define XNETIF_STATS_RX_INPUT(stats)		xnetif_stats_rx_input(stats)
+#else
+#define XNETIF_STATS_RX_DROP(stats, reason)
+#define XNETIF_STATS_HIST(hist, value)
+#define XNETIF_STATS_RX_IRQ(stats)
+#define XNETIF_STATS_RX_INPUT(stats)
+#endif
+
+void	xnetif_hist_add(xnetif_hist_t *hist, u32_t value);
+void	xnetif_stats_rx_irq(xnetif_stats_t *stats);
+void	xnetif_stats_rx_input(xnetif_stats_t *stats);
+void	xnetif_stats_copy(xnetif_stats_t *stats, const xnetif_stats_t *src);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -36,18 +36,40 @@ extern "C" {
 #endif
 
 #include "debug.h"
+#include "xil_ring.h"
 
+/* Must be a power of two */
 #define PQ_QUEUE_SIZE 4096
 
+/* Number of pbufs the input path takes off a queue at once */
+#define PQ_BULK_SIZE 32
+
+/*
+ * Single producer single consumer queue of pbuf pointers. The netif ISR and
+ * the lwIP input path can use it without masking interrupts, as long as each
+ * of enqueue and dequeue is done from a single context.
+ */
 typedef struct {
+	Xil_Ring ring;
+	/* written by the producer only */
+	u32 high_water;
+	u32 drops;
 	void *data[PQ_QUEUE_SIZE];
-	int head, tail, len;
 } pq_queue_t;
 
+/* Depth statistics of a queue, see pq_get_stats() */
+typedef struct {
+	u32 length;		/* pbufs in the queue */
+	u32 high_water;		/* most pbufs ever in the queue */
+	u32 drops;		/* pbufs refused because the queue was full */
+} pq_stats_t;
+
 pq_queue_t*	pq_create_queue();
 int 		pq_enqueue(pq_queue_t *q, void *p);
 void*		pq_dequeue(pq_queue_t *q);
+int		pq_dequeue_bulk(pq_queue_t *q, void **p, int n);
 int		pq_qlength(pq_queue_t *q);
+void		pq_get_stats(pq_queue_t *q, pq_stats_t *stats);
 
 #ifdef __cplusplus
 }
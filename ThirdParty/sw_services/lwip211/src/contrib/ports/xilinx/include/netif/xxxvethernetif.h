@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2026 Xilinx, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ * SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+ * OF SUCH DAMAGE.
+ *
+ * This file is part of the lwIP TCP/IP stack.
+ *
+ */
+
+#ifndef __NETIF_XXXVETHERNETIF_H__
+#define __NETIF_XXXVETHERNETIF_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xlwipconfig.h"
+#include "lwip/netif.h"
+#include "netif/etharp.h"
+#include "netif/xadapter.h"
+
+#include "xparameters.h"
+#include "xstatus.h"
+
+#include "xxxvethernet.h"
+#include "xmcdma.h"
+
+#include "netif/xpqueue.h"
+
+#define XXVMCDMA_TX_INTR_PRIORITY_SET_IN_GIC	0xA0
+#define XXVMCDMA_RX_INTR_PRIORITY_SET_IN_GIC	0xA0
+#define XXV_TRIG_TYPE_RISING_EDGE_SENSITIVE	0x3
+
+err_t	xxxvethernetif_init(struct netif *netif);
+int	xxxvethernetif_input(struct netif *netif);
+void	xxxvethernetif_rxq_stats(struct netif *netif, pq_stats_t *stats);
+
+/* structure within each netif, encapsulating all information required for
+ * using a particular xxv ethernet instance
+ */
+typedef struct {
+	XMcdma       aximcdma;
+	XXxvEthernet xxv_ethernet;
+
+	/* queue to store overflow packets */
+	pq_queue_t *recv_q;
+	pq_queue_t *send_q;
+
+	/* pointers to memory holding buffer descriptors of all channels */
+	void *rx_bdspace;
+	void *tx_bdspace;
+} xxxvethernetif_s;
+
+/* xxxvethernetif_mcdma.c */
+XStatus init_xxv_mcdma(struct xemac_s *xemac);
+XStatus xxv_mcdma_sgsend(xxxvethernetif_s *xxxvethernetif, struct pbuf *p);
+s32_t xxv_is_tx_space_available(xxxvethernetif_s *xxxvethernetif);
+s32_t xxv_process_sent_bds(XMcdma_ChanCtrl *Tx_Chan);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __NETIF_XXXVETHERNETIF_H__ */
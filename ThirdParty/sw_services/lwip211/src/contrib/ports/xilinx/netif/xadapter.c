@@ -58,6 +58,10 @@
 #include "netif/xemacpsif.h"
 #endif
 
+#ifdef XLWIP_CONFIG_INCLUDE_XXV_ETHERNET
+#include "netif/xxxvethernetif.h"
+#endif
+
 #if !NO_SYS
 #include "lwip/tcpip.h"
 
@@ -146,6 +150,7 @@ xemac_add(struct netif *netif,
 					tcpip_input
 #endif
 					);
+				break;
 #else
 				nif = NULL;
 #endif
@@ -160,6 +165,7 @@ xemac_add(struct netif *netif,
 					tcpip_input
 #endif
 					);
+				break;
 #else
 				nif = NULL;
 #endif
@@ -176,6 +182,24 @@ xemac_add(struct netif *netif,
 #endif
 
 						);
+				break;
+#endif
+#endif
+#if defined (__arm__) || defined (__aarch64__)
+			case xemac_type_xxv_ethernet:
+#ifdef XLWIP_CONFIG_INCLUDE_XXV_ETHERNET
+				nif = netif_add(netif, ipaddr, netmask, gw,
+					(void*)(UINTPTR)mac_baseaddr,
+					xxxvethernetif_init,
+#if NO_SYS
+					ethernet_input
+#else
+					tcpip_input
+#endif
+					);
+				break;
+#else
+				nif = NULL;
 #endif
 #endif
 			default:
@@ -196,7 +220,7 @@ xemac_add(struct netif *netif,
 /*
  * The input thread calls lwIP to process any received packets.
  * This thread waits until a packet is received (sem_rx_data_available),
- * and then calls xemacif_input which processes 1 packet at a time.
+ * and then calls xemacif_input which drains the receive queue in batches.
  */
 void
 xemacif_input_thread(struct netif *netif)
@@ -251,6 +275,17 @@ xemacif_input(struct netif *netif)
 			while(1);
 			return 0;
 #endif
+#endif
+#if defined (__arm__) || defined (__aarch64__)
+		case xemac_type_xxv_ethernet:
+#ifdef XLWIP_CONFIG_INCLUDE_XXV_ETHERNET
+			n_packets = xxxvethernetif_input(netif);
+			break;
+#else
+			xil_printf("incorrect configuration: xxv_ethernet drivers not present?\r\n");
+			while(1);
+			return 0;
+#endif
 #endif
 		default:
 			xil_printf("incorrect configuration: unknown temac type");
@@ -261,6 +296,118 @@ xemacif_input(struct netif *netif)
 	return n_packets;
 }
 
+/*
+ * Returns the depth statistics of the receive queue between the interrupt
+ * handler and the input path of the netif, to size PQ_QUEUE_SIZE and spot
+ * an input thread that does not keep up.
+ * Returns 0 on success, -1 if the netif type has no receive queue.
+ */
+int
+xemacif_rxq_stats(struct netif *netif, pq_stats_t *stats)
+{
+	struct xemac_s *emac = (struct xemac_s *)netif->state;
+
+	switch (emac->type) {
+#ifdef XLWIP_CONFIG_INCLUDE_EMACLITE
+		case xemac_type_xps_emaclite:
+			xemacliteif_rxq_stats(netif, stats);
+			return 0;
+#endif
+#ifdef XLWIP_CONFIG_INCLUDE_AXI_ETHERNET
+		case xemac_type_axi_ethernet:
+			xaxiemacif_rxq_stats(netif, stats);
+			return 0;
+#endif
+#if defined (__arm__) || defined (__aarch64__)
+#ifdef XLWIP_CONFIG_INCLUDE_GEM
+		case xemac_type_emacps:
+			xemacpsif_rxq_stats(netif, stats);
+			return 0;
+#endif
+#endif
+#if defined (__arm__) || defined (__aarch64__)
+#ifdef XLWIP_CONFIG_INCLUDE_XXV_ETHERNET
+		case xemac_type_xxv_ethernet:
+			xxxvethernetif_rxq_stats(netif, stats);
+			return 0;
+#endif
+#endif
+		default:
+			return -1;
+	}
+}
+
+/*
+ * Returns a snapshot of the statistics kept by the netif when
+ * XLWIP_CONFIG_NETIF_STATS is set: the delay from the RX interrupt to the
+ * input path, the RX and TX ring occupancy, and why received frames were
+ * lost, to tell ring exhaustion, pbuf exhaustion and a late input thread
+ * apart.
+ * Returns 0 on success, -1 if the netif keeps no statistics.
+ */
+int
+xemacif_netif_stats(struct netif *netif, xnetif_stats_t *stats)
+{
+#if XLWIP_CONFIG_NETIF_STATS
+	struct xemac_s *emac = (struct xemac_s *)netif->state;
+
+	switch (emac->type) {
+#ifdef XLWIP_CONFIG_INCLUDE_AXI_ETHERNET
+		case xemac_type_axi_ethernet:
+			xaxiemacif_netif_stats(netif, stats);
+			return 0;
+#endif
+#if defined (__arm__) || defined (__aarch64__)
+#ifdef XLWIP_CONFIG_INCLUDE_GEM
+		case xemac_type_emacps:
+			xemacpsif_netif_stats(netif, stats);
+			return 0;
+#endif
+#endif
+		default:
+			return -1;
+	}
+#else
+	(void)netif;
+	(void)stats;
+	return -1;
+#endif
+}
+
+/*
+ * Frees the sent TX BDs and their pbufs when XLWIP_CONFIG_TX_RECLAIM_WATERMARK
+ * is set, call it periodically so that the pbufs of the last frames sent do
+ * not wait for the next transmission.
+ * Returns 0 on success, -1 if the netif reclaims on TX done interrupts.
+ */
+int
+xemacif_tx_reclaim(struct netif *netif)
+{
+#if XLWIP_CONFIG_TX_RECLAIM_WATERMARK
+	struct xemac_s *emac = (struct xemac_s *)netif->state;
+
+	switch (emac->type) {
+#ifdef XLWIP_CONFIG_INCLUDE_AXI_ETHERNET
+		case xemac_type_axi_ethernet:
+			xaxiemacif_tx_reclaim(netif);
+			return 0;
+#endif
+#if defined (__arm__) || defined (__aarch64__)
+#ifdef XLWIP_CONFIG_INCLUDE_GEM
+		case xemac_type_emacps:
+			xemacpsif_tx_reclaim(netif);
+			return 0;
+#endif
+#endif
+		default:
+			return -1;
+	}
+#else
+	(void)netif;
+	return -1;
+#endif
+}
+
 #if defined(XLWIP_CONFIG_INCLUDE_GEM)
 static u32_t phy_link_detect(XEmacPs *xemacp, u32_t phy_addr)
 {
@@ -355,6 +502,18 @@ static u32_t phy_autoneg_status(XEmacLite *xemacp, u32_t phy_addr)
 }
 #endif
 
+#if !defined(XLWIP_CONFIG_INCLUDE_GEM) && \
+	!defined(XLWIP_CONFIG_INCLUDE_AXI_ETHERNET) && \
+	!defined(XLWIP_CONFIG_INCLUDE_EMACLITE)
+/*
+ * The XXV Ethernet has no PHY to poll, its link is brought up with the
+ * receiver block lock when the netif is initialized.
+ */
+void eth_link_detect(struct netif *netif)
+{
+	(void)netif;
+}
+#else
 void eth_link_detect(struct netif *netif)
 {
 	u32_t link_speed, phy_link_status;
@@ -410,6 +569,7 @@ void eth_link_detect(struct netif *netif)
 			break;
 	}
 }
+#endif
 
 #if !NO_SYS
 void link_detect_thread(void *p)
@@ -145,6 +145,33 @@ static err_t _unbuffered_low_level_output(xaxiemacif_s *xaxiemacif,
 
 }
 
+#if XLWIP_CONFIG_TX_RECLAIM_WATERMARK
+/*
+ * tx_reclaim():
+ *
+ * Frees the sent TX BDs of all TX rings and their pbufs. The caller
+ * serializes it with the TX path.
+ *
+ */
+static void tx_reclaim(xaxiemacif_s *xaxiemacif)
+{
+#ifdef XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_DMA
+	(void)process_sent_bds(XAxiDma_GetTxRing(&xaxiemacif->axidma));
+#elif defined(XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_MCDMA)
+	u8_t ChanId;
+
+	for (ChanId = 1;
+	     ChanId <= xaxiemacif->axi_ethernet.Config.AxiMcDmaChan_Cnt;
+	     ChanId++) {
+		(void)process_sent_bds(XMcdma_GetMcdmaTxChan(&xaxiemacif->aximcdma,
+							     ChanId));
+	}
+#else
+	(void)xaxiemacif;
+#endif
+}
+#endif
+
 /*
  * low_level_output():
  *
@@ -180,6 +207,12 @@ static err_t low_level_output(struct netif *netif, struct pbuf *p)
 
         SYS_ARCH_PROTECT(lev);
 
+#if XLWIP_CONFIG_TX_RECLAIM_WATERMARK && defined(XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_DMA)
+	if (is_tx_space_available(xaxiemacif) < XLWIP_CONFIG_TX_RECLAIM_WATERMARK) {
+		process_sent_bds(txring);
+	}
+#endif
+
         while (count) {
 
 		/* check if space is available to send */
@@ -202,6 +235,8 @@ static err_t low_level_output(struct netif *netif, struct pbuf *p)
 #endif
 #ifdef XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_DMA
 			process_sent_bds(txring);
+#elif XLWIP_CONFIG_TX_RECLAIM_WATERMARK
+			tx_reclaim(xaxiemacif);
 #endif
 			count--;
     }
@@ -239,20 +274,22 @@ return_pack_dropped:
  * Should allocate a pbuf and transfer the bytes of the incoming
  * packet from the interface into the pbuf.
  *
+ * Takes up to n received packets off the receive queue. The ISR is the
+ * only producer of the queue, so no interrupt masking is needed.
+ *
  */
-static struct pbuf *low_level_input(struct netif *netif)
+static int low_level_input(struct netif *netif, struct pbuf **p, int n)
 {
 	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
 	xaxiemacif_s *xaxiemacif = (xaxiemacif_s *)(xemac->state);
-	struct pbuf *p;
+	int taken;
 
-	/* see if there is data to process */
-	if (pq_qlength(xaxiemacif->recv_q) == 0)
-		return NULL;
+	taken = pq_dequeue_bulk(xaxiemacif->recv_q, (void **)p, n);
+	if (taken > 0) {
+		XNETIF_STATS_RX_INPUT(&xaxiemacif->stats);
+	}
 
-	/* return one packet from receive q */
-	p = (struct pbuf *)pq_dequeue(xaxiemacif->recv_q);
-	return p;
+	return taken;
 }
 
 /*
@@ -271,6 +308,63 @@ static err_t xaxiemacif_output(struct netif *netif, struct pbuf *p,
 	return etharp_output(netif, p, ipaddr);
 }
 
+/*
+ * xaxiemacif_input_frame():
+ *
+ * Passes one received packet to lwIP, or drops it if it is of a type
+ * the stack does not handle.
+ *
+ */
+static void xaxiemacif_input_frame(struct netif *netif, struct pbuf *p)
+{
+	struct eth_hdr *ethhdr;
+#if XLWIP_CONFIG_NETIF_STATS
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xaxiemacif_s *xaxiemacif = (xaxiemacif_s *)(xemac->state);
+#endif
+
+	/* points to packet payload, which starts with an Ethernet header */
+	ethhdr = p->payload;
+
+#if XLWIP_CONFIG_HW_TIMESTAMP && XLWIP_CONFIG_AXI_ETHERNET_ENABLE_1588
+	/* the MAC puts the RX timestamp in front of the frame, nanoseconds first */
+	memcpy(&p->ts_nsec, &ethhdr->padding[0], sizeof p->ts_nsec);
+	memcpy(&p->ts_sec, &ethhdr->padding[4], sizeof p->ts_sec);
+#endif
+
+#if LINK_STATS
+	lwip_stats.link.recv++;
+#endif /* LINK_STATS */
+
+	switch (htons(ethhdr->type)) {
+		/* IP or ARP packet? */
+		case ETHTYPE_IP:
+		case ETHTYPE_ARP:
+#if LWIP_IPV6
+		/*IPv6 Packet?*/
+		case ETHTYPE_IPV6:
+#endif
+#if PPPOE_SUPPORT
+			/* PPPoE packet? */
+		case ETHTYPE_PPPOEDISC:
+		case ETHTYPE_PPPOE:
+#endif /* PPPOE_SUPPORT */
+			/* full packet send to tcpip_thread to process */
+			if (netif->input(p, netif) != ERR_OK) {
+				LWIP_DEBUGF(NETIF_DEBUG, ("xaxiemacif_input: IP input error\r\n"));
+				XNETIF_STATS_RX_DROP(&xaxiemacif->stats,
+						     XNETIF_RX_DROP_STACK);
+				pbuf_free(p);
+			}
+			break;
+
+		default:
+			XNETIF_STATS_RX_DROP(&xaxiemacif->stats, XNETIF_RX_DROP_ETHTYPE);
+			pbuf_free(p);
+			break;
+	}
+}
+
 /*
  * xaxiemacif_input():
  *
@@ -279,66 +373,100 @@ static err_t xaxiemacif_output(struct netif *netif, struct pbuf *p,
  * should handle the actual reception of bytes from the network
  * interface.
  *
- * Returns the number of packets read (max 1 packet on success,
- * 0 if there are no packets)
+ * Packets are taken off the receive queue PQ_BULK_SIZE at a time.
+ * Without an OS one batch is passed to lwIP per call, with an OS the
+ * queue is drained.
+ *
+ * In the busy poll mode of the AXI DMA the rings are polled first, the
+ * application calls this function from its own loop in place of taking
+ * the RX interrupts, without an OS as well as with one.
+ *
+ * Returns the number of packets read (0 if there are no packets)
  *
  */
 
 int xaxiemacif_input(struct netif *netif)
 {
-	struct eth_hdr *ethhdr;
-	struct pbuf *p;
+	struct pbuf *p[PQ_BULK_SIZE];
+	int n_packets = 0;
+	int n, i;
+#if XLWIP_CONFIG_AXI_ETHERNET_DMA_POLL
 	SYS_ARCH_DECL_PROTECT(lev);
+#endif
 
 #if !NO_SYS
 	while (1)
 #endif
 	{
-		/* move received packet into a new pbuf */
+#if XLWIP_CONFIG_AXI_ETHERNET_DMA_POLL
+		/* serialized with the TX path, which frees sent BDs too */
 		SYS_ARCH_PROTECT(lev);
-		p = low_level_input(netif);
+		(void)axidma_poll((struct xemac_s *)(netif->state));
 		SYS_ARCH_UNPROTECT(lev);
+#endif
+		/* move received packets into the batch */
+		n = low_level_input(netif, p, PQ_BULK_SIZE);
 
 		/* no packet could be read, silently ignore this */
-		if (p == NULL)
-			return 0;
+		if (n == 0)
+			return n_packets;
 
-		/* points to packet payload, which starts with an Ethernet header */
-		ethhdr = p->payload;
+		for (i = 0; i < n; i++) {
+			xaxiemacif_input_frame(netif, p[i]);
+		}
+		n_packets += n;
+	}
+	return n_packets;
+}
 
-#if LINK_STATS
-		lwip_stats.link.recv++;
-#endif /* LINK_STATS */
+/*
+ * xaxiemacif_rxq_stats():
+ *
+ * Returns the depth statistics of the receive queue of the netif.
+ *
+ */
+void xaxiemacif_rxq_stats(struct netif *netif, pq_stats_t *stats)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xaxiemacif_s *xaxiemacif = (xaxiemacif_s *)(xemac->state);
 
-		switch (htons(ethhdr->type)) {
-			/* IP or ARP packet? */
-			case ETHTYPE_IP:
-			case ETHTYPE_ARP:
-#if LWIP_IPV6
-			/*IPv6 Packet?*/
-			case ETHTYPE_IPV6:
+	pq_get_stats(xaxiemacif->recv_q, stats);
+}
+
+#if XLWIP_CONFIG_TX_RECLAIM_WATERMARK
+/*
+ * xaxiemacif_tx_reclaim():
+ *
+ * Frees the sent TX BDs of the netif and their pbufs.
+ *
+ */
+void xaxiemacif_tx_reclaim(struct netif *netif)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xaxiemacif_s *xaxiemacif = (xaxiemacif_s *)(xemac->state);
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	SYS_ARCH_PROTECT(lev);
+	tx_reclaim(xaxiemacif);
+	SYS_ARCH_UNPROTECT(lev);
+}
 #endif
-#if PPPOE_SUPPORT
-				/* PPPoE packet? */
-			case ETHTYPE_PPPOEDISC:
-			case ETHTYPE_PPPOE:
-#endif /* PPPOE_SUPPORT */
-				/* full packet send to tcpip_thread to process */
-				if (netif->input(p, netif) != ERR_OK) {
-					LWIP_DEBUGF(NETIF_DEBUG, ("xaxiemacif_input: IP input error\r\n"));
-					pbuf_free(p);
-					p = NULL;
-				}
-				break;
 
-			default:
-				pbuf_free(p);
-				p = NULL;
-				break;
-		}
-	}
-	return 1;
+#if XLWIP_CONFIG_NETIF_STATS
+/*
+ * xaxiemacif_netif_stats():
+ *
+ * Returns a snapshot of the statistics of the netif.
+ *
+ */
+void xaxiemacif_netif_stats(struct netif *netif, xnetif_stats_t *stats)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xaxiemacif_s *xaxiemacif = (xaxiemacif_s *)(xemac->state);
+
+	xnetif_stats_copy(stats, &xaxiemacif->stats);
 }
+#endif
 
 static err_t low_level_init(struct netif *netif)
 {
@@ -364,6 +492,9 @@ static err_t low_level_init(struct netif *netif)
 	xemac->type = xemac_type_axi_ethernet;
 
 	xaxiemacif->send_q = NULL;
+#if XLWIP_CONFIG_NETIF_STATS
+	memset(&xaxiemacif->stats, 0, sizeof xaxiemacif->stats);
+#endif
 	xaxiemacif->recv_q = pq_create_queue();
 	if (!xaxiemacif->recv_q)
 		return ERR_MEM;
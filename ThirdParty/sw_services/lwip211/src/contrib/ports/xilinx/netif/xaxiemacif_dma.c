@@ -79,6 +79,13 @@
 /* Byte alignment of BDs */
 #define BD_ALIGNMENT (XAXIDMA_BD_MINIMUM_ALIGNMENT*2)
 
+/* TX ring interrupts, the TX path reclaims the sent BDs with a watermark */
+#if XLWIP_CONFIG_TX_RECLAIM_WATERMARK
+#define AXIDMA_TX_IRQ_MASK	XAXIDMA_IRQ_ERROR_MASK
+#else
+#define AXIDMA_TX_IRQ_MASK	XAXIDMA_IRQ_ALL_MASK
+#endif
+
 #if XPAR_INTC_0_HAS_FAST == 1
 /*********** Function Prototypes *********************************************/
 /*
@@ -298,14 +305,14 @@ static void axidma_send_handler(void *arg)
 		process_sent_bds(txringptr);
 	}
 
-	XAxiDma_BdRingIntEnable(txringptr, XAXIDMA_IRQ_ALL_MASK);
+	XAxiDma_BdRingIntEnable(txringptr, AXIDMA_TX_IRQ_MASK);
 
 #if !NO_SYS
 	xInsideISR--;
 #endif
 }
 
-static void setup_rx_bds(XAxiDma_BdRing *rxring)
+static void setup_rx_bds(xaxiemacif_s *xaxiemacif, XAxiDma_BdRing *rxring)
 {
 	XAxiDma_Bd *rxbd;
 	s32_t n_bds;
@@ -326,6 +333,7 @@ static void setup_rx_bds(XAxiDma_BdRing *rxring)
 			lwip_stats.link.memerr++;
 			lwip_stats.link.drop++;
 #endif
+			XNETIF_STATS_RX_DROP(&xaxiemacif->stats, XNETIF_RX_DROP_NO_PBUF);
 			xil_printf("unable to alloc pbuf in recv_handler\r\n");
 			return;
 		}
@@ -375,11 +383,93 @@ static void setup_rx_bds(XAxiDma_BdRing *rxring)
 	}
 }
 
-static void axidma_recv_handler(void *arg)
+/*
+ * Resets the DMA after an RX error, the caller resumes it.
+ */
+static void axidma_rx_reset(xaxiemacif_s *xaxiemacif, XAxiDma_BdRing *rxring)
+{
+	u32 timeOut;
+
+	setup_rx_bds(xaxiemacif, rxring);
+	LWIP_DEBUGF(NETIF_DEBUG, ("%s: Error: axidma error interrupt is asserted\r\n",
+		__FUNCTION__));
+	XAxiDma_Reset(&xaxiemacif->axidma);
+	timeOut = 10000;
+	while (timeOut) {
+		if (XAxiDma_ResetIsDone(&xaxiemacif->axidma)) {
+			break;
+		}
+		timeOut -= 1;
+	}
+}
+
+/*
+ * Moves the received frames of the RX ring to the receive queue and refills
+ * the ring. Returns the number of frames reaped.
+ */
+static u32 axidma_rx_reap(xaxiemacif_s *xaxiemacif, XAxiDma_BdRing *rxring)
 {
 	struct pbuf *p;
-	u32 irq_status, i, timeOut;
 	XAxiDma_Bd *rxbd, *rxbdset;
+	u32 bd_processed;
+	u32 rx_bytes;
+	u32 i;
+
+	bd_processed = XAxiDma_BdRingFromHw(rxring, XAXIDMA_ALL_BDS, &rxbdset);
+	if (bd_processed == 0) {
+		/* retry BDs left without a pbuf by an earlier refill */
+		setup_rx_bds(xaxiemacif, rxring);
+		return 0;
+	}
+	XNETIF_STATS_HIST(&xaxiemacif->stats.rx_ring_used, bd_processed);
+
+	for (i = 0, rxbd = rxbdset; i < bd_processed; i++) {
+		p = (struct pbuf *)(UINTPTR)XAxiDma_BdGetId(rxbd);
+		/* Adjust the buffer size to the actual number of bytes received.*/
+		rx_bytes = extract_packet_len(rxbd);
+		pbuf_realloc(p, rx_bytes);
+
+#if defined(__aarch64__)
+#ifdef USE_JUMBO_FRAMES
+		XCACHE_INVALIDATE_DCACHE_RANGE(p->payload,
+						XAE_MAX_JUMBO_FRAME_SIZE);
+#else
+		XCACHE_INVALIDATE_DCACHE_RANGE(p->payload, XAE_MAX_FRAME_SIZE);
+#endif
+#endif
+
+#if LWIP_PARTIAL_CSUM_OFFLOAD_RX==1
+		/* Verify for partial checksum offload case */
+		if (!is_checksum_valid(rxbd, p)) {
+			LWIP_DEBUGF(NETIF_DEBUG, ("Incorrect csum as calculated by the hw\r\n"));
+		}
+#endif
+		/* store it in the receive queue,
+		 * where it'll be processed by a different handler
+		 */
+		if (pq_enqueue(xaxiemacif->recv_q, (void*)p) < 0) {
+#if LINK_STATS
+			lwip_stats.link.memerr++;
+			lwip_stats.link.drop++;
+#endif
+			XNETIF_STATS_RX_DROP(&xaxiemacif->stats,
+					     XNETIF_RX_DROP_QUEUE_FULL);
+			pbuf_free(p);
+		}
+		rxbd = (XAxiDma_Bd *)XAxiDma_BdRingNext(rxring, rxbd);
+	}
+	/* free up the BD's */
+	XAxiDma_BdRingFree(rxring, bd_processed, rxbdset);
+	/* return all the processed bd's back to the stack */
+	/* setup_rx_bds -> use XAxiDma_BdRingGetFreeCnt */
+	setup_rx_bds(xaxiemacif, rxring);
+
+	return bd_processed;
+}
+
+static void axidma_recv_handler(void *arg)
+{
+	u32 irq_status;
 	struct xemac_s *xemac;
 	xaxiemacif_s *xaxiemacif;
 	XAxiDma_BdRing *rxring;
@@ -391,6 +481,7 @@ static void axidma_recv_handler(void *arg)
 	xemac = (struct xemac_s *)(arg);
 	xaxiemacif = (xaxiemacif_s *)(xemac->state);
 	rxring = XAxiDma_GetRxRing(&xaxiemacif->axidma);
+	XNETIF_STATS_RX_IRQ(&xaxiemacif->stats);
 
 	XAxiDma_BdRingIntDisable(rxring, XAXIDMA_IRQ_ALL_MASK);
 
@@ -405,17 +496,7 @@ static void axidma_recv_handler(void *arg)
 	 * processing.
 	 */
 	if ((irq_status & XAXIDMA_IRQ_ERROR_MASK)) {
-		setup_rx_bds(rxring);
-		LWIP_DEBUGF(NETIF_DEBUG, ("%s: Error: axidma error interrupt is asserted\r\n",
-			__FUNCTION__));
-		XAxiDma_Reset(&xaxiemacif->axidma);
-		timeOut = 10000;
-		while (timeOut) {
-			if (XAxiDma_ResetIsDone(&xaxiemacif->axidma)) {
-				break;
-			}
-			timeOut -= 1;
-		}
+		axidma_rx_reset(xaxiemacif, rxring);
 		XAxiDma_BdRingIntEnable(rxring, XAXIDMA_IRQ_ALL_MASK);
 		XAxiDma_Resume(&xaxiemacif->axidma);
 #if !NO_SYS
@@ -427,49 +508,7 @@ static void axidma_recv_handler(void *arg)
 	 * to handle the processed BDs and then raise the according flag.
 	 */
 	if (irq_status & (XAXIDMA_IRQ_DELAY_MASK | XAXIDMA_IRQ_IOC_MASK)) {
-		u32 bd_processed;
-		u32 rx_bytes;
-
-		bd_processed = XAxiDma_BdRingFromHw(rxring, XAXIDMA_ALL_BDS, &rxbdset);
-
-		for (i = 0, rxbd = rxbdset; i < bd_processed; i++) {
-			p = (struct pbuf *)(UINTPTR)XAxiDma_BdGetId(rxbd);
-			/* Adjust the buffer size to the actual number of bytes received.*/
-			rx_bytes = extract_packet_len(rxbd);
-			pbuf_realloc(p, rx_bytes);
-
-#if defined(__aarch64__)
-#ifdef USE_JUMBO_FRAMES
-			XCACHE_INVALIDATE_DCACHE_RANGE(p->payload,
-							XAE_MAX_JUMBO_FRAME_SIZE);
-#else
-			XCACHE_INVALIDATE_DCACHE_RANGE(p->payload, XAE_MAX_FRAME_SIZE);
-#endif
-#endif
-
-#if LWIP_PARTIAL_CSUM_OFFLOAD_RX==1
-			/* Verify for partial checksum offload case */
-			if (!is_checksum_valid(rxbd, p)) {
-				LWIP_DEBUGF(NETIF_DEBUG, ("Incorrect csum as calculated by the hw\r\n"));
-			}
-#endif
-			/* store it in the receive queue,
-			 * where it'll be processed by a different handler
-			 */
-			if (pq_enqueue(xaxiemacif->recv_q, (void*)p) < 0) {
-#if LINK_STATS
-				lwip_stats.link.memerr++;
-				lwip_stats.link.drop++;
-#endif
-				pbuf_free(p);
-			}
-			rxbd = (XAxiDma_Bd *)XAxiDma_BdRingNext(rxring, rxbd);
-		}
-		/* free up the BD's */
-		XAxiDma_BdRingFree(rxring, bd_processed, rxbdset);
-		/* return all the processed bd's back to the stack */
-		/* setup_rx_bds -> use XAxiDma_BdRingGetFreeCnt */
-		setup_rx_bds(rxring);
+		(void)axidma_rx_reap(xaxiemacif, rxring);
 	}
 	XAxiDma_BdRingIntEnable(rxring, XAXIDMA_IRQ_ALL_MASK);
 #if !NO_SYS
@@ -479,6 +518,52 @@ static void axidma_recv_handler(void *arg)
 
 }
 
+#if XLWIP_CONFIG_AXI_ETHERNET_DMA_POLL
+/*
+ * axidma_poll():
+ *
+ * Busy poll mode: services the TX and RX rings in place of the DMA
+ * interrupts, which stay disabled. The completed TX BDs are freed and the
+ * received frames moved to the receive queue, no semaphore is signaled.
+ *
+ * Must not run concurrently with the TX path of the netif.
+ *
+ * Returns the number of frames received.
+ */
+s32_t axidma_poll(struct xemac_s *xemac)
+{
+	xaxiemacif_s *xaxiemacif = (xaxiemacif_s *)(xemac->state);
+	XAxiDma_BdRing *txring = XAxiDma_GetTxRing(&xaxiemacif->axidma);
+	XAxiDma_BdRing *rxring = XAxiDma_GetRxRing(&xaxiemacif->axidma);
+	u32 irq_status;
+
+	/* the status bits latch with the interrupts disabled too */
+	irq_status = XAxiDma_BdRingGetIrq(txring);
+	if (irq_status != 0) {
+		XAxiDma_BdRingAckIrq(txring, irq_status);
+	}
+	if (irq_status & XAXIDMA_IRQ_ERROR_MASK) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("%s: Error: axidma TX error\r\n",
+			__FUNCTION__));
+		XAxiDma_Reset(&xaxiemacif->axidma);
+		return 0;
+	}
+	(void)process_sent_bds(txring);
+
+	irq_status = XAxiDma_BdRingGetIrq(rxring);
+	if (irq_status != 0) {
+		XAxiDma_BdRingAckIrq(rxring, irq_status);
+	}
+	if (irq_status & XAXIDMA_IRQ_ERROR_MASK) {
+		axidma_rx_reset(xaxiemacif, rxring);
+		XAxiDma_Resume(&xaxiemacif->axidma);
+		return 0;
+	}
+
+	return (s32_t)axidma_rx_reap(xaxiemacif, rxring);
+}
+#endif
+
 s32_t is_tx_space_available(xaxiemacif_s *emac)
 {
 	XAxiDma_BdRing *txring;
@@ -545,6 +630,8 @@ XStatus axidma_sgsend(xaxiemacif_s *xaxiemacif, struct pbuf *p)
 		LWIP_DEBUGF(NETIF_DEBUG, ("sgsend: Error allocating TxBD\r\n"));
 		return ERR_IF;
 	}
+	XNETIF_STATS_HIST(&xaxiemacif->stats.tx_ring_used,
+			  XLWIP_CONFIG_N_TX_DESC - XAxiDma_BdRingGetFreeCnt(txring));
 
 	for(q = p, txbd = txbdset; q != NULL; q = q->next) {
 		bdindex = XAxiDma_BD_TO_INDEX(txring, txbd);
@@ -799,9 +886,18 @@ XStatus init_axi_dma(struct xemac_s *xemac)
 		LWIP_DEBUGF(NETIF_DEBUG, ("Error: failed to start RX BD ring\r\n"));
 		return ERR_IF;
 	}
+#if XLWIP_CONFIG_AXI_ETHERNET_DMA_POLL
+	/*
+	 * busy poll mode: the handlers are connected below, but the DMA never
+	 * raises its interrupts, axidma_poll() services the rings instead
+	 */
+	XAxiDma_BdRingIntDisable(txringptr, XAXIDMA_IRQ_ALL_MASK);
+	XAxiDma_BdRingIntDisable(rxringptr, XAXIDMA_IRQ_ALL_MASK);
+#else
 	/* enable DMA interrupts */
-	XAxiDma_BdRingIntEnable(txringptr, XAXIDMA_IRQ_ALL_MASK);
+	XAxiDma_BdRingIntEnable(txringptr, AXIDMA_TX_IRQ_MASK);
 	XAxiDma_BdRingIntEnable(rxringptr, XAXIDMA_IRQ_ALL_MASK);
+#endif
 
 #if XLWIP_CONFIG_INCLUDE_AXIETH_ON_ZYNQ == 1
 	XScuGic_RegisterHandler(xtopologyp->scugic_baseaddr,
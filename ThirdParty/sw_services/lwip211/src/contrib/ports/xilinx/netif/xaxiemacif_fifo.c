@@ -81,16 +81,51 @@ xaxiemacif_s *xaxiemacif_fast;
 unsigned int xInsideISR = 0;
 #endif
 
+extern XLlFifo_Config XLlFifo_ConfigTable[];
+
+static XLlFifo_Config *
+xllfifo_lookup_config(UINTPTR base)
+{
+	XLlFifo_Config *CfgPtr = NULL;
+	int i;
+
+	for (i = 0; i < XPAR_XLLFIFO_NUM_INSTANCES; i++)
+		if (XLlFifo_ConfigTable[i].BaseAddress == base) {
+			CfgPtr = &XLlFifo_ConfigTable[i];
+			break;
+		}
+
+	return CfgPtr;
+}
+
 int is_tx_space_available(xaxiemacif_s *emac)
 {
 	return ((XLlFifo_TxVacancy(&emac->axififo) * 4) > XAE_MAX_FRAME_SIZE);
 }
 
+/*
+ * Reads a frame that no pbuf could be allocated for out of the fifo, in
+ * small pieces, to keep the data and length registers in sync.
+ */
+static void
+xllfifo_drop_frame(XLlFifo *llfifo, u32_t frame_length)
+{
+	u32_t scratch[16];
+	u32_t n;
+
+	while (frame_length) {
+		n = LWIP_MIN(frame_length, sizeof(scratch));
+		XLlFifo_Read(llfifo, scratch, n);
+		frame_length -= n;
+	}
+}
+
 static void
 xllfifo_recv_handler(struct xemac_s *xemac)
 {
 	u32_t frame_length;
 	struct pbuf *p;
+	struct pbuf *q;
 	xaxiemacif_s *xaxiemacif = (xaxiemacif_s *)(xemac->state);
 	XLlFifo *llfifo = &xaxiemacif->axififo;
 
@@ -99,25 +134,33 @@ xllfifo_recv_handler(struct xemac_s *xemac)
 		/* find packet length */
 		frame_length = XLlFifo_RxGetLen(llfifo);
 
-		/* allocate a pbuf */
-		p = pbuf_alloc(PBUF_RAW, frame_length, PBUF_POOL);
+		/* allocate a pbuf, allowing room for Ethernet padding */
+		p = pbuf_alloc(PBUF_RAW, frame_length + ETH_PAD_SIZE, PBUF_POOL);
 		if (!p) {
-                        char tmp_frame[XAE_MAX_FRAME_SIZE];
 #if LINK_STATS
 			lwip_stats.link.memerr++;
 			lwip_stats.link.drop++;
 #endif
 			/* receive and drop packet to keep data & len registers in sync */
-		        XLlFifo_Read(llfifo, tmp_frame, frame_length);
+			xllfifo_drop_frame(llfifo, frame_length);
 
 			continue;
-                }
+		}
+
+#if ETH_PAD_SIZE
+		pbuf_header(p, -ETH_PAD_SIZE);		/* drop the padding word */
+#endif
 
-		/* receive packet */
-		XLlFifo_Read(llfifo, p->payload, frame_length);
+		/* receive packet straight into the pbuf chain, the word aligned
+		 * part of each pbuf is read with bursts if the fifo has the AXI4
+		 * data interface
+		 */
+		for (q = p; q != NULL; q = q->next) {
+			XLlFifo_Read(llfifo, q->payload, q->len);
+		}
 
 #if ETH_PAD_SIZE
-		len += ETH_PAD_SIZE;		/* allow room for Ethernet padding */
+		pbuf_header(p, ETH_PAD_SIZE);		/* reclaim the padding word */
 #endif
 
 		/* store it in the receive queue, where it'll be processed by xemacif input thread */
@@ -216,10 +259,24 @@ XStatus init_axi_fifo(struct xemac_s *xemac)
 	xemac_fast = xemac;
 #endif
 	struct xtopology_t *xtopologyp = &xtopology[xemac->topology_index];
+	XLlFifo_Config *fifo_config;
 
-	/* initialize ll fifo */
-	XLlFifo_Initialize(&xaxiemacif->axififo,
+	/* initialize ll fifo, with its AXI4 data interface if it has one */
+	fifo_config = xllfifo_lookup_config(
 			XAxiEthernet_AxiDevBaseAddress(&xaxiemacif->axi_ethernet));
+	if (fifo_config) {
+		XLlFifo_CfgInitialize(&xaxiemacif->axififo, fifo_config,
+				fifo_config->BaseAddress);
+	} else {
+		XLlFifo_Initialize(&xaxiemacif->axififo,
+			XAxiEthernet_AxiDevBaseAddress(&xaxiemacif->axi_ethernet));
+	}
+
+	/* move the frame data with 64 bit bursts over the AXI4 data
+	 * interface, this fails harmlessly when the fifo only has AXI4-Lite
+	 */
+	XLlFifo_RxSetBurst(&xaxiemacif->axififo, 1);
+	XLlFifo_TxSetBurst(&xaxiemacif->axififo, 1);
 
 	/* Clear any pending FIFO interrupts */
 	XLlFifo_IntClear(&xaxiemacif->axififo, XLLF_INT_ALL_MASK);
@@ -339,7 +396,9 @@ XStatus axififo_send(xaxiemacif_s *xaxiemacif, struct pbuf *p)
 	struct pbuf *q;
 
 	for(q = p; q != NULL; q = q->next) {
-		/* write frame data to FIFO */
+		/* write frame data to FIFO, with bursts if the FIFO has the
+		 * AXI4 data interface
+		 */
 		XLlFifo_Write(llfifo, q->payload, q->len);
 		l += q->len;
 	}
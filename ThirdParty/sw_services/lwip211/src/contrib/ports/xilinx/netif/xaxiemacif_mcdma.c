@@ -82,6 +82,13 @@
 #define XMCDMA_BD_LENGTH_MASK   0x007FFFFF
 #define XMCDMA_COALESCEDELAY    0x1
 
+/* TX channel interrupts, the TX path reclaims the sent BDs with a watermark */
+#if XLWIP_CONFIG_TX_RECLAIM_WATERMARK
+#define XMCDMA_TX_IRQ_MASK      XMCDMA_IRQ_ERROR_MASK
+#else
+#define XMCDMA_TX_IRQ_MASK      XMCDMA_IRQ_ALL_MASK
+#endif
+
 #define RESET_TIMEOUT_COUNT     10000
 #define BLOCK_SIZE_2MB          0x200000
 #define BLOCK_SIZE_1MB          0x100000
@@ -534,26 +541,33 @@ XStatus axi_mcdma_sgsend(xaxiemacif_s *xaxiemacif, struct pbuf *p)
 	XMcdma_Bd *txbdset, *txbd, *last_txbd = NULL;
 	XMcdma_ChanCtrl *Tx_Chan;
 	XStatus status;
-	static u8_t ChanId = 1;
-	u8_t next_ChanId = ChanId;
+	u32_t ready_mask = 0;
+	u32_t ChanId;
 
 	/* first count the number of pbufs */
 	for (q = p; q != NULL; q = q->next)
 		n_pbufs++;
 
-	/* Transfer packets to TX DMA Channels in round-robin manner */
-	do {
+	/* Transfer packets to TX DMA Channels in weighted round-robin
+	 * manner, among the channels that have room for the packet */
+	for (ChanId = 1;
+	     ChanId <= xaxiemacif->axi_ethernet.Config.AxiMcDmaChan_Cnt;
+	     ChanId++) {
 		Tx_Chan = XMcdma_GetMcdmaTxChan(&xaxiemacif->aximcdma, ChanId);
+#if XLWIP_CONFIG_TX_RECLAIM_WATERMARK
+		if (Tx_Chan->BdCnt < XLWIP_CONFIG_TX_RECLAIM_WATERMARK)
+			process_sent_bds(Tx_Chan);
+#endif
+		if (n_pbufs <= Tx_Chan->BdCnt)
+			ready_mask |= 1U << (ChanId - 1);
+	}
 
-		if (++ChanId > xaxiemacif->axi_ethernet.Config.AxiMcDmaChan_Cnt)
-			ChanId = 1;
-
-		if ((next_ChanId == ChanId) && (n_pbufs > Tx_Chan->BdCnt)) {
-			LWIP_DEBUGF(NETIF_DEBUG, ("sgsend: Error, not enough BD space in All Chans\r\n"));
-			return ERR_IF;
-		}
-
-	} while (n_pbufs > Tx_Chan->BdCnt);
+	ChanId = XMcdma_SchedNextChan(&xaxiemacif->aximcdma, ready_mask);
+	if (ChanId == 0) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("sgsend: Error, not enough BD space in All Chans\r\n"));
+		return ERR_IF;
+	}
+	Tx_Chan = XMcdma_GetMcdmaTxChan(&xaxiemacif->aximcdma, ChanId);
 
 	txbdset = (XMcdma_Bd *)XMcdma_GetChanCurBd(Tx_Chan);
 
@@ -736,7 +750,7 @@ XStatus axi_mcdma_setup_tx_chan(struct xemac_s *xemac, u8 ChanId)
 		return ERR_IF;
 	}
 
-	XMcdma_IntrEnable(Tx_Chan, XMCDMA_IRQ_ALL_MASK);
+	XMcdma_IntrEnable(Tx_Chan, XMCDMA_TX_IRQ_MASK);
 
 	return XST_SUCCESS;
 }
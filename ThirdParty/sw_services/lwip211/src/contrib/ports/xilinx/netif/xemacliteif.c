@@ -114,6 +114,11 @@
 #define IEEE_AN1_ABILITY_MASK_100MBPS		0x0380
 #define IEEE_AN1_ABILITY_MASK_10MBPS		0x0060
 
+/* Most pbufs a frame may be split into for a direct copy to or from the
+ * emaclite buffers, longer chains go through xemac_tx_frame.
+ */
+#define XEMACLITEIF_MAX_SEGS	16
+
 #define PHY_DETECT_REG		1
 #define PHY_DETECT_MASK 	0x1808
 
@@ -153,13 +158,41 @@ XEmacLite *xemaclitep_fast;
 #endif
 #endif
 
+/*
+ * Builds the segment list of the driver from a pbuf chain, so that the frame
+ * is copied straight between the pbufs and the ping/pong buffers of the
+ * EmacLite. Returns the number of segments, or 0 if the chain is longer than
+ * XEMACLITEIF_MAX_SEGS.
+ */
+static unsigned
+pbuf_to_segments(struct pbuf *p, XEmacLite_Segment *segs)
+{
+	struct pbuf *q;
+	unsigned n = 0;
+
+	for (q = p; q != NULL; q = q->next) {
+		if (q->len == 0)
+			continue;
+		if (n == XEMACLITEIF_MAX_SEGS)
+			return 0;
+		segs[n].DataPtr = q->payload;
+		segs[n].Length = q->len;
+		n++;
+	}
+
+	return n;
+}
+
 static void
 xemacif_recv_handler(void *arg) {
 	struct xemac_s *xemac = (struct xemac_s *)(arg);
 	xemacliteif_s *xemacliteif = (xemacliteif_s *)(xemac->state);
 	XEmacLite *instance = xemacliteif->instance;
+	XEmacLite_Segment segs[XEMACLITEIF_MAX_SEGS];
 	struct pbuf *p;
+	unsigned nsegs;
 	int len = 0;
+	int received = 0;
 	struct xtopology_t *xtopologyp = &xtopology[xemac->topology_index];
 
 #if !NO_SYS
@@ -170,53 +203,60 @@ xemacif_recv_handler(void *arg) {
 #else
 	XIntc_AckIntr(xtopologyp->intc_baseaddr, 1 << xtopologyp->intc_emac_intr);
 #endif
-	p = pbuf_alloc(PBUF_RAW, XEL_MAX_FRAME_SIZE, PBUF_POOL);
-	if (!p) {
+
+	/* both the ping and the pong buffer may hold a frame by now, empty
+	 * them all so that the emaclite can receive again while the frames
+	 * are processed
+	 */
+	while ((len = XEmacLite_RecvLength(instance)) != 0) {
+		p = pbuf_alloc(PBUF_RAW, len + ETH_PAD_SIZE, PBUF_POOL);
+		if (!p) {
 #if LINK_STATS
-		lwip_stats.link.memerr++;
-		lwip_stats.link.drop++;
+			lwip_stats.link.memerr++;
+			lwip_stats.link.drop++;
+#endif
+			/* receive and just ignore the frame.
+			 * we need to receive the frame because otherwise emaclite will
+			 * not generate any other interrupts since it cannot receive,
+			 * and we do not actively poll the emaclite
+			 */
+			XEmacLite_RecvSg(instance, NULL, 0);
+			continue;
+		}
+
+#if ETH_PAD_SIZE
+		pbuf_header(p, -ETH_PAD_SIZE);		/* drop the padding word */
 #endif
-		/* receive and just ignore the frame.
-		 * we need to receive the frame because otherwise emaclite will
-		 * not generate any other interrupts since it cannot receive,
-		 * and we do not actively poll the emaclite
-		 */
-		XEmacLite_Recv(instance, xemac_tx_frame);
-#if !NO_SYS
-		xInsideISR--;
+		/* receive the packet straight into the pbuf chain */
+		nsegs = pbuf_to_segments(p, segs);
+		len = XEmacLite_RecvSg(instance, segs, nsegs);
+#if ETH_PAD_SIZE
+		pbuf_header(p, ETH_PAD_SIZE);		/* reclaim the padding word */
 #endif
-		return;
-	}
-
-	/* receive the packet */
-	len = XEmacLite_Recv(instance, p->payload);
 
-	if (len == 0) {
+		if ((len == 0) || (nsegs == 0)) {
 #if LINK_STATS
-		lwip_stats.link.drop++;
-#endif
-		pbuf_free(p);
-#if !NO_SYS
-		xInsideISR--;
+			lwip_stats.link.drop++;
 #endif
-		return;
-	}
+			pbuf_free(p);
+			continue;
+		}
 
-	/* store it in the receive queue, where it'll be processed by xemacif input thread */
-	if (pq_enqueue(xemacliteif->recv_q, (void*)p) < 0) {
+		/* store it in the receive queue, where it'll be processed by xemacif input thread */
+		if (pq_enqueue(xemacliteif->recv_q, (void*)p) < 0) {
 #if LINK_STATS
-		lwip_stats.link.memerr++;
-		lwip_stats.link.drop++;
+			lwip_stats.link.memerr++;
+			lwip_stats.link.drop++;
 #endif
-		pbuf_free(p);
-#if !NO_SYS
-		xInsideISR--;
-#endif
-		return;
+			pbuf_free(p);
+			continue;
+		}
+		received++;
 	}
 
 #if !NO_SYS
-	sys_sem_signal(&xemac->sem_rx_data_available);
+	if (received)
+		sys_sem_signal(&xemac->sem_rx_data_available);
 	xInsideISR--;
 #endif
 }
@@ -242,22 +282,35 @@ int transmit_packet(XEmacLite *instancep, void *packet, unsigned len)
 static err_t
 _unbuffered_low_level_output(XEmacLite *instancep, struct pbuf *p)
 {
+	XEmacLite_Segment segs[XEMACLITEIF_MAX_SEGS];
 	struct pbuf *q;
+	unsigned nsegs;
 	int total_len = 0;
+	int result;
 
 #if ETH_PAD_SIZE
 	pbuf_header(p, -ETH_PAD_SIZE);			/* drop the padding word */
 #endif
 
-	for(q = p, total_len = 0; q != NULL; q = q->next) {
-		/* Send the data from the pbuf to the interface, one pbuf at a
-		   time. The size of the data in each pbuf is kept in the ->len
-		   variable. */
-		memcpy(xemac_tx_frame + total_len, q->payload, q->len);
-		total_len += q->len;
+	/* copy the payload of each pbuf straight into the emaclite buffer */
+	nsegs = pbuf_to_segments(p, segs);
+	if (nsegs != 0) {
+		result = (XEmacLite_SendSg(instancep, segs, nsegs) ==
+				XST_SUCCESS) ? 0 : -1;
+	} else {
+		for(q = p, total_len = 0; q != NULL; q = q->next) {
+			/* Send the data from the pbuf to the interface, one pbuf at a
+			   time. The size of the data in each pbuf is kept in the ->len
+			   variable. */
+			if (total_len + q->len > XEL_MAX_FRAME_SIZE)
+				break;
+			memcpy(xemac_tx_frame + total_len, q->payload, q->len);
+			total_len += q->len;
+		}
+		result = transmit_packet(instancep, xemac_tx_frame, total_len);
 	}
 
-	if (transmit_packet(instancep, xemac_tx_frame, total_len) < 0) {
+	if (result < 0) {
 #if LINK_STATS
 		lwip_stats.link.drop++;
 #endif
@@ -293,15 +346,22 @@ low_level_output(struct netif *netif, struct pbuf *p)
 
 	SYS_ARCH_PROTECT(lev);
 
-	/* check if space is available to send */
-        if (XEmacLite_TxBufferAvailable(instance) == TRUE) {
-		if (pq_qlength(xemacliteif->send_q)) {  	/* send backlog */
-			_unbuffered_low_level_output(instance, (struct pbuf *)pq_dequeue(xemacliteif->send_q));
-		} else { 				/* send current */
-			_unbuffered_low_level_output(instance, p);
-			SYS_ARCH_UNPROTECT(lev);
-			return ERR_OK;
-		}
+	/* send the backlog first, into as many of the ping and pong buffers
+	 * as are free
+	 */
+	while (pq_qlength(xemacliteif->send_q) &&
+			(XEmacLite_TxBufferAvailable(instance) == TRUE)) {
+		q = (struct pbuf *)pq_dequeue(xemacliteif->send_q);
+		_unbuffered_low_level_output(instance, q);
+		pbuf_free(q);
+	}
+
+	/* send current */
+	if ((pq_qlength(xemacliteif->send_q) == 0) &&
+			(XEmacLite_TxBufferAvailable(instance) == TRUE)) {
+		_unbuffered_low_level_output(instance, p);
+		SYS_ARCH_UNPROTECT(lev);
+		return ERR_OK;
 	}
 
 	/* if we cannot send the packet immediately, then make a copy of the whole packet
@@ -317,14 +377,19 @@ low_level_output(struct netif *netif, struct pbuf *p)
 		return ERR_MEM;
 	}
 
-	for (q->len = 0; p; p = p->next) {
-		memcpy(q->payload + q->len, p->payload, p->len);
-		q->len += p->len;
+	if (pbuf_copy(q, p) != ERR_OK) {
+#if LINK_STATS
+		lwip_stats.link.drop++;
+#endif
+		pbuf_free(q);
+		SYS_ARCH_UNPROTECT(lev);
+		return ERR_MEM;
 	}
 	if (pq_enqueue(xemacliteif->send_q, (void *)q) < 0) {
 #if LINK_STATS
 		lwip_stats.link.drop++;
 #endif
+		pbuf_free(q);
 		SYS_ARCH_UNPROTECT(lev);
 		return ERR_MEM;
 	}
@@ -349,7 +414,8 @@ xemacif_send_handler(void *arg) {
 	XIntc_AckIntr(xtopologyp->intc_baseaddr, 1 << xtopologyp->intc_emac_intr);
 #endif
 
-	if (pq_qlength(xemacliteif->send_q) && (XEmacLite_TxBufferAvailable(instance) == TRUE)) {
+	/* refill both the ping and the pong buffer if they are free */
+	while (pq_qlength(xemacliteif->send_q) && (XEmacLite_TxBufferAvailable(instance) == TRUE)) {
 		struct pbuf *p = pq_dequeue(xemacliteif->send_q);
 		_unbuffered_low_level_output(instance, p);
 		pbuf_free(p);
@@ -380,6 +446,21 @@ low_level_input(struct netif *netif)
 	return (struct pbuf *)pq_dequeue(xemacliteif->recv_q);
 }
 
+/*
+ * xemacliteif_rxq_stats():
+ *
+ * Returns the depth statistics of the receive queue of the netif.
+ *
+ */
+void
+xemacliteif_rxq_stats(struct netif *netif, pq_stats_t *stats)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xemacliteif_s *xemacliteif = (xemacliteif_s *)(xemac->state);
+
+	pq_get_stats(xemacliteif->recv_q, stats);
+}
+
 /*
  * xemacliteif_output():
  *
@@ -160,7 +160,11 @@ static err_t low_level_output(struct netif *netif, struct pbuf *p)
 	SYS_ARCH_PROTECT(lev);
 	/* check if space is available to send */
     freecnt = is_tx_space_available(xemacpsif);
+#if XLWIP_CONFIG_TX_RECLAIM_WATERMARK
+    if (freecnt < XLWIP_CONFIG_TX_RECLAIM_WATERMARK) {
+#else
     if (freecnt <= 5) {
+#endif
 	txring = &(XEmacPs_GetTxRing(&xemacpsif->emacps));
 		process_sent_bds(xemacpsif, txring);
 	}
@@ -210,20 +214,22 @@ return_pack_dropped:
  * Should allocate a pbuf and transfer the bytes of the incoming
  * packet from the interface into the pbuf.
  *
+ * Takes up to n received packets off the receive queue. The ISR is the
+ * only producer of the queue, so no interrupt masking is needed.
+ *
  */
-static struct pbuf * low_level_input(struct netif *netif)
+static int low_level_input(struct netif *netif, struct pbuf **p, int n)
 {
 	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
 	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
-	struct pbuf *p;
+	int taken;
 
-	/* see if there is data to process */
-	if (pq_qlength(xemacpsif->recv_q) == 0)
-		return NULL;
+	taken = pq_dequeue_bulk(xemacpsif->recv_q, (void **)p, n);
+	if (taken > 0) {
+		XNETIF_STATS_RX_INPUT(&xemacpsif->stats);
+	}
 
-	/* return one packet from receive q */
-	p = (struct pbuf *)pq_dequeue(xemacpsif->recv_q);
-	return p;
+	return taken;
 }
 
 /*
@@ -242,6 +248,64 @@ static err_t xemacpsif_output(struct netif *netif, struct pbuf *p,
 	return etharp_output(netif, p, ipaddr);
 }
 
+/*
+ * xemacpsif_input_frame():
+ *
+ * Passes one received packet to lwIP, or drops it if it is of a type
+ * the stack does not handle.
+ *
+ */
+static void xemacpsif_input_frame(struct netif *netif, struct pbuf *p)
+{
+	struct eth_hdr *ethhdr;
+#if XLWIP_CONFIG_NETIF_STATS
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
+#endif
+
+	/* points to packet payload, which starts with an Ethernet header */
+	ethhdr = p->payload;
+
+#if LINK_STATS
+	lwip_stats.link.recv++;
+#endif /* LINK_STATS */
+
+#if XLWIP_CONFIG_EMACPS_UDP_STREAM
+	/* datagrams of an open UDP stream bypass the stack */
+	if (xemacpsif_udps_input(netif, p) != 0) {
+		return;
+	}
+#endif
+
+	switch (htons(ethhdr->type)) {
+		/* IP or ARP packet? */
+		case ETHTYPE_IP:
+		case ETHTYPE_ARP:
+#if LWIP_IPV6
+		/*IPv6 Packet?*/
+		case ETHTYPE_IPV6:
+#endif
+#if PPPOE_SUPPORT
+			/* PPPoE packet? */
+		case ETHTYPE_PPPOEDISC:
+		case ETHTYPE_PPPOE:
+#endif /* PPPOE_SUPPORT */
+			/* full packet send to tcpip_thread to process */
+			if (netif->input(p, netif) != ERR_OK) {
+				LWIP_DEBUGF(NETIF_DEBUG, ("xemacpsif_input: IP input error\r\n"));
+				XNETIF_STATS_RX_DROP(&xemacpsif->stats,
+						     XNETIF_RX_DROP_STACK);
+				pbuf_free(p);
+			}
+			break;
+
+		default:
+			XNETIF_STATS_RX_DROP(&xemacpsif->stats, XNETIF_RX_DROP_ETHTYPE);
+			pbuf_free(p);
+			break;
+	}
+}
+
 /*
  * xemacpsif_input():
  *
@@ -250,69 +314,127 @@ static err_t xemacpsif_output(struct netif *netif, struct pbuf *p,
  * should handle the actual reception of bytes from the network
  * interface.
  *
- * Returns the number of packets read (max 1 packet on success,
- * 0 if there are no packets)
+ * Packets are taken off the receive queue PQ_BULK_SIZE at a time.
+ * Without an OS one batch is passed to lwIP per call, with an OS the
+ * queue is drained.
+ *
+ * Returns the number of packets read (0 if there are no packets)
  *
  */
 
 s32_t xemacpsif_input(struct netif *netif)
 {
-	struct eth_hdr *ethhdr;
-	struct pbuf *p;
+	struct pbuf *p[PQ_BULK_SIZE];
+	s32_t n_packets = 0;
+	int n, i;
+#if XLWIP_CONFIG_EMACPS_RX_POLL_BUDGET
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	u32_t polled = 0;
 	SYS_ARCH_DECL_PROTECT(lev);
+#endif
 
 #if !NO_SYS
 	while (1)
 #endif
 	{
-		/* move received packet into a new pbuf */
-		SYS_ARCH_PROTECT(lev);
-		p = low_level_input(netif);
-		SYS_ARCH_UNPROTECT(lev);
+		/* move received packets into the batch */
+		n = low_level_input(netif, p, PQ_BULK_SIZE);
+#if XLWIP_CONFIG_EMACPS_RX_POLL_BUDGET
+		/*
+		 * refill the receive queue from the RX ring, once per call; the
+		 * ring is shared with the error handler, so this one is masked
+		 */
+		if ((n == 0) && (polled == 0)) {
+			polled = 1;
+			SYS_ARCH_PROTECT(lev);
+			(void)emacps_rx_poll(xemac, XLWIP_CONFIG_EMACPS_RX_POLL_BUDGET);
+			SYS_ARCH_UNPROTECT(lev);
+			n = low_level_input(netif, p, PQ_BULK_SIZE);
+		}
+#endif
 
 		/* no packet could be read, silently ignore this */
-		if (p == NULL) {
-			return 0;
+		if (n == 0) {
+#if XLWIP_CONFIG_EMACPS_RX_POLL_BUDGET && !NO_SYS
+			/* budget used up, come back after other tasks had a chance to run */
+			if (((xemacpsif_s *)(xemac->state))->rx_poll_pending != 0) {
+				sys_sem_signal(&xemac->sem_rx_data_available);
+			}
+#endif
+			return n_packets;
 		}
 
-		/* points to packet payload, which starts with an Ethernet header */
-		ethhdr = p->payload;
-
-	#if LINK_STATS
-		lwip_stats.link.recv++;
-	#endif /* LINK_STATS */
-
-		switch (htons(ethhdr->type)) {
-			/* IP or ARP packet? */
-			case ETHTYPE_IP:
-			case ETHTYPE_ARP:
-	#if LWIP_IPV6
-			/*IPv6 Packet?*/
-			case ETHTYPE_IPV6:
-	#endif
-	#if PPPOE_SUPPORT
-				/* PPPoE packet? */
-			case ETHTYPE_PPPOEDISC:
-			case ETHTYPE_PPPOE:
-	#endif /* PPPOE_SUPPORT */
-				/* full packet send to tcpip_thread to process */
-				if (netif->input(p, netif) != ERR_OK) {
-					LWIP_DEBUGF(NETIF_DEBUG, ("xemacpsif_input: IP input error\r\n"));
-					pbuf_free(p);
-					p = NULL;
-				}
-				break;
-
-			default:
-				pbuf_free(p);
-				p = NULL;
-				break;
+		for (i = 0; i < n; i++) {
+			xemacpsif_input_frame(netif, p[i]);
 		}
+		n_packets += n;
 	}
 
-	return 1;
+	return n_packets;
 }
 
+/*
+ * xemacpsif_rxq_stats():
+ *
+ * Returns the depth statistics of the receive queue of the netif.
+ *
+ */
+void xemacpsif_rxq_stats(struct netif *netif, pq_stats_t *stats)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
+
+	pq_get_stats(xemacpsif->recv_q, stats);
+}
+
+#if XLWIP_CONFIG_TX_RECLAIM_WATERMARK
+/*
+ * xemacpsif_tx_reclaim():
+ *
+ * Frees the sent TX BDs of the netif and their pbufs.
+ *
+ */
+void xemacpsif_tx_reclaim(struct netif *netif)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	SYS_ARCH_PROTECT(lev);
+	process_sent_bds(xemacpsif, &(XEmacPs_GetTxRing(&xemacpsif->emacps)));
+	SYS_ARCH_UNPROTECT(lev);
+}
+#endif
+
+#if XLWIP_CONFIG_NETIF_STATS
+/*
+ * xemacpsif_netif_stats():
+ *
+ * Returns a snapshot of the statistics of the netif. The frames the GEM
+ * dropped for lack of RX BDs are taken from its clear on read statistics
+ * registers.
+ *
+ */
+void xemacpsif_netif_stats(struct netif *netif, xnetif_stats_t *stats)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
+	u32_t ring_drops;
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	ring_drops = XEmacPs_ReadReg(xemacpsif->emacps.Config.BaseAddress,
+				     XEMACPS_RXRESERRCNT_OFFSET);
+	ring_drops += XEmacPs_ReadReg(xemacpsif->emacps.Config.BaseAddress,
+				      XEMACPS_RXORCNT_OFFSET);
+
+	SYS_ARCH_PROTECT(lev);
+	xemacpsif->stats.rx_drops[XNETIF_RX_DROP_RING] += ring_drops;
+	SYS_ARCH_UNPROTECT(lev);
+
+	xnetif_stats_copy(stats, &xemacpsif->stats);
+}
+#endif
+
 #if !NO_SYS
 #if defined(__arm__) && !defined(ARMR5)
 void vTimerCallback( TimerHandle_t pxTimer )
@@ -358,6 +480,10 @@ static err_t low_level_init(struct netif *netif)
 	xemac->type = xemac_type_emacps;
 
 	xemacpsif->send_q = NULL;
+	xemacpsif->rx_poll_pending = 0;
+#if XLWIP_CONFIG_NETIF_STATS
+	memset(&xemacpsif->stats, 0, sizeof xemacpsif->stats);
+#endif
 	xemacpsif->recv_q = pq_create_queue();
 	if (!xemacpsif->recv_q)
 		return ERR_MEM;
@@ -552,7 +678,7 @@ static void xemacpsif_mld6_mac_hash_update (struct netif *netif, u8_t *ip_addr,
 	reset_dma(xemac);
 
 	/* Start Ethernet */
-	XEmacPs_Start(&xemacpsif->emacps);
+	start_emacps(xemacpsif);
 
 	SYS_ARCH_UNPROTECT(lev);
 }
@@ -659,7 +785,7 @@ static void xemacpsif_mac_hash_update (struct netif *netif, u8_t *ip_addr,
 	reset_dma(xemac);
 
 	/* Start Ethernet */
-	XEmacPs_Start(&xemacpsif->emacps);
+	start_emacps(xemacpsif);
 
 	SYS_ARCH_UNPROTECT(lev);
 }
@@ -793,3 +919,68 @@ void xemacpsif_resetrx_on_no_rxdata(struct netif *netif)
 
 	resetrx_on_no_rxdata(xemacpsif);
 }
+
+#if XLWIP_CONFIG_EMACPS_RX_Q1
+/*
+ * xemacpsif_rx_steer_udp_port():
+ *
+ * Steers received UDP frames with destination port to RX priority queue 1,
+ * whose frames are passed to lwIP ahead of the ones of queue 0. Index is
+ * the type 1 screener used for the match.
+ *
+ * Returns XST_SUCCESS, or XST_INVALID_PARAM if the GEM has no such screener.
+ */
+s32_t xemacpsif_rx_steer_udp_port(struct netif *netif, u32_t index,
+				  u16_t port)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
+	XEmacPs_ScreenT1 screen;
+
+	if ((xemacpsif->rxq1_active == 0) ||
+	    (index >= XEmacPs_GetNumScreeners(&xemacpsif->emacps,
+					      XEMACPS_SCREEN_T1))) {
+		return XST_INVALID_PARAM;
+	}
+
+	memset(&screen, 0, sizeof(screen));
+	screen.Queue = 1;
+	screen.UdpPortEnable = 1;
+	screen.UdpPort = port;
+
+	return (s32_t)XEmacPs_SetScreenT1(&xemacpsif->emacps, (u8)index, &screen);
+}
+
+/*
+ * xemacpsif_rx_steer_ethertype():
+ *
+ * Steers received frames of ethertype to RX priority queue 1. Index is used
+ * for both the type 2 screener and its ethertype register.
+ *
+ * Returns XST_SUCCESS, or XST_INVALID_PARAM if the GEM has no such screener.
+ */
+s32_t xemacpsif_rx_steer_ethertype(struct netif *netif, u32_t index,
+				   u16_t ethtype)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
+	XEmacPs_ScreenT2 screen;
+	LONG status;
+
+	if (xemacpsif->rxq1_active == 0) {
+		return XST_INVALID_PARAM;
+	}
+
+	status = XEmacPs_SetScreenEthType(&xemacpsif->emacps, (u8)index, ethtype);
+	if (status != XST_SUCCESS) {
+		return (s32_t)status;
+	}
+
+	memset(&screen, 0, sizeof(screen));
+	screen.Queue = 1;
+	screen.EthTypeEnable = 1;
+	screen.EthTypeIndex = (u8)index;
+
+	return (s32_t)XEmacPs_SetScreenT2(&xemacpsif->emacps, (u8)index, &screen);
+}
+#endif
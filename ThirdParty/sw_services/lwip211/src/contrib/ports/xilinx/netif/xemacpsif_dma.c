@@ -64,8 +64,91 @@
 /* A max of 4 different ethernet interfaces are supported */
 static UINTPTR tx_pbufs_storage[4*XLWIP_CONFIG_N_TX_DESC];
 static UINTPTR rx_pbufs_storage[4*XLWIP_CONFIG_N_RX_DESC];
+#if XLWIP_CONFIG_EMACPS_RX_Q1
+static UINTPTR rx_q1_pbufs_storage[4*XLWIP_CONFIG_N_RX_DESC];
+#endif
+
+#ifdef ZYNQMP_USE_JUMBO
+#define RX_FRAME_SIZE	MAX_FRAME_SIZE_JUMBO
+#else
+#define RX_FRAME_SIZE	XEMACPS_MAX_FRAME_SIZE
+#endif
+
+#if XLWIP_CONFIG_EMACPS_RX_POOL_SIZE
+/* RX pool buffers are cache line aligned and padded, so that cache
+ * maintenance on a buffer never touches a neighbouring one.
+ */
+#define RX_POOL_ALIGNMENT	64
+#define RX_POOL_BUF_SIZE	((RX_FRAME_SIZE + RX_POOL_ALIGNMENT - 1) & \
+				 ~(RX_POOL_ALIGNMENT - 1))
+
+typedef struct rx_pool_buf {
+	struct pbuf_custom pc;
+	struct rx_pool_buf *next;
+	xemacpsif_s *xemacpsif;
+	/* bytes the CPU may have cached since the buffer left the pool */
+	u32_t used_len;
+	u8_t payload[RX_POOL_BUF_SIZE] __attribute__ ((aligned (RX_POOL_ALIGNMENT)));
+} rx_pool_buf_t;
+
+/* A pool for each of the max 4 ethernet interfaces */
+static rx_pool_buf_t rx_pool[4][XLWIP_CONFIG_EMACPS_RX_POOL_SIZE];
+static rx_pool_buf_t *rx_pool_free[4];
+static u8_t rx_pool_ready[4];
+#endif
 
 static s32_t emac_intr_num;
+
+#if XLWIP_CONFIG_HW_TIMESTAMP
+#define PTP_ETHTYPE		0x88F7U
+#define PTP_EVENT_UDP_PORT	319U
+
+/*
+ * Reads a seconds and nanoseconds register pair of the timestamp unit, the
+ * seconds are read again in case they ticked between the reads.
+ */
+static void emacps_get_ts(UINTPTR base, u32_t sec_offset, u32_t nsec_offset,
+			  u32_t *sec, u32_t *nsec)
+{
+	u32_t s;
+
+	do {
+		s = XEmacPs_ReadReg(base, sec_offset);
+		*nsec = XEmacPs_ReadReg(base, nsec_offset);
+	} while (XEmacPs_ReadReg(base, sec_offset) != s);
+	*sec = s;
+}
+
+/*
+ * Tells whether an untagged frame is a PTP event message, over Ethernet or
+ * UDP/IPv4. The GEM latches the timestamps of those in its PTP event
+ * registers.
+ */
+static int emacps_is_ptp_event(struct pbuf *p)
+{
+	u8_t *frame = (u8_t *)p->payload;
+	u16_t type;
+	u32_t ihl;
+
+	if (p->len < 15) {
+		return 0;
+	}
+	type = ((u16_t)frame[12] << 8) | frame[13];
+	if (type == PTP_ETHTYPE) {
+		/* message types 0 to 7 are event messages */
+		return (frame[14] & 0x08U) == 0;
+	}
+	if (type != ETHTYPE_IP) {
+		return 0;
+	}
+	ihl = (frame[14] & 0x0FU) * 4U;
+	if ((p->len < 14 + ihl + 8) || (frame[23] != IP_PROTO_UDP)) {
+		return 0;
+	}
+	return (((u16_t)frame[14 + ihl + 2] << 8) | frame[14 + ihl + 3]) ==
+		PTP_EVENT_UDP_PORT;
+}
+#endif
 #if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
 volatile u32_t notifyinfo[4*XLWIP_CONFIG_N_TX_DESC];
 #endif
@@ -223,6 +306,119 @@ u32_t get_base_index_rxpbufsstorage (xemacpsif_s *xemacpsif)
 	return index;
 }
 
+/*
+ * rx_ring_storage():
+ *
+ * Returns the pbuf storage of the BDs of an RX ring of the interface.
+ */
+static inline
+UINTPTR *rx_ring_storage(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring)
+{
+	u32_t index = get_base_index_rxpbufsstorage(xemacpsif);
+
+#if XLWIP_CONFIG_EMACPS_RX_Q1
+	if (rxring == &xemacpsif->rxq1_ring) {
+		return &rx_q1_pbufs_storage[index];
+	}
+#else
+	(void)rxring;
+#endif
+	return &rx_pbufs_storage[index];
+}
+
+#if XLWIP_CONFIG_EMACPS_RX_POOL_SIZE
+/*
+ * rx_pool_return():
+ *
+ * Custom free function of the RX pool pbufs, called by lwIP when the last
+ * reference to a received frame is dropped. Buffers in the pool hold no
+ * cache lines, so only the part the CPU may have cached is invalidated.
+ */
+static void rx_pool_return(struct pbuf *p)
+{
+	rx_pool_buf_t *buf = (rx_pool_buf_t *)p;
+	u32_t pool = get_base_index_rxpbufsstorage(buf->xemacpsif) /
+		     XLWIP_CONFIG_N_RX_DESC;
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	if ((buf->xemacpsif->emacps.Config.IsCacheCoherent == 0) &&
+	    (buf->used_len != 0)) {
+		Xil_DCacheInvalidateRange((UINTPTR)buf->payload, buf->used_len);
+	}
+
+	SYS_ARCH_PROTECT(lev);
+	buf->next = rx_pool_free[pool];
+	rx_pool_free[pool] = buf;
+	SYS_ARCH_UNPROTECT(lev);
+}
+
+/*
+ * rx_pool_init():
+ *
+ * Puts all buffers of the interface in its pool, once. The buffers are
+ * invalidated in full since their lines may be dirty from startup.
+ */
+static void rx_pool_init(xemacpsif_s *xemacpsif)
+{
+	u32_t pool = get_base_index_rxpbufsstorage(xemacpsif) /
+		     XLWIP_CONFIG_N_RX_DESC;
+	rx_pool_buf_t *buf;
+	u32_t i;
+
+	if (rx_pool_ready[pool] != 0) {
+		return;
+	}
+
+	rx_pool_free[pool] = NULL;
+	for (i = 0; i < XLWIP_CONFIG_EMACPS_RX_POOL_SIZE; i++) {
+		buf = &rx_pool[pool][i];
+		buf->pc.custom_free_function = rx_pool_return;
+		buf->xemacpsif = xemacpsif;
+		buf->used_len = RX_POOL_BUF_SIZE;
+		rx_pool_return(&buf->pc.pbuf);
+	}
+	rx_pool_ready[pool] = 1;
+}
+#endif
+
+/*
+ * rx_pbuf_alloc():
+ *
+ * Returns a pbuf to receive a frame in, with no cache lines that could be
+ * written back over the received data, or NULL if none is available.
+ */
+static struct pbuf *rx_pbuf_alloc(xemacpsif_s *xemacpsif)
+{
+	struct pbuf *p;
+#if XLWIP_CONFIG_EMACPS_RX_POOL_SIZE
+	u32_t pool = get_base_index_rxpbufsstorage(xemacpsif) /
+		     XLWIP_CONFIG_N_RX_DESC;
+	rx_pool_buf_t *buf;
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	SYS_ARCH_PROTECT(lev);
+	buf = rx_pool_free[pool];
+	if (buf != NULL) {
+		rx_pool_free[pool] = buf->next;
+	}
+	SYS_ARCH_UNPROTECT(lev);
+
+	if (buf == NULL) {
+		return NULL;
+	}
+
+	buf->used_len = 0;
+	p = pbuf_alloced_custom(PBUF_RAW, RX_FRAME_SIZE, PBUF_REF, &buf->pc,
+				buf->payload, RX_POOL_BUF_SIZE);
+#else
+	p = pbuf_alloc(PBUF_RAW, RX_FRAME_SIZE, PBUF_POOL);
+	if ((p != NULL) && (xemacpsif->emacps.Config.IsCacheCoherent == 0)) {
+		Xil_DCacheInvalidateRange((UINTPTR)p->payload, (UINTPTR)RX_FRAME_SIZE);
+	}
+#endif
+	return p;
+}
+
 void process_sent_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *txring)
 {
 	XEmacPs_Bd *txbdset;
@@ -266,6 +462,18 @@ void process_sent_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *txring)
 			dsb();
 			p = (struct pbuf *)tx_pbufs_storage[index + bdindex];
 			if (p != NULL) {
+#if XLWIP_CONFIG_HW_TIMESTAMP
+				/*
+				 * the event registers hold the last PTP event frame
+				 * sent, a sender keeping a reference reads it here
+				 */
+				if (emacps_is_ptp_event(p)) {
+					emacps_get_ts(xemacpsif->emacps.Config.BaseAddress,
+						      XEMACPS_PTP_TXSEC_OFFSET,
+						      XEMACPS_PTP_TXNANOSEC_OFFSET,
+						      &p->ts_sec, &p->ts_nsec);
+				}
+#endif
 				pbuf_free(p);
 			}
 #if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
@@ -306,15 +514,21 @@ void emacps_send_handler(void *arg)
 	xInsideISR--;
 #endif
 }
+/*
+ * emacps_sgqueue():
+ *
+ * Hands the BDs of one frame to the GEM without starting the transmitter,
+ * so that several frames can be queued ahead of one emacps_tx_start().
+ */
 #if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
-XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p,
+XStatus emacps_sgqueue(xemacpsif_s *xemacpsif, struct pbuf *p,
 					u32_t block_till_tx_complete, u32_t *to_block_index)
 #else
-XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p)
+XStatus emacps_sgqueue(xemacpsif_s *xemacpsif, struct pbuf *p)
 #endif
 {
 	struct pbuf *q;
-	s32_t n_pbufs;
+	s32_t n_pbufs, k;
 	XEmacPs_Bd *txbdset, *txbd, *last_txbd = NULL;
 	XEmacPs_Bd *temp_txbd;
 	XStatus status;
@@ -333,9 +547,14 @@ XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p)
 	tx_task_notifier_index = get_base_index_tasknotifyinfo (xemacpsif);
 #endif
 
-	/* first count the number of pbufs */
-	for (q = p, n_pbufs = 0; q != NULL; q = q->next)
-		n_pbufs++;
+	/* first count the number of pbufs, empty ones need no BD */
+	for (q = p, n_pbufs = 0; q != NULL; q = q->next) {
+		if (q->len != 0)
+			n_pbufs++;
+	}
+	if (n_pbufs == 0) {
+		return XST_FAILURE;
+	}
 
 	/* obtain as many BD's */
 	status = XEmacPs_BdRingAlloc(txring, n_pbufs, &txbdset);
@@ -343,11 +562,23 @@ XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p)
 		LWIP_DEBUGF(NETIF_DEBUG, ("sgsend: Error allocating TxBD\r\n"));
 		return XST_FAILURE;
 	}
+	XNETIF_STATS_HIST(&xemacpsif->stats.tx_ring_used,
+			  XLWIP_CONFIG_N_TX_DESC - XEmacPs_BdRingGetFreeCnt(txring));
+
+#ifdef ZYNQMP_USE_JUMBO
+	max_fr_size = MAX_FRAME_SIZE_JUMBO - 18;
+#else
+	max_fr_size = XEMACPS_MAX_FRAME_SIZE - 18;
+#endif
 
 	for(q = p, txbd = txbdset; q != NULL; q = q->next) {
+		if (q->len == 0)
+			continue;
+
 		bdindex = XEMACPS_BD_TO_INDEX(txring, txbd);
 		if (tx_pbufs_storage[index + bdindex] != 0) {
 			LWIP_DEBUGF(NETIF_DEBUG, ("PBUFS not available\r\n"));
+			XEmacPs_BdRingUnAlloc(txring, n_pbufs, txbdset);
 			return XST_FAILURE;
 		}
 
@@ -360,23 +591,21 @@ XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p)
 
 		XEmacPs_BdSetAddressTx(txbd, (UINTPTR)q->payload);
 
-#ifdef ZYNQMP_USE_JUMBO
-		max_fr_size = MAX_FRAME_SIZE_JUMBO - 18;
-#else
-		max_fr_size = XEMACPS_MAX_FRAME_SIZE - 18;
-#endif
 		if (q->len > max_fr_size)
 			XEmacPs_BdSetLength(txbd, max_fr_size & 0x3FFF);
 		else
 			XEmacPs_BdSetLength(txbd, q->len & 0x3FFF);
 
-		tx_pbufs_storage[index + bdindex] = (UINTPTR)q;
-
-		pbuf_ref(q);
 		last_txbd = txbd;
 		XEmacPs_BdClearLast(txbd);
 		txbd = XEmacPs_BdRingNext(txring, txbd);
 	}
+
+	/* The whole chain is held by one reference on its head, kept with the
+	   last BD of the frame, so that it is freed once the frame is sent. */
+	bdindex = XEMACPS_BD_TO_INDEX(txring, last_txbd);
+	tx_pbufs_storage[index + bdindex] = (UINTPTR)p;
+	pbuf_ref(p);
 #if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
     if (block_till_tx_complete == 1) {
 		notifyinfo[tx_task_notifier_index + bdindex] = 1;
@@ -390,11 +619,9 @@ XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p)
 	   just remember the allocated BD. */
 	temp_txbd = txbdset;
 	txbd = txbdset;
-	txbd = XEmacPs_BdRingNext(txring, txbd);
-	q = p->next;
-	for(; q != NULL; q = q->next) {
-		XEmacPs_BdClearTxUsed(txbd);
+	for (k = 1; k < n_pbufs; k++) {
 		txbd = XEmacPs_BdRingNext(txring, txbd);
+		XEmacPs_BdClearTxUsed(txbd);
 	}
 	XEmacPs_BdClearTxUsed(temp_txbd);
 	dsb();
@@ -404,11 +631,37 @@ XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p)
 		LWIP_DEBUGF(NETIF_DEBUG, ("sgsend: Error submitting TxBD\r\n"));
 		return XST_FAILURE;
 	}
-	/* Start transmit */
+	return status;
+}
+
+/* Starts the transmitter on the frames queued with emacps_sgqueue() */
+void emacps_tx_start(xemacpsif_s *xemacpsif)
+{
 	XEmacPs_WriteReg((xemacpsif->emacps).Config.BaseAddress,
 	XEMACPS_NWCTRL_OFFSET,
 	(XEmacPs_ReadReg((xemacpsif->emacps).Config.BaseAddress,
 	XEMACPS_NWCTRL_OFFSET) | XEMACPS_NWCTRL_STARTTX_MASK));
+}
+
+#if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
+XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p,
+					u32_t block_till_tx_complete, u32_t *to_block_index)
+#else
+XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p)
+#endif
+{
+	XStatus status;
+
+#if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
+	status = emacps_sgqueue(xemacpsif, p, block_till_tx_complete,
+				to_block_index);
+#else
+	status = emacps_sgqueue(xemacpsif, p);
+#endif
+	if (status == XST_SUCCESS) {
+		/* Start transmit */
+		emacps_tx_start(xemacpsif);
+	}
 	return status;
 }
 
@@ -420,23 +673,20 @@ void setup_rx_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring)
 	u32_t freebds;
 	u32_t bdindex;
 	u32 *temp;
-	u32_t index;
+	UINTPTR *storage;
 
-	index = get_base_index_rxpbufsstorage (xemacpsif);
+	storage = rx_ring_storage(xemacpsif, rxring);
 
 	freebds = XEmacPs_BdRingGetFreeCnt (rxring);
 	while (freebds > 0) {
 		freebds--;
-#ifdef ZYNQMP_USE_JUMBO
-		p = pbuf_alloc(PBUF_RAW, MAX_FRAME_SIZE_JUMBO, PBUF_POOL);
-#else
-		p = pbuf_alloc(PBUF_RAW, XEMACPS_MAX_FRAME_SIZE, PBUF_POOL);
-#endif
+		p = rx_pbuf_alloc(xemacpsif);
 		if (!p) {
 #if LINK_STATS
 			lwip_stats.link.memerr++;
 			lwip_stats.link.drop++;
 #endif
+			XNETIF_STATS_RX_DROP(&xemacpsif->stats, XNETIF_RX_DROP_NO_PBUF);
 			xil_printf("unable to alloc pbuf in recv_handler\r\n");
 			return;
 		}
@@ -460,15 +710,6 @@ void setup_rx_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring)
 			XEmacPs_BdRingUnAlloc(rxring, 1, rxbd);
 			return;
 		}
-#ifdef ZYNQMP_USE_JUMBO
-		if (xemacpsif->emacps.Config.IsCacheCoherent == 0) {
-			Xil_DCacheInvalidateRange((UINTPTR)p->payload, (UINTPTR)MAX_FRAME_SIZE_JUMBO);
-		}
-#else
-		if (xemacpsif->emacps.Config.IsCacheCoherent == 0) {
-			Xil_DCacheInvalidateRange((UINTPTR)p->payload, (UINTPTR)XEMACPS_MAX_FRAME_SIZE);
-		}
-#endif
 		bdindex = XEMACPS_BD_TO_INDEX(rxring, rxbd);
 		temp = (u32 *)rxbd;
 		temp++;
@@ -488,55 +729,57 @@ void setup_rx_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring)
 			XEmacPs_BdWrite(rxbd, XEMACPS_BD_ADDR_OFFSET, (UINTPTR)p->payload);
 		}
 
-		rx_pbufs_storage[index + bdindex] = (UINTPTR)p;
+		storage[bdindex] = (UINTPTR)p;
 	}
 }
 
-void emacps_recv_handler(void *arg)
+/*
+ * emacps_rx_reap():
+ *
+ * Moves up to budget received frames from an RX ring to the receive
+ * queue and hands fresh pbufs to the freed BDs.
+ *
+ * Returns the number of BDs reaped.
+ */
+static u32_t emacps_rx_reap(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring,
+			    u32_t budget)
 {
 	struct pbuf *p;
 	XEmacPs_Bd *rxbdset, *curbdptr;
-	struct xemac_s *xemac;
-	xemacpsif_s *xemacpsif;
-	XEmacPs_BdRing *rxring;
 	volatile s32_t bd_processed;
 	s32_t rx_bytes, k;
 	u32_t bdindex;
-	u32_t regval;
-	u32_t index;
-	u32_t gigeversion;
-
-	xemac = (struct xemac_s *)(arg);
-	xemacpsif = (xemacpsif_s *)(xemac->state);
-	rxring = &XEmacPs_GetRxRing(&xemacpsif->emacps);
-
-#if !NO_SYS
-	xInsideISR++;
+	UINTPTR *storage;
+	u32_t limit;
+	u32_t reaped = 0;
+#if XLWIP_CONFIG_HW_TIMESTAMP
+	u32_t ts_sec, ts_nsec;
 #endif
 
-	gigeversion = ((Xil_In32(xemacpsif->emacps.Config.BaseAddress + 0xFC)) >> 16) & 0xFFF;
-	index = get_base_index_rxpbufsstorage (xemacpsif);
-	/*
-	 * If Reception done interrupt is asserted, call RX call back function
-	 * to handle the processed BDs and then raise the according flag.
-	 */
-	regval = XEmacPs_ReadReg(xemacpsif->emacps.Config.BaseAddress, XEMACPS_RXSR_OFFSET);
-	XEmacPs_WriteReg(xemacpsif->emacps.Config.BaseAddress, XEMACPS_RXSR_OFFSET, regval);
-	if (gigeversion <= 2) {
-			resetrx_on_no_rxdata(xemacpsif);
-	}
+	storage = rx_ring_storage(xemacpsif, rxring);
 
-	while(1) {
+	while (reaped < budget) {
 
-		bd_processed = XEmacPs_BdRingFromHwRx(rxring, XLWIP_CONFIG_N_RX_DESC, &rxbdset);
+		limit = budget - reaped;
+		if (limit > XLWIP_CONFIG_N_RX_DESC) {
+			limit = XLWIP_CONFIG_N_RX_DESC;
+		}
+		bd_processed = XEmacPs_BdRingFromHwRx(rxring, limit, &rxbdset);
 		if (bd_processed <= 0) {
 			break;
 		}
+		XNETIF_STATS_HIST(&xemacpsif->stats.rx_ring_used, bd_processed);
+#if XLWIP_CONFIG_HW_TIMESTAMP
+		/* frames other than PTP event ones get the time of the reap */
+		emacps_get_ts(xemacpsif->emacps.Config.BaseAddress,
+			      XEMACPS_1588_SEC_OFFSET, XEMACPS_1588_NANOSEC_OFFSET,
+			      &ts_sec, &ts_nsec);
+#endif
 
 		for (k = 0, curbdptr=rxbdset; k < bd_processed; k++) {
 
 			bdindex = XEMACPS_BD_TO_INDEX(rxring, curbdptr);
-			p = (struct pbuf *)rx_pbufs_storage[index + bdindex];
+			p = (struct pbuf *)storage[bdindex];
 
 			/*
 			 * Adjust the buffer size to the actual number of bytes received.
@@ -547,6 +790,9 @@ void emacps_recv_handler(void *arg)
 			rx_bytes = XEmacPs_BdGetLength(curbdptr);
 #endif
 			pbuf_realloc(p, rx_bytes);
+#if XLWIP_CONFIG_EMACPS_RX_POOL_SIZE
+			((rx_pool_buf_t *)p)->used_len = rx_bytes;
+#endif
 
 			/* Invalidate RX frame before queuing to handle
 			 * L1 cache prefetch conditions on any architecture.
@@ -555,6 +801,18 @@ void emacps_recv_handler(void *arg)
 				Xil_DCacheInvalidateRange((UINTPTR)p->payload, rx_bytes);
 			}
 
+#if XLWIP_CONFIG_HW_TIMESTAMP
+			if (emacps_is_ptp_event(p)) {
+				emacps_get_ts(xemacpsif->emacps.Config.BaseAddress,
+					      XEMACPS_PTP_RXSEC_OFFSET,
+					      XEMACPS_PTP_RXNANOSEC_OFFSET,
+					      &p->ts_sec, &p->ts_nsec);
+			} else {
+				p->ts_sec = ts_sec;
+				p->ts_nsec = ts_nsec;
+			}
+#endif
+
 			/* store it in the receive queue,
 			 * where it'll be processed by a different handler
 			 */
@@ -563,6 +821,8 @@ void emacps_recv_handler(void *arg)
 				lwip_stats.link.memerr++;
 				lwip_stats.link.drop++;
 #endif
+				XNETIF_STATS_RX_DROP(&xemacpsif->stats,
+						     XNETIF_RX_DROP_QUEUE_FULL);
 				pbuf_free(p);
 			}
 			curbdptr = XEmacPs_BdRingNext( rxring, curbdptr);
@@ -570,7 +830,57 @@ void emacps_recv_handler(void *arg)
 		/* free up the BD's */
 		XEmacPs_BdRingFree(rxring, bd_processed, rxbdset);
 		setup_rx_bds(xemacpsif, rxring);
+		reaped += (u32_t)bd_processed;
+	}
+
+	return reaped;
+}
+
+void emacps_recv_handler(void *arg)
+{
+	struct xemac_s *xemac;
+	xemacpsif_s *xemacpsif;
+	u32_t regval;
+	u32_t gigeversion;
+
+	xemac = (struct xemac_s *)(arg);
+	xemacpsif = (xemacpsif_s *)(xemac->state);
+
+#if !NO_SYS
+	xInsideISR++;
+#endif
+	XNETIF_STATS_RX_IRQ(&xemacpsif->stats);
+
+	gigeversion = ((Xil_In32(xemacpsif->emacps.Config.BaseAddress + 0xFC)) >> 16) & 0xFFF;
+	/*
+	 * If Reception done interrupt is asserted, call RX call back function
+	 * to handle the processed BDs and then raise the according flag.
+	 */
+	regval = XEmacPs_ReadReg(xemacpsif->emacps.Config.BaseAddress, XEMACPS_RXSR_OFFSET);
+	XEmacPs_WriteReg(xemacpsif->emacps.Config.BaseAddress, XEMACPS_RXSR_OFFSET, regval);
+	if (gigeversion <= 2) {
+			resetrx_on_no_rxdata(xemacpsif);
+	}
+
+#if XLWIP_CONFIG_EMACPS_RX_POLL_BUDGET
+	/*
+	 * Budgeted polling: leave the ring to emacps_rx_poll() and keep the
+	 * frame received interrupt masked until the ring is drained.
+	 */
+	XEmacPs_IntDisable(&xemacpsif->emacps, XEMACPS_IXR_FRAMERX_MASK);
+	xemacpsif->rx_poll_pending = 1;
+#else
+#if XLWIP_CONFIG_EMACPS_RX_Q1
+	/* Priority frames are queued ahead of the ones of queue 0 */
+	if (xemacpsif->rxq1_active != 0) {
+		(void)emacps_rx_reap(xemacpsif, &xemacpsif->rxq1_ring,
+				     0xFFFFFFFFU);
 	}
+#endif
+	(void)emacps_rx_reap(xemacpsif, &XEmacPs_GetRxRing(&xemacpsif->emacps),
+			     0xFFFFFFFFU);
+#endif
+
 #if !NO_SYS
 	sys_sem_signal(&xemac->sem_rx_data_available);
 	xInsideISR--;
@@ -579,6 +889,84 @@ void emacps_recv_handler(void *arg)
 	return;
 }
 
+#if XLWIP_CONFIG_EMACPS_RX_Q1
+/*
+ * emacps_recv_q1_handler():
+ *
+ * RX handler of priority queue 1, the screeners steer frames to it.
+ */
+void emacps_recv_q1_handler(void *arg)
+{
+	struct xemac_s *xemac;
+	xemacpsif_s *xemacpsif;
+
+	xemac = (struct xemac_s *)(arg);
+	xemacpsif = (xemacpsif_s *)(xemac->state);
+
+#if !NO_SYS
+	xInsideISR++;
+#endif
+	XNETIF_STATS_RX_IRQ(&xemacpsif->stats);
+
+#if XLWIP_CONFIG_EMACPS_RX_POLL_BUDGET
+	XEmacPs_IntQ1Disable(&xemacpsif->emacps, XEMACPS_INTQ1_IXR_RX_MASK);
+	xemacpsif->rx_poll_pending = 1;
+#else
+	(void)emacps_rx_reap(xemacpsif, &xemacpsif->rxq1_ring, 0xFFFFFFFFU);
+#endif
+
+#if !NO_SYS
+	sys_sem_signal(&xemac->sem_rx_data_available);
+	xInsideISR--;
+#endif
+}
+#endif
+
+/*
+ * emacps_rx_poll():
+ *
+ * Reaps up to budget RX BDs after emacps_recv_handler() masked the frame
+ * received interrupt, and unmasks it once the rings are empty. A frame that
+ * completes in between still latches in the interrupt status register and
+ * raises the interrupt when it is unmasked.
+ *
+ * Must be called with interrupts of the EMAC disabled.
+ *
+ * Returns the number of BDs reaped.
+ */
+s32_t emacps_rx_poll(struct xemac_s *xemac, u32_t budget)
+{
+	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
+	u32_t reaped;
+
+	if (xemacpsif->rx_poll_pending == 0) {
+		return 0;
+	}
+
+	reaped = 0;
+#if XLWIP_CONFIG_EMACPS_RX_Q1
+	/* Priority queue 1 takes the budget first */
+	if (xemacpsif->rxq1_active != 0) {
+		reaped = emacps_rx_reap(xemacpsif, &xemacpsif->rxq1_ring, budget);
+	}
+#endif
+	reaped += emacps_rx_reap(xemacpsif,
+				 &XEmacPs_GetRxRing(&xemacpsif->emacps),
+				 budget - reaped);
+	if (reaped < budget) {
+		xemacpsif->rx_poll_pending = 0;
+		XEmacPs_IntEnable(&xemacpsif->emacps, XEMACPS_IXR_FRAMERX_MASK);
+#if XLWIP_CONFIG_EMACPS_RX_Q1
+		if (xemacpsif->rxq1_active != 0) {
+			XEmacPs_IntQ1Enable(&xemacpsif->emacps,
+					    XEMACPS_INTQ1_IXR_RX_MASK);
+		}
+#endif
+	}
+
+	return (s32_t)reaped;
+}
+
 void clean_dma_txdescs(struct xemac_s *xemac)
 {
 	XEmacPs_Bd bdtemplate;
@@ -599,26 +987,110 @@ void clean_dma_txdescs(struct xemac_s *xemac)
 	XEmacPs_BdRingClone(txringptr, &bdtemplate, XEMACPS_SEND);
 }
 
-XStatus init_dma(struct xemac_s *xemac)
+/*
+ * init_rx_ring():
+ *
+ * Creates an RX BD ring in bdspace and hands a pbuf to each of its BDs.
+ */
+static XStatus init_rx_ring(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxringptr,
+			    void *bdspace)
 {
 	XEmacPs_Bd bdtemplate;
-	XEmacPs_BdRing *rxringptr, *txringptr;
 	XEmacPs_Bd *rxbd;
 	struct pbuf *p;
 	XStatus status;
 	s32_t i;
 	u32_t bdindex;
+	UINTPTR *storage;
+	u32 *temp;
+
+	/*
+	 * Setup RxBD space.
+	 *
+	 * Setup a BD template for the Rx channel. This template will be copied to
+	 * every RxBD. We will not have to explicitly set these again.
+	 */
+	XEmacPs_BdClear(&bdtemplate);
+
+	/*
+	 * Create the RxBD ring
+	 */
+
+	status = XEmacPs_BdRingCreate(rxringptr, (UINTPTR) bdspace,
+				(UINTPTR) bdspace, BD_ALIGNMENT,
+				     XLWIP_CONFIG_N_RX_DESC);
+
+	if (status != XST_SUCCESS) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("Error setting up RxBD space\r\n"));
+		return XST_FAILURE;
+	}
+
+	status = XEmacPs_BdRingClone(rxringptr, &bdtemplate, XEMACPS_RECV);
+	if (status != XST_SUCCESS) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("Error initializing RxBD space\r\n"));
+		return XST_FAILURE;
+	}
+
+	storage = rx_ring_storage(xemacpsif, rxringptr);
+
+	/*
+	 * Allocate RX descriptors, 1 RxBD at a time.
+	 */
+	for (i = 0; i < XLWIP_CONFIG_N_RX_DESC; i++) {
+		p = rx_pbuf_alloc(xemacpsif);
+		if (!p) {
+#if LINK_STATS
+			lwip_stats.link.memerr++;
+			lwip_stats.link.drop++;
+#endif
+			xil_printf("unable to alloc pbuf in init_dma\r\n");
+			return XST_FAILURE;
+		}
+		status = XEmacPs_BdRingAlloc(rxringptr, 1, &rxbd);
+		if (status != XST_SUCCESS) {
+			LWIP_DEBUGF(NETIF_DEBUG, ("init_dma: Error allocating RxBD\r\n"));
+			pbuf_free(p);
+			return XST_FAILURE;
+		}
+		/* Enqueue to HW */
+		status = XEmacPs_BdRingToHw(rxringptr, 1, rxbd);
+		if (status != XST_SUCCESS) {
+			LWIP_DEBUGF(NETIF_DEBUG, ("Error: committing RxBD to HW\r\n"));
+			pbuf_free(p);
+			XEmacPs_BdRingUnAlloc(rxringptr, 1, rxbd);
+			return XST_FAILURE;
+		}
+
+		bdindex = XEMACPS_BD_TO_INDEX(rxringptr, rxbd);
+		temp = (u32 *)rxbd;
+		*temp = 0;
+		if (bdindex == (XLWIP_CONFIG_N_RX_DESC - 1)) {
+			*temp = 0x00000002;
+		}
+		temp++;
+		*temp = 0;
+		dsb();
+		XEmacPs_BdSetAddressRx(rxbd, (UINTPTR)p->payload);
+
+		storage[bdindex] = (UINTPTR)p;
+	}
+
+	return XST_SUCCESS;
+}
+
+XStatus init_dma(struct xemac_s *xemac)
+{
+	XEmacPs_Bd bdtemplate;
+	XEmacPs_BdRing *rxringptr, *txringptr;
+	XStatus status;
 	volatile UINTPTR tempaddress;
-	u32_t index;
 	u32_t gigeversion;
 	XEmacPs_Bd *bdtxterminate = NULL;
 	XEmacPs_Bd *bdrxterminate = NULL;
-	u32 *temp;
 
 	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
 	struct xtopology_t *xtopologyp = &xtopology[xemac->topology_index];
 
-	index = get_base_index_rxpbufsstorage (xemacpsif);
 	gigeversion = ((Xil_In32(xemacpsif->emacps.Config.BaseAddress + 0xFC)) >> 16) & 0xFFF;
 	/*
 	 * The BDs need to be allocated in uncached memory. Hence the 1 MB
@@ -670,33 +1142,6 @@ XStatus init_dma(struct xemac_s *xemac)
 		return ERR_IF;
 	}
 
-	/*
-	 * Setup RxBD space.
-	 *
-	 * Setup a BD template for the Rx channel. This template will be copied to
-	 * every RxBD. We will not have to explicitly set these again.
-	 */
-	XEmacPs_BdClear(&bdtemplate);
-
-	/*
-	 * Create the RxBD ring
-	 */
-
-	status = XEmacPs_BdRingCreate(rxringptr, (UINTPTR) xemacpsif->rx_bdspace,
-				(UINTPTR) xemacpsif->rx_bdspace, BD_ALIGNMENT,
-				     XLWIP_CONFIG_N_RX_DESC);
-
-	if (status != XST_SUCCESS) {
-		LWIP_DEBUGF(NETIF_DEBUG, ("Error setting up RxBD space\r\n"));
-		return ERR_IF;
-	}
-
-	status = XEmacPs_BdRingClone(rxringptr, &bdtemplate, XEMACPS_RECV);
-	if (status != XST_SUCCESS) {
-		LWIP_DEBUGF(NETIF_DEBUG, ("Error initializing RxBD space\r\n"));
-		return ERR_IF;
-	}
-
 	XEmacPs_BdClear(&bdtemplate);
 	XEmacPs_BdSetStatus(&bdtemplate, XEMACPS_TXBUF_USED_MASK);
 	/*
@@ -716,60 +1161,26 @@ XStatus init_dma(struct xemac_s *xemac)
 		return ERR_IF;
 	}
 
-	/*
-	 * Allocate RX descriptors, 1 RxBD at a time.
-	 */
-	for (i = 0; i < XLWIP_CONFIG_N_RX_DESC; i++) {
-#ifdef ZYNQMP_USE_JUMBO
-		p = pbuf_alloc(PBUF_RAW, MAX_FRAME_SIZE_JUMBO, PBUF_POOL);
-#else
-		p = pbuf_alloc(PBUF_RAW, XEMACPS_MAX_FRAME_SIZE, PBUF_POOL);
-#endif
-		if (!p) {
-#if LINK_STATS
-			lwip_stats.link.memerr++;
-			lwip_stats.link.drop++;
+#if XLWIP_CONFIG_EMACPS_RX_POOL_SIZE
+	rx_pool_init(xemacpsif);
 #endif
-			xil_printf("unable to alloc pbuf in init_dma\r\n");
-			return ERR_IF;
-		}
-		status = XEmacPs_BdRingAlloc(rxringptr, 1, &rxbd);
-		if (status != XST_SUCCESS) {
-			LWIP_DEBUGF(NETIF_DEBUG, ("init_dma: Error allocating RxBD\r\n"));
-			pbuf_free(p);
-			return ERR_IF;
-		}
-		/* Enqueue to HW */
-		status = XEmacPs_BdRingToHw(rxringptr, 1, rxbd);
+	status = init_rx_ring(xemacpsif, rxringptr, xemacpsif->rx_bdspace);
+	if (status != XST_SUCCESS) {
+		return ERR_IF;
+	}
+#if XLWIP_CONFIG_EMACPS_RX_Q1
+	xemacpsif->rxq1_active = 0;
+	if (gigeversion > 2) {
+		/* Queue 1 takes the BD space of the parked RX queues */
+		xemacpsif->rxq1_bdspace = (void *)bdrxterminate;
+		status = init_rx_ring(xemacpsif, &xemacpsif->rxq1_ring,
+				      xemacpsif->rxq1_bdspace);
 		if (status != XST_SUCCESS) {
-			LWIP_DEBUGF(NETIF_DEBUG, ("Error: committing RxBD to HW\r\n"));
-			pbuf_free(p);
-			XEmacPs_BdRingUnAlloc(rxringptr, 1, rxbd);
 			return ERR_IF;
 		}
-
-		bdindex = XEMACPS_BD_TO_INDEX(rxringptr, rxbd);
-		temp = (u32 *)rxbd;
-		*temp = 0;
-		if (bdindex == (XLWIP_CONFIG_N_RX_DESC - 1)) {
-			*temp = 0x00000002;
-		}
-		temp++;
-		*temp = 0;
-		dsb();
-#ifdef ZYNQMP_USE_JUMBO
-		if (xemacpsif->emacps.Config.IsCacheCoherent == 0) {
-			Xil_DCacheInvalidateRange((UINTPTR)p->payload, (UINTPTR)MAX_FRAME_SIZE_JUMBO);
-		}
-#else
-		if (xemacpsif->emacps.Config.IsCacheCoherent == 0) {
-			Xil_DCacheInvalidateRange((UINTPTR)p->payload, (UINTPTR)XEMACPS_MAX_FRAME_SIZE);
-		}
-#endif
-		XEmacPs_BdSetAddressRx(rxbd, (UINTPTR)p->payload);
-
-		rx_pbufs_storage[index + bdindex] = (UINTPTR)p;
+		xemacpsif->rxq1_active = 1;
 	}
+#endif
 	XEmacPs_SetQueuePtr(&(xemacpsif->emacps), xemacpsif->emacps.RxBdRing.BaseBdAddr, 0, XEMACPS_RECV);
 	if (gigeversion > 2) {
 		XEmacPs_SetQueuePtr(&(xemacpsif->emacps), xemacpsif->emacps.TxBdRing.BaseBdAddr, 1, XEMACPS_SEND);
@@ -786,11 +1197,29 @@ XStatus init_dma(struct xemac_s *xemac)
 		 * the controller to malfunction by fetching the descriptors
 		 * from these queues.
 		 */
+#if XLWIP_CONFIG_EMACPS_RX_Q1
+		if (xemacpsif->rxq1_active != 0) {
+			/* RX queue 1 is in use and is not parked */
+			XEmacPs_SetQueuePtr(&(xemacpsif->emacps),
+					    xemacpsif->rxq1_ring.BaseBdAddr, 1,
+					    XEMACPS_RECV);
+			XEmacPs_WriteReg(xemacpsif->emacps.Config.BaseAddress,
+					 XEMACPS_RXQ1BUFSIZE_OFFSET,
+					 (RX_FRAME_SIZE + 63) / 64);
+		} else {
+			XEmacPs_BdClear(bdrxterminate);
+			XEmacPs_BdSetAddressRx(bdrxterminate, (XEMACPS_RXBUF_NEW_MASK |
+							XEMACPS_RXBUF_WRAP_MASK));
+			XEmacPs_Out32((xemacpsif->emacps.Config.BaseAddress + XEMACPS_RXQ1BASE_OFFSET),
+					   (UINTPTR)bdrxterminate);
+		}
+#else
 		XEmacPs_BdClear(bdrxterminate);
 		XEmacPs_BdSetAddressRx(bdrxterminate, (XEMACPS_RXBUF_NEW_MASK |
 						XEMACPS_RXBUF_WRAP_MASK));
 		XEmacPs_Out32((xemacpsif->emacps.Config.BaseAddress + XEMACPS_RXQ1BASE_OFFSET),
 				   (UINTPTR)bdrxterminate);
+#endif
 		XEmacPs_BdClear(bdtxterminate);
 		XEmacPs_BdSetStatus(bdtxterminate, (XEMACPS_TXBUF_USED_MASK |
 						XEMACPS_TXBUF_WRAP_MASK));
@@ -878,6 +1307,14 @@ void free_txrx_pbufs(xemacpsif_s *xemacpsif)
 		pbuf_free(p);
 
 	}
+#if XLWIP_CONFIG_EMACPS_RX_Q1
+	if (xemacpsif->rxq1_active != 0) {
+		for (index = index1; index < (index1 + XLWIP_CONFIG_N_RX_DESC); index++) {
+			p = (struct pbuf *)rx_q1_pbufs_storage[index];
+			pbuf_free(p);
+		}
+	}
+#endif
 }
 
 void free_onlytx_pbufs(xemacpsif_s *xemacpsif)
@@ -917,6 +1354,12 @@ void reset_dma(struct xemac_s *xemac)
 
 	XEmacPs_SetQueuePtr(&(xemacpsif->emacps), xemacpsif->emacps.RxBdRing.BaseBdAddr, 0, XEMACPS_RECV);
 	XEmacPs_SetQueuePtr(&(xemacpsif->emacps), xemacpsif->emacps.TxBdRing.BaseBdAddr, txqueuenum, XEMACPS_SEND);
+#if XLWIP_CONFIG_EMACPS_RX_Q1
+	if (xemacpsif->rxq1_active != 0) {
+		XEmacPs_BdRingPtrReset(&xemacpsif->rxq1_ring, xemacpsif->rxq1_bdspace);
+		XEmacPs_SetQueuePtr(&(xemacpsif->emacps), xemacpsif->rxq1_ring.BaseBdAddr, 1, XEMACPS_RECV);
+	}
+#endif
 }
 
 void emac_disable_intr(void)
@@ -190,12 +190,25 @@ void setup_isr (struct xemac_s *xemac)
 	XEmacPs_SetHandler(&xemacpsif->emacps, XEMACPS_HANDLER_ERROR,
 				    (void *) emacps_error_handler,
 				    (void *) xemac);
+
+#if XLWIP_CONFIG_EMACPS_RX_Q1
+	/* GEM with priority queues receives screener steered frames on queue 1 */
+	if (xemacpsif->emacps.Version > 2) {
+		XEmacPs_SetHandler(&xemacpsif->emacps, XEMACPS_HANDLER_DMARECV_Q1,
+					    (void *) emacps_recv_q1_handler,
+					    (void *) xemac);
+	}
+#endif
 }
 
 void start_emacps (xemacpsif_s *xemacps)
 {
 	/* start the temac */
 	XEmacPs_Start(&xemacps->emacps);
+#if XLWIP_CONFIG_TX_RECLAIM_WATERMARK
+	/* sent BDs are reclaimed by the TX path, see xemacif_tx_reclaim() */
+	XEmacPs_IntDisable(&xemacps->emacps, XEMACPS_IXR_TXCOMPL_MASK);
+#endif
 }
 
 void restart_emacps_transmitter (xemacpsif_s *xemacps) {
@@ -0,0 +1,536 @@
+/*
+ * Copyright (C) 2026 Xilinx, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ * SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+ * OF SUCH DAMAGE.
+ *
+ * This file is part of the lwIP TCP/IP stack.
+ *
+ */
+
+/*
+ * Zero copy UDP streams on the GEM, for fixed size datagram streams that do
+ * not need the sockets or the raw UDP API.
+ *
+ * Received IPv4 datagrams for the local port of an open stream are taken
+ * off the input path before lwIP sees them, and are handed to the
+ * application as slots pointing into the RX DMA buffers. A slot returns its
+ * buffer to the netif when it is released.
+ *
+ * For sending, a stream owns XLWIP_CONFIG_N_TX_DESC frame sized DMA buffers.
+ * The application fills the payload of the slots it allocated, and
+ * xemacpsif_udps_send() prepends the headers and queues all of them ahead
+ * of a single start of the transmitter. The buffers return to the stream
+ * once sent.
+ *
+ * Datagrams are not fragmented. Without RX checksum offload, the IPv4 and
+ * UDP checksums are checked in software; without TX checksum offload the
+ * UDP checksum of sent datagrams is 0.
+ *
+ * The functions follow the rules of the raw API: call them from the
+ * context that runs lwIP.
+ */
+
+#include <string.h>
+
+#include "lwipopts.h"
+#include "lwip/sys.h"
+#include "lwip/stats.h"
+#include "lwip/inet_chksum.h"
+#include "lwip/etharp.h"
+#include "lwip/prot/ip4.h"
+#include "lwip/prot/udp.h"
+
+#include "netif/xadapter.h"
+#include "netif/xemacpsif.h"
+
+#if XLWIP_CONFIG_EMACPS_UDP_STREAM
+
+#define UDPS_BUF_ALIGNMENT	64
+#define UDPS_BUF_SIZE		((XEMACPS_MAX_FRAME_SIZE + UDPS_BUF_ALIGNMENT - 1) & \
+				 ~(UDPS_BUF_ALIGNMENT - 1))
+#define UDPS_TTL		64
+
+typedef struct udps_tx_buf {
+	struct pbuf_custom pc;
+	struct udps_tx_buf *next;
+	struct xemacpsif_udps *stream;
+	u8_t payload[UDPS_BUF_SIZE] __attribute__ ((aligned (UDPS_BUF_ALIGNMENT)));
+} udps_tx_buf_t;
+
+struct xemacpsif_udps {
+	struct netif *netif;
+	u16_t local_port;
+	u16_t remote_port;
+	ip4_addr_t remote_ip;
+	u8_t remote_mac_valid;
+	u8_t tx_enabled;
+	u16_t ip_id;
+	u8_t hdr[XEMACPSIF_UDPS_HDR_SIZE];
+
+	/* filled by the input path, emptied by xemacpsif_udps_recv() */
+	Xil_Ring rx_ring;
+	struct pbuf *rx_data[XEMACPSIF_UDPS_RX_SLOTS];
+	u32_t rx_drops;
+
+	udps_tx_buf_t *tx_free;
+	u32_t tx_owned;
+	udps_tx_buf_t tx_buf[XLWIP_CONFIG_N_TX_DESC];
+};
+
+static struct xemacpsif_udps udps[XEMACPSIF_UDPS_MAX_STREAMS];
+static u32_t udps_open_cnt;
+
+/*
+ * Returns a TX buffer to its stream once the GEM sent it, called by lwIP
+ * when the last reference to the pbuf goes.
+ */
+static void udps_tx_buf_free(struct pbuf *p)
+{
+	udps_tx_buf_t *buf = (udps_tx_buf_t *)p;
+	struct xemacpsif_udps *s = buf->stream;
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	SYS_ARCH_PROTECT(lev);
+	buf->next = s->tx_free;
+	s->tx_free = buf;
+	s->tx_owned--;
+	SYS_ARCH_UNPROTECT(lev);
+}
+
+/* Builds the Ethernet, IPv4 and UDP headers shared by the datagrams sent */
+static void udps_build_hdr(struct xemacpsif_udps *s, const u8_t *remote_mac)
+{
+	struct eth_hdr *ethhdr = (struct eth_hdr *)s->hdr;
+	struct ip_hdr *iphdr = (struct ip_hdr *)(s->hdr + SIZEOF_ETH_HDR);
+	struct udp_hdr *udphdr = (struct udp_hdr *)(s->hdr + SIZEOF_ETH_HDR +
+						    IP_HLEN);
+
+	memcpy(&ethhdr->dest, remote_mac, ETH_HWADDR_LEN);
+	memcpy(&ethhdr->src, s->netif->hwaddr, ETH_HWADDR_LEN);
+	ethhdr->type = PP_HTONS(ETHTYPE_IP);
+
+	IPH_VHL_SET(iphdr, 4, IP_HLEN / 4);
+	IPH_TOS_SET(iphdr, 0);
+	IPH_LEN_SET(iphdr, 0);
+	IPH_ID_SET(iphdr, 0);
+	IPH_OFFSET_SET(iphdr, PP_HTONS(IP_DF));
+	IPH_TTL_SET(iphdr, UDPS_TTL);
+	IPH_PROTO_SET(iphdr, IP_PROTO_UDP);
+	IPH_CHKSUM_SET(iphdr, 0);
+	ip4_addr_copy(iphdr->src, *netif_ip4_addr(s->netif));
+	ip4_addr_copy(iphdr->dest, s->remote_ip);
+
+	udphdr->src = lwip_htons(s->local_port);
+	udphdr->dest = lwip_htons(s->remote_port);
+	udphdr->len = 0;
+	udphdr->chksum = 0;
+
+	s->remote_mac_valid = 1;
+}
+
+/*
+ * Looks the remote address up in the ARP cache, and starts resolving it if
+ * it is not there yet.
+ */
+static err_t udps_resolve(struct xemacpsif_udps *s)
+{
+	struct eth_addr *eth_ret;
+	const ip4_addr_t *ip_ret;
+
+	if (etharp_find_addr(s->netif, &s->remote_ip, &eth_ret, &ip_ret) >= 0) {
+		udps_build_hdr(s, eth_ret->addr);
+		return ERR_OK;
+	}
+
+	(void)etharp_query(s->netif, &s->remote_ip, NULL);
+	return ERR_INPROGRESS;
+}
+
+/*
+ * xemacpsif_udps_open():
+ *
+ * Opens a stream receiving the datagrams for local_port of netif. With a
+ * remote_ip the stream also sends to remote_ip and remote_port.
+ *
+ * Returns the stream, or NULL if all are in use or the port has a stream.
+ */
+xemacpsif_udps_t *xemacpsif_udps_open(struct netif *netif, u16_t local_port,
+				      const ip4_addr_t *remote_ip,
+				      u16_t remote_port)
+{
+	struct xemacpsif_udps *s = NULL;
+	u32_t i;
+
+	for (i = 0; i < XEMACPSIF_UDPS_MAX_STREAMS; i++) {
+		if (udps[i].netif == NULL) {
+			if (s == NULL) {
+				s = &udps[i];
+			}
+		} else if ((udps[i].netif == netif) &&
+			   (udps[i].local_port == local_port)) {
+			return NULL;
+		}
+	}
+	if (s == NULL) {
+		return NULL;
+	}
+
+	memset(s, 0, sizeof(*s));
+	s->local_port = local_port;
+	(void)Xil_RingInit(&s->rx_ring, s->rx_data, XEMACPSIF_UDPS_RX_SLOTS,
+			   sizeof(struct pbuf *));
+
+	if (remote_ip != NULL) {
+		ip4_addr_copy(s->remote_ip, *remote_ip);
+		s->remote_port = remote_port;
+		s->tx_enabled = 1;
+		for (i = 0; i < XLWIP_CONFIG_N_TX_DESC; i++) {
+			s->tx_buf[i].pc.custom_free_function = udps_tx_buf_free;
+			s->tx_buf[i].stream = s;
+			s->tx_buf[i].next = s->tx_free;
+			s->tx_free = &s->tx_buf[i];
+		}
+	}
+
+	/* the input path sees the stream once netif is set */
+	s->netif = netif;
+	udps_open_cnt++;
+	if (s->tx_enabled != 0) {
+		(void)udps_resolve(s);
+	}
+
+	return s;
+}
+
+/*
+ * xemacpsif_udps_close():
+ *
+ * Closes a stream and frees the datagrams it still holds.
+ *
+ * Returns XST_SUCCESS, or XST_DEVICE_BUSY while TX slots are allocated
+ * or in flight.
+ */
+s32_t xemacpsif_udps_close(xemacpsif_udps_t *s)
+{
+	struct pbuf *p;
+
+	if (s->tx_owned != 0) {
+		return XST_DEVICE_BUSY;
+	}
+
+	s->netif = NULL;
+	udps_open_cnt--;
+	while (Xil_RingPop(&s->rx_ring, &p) == XST_SUCCESS) {
+		pbuf_free(p);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*
+ * xemacpsif_udps_input():
+ *
+ * Called by the input path for every received frame. Takes the frame if it
+ * is an unfragmented IPv4 datagram for a stream of netif.
+ *
+ * Returns 1 if the frame was taken, 0 to pass it to lwIP.
+ */
+int xemacpsif_udps_input(struct netif *netif, struct pbuf *p)
+{
+	struct eth_hdr *ethhdr = (struct eth_hdr *)p->payload;
+	struct ip_hdr *iphdr;
+	struct udp_hdr *udphdr;
+	struct xemacpsif_udps *s = NULL;
+	u16_t iphdr_len, udp_len, port;
+	u32_t i;
+
+	if ((udps_open_cnt == 0) || (p->next != NULL) ||
+	    (p->len < SIZEOF_ETH_HDR + IP_HLEN + UDP_HLEN) ||
+	    (ethhdr->type != PP_HTONS(ETHTYPE_IP))) {
+		return 0;
+	}
+
+	iphdr = (struct ip_hdr *)((u8_t *)p->payload + SIZEOF_ETH_HDR);
+	iphdr_len = IPH_HL_BYTES(iphdr);
+	if ((IPH_V(iphdr) != 4) || (IPH_PROTO(iphdr) != IP_PROTO_UDP) ||
+	    (iphdr_len < IP_HLEN) ||
+	    ((IPH_OFFSET(iphdr) & PP_HTONS(IP_OFFMASK | IP_MF)) != 0) ||
+	    (p->len < SIZEOF_ETH_HDR + iphdr_len + UDP_HLEN) ||
+	    !ip4_addr_cmp(&iphdr->dest, netif_ip4_addr(netif))) {
+		return 0;
+	}
+
+	udphdr = (struct udp_hdr *)((u8_t *)iphdr + iphdr_len);
+	port = lwip_ntohs(udphdr->dest);
+	for (i = 0; i < XEMACPSIF_UDPS_MAX_STREAMS; i++) {
+		if ((udps[i].netif == netif) && (udps[i].local_port == port)) {
+			s = &udps[i];
+			break;
+		}
+	}
+	if (s == NULL) {
+		return 0;
+	}
+
+	udp_len = lwip_ntohs(udphdr->len);
+	if ((udp_len < UDP_HLEN) ||
+	    (SIZEOF_ETH_HDR + iphdr_len + udp_len > p->len)) {
+		/* lwIP drops and accounts the malformed datagram */
+		return 0;
+	}
+
+#if CHECKSUM_CHECK_IP
+	if (inet_chksum(iphdr, iphdr_len) != 0) {
+		return 0;
+	}
+#endif
+#if CHECKSUM_CHECK_UDP
+	if (udphdr->chksum != 0) {
+		ip4_addr_t src, dest;
+		u16_t chksum;
+
+		ip4_addr_copy(src, iphdr->src);
+		ip4_addr_copy(dest, iphdr->dest);
+		/* drop the Ethernet padding of short frames for the sum */
+		pbuf_realloc(p, SIZEOF_ETH_HDR + iphdr_len + udp_len);
+		(void)pbuf_remove_header(p, SIZEOF_ETH_HDR + iphdr_len);
+		chksum = inet_chksum_pseudo(p, IP_PROTO_UDP, udp_len, &src, &dest);
+		(void)pbuf_add_header(p, SIZEOF_ETH_HDR + iphdr_len);
+		if (chksum != 0) {
+			return 0;
+		}
+	}
+#endif
+
+	if (Xil_RingPush(&s->rx_ring, &p) != XST_SUCCESS) {
+		s->rx_drops++;
+		pbuf_free(p);
+	}
+
+	return 1;
+}
+
+/*
+ * xemacpsif_udps_recv():
+ *
+ * Takes up to n received datagrams of a stream. Each slot holds its RX
+ * buffer until it is passed to xemacpsif_udps_release().
+ *
+ * Returns the number of slots filled.
+ */
+int xemacpsif_udps_recv(xemacpsif_udps_t *s, xemacpsif_udps_slot_t *slots,
+			int n)
+{
+	struct pbuf *p[PQ_BULK_SIZE];
+	struct ip_hdr *iphdr;
+	struct udp_hdr *udphdr;
+	int done = 0;
+	int cnt, i;
+
+	while (done < n) {
+		cnt = n - done;
+		if (cnt > PQ_BULK_SIZE) {
+			cnt = PQ_BULK_SIZE;
+		}
+		cnt = (int)Xil_RingDequeueBulk(&s->rx_ring, p, (u32)cnt);
+		if (cnt == 0) {
+			break;
+		}
+
+		for (i = 0; i < cnt; i++) {
+			/* the input path checked the headers */
+			iphdr = (struct ip_hdr *)((u8_t *)p[i]->payload +
+						  SIZEOF_ETH_HDR);
+			udphdr = (struct udp_hdr *)((u8_t *)iphdr +
+						    IPH_HL_BYTES(iphdr));
+			slots[done].p = p[i];
+			slots[done].data = (u8_t *)udphdr + UDP_HLEN;
+			slots[done].len = lwip_ntohs(udphdr->len) - UDP_HLEN;
+			done++;
+		}
+	}
+
+	return done;
+}
+
+/*
+ * xemacpsif_udps_release():
+ *
+ * Returns the buffers of n received slots to the netif.
+ */
+void xemacpsif_udps_release(xemacpsif_udps_slot_t *slots, int n)
+{
+	int i;
+
+	for (i = 0; i < n; i++) {
+		pbuf_free(slots[i].p);
+		slots[i].p = NULL;
+	}
+}
+
+/*
+ * xemacpsif_udps_tx_alloc():
+ *
+ * Allocates up to n TX slots of a stream, with room for
+ * XEMACPSIF_UDPS_MAX_PAYLOAD bytes each. Set the len of a slot to the
+ * payload written before sending it.
+ *
+ * Returns the number of slots allocated.
+ */
+int xemacpsif_udps_tx_alloc(xemacpsif_udps_t *s, xemacpsif_udps_slot_t *slots,
+			    int n)
+{
+	udps_tx_buf_t *buf;
+	int i;
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	if (s->tx_enabled == 0) {
+		return 0;
+	}
+
+	for (i = 0; i < n; i++) {
+		SYS_ARCH_PROTECT(lev);
+#if XLWIP_CONFIG_TX_RECLAIM_WATERMARK
+		if (s->tx_free == NULL) {
+			/* the buffers return once their BDs are reclaimed */
+			struct xemac_s *xemac = (struct xemac_s *)(s->netif->state);
+			xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
+
+			process_sent_bds(xemacpsif,
+					 &(XEmacPs_GetTxRing(&xemacpsif->emacps)));
+		}
+#endif
+		buf = s->tx_free;
+		if (buf != NULL) {
+			s->tx_free = buf->next;
+			s->tx_owned++;
+		}
+		SYS_ARCH_UNPROTECT(lev);
+
+		if (buf == NULL) {
+			break;
+		}
+
+		slots[i].p = pbuf_alloced_custom(PBUF_RAW,
+				XEMACPSIF_UDPS_HDR_SIZE + XEMACPSIF_UDPS_MAX_PAYLOAD,
+				PBUF_REF, &buf->pc, buf->payload, UDPS_BUF_SIZE);
+		slots[i].data = buf->payload + XEMACPSIF_UDPS_HDR_SIZE;
+		slots[i].len = XEMACPSIF_UDPS_MAX_PAYLOAD;
+	}
+
+	return i;
+}
+
+/*
+ * xemacpsif_udps_send():
+ *
+ * Sends n TX slots of a stream, in order, and starts the transmitter once
+ * for all of them. The slots that were sent are no longer owned by the
+ * application; the others, beyond a full TX ring, can be sent again.
+ *
+ * Returns the number of slots sent, 0 while the remote address is being
+ * resolved.
+ */
+int xemacpsif_udps_send(xemacpsif_udps_t *s, xemacpsif_udps_slot_t *slots,
+			int n)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(s->netif->state);
+	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
+	struct ip_hdr *iphdr;
+	struct udp_hdr *udphdr;
+	struct pbuf *p;
+	u16_t len;
+	int sent;
+#if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
+	u32_t to_block_index;
+#endif
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	if ((s->tx_enabled == 0) ||
+	    ((s->remote_mac_valid == 0) && (udps_resolve(s) != ERR_OK))) {
+		return 0;
+	}
+
+	SYS_ARCH_PROTECT(lev);
+	if ((is_tx_space_available(xemacpsif) < n) ||
+	    (is_tx_space_available(xemacpsif) <
+	     XLWIP_CONFIG_TX_RECLAIM_WATERMARK)) {
+		process_sent_bds(xemacpsif,
+				 &(XEmacPs_GetTxRing(&xemacpsif->emacps)));
+	}
+
+	for (sent = 0; sent < n; sent++) {
+		p = slots[sent].p;
+		len = slots[sent].len;
+		if (len > XEMACPSIF_UDPS_MAX_PAYLOAD) {
+			len = XEMACPSIF_UDPS_MAX_PAYLOAD;
+		}
+
+		memcpy(p->payload, s->hdr, XEMACPSIF_UDPS_HDR_SIZE);
+		iphdr = (struct ip_hdr *)((u8_t *)p->payload + SIZEOF_ETH_HDR);
+		udphdr = (struct udp_hdr *)((u8_t *)iphdr + IP_HLEN);
+		IPH_LEN_SET(iphdr, lwip_htons(IP_HLEN + UDP_HLEN + len));
+		IPH_ID_SET(iphdr, lwip_htons(s->ip_id));
+#if CHECKSUM_GEN_IP
+		IPH_CHKSUM_SET(iphdr, inet_chksum(iphdr, IP_HLEN));
+#endif
+		udphdr->len = lwip_htons(UDP_HLEN + len);
+		pbuf_realloc(p, XEMACPSIF_UDPS_HDR_SIZE + len);
+
+#if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
+		if (emacps_sgqueue(xemacpsif, p, 0, &to_block_index) != XST_SUCCESS) {
+#else
+		if (emacps_sgqueue(xemacpsif, p) != XST_SUCCESS) {
+#endif
+			break;
+		}
+		s->ip_id++;
+	}
+
+	if (sent > 0) {
+		emacps_tx_start(xemacpsif);
+	}
+	SYS_ARCH_UNPROTECT(lev);
+
+	/* the TX ring holds the frames sent until they are done */
+	xemacpsif_udps_release(slots, sent);
+#if LINK_STATS
+	lwip_stats.link.xmit += sent;
+#endif
+
+	return sent;
+}
+
+/*
+ * xemacpsif_udps_rx_drops():
+ *
+ * Returns the number of datagrams a stream dropped because the application
+ * did not take the ones received before.
+ */
+u32_t xemacpsif_udps_rx_drops(xemacpsif_udps_t *s)
+{
+	return s->rx_drops;
+}
+
+#endif
@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2026 Xilinx, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ * SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+ * OF SUCH DAMAGE.
+ *
+ * This file is part of the lwIP TCP/IP stack.
+ *
+ */
+
+#include <string.h>
+
+#include "lwipopts.h"
+#include "lwip/sys.h"
+
+#include "netif/xnetif_stats.h"
+#if defined (__arm__) || defined (__aarch64__)
+#include "xtime_l.h"
+#endif
+
+/*
+ * Time base of the latency histogram, 0 where there is no free running
+ * timer; the latency histogram stays empty then.
+ */
+static u64_t
+xnetif_stats_now(void)
+{
+#if defined (__arm__) || defined (__aarch64__)
+	XTime now;
+
+	XTime_GetTime(&now);
+	return (u64_t)now;
+#else
+	return 0;
+#endif
+}
+
+void
+xnetif_hist_add(xnetif_hist_t *hist, u32_t value)
+{
+	u32_t i = 0;
+
+	while ((value >> i) != 0 && i < XNETIF_HIST_BUCKETS - 1)
+		i++;
+
+	hist->bucket[i]++;
+	if (value > hist->max)
+		hist->max = value;
+}
+
+/*
+ * Called from the RX interrupt handler. Only the first interrupt not yet
+ * seen by the input path is timed, later ones add to the same wait.
+ */
+void
+xnetif_stats_rx_irq(xnetif_stats_t *stats)
+{
+	if (stats->rx_pending_since == 0)
+		stats->rx_pending_since = xnetif_stats_now();
+}
+
+/*
+ * Called by the input path once it took frames off the receive queue.
+ */
+void
+xnetif_stats_rx_input(xnetif_stats_t *stats)
+{
+#if defined (__arm__) || defined (__aarch64__)
+	u64_t since = stats->rx_pending_since;
+	u64_t delay;
+
+	if (since == 0)
+		return;
+
+	stats->rx_pending_since = 0;
+	delay = ((xnetif_stats_now() - since) * 1000000U) / COUNTS_PER_SECOND;
+	xnetif_hist_add(&stats->rx_latency_us,
+			delay > 0xFFFFFFFFU ? 0xFFFFFFFFU : (u32_t)delay);
+#else
+	(void)stats;
+#endif
+}
+
+/*
+ * Takes a snapshot of stats, with interrupts masked so that the interrupt
+ * handlers do not update it half way.
+ */
+void
+xnetif_stats_copy(xnetif_stats_t *stats, const xnetif_stats_t *src)
+{
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	SYS_ARCH_PROTECT(lev);
+	memcpy(stats, src, sizeof *stats);
+	SYS_ARCH_UNPROTECT(lev);
+}
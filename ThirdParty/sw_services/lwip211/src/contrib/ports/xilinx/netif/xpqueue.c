@@ -52,7 +52,9 @@ pq_create_queue()
 	if (!q)
 		return q;
 
-	q->head = q->tail = q->len = 0;
+	(void)Xil_RingInit(&q->ring, q->data, PQ_QUEUE_SIZE, sizeof(void *));
+	q->high_water = 0;
+	q->drops = 0;
 
 	return q;
 }
@@ -60,12 +62,16 @@ pq_create_queue()
 int
 pq_enqueue(pq_queue_t *q, void *p)
 {
-	if (q->len == PQ_QUEUE_SIZE)
+	u32 length;
+
+	if (Xil_RingPush(&q->ring, &p) != XST_SUCCESS) {
+		q->drops++;
 		return -1;
+	}
 
-	q->data[q->head] = p;
-	q->head = (q->head + 1)%PQ_QUEUE_SIZE;
-	q->len++;
+	length = Xil_RingCount(&q->ring);
+	if (length > q->high_water)
+		q->high_water = length;
 
 	return 0;
 }
@@ -73,20 +79,41 @@ pq_enqueue(pq_queue_t *q, void *p)
 void*
 pq_dequeue(pq_queue_t *q)
 {
-	int ptail;
+	void *p;
 
-	if (q->len == 0)
+	if (Xil_RingPop(&q->ring, &p) != XST_SUCCESS)
 		return NULL;
 
-	ptail = q->tail;
-	q->tail = (q->tail + 1)%PQ_QUEUE_SIZE;
-	q->len--;
+	return p;
+}
 
-	return q->data[ptail];
+/*
+ * Takes up to n pbufs off the queue with a single consumer index update.
+ * Returns the number of pbufs stored in p.
+ */
+int
+pq_dequeue_bulk(pq_queue_t *q, void **p, int n)
+{
+	if (n <= 0)
+		return 0;
+
+	return (int)Xil_RingDequeueBulk(&q->ring, p, (u32)n);
 }
 
 int
 pq_qlength(pq_queue_t *q)
 {
-	return q->len;
+	return (int)Xil_RingCount(&q->ring);
+}
+
+/*
+ * The statistics are updated by the producer without locking, a snapshot
+ * taken from another context may be off by the pbufs in flight.
+ */
+void
+pq_get_stats(pq_queue_t *q, pq_stats_t *stats)
+{
+	stats->length = Xil_RingCount(&q->ring);
+	stats->high_water = q->high_water;
+	stats->drops = q->drops;
 }
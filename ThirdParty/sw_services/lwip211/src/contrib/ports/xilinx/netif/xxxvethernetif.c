@@ -0,0 +1,414 @@
+/*
+ * Copyright (C) 2026 Xilinx, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ * SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+ * OF SUCH DAMAGE.
+ *
+ * This file is part of the lwIP TCP/IP stack.
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <xparameters.h>
+
+#include "xlwipconfig.h"
+#include "lwip/opt.h"
+#include "lwip/def.h"
+#include "lwip/mem.h"
+#include "lwip/pbuf.h"
+#include "lwip/sys.h"
+#include "lwip/stats.h"
+#include "lwip/igmp.h"
+
+#include "netif/etharp.h"
+#include "netif/xxxvethernetif.h"
+#include "netif/xadapter.h"
+#include "netif/xpqueue.h"
+
+#include "xxxvethernet_hw.h"
+
+#if LWIP_IPV6
+#include "lwip/ethip6.h"
+#endif
+
+/* Define those to better describe your network interface. */
+#define IFNAME0 'x'
+#define IFNAME1 'e'
+
+extern enum ethernet_link_status eth_link_status;
+
+/*
+ * this function is always called with interrupts off
+ * this function also assumes that there are available BD's
+ */
+static err_t _unbuffered_low_level_output(xxxvethernetif_s *xxxvethernetif,
+							struct pbuf *p)
+{
+	XStatus status;
+	err_t err = ERR_MEM;
+
+#if ETH_PAD_SIZE
+	pbuf_header(p, -ETH_PAD_SIZE);			/* drop the padding word */
+#endif
+	status = xxv_mcdma_sgsend(xxxvethernetif, p);
+	if (status != XST_SUCCESS) {
+#if LINK_STATS
+		lwip_stats.link.drop++;
+#endif
+	} else {
+		err = ERR_OK;
+	}
+
+#if ETH_PAD_SIZE
+	pbuf_header(p, ETH_PAD_SIZE);	/* reclaim the padding word */
+#endif
+
+#if LINK_STATS
+	lwip_stats.link.xmit++;
+#endif /* LINK_STATS */
+
+	return err;
+}
+
+/*
+ * low_level_output():
+ *
+ * Should do the actual transmission of the packet. The packet is
+ * contained in the pbuf that is passed to the function. This pbuf
+ * might be chained.
+ *
+ * When no TX channel has free BDs, the completed BDs of all channels
+ * are reclaimed and the check is retried a bounded number of times.
+ *
+ */
+static err_t low_level_output(struct netif *netif, struct pbuf *p)
+{
+	err_t err = ERR_MEM;
+	SYS_ARCH_DECL_PROTECT(lev);
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xxxvethernetif_s *xxxvethernetif = (xxxvethernetif_s *)(xemac->state);
+	XMcdma_ChanCtrl *Tx_Chan;
+	u32_t ChanId;
+	int count = 100;
+
+	SYS_ARCH_PROTECT(lev);
+
+	while (count) {
+		/* check if space is available to send */
+		if (xxv_is_tx_space_available(xxxvethernetif)) {
+			err = _unbuffered_low_level_output(xxxvethernetif, p);
+			break;
+		}
+
+#if LINK_STATS
+		lwip_stats.link.drop++;
+#endif
+		for (ChanId = 1;
+		     ChanId <= xxxvethernetif->xxv_ethernet.Config.AxiMcDmaChan_Cnt;
+		     ChanId++) {
+			Tx_Chan = XMcdma_GetMcdmaTxChan(&xxxvethernetif->aximcdma,
+							ChanId);
+			xxv_process_sent_bds(Tx_Chan);
+		}
+		count--;
+	}
+
+	SYS_ARCH_UNPROTECT(lev);
+
+	if (count == 0) {
+		xil_printf("pack dropped, no space\r\n");
+	}
+
+	return err;
+}
+
+/*
+ * low_level_input():
+ *
+ * Takes up to n received packets off the receive queue. The ISR is the
+ * only producer of the queue, so no interrupt masking is needed.
+ *
+ */
+static int low_level_input(struct netif *netif, struct pbuf **p, int n)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xxxvethernetif_s *xxxvethernetif = (xxxvethernetif_s *)(xemac->state);
+
+	return pq_dequeue_bulk(xxxvethernetif->recv_q, (void **)p, n);
+}
+
+/*
+ * xxxvethernetif_output():
+ *
+ * This function is called by the TCP/IP stack when an IP packet
+ * should be sent. It calls the function called low_level_output() to
+ * do the actual transmission of the packet.
+ *
+ */
+static err_t xxxvethernetif_output(struct netif *netif, struct pbuf *p,
+		const ip_addr_t *ipaddr)
+{
+	/* resolve hardware address, then send (or queue) packet */
+	return etharp_output(netif, p, ipaddr);
+}
+
+/*
+ * xxxvethernetif_input_frame():
+ *
+ * Passes one received packet to lwIP, or drops it if it is of a type
+ * the stack does not handle.
+ *
+ */
+static void xxxvethernetif_input_frame(struct netif *netif, struct pbuf *p)
+{
+	struct eth_hdr *ethhdr;
+
+	/* points to packet payload, which starts with an Ethernet header */
+	ethhdr = p->payload;
+
+#if LINK_STATS
+	lwip_stats.link.recv++;
+#endif /* LINK_STATS */
+
+	switch (htons(ethhdr->type)) {
+		/* IP or ARP packet? */
+		case ETHTYPE_IP:
+		case ETHTYPE_ARP:
+#if LWIP_IPV6
+		/*IPv6 Packet?*/
+		case ETHTYPE_IPV6:
+#endif
+#if PPPOE_SUPPORT
+			/* PPPoE packet? */
+		case ETHTYPE_PPPOEDISC:
+		case ETHTYPE_PPPOE:
+#endif /* PPPOE_SUPPORT */
+			/* full packet send to tcpip_thread to process */
+			if (netif->input(p, netif) != ERR_OK) {
+				LWIP_DEBUGF(NETIF_DEBUG, ("xxxvethernetif_input: IP input error\r\n"));
+				pbuf_free(p);
+			}
+			break;
+
+		default:
+			pbuf_free(p);
+			break;
+	}
+}
+
+/*
+ * xxxvethernetif_input():
+ *
+ * This function should be called when a packet is ready to be read
+ * from the interface. Packets are taken off the receive queue
+ * PQ_BULK_SIZE at a time. Without an OS one batch is passed to lwIP
+ * per call, with an OS the queue is drained.
+ *
+ * Returns the number of packets read (0 if there are no packets)
+ *
+ */
+int xxxvethernetif_input(struct netif *netif)
+{
+	struct pbuf *p[PQ_BULK_SIZE];
+	int n_packets = 0;
+	int n, i;
+
+#if !NO_SYS
+	while (1)
+#endif
+	{
+		/* move received packets into the batch */
+		n = low_level_input(netif, p, PQ_BULK_SIZE);
+
+		/* no packet could be read, silently ignore this */
+		if (n == 0)
+			return n_packets;
+
+		for (i = 0; i < n; i++) {
+			xxxvethernetif_input_frame(netif, p[i]);
+		}
+		n_packets += n;
+	}
+	return n_packets;
+}
+
+/*
+ * xxxvethernetif_rxq_stats():
+ *
+ * Returns the depth statistics of the receive queue of the netif.
+ *
+ */
+void xxxvethernetif_rxq_stats(struct netif *netif, pq_stats_t *stats)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xxxvethernetif_s *xxxvethernetif = (xxxvethernetif_s *)(xemac->state);
+
+	pq_get_stats(xxxvethernetif->recv_q, stats);
+}
+
+/*
+ * init_xxv():
+ *
+ * Configures and starts the MAC. The MAC has no address filter, it
+ * passes every received frame to the MCDMA. With jumbo frames the
+ * maximum frame length of the receiver is raised to fit XXE_JUMBO_MTU.
+ *
+ */
+static err_t init_xxv(xxxvethernetif_s *xxxvethernetif)
+{
+	XXxvEthernet *xxvp = &xxxvethernetif->xxv_ethernet;
+	u32 options;
+#ifdef USE_JUMBO_FRAMES
+	u32 reg;
+#endif
+
+	options = XXE_TRANSMITTER_ENABLE_OPTION | XXE_RECEIVER_ENABLE_OPTION |
+		  XXE_FCS_STRIP_OPTION | XXE_FCS_INSERT_OPTION;
+	XXxvEthernet_SetOptions(xxvp, options);
+	XXxvEthernet_ClearOptions(xxvp, ~options);
+
+#ifdef USE_JUMBO_FRAMES
+	reg = XXxvEthernet_ReadReg(xxvp->Config.BaseAddress, XXE_RXMTU_OFFSET);
+	reg &= ~XXE_RXMTU_MAX_JUM_MASK;
+	reg |= ((u32)XXE_MAX_JUMBO_FRAME_SIZE << 16) & XXE_RXMTU_MAX_JUM_MASK;
+	XXxvEthernet_WriteReg(xxvp->Config.BaseAddress, XXE_RXMTU_OFFSET, reg);
+#endif
+
+	/* start the mac, this waits for the receiver block lock */
+	if (XXxvEthernet_Start(xxvp) != XST_SUCCESS) {
+		eth_link_status = ETH_LINK_DOWN;
+		LWIP_DEBUGF(NETIF_DEBUG, ("xxxvethernetif_init: no block lock\r\n"));
+		return ERR_IF;
+	}
+
+	eth_link_status = ETH_LINK_UP;
+
+	return ERR_OK;
+}
+
+static err_t low_level_init(struct netif *netif)
+{
+	UINTPTR mac_address = (UINTPTR)(netif->state);
+	struct xemac_s *xemac;
+	xxxvethernetif_s *xxxvethernetif;
+	XXxvEthernet_Config *mac_config;
+
+	xxxvethernetif = mem_malloc(sizeof *xxxvethernetif);
+	if (xxxvethernetif == NULL) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("xxxvethernetif_init: out of memory\r\n"));
+		return ERR_MEM;
+	}
+
+	xemac = mem_malloc(sizeof *xemac);
+	if (xemac == NULL) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("xxxvethernetif_init: out of memory\r\n"));
+		return ERR_MEM;
+	}
+
+	xemac->state = (void *)xxxvethernetif;
+	xemac->topology_index = xtopology_find_index(mac_address);
+	xemac->type = xemac_type_xxv_ethernet;
+
+	xxxvethernetif->send_q = NULL;
+	xxxvethernetif->recv_q = pq_create_queue();
+	if (!xxxvethernetif->recv_q)
+		return ERR_MEM;
+
+	/* maximum transfer unit */
+#ifdef USE_JUMBO_FRAMES
+	netif->mtu = XXE_JUMBO_MTU - XXE_HDR_SIZE;
+#else
+	netif->mtu = XXE_MTU - XXE_HDR_SIZE;
+#endif
+
+	netif->flags = NETIF_FLAG_BROADCAST | NETIF_FLAG_ETHARP |
+				   NETIF_FLAG_LINK_UP;
+
+#if LWIP_IPV6 && LWIP_IPV6_MLD
+	netif->flags |= NETIF_FLAG_MLD6;
+#endif
+
+#if LWIP_IGMP
+	netif->flags |= NETIF_FLAG_IGMP;
+#endif
+
+#if !NO_SYS
+	sys_sem_new(&xemac->sem_rx_data_available, 0);
+#endif
+
+	/* obtain config of this emac */
+	mac_config = XXxvEthernet_LookupConfigBaseAddr(mac_address);
+	if (mac_config == NULL) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("xxxvethernetif_init: no config for mac\r\n"));
+		return ERR_IF;
+	}
+
+	XXxvEthernet_CfgInitialize(&xxxvethernetif->xxv_ethernet, mac_config,
+				   mac_config->BaseAddress);
+
+	if (!XXxvEthernet_IsMcDma(&xxxvethernetif->xxv_ethernet)) {
+		/* should not occur */
+		LWIP_DEBUGF(NETIF_DEBUG, ("xxxvethernetif_init: mac is not configured with MCDMA\r\n"));
+		return ERR_IF;
+	}
+
+	/* initialize the MCDMA engine */
+	if (init_xxv_mcdma(xemac) != XST_SUCCESS)
+		return ERR_IF;
+
+	/* initialize the mac */
+	init_xxv(xxxvethernetif);
+
+	/* replace the state in netif (currently the emac baseaddress)
+	 * with the mac instance pointer.
+	 */
+	netif->state = (void *)xemac;
+
+	return ERR_OK;
+}
+
+/*
+ * xxxvethernetif_init():
+ *
+ * Should be called at the beginning of the program to set up the
+ * network interface. It calls the function low_level_init() to do the
+ * actual setup of the hardware.
+ *
+ */
+err_t
+xxxvethernetif_init(struct netif *netif)
+{
+	netif->name[0] = IFNAME0;
+	netif->name[1] = IFNAME1;
+	netif->output = xxxvethernetif_output;
+	netif->linkoutput = low_level_output;
+#if LWIP_IPV6
+	netif->output_ip6 = ethip6_output;
+#endif
+
+	low_level_init(netif);
+
+	return ERR_OK;
+}
@@ -0,0 +1,628 @@
+/*
+ * Copyright (C) 2026 Xilinx, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ * SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+ * OF SUCH DAMAGE.
+ *
+ * This file is part of the lwIP TCP/IP stack.
+ *
+ */
+
+#include "lwipopts.h"
+
+#if !NO_SYS
+#include "FreeRTOS.h"
+#include "lwip/sys.h"
+#endif
+
+#include "lwip/stats.h"
+
+#include "netif/xadapter.h"
+#include "netif/xxxvethernetif.h"
+
+#include "xscugic.h"
+#include "xstatus.h"
+#include "xil_cache.h"
+
+#include "xlwipconfig.h"
+#include "xparameters.h"
+
+#if defined __aarch64__
+#include "xil_mmu.h"
+#endif
+
+#if defined ARMR5
+#include "xil_mpu.h"
+#endif
+
+#define XMCDMA_ALL_BDS          0xFFFF
+#define XMCDMA_BD_LENGTH_MASK   0x007FFFFF
+#define XMCDMA_COALESCEDELAY    0x1
+
+#define RESET_TIMEOUT_COUNT     10000
+#define BLOCK_SIZE_2MB          0x200000
+#define BLOCK_SIZE_1MB          0x100000
+
+#define INTC_DIST_BASE_ADDR     XPAR_SCUGIC_0_DIST_BASEADDR
+
+#if defined (__aarch64__)
+#define BD_SIZE                 BLOCK_SIZE_2MB
+static u8_t bd_space[BD_SIZE] __attribute__ ((aligned (BLOCK_SIZE_2MB)));
+#else
+#define BD_SIZE                 BLOCK_SIZE_1MB
+static u8_t bd_space[BD_SIZE] __attribute__ ((aligned (BLOCK_SIZE_1MB)));
+#endif
+
+static u8_t *bd_mem_ptr = bd_space;
+
+#if !NO_SYS
+#ifdef XLWIP_CONFIG_INCLUDE_AXI_ETHERNET
+extern u32 xInsideISR;
+#else
+u32 xInsideISR = 0;
+#endif
+#endif
+
+#ifdef USE_JUMBO_FRAMES
+#define XXV_MAX_FRAME_SIZE	XXE_MAX_JUMBO_FRAME_SIZE
+#else
+#define XXV_MAX_FRAME_SIZE	XXE_MAX_FRAME_SIZE
+#endif
+
+static inline u32_t extract_packet_len(XMcdma_Bd *rxbd) {
+	return XMcDma_BdGetActualLength(rxbd, XMCDMA_BD_LENGTH_MASK);
+}
+
+#define XMcdma_BdMemCalc(Alignment, NumBd) \
+	(int)((sizeof(XMcdma_Bd)+((Alignment)-1)) & ~((Alignment)-1))*(NumBd)
+
+static inline void *alloc_bdspace(int n_desc, u32 alignment)
+{
+	int space = XMcdma_BdMemCalc(alignment, n_desc);
+	void *unaligned_mem = bd_mem_ptr;
+	void *aligned_mem =
+	(void *)(((UINTPTR)(unaligned_mem + alignment - 1)) & ~(alignment - 1));
+
+	if (aligned_mem + space > (void *)(bd_space + BD_SIZE)) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("Unable to allocate BD space\r\n"));
+		return NULL;
+	}
+
+	bd_mem_ptr = aligned_mem + space;
+
+	return aligned_mem;
+}
+
+static void xxv_mcdma_reset(XMcdma *McDmaInstPtr)
+{
+	u32 timeOut;
+
+	XMcDma_Reset(McDmaInstPtr);
+	timeOut = RESET_TIMEOUT_COUNT;
+	while (timeOut) {
+		if (XMcdma_ResetIsDone(McDmaInstPtr))
+			break;
+		timeOut -= 1;
+	}
+
+	if (!timeOut) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("%s: Error: aximcdma reset timed out\r\n", __func__));
+	}
+}
+
+static void xxv_mcdma_send_error_handler(void *CallBackRef, u32 ChanId, u32 Mask)
+{
+	XMcdma *McDmaInstPtr = (XMcdma *)((void *)CallBackRef);
+
+#if !NO_SYS
+	xInsideISR++;
+#endif
+	LWIP_DEBUGF(NETIF_DEBUG, ("%s: Error: aximcdma error interrupt is asserted, Chan_id = "
+			"%d, Mask = %d\r\n", __FUNCTION__, ChanId, Mask));
+
+	xxv_mcdma_reset(McDmaInstPtr);
+
+#if !NO_SYS
+	xInsideISR--;
+#endif
+}
+
+static void xxv_mcdma_send_handler(void *CallBackRef, u32 ChanId)
+{
+	XMcdma *McDmaInstPtr = (XMcdma *)((void *)CallBackRef);
+	XMcdma_ChanCtrl *Tx_Chan = XMcdma_GetMcdmaTxChan(McDmaInstPtr, ChanId);
+
+#if !NO_SYS
+	xInsideISR++;
+#endif
+
+	xxv_process_sent_bds(Tx_Chan);
+
+#if !NO_SYS
+	xInsideISR--;
+#endif
+}
+
+/*
+ * Refills up to n_bds RX BDs of a channel with fresh pbufs. The BDs are
+ * submitted one by one and committed to hardware with a single
+ * XMcDma_ChanToHw(), which writes the tail pointer of the channel once
+ * for the whole batch.
+ */
+static void setup_rx_bds(XMcdma_ChanCtrl *Rx_Chan, u32_t n_bds)
+{
+	XMcdma_Bd *rxbd;
+	u32_t i;
+	u32_t n_submitted = 0;
+	XStatus status;
+	struct pbuf *p;
+	u32 bdsts;
+
+	for (i = 0; i < n_bds; i++) {
+		p = pbuf_alloc(PBUF_RAW, XXV_MAX_FRAME_SIZE, PBUF_POOL);
+		if (!p) {
+#if LINK_STATS
+			lwip_stats.link.memerr++;
+#endif
+			LWIP_DEBUGF(NETIF_DEBUG, ("unable to alloc pbuf in recv_handler\r\n"));
+			break;
+		}
+
+		rxbd = (XMcdma_Bd *)XMcdma_GetChanCurBd(Rx_Chan);
+		status = XMcDma_ChanSubmit(Rx_Chan, (UINTPTR)p->payload,
+					   p->len);
+		if (status != XST_SUCCESS) {
+			LWIP_DEBUGF(NETIF_DEBUG, ("setup_rx_bds: Error allocating RxBD\r\n"));
+			pbuf_free(p);
+			break;
+		}
+		/* Clear everything but the COMPLETE bit, which is cleared when
+		 * committed to hardware.
+		 */
+		bdsts = XMcDma_BdGetSts(rxbd);
+		bdsts &= XMCDMA_BD_STS_COMPLETE_MASK;
+		XMcdma_BdWrite(rxbd, XMCDMA_BD_STS_OFFSET, bdsts);
+		XMcDma_BdSetCtrl(rxbd, 0);
+		XMcdma_BdSetSwId(rxbd, p);
+
+#if defined(__aarch64__)
+		Xil_DCacheInvalidateRange((UINTPTR)p->payload,
+					  (UINTPTR)XXV_MAX_FRAME_SIZE);
+#else
+		Xil_DCacheFlushRange((UINTPTR)p->payload,
+				     (UINTPTR)XXV_MAX_FRAME_SIZE);
+#endif
+		n_submitted++;
+	}
+
+	dsb();
+
+	if (n_submitted) {
+		/* Enqueue to HW */
+		status = XMcDma_ChanToHw(Rx_Chan);
+		if (status != XST_SUCCESS) {
+			LWIP_DEBUGF(NETIF_DEBUG, ("Error committing RxBD to hardware\n\r"));
+		}
+	}
+}
+
+static void xxv_mcdma_recv_error_handler(void *CallBackRef, u32 ChanId)
+{
+	XMcdma_ChanCtrl *Rx_Chan;
+	struct xemac_s *xemac = (struct xemac_s *)(CallBackRef);
+	xxxvethernetif_s *xxxvethernetif = (xxxvethernetif_s *)(xemac->state);
+	XMcdma *McDmaInstPtr = &xxxvethernetif->aximcdma;
+
+#if !NO_SYS
+	xInsideISR++;
+#endif
+	LWIP_DEBUGF(NETIF_DEBUG, ("%s: Error: aximcdma error interrupt is asserted\r\n",
+			__FUNCTION__));
+	Rx_Chan = XMcdma_GetMcdmaRxChan(McDmaInstPtr, ChanId);
+
+	setup_rx_bds(Rx_Chan, Rx_Chan->BdCnt);
+
+	xxv_mcdma_reset(McDmaInstPtr);
+
+	XMcDma_ChanToHw(Rx_Chan);
+
+#if !NO_SYS
+	xInsideISR--;
+#endif
+}
+
+/*
+ * Takes all completed BDs of a channel off the ring in one
+ * XMcdma_BdChainFromHW() call, queues their pbufs for the input path and
+ * refills the ring in one batch.
+ */
+static void xxv_mcdma_recv_handler(void *CallBackRef, u32 ChanId)
+{
+	struct pbuf *p;
+	u32 i, rx_bytes, ProcessedBdCnt;
+	XMcdma_Bd *rxbd, *rxbdset;
+	struct xemac_s *xemac = (struct xemac_s *)(CallBackRef);
+	xxxvethernetif_s *xxxvethernetif = (xxxvethernetif_s *)(xemac->state);
+	XMcdma *McDmaInstPtr = &xxxvethernetif->aximcdma;
+	XMcdma_ChanCtrl *Rx_Chan;
+
+#if !NO_SYS
+	xInsideISR++;
+#endif
+
+	Rx_Chan = XMcdma_GetMcdmaRxChan(McDmaInstPtr, ChanId);
+
+	ProcessedBdCnt = XMcdma_BdChainFromHW(Rx_Chan, XMCDMA_ALL_BDS, &rxbdset);
+
+	for (i = 0, rxbd = rxbdset; i < ProcessedBdCnt; i++) {
+
+		p = (struct pbuf *)(UINTPTR)XMcdma_BdGetSwId(rxbd);
+
+		/* Adjust the buffer size to actual number of bytes received.*/
+		rx_bytes = extract_packet_len(rxbd);
+#ifndef __aarch64__
+		Xil_DCacheInvalidateRange((UINTPTR)p->payload,
+					  (UINTPTR)rx_bytes);
+#endif
+		pbuf_realloc(p, rx_bytes);
+
+		/* store it in the receive queue,
+		 * where it'll be processed by a different handler
+		 */
+		if (pq_enqueue(xxxvethernetif->recv_q, (void*)p) < 0) {
+#if LINK_STATS
+			lwip_stats.link.memerr++;
+			lwip_stats.link.drop++;
+#endif
+			pbuf_free(p);
+		}
+		rxbd = (XMcdma_Bd *)XMcdma_BdChainNextBd(Rx_Chan, rxbd);
+	}
+
+	/* free up the BD's */
+	XMcdma_BdChainFree(Rx_Chan, ProcessedBdCnt, rxbdset);
+
+	/* return all the processed bd's back to the stack */
+	setup_rx_bds(Rx_Chan, Rx_Chan->BdCnt);
+#if !NO_SYS
+	sys_sem_signal(&xemac->sem_rx_data_available);
+	xInsideISR--;
+#endif
+}
+
+s32_t xxv_is_tx_space_available(xxxvethernetif_s *xxxvethernetif)
+{
+	XMcdma_ChanCtrl *Tx_Chan;
+	u32_t ChanId;
+
+	for (ChanId = 1;
+	     ChanId <= xxxvethernetif->xxv_ethernet.Config.AxiMcDmaChan_Cnt;
+	     ChanId++) {
+		Tx_Chan = XMcdma_GetMcdmaTxChan(&xxxvethernetif->aximcdma, ChanId);
+
+		if (Tx_Chan->BdCnt) {
+			return Tx_Chan->BdCnt;
+		}
+	}
+	return 0;
+}
+
+s32_t xxv_process_sent_bds(XMcdma_ChanCtrl *Tx_Chan)
+{
+	int ProcessedBdCnt, i;
+	XStatus status;
+	XMcdma_Bd *txbdset, *txbd;
+
+	ProcessedBdCnt = XMcdma_BdChainFromHW(Tx_Chan, XMCDMA_ALL_BDS,
+					      &txbdset);
+	if (ProcessedBdCnt == 0) {
+		return XST_FAILURE;
+	}
+
+	/* free the pbuf associated with each BD */
+	for (i = 0, txbd = txbdset; i < ProcessedBdCnt; i++) {
+		struct pbuf *p = (struct pbuf *)(UINTPTR)XMcdma_BdGetSwId(txbd);
+		pbuf_free(p);
+		txbd = (XMcdma_Bd *)XMcdma_BdChainNextBd(Tx_Chan, txbd);
+	}
+
+	/* free the processed BD's */
+	status = XMcdma_BdChainFree(Tx_Chan, ProcessedBdCnt, txbdset);
+	if (status != XST_SUCCESS) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("Error freeing up TxBDs"));
+		return XST_FAILURE;
+	}
+	return XST_SUCCESS;
+}
+
+/*
+ * Queues a frame on one of the TX channels that has room for all its
+ * pbufs, picked in weighted round-robin order. All pbufs of the frame are
+ * submitted before the tail pointer is written once.
+ */
+XStatus xxv_mcdma_sgsend(xxxvethernetif_s *xxxvethernetif, struct pbuf *p)
+{
+	struct pbuf *q;
+	u32_t n_pbufs = 0;
+	XMcdma_Bd *txbdset, *txbd, *last_txbd = NULL;
+	XMcdma_ChanCtrl *Tx_Chan;
+	XStatus status;
+	u32_t ready_mask = 0;
+	u32_t ChanId;
+
+	/* first count the number of pbufs */
+	for (q = p; q != NULL; q = q->next)
+		n_pbufs++;
+
+	for (ChanId = 1;
+	     ChanId <= xxxvethernetif->xxv_ethernet.Config.AxiMcDmaChan_Cnt;
+	     ChanId++) {
+		Tx_Chan = XMcdma_GetMcdmaTxChan(&xxxvethernetif->aximcdma, ChanId);
+		if (n_pbufs <= Tx_Chan->BdCnt)
+			ready_mask |= 1U << (ChanId - 1);
+	}
+
+	ChanId = XMcdma_SchedNextChan(&xxxvethernetif->aximcdma, ready_mask);
+	if (ChanId == 0) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("sgsend: Error, not enough BD space in All Chans\r\n"));
+		return XST_FAILURE;
+	}
+	Tx_Chan = XMcdma_GetMcdmaTxChan(&xxxvethernetif->aximcdma, ChanId);
+
+	txbdset = (XMcdma_Bd *)XMcdma_GetChanCurBd(Tx_Chan);
+
+	for (q = p, txbd = txbdset; q != NULL; q = q->next) {
+		/* Send the data from the pbuf to the interface, one pbuf at a
+		 * time. The size of the data in each pbuf is kept in the ->len
+		 * variable.
+		 */
+		XMcDma_BdSetCtrl(txbd, 0);
+		XMcdma_BdSetSwId(txbd, (void *)q);
+
+		Xil_DCacheFlushRange((UINTPTR)q->payload, q->len);
+
+		status = XMcDma_ChanSubmit(Tx_Chan, (UINTPTR)q->payload,
+					   q->len);
+		if (status != XST_SUCCESS) {
+			LWIP_DEBUGF(NETIF_DEBUG, ("ChanSubmit failed\n\r"));
+			return XST_FAILURE;
+		}
+
+		pbuf_ref(q);
+
+		last_txbd = txbd;
+		txbd = (XMcdma_Bd *)XMcdma_BdChainNextBd(Tx_Chan, txbd);
+	}
+
+	if (n_pbufs == 1) {
+		XMcDma_BdSetCtrl(txbdset, XMCDMA_BD_CTRL_SOF_MASK
+				| XMCDMA_BD_CTRL_EOF_MASK);
+	} else {
+		/* in the first packet, set the SOP */
+		XMcDma_BdSetCtrl(txbdset, XMCDMA_BD_CTRL_SOF_MASK);
+		/* in the last packet, set the EOP */
+		XMcDma_BdSetCtrl(last_txbd, XMCDMA_BD_CTRL_EOF_MASK);
+	}
+
+	DATA_SYNC;
+	/* enq to h/w */
+	return XMcDma_ChanToHw(Tx_Chan);
+}
+
+static void xxv_mcdma_register_handlers(struct xemac_s *xemac, u32_t ChanId)
+{
+	xxxvethernetif_s *xxxvethernetif = (xxxvethernetif_s *)(xemac->state);
+	XMcdma *McDmaInstPtr = &xxxvethernetif->aximcdma;
+	XXxvEthernet_Config *cfg = &xxxvethernetif->xxv_ethernet.Config;
+	struct xtopology_t *xtopologyp = &xtopology[xemac->topology_index];
+
+	XScuGic_RegisterHandler(xtopologyp->scugic_baseaddr,
+			cfg->AxiMcDmaRxIntr[ChanId - 1],
+			(Xil_InterruptHandler)XMcdma_IntrHandler,
+			McDmaInstPtr);
+
+	XScuGic_RegisterHandler(xtopologyp->scugic_baseaddr,
+			cfg->AxiMcDmaTxIntr[ChanId - 1],
+			(Xil_InterruptHandler)XMcdma_TxIntrHandler,
+			McDmaInstPtr);
+
+	XScuGic_SetPriTrigTypeByDistAddr(INTC_DIST_BASE_ADDR,
+			cfg->AxiMcDmaTxIntr[ChanId - 1],
+			XXVMCDMA_TX_INTR_PRIORITY_SET_IN_GIC,
+			XXV_TRIG_TYPE_RISING_EDGE_SENSITIVE);
+
+	XScuGic_SetPriTrigTypeByDistAddr(INTC_DIST_BASE_ADDR,
+			cfg->AxiMcDmaRxIntr[ChanId - 1],
+			XXVMCDMA_RX_INTR_PRIORITY_SET_IN_GIC,
+			XXV_TRIG_TYPE_RISING_EDGE_SENSITIVE);
+
+	XScuGic_EnableIntr(INTC_DIST_BASE_ADDR,
+			cfg->AxiMcDmaTxIntr[ChanId - 1]);
+
+	XScuGic_EnableIntr(INTC_DIST_BASE_ADDR,
+			cfg->AxiMcDmaRxIntr[ChanId - 1]);
+}
+
+static XStatus xxv_mcdma_setup_rx_chan(struct xemac_s *xemac, u32_t ChanId)
+{
+	XMcdma_ChanCtrl *Rx_Chan;
+	XStatus status;
+	xxxvethernetif_s *xxxvethernetif = (xxxvethernetif_s *)(xemac->state);
+
+	/* RX chan configurations */
+	Rx_Chan = XMcdma_GetMcdmaRxChan(&xxxvethernetif->aximcdma, ChanId);
+
+	/* Disable all interrupts */
+	XMcdma_IntrDisable(Rx_Chan, XMCDMA_IRQ_ALL_MASK);
+
+	status = XMcDma_ChanBdCreate(Rx_Chan,
+				     (UINTPTR)xxxvethernetif->rx_bdspace,
+				     XLWIP_CONFIG_N_RX_DESC);
+	if (status != XST_SUCCESS) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("Rx bd create failed with %d\r\n", status));
+		return XST_FAILURE;
+	}
+
+	xxxvethernetif->rx_bdspace += (XLWIP_CONFIG_N_RX_DESC * sizeof(XMcdma_Bd));
+
+	/* Setup Interrupt System and register callbacks */
+	XMcdma_SetCallBack(&xxxvethernetif->aximcdma, XMCDMA_HANDLER_DONE,
+			(void *)xxv_mcdma_recv_handler, xemac);
+	XMcdma_SetCallBack(&xxxvethernetif->aximcdma, XMCDMA_HANDLER_ERROR,
+			(void *)xxv_mcdma_recv_error_handler, xemac);
+
+	status = XMcdma_SetChanCoalesceDelay(Rx_Chan,
+					     XLWIP_CONFIG_N_RX_COALESCE,
+					     XMCDMA_COALESCEDELAY);
+	if (status != XST_SUCCESS) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("Error setting coalescing settings\r\n"));
+		return XST_FAILURE;
+	}
+
+	setup_rx_bds(Rx_Chan, XLWIP_CONFIG_N_RX_DESC);
+
+	/* enable DMA interrupts */
+	XMcdma_IntrEnable(Rx_Chan, XMCDMA_IRQ_ALL_MASK);
+
+	return XST_SUCCESS;
+}
+
+static XStatus xxv_mcdma_setup_tx_chan(struct xemac_s *xemac, u32_t ChanId)
+{
+	XStatus status;
+	XMcdma_ChanCtrl *Tx_Chan;
+	xxxvethernetif_s *xxxvethernetif = (xxxvethernetif_s *)(xemac->state);
+
+	/* TX chan configurations */
+	Tx_Chan = XMcdma_GetMcdmaTxChan(&xxxvethernetif->aximcdma, ChanId);
+
+	XMcdma_IntrDisable(Tx_Chan, XMCDMA_IRQ_ALL_MASK);
+
+	status = XMcDma_ChanBdCreate(Tx_Chan,
+				     (UINTPTR)xxxvethernetif->tx_bdspace,
+				     XLWIP_CONFIG_N_TX_DESC);
+	if (status != XST_SUCCESS) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("TX bd create failed with %d\r\n", status));
+		return XST_FAILURE;
+	}
+
+	xxxvethernetif->tx_bdspace += (XLWIP_CONFIG_N_TX_DESC * sizeof(XMcdma_Bd));
+
+	/* Setup Interrupt System and register callbacks */
+	XMcdma_SetCallBack(&xxxvethernetif->aximcdma, XMCDMA_TX_HANDLER_DONE,
+			(void *)xxv_mcdma_send_handler, &xxxvethernetif->aximcdma);
+	XMcdma_SetCallBack(&xxxvethernetif->aximcdma, XMCDMA_TX_HANDLER_ERROR,
+			(void *)xxv_mcdma_send_error_handler,
+			&xxxvethernetif->aximcdma);
+
+	status = XMcdma_SetChanCoalesceDelay(Tx_Chan,
+					     XLWIP_CONFIG_N_TX_COALESCE,
+					     XMCDMA_COALESCEDELAY);
+	if (status != XST_SUCCESS) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("Error setting coalescing settings\r\n"));
+		return XST_FAILURE;
+	}
+
+	XMcdma_IntrEnable(Tx_Chan, XMCDMA_IRQ_ALL_MASK);
+
+	return XST_SUCCESS;
+}
+
+XStatus init_xxv_mcdma(struct xemac_s *xemac)
+{
+	XMcdma_Config *dmaconfig;
+	XStatus status;
+	u32_t ChanId;
+	xxxvethernetif_s *xxxvethernetif = (xxxvethernetif_s *)(xemac->state);
+	u32_t n_chans = xxxvethernetif->xxv_ethernet.Config.AxiMcDmaChan_Cnt;
+	UINTPTR baseaddr;
+
+	/*
+	 * Disable L1 prefetch on ARMv8, see init_axi_mcdma() in
+	 * xaxiemacif_mcdma.c: a prefetched cache line of an RX pbuf can
+	 * shadow the data the MCDMA writes to it.
+	 */
+#if defined __aarch64__
+	Xil_ConfigureL1Prefetch(0);
+#endif
+
+	xxxvethernetif->rx_bdspace = alloc_bdspace(XLWIP_CONFIG_N_RX_DESC * n_chans,
+						   XMCDMA_BD_MINIMUM_ALIGNMENT);
+	if (!xxxvethernetif->rx_bdspace) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("%s@%d: Error: Unable to allocate memory for "
+				"RX buffer descriptors", __FILE__, __LINE__));
+		return XST_FAILURE;
+	}
+
+	xxxvethernetif->tx_bdspace = alloc_bdspace(XLWIP_CONFIG_N_TX_DESC * n_chans,
+						   XMCDMA_BD_MINIMUM_ALIGNMENT);
+	if (!xxxvethernetif->tx_bdspace) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("%s@%d: Error: Unable to allocate memory for "
+				"TX buffer descriptors", __FILE__, __LINE__));
+		return XST_FAILURE;
+	}
+
+	/* Mark the BD Region as uncacheable */
+#if defined(__aarch64__)
+	Xil_SetTlbAttributes((UINTPTR)bd_space,
+			     NORM_NONCACHE | INNER_SHAREABLE);
+#elif defined (ARMR5)
+	Xil_SetTlbAttributes((INTPTR)bd_space,
+			     DEVICE_SHARED | PRIV_RW_USER_RW);
+#else
+	Xil_SetTlbAttributes((INTPTR)bd_space, DEVICE_MEMORY);
+#endif
+
+	/* Initialize MCDMA */
+	baseaddr = xxxvethernetif->xxv_ethernet.Config.XxvDevBaseAddress;
+	dmaconfig = XMcdma_LookupConfigBaseAddr(baseaddr);
+	if (dmaconfig == NULL) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("%s@%d: Error: Lookup Config failed\r\n", __FILE__,
+				__LINE__));
+		return XST_FAILURE;
+	}
+	status = XMcDma_CfgInitialize(&xxxvethernetif->aximcdma, dmaconfig);
+	if (status != XST_SUCCESS) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("%s@%d: Error: MCDMA config initialization failed\r\n", __FILE__, __LINE__));
+		return XST_FAILURE;
+	}
+
+	/* Setup Rx/Tx chan and Interrupts */
+	for (ChanId = 1; ChanId <= n_chans; ChanId++) {
+		status = xxv_mcdma_setup_rx_chan(xemac, ChanId);
+		if (status != XST_SUCCESS) {
+			LWIP_DEBUGF(NETIF_DEBUG, ("%s@%d: Error: MCDMA Rx chan setup failed\r\n", __FILE__, __LINE__));
+			return XST_FAILURE;
+		}
+
+		status = xxv_mcdma_setup_tx_chan(xemac, ChanId);
+		if (status != XST_SUCCESS) {
+			LWIP_DEBUGF(NETIF_DEBUG, ("%s@%d: Error: MCDMA Tx chan setup failed\r\n", __FILE__, __LINE__));
+			return XST_FAILURE;
+		}
+
+		xxv_mcdma_register_handlers(xemac, ChanId);
+	}
+
+	return XST_SUCCESS;
+}
@@ -186,6 +186,10 @@ pbuf_init_alloced_pbuf(struct pbuf *p, void *payload, u16_t tot_len, u16_t len,
   p->flags = flags;
   p->ref = 1;
   p->if_idx = NETIF_NO_INDEX;
+#if XLWIP_CONFIG_HW_TIMESTAMP
+  p->ts_sec = 0;
+  p->ts_nsec = 0;
+#endif
 }
 
 /**
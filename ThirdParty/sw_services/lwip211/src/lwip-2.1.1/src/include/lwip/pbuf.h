@@ -40,6 +40,7 @@
 
 #include "lwip/opt.h"
 #include "lwip/err.h"
+#include "xlwipconfig.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -219,6 +220,12 @@ struct pbuf {
 
   /** For incoming packets, this contains the input netif's index */
   u8_t if_idx;
+
+#if XLWIP_CONFIG_HW_TIMESTAMP
+  /** hardware timestamp of the frame set by the netif, 0 if none was taken */
+  u32_t ts_sec;
+  u32_t ts_nsec;
+#endif
 };
 
 
@@ -59,7 +59,10 @@ proc generate {libhandle} {
 	set extra_flags_oamp "${extra_flags} -I${linclude}/include"
 	set with_proxy [::common::get_property VALUE [hsi::get_comp_params -filter { NAME == WITH_PROXY } ] ]
 
+	set with_dcache_buffers [::common::get_property VALUE [hsi::get_comp_params -filter { NAME == WITH_DCACHE_BUFFERS } ] ]
+
 	puts "WITH_PROXY=${with_proxy}"
+	puts "WITH_DCACHE_BUFFERS=${with_dcache_buffers}"
 
 	if { "${with_proxy}" == "true" } {
 		if {[string match "*-DUNDEFINE_FILE_OPS*" $extra_flags] != 1} {
@@ -116,7 +119,7 @@ proc generate {libhandle} {
 		# Linux
 		file attributes ${cmake_cmd} -permissions ugo+rx
 
-		set cmake_opt "-DCMAKE_TOOLCHAIN_FILE=toolchain -DCMAKE_INSTALL_PREFIX=/ -DCMAKE_VERBOSE_MAKEFILE=on -DWITH_LIBMETAL_FIND=off -DWITH_EXT_INCLUDES_FIND=off -DWITH_PROXY=${with_proxy}"
+		set cmake_opt "-DCMAKE_TOOLCHAIN_FILE=toolchain -DCMAKE_INSTALL_PREFIX=/ -DCMAKE_VERBOSE_MAKEFILE=on -DWITH_LIBMETAL_FIND=off -DWITH_EXT_INCLUDES_FIND=off -DWITH_PROXY=${with_proxy} -DWITH_DCACHE_BUFFERS=${with_dcache_buffers}"
 		if { [catch {exec ${cmake_cmd} "../src/open-amp" ${cmake_opt}} msg] } {
 			puts "${msg}"
 			error "Failed to generate cmake files."
@@ -126,7 +129,7 @@ proc generate {libhandle} {
 
 	} else {
 		# Windows
-		if { [catch {exec ${cmake_cmd} -G "Unix Makefiles" -DCMAKE_TOOLCHAIN_FILE=toolchain -DCMAKE_INSTALL_PREFIX=/ -DCMAKE_VERBOSE_MAKEFILE=on -DWITH_LIBMETAL_FIND=off -DWITH_EXT_INCLUDES_FIND=off -DWITH_PROXY=${with_proxy} "../src/open-amp" } msg] } {
+		if { [catch {exec ${cmake_cmd} -G "Unix Makefiles" -DCMAKE_TOOLCHAIN_FILE=toolchain -DCMAKE_INSTALL_PREFIX=/ -DCMAKE_VERBOSE_MAKEFILE=on -DWITH_LIBMETAL_FIND=off -DWITH_EXT_INCLUDES_FIND=off -DWITH_PROXY=${with_proxy} -DWITH_DCACHE_BUFFERS=${with_dcache_buffers} "../src/open-amp" } msg] } {
 			puts "${msg}"
 			error "Failed to generate cmake files."
 		} else {
@@ -10,6 +10,7 @@
 
 #include <openamp/rpmsg.h>
 #include <openamp/rpmsg_virtio.h>
+#include <openamp/rpmsg_bulk.h>
 #include <openamp/remoteproc.h>
 #include <openamp/remoteproc_virtio.h>
 
@@ -362,6 +362,7 @@ struct remoteproc_mem {
  * @bitmap: bitmap for notify IDs for remoteproc subdevices
  * @state: remote processor state
  * @priv: private data
+ * @polling: virtqueues are polled, the remote is not notified
  */
 struct remoteproc {
 	metal_mutex_t lock;
@@ -376,6 +377,7 @@ struct remoteproc {
 	struct loader_ops *loader;
 	unsigned int state;
 	void *priv;
+	int polling;
 };
 
 /**
@@ -834,6 +836,30 @@ void remoteproc_remove_virtio(struct remoteproc *rproc,
  */
 int remoteproc_get_notification(struct remoteproc *rproc,
 				uint32_t notifyid);
+
+/* remoteproc_set_polling
+ *
+ * Select the polling transport for the remoteproc. In polling mode the
+ * virtqueues are not kicked, the ops->notify() IPI is never raised, and
+ * each side has to call remoteproc_poll() to process its virtqueues. It is
+ * meant for a core dedicated to the communication, and both sides have to
+ * poll.
+ *
+ * @rproc - pointer to the remoteproc instance
+ * @enable - nonzero to poll, 0 to use notifications
+ */
+void remoteproc_set_polling(struct remoteproc *rproc, int enable);
+
+/* remoteproc_poll
+ *
+ * Check the virtqueues of the remoteproc virtio devices and process the
+ * ones the remote has made buffers available in, as a notification would.
+ *
+ * @rproc - pointer to the remoteproc instance
+ *
+ * return number of virtqueues processed
+ */
+int remoteproc_poll(struct remoteproc *rproc);
 #if defined __cplusplus
 }
 #endif
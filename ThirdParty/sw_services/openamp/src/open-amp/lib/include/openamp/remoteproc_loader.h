@@ -34,6 +34,8 @@ extern "C" {
 
 /* Loader feature macros */
 #define SUPPORT_SEEK 1UL
+/* Target loads can be queued, e.g. to a DMA, and completed by ->wait() */
+#define SUPPORT_ASYNC 2UL
 
 /* Remoteproc loader any address */
 #define RPROC_LOAD_ANYADDR ((metal_phys_addr_t)-1)
@@ -62,6 +64,15 @@ extern "C" {
  * @load: user defined callback to load the firmware contents to target
  *        memory or local memory
  * @features: loader supported features. e.g. seek
+ * @fill: optional callback to fill target memory with a value, e.g. with a
+ *        DMA; used for the segment padding (BSS) with SUPPORT_ASYNC
+ * @wait: with SUPPORT_ASYNC, callback to wait for the completion of all the
+ *        target loads and fills queued with is_blocking == 0
+ *
+ * With SUPPORT_ASYNC, the segments are loaded to target memory with
+ * is_blocking == 0: @load and @fill may return as soon as the copy is
+ * queued, so that the copies of all the segments run concurrently, and
+ * remoteproc_load() calls @wait once all the segments are issued.
  */
 struct image_store_ops {
 	int (*open)(void *store, const char *path, const void **img_data);
@@ -71,6 +82,10 @@ struct image_store_ops {
 		    metal_phys_addr_t pa,
 		    struct metal_io_region *io, char is_blocking);
 	unsigned int features;
+	int (*fill)(void *store, metal_phys_addr_t pa,
+		    struct metal_io_region *io, unsigned char value,
+		    size_t size, char is_blocking);
+	int (*wait)(void *store);
 };
 
 /**
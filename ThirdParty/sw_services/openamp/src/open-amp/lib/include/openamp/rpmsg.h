@@ -87,6 +87,7 @@ struct rpmsg_endpoint {
  * @release_rx_buffer: release RPMsg RX buffer
  * @get_tx_payload_buffer: get RPMsg TX buffer
  * @send_offchannel_nocopy: send RPMsg data without copy
+ * @send_offchannel_batch: send several RPMsg messages with one notification
  */
 struct rpmsg_device_ops {
 	int (*send_offchannel_raw)(struct rpmsg_device *rdev,
@@ -99,6 +100,10 @@ struct rpmsg_device_ops {
 	int (*send_offchannel_nocopy)(struct rpmsg_device *rdev,
 				      uint32_t src, uint32_t dst,
 				       const void *data, int len);
+	int (*send_offchannel_batch)(struct rpmsg_device *rdev,
+				     uint32_t src, uint32_t dst,
+				     const void *const data[], const int len[],
+				     int count, int wait);
 };
 
 /**
@@ -276,6 +281,54 @@ static inline int rpmsg_trysend_offchannel(struct rpmsg_endpoint *ept,
 	return rpmsg_send_offchannel_raw(ept, src, dst, data, len, false);
 }
 
+/**
+ * rpmsg_send_offchannel_batch() - send several messages across to the remote
+ * processor, specifying source and destination address.
+ * @ept: the rpmsg endpoint
+ * @src: source address
+ * @dst: destination address
+ * @data: payloads of the messages
+ * @len: lengths of the payloads
+ * @count: number of messages
+ * @wait: boolean, wait or not for buffers to become available
+ *
+ * This function sends the @count messages @data[i] of length @len[i] to the
+ * remote @dst address from the source @src address. The messages are queued
+ * under one lock and the remote processor is notified once for the whole
+ * batch, rather than once per message.
+ * If the TX buffers run out, the queued messages are handed to the remote
+ * processor and, with @wait, the function waits for buffers to become
+ * available as rpmsg_send() does.
+ *
+ * Returns number of messages it has sent or negative error value on failure.
+ */
+int rpmsg_send_offchannel_batch(struct rpmsg_endpoint *ept, uint32_t src,
+				uint32_t dst, const void *const data[],
+				const int len[], int count, int wait);
+
+/**
+ * rpmsg_send_batch() - send several messages across to the remote processor
+ * @ept: the rpmsg endpoint
+ * @data: payloads of the messages
+ * @len: lengths of the payloads
+ * @count: number of messages
+ *
+ * This function sends the @count messages @data[i] of length @len[i] on the
+ * @ept channel, using @ept's source and destination addresses, with a single
+ * notification of the remote processor.
+ * In case there are no TX buffers available, the function will block until
+ * they become available, or a timeout of 15 seconds elapses.
+ *
+ * Returns number of messages it has sent or negative error value on failure.
+ */
+static inline int rpmsg_send_batch(struct rpmsg_endpoint *ept,
+				   const void *const data[], const int len[],
+				   int count)
+{
+	return rpmsg_send_offchannel_batch(ept, ept->addr, ept->dest_addr,
+					   data, len, count, true);
+}
+
 /**
  * @brief Holds the rx buffer for usage outside the receive callback.
  *
@@ -0,0 +1,183 @@
+/*
+ * Zero-copy bulk transfers over RPMsg
+ *
+ * Copyright (C) 2026 Xilinx, Inc.
+ *
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _RPMSG_BULK_H_
+#define _RPMSG_BULK_H_
+
+#include <metal/io.h>
+#include <metal/mutex.h>
+#include <metal/utilities.h>
+#include <openamp/rpmsg.h>
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+/* Configurable parameters */
+#ifndef RPMSG_BULK_MAX_BUFS
+#define RPMSG_BULK_MAX_BUFS	(64)
+#endif
+
+/* Bulk message types */
+#define RPMSG_BULK_DATA		0 /* buffer handed to the remote */
+#define RPMSG_BULK_RELEASE	1 /* buffer handed back to its owner */
+
+struct rpmsg_bulk;
+
+/**
+ * typedef rpmsg_bulk_cb - bulk buffer received callback
+ * @bulk: the bulk channel
+ * @data: the received buffer, in shared memory
+ * @len: length of the data in the buffer
+ * @priv: private data of the bulk channel
+ *
+ * The buffer is handed back to the remote when the callback returns, unless
+ * the callback holds it with rpmsg_bulk_hold_buffer().
+ */
+typedef int (*rpmsg_bulk_cb)(struct rpmsg_bulk *bulk, void *data,
+			     size_t len, void *priv);
+
+/**
+ * struct rpmsg_bulk_msg - bulk message sent over the RPMsg endpoint
+ * @type: RPMSG_BULK_DATA or RPMSG_BULK_RELEASE
+ * @len: length of the data in the buffer
+ * @pa: physical address of the buffer
+ */
+METAL_PACKED_BEGIN
+struct rpmsg_bulk_msg {
+	uint32_t type;
+	uint32_t len;
+	uint64_t pa;
+} METAL_PACKED_END;
+
+/**
+ * struct rpmsg_bulk - zero-copy bulk channel
+ * @ept: RPMsg endpoint carrying the buffer handles
+ * @io: shared memory I/O region holding the buffers of both sides
+ * @base: base of the local buffer pool
+ * @buf_size: size of a buffer of the pool
+ * @num_bufs: number of buffers in the pool
+ * @bitmap: buffers of the pool in use
+ * @lock: protects the bitmap
+ * @held: set while the receive callback holds its buffer
+ * @cb: buffer received callback
+ * @priv: private data passed to the callback
+ *
+ * Each side sends buffers from its own pool. A received buffer stays owned
+ * by the sender until the receiver hands it back, so no copy is made and
+ * the pools are never written concurrently by both sides.
+ */
+struct rpmsg_bulk {
+	struct rpmsg_endpoint ept;
+	struct metal_io_region *io;
+	void *base;
+	size_t buf_size;
+	unsigned int num_bufs;
+	unsigned long bitmap[metal_bitmap_longs(RPMSG_BULK_MAX_BUFS)];
+	metal_mutex_t lock;
+	bool held;
+	rpmsg_bulk_cb cb;
+	void *priv;
+};
+
+/**
+ * rpmsg_bulk_init - create a bulk channel
+ *
+ * Create the RPMsg endpoint of the bulk channel and initialize the local
+ * buffer pool. The pool has to be in the shared memory I/O region, which
+ * also has to hold the pool of the remote.
+ *
+ * @bulk: pointer to the bulk channel
+ * @rdev: pointer to the rpmsg device
+ * @name: service name associated to the endpoint
+ * @src: local address of the endpoint
+ * @dest: target address of the endpoint
+ * @io: shared memory I/O region
+ * @pool: base of the local buffer pool
+ * @buf_size: size of a buffer of the pool
+ * @num_bufs: number of buffers in the pool, up to RPMSG_BULK_MAX_BUFS
+ * @cb: buffer received callback
+ * @ns_unbind_cb: end point service unbind callback
+ * @priv: private data passed to the callback
+ *
+ * @return - status of function execution
+ */
+int rpmsg_bulk_init(struct rpmsg_bulk *bulk, struct rpmsg_device *rdev,
+		    const char *name, uint32_t src, uint32_t dest,
+		    struct metal_io_region *io, void *pool, size_t buf_size,
+		    unsigned int num_bufs, rpmsg_bulk_cb cb,
+		    rpmsg_ns_unbind_cb ns_unbind_cb, void *priv);
+
+/**
+ * rpmsg_bulk_deinit - destroy a bulk channel
+ *
+ * @bulk: pointer to the bulk channel
+ */
+void rpmsg_bulk_deinit(struct rpmsg_bulk *bulk);
+
+/**
+ * rpmsg_bulk_get_buffer - get a free buffer of the local pool
+ *
+ * @bulk: pointer to the bulk channel
+ * @len: pointer to store the buffer size
+ *
+ * @return - buffer pointer, or NULL if all buffers are in use
+ */
+void *rpmsg_bulk_get_buffer(struct rpmsg_bulk *bulk, size_t *len);
+
+/**
+ * rpmsg_bulk_put_buffer - return an unsent buffer to the local pool
+ *
+ * @bulk: pointer to the bulk channel
+ * @buf: buffer got by rpmsg_bulk_get_buffer()
+ */
+void rpmsg_bulk_put_buffer(struct rpmsg_bulk *bulk, void *buf);
+
+/**
+ * rpmsg_bulk_send - hand a filled buffer to the remote
+ *
+ * The handle of the buffer is sent in a RPMsg TX buffer without copy. The
+ * buffer is no more owned by the sender until the remote hands it back,
+ * after which it returns to the local pool.
+ *
+ * @bulk: pointer to the bulk channel
+ * @buf: buffer got by rpmsg_bulk_get_buffer()
+ * @len: length of the data in the buffer
+ *
+ * @return - number of bytes sent or negative error value on failure
+ */
+int rpmsg_bulk_send(struct rpmsg_bulk *bulk, void *buf, size_t len);
+
+/**
+ * rpmsg_bulk_hold_buffer - keep a received buffer after the callback
+ *
+ * This API can only be called from the buffer received callback. The buffer
+ * has to be handed back later with rpmsg_bulk_release_buffer().
+ *
+ * @bulk: pointer to the bulk channel
+ * @data: the received buffer
+ */
+void rpmsg_bulk_hold_buffer(struct rpmsg_bulk *bulk, void *data);
+
+/**
+ * rpmsg_bulk_release_buffer - hand a received buffer back to the remote
+ *
+ * @bulk: pointer to the bulk channel
+ * @data: the received buffer
+ *
+ * @return - status of function execution
+ */
+int rpmsg_bulk_release_buffer(struct rpmsg_bulk *bulk, void *data);
+
+#if defined __cplusplus
+}
+#endif
+
+#endif	/* _RPMSG_BULK_H_ */
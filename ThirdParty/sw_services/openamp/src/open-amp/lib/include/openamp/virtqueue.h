@@ -219,6 +219,8 @@ void virtqueue_dump(struct virtqueue *vq);
 
 void virtqueue_notification(struct virtqueue *vq);
 
+int virtqueue_pending(struct virtqueue *vq);
+
 uint32_t virtqueue_get_desc_size(struct virtqueue *vq);
 
 uint32_t virtqueue_get_buffer_length(struct virtqueue *vq, uint16_t idx);
@@ -406,6 +406,7 @@ int remoteproc_load(struct remoteproc *rproc, const char *path,
 	size_t rsc_size = 0;
 	void *rsc_table = NULL;
 	struct metal_io_region *io = NULL;
+	int async = 0;
 
 	if (!rproc)
 		return -RPROC_ENODEV;
@@ -514,6 +515,8 @@ int remoteproc_load(struct remoteproc *rproc, const char *path,
 	metal_log(METAL_LOG_DEBUG, "%s: load executable data\r\n", __func__);
 	offset = 0;
 	len = 0;
+	/* Queue the target loads and wait for them all at the end */
+	async = (store_ops->features & SUPPORT_ASYNC) && store_ops->wait;
 	while (1) {
 		unsigned char padding;
 		size_t nmemsize;
@@ -552,7 +555,8 @@ int remoteproc_load(struct remoteproc *rproc, const char *path,
 			}
 			if (nlen > 0) {
 				ret = store_ops->load(store, noffset, nlen,
-						      &img_data, pa, io, 1);
+						      &img_data, pa, io,
+						      !async);
 				if (ret != (int)nlen) {
 					metal_log(METAL_LOG_ERROR,
 						  "load data failed 0x%lx, 0x%lx, 0x%x\r\n",
@@ -561,7 +565,18 @@ int remoteproc_load(struct remoteproc *rproc, const char *path,
 					goto error3;
 				}
 			}
-			if (nmemsize > nlen) {
+			if (nmemsize > nlen && async && store_ops->fill) {
+				ret = store_ops->fill(store, pa + nlen, io,
+						      padding,
+						      nmemsize - nlen, 0);
+				if (ret != (int)(nmemsize - nlen)) {
+					metal_log(METAL_LOG_ERROR,
+						  "fill data failed 0x%lx, 0x%lx\r\n",
+						  pa + nlen, nmemsize - nlen);
+					ret = -RPROC_EINVAL;
+					goto error3;
+				}
+			} else if (nmemsize > nlen) {
 				size_t tmpoffset;
 
 				tmpoffset = metal_io_phys_to_offset(io,
@@ -594,6 +609,17 @@ int remoteproc_load(struct remoteproc *rproc, const char *path,
 		}
 	}
 
+	if (async) {
+		/* The resource table may be in a loaded segment */
+		async = 0;
+		ret = store_ops->wait(store);
+		if (ret < 0) {
+			metal_log(METAL_LOG_ERROR,
+				  "load data failed to complete %d\r\n", ret);
+			goto error3;
+		}
+	}
+
 	if (rsc_size == 0) {
 		ret = loader->locate_rsc_table(limg_info, &rsc_da,
 					       &offset, &rsc_size);
@@ -652,6 +678,9 @@ int remoteproc_load(struct remoteproc *rproc, const char *path,
 	return 0;
 
 error3:
+	/* Don't leave queued copies running into the target memory */
+	if (async)
+		(void)store_ops->wait(store);
 	if (rsc_table)
 		metal_free_memory(rsc_table);
 error2:
@@ -877,6 +906,10 @@ static int remoteproc_virtio_notify(void *priv, uint32_t id)
 {
 	struct remoteproc *rproc = priv;
 
+	/* The remote polls the virtqueues, no IPI to raise */
+	if (rproc->polling)
+		return 0;
+
 	return rproc->ops->notify(rproc, id);
 }
 
@@ -990,3 +1023,33 @@ int remoteproc_get_notification(struct remoteproc *rproc, uint32_t notifyid)
 	}
 	return 0;
 }
+
+void remoteproc_set_polling(struct remoteproc *rproc, int enable)
+{
+	metal_assert(rproc);
+	rproc->polling = !!enable;
+}
+
+int remoteproc_poll(struct remoteproc *rproc)
+{
+	struct remoteproc_virtio *rpvdev;
+	struct virtio_device *vdev;
+	struct virtqueue *vq;
+	struct metal_list *node;
+	unsigned int i;
+	int num = 0;
+
+	metal_list_for_each(&rproc->vdevs, node) {
+		rpvdev = metal_container_of(node, struct remoteproc_virtio,
+					    node);
+		vdev = &rpvdev->vdev;
+		for (i = 0; i < vdev->vrings_num; i++) {
+			vq = vdev->vrings_info[i].vq;
+			if (vq && virtqueue_pending(vq)) {
+				virtqueue_notification(vq);
+				num++;
+			}
+		}
+	}
+	return num;
+}
@@ -127,6 +127,38 @@ int rpmsg_send_offchannel_raw(struct rpmsg_endpoint *ept, uint32_t src,
 	return RPMSG_ERR_PARAM;
 }
 
+int rpmsg_send_offchannel_batch(struct rpmsg_endpoint *ept, uint32_t src,
+				uint32_t dst, const void *const data[],
+				const int len[], int count, int wait)
+{
+	struct rpmsg_device *rdev;
+	int ret;
+	int i;
+
+	if (!ept || !ept->rdev || !data || !len || count <= 0 ||
+	    dst == RPMSG_ADDR_ANY)
+		return RPMSG_ERR_PARAM;
+
+	rdev = ept->rdev;
+
+	if (rdev->ops.send_offchannel_batch)
+		return rdev->ops.send_offchannel_batch(rdev, src, dst, data,
+						       len, count, wait);
+
+	if (!rdev->ops.send_offchannel_raw)
+		return RPMSG_ERR_PARAM;
+
+	/* No batch support in the transport, send one by one */
+	for (i = 0; i < count; i++) {
+		ret = rdev->ops.send_offchannel_raw(rdev, src, dst, data[i],
+						    len[i], wait);
+		if (ret < 0)
+			return i ? i : ret;
+	}
+
+	return count;
+}
+
 int rpmsg_send_ns_message(struct rpmsg_endpoint *ept, unsigned long flags)
 {
 	struct rpmsg_ns_msg ns_msg;
@@ -0,0 +1,224 @@
+/*
+ * Copyright (C) 2026 Xilinx, Inc.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <metal/cache.h>
+#include <metal/utilities.h>
+#include <openamp/rpmsg_bulk.h>
+
+/**
+ * rpmsg_bulk_send_msg
+ *
+ * Sends a bulk message in a RPMsg TX buffer, without copy.
+ *
+ * @param bulk - pointer to the bulk channel
+ * @param type - message type
+ * @param buf  - buffer the message refers to
+ * @param len  - length of the data in the buffer
+ *
+ * @return - number of bytes sent or negative error value on failure
+ */
+static int rpmsg_bulk_send_msg(struct rpmsg_bulk *bulk, uint32_t type,
+			       void *buf, size_t len)
+{
+	struct rpmsg_bulk_msg *msg;
+	metal_phys_addr_t pa;
+	uint32_t size;
+
+	pa = metal_io_virt_to_phys(bulk->io, buf);
+	if (pa == METAL_BAD_PHYS)
+		return RPMSG_ERR_PARAM;
+
+	msg = rpmsg_get_tx_payload_buffer(&bulk->ept, &size, true);
+	if (!msg)
+		return RPMSG_ERR_NO_BUFF;
+
+	msg->type = type;
+	msg->len = len;
+	msg->pa = pa;
+
+	return rpmsg_send_nocopy(&bulk->ept, msg, sizeof(*msg));
+}
+
+/**
+ * rpmsg_bulk_ept_cb
+ *
+ * Endpoint callback of the bulk channel. A data message passes the buffer
+ * to the bulk callback, a release message returns a buffer to the pool.
+ *
+ * @param ept  - pointer to the bulk endpoint
+ * @param data - pointer to the received message
+ * @param len  - length of the received message
+ * @param src  - source address
+ * @param priv - pointer to the bulk channel
+ *
+ * @return - rpmsg endpoint callback handled
+ */
+static int rpmsg_bulk_ept_cb(struct rpmsg_endpoint *ept, void *data,
+			     size_t len, uint32_t src, void *priv)
+{
+	struct rpmsg_bulk *bulk = priv;
+	struct rpmsg_bulk_msg *msg = data;
+	void *buf;
+
+	(void)ept;
+	(void)src;
+
+	if (len != sizeof(*msg))
+		/* Returns as the message is corrupted */
+		return RPMSG_SUCCESS;
+
+	buf = metal_io_phys_to_virt(bulk->io, msg->pa);
+	if (!buf)
+		return RPMSG_SUCCESS;
+
+	if (msg->type == RPMSG_BULK_RELEASE) {
+		rpmsg_bulk_put_buffer(bulk, buf);
+		return RPMSG_SUCCESS;
+	}
+
+	if (msg->type != RPMSG_BULK_DATA)
+		return RPMSG_SUCCESS;
+
+#ifdef VIRTIO_CACHED_BUFFERS
+	metal_cache_invalidate(buf, msg->len);
+#endif /* VIRTIO_CACHED_BUFFERS */
+
+	bulk->held = false;
+	if (bulk->cb)
+		bulk->cb(bulk, buf, msg->len, bulk->priv);
+
+	/* Check whether callback wants to hold buffer */
+	if (!bulk->held)
+		rpmsg_bulk_release_buffer(bulk, buf);
+
+	return RPMSG_SUCCESS;
+}
+
+int rpmsg_bulk_init(struct rpmsg_bulk *bulk, struct rpmsg_device *rdev,
+		    const char *name, uint32_t src, uint32_t dest,
+		    struct metal_io_region *io, void *pool, size_t buf_size,
+		    unsigned int num_bufs, rpmsg_bulk_cb cb,
+		    rpmsg_ns_unbind_cb ns_unbind_cb, void *priv)
+{
+	int status;
+
+	if (!bulk || !io || !pool || !buf_size || !num_bufs ||
+	    num_bufs > RPMSG_BULK_MAX_BUFS)
+		return RPMSG_ERR_PARAM;
+
+	/* The whole pool has to be reachable by the remote */
+	if (metal_io_virt_to_phys(io, pool) == METAL_BAD_PHYS ||
+	    metal_io_virt_to_phys(io, (char *)pool + buf_size * num_bufs - 1)
+	    == METAL_BAD_PHYS)
+		return RPMSG_ERR_PARAM;
+
+	memset(bulk->bitmap, 0, sizeof(bulk->bitmap));
+	metal_mutex_init(&bulk->lock);
+	bulk->io = io;
+	bulk->base = pool;
+	bulk->buf_size = buf_size;
+	bulk->num_bufs = num_bufs;
+	bulk->held = false;
+	bulk->cb = cb;
+	bulk->priv = priv;
+
+	status = rpmsg_create_ept(&bulk->ept, rdev, name, src, dest,
+				  rpmsg_bulk_ept_cb, ns_unbind_cb);
+	if (status) {
+		metal_mutex_deinit(&bulk->lock);
+		return status;
+	}
+	bulk->ept.priv = bulk;
+
+	return RPMSG_SUCCESS;
+}
+
+void rpmsg_bulk_deinit(struct rpmsg_bulk *bulk)
+{
+	if (!bulk)
+		return;
+
+	rpmsg_destroy_ept(&bulk->ept);
+	metal_mutex_deinit(&bulk->lock);
+}
+
+void *rpmsg_bulk_get_buffer(struct rpmsg_bulk *bulk, size_t *len)
+{
+	unsigned int bit;
+
+	if (!bulk || !len)
+		return NULL;
+
+	metal_mutex_acquire(&bulk->lock);
+	bit = metal_bitmap_next_clear_bit(bulk->bitmap, 0, bulk->num_bufs);
+	if (bit < bulk->num_bufs)
+		metal_bitmap_set_bit(bulk->bitmap, bit);
+	metal_mutex_release(&bulk->lock);
+
+	if (bit >= bulk->num_bufs)
+		return NULL;
+
+	*len = bulk->buf_size;
+	return (char *)bulk->base + bit * bulk->buf_size;
+}
+
+void rpmsg_bulk_put_buffer(struct rpmsg_bulk *bulk, void *buf)
+{
+	size_t offset;
+
+	if (!bulk || (char *)buf < (char *)bulk->base)
+		return;
+
+	offset = (char *)buf - (char *)bulk->base;
+	if (offset % bulk->buf_size ||
+	    offset / bulk->buf_size >= bulk->num_bufs)
+		return;
+
+	metal_mutex_acquire(&bulk->lock);
+	metal_bitmap_clear_bit(bulk->bitmap, offset / bulk->buf_size);
+	metal_mutex_release(&bulk->lock);
+}
+
+int rpmsg_bulk_send(struct rpmsg_bulk *bulk, void *buf, size_t len)
+{
+	int status;
+
+	if (!bulk || !buf || len > bulk->buf_size)
+		return RPMSG_ERR_PARAM;
+
+#ifdef VIRTIO_CACHED_BUFFERS
+	metal_cache_flush(buf, len);
+#endif /* VIRTIO_CACHED_BUFFERS */
+
+	status = rpmsg_bulk_send_msg(bulk, RPMSG_BULK_DATA, buf, len);
+	if (status < 0)
+		return status;
+
+	return (int)len;
+}
+
+void rpmsg_bulk_hold_buffer(struct rpmsg_bulk *bulk, void *data)
+{
+	(void)data;
+
+	if (bulk)
+		bulk->held = true;
+}
+
+int rpmsg_bulk_release_buffer(struct rpmsg_bulk *bulk, void *data)
+{
+	int status;
+
+	if (!bulk || !data)
+		return RPMSG_ERR_PARAM;
+
+	status = rpmsg_bulk_send_msg(bulk, RPMSG_BULK_RELEASE, data, 0);
+	if (status < 0)
+		return status;
+
+	return RPMSG_SUCCESS;
+}
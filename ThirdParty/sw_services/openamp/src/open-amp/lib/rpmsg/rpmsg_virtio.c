@@ -66,6 +66,15 @@ static void rpmsg_virtio_return_buffer(struct rpmsg_virtio_device *rvdev,
 				       uint16_t idx)
 {
 	unsigned int role = rpmsg_virtio_get_role(rvdev);
+
+#ifdef VIRTIO_CACHED_BUFFERS
+	/*
+	 * The header may have been written locally (held status), write it
+	 * back before the other side can reuse the buffer.
+	 */
+	metal_cache_flush(buffer, sizeof(struct rpmsg_hdr));
+#endif /* VIRTIO_CACHED_BUFFERS */
+
 #ifndef VIRTIO_SLAVE_ONLY
 	if (role == RPMSG_MASTER) {
 		struct virtqueue_buf vqbuf;
@@ -105,7 +114,10 @@ static int rpmsg_virtio_enqueue_buffer(struct rpmsg_virtio_device *rvdev,
 	unsigned int role = rpmsg_virtio_get_role(rvdev);
 
 #ifdef VIRTIO_CACHED_BUFFERS
-	metal_cache_flush(buffer, len);
+	/* Only the header and the message it announces need to be flushed */
+	metal_cache_flush(buffer,
+			  metal_min(sizeof(struct rpmsg_hdr) +
+				    ((struct rpmsg_hdr *)buffer)->len, len));
 #endif /* VIRTIO_CACHED_BUFFERS */
 
 #ifndef VIRTIO_SLAVE_ONLY
@@ -199,8 +211,19 @@ static void *rpmsg_virtio_get_rx_buffer(struct rpmsg_virtio_device *rvdev,
 #endif /*!VIRTIO_MASTER_ONLY*/
 
 #ifdef VIRTIO_CACHED_BUFFERS
-	/* Invalidate the buffer before returning it */
-	metal_cache_invalidate(data, *len);
+	/*
+	 * Invalidate the buffer before returning it: the header first, then
+	 * only the message it announces rather than the whole buffer.
+	 */
+	if (data) {
+		struct rpmsg_hdr *rp_hdr = data;
+
+		metal_cache_invalidate(rp_hdr, sizeof(*rp_hdr));
+		if (*len > sizeof(*rp_hdr))
+			metal_cache_invalidate(RPMSG_LOCATE_DATA(rp_hdr),
+					       metal_min(rp_hdr->len,
+							 *len - sizeof(*rp_hdr)));
+	}
 #endif /* VIRTIO_CACHED_BUFFERS */
 
 	return data;
@@ -444,6 +467,151 @@ static int rpmsg_virtio_send_offchannel_raw(struct rpmsg_device *rdev,
 	return rpmsg_virtio_send_offchannel_nocopy(rdev, src, dst, buffer, len);
 }
 
+/**
+ * This function sends several rpmsg messages to remote device, notifying it
+ * once for the whole batch.
+ *
+ * @param rdev    - pointer to rpmsg device
+ * @param src     - source address of channel
+ * @param dst     - destination address of channel
+ * @param data    - payloads of the messages
+ * @param len     - sizes of the payloads
+ * @param count   - number of messages
+ * @param wait    - boolean, wait or not for buffers to become
+ *                  available
+ *
+ * @return - number of messages sent or negative value for failure.
+ *
+ */
+static int rpmsg_virtio_send_offchannel_batch(struct rpmsg_device *rdev,
+					      uint32_t src, uint32_t dst,
+					      const void *const data[],
+					      const int len[], int count,
+					      int wait)
+{
+	struct rpmsg_virtio_device *rvdev;
+	struct metal_io_region *io;
+	struct rpmsg_hdr rp_hdr;
+	struct rpmsg_hdr *hdr;
+	uint32_t buff_len;
+	uint16_t idx;
+	int tick_count;
+	int queued = 0;
+	int sent = 0;
+	int msg_len;
+	int status;
+
+	/* Get the associated remote device for channel. */
+	rvdev = metal_container_of(rdev, struct rpmsg_virtio_device, rdev);
+	io = rvdev->shbuf_io;
+
+	/* Validate device state */
+	status = rpmsg_virtio_get_status(rvdev);
+	if (!(status & VIRTIO_CONFIG_STATUS_DRIVER_OK))
+		return RPMSG_ERR_DEV_STATE;
+
+	if (wait)
+		tick_count = RPMSG_TICK_COUNT / RPMSG_TICKS_PER_INTERVAL;
+	else
+		tick_count = 0;
+
+	/* Lock the device to enable exclusive access to virtqueues */
+	metal_mutex_acquire(&rdev->lock);
+
+	while (sent < count) {
+		hdr = rpmsg_virtio_get_tx_buffer(rvdev, &buff_len, &idx);
+		if (!hdr) {
+			/*
+			 * Hand the queued messages to the other side so it
+			 * can give buffers back, then wait for them.
+			 */
+			if (queued) {
+				virtqueue_kick(rvdev->svq);
+				queued = 0;
+			}
+			if (!tick_count)
+				break;
+			metal_mutex_release(&rdev->lock);
+			metal_sleep_usec(RPMSG_TICKS_PER_INTERVAL);
+			tick_count--;
+			metal_mutex_acquire(&rdev->lock);
+			continue;
+		}
+
+#ifndef VIRTIO_SLAVE_ONLY
+		if (rpmsg_virtio_get_role(rvdev) == RPMSG_MASTER)
+			buff_len = RPMSG_BUFFER_SIZE;
+		else
+#endif /*!VIRTIO_SLAVE_ONLY*/
+			buff_len = virtqueue_get_buffer_length(rvdev->svq, idx);
+
+		msg_len = len[sent];
+		if (msg_len > (int)(buff_len - sizeof(struct rpmsg_hdr)))
+			msg_len = buff_len - sizeof(struct rpmsg_hdr);
+
+		/* Initialize RPMSG header. */
+		rp_hdr.dst = dst;
+		rp_hdr.src = src;
+		rp_hdr.len = msg_len;
+		rp_hdr.reserved = 0;
+		rp_hdr.flags = 0;
+
+		/* Copy header and data to rpmsg buffer. */
+		status = metal_io_block_write(io,
+					      metal_io_virt_to_offset(io, hdr),
+					      &rp_hdr, sizeof(rp_hdr));
+		RPMSG_ASSERT(status == sizeof(rp_hdr),
+			     "failed to write header\r\n");
+		status = metal_io_block_write(io,
+					      metal_io_virt_to_offset(io,
+						RPMSG_LOCATE_DATA(hdr)),
+					      data[sent], msg_len);
+		RPMSG_ASSERT(status == msg_len, "failed to write buffer\r\n");
+
+		/* Enqueue buffer on virtqueue. */
+		status = rpmsg_virtio_enqueue_buffer(rvdev, hdr, buff_len, idx);
+		RPMSG_ASSERT(status == VQUEUE_SUCCESS,
+			     "failed to enqueue buffer\r\n");
+		queued++;
+		sent++;
+	}
+
+	/* Let the other side know once that there are jobs to process. */
+	if (queued)
+		virtqueue_kick(rvdev->svq);
+
+	metal_mutex_release(&rdev->lock);
+
+	return sent ? sent : RPMSG_ERR_NO_BUFF;
+}
+
+/**
+ * rpmsg_virtio_rx_rearm
+ *
+ * Re-enables the Rx notifications after the Rx virtqueue has been drained.
+ * A buffer received while the notifications were suppressed would not be
+ * notified, so it is returned to be processed by the caller.
+ *
+ * @param rvdev - pointer to rpmsg device
+ * @param len  - size of received buffer
+ * @param idx  - index of buffer
+ *
+ * @return - pointer to received buffer, NULL once notifications are enabled
+ *
+ */
+static void *rpmsg_virtio_rx_rearm(struct rpmsg_virtio_device *rvdev,
+				   uint32_t *len, uint16_t *idx)
+{
+	void *data = NULL;
+
+	while (!data && virtqueue_enable_cb(rvdev->rvq)) {
+		virtqueue_disable_cb(rvdev->rvq);
+		data = rpmsg_virtio_get_rx_buffer(rvdev, len, idx);
+	}
+
+	return data;
+}
+
 /**
  * rpmsg_virtio_tx_callback
  *
@@ -479,8 +647,16 @@ static void rpmsg_virtio_rx_callback(struct virtqueue *vq)
 
 	metal_mutex_acquire(&rdev->lock);
 
+	/*
+	 * Suppress the notifications while the received buffers are drained,
+	 * the remote node doesn't have to raise one per message.
+	 */
+	virtqueue_disable_cb(rvdev->rvq);
+
 	/* Process the received data from remote node */
 	rp_hdr = rpmsg_virtio_get_rx_buffer(rvdev, &len, &idx);
+	if (!rp_hdr)
+		rp_hdr = rpmsg_virtio_rx_rearm(rvdev, &len, &idx);
 
 	metal_mutex_release(&rdev->lock);
 
@@ -519,6 +695,7 @@ static void rpmsg_virtio_rx_callback(struct virtqueue *vq)
 		if (!rp_hdr) {
 			/* tell peer we return some rx buffer */
 			virtqueue_kick(rvdev->rvq);
+			rp_hdr = rpmsg_virtio_rx_rearm(rvdev, &len, &idx);
 		}
 		metal_mutex_release(&rdev->lock);
 	}
@@ -628,6 +805,7 @@ int rpmsg_init_vdev(struct rpmsg_virtio_device *rvdev,
 	rdev->ops.release_rx_buffer = rpmsg_virtio_release_rx_buffer;
 	rdev->ops.get_tx_payload_buffer = rpmsg_virtio_get_tx_payload_buffer;
 	rdev->ops.send_offchannel_nocopy = rpmsg_virtio_send_offchannel_nocopy;
+	rdev->ops.send_offchannel_batch = rpmsg_virtio_send_offchannel_batch;
 	role = rpmsg_virtio_get_role(rvdev);
 
 #ifndef VIRTIO_MASTER_ONLY
@@ -417,8 +417,8 @@ void virtqueue_dump(struct virtqueue *vq)
 	if (!vq)
 		return;
 
-	VRING_INVALIDATE(vq->vq_ring.avail);
-	VRING_INVALIDATE(vq->vq_ring.used);
+	VRING_INVALIDATE(*vq->vq_ring.avail);
+	VRING_INVALIDATE(*vq->vq_ring.used);
 
 	metal_log(METAL_LOG_DEBUG,
 		  "VQ: %s - size=%d; free=%d; queued=%d; "
@@ -693,6 +693,28 @@ static int vq_ring_enable_interrupt(struct virtqueue *vq, uint16_t ndesc)
 	return 0;
 }
 
+/**
+ * virtqueue_pending - Checks for buffers the other side has made available
+ *                     to us, without notification
+ *
+ * @param vq            - Pointer to VirtIO queue control block
+ *
+ * @return              - Number of buffers to process
+ */
+int virtqueue_pending(struct virtqueue *vq)
+{
+#ifndef VIRTIO_SLAVE_ONLY
+	if (vq->vq_dev->role == VIRTIO_DEV_MASTER)
+		return virtqueue_nused(vq);
+#endif /*VIRTIO_SLAVE_ONLY*/
+#ifndef VIRTIO_MASTER_ONLY
+	if (vq->vq_dev->role == VIRTIO_DEV_SLAVE)
+		return virtqueue_navail(vq);
+#endif /*VIRTIO_MASTER_ONLY*/
+
+	return 0;
+}
+
 /**
  *
  * virtqueue_interrupt
@@ -0,0 +1,443 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaiedma_ring.c
+* @{
+*
+* This file contains the routines to set up and run the Tile and Shim DMA
+* buffer rings.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  ag      10/15/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+#include "xaiegbl_defs.h"
+#include "xaiegbl.h"
+#include "xaiedma_ring.h"
+#include "xaietile_event.h"
+#include "xaietile_lock.h"
+#include "xaietile_perfcnt.h"
+
+/***************************** Include Files *********************************/
+
+/***************************** Macro Definitions *****************************/
+
+/************************** Variable Definitions *****************************/
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This is an internal API to set the members common to the Tile and Shim
+* rings.
+*
+* @param	RingPtr - Pointer to the ring instance.
+* @param	TileInstPtr - Pointer to the Tile instance.
+* @param	ChNum - Channel number (0-S2MM0,1-S2MM1,2-MM2S0,3-MM2S1).
+* @param	NumBufs - Number of buffers, ranging from 1-16.
+* @param	BdNum - BD of each buffer.
+* @param	LockId - Lock of each buffer.
+* @param	Length - Buffer length in bytes.
+*
+* @return	None.
+*
+* @note		Used only in this file.
+*
+*******************************************************************************/
+static void XAieDma_RingSetup(XAieDma_Ring *RingPtr, XAieGbl_Tile *TileInstPtr,
+		u8 ChNum, u8 NumBufs, const u8 *BdNum, const u8 *LockId,
+		u32 Length)
+{
+	u8 Idx;
+
+	RingPtr->TileInstPtr = TileInstPtr;
+	RingPtr->ChNum = ChNum;
+	RingPtr->NumBufs = NumBufs;
+	for(Idx = 0U; Idx < NumBufs; Idx++) {
+		RingPtr->BdNum[Idx] = BdNum[Idx];
+		RingPtr->LockId[Idx] = LockId[Idx];
+	}
+
+	/* MM2S consumes the full buffers, S2MM fills the empty ones */
+	if(ChNum >= XAIEDMA_TILE_CHNUM_MM2S0) {
+		RingPtr->AppAcqVal = XAIETILE_LOCK_ACQ_VAL0;
+	} else {
+		RingPtr->AppAcqVal = XAIETILE_LOCK_ACQ_VAL1;
+	}
+
+	RingPtr->Head = 0U;
+	RingPtr->Held = 0U;
+	RingPtr->PerfCounter = XAIEDMA_RING_PERFCNT_INVALID;
+	RingPtr->Length = Length;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sets up a ring of Tile DMA BDs. The BDs are chained in a loop and
+* written to the physical BD locations, but the channel is not started.
+*
+* @param	RingPtr - Pointer to the ring instance.
+* @param	TileInstPtr - Pointer to the Tile instance.
+* @param	DmaInstPtr - Pointer to the initialized Tile DMA instance.
+* @param	ChNum - Channel number (0-S2MM0,1-S2MM1,2-MM2S0,3-MM2S1).
+* @param	NumBufs - Number of buffers, ranging from 1-16.
+* @param	BdNum - BD of each buffer, ranging from 0-15.
+* @param	LockId - Lock of each buffer, ranging from 0-15.
+* @param	BufAddr - Data memory address of each buffer (32b aligned).
+* @param	Length - Buffer length in bytes.
+*
+* @return	XAIE_SUCCESS if successful, else XAIE_FAILURE.
+*
+* @note		The other BD attributes can be set with the BD APIs followed by
+*		XAieDma_TileBdWrite() before the ring is started.
+*
+*******************************************************************************/
+u32 XAieDma_TileRingInitialize(XAieDma_Ring *RingPtr, XAieGbl_Tile *TileInstPtr,
+		XAieDma_Tile *DmaInstPtr, u8 ChNum, u8 NumBufs, const u8 *BdNum,
+		const u8 *LockId, const u16 *BufAddr, u16 Length)
+{
+	u8 Idx;
+	u8 DmaAcqVal;
+
+	XAie_AssertNonvoid(RingPtr != XAIE_NULL);
+	XAie_AssertNonvoid(TileInstPtr != XAIE_NULL);
+	XAie_AssertNonvoid(DmaInstPtr != XAIE_NULL);
+	XAie_AssertNonvoid(DmaInstPtr->IsReady == XAIE_COMPONENT_IS_READY);
+	XAie_AssertNonvoid(ChNum < XAIEDMA_TILE_MAX_NUM_CHANNELS);
+	XAie_AssertNonvoid(NumBufs > 0U && NumBufs <= XAIEDMA_RING_MAX_NUM_BUFS);
+	XAie_AssertNonvoid(BdNum != XAIE_NULL);
+	XAie_AssertNonvoid(LockId != XAIE_NULL);
+	XAie_AssertNonvoid(BufAddr != XAIE_NULL);
+
+	XAieDma_RingSetup(RingPtr, TileInstPtr, ChNum, NumBufs, BdNum, LockId,
+			Length);
+	RingPtr->TileDmaPtr = DmaInstPtr;
+	RingPtr->ShimDmaPtr = XAIE_NULL;
+	DmaAcqVal = !RingPtr->AppAcqVal;
+
+	for(Idx = 0U; Idx < NumBufs; Idx++) {
+		XAieDma_TileBdClear(DmaInstPtr, BdNum[Idx]);
+		XAieDma_TileBdSetLock(DmaInstPtr, BdNum[Idx],
+				XAIEDMA_TILE_BD_ADDRA, LockId[Idx], XAIE_ENABLE,
+				!DmaAcqVal, XAIE_ENABLE, DmaAcqVal);
+		XAieDma_TileBdSetAdrLenMod(DmaInstPtr, BdNum[Idx],
+				BufAddr[Idx], 0U, Length, XAIE_DISABLE, 0U);
+		XAieDma_TileBdSetNext(DmaInstPtr, BdNum[Idx],
+				BdNum[(Idx + 1U) % NumBufs]);
+		XAieDma_TileBdWrite(DmaInstPtr, BdNum[Idx]);
+	}
+
+	return XAIE_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sets up a ring of Shim DMA BDs. The BDs are chained in a loop and
+* written to the physical BD locations, but the channel is not started.
+*
+* @param	RingPtr - Pointer to the ring instance.
+* @param	TileInstPtr - Pointer to the Shim Tile instance.
+* @param	DmaInstPtr - Pointer to the initialized Shim DMA instance.
+* @param	ChNum - Channel number (0-S2MM0,1-S2MM1,2-MM2S0,3-MM2S1).
+* @param	NumBufs - Number of buffers, ranging from 1-16.
+* @param	BdNum - BD of each buffer, ranging from 0-15.
+* @param	LockId - Lock of each buffer, ranging from 0-15.
+* @param	BufAddr - 48-bit address of each buffer (128b aligned).
+* @param	Length - Buffer length in bytes.
+*
+* @return	XAIE_SUCCESS if successful, else XAIE_FAILURE.
+*
+* @note		The AXI attributes can be set with XAieDma_ShimBdSetAxi()
+*		followed by XAieDma_ShimBdWrite() before the ring is started.
+*
+*******************************************************************************/
+u32 XAieDma_ShimRingInitialize(XAieDma_Ring *RingPtr, XAieGbl_Tile *TileInstPtr,
+		XAieDma_Shim *DmaInstPtr, u8 ChNum, u8 NumBufs, const u8 *BdNum,
+		const u8 *LockId, const u64 *BufAddr, u32 Length)
+{
+	u8 Idx;
+	u8 DmaAcqVal;
+
+	XAie_AssertNonvoid(RingPtr != XAIE_NULL);
+	XAie_AssertNonvoid(TileInstPtr != XAIE_NULL);
+	XAie_AssertNonvoid(DmaInstPtr != XAIE_NULL);
+	XAie_AssertNonvoid(ChNum < XAIEDMA_SHIM_MAX_NUM_CHANNELS);
+	XAie_AssertNonvoid(NumBufs > 0U && NumBufs <= XAIEDMA_RING_MAX_NUM_BUFS);
+	XAie_AssertNonvoid(BdNum != XAIE_NULL);
+	XAie_AssertNonvoid(LockId != XAIE_NULL);
+	XAie_AssertNonvoid(BufAddr != XAIE_NULL);
+
+	XAieDma_RingSetup(RingPtr, TileInstPtr, ChNum, NumBufs, BdNum, LockId,
+			Length);
+	RingPtr->TileDmaPtr = XAIE_NULL;
+	RingPtr->ShimDmaPtr = DmaInstPtr;
+	DmaAcqVal = !RingPtr->AppAcqVal;
+
+	for(Idx = 0U; Idx < NumBufs; Idx++) {
+		XAieDma_ShimBdClear(DmaInstPtr, BdNum[Idx]);
+		XAieDma_ShimBdSetLock(DmaInstPtr, BdNum[Idx], LockId[Idx],
+				XAIE_ENABLE, !DmaAcqVal, XAIE_ENABLE,
+				DmaAcqVal);
+		XAieDma_ShimBdSetAddr(DmaInstPtr, BdNum[Idx],
+				(u16)(BufAddr[Idx] >> 32U), (u32)BufAddr[Idx],
+				Length);
+		XAieDma_ShimBdSetNext(DmaInstPtr, BdNum[Idx],
+				BdNum[(Idx + 1U) % NumBufs]);
+		XAieDma_ShimBdWrite(DmaInstPtr, BdNum[Idx]);
+	}
+
+	return XAIE_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API starts the channel of the ring at its first buffer. From then on
+* the channel walks the ring as the application releases the buffers.
+*
+* @param	RingPtr - Pointer to the ring instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+void XAieDma_RingStart(XAieDma_Ring *RingPtr)
+{
+	XAie_AssertVoid(RingPtr != XAIE_NULL);
+
+	if(RingPtr->TileDmaPtr != XAIE_NULL) {
+		XAieDma_TileSetStartBd(RingPtr->TileDmaPtr, RingPtr->ChNum,
+				RingPtr->BdNum[0U]);
+		(void)XAieDma_TileChControl(RingPtr->TileDmaPtr, RingPtr->ChNum,
+				XAIE_RESETDISABLE, XAIE_ENABLE);
+	} else {
+		XAieDma_ShimSetStartBd(RingPtr->ShimDmaPtr, RingPtr->ChNum,
+				RingPtr->BdNum[0U]);
+		XAieDma_ShimChControl(RingPtr->ShimDmaPtr, RingPtr->ChNum,
+				XAIE_DISABLE, XAIE_DISABLE, XAIE_ENABLE);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API acquires the next buffer of the ring for the application: an
+* empty buffer to fill for MM2S, a full buffer to consume for S2MM.
+*
+* @param	RingPtr - Pointer to the ring instance.
+* @param	TimeOut - Time-out in usecs. 0 to try once.
+* @param	BufIdx - Set to the index of the acquired buffer.
+*
+* @return	XAIE_SUCCESS if the buffer is acquired, XAIE_FAILURE if the
+*		DMA still owns it.
+*
+* @note		Acquiring again before releasing returns the same buffer.
+*
+*******************************************************************************/
+u32 XAieDma_RingAcquire(XAieDma_Ring *RingPtr, u32 TimeOut, u8 *BufIdx)
+{
+	XAie_AssertNonvoid(RingPtr != XAIE_NULL);
+	XAie_AssertNonvoid(BufIdx != XAIE_NULL);
+
+	if(RingPtr->Held == 0U) {
+		if(XAieTile_LockAcquire(RingPtr->TileInstPtr,
+				RingPtr->LockId[RingPtr->Head],
+				RingPtr->AppAcqVal, TimeOut) !=
+				XAIETILE_LOCK_ACQ_SUCCESS) {
+			return XAIE_FAILURE;
+		}
+		RingPtr->Held = 1U;
+	}
+
+	*BufIdx = RingPtr->Head;
+
+	return XAIE_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API hands the acquired buffer back to the DMA and moves the
+* application to the next buffer of the ring.
+*
+* @param	RingPtr - Pointer to the ring instance.
+*
+* @return	XAIE_SUCCESS if successful, else XAIE_FAILURE.
+*
+* @note		None.
+*
+*******************************************************************************/
+u32 XAieDma_RingRelease(XAieDma_Ring *RingPtr)
+{
+	XAie_AssertNonvoid(RingPtr != XAIE_NULL);
+
+	if(RingPtr->Held == 0U) {
+		return XAIE_FAILURE;
+	}
+
+	if(XAieTile_LockRelease(RingPtr->TileInstPtr,
+			RingPtr->LockId[RingPtr->Head], !RingPtr->AppAcqVal,
+			0U) != XAIETILE_LOCK_REL_SUCCESS) {
+		return XAIE_FAILURE;
+	}
+
+	RingPtr->Held = 0U;
+	RingPtr->Head = (RingPtr->Head + 1U) % RingPtr->NumBufs;
+
+	return XAIE_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API reloads the address of a buffer of the ring, for example to move
+* to the next frame of a larger memory region.
+*
+* @param	RingPtr - Pointer to the ring instance.
+* @param	BufIdx - Index of the buffer.
+* @param	Addr - Data memory address for a Tile ring, 48-bit address for
+*		a Shim ring.
+*
+* @return	None.
+*
+* @note		The buffer has to be held by the application, so the DMA
+*		doesn't use the BD while it is rewritten.
+*
+*******************************************************************************/
+void XAieDma_RingSetAddr(XAieDma_Ring *RingPtr, u8 BufIdx, u64 Addr)
+{
+	u8 BdNum;
+	XAieDma_TileBd *DescrPtr;
+
+	XAie_AssertVoid(RingPtr != XAIE_NULL);
+	XAie_AssertVoid(BufIdx < RingPtr->NumBufs);
+
+	BdNum = RingPtr->BdNum[BufIdx];
+
+	if(RingPtr->TileDmaPtr != XAIE_NULL) {
+		XAie_AssertVoid((Addr & XAIEDMA_TILE_ADDRAB_ALIGN_MASK) == 0U);
+		DescrPtr = &RingPtr->TileDmaPtr->Descrs[BdNum];
+		DescrPtr->AddrA.BaseAddr =
+			(u16)(Addr >> XAIEDMA_TILE_ADDRAB_ALIGN_OFFSET);
+		XAieDma_TileBdWrite(RingPtr->TileDmaPtr, BdNum);
+	} else {
+		XAieDma_ShimBdSetAddr(RingPtr->ShimDmaPtr, BdNum,
+				(u16)(Addr >> 32U), (u32)Addr, RingPtr->Length);
+		XAieDma_ShimBdWrite(RingPtr->ShimDmaPtr, BdNum);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sets up a performance counter of the memory module (Tile ring) or
+* PL module (Shim ring) to count the BDs finished by the ring channel.
+*
+* @param	RingPtr - Pointer to the ring instance.
+* @param	Counter - Counter ID. 0 or 1.
+*
+* @return	XAIE_SUCCESS if successful, else XAIE_FAILURE.
+*
+* @note		The counter uses the finished BD event of the channel as both
+*		start and stop event, which counts the event occurrences.
+*
+*******************************************************************************/
+u32 XAieDma_RingPerfEnable(XAieDma_Ring *RingPtr, u8 Counter)
+{
+	u16 Event;
+	u32 Status;
+
+	XAie_AssertNonvoid(RingPtr != XAIE_NULL);
+
+	if(RingPtr->TileDmaPtr != XAIE_NULL) {
+		Event = XAIETILE_EVENT_MEM_DMA_S2MM_0_FINISHED_BD +
+			RingPtr->ChNum;
+		Status = XAieTileMem_PerfCounterControl(RingPtr->TileInstPtr,
+				Counter, Event, Event, XAIETILE_EVENT_MEM_NONE);
+		if(Status == XAIE_SUCCESS) {
+			Status = XAieTileMem_PerfCounterSet(
+					RingPtr->TileInstPtr, Counter, 0U);
+		}
+	} else {
+		Event = XAIETILE_EVENT_SHIM_DMA_S2MM_0_FINISHED_BD_NOC +
+			RingPtr->ChNum;
+		Status = XAieTilePl_PerfCounterControl(RingPtr->TileInstPtr,
+				Counter, Event, Event, XAIETILE_EVENT_SHIM_NONE);
+		if(Status == XAIE_SUCCESS) {
+			Status = XAieTilePl_PerfCounterSet(
+					RingPtr->TileInstPtr, Counter, 0U);
+		}
+	}
+
+	if(Status == XAIE_SUCCESS) {
+		RingPtr->PerfCounter = Counter;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the number of buffers the ring channel has finished since
+* XAieDma_RingPerfEnable().
+*
+* @param	RingPtr - Pointer to the ring instance.
+*
+* @return	Number of finished buffers, 0 if no counter is set up.
+*
+* @note		None.
+*
+*******************************************************************************/
+u32 XAieDma_RingGetCompleted(XAieDma_Ring *RingPtr)
+{
+	XAie_AssertNonvoid(RingPtr != XAIE_NULL);
+
+	if(RingPtr->PerfCounter == XAIEDMA_RING_PERFCNT_INVALID) {
+		return 0U;
+	}
+
+	if(RingPtr->TileDmaPtr != XAIE_NULL) {
+		return XAieTileMem_PerfCounterGet(RingPtr->TileInstPtr,
+				RingPtr->PerfCounter);
+	}
+
+	return XAieTilePl_PerfCounterGet(RingPtr->TileInstPtr,
+			RingPtr->PerfCounter);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the number of bytes the ring channel has moved since
+* XAieDma_RingPerfEnable(). Sampling it at two points in time gives the
+* sustained rate of the ring.
+*
+* @param	RingPtr - Pointer to the ring instance.
+*
+* @return	Number of bytes, 0 if no counter is set up.
+*
+* @note		None.
+*
+*******************************************************************************/
+u64 XAieDma_RingGetBytes(XAieDma_Ring *RingPtr)
+{
+	XAie_AssertNonvoid(RingPtr != XAIE_NULL);
+
+	return (u64)XAieDma_RingGetCompleted(RingPtr) * RingPtr->Length;
+}
+
+/** @} */
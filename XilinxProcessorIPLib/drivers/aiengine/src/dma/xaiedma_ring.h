@@ -0,0 +1,83 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaiedma_ring.h
+* @{
+*
+* Header file for the Tile and Shim DMA buffer rings.
+*
+* A ring chains NumBufs BDs of one DMA channel into a loop, each BD moving one
+* buffer and guarded by its own lock. The DMA acquires the lock of a buffer
+* before the transfer and releases it with the other value after, so the
+* application and the DMA hand the buffers over without stopping the channel:
+*
+*	MM2S: application acquires value 0 (empty), fills the buffer and
+*	      releases value 1. The DMA acquires 1 and releases 0.
+*	S2MM: application acquires value 1 (full), consumes the buffer and
+*	      releases value 0. The DMA acquires 0 and releases 1.
+*
+* The application side is used from the PS with XAieDma_RingAcquire() and
+* XAieDma_RingRelease(), or from an AIE kernel using the same locks. The
+* number of finished BDs can be counted by a performance counter of the
+* memory (Tile) or PL (Shim) module to measure the ring throughput.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  ag      10/15/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+#ifndef XAIEDMA_RING_H
+#define XAIEDMA_RING_H
+
+/***************************** Include Files *********************************/
+#include "xaiedma_tile.h"
+#include "xaiedma_shim.h"
+
+/***************************** Constant Definitions **************************/
+#define XAIEDMA_RING_MAX_NUM_BUFS		16U
+
+#define XAIEDMA_RING_PERFCNT_INVALID		0xFFU
+
+/**************************** Type Definitions *******************************/
+/**
+ * This typedef is the DMA ring instance. User is required to allocate memory
+ * for the ring and a pointer of the same is passed to the ring functions.
+ */
+typedef struct
+{
+	XAieGbl_Tile *TileInstPtr;		/**< Tile owning the DMA and the locks */
+	XAieDma_Tile *TileDmaPtr;		/**< Tile DMA, NULL for a Shim ring */
+	XAieDma_Shim *ShimDmaPtr;		/**< Shim DMA, NULL for a Tile ring */
+	u8 ChNum;				/**< Channel number, ranging from 0-3 */
+	u8 NumBufs;				/**< Number of buffers in the ring */
+	u8 BdNum[XAIEDMA_RING_MAX_NUM_BUFS];	/**< BD of each buffer */
+	u8 LockId[XAIEDMA_RING_MAX_NUM_BUFS];	/**< Lock of each buffer */
+	u8 AppAcqVal;				/**< Lock value the application acquires */
+	u8 Head;				/**< Next buffer of the application */
+	u8 Held;				/**< The application holds the head buffer */
+	u8 PerfCounter;				/**< Counter of finished BDs */
+	u32 Length;				/**< Buffer length in bytes */
+} XAieDma_Ring;
+
+/************************** Function Prototypes  *****************************/
+u32 XAieDma_TileRingInitialize(XAieDma_Ring *RingPtr, XAieGbl_Tile *TileInstPtr, XAieDma_Tile *DmaInstPtr, u8 ChNum, u8 NumBufs, const u8 *BdNum, const u8 *LockId, const u16 *BufAddr, u16 Length);
+u32 XAieDma_ShimRingInitialize(XAieDma_Ring *RingPtr, XAieGbl_Tile *TileInstPtr, XAieDma_Shim *DmaInstPtr, u8 ChNum, u8 NumBufs, const u8 *BdNum, const u8 *LockId, const u64 *BufAddr, u32 Length);
+void XAieDma_RingStart(XAieDma_Ring *RingPtr);
+u32 XAieDma_RingAcquire(XAieDma_Ring *RingPtr, u32 TimeOut, u8 *BufIdx);
+u32 XAieDma_RingRelease(XAieDma_Ring *RingPtr);
+void XAieDma_RingSetAddr(XAieDma_Ring *RingPtr, u8 BufIdx, u64 Addr);
+u32 XAieDma_RingPerfEnable(XAieDma_Ring *RingPtr, u8 Counter);
+u32 XAieDma_RingGetCompleted(XAieDma_Ring *RingPtr);
+u64 XAieDma_RingGetBytes(XAieDma_Ring *RingPtr);
+
+#endif		/* end of protection macro */
+/** @} */
@@ -38,12 +38,14 @@
 * 2.6  Tejus   10/14/2019  Enable assertion for linux and simulation
 * 2.7  Wendy   02/25/2020  Add logging API
 * 2.8  Tejus   04/17/2020  Fix variable overflow issue.
+* 2.9  ag      10/15/2026  Record writes into transactions
 * </pre>
 *
 ******************************************************************************/
 #include "xaiegbl_defs.h"
 #include "xaielib.h"
 #include "xaielib_npi.h"
+#include "xaielib_txn.h"
 #include <stdarg.h>
 #include <stdio.h>
 #include <string.h>
@@ -893,6 +895,8 @@ u32 XAieLib_MemRead32(XAieLib_MemInst *XAieLib_MemInstPtr, u64 Addr)
 *******************************************************************************/
 u32 XAieLib_Read32(u64 Addr)
 {
+	(void)XAieLib_TxnFlush();
+
 #ifdef __AIESIM__
 	return(XAieSim_Read32(Addr));
 #elif defined __AIEBAREMTL__
@@ -919,6 +923,8 @@ void XAieLib_Read128(u64 Addr, u32 *Data)
 {
 	u8 Idx;
 
+	(void)XAieLib_TxnFlush();
+
 	for(Idx = 0U; Idx < 4U; Idx++) {
 #ifdef __AIESIM__
 		Data[Idx] = XAieSim_Read32(Addr + Idx*4U);
@@ -945,6 +951,10 @@ void XAieLib_Read128(u64 Addr, u32 *Data)
 *******************************************************************************/
 void XAieLib_Write32(u64 Addr, u32 Data)
 {
+	if(XAieLib_TxnRecord(Addr, 0U, &Data, 1U) == XAIELIB_SUCCESS) {
+		return;
+	}
+
 #ifdef __AIESIM__
 	XAieSim_Write32(Addr, Data);
 #elif defined __AIEBAREMTL__
@@ -973,6 +983,14 @@ void XAieLib_MaskWrite32(u64 Addr, u32 Mask, u32 Data)
 {
 	u32 RegVal;
 
+	/* The recorded mask includes the data bits set outside of Mask */
+	if((Mask | Data) == 0U) {
+		return;
+	}
+	if(XAieLib_TxnRecord(Addr, Mask | Data, &Data, 1U) == XAIELIB_SUCCESS) {
+		return;
+	}
+
 #ifdef __AIESIM__
 	XAieSim_MaskWrite32(Addr, Mask, Data);
 #elif defined __AIEBAREMTL__
@@ -1003,6 +1021,10 @@ void XAieLib_MaskWrite32(u64 Addr, u32 Mask, u32 Data)
 *******************************************************************************/
 void XAieLib_Write128(u64 Addr, u32 *Data)
 {
+	if(XAieLib_TxnRecord(Addr, 0U, Data, 4U) == XAIELIB_SUCCESS) {
+		return;
+	}
+
 #ifdef __AIESIM__
 	XAieSim_Write128(Addr, Data);
 #elif defined __AIEBAREMTL__
@@ -1058,6 +1080,8 @@ u32 XAieLib_MaskPoll(u64 Addr, u32 Mask, u32 Value, u32 TimeOutUs)
 {
 	u32 Ret = XAIELIB_FAILURE;
 
+	(void)XAieLib_TxnFlush();
+
 #ifdef __AIESIM__
 	if (XAieSim_MaskPoll(Addr, Mask, Value, TimeOutUs) == XAIESIM_SUCCESS) {
 		Ret = XAIELIB_SUCCESS;
@@ -1104,6 +1128,8 @@ u32 XAieLib_MaskPoll(u64 Addr, u32 Mask, u32 Value, u32 TimeOutUs)
 *******************************************************************************/
 u32 XAieLib_NPIRead32(u64 Addr)
 {
+	(void)XAieLib_TxnFlush();
+
 #ifdef __AIESIM__
 	return XAieSim_NPIRead32(Addr);
 #elif defined __AIEBAREMTL__
@@ -1160,6 +1186,7 @@ static void XAieLib_NPISetLock(u8 Lock)
 *******************************************************************************/
 void XAieLib_NPIWrite32(u64 Addr, u32 Data)
 {
+	(void)XAieLib_TxnFlush();
 	XAieLib_NPISetLock(0);
 #ifdef __AIESIM__
 	XAieSim_NPIWrite32(Addr, Data);
@@ -1190,6 +1217,7 @@ void XAieLib_NPIMaskWrite32(u64 Addr, u32 Mask, u32 Data)
 {
 	u32 RegVal;
 
+	(void)XAieLib_TxnFlush();
 	XAieLib_NPISetLock(0);
 #ifdef __AIESIM__
 	XAieSim_NPIMaskWrite32(Addr, Mask, Data);
@@ -1226,6 +1254,8 @@ u32 XAieLib_NPIMaskPoll(u64 Addr, u32 Mask, u32 Value, u32 TimeOutUs)
 {
 	u32 Ret = XAIELIB_FAILURE;
 
+	(void)XAieLib_TxnFlush();
+
 #ifdef __AIESIM__
 	if (XAieSim_NPIMaskPoll(Addr, Mask, Value, TimeOutUs) == XAIESIM_SUCCESS) {
 		Ret = XAIELIB_SUCCESS;
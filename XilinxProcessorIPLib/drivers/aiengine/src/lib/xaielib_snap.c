@@ -0,0 +1,533 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaielib_snap.c
+* @{
+*
+* This file contains the AIE configuration snapshots. See xaielib_snap.h for
+* a description of their use.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  ag      10/15/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+#include "xaiegbl_defs.h"
+#include "xaielib.h"
+#include "xaielib_snap.h"
+
+/***************************** Include Files *********************************/
+
+/***************************** Macro Definitions *****************************/
+
+/************************** Variable Definitions *****************************/
+static XAieLib_Snap *XAieLib_SnapActivePtr; /**< Capturing snapshot */
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This appends a command to the snapshot.
+*
+* @param	SnapPtr: Snapshot.
+* @param	Addr: Address of the first word.
+* @param	Mask: Mask of a mask write, 0 for a write.
+* @param	Data: Words of the command.
+* @param	NumWords: Number of words.
+*
+* @return	None.
+*
+* @note		Sets the snapshot status to XAIELIB_FAILURE on overflow.
+*
+*******************************************************************************/
+static void XAieLib_SnapAppend(XAieLib_Snap *SnapPtr, u64 Addr, u32 Mask,
+		const u32 *Data, u32 NumWords)
+{
+	XAieLib_TxnCmd *CmdPtr;
+	u32 Idx;
+
+	if((SnapPtr->NumCmds == SnapPtr->MaxCmds) ||
+			(SnapPtr->NumData + NumWords > SnapPtr->MaxData)) {
+		SnapPtr->Status = XAIELIB_FAILURE;
+		return;
+	}
+
+	CmdPtr = &SnapPtr->CmdPtr[SnapPtr->NumCmds++];
+	CmdPtr->Addr = Addr;
+	CmdPtr->Mask = Mask;
+	CmdPtr->NumWords = NumWords;
+	CmdPtr->DataIdx = SnapPtr->NumData;
+	for(Idx = 0U; Idx < NumWords; Idx++) {
+		SnapPtr->DataPtr[SnapPtr->NumData++] = Data[Idx];
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This adds a captured command to the snapshot. An earlier command to the
+* same extent is dropped, and a mask write is folded into an earlier write
+* of the register.
+*
+* @param	SnapPtr: Snapshot.
+* @param	Addr: Address of the first word.
+* @param	Mask: Mask of a mask write, 0 for a write.
+* @param	Data: Words of the command.
+* @param	NumWords: Number of words.
+*
+* @return	None.
+*
+* @note		Dropped commands keep their place with NumWords set to 0
+*		until XAieLib_SnapCompact().
+*
+*******************************************************************************/
+static void XAieLib_SnapAdd(XAieLib_Snap *SnapPtr, u64 Addr, u32 Mask,
+		const u32 *Data, u32 NumWords)
+{
+	XAieLib_TxnCmd *CmdPtr;
+	u32 Value;
+	u32 Idx;
+
+	for(Idx = SnapPtr->NumCmds; Idx > 0U; Idx--) {
+		CmdPtr = &SnapPtr->CmdPtr[Idx - 1U];
+		if((CmdPtr->NumWords == 0U) ||
+				(CmdPtr->Addr + CmdPtr->NumWords * 4U <= Addr) ||
+				(Addr + NumWords * 4U <= CmdPtr->Addr)) {
+			continue;
+		}
+		if((CmdPtr->NumWords != NumWords) || (CmdPtr->Addr != Addr)) {
+			/* Partial overlap, keep the capture order from here */
+			break;
+		}
+
+		if(Mask == 0U) {
+			/* Superseded, keep looking for older ones */
+			CmdPtr->NumWords = 0U;
+			continue;
+		}
+
+		/* (R & ~M1 | D1) & ~M2 | D2 == R & ~(M1 | M2) | (D1 & ~M2 | D2) */
+		Value = (SnapPtr->DataPtr[CmdPtr->DataIdx] & ~Mask) | Data[0U];
+		if(CmdPtr->Mask != 0U) {
+			Mask |= CmdPtr->Mask;
+		}
+		CmdPtr->NumWords = 0U;
+		if(CmdPtr->Mask == 0U) {
+			XAieLib_SnapAppend(SnapPtr, Addr, 0U, &Value, 1U);
+		} else {
+			XAieLib_SnapAppend(SnapPtr, Addr, Mask, &Value, 1U);
+		}
+		return;
+	}
+
+	XAieLib_SnapAppend(SnapPtr, Addr, Mask, Data, NumWords);
+}
+
+/*****************************************************************************/
+/**
+*
+* This removes the dropped commands from the snapshot and merges writes to
+* consecutive addresses into bursts.
+*
+* @param	SnapPtr: Snapshot.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+static void XAieLib_SnapCompact(XAieLib_Snap *SnapPtr)
+{
+	XAieLib_TxnCmd *CmdPtr;
+	XAieLib_TxnCmd *LastPtr = XAIE_NULL;
+	u32 NumCmds = 0U;
+	u32 NumData = 0U;
+	u32 CmdIdx;
+	u32 Idx;
+
+	for(CmdIdx = 0U; CmdIdx < SnapPtr->NumCmds; CmdIdx++) {
+		CmdPtr = &SnapPtr->CmdPtr[CmdIdx];
+		if(CmdPtr->NumWords == 0U) {
+			continue;
+		}
+
+		/* Data only moves down, the copy can't overwrite unread words */
+		for(Idx = 0U; Idx < CmdPtr->NumWords; Idx++) {
+			SnapPtr->DataPtr[NumData + Idx] =
+				SnapPtr->DataPtr[CmdPtr->DataIdx + Idx];
+		}
+
+		if((LastPtr != XAIE_NULL) && (LastPtr->Mask == 0U) &&
+				(CmdPtr->Mask == 0U) &&
+				(LastPtr->Addr + LastPtr->NumWords * 4U ==
+				 CmdPtr->Addr)) {
+			LastPtr->NumWords += CmdPtr->NumWords;
+		} else {
+			LastPtr = &SnapPtr->CmdPtr[NumCmds++];
+			LastPtr->Addr = CmdPtr->Addr;
+			LastPtr->Mask = CmdPtr->Mask;
+			LastPtr->NumWords = CmdPtr->NumWords;
+			LastPtr->DataIdx = NumData;
+		}
+		NumData += CmdPtr->NumWords;
+	}
+
+	SnapPtr->NumCmds = NumCmds;
+	SnapPtr->NumData = NumData;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the handler of the capture transaction. It adds the commands to
+* the snapshot and applies them.
+*
+* @param	HandlerRef: Snapshot.
+* @param	CmdPtr: Commands to apply.
+* @param	NumCmds: Number of commands.
+* @param	DataPtr: Data buffer of the commands.
+*
+* @return	XAIELIB_SUCCESS.
+*
+* @note		None.
+*
+*******************************************************************************/
+static u32 XAieLib_SnapHandler(void *HandlerRef, const XAieLib_TxnCmd *CmdPtr,
+		u32 NumCmds, const u32 *DataPtr)
+{
+	XAieLib_Snap *SnapPtr = (XAieLib_Snap *)HandlerRef;
+	u32 CmdIdx;
+
+	for(CmdIdx = 0U; CmdIdx < NumCmds; CmdIdx++) {
+		XAieLib_SnapAdd(SnapPtr, CmdPtr[CmdIdx].Addr,
+				CmdPtr[CmdIdx].Mask,
+				&DataPtr[CmdPtr[CmdIdx].DataIdx],
+				CmdPtr[CmdIdx].NumWords);
+	}
+
+	return XAieLib_TxnApply(CmdPtr, NumCmds, DataPtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This initializes an empty snapshot.
+*
+* @param	SnapPtr: Snapshot to initialize.
+* @param	CmdPtr: Command buffer.
+* @param	MaxCmds: Number of commands in the command buffer.
+* @param	DataPtr: Data buffer.
+* @param	MaxData: Number of 32bit words in the data buffer.
+* @param	LockPtr: Buffer for the lock release addresses.
+* @param	MaxLocks: Number of addresses in the lock buffer.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+void XAieLib_SnapInit(XAieLib_Snap *SnapPtr, XAieLib_TxnCmd *CmdPtr,
+		u32 MaxCmds, u32 *DataPtr, u32 MaxData, u64 *LockPtr,
+		u32 MaxLocks)
+{
+	XAie_AssertVoid(SnapPtr != XAIE_NULL);
+	XAie_AssertVoid(CmdPtr != XAIE_NULL);
+	XAie_AssertVoid(DataPtr != XAIE_NULL);
+	XAie_AssertVoid(LockPtr != XAIE_NULL || MaxLocks == 0U);
+
+	SnapPtr->CmdPtr = CmdPtr;
+	SnapPtr->MaxCmds = MaxCmds;
+	SnapPtr->NumCmds = 0U;
+	SnapPtr->DataPtr = DataPtr;
+	SnapPtr->MaxData = MaxData;
+	SnapPtr->NumData = 0U;
+	SnapPtr->LockPtr = LockPtr;
+	SnapPtr->MaxLocks = MaxLocks;
+	SnapPtr->NumLocks = 0U;
+	SnapPtr->Status = XAIELIB_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This starts capturing the configuration into a snapshot. The captured
+* writes are still applied to the array.
+*
+* @param	SnapPtr: Initialized snapshot.
+*
+* @return	None.
+*
+* @note		The capture uses a transaction, which ends a transaction that
+*		is recording.
+*
+*******************************************************************************/
+void XAieLib_SnapCaptureStart(XAieLib_Snap *SnapPtr)
+{
+	XAie_AssertVoid(SnapPtr != XAIE_NULL);
+
+	XAieLib_TxnInit(&SnapPtr->Txn, SnapPtr->TxnCmd,
+			XAIELIB_SNAP_TXN_NUM_CMDS, SnapPtr->TxnData,
+			XAIELIB_SNAP_TXN_NUM_DATA, XAieLib_SnapHandler,
+			SnapPtr);
+	XAieLib_SnapActivePtr = SnapPtr;
+	XAieLib_TxnStart(&SnapPtr->Txn);
+}
+
+/*****************************************************************************/
+/**
+*
+* This ends the capture and compacts the snapshot.
+*
+* @param	None.
+*
+* @return	XAIELIB_SUCCESS if the whole configuration is in the
+*		snapshot, otherwise XAIELIB_FAILURE.
+*
+* @note		None.
+*
+*******************************************************************************/
+u32 XAieLib_SnapCaptureEnd(void)
+{
+	XAieLib_Snap *SnapPtr = XAieLib_SnapActivePtr;
+
+	if(SnapPtr == XAIE_NULL) {
+		return XAIELIB_FAILURE;
+	}
+
+	(void)XAieLib_TxnEnd();
+	XAieLib_SnapActivePtr = XAIE_NULL;
+	XAieLib_SnapCompact(SnapPtr);
+
+	if(SnapPtr->Status != XAIELIB_SUCCESS) {
+		XAieLib_log(XAIELIB_LOGERROR, "Snapshot buffers too small\n");
+	}
+
+	return SnapPtr->Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This records a lock release into the capturing snapshot. Lock releases are
+* done by reading the release register, so they are not seen as writes.
+*
+* @param	Addr: Address of the lock release register.
+*
+* @return	None.
+*
+* @note		Used by the lock functions. Nothing is done when no snapshot
+*		is capturing.
+*
+*******************************************************************************/
+void XAieLib_SnapRecordLockRel(u64 Addr)
+{
+	XAieLib_Snap *SnapPtr = XAieLib_SnapActivePtr;
+
+	if(SnapPtr == XAIE_NULL) {
+		return;
+	}
+
+	if(SnapPtr->NumLocks == SnapPtr->MaxLocks) {
+		SnapPtr->Status = XAIELIB_FAILURE;
+		return;
+	}
+
+	SnapPtr->LockPtr[SnapPtr->NumLocks++] = Addr;
+}
+
+/*****************************************************************************/
+/**
+*
+* This applies a snapshot to the array. The writes are applied first, in
+* the captured order, then the locks are released.
+*
+* @param	SnapPtr: Snapshot to apply.
+* @param	Handler: Handler applying the writes, e.g. through a DMA or a
+*		PLM CDO, or NULL to write them directly.
+* @param	HandlerRef: Passed to the handler.
+*
+* @return	XAIELIB_SUCCESS on success, otherwise XAIELIB_FAILURE.
+*
+* @note		None.
+*
+*******************************************************************************/
+u32 XAieLib_SnapRestore(const XAieLib_Snap *SnapPtr,
+		XAieLib_TxnHandler Handler, void *HandlerRef)
+{
+	u32 Ret;
+	u32 Idx;
+
+	XAie_AssertNonvoid(SnapPtr != XAIE_NULL);
+
+	if(SnapPtr->Status != XAIELIB_SUCCESS) {
+		return XAIELIB_FAILURE;
+	}
+
+	if(Handler != XAIE_NULL) {
+		Ret = Handler(HandlerRef, SnapPtr->CmdPtr, SnapPtr->NumCmds,
+				SnapPtr->DataPtr);
+	} else {
+		Ret = XAieLib_TxnApply(SnapPtr->CmdPtr, SnapPtr->NumCmds,
+				SnapPtr->DataPtr);
+	}
+	if(Ret != XAIELIB_SUCCESS) {
+		return Ret;
+	}
+
+	for(Idx = 0U; Idx < SnapPtr->NumLocks; Idx++) {
+		(void)XAieLib_Read32(SnapPtr->LockPtr[Idx]);
+	}
+
+	return XAIELIB_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This serializes a snapshot to a word buffer. The buffer holds a header
+* (magic, version, number of commands, words and locks), the commands as
+* address high, address low, mask and number of words, the data words and
+* the lock addresses as high and low words.
+*
+* @param	SnapPtr: Snapshot to serialize.
+* @param	BufPtr: Buffer to fill.
+* @param	MaxWords: Size of the buffer in words.
+* @param	NumWordsPtr: Set to the number of words used.
+*
+* @return	XAIELIB_SUCCESS on success, XAIELIB_FAILURE if the buffer is
+*		too small or the snapshot is incomplete.
+*
+* @note		None.
+*
+*******************************************************************************/
+u32 XAieLib_SnapSerialize(const XAieLib_Snap *SnapPtr, u32 *BufPtr,
+		u32 MaxWords, u32 *NumWordsPtr)
+{
+	const XAieLib_TxnCmd *CmdPtr;
+	u32 Pos = 0U;
+	u32 Idx;
+
+	XAie_AssertNonvoid(SnapPtr != XAIE_NULL);
+	XAie_AssertNonvoid(BufPtr != XAIE_NULL);
+	XAie_AssertNonvoid(NumWordsPtr != XAIE_NULL);
+
+	if((SnapPtr->Status != XAIELIB_SUCCESS) ||
+			(XAIELIB_SNAP_HDR_WORDS +
+			 SnapPtr->NumCmds * XAIELIB_SNAP_CMD_WORDS +
+			 SnapPtr->NumData + SnapPtr->NumLocks * 2U > MaxWords)) {
+		return XAIELIB_FAILURE;
+	}
+
+	BufPtr[Pos++] = XAIELIB_SNAP_MAGIC;
+	BufPtr[Pos++] = XAIELIB_SNAP_VERSION;
+	BufPtr[Pos++] = SnapPtr->NumCmds;
+	BufPtr[Pos++] = SnapPtr->NumData;
+	BufPtr[Pos++] = SnapPtr->NumLocks;
+
+	for(Idx = 0U; Idx < SnapPtr->NumCmds; Idx++) {
+		CmdPtr = &SnapPtr->CmdPtr[Idx];
+		BufPtr[Pos++] = (u32)(CmdPtr->Addr >> 32U);
+		BufPtr[Pos++] = (u32)CmdPtr->Addr;
+		BufPtr[Pos++] = CmdPtr->Mask;
+		BufPtr[Pos++] = CmdPtr->NumWords;
+	}
+
+	for(Idx = 0U; Idx < SnapPtr->NumData; Idx++) {
+		BufPtr[Pos++] = SnapPtr->DataPtr[Idx];
+	}
+
+	for(Idx = 0U; Idx < SnapPtr->NumLocks; Idx++) {
+		BufPtr[Pos++] = (u32)(SnapPtr->LockPtr[Idx] >> 32U);
+		BufPtr[Pos++] = (u32)SnapPtr->LockPtr[Idx];
+	}
+
+	*NumWordsPtr = Pos;
+
+	return XAIELIB_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This loads a snapshot from a buffer filled by XAieLib_SnapSerialize().
+*
+* @param	SnapPtr: Snapshot initialized with large enough buffers.
+* @param	BufPtr: Serialized snapshot.
+* @param	NumWords: Size of the serialized snapshot in words.
+*
+* @return	XAIELIB_SUCCESS on success, XAIELIB_FAILURE if the buffer is
+*		not a valid snapshot or doesn't fit.
+*
+* @note		None.
+*
+*******************************************************************************/
+u32 XAieLib_SnapDeserialize(XAieLib_Snap *SnapPtr, const u32 *BufPtr,
+		u32 NumWords)
+{
+	XAieLib_TxnCmd *CmdPtr;
+	u32 NumCmds, NumData, NumLocks;
+	u32 Pos = XAIELIB_SNAP_HDR_WORDS;
+	u32 DataIdx = 0U;
+	u32 Idx;
+
+	XAie_AssertNonvoid(SnapPtr != XAIE_NULL);
+	XAie_AssertNonvoid(BufPtr != XAIE_NULL);
+
+	if((NumWords < XAIELIB_SNAP_HDR_WORDS) ||
+			(BufPtr[0U] != XAIELIB_SNAP_MAGIC) ||
+			(BufPtr[1U] != XAIELIB_SNAP_VERSION)) {
+		return XAIELIB_FAILURE;
+	}
+
+	NumCmds = BufPtr[2U];
+	NumData = BufPtr[3U];
+	NumLocks = BufPtr[4U];
+	if((NumCmds > SnapPtr->MaxCmds) || (NumData > SnapPtr->MaxData) ||
+			(NumLocks > SnapPtr->MaxLocks) ||
+			((u64)XAIELIB_SNAP_HDR_WORDS +
+			 (u64)NumCmds * XAIELIB_SNAP_CMD_WORDS + NumData +
+			 (u64)NumLocks * 2U != NumWords)) {
+		return XAIELIB_FAILURE;
+	}
+
+	for(Idx = 0U; Idx < NumCmds; Idx++) {
+		CmdPtr = &SnapPtr->CmdPtr[Idx];
+		CmdPtr->Addr = ((u64)BufPtr[Pos] << 32U) | BufPtr[Pos + 1U];
+		CmdPtr->Mask = BufPtr[Pos + 2U];
+		CmdPtr->NumWords = BufPtr[Pos + 3U];
+		CmdPtr->DataIdx = DataIdx;
+		DataIdx += CmdPtr->NumWords;
+		Pos += XAIELIB_SNAP_CMD_WORDS;
+	}
+	if(DataIdx != NumData) {
+		return XAIELIB_FAILURE;
+	}
+
+	for(Idx = 0U; Idx < NumData; Idx++) {
+		SnapPtr->DataPtr[Idx] = BufPtr[Pos++];
+	}
+
+	for(Idx = 0U; Idx < NumLocks; Idx++) {
+		SnapPtr->LockPtr[Idx] = ((u64)BufPtr[Pos] << 32U) |
+			BufPtr[Pos + 1U];
+		Pos += 2U;
+	}
+
+	SnapPtr->NumCmds = NumCmds;
+	SnapPtr->NumData = NumData;
+	SnapPtr->NumLocks = NumLocks;
+	SnapPtr->Status = XAIELIB_SUCCESS;
+
+	return XAIELIB_SUCCESS;
+}
+/** @} */
@@ -0,0 +1,87 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaielib_snap.h
+* @{
+*
+* Header file for the AIE configuration snapshots.
+*
+* While a snapshot is captured, the writes of the driver (DMA, stream switch,
+* program memory, ...) are recorded through a transaction and applied to the
+* array as usual, and the lock releases are recorded. A write to the same
+* extent as an earlier one, or a mask write on top of an earlier write,
+* replaces the earlier command, so the snapshot holds each register once.
+* At the end of the capture the remaining writes to consecutive addresses
+* are merged into bursts.
+*
+* XAieLib_SnapRestore() replays the snapshot, for example after an AIE reset,
+* directly or through a transaction handler (DMA or PLM CDO). The snapshot
+* can be serialized to a word buffer, stored e.g. in flash, and loaded back
+* with XAieLib_SnapDeserialize().
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  ag      10/15/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+#ifndef XAIELIB_SNAP_H
+#define XAIELIB_SNAP_H
+
+/***************************** Include Files *********************************/
+#include "xaielib_txn.h"
+
+/************************** Constant Definitions *****************************/
+#define XAIELIB_SNAP_TXN_NUM_CMDS	16U
+#define XAIELIB_SNAP_TXN_NUM_DATA	256U
+
+#define XAIELIB_SNAP_MAGIC		0x53454941U	/* "AIES" */
+#define XAIELIB_SNAP_VERSION		1U
+#define XAIELIB_SNAP_HDR_WORDS		5U
+#define XAIELIB_SNAP_CMD_WORDS		4U
+
+/**************************** Type Definitions *******************************/
+/**
+ * This typedef contains a snapshot. The command, data and lock buffers are
+ * provided by the user.
+ */
+typedef struct {
+	XAieLib_TxnCmd *CmdPtr;		/**< Command buffer */
+	u32 MaxCmds;			/**< Size of the command buffer */
+	u32 NumCmds;			/**< Captured commands */
+	u32 *DataPtr;			/**< Data buffer */
+	u32 MaxData;			/**< Size of the data buffer in words */
+	u32 NumData;			/**< Captured words */
+	u64 *LockPtr;			/**< Lock release register addresses */
+	u32 MaxLocks;			/**< Size of the lock buffer */
+	u32 NumLocks;			/**< Captured lock releases */
+	u32 Status;			/**< XAIELIB_FAILURE once a buffer overflowed */
+	XAieLib_Txn Txn;		/**< Capture transaction */
+	XAieLib_TxnCmd TxnCmd[XAIELIB_SNAP_TXN_NUM_CMDS];	/**< Capture commands */
+	u32 TxnData[XAIELIB_SNAP_TXN_NUM_DATA];		/**< Capture data */
+} XAieLib_Snap;
+
+/************************** Function Prototypes  *****************************/
+void XAieLib_SnapInit(XAieLib_Snap *SnapPtr, XAieLib_TxnCmd *CmdPtr,
+		u32 MaxCmds, u32 *DataPtr, u32 MaxData, u64 *LockPtr,
+		u32 MaxLocks);
+void XAieLib_SnapCaptureStart(XAieLib_Snap *SnapPtr);
+u32 XAieLib_SnapCaptureEnd(void);
+void XAieLib_SnapRecordLockRel(u64 Addr);
+u32 XAieLib_SnapRestore(const XAieLib_Snap *SnapPtr,
+		XAieLib_TxnHandler Handler, void *HandlerRef);
+u32 XAieLib_SnapSerialize(const XAieLib_Snap *SnapPtr, u32 *BufPtr,
+		u32 MaxWords, u32 *NumWordsPtr);
+u32 XAieLib_SnapDeserialize(XAieLib_Snap *SnapPtr, const u32 *BufPtr,
+		u32 NumWords);
+
+#endif		/* end of protection macro */
+/** @} */
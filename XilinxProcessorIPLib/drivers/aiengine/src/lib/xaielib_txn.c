@@ -0,0 +1,356 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaielib_txn.c
+* @{
+*
+* This file contains the register write transactions. See xaielib_txn.h for
+* a description of their use.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  ag      10/15/2026  Initial creation
+* 1.1  ag      10/15/2026  Export XAieLib_TxnApply()
+* </pre>
+*
+******************************************************************************/
+#include "xaiegbl_defs.h"
+#include "xaielib.h"
+#include "xaielib_txn.h"
+
+/***************************** Include Files *********************************/
+
+/***************************** Macro Definitions *****************************/
+
+/************************** Variable Definitions *****************************/
+static XAieLib_Txn *XAieLib_TxnActivePtr; /**< Recording transaction */
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This applies the commands of a transaction one word at a time.
+*
+* @param	CmdPtr: Commands to apply.
+* @param	NumCmds: Number of commands.
+* @param	DataPtr: Data buffer of the commands.
+*
+* @return	XAIELIB_SUCCESS.
+*
+* @note		Writes are recorded if a transaction is recording. The
+*		default path of XAieLib_TxnFlush() and the handlers call this
+*		with no transaction recording.
+*
+*******************************************************************************/
+u32 XAieLib_TxnApply(const XAieLib_TxnCmd *CmdPtr, u32 NumCmds,
+		const u32 *DataPtr)
+{
+	u32 CmdIdx;
+	u32 Idx;
+
+	for(CmdIdx = 0U; CmdIdx < NumCmds; CmdIdx++) {
+		if(CmdPtr[CmdIdx].Mask != 0U) {
+			XAieLib_MaskWrite32(CmdPtr[CmdIdx].Addr,
+					CmdPtr[CmdIdx].Mask,
+					DataPtr[CmdPtr[CmdIdx].DataIdx]);
+			continue;
+		}
+
+		for(Idx = 0U; Idx < CmdPtr[CmdIdx].NumWords; Idx++) {
+			XAieLib_Write32(CmdPtr[CmdIdx].Addr + Idx * 4U,
+					DataPtr[CmdPtr[CmdIdx].DataIdx + Idx]);
+		}
+	}
+
+	return XAIELIB_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This initializes an empty transaction.
+*
+* @param	TxnPtr: Transaction to initialize.
+* @param	CmdPtr: Command buffer.
+* @param	MaxCmds: Number of commands in the command buffer.
+* @param	DataPtr: Data buffer.
+* @param	MaxData: Number of 32bit words in the data buffer.
+* @param	Handler: Handler applying the commands, NULL to write them
+*		directly.
+* @param	HandlerRef: Passed to the handler.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+void XAieLib_TxnInit(XAieLib_Txn *TxnPtr, XAieLib_TxnCmd *CmdPtr, u32 MaxCmds,
+		u32 *DataPtr, u32 MaxData, XAieLib_TxnHandler Handler,
+		void *HandlerRef)
+{
+	XAie_AssertVoid(TxnPtr != XAIE_NULL);
+	XAie_AssertVoid(CmdPtr != XAIE_NULL);
+	XAie_AssertVoid(DataPtr != XAIE_NULL);
+	XAie_AssertVoid(MaxCmds != 0U);
+	XAie_AssertVoid(MaxData >= 4U);
+
+	TxnPtr->CmdPtr = CmdPtr;
+	TxnPtr->MaxCmds = MaxCmds;
+	TxnPtr->NumCmds = 0U;
+	TxnPtr->DataPtr = DataPtr;
+	TxnPtr->MaxData = MaxData;
+	TxnPtr->NumData = 0U;
+	TxnPtr->Handler = Handler;
+	TxnPtr->HandlerRef = HandlerRef;
+	TxnPtr->Status = XAIELIB_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This starts recording the driver writes into a transaction. A transaction
+* which is recording is ended first.
+*
+* @param	TxnPtr: Transaction to record into.
+*
+* @return	None.
+*
+* @note		The transaction state is global, like the IO functions.
+*
+*******************************************************************************/
+void XAieLib_TxnStart(XAieLib_Txn *TxnPtr)
+{
+	XAie_AssertVoid(TxnPtr != XAIE_NULL);
+
+	if(XAieLib_TxnActivePtr != XAIE_NULL) {
+		(void)XAieLib_TxnEnd();
+	}
+
+	TxnPtr->Status = XAIELIB_SUCCESS;
+	XAieLib_TxnActivePtr = TxnPtr;
+}
+
+/*****************************************************************************/
+/**
+*
+* This applies the recorded commands and empties the transaction, which keeps
+* recording. It is called by the IO functions before reading from the array.
+*
+* @param	None.
+*
+* @return	XAIELIB_SUCCESS on success, otherwise XAIELIB_FAILURE.
+*
+* @note		Nothing is done when no transaction is recording.
+*
+*******************************************************************************/
+u32 XAieLib_TxnFlush(void)
+{
+	XAieLib_Txn *TxnPtr = XAieLib_TxnActivePtr;
+	u32 Ret;
+
+	if((TxnPtr == XAIE_NULL) || (TxnPtr->NumCmds == 0U)) {
+		return XAIELIB_SUCCESS;
+	}
+
+	/* Writes of the handler go to the hardware */
+	XAieLib_TxnActivePtr = XAIE_NULL;
+	if(TxnPtr->Handler != XAIE_NULL) {
+		Ret = TxnPtr->Handler(TxnPtr->HandlerRef, TxnPtr->CmdPtr,
+				TxnPtr->NumCmds, TxnPtr->DataPtr);
+	} else {
+		Ret = XAieLib_TxnApply(TxnPtr->CmdPtr, TxnPtr->NumCmds,
+				TxnPtr->DataPtr);
+	}
+	XAieLib_TxnActivePtr = TxnPtr;
+
+	TxnPtr->NumCmds = 0U;
+	TxnPtr->NumData = 0U;
+	if(Ret != XAIELIB_SUCCESS) {
+		XAieLib_log(XAIELIB_LOGERROR, "Transaction flush failed\n");
+		TxnPtr->Status = XAIELIB_FAILURE;
+	}
+
+	return Ret;
+}
+
+/*****************************************************************************/
+/**
+*
+* This applies the recorded commands and stops recording.
+*
+* @param	None.
+*
+* @return	XAIELIB_SUCCESS if every flush of the transaction succeeded,
+*		otherwise XAIELIB_FAILURE.
+*
+* @note		None.
+*
+*******************************************************************************/
+u32 XAieLib_TxnEnd(void)
+{
+	XAieLib_Txn *TxnPtr = XAieLib_TxnActivePtr;
+
+	if(TxnPtr == XAIE_NULL) {
+		return XAIELIB_SUCCESS;
+	}
+
+	(void)XAieLib_TxnFlush();
+	XAieLib_TxnActivePtr = XAIE_NULL;
+
+	return TxnPtr->Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This records a write into the recording transaction. A write following the
+* previous one at the next address extends its command.
+*
+* @param	Addr: Address to write to.
+* @param	Mask: Mask of a mask write, 0 for a write.
+* @param	Data: Words to be written.
+* @param	NumWords: Number of words, 1 for a mask write.
+*
+* @return	XAIELIB_SUCCESS if the write is recorded, XAIELIB_FAILURE if
+*		no transaction is recording and the caller has to write.
+*
+* @note		Used by the IO functions.
+*
+*******************************************************************************/
+u32 XAieLib_TxnRecord(u64 Addr, u32 Mask, const u32 *Data, u32 NumWords)
+{
+	XAieLib_Txn *TxnPtr = XAieLib_TxnActivePtr;
+	XAieLib_TxnCmd *CmdPtr;
+	u32 Idx;
+
+	if(TxnPtr == XAIE_NULL) {
+		return XAIELIB_FAILURE;
+	}
+
+	if((TxnPtr->NumData + NumWords > TxnPtr->MaxData) ||
+			(TxnPtr->NumCmds == TxnPtr->MaxCmds)) {
+		(void)XAieLib_TxnFlush();
+	}
+
+	CmdPtr = XAIE_NULL;
+	if((TxnPtr->NumCmds != 0U) && (Mask == 0U)) {
+		CmdPtr = &TxnPtr->CmdPtr[TxnPtr->NumCmds - 1U];
+		if((CmdPtr->Mask != 0U) ||
+				(CmdPtr->Addr + CmdPtr->NumWords * 4U != Addr)) {
+			CmdPtr = XAIE_NULL;
+		}
+	}
+
+	if(CmdPtr == XAIE_NULL) {
+		CmdPtr = &TxnPtr->CmdPtr[TxnPtr->NumCmds];
+		CmdPtr->Addr = Addr;
+		CmdPtr->Mask = Mask;
+		CmdPtr->NumWords = 0U;
+		CmdPtr->DataIdx = TxnPtr->NumData;
+		TxnPtr->NumCmds++;
+	}
+
+	for(Idx = 0U; Idx < NumWords; Idx++) {
+		TxnPtr->DataPtr[TxnPtr->NumData++] = Data[Idx];
+	}
+	CmdPtr->NumWords += NumWords;
+
+	return XAIELIB_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This converts commands to a PLM CDO command sequence. Single writes become
+* WRITE64, mask writes MASK_WRITE64 and bursts DMA_WRITE commands.
+*
+* @param	CmdPtr: Commands to convert.
+* @param	NumCmds: Number of commands.
+* @param	DataPtr: Data buffer of the commands.
+* @param	CdoPtr: Buffer for the CDO commands.
+* @param	MaxWords: Size of the CDO buffer in words.
+* @param	NumWordsPtr: Set to the number of CDO words.
+*
+* @return	XAIELIB_SUCCESS on success, XAIELIB_FAILURE if the CDO buffer
+*		is too small.
+*
+* @note		None.
+*
+*******************************************************************************/
+u32 XAieLib_TxnToCdo(const XAieLib_TxnCmd *CmdPtr, u32 NumCmds,
+		const u32 *DataPtr, u32 *CdoPtr, u32 MaxWords, u32 *NumWordsPtr)
+{
+	const XAieLib_TxnCmd *Cmd;
+	u32 CmdIdx;
+	u32 Idx;
+	u32 Len;
+	u32 Pos = 0U;
+
+	XAie_AssertNonvoid(CmdPtr != XAIE_NULL);
+	XAie_AssertNonvoid(DataPtr != XAIE_NULL);
+	XAie_AssertNonvoid(CdoPtr != XAIE_NULL);
+	XAie_AssertNonvoid(NumWordsPtr != XAIE_NULL);
+
+	for(CmdIdx = 0U; CmdIdx < NumCmds; CmdIdx++) {
+		Cmd = &CmdPtr[CmdIdx];
+
+		if(Cmd->Mask != 0U) {
+			if(Pos + 5U > MaxWords) {
+				return XAIELIB_FAILURE;
+			}
+			CdoPtr[Pos++] = (4U << 16U) |
+				(XAIELIB_CDO_MODULE_GENERIC << 8U) |
+				XAIELIB_CDO_CMD_MASK_WRITE64;
+			CdoPtr[Pos++] = (u32)(Cmd->Addr >> 32U);
+			CdoPtr[Pos++] = (u32)Cmd->Addr;
+			CdoPtr[Pos++] = Cmd->Mask;
+			CdoPtr[Pos++] = DataPtr[Cmd->DataIdx];
+		} else if(Cmd->NumWords == 1U) {
+			if(Pos + 4U > MaxWords) {
+				return XAIELIB_FAILURE;
+			}
+			CdoPtr[Pos++] = (3U << 16U) |
+				(XAIELIB_CDO_MODULE_GENERIC << 8U) |
+				XAIELIB_CDO_CMD_WRITE64;
+			CdoPtr[Pos++] = (u32)(Cmd->Addr >> 32U);
+			CdoPtr[Pos++] = (u32)Cmd->Addr;
+			CdoPtr[Pos++] = DataPtr[Cmd->DataIdx];
+		} else {
+			/* Payload is the address and the data */
+			Len = Cmd->NumWords + 2U;
+			if(Pos + Len + 2U > MaxWords) {
+				return XAIELIB_FAILURE;
+			}
+			if(Len < XAIELIB_CDO_MAX_SHORT_LEN) {
+				CdoPtr[Pos++] = (Len << 16U) |
+					(XAIELIB_CDO_MODULE_GENERIC << 8U) |
+					XAIELIB_CDO_CMD_DMA_WRITE;
+			} else {
+				CdoPtr[Pos++] =
+					(XAIELIB_CDO_MAX_SHORT_LEN << 16U) |
+					(XAIELIB_CDO_MODULE_GENERIC << 8U) |
+					XAIELIB_CDO_CMD_DMA_WRITE;
+				CdoPtr[Pos++] = Len;
+			}
+			CdoPtr[Pos++] = (u32)(Cmd->Addr >> 32U);
+			CdoPtr[Pos++] = (u32)Cmd->Addr;
+			for(Idx = 0U; Idx < Cmd->NumWords; Idx++) {
+				CdoPtr[Pos++] = DataPtr[Cmd->DataIdx + Idx];
+			}
+		}
+	}
+
+	*NumWordsPtr = Pos;
+
+	return XAIELIB_SUCCESS;
+}
+/** @} */
@@ -0,0 +1,95 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaielib_txn.h
+* @{
+*
+* Header file for the register write transactions.
+*
+* While a transaction is started, the 32bit, 128bit and mask writes of the
+* driver to the AIE array are recorded into the transaction buffer instead of
+* being written. Writes to consecutive addresses are merged into one command,
+* so the tile DMA buffer descriptors, stream switch configuration and program
+* memory contents become bursts. The commands are applied by a transaction
+* handler when the buffer is full, before the driver reads from the array, and
+* when the transaction is flushed or ended. The handler can write the bursts
+* through a DMA engine or convert them to a PLM CDO with XAieLib_TxnToCdo().
+* Without a handler the commands are written one word at a time.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  ag      10/15/2026  Initial creation
+* 1.1  ag      10/15/2026  Export XAieLib_TxnApply()
+* </pre>
+*
+******************************************************************************/
+#ifndef XAIELIB_TXN_H
+#define XAIELIB_TXN_H
+
+/***************************** Include Files *********************************/
+#include "xaielib.h"
+
+/************************** Constant Definitions *****************************/
+/* PLM CDO generic module commands used by XAieLib_TxnToCdo() */
+#define XAIELIB_CDO_MODULE_GENERIC	1U
+#define XAIELIB_CDO_CMD_DMA_WRITE	5U
+#define XAIELIB_CDO_CMD_MASK_WRITE64	7U
+#define XAIELIB_CDO_CMD_WRITE64		8U
+#define XAIELIB_CDO_MAX_SHORT_LEN	255U
+
+/**************************** Type Definitions *******************************/
+/**
+ * This typedef contains one recorded command.
+ */
+typedef struct {
+	u64 Addr;	/**< Address of the first word */
+	u32 Mask;	/**< Mask of a mask write, 0 for a write */
+	u32 NumWords;	/**< Number of consecutive words, 1 for a mask write */
+	u32 DataIdx;	/**< Index of the first word in the data buffer */
+} XAieLib_TxnCmd;
+
+/**
+ * Transaction handler. It applies the commands in order and returns
+ * XAIELIB_SUCCESS on success, otherwise XAIELIB_FAILURE.
+ */
+typedef u32 (*XAieLib_TxnHandler)(void *HandlerRef,
+		const XAieLib_TxnCmd *CmdPtr, u32 NumCmds, const u32 *DataPtr);
+
+/**
+ * This typedef contains a transaction.
+ */
+typedef struct {
+	XAieLib_TxnCmd *CmdPtr;		/**< Command buffer */
+	u32 MaxCmds;			/**< Size of the command buffer */
+	u32 NumCmds;			/**< Recorded commands */
+	u32 *DataPtr;			/**< Data buffer */
+	u32 MaxData;			/**< Size of the data buffer in words */
+	u32 NumData;			/**< Recorded words */
+	XAieLib_TxnHandler Handler;	/**< Handler, NULL for direct writes */
+	void *HandlerRef;		/**< Passed to the handler */
+	u32 Status;			/**< XAIELIB_FAILURE once a flush failed */
+} XAieLib_Txn;
+
+/************************** Function Prototypes  *****************************/
+void XAieLib_TxnInit(XAieLib_Txn *TxnPtr, XAieLib_TxnCmd *CmdPtr, u32 MaxCmds,
+		u32 *DataPtr, u32 MaxData, XAieLib_TxnHandler Handler,
+		void *HandlerRef);
+void XAieLib_TxnStart(XAieLib_Txn *TxnPtr);
+u32 XAieLib_TxnFlush(void);
+u32 XAieLib_TxnEnd(void);
+u32 XAieLib_TxnRecord(u64 Addr, u32 Mask, const u32 *Data, u32 NumWords);
+u32 XAieLib_TxnApply(const XAieLib_TxnCmd *CmdPtr, u32 NumCmds,
+		const u32 *DataPtr);
+u32 XAieLib_TxnToCdo(const XAieLib_TxnCmd *CmdPtr, u32 NumCmds,
+		const u32 *DataPtr, u32 *CdoPtr, u32 MaxWords, u32 *NumWordsPtr);
+
+#endif		/* end of protection macro */
+/** @} */
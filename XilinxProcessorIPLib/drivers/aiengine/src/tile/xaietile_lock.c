@@ -23,6 +23,7 @@
 * 1.4  Hyun    01/08/2019  Use the poll function
 * 1.5  Nishad  03/20/2019  Fix usage of uninitialized variable in
 * 			   XAieTile_LockAcquire and XAieTile_LockRelease
+* 1.6  ag      10/15/2026  Record lock releases in the capturing snapshot
 * </pre>
 *
 ******************************************************************************/
@@ -30,6 +31,7 @@
 #include "xaiegbl.h"
 #include "xaiegbl_reginit.h"
 #include "xaietile_lock.h"
+#include "xaielib_snap.h"
 
 /***************************** Include Files *********************************/
 
@@ -178,6 +180,7 @@ u8 XAieTile_LockRelease(XAieGbl_Tile *TileInstPtr, u8 LockId, u8 LockVal,
 
 	if (XAieGbl_MaskPoll(RegAddr, Mask, Value, TimeOut) == XAIE_SUCCESS) {
 		RelDone = XAIETILE_LOCK_REL_SUCCESS;
+		XAieLib_SnapRecordLockRel(RegAddr);
 	}
 
 	return RelDone;
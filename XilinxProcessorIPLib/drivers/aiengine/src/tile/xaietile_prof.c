@@ -0,0 +1,433 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaietile_prof.c
+* @{
+*
+* This file contains the routines of the tile range profiler.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  ag      10/15/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+#include "xaiegbl_defs.h"
+#include "xaiegbl.h"
+#include "xaiegbl_reginit.h"
+#include "xaietile_event.h"
+#include "xaietile_perfcnt.h"
+#include "xaietile_strm.h"
+#include "xaiedma_tile.h"
+#include "xaietile_prof.h"
+
+/***************************** Include Files *********************************/
+
+/***************************** Macro Definitions *****************************/
+#define XAIETILE_PROF_MODULE_CORE		0x0U
+#define XAIETILE_PROF_MODULE_MEM		0x2U
+
+#define XAIETILE_PROF_CORE_STALL_MASK		0xFU	/* Memory, stream, cascade, lock */
+
+/************************** Variable Definitions *****************************/
+extern XAieGbl_RegPerfCounter PerfCounter[];
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This is an internal API to get a tile of the AIE instance.
+*
+* @param	ProfPtr - Pointer to the profiler instance.
+* @param	Col - Column of the tile.
+* @param	Row - Row of the tile, 0 for the Shim tile.
+*
+* @return	Pointer to the Tile instance.
+*
+* @note		Used only in this file.
+*
+*******************************************************************************/
+static XAieGbl_Tile *XAieTile_ProfTile(XAieTile_Prof *ProfPtr, u16 Col,
+		u16 Row)
+{
+	return ProfPtr->AieInst->Tiles +
+		Col * (ProfPtr->AieInst->Config->NumRows + 1) + Row;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sets up the performance counters of all tiles in the range from
+* Start to End and clears the counts.
+*
+* @param	ProfPtr - Pointer to the profiler instance.
+* @param	AieInst - Pointer to the AIE instance.
+* @param	Start - First tile of the range (lowest column and row).
+* @param	End - Last tile of the range (highest column and row).
+* @param	DmaChNum - Tile DMA channel to measure (0-S2MM0,1-S2MM1,
+*		2-MM2S0,3-MM2S1).
+* @param	Last - Array of one count entry per tile of the range.
+* @param	Delta - Array of one count entry per tile of the range.
+*
+* @return	XAIE_SUCCESS if successful, else XAIE_FAILURE.
+*
+* @note		The counters are not available to other users of the tiles
+*		while the profiler is used.
+*
+*******************************************************************************/
+u32 XAieTile_ProfInitialize(XAieTile_Prof *ProfPtr, XAieGbl *AieInst,
+		XAie_LocType Start, XAie_LocType End, u8 DmaChNum,
+		XAieTile_ProfCounts *Last, XAieTile_ProfCounts *Delta)
+{
+	XAieGbl_Tile *TilePtr;
+	u16 Col, Row;
+	u32 Idx;
+	u8 Counter;
+	u8 Status = XAIE_SUCCESS;
+
+	XAie_AssertNonvoid(ProfPtr != XAIE_NULL);
+	XAie_AssertNonvoid(AieInst != XAIE_NULL);
+	XAie_AssertNonvoid(AieInst->Tiles != XAIE_NULL);
+	XAie_AssertNonvoid(AieInst->Config != XAIE_NULL);
+	XAie_AssertNonvoid(Start.Row >= 1U && Start.Row <= End.Row);
+	XAie_AssertNonvoid(Start.Col <= End.Col);
+	XAie_AssertNonvoid(End.Row <= AieInst->Config->NumRows);
+	XAie_AssertNonvoid(End.Col < AieInst->Config->NumCols);
+	XAie_AssertNonvoid(DmaChNum < XAIEDMA_TILE_MAX_NUM_CHANNELS);
+	XAie_AssertNonvoid(Last != XAIE_NULL);
+	XAie_AssertNonvoid(Delta != XAIE_NULL);
+
+	ProfPtr->AieInst = AieInst;
+	ProfPtr->Start = Start;
+	ProfPtr->NumRows = End.Row - Start.Row + 1U;
+	ProfPtr->NumCols = End.Col - Start.Col + 1U;
+	ProfPtr->DmaChNum = DmaChNum;
+	ProfPtr->Last = Last;
+	ProfPtr->Delta = Delta;
+
+	for(Col = Start.Col; Col <= End.Col; Col++) {
+		for(Row = Start.Row; Row <= End.Row; Row++) {
+			TilePtr = XAieTile_ProfTile(ProfPtr, Col, Row);
+
+			XAieTile_CoreGroupEventSet(TilePtr,
+					XAIETILE_GROUP_EVENT_CORE_CORE_STALL,
+					XAIETILE_PROF_CORE_STALL_MASK);
+
+			/*
+			 * Equal start and stop events count the cycles the
+			 * event is signalled
+			 */
+			Status |= XAieTileCore_PerfCounterControl(TilePtr, 0U,
+					XAIETILE_EVENT_CORE_TRUE,
+					XAIETILE_EVENT_CORE_TRUE,
+					XAIETILE_EVENT_CORE_NONE);
+			Status |= XAieTileCore_PerfCounterControl(TilePtr, 1U,
+					XAIETILE_EVENT_CORE_ACTIVE,
+					XAIETILE_EVENT_CORE_ACTIVE,
+					XAIETILE_EVENT_CORE_NONE);
+			Status |= XAieTileCore_PerfCounterControl(TilePtr, 2U,
+					XAIETILE_EVENT_CORE_GROUP_CORE_STALL,
+					XAIETILE_EVENT_CORE_GROUP_CORE_STALL,
+					XAIETILE_EVENT_CORE_NONE);
+			Status |= XAieTileCore_PerfCounterControl(TilePtr, 3U,
+					XAIETILE_EVENT_CORE_LOCK_STALL,
+					XAIETILE_EVENT_CORE_LOCK_STALL,
+					XAIETILE_EVENT_CORE_NONE);
+
+			/* Busy from the BD start until the channel is idle */
+			Status |= XAieTileMem_PerfCounterControl(TilePtr, 0U,
+					XAIETILE_EVENT_MEM_DMA_S2MM_0_START_BD +
+					DmaChNum,
+					XAIETILE_EVENT_MEM_DMA_S2MM_0_GO_TO_IDLE +
+					DmaChNum,
+					XAIETILE_EVENT_MEM_NONE);
+			Status |= XAieTileMem_PerfCounterControl(TilePtr, 1U,
+					XAIETILE_EVENT_MEM_DMA_S2MM_0_STALLED_LOCK_ACQUIRE +
+					DmaChNum,
+					XAIETILE_EVENT_MEM_DMA_S2MM_0_STALLED_LOCK_ACQUIRE +
+					DmaChNum,
+					XAIETILE_EVENT_MEM_NONE);
+
+			for(Counter = 0U; Counter < 4U; Counter++) {
+				XAieTileCore_PerfCounterSet(TilePtr, Counter,
+						0U);
+			}
+			XAieTileMem_PerfCounterSet(TilePtr, 0U, 0U);
+			XAieTileMem_PerfCounterSet(TilePtr, 1U, 0U);
+		}
+	}
+
+	for(Idx = 0U; Idx < (u32)ProfPtr->NumRows * ProfPtr->NumCols; Idx++) {
+		Last[Idx] = (XAieTile_ProfCounts){0U};
+		Delta[Idx] = (XAieTile_ProfCounts){0U};
+	}
+
+	return (Status == XAIE_SUCCESS) ? XAIE_SUCCESS : XAIE_FAILURE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API reads the counters of all tiles in the range and stores the
+* increments since the previous sample in the Delta array.
+*
+* @param	ProfPtr - Pointer to the profiler instance.
+*
+* @return	None.
+*
+* @note		The 4 core counters of a tile are read with a single 128-bit
+*		read. The counters wrap, the increments are still correct as
+*		long as the sample period is below 2^32 cycles.
+*
+*******************************************************************************/
+void XAieTile_ProfSample(XAieTile_Prof *ProfPtr)
+{
+	XAieGbl_Tile *TilePtr;
+	XAieTile_ProfCounts Now;
+	u32 CoreVal[4U];
+	u16 Col, Row;
+	u32 Idx = 0U;
+
+	XAie_AssertVoid(ProfPtr != XAIE_NULL);
+
+	for(Col = 0U; Col < ProfPtr->NumCols; Col++) {
+		for(Row = 0U; Row < ProfPtr->NumRows; Row++, Idx++) {
+			TilePtr = XAieTile_ProfTile(ProfPtr,
+					ProfPtr->Start.Col + Col,
+					ProfPtr->Start.Row + Row);
+
+			XAieGbl_Read128(TilePtr->TileAddr +
+				PerfCounter[XAIETILE_PROF_MODULE_CORE].RegOff[0U],
+				CoreVal);
+			Now.Cycles = CoreVal[0U];
+			Now.Active = CoreVal[1U];
+			Now.Stall = CoreVal[2U];
+			Now.LockStall = CoreVal[3U];
+			Now.DmaBusy = XAieGbl_Read32(TilePtr->TileAddr +
+				PerfCounter[XAIETILE_PROF_MODULE_MEM].RegOff[0U]);
+			Now.DmaLockStall = XAieGbl_Read32(TilePtr->TileAddr +
+				PerfCounter[XAIETILE_PROF_MODULE_MEM].RegOff[1U]);
+
+			ProfPtr->Delta[Idx].Cycles = Now.Cycles -
+				ProfPtr->Last[Idx].Cycles;
+			ProfPtr->Delta[Idx].Active = Now.Active -
+				ProfPtr->Last[Idx].Active;
+			ProfPtr->Delta[Idx].Stall = Now.Stall -
+				ProfPtr->Last[Idx].Stall;
+			ProfPtr->Delta[Idx].LockStall = Now.LockStall -
+				ProfPtr->Last[Idx].LockStall;
+			ProfPtr->Delta[Idx].DmaBusy = Now.DmaBusy -
+				ProfPtr->Last[Idx].DmaBusy;
+			ProfPtr->Delta[Idx].DmaLockStall = Now.DmaLockStall -
+				ProfPtr->Last[Idx].DmaLockStall;
+			ProfPtr->Last[Idx] = Now;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API computes the ratios of a tile from the last sample.
+*
+* @param	ProfPtr - Pointer to the profiler instance.
+* @param	TileIdx - Index of the tile in the range.
+* @param	RatiosPtr - Pointer to the ratios to fill.
+*
+* @return	None.
+*
+* @note		All ratios are 0 if no cycles were counted.
+*
+*******************************************************************************/
+void XAieTile_ProfGetRatios(XAieTile_Prof *ProfPtr, u32 TileIdx,
+		XAieTile_ProfRatios *RatiosPtr)
+{
+	XAieTile_ProfCounts *DeltaPtr;
+	u64 Cycles;
+
+	XAie_AssertVoid(ProfPtr != XAIE_NULL);
+	XAie_AssertVoid(RatiosPtr != XAIE_NULL);
+	XAie_AssertVoid(TileIdx < (u32)ProfPtr->NumRows * ProfPtr->NumCols);
+
+	DeltaPtr = &ProfPtr->Delta[TileIdx];
+	Cycles = DeltaPtr->Cycles;
+	if(Cycles == 0U) {
+		*RatiosPtr = (XAieTile_ProfRatios){0U};
+		return;
+	}
+
+	RatiosPtr->Active = (u32)(((u64)DeltaPtr->Active *
+				XAIETILE_PROF_RATIO_SCALE) / Cycles);
+	RatiosPtr->Stall = (u32)(((u64)DeltaPtr->Stall *
+				XAIETILE_PROF_RATIO_SCALE) / Cycles);
+	RatiosPtr->LockWait = (u32)(((u64)DeltaPtr->LockStall *
+				XAIETILE_PROF_RATIO_SCALE) / Cycles);
+	RatiosPtr->DmaBusy = (u32)(((u64)DeltaPtr->DmaBusy *
+				XAIETILE_PROF_RATIO_SCALE) / Cycles);
+	RatiosPtr->DmaLockWait = (u32)(((u64)DeltaPtr->DmaLockStall *
+				XAIETILE_PROF_RATIO_SCALE) / Cycles);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the tile of the range with the highest stall ratio in the
+* last sample, the first candidate for a bottleneck kernel.
+*
+* @param	ProfPtr - Pointer to the profiler instance.
+*
+* @return	Index of the tile in the range.
+*
+* @note		None.
+*
+*******************************************************************************/
+u32 XAieTile_ProfTopStall(XAieTile_Prof *ProfPtr)
+{
+	XAieTile_ProfRatios Ratios;
+	u32 Idx;
+	u32 TopIdx = 0U;
+	u32 TopStall = 0U;
+
+	XAie_AssertNonvoid(ProfPtr != XAIE_NULL);
+
+	for(Idx = 0U; Idx < (u32)ProfPtr->NumRows * ProfPtr->NumCols; Idx++) {
+		XAieTile_ProfGetRatios(ProfPtr, Idx, &Ratios);
+		if(Ratios.Stall > TopStall) {
+			TopStall = Ratios.Stall;
+			TopIdx = Idx;
+		}
+	}
+
+	return TopIdx;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API starts the core trace of the tiles of one column of the range and
+* routes it to DDR. The trace streams are merged with packet switching on
+* stream StrmIdx of the tiles of the range, passed through the tiles below
+* and the Shim tile, and written by the Shim DMA S2MM channel.
+*
+* @param	ProfPtr - Pointer to the profiler instance.
+* @param	Col - Column of the range to trace.
+* @param	TraceEvents - Events to trace in every tile.
+* @param	StrmIdx - North/South stream used for the route, ranging 0-3.
+* @param	DmaInstPtr - Pointer to the Shim DMA instance of the column.
+* @param	ChNum - Shim DMA channel (0-S2MM0,1-S2MM1).
+* @param	BdNum - BD for the trace buffer, or XAIETILE_PROF_TRACE_NO_BD
+*		if the channel is set up by the caller, e.g. with a
+*		XAieDma_Ring for continuous capture.
+* @param	BufAddr - 48-bit address of the trace buffer (128b aligned).
+* @param	Length - Trace buffer length in bytes.
+*
+* @return	XAIE_SUCCESS if successful, else XAIE_FAILURE.
+*
+* @note		The trace packet ID of each tile is its row. The stream
+*		ports used by the route must not be used by the graph.
+*
+*******************************************************************************/
+u32 XAieTile_ProfTraceStart(XAieTile_Prof *ProfPtr, u16 Col,
+		XAie_TraceEvents *TraceEvents, u8 StrmIdx,
+		XAieDma_Shim *DmaInstPtr, u8 ChNum, u8 BdNum, u64 BufAddr,
+		u32 Length)
+{
+	XAieGbl_Tile *TilePtr;
+	u16 Row, TopRow;
+	u8 Status = XAIE_SUCCESS;
+
+	XAie_AssertNonvoid(ProfPtr != XAIE_NULL);
+	XAie_AssertNonvoid(TraceEvents != XAIE_NULL);
+	XAie_AssertNonvoid(DmaInstPtr != XAIE_NULL);
+	XAie_AssertNonvoid(Col >= ProfPtr->Start.Col &&
+			Col < ProfPtr->Start.Col + ProfPtr->NumCols);
+	XAie_AssertNonvoid(StrmIdx < 4U);
+	XAie_AssertNonvoid(ChNum == XAIEDMA_SHIM_CHNUM_S2MM0 ||
+			ChNum == XAIEDMA_SHIM_CHNUM_S2MM1);
+
+	TopRow = ProfPtr->Start.Row + ProfPtr->NumRows - 1U;
+
+	/* Traced tiles merge their trace with the packets from above */
+	for(Row = TopRow; Row >= ProfPtr->Start.Row; Row--) {
+		TilePtr = XAieTile_ProfTile(ProfPtr, Col, Row);
+
+		Status |= XAieTileCore_EventTraceEventWrite(TilePtr,
+				TraceEvents);
+		Status |= XAieTileCore_EventTraceControl(TilePtr,
+				XAIETILE_EVENT_MODE_EVENT_TIME,
+				XAIETILE_EVENT_CORE_TRUE,
+				XAIETILE_EVENT_CORE_NONE, (u8)Row, 0U);
+
+		XAieTile_StrmConfigSlv(TilePtr,
+				XAIETILE_STRSW_SPORT_TRACE(TilePtr, 0U),
+				XAIE_ENABLE, XAIE_ENABLE);
+		XAieTile_StrmConfigSlvSlot(TilePtr,
+				XAIETILE_STRSW_SPORT_TRACE(TilePtr, 0U),
+				XAIETILE_STRSW_SPORT_SLOT0, XAIE_ENABLE,
+				XAIETILE_STRSW_SLVSLOT_CFG(TilePtr,
+					(XAIETILE_STRSW_SPORT_TRACE(TilePtr, 0U)),
+					XAIETILE_STRSW_SPORT_SLOT0, 0U, 0U,
+					XAIE_ENABLE, 0U, 0U));
+		if(Row < TopRow) {
+			XAieTile_StrmConfigSlv(TilePtr,
+				XAIETILE_STRSW_SPORT_NORTH(TilePtr, StrmIdx),
+				XAIE_ENABLE, XAIE_ENABLE);
+			XAieTile_StrmConfigSlvSlot(TilePtr,
+				XAIETILE_STRSW_SPORT_NORTH(TilePtr, StrmIdx),
+				XAIETILE_STRSW_SPORT_SLOT0, XAIE_ENABLE,
+				XAIETILE_STRSW_SLVSLOT_CFG(TilePtr,
+					(XAIETILE_STRSW_SPORT_NORTH(TilePtr,
+						StrmIdx)),
+					XAIETILE_STRSW_SPORT_SLOT0, 0U, 0U,
+					XAIE_ENABLE, 0U, 0U));
+		}
+		XAieTile_StrmConfigMstr(TilePtr,
+				XAIETILE_STRSW_MPORT_SOUTH(TilePtr, StrmIdx),
+				XAIE_ENABLE, XAIE_ENABLE,
+				XAIETILE_STRSW_MPORT_CFGPKT(TilePtr,
+					(XAIETILE_STRSW_MPORT_SOUTH(TilePtr,
+						StrmIdx)),
+					XAIE_DISABLE, 1U, 0U));
+	}
+
+	/* Tiles below the range pass the packets through */
+	for(Row = 1U; Row < ProfPtr->Start.Row; Row++) {
+		TilePtr = XAieTile_ProfTile(ProfPtr, Col, Row);
+		XAieTile_StrmConnectCct(TilePtr,
+				XAIETILE_STRSW_SPORT_NORTH(TilePtr, StrmIdx),
+				XAIETILE_STRSW_MPORT_SOUTH(TilePtr, StrmIdx),
+				XAIE_ENABLE);
+	}
+
+	/* South 2 and 3 of the Shim tile lead to the S2MM channels */
+	TilePtr = XAieTile_ProfTile(ProfPtr, Col, 0U);
+	XAieTile_StrmConnectCct(TilePtr,
+			XAIETILE_STRSW_SPORT_NORTH(TilePtr, StrmIdx),
+			XAIETILE_STRSW_MPORT_SOUTH(TilePtr, 2U + ChNum),
+			XAIE_ENABLE);
+	XAieTile_ShimStrmDemuxConfig(TilePtr,
+			XAIETILE_SHIM_STRM_DEM_SOUTH2 + ChNum,
+			XAIETILE_SHIM_STRM_DEM_DMA);
+
+	if(BdNum != XAIETILE_PROF_TRACE_NO_BD) {
+		XAieDma_ShimBdClear(DmaInstPtr, BdNum);
+		XAieDma_ShimBdSetAddr(DmaInstPtr, BdNum, (u16)(BufAddr >> 32U),
+				(u32)BufAddr, Length);
+		XAieDma_ShimBdWrite(DmaInstPtr, BdNum);
+		XAieDma_ShimSetStartBd(DmaInstPtr, ChNum, BdNum);
+		XAieDma_ShimChControl(DmaInstPtr, ChNum, XAIE_DISABLE,
+				XAIE_DISABLE, XAIE_ENABLE);
+	}
+
+	return (Status == XAIE_SUCCESS) ? XAIE_SUCCESS : XAIE_FAILURE;
+}
+
+/** @} */
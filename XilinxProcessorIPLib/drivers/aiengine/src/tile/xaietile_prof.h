@@ -0,0 +1,102 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaietile_prof.h
+* @{
+*
+* Header file for the tile range profiler.
+*
+* The profiler takes over the performance counters of the AIE tiles in a
+* rectangular range:
+*
+*	Core counter 0: cycles
+*	Core counter 1: active cycles
+*	Core counter 2: stall cycles (memory, stream, cascade and lock)
+*	Core counter 3: lock stall cycles
+*	Memory counter 0: cycles the selected DMA channel is busy
+*	Memory counter 1: cycles the selected DMA channel waits on a lock
+*
+* XAieTile_ProfSample() reads all counters of the range in one sweep and
+* keeps the increments since the previous sample, from which the ratios are
+* computed. The core trace of the range can also be routed down a column
+* with packet switching and written to DDR by a Shim DMA S2MM channel.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  ag      10/15/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+#ifndef XAIETILE_PROF_H
+#define XAIETILE_PROF_H
+
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+#include "xaietile_event.h"
+#include "xaiedma_shim.h"
+
+/***************************** Constant Definitions **************************/
+#define XAIETILE_PROF_RATIO_SCALE		10000U	/* Ratios in 0.01% */
+
+#define XAIETILE_PROF_TRACE_NO_BD		0xFFU
+
+/**************************** Type Definitions *******************************/
+/**
+ * This typedef contains the counter increments of a tile between samples.
+ */
+typedef struct
+{
+	u32 Cycles;			/**< Cycles */
+	u32 Active;			/**< Core active cycles */
+	u32 Stall;			/**< Core stall cycles */
+	u32 LockStall;			/**< Core lock stall cycles */
+	u32 DmaBusy;			/**< DMA channel busy cycles */
+	u32 DmaLockStall;		/**< DMA channel lock stall cycles */
+} XAieTile_ProfCounts;
+
+/**
+ * This typedef contains the ratios of a tile, in XAIETILE_PROF_RATIO_SCALE
+ * units of the cycles.
+ */
+typedef struct
+{
+	u32 Active;			/**< Core active ratio */
+	u32 Stall;			/**< Core stall ratio */
+	u32 LockWait;			/**< Core lock wait ratio */
+	u32 DmaBusy;			/**< DMA busy ratio */
+	u32 DmaLockWait;		/**< DMA lock wait ratio */
+} XAieTile_ProfRatios;
+
+/**
+ * This typedef is the profiler instance. The user provides two count
+ * arrays with one entry per tile of the range, indexed by
+ * (Col - StartCol) * NumRows + (Row - StartRow).
+ */
+typedef struct
+{
+	XAieGbl *AieInst;		/**< AIE instance */
+	XAie_LocType Start;		/**< First tile of the range */
+	u16 NumRows;			/**< Number of rows of the range */
+	u16 NumCols;			/**< Number of columns of the range */
+	u8 DmaChNum;			/**< Tile DMA channel measured */
+	XAieTile_ProfCounts *Last;	/**< Counter values of the last sample */
+	XAieTile_ProfCounts *Delta;	/**< Increments of the last sample */
+} XAieTile_Prof;
+
+/************************** Function Prototypes  *****************************/
+u32 XAieTile_ProfInitialize(XAieTile_Prof *ProfPtr, XAieGbl *AieInst, XAie_LocType Start, XAie_LocType End, u8 DmaChNum, XAieTile_ProfCounts *Last, XAieTile_ProfCounts *Delta);
+void XAieTile_ProfSample(XAieTile_Prof *ProfPtr);
+void XAieTile_ProfGetRatios(XAieTile_Prof *ProfPtr, u32 TileIdx, XAieTile_ProfRatios *RatiosPtr);
+u32 XAieTile_ProfTopStall(XAieTile_Prof *ProfPtr);
+u32 XAieTile_ProfTraceStart(XAieTile_Prof *ProfPtr, u16 Col, XAie_TraceEvents *TraceEvents, u8 StrmIdx, XAieDma_Shim *DmaInstPtr, u8 ChNum, u8 BdNum, u64 BufAddr, u32 Length);
+
+#endif		/* end of protection macro */
+/** @} */
@@ -9,12 +9,15 @@ extern "C" {
 
 #include <xaiengine/xaieconfig.h>
 #include <xaiengine/xaiedma_shim.h>
+#include <xaiengine/xaiedma_ring.h>
 #include <xaiengine/xaiedma_tile.h>
 #include <xaiengine/xaiegbl.h>
 #include <xaiengine/xaiegbl_defs.h>
 #include <xaiengine/xaiegbl_params.h>
 #include <xaiengine/xaiegbl_reginit.h>
 #include <xaiengine/xaielib.h>
+#include <xaiengine/xaielib_txn.h>
+#include <xaiengine/xaielib_snap.h>
 #include <xaiengine/xaielib_npi.h>
 #include <xaiengine/xaiepm_clock.h>
 #include <xaiengine/xaietile_core.h>
@@ -25,6 +28,7 @@ extern "C" {
 #include <xaiengine/xaietile_noc.h>
 #include <xaiengine/xaietile_perfcnt.h>
 #include <xaiengine/xaietile_pl.h>
+#include <xaiengine/xaietile_prof.h>
 #include <xaiengine/xaietile_plif.h>
 #include <xaiengine/xaietile_shim.h>
 #include <xaiengine/xaietile_strm.h>
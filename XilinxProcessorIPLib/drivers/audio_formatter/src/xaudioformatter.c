@@ -85,6 +85,8 @@ u32 XAudioFormatter_CfgInitialize(XAudioFormatter *InstancePtr,
 	/* Setup the instance */
 	InstancePtr->Config = *CfgPtr;
 	InstancePtr->BaseAddress = CfgPtr->BaseAddress;
+	InstancePtr->S2MMStream = NULL;
+	InstancePtr->MM2SStream = NULL;
 	val = XAudioFormatter_ReadReg(CfgPtr->BaseAddress,
 		XAUD_FORMATTER_CORE_CONFIG);
 	if (val & XAUD_CFG_MM2S_MASK) {
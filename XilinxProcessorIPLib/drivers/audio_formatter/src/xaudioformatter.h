@@ -20,6 +20,13 @@
 * The driver does the interrupt handling, and dispatch to the user application
 * through callback functions that user has registered.
 *
+* <b> Streams </b>
+* XAudioFormatter_StreamInit() sets up a stream on the ring buffer of one
+* direction. The stream follows the DMA position from the transfer count
+* register, with or without the period interrupt, reports the bytes that
+* can be read or written, and calls its callback once per a number of
+* periods. See xaudioformatter_stream.c.
+*
 * <b> Virtual Memory </b>
 *
 * This driver supports Virtual Memory. The RTOS is responsible for calculating
@@ -91,6 +98,11 @@ typedef enum {
 
 /**************************** Type Definitions *******************************/
 typedef void (*XAudioFormatter_Callback)(void *CallbackRef);
+typedef u64 (*XAudioFormatter_TimestampFn)(void);
+typedef void (*XAudioFormatter_ProcessFn)(void *ProcessRef, u8 *Data,
+	u32 Bytes);
+
+struct XAudioFormatter_StreamTag;
 /**
 * This typedef contains configuration information for a audio formatter core.
 * Each audio formatter core should have a configuration structure associated.
@@ -144,6 +156,8 @@ typedef struct {
 	void *S2MMERRCallbackRef;
 	XAudioFormatter_Callback MM2SERRCallback;
 	void *MM2SERRCallbackRef;
+	struct XAudioFormatter_StreamTag *S2MMStream;
+	struct XAudioFormatter_StreamTag *MM2SStream;
 } XAudioFormatter;
 
 /**
@@ -157,6 +171,30 @@ typedef struct {
 	u32 bytes_per_period;
 } XAudioFormatterHwParams;
 
+/**
+* This typedef contains the state of a stream on the ring buffer of one
+* direction of an audio formatter core.
+*/
+typedef struct XAudioFormatter_StreamTag {
+	XAudioFormatter *InstancePtr;	/**< Audio formatter instance */
+	XAudioFormatter_ChannelId ChannelId; /**< Direction of the stream */
+	u8 *Buffer;			/**< Ring buffer */
+	u32 BufferBytes;		/**< Size of the ring buffer */
+	u32 PeriodBytes;		/**< Size of a period */
+	u32 HwPos;			/**< Last DMA position in the ring */
+	u64 HwBytes;			/**< Bytes transferred by the DMA */
+	u64 AppBytes;			/**< Bytes read or written by the
+					  *  application */
+	u64 Timestamp;			/**< Time stamp of HwBytes */
+	u32 Xruns;			/**< Overruns or underruns */
+	u32 Coalesce;			/**< Periods per callback, 0 for no
+					  *  period interrupt */
+	u32 IocCount;			/**< Periods since the last callback */
+	XAudioFormatter_Callback Callback; /**< Stream callback */
+	void *CallbackRef;		/**< Stream callback reference */
+	XAudioFormatter_TimestampFn GetTimestamp; /**< Time stamp function */
+} XAudioFormatter_Stream;
+
 /*****************************************************************************/
 
 
@@ -188,6 +226,25 @@ void XAudioFormatterSetFsMultiplier(XAudioFormatter *InstancePtr, u32 Mclk,
 u32 XAudioFormatterGetDMATransferCount(XAudioFormatter *InstancePtr);
 void XSdiAud_GetChStat(XAudioFormatter *InstancePtr, u8 *ChStatBuf);
 void XAudioFormatterSetS2MMTimeOut(XAudioFormatter *InstancePtr, u32 TimeOut);
+
+u32 XAudioFormatter_StreamInit(XAudioFormatter_Stream *StreamPtr,
+	XAudioFormatter *InstancePtr, XAudioFormatter_ChannelId ChannelId,
+	XAudioFormatterHwParams *hw_params, u32 Coalesce,
+	XAudioFormatter_TimestampFn GetTimestamp);
+void XAudioFormatter_StreamSetCallback(XAudioFormatter_Stream *StreamPtr,
+	XAudioFormatter_Callback CallbackFunc, void *CallbackRef);
+void XAudioFormatter_StreamStart(XAudioFormatter_Stream *StreamPtr);
+void XAudioFormatter_StreamStop(XAudioFormatter_Stream *StreamPtr);
+u32 XAudioFormatter_StreamUpdate(XAudioFormatter_Stream *StreamPtr);
+void XAudioFormatter_StreamGetPosition(XAudioFormatter_Stream *StreamPtr,
+	u64 *Bytes, u64 *Timestamp);
+void XAudioFormatter_StreamProcess(XAudioFormatter_Stream *StreamPtr,
+	u32 Bytes, XAudioFormatter_ProcessFn ProcessFunc, void *ProcessRef);
+void XAudioFormatter_StreamRead(XAudioFormatter_Stream *StreamPtr, u8 *Data,
+	u32 Bytes);
+void XAudioFormatter_StreamWrite(XAudioFormatter_Stream *StreamPtr,
+	const u8 *Data, u32 Bytes);
+void XAudioFormatter_StreamIntrHandler(XAudioFormatter_Stream *StreamPtr);
 /******************************************************************************/
 
 #ifdef __cplusplus
@@ -89,6 +89,8 @@ void *XAudioFormatterS2MMIntrHandler(void *InstancePtr)
 		XAUD_FORMATTER_STS + XAUD_FORMATTER_S2MM_OFFSET);
 	if (Data & XAUD_STS_IOC_IRQ_MASK) {
 		XAudioFormatter_InterruptClear(AFPtr, XAUD_STS_IOC_IRQ_MASK);
+		if (AFPtr->S2MMStream)
+			XAudioFormatter_StreamIntrHandler(AFPtr->S2MMStream);
 		if (AFPtr->S2MMIOCCallback)
 			AFPtr->S2MMIOCCallback(AFPtr);
 	}
@@ -120,6 +122,8 @@ void *XAudioFormatterMM2SIntrHandler(void *InstancePtr)
 		XAUD_FORMATTER_STS + XAUD_FORMATTER_MM2S_OFFSET);
 	if (Data & XAUD_STS_IOC_IRQ_MASK) {
 		XAudioFormatter_InterruptClear(AFPtr, XAUD_STS_IOC_IRQ_MASK);
+		if (AFPtr->MM2SStream)
+			XAudioFormatter_StreamIntrHandler(AFPtr->MM2SStream);
 		if (AFPtr->MM2SIOCCallback)
 			AFPtr->MM2SIOCCallback(AFPtr);
 	}
@@ -0,0 +1,443 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+*
+* @file xaudioformatter_stream.c
+* @addtogroup audio_formatter_v1_2
+* @{
+*
+* This file contains the stream functions of the Xilinx Audio Formatter core.
+*
+* A stream manages the ring buffer of one direction of the core. The position
+* of the DMA is read from the transfer count register, so the application can
+* follow it without interrupts, and is extended to a 64 bit byte count that is
+* time stamped when it is read. The stream keeps the matching application
+* position, reports the bytes that can be read (S2MM) or written (MM2S),
+* copies data across the ring wrap with the cache maintenance, and detects
+* overruns and underruns.
+*
+* When interrupts are used, the period interrupts update the position and
+* the stream callback is called once per the given number of periods, so
+* that short periods give a fine position without a callback per period.
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <string.h>
+#include "xaudioformatter.h"
+
+/************************** Function Prototypes ******************************/
+
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function returns the register offset of the direction of a stream and
+* selects that direction in the driver instance.
+*
+* @param	StreamPtr is a pointer to the stream.
+*
+* @return	XAUD_FORMATTER_S2MM_OFFSET or XAUD_FORMATTER_MM2S_OFFSET.
+*
+******************************************************************************/
+static u32 XAudioFormatter_StreamSelect(XAudioFormatter_Stream *StreamPtr)
+{
+	StreamPtr->InstancePtr->ChannelId = StreamPtr->ChannelId;
+
+	if (StreamPtr->ChannelId == XAudioFormatter_S2MM)
+		return XAUD_FORMATTER_S2MM_OFFSET;
+
+	return XAUD_FORMATTER_MM2S_OFFSET;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function initializes a stream and sets the hw params of its direction.
+*
+* @param	StreamPtr is a pointer to the stream.
+* @param	InstancePtr is a pointer to the XAudioFormatter instance.
+* @param	ChannelId is the direction of the stream.
+* @param	hw_params are the hw params. buf_addr is the ring buffer,
+*		which must be addressable by the processor as well.
+* @param	Coalesce is the number of period interrupts per call of the
+*		stream callback. 0 disables the period interrupt, the
+*		application then calls XAudioFormatter_StreamUpdate() at least
+*		once per ring buffer duration.
+* @param	GetTimestamp is the function that time stamps the position,
+*		or NULL.
+*
+* @return
+*		- XST_SUCCESS if the stream is initialized.
+*		- XST_FAILURE if the direction is not in the core.
+*
+* @note		The stream is stopped. In interrupt mode the interrupt
+*		handler of the direction must be connected by the caller.
+*
+******************************************************************************/
+u32 XAudioFormatter_StreamInit(XAudioFormatter_Stream *StreamPtr,
+	XAudioFormatter *InstancePtr, XAudioFormatter_ChannelId ChannelId,
+	XAudioFormatterHwParams *hw_params, u32 Coalesce,
+	XAudioFormatter_TimestampFn GetTimestamp)
+{
+	/* Verify arguments. */
+	Xil_AssertNonvoid(StreamPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(hw_params != NULL);
+
+	if (((ChannelId == XAudioFormatter_S2MM) &&
+	     (InstancePtr->s2mm_presence != TRUE)) ||
+	    ((ChannelId == XAudioFormatter_MM2S) &&
+	     (InstancePtr->mm2s_presence != TRUE)))
+		return XST_FAILURE;
+
+	memset(StreamPtr, 0, sizeof(XAudioFormatter_Stream));
+	StreamPtr->InstancePtr = InstancePtr;
+	StreamPtr->ChannelId = ChannelId;
+	StreamPtr->Buffer = (u8 *)(UINTPTR)hw_params->buf_addr;
+	StreamPtr->PeriodBytes = hw_params->bytes_per_period;
+	StreamPtr->BufferBytes = hw_params->bytes_per_period *
+		hw_params->periods;
+	StreamPtr->Coalesce = Coalesce;
+	StreamPtr->GetTimestamp = GetTimestamp;
+
+	(void)XAudioFormatter_StreamSelect(StreamPtr);
+	XAudioFormatterDMAStop(InstancePtr);
+	XAudioFormatterSetHwParams(InstancePtr, hw_params);
+
+	if (ChannelId == XAudioFormatter_S2MM)
+		InstancePtr->S2MMStream = StreamPtr;
+	else
+		InstancePtr->MM2SStream = StreamPtr;
+
+	if (Coalesce != 0)
+		XAudioFormatter_InterruptEnable(InstancePtr,
+			XAUD_CTRL_IOC_IRQ_MASK);
+	else
+		XAudioFormatter_InterruptDisable(InstancePtr,
+			XAUD_CTRL_IOC_IRQ_MASK);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sets the callback of a stream. It is called from the period
+* interrupt once per Coalesce periods, after the position is updated.
+*
+* @param	StreamPtr is a pointer to the stream.
+* @param	CallbackFunc is the callback, called with CallbackRef.
+* @param	CallbackRef is the callback reference.
+*
+* @return	None.
+*
+******************************************************************************/
+void XAudioFormatter_StreamSetCallback(XAudioFormatter_Stream *StreamPtr,
+	XAudioFormatter_Callback CallbackFunc, void *CallbackRef)
+{
+	Xil_AssertVoid(StreamPtr != NULL);
+
+	StreamPtr->Callback = CallbackFunc;
+	StreamPtr->CallbackRef = CallbackRef;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function starts the DMA of a stream from the start of the ring.
+* An MM2S stream should be filled with XAudioFormatter_StreamWrite() first.
+*
+* @param	StreamPtr is a pointer to the stream.
+*
+* @return	None.
+*
+******************************************************************************/
+void XAudioFormatter_StreamStart(XAudioFormatter_Stream *StreamPtr)
+{
+	Xil_AssertVoid(StreamPtr != NULL);
+
+	StreamPtr->HwPos = 0;
+	StreamPtr->HwBytes = 0;
+	StreamPtr->IocCount = 0;
+	if (StreamPtr->ChannelId == XAudioFormatter_S2MM)
+		StreamPtr->AppBytes = 0;
+	if (StreamPtr->GetTimestamp != NULL)
+		StreamPtr->Timestamp = StreamPtr->GetTimestamp();
+
+	(void)XAudioFormatter_StreamSelect(StreamPtr);
+	XAudioFormatterDMAStart(StreamPtr->InstancePtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function stops the DMA of a stream. The application position is kept,
+* and the ring must be refilled before an MM2S stream is started again.
+*
+* @param	StreamPtr is a pointer to the stream.
+*
+* @return	None.
+*
+******************************************************************************/
+void XAudioFormatter_StreamStop(XAudioFormatter_Stream *StreamPtr)
+{
+	Xil_AssertVoid(StreamPtr != NULL);
+
+	(void)XAudioFormatter_StreamSelect(StreamPtr);
+	XAudioFormatterDMAStop(StreamPtr->InstancePtr);
+	if (StreamPtr->ChannelId == XAudioFormatter_MM2S)
+		StreamPtr->AppBytes = 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads the DMA position of a stream and returns the number of
+* bytes the application can read (S2MM) or write (MM2S). On an overrun or
+* underrun the application position is moved to the DMA position and the
+* event is counted in Xruns.
+*
+* @param	StreamPtr is a pointer to the stream.
+*
+* @return	Bytes available to the application.
+*
+* @note		The position read wraps with the ring, so this function must
+*		be called at least once per ring buffer duration. The period
+*		interrupt does it when enabled.
+*
+******************************************************************************/
+u32 XAudioFormatter_StreamUpdate(XAudioFormatter_Stream *StreamPtr)
+{
+	u32 Offset;
+	u32 Pos;
+	u32 Delta;
+
+	Xil_AssertNonvoid(StreamPtr != NULL);
+
+	Offset = XAudioFormatter_StreamSelect(StreamPtr);
+	Pos = XAudioFormatter_ReadReg(StreamPtr->InstancePtr->BaseAddress,
+		XAUD_FORMATTER_XFER_COUNT + Offset);
+	if (StreamPtr->GetTimestamp != NULL)
+		StreamPtr->Timestamp = StreamPtr->GetTimestamp();
+	if (Pos >= StreamPtr->BufferBytes)
+		Pos = 0;
+
+	if (Pos >= StreamPtr->HwPos)
+		Delta = Pos - StreamPtr->HwPos;
+	else
+		Delta = StreamPtr->BufferBytes - StreamPtr->HwPos + Pos;
+	StreamPtr->HwPos = Pos;
+	StreamPtr->HwBytes += Delta;
+
+	if (StreamPtr->ChannelId == XAudioFormatter_S2MM) {
+		if ((StreamPtr->HwBytes - StreamPtr->AppBytes) >
+		    StreamPtr->BufferBytes) {
+			StreamPtr->Xruns++;
+			StreamPtr->AppBytes = StreamPtr->HwBytes -
+				StreamPtr->BufferBytes;
+		}
+		return (u32)(StreamPtr->HwBytes - StreamPtr->AppBytes);
+	}
+
+	if (StreamPtr->HwBytes > StreamPtr->AppBytes) {
+		StreamPtr->Xruns++;
+		StreamPtr->AppBytes = StreamPtr->HwBytes;
+	}
+	return StreamPtr->BufferBytes -
+		(u32)(StreamPtr->AppBytes - StreamPtr->HwBytes);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the DMA position of a stream as of the last update,
+* with its time stamp.
+*
+* @param	StreamPtr is a pointer to the stream.
+* @param	Bytes is set to the bytes transferred by the DMA since the
+*		stream was started.
+* @param	Timestamp is set to the time stamp of the position, or 0 when
+*		the stream has no time stamp function. May be NULL.
+*
+* @return	None.
+*
+******************************************************************************/
+void XAudioFormatter_StreamGetPosition(XAudioFormatter_Stream *StreamPtr,
+	u64 *Bytes, u64 *Timestamp)
+{
+	Xil_AssertVoid(StreamPtr != NULL);
+	Xil_AssertVoid(Bytes != NULL);
+
+	*Bytes = StreamPtr->HwBytes;
+	if (Timestamp != NULL)
+		*Timestamp = StreamPtr->Timestamp;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function calls a function on the next bytes of the ring at the
+* application position, in place, in one or two pieces when the bytes wrap
+* around the end of the ring. The application position is then advanced.
+*
+* For S2MM the cache lines are invalidated before the function is called,
+* for MM2S they are flushed after. This is the hook for sample conversion
+* and mixing without an intermediate copy.
+*
+* @param	StreamPtr is a pointer to the stream.
+* @param	Bytes is the number of bytes, at most the value returned by
+*		XAudioFormatter_StreamUpdate().
+* @param	ProcessFunc is called with ProcessRef, the address and the
+*		length of each piece.
+* @param	ProcessRef is the reference passed to ProcessFunc.
+*
+* @return	None.
+*
+* @note		The ring buffer and the periods should be cache line aligned.
+*
+******************************************************************************/
+void XAudioFormatter_StreamProcess(XAudioFormatter_Stream *StreamPtr,
+	u32 Bytes, XAudioFormatter_ProcessFn ProcessFunc, void *ProcessRef)
+{
+	u32 Pos;
+	u32 Len;
+
+	Xil_AssertVoid(StreamPtr != NULL);
+	Xil_AssertVoid(ProcessFunc != NULL);
+	Xil_AssertVoid(Bytes <= StreamPtr->BufferBytes);
+
+	while (Bytes > 0) {
+		Pos = (u32)(StreamPtr->AppBytes % StreamPtr->BufferBytes);
+		Len = StreamPtr->BufferBytes - Pos;
+		if (Len > Bytes)
+			Len = Bytes;
+
+		if (StreamPtr->ChannelId == XAudioFormatter_S2MM)
+			Xil_DCacheInvalidateRange(
+				(INTPTR)(StreamPtr->Buffer + Pos), Len);
+		ProcessFunc(ProcessRef, StreamPtr->Buffer + Pos, Len);
+		if (StreamPtr->ChannelId == XAudioFormatter_MM2S)
+			Xil_DCacheFlushRange(
+				(INTPTR)(StreamPtr->Buffer + Pos), Len);
+
+		StreamPtr->AppBytes += Len;
+		Bytes -= Len;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function copies captured data from the ring of an S2MM stream.
+*
+* @param	StreamPtr is a pointer to the stream.
+* @param	Data is the destination.
+* @param	Bytes is the number of bytes, at most the value returned by
+*		XAudioFormatter_StreamUpdate().
+*
+* @return	None.
+*
+******************************************************************************/
+void XAudioFormatter_StreamRead(XAudioFormatter_Stream *StreamPtr, u8 *Data,
+	u32 Bytes)
+{
+	u32 Pos;
+	u32 Len;
+
+	Xil_AssertVoid(StreamPtr != NULL);
+	Xil_AssertVoid(StreamPtr->ChannelId == XAudioFormatter_S2MM);
+	Xil_AssertVoid(Data != NULL);
+	Xil_AssertVoid(Bytes <= StreamPtr->BufferBytes);
+
+	while (Bytes > 0) {
+		Pos = (u32)(StreamPtr->AppBytes % StreamPtr->BufferBytes);
+		Len = StreamPtr->BufferBytes - Pos;
+		if (Len > Bytes)
+			Len = Bytes;
+
+		Xil_DCacheInvalidateRange((INTPTR)(StreamPtr->Buffer + Pos),
+			Len);
+		memcpy(Data, StreamPtr->Buffer + Pos, Len);
+
+		StreamPtr->AppBytes += Len;
+		Data += Len;
+		Bytes -= Len;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function copies data to play to the ring of an MM2S stream.
+*
+* @param	StreamPtr is a pointer to the stream.
+* @param	Data is the source.
+* @param	Bytes is the number of bytes, at most the value returned by
+*		XAudioFormatter_StreamUpdate(), or the ring size before the
+*		stream is started.
+*
+* @return	None.
+*
+******************************************************************************/
+void XAudioFormatter_StreamWrite(XAudioFormatter_Stream *StreamPtr,
+	const u8 *Data, u32 Bytes)
+{
+	u32 Pos;
+	u32 Len;
+
+	Xil_AssertVoid(StreamPtr != NULL);
+	Xil_AssertVoid(StreamPtr->ChannelId == XAudioFormatter_MM2S);
+	Xil_AssertVoid(Data != NULL);
+	Xil_AssertVoid(Bytes <= StreamPtr->BufferBytes);
+
+	while (Bytes > 0) {
+		Pos = (u32)(StreamPtr->AppBytes % StreamPtr->BufferBytes);
+		Len = StreamPtr->BufferBytes - Pos;
+		if (Len > Bytes)
+			Len = Bytes;
+
+		memcpy(StreamPtr->Buffer + Pos, Data, Len);
+		Xil_DCacheFlushRange((INTPTR)(StreamPtr->Buffer + Pos), Len);
+
+		StreamPtr->AppBytes += Len;
+		Data += Len;
+		Bytes -= Len;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function handles a period interrupt of a stream. It is called by the
+* interrupt handler of the direction of the stream.
+*
+* @param	StreamPtr is a pointer to the stream.
+*
+* @return	None.
+*
+******************************************************************************/
+void XAudioFormatter_StreamIntrHandler(XAudioFormatter_Stream *StreamPtr)
+{
+	(void)XAudioFormatter_StreamUpdate(StreamPtr);
+
+	if (StreamPtr->Coalesce == 0)
+		return;
+
+	StreamPtr->IocCount++;
+	if (StreamPtr->IocCount >= StreamPtr->Coalesce) {
+		StreamPtr->IocCount = 0;
+		if (StreamPtr->Callback)
+			StreamPtr->Callback(StreamPtr->CallbackRef);
+	}
+}
+/** @} */
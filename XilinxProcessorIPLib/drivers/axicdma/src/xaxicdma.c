@@ -24,6 +24,7 @@
  * 4.1   sk   11/10/15 Used UINTPTR instead of u32 for Baseaddress CR# 867425.
  *                     Changed the prototype of XAxiCdma_CfgInitialize API.
  * 4.7   rsp  11/29/19 Fix XAxiCdma_SimpleTransfer documentation for BTT.
+ * 4.10  ag   10/14/26 Invalidate the cached 2D transfer plan on initialize.
  * </pre>
  *
  *****************************************************************************/
@@ -203,6 +204,7 @@ u32 XAxiCdma_CfgInitialize(XAxiCdma *InstancePtr, XAxiCdma_Config *CfgPtr,
 	InstancePtr->HwBdCnt = 0;
 	InstancePtr->PreBdCnt = 0;
 	InstancePtr->PostBdCnt = 0;
+	InstancePtr->Plan2D.IsReady = 0;
 
 	/* Mark that the driver/engine is in working state now
 	 */
@@ -111,6 +111,26 @@
  * The down side of using the SG DMA transfer is that you have to manage the
  * memory for the buffer descriptors (BD), and setup BDs for the transfers.
  *
+ * <b>2D Transfers</b>
+ *
+ * XAxiCdma_2DTransfer() copies a rectangular region, Height lines of Width
+ * bytes, where the start of consecutive lines is SrcStride bytes apart in
+ * the source and DstStride bytes apart in the destination. The region is
+ * expanded into the fewest BDs the hardware can take: a region whose lines
+ * are contiguous in both buffers is copied as one block, split only at the
+ * maximum transfer length, otherwise each line takes one BD, or more if it
+ * is longer than the maximum transfer length.
+ *
+ * The expansion of a shape is kept in an XAxiCdma_2DPlan.
+ * XAxiCdma_2DPlanInit() builds a plan that can be submitted any number of
+ * times with XAxiCdma_2DPlanSubmit(), which only writes the addresses and
+ * lengths into the allocated BDs. XAxiCdma_2DTransfer() keeps the plan of the last shape
+ * it was called with in the driver instance, so repeating a shape, for
+ * example all tiles of a frame, does not expand it again.
+ *
+ * The BDs of a 2D transfer are retrieved and freed with the BD ring API like
+ * any other SG transfer, and the callback gets all of them at once.
+ *
  * <b>Interrupts</b>
  *
  * The driver handles the interrupts.
@@ -318,6 +338,8 @@
  *                     for doxygen generation of examples.
  * 4.10  sa   08/12/22 Updated the examples to use latest MIG cannoical define
  * 		       i.e XPAR_MIG_0_C0_DDR4_MEMORY_MAP_BASEADDR.
+ *       ag   10/14/26 Added 2D strided transfers, XAxiCdma_2DPlanInit,
+ *                     XAxiCdma_2DPlanSubmit and XAxiCdma_2DTransfer.
  * </pre>
  *****************************************************************************/
 
@@ -394,6 +416,39 @@ typedef struct {
 	volatile int NumBds;            /**< Number of BDs this handler cares */
 }XAxiCdma_IntrHandlerList;
 
+/**
+ * @name XAxiCdma_2DShape
+ *
+ * Shape of a 2D transfer, all values are in bytes
+ *
+ * @{
+ */
+typedef struct {
+	u32 Width;                /**< Bytes copied per line */
+	u32 Height;               /**< Number of lines */
+	u32 SrcStride;            /**< Distance between source lines */
+	u32 DstStride;            /**< Distance between destination lines */
+}XAxiCdma_2DShape;
+
+/**
+ * @name XAxiCdma_2DPlan
+ *
+ * Expansion of a 2D shape into BDs, built by XAxiCdma_2DPlanInit()
+ *
+ * @{
+ */
+typedef struct {
+	XAxiCdma_2DShape Shape;   /**< Shape this plan was built for */
+	u32 NumRows;              /**< Rows after merging contiguous lines */
+	u32 RowLen;               /**< Bytes per row */
+	u32 SegLen;               /**< Maximum bytes per BD */
+	u32 SegsPerRow;           /**< BDs per row */
+	u32 SrcStride;            /**< Distance between source rows */
+	u32 DstStride;            /**< Distance between destination rows */
+	int NumBd;                /**< Total number of BDs */
+	int IsReady;              /**< Plan has been built */
+}XAxiCdma_2DPlan;
+
 /**
  * @name XAxiCdma_Config
  *
@@ -461,6 +516,8 @@ typedef struct {
 	                               /**< List of interrupt handlers */
 	int AddrWidth;		  /**< Address Width */
 
+	XAxiCdma_2DPlan Plan2D;   /**< Plan of the last 2D transfer shape */
+
 }XAxiCdma;
 /* @} */
 
@@ -549,6 +606,17 @@ u32 XAxiCdma_BdRingFree(XAxiCdma *InstancePtr, int NumBd,
 void XAxiCdma_BdSetCurBdPtr(XAxiCdma *InstancePtr, UINTPTR CurBdPtr);
 void XAxiCdma_BdSetTailBdPtr(XAxiCdma *InstancePtr, UINTPTR TailBdPtr);
 
+/* 2D transfer functions
+ */
+int XAxiCdma_2DPlanInit(XAxiCdma *InstancePtr, XAxiCdma_2DPlan *PlanPtr,
+			XAxiCdma_2DShape *ShapePtr);
+int XAxiCdma_2DPlanSubmit(XAxiCdma *InstancePtr, XAxiCdma_2DPlan *PlanPtr,
+			  UINTPTR SrcAddr, UINTPTR DstAddr,
+			  XAxiCdma_CallBackFn CallBackFn, void *CallBackRef);
+int XAxiCdma_2DTransfer(XAxiCdma *InstancePtr, UINTPTR SrcAddr,
+			UINTPTR DstAddr, XAxiCdma_2DShape *ShapePtr,
+			XAxiCdma_CallBackFn CallBackFn, void *CallBackRef);
+
 /* Debug utility function
  */
 void XAxiCdma_DumpRegisters(XAxiCdma *InstancePtr);
@@ -0,0 +1,294 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *  @file xaxicdma_2d.c
+* @addtogroup axicdma_v4_10
+* @{
+ *
+ * Implementation of 2D strided transfers on top of the BD ring. A 2D shape
+ * is expanded once into a plan, and each submission of the plan only writes
+ * the addresses and lengths into the BDs allocated from the ring.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 4.10  ag   10/14/26 First release
+ * </pre>
+ *
+ *****************************************************************************/
+#include "xaxicdma.h"
+#include "xaxicdma_i.h"
+
+/*****************************************************************************/
+/**
+ * This function expands a 2D shape into a plan of BDs.
+ *
+ * Lines that are contiguous in both the source and the destination, that is
+ * SrcStride and DstStride equal to Width, are merged into one row. A row is
+ * split into segments of at most the maximum transfer length, and each
+ * segment takes one BD.
+ *
+ * @param	InstancePtr is the driver instance we are working on
+ * @param	PlanPtr is the plan to build
+ * @param	ShapePtr is the shape of the transfer
+ *
+ * @return
+ *		- XST_SUCCESS for success
+ *		- XST_INVALID_PARAM if the shape is empty, needs too many BDs,
+ *		or has strides not aligned to the word length and the
+ *		hardware build has no DRE
+ *
+ * @note	The plan does not depend on the buffer addresses, it can be
+ *		submitted with XAxiCdma_2DPlanSubmit() for any pair of buffers.
+ *
+ *****************************************************************************/
+int XAxiCdma_2DPlanInit(XAxiCdma *InstancePtr, XAxiCdma_2DPlan *PlanPtr,
+			XAxiCdma_2DShape *ShapePtr)
+{
+	u64 Total;
+	u64 NumBd;
+	u32 WordBits;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(PlanPtr != NULL);
+	Xil_AssertNonvoid(ShapePtr != NULL);
+
+	PlanPtr->IsReady = 0;
+
+	if ((ShapePtr->Width == 0) || (ShapePtr->Height == 0)) {
+		xdbg_printf(XDBG_DEBUG_ERROR, "2DPlanInit: empty shape\r\n");
+
+		return XST_INVALID_PARAM;
+	}
+
+	WordBits = (u32)(InstancePtr->WordLength - 1);
+
+	PlanPtr->SegLen = (u32)InstancePtr->MaxTransLen;
+	if (!InstancePtr->HasDRE) {
+		PlanPtr->SegLen &= ~WordBits;
+	}
+
+	Total = (u64)ShapePtr->Width * ShapePtr->Height;
+
+	/* Merge the lines into a single row if they are contiguous on both
+	 * sides and the row length fits in 32 bits
+	 */
+	if (((ShapePtr->Height == 1) ||
+	     ((ShapePtr->SrcStride == ShapePtr->Width) &&
+	      (ShapePtr->DstStride == ShapePtr->Width))) &&
+	    (Total <= 0xFFFFFFFFU)) {
+		PlanPtr->NumRows = 1;
+		PlanPtr->RowLen = (u32)Total;
+		PlanPtr->SrcStride = 0;
+		PlanPtr->DstStride = 0;
+	}
+	else {
+		if ((!InstancePtr->HasDRE) &&
+		    ((ShapePtr->SrcStride | ShapePtr->DstStride) & WordBits)) {
+
+			xdbg_printf(XDBG_DEBUG_ERROR, "2DPlanInit: strides "
+			    "not aligned to word length %d\r\n",
+			    InstancePtr->WordLength);
+
+			return XST_INVALID_PARAM;
+		}
+
+		PlanPtr->NumRows = ShapePtr->Height;
+		PlanPtr->RowLen = ShapePtr->Width;
+		PlanPtr->SrcStride = ShapePtr->SrcStride;
+		PlanPtr->DstStride = ShapePtr->DstStride;
+	}
+
+	PlanPtr->SegsPerRow = PlanPtr->RowLen / PlanPtr->SegLen;
+	if (PlanPtr->RowLen % PlanPtr->SegLen) {
+		PlanPtr->SegsPerRow += 1;
+	}
+
+	NumBd = (u64)PlanPtr->NumRows * PlanPtr->SegsPerRow;
+	if (NumBd > XAXICDMA_ALL_BDS) {
+		xdbg_printf(XDBG_DEBUG_ERROR, "2DPlanInit: too many BDs\r\n");
+
+		return XST_INVALID_PARAM;
+	}
+
+	PlanPtr->NumBd = (int)NumBd;
+	PlanPtr->Shape = *ShapePtr;
+	PlanPtr->IsReady = 1;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function submits a 2D transfer built by XAxiCdma_2DPlanInit() to the
+ * hardware. It allocates the BDs of the plan from the BD ring, fills them in
+ * and enqueues them with one call to XAxiCdma_BdRingToHw().
+ *
+ * @param	InstancePtr is the driver instance we are working on
+ * @param	PlanPtr is the plan of the transfer
+ * @param	SrcAddr is the source address of the first line
+ * @param	DstAddr is the destination address of the first line
+ * @param	CallBackFn is the callback function for this transfer, NULL is
+ *		fine
+ * @param	CallBackRef is the callback reference pointer
+ *
+ * @return
+ *		- XST_SUCCESS for success
+ *		- XST_INVALID_PARAM if the plan is not built, needs more BDs
+ *		than the BD ring has, or the addresses are not aligned and the
+ *		hardware build has no DRE
+ *		- XST_FAILURE if there are not enough free BDs, or for the
+ *		failures of XAxiCdma_BdRingToHw()
+ *		- XST_FIFO_NO_ROOM if the interrupt handler array is full
+ *
+ * @note	On failure no BDs are left allocated.
+ *
+ *****************************************************************************/
+int XAxiCdma_2DPlanSubmit(XAxiCdma *InstancePtr, XAxiCdma_2DPlan *PlanPtr,
+			  UINTPTR SrcAddr, UINTPTR DstAddr,
+			  XAxiCdma_CallBackFn CallBackFn, void *CallBackRef)
+{
+	XAxiCdma_Bd *BdSetPtr;
+	XAxiCdma_Bd *BdPtr;
+	UINTPTR SrcRow;
+	UINTPTR DstRow;
+	UINTPTR Offset;
+	u32 Row;
+	u32 Seg;
+	u32 Len;
+	LONG Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(PlanPtr != NULL);
+
+	if (!PlanPtr->IsReady) {
+		return XST_INVALID_PARAM;
+	}
+
+	if ((!InstancePtr->HasDRE) &&
+	    ((SrcAddr | DstAddr) & (UINTPTR)(InstancePtr->WordLength - 1))) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "2DPlanSubmit: unaligned "
+		    "transfers not supported\r\n");
+
+		return XST_INVALID_PARAM;
+	}
+
+	/* A plan larger than the ring can never be submitted */
+	if (PlanPtr->NumBd > InstancePtr->AllBdCnt) {
+		return XST_INVALID_PARAM;
+	}
+
+	Status = XAxiCdma_BdRingAlloc(InstancePtr, PlanPtr->NumBd, &BdSetPtr);
+	if (Status != XST_SUCCESS) {
+		return (int)Status;
+	}
+
+	/* The BD attributes were checked when the plan was built, so write
+	 * the hardware words directly. XAxiCdma_BdRingToHw() clears the
+	 * status and flushes the BDs.
+	 */
+	BdPtr = BdSetPtr;
+	SrcRow = SrcAddr;
+	DstRow = DstAddr;
+
+	for (Row = 0; Row < PlanPtr->NumRows; Row++) {
+		Offset = 0;
+
+		for (Seg = 0; Seg < PlanPtr->SegsPerRow; Seg++) {
+			Len = PlanPtr->RowLen - (u32)Offset;
+			if (Len > PlanPtr->SegLen) {
+				Len = PlanPtr->SegLen;
+			}
+
+			XAxiCdma_BdWrite(BdPtr, XAXICDMA_BD_BUFSRC_OFFSET,
+			    LOWER_32_BITS(SrcRow + Offset));
+			XAxiCdma_BdWrite(BdPtr, XAXICDMA_BD_BUFDST_OFFSET,
+			    LOWER_32_BITS(DstRow + Offset));
+			if (InstancePtr->AddrWidth > 32) {
+				XAxiCdma_BdWrite(BdPtr,
+				    XAXICDMA_BD_BUFSRC_MSB_OFFSET,
+				    UPPER_32_BITS(SrcRow + Offset));
+				XAxiCdma_BdWrite(BdPtr,
+				    XAXICDMA_BD_BUFDST_MSB_OFFSET,
+				    UPPER_32_BITS(DstRow + Offset));
+			}
+			XAxiCdma_BdWrite(BdPtr, XAXICDMA_BD_CTRL_LEN_OFFSET,
+			    Len);
+
+			Offset += Len;
+			BdPtr = XAxiCdma_BdRingNext(InstancePtr, BdPtr);
+		}
+
+		SrcRow += PlanPtr->SrcStride;
+		DstRow += PlanPtr->DstStride;
+	}
+
+	Status = XAxiCdma_BdRingToHw(InstancePtr, PlanPtr->NumBd, BdSetPtr,
+	    CallBackFn, CallBackRef);
+	if (Status != XST_SUCCESS) {
+		xdbg_printf(XDBG_DEBUG_ERROR, "2DPlanSubmit: BdRingToHw "
+		    "failed with %d\r\n", (int)Status);
+
+		(void)XAxiCdma_BdRingUnAlloc(InstancePtr, PlanPtr->NumBd,
+		    BdSetPtr);
+	}
+
+	return (int)Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function submits a 2D transfer in one call. The plan of the shape is
+ * kept in the driver instance and only rebuilt when the shape differs from
+ * the shape of the previous call.
+ *
+ * @param	InstancePtr is the driver instance we are working on
+ * @param	SrcAddr is the source address of the first line
+ * @param	DstAddr is the destination address of the first line
+ * @param	ShapePtr is the shape of the transfer
+ * @param	CallBackFn is the callback function for this transfer, NULL is
+ *		fine
+ * @param	CallBackRef is the callback reference pointer
+ *
+ * @return	The return values of XAxiCdma_2DPlanInit() and
+ *		XAxiCdma_2DPlanSubmit()
+ *
+ * @note	Applications that alternate between a few shapes should keep
+ *		one plan per shape and call XAxiCdma_2DPlanSubmit() directly.
+ *
+ *****************************************************************************/
+int XAxiCdma_2DTransfer(XAxiCdma *InstancePtr, UINTPTR SrcAddr,
+			UINTPTR DstAddr, XAxiCdma_2DShape *ShapePtr,
+			XAxiCdma_CallBackFn CallBackFn, void *CallBackRef)
+{
+	XAxiCdma_2DPlan *PlanPtr;
+	int Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(ShapePtr != NULL);
+
+	PlanPtr = &InstancePtr->Plan2D;
+
+	if ((!PlanPtr->IsReady) ||
+	    (PlanPtr->Shape.Width != ShapePtr->Width) ||
+	    (PlanPtr->Shape.Height != ShapePtr->Height) ||
+	    (PlanPtr->Shape.SrcStride != ShapePtr->SrcStride) ||
+	    (PlanPtr->Shape.DstStride != ShapePtr->DstStride)) {
+
+		Status = XAxiCdma_2DPlanInit(InstancePtr, PlanPtr, ShapePtr);
+		if (Status != XST_SUCCESS) {
+			return Status;
+		}
+	}
+
+	return XAxiCdma_2DPlanSubmit(InstancePtr, PlanPtr, SrcAddr, DstAddr,
+	    CallBackFn, CallBackRef);
+}
+/** @} */
@@ -60,6 +60,8 @@
 * 9.8   rsp  07/11/18 Fix cppcheck style warnings. CR #1006164
 * 9.12  sk   06/17/20 Fix the MM2S and S2MM MaxTransferLen calculation in DMA
 *		      Micro Mode.
+* 9.15  ag   10/15/26 Register the performance counters of the rings in
+*		      XAxiDma_CfgInitialize() and count simple mode transfers.
 *
 * </pre>
 ******************************************************************************/
@@ -194,6 +196,8 @@ int XAxiDma_CfgInitialize(XAxiDma * InstancePtr, XAxiDma_Config *Config)
 		InstancePtr->TxBdRing.HasDRE = Config->HasMm2SDRE;
 		InstancePtr->TxBdRing.DataWidth =
 			((unsigned int)Config->Mm2SDataWidth >> 3);
+		XIL_PERF_STATS_REGISTER(&InstancePtr->TxBdRing.Stats,
+					"axidma_tx", BaseAddr);
 	}
 
 	if (InstancePtr->HasS2Mm) {
@@ -224,6 +228,9 @@ int XAxiDma_CfgInitialize(XAxiDma * InstancePtr, XAxiDma_Config *Config)
 				InstancePtr->RxBdRing[Index].Addr_ext = 1;
 			else
 				InstancePtr->RxBdRing[Index].Addr_ext = 0;
+			XIL_PERF_STATS_REGISTER(
+				&InstancePtr->RxBdRing[Index].Stats,
+				"axidma_rx", BaseAddr);
 		}
 	}
 
@@ -897,6 +904,7 @@ u32 XAxiDma_SimpleTransfer(XAxiDma *InstancePtr, UINTPTR BuffAddr, u32 Length,
 		 */
 		XAxiDma_WriteReg(InstancePtr->TxBdRing.ChanBase,
 					XAXIDMA_BUFFLEN_OFFSET, Length);
+		XIL_PERF_STATS_OPS(&InstancePtr->TxBdRing.Stats, 1, Length);
 	}
 	else if(Direction == XAXIDMA_DEVICE_TO_DMA){
 		if ((Length < 1) ||
@@ -957,6 +965,8 @@ u32 XAxiDma_SimpleTransfer(XAxiDma *InstancePtr, UINTPTR BuffAddr, u32 Length,
 		 */
 		XAxiDma_WriteReg(InstancePtr->RxBdRing[RingIndex].ChanBase,
 					XAXIDMA_BUFFLEN_OFFSET, Length);
+		XIL_PERF_STATS_OPS(&InstancePtr->RxBdRing[RingIndex].Stats, 1,
+				   Length);
 
 	}
 
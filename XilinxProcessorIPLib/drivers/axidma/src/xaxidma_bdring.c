@@ -44,6 +44,18 @@
 *       rsp  01/17/18  Use virtual address for register read/write.
 *                      In _BdRingCreate() assign VA to BdaRestart CR#976392
 * 9.9   rsp  02/05/19  Fix XAxiDma_BdRingFromHw implementation for cyclic mode.
+* 9.15  ag   10/14/26  Added XAxiDma_BdRingCreateCoherent to skip BD cache
+*                      maintenance for BDs in non-cacheable or coherent
+*                      memory.
+*       ag   10/14/26  Added XAxiDma_BdRingSubmitVec() and
+*                      XAxiDma_BdRingReapVec() to prepare, commit and reap
+*                      a batch of BDs with a single tail pointer write.
+*       ag   10/14/26  Count completed packets and bytes in
+*                      XAxiDma_BdRingFromHw() and added adaptive interrupt
+*                      moderation with XAxiDma_BdRingDimInit() and
+*                      XAxiDma_BdRingDimUpdate().
+*       ag   10/15/26  Count completed packets, bytes and BD errors in the
+*                      performance counters of the ring.
 *
 * </pre>
 ******************************************************************************/
@@ -66,6 +78,28 @@
 /* The following macros are helper functions inside this file.
  */
 
+/******************************************************************************
+ * Flush or invalidate a BD unless the ring was created with
+ * XAxiDma_BdRingCreateCoherent().
+ *
+ * @param	RingPtr is the BD ring instance holding the BD
+ * @param	BdPtr is the virtual address of the BD
+ *
+ *****************************************************************************/
+#define XAXIDMA_RING_CACHE_FLUSH(RingPtr, BdPtr) \
+	do { \
+		if ((RingPtr)->Coherent == 0) { \
+			XAXIDMA_CACHE_FLUSH(BdPtr); \
+		} \
+	} while (0)
+
+#define XAXIDMA_RING_CACHE_INVALIDATE(RingPtr, BdPtr) \
+	do { \
+		if ((RingPtr)->Coherent == 0) { \
+			XAXIDMA_CACHE_INVALIDATE(BdPtr); \
+		} \
+	} while (0)
+
 /******************************************************************************
  * Compute the physical address of a descriptor from its virtual address
  *
@@ -143,6 +177,10 @@
 
 /************************** Function Prototypes ******************************/
 
+/************************** Function Prototypes ******************************/
+
+static void XAxiDma_BdRingKick(XAxiDma_BdRing *RingPtr);
+
 /************************** Variable Definitions *****************************/
 
 
@@ -343,6 +381,7 @@ u32 XAxiDma_BdRingCreate(XAxiDma_BdRing *RingPtr, UINTPTR PhysAddr,
 	RingPtr->PreCnt = 0;
 	RingPtr->PostCnt = 0;
 	RingPtr->Cyclic = 0;
+	RingPtr->Coherent = 0;
 
 	/* Make sure Alignment parameter meets minimum requirements */
 	if (Alignment < XAXIDMA_BD_MINIMUM_ALIGNMENT) {
@@ -413,7 +452,7 @@ u32 XAxiDma_BdRingCreate(XAxiDma_BdRing *RingPtr, UINTPTR PhysAddr,
 		    (((u32)(RingPtr->HasDRE)) << XAXIDMA_BD_HAS_DRE_SHIFT) |
 		    RingPtr->DataWidth);
 
-		XAXIDMA_CACHE_FLUSH(BdVirtAddr);
+		XAXIDMA_RING_CACHE_FLUSH(RingPtr, BdVirtAddr);
 		BdVirtAddr += RingPtr->Separation;
 		BdPhysAddr += RingPtr->Separation;
 	}
@@ -453,6 +492,45 @@ u32 XAxiDma_BdRingCreate(XAxiDma_BdRing *RingPtr, UINTPTR PhysAddr,
 	return XST_SUCCESS;
 }
 
+/*****************************************************************************/
+/**
+ * This function creates a BD ring as XAxiDma_BdRingCreate() does, for BDs
+ * located in memory that needs no cache maintenance: memory marked
+ * non-cacheable, for example with Xil_SetTlbAttributes(), or memory
+ * accessed by the DMA through a cache coherent port such as the HPC ports
+ * of Zynq UltraScale+ MPSoC. BDs of such a ring are not flushed or
+ * invalidated when they are passed to or taken back from the hardware.
+ *
+ * @param	RingPtr is the BD ring instance to be worked on.
+ * @param	PhysAddr is the physical base address of application memory
+ *		region.
+ * @param	VirtAddr is the virtual base address of the application memory
+ *		region.
+ * @param	Alignment governs the byte alignment of individual BDs, see
+ *		XAxiDma_BdRingCreate().
+ * @param	BdCount is the number of BDs to setup in the application memory
+ *		region.
+ *
+ * @return	Same as XAxiDma_BdRingCreate().
+ *
+ * @note	Using cacheable, non-coherent memory for such a ring leads to
+ *		stale BDs being seen by the hardware or by the driver.
+ *
+ *****************************************************************************/
+u32 XAxiDma_BdRingCreateCoherent(XAxiDma_BdRing *RingPtr, UINTPTR PhysAddr,
+			UINTPTR VirtAddr, u32 Alignment, int BdCount)
+{
+	u32 Status;
+
+	Status = XAxiDma_BdRingCreate(RingPtr, PhysAddr, VirtAddr, Alignment,
+				BdCount);
+	if (Status == XST_SUCCESS) {
+		RingPtr->Coherent = 1;
+	}
+
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * Clone the given BD into every BD in the ring. Only the fields offset from
@@ -526,7 +604,7 @@ int XAxiDma_BdRingClone(XAxiDma_BdRing * RingPtr, XAxiDma_Bd * SrcBdPtr)
 		    (void *)((UINTPTR)(&TmpBd) + XAXIDMA_BD_START_CLEAR),
 		    XAXIDMA_BD_BYTES_TO_CLEAR);
 
-		XAXIDMA_CACHE_FLUSH(CurBd);
+		XAXIDMA_RING_CACHE_FLUSH(RingPtr, CurBd);
 	}
 
 	return XST_SUCCESS;
@@ -574,7 +652,7 @@ int XAxiDma_StartBdRingHw(XAxiDma_BdRing * RingPtr)
 		 */
 		if (RingPtr->HwCnt > 0) {
 
-			XAXIDMA_CACHE_INVALIDATE(RingPtr->HwTail);
+			XAXIDMA_RING_CACHE_INVALIDATE(RingPtr, RingPtr->HwTail);
 			if (RingPtr->Cyclic) {
 				XAxiDma_WriteReg(RingPtr->ChanBase,
 						 XAXIDMA_TDESC_OFFSET,
@@ -752,6 +830,119 @@ void XAxiDma_BdRingGetCoalesce(XAxiDma_BdRing * RingPtr,
 	*TimerPtr = ((Cr & XAXIDMA_DELAY_MASK) >> XAXIDMA_DELAY_SHIFT);
 }
 
+/*****************************************************************************/
+/**
+ * Enable adaptive interrupt moderation on a descriptor ring. The ring starts
+ * on the first, lowest latency, profile. From then on the coalescing
+ * threshold and delay timer are set by XAxiDma_BdRingDimUpdate() and must
+ * not be changed with XAxiDma_BdRingSetCoalesce().
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	Profiles is the profile table, ordered from the lowest latency
+ *		to the highest coalescing, or NULL for the default table of
+ *		xil_dim.h. The Timer values are in units of the delay timer of
+ *		the channel, 125 SG clock cycles.
+ * @param	NumProfiles is the number of profiles in the table.
+ *
+ * @return
+ *		- XST_SUCCESS if the moderation is enabled
+ *		- XST_INVALID_PARAM if the table is empty
+ *		- XST_FAILURE if a profile is out of the range of the coalescing
+ *		threshold or the delay timer
+ *
+ * @note	Use Xil_DimSetBounds() on XAxiDma_BdRingGetDim() to limit the
+ *		profiles used, and thus the added latency.
+ *
+ *		This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingDimInit(XAxiDma_BdRing *RingPtr,
+		const Xil_DimProfile *Profiles, u32 NumProfiles)
+{
+	const Xil_DimProfile *Profile;
+	u32 Index;
+	int Status;
+
+	Status = (int)Xil_DimInit(&RingPtr->Dim, Profiles, NumProfiles);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	for (Index = 0; Index < RingPtr->Dim.NumProfiles; Index++) {
+		Profile = &RingPtr->Dim.Profiles[Index];
+		if ((Profile->Count == 0) || (Profile->Count > 0xFF) ||
+		    (Profile->Timer > 0xFF)) {
+
+			xdbg_printf(XDBG_DEBUG_ERROR, "BdRingDimInit: "
+			"invalid profile %d", (int)Index);
+
+			return XST_FAILURE;
+		}
+	}
+
+	RingPtr->DimPackets = 0;
+	RingPtr->DimBytes = 0;
+	RingPtr->DimEvents = 0;
+	RingPtr->DimEnabled = 1;
+
+	Profile = Xil_DimGetProfile(&RingPtr->Dim);
+
+	return XAxiDma_BdRingSetCoalesce(RingPtr, Profile->Count,
+			Profile->Timer);
+}
+
+/*****************************************************************************/
+/**
+ * Close one epoch of adaptive interrupt moderation. The packets and bytes
+ * completed through XAxiDma_BdRingFromHw() and the interrupts counted with
+ * XAxiDma_BdRingDimCountIrq() since the previous call are fed to the
+ * controller, and the coalescing threshold and delay timer are updated when
+ * it picks a new profile.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ *
+ * @return
+ *		- XST_SUCCESS if the epoch was processed
+ *		- XST_NOT_ENABLED if XAxiDma_BdRingDimInit() was not called
+ *
+ * @note	Call this function at a fixed interval, for example from a
+ *		timer tick. The interval should cover several interrupts at the
+ *		highest coalescing profile.
+ *
+ *		It must not run concurrently with XAxiDma_BdRingFromHw() on the
+ *		same ring.
+ *
+ *		This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingDimUpdate(XAxiDma_BdRing *RingPtr)
+{
+	const Xil_DimProfile *Profile;
+	Xil_DimSample Sample;
+
+	if (!RingPtr->DimEnabled) {
+		return XST_NOT_ENABLED;
+	}
+
+	Sample.Packets = RingPtr->DimPackets;
+	Sample.Bytes = RingPtr->DimBytes;
+	Sample.Events = RingPtr->DimEvents;
+	RingPtr->DimPackets = 0;
+	RingPtr->DimBytes = 0;
+	RingPtr->DimEvents = 0;
+
+	if (Xil_DimUpdate(&RingPtr->Dim, &Sample)) {
+		Profile = Xil_DimGetProfile(&RingPtr->Dim);
+
+		return XAxiDma_BdRingSetCoalesce(RingPtr, Profile->Count,
+				Profile->Timer);
+	}
+
+	return XST_SUCCESS;
+}
+
 /*****************************************************************************/
 /**
  * Reserve locations in the BD ring. The set of returned BDs may be modified in
@@ -1002,7 +1193,6 @@ int XAxiDma_BdRingToHw(XAxiDma_BdRing * RingPtr, int NumBd,
 	int i;
 	u32 BdCr;
 	u32 BdSts;
-	int RingIndex = RingPtr->RingIndex;
 
 	if (NumBd < 0) {
 
@@ -1056,7 +1246,7 @@ int XAxiDma_BdRingToHw(XAxiDma_BdRing * RingPtr, int NumBd,
 		XAxiDma_BdWrite(CurBdPtr, XAXIDMA_BD_STS_OFFSET, BdSts);
 
 		/* Flush the current BD so DMA core could see the updates */
-		XAXIDMA_CACHE_FLUSH(CurBdPtr);
+		XAXIDMA_RING_CACHE_FLUSH(RingPtr, CurBdPtr);
 
 		CurBdPtr = (XAxiDma_Bd *)((void *)XAxiDma_BdRingNext(RingPtr, CurBdPtr));
 		BdCr = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_CTRL_LEN_OFFSET);
@@ -1087,7 +1277,7 @@ int XAxiDma_BdRingToHw(XAxiDma_BdRing * RingPtr, int NumBd,
 	XAxiDma_BdWrite(CurBdPtr, XAXIDMA_BD_STS_OFFSET, BdSts);
 
 	/* Flush the last BD so DMA core could see the updates */
-	XAXIDMA_CACHE_FLUSH(CurBdPtr);
+	XAXIDMA_RING_CACHE_FLUSH(RingPtr, CurBdPtr);
 	DATA_SYNC;
 
 	/* This set has completed pre-processing, adjust ring pointers and
@@ -1100,44 +1290,7 @@ int XAxiDma_BdRingToHw(XAxiDma_BdRing * RingPtr, int NumBd,
 
 	/* If it is running, signal the engine to begin processing */
 	if (RingPtr->RunState == AXIDMA_CHANNEL_NOT_HALTED) {
-			if (RingPtr->Cyclic) {
-				XAxiDma_WriteReg(RingPtr->ChanBase,
-						 XAXIDMA_TDESC_OFFSET,
-						 (u32)XAXIDMA_VIRT_TO_PHYS(RingPtr->CyclicBd));
-				if (RingPtr->Addr_ext)
-					XAxiDma_WriteReg(RingPtr->ChanBase,
-							 XAXIDMA_TDESC_MSB_OFFSET,
-							 UPPER_32_BITS(XAXIDMA_VIRT_TO_PHYS(RingPtr->CyclicBd)));
-				return XST_SUCCESS;
-			}
-
-			if (RingPtr->IsRxChannel) {
-				if (!RingIndex) {
-					XAxiDma_WriteReg(RingPtr->ChanBase,
-							XAXIDMA_TDESC_OFFSET, (XAXIDMA_VIRT_TO_PHYS(RingPtr->HwTail) & XAXIDMA_DESC_LSB_MASK));
-					if (RingPtr->Addr_ext)
-						XAxiDma_WriteReg(RingPtr->ChanBase, XAXIDMA_TDESC_MSB_OFFSET,
-								 UPPER_32_BITS(XAXIDMA_VIRT_TO_PHYS(RingPtr->HwTail)));
-				}
-				else {
-					XAxiDma_WriteReg(RingPtr->ChanBase,
-						(XAXIDMA_RX_TDESC0_OFFSET +
-						(RingIndex - 1) * XAXIDMA_RX_NDESC_OFFSET),
-						(XAXIDMA_VIRT_TO_PHYS(RingPtr->HwTail) & XAXIDMA_DESC_LSB_MASK ));
-					if (RingPtr->Addr_ext)
-						XAxiDma_WriteReg(RingPtr->ChanBase,
-							(XAXIDMA_RX_TDESC0_MSB_OFFSET +
-							(RingIndex - 1) * XAXIDMA_RX_NDESC_OFFSET),
-							UPPER_32_BITS(XAXIDMA_VIRT_TO_PHYS(RingPtr->HwTail)));
-				}
-			}
-			else {
-				XAxiDma_WriteReg(RingPtr->ChanBase,
-							XAXIDMA_TDESC_OFFSET, (XAXIDMA_VIRT_TO_PHYS(RingPtr->HwTail) & XAXIDMA_DESC_LSB_MASK));
-				if (RingPtr->Addr_ext)
-					XAxiDma_WriteReg(RingPtr->ChanBase, XAXIDMA_TDESC_MSB_OFFSET,
-								UPPER_32_BITS(XAXIDMA_VIRT_TO_PHYS(RingPtr->HwTail)));
-			}
+		XAxiDma_BdRingKick(RingPtr);
 	}
 
 	return XST_SUCCESS;
@@ -1223,6 +1376,12 @@ int XAxiDma_BdRingFromHw(XAxiDma_BdRing * RingPtr, int BdLimit,
 	int BdPartialCount;
 	u32 BdSts;
 	u32 BdCr;
+	u32 Packets = 0;
+	u32 Bytes = 0;
+	u32 PktBytes = 0;
+#ifdef XIL_PERF_STATS_ENABLE
+	u32 Errors = 0;
+#endif
 
 	CurBdPtr = RingPtr->HwHead;
 	BdCount = 0;
@@ -1251,7 +1410,7 @@ int XAxiDma_BdRingFromHw(XAxiDma_BdRing * RingPtr, int BdLimit,
 
 	while (BdCount < BdLimit) {
 		/* Read the status */
-		XAXIDMA_CACHE_INVALIDATE(CurBdPtr);
+		XAXIDMA_RING_CACHE_INVALIDATE(RingPtr, CurBdPtr);
 		BdSts = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_STS_OFFSET);
 		BdCr = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_CTRL_LEN_OFFSET);
 
@@ -1264,6 +1423,12 @@ int XAxiDma_BdRingFromHw(XAxiDma_BdRing * RingPtr, int BdLimit,
 
 		BdCount++;
 
+#ifdef XIL_PERF_STATS_ENABLE
+		if ((BdSts & XAXIDMA_BD_STS_ALL_ERR_MASK) != 0U) {
+			Errors++;
+		}
+#endif
+
 		/* Hardware has processed this BD so check the "last" bit. If
 		 * it is clear, then there are more BDs for the current packet.
 		 * Keep a count of these partial packet BDs.
@@ -1277,15 +1442,19 @@ int XAxiDma_BdRingFromHw(XAxiDma_BdRing * RingPtr, int BdLimit,
 			XAXIDMA_BD_STS_RXEOF_MASK)))) {
 
 			BdPartialCount = 0;
+			Packets++;
+			Bytes += PktBytes + (BdSts & RingPtr->MaxTransferLen);
+			PktBytes = 0;
 		}
 		else {
 			BdPartialCount++;
+			PktBytes += BdSts & RingPtr->MaxTransferLen;
 		}
 
 		if (RingPtr->Cyclic) {
 			BdSts = BdSts & ~XAXIDMA_BD_STS_COMPLETE_MASK;
 			XAxiDma_BdWrite(CurBdPtr, XAXIDMA_BD_STS_OFFSET, BdSts);
-			XAXIDMA_CACHE_FLUSH(CurBdPtr);
+			XAXIDMA_RING_CACHE_FLUSH(RingPtr, CurBdPtr);
 		}
 
 		/* Reached the end of the work group */
@@ -1300,6 +1469,13 @@ int XAxiDma_BdRingFromHw(XAxiDma_BdRing * RingPtr, int BdLimit,
 	/* Subtract off any partial packet BDs found */
 	BdCount -= BdPartialCount;
 
+	RingPtr->DimPackets += Packets;
+	RingPtr->DimBytes += Bytes;
+	XIL_PERF_STATS_OPS(&RingPtr->Stats, Packets, Bytes);
+#ifdef XIL_PERF_STATS_ENABLE
+	RingPtr->Stats.Errors += Errors;
+#endif
+
 	/* If BdCount is non-zero then BDs were found to return. Set return
 	 * parameters, update pointers and counters, return success
 	 */
@@ -1379,6 +1555,256 @@ int XAxiDma_BdRingFree(XAxiDma_BdRing * RingPtr, int NumBd,
 
 	return XST_SUCCESS;
 }
+/*****************************************************************************/
+/**
+ * Prepare and commit a batch of buffers to hardware. The BDs are taken from
+ * the free group, filled from the vector, flushed, and handed to hardware
+ * with a single write to the tail descriptor register. This replaces the
+ * XAxiDma_BdRingAlloc(), XAxiDma_BdSetBufAddr(), XAxiDma_BdSetLength(),
+ * XAxiDma_BdSetCtrl() and XAxiDma_BdRingToHw() sequence on the fast path.
+ *
+ * The whole vector is validated before any BD is touched, so on failure the
+ * ring is left unchanged.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	VecPtr is the array of buffers to submit.
+ * @param	NumBd is the number of entries in VecPtr.
+ *
+ * @return
+ *		- XST_SUCCESS if all buffers were committed to hardware
+ *		- XST_INVALID_PARAM if NumBd is not positive, a length is 0 or
+ *		larger than the maximum transfer length, or a buffer address
+ *		is not aligned and the channel has no DRE
+ *		- XST_FAILURE if there are not enough free BDs, or for transmit
+ *		the first entry does not have XAXIDMA_BD_CTRL_TXSOF_MASK or the
+ *		last entry does not have XAXIDMA_BD_CTRL_TXEOF_MASK set
+ *		- XST_DMA_SG_LIST_ERROR if the ring is in cyclic mode or BDs
+ *		allocated with XAxiDma_BdRingAlloc() are not yet committed
+ *
+ * @note	This function should not be preempted by another XAxiDma ring
+ *		function call that modifies the BD space. It is the caller's
+ *		responsibility to provide a mutual exclusion mechanism.
+ *
+ *		The APP words and the ID field of the BDs are not modified.
+ *
+ *		This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingSubmitVec(XAxiDma_BdRing *RingPtr,
+	const XAxiDma_BdVec *VecPtr, int NumBd)
+{
+	XAxiDma_Bd *CurBdPtr;
+	XAxiDma_Bd *LastBdPtr = NULL;
+	UINTPTR AlignMask;
+	int i;
+
+	if ((NumBd <= 0) || (VecPtr == NULL)) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "BdRingSubmitVec: invalid BD "
+			"number %d\r\n", NumBd);
+
+		return XST_INVALID_PARAM;
+	}
+
+	if ((RingPtr->Cyclic) || (RingPtr->PreCnt != 0)) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "BdRingSubmitVec: ring has "
+			"uncommitted BDs or is cyclic\r\n");
+
+		return XST_DMA_SG_LIST_ERROR;
+	}
+
+	if (RingPtr->FreeCnt < NumBd) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "Not enough BDs to alloc %d/%d"
+			"\r\n", NumBd, RingPtr->FreeCnt);
+
+		return XST_FAILURE;
+	}
+
+	if (!(RingPtr->IsRxChannel) &&
+	    (!(VecPtr[0].Ctrl & XAXIDMA_BD_CTRL_TXSOF_MASK) ||
+	     !(VecPtr[NumBd - 1].Ctrl & XAXIDMA_BD_CTRL_TXEOF_MASK))) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "Tx BD vector does not have "
+			"SOF or EOF\r\n");
+
+		return XST_FAILURE;
+	}
+
+	AlignMask = RingPtr->HasDRE ? 0 : (UINTPTR)(RingPtr->DataWidth - 1);
+
+	for (i = 0; i < NumBd; i++) {
+		if ((VecPtr[i].Length == 0) ||
+		    (VecPtr[i].Length > RingPtr->MaxTransferLen) ||
+		    (VecPtr[i].BufAddr & AlignMask)) {
+
+			xdbg_printf(XDBG_DEBUG_ERROR, "BdRingSubmitVec: invalid "
+				"entry %d\r\n", i);
+
+			return XST_INVALID_PARAM;
+		}
+	}
+
+	/* Fill the BDs straight from the free group */
+	CurBdPtr = RingPtr->FreeHead;
+	for (i = 0; i < NumBd; i++) {
+#if defined(__aarch64__) || defined(__arch64__)
+		XAxiDma_BdWrite64(CurBdPtr, XAXIDMA_BD_BUFA_OFFSET,
+				  VecPtr[i].BufAddr);
+#else
+		XAxiDma_BdWrite(CurBdPtr, XAXIDMA_BD_BUFA_OFFSET,
+				VecPtr[i].BufAddr);
+#endif
+		XAxiDma_BdWrite(CurBdPtr, XAXIDMA_BD_CTRL_LEN_OFFSET,
+				VecPtr[i].Length |
+				(VecPtr[i].Ctrl & XAXIDMA_BD_CTRL_ALL_MASK));
+		XAxiDma_BdWrite(CurBdPtr, XAXIDMA_BD_STS_OFFSET, 0);
+
+		/* Flush the BD so DMA core could see the updates */
+		XAXIDMA_RING_CACHE_FLUSH(RingPtr, CurBdPtr);
+
+		LastBdPtr = CurBdPtr;
+		CurBdPtr = (XAxiDma_Bd *)((void *)XAxiDma_BdRingNext(RingPtr,
+							CurBdPtr));
+	}
+	DATA_SYNC;
+
+	/* The BDs skip the pre-work group and go straight to hardware */
+	XAXIDMA_RING_SEEKAHEAD(RingPtr, RingPtr->FreeHead, NumBd);
+	XAXIDMA_RING_SEEKAHEAD(RingPtr, RingPtr->PreHead, NumBd);
+	RingPtr->FreeCnt -= NumBd;
+	RingPtr->HwTail = LastBdPtr;
+	RingPtr->HwCnt += NumBd;
+
+	if (RingPtr->RunState == AXIDMA_CHANNEL_NOT_HALTED) {
+		XAxiDma_BdRingKick(RingPtr);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Reap up to MaxBd BDs completed by hardware into the result array and
+ * return them to the free group in one step. This replaces the
+ * XAxiDma_BdRingFromHw(), XAxiDma_BdGetBufAddr(), XAxiDma_BdGetActualLength(),
+ * XAxiDma_BdGetSts() and XAxiDma_BdRingFree() sequence on the fast path.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	ResPtr is the array receiving one entry per completed BD.
+ * @param	MaxBd is the capacity of ResPtr.
+ *
+ * @return	The number of BDs reaped, 0 if no BD was completed.
+ *
+ * @note	This function should not be preempted by another XAxiDma ring
+ *		function call that modifies the BD space. It is the caller's
+ *		responsibility to provide a mutual exclusion mechanism.
+ *
+ *		Completed BDs returned by XAxiDma_BdRingFromHw() but not yet
+ *		freed must not be pending when this function is called.
+ *
+ *		This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingReapVec(XAxiDma_BdRing *RingPtr,
+	XAxiDma_BdResult *ResPtr, int MaxBd)
+{
+	XAxiDma_Bd *BdSetPtr;
+	XAxiDma_Bd *CurBdPtr;
+	u32 BdSts;
+	int NumBd;
+	int i;
+
+	if ((MaxBd <= 0) || (ResPtr == NULL)) {
+		return 0;
+	}
+
+	NumBd = XAxiDma_BdRingFromHw(RingPtr, MaxBd, &BdSetPtr);
+	if (NumBd == 0) {
+		return 0;
+	}
+
+	/* The BDs were invalidated by XAxiDma_BdRingFromHw() */
+	CurBdPtr = BdSetPtr;
+	for (i = 0; i < NumBd; i++) {
+		BdSts = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_STS_OFFSET);
+#if defined(__aarch64__) || defined(__arch64__)
+		ResPtr[i].BufAddr = (UINTPTR)XAxiDma_BdRead(CurBdPtr,
+						XAXIDMA_BD_BUFA_OFFSET) |
+			((UINTPTR)XAxiDma_BdRead(CurBdPtr,
+						XAXIDMA_BD_BUFA_MSB_OFFSET) << 32);
+#else
+		ResPtr[i].BufAddr = XAxiDma_BdRead(CurBdPtr,
+						XAXIDMA_BD_BUFA_OFFSET);
+#endif
+		ResPtr[i].Length = BdSts & RingPtr->MaxTransferLen;
+		ResPtr[i].Status = BdSts & XAXIDMA_BD_STS_ALL_MASK;
+
+		CurBdPtr = (XAxiDma_Bd *)((void *)XAxiDma_BdRingNext(RingPtr,
+							CurBdPtr));
+	}
+
+	(void)XAxiDma_BdRingFree(RingPtr, NumBd, BdSetPtr);
+
+	return NumBd;
+}
+
+/*****************************************************************************/
+/*
+ * Write the tail descriptor register of a running channel so that hardware
+ * processes the BDs up to RingPtr->HwTail.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XAxiDma_BdRingKick(XAxiDma_BdRing *RingPtr)
+{
+	if (RingPtr->Cyclic) {
+		XAxiDma_WriteReg(RingPtr->ChanBase,
+				 XAXIDMA_TDESC_OFFSET,
+				 (u32)XAXIDMA_VIRT_TO_PHYS(RingPtr->CyclicBd));
+		if (RingPtr->Addr_ext)
+			XAxiDma_WriteReg(RingPtr->ChanBase,
+					 XAXIDMA_TDESC_MSB_OFFSET,
+					 UPPER_32_BITS(XAXIDMA_VIRT_TO_PHYS(RingPtr->CyclicBd)));
+		return;
+	}
+
+	if (RingPtr->IsRxChannel) {
+		if (!RingPtr->RingIndex) {
+			XAxiDma_WriteReg(RingPtr->ChanBase,
+					XAXIDMA_TDESC_OFFSET, (XAXIDMA_VIRT_TO_PHYS(RingPtr->HwTail) & XAXIDMA_DESC_LSB_MASK));
+			if (RingPtr->Addr_ext)
+				XAxiDma_WriteReg(RingPtr->ChanBase, XAXIDMA_TDESC_MSB_OFFSET,
+						 UPPER_32_BITS(XAXIDMA_VIRT_TO_PHYS(RingPtr->HwTail)));
+		}
+		else {
+			XAxiDma_WriteReg(RingPtr->ChanBase,
+				(XAXIDMA_RX_TDESC0_OFFSET +
+				(RingPtr->RingIndex - 1) * XAXIDMA_RX_NDESC_OFFSET),
+				(XAXIDMA_VIRT_TO_PHYS(RingPtr->HwTail) & XAXIDMA_DESC_LSB_MASK ));
+			if (RingPtr->Addr_ext)
+				XAxiDma_WriteReg(RingPtr->ChanBase,
+					(XAXIDMA_RX_TDESC0_MSB_OFFSET +
+					(RingPtr->RingIndex - 1) * XAXIDMA_RX_NDESC_OFFSET),
+					UPPER_32_BITS(XAXIDMA_VIRT_TO_PHYS(RingPtr->HwTail)));
+		}
+	}
+	else {
+		XAxiDma_WriteReg(RingPtr->ChanBase,
+					XAXIDMA_TDESC_OFFSET, (XAXIDMA_VIRT_TO_PHYS(RingPtr->HwTail) & XAXIDMA_DESC_LSB_MASK));
+		if (RingPtr->Addr_ext)
+			XAxiDma_WriteReg(RingPtr->ChanBase, XAXIDMA_TDESC_MSB_OFFSET,
+						UPPER_32_BITS(XAXIDMA_VIRT_TO_PHYS(RingPtr->HwTail)));
+	}
+}
+
 /*****************************************************************************/
 /**
  * Check the internal data structures of the BD ring for the provided channel.
@@ -1513,7 +1939,7 @@ int XAxiDma_BdRingCheck(XAxiDma_BdRing * RingPtr)
 	AddrV = RingPtr->FirstBdAddr;
 	AddrP = RingPtr->FirstBdPhysAddr + RingPtr->Separation;
 	for (i = 1; i < RingPtr->AllCnt; i++) {
-		XAXIDMA_CACHE_INVALIDATE(AddrV);
+		XAXIDMA_RING_CACHE_INVALIDATE(RingPtr, AddrV);
 		/* Check next pointer for this BD. It should equal to the
 		 * physical address of next BD
 		 */
@@ -1533,7 +1959,7 @@ int XAxiDma_BdRingCheck(XAxiDma_BdRing * RingPtr)
 		AddrP += RingPtr->Separation;
 	}
 
-	XAXIDMA_CACHE_INVALIDATE(AddrV);
+	XAXIDMA_RING_CACHE_INVALIDATE(RingPtr, AddrV);
 	/* Last BD should point back to the beginning of ring */
 	if (XAxiDma_BdRead(AddrV, XAXIDMA_BD_NDESC_OFFSET) !=
 	    RingPtr->FirstBdPhysAddr) {
@@ -44,6 +44,15 @@
 * 9.2   vak  15/04/16  Fixed the compilation warnings in axidma driver
 * 9.7   rsp  01/11/18  Use UINTPTR instead of u32 for ChanBase CR#976392
 * 9.15  adk  08/16/22  Fix syntax error in the XAxiDma_BdRingGetCurrBd() API.
+* 9.15  ag   10/14/26  Added Coherent ring attribute and
+*                      XAxiDma_BdRingCreateCoherent().
+*       ag   10/14/26  Added XAxiDma_BdVec, XAxiDma_BdResult,
+*                      XAxiDma_BdRingSubmitVec() and XAxiDma_BdRingReapVec().
+*       ag   10/14/26  Added adaptive interrupt moderation,
+*                      XAxiDma_BdRingDimInit(), XAxiDma_BdRingDimUpdate()
+*                      and XAxiDma_BdRingDimCountIrq().
+*       ag   10/15/26  Added the Stats performance counters of the ring,
+*                      enabled with XIL_PERF_STATS_ENABLE.
 *
 * </pre>
 *
@@ -60,6 +69,8 @@ extern "C" {
 
 #include "xstatus.h"
 #include "xaxidma_bd.h"
+#include "xil_dim.h"
+#include "xil_perfstats.h"
 #include <stdlib.h>
 
 /************************** Constant Definitions *****************************/
@@ -110,8 +121,33 @@ typedef struct {
 	int AllCnt;		/**< Total Number of BDs for channel */
 	int RingIndex;		/**< Ring Index */
 	int Cyclic;		/**< Check for cyclic DMA Mode */
+	int Coherent;		/**< BDs need no cache maintenance */
+	int DimEnabled;		/**< Adaptive moderation is enabled */
+	u32 DimPackets;		/**< Packets completed in this epoch */
+	u32 DimBytes;		/**< Bytes completed in this epoch */
+	u32 DimEvents;		/**< Interrupts taken in this epoch */
+	Xil_Dim Dim;		/**< Adaptive moderation controller */
+#ifdef XIL_PERF_STATS_ENABLE
+	Xil_PerfStats Stats;	/**< Performance counters */
+#endif
 } XAxiDma_BdRing;
 
+/** One buffer passed to XAxiDma_BdRingSubmitVec() */
+typedef struct {
+	UINTPTR BufAddr;	/**< Buffer address */
+	u32 Length;		/**< Buffer length in bytes */
+	u32 Ctrl;		/**< XAXIDMA_BD_CTRL_TXSOF_MASK and
+				     XAXIDMA_BD_CTRL_TXEOF_MASK for Tx,
+				     0 for Rx */
+} XAxiDma_BdVec;
+
+/** One completed BD returned by XAxiDma_BdRingReapVec() */
+typedef struct {
+	UINTPTR BufAddr;	/**< Buffer address */
+	u32 Length;		/**< Bytes actually transferred */
+	u32 Status;		/**< BD status bits, XAXIDMA_BD_STS_* */
+} XAxiDma_BdResult;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /*****************************************************************************/
@@ -519,6 +555,45 @@ typedef struct {
 
 /****************************************************************************/
 
+/*****************************************************************************/
+/**
+* Count one completion interrupt of the ring for adaptive interrupt
+* moderation, and in the performance counters of the ring. Call it from the
+* interrupt handler of the channel.
+*
+* @param	RingPtr is the BD ring to operate on.
+*
+* @return	None
+*
+* @note
+*		C-style signature:
+*		void XAxiDma_BdRingDimCountIrq(XAxiDma_BdRing * RingPtr)
+*
+*****************************************************************************/
+#define XAxiDma_BdRingDimCountIrq(RingPtr) \
+	do { \
+		(RingPtr)->DimEvents++; \
+		XIL_PERF_STATS_INTR(&(RingPtr)->Stats); \
+	} while (0)
+
+/*****************************************************************************/
+/**
+* Return the adaptive moderation controller of the ring. The current profile,
+* level and state are read with Xil_DimGetProfile(), Xil_DimGetLevel() and
+* Xil_DimGetState().
+*
+* @param	RingPtr is the BD ring to operate on.
+*
+* @return	Pointer to the controller of the ring.
+*
+* @note
+*		C-style signature:
+*		Xil_Dim *XAxiDma_BdRingGetDim(XAxiDma_BdRing * RingPtr)
+*
+*****************************************************************************/
+#define XAxiDma_BdRingGetDim(RingPtr) \
+		(&((RingPtr)->Dim))
+
 /************************* Function Prototypes ******************************/
 
 /*
@@ -528,6 +603,8 @@ int XAxiDma_StartBdRingHw(XAxiDma_BdRing* RingPtr);
 int XAxiDma_UpdateBdRingCDesc(XAxiDma_BdRing* RingPtr);
 u32 XAxiDma_BdRingCreate(XAxiDma_BdRing * RingPtr, UINTPTR PhysAddr,
 		UINTPTR VirtAddr, u32 Alignment, int BdCount);
+u32 XAxiDma_BdRingCreateCoherent(XAxiDma_BdRing *RingPtr, UINTPTR PhysAddr,
+		UINTPTR VirtAddr, u32 Alignment, int BdCount);
 int XAxiDma_BdRingClone(XAxiDma_BdRing * RingPtr, XAxiDma_Bd * SrcBdPtr);
 int XAxiDma_BdRingAlloc(XAxiDma_BdRing * RingPtr, int NumBd,
 		XAxiDma_Bd ** BdSetPtr);
@@ -539,10 +616,17 @@ int XAxiDma_BdRingFromHw(XAxiDma_BdRing * RingPtr, int BdLimit,
 		XAxiDma_Bd ** BdSetPtr);
 int XAxiDma_BdRingFree(XAxiDma_BdRing * RingPtr, int NumBd,
 		XAxiDma_Bd * BdSetPtr);
+int XAxiDma_BdRingSubmitVec(XAxiDma_BdRing *RingPtr,
+		const XAxiDma_BdVec *VecPtr, int NumBd);
+int XAxiDma_BdRingReapVec(XAxiDma_BdRing *RingPtr,
+		XAxiDma_BdResult *ResPtr, int MaxBd);
 int XAxiDma_BdRingStart(XAxiDma_BdRing * RingPtr);
 int XAxiDma_BdRingSetCoalesce(XAxiDma_BdRing * RingPtr, u32 Counter, u32 Timer);
 void XAxiDma_BdRingGetCoalesce(XAxiDma_BdRing * RingPtr,
 		u32 *CounterPtr, u32 *TimerPtr);
+int XAxiDma_BdRingDimInit(XAxiDma_BdRing *RingPtr,
+		const Xil_DimProfile *Profiles, u32 NumProfiles);
+int XAxiDma_BdRingDimUpdate(XAxiDma_BdRing *RingPtr);
 
 /* The following functions are for debug only
  */
@@ -235,6 +235,10 @@
 *                     generation.
 * 6.6   ms   04/18/17 Modified tcl file to add suffix U for all macro
 *                     definitions of axipmon in xparameters.h
+* 6.9   ag   10/15/26 Added a sampling engine in xaxipmon_sampler.c that logs
+*                     sampled metric counters on every sample interval
+*                     interrupt to a ring buffer and derives per slot
+*                     bandwidth and latency.
 * </pre>
 *
 *****************************************************************************/
@@ -452,6 +456,48 @@ typedef struct {
 	u8   Mode;		/**< APM Mode */
 } XAxiPmon;
 
+/**
+ * One record of the sampling engine. Counter[n] holds the value of sampled
+ * metric counter n over one sample interval.
+ */
+typedef struct {
+	u64 Timestamp;		/**< Global clock counter when logged */
+	u32 SeqNum;		/**< Sample number since the engine started */
+	u32 Counter[XAPM_MAX_COUNTERS]; /**< Sampled metric counters */
+} XAxiPmon_Sample;
+
+/**
+ * Sampling engine state. The record ring is supplied by the user (normally
+ * a buffer in DDR) and its size must be a power of two.
+ */
+typedef struct {
+	XAxiPmon *InstancePtr;	/**< Monitor the engine samples */
+	XAxiPmon_Sample *RingPtr; /**< Record ring buffer */
+	u32 RingSize;		/**< Number of records in the ring */
+	volatile u32 Head;	/**< Next record written by the handler */
+	volatile u32 Tail;	/**< Next record read by XAxiPmon_SamplerGet */
+	volatile u32 Dropped;	/**< Samples lost because the ring was full */
+	u32 SeqNum;		/**< Number of samples taken */
+	u32 SampleInterval;	/**< Sample interval in clocks */
+	u32 ClockHz;		/**< Monitor clock frequency */
+	u8 NumCounters;		/**< Number of metric counters sampled */
+	u8 Metrics[XAPM_MAX_COUNTERS]; /**< Metric set of each counter */
+	u8 Slot[XAPM_MAX_COUNTERS]; /**< Slot of each counter */
+} XAxiPmon_Sampler;
+
+/**
+ * Per slot statistics derived from one sample. A field is zero when the
+ * metric it needs is not mapped to any counter of the slot.
+ */
+typedef struct {
+	u64 WrBytesPerSec;	/**< Write bandwidth in bytes per second */
+	u64 RdBytesPerSec;	/**< Read bandwidth in bytes per second */
+	u32 WrTransactions;	/**< Write transactions in the interval */
+	u32 RdTransactions;	/**< Read transactions in the interval */
+	u32 WrLatency;		/**< Average write latency in clocks */
+	u32 RdLatency;		/**< Average read latency in clocks */
+} XAxiPmon_SlotStats;
+
 /***************** Macros (Inline Functions) Definitions ********************/
 
 
@@ -912,6 +958,26 @@ u32 XAxiPmon_GetReadIdMask(XAxiPmon *InstancePtr);
  */
 s32 XAxiPmon_SelfTest(XAxiPmon *InstancePtr);
 
+/**
+ * Functions in xaxipmon_sampler.c
+ */
+s32 XAxiPmon_SamplerInit(XAxiPmon_Sampler *SamplerPtr,
+		XAxiPmon *InstancePtr, XAxiPmon_Sample *RingPtr,
+		u32 RingSize, u32 ClockHz);
+
+s32 XAxiPmon_SamplerStart(XAxiPmon_Sampler *SamplerPtr, u32 SampleInterval);
+
+s32 XAxiPmon_SamplerStop(XAxiPmon_Sampler *SamplerPtr);
+
+void XAxiPmon_SamplerIntrHandler(void *CallBackRef);
+
+u32 XAxiPmon_SamplerGet(XAxiPmon_Sampler *SamplerPtr,
+		XAxiPmon_Sample *SamplePtr);
+
+void XAxiPmon_SamplerSlotStats(XAxiPmon_Sampler *SamplerPtr,
+		const XAxiPmon_Sample *SamplePtr, u8 Slot,
+		XAxiPmon_SlotStats *StatsPtr);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,430 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xaxipmon_sampler.c
+* @addtogroup axipmon_v6_9
+* @{
+*
+* This file contains a continuous sampling engine for the AXI Performance
+* Monitor in Advanced mode.
+*
+* The sample interval counter is programmed to reset the metric counters
+* each time it expires, so the sampled metric counters always hold the
+* counts of the last interval. On every sample interval overflow interrupt
+* XAxiPmon_SamplerIntrHandler() copies the sampled metric counters and the
+* global clock counter into the next record of a user supplied ring buffer,
+* normally placed in DDR. The application drains the ring with
+* XAxiPmon_SamplerGet() and can turn a record into per slot bandwidth and
+* latency figures with XAxiPmon_SamplerSlotStats(), using the slot and metric
+* set each counter was mapped to with XAxiPmon_SetMetrics().
+*
+* The handler is the only writer of Head and XAxiPmon_SamplerGet() the only
+* writer of Tail, so the ring needs no locking. When the ring is full new
+* samples are dropped and counted in Dropped.
+*
+* @note	The metric counters must be mapped before XAxiPmon_SamplerStart()
+*	is called. XAxiPmon_SamplerIntrHandler() has to be connected to the
+*	interrupt controller by the application.
+*
+* <pre>
+*
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- -----  -------- -----------------------------------------------------
+* 6.9   ag   10/15/26 First release
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+
+#include "xaxipmon.h"
+
+/************************** Constant Definitions ****************************/
+
+/**************************** Type Definitions ******************************/
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+/************************** Variable Definitions ****************************/
+
+/************************** Function Prototypes *****************************/
+
+static u32 XAxiPmon_SamplerSum(const XAxiPmon_Sampler *SamplerPtr,
+		const XAxiPmon_Sample *SamplePtr, u8 Slot, u8 Metrics);
+
+/*****************************************************************************/
+/**
+*
+* This function initializes a sampling engine for an AXI Performance Monitor.
+*
+* @param	SamplerPtr is a pointer to the XAxiPmon_Sampler to initialize.
+* @param	InstancePtr is a pointer to the initialized XAxiPmon instance.
+* @param	RingPtr is a pointer to the record ring buffer.
+* @param	RingSize is the number of records in RingPtr. It must be a
+*		power of two.
+* @param	ClockHz is the frequency of the monitor clock in Hz, used to
+*		convert byte counts into bandwidth.
+*
+* @return
+*		- XST_SUCCESS if the engine was initialized.
+*		- XST_INVALID_PARAM if RingSize is not a power of two or the
+*		  monitor has no sampled metric counters.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XAxiPmon_SamplerInit(XAxiPmon_Sampler *SamplerPtr,
+		XAxiPmon *InstancePtr, XAxiPmon_Sample *RingPtr,
+		u32 RingSize, u32 ClockHz)
+{
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertNonvoid(SamplerPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(RingPtr != NULL);
+	Xil_AssertNonvoid(ClockHz != 0U);
+
+	if ((RingSize == 0U) || ((RingSize & (RingSize - 1U)) != 0U)) {
+		return XST_INVALID_PARAM;
+	}
+
+	if ((InstancePtr->Mode != XAPM_MODE_ADVANCED) ||
+		(InstancePtr->Config.IsEventCount != 1U) ||
+		(InstancePtr->Config.HaveSampledCounters != 1U)) {
+		return XST_INVALID_PARAM;
+	}
+
+	SamplerPtr->InstancePtr = InstancePtr;
+	SamplerPtr->RingPtr = RingPtr;
+	SamplerPtr->RingSize = RingSize;
+	SamplerPtr->Head = 0U;
+	SamplerPtr->Tail = 0U;
+	SamplerPtr->Dropped = 0U;
+	SamplerPtr->SeqNum = 0U;
+	SamplerPtr->SampleInterval = 0U;
+	SamplerPtr->ClockHz = ClockHz;
+	SamplerPtr->NumCounters = InstancePtr->Config.NumberofCounters;
+	if (SamplerPtr->NumCounters > XAPM_MAX_COUNTERS) {
+		SamplerPtr->NumCounters = (u8)XAPM_MAX_COUNTERS;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function starts continuous sampling. It records the current mapping
+* of every metric counter, resets the metric and global clock counters,
+* starts the counters with the given sample interval, sets the sample
+* interval counter to reset the metric counters on every expiry, and enables
+* the sample interval overflow interrupt.
+*
+* @param	SamplerPtr is a pointer to the XAxiPmon_Sampler.
+* @param	SampleInterval is the sample interval in monitor clocks.
+*
+* @return	XST_SUCCESS
+*
+* @note		Records left in the ring from a previous run are discarded.
+*
+******************************************************************************/
+s32 XAxiPmon_SamplerStart(XAxiPmon_Sampler *SamplerPtr, u32 SampleInterval)
+{
+	XAxiPmon *InstancePtr;
+	u32 RegValue;
+	u8 Index;
+
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertNonvoid(SamplerPtr != NULL);
+	Xil_AssertNonvoid(SamplerPtr->InstancePtr != NULL);
+	Xil_AssertNonvoid(SampleInterval != 0U);
+
+	InstancePtr = SamplerPtr->InstancePtr;
+
+	for (Index = 0U; Index < SamplerPtr->NumCounters; Index++) {
+		(void)XAxiPmon_GetMetrics(InstancePtr, Index,
+				&SamplerPtr->Metrics[Index],
+				&SamplerPtr->Slot[Index]);
+	}
+
+	SamplerPtr->Head = 0U;
+	SamplerPtr->Tail = 0U;
+	SamplerPtr->Dropped = 0U;
+	SamplerPtr->SeqNum = 0U;
+	SamplerPtr->SampleInterval = SampleInterval;
+
+	(void)XAxiPmon_ResetMetricCounter(InstancePtr);
+	XAxiPmon_ResetGlobalClkCounter(InstancePtr);
+
+	(void)XAxiPmon_StartCounters(InstancePtr, SampleInterval);
+
+	/* Reset the metric counters each time they are sampled */
+	RegValue = XAxiPmon_ReadReg(InstancePtr->Config.BaseAddress,
+					XAPM_SICR_OFFSET);
+	XAxiPmon_WriteReg(InstancePtr->Config.BaseAddress, XAPM_SICR_OFFSET,
+				RegValue | XAPM_SICR_MCNTR_RST_MASK);
+
+	XAxiPmon_WriteReg(InstancePtr->Config.BaseAddress, XAPM_IS_OFFSET,
+				XAPM_IXR_SIC_OVERFLOW_MASK);
+	XAxiPmon_IntrEnable(InstancePtr, XAPM_IXR_SIC_OVERFLOW_MASK);
+	XAxiPmon_IntrGlobalEnable(InstancePtr);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function stops continuous sampling. The sample interval overflow
+* interrupt and the sample interval counter are disabled and the counters
+* are stopped. Records already in the ring remain available.
+*
+* @param	SamplerPtr is a pointer to the XAxiPmon_Sampler.
+*
+* @return	XST_SUCCESS
+*
+* @note		The global interrupt enable is left unchanged as other
+*		monitor interrupts may still be in use.
+*
+******************************************************************************/
+s32 XAxiPmon_SamplerStop(XAxiPmon_Sampler *SamplerPtr)
+{
+	XAxiPmon *InstancePtr;
+	u32 RegValue;
+
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertNonvoid(SamplerPtr != NULL);
+	Xil_AssertNonvoid(SamplerPtr->InstancePtr != NULL);
+
+	InstancePtr = SamplerPtr->InstancePtr;
+
+	RegValue = XAxiPmon_ReadReg(InstancePtr->Config.BaseAddress,
+					XAPM_IE_OFFSET);
+	XAxiPmon_WriteReg(InstancePtr->Config.BaseAddress, XAPM_IE_OFFSET,
+				RegValue & ~XAPM_IXR_SIC_OVERFLOW_MASK);
+
+	RegValue = XAxiPmon_ReadReg(InstancePtr->Config.BaseAddress,
+					XAPM_SICR_OFFSET);
+	XAxiPmon_WriteReg(InstancePtr->Config.BaseAddress, XAPM_SICR_OFFSET,
+		RegValue & ~(XAPM_SICR_ENABLE_MASK | XAPM_SICR_MCNTR_RST_MASK));
+
+	(void)XAxiPmon_StopCounters(InstancePtr);
+
+	XAxiPmon_WriteReg(InstancePtr->Config.BaseAddress, XAPM_IS_OFFSET,
+				XAPM_IXR_SIC_OVERFLOW_MASK);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the interrupt handler of the sampling engine. On a sample
+* interval overflow it logs the sampled metric counters of the interval that
+* just ended, timestamped with the global clock counter, to the next free
+* record of the ring.
+*
+* @param	CallBackRef is a pointer to the XAxiPmon_Sampler, passed when
+*		the handler is connected to the interrupt controller.
+*
+* @return	None.
+*
+* @note		The timestamp is taken when the handler runs, so it includes
+*		the interrupt latency. The counter values are not affected as
+*		they are latched by the hardware at the end of the interval.
+*
+******************************************************************************/
+void XAxiPmon_SamplerIntrHandler(void *CallBackRef)
+{
+	XAxiPmon_Sampler *SamplerPtr = (XAxiPmon_Sampler *)CallBackRef;
+	XAxiPmon *InstancePtr;
+	XAxiPmon_Sample *SamplePtr;
+	u32 Status;
+	u32 CntHigh;
+	u32 CntLow;
+	u32 Head;
+	u8 Index;
+
+	Xil_AssertVoid(SamplerPtr != NULL);
+	Xil_AssertVoid(SamplerPtr->InstancePtr != NULL);
+
+	InstancePtr = SamplerPtr->InstancePtr;
+
+	Status = XAxiPmon_ReadReg(InstancePtr->Config.BaseAddress,
+					XAPM_IS_OFFSET);
+	if ((Status & XAPM_IXR_SIC_OVERFLOW_MASK) == 0U) {
+		return;
+	}
+
+	XAxiPmon_WriteReg(InstancePtr->Config.BaseAddress, XAPM_IS_OFFSET,
+				XAPM_IXR_SIC_OVERFLOW_MASK);
+
+	SamplerPtr->SeqNum++;
+
+	Head = SamplerPtr->Head;
+	if ((Head - SamplerPtr->Tail) >= SamplerPtr->RingSize) {
+		SamplerPtr->Dropped++;
+		return;
+	}
+
+	SamplePtr = &SamplerPtr->RingPtr[Head & (SamplerPtr->RingSize - 1U)];
+
+	XAxiPmon_GetGlobalClkCounter(InstancePtr, &CntHigh, &CntLow);
+	SamplePtr->Timestamp = ((u64)CntHigh << 32U) | (u64)CntLow;
+	SamplePtr->SeqNum = SamplerPtr->SeqNum;
+
+	for (Index = 0U; Index < SamplerPtr->NumCounters; Index++) {
+		SamplePtr->Counter[Index] =
+			XAxiPmon_GetSampledMetricCounter(InstancePtr, Index);
+	}
+
+	SamplerPtr->Head = Head + 1U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function removes the oldest record from the ring.
+*
+* @param	SamplerPtr is a pointer to the XAxiPmon_Sampler.
+* @param	SamplePtr is a pointer to the record to fill.
+*
+* @return	1 if a record was copied to SamplePtr, 0 if the ring is empty.
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XAxiPmon_SamplerGet(XAxiPmon_Sampler *SamplerPtr,
+		XAxiPmon_Sample *SamplePtr)
+{
+	u32 Tail;
+
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertNonvoid(SamplerPtr != NULL);
+	Xil_AssertNonvoid(SamplePtr != NULL);
+
+	Tail = SamplerPtr->Tail;
+	if (Tail == SamplerPtr->Head) {
+		return 0U;
+	}
+
+	*SamplePtr = SamplerPtr->RingPtr[Tail & (SamplerPtr->RingSize - 1U)];
+	SamplerPtr->Tail = Tail + 1U;
+
+	return 1U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function derives the bandwidth and average latency of one slot from a
+* record. Counters mapped to the same slot and metric set are added up.
+*
+* @param	SamplerPtr is a pointer to the XAxiPmon_Sampler.
+* @param	SamplePtr is a pointer to a record from XAxiPmon_SamplerGet().
+* @param	Slot is the monitor slot, 0 to XAPM_MAX_AGENTS - 1.
+* @param	StatsPtr is a pointer to the statistics to fill.
+*
+* @return	None.
+*
+* @note		Bandwidth needs the byte count metric sets (XAPM_METRIC_SET_2
+*		and XAPM_METRIC_SET_3) and average latency needs the total
+*		latency (XAPM_METRIC_SET_5 and XAPM_METRIC_SET_6) together with
+*		the transaction count (XAPM_METRIC_SET_0 and XAPM_METRIC_SET_1)
+*		of the slot.
+*
+******************************************************************************/
+void XAxiPmon_SamplerSlotStats(XAxiPmon_Sampler *SamplerPtr,
+		const XAxiPmon_Sample *SamplePtr, u8 Slot,
+		XAxiPmon_SlotStats *StatsPtr)
+{
+	u32 WrBytes;
+	u32 RdBytes;
+	u32 WrLatency;
+	u32 RdLatency;
+
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertVoid(SamplerPtr != NULL);
+	Xil_AssertVoid(SamplePtr != NULL);
+	Xil_AssertVoid(StatsPtr != NULL);
+	Xil_AssertVoid(Slot < XAPM_MAX_AGENTS);
+	Xil_AssertVoid(SamplerPtr->SampleInterval != 0U);
+
+	StatsPtr->WrTransactions = XAxiPmon_SamplerSum(SamplerPtr, SamplePtr,
+				Slot, (u8)XAPM_METRIC_SET_0);
+	StatsPtr->RdTransactions = XAxiPmon_SamplerSum(SamplerPtr, SamplePtr,
+				Slot, (u8)XAPM_METRIC_SET_1);
+	WrBytes = XAxiPmon_SamplerSum(SamplerPtr, SamplePtr, Slot,
+				(u8)XAPM_METRIC_SET_2);
+	RdBytes = XAxiPmon_SamplerSum(SamplerPtr, SamplePtr, Slot,
+				(u8)XAPM_METRIC_SET_3);
+	RdLatency = XAxiPmon_SamplerSum(SamplerPtr, SamplePtr, Slot,
+				(u8)XAPM_METRIC_SET_5);
+	WrLatency = XAxiPmon_SamplerSum(SamplerPtr, SamplePtr, Slot,
+				(u8)XAPM_METRIC_SET_6);
+
+	StatsPtr->WrBytesPerSec = ((u64)WrBytes * SamplerPtr->ClockHz) /
+					SamplerPtr->SampleInterval;
+	StatsPtr->RdBytesPerSec = ((u64)RdBytes * SamplerPtr->ClockHz) /
+					SamplerPtr->SampleInterval;
+
+	StatsPtr->WrLatency = 0U;
+	if (StatsPtr->WrTransactions != 0U) {
+		StatsPtr->WrLatency = WrLatency / StatsPtr->WrTransactions;
+	}
+
+	StatsPtr->RdLatency = 0U;
+	if (StatsPtr->RdTransactions != 0U) {
+		StatsPtr->RdLatency = RdLatency / StatsPtr->RdTransactions;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function adds up the counters of a record that are mapped to the
+* given slot and metric set.
+*
+* @param	SamplerPtr is a pointer to the XAxiPmon_Sampler.
+* @param	SamplePtr is a pointer to the record.
+* @param	Slot is the monitor slot.
+* @param	Metrics is the metric set.
+*
+* @return	Sum of the matching counters.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 XAxiPmon_SamplerSum(const XAxiPmon_Sampler *SamplerPtr,
+		const XAxiPmon_Sample *SamplePtr, u8 Slot, u8 Metrics)
+{
+	u32 Sum = 0U;
+	u8 Index;
+
+	for (Index = 0U; Index < SamplerPtr->NumCounters; Index++) {
+		if ((SamplerPtr->Slot[Index] == Slot) &&
+			(SamplerPtr->Metrics[Index] == Metrics)) {
+			Sum += SamplePtr->Counter[Index];
+		}
+	}
+
+	return Sum;
+}
+/** @} */
@@ -173,6 +173,25 @@
 * Buffer addresses for transfers are physical addresses. If the system does not
 * use MMU, then physical and virtual addresses are the same.
 *
+* <b>Triple Buffer Frame Queue</b>
+*
+* The frame queue, XAxiVdma_FrameQueue, hands complete frames from the write
+* channel to the read channel using three frame stores and park mode. Each
+* frame store is owned by the write channel, which fills it, is published as
+* the latest complete frame, or is owned by the read channel, which shows
+* it. On every write frame count interrupt the frame just written becomes
+* the latest frame and the write channel parks on the free frame store. On
+* every read frame count interrupt the read channel parks on the latest
+* frame if there is a newer one, otherwise it shows its frame again. The
+* read channel therefore always takes the newest frame and never a frame
+* that is still being written.
+*
+* The ownership is kept in one word that the interrupt handlers update with
+* an atomic compare and swap, so no locks are taken and the handlers of the
+* two channels may preempt each other or run on different cores. The frame
+* stores must be set up with XAxiVdma_DmaConfig(), XAxiVdma_DmaSetBufferAddr()
+* and XAxiVdma_DmaStart() before XAxiVdma_FrameQueueStart() is called.
+*
 * <b>API Change from PLB Video DMA</b>
 *
 * We try to keep the API as consistent with the PLB Video DMA driver as
@@ -278,6 +297,7 @@
 * 6.6   rsp  07/02/18 Add vertical flip states in config structures
 * 6.12  sa   08/12/22 Updated the examples to use latest MIG cannoical define
 * 		       i.e XPAR_MIG_0_C0_DDR4_MEMORY_MAP_BASEADDR.
+*       ag   10/14/26 Added the triple buffer frame queue.
 *
 * </pre>
 *
@@ -353,6 +373,11 @@ extern "C" {
  * reinitialize channels.
  *
  */
+/**
+ * Number of frame stores used by the frame queue
+ */
+#define XAXIVDMA_FRMQ_NUM_FRAMES	3
+
 #ifndef XST_VDMA_MISMATCH_ERROR
 #define XST_VDMA_MISMATCH_ERROR 1430
 #endif
@@ -518,6 +543,18 @@ typedef struct {
 	int AddrWidth;		  /**< Address Width */
 } XAxiVdma;
 
+/**
+ * The XAxiVdma_FrameQueue structure contains the state of a triple buffer
+ * frame queue. The statistics are updated by the interrupt handlers.
+ */
+typedef struct {
+    XAxiVdma *InstancePtr;  /**< VDMA the queue works on */
+    u32 State;              /**< Frame store ownership, updated atomically */
+    u32 Published;          /**< Frames completed by the write channel */
+    u32 Dropped;            /**< Frames replaced before they were read */
+    u32 Repeated;           /**< Read passes without a new frame */
+} XAxiVdma_FrameQueue;
+
 
 /************************** Function Prototypes ******************************/
 /* Initialization */
@@ -590,6 +627,17 @@ int XAxiVdma_SetCallBack(XAxiVdma * InstancePtr, u32 HandlerType,
         void *CallBackFunc, void *CallBackRef, u16 Direction);
 int XAxiVdma_Selftest(XAxiVdma * InstancePtr);
 
+/*
+ * Frame queue functions in xaxivdma_frmq.c
+ */
+int XAxiVdma_FrameQueueInit(XAxiVdma_FrameQueue *QueuePtr,
+        XAxiVdma *InstancePtr);
+int XAxiVdma_FrameQueueStart(XAxiVdma_FrameQueue *QueuePtr);
+void XAxiVdma_FrameQueueStop(XAxiVdma_FrameQueue *QueuePtr);
+int XAxiVdma_FrameQueueGetLatest(XAxiVdma_FrameQueue *QueuePtr);
+void XAxiVdma_FrameQueueWriteHandler(void *CallBackRef, u32 InterruptTypes);
+void XAxiVdma_FrameQueueReadHandler(void *CallBackRef, u32 InterruptTypes);
+
 #ifdef __cplusplus
 }
 #endif
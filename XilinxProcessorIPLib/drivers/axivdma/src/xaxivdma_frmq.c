@@ -0,0 +1,389 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xaxivdma_frmq.c
+* @addtogroup axivdma_v6_12
+* @{
+*
+* Implementation of the triple buffer frame queue. Refer to xaxivdma.h for
+* the description of the frame queue.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 6.12  ag   10/14/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xaxivdma.h"
+#include "xaxivdma_i.h"
+
+/************************** Constant Definitions *****************************/
+
+/*
+ * Layout of the State word of the frame queue
+ */
+#define XAXIVDMA_FRMQ_WRITE_SHIFT	0	/**< Frame being written */
+#define XAXIVDMA_FRMQ_LATEST_SHIFT	8	/**< Latest complete frame */
+#define XAXIVDMA_FRMQ_READ_SHIFT	16	/**< Frame being read */
+#define XAXIVDMA_FRMQ_INDEX_MASK	0xFF
+#define XAXIVDMA_FRMQ_FRESH_MASK	0x01000000 /**< Latest not read yet */
+#define XAXIVDMA_FRMQ_VALID_MASK	0x02000000 /**< A frame was published */
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#define XAXIVDMA_FRMQ_GET(State, Shift)		\
+	(((State) >> (Shift)) & XAXIVDMA_FRMQ_INDEX_MASK)
+
+#define XAXIVDMA_FRMQ_SET(Index, Shift)		((u32)(Index) << (Shift))
+
+/*
+ * Atomic access to the State word. Without GCC builtins the handlers of the
+ * two channels must not preempt each other.
+ */
+#if defined (__GNUC__)
+#define XAXIVDMA_FRMQ_LOAD(Ptr)	__atomic_load_n((Ptr), __ATOMIC_ACQUIRE)
+#define XAXIVDMA_FRMQ_CAS(Ptr, Old, New)			\
+	__atomic_compare_exchange_n((Ptr), &(Old), (New), 0,	\
+				    __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+#else
+#define XAXIVDMA_FRMQ_LOAD(Ptr)	(*(volatile u32 *)(Ptr))
+#define XAXIVDMA_FRMQ_CAS(Ptr, Old, New)	((*(Ptr) = (New)), 1)
+#endif
+
+/************************** Function Prototypes ******************************/
+
+static void XAxiVdma_FrameQueuePark(XAxiVdma_FrameQueue *QueuePtr,
+        u32 State);
+
+/*****************************************************************************/
+/**
+ * Initialize a frame queue
+ *
+ * The write channel starts on frame store 0 and the read channel on frame
+ * store 1. The read channel shows frame store 1 until the first frame has
+ * been written.
+ *
+ * @param QueuePtr is the pointer to the frame queue
+ * @param InstancePtr is the pointer to the DMA engine to work on
+ *
+ * @return
+ * - XST_SUCCESS if the frame queue is initialized
+ * - XST_INVALID_PARAM if the hardware has less than
+ *   XAXIVDMA_FRMQ_NUM_FRAMES frame stores
+ *
+ *****************************************************************************/
+int XAxiVdma_FrameQueueInit(XAxiVdma_FrameQueue *QueuePtr,
+        XAxiVdma *InstancePtr)
+{
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XAXIVDMA_DEVICE_READY);
+
+	if (InstancePtr->MaxNumFrames < XAXIVDMA_FRMQ_NUM_FRAMES) {
+		xdbg_printf(XDBG_DEBUG_ERROR,
+		    "Frame queue needs %d frame stores, hardware has %d\r\n",
+		    XAXIVDMA_FRMQ_NUM_FRAMES, InstancePtr->MaxNumFrames);
+
+		return XST_INVALID_PARAM;
+	}
+
+	QueuePtr->InstancePtr = InstancePtr;
+	QueuePtr->State = XAXIVDMA_FRMQ_SET(0, XAXIVDMA_FRMQ_WRITE_SHIFT) |
+	    XAXIVDMA_FRMQ_SET(1, XAXIVDMA_FRMQ_LATEST_SHIFT) |
+	    XAXIVDMA_FRMQ_SET(1, XAXIVDMA_FRMQ_READ_SHIFT);
+	QueuePtr->Published = 0;
+	QueuePtr->Dropped = 0;
+	QueuePtr->Repeated = 0;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Start a frame queue
+ *
+ * The channels are parked on their initial frame stores, the frame count
+ * interrupt is set to fire after every frame, and the frame queue handlers
+ * are installed as the general callbacks of the channels.
+ *
+ * @param QueuePtr is the pointer to the frame queue
+ *
+ * @return
+ * - XST_SUCCESS if the frame queue is started
+ * - XST_FAILURE if setting the frame counter or parking a channel failed
+ *
+ * @note
+ * The channels must be running. The error callbacks are not changed and
+ * must be set by the application.
+ *
+ *****************************************************************************/
+int XAxiVdma_FrameQueueStart(XAxiVdma_FrameQueue *QueuePtr)
+{
+	XAxiVdma *InstancePtr;
+	XAxiVdma_Channel *Channel;
+	XAxiVdma_FrameCounter FrameCfg;
+	u32 State;
+	int Status;
+
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(QueuePtr->InstancePtr != NULL);
+
+	InstancePtr = QueuePtr->InstancePtr;
+
+	FrameCfg.ReadFrameCount = 1;
+	FrameCfg.ReadDelayTimerCount = 0;
+	FrameCfg.WriteFrameCount = 1;
+	FrameCfg.WriteDelayTimerCount = 0;
+
+	Status = XAxiVdma_SetFrameCounter(InstancePtr, &FrameCfg);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	State = XAXIVDMA_FRMQ_LOAD(&QueuePtr->State);
+
+	Channel = XAxiVdma_GetChannel(InstancePtr, XAXIVDMA_WRITE);
+	if (Channel->IsValid) {
+		XAxiVdma_SetCallBack(InstancePtr, XAXIVDMA_HANDLER_GENERAL,
+		    (void *)XAxiVdma_FrameQueueWriteHandler, QueuePtr,
+		    XAXIVDMA_WRITE);
+
+		Status = XAxiVdma_StartParking(InstancePtr,
+		    XAXIVDMA_FRMQ_GET(State, XAXIVDMA_FRMQ_WRITE_SHIFT),
+		    XAXIVDMA_WRITE);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+
+		XAxiVdma_IntrEnable(InstancePtr, XAXIVDMA_IXR_FRMCNT_MASK,
+		    XAXIVDMA_WRITE);
+	}
+
+	Channel = XAxiVdma_GetChannel(InstancePtr, XAXIVDMA_READ);
+	if (Channel->IsValid) {
+		XAxiVdma_SetCallBack(InstancePtr, XAXIVDMA_HANDLER_GENERAL,
+		    (void *)XAxiVdma_FrameQueueReadHandler, QueuePtr,
+		    XAXIVDMA_READ);
+
+		Status = XAxiVdma_StartParking(InstancePtr,
+		    XAXIVDMA_FRMQ_GET(State, XAXIVDMA_FRMQ_READ_SHIFT),
+		    XAXIVDMA_READ);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+
+		XAxiVdma_IntrEnable(InstancePtr, XAXIVDMA_IXR_FRMCNT_MASK,
+		    XAXIVDMA_READ);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Stop a frame queue
+ *
+ * The frame count interrupts are disabled. The channels stay parked on
+ * their current frame stores.
+ *
+ * @param QueuePtr is the pointer to the frame queue
+ *
+ * @return
+ *   None
+ *
+ *****************************************************************************/
+void XAxiVdma_FrameQueueStop(XAxiVdma_FrameQueue *QueuePtr)
+{
+	Xil_AssertVoid(QueuePtr != NULL);
+	Xil_AssertVoid(QueuePtr->InstancePtr != NULL);
+
+	XAxiVdma_IntrDisable(QueuePtr->InstancePtr, XAXIVDMA_IXR_FRMCNT_MASK,
+	    XAXIVDMA_WRITE);
+	XAxiVdma_IntrDisable(QueuePtr->InstancePtr, XAXIVDMA_IXR_FRMCNT_MASK,
+	    XAXIVDMA_READ);
+}
+
+/*****************************************************************************/
+/**
+ * Get the latest complete frame of a frame queue
+ *
+ * @param QueuePtr is the pointer to the frame queue
+ *
+ * @return
+ * The frame store index of the latest complete frame, or -1 if no frame
+ * has been completed yet
+ *
+ * @note
+ * The frame store is only guaranteed to hold this frame until the next
+ * write frame count interrupt, unless the read channel has taken it.
+ *
+ *****************************************************************************/
+int XAxiVdma_FrameQueueGetLatest(XAxiVdma_FrameQueue *QueuePtr)
+{
+	u32 State;
+
+	Xil_AssertNonvoid(QueuePtr != NULL);
+
+	State = XAXIVDMA_FRMQ_LOAD(&QueuePtr->State);
+
+	if (!(State & XAXIVDMA_FRMQ_VALID_MASK)) {
+		return -1;
+	}
+
+	return (int)XAXIVDMA_FRMQ_GET(State, XAXIVDMA_FRMQ_LATEST_SHIFT);
+}
+
+/*****************************************************************************/
+/**
+ * Write channel callback of a frame queue
+ *
+ * The frame just written is published as the latest frame, and the write
+ * channel is parked on the frame store that is neither the latest frame
+ * nor the frame being read.
+ *
+ * @param CallBackRef is the pointer to the frame queue
+ * @param InterruptTypes is the mask of the pending interrupts
+ *
+ * @return
+ *   None
+ *
+ * @note
+ * This is installed by XAxiVdma_FrameQueueStart(). An application that
+ * needs its own write callback can call it from that callback instead.
+ * The new park pointer takes effect at the next frame start, so the handler
+ * must run before the next frame sync.
+ *
+ *****************************************************************************/
+void XAxiVdma_FrameQueueWriteHandler(void *CallBackRef, u32 InterruptTypes)
+{
+	XAxiVdma_FrameQueue *QueuePtr = (XAxiVdma_FrameQueue *)CallBackRef;
+	u32 Old;
+	u32 New;
+	u32 Write;
+	u32 Read;
+	u32 Next;
+
+	if (!(InterruptTypes & XAXIVDMA_IXR_FRMCNT_MASK)) {
+		return;
+	}
+
+	Old = XAXIVDMA_FRMQ_LOAD(&QueuePtr->State);
+	do {
+		Write = XAXIVDMA_FRMQ_GET(Old, XAXIVDMA_FRMQ_WRITE_SHIFT);
+		Read = XAXIVDMA_FRMQ_GET(Old, XAXIVDMA_FRMQ_READ_SHIFT);
+
+		/* Of three frame stores one is always free */
+		for (Next = 0; (Next == Write) || (Next == Read); Next++) {
+			;
+		}
+
+		New = XAXIVDMA_FRMQ_SET(Next, XAXIVDMA_FRMQ_WRITE_SHIFT) |
+		    XAXIVDMA_FRMQ_SET(Write, XAXIVDMA_FRMQ_LATEST_SHIFT) |
+		    XAXIVDMA_FRMQ_SET(Read, XAXIVDMA_FRMQ_READ_SHIFT) |
+		    XAXIVDMA_FRMQ_FRESH_MASK | XAXIVDMA_FRMQ_VALID_MASK;
+	} while (!XAXIVDMA_FRMQ_CAS(&QueuePtr->State, Old, New));
+
+	QueuePtr->Published++;
+	if (Old & XAXIVDMA_FRMQ_FRESH_MASK) {
+		QueuePtr->Dropped++;
+	}
+
+	XAxiVdma_FrameQueuePark(QueuePtr, New);
+}
+
+/*****************************************************************************/
+/**
+ * Read channel callback of a frame queue
+ *
+ * If a frame was published since the last call, the read channel is parked
+ * on it and the frame store read so far is released to the write channel.
+ *
+ * @param CallBackRef is the pointer to the frame queue
+ * @param InterruptTypes is the mask of the pending interrupts
+ *
+ * @return
+ *   None
+ *
+ * @note
+ * This is installed by XAxiVdma_FrameQueueStart(). An application that
+ * needs its own read callback can call it from that callback instead.
+ *
+ *****************************************************************************/
+void XAxiVdma_FrameQueueReadHandler(void *CallBackRef, u32 InterruptTypes)
+{
+	XAxiVdma_FrameQueue *QueuePtr = (XAxiVdma_FrameQueue *)CallBackRef;
+	u32 Old;
+	u32 New;
+	u32 Latest;
+
+	if (!(InterruptTypes & XAXIVDMA_IXR_FRMCNT_MASK)) {
+		return;
+	}
+
+	Old = XAXIVDMA_FRMQ_LOAD(&QueuePtr->State);
+	do {
+		if (!(Old & XAXIVDMA_FRMQ_FRESH_MASK)) {
+			QueuePtr->Repeated++;
+			return;
+		}
+
+		Latest = XAXIVDMA_FRMQ_GET(Old, XAXIVDMA_FRMQ_LATEST_SHIFT);
+
+		New = Old & ~(XAXIVDMA_FRMQ_SET(XAXIVDMA_FRMQ_INDEX_MASK,
+		    XAXIVDMA_FRMQ_READ_SHIFT) | XAXIVDMA_FRMQ_FRESH_MASK);
+		New |= XAXIVDMA_FRMQ_SET(Latest, XAXIVDMA_FRMQ_READ_SHIFT);
+	} while (!XAXIVDMA_FRMQ_CAS(&QueuePtr->State, Old, New));
+
+	XAxiVdma_FrameQueuePark(QueuePtr, New);
+}
+
+/*****************************************************************************/
+/*
+ * Write the park pointers of both channels from the queue state
+ *
+ * The register holds the park pointers of both channels, so it is written
+ * as a whole from the state. If the other channel's handler changed the
+ * state in the meantime, the register is written again with the newer
+ * state, so the last write always matches the last state.
+ *
+ * @param QueuePtr is the pointer to the frame queue
+ * @param State is the state just committed by the caller
+ *
+ * @return
+ *   None
+ *
+ *****************************************************************************/
+static void XAxiVdma_FrameQueuePark(XAxiVdma_FrameQueue *QueuePtr,
+        u32 State)
+{
+	u32 Current;
+	u32 RegValue;
+
+	for (;;) {
+		RegValue = (XAXIVDMA_FRMQ_GET(State, XAXIVDMA_FRMQ_READ_SHIFT) <<
+		    XAXIVDMA_READREF_SHIFT) & XAXIVDMA_PARKPTR_READREF_MASK;
+		RegValue |= (XAXIVDMA_FRMQ_GET(State, XAXIVDMA_FRMQ_WRITE_SHIFT) <<
+		    XAXIVDMA_WRTREF_SHIFT) & XAXIVDMA_PARKPTR_WRTREF_MASK;
+
+		XAxiVdma_WriteReg(QueuePtr->InstancePtr->BaseAddr,
+		    XAXIVDMA_PARKPTR_OFFSET, RegValue);
+
+		Current = XAXIVDMA_FRMQ_LOAD(&QueuePtr->State);
+		if (Current == State) {
+			break;
+		}
+		State = Current;
+	}
+}
+/** @} */
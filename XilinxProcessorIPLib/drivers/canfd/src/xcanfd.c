@@ -60,6 +60,8 @@
 * 2.3  sne  12/18/19 Added Protocol Exception Event and BusOff event support.
 * 2.3	sne  03/06/20 Fixed sending extra frames in XCanFd_Send_Queue API.
 * 2.3	se   03/09/20 Initialize IsPl of config structure.
+* 2.7	ag   10/15/26 Added XCanFd_Recv_Ring() to drain all received frames
+*		      into a ring in one pass.
 *
 *
 * </pre>
@@ -88,6 +90,13 @@ static void StubHandler(void);
 static int XCanfd_TrrVal_Get_SetBit_Position(u32 u);
 static u32 XCanFd_SeqRecv_logic(XCanFd *InstancePtr, u32 ReadIndex,
 	   u32 FsrVal, u32 *FramePtr, u8 fifo_no);
+static void XCanFd_ReadRxFrame(XCanFd *InstancePtr, UINTPTR IdOffset,
+	   UINTPTR DlcOffset, UINTPTR DwOffset, u32 *FramePtr);
+static u32 *XCanFd_RxRingSlot(XCanFd_RxRing *RingPtr, u32 *ScratchPtr);
+static u32 XCanFd_RxRingDrainFifo(XCanFd *InstancePtr, XCanFd_RxRing *RingPtr,
+	   u8 fifo_no);
+static u32 XCanFd_RxRingDrainMailbox(XCanFd *InstancePtr,
+	   XCanFd_RxRing *RingPtr);
 
 /************************** Global Variables ******************************/
 
@@ -880,6 +889,118 @@ u32 XCanFd_Recv_Mailbox(XCanFd *InstancePtr, u32 *FramePtr)
 	}
 }
 
+/*****************************************************************************/
+/**
+*
+* This function initializes a ring of received frames for XCanFd_Recv_Ring().
+*
+* @param	RingPtr is a pointer to the ring to be initialized.
+* @param	FrameStore is the storage for Size frames of XCANFD_FRAME_WORDS
+*		words each.
+* @param	Size is the number of frames the ring holds, a power of two.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XCanFd_RxRingInit(XCanFd_RxRing *RingPtr, u32 *FrameStore, u32 Size)
+{
+	Xil_AssertVoid(RingPtr != NULL);
+	Xil_AssertVoid(FrameStore != NULL);
+	Xil_AssertVoid((Size != (u32)0) && ((Size & (Size - (u32)1)) == (u32)0));
+
+	RingPtr->FrameStore = FrameStore;
+	RingPtr->Size = Size;
+	RingPtr->Head = 0U;
+	RingPtr->Tail = 0U;
+	RingPtr->Dropped = 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function moves every frame held by the core into a ring in one pass.
+* In Sequential Mode the fill level of each RX FIFO is read once and that
+* many frames are copied, each one released with a single write of the IRI
+* bit. In MailBox Mode each RCS register is read once, all the full buffers
+* it reports are copied and then released together with one write.
+*
+* @param	InstancePtr is a pointer to the XCanFd instance to be worked on.
+* @param	RingPtr is a pointer to the ring the frames are written to.
+*
+* @return	Number of frames read from the core.
+*
+* @note		This routine is meant to be called from the receive callback,
+*		one call per interrupt instead of one XCanFd_Recv_Sequential()
+*		or XCanFd_Recv_Mailbox() call per frame. Frames received while
+*		the ring is full are still read out of the core, so that it
+*		keeps receiving, and counted in RingPtr->Dropped.
+*
+******************************************************************************/
+u32 XCanFd_Recv_Ring(XCanFd *InstancePtr, XCanFd_RxRing *RingPtr)
+{
+	u32 Count;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(RingPtr != NULL);
+
+	if (InstancePtr->CanFdConfig.Rx_Mode != (u32)0) {
+		Count = XCanFd_RxRingDrainMailbox(InstancePtr, RingPtr);
+	} else {
+		Count = XCanFd_RxRingDrainFifo(InstancePtr, RingPtr,
+				(u8)XCANFD_RX_FIFO_0);
+		Count += XCanFd_RxRingDrainFifo(InstancePtr, RingPtr,
+				(u8)XCANFD_RX_FIFO_1);
+	}
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function takes the oldest frame out of a ring filled by
+* XCanFd_Recv_Ring().
+*
+* @param	RingPtr is a pointer to the ring to read from.
+* @param	FramePtr is a pointer to a 32-bit aligned buffer of
+*		XCANFD_FRAME_WORDS words where the frame is to be written.
+*
+* @return	- XST_SUCCESS if a frame was copied into the given buffer;
+*		- XST_NO_DATA if the ring is empty.
+*
+* @note		The ring has one producer and one consumer, this routine may
+*		run while XCanFd_Recv_Ring() runs from the interrupt.
+*
+******************************************************************************/
+u32 XCanFd_RxRingGet(XCanFd_RxRing *RingPtr, u32 *FramePtr)
+{
+	u32 *SlotPtr;
+	u32 Dlc;
+	u32 Index;
+
+	Xil_AssertNonvoid(RingPtr != NULL);
+	Xil_AssertNonvoid(FramePtr != NULL);
+
+	if (RingPtr->Head == RingPtr->Tail) {
+		return XST_NO_DATA;
+	}
+
+	SlotPtr = &RingPtr->FrameStore[(RingPtr->Tail & (RingPtr->Size - (u32)1))
+			* XCANFD_FRAME_WORDS];
+	Dlc = (u32)XCanFd_GetDlc2len(SlotPtr[1] & XCANFD_DLCR_DLC_MASK,
+			(SlotPtr[1] & XCANFD_DLCR_EDL_MASK));
+	for (Index = 0U; Index < ((u32)2 + ((Dlc + (u32)3) / XCANFD_DW_BYTES));
+	     Index++) {
+		FramePtr[Index] = SlotPtr[Index];
+	}
+	RingPtr->Tail++;
+
+	return XST_SUCCESS;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -1892,6 +2013,195 @@ static u32 XCanFd_SeqRecv_logic(XCanFd *InstancePtr, u32 ReadIndex, u32 FsrVal,
 
 		return XST_SUCCESS;
 }
+/*****************************************************************************/
+/**
+* This function copies one received frame out of the RX buffer at the given
+* offsets.
+*
+* @param	InstancePtr is a pointer to the XCanFd instance to be worked on.
+* @param	IdOffset is the offset of the ID word of the buffer.
+* @param	DlcOffset is the offset of the DLC word of the buffer.
+* @param	DwOffset is the offset of the first data word of the buffer.
+* @param	FramePtr is a pointer to a 32-bit aligned buffer where the
+*		CAN/CAN FD frame is to be written.
+*
+* @return	None.
+*
+* @note		Only the data words covered by the DLC are read.
+*
+******************************************************************************/
+static void XCanFd_ReadRxFrame(XCanFd *InstancePtr, UINTPTR IdOffset,
+	   UINTPTR DlcOffset, UINTPTR DwOffset, u32 *FramePtr)
+{
+	u32 DwIndex;
+	u32 Dlc;
+
+	FramePtr[0] = XCanFd_ReadReg(InstancePtr->CanFdConfig.BaseAddress,
+			IdOffset);
+	FramePtr[1] = XCanFd_ReadReg(InstancePtr->CanFdConfig.BaseAddress,
+			DlcOffset);
+	Dlc = (u32)XCanFd_GetDlc2len(FramePtr[1] & XCANFD_DLCR_DLC_MASK,
+			(FramePtr[1] & XCANFD_DLCR_EDL_MASK));
+
+	for (DwIndex = (u32)0; (DwIndex * XCANFD_DW_BYTES) < Dlc; DwIndex++) {
+		FramePtr[(u32)2+DwIndex] = Xil_EndianSwap32(XCanFd_ReadReg(
+				InstancePtr->CanFdConfig.BaseAddress,
+				(DwOffset + (DwIndex*XCANFD_DW_BYTES))));
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function returns where the next received frame is to be written.
+*
+* @param	RingPtr is a pointer to the ring being filled.
+* @param	ScratchPtr is a frame sized buffer used when the ring is full.
+*
+* @return	Pointer to the next free frame of the ring, or ScratchPtr if
+*		the ring is full.
+*
+* @note		The frame is added to the ring by incrementing Head once it
+*		has been written.
+*
+******************************************************************************/
+static u32 *XCanFd_RxRingSlot(XCanFd_RxRing *RingPtr, u32 *ScratchPtr)
+{
+	if ((RingPtr->Head - RingPtr->Tail) >= RingPtr->Size) {
+		RingPtr->Dropped++;
+		return ScratchPtr;
+	}
+
+	return &RingPtr->FrameStore[(RingPtr->Head & (RingPtr->Size - (u32)1))
+			* XCANFD_FRAME_WORDS];
+}
+
+/*****************************************************************************/
+/**
+* This function copies all frames stored in one RX FIFO into a ring.
+*
+* @param	InstancePtr is a pointer to the XCanFd instance to be worked on.
+* @param	RingPtr is a pointer to the ring being filled.
+* @param	fifo_no is target fifo number.
+*
+* @return	Number of frames read from the FIFO.
+*
+* @note		The fill level is sampled once, frames received meanwhile are
+*		left for the next call. FSR is read again after each IRI write
+*		for the read index of the next frame, as the FIFO depth is not
+*		known to the driver.
+*
+******************************************************************************/
+static u32 XCanFd_RxRingDrainFifo(XCanFd *InstancePtr, XCanFd_RxRing *RingPtr,
+	   u8 fifo_no)
+{
+	u32 Scratch[XCANFD_FRAME_WORDS];
+	u32 *FramePtr;
+	u32 FsrVal;
+	u32 FillLevel;
+	u32 ReadIndex;
+	u32 Index;
+
+	FsrVal = XCanFd_ReadReg(InstancePtr->CanFdConfig.BaseAddress,
+			XCANFD_FSR_OFFSET);
+	if (fifo_no == (u8)XCANFD_RX_FIFO_0) {
+		FillLevel = (FsrVal & XCANFD_FSR_FL_MASK) >>
+				XCANFD_FSR_FL_0_SHIFT;
+	} else {
+		FillLevel = (FsrVal & XCANFD_FSR_FL_1_MASK) >>
+				XCANFD_FSR_FL_1_SHIFT;
+	}
+
+	for (Index = (u32)0; Index < FillLevel; Index++) {
+		FramePtr = XCanFd_RxRingSlot(RingPtr, Scratch);
+		if (fifo_no == (u8)XCANFD_RX_FIFO_0) {
+			ReadIndex = FsrVal & XCANFD_FSR_RI_MASK;
+			XCanFd_ReadRxFrame(InstancePtr,
+					XCANFD_RXID_OFFSET(ReadIndex),
+					XCANFD_RXDLC_OFFSET(ReadIndex),
+					XCANFD_RXDW_OFFSET(ReadIndex), FramePtr);
+			XCanFd_WriteReg(InstancePtr->CanFdConfig.BaseAddress,
+					XCANFD_FSR_OFFSET, XCANFD_FSR_IRI_MASK);
+		} else {
+			ReadIndex = (FsrVal & XCANFD_FSR_RI_1_MASK) >>
+					XCANFD_FSR_RI_1_SHIFT;
+			XCanFd_ReadRxFrame(InstancePtr,
+					XCANFD_FIFO_1_RXID_OFFSET(ReadIndex),
+					XCANFD_FIFO_1_RXDLC_OFFSET(ReadIndex),
+					XCANFD_FIFO_1_RXDW_OFFSET(ReadIndex),
+					FramePtr);
+			XCanFd_WriteReg(InstancePtr->CanFdConfig.BaseAddress,
+					XCANFD_FSR_OFFSET, XCANFD_FSR_IRI_1_MASK);
+		}
+		if (FramePtr != Scratch) {
+			RingPtr->Head++;
+		}
+		FsrVal = XCanFd_ReadReg(InstancePtr->CanFdConfig.BaseAddress,
+				XCANFD_FSR_OFFSET);
+	}
+
+	return FillLevel;
+}
+
+/*****************************************************************************/
+/**
+* This function copies all full mailbox RX buffers into a ring.
+*
+* @param	InstancePtr is a pointer to the XCanFd instance to be worked on.
+* @param	RingPtr is a pointer to the ring being filled.
+*
+* @return	Number of frames read from the RX buffers.
+*
+* @note		Buffers are copied in index order. The CSB bits of each RCS
+*		register are cleared with one write once its buffers are read.
+*
+******************************************************************************/
+static u32 XCanFd_RxRingDrainMailbox(XCanFd *InstancePtr,
+	   XCanFd_RxRing *RingPtr)
+{
+	u32 Scratch[XCANFD_FRAME_WORDS];
+	u32 *FramePtr;
+	u32 RcsRegNr;
+	u32 NumRcsReg;
+	u32 Result;
+	u32 Full;
+	u32 Pending;
+	u32 RxBufferIndex;
+	u32 Count = 0U;
+
+	NumRcsReg = (u32)XCanFd_Get_NofRxBuffers(InstancePtr);
+	for (RcsRegNr = (u32)0; RcsRegNr < NumRcsReg; RcsRegNr++) {
+		Result = XCanFd_ReadReg(InstancePtr->CanFdConfig.BaseAddress,
+				XCANFD_RCS_OFFSET(RcsRegNr));
+		Full = Result >> XCANFD_CSB_SHIFT;
+		Pending = Full;
+		while (Pending != (u32)0) {
+			RxBufferIndex = (RcsRegNr * XCANFD_CSB_SHIFT) +
+				(u32)XCanfd_TrrVal_Get_SetBit_Position(
+				XCanFD_Check_TrrVal_Set_Bit(Pending));
+			FramePtr = XCanFd_RxRingSlot(RingPtr, Scratch);
+			XCanFd_ReadRxFrame(InstancePtr,
+					XCANFD_RXID_OFFSET(RxBufferIndex),
+					XCANFD_RXDLC_OFFSET(RxBufferIndex),
+					XCANFD_RXDW_OFFSET(RxBufferIndex),
+					FramePtr);
+			if (FramePtr != Scratch) {
+				RingPtr->Head++;
+			}
+			Pending &= Pending - (u32)1;
+			Count++;
+		}
+		if (Full != (u32)0) {
+			/* Clear CSB Bits of RCS Register */
+			XCanFd_WriteReg(InstancePtr->CanFdConfig.BaseAddress,
+				XCANFD_RCS_OFFSET(RcsRegNr),
+				(Result & XCANFD_RCS_HCB_MASK) |
+				(Full << XCANFD_CSB_SHIFT));
+		}
+	}
+
+	return Count;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -256,6 +256,8 @@ exclusion
 * 2.4   sne  08/28/20 Modify Makefile to support parallel make execution.
 * 2.5	sne  11/23/20 Fixed MISRAC violations.
 * 2.7	sne  04/26/22 Corrected Return value of XCanFd_GetFreeBuffer().
+* 2.7	ag   10/15/26 Added ID priority TX scheduler XCanFd_TxSched* and
+*		      batched receive into a ring, XCanFd_Recv_Ring().
 *
 * </pre>
 *
@@ -317,6 +319,14 @@ extern "C" {
 #define XCANFD_RX_FIFO_1	         1 /**< Selection for RX Fifo 1 */
 /** @} */
 
+/** @name TX scheduler and RX ring sizes
+ *  @{
+ */
+#define XCANFD_FRAME_WORDS	(XCANFD_MAX_FRAME_SIZE / XCANFD_DW_BYTES)
+					/**< Words in one frame buffer */
+#define XCANFD_TXSCHED_MAX_FRAMES	64U /**< Maximum TX scheduler depth */
+/** @} */
+
 /** @name Callback identifiers used as parameters to XCanFd_SetHandler()
  *  @{
  */
@@ -418,6 +428,43 @@ typedef struct {
 
 }XCanFd;
 
+/*****************************************************************************/
+/**
+ * The TX scheduler state. Frames are kept ordered by their ID word, lowest
+ * (highest bus priority) first, and the scheduler keeps the highest priority
+ * frames in the TX buffers it owns so the core arbitrates among them. The
+ * user allocates a variable of this type together with the frame storage and
+ * passes it to XCanFd_TxSchedInit().
+ */
+typedef struct {
+	XCanFd *InstancePtr;	/**< Instance owning the TX buffers */
+	u32 *FrameStore;	/**< Depth frames of XCANFD_FRAME_WORDS words */
+	u32 Depth;		/**< Number of frames FrameStore holds */
+	u32 InUse;		/**< Frames waiting or held in a TX buffer */
+	u32 Waiting;		/**< Frames waiting for a TX buffer */
+	u8 Order[XCANFD_TXSCHED_MAX_FRAMES];	/**< Waiting frame slots,
+						  lowest priority first */
+	u8 FreeSlot[XCANFD_TXSCHED_MAX_FRAMES];	/**< Unused frame slots */
+	u8 BufSlot[MAX_BUFFER_INDEX];	/**< Frame slot held in each buffer */
+	u32 BufMask;		/**< TX buffers owned by the scheduler */
+	u32 Busy;		/**< Buffers with a ready request set */
+	u32 Cancel;		/**< Busy buffers with a cancel request set */
+} XCanFd_TxSched;
+
+/*****************************************************************************/
+/**
+ * Ring of received frames filled by XCanFd_Recv_Ring(), typically from the
+ * receive callback, and drained by the application with XCanFd_RxRingGet().
+ * Head and Tail are free running, Size must be a power of two.
+ */
+typedef struct {
+	u32 *FrameStore;	/**< Size frames of XCANFD_FRAME_WORDS words */
+	u32 Size;		/**< Number of frames in the ring */
+	volatile u32 Head;	/**< Frames written by the driver */
+	volatile u32 Tail;	/**< Frames read by the application */
+	u32 Dropped;		/**< Frames discarded on a full ring */
+} XCanFd_RxRing;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /*****************************************************************************/
@@ -1062,6 +1109,15 @@ void XCanFd_Enable_Tranceiver_Delay_Compensation(XCanFd *InstancePtr);
 void XCanFd_Set_Tranceiver_Delay_Compensation(XCanFd *InstancePtr, u32 TdcOffset);
 void XCanFd_Disable_Tranceiver_Delay_Compensation(XCanFd *InstancePtr);
 void XCanFd_Pee_BusOff_Handler(XCanFd *InstancePtr);
+void XCanFd_RxRingInit(XCanFd_RxRing *RingPtr, u32 *FrameStore, u32 Size);
+u32 XCanFd_Recv_Ring(XCanFd *InstancePtr, XCanFd_RxRing *RingPtr);
+u32 XCanFd_RxRingGet(XCanFd_RxRing *RingPtr, u32 *FramePtr);
+
+/* Functions in xcanfd_sched.c */
+int XCanFd_TxSchedInit(XCanFd_TxSched *SchedPtr, XCanFd *InstancePtr,
+			u32 *FrameStore, u32 Depth, u32 BufMask);
+int XCanFd_TxSchedSend(XCanFd_TxSched *SchedPtr, u32 *FramePtr);
+void XCanFd_TxSchedService(XCanFd_TxSched *SchedPtr);
 
 /* Configuration functions in xcan_config.c */
 int XCanFd_SetBaudRatePrescaler(XCanFd *InstancePtr, u8 Prescaler);
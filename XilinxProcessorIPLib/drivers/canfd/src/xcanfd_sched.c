@@ -0,0 +1,375 @@
+/******************************************************************************
+* Copyright (C) 2015 - 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xcanfd_sched.c
+* @addtogroup canfd_v2_6
+* @{
+*
+* This file contains the TX scheduler. XCanFd_Send() and XCanFd_Addto_Queue()
+* fill the TX buffers in call order, so once all buffers are taken a high
+* priority frame waits behind lower priority ones. The scheduler keeps the
+* frames to be sent in a software queue ordered by ID and always holds the
+* highest priority ones in the TX buffers it owns, the core then picks the
+* lowest ID among the ready buffers. When all buffers are taken and a frame
+* of higher priority than one already in a buffer is queued, the lowest
+* priority buffer is cancelled and its frame goes back into the queue.
+*
+* XCanFd_TxSchedSend() never waits. XCanFd_TxSchedService() has to be called
+* when a buffer completes, from the send callback for TXOK and from the event
+* callback for XCANFD_IXR_TXCRS_MASK, or polled.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date      Changes
+* ----- ---- --------- -------------------------------------------------------
+* 2.7   ag   10/15/26  First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xil_types.h"
+#include "xil_assert.h"
+#include "xil_io.h"
+#include "xcanfd.h"
+
+/************************** Constant Definitions *****************************/
+
+
+/**************************** Type Definitions *******************************/
+
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/*****************************************************************************/
+/**
+* This macro returns the ID word of the frame stored in a scheduler slot.
+*
+* @param	SchedPtr is a pointer to the XCanFd_TxSched instance.
+* @param	Slot is the frame slot.
+*
+* @note		none
+*
+*****************************************************************************/
+#define XCanFd_TxSchedId(SchedPtr, Slot) \
+	((SchedPtr)->FrameStore[(u32)(Slot) * XCANFD_FRAME_WORDS])
+
+/************************** Variable Definitions *****************************/
+
+
+/************************** Function Prototypes ******************************/
+
+static void XCanFd_TxSchedInsert(XCanFd_TxSched *SchedPtr, u8 Slot);
+static void XCanFd_TxSchedWriteBuffer(XCanFd *InstancePtr,
+			u32 FreeTxBuffer, const u32 *FramePtr);
+
+/*****************************************************************************/
+/**
+*
+* This function initializes a TX scheduler on top of an initialized XCanFd
+* instance.
+*
+* @param	SchedPtr is a pointer to the XCanFd_TxSched instance.
+* @param	InstancePtr is a pointer to the XCanFd instance to be worked on.
+* @param	FrameStore is the storage for Depth frames of
+*		XCANFD_FRAME_WORDS words each.
+* @param	Depth is the number of frames the scheduler can hold, up to
+*		XCANFD_TXSCHED_MAX_FRAMES.
+* @param	BufMask selects the TX buffers handed to the scheduler, bit n
+*		for buffer n. Buffers beyond the design are ignored.
+*
+* @return	- XST_SUCCESS if the scheduler was initialized;
+*		- XST_INVALID_PARAM if BufMask selects no existing buffer;
+*		- XST_DEVICE_BUSY if one of the buffers has a pending
+*		transmission.
+*
+* @note		Buffers owned by the scheduler must not be used with
+*		XCanFd_Send() or XCanFd_Addto_Queue(). Other buffers remain
+*		available to them.
+*
+******************************************************************************/
+int XCanFd_TxSchedInit(XCanFd_TxSched *SchedPtr, XCanFd *InstancePtr,
+			u32 *FrameStore, u32 Depth, u32 BufMask)
+{
+	u32 Index;
+
+	Xil_AssertNonvoid(SchedPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(FrameStore != NULL);
+	Xil_AssertNonvoid((Depth != (u32)0) &&
+			(Depth <= XCANFD_TXSCHED_MAX_FRAMES));
+
+	if (InstancePtr->CanFdConfig.NumofTxBuf < MAX_BUFFER_INDEX) {
+		BufMask &= ((u32)1 << InstancePtr->CanFdConfig.NumofTxBuf) -
+			(u32)1;
+	}
+	if (BufMask == (u32)0) {
+		return (s32)XST_INVALID_PARAM;
+	}
+
+	if ((XCanFd_ReadReg(InstancePtr->CanFdConfig.BaseAddress,
+			XCANFD_TRR_OFFSET) & BufMask) != (u32)0) {
+		return (s32)XST_DEVICE_BUSY;
+	}
+
+	SchedPtr->InstancePtr = InstancePtr;
+	SchedPtr->FrameStore = FrameStore;
+	SchedPtr->Depth = Depth;
+	SchedPtr->InUse = 0U;
+	SchedPtr->Waiting = 0U;
+	SchedPtr->BufMask = BufMask;
+	SchedPtr->Busy = 0U;
+	SchedPtr->Cancel = 0U;
+	for (Index = 0U; Index < Depth; Index++) {
+		SchedPtr->FreeSlot[Index] = (u8)Index;
+	}
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function queues a CAN/CAN FD frame for transmission and starts it
+* right away if its priority allows. It does not wait for a TX buffer nor for
+* the frame being sent to CAN bus.
+*
+* @param	SchedPtr is a pointer to the XCanFd_TxSched instance.
+* @param	FramePtr is a pointer to a 32-bit aligned buffer containing the
+*		CAN frame to be sent, in the XCanFd_Send() format.
+*
+* @return	- XST_SUCCESS if the frame was queued;
+*		- XST_FIFO_NO_ROOM if the scheduler already holds Depth frames.
+*
+* @note		This routine and XCanFd_TxSchedService() must not run at the
+*		same time. When it is called from task context, the CAN
+*		interrupt has to be disabled around the call.
+*		Frames with the same ID are queued in call order.
+*
+******************************************************************************/
+int XCanFd_TxSchedSend(XCanFd_TxSched *SchedPtr, u32 *FramePtr)
+{
+	u32 *SlotPtr;
+	u32 Dlc;
+	u32 Index;
+	u8 Slot;
+
+	Xil_AssertNonvoid(SchedPtr != NULL);
+	Xil_AssertNonvoid(SchedPtr->InstancePtr != NULL);
+	Xil_AssertNonvoid(FramePtr != NULL);
+
+	if (SchedPtr->InUse == SchedPtr->Depth) {
+		return (s32)XST_FIFO_NO_ROOM;
+	}
+
+	Slot = SchedPtr->FreeSlot[SchedPtr->Depth - SchedPtr->InUse - (u32)1];
+	SchedPtr->InUse++;
+
+	SlotPtr = &SchedPtr->FrameStore[(u32)Slot * XCANFD_FRAME_WORDS];
+	Dlc = (u32)XCanFd_GetDlc2len(FramePtr[1] & XCANFD_DLCR_DLC_MASK,
+			(FramePtr[1] & XCANFD_DLCR_EDL_MASK));
+	for (Index = 0U; Index < ((u32)2 + ((Dlc + (u32)3) / XCANFD_DW_BYTES));
+	     Index++) {
+		SlotPtr[Index] = FramePtr[Index];
+	}
+
+	XCanFd_TxSchedInsert(SchedPtr, Slot);
+	XCanFd_TxSchedService(SchedPtr);
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function moves queued frames into the TX buffers. Buffers whose ready
+* request was served are released first; a frame whose buffer was cancelled
+* goes back into the queue. The highest priority queued frames are then
+* written to the free buffers. If frames are still queued, the buffers
+* holding frames of lower priority than them are cancelled, so that they are
+* refilled on a later call.
+*
+* @param	SchedPtr is a pointer to the XCanFd_TxSched instance.
+*
+* @return	None.
+*
+* @note		Call from the send callback, from the event callback on
+*		XCANFD_IXR_TXCRS_MASK, or periodically when interrupts are not
+*		used. A cancel request is ignored by the core for a frame that
+*		is already on the bus; such a frame is sent and also queued
+*		again, so it may be sent twice.
+*
+******************************************************************************/
+void XCanFd_TxSchedService(XCanFd_TxSched *SchedPtr)
+{
+	XCanFd *InstancePtr;
+	u32 TrrVal;
+	u32 Done;
+	u32 FreeBuf;
+	u32 FreeTxBuffer;
+	u32 Victim;
+	u32 Mask;
+	u32 Index;
+	u8 Slot;
+
+	Xil_AssertVoid(SchedPtr != NULL);
+	Xil_AssertVoid(SchedPtr->InstancePtr != NULL);
+
+	InstancePtr = SchedPtr->InstancePtr;
+	TrrVal = XCanFd_ReadReg(InstancePtr->CanFdConfig.BaseAddress,
+			XCANFD_TRR_OFFSET);
+
+	/* Release the buffers the core is done with */
+	Done = SchedPtr->Busy & (~TrrVal);
+	for (FreeTxBuffer = 0U; Done != (u32)0; FreeTxBuffer++) {
+		Mask = (u32)1 << FreeTxBuffer;
+		if ((Done & Mask) == (u32)0) {
+			continue;
+		}
+		Done &= ~Mask;
+		Slot = SchedPtr->BufSlot[FreeTxBuffer];
+		if ((SchedPtr->Cancel & Mask) != (u32)0) {
+			XCanFd_TxSchedInsert(SchedPtr, Slot);
+		} else {
+			SchedPtr->InUse--;
+			SchedPtr->FreeSlot[SchedPtr->Depth - SchedPtr->InUse -
+				(u32)1] = Slot;
+		}
+	}
+	SchedPtr->Busy &= TrrVal;
+	SchedPtr->Cancel &= TrrVal;
+
+	/* Highest priority frames first, Order is kept lowest priority first */
+	FreeBuf = SchedPtr->BufMask & (~SchedPtr->Busy) & (~TrrVal);
+	for (FreeTxBuffer = 0U; (FreeBuf != (u32)0) &&
+	     (SchedPtr->Waiting != (u32)0); FreeTxBuffer++) {
+		Mask = (u32)1 << FreeTxBuffer;
+		if ((FreeBuf & Mask) == (u32)0) {
+			continue;
+		}
+		FreeBuf &= ~Mask;
+		SchedPtr->Waiting--;
+		Slot = SchedPtr->Order[SchedPtr->Waiting];
+		XCanFd_TxSchedWriteBuffer(InstancePtr, FreeTxBuffer,
+			&SchedPtr->FrameStore[(u32)Slot * XCANFD_FRAME_WORDS]);
+		SchedPtr->BufSlot[FreeTxBuffer] = Slot;
+		SchedPtr->Busy |= Mask;
+
+		/* Only this bit is set, other ready requests are unaffected */
+		XCanFd_WriteReg(InstancePtr->CanFdConfig.BaseAddress,
+				XCANFD_TRR_OFFSET, Mask);
+	}
+
+	/*
+	 * All buffers are taken. Each pending cancel already makes room for
+	 * one queued frame, cancel more buffers as long as the next queued
+	 * frame outranks the lowest priority frame still in a buffer.
+	 */
+	Index = 0U;
+	for (Mask = SchedPtr->Cancel; Mask != (u32)0; Mask &= Mask - (u32)1) {
+		Index++;
+	}
+	for (; Index < SchedPtr->Waiting; Index++) {
+		Victim = MAX_BUFFER_INDEX;
+		Mask = SchedPtr->Busy & (~SchedPtr->Cancel);
+		for (FreeTxBuffer = 0U; Mask != (u32)0; FreeTxBuffer++) {
+			if ((Mask & ((u32)1 << FreeTxBuffer)) == (u32)0) {
+				continue;
+			}
+			Mask &= ~((u32)1 << FreeTxBuffer);
+			if ((Victim == MAX_BUFFER_INDEX) ||
+			    (XCanFd_TxSchedId(SchedPtr,
+				SchedPtr->BufSlot[FreeTxBuffer]) >
+			     XCanFd_TxSchedId(SchedPtr,
+				SchedPtr->BufSlot[Victim]))) {
+				Victim = FreeTxBuffer;
+			}
+		}
+		if ((Victim == MAX_BUFFER_INDEX) ||
+		    (XCanFd_TxSchedId(SchedPtr, SchedPtr->BufSlot[Victim]) <=
+		     XCanFd_TxSchedId(SchedPtr, SchedPtr->Order[
+			SchedPtr->Waiting - Index - (u32)1]))) {
+			break;
+		}
+		XCanFd_WriteReg(InstancePtr->CanFdConfig.BaseAddress,
+				XCANFD_TCR_OFFSET, (u32)1 << Victim);
+		SchedPtr->Cancel |= (u32)1 << Victim;
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function adds a frame slot to the ordered queue. The queue is kept
+* lowest priority first so that the next frame to send is taken from its
+* end. A lower ID word means a higher priority, as in bus arbitration.
+*
+* @param	SchedPtr is a pointer to the XCanFd_TxSched instance.
+* @param	Slot is the frame slot to add.
+*
+* @return	None.
+*
+* @note		A frame is placed before the frames with the same ID word, so
+*		that these are sent in the order they were queued.
+*
+******************************************************************************/
+static void XCanFd_TxSchedInsert(XCanFd_TxSched *SchedPtr, u8 Slot)
+{
+	u32 Id = XCanFd_TxSchedId(SchedPtr, Slot);
+	u32 Index = SchedPtr->Waiting;
+
+	while ((Index > (u32)0) &&
+	       (XCanFd_TxSchedId(SchedPtr, SchedPtr->Order[Index - (u32)1])
+		<= Id)) {
+		SchedPtr->Order[Index] = SchedPtr->Order[Index - (u32)1];
+		Index--;
+	}
+	SchedPtr->Order[Index] = Slot;
+	SchedPtr->Waiting++;
+}
+
+/*****************************************************************************/
+/**
+* This function writes a frame into a TX buffer without requesting its
+* transmission.
+*
+* @param	InstancePtr is a pointer to the XCanFd instance to be worked on.
+* @param	FreeTxBuffer is the TX buffer to write.
+* @param	FramePtr is a pointer to the frame in the XCanFd_Send() format.
+*
+* @return	None.
+*
+* @note		Only the data words covered by the DLC are written.
+*
+******************************************************************************/
+static void XCanFd_TxSchedWriteBuffer(XCanFd *InstancePtr,
+			u32 FreeTxBuffer, const u32 *FramePtr)
+{
+	u32 DwIndex;
+	u32 Dlc;
+
+	/* Write ID to ID Register */
+	XCanFd_WriteReg(InstancePtr->CanFdConfig.BaseAddress,
+			XCANFD_TXID_OFFSET(FreeTxBuffer), FramePtr[0]);
+
+	/* Write DLC to DLC Register */
+	XCanFd_WriteReg(InstancePtr->CanFdConfig.BaseAddress,
+			XCANFD_TXDLC_OFFSET(FreeTxBuffer), FramePtr[1]);
+
+	Dlc = (u32)XCanFd_GetDlc2len(FramePtr[1] & XCANFD_DLCR_DLC_MASK,
+			(FramePtr[1] & XCANFD_DLCR_EDL_MASK));
+	for (DwIndex = 0U; (DwIndex * XCANFD_DW_BYTES) < Dlc; DwIndex++) {
+		XCanFd_WriteReg(InstancePtr->CanFdConfig.BaseAddress,
+				(XCANFD_TXDW_OFFSET(FreeTxBuffer) +
+				(DwIndex * XCANFD_DW_BYTES)),
+				Xil_EndianSwap32(FramePtr[(u32)2 + DwIndex]));
+	}
+}
+/** @} */
@@ -47,6 +47,9 @@
 *       dc     01/31/22 CCF IP MODEL_PARAM register change
 *       dc     03/21/22 Add prefix to global variables
 * 1.4   dc     04/08/22 Update documentation
+*       ag     10/15/26 Write only the changed NEXT CC configuration
+*                       registers
+*       ag     10/15/26 Add precompiled coefficient images and banks
 *
 * </pre>
 * @addtogroup dfeccf Overview
@@ -459,6 +462,28 @@ XDfeCcf_GetInternalCarrierCfg(const XDfeCcf *InstancePtr, s32 CCID,
 					      XDFECCF_GAIN_OFFSET, Val);
 }
 
+/****************************************************************************/
+/**
+*
+* Writes a NEXT CC configuration register unless it already holds the value.
+* The NEXT registers keep their value across a CC update, so a carrier add
+* or remove only writes the registers of the carriers and slots it changes.
+*
+* @param    InstancePtr Pointer to the Ccf instance.
+* @param    Offset Register offset.
+* @param    Shadow Driver copy of the register.
+* @param    Data Value to be written.
+*
+****************************************************************************/
+static void XDfeCcf_WriteNextReg(XDfeCcf *InstancePtr, u32 Offset, u32 *Shadow,
+				 u32 Data)
+{
+	if ((InstancePtr->NextShadow.IsValid == 0U) || (*Shadow != Data)) {
+		XDfeCcf_WriteReg(InstancePtr, Offset, Data);
+		*Shadow = Data;
+	}
+}
+
 /****************************************************************************/
 /**
 *
@@ -468,9 +493,10 @@ XDfeCcf_GetInternalCarrierCfg(const XDfeCcf *InstancePtr, s32 CCID,
 * @param    NextCCCfg Next CC configuration container.
 *
 ****************************************************************************/
-static void XDfeCcf_SetNextCCCfg(const XDfeCcf *InstancePtr,
+static void XDfeCcf_SetNextCCCfg(XDfeCcf *InstancePtr,
 				 const XDfeCcf_CCCfg *NextCCCfg)
 {
+	XDfeCcf_NextShadow *Shadow = &InstancePtr->NextShadow;
 	u32 AntennaCfg = 0U;
 	u32 CarrierCfg;
 	u32 Index;
@@ -490,9 +516,9 @@ static void XDfeCcf_SetNextCCCfg(const XDfeCcf *InstancePtr,
 
 	/* Write CCID sequence and carrier configurations */
 	for (Index = 0; Index < XDFECCF_CC_NUM; Index++) {
-		XDfeCcf_WriteReg(InstancePtr,
-				 XDFECCF_SEQUENCE_NEXT + (sizeof(u32) * Index),
-				 NextCCID[Index]);
+		XDfeCcf_WriteNextReg(InstancePtr,
+				     XDFECCF_SEQUENCE_NEXT + (sizeof(u32) * Index),
+				     &Shadow->Sequence[Index], NextCCID[Index]);
 
 		CarrierCfg =
 			XDfeCcf_WrBitField(XDFECCF_ENABLE_WIDTH,
@@ -515,18 +541,21 @@ static void XDfeCcf_SetNextCCCfg(const XDfeCcf *InstancePtr,
 		CarrierCfg = XDfeCcf_WrBitField(
 			XDFECCF_RE_COEFF_SET_WIDTH, XDFECCF_RE_COEFF_SET_OFFSET,
 			CarrierCfg, NextCCCfg->CarrierCfg[Index].RealCoeffSet);
-		XDfeCcf_WriteReg(InstancePtr,
-				 XDFECCF_CARRIER_CONFIGURATION_NEXT +
-					 (sizeof(u32) * Index),
-				 CarrierCfg);
+		XDfeCcf_WriteNextReg(InstancePtr,
+				     XDFECCF_CARRIER_CONFIGURATION_NEXT +
+					     (sizeof(u32) * Index),
+				     &Shadow->CarrierCfg[Index], CarrierCfg);
 	}
 
 	/* Write Antenna configuration */
 	for (Index = 0; Index < XDFECCF_ANT_NUM_MAX; Index++) {
 		AntennaCfg += (NextCCCfg->AntennaCfg.Enable[Index] << Index);
 	}
-	XDfeCcf_WriteReg(InstancePtr, XDFECCF_ANTENNA_CONFIGURATION_NEXT,
-			 AntennaCfg);
+	XDfeCcf_WriteNextReg(InstancePtr, XDFECCF_ANTENNA_CONFIGURATION_NEXT,
+			     &Shadow->AntennaCfg, AntennaCfg);
+
+	/* NEXT registers now hold the shadow values */
+	Shadow->IsValid = 1U;
 }
 
 /****************************************************************************/
@@ -877,6 +906,7 @@ void XDfeCcf_Reset(XDfeCcf *InstancePtr)
 	/* Put Ccf in reset */
 	XDfeCcf_WriteReg(InstancePtr, XDFECCF_RESET_OFFSET, XDFECCF_RESET_ON);
 	InstancePtr->StateId = XDFECCF_STATE_RESET;
+	InstancePtr->NextShadow.IsValid = 0U;
 }
 
 /****************************************************************************/
@@ -958,6 +988,9 @@ void XDfeCcf_Initialize(XDfeCcf *InstancePtr, XDfeCcf_Init *Init)
 	Xil_AssertVoid(InstancePtr->StateId == XDFECCF_STATE_CONFIGURED);
 	Xil_AssertVoid(Init != NULL);
 
+	/* NEXT registers are written directly below */
+	InstancePtr->NextShadow.IsValid = 0U;
+
 	/* Write "one-time" configuration */
 	XDfeCcf_WriteReg(InstancePtr, XDFECCF_GAIN_STG_EN_OFFSET,
 			 Init->GainStage);
@@ -1406,7 +1439,7 @@ void XDfeCcf_UpdateCCinCCCfg(const XDfeCcf *InstancePtr, XDfeCcf_CCCfg *CCCfg,
 *           - XST_FAILURE if error occurs.
 *
 ****************************************************************************/
-u32 XDfeCcf_SetNextCCCfgAndTrigger(const XDfeCcf *InstancePtr,
+u32 XDfeCcf_SetNextCCCfgAndTrigger(XDfeCcf *InstancePtr,
 				   XDfeCcf_CCCfg *CCCfg)
 {
 	Xil_AssertNonvoid(InstancePtr != NULL);
@@ -1559,7 +1592,7 @@ u32 XDfeCcf_RemoveCC(XDfeCcf *InstancePtr, s32 CCID)
 *           running this API.
 *
 ****************************************************************************/
-u32 XDfeCcf_UpdateCC(const XDfeCcf *InstancePtr, s32 CCID,
+u32 XDfeCcf_UpdateCC(XDfeCcf *InstancePtr, s32 CCID,
 		     const XDfeCcf_CarrierCfg *CarrierCfg)
 {
 	XDfeCcf_CCCfg CCCfg;
@@ -1611,7 +1644,7 @@ u32 XDfeCcf_UpdateCC(const XDfeCcf *InstancePtr, s32 CCID,
 *           running this API.
 *
 ****************************************************************************/
-u32 XDfeCcf_UpdateAntenna(const XDfeCcf *InstancePtr, u32 Ant, bool Enabled)
+u32 XDfeCcf_UpdateAntenna(XDfeCcf *InstancePtr, u32 Ant, bool Enabled)
 {
 	XDfeCcf_CCCfg CCCfg;
 
@@ -1936,18 +1969,42 @@ void XDfeCcf_GetActiveSets(const XDfeCcf *InstancePtr, u32 *IsActive)
 ****************************************************************************/
 void XDfeCcf_LoadCoefficients(XDfeCcf *InstancePtr, u32 Set, u32 Shift,
 			      const XDfeCcf_Coefficients *Coeffs)
+{
+	XDfeCcf_CoeffImage Image;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(Coeffs != NULL);
+	Xil_AssertVoid(Coeffs->Num != 0U); /* Protect from division with 0 */
+
+	XDfeCcf_CompileCoefficients(Shift, Coeffs, &Image);
+	XDfeCcf_LoadCoeffImage(InstancePtr, Set, &Image);
+}
+
+/****************************************************************************/
+/**
+*
+* Builds the coefficient image of a filter. The image holds the register
+* values XDfeCcf_LoadCoefficients() would write, so it can be built once
+* and loaded repeatedly.
+*
+* @param    Shift Coefficient shift value.
+* @param    Coeffs Array of filter coefficients.
+* @param    Image Coefficient image container.
+*
+****************************************************************************/
+void XDfeCcf_CompileCoefficients(u32 Shift, const XDfeCcf_Coefficients *Coeffs,
+				 XDfeCcf_CoeffImage *Image)
 {
 	u32 NumValues;
 	u32 NumUnits;
 	u32 IsOdd;
-	u32 LoadActive;
 	u32 Val;
 	u32 Index;
 	u32 NumPadding = 0U;
 
-	Xil_AssertVoid(InstancePtr != NULL);
 	Xil_AssertVoid(Coeffs != NULL);
 	Xil_AssertVoid(Coeffs->Num != 0U); /* Protect from division with 0 */
+	Xil_AssertVoid(Image != NULL);
 
 	IsOdd = Coeffs->Num % 2U;
 	if (0U != Coeffs->Symmetric) {
@@ -1957,24 +2014,10 @@ void XDfeCcf_LoadCoefficients(XDfeCcf *InstancePtr, u32 Set, u32 Shift,
 	}
 	Xil_AssertVoid(NumValues <= XDFECCF_NUM_COEFF);
 
-	/* Check is load in progress */
-	for (Index = 0; Index < XDFECCF_COEFF_LOAD_TIMEOUT; Index++) {
-		LoadActive = XDFECCF_STATUS_WIDTH &
-			     XDfeCcf_ReadReg(InstancePtr, XDFECCF_COEFF_LOAD);
-		if (XDFECCF_STATUS_LOADING != LoadActive) {
-			break;
-		}
-		usleep(10);
-		if (Index == (XDFECCF_COEFF_LOAD_TIMEOUT - 1U)) {
-			Xil_AssertVoidAlways();
-		}
-	}
-
 	/* Nuber of units */
 	NumUnits = (NumValues + (XDFECCF_COEFF_UNIT_SIZE - 1)) /
 		   XDFECCF_COEFF_UNIT_SIZE;
 
-	/* When no load is active write filter coefficients and initiate load */
 	Val = XDfeCcf_WrBitField(XDFECCF_NUMBER_UNITS_WIDTH,
 				 XDFECCF_NUMBER_UNITS_OFFSET, 0U, NumUnits);
 	Val = XDfeCcf_WrBitField(XDFECCF_SHIFT_VALUE_WIDTH,
@@ -1984,42 +2027,66 @@ void XDfeCcf_LoadCoefficients(XDfeCcf *InstancePtr, u32 Set, u32 Shift,
 				 Coeffs->Symmetric);
 	Val = XDfeCcf_WrBitField(XDFECCF_USE_ODD_TAPS_WIDTH,
 				 XDFECCF_USE_ODD_TAPS_OFFSET, Val, IsOdd);
-	XDfeCcf_WriteReg(InstancePtr, XDFECCF_COEFF_CFG, Val);
+	Image->Cfg = Val;
+	Image->NumWords = NumUnits * XDFECCF_COEFF_UNIT_SIZE;
 
 	if ((NumValues % XDFECCF_COEFF_UNIT_SIZE) != 0) {
 		NumPadding = XDFECCF_COEFF_UNIT_SIZE -
 			     (NumValues % XDFECCF_COEFF_UNIT_SIZE);
 	}
+	memset(Image->Value, 0, sizeof(Image->Value));
 	if (0U == Coeffs->Symmetric) {
-		for (Index = 0; Index < NumValues; Index++) {
-			XDfeCcf_WriteReg(InstancePtr,
-					 XDFECCF_COEFF_VALUE +
-						 (sizeof(u32) * Index),
-					 Coeffs->Value[Index]);
-		}
 		/* Non-symmetric filter: Zero-padding at the end of array */
-		for (Index = NumValues; Index < NumValues + NumPadding;
-		     Index++) {
-			XDfeCcf_WriteReg(
-				InstancePtr,
-				XDFECCF_COEFF_VALUE + (sizeof(u32) * Index), 0);
-		}
-	} else {
-		/* Symetric filter: Zero-padding at the begining of array */
-		for (Index = 0; Index < NumPadding; Index++) {
-			XDfeCcf_WriteReg(
-				InstancePtr,
-				XDFECCF_COEFF_VALUE + (sizeof(u32) * Index), 0);
+		NumPadding = 0U;
+	} /* else symetric filter: Zero-padding at the begining of array */
+	for (Index = 0; Index < NumValues; Index++) {
+		Image->Value[Index + NumPadding] = (u32)Coeffs->Value[Index];
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* Writes a coefficient image into the register map and commit it to the
+* hard block's internal coefficient memory for the specified Set.
+*
+* @param    InstancePtr Pointer to the Ccf instance.
+* @param    Set Coefficient set Id.
+* @param    Image Coefficient image container.
+*
+****************************************************************************/
+void XDfeCcf_LoadCoeffImage(const XDfeCcf *InstancePtr, u32 Set,
+			    const XDfeCcf_CoeffImage *Image)
+{
+	u32 LoadActive;
+	u32 Index;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(Set < XDFECCF_ACTIVE_SET_NUM);
+	Xil_AssertVoid(Image != NULL);
+	Xil_AssertVoid(Image->NumWords <= XDFECCF_NUM_COEFF);
+
+	/* Check is load in progress */
+	for (Index = 0; Index < XDFECCF_COEFF_LOAD_TIMEOUT; Index++) {
+		LoadActive = XDFECCF_STATUS_WIDTH &
+			     XDfeCcf_ReadReg(InstancePtr, XDFECCF_COEFF_LOAD);
+		if (XDFECCF_STATUS_LOADING != LoadActive) {
+			break;
 		}
-		for (Index = 0; Index < NumValues + NumPadding; Index++) {
-			XDfeCcf_WriteReg(
-				InstancePtr,
-				XDFECCF_COEFF_VALUE +
-					(sizeof(u32) * (Index + NumPadding)),
-				Coeffs->Value[Index]);
+		usleep(10);
+		if (Index == (XDFECCF_COEFF_LOAD_TIMEOUT - 1U)) {
+			Xil_AssertVoidAlways();
 		}
 	}
 
+	/* When no load is active write filter coefficients and initiate load */
+	XDfeCcf_WriteReg(InstancePtr, XDFECCF_COEFF_CFG, Image->Cfg);
+	for (Index = 0; Index < Image->NumWords; Index++) {
+		XDfeCcf_WriteReg(InstancePtr,
+				 XDFECCF_COEFF_VALUE + (sizeof(u32) * Index),
+				 Image->Value[Index]);
+	}
+
 	/* Set the coefficient set value */
 	XDfeCcf_WrRegBitField(InstancePtr, XDFECCF_COEFF_LOAD,
 			      XDFECCF_SET_NUM_WIDTH, XDFECCF_SET_NUM_OFFSET,
@@ -2029,6 +2096,136 @@ void XDfeCcf_LoadCoefficients(XDfeCcf *InstancePtr, u32 Set, u32 Shift,
 			      XDFECCF_STATUS_WIDTH, XDFECCF_STATUS_OFFSET, 1U);
 }
 
+/****************************************************************************/
+/**
+*
+* Initializes a coefficient bank of a CC. Images are built with
+* XDfeCcf_CompileCoefficients() and are referred to by their index in
+* Images.
+*
+* @param    Bank Coefficient bank container.
+* @param    CCID CC ID.
+* @param    Set0 Coefficient set of bank 0.
+* @param    Set1 Coefficient set of bank 1.
+* @param    Images Array of coefficient images.
+* @param    NumImages Number of images in Images.
+*
+* @note     The two sets must not be used by any other CC. Initialize the
+*           bank again after XDfeCcf_Reset(), the banks are then considered
+*           empty.
+*
+****************************************************************************/
+void XDfeCcf_CoeffBankInit(XDfeCcf_CoeffBank *Bank, s32 CCID, u32 Set0,
+			   u32 Set1, const XDfeCcf_CoeffImage *Images,
+			   u32 NumImages)
+{
+	u32 Index;
+
+	Xil_AssertVoid(Bank != NULL);
+	Xil_AssertVoid(CCID < XDFECCF_CC_NUM);
+	Xil_AssertVoid(Set0 < XDFECCF_ACTIVE_SET_NUM);
+	Xil_AssertVoid(Set1 < XDFECCF_ACTIVE_SET_NUM);
+	Xil_AssertVoid(Set0 != Set1);
+	Xil_AssertVoid(Images != NULL);
+	Xil_AssertVoid(NumImages != 0U);
+
+	Bank->Images = Images;
+	Bank->NumImages = NumImages;
+	Bank->CCID = CCID;
+	Bank->Set[0] = Set0;
+	Bank->Set[1] = Set1;
+	for (Index = 0; Index < XDFECCF_COEFF_BANK_NUM; Index++) {
+		Bank->ResidentId[Index] = XDFECCF_COEFF_BANK_NO_ID;
+	}
+	Bank->NextBank = 0U;
+}
+
+/****************************************************************************/
+/**
+*
+* Loads the image Id into the bank which the CC does not use. Nothing is
+* written when one of the banks already holds the image.
+*
+* @param    InstancePtr Pointer to the Ccf instance.
+* @param    Bank Coefficient bank container.
+* @param    Id Index of the image in the bank's image array.
+*
+* @return
+*           - XST_SUCCESS if successful.
+*           - XST_FAILURE if error occurs.
+*
+* @note     Call XDfeCcf_CoeffBankActivate() to switch to the image. The
+*           previous activation must have taken effect before this call.
+*
+****************************************************************************/
+u32 XDfeCcf_CoeffBankPrepare(const XDfeCcf *InstancePtr,
+			     XDfeCcf_CoeffBank *Bank, u32 Id)
+{
+	XDfeCcf_CarrierCfg CarrierCfg;
+	u32 FreeBank;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(Bank != NULL);
+
+	if (Id >= Bank->NumImages) {
+		metal_log(METAL_LOG_ERROR, "Wrong image Id %d in %s\n", Id,
+			  __func__);
+		return XST_FAILURE;
+	}
+
+	/* The bank not selected by the CC is free */
+	XDfeCcf_GetCC(InstancePtr, Bank->CCID, &CarrierCfg);
+	FreeBank = (CarrierCfg.RealCoeffSet == Bank->Set[0]) ? 1U : 0U;
+	if (Bank->ResidentId[FreeBank ^ 1U] == Id) {
+		Bank->NextBank = FreeBank ^ 1U;
+		return XST_SUCCESS;
+	}
+
+	if (Bank->ResidentId[FreeBank] != Id) {
+		Bank->ResidentId[FreeBank] = XDFECCF_COEFF_BANK_NO_ID;
+		XDfeCcf_LoadCoeffImage(InstancePtr, Bank->Set[FreeBank],
+				       &Bank->Images[Id]);
+		Bank->ResidentId[FreeBank] = Id;
+	}
+	Bank->NextBank = FreeBank;
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* Switches the CC to the bank prepared by XDfeCcf_CoeffBankPrepare(). Both
+* the real and the imaginary data of the CC use the bank. This is a single
+* CC update, applied on the CC update trigger.
+*
+* @param    InstancePtr Pointer to the Ccf instance.
+* @param    Bank Coefficient bank container.
+*
+* @return
+*           - XST_SUCCESS if successful.
+*           - XST_FAILURE if error occurs.
+*
+****************************************************************************/
+u32 XDfeCcf_CoeffBankActivate(XDfeCcf *InstancePtr,
+			      const XDfeCcf_CoeffBank *Bank)
+{
+	XDfeCcf_CarrierCfg CarrierCfg;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(Bank != NULL);
+
+	XDfeCcf_GetCC(InstancePtr, Bank->CCID, &CarrierCfg);
+	if ((CarrierCfg.RealCoeffSet == Bank->Set[Bank->NextBank]) &&
+	    (CarrierCfg.ImagCoeffSet == Bank->Set[Bank->NextBank])) {
+		return XST_SUCCESS;
+	}
+
+	CarrierCfg.RealCoeffSet = Bank->Set[Bank->NextBank];
+	CarrierCfg.ImagCoeffSet = Bank->Set[Bank->NextBank];
+	return XDfeCcf_UpdateCC(InstancePtr, Bank->CCID, &CarrierCfg);
+}
+
 /****************************************************************************/
 /**
 *
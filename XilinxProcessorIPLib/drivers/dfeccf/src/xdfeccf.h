@@ -80,6 +80,9 @@
 *       dc     01/27/22 Get calculated TDataDelay
 *       dc     03/21/22 Add prefix to global variables
 * 1.4   dc     04/08/22 Update documentation
+*       ag     10/15/26 Write only the changed NEXT CC configuration
+*                       registers
+*       ag     10/15/26 Add precompiled coefficient images and banks
 *
 * </pre>
 * @endcond
@@ -135,6 +138,8 @@ extern "C" {
 #define XDFECCF_ANT_NUM_MAX (8U) /**< Maximum anntena number */
 #define XDFECCF_SEQ_LENGTH_MAX (16U) /**< Maximum sequence length */
 #define XDFECCF_NUM_COEFF (128U) /**< Maximum number of coefficents */
+#define XDFECCF_COEFF_BANK_NUM (2U) /**< Coefficient banks per CC */
+#define XDFECCF_COEFF_BANK_NO_ID (0xFFFFFFFFU) /**< Bank holds no image */
 
 /**************************** Type Definitions *******************************/
 /*********** start - common code to all Logiccores ************/
@@ -290,6 +295,32 @@ typedef struct {
 			  (Num+1)/2 coefficients are provided */
 } XDfeCcf_Coefficients;
 
+/**
+ * Coefficient image. Register values of one coefficient load, built once by
+ * XDfeCcf_CompileCoefficients() and written by XDfeCcf_LoadCoeffImage()
+ * without any further computation.
+ */
+typedef struct {
+	u32 Cfg; /**< Coefficient configuration register value */
+	u32 NumWords; /**< Number of coefficient values including padding */
+	u32 Value[XDFECCF_NUM_COEFF]; /**< Padded coefficient values */
+} XDfeCcf_CoeffImage;
+
+/**
+ * Coefficient bank. Double-banks an array of coefficient images in two
+ * coefficient sets of a CC, so an image swap is a single CC update.
+ */
+typedef struct {
+	const XDfeCcf_CoeffImage *Images; /**< Images indexed by Id */
+	u32 NumImages; /**< Number of images */
+	s32 CCID; /**< CC using the bank */
+	u32 Set[XDFECCF_COEFF_BANK_NUM]; /**< [0-7] Coefficient set of each
+		bank */
+	u32 ResidentId[XDFECCF_COEFF_BANK_NUM]; /**< Image held by each
+		bank */
+	u32 NextBank; /**< Bank activated by XDfeCcf_CoeffBankActivate() */
+} XDfeCcf_CoeffBank;
+
 /**
  * Configuration for a single CC.
  */
@@ -381,6 +412,16 @@ typedef struct {
 	u32 AntennaInterleave; /**< Number of Antenna slots */
 } XDfeCcf_Config;
 
+/**
+ * Copy of the NEXT CC configuration registers as last written by the driver.
+ */
+typedef struct {
+	u32 IsValid; /**< [0,1] Copy matches the NEXT registers */
+	u32 Sequence[XDFECCF_SEQ_LENGTH_MAX]; /**< Sequence NEXT */
+	u32 CarrierCfg[XDFECCF_CC_NUM]; /**< Carrier configuration NEXT */
+	u32 AntennaCfg; /**< Antenna configuration NEXT */
+} XDfeCcf_NextShadow;
+
 /**
  * CCF Structure.
  */
@@ -389,6 +430,7 @@ typedef struct {
 	XDfeCcf_StateId StateId; /**< StateId */
 	s32 NotUsedCCID; /**< Not used CCID */
 	u32 SequenceLength; /**< Exact sequence length */
+	XDfeCcf_NextShadow NextShadow; /**< Last written NEXT configuration */
 	char NodeName[XDFECCF_NODE_NAME_MAX_LENGTH]; /**< Node name */
 	struct metal_io_region *Io; /**< Libmetal IO structure */
 	struct metal_device *Device; /**< Libmetal device structure */
@@ -432,14 +474,14 @@ void XDfeCcf_RemoveCCfromCCCfg(XDfeCcf *InstancePtr, XDfeCcf_CCCfg *CCCfg,
 			       s32 CCID);
 void XDfeCcf_UpdateCCinCCCfg(const XDfeCcf *InstancePtr, XDfeCcf_CCCfg *CCCfg,
 			     s32 CCID, const XDfeCcf_CarrierCfg *CarrierCfg);
-u32 XDfeCcf_SetNextCCCfgAndTrigger(const XDfeCcf *InstancePtr,
+u32 XDfeCcf_SetNextCCCfgAndTrigger(XDfeCcf *InstancePtr,
 				   XDfeCcf_CCCfg *CCCfg);
 u32 XDfeCcf_AddCC(XDfeCcf *InstancePtr, s32 CCID, u32 CCSeqBitmap,
 		  const XDfeCcf_CarrierCfg *CarrierCfg);
 u32 XDfeCcf_RemoveCC(XDfeCcf *InstancePtr, s32 CCID);
-u32 XDfeCcf_UpdateCC(const XDfeCcf *InstancePtr, s32 CCID,
+u32 XDfeCcf_UpdateCC(XDfeCcf *InstancePtr, s32 CCID,
 		     const XDfeCcf_CarrierCfg *CarrierCfg);
-u32 XDfeCcf_UpdateAntenna(const XDfeCcf *InstancePtr, u32 Ant, bool Enabled);
+u32 XDfeCcf_UpdateAntenna(XDfeCcf *InstancePtr, u32 Ant, bool Enabled);
 u32 XDfeCcf_UpdateAntennaCfg(XDfeCcf *InstancePtr,
 			     XDfeCcf_AntennaCfg *AntennaCfg);
 void XDfeCcf_GetTriggersCfg(const XDfeCcf *InstancePtr,
@@ -451,6 +493,17 @@ void XDfeCcf_GetCC(const XDfeCcf *InstancePtr, s32 CCID,
 void XDfeCcf_GetActiveSets(const XDfeCcf *InstancePtr, u32 *IsActive);
 void XDfeCcf_LoadCoefficients(XDfeCcf *InstancePtr, u32 Set, u32 Shift,
 			      const XDfeCcf_Coefficients *Coeffs);
+void XDfeCcf_CompileCoefficients(u32 Shift, const XDfeCcf_Coefficients *Coeffs,
+				 XDfeCcf_CoeffImage *Image);
+void XDfeCcf_LoadCoeffImage(const XDfeCcf *InstancePtr, u32 Set,
+			    const XDfeCcf_CoeffImage *Image);
+void XDfeCcf_CoeffBankInit(XDfeCcf_CoeffBank *Bank, s32 CCID, u32 Set0,
+			   u32 Set1, const XDfeCcf_CoeffImage *Images,
+			   u32 NumImages);
+u32 XDfeCcf_CoeffBankPrepare(const XDfeCcf *InstancePtr,
+			     XDfeCcf_CoeffBank *Bank, u32 Id);
+u32 XDfeCcf_CoeffBankActivate(XDfeCcf *InstancePtr,
+			      const XDfeCcf_CoeffBank *Bank);
 void XDfeCcf_GetEventStatus(const XDfeCcf *InstancePtr, XDfeCcf_Status *Status);
 void XDfeCcf_ClearEventStatus(const XDfeCcf *InstancePtr,
 			      const XDfeCcf_Status *Status);
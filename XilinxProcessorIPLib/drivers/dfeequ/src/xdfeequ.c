@@ -34,6 +34,7 @@
 *       dc     02/18/22 Write 1 clears event status
 *       dc     03/21/22 Add prefix to global variables
 * 1.4   dc     04/06/22 Update documentation
+*       ag     10/15/26 Add precompiled coefficient images and banks
 *
 * </pre>
 * @addtogroup dfeequ Overview
@@ -226,226 +227,34 @@ u32 XDfeEqu_WrBitField(u32 FieldWidth, u32 FieldOffset, u32 Data, u32 Val)
 /****************************************************************************/
 /**
 *
-* Sets Equalizer filter coefficients in Real mode.
+* Waits for the previous coefficient load to finish.
 *
 * @param    InstancePtr Pointer to the Equalizer instance.
-* @param    ChannelField Flag which bits indicate channel is enabled.
-* @param    EqCoeffs Equalizer coefficients container.
-* @param    Shift Shift value.
-*
-****************************************************************************/
-static void XDfeEqu_LoadRealCoefficients(const XDfeEqu *InstancePtr,
-					 u32 ChannelField,
-					 const XDfeEqu_Coefficients *EqCoeffs,
-					 u32 Shift)
-{
-	u32 Offset;
-	u32 Index;
-	u32 NumValues = EqCoeffs->Num;
-	u32 NumUnits;
-
-	/* Nuber of units */
-	NumUnits = (NumValues + (XDFEEQU_COEFF_UNIT_SIZE - 1U)) /
-		   XDFEEQU_COEFF_UNIT_SIZE;
-
-	/* Write the coefficient set buffer with the following information */
-	Offset = XDFEEQU_COEFFICIENT_SET;
-	for (Index = 0; Index < NumValues; Index++) {
-		XDfeEqu_WriteReg(InstancePtr, Offset,
-				 (u32)(EqCoeffs->Coefficients[Index]));
-		Offset += (u32)sizeof(u32);
-	}
-	/* Zero-padding at the end of array */
-	for (Index = NumValues; Index < NumUnits * XDFEEQU_COEFF_UNIT_SIZE;
-	     Index++) {
-		XDfeEqu_WriteReg(InstancePtr, Offset, 0);
-		Offset += (u32)sizeof(u32);
-	}
-
-	Offset = XDFEEQU_SET_TO_WRITE_OFFSET;
-	XDfeEqu_WriteReg(InstancePtr, Offset, EqCoeffs->Set);
-	Offset = XDFEEQU_NUMBER_OF_UNITS_OFFSET;
-	XDfeEqu_WriteReg(InstancePtr, Offset, NumUnits);
-	Offset = XDFEEQU_SHIFT_VALUE_OFFSET;
-	XDfeEqu_WriteReg(InstancePtr, Offset, Shift);
-
-	/* Set the Channel_Field register (0x010C) with the value in
-	   Channel_Field. This initiates the write of the coefficients. */
-	Offset = XDFEEQU_CHANNEL_FIELD_OFFSET;
-	XDfeEqu_WriteReg(InstancePtr, Offset, ChannelField);
-}
-
-/****************************************************************************/
-/**
-*
-* Sets Equalizer filter coefficients in Complex mode.
-*
-* @param    InstancePtr Pointer to the Equalizer instance.
-* @param    ChannelField Flag in which bits indicate the channel is
-*           enabled.
-* @param    EqCoeffs Equalizer coefficients container.
-* @param    Shift Shift value.
 *
 ****************************************************************************/
-static void
-XDfeEqu_LoadComplexCoefficients(const XDfeEqu *InstancePtr, u32 ChannelField,
-				const XDfeEqu_Coefficients *EqCoeffs, u32 Shift)
+static void XDfeEqu_WaitCoeffLoad(const XDfeEqu *InstancePtr)
 {
-	u32 Offset;
 	u32 LoadDone;
 	u32 Index;
-	u32 NumValues = EqCoeffs->Num;
-	u32 NumUnits;
-
-	/* Nuber of units */
-	NumUnits = (NumValues + (XDFEEQU_COEFF_UNIT_SIZE - 1U)) /
-		   XDFEEQU_COEFF_UNIT_SIZE;
-
-	/* Write the coefficient set buffer with the following information */
-	Offset = XDFEEQU_COEFFICIENT_SET;
-	for (Index = 0; Index < NumValues; Index++) {
-		XDfeEqu_WriteReg(InstancePtr, Offset,
-				 (u32)(EqCoeffs->Coefficients[Index]));
-		XDfeEqu_WriteReg(
-			InstancePtr,
-			Offset + (XDFEEQU_IM_COEFFICIENT_SET_OFFSET *
-				  sizeof(u32)),
-			(u32)(EqCoeffs->Coefficients[Index + NumValues]));
-		Offset += (u32)sizeof(u32);
-	}
-	/* Zero-padding at the end of array */
-	for (Index = NumValues; Index < NumUnits * XDFEEQU_COEFF_UNIT_SIZE;
-	     Index++) {
-		XDfeEqu_WriteReg(InstancePtr, Offset, 0);
-		XDfeEqu_WriteReg(InstancePtr,
-				 Offset + (XDFEEQU_IM_COEFFICIENT_SET_OFFSET *
-					   sizeof(u32)),
-				 0);
-		Offset += (u32)sizeof(u32);
-	}
-
-	Offset = XDFEEQU_SET_TO_WRITE_OFFSET;
-	XDfeEqu_WriteReg(InstancePtr, Offset, EqCoeffs->Set);
-	Offset = XDFEEQU_NUMBER_OF_UNITS_OFFSET;
-	XDfeEqu_WriteReg(InstancePtr, Offset, NumUnits);
-	Offset = XDFEEQU_SHIFT_VALUE_OFFSET;
-	XDfeEqu_WriteReg(InstancePtr, Offset, Shift);
-
-	/* Set the Channel_Field register (0x010C) with the value in
-	   Channel_Field. This initiates the write of the coefficients. */
-	Offset = XDFEEQU_CHANNEL_FIELD_OFFSET;
-	XDfeEqu_WriteReg(InstancePtr, Offset, ChannelField);
 
 	/* The software should wait for bit 8 in the Channel_Field register
-	   to go low before returning. */
+	   to go high before starting a new load. */
 	for (Index = 0; Index < XDFEEQU_COEFF_LOAD_TIMEOUT; Index++) {
 		LoadDone = XDfeEqu_RdRegBitField(
-			InstancePtr, Offset, XDFEEQU_CHANNEL_FIELD_DONE_WIDTH,
+			InstancePtr, XDFEEQU_CHANNEL_FIELD_OFFSET,
+			XDFEEQU_CHANNEL_FIELD_DONE_WIDTH,
 			XDFEEQU_CHANNEL_FIELD_DONE_OFFSET);
 		if (XDFEEQU_CHANNEL_FIELD_DONE_LOADING_DONE == LoadDone) {
+			/* Loading is finished */
 			break;
 		}
 		usleep(XDFEEQU_WAIT);
 		if (Index == (XDFEEQU_COEFF_LOAD_TIMEOUT - 1U)) {
+			/* Loading still on, this is serious problem block
+			   the system */
 			Xil_AssertVoidAlways();
 		}
 	}
-
-	/* Write the coefficient set buffer with the following information */
-	Offset = XDFEEQU_COEFFICIENT_SET;
-	for (Index = 0; Index < NumValues; Index++) {
-		XDfeEqu_WriteReg(
-			InstancePtr, Offset,
-			(u32)(-EqCoeffs->Coefficients[Index + NumValues]));
-		XDfeEqu_WriteReg(InstancePtr,
-				 Offset + (XDFEEQU_IM_COEFFICIENT_SET_OFFSET *
-					   sizeof(u32)),
-				 (u32)(EqCoeffs->Coefficients[Index]));
-		Offset += (u32)sizeof(u32);
-	}
-	/* Zero-padding at the end of array */
-	for (Index = NumValues; Index < NumUnits * XDFEEQU_COEFF_UNIT_SIZE;
-	     Index++) {
-		XDfeEqu_WriteReg(InstancePtr, Offset, 0);
-		XDfeEqu_WriteReg(InstancePtr,
-				 Offset + (XDFEEQU_IM_COEFFICIENT_SET_OFFSET *
-					   sizeof(u32)),
-				 0);
-		Offset += (u32)sizeof(u32);
-	}
-
-	Offset = XDFEEQU_SET_TO_WRITE_OFFSET;
-	XDfeEqu_WriteReg(InstancePtr, Offset, EqCoeffs->Set + 1U);
-	Offset = XDFEEQU_NUMBER_OF_UNITS_OFFSET;
-	XDfeEqu_WriteReg(InstancePtr, Offset, NumUnits);
-	Offset = XDFEEQU_SHIFT_VALUE_OFFSET;
-	XDfeEqu_WriteReg(InstancePtr, Offset, Shift);
-
-	/* Set the Channel_Field register (0x010C) with the value in
-	   Channel_Field. This initiates the write of the coefficients. */
-	Offset = XDFEEQU_CHANNEL_FIELD_OFFSET;
-	XDfeEqu_WriteReg(InstancePtr, Offset, ChannelField);
-}
-
-/****************************************************************************/
-/**
-*
-* Sets Equalizer filter coefficients in Matrix mode.
-*
-* @param    InstancePtr Pointer to the Equalizer instance.
-* @param    ChannelField Flag in which bits indicate channel is enabled.
-* @param    EqCoeffs Equalizer coefficients container.
-* @param    Shift Shift value.
-*
-****************************************************************************/
-static void XDfeEqu_LoadMatrixCoefficients(const XDfeEqu *InstancePtr,
-					   u32 ChannelField,
-					   const XDfeEqu_Coefficients *EqCoeffs,
-					   u32 Shift)
-{
-	u32 Offset;
-	u32 Index;
-	u32 NumValues = EqCoeffs->Num;
-	u32 NumUnits;
-
-	/* Nuber of units */
-	NumUnits = (NumValues + (XDFEEQU_COEFF_UNIT_SIZE - 1U)) /
-		   XDFEEQU_COEFF_UNIT_SIZE;
-
-	/* Write the coefficient set buffer with the following information */
-	Offset = XDFEEQU_COEFFICIENT_SET;
-	for (Index = 0; Index < NumValues; Index++) {
-		XDfeEqu_WriteReg(InstancePtr, Offset,
-				 (u32)(EqCoeffs->Coefficients[Index]));
-		XDfeEqu_WriteReg(
-			InstancePtr,
-			Offset + (XDFEEQU_IM_COEFFICIENT_SET_OFFSET *
-				  sizeof(u32)),
-			(u32)(EqCoeffs->Coefficients[Index + NumValues]));
-		Offset += (u32)sizeof(u32);
-	}
-	/* Zero-padding at the end of array */
-	for (Index = NumValues; Index < NumUnits * XDFEEQU_COEFF_UNIT_SIZE;
-	     Index++) {
-		XDfeEqu_WriteReg(InstancePtr, Offset, 0);
-		XDfeEqu_WriteReg(InstancePtr,
-				 Offset + (XDFEEQU_IM_COEFFICIENT_SET_OFFSET *
-					   sizeof(u32)),
-				 0);
-		Offset += (u32)sizeof(u32);
-	}
-
-	Offset = XDFEEQU_SET_TO_WRITE_OFFSET;
-	XDfeEqu_WriteReg(InstancePtr, Offset, EqCoeffs->Set);
-	Offset = XDFEEQU_NUMBER_OF_UNITS_OFFSET;
-	XDfeEqu_WriteReg(InstancePtr, Offset, NumUnits);
-	Offset = XDFEEQU_SHIFT_VALUE_OFFSET;
-	XDfeEqu_WriteReg(InstancePtr, Offset, Shift);
-
-	/* Set the Channel_Field register (0x010C) with the value in
-	   Channel_Field. This initiates the write of the coefficients. */
-	Offset = XDFEEQU_CHANNEL_FIELD_OFFSET;
-	XDfeEqu_WriteReg(InstancePtr, Offset, ChannelField);
 }
 
 /****************************************************************************/
@@ -1184,8 +993,7 @@ void XDfeEqu_LoadCoefficients(const XDfeEqu *InstancePtr, u32 ChannelField,
 			      u32 Mode, u32 Shift,
 			      const XDfeEqu_Coefficients *EqCoeffs)
 {
-	u32 LoadDone;
-	u32 Index;
+	XDfeEqu_CoeffImage Image;
 
 	Xil_AssertVoid(InstancePtr != NULL);
 	Xil_AssertVoid(InstancePtr->StateId == XDFEEQU_STATE_OPERATIONAL);
@@ -1197,40 +1005,269 @@ void XDfeEqu_LoadCoefficients(const XDfeEqu *InstancePtr, u32 ChannelField,
 	Xil_AssertVoid(EqCoeffs->Num != 0U);
 	Xil_AssertVoid(EqCoeffs->Num <= XDFEEQU_NUM_COEFF);
 
-	/* Check is load in progress */
-	for (Index = 0; Index < XDFEEQU_COEFF_LOAD_TIMEOUT; Index++) {
-		LoadDone = XDfeEqu_RdRegBitField(
-			InstancePtr, XDFEEQU_CHANNEL_FIELD_OFFSET,
-			XDFEEQU_CHANNEL_FIELD_DONE_WIDTH,
-			XDFEEQU_CHANNEL_FIELD_DONE_OFFSET);
-		if (XDFEEQU_CHANNEL_FIELD_DONE_LOADING_DONE == LoadDone) {
-			/* Loading is finished */
-			break;
+	/* Write filter coefficients and initiate new coefficient load */
+	XDfeEqu_CompileCoefficients(Mode, Shift, EqCoeffs, &Image);
+	XDfeEqu_LoadCoeffImage(InstancePtr, ChannelField, EqCoeffs->Set,
+			       &Image);
+}
+
+/****************************************************************************/
+/**
+*
+* Builds the coefficient image of a coefficient set. The image holds the
+* register values XDfeEqu_LoadCoefficients() would write, so it can be built
+* once, e.g. for every calibration point, and loaded repeatedly.
+*
+* @param    Mode Equalizer mode.
+* @param    Shift Coefficient shift value.
+* @param    EqCoeffs Equalizer coefficients container, Set is ignored.
+* @param    Image Coefficient image container.
+*
+****************************************************************************/
+void XDfeEqu_CompileCoefficients(u32 Mode, u32 Shift,
+				 const XDfeEqu_Coefficients *EqCoeffs,
+				 XDfeEqu_CoeffImage *Image)
+{
+	u32 NumValues;
+	u32 Index;
+
+	Xil_AssertVoid(Mode <= XDFEEQU_DATAPATH_MODE_MATRIX);
+	Xil_AssertVoid(EqCoeffs != NULL);
+	Xil_AssertVoid(EqCoeffs->Num != 0U);
+	Xil_AssertVoid(EqCoeffs->Num <= XDFEEQU_NUM_COEFF);
+	Xil_AssertVoid(Image != NULL);
+
+	NumValues = EqCoeffs->Num;
+	Image->Mode = Mode;
+	Image->Shift = Shift;
+	/* Nuber of units */
+	Image->NumUnits = (NumValues + (XDFEEQU_COEFF_UNIT_SIZE - 1U)) /
+			  XDFEEQU_COEFF_UNIT_SIZE;
+
+	/* Zero-padding at the end of array */
+	memset(Image->Re, 0, sizeof(Image->Re));
+	memset(Image->Im, 0, sizeof(Image->Im));
+
+	if (Mode == XDFEEQU_DATAPATH_MODE_REAL) {
+		Image->NumPasses = 1U;
+		for (Index = 0; Index < NumValues; Index++) {
+			Image->Re[0][Index] =
+				(u32)(EqCoeffs->Coefficients[Index]);
 		}
-		usleep(XDFEEQU_WAIT);
-		if (Index == (XDFEEQU_COEFF_LOAD_TIMEOUT - 1U)) {
-			/* Loading still on, this is serious problem block
-			   the system */
-			Xil_AssertVoidAlways();
+		return;
+	}
+
+	Xil_AssertVoid(NumValues <= (XDFEEQU_NUM_COEFF / 2U));
+	for (Index = 0; Index < NumValues; Index++) {
+		Image->Re[0][Index] = (u32)(EqCoeffs->Coefficients[Index]);
+		Image->Im[0][Index] =
+			(u32)(EqCoeffs->Coefficients[Index + NumValues]);
+	}
+
+	if (Mode == XDFEEQU_DATAPATH_MODE_MATRIX) {
+		Image->NumPasses = 1U;
+		return;
+	}
+
+	/* Complex mode uses a second set, Set + 1, with the swapped and
+	   negated coefficients */
+	Image->NumPasses = 2U;
+	for (Index = 0; Index < NumValues; Index++) {
+		Image->Re[1][Index] =
+			(u32)(-EqCoeffs->Coefficients[Index + NumValues]);
+		Image->Im[1][Index] = (u32)(EqCoeffs->Coefficients[Index]);
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* Writes a coefficient image into the coefficient set Set and, in complex
+* mode, Set + 1.
+*
+* @param    InstancePtr Pointer to the Equalizer instance.
+* @param    ChannelField Flag in which bits indicate the channel is
+*           enabled.
+* @param    Set Coefficient set, 0 or 2 in complex mode.
+* @param    Image Coefficient image container.
+*
+****************************************************************************/
+void XDfeEqu_LoadCoeffImage(const XDfeEqu *InstancePtr, u32 ChannelField,
+			    u32 Set, const XDfeEqu_CoeffImage *Image)
+{
+	u32 Offset;
+	u32 NumWords;
+	u32 Pass;
+	u32 Index;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->StateId == XDFEEQU_STATE_OPERATIONAL);
+	Xil_AssertVoid(ChannelField <
+		       ((u32)1U << XDFEEQU_CHANNEL_FIELD_FIELD_WIDTH));
+	Xil_AssertVoid(Image != NULL);
+	Xil_AssertVoid((Image->NumPasses == 1U) || (Image->NumPasses == 2U));
+	Xil_AssertVoid((Set + Image->NumPasses) <=
+		       (1U << XDFEEQU_SET_TO_WRITE_SET_WIDTH));
+
+	NumWords = Image->NumUnits * XDFEEQU_COEFF_UNIT_SIZE;
+	for (Pass = 0; Pass < Image->NumPasses; Pass++) {
+		/* Check is load in progress */
+		XDfeEqu_WaitCoeffLoad(InstancePtr);
+
+		/* Write the coefficient set buffer */
+		Offset = XDFEEQU_COEFFICIENT_SET;
+		for (Index = 0; Index < NumWords; Index++) {
+			XDfeEqu_WriteReg(InstancePtr, Offset,
+					 Image->Re[Pass][Index]);
+			if (Image->Mode != XDFEEQU_DATAPATH_MODE_REAL) {
+				XDfeEqu_WriteReg(
+					InstancePtr,
+					Offset +
+						(XDFEEQU_IM_COEFFICIENT_SET_OFFSET *
+						 sizeof(u32)),
+					Image->Im[Pass][Index]);
+			}
+			Offset += (u32)sizeof(u32);
 		}
+
+		XDfeEqu_WriteReg(InstancePtr, XDFEEQU_SET_TO_WRITE_OFFSET,
+				 Set + Pass);
+		XDfeEqu_WriteReg(InstancePtr, XDFEEQU_NUMBER_OF_UNITS_OFFSET,
+				 Image->NumUnits);
+		XDfeEqu_WriteReg(InstancePtr, XDFEEQU_SHIFT_VALUE_OFFSET,
+				 Image->Shift);
+
+		/* Set the Channel_Field register (0x010C) with the value in
+		   Channel_Field. This initiates the write of the
+		   coefficients. */
+		XDfeEqu_WriteReg(InstancePtr, XDFEEQU_CHANNEL_FIELD_OFFSET,
+				 ChannelField);
 	}
+}
 
-	/* Write filter coefficients and initiate new coefficient load */
-	if (Mode == XDFEEQU_DATAPATH_MODE_REAL) {
-		/* Mode == real */
-		XDfeEqu_LoadRealCoefficients(InstancePtr, ChannelField,
-					     EqCoeffs, Shift);
-	} else if (Mode == XDFEEQU_DATAPATH_MODE_COMPLEX) {
-		/* Mode == complex */
-		Xil_AssertVoid(EqCoeffs->Num <= (XDFEEQU_NUM_COEFF / 2U));
-		XDfeEqu_LoadComplexCoefficients(InstancePtr, ChannelField,
-						EqCoeffs, Shift);
-	} else {
-		/* Mode == matrix */
-		Xil_AssertVoid(EqCoeffs->Num <= (XDFEEQU_NUM_COEFF / 2U));
-		XDfeEqu_LoadMatrixCoefficients(InstancePtr, ChannelField,
-					       EqCoeffs, Shift);
+/****************************************************************************/
+/**
+*
+* Initializes a coefficient bank. Images are built with
+* XDfeEqu_CompileCoefficients() and are referred to by their index in
+* Images.
+*
+* @param    Bank Coefficient bank container.
+* @param    Mode Equalizer mode of all images.
+* @param    ChannelField Flag in which bits indicate the channel is
+*           enabled.
+* @param    Images Array of coefficient images.
+* @param    NumImages Number of images in Images.
+*
+* @note     Initialize the bank again after XDfeEqu_Reset(), the banks
+*           are then considered empty.
+*
+****************************************************************************/
+void XDfeEqu_CoeffBankInit(XDfeEqu_CoeffBank *Bank, u32 Mode,
+			   u32 ChannelField, const XDfeEqu_CoeffImage *Images,
+			   u32 NumImages)
+{
+	u32 Index;
+
+	Xil_AssertVoid(Bank != NULL);
+	Xil_AssertVoid(Mode <= XDFEEQU_DATAPATH_MODE_MATRIX);
+	Xil_AssertVoid(ChannelField <
+		       ((u32)1U << XDFEEQU_CHANNEL_FIELD_FIELD_WIDTH));
+	Xil_AssertVoid(Images != NULL);
+	Xil_AssertVoid(NumImages != 0U);
+
+	Bank->Images = Images;
+	Bank->NumImages = NumImages;
+	Bank->Mode = Mode;
+	Bank->ChannelField = ChannelField;
+	for (Index = 0; Index < XDFEEQU_COEFF_BANK_NUM; Index++) {
+		Bank->ResidentId[Index] = XDFEEQU_COEFF_BANK_NO_ID;
 	}
+	Bank->NextBank = 0U;
+}
+
+/****************************************************************************/
+/**
+*
+* Loads the image Id into the bank which is not in use. Nothing is written
+* when one of the banks already holds the image.
+*
+* @param    InstancePtr Pointer to the Equalizer instance.
+* @param    Bank Coefficient bank container.
+* @param    Id Index of the image in the bank's image array.
+*
+* @return
+*           - XST_SUCCESS if successful.
+*           - XST_FAILURE if error occurs.
+*
+* @note     Call XDfeEqu_CoeffBankActivate() to switch to the image. The
+*           previous activation must have taken effect before this call.
+*
+****************************************************************************/
+u32 XDfeEqu_CoeffBankPrepare(const XDfeEqu *InstancePtr,
+			     XDfeEqu_CoeffBank *Bank, u32 Id)
+{
+	u32 RealSet;
+	u32 ImagSet;
+	u32 ActiveBank;
+	u32 FreeBank;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->StateId == XDFEEQU_STATE_OPERATIONAL);
+	Xil_AssertNonvoid(Bank != NULL);
+
+	if ((Id >= Bank->NumImages) || (Bank->Images[Id].Mode != Bank->Mode)) {
+		metal_log(METAL_LOG_ERROR, "Wrong image Id %d in %s\n", Id,
+			  __func__);
+		return XST_FAILURE;
+	}
+
+	/* Bank 0 is set 0 (and 1), bank 1 is set 2 (and 3) */
+	XDfeEqu_GetActiveSets(InstancePtr, &RealSet, &ImagSet);
+	ActiveBank = (RealSet & XDFEEQU_COEFF_SET_CONTROL_MASK) >> 1U;
+	if (Bank->ResidentId[ActiveBank] == Id) {
+		Bank->NextBank = ActiveBank;
+		return XST_SUCCESS;
+	}
+
+	FreeBank = ActiveBank ^ 1U;
+	if (Bank->ResidentId[FreeBank] != Id) {
+		Bank->ResidentId[FreeBank] = XDFEEQU_COEFF_BANK_NO_ID;
+		XDfeEqu_LoadCoeffImage(InstancePtr, Bank->ChannelField,
+				       FreeBank * 2U, &Bank->Images[Id]);
+		Bank->ResidentId[FreeBank] = Id;
+	}
+	Bank->NextBank = FreeBank;
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* Switches the datapath to the bank prepared by XDfeEqu_CoeffBankPrepare().
+* This is a single update of the coefficient set selection, applied on the
+* Update trigger. In real mode both sub-channels use the bank.
+*
+* @param    InstancePtr Pointer to the Equalizer instance.
+* @param    Bank Coefficient bank container.
+* @param    Flush [0,1] Set high to flush the buffers.
+*
+****************************************************************************/
+void XDfeEqu_CoeffBankActivate(const XDfeEqu *InstancePtr,
+			       const XDfeEqu_CoeffBank *Bank, u32 Flush)
+{
+	XDfeEqu_EqConfig Config;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->StateId == XDFEEQU_STATE_OPERATIONAL);
+	Xil_AssertVoid(Bank != NULL);
+
+	Config.Flush = Flush;
+	Config.DatapathMode = Bank->Mode;
+	Config.RealDatapathSet = Bank->NextBank * 2U;
+	Config.ImDatapathSet = Bank->NextBank * 2U;
+	XDfeEqu_Update(InstancePtr, &Config);
 }
 
 /****************************************************************************/
@@ -60,6 +60,7 @@
 * 1.3   dc     02/18/22 Write 1 clears event status
 *       dc     03/21/22 Add prefix to global variables
 * 1.4   dc     04/06/22 Update documentation
+*       ag     10/15/26 Add precompiled coefficient images and banks
 *
 * </pre>
 * @endcond
@@ -118,6 +119,8 @@ extern "C" {
 #define XDFEEQU_NUM_COEFF (24U) /**< Maximum number of coefficents */
 #define XDFEEQU_DATAPATH_MODE_REAL (0U) /**< Real mode */
 #define XDFEEQU_DATAPATH_MODE_COMPLEX (1U) /**< Complex mode */
+#define XDFEEQU_COEFF_BANK_NUM (2U) /**< Coefficient banks, sets 0 and 2 */
+#define XDFEEQU_COEFF_BANK_NO_ID (0xFFFFFFFFU) /**< Bank holds no image */
 /**
 * @cond nocomments
 */
@@ -260,6 +263,37 @@ typedef struct {
 		Coefficients. */
 } XDfeEqu_Coefficients;
 
+/**
+ * Coefficient image. Register values of one coefficient load, built once by
+ * XDfeEqu_CompileCoefficients() and written by XDfeEqu_LoadCoeffImage()
+ * without any further computation.
+ */
+typedef struct {
+	u32 Mode; /**< [0,1] Datapath mode the image is built for */
+	u32 Shift; /**< Coefficient shift value */
+	u32 NumUnits; /**< Number of 4 coefficient units */
+	u32 NumPasses; /**< [1,2] Coefficient sets written, 2 in complex
+		mode */
+	u32 Re[2][XDFEEQU_NUM_COEFF]; /**< Real buffer values per pass */
+	u32 Im[2][XDFEEQU_NUM_COEFF / 2U]; /**< Imaginary buffer values per
+		pass, not used in real mode */
+} XDfeEqu_CoeffImage;
+
+/**
+ * Coefficient bank. Double-banks an array of coefficient images in
+ * coefficient sets 0 and 2, so an image swap is a single update of the
+ * active set.
+ */
+typedef struct {
+	const XDfeEqu_CoeffImage *Images; /**< Images indexed by Id */
+	u32 NumImages; /**< Number of images */
+	u32 Mode; /**< [0,1] Datapath mode of all images */
+	u32 ChannelField; /**< Channels the images are loaded to */
+	u32 ResidentId[XDFEEQU_COEFF_BANK_NUM]; /**< Image held by each
+		bank */
+	u32 NextBank; /**< Bank activated by XDfeEqu_CoeffBankActivate() */
+} XDfeEqu_CoeffBank;
+
 /**
  * Equalizer Configuration Structure.
  */
@@ -352,6 +386,18 @@ void XDfeEqu_SetTriggersCfg(const XDfeEqu *InstancePtr,
 void XDfeEqu_LoadCoefficients(const XDfeEqu *InstancePtr, u32 ChannelField,
 			      u32 Mode, u32 Shift,
 			      const XDfeEqu_Coefficients *EqCoeffs);
+void XDfeEqu_CompileCoefficients(u32 Mode, u32 Shift,
+				 const XDfeEqu_Coefficients *EqCoeffs,
+				 XDfeEqu_CoeffImage *Image);
+void XDfeEqu_LoadCoeffImage(const XDfeEqu *InstancePtr, u32 ChannelField,
+			    u32 Set, const XDfeEqu_CoeffImage *Image);
+void XDfeEqu_CoeffBankInit(XDfeEqu_CoeffBank *Bank, u32 Mode,
+			   u32 ChannelField, const XDfeEqu_CoeffImage *Images,
+			   u32 NumImages);
+u32 XDfeEqu_CoeffBankPrepare(const XDfeEqu *InstancePtr,
+			     XDfeEqu_CoeffBank *Bank, u32 Id);
+void XDfeEqu_CoeffBankActivate(const XDfeEqu *InstancePtr,
+			       const XDfeEqu_CoeffBank *Bank, u32 Flush);
 void XDfeEqu_GetEventStatus(const XDfeEqu *InstancePtr, XDfeEqu_Status *Status);
 void XDfeEqu_ClearEventStatus(const XDfeEqu *InstancePtr,
 			      const XDfeEqu_Status *Status);
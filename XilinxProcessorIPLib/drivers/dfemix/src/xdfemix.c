@@ -48,6 +48,8 @@
 * 1.4   dc     04/04/22 Correct conversion rate calculation
 *       dc     04/06/22 Update documentation
 *       dc     08/19/22 Update register map
+*       ag     10/15/26 Write only the changed NEXT CC configuration
+*                       registers
 *
 * </pre>
 * @addtogroup dfemix Overview
@@ -738,6 +740,29 @@ static u32 XDfeMix_UpdateCCDDC(const XDfeMix *InstancePtr, XDfeMix_CCCfg *CCCfg,
 	return XST_SUCCESS;
 }
 
+/****************************************************************************/
+/**
+*
+* Writes a NEXT CC configuration register unless it already holds the value.
+* The NEXT registers keep their value across a CC update, so a carrier add,
+* move or remove only writes the registers of the carriers and slots it
+* changes.
+*
+* @param    InstancePtr Pointer to the Mixer instance.
+* @param    Offset Register offset.
+* @param    Shadow Driver copy of the register.
+* @param    Data Value to be written.
+*
+****************************************************************************/
+static void XDfeMix_WriteNextReg(XDfeMix *InstancePtr, u32 Offset, u32 *Shadow,
+				 u32 Data)
+{
+	if ((InstancePtr->NextShadow.IsValid == 0U) || (*Shadow != Data)) {
+		XDfeMix_WriteReg(InstancePtr, Offset, Data);
+		*Shadow = Data;
+	}
+}
+
 /****************************************************************************/
 /**
 *
@@ -747,9 +772,10 @@ static u32 XDfeMix_UpdateCCDDC(const XDfeMix *InstancePtr, XDfeMix_CCCfg *CCCfg,
 * @param    CCCfg Configuration data container.
 *
 ****************************************************************************/
-static void XDfeMix_SetNextCCCfg(const XDfeMix *InstancePtr,
+static void XDfeMix_SetNextCCCfg(XDfeMix *InstancePtr,
 				 const XDfeMix_CCCfg *NextCCCfg)
 {
+	XDfeMix_NextShadow *Shadow = &InstancePtr->NextShadow;
 	u32 AntennaCfg = 0U;
 	u32 DucDdcConfig;
 	u32 Index;
@@ -777,13 +803,17 @@ static void XDfeMix_SetNextCCCfg(const XDfeMix *InstancePtr,
 
 	/* Write CCID sequence and carrier configurations */
 	for (Index = 0; Index < XDFEMIX_CC_NUM; Index++) {
-		XDfeMix_WriteReg(InstancePtr,
-				 XDFEMIX_SEQUENCE_NEXT + (sizeof(u32) * Index),
-				 NextCCID[Index]);
-
-		DucDdcConfig = XDfeMix_ReadReg(InstancePtr,
-					       XDFEMIX_CC_CONFIG_NEXT +
-						       ((Index * sizeof(u32))));
+		XDfeMix_WriteNextReg(InstancePtr,
+				     XDFEMIX_SEQUENCE_NEXT + (sizeof(u32) * Index),
+				     &Shadow->Sequence[Index], NextCCID[Index]);
+
+		if (Shadow->IsValid == 0U) {
+			DucDdcConfig = XDfeMix_ReadReg(
+				InstancePtr,
+				XDFEMIX_CC_CONFIG_NEXT + ((Index * sizeof(u32))));
+		} else {
+			DucDdcConfig = Shadow->CCConfig[Index];
+		}
 		DucDdcConfig =
 			XDfeMix_WrBitField(XDFEMIX_CC_CONFIG_NCO_WIDTH,
 					   XDFEMIX_CC_CONFIG_NCO_OFFSET,
@@ -799,17 +829,21 @@ static void XDfeMix_SetNextCCCfg(const XDfeMix *InstancePtr,
 					   XDFEMIX_CC_CONFIG_CC_GAIN_OFFSET,
 					   DucDdcConfig,
 					   NextCCCfg->DUCDDCCfg[Index].CCGain);
-		XDfeMix_WriteReg(InstancePtr,
-				 XDFEMIX_CC_CONFIG_NEXT +
-					 ((Index * sizeof(u32))),
-				 DucDdcConfig);
+		XDfeMix_WriteNextReg(InstancePtr,
+				     XDFEMIX_CC_CONFIG_NEXT +
+					     ((Index * sizeof(u32))),
+				     &Shadow->CCConfig[Index], DucDdcConfig);
 	}
 
 	/* Write Antenna configuration */
 	for (Index = 0; Index < XDFEMIX_ANT_NUM_MAX; Index++) {
 		AntennaCfg += (NextCCCfg->AntennaCfg.Gain[Index] << Index);
 	}
-	XDfeMix_WriteReg(InstancePtr, XDFEMIX_ANTENNA_GAIN_NEXT, AntennaCfg);
+	XDfeMix_WriteNextReg(InstancePtr, XDFEMIX_ANTENNA_GAIN_NEXT,
+			     &Shadow->AntennaGain, AntennaCfg);
+
+	/* NEXT registers now hold the shadow values */
+	Shadow->IsValid = 1U;
 }
 
 /****************************************************************************/
@@ -1383,6 +1417,7 @@ void XDfeMix_Reset(XDfeMix *InstancePtr)
 	/* Put Mixer in reset */
 	XDfeMix_WriteReg(InstancePtr, XDFEMIX_RESET_OFFSET, XDFEMIX_RESET_ON);
 	InstancePtr->StateId = XDFEMIX_STATE_RESET;
+	InstancePtr->NextShadow.IsValid = 0U;
 }
 
 /****************************************************************************/
@@ -1503,6 +1538,9 @@ void XDfeMix_Initialize(XDfeMix *InstancePtr, XDfeMix_Init *Init)
 	Xil_AssertVoid(InstancePtr->StateId == XDFEMIX_STATE_CONFIGURED);
 	Xil_AssertVoid(Init != NULL);
 
+	/* NEXT registers are written directly below */
+	InstancePtr->NextShadow.IsValid = 0U;
+
 	/* Enable FIR and MIXER registers */
 	XDfeMix_WriteReg(InstancePtr, XDFEMIX_STATE_FIR_ENABLE_OFFSET,
 			 XDFEMIX_STATE_FIR_ENABLED);
@@ -2019,7 +2057,7 @@ u32 XDfeMix_UpdateCCinCCCfg(const XDfeMix *InstancePtr, XDfeMix_CCCfg *CCCfg,
 *           - XST_FAILURE if error occurs.
 *
 ****************************************************************************/
-u32 XDfeMix_SetNextCCCfgAndTrigger(const XDfeMix *InstancePtr,
+u32 XDfeMix_SetNextCCCfgAndTrigger(XDfeMix *InstancePtr,
 				   const XDfeMix_CCCfg *CCCfg)
 {
 	u32 Index;
@@ -2288,7 +2326,7 @@ u32 XDfeMix_MoveCC(XDfeMix *InstancePtr, s32 CCID, u32 Rate, u32 FromNCO,
 *           running this API.
 *
 ****************************************************************************/
-u32 XDfeMix_UpdateCC(const XDfeMix *InstancePtr, s32 CCID,
+u32 XDfeMix_UpdateCC(XDfeMix *InstancePtr, s32 CCID,
 		     const XDfeMix_CarrierCfg *CarrierCfg)
 {
 	XDfeMix_CCCfg CCCfg;
@@ -77,6 +77,8 @@
 *       dc     03/21/22 Add prefix to global variables
 * 1.4   dc     03/28/22 Update documentation
 *       dc     08/19/22 Update register map
+*       ag     10/15/26 Write only the changed NEXT CC configuration
+*                       registers
 *
 * </pre>
 * @endcond
@@ -461,6 +463,16 @@ typedef struct {
 	u32 TUserWidth; /**< [0-64] */
 } XDfeMix_Config;
 
+/**
+ * Copy of the NEXT CC configuration registers as last written by the driver.
+ */
+typedef struct {
+	u32 IsValid; /**< [0,1] Copy matches the NEXT registers */
+	u32 Sequence[XDFEMIX_SEQ_LENGTH_MAX]; /**< Sequence NEXT */
+	u32 CCConfig[XDFEMIX_CC_NUM]; /**< DUC/DDC configuration NEXT */
+	u32 AntennaGain; /**< Antenna gain NEXT */
+} XDfeMix_NextShadow;
+
 /**
  * Mixer Structure.
  */
@@ -469,6 +481,7 @@ typedef struct {
 	XDfeMix_StateId StateId; /**< StateId */
 	s32 NotUsedCCID; /**< Lowest CCID number not allocated */
 	u32 SequenceLength; /**< Exact sequence length */
+	XDfeMix_NextShadow NextShadow; /**< Last written NEXT configuration */
 	char NodeName[XDFEMIX_NODE_NAME_MAX_LENGTH]; /**< Node name */
 	struct metal_io_region *Io; /**< Libmetal IO structure */
 	struct metal_device *Device; /**< Libmetal device structure */
@@ -515,14 +528,14 @@ void XDfeMix_RemoveCCfromCCCfg(XDfeMix *InstancePtr, XDfeMix_CCCfg *CCCfg,
 			       s32 CCID);
 u32 XDfeMix_UpdateCCinCCCfg(const XDfeMix *InstancePtr, XDfeMix_CCCfg *CCCfg,
 			    s32 CCID, const XDfeMix_CarrierCfg *CarrierCfg);
-u32 XDfeMix_SetNextCCCfgAndTrigger(const XDfeMix *InstancePtr,
+u32 XDfeMix_SetNextCCCfgAndTrigger(XDfeMix *InstancePtr,
 				   const XDfeMix_CCCfg *CCCfg);
 u32 XDfeMix_AddCC(XDfeMix *InstancePtr, s32 CCID, u32 CCSeqBitmap,
 		  const XDfeMix_CarrierCfg *CarrierCfg, const XDfeMix_NCO *NCO);
 u32 XDfeMix_RemoveCC(XDfeMix *InstancePtr, s32 CCID);
 u32 XDfeMix_MoveCC(XDfeMix *InstancePtr, s32 CCID, u32 Rate, u32 FromNCO,
 		   u32 ToNCO);
-u32 XDfeMix_UpdateCC(const XDfeMix *InstancePtr, s32 CCID,
+u32 XDfeMix_UpdateCC(XDfeMix *InstancePtr, s32 CCID,
 		     const XDfeMix_CarrierCfg *CarrierCfg);
 u32 XDfeMix_SetAntennaGain(XDfeMix *InstancePtr, u32 AntennaId,
 			   u32 AntennaGain);
@@ -42,6 +42,8 @@
 *       dc     03/21/22 Add prefix to global variables
 * 1.4   dc     04/04/22 Correct PatternPeriod represantion
 *       dc     04/06/22 Update documentation
+*       ag     10/15/26 Write only the changed NEXT CC configuration
+*                       registers
 *
 * </pre>
 * @addtogroup dfeprach Overview
@@ -495,6 +497,28 @@ static u32 XDfePrach_FindRate(const XDfePrach *InstancePtr, u32 CCSeqBitmap,
 	return XST_SUCCESS;
 }
 
+/****************************************************************************/
+/**
+*
+* Writes a NEXT CC configuration register unless it already holds the value.
+* The NEXT registers keep their value across an update, so a carrier add or
+* remove only writes the registers of the carriers and slots it changes.
+*
+* @param    InstancePtr Pointer to the PRACH instance.
+* @param    Offset Register offset.
+* @param    Shadow Driver copy of the register.
+* @param    Data Value to be written.
+*
+****************************************************************************/
+static void XDfePrach_WriteNextReg(XDfePrach *InstancePtr, u32 Offset,
+				   u32 *Shadow, u32 Data)
+{
+	if ((InstancePtr->NextShadow.IsValid == 0U) || (*Shadow != Data)) {
+		XDfePrach_WriteReg(InstancePtr, Offset, Data);
+		*Shadow = Data;
+	}
+}
+
 /****************************************************************************/
 /**
 *
@@ -504,9 +528,10 @@ static u32 XDfePrach_FindRate(const XDfePrach *InstancePtr, u32 CCSeqBitmap,
 * @param    NextCCCfg Next CC configuration container.
 *
 ****************************************************************************/
-static void XDfePrach_SetNextCCCfg(const XDfePrach *InstancePtr,
+static void XDfePrach_SetNextCCCfg(XDfePrach *InstancePtr,
 				   const XDfePrach_CCCfg *NextCCCfg)
 {
+	XDfePrach_NextShadow *Shadow = &InstancePtr->NextShadow;
 	u32 Data = 0U;
 	u32 Index;
 	u32 SeqLength;
@@ -532,10 +557,10 @@ static void XDfePrach_SetNextCCCfg(const XDfePrach *InstancePtr,
 
 	/* Write CCID sequence and carrier configurations */
 	for (Index = 0; Index < XDFEPRACH_SEQ_LENGTH_MAX; Index++) {
-		XDfePrach_WriteReg(InstancePtr,
-				   XDFEPRACH_CC_SEQUENCE_NEXT +
-					   (Index * sizeof(u32)),
-				   NextCCID[Index]);
+		XDfePrach_WriteNextReg(InstancePtr,
+				       XDFEPRACH_CC_SEQUENCE_NEXT +
+					       (Index * sizeof(u32)),
+				       &Shadow->Sequence[Index], NextCCID[Index]);
 
 		Data = XDfePrach_WrBitField(
 			XDFEPRACH_CC_MAPPING_ENABLE_WIDTH,
@@ -549,11 +574,14 @@ static void XDfePrach_SetNextCCCfg(const XDfePrach *InstancePtr,
 			XDFEPRACH_CC_MAPPING_DECIMATION_RATE_WIDTH,
 			XDFEPRACH_CC_MAPPING_DECIMATION_RATE_OFFSET, Data,
 			NextCCCfg->CarrierCfg[Index].CCRate);
-		XDfePrach_WriteReg(InstancePtr,
-				   XDFEPRACH_CC_MAPPING_NEXT +
-					   (Index * sizeof(u32)),
-				   Data);
+		XDfePrach_WriteNextReg(InstancePtr,
+				       XDFEPRACH_CC_MAPPING_NEXT +
+					       (Index * sizeof(u32)),
+				       &Shadow->CCMapping[Index], Data);
 	}
+
+	/* NEXT registers now hold the shadow values */
+	Shadow->IsValid = 1U;
 }
 
 /****************************************************************************/
@@ -1553,6 +1581,7 @@ void XDfePrach_Reset(XDfePrach *InstancePtr)
 	XDfePrach_WriteReg(InstancePtr, XDFEPRACH_RESET_OFFSET,
 			   XDFEPRACH_RESET_OFF);
 	InstancePtr->StateId = XDFEPRACH_STATE_RESET;
+	InstancePtr->NextShadow.IsValid = 0U;
 }
 
 /****************************************************************************/
@@ -1664,6 +1693,9 @@ void XDfePrach_Initialize(XDfePrach *InstancePtr, XDfePrach_Init *Init)
 	Xil_AssertVoid(InstancePtr->StateId == XDFEPRACH_STATE_CONFIGURED);
 	Xil_AssertVoid(Init != NULL);
 
+	/* NEXT registers are written directly below */
+	InstancePtr->NextShadow.IsValid = 0U;
+
 	/* Write "one-time" Sequence length */
 	InstancePtr->NotUsedCCID = 0;
 	InstancePtr->SequenceLength = Init->Sequence.Length;
@@ -2134,7 +2166,7 @@ u32 XDfePrach_UpdateCCinCCCfg(const XDfePrach *InstancePtr,
 *           - XST_FAILURE if error occurs.
 *
 ****************************************************************************/
-u32 XDfePrach_SetNextCfg(const XDfePrach *InstancePtr,
+u32 XDfePrach_SetNextCfg(XDfePrach *InstancePtr,
 			 const XDfePrach_CCCfg *NextCCCfg,
 			 XDfePrach_RCCfg *NextRCCfg)
 {
@@ -2298,7 +2330,7 @@ u32 XDfePrach_RemoveCC(XDfePrach *InstancePtr, s32 CCID)
 *           running this API.
 *
 ****************************************************************************/
-u32 XDfePrach_UpdateCC(const XDfePrach *InstancePtr, s32 CCID,
+u32 XDfePrach_UpdateCC(XDfePrach *InstancePtr, s32 CCID,
 		       const XDfePrach_CarrierCfg *CarrierCfg)
 {
 	XDfePrach_CCCfg CCCfg;
@@ -2547,7 +2579,7 @@ void XDfePrach_UpdateRCinRCCfg(const XDfePrach *InstancePtr,
 *           running this API.
 *
 ****************************************************************************/
-u32 XDfePrach_AddRCCfg(const XDfePrach *InstancePtr, s32 CCID, u32 RCId,
+u32 XDfePrach_AddRCCfg(XDfePrach *InstancePtr, s32 CCID, u32 RCId,
 		       u32 RachChan, XDfePrach_DDCCfg *DdcCfg,
 		       XDfePrach_NCO *NcoCfg,
 		       XDfePrach_Schedule *StaticSchedule)
@@ -2615,7 +2647,7 @@ u32 XDfePrach_AddRCCfg(const XDfePrach *InstancePtr, s32 CCID, u32 RCId,
 *           running this API.
 *
 ****************************************************************************/
-u32 XDfePrach_RemoveRC(const XDfePrach *InstancePtr, u32 RCId)
+u32 XDfePrach_RemoveRC(XDfePrach *InstancePtr, u32 RCId)
 {
 	XDfePrach_CCCfg CurrentCCCfg;
 	XDfePrach_RCCfg CurrentRCCfg;
@@ -2664,7 +2696,7 @@ u32 XDfePrach_RemoveRC(const XDfePrach *InstancePtr, u32 RCId)
 *           running this API.
 *
 ****************************************************************************/
-u32 XDfePrach_UpdateRCCfg(const XDfePrach *InstancePtr, s32 CCID, u32 RCId,
+u32 XDfePrach_UpdateRCCfg(XDfePrach *InstancePtr, s32 CCID, u32 RCId,
 			  u32 RachChan, XDfePrach_DDCCfg *DdcCfg,
 			  XDfePrach_NCO *NcoCfg,
 			  XDfePrach_Schedule *StaticSchedule)
@@ -2719,7 +2751,7 @@ u32 XDfePrach_UpdateRCCfg(const XDfePrach *InstancePtr, s32 CCID, u32 RCId,
 *           running this API.
 *
 ****************************************************************************/
-u32 XDfePrach_MoveRC(const XDfePrach *InstancePtr, u32 RCId, u32 ToChannel)
+u32 XDfePrach_MoveRC(XDfePrach *InstancePtr, u32 RCId, u32 ToChannel)
 {
 	u32 Index;
 	XDfePrach_CCCfg CurrentCCCfg;
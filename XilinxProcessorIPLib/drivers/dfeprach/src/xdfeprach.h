@@ -73,6 +73,8 @@
 *       dc     03/21/22 Add prefix to global variables
 * 1.4   dc     04/04/22 Correct PatternPeriod represantion
 *       dc     03/28/22 Update documentation
+*       ag     10/15/26 Write only the changed NEXT CC configuration
+*                       registers
 *
 * </pre>
 * @endcond
@@ -573,6 +575,15 @@ typedef struct {
 	u32 HasIrq; /**< [0,1] CORE.MODEL_PARAM.HAS_IRQ */
 } XDfePrach_Config;
 
+/**
+ * Copy of the NEXT CC configuration registers as last written by the driver.
+ */
+typedef struct {
+	u32 IsValid; /**< [0,1] Copy matches the NEXT registers */
+	u32 Sequence[XDFEPRACH_SEQ_LENGTH_MAX]; /**< CC sequence NEXT */
+	u32 CCMapping[XDFEPRACH_CC_NUM_MAX]; /**< CC mapping NEXT */
+} XDfePrach_NextShadow;
+
 /**
  * PRACH driver object - global data storage.
  */
@@ -581,6 +592,7 @@ typedef struct {
 	XDfePrach_StateId StateId; /**< State machine state Id */
 	s32 NotUsedCCID; /**< Storage for 'Not used CCID' value */
 	u32 SequenceLength; /**< Sequence length 'storage' */
+	XDfePrach_NextShadow NextShadow; /**< Last written NEXT configuration */
 	char NodeName[XDFEPRACH_NODE_NAME_MAX_LENGTH]; /**< Node name storage */
 	struct metal_io_region *Io; /**< Libmetal IO structure */
 	struct metal_device *Device; /**< Libmetal device structure */
@@ -627,13 +639,13 @@ u32 XDfePrach_RemoveCCfromCCCfg(XDfePrach *InstancePtr, XDfePrach_CCCfg *CCCfg,
 u32 XDfePrach_UpdateCCinCCCfg(const XDfePrach *InstancePtr,
 			      XDfePrach_CCCfg *CCCfg, s32 CCID,
 			      const XDfePrach_CarrierCfg *CarrierCfg);
-u32 XDfePrach_SetNextCfg(const XDfePrach *InstancePtr,
+u32 XDfePrach_SetNextCfg(XDfePrach *InstancePtr,
 			 const XDfePrach_CCCfg *NextCCCfg,
 			 XDfePrach_RCCfg *NextRCCfg);
 u32 XDfePrach_AddCC(XDfePrach *InstancePtr, s32 CCID, u32 CCSeqBitmap,
 		    const XDfePrach_CarrierCfg *CarrierCfg);
 u32 XDfePrach_RemoveCC(XDfePrach *InstancePtr, s32 CCID);
-u32 XDfePrach_UpdateCC(const XDfePrach *InstancePtr, s32 CCID,
+u32 XDfePrach_UpdateCC(XDfePrach *InstancePtr, s32 CCID,
 		       const XDfePrach_CarrierCfg *CarrierCfg);
 void XDfePrach_GetCurrentRCCfg(const XDfePrach *InstancePtr,
 			       XDfePrach_RCCfg *RCCfg);
@@ -654,16 +666,16 @@ void XDfePrach_UpdateRCinRCCfg(const XDfePrach *InstancePtr,
 			       u32 RCId, u32 RachChan, XDfePrach_DDCCfg *DdcCfg,
 			       XDfePrach_NCO *NcoCfg,
 			       XDfePrach_Schedule *StaticSchedule);
-u32 XDfePrach_AddRCCfg(const XDfePrach *InstancePtr, s32 CCID, u32 RCId,
+u32 XDfePrach_AddRCCfg(XDfePrach *InstancePtr, s32 CCID, u32 RCId,
 		       u32 RachChan, XDfePrach_DDCCfg *DdcCfg,
 		       XDfePrach_NCO *NcoCfg,
 		       XDfePrach_Schedule *StaticSchedule);
-u32 XDfePrach_RemoveRC(const XDfePrach *InstancePtr, u32 RCId);
-u32 XDfePrach_UpdateRCCfg(const XDfePrach *InstancePtr, s32 CCID, u32 RCId,
+u32 XDfePrach_RemoveRC(XDfePrach *InstancePtr, u32 RCId);
+u32 XDfePrach_UpdateRCCfg(XDfePrach *InstancePtr, s32 CCID, u32 RCId,
 			  u32 RachChan, XDfePrach_DDCCfg *DdcCfg,
 			  XDfePrach_NCO *NcoCfg,
 			  XDfePrach_Schedule *StaticSchedule);
-u32 XDfePrach_MoveRC(const XDfePrach *InstancePtr, u32 RCId, u32 ToChannel);
+u32 XDfePrach_MoveRC(XDfePrach *InstancePtr, u32 RCId, u32 ToChannel);
 void XDfePrach_GetTriggersCfg(const XDfePrach *InstancePtr,
 			      XDfePrach_TriggerCfg *TriggerCfg);
 void XDfePrach_SetTriggersCfg(const XDfePrach *InstancePtr,
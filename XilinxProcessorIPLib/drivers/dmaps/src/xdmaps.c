@@ -46,6 +46,9 @@
 * 2.3 kpc     14/10/16   Fixed the compiler error when optimization O0 is used.
 * 2.5 hk      08/16/19   Add a memory barrier before DMASEV as per specification.
 * 2.6 hk      02/14/20   Correct boundary check for Channel.
+* 2.8 ag      10/14/26   Reuse cached DMA programs of the same geometry, added
+*                        XDmaPs_PatchDmaProg(), XDmaPs_Stop() and looped
+*                        and cyclic programs.
 *
 * </pre>
 *
@@ -75,6 +78,13 @@
 
 /***************** Macros (Inline Functions) Definitions ********************/
 
+/*
+ * Offset of the DMAMOV SAR instruction in a generated program. A finite
+ * looped program starts with the DMALP of the repeat loop.
+ */
+#define XDMAPS_PROG_ADDR_OFFSET(LoopCount)			\
+	((((LoopCount) > 1) && ((LoopCount) != XDMAPS_LOOP_CYCLIC)) ? 2 : 0)
+
 
 /************************** Function Prototypes *****************************/
 static int XDmaPs_Exec_DMAKILL(u32 BaseAddr,
@@ -86,7 +96,11 @@ static void XDmaPs_BufPool_Free(XDmaPs_ProgBuf *Pool, void *Buf);
 static int XDmaPs_Exec_DMAGO(u32 BaseAddr, unsigned int Channel, u32 DmaProg);
 
 static void XDmaPs_DoneISR_n(XDmaPs *InstPtr, unsigned Channel);
-static void *XDmaPs_BufPool_Allocate(XDmaPs_ProgBuf *Pool);
+static XDmaPs_ProgBuf *XDmaPs_BufPool_Allocate(XDmaPs_ProgBuf *Pool);
+static XDmaPs_ProgBuf *XDmaPs_BufPool_Lookup(XDmaPs_ProgBuf *Pool,
+					      XDmaPs_ProgKey *Key);
+static void XDmaPs_SetProgAddr(char *DmaProg, unsigned int LoopCount,
+				u32 SrcAddr, u32 DstAddr);
 static int XDmaPs_BuildDmaProg(unsigned Channel, XDmaPs_Cmd *Cmd,
 				unsigned CacheLength);
 
@@ -551,6 +565,36 @@ static INLINE int XDmaPs_Instr_DMALPEND(char *DmaProg, char *BodyStart, unsigned
 	return 2;
 }
 
+/****************************************************************************/
+/**
+*
+* Construction function for the DMALPEND instruction of a loop forever. This
+* function fills the program buffer with the constructed instruction.
+*
+* @param	DmaProg is the DMA program buffer, it's the starting address
+*		for the instruction being constructed
+* @param	BodyStart is the starting address of the loop body. It is used
+* 		to calculate the bytes of backward jump.
+*
+* @return 	The number of bytes for this instruction which is 2.
+*
+* @note	A loop forever has no DMALP instruction, the loop starts at
+*		BodyStart.
+*
+*****************************************************************************/
+static INLINE int XDmaPs_Instr_DMALPFEND(char *DmaProg, char *BodyStart)
+{
+	/*
+	 * DMALPEND encoding with nf 0 and lc 0
+	 * 15       ...        8 7 6 5 4  3 2  1  0
+	 * | backward_jump[7:0] |0 0 1 0  1 0  0  0
+	 */
+	*DmaProg = 0x28;
+	*(DmaProg + 1) = (u8)(DmaProg - BodyStart);
+
+	return 2;
+}
+
 /*
  * Register number for the DMAMOV instruction
  */
@@ -1097,6 +1141,8 @@ static int XDmaPs_BuildDmaProg(unsigned Channel, XDmaPs_Cmd *Cmd,
 	unsigned int Index;
 	unsigned int SrcUnaligned = 0;
 	unsigned int DstUnaligned = 0;
+	unsigned int Repeat = Cmd->LoopCount;
+	char *BodyStart;
 
 	XDmaPs_ChanCtrl *ChanCtrl;
 	XDmaPs_ChanCtrl WordChanCtrl;
@@ -1116,6 +1162,19 @@ static int XDmaPs_BuildDmaProg(unsigned Channel, XDmaPs_Cmd *Cmd,
 
 	ChanCtrl = &Cmd->ChanCtrl;
 
+	if (Repeat == XDMAPS_LOOP_CYCLIC) {
+		Repeat = 0;
+	} else if (Repeat > 1) {
+		/* repeat loop, it takes loop counter 1 */
+		DmaProgBuf += XDmaPs_Instr_DMALP(DmaProgBuf, 1, Repeat);
+	}
+
+	/*
+	 * the repeat loop body starts with the DMAMOVs so that each pass
+	 * starts from the beginning of the buffers
+	 */
+	BodyStart = DmaProgBuf;
+
 	/* insert DMAMOV for SAR and DAR */
 	DmaProgBuf += XDmaPs_Instr_DMAMOV(DmaProgBuf,
 					   XDMAPS_MOV_SAR,
@@ -1191,6 +1250,11 @@ static int XDmaPs_BuildDmaProg(unsigned Channel, XDmaPs_Cmd *Cmd,
 				   Channel);
 			return 0;
 		}
+		if ((LoopCount1 > 1) && (Repeat > 1)) {
+			xil_printf("DMA operation is too long for a looped "
+				   "program for channel %d\r\n", Channel);
+			return 0;
+		}
 		LoopResidue = LoopCount % 256;
 
 		if (LoopCount1 > 1)
@@ -1281,9 +1345,26 @@ static int XDmaPs_BuildDmaProg(unsigned Channel, XDmaPs_Cmd *Cmd,
 		}
 	}
 
+	if (Repeat > 1) {
+		if (DmaProgBuf - BodyStart > 255) {
+			return 0;
+		}
+		DmaProgBuf += XDmaPs_Instr_DMALPEND(DmaProgBuf,
+						     BodyStart, 1);
+	}
+
 	/* Add a memory barrier before DMASSEV as recommended by spec */
 	DmaProgBuf += XDmaPs_Instr_DMAWMB(DmaProgBuf);
 	DmaProgBuf += XDmaPs_Instr_DMASEV(DmaProgBuf, DevChan);
+
+	if (Cmd->LoopCount == XDMAPS_LOOP_CYCLIC) {
+		/* signal every pass and loop forever */
+		if (DmaProgBuf - BodyStart > 255) {
+			return 0;
+		}
+		DmaProgBuf += XDmaPs_Instr_DMALPFEND(DmaProgBuf, BodyStart);
+	}
+
 	DmaProgBuf += XDmaPs_Instr_DMAEND(DmaProgBuf);
 
 	DmaProgBytes = DmaProgBuf - DmaProgStart;
@@ -1301,6 +1382,10 @@ static int XDmaPs_BuildDmaProg(unsigned Channel, XDmaPs_Cmd *Cmd,
 * Generate a DMA program based for the DMA command, the buffer will be pointed
 * by the GeneratedDmaProg field of the command.
 *
+* If a free program buffer of the channel still holds a program built for
+* the same geometry, that program is reused and only its source and
+* destination addresses are patched.
+*
 * @param	InstPtr is then DMA instance.
 * @param	Channel is the DMA channel number.
 * @param	Cmd is the DMA command.
@@ -1317,6 +1402,8 @@ int XDmaPs_GenDmaProg(XDmaPs *InstPtr, unsigned int Channel, XDmaPs_Cmd *Cmd)
 	int ProgLen;
 	XDmaPs_ChannelData *ChanData;
 	XDmaPs_ChanCtrl *ChanCtrl;
+	XDmaPs_ProgBuf *ProgBuf;
+	XDmaPs_ProgKey Key;
 
 	Xil_AssertNonvoid(InstPtr != NULL);
 	Xil_AssertNonvoid(Cmd != NULL);
@@ -1345,16 +1432,45 @@ int XDmaPs_GenDmaProg(XDmaPs *InstPtr, unsigned int Channel, XDmaPs_Cmd *Cmd)
 		return XST_FAILURE;
 	}
 
-	Buf = XDmaPs_BufPool_Allocate(ChanData->ProgBufPool);
-	if (Buf == NULL) {
+	if ((Cmd->LoopCount > XDMAPS_MAX_LOOP_COUNT) &&
+	    (Cmd->LoopCount != XDMAPS_LOOP_CYCLIC)) {
+		return XST_FAILURE;
+	}
+
+	Key.ChanCtrl = *ChanCtrl;
+	Key.Length = Cmd->BD.Length;
+	Key.SrcOffset = Cmd->BD.SrcAddr % ChanCtrl->SrcBurstSize;
+	Key.DstOffset = Cmd->BD.DstAddr % ChanCtrl->DstBurstSize;
+	Key.LoopCount = Cmd->LoopCount;
+
+	ProgBuf = XDmaPs_BufPool_Lookup(ChanData->ProgBufPool, &Key);
+	if (ProgBuf != NULL) {
+		/* same geometry, only the addresses differ */
+		ProgBuf->Allocated = 1;
+		Cmd->GeneratedDmaProg = ProgBuf->Buf;
+		Cmd->GeneratedDmaProgLength = ProgBuf->Len;
+		XDmaPs_SetProgAddr(ProgBuf->Buf, Cmd->LoopCount,
+				    Cmd->BD.SrcAddr, Cmd->BD.DstAddr);
+		return XST_SUCCESS;
+	}
+
+	ProgBuf = XDmaPs_BufPool_Allocate(ChanData->ProgBufPool);
+	if (ProgBuf == NULL) {
 		return XST_FAILURE;
 	}
+	Buf = ProgBuf->Buf;
 
 	Cmd->GeneratedDmaProg = Buf;
 	ProgLen = XDmaPs_BuildDmaProg(Channel, Cmd,
 				       InstPtr->CacheLength);
 	Cmd->GeneratedDmaProgLength = ProgLen;
 
+	if (ProgLen > 0) {
+		ProgBuf->Key = Key;
+		ProgBuf->Len = ProgLen;
+		ProgBuf->KeyValid = 1;
+	}
+
 
 #ifdef XDMAPS_DEBUG
 	XDmaPs_Print_DmaProg(Cmd);
@@ -1412,6 +1528,97 @@ int XDmaPs_FreeDmaProg(XDmaPs *InstPtr, unsigned int Channel, XDmaPs_Cmd *Cmd)
 }
 
 
+/****************************************************************************/
+/**
+* Change the source and destination addresses of the DMA program that is
+* pointed by the GeneratedDmaProg field of the command. This is used to
+* relaunch a program held with the HoldDmaProg argument of XDmaPs_Start()
+* for other buffers, without generating the program again.
+*
+* @param	Cmd is the DMA command.
+* @param	SrcAddr is the new source address.
+* @param	DstAddr is the new destination address.
+*
+* @return	- XST_SUCCESS on success.
+* 		- XST_FAILURE if the command has no generated program, or the
+*		new addresses are not at the same offset within a burst as the
+*		addresses the program was generated for.
+*
+* @note		The channel must not be running the program.
+*
+*****************************************************************************/
+int XDmaPs_PatchDmaProg(XDmaPs_Cmd *Cmd, u32 SrcAddr, u32 DstAddr)
+{
+	XDmaPs_ChanCtrl *ChanCtrl;
+
+	Xil_AssertNonvoid(Cmd != NULL);
+
+	if (!Cmd->GeneratedDmaProg)
+		return XST_FAILURE;
+
+	ChanCtrl = &Cmd->ChanCtrl;
+
+	/*
+	 * the head and tail handling of the program depends on the
+	 * alignment of the addresses
+	 */
+	if ((SrcAddr % ChanCtrl->SrcBurstSize !=
+	     Cmd->BD.SrcAddr % ChanCtrl->SrcBurstSize) ||
+	    (DstAddr % ChanCtrl->DstBurstSize !=
+	     Cmd->BD.DstAddr % ChanCtrl->DstBurstSize)) {
+		return XST_FAILURE;
+	}
+
+	Cmd->BD.SrcAddr = SrcAddr;
+	Cmd->BD.DstAddr = DstAddr;
+	XDmaPs_SetProgAddr((char *)Cmd->GeneratedDmaProg, Cmd->LoopCount,
+			    SrcAddr, DstAddr);
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+* Stop the DMA command running on a channel. This is the way to end a
+* cyclic command. The generated program is released unless it was held by
+* the HoldDmaProg argument of XDmaPs_Start().
+*
+* @param	InstPtr is then DMA instance.
+* @param	Channel is the DMA channel number.
+*
+* @return	- XST_SUCCESS on success.
+* 		- XST_FAILURE if the channel could not be killed.
+*
+* @note		The done handler is not called for the stopped command.
+*
+*****************************************************************************/
+int XDmaPs_Stop(XDmaPs *InstPtr, unsigned int Channel)
+{
+	XDmaPs_ChannelData *ChanData;
+	XDmaPs_Cmd *DmaCmd;
+
+	Xil_AssertNonvoid(InstPtr != NULL);
+
+	if (Channel >= XDMAPS_CHANNELS_PER_DEV)
+		return XST_FAILURE;
+
+	if (XDmaPs_ResetChannel(InstPtr, Channel))
+		return XST_FAILURE;
+
+	ChanData = InstPtr->Chans + Channel;
+	DmaCmd = ChanData->DmaCmdToHw;
+	if (DmaCmd) {
+		if (!ChanData->HoldDmaProg && DmaCmd->GeneratedDmaProg) {
+			XDmaPs_BufPool_Free(ChanData->ProgBufPool,
+					     DmaCmd->GeneratedDmaProg);
+			DmaCmd->GeneratedDmaProg = NULL;
+		}
+		ChanData->DmaCmdToHw = NULL;
+	}
+
+	return XST_SUCCESS;
+}
+
 /****************************************************************************/
 /**
 *
@@ -1528,30 +1735,92 @@ int XDmaPs_IsActive(XDmaPs *InstPtr, unsigned int Channel)
 /****************************************************************************/
 /**
 *
-* Allocate a buffer of the DMA program buffer from the pool.
+* Allocate a buffer of the DMA program buffer from the pool. Buffers that do
+* not hold a reusable program are taken first.
 *
 * @param	Pool the DMA program pool.
 *
 * @return	The allocated buffer, NULL if there is any error.
 *
-* @note		None.
+* @note		The reusable program in the returned buffer is discarded.
 *
 *****************************************************************************/
-static void *XDmaPs_BufPool_Allocate(XDmaPs_ProgBuf *Pool)
+static XDmaPs_ProgBuf *XDmaPs_BufPool_Allocate(XDmaPs_ProgBuf *Pool)
 {
 	int Index;
+	XDmaPs_ProgBuf *ProgBuf = NULL;
 
 	Xil_AssertNonvoid(Pool != NULL);
 
 	for (Index = 0; Index < XDMAPS_MAX_CHAN_BUFS; Index++) {
 		if (!Pool[Index].Allocated) {
-			Pool[Index].Allocated = 1;
-			return Pool[Index].Buf;
+			ProgBuf = Pool + Index;
+			if (!ProgBuf->KeyValid)
+				break;
+		}
+	}
+
+	if (ProgBuf) {
+		ProgBuf->Allocated = 1;
+		ProgBuf->KeyValid = 0;
+	}
+
+	return ProgBuf;
+}
+
+/****************************************************************************/
+/**
+*
+* Find a free buffer in the pool that holds a program of the given geometry.
+*
+* @param	Pool the DMA program pool.
+* @param	Key the geometry of the program.
+*
+* @return	The buffer, NULL if there is none. The buffer is not allocated.
+*
+* @note		None.
+*
+*****************************************************************************/
+static XDmaPs_ProgBuf *XDmaPs_BufPool_Lookup(XDmaPs_ProgBuf *Pool,
+					      XDmaPs_ProgKey *Key)
+{
+	int Index;
+
+	for (Index = 0; Index < XDMAPS_MAX_CHAN_BUFS; Index++) {
+		if (!Pool[Index].Allocated && Pool[Index].KeyValid &&
+		    !memcmp(&Pool[Index].Key, Key, sizeof(XDmaPs_ProgKey))) {
+			return Pool + Index;
 		}
 	}
 
 	return NULL;
+}
 
+/****************************************************************************/
+/**
+*
+* Write the immediates of the DMAMOV SAR and DMAMOV DAR instructions of a
+* generated program and flush them to memory.
+*
+* @param	DmaProg is the generated DMA program.
+* @param	LoopCount is the loop count the program was generated for.
+* @param	SrcAddr is the source address.
+* @param	DstAddr is the destination address.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void XDmaPs_SetProgAddr(char *DmaProg, unsigned int LoopCount,
+				u32 SrcAddr, u32 DstAddr)
+{
+	char *MovStart = DmaProg + XDMAPS_PROG_ADDR_OFFSET(LoopCount);
+
+	XDmaPs_Memcpy4(MovStart + 2, (char *)&SrcAddr);
+	XDmaPs_Memcpy4(MovStart + 8, (char *)&DstAddr);
+
+	Xil_DCacheFlushRange((u32)MovStart, 12);
 }
 
 /*****************************************************************************/
@@ -1891,7 +2160,14 @@ static void XDmaPs_DoneISR_n(XDmaPs *InstPtr, unsigned Channel)
 
 
 	DmaCmd = ChanData->DmaCmdToHw;
-	if (DmaCmd) {
+	if (DmaCmd && (DmaCmd->LoopCount == XDMAPS_LOOP_CYCLIC)) {
+		/* the program keeps running, report the pass */
+		DmaCmd->DmaStatus = 0;
+
+		if (ChanData->DoneHandler)
+			ChanData->DoneHandler(Channel, DmaCmd,
+					      ChanData->DoneRef);
+	} else if (DmaCmd) {
 		if (!ChanData->HoldDmaProg) {
 			DmaProgBuf = (void *)DmaCmd->GeneratedDmaProg;
 			if (DmaProgBuf)
@@ -11,6 +11,30 @@
 * @{
 * @details
 *
+* <b>DMA Program Cache</b>
+*
+* XDmaPs_GenDmaProg() keeps the geometry of each program it builds with the
+* program buffer: the channel control, the length, the loop count and the
+* offsets of the source and destination addresses within a burst. A later
+* command with the same geometry reuses the program left in a free buffer
+* and only the source and destination addresses are patched, so recurring
+* transfers do not pay for the program generation. The number of program
+* buffers of a channel is set by XDMAPS_MAX_CHAN_BUFS.
+*
+* A program held with the HoldDmaProg argument of XDmaPs_Start() can be
+* relaunched for other buffers of the same geometry by calling
+* XDmaPs_PatchDmaProg() and then XDmaPs_Start() again.
+*
+* <b>Looped and Cyclic Programs</b>
+*
+* The LoopCount field of the command makes the generated program repeat the
+* transfer without the CPU re-arming the channel. With a LoopCount of 2 to
+* XDMAPS_MAX_LOOP_COUNT the transfer runs LoopCount times and the done
+* interrupt is raised once at the end. With XDMAPS_LOOP_CYCLIC the transfer
+* runs until XDmaPs_Stop() is called and the done handler is called after
+* every pass. The repeat loop of a looped program takes one of the two loop
+* counters, which limits its transfer to less than 512 bursts. A cyclic
+* program has no such limit.
 *
 * <pre>
 * MODIFICATION HISTORY:
@@ -60,6 +84,8 @@
 * 2.4   adk    13/08/18 Fixed armcc compiler warnings in the driver CR-1008310.
 * 2.8	sk     05/18/21 Modify all inline functions declarations from extern inline
 *			to static inline to avoid the linkage conflict for IAR compiler.
+*	ag     10/14/26 Added the program cache, XDmaPs_PatchDmaProg(),
+*			XDmaPs_Stop() and looped and cyclic programs.
 * </pre>
 *
 *****************************************************************************/
@@ -82,6 +108,10 @@ extern "C" {
 
 /************************** Constant Definitions ****************************/
 
+#define XDMAPS_MAX_LOOP_COUNT	256	/**< Maximum finite LoopCount */
+#define XDMAPS_LOOP_CYCLIC	0xFFFFFFFFU /**< LoopCount that repeats the
+					      *  transfer until stopped */
+
 /**************************** Type Definitions ******************************/
 
 /**
@@ -163,6 +193,11 @@ typedef struct {
 				 */
 	u32 ChanFaultPCAddr;	/**< Channel fault PC address
 				 */
+	unsigned int LoopCount;	/**< Number of times the generated
+				 *  program runs the transfer, 0 or 1
+				 *  to run it once, XDMAPS_LOOP_CYCLIC
+				 *  to run it until stopped
+				 */
 } XDmaPs_Cmd;
 
 /**
@@ -179,9 +214,24 @@ typedef void (*XDmaPsFaultHandler) (unsigned int Channel,
 				     XDmaPs_Cmd *DmaCmd,
 				     void *CallbackRef);
 
+#ifndef XDMAPS_MAX_CHAN_BUFS
 #define XDMAPS_MAX_CHAN_BUFS	2
+#endif
 #define XDMAPS_CHAN_BUF_LEN	128
 
+/**
+ * The XDmaPs_ProgKey is the geometry a generated DMA program depends on.
+ */
+typedef struct {
+	XDmaPs_ChanCtrl ChanCtrl;	/**< Channel control of the command */
+	unsigned int Length;		/**< Number of bytes */
+	unsigned int SrcOffset;		/**< Source address modulo the source
+					  *  burst size */
+	unsigned int DstOffset;		/**< Destination address modulo the
+					  *  destination burst size */
+	unsigned int LoopCount;		/**< Loop count of the command */
+} XDmaPs_ProgKey;
+
 /**
  * The XDmaPs_ProgBuf is the struct for a DMA program buffer.
  */
@@ -192,6 +242,10 @@ typedef struct {
 					  *  program in bytes. */
 	int Allocated;			/**< A tag indicating whether the
 					  *  buffer is allocated or not */
+	XDmaPs_ProgKey Key;		/**< Geometry of the program in the
+					  *  buffer */
+	int KeyValid;			/**< A tag indicating whether the
+					  *  buffer holds a reusable program */
 } XDmaPs_ProgBuf;
 
 /**
@@ -249,6 +303,8 @@ int XDmaPs_GenDmaProg(XDmaPs *InstPtr, unsigned int Channel,
 int XDmaPs_FreeDmaProg(XDmaPs *InstPtr, unsigned int Channel,
 			XDmaPs_Cmd *Cmd);
 void XDmaPs_Print_DmaProg(XDmaPs_Cmd *Cmd);
+int XDmaPs_PatchDmaProg(XDmaPs_Cmd *Cmd, u32 SrcAddr, u32 DstAddr);
+int XDmaPs_Stop(XDmaPs *InstPtr, unsigned int Channel);
 
 
 int XDmaPs_ResetManager(XDmaPs *InstPtr);
@@ -281,6 +337,7 @@ static INLINE int XDmaPs_Instr_DMALD(char *DmaProg);
 static INLINE int XDmaPs_Instr_DMALP(char *DmaProg, unsigned Lc,
 	       unsigned LoopIterations);
 static INLINE int XDmaPs_Instr_DMALPEND(char *DmaProg, char *BodyStart, unsigned Lc);
+static INLINE int XDmaPs_Instr_DMALPFEND(char *DmaProg, char *BodyStart);
 static INLINE int XDmaPs_Instr_DMAMOV(char *DmaProg, unsigned Rd, u32 Imm);
 static INLINE int XDmaPs_Instr_DMANOP(char *DmaProg);
 static INLINE int XDmaPs_Instr_DMASEV(char *DmaProg, unsigned int EventNumber);
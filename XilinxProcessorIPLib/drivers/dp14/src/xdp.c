@@ -37,6 +37,7 @@
  * 7.4   rg   09/01/20 Added XDp_TxColorimetryVsc API for reading sink device
  *                     capability for receiving colorimetry information through
  *                     VSC SDP packets.
+ * 7.4   ag   10/15/26 Added XDp_TxEnableTrainCache and XDp_TxClearTrainCache.
  * </pre>
  *
 *******************************************************************************/
@@ -111,6 +112,8 @@ static u32 XDp_RxInitialize(XDp *InstancePtr);
 #if XPAR_XDPTXSS_NUM_INSTANCES
 /* Training functions. */
 static u32 XDp_TxRunTraining(XDp *InstancePtr);
+static u32 XDp_TxGetTrainCacheIndex(XDp *InstancePtr, u8 *RateIdx,
+							u8 *LaneIdx);
 static XDp_TxTrainingState XDp_TxTrainingStateClockRecovery(XDp *InstancePtr);
 static XDp_TxTrainingState XDp_TxTrainingStateChannelEqualization(
 							XDp *InstancePtr);
@@ -596,6 +599,55 @@ void XDp_TxEnableTrainAdaptive(XDp *InstancePtr, u8 Enable)
 	InstancePtr->TxInstance.TrainAdaptive = Enable;
 }
 
+/******************************************************************************/
+/**
+ * This function enables or disables the link training cache. When enabled,
+ * the clock recovery sequence starts from the voltage swing and pre-emphasis
+ * levels of the previous successful training at the same link rate and lane
+ * count instead of the minimum levels, which usually lets the RX device lock
+ * without further adjustment requests. The cache is cleared automatically
+ * when the capabilities of the RX device change.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	Enable controls the training cache.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+void XDp_TxEnableTrainCache(XDp *InstancePtr, u8 Enable)
+{
+	/* Verify arguments. */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(XDp_GetCoreType(InstancePtr) == XDP_TX);
+	Xil_AssertVoid((Enable == 1) || (Enable == 0));
+
+	InstancePtr->TxInstance.TrainCacheEn = Enable;
+}
+
+/******************************************************************************/
+/**
+ * This function clears all entries of the link training cache, e.g. after a
+ * different RX device with identical capabilities has been connected.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+void XDp_TxClearTrainCache(XDp *InstancePtr)
+{
+	/* Verify arguments. */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(XDp_GetCoreType(InstancePtr) == XDP_TX);
+
+	memset(&InstancePtr->TxInstance.TrainCache, 0,
+					sizeof(XDp_TxTrainCache));
+}
+
 /******************************************************************************/
 /**
  * This function sets a software switch that signifies whether or not a redriver
@@ -2311,7 +2363,20 @@ static u32 XDp_RxInitialize(XDp *InstancePtr)
 static u32 XDp_TxRunTraining(XDp *InstancePtr)
 {
 	u32 Status;
+	u8 RateIdx;
+	u8 LaneIdx;
 	XDp_TxTrainingState TrainingState = XDP_TX_TS_CLOCK_RECOVERY;
+	XDp_TxTrainCache *Cache = &InstancePtr->TxInstance.TrainCache;
+	u8 *RxCaps = InstancePtr->TxInstance.RxConfig.DpcdRxCapsField;
+
+	/* Drop cached drive settings trained with a different RX device. */
+	if (InstancePtr->TxInstance.TrainCacheEn &&
+		memcmp(Cache->DpcdRxCapsField, RxCaps,
+				sizeof(Cache->DpcdRxCapsField))) {
+		memset(Cache, 0, sizeof(XDp_TxTrainCache));
+		memcpy(Cache->DpcdRxCapsField, RxCaps,
+				sizeof(Cache->DpcdRxCapsField));
+	}
 
 	while (1) {
 		switch (TrainingState) {
@@ -2340,6 +2405,15 @@ static u32 XDp_TxRunTraining(XDp *InstancePtr)
 				InstancePtr->TxInstance.LinkConfig.MaxLaneCount;
 			InstancePtr->TxInstance.LinkConfig.cr_done_cnt =
 				InstancePtr->TxInstance.LinkConfig.MaxLaneCount;
+			/* Remember the drive settings that trained. */
+			if (XDp_TxGetTrainCacheIndex(InstancePtr, &RateIdx,
+					&LaneIdx) == XST_SUCCESS) {
+				Cache->VsLevel[RateIdx][LaneIdx] =
+				InstancePtr->TxInstance.LinkConfig.VsLevel;
+				Cache->PeLevel[RateIdx][LaneIdx] =
+				InstancePtr->TxInstance.LinkConfig.PeLevel;
+				Cache->Valid[RateIdx][LaneIdx] = 1;
+			}
 			break;
 		}
 		else if (TrainingState == XDP_TX_TS_FAILURE) {
@@ -2352,6 +2426,12 @@ static u32 XDp_TxRunTraining(XDp *InstancePtr)
 
 		if ((TrainingState == XDP_TX_TS_ADJUST_LINK_RATE) ||
 			(TrainingState == XDP_TX_TS_ADJUST_LANE_COUNT)) {
+			/* Training failed at this link configuration. */
+			if (XDp_TxGetTrainCacheIndex(InstancePtr, &RateIdx,
+					&LaneIdx) == XST_SUCCESS) {
+				Cache->Valid[RateIdx][LaneIdx] = 0;
+			}
+
 			if (InstancePtr->TxInstance.TrainAdaptive == 0) {
 				return XST_FAILURE;
 			}
@@ -2385,6 +2465,61 @@ static u32 XDp_TxRunTraining(XDp *InstancePtr)
 	return XST_SUCCESS;
 }
 
+/******************************************************************************/
+/**
+ * This function returns the link training cache indices of the current link
+ * rate and lane count.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	RateIdx is a pointer to the returned link rate index.
+ * @param	LaneIdx is a pointer to the returned lane count index.
+ *
+ * @return
+ *		- XST_SUCCESS if the link configuration has a cache entry.
+ *		- XST_FAILURE otherwise.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u32 XDp_TxGetTrainCacheIndex(XDp *InstancePtr, u8 *RateIdx,
+							u8 *LaneIdx)
+{
+	XDp_TxLinkConfig *LinkConfig = &InstancePtr->TxInstance.LinkConfig;
+
+	switch (LinkConfig->LinkRate) {
+	case XDP_TX_LINK_BW_SET_162GBPS:
+		*RateIdx = 0;
+		break;
+	case XDP_TX_LINK_BW_SET_270GBPS:
+		*RateIdx = 1;
+		break;
+	case XDP_TX_LINK_BW_SET_540GBPS:
+		*RateIdx = 2;
+		break;
+	case XDP_TX_LINK_BW_SET_810GBPS:
+		*RateIdx = 3;
+		break;
+	default:
+		return XST_FAILURE;
+	}
+
+	switch (LinkConfig->LaneCount) {
+	case XDP_TX_LANE_COUNT_SET_1:
+		*LaneIdx = 0;
+		break;
+	case XDP_TX_LANE_COUNT_SET_2:
+		*LaneIdx = 1;
+		break;
+	case XDP_TX_LANE_COUNT_SET_4:
+		*LaneIdx = 2;
+		break;
+	default:
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
 /******************************************************************************/
 /**
  * This function runs the clock recovery sequence as part of link training. The
@@ -2424,6 +2559,8 @@ static XDp_TxTrainingState XDp_TxTrainingStateClockRecovery(XDp *InstancePtr)
 {
 	u32 Status;
 	u32 DelayUs;
+	u8 RateIdx;
+	u8 LaneIdx;
 	u8 PrevVsLevel = 0;
 	u8 SameVsLevelCount = 0;
 	XDp_TxLinkConfig *LinkConfig = &InstancePtr->TxInstance.LinkConfig;
@@ -2436,9 +2573,20 @@ static XDp_TxTrainingState XDp_TxTrainingStateClockRecovery(XDp *InstancePtr)
 
 	/* Transmit training pattern 1. */
 	/* Disable the scrambler. */
-	/* Start from minimal voltage swing and pre-emphasis levels. */
+	/* Start from minimal voltage swing and pre-emphasis levels, or from the
+	 * levels of the previous successful training at this link
+	 * configuration if the training cache is enabled. */
 	InstancePtr->TxInstance.LinkConfig.VsLevel = 0;
 	InstancePtr->TxInstance.LinkConfig.PeLevel = 0;
+	if (InstancePtr->TxInstance.TrainCacheEn &&
+		(XDp_TxGetTrainCacheIndex(InstancePtr, &RateIdx,
+					&LaneIdx) == XST_SUCCESS) &&
+		InstancePtr->TxInstance.TrainCache.Valid[RateIdx][LaneIdx]) {
+		LinkConfig->VsLevel =
+			InstancePtr->TxInstance.TrainCache.VsLevel[RateIdx][LaneIdx];
+		LinkConfig->PeLevel =
+			InstancePtr->TxInstance.TrainCache.PeLevel[RateIdx][LaneIdx];
+	}
 	Status = XDp_TxSetTrainingPattern(InstancePtr,
 					XDP_TX_TRAINING_PATTERN_SET_TP1);
 	if (Status != XST_SUCCESS) {
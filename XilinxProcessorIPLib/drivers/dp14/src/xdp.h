@@ -363,6 +363,9 @@
  *                     capability for receiving colorimetry information through
  *                     VSC SDP packets.
  * 7.4   rg   09/26/20 Added support yuv420 color format.
+ * 7.4   ag   10/15/26 Added link training drive level cache.
+ * 7.4   ag   10/15/26 Added XDp_TxUpdatePayloadStream to change the payload
+ *                     allocation of one MST stream.
  *
  * </pre>
  *
@@ -584,6 +587,19 @@ typedef struct {
 						with clock recovery. */
 } XDp_TxLinkConfig;
 
+/**
+ * This typedef contains the drive settings of previous successful link
+ * trainings with one RX device. The entries are indexed by link rate
+ * (1.62, 2.70, 5.40, 8.10 Gbps) and lane count (1, 2, 4).
+ */
+typedef struct {
+	u8 DpcdRxCapsField[16];	/**< Capabilities of the RX device the
+					entries were trained with. */
+	u8 Valid[4][3];		/**< Entry holds trained drive settings. */
+	u8 VsLevel[4][3];	/**< Trained voltage swing level. */
+	u8 PeLevel[4][3];	/**< Trained pre-emphasis/cursor level. */
+} XDp_TxTrainCache;
+
 /**
  * This typedef contains the main stream attributes which determine how the
  * video will be displayed.
@@ -674,6 +690,21 @@ typedef struct {
 	u8 MstStreamEnable;		/**< In MST mode, enables the
 						corresponding stream for this
 						MSA configuration. */
+	u8 AllocTs;			/**< Number of timeslots allocated
+						to the stream in the payload
+						ID tables, 0 if the stream is
+						not allocated. */
+	u16 AllocPbn;			/**< Payload bandwidth number
+						allocated to the stream in the
+						downstream devices. */
+	u16 AvailPbn;			/**< Available payload bandwidth
+						number of the path to the sink,
+						from the last
+						ENUM_PATH_RESOURCES reply. */
+	u16 FullPbn;			/**< Total payload bandwidth number
+						of the path to the sink, from
+						the last ENUM_PATH_RESOURCES
+						reply. 0 if unknown. */
 } XDp_TxMstStream;
 
 /**
@@ -1049,6 +1080,13 @@ typedef struct {
 	void *VsyncCallbackHandlerRef;		/**< A pointer to the user data
 							passed to the vertical sync
 							callback function. */
+	u8 TrainCacheEn;			/**< Link training starts from
+							the drive settings of
+							the previous successful
+							training at the same
+							link configuration. */
+	XDp_TxTrainCache TrainCache;		/**< Drive settings of previous
+							successful trainings. */
 } XDp_Tx;
 
 /**
@@ -1457,6 +1495,8 @@ u32 XDp_TxCfgMainLinkMax(XDp *InstancePtr);
 u32 XDp_TxEstablishLink(XDp *InstancePtr);
 u32 XDp_TxCheckLinkStatus(XDp *InstancePtr, u8 LaneCount);
 void XDp_TxEnableTrainAdaptive(XDp *InstancePtr, u8 Enable);
+void XDp_TxEnableTrainCache(XDp *InstancePtr, u8 Enable);
+void XDp_TxClearTrainCache(XDp *InstancePtr);
 void XDp_TxSetHasRedriverInPath(XDp *InstancePtr, u8 Set);
 void XDp_TxCfgTxVsOffset(XDp *InstancePtr, u8 Offset);
 void XDp_TxCfgTxVsLevel(XDp *InstancePtr, u8 Level, u8 TxLevel);
@@ -1594,6 +1634,7 @@ u32 XDp_TxRemoteIicWrite(XDp *InstancePtr, u8 LinkCountTotal,
 /* xdp_mst.c: Multi-stream transport (MST) functions related to MST stream
  * allocation. */
 u32 XDp_TxAllocatePayloadStreams(XDp *InstancePtr);
+u32 XDp_TxUpdatePayloadStream(XDp *InstancePtr, u8 Stream);
 u32 XDp_TxAllocatePayloadVcIdTable(XDp *InstancePtr, u8 VcId, u8 Ts,
 		u8 StartTs);
 u32 XDp_TxClearPayloadVcIdTable(XDp *InstancePtr);
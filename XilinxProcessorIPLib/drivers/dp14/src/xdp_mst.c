@@ -27,6 +27,10 @@
  * 5.2  aad  01/24/16 XDp_RxAllocatePayloadStream now adjusts to timeslot
  *			   rearragement
  * 6.0	tu   05/30/17 Initialized variable in XDp_RxDeviceInfoToRawData
+ * 7.4  ag   10/15/26 Added XDp_TxUpdatePayloadStream. The allocated timeslots
+ *		       and PBN of each stream and the bandwidth reported by
+ *		       ENUM_PATH_RESOURCES are kept in XDp_TxMstStream.
+ *		       XDp_TxSendSbMsgAllocatePayload accepts a PBN of 0.
  * </pre>
  *
 *******************************************************************************/
@@ -1356,6 +1360,8 @@ u32 XDp_TxSendEnumPathResourceRequest(XDp *InstancePtr)
 								   &AvailPbn, &FullPbn);
 			if (Status != XST_SUCCESS)
 				return Status;
+			MstStream->AvailPbn = AvailPbn;
+			MstStream->FullPbn = FullPbn;
 		}
 	}
 	return XST_SUCCESS;
@@ -1400,6 +1406,14 @@ u32 XDp_TxAllocatePayloadStreams(XDp *InstancePtr)
 	Xil_AssertNonvoid(XDp_GetCoreType(InstancePtr) == XDP_TX);
 	Msatopology = &InstancePtr->TxInstance.Topology;
 
+	for (StreamIndex = 0; StreamIndex < InstancePtr->TxInstance.NumOfMstStreams;
+			StreamIndex++) {
+		MstStream =
+			&InstancePtr->TxInstance.MstStreamConfig[StreamIndex];
+		MstStream->AllocTs = 0;
+		MstStream->AllocPbn = 0;
+	}
+
 	/* Allocate the payload table for each stream in both the DisplayPort TX
 	 * and RX device. */
 	for (StreamIndex = 0; StreamIndex < InstancePtr->TxInstance.NumOfMstStreams;
@@ -1434,7 +1448,212 @@ u32 XDp_TxAllocatePayloadStreams(XDp *InstancePtr)
 		if (Status != XST_SUCCESS) {
 			return Status;
 		}
+		MstStream->AllocTs = MsaConfig->TransferUnitSize;
+		MstStream->AllocPbn = MstStream->MstPbn;
+	}
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function will update the payload allocation of one stream after its
+ * bandwidth has changed, leaving the allocation of the other streams in the
+ * downstream devices as it is. Only one payload ID table update, one ACT
+ * event and one ALLOCATE_PAYLOAD sideband message are issued, where
+ * XDp_TxAllocatePayloadStreams issues them for every stream.
+ *
+ * The new number of timeslots is taken from the TransferUnitSize and the new
+ * bandwidth from the MstPbn of the stream. The timeslots of the streams that
+ * follow it are moved by the difference, the same way the RX device moves
+ * them in its payload ID table. A stream that is disabled is de-allocated.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	Stream is the stream number to update, from
+ *		XDP_TX_STREAM_ID1 to XDP_TX_STREAM_ID4.
+ *
+ * @return
+ *		- XST_SUCCESS if the payload ID tables were successfully updated
+ *		  with the new allocation.
+ *              - XST_DEVICE_NOT_FOUND if no RX device is connected.
+ *		- XST_ERROR_COUNT_MAX if either waiting for a reply, waiting for
+ *		  the payload ID table to be updated, or an AUX request timed
+ *		  out.
+ *		- XST_BUFFER_TOO_SMALL if there is not enough free timeslots in
+ *		  the payload ID table, or the stream needs more bandwidth than
+ *		  the path to its sink reported through ENUM_PATH_RESOURCES.
+ *		- XST_FAILURE otherwise - if an AUX read or write transaction
+ *		  failed, the header or body CRC of a sideband message did not
+ *		  match the calculated value, or the a reply was negative
+ *		  acknowledged (NACK'ed).
+ *
+ * @note	A stream that was not allocated yet is appended after the other
+ *		streams in the RX device. When a stream with a higher number is
+ *		already allocated, the payload ID tables are cleared and all
+ *		streams are allocated again with XDp_TxAllocatePayloadStreams.
+ *
+*******************************************************************************/
+u32 XDp_TxUpdatePayloadStream(XDp *InstancePtr, u8 Stream)
+{
+	u32 Status;
+	u8 AuxData[3];
+	u8 StreamIndex;
+	u8 Index;
+	u8 NewTs;
+	u8 UsedTs = 0;
+	u8 TimeoutCount = 0;
+	XDp_TxMstStream *MstStream;
+	XDp_TxMstStream *OtherStream;
+	XDp_TxMainStreamAttributes *MsaConfig;
+	XDp_TxMainStreamAttributes *OtherMsa;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(XDp_GetCoreType(InstancePtr) == XDP_TX);
+	Xil_AssertNonvoid((Stream == XDP_TX_STREAM_ID1) ||
+			(Stream == XDP_TX_STREAM_ID2) ||
+			(Stream == XDP_TX_STREAM_ID3) ||
+			(Stream == XDP_TX_STREAM_ID4));
+
+	MstStream = &InstancePtr->TxInstance.MstStreamConfig[Stream - 1];
+	MsaConfig = &InstancePtr->TxInstance.MsaConfig[Stream - 1];
+
+	if (XDp_TxMstStreamIsEnabled(InstancePtr, Stream)) {
+		NewTs = MsaConfig->TransferUnitSize;
+	}
+	else {
+		NewTs = 0;
+	}
+
+	/* Nothing to do if the allocation did not change. */
+	if ((NewTs == MstStream->AllocTs) && ((NewTs == 0) ||
+			(MstStream->MstPbn == MstStream->AllocPbn))) {
+		return XST_SUCCESS;
+	}
+
+	/* A new stream can only be appended behind the allocated ones. */
+	for (StreamIndex = Stream;
+			StreamIndex < InstancePtr->TxInstance.NumOfMstStreams;
+			StreamIndex++) {
+		if ((MstStream->AllocTs == 0) && (InstancePtr->TxInstance.
+				MstStreamConfig[StreamIndex].AllocTs != 0)) {
+			Status = XDp_TxClearPayloadVcIdTable(InstancePtr);
+			if (Status != XST_SUCCESS) {
+				return Status;
+			}
+			return XDp_TxAllocatePayloadStreams(InstancePtr);
+		}
+	}
+
+	/* Check that there are enough time slots and path bandwidth. */
+	for (StreamIndex = 0;
+			StreamIndex < InstancePtr->TxInstance.NumOfMstStreams;
+			StreamIndex++) {
+		if (StreamIndex != (Stream - 1)) {
+			UsedTs += InstancePtr->TxInstance.
+					MstStreamConfig[StreamIndex].AllocTs;
+		}
+	}
+	if ((UsedTs + NewTs) > (XDP_TX_NUM_PAYLOAD_TIMESLOTS - 1)) {
+		return XST_BUFFER_TOO_SMALL;
+	}
+	if ((NewTs != 0) && (MstStream->FullPbn != 0) &&
+			(MstStream->MstPbn > MstStream->FullPbn)) {
+		return XST_BUFFER_TOO_SMALL;
+	}
+
+	/* Move the streams that follow by the change in size. */
+	if (MstStream->AllocTs == 0) {
+		MsaConfig->StartTs = UsedTs + 1;
+	}
+	for (StreamIndex = Stream;
+			StreamIndex < InstancePtr->TxInstance.NumOfMstStreams;
+			StreamIndex++) {
+		OtherStream =
+			&InstancePtr->TxInstance.MstStreamConfig[StreamIndex];
+		if (OtherStream->AllocTs != 0) {
+			OtherMsa = &InstancePtr->TxInstance.MsaConfig[StreamIndex];
+			OtherMsa->StartTs = OtherMsa->StartTs + NewTs -
+							MstStream->AllocTs;
+		}
+	}
+	MstStream->AllocTs = NewTs;
+
+	/* Clear the VC payload ID table updated bit. */
+	AuxData[0] = 0x1;
+	Status = XDp_TxAuxWrite(InstancePtr,
+			XDP_DPCD_PAYLOAD_TABLE_UPDATE_STATUS, 1, AuxData);
+	if (Status != XST_SUCCESS) {
+		/* The AUX write transaction failed. */
+		return Status;
+	}
+
+	/* Rewrite the timeslots in TX, they take effect with the ACT event. */
+	for (Index = 1; Index < XDP_TX_NUM_PAYLOAD_TIMESLOTS; Index++) {
+		XDp_WriteReg(InstancePtr->Config.BaseAddr,
+			     (XDP_TX_VC_PAYLOAD_BUFFER_ADDR + (4 * Index)), 0);
+	}
+	for (StreamIndex = 0;
+			StreamIndex < InstancePtr->TxInstance.NumOfMstStreams;
+			StreamIndex++) {
+		OtherStream =
+			&InstancePtr->TxInstance.MstStreamConfig[StreamIndex];
+		OtherMsa = &InstancePtr->TxInstance.MsaConfig[StreamIndex];
+		for (Index = OtherMsa->StartTs; (OtherStream->AllocTs != 0) &&
+			(Index < (OtherMsa->StartTs + OtherStream->AllocTs));
+				Index++) {
+			XDp_WriteReg(InstancePtr->Config.BaseAddr,
+				     (XDP_TX_VC_PAYLOAD_BUFFER_ADDR + (4 * Index)),
+				     StreamIndex + XDP_TX_STREAM_ID1);
+		}
+	}
+
+	/* Change the timeslots of the VC in the sink. */
+	AuxData[0] = Stream;
+	AuxData[1] = MsaConfig->StartTs;
+	AuxData[2] = NewTs;
+	Status = XDp_TxAuxWrite(InstancePtr, XDP_DPCD_PAYLOAD_ALLOCATE_SET, 3,
+								AuxData);
+	if (Status != XST_SUCCESS) {
+		/* The AUX write transaction failed. */
+		return Status;
+	}
+
+	/* Wait for the VC table to be updated. */
+	do {
+		Status = XDp_TxAuxRead(InstancePtr,
+			XDP_DPCD_PAYLOAD_TABLE_UPDATE_STATUS, 1, AuxData);
+		if (Status != XST_SUCCESS) {
+			/* The AUX read transaction failed. */
+			return Status;
+		}
+		if ((AuxData[0] & 0x01) == 0x01) {
+			break;
+		}
+		/* Error out if timed out. */
+		if (TimeoutCount > XDP_TX_ALLOCATE_PAYLOAD_MAX_TIMEOUT_COUNT)
+			return XST_ERROR_COUNT_MAX;
+
+		TimeoutCount++;
+		XDp_WaitUs(InstancePtr, 1000);
+	} while (1);
+
+	/* Generate an ACT event. */
+	Status = XDp_TxSendActTrigger(InstancePtr);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	/* Update the bandwidth in the branch devices on the path, a PBN of 0
+	 * releases it. */
+	Status = XDp_TxSendSbMsgAllocatePayload(InstancePtr,
+			MstStream->LinkCountTotal, MstStream->RelativeAddress,
+			Stream, (NewTs != 0) ? MstStream->MstPbn : 0);
+	if (Status != XST_SUCCESS) {
+		return Status;
 	}
+	MstStream->AllocPbn = (NewTs != 0) ? MstStream->MstPbn : 0;
 
 	return XST_SUCCESS;
 }
@@ -1587,6 +1806,7 @@ u32 XDp_TxAllocatePayloadVcIdTable(XDp *InstancePtr, u8 VcId, u8 Ts, u8 StartTs)
 u32 XDp_TxClearPayloadVcIdTable(XDp *InstancePtr)
 {
 	u32 Status;
+	u8 StreamIndex;
 
 	/* Verify arguments. */
 	Xil_AssertNonvoid(InstancePtr != NULL);
@@ -1598,6 +1818,12 @@ u32 XDp_TxClearPayloadVcIdTable(XDp *InstancePtr)
 		return Status;
 	}
 
+	for (StreamIndex = 0; StreamIndex < InstancePtr->TxInstance.NumOfMstStreams;
+			StreamIndex++) {
+		InstancePtr->TxInstance.MstStreamConfig[StreamIndex].AllocTs = 0;
+		InstancePtr->TxInstance.MstStreamConfig[StreamIndex].AllocPbn = 0;
+	}
+
 	/* Send CLEAR_PAYLOAD_ID_TABLE request. */
 	Status = XDp_TxSendSbMsgClearPayloadIdTable(InstancePtr);
 
@@ -2191,7 +2417,8 @@ u32 XDp_TxSendSbMsgEnumPathResources(XDp *InstancePtr, u8 LinkCountTotal,
  * @param	VcId is the unique virtual channel ID to allocate into the
  *		payload ID tables.
  * @param	Pbn is the payload bandwidth number that determines how much
- *		bandwidth will be allocated for the virtual channel.
+ *		bandwidth will be allocated for the virtual channel. A Pbn of
+ *		0 de-allocates the virtual channel.
  *
  * @return
  *		- XST_SUCCESS if the reply to the sideband message was
@@ -2224,7 +2451,6 @@ u32 XDp_TxSendSbMsgAllocatePayload(XDp *InstancePtr, u8 LinkCountTotal,
 	Xil_AssertNonvoid(LinkCountTotal > 0);
 	Xil_AssertNonvoid((RelativeAddress != NULL) || (LinkCountTotal == 1));
 	Xil_AssertNonvoid(VcId > 0);
-	Xil_AssertNonvoid(Pbn > 0);
 
 	Msg.FragmentNum = 0;
 
@@ -363,6 +363,7 @@
  *                     capability for receiving colorimetry information through
  *                     VSC SDP packets.
  * 7.4   rg   09/26/20 Added support yuv420 color format.
+ * 7.4   ag   10/15/26 Added link training drive level cache.
  *
  * </pre>
  *
@@ -617,6 +618,19 @@ typedef struct {
 	u8 ExtendedCapPresent;	/**< Availability of Extended capabilities*/
 } XDp_TxLinkConfig;
 
+/**
+ * This typedef contains the drive settings of previous successful link
+ * trainings with one RX device. The entries are indexed by link rate
+ * (1.62, 2.70, 5.40, 8.10 Gbps) and lane count (1, 2, 4).
+ */
+typedef struct {
+	u8 DpcdRxCapsField[16];	/**< Capabilities of the RX device the
+					entries were trained with. */
+	u8 Valid[4][3];		/**< Entry holds trained drive settings. */
+	u8 VsLevel[4][3];	/**< Trained voltage swing level. */
+	u8 PeLevel[4][3];	/**< Trained pre-emphasis/cursor level. */
+} XDp_TxTrainCache;
+
 /**
  * This typedef contains the main stream attributes which determine how the
  * video will be displayed.
@@ -1092,6 +1106,13 @@ typedef struct {
 	void *PresetFfeAdjustCallbackRef;	/* A pointer to the user data passed to the
 						 * ffe preset adjust request callback function.
 						 */
+	u8 TrainCacheEn;			/**< Link training starts from
+							the drive settings of
+							the previous successful
+							training at the same
+							link configuration. */
+	XDp_TxTrainCache TrainCache;		/**< Drive settings of previous
+							successful trainings. */
 } XDp_Tx;
 
 /**
@@ -1500,6 +1521,8 @@ u32 XDp_TxCfgMainLinkMax(XDp *InstancePtr);
 u32 XDp_TxEstablishLink(XDp *InstancePtr);
 u32 XDp_TxCheckLinkStatus(XDp *InstancePtr, u8 LaneCount);
 void XDp_TxEnableTrainAdaptive(XDp *InstancePtr, u8 Enable);
+void XDp_TxEnableTrainCache(XDp *InstancePtr, u8 Enable);
+void XDp_TxClearTrainCache(XDp *InstancePtr);
 void XDp_TxSetHasRedriverInPath(XDp *InstancePtr, u8 Set);
 void XDp_TxCfgTxVsOffset(XDp *InstancePtr, u8 Offset);
 void XDp_TxCfgTxVsLevel(XDp *InstancePtr, u8 Level, u8 TxLevel);
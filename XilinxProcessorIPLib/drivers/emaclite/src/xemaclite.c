@@ -41,6 +41,11 @@
 * 4.2   sk   11/10/15 Used UINTPTR instead of u32 for Baseaddress CR# 867425.
 *                     Changed the prototypes of XEmacLite_GetReceiveDataLength,
 *                     XEmacLite_CfgInitialize API's.
+* 4.7   ag   10/15/26 Added XEmacLite_SendSg, XEmacLite_RecvSg and
+*                     XEmacLite_RecvLength. Moved the buffer selection of
+*                     XEmacLite_Send and XEmacLite_Recv to helpers shared with
+*                     them and bounded the received length to
+*                     XEL_MAX_FRAME_SIZE.
 *
 * </pre>
 ******************************************************************************/
@@ -138,6 +143,108 @@ int XEmacLite_CfgInitialize(XEmacLite *InstancePtr,
 	return XST_SUCCESS;
 }
 
+/*****************************************************************************/
+/**
+*
+* Find a free transmit buffer. The expected buffer is used if it is free,
+* otherwise the other buffer if ping-pong buffers are configured.
+*
+* @param	InstancePtr is a pointer to the XEmacLite instance.
+* @param	BaseAddressPtr is where the address of the free buffer is
+*		returned.
+*
+* @return
+*		- XST_SUCCESS if a buffer is free.
+*		- XST_FAILURE if buffer(s) was (were) full.
+*
+* @note		None.
+*
+******************************************************************************/
+static int XEmacLite_TxBufferGet(XEmacLite *InstancePtr,
+				 UINTPTR *BaseAddressPtr)
+{
+	UINTPTR BaseAddress;
+
+	/*
+	 * Determine the expected TX buffer address.
+	 */
+	BaseAddress = XEmacLite_NextTransmitAddr(InstancePtr);
+
+	if ((XEmacLite_GetTxStatus(BaseAddress) &
+			(XEL_TSR_XMIT_BUSY_MASK | XEL_TSR_XMIT_ACTIVE_MASK)) == 0) {
+		/*
+		 * Switch to next buffer if configured.
+		 */
+		if (InstancePtr->EmacLiteConfig.TxPingPong != 0) {
+			InstancePtr->NextTxBufferToUse ^= XEL_BUFFER_OFFSET;
+		}
+		*BaseAddressPtr = BaseAddress;
+		return XST_SUCCESS;
+	}
+
+	/*
+	 * If the expected buffer was full, try the other buffer if configured.
+	 * Do not switch to next buffer, there is a sync problem and the
+	 * expected buffer should not change.
+	 */
+	if (InstancePtr->EmacLiteConfig.TxPingPong != 0) {
+		BaseAddress ^= XEL_BUFFER_OFFSET;
+		if ((XEmacLite_GetTxStatus(BaseAddress) &
+			(XEL_TSR_XMIT_BUSY_MASK | XEL_TSR_XMIT_ACTIVE_MASK)) == 0) {
+			*BaseAddressPtr = BaseAddress;
+			return XST_SUCCESS;
+		}
+	}
+
+	return XST_FAILURE;
+}
+
+/*****************************************************************************/
+/**
+*
+* Start the transmission of a frame written to a transmit buffer.
+*
+* @param	InstancePtr is a pointer to the XEmacLite instance.
+* @param	BaseAddress is the address of the transmit buffer.
+* @param	ByteCount is the size, in bytes, of the frame.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XEmacLite_TxBufferStart(XEmacLite *InstancePtr,
+				    UINTPTR BaseAddress, unsigned ByteCount)
+{
+	u32 Register;
+	u32 IntrEnableStatus;
+
+	/*
+	 * The frame is in the buffer, now send it.
+	 */
+	XEmacLite_WriteReg(BaseAddress, XEL_TPLR_OFFSET,
+				(ByteCount & (XEL_TPLR_LENGTH_MASK_HI |
+				XEL_TPLR_LENGTH_MASK_LO)));
+
+	/*
+	 * Update the Tx Status Register to indicate that there is a
+	 * frame to send.
+	 * If the interrupt enable bit of Ping buffer(since this
+	 * controls both the buffers) is enabled then set the
+	 * XEL_TSR_XMIT_ACTIVE_MASK flag which is used by the interrupt
+	 * handler to call the callback function provided by the user
+	 * to indicate that the frame has been transmitted.
+	 */
+	Register = XEmacLite_GetTxStatus(BaseAddress);
+	Register |= XEL_TSR_XMIT_BUSY_MASK;
+	IntrEnableStatus = XEmacLite_GetTxStatus(
+				InstancePtr->EmacLiteConfig.BaseAddress);
+	if ((IntrEnableStatus & XEL_TSR_XMIT_IE_MASK) != 0) {
+		Register |= XEL_TSR_XMIT_ACTIVE_MASK;
+	}
+	XEmacLite_SetTxStatus(BaseAddress, Register);
+}
+
 /*****************************************************************************/
 /**
 *
@@ -163,22 +270,13 @@ int XEmacLite_CfgInitialize(XEmacLite *InstancePtr,
 ******************************************************************************/
 int XEmacLite_Send(XEmacLite *InstancePtr, u8 *FramePtr, unsigned ByteCount)
 {
-	u32 Register;
 	UINTPTR BaseAddress;
-	UINTPTR EmacBaseAddress;
-	u32 IntrEnableStatus;
 
 	/*
 	 * Verify that each of the inputs are valid.
 	 */
 	Xil_AssertNonvoid(InstancePtr != NULL);
 
-	/*
-	 * Determine the expected TX buffer address.
-	 */
-	BaseAddress = XEmacLite_NextTransmitAddr(InstancePtr);
-	EmacBaseAddress = InstancePtr->EmacLiteConfig.BaseAddress;
-
 	/*
 	 * Check the Length if it is too large, truncate it.
 	 * The maximum Tx packet size is
@@ -190,164 +288,102 @@ int XEmacLite_Send(XEmacLite *InstancePtr, u8 *FramePtr, unsigned ByteCount)
 	}
 
 	/*
-	 * Determine if the expected buffer address is empty.
+	 * Buffer(s) was(were) full, return failure to allow for polling usage.
 	 */
-	Register = XEmacLite_GetTxStatus(BaseAddress);
+	if (XEmacLite_TxBufferGet(InstancePtr, &BaseAddress) != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
 
 	/*
-	 * If the expected buffer is available, fill it with the provided data
-	 * Align if necessary.
+	 * Write the frame to the buffer.
 	 */
-	if ((Register & (XEL_TSR_XMIT_BUSY_MASK |
-			XEL_TSR_XMIT_ACTIVE_MASK)) == 0) {
+	XEmacLite_AlignedWrite(FramePtr, (UINTPTR *) BaseAddress, ByteCount);
 
-		/*
-		 * Switch to next buffer if configured.
-		 */
-		if (InstancePtr->EmacLiteConfig.TxPingPong != 0) {
-			InstancePtr->NextTxBufferToUse ^= XEL_BUFFER_OFFSET;
-		}
+	XEmacLite_TxBufferStart(InstancePtr, BaseAddress, ByteCount);
 
-		/*
-		 * Write the frame to the buffer.
-		 */
-		XEmacLite_AlignedWrite(FramePtr, (UINTPTR *) BaseAddress,
-				       ByteCount);
-
-
-		/*
-		 * The frame is in the buffer, now send it.
-		 */
-		XEmacLite_WriteReg(BaseAddress, XEL_TPLR_OFFSET,
-					(ByteCount & (XEL_TPLR_LENGTH_MASK_HI |
-					XEL_TPLR_LENGTH_MASK_LO)));
-
-		/*
-		 * Update the Tx Status Register to indicate that there is a
-		 * frame to send.
-		 * If the interrupt enable bit of Ping buffer(since this
-		 * controls both the buffers) is enabled then set the
-		 * XEL_TSR_XMIT_ACTIVE_MASK flag which is used by the interrupt
-		 * handler to call the callback function provided by the user
-		 * to indicate that the frame has been transmitted.
-		 */
-		Register = XEmacLite_GetTxStatus(BaseAddress);
-		Register |= XEL_TSR_XMIT_BUSY_MASK;
-		IntrEnableStatus = XEmacLite_GetTxStatus(EmacBaseAddress);
-		if ((IntrEnableStatus & XEL_TSR_XMIT_IE_MASK) != 0) {
-			Register |= XEL_TSR_XMIT_ACTIVE_MASK;
-		}
-		XEmacLite_SetTxStatus(BaseAddress, Register);
+	return XST_SUCCESS;
+}
 
-		return XST_SUCCESS;
-	}
+/*****************************************************************************/
+/**
+*
+* Send an Ethernet frame held in a list of segments. The segments are copied
+* one after the other into a transmit buffer, in 32-bit words where the
+* alignment of the segments allows it, without assembling the frame first.
+*
+* @param	InstancePtr is a pointer to the XEmacLite instance.
+* @param	SegPtr is a pointer to the segments of the frame.
+* @param	NumSeg is the number of segments.
+*
+* @return
+*		- XST_SUCCESS if data was transmitted.
+*		- XST_FAILURE if buffer(s) was (were) full and no valid data was
+*	 	transmitted.
+*
+* @note
+*
+* This function call is not blocking in nature, i.e. it will not wait until the
+* frame is transmitted. A frame longer than XEL_MAX_TX_FRAME_SIZE bytes is
+* truncated.
+*
+******************************************************************************/
+int XEmacLite_SendSg(XEmacLite *InstancePtr, XEmacLite_Segment *SegPtr,
+			unsigned NumSeg)
+{
+	UINTPTR BaseAddress;
+	unsigned ByteCount = 0;
+	unsigned Index;
 
 	/*
-	 * If the expected buffer was full, try the other buffer if configured.
+	 * Verify that each of the inputs are valid.
 	 */
-	if (InstancePtr->EmacLiteConfig.TxPingPong != 0) {
-
-		BaseAddress ^= XEL_BUFFER_OFFSET;
-
-		/*
-		 * Determine if the expected buffer address is empty.
-		 */
-		Register = XEmacLite_GetTxStatus(BaseAddress);
-
-		/*
-		 * If the next buffer is available, fill it with the provided
-		 * data.
-		 */
-		if ((Register & (XEL_TSR_XMIT_BUSY_MASK |
-				XEL_TSR_XMIT_ACTIVE_MASK)) == 0) {
-
-			/*
-			 * Write the frame to the buffer.
-			 */
-			XEmacLite_AlignedWrite(FramePtr, (UINTPTR *) BaseAddress,
-					       ByteCount);
-
-			/*
-			 * The frame is in the buffer, now send it.
-			 */
-			XEmacLite_WriteReg(BaseAddress, XEL_TPLR_OFFSET,
-					(ByteCount & (XEL_TPLR_LENGTH_MASK_HI |
-					   XEL_TPLR_LENGTH_MASK_LO)));
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(SegPtr != NULL);
+	Xil_AssertNonvoid(NumSeg > 0);
 
-			/*
-			 * Update the Tx Status Register to indicate that there
-			 * is a frame to send.
-			 * If the interrupt enable bit of Ping buffer(since this
-			 * controls both the buffers) is enabled then set the
-			 * XEL_TSR_XMIT_ACTIVE_MASK flag which is used by the
-			 * interrupt handler to call the callback function
-			 * provided by the user to indicate that the frame has
-			 * been transmitted.
-			 */
-			Register = XEmacLite_GetTxStatus(BaseAddress);
-			Register |= XEL_TSR_XMIT_BUSY_MASK;
-			IntrEnableStatus =
-					XEmacLite_GetTxStatus(EmacBaseAddress);
-			if ((IntrEnableStatus & XEL_TSR_XMIT_IE_MASK) != 0) {
-				Register |= XEL_TSR_XMIT_ACTIVE_MASK;
-			}
-			XEmacLite_SetTxStatus(BaseAddress, Register);
+	for (Index = 0; Index < NumSeg; Index++) {
+		ByteCount += SegPtr[Index].Length;
+	}
+	if (ByteCount > XEL_MAX_TX_FRAME_SIZE) {
+		ByteCount = XEL_MAX_TX_FRAME_SIZE;
+	}
 
-			/*
-			 * Do not switch to next buffer, there is a sync problem
-			 * and the expected buffer should not change.
-			 */
-			return XST_SUCCESS;
-		}
+	if (XEmacLite_TxBufferGet(InstancePtr, &BaseAddress) != XST_SUCCESS) {
+		return XST_FAILURE;
 	}
 
+	XEmacLite_GatherWrite(SegPtr, NumSeg, (UINTPTR *) BaseAddress,
+			      ByteCount);
 
-	/*
-	 * Buffer(s) was(were) full, return failure to allow for polling usage.
-	 */
-	return XST_FAILURE;
+	XEmacLite_TxBufferStart(InstancePtr, BaseAddress, ByteCount);
+
+	return XST_SUCCESS;
 }
 
 /*****************************************************************************/
 /**
 *
-* Receive a frame. Intended to be called from the interrupt context or
-* with a wrapper which waits for the receive frame to be available.
+* Find the receive buffer holding the next frame. The expected buffer is used
+* if it holds a frame, otherwise the other buffer if ping-pong buffers are
+* configured.
 *
 * @param	InstancePtr is a pointer to the XEmacLite instance.
-* @param 	FramePtr is a pointer to a buffer where the frame will
-*		be stored. The buffer must be at least XEL_MAX_FRAME_SIZE bytes.
-*		For optimal performance, a 32-bit aligned buffer should be used
-*		but it is not required, the function will align the data if
-*		necessary.
+* @param	BaseAddressPtr is where the address of the buffer is returned.
+* @param	Update is TRUE to move on to the next expected buffer, FALSE
+*		to only look for the frame.
 *
 * @return
+*		- XST_SUCCESS if a frame is available.
+*		- XST_FAILURE if no frame is available.
 *
-* The type/length field of the frame received.  When the type/length field
-* contains the type, XEL_MAX_FRAME_SIZE bytes will be copied out of the
-* buffer and it is up to the higher layers to sort out the frame.
-* Function returns 0 if there is no data waiting in the receive buffer or
-* the pong buffer if configured.
-*
-* @note
-*
-* This function call is not blocking in nature, i.e. it will not wait until
-* a frame arrives.
+* @note		None.
 *
 ******************************************************************************/
-u16 XEmacLite_Recv(XEmacLite *InstancePtr, u8 *FramePtr)
+static int XEmacLite_RxBufferGet(XEmacLite *InstancePtr,
+				 UINTPTR *BaseAddressPtr, int Update)
 {
-	u16 LengthType;
-	u16 Length;
-	u32 Register;
 	UINTPTR BaseAddress;
 
-	/*
-	 * Verify that each of the inputs are valid.
-	 */
-
-	Xil_AssertNonvoid(InstancePtr != NULL);
-
 	/*
 	 * Determine the expected buffer address.
 	 */
@@ -356,43 +392,60 @@ u16 XEmacLite_Recv(XEmacLite *InstancePtr, u8 *FramePtr)
 	/*
 	 * Verify which buffer has valid data.
 	 */
-	Register = XEmacLite_GetRxStatus(BaseAddress);
-
-	if ((Register & XEL_RSR_RECV_DONE_MASK) == XEL_RSR_RECV_DONE_MASK) {
+	if ((XEmacLite_GetRxStatus(BaseAddress) & XEL_RSR_RECV_DONE_MASK) ==
+			XEL_RSR_RECV_DONE_MASK) {
 
 		/*
 		 * The driver is in sync, update the next expected buffer if
 		 * configured.
 		 */
-
-		if (InstancePtr->EmacLiteConfig.RxPingPong != 0) {
+		if ((Update == TRUE) &&
+		    (InstancePtr->EmacLiteConfig.RxPingPong != 0)) {
 			InstancePtr->NextRxBufferToUse ^= XEL_BUFFER_OFFSET;
 		}
+		*BaseAddressPtr = BaseAddress;
+		return XST_SUCCESS;
 	}
-	else {
-		/*
-		 * The instance is out of sync, try other buffer if other
-		 * buffer is configured, return 0 otherwise. If the instance is
-		 * out of sync, do not update the 'NextRxBufferToUse' since it
-		 * will correct on subsequent calls.
-		 */
-		if (InstancePtr->EmacLiteConfig.RxPingPong != 0) {
-			BaseAddress ^= XEL_BUFFER_OFFSET;
-		}
-		else {
-			return 0;	/* No data was available */
-		}
 
-		/*
-		 * Verify that buffer has valid data.
-		 */
-		Register = XEmacLite_GetRxStatus(BaseAddress);
-		if ((Register & XEL_RSR_RECV_DONE_MASK) !=
+	/*
+	 * The instance is out of sync, try other buffer if other
+	 * buffer is configured. If the instance is out of sync, do not
+	 * update the 'NextRxBufferToUse' since it will correct on
+	 * subsequent calls.
+	 */
+	if (InstancePtr->EmacLiteConfig.RxPingPong != 0) {
+		BaseAddress ^= XEL_BUFFER_OFFSET;
+		if ((XEmacLite_GetRxStatus(BaseAddress) &
+				XEL_RSR_RECV_DONE_MASK) ==
 				XEL_RSR_RECV_DONE_MASK) {
-			return 0;	/* No data was available */
+			*BaseAddressPtr = BaseAddress;
+			return XST_SUCCESS;
 		}
 	}
 
+	return XST_FAILURE;	/* No data was available */
+}
+
+/*****************************************************************************/
+/**
+*
+* Return the length of the frame in a receive buffer, including the header
+* and the FCS.
+*
+* @param	BaseAddress is the address of the receive buffer.
+*
+* @return	The length of the frame. When the type/length field contains
+*		a type other than IP or ARP, XEL_MAX_FRAME_SIZE is returned and
+*		it is up to the higher layers to sort out the frame.
+*
+* @note		None.
+*
+******************************************************************************/
+static u16 XEmacLite_RxFrameLength(UINTPTR BaseAddress)
+{
+	u16 LengthType;
+	u16 Length;
+
 	/*
 	 * Get the length of the frame that arrived.
 	 */
@@ -451,6 +504,83 @@ u16 XEmacLite_Recv(XEmacLite *InstancePtr, u8 *FramePtr)
 		Length = LengthType + XEL_HEADER_SIZE + XEL_FCS_SIZE;
 	}
 
+	/*
+	 * A corrupted IP length must not overrun the buffer of the caller.
+	 */
+	if (Length > XEL_MAX_FRAME_SIZE) {
+		Length = XEL_MAX_FRAME_SIZE;
+	}
+
+	return Length;
+}
+
+/*****************************************************************************/
+/**
+*
+* Acknowledge the frame in a receive buffer, giving the buffer back to the
+* device.
+*
+* @param	BaseAddress is the address of the receive buffer.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XEmacLite_RxBufferAck(UINTPTR BaseAddress)
+{
+	u32 Register;
+
+	Register = XEmacLite_GetRxStatus(BaseAddress);
+	Register &= ~XEL_RSR_RECV_DONE_MASK;
+	XEmacLite_SetRxStatus(BaseAddress, Register);
+}
+
+/*****************************************************************************/
+/**
+*
+* Receive a frame. Intended to be called from the interrupt context or
+* with a wrapper which waits for the receive frame to be available.
+*
+* @param	InstancePtr is a pointer to the XEmacLite instance.
+* @param 	FramePtr is a pointer to a buffer where the frame will
+*		be stored. The buffer must be at least XEL_MAX_FRAME_SIZE bytes.
+*		For optimal performance, a 32-bit aligned buffer should be used
+*		but it is not required, the function will align the data if
+*		necessary.
+*
+* @return
+*
+* The type/length field of the frame received.  When the type/length field
+* contains the type, XEL_MAX_FRAME_SIZE bytes will be copied out of the
+* buffer and it is up to the higher layers to sort out the frame.
+* Function returns 0 if there is no data waiting in the receive buffer or
+* the pong buffer if configured.
+*
+* @note
+*
+* This function call is not blocking in nature, i.e. it will not wait until
+* a frame arrives.
+*
+******************************************************************************/
+u16 XEmacLite_Recv(XEmacLite *InstancePtr, u8 *FramePtr)
+{
+	u16 Length;
+	UINTPTR BaseAddress;
+
+	/*
+	 * Verify that each of the inputs are valid.
+	 */
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	if (XEmacLite_RxBufferGet(InstancePtr, &BaseAddress, TRUE) !=
+			XST_SUCCESS) {
+		return 0;	/* No data was available */
+	}
+
+	Length = XEmacLite_RxFrameLength(BaseAddress);
+
 	/*
 	 * Read from the EmacLite.
 	 */
@@ -460,9 +590,93 @@ u16 XEmacLite_Recv(XEmacLite *InstancePtr, u8 *FramePtr)
 	/*
 	 * Acknowledge the frame.
 	 */
-	Register = XEmacLite_GetRxStatus(BaseAddress);
-	Register &= ~XEL_RSR_RECV_DONE_MASK;
-	XEmacLite_SetRxStatus(BaseAddress, Register);
+	XEmacLite_RxBufferAck(BaseAddress);
+
+	return Length;
+}
+
+/*****************************************************************************/
+/**
+*
+* Return the length of the next received frame without reading it, so that
+* a buffer of the right size can be set up for XEmacLite_RecvSg.
+*
+* @param	InstancePtr is a pointer to the XEmacLite instance.
+*
+* @return	The length of the frame, including the header and the FCS, as
+*		returned by XEmacLite_Recv. 0 if there is no data waiting in the
+*		receive buffer or the pong buffer if configured.
+*
+* @note		None.
+*
+******************************************************************************/
+u16 XEmacLite_RecvLength(XEmacLite *InstancePtr)
+{
+	UINTPTR BaseAddress;
+
+	/*
+	 * Verify that each of the inputs are valid.
+	 */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	if (XEmacLite_RxBufferGet(InstancePtr, &BaseAddress, FALSE) !=
+			XST_SUCCESS) {
+		return 0;	/* No data was available */
+	}
+
+	return XEmacLite_RxFrameLength(BaseAddress);
+}
+
+/*****************************************************************************/
+/**
+*
+* Receive a frame into a list of segments. The frame is copied out of the
+* receive buffer into the segments one after the other, in 32-bit words where
+* the alignment of the segments allows it, and the buffer is given back to the
+* device.
+*
+* @param	InstancePtr is a pointer to the XEmacLite instance.
+* @param	SegPtr is a pointer to the segments to fill.
+* @param	NumSeg is the number of segments. When it is 0 the frame is
+*		dropped without being copied.
+*
+* @return	The length of the frame, including the header and the FCS, as
+*		returned by XEmacLite_RecvLength. If the segments hold fewer
+*		bytes, the rest of the frame is dropped. 0 if there is no data
+*		waiting in the receive buffer or the pong buffer if configured.
+*
+* @note
+*
+* This function call is not blocking in nature, i.e. it will not wait until
+* a frame arrives.
+*
+******************************************************************************/
+u16 XEmacLite_RecvSg(XEmacLite *InstancePtr, XEmacLite_Segment *SegPtr,
+			unsigned NumSeg)
+{
+	u16 Length;
+	UINTPTR BaseAddress;
+
+	/*
+	 * Verify that each of the inputs are valid.
+	 */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid((SegPtr != NULL) || (NumSeg == 0));
+
+	if (XEmacLite_RxBufferGet(InstancePtr, &BaseAddress, TRUE) !=
+			XST_SUCCESS) {
+		return 0;	/* No data was available */
+	}
+
+	Length = XEmacLite_RxFrameLength(BaseAddress);
+
+	if (NumSeg != 0) {
+		XEmacLite_ScatterRead((UINTPTR *) (BaseAddress +
+				      XEL_RXBUFF_OFFSET), SegPtr, NumSeg,
+				      Length);
+	}
+
+	XEmacLite_RxBufferAck(BaseAddress);
 
 	return Length;
 }
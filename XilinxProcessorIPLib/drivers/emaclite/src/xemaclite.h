@@ -93,6 +93,20 @@
 * For optimum performance, the user should provide a 32-bit aligned buffer
 * to the _Send and _Recv routines.
 *
+* <b>Scatter Gather Copies</b>
+*
+* XEmacLite_SendSg and XEmacLite_RecvSg take the frame as a list of segments,
+* such as the buffers of a protocol stack packet chain, and copy it straight
+* between the segments and the dual port buffers of the device, without an
+* intermediate frame buffer. Data is moved in 32-bit words whenever the
+* segment allows it, bytes are only used to join unaligned segment
+* boundaries. XEmacLite_RecvLength returns the length of the next received
+* frame before it is read, so that a buffer of the right size can be
+* allocated. With ping-pong buffers configured, the caller should keep
+* calling XEmacLite_SendSg while it succeeds and XEmacLite_RecvSg while
+* frames are available, so that one buffer is filled or emptied while the
+* device works on the other.
+*
 * <b>Asserts</b>
 *
 * Asserts are used within all Xilinx drivers to enforce constraints on argument
@@ -183,6 +197,9 @@
 *                     for CR-965028.
 *       ms   03/17/17 Modified text file in examples folder for doxygen
 *                     generation.
+* 4.7   ag   10/15/26 Added XEmacLite_SendSg, XEmacLite_RecvSg and
+*                     XEmacLite_RecvLength to copy frames straight between
+*                     segment lists and the ping-pong buffers in 32-bit words.
 *
 * </pre>
 *
@@ -238,6 +255,14 @@ typedef struct {
  */
 typedef void (*XEmacLite_Handler) (void *CallBackRef);
 
+/**
+ * One segment of a frame passed to XEmacLite_SendSg or XEmacLite_RecvSg.
+ */
+typedef struct {
+	void *DataPtr;		/**< Start of the segment, any alignment */
+	unsigned Length;	/**< Number of bytes in the segment */
+} XEmacLite_Segment;
+
 /**
  * The XEmacLite driver instance data. The user is required to allocate a
  * variable of this type for every EmacLite device in the system. A pointer
@@ -355,6 +380,11 @@ void XEmacLite_FlushReceive(XEmacLite *InstancePtr);
 
 int XEmacLite_Send(XEmacLite *InstancePtr, u8 *FramePtr, unsigned ByteCount);
 u16 XEmacLite_Recv(XEmacLite *InstancePtr, u8 *FramePtr);
+int XEmacLite_SendSg(XEmacLite *InstancePtr, XEmacLite_Segment *SegPtr,
+			unsigned NumSeg);
+u16 XEmacLite_RecvLength(XEmacLite *InstancePtr);
+u16 XEmacLite_RecvSg(XEmacLite *InstancePtr, XEmacLite_Segment *SegPtr,
+			unsigned NumSeg);
 
 int XEmacLite_PhyRead(XEmacLite *InstancePtr, u32 PhyAddress, u32 RegNum,
 			u16 *PhyDataPtr);
@@ -28,6 +28,7 @@
 *		      The macros changed in this file are
 *		      XEmacLite_mGetTxActive changed to XEmacLite_GetTxActive,
 *		      XEmacLite_mSetTxActive changed to XEmacLite_SetTxActive.
+* 4.7   ag   10/15/26 Added XEmacLite_GatherWrite and XEmacLite_ScatterRead.
 *
 * </pre>
 ******************************************************************************/
@@ -101,6 +102,10 @@ extern XEmacLite_Config XEmacLite_ConfigTable[];
 
 void XEmacLite_AlignedWrite(void *SrcPtr, UINTPTR *DestPtr, unsigned ByteCount);
 void XEmacLite_AlignedRead(UINTPTR *SrcPtr, void *DestPtr, unsigned ByteCount);
+void XEmacLite_GatherWrite(XEmacLite_Segment *SegPtr, unsigned NumSeg,
+			   UINTPTR *DestPtr, unsigned ByteCount);
+void XEmacLite_ScatterRead(UINTPTR *SrcPtr, XEmacLite_Segment *SegPtr,
+			   unsigned NumSeg, unsigned ByteCount);
 
 void StubHandler(void *CallBackRef);
 
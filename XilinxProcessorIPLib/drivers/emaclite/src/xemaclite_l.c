@@ -38,6 +38,7 @@
 *                     XEmacLite_AlignedWrite.
 * 4.6   rsp  08/08/20 Fix selftest failure on zynqmp. In XEmacLite_AlignedWrite
 *                     use correct pointer data type i.e u32 for To32Ptr.
+* 4.7   ag   10/15/26 Added XEmacLite_GatherWrite and XEmacLite_ScatterRead.
 * </pre>
 *
 ******************************************************************************/
@@ -486,4 +487,223 @@ void XEmacLite_AlignedRead(UINTPTR *SrcPtr, void *DestPtr, unsigned ByteCount)
 		*To8Ptr++ = *From8Ptr++;
 	}
 }
+
+/******************************************************************************/
+/**
+*
+* This function writes a frame held in a list of segments of any alignment
+* to a 32-bit aligned destination address range. Word aligned runs of a
+* segment are copied a word at a time, unaligned runs are assembled into
+* words first. The bytes of a word that straddles two segments are carried
+* over to the next segment, so that each word of the destination is written
+* once.
+*
+* @param	SegPtr is a pointer to the segments of the frame.
+* @param	NumSeg is the number of segments.
+* @param	DestPtr is a pointer to outgoing data of 32-bit alignment.
+* @param	ByteCount is the number of bytes to write. Segments past
+*		ByteCount are not read.
+*
+* @return	None.
+*
+* @note		The last word is padded with zeros.
+*
+******************************************************************************/
+void XEmacLite_GatherWrite(XEmacLite_Segment *SegPtr, unsigned NumSeg,
+			   UINTPTR *DestPtr, unsigned ByteCount)
+{
+	unsigned Index;
+	unsigned Length;
+	unsigned Fill = 0;
+	volatile u32 AlignBuffer = 0;
+	volatile u32 *To32Ptr;
+	u32 *From32Ptr;
+	u8 *To8Ptr;
+	u8 *From8Ptr;
+
+	To32Ptr = (volatile u32 *)DestPtr;
+	To8Ptr = (u8 *) &AlignBuffer;
+
+	for (Index = 0; (Index < NumSeg) && (ByteCount > 0); Index++) {
+		From8Ptr = (u8 *) SegPtr[Index].DataPtr;
+		Length = SegPtr[Index].Length;
+		if (Length > ByteCount) {
+			Length = ByteCount;
+		}
+		ByteCount -= Length;
+
+		/*
+		 * Complete the word carried over from the previous segment.
+		 */
+		while ((Fill != 0) && (Length > 0)) {
+			To8Ptr[Fill++] = *From8Ptr++;
+			Length--;
+			if (Fill == 4) {
+				*To32Ptr++ = AlignBuffer;
+				Fill = 0;
+			}
+		}
+
+		if ((((UINTPTR) From8Ptr) & 0x00000003) == 0) {
+			/*
+			 * Word aligned run, no correction needed.
+			 */
+			From32Ptr = (u32 *) From8Ptr;
+
+			while (Length > 15) {
+				To32Ptr[0] = From32Ptr[0];
+				To32Ptr[1] = From32Ptr[1];
+				To32Ptr[2] = From32Ptr[2];
+				To32Ptr[3] = From32Ptr[3];
+				To32Ptr += 4;
+				From32Ptr += 4;
+				Length -= 16;
+			}
+
+			while (Length > 3) {
+				*To32Ptr++ = *From32Ptr++;
+				Length -= 4;
+			}
+
+			From8Ptr = (u8 *) From32Ptr;
+		} else {
+			/*
+			 * Unaligned run, assemble each word in the temporary
+			 * buffer.
+			 */
+			while (Length > 3) {
+				To8Ptr[0] = From8Ptr[0];
+				To8Ptr[1] = From8Ptr[1];
+				To8Ptr[2] = From8Ptr[2];
+				To8Ptr[3] = From8Ptr[3];
+				*To32Ptr++ = AlignBuffer;
+				From8Ptr += 4;
+				Length -= 4;
+			}
+		}
+
+		/*
+		 * Keep the remaining bytes for the next segment.
+		 */
+		while (Length > 0) {
+			To8Ptr[Fill++] = *From8Ptr++;
+			Length--;
+		}
+	}
+
+	/*
+	 * Output the remaining data, padded with zeros.
+	 */
+	if (Fill != 0) {
+		while (Fill < 4) {
+			To8Ptr[Fill++] = 0;
+		}
+		*To32Ptr = AlignBuffer;
+	}
+}
+
+/******************************************************************************/
+/**
+*
+* This function reads a frame from a 32-bit aligned source address range
+* into a list of segments of any alignment. Each word of the source is read
+* once: the bytes of a word that straddles two segments are kept for the next
+* segment.
+*
+* @param	SrcPtr is a pointer to incoming data of 32-bit alignment.
+* @param	SegPtr is a pointer to the segments to fill.
+* @param	NumSeg is the number of segments.
+* @param	ByteCount is the number of bytes to read. If the segments
+*		hold fewer bytes, only that many are read.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XEmacLite_ScatterRead(UINTPTR *SrcPtr, XEmacLite_Segment *SegPtr,
+			   unsigned NumSeg, unsigned ByteCount)
+{
+	unsigned Index;
+	unsigned Length;
+	unsigned Left = 0;
+	volatile u32 AlignBuffer = 0;
+	volatile u32 *From32Ptr;
+	u32 *To32Ptr;
+	u8 *To8Ptr;
+	u8 *From8Ptr;
+
+	From32Ptr = (volatile u32 *)SrcPtr;
+	From8Ptr = (u8 *) &AlignBuffer;
+
+	for (Index = 0; (Index < NumSeg) && (ByteCount > 0); Index++) {
+		To8Ptr = (u8 *) SegPtr[Index].DataPtr;
+		Length = SegPtr[Index].Length;
+		if (Length > ByteCount) {
+			Length = ByteCount;
+		}
+		ByteCount -= Length;
+
+		/*
+		 * Use up the word left over from the previous segment.
+		 */
+		while ((Left != 0) && (Length > 0)) {
+			*To8Ptr++ = From8Ptr[4 - Left];
+			Left--;
+			Length--;
+		}
+
+		if ((((UINTPTR) To8Ptr) & 0x00000003) == 0) {
+			/*
+			 * Word aligned run, no correction needed.
+			 */
+			To32Ptr = (u32 *) To8Ptr;
+
+			while (Length > 15) {
+				To32Ptr[0] = From32Ptr[0];
+				To32Ptr[1] = From32Ptr[1];
+				To32Ptr[2] = From32Ptr[2];
+				To32Ptr[3] = From32Ptr[3];
+				To32Ptr += 4;
+				From32Ptr += 4;
+				Length -= 16;
+			}
+
+			while (Length > 3) {
+				*To32Ptr++ = *From32Ptr++;
+				Length -= 4;
+			}
+
+			To8Ptr = (u8 *) To32Ptr;
+		} else {
+			/*
+			 * Unaligned run, split each word through the temporary
+			 * buffer.
+			 */
+			while (Length > 3) {
+				AlignBuffer = *From32Ptr++;
+				To8Ptr[0] = From8Ptr[0];
+				To8Ptr[1] = From8Ptr[1];
+				To8Ptr[2] = From8Ptr[2];
+				To8Ptr[3] = From8Ptr[3];
+				To8Ptr += 4;
+				Length -= 4;
+			}
+		}
+
+		/*
+		 * Read the word holding the remaining data, the rest of it is
+		 * kept for the next segment.
+		 */
+		if (Length > 0) {
+			AlignBuffer = *From32Ptr++;
+			Left = 4;
+			while (Length > 0) {
+				*To8Ptr++ = From8Ptr[4 - Left];
+				Left--;
+				Length--;
+			}
+		}
+	}
+}
 /** @} */
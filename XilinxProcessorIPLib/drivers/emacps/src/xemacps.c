@@ -32,6 +32,10 @@
 * 3.8  mus  11/05/18 Support 64 bit DMA addresses for Microblaze-X platform.
 * 3.10 hk   05/16/19 Clear status registers properly in reset
 * 3.11 sd   02/14/20 Add clock support
+* 3.17 ag   10/14/26 Set the RX Q1 base in XEmacPs_SetQueuePtr() and
+*		     enable RX Q1 interrupts when their handler is set.
+* 3.17 ag   10/15/26 Register the performance counters of the TX and RX
+*		     BD rings in XEmacPs_CfgInitialize().
 *
 * </pre>
 ******************************************************************************/
@@ -102,8 +106,14 @@ LONG XEmacPs_CfgInitialize(XEmacPs *InstancePtr, XEmacPs_Config * CfgPtr,
 	/* Set callbacks to an initial stub routine */
 	InstancePtr->SendHandler = ((XEmacPs_Handler)((void*)XEmacPs_StubHandler));
 	InstancePtr->RecvHandler = ((XEmacPs_Handler)(void*)XEmacPs_StubHandler);
+	InstancePtr->RecvQ1Handler = ((XEmacPs_Handler)(void*)XEmacPs_StubHandler);
 	InstancePtr->ErrorHandler = ((XEmacPs_ErrHandler)(void*)XEmacPs_StubHandler);
 
+	XIL_PERF_STATS_REGISTER(&InstancePtr->TxBdRing.Stats, "emacps_tx",
+				EffectiveAddress);
+	XIL_PERF_STATS_REGISTER(&InstancePtr->RxBdRing.Stats, "emacps_rx",
+				EffectiveAddress);
+
 	/* Reset the hardware and set default options */
 	InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
 	XEmacPs_Reset(InstancePtr);
@@ -200,9 +210,16 @@ void XEmacPs_Start(XEmacPs *InstancePtr)
 	XEMACPS_IXR_RX_ERR_MASK | (u32)XEMACPS_IXR_FRAMERX_MASK |
 	(u32)XEMACPS_IXR_TXCOMPL_MASK));
 
-	/* Enable TX Q1 Interrupts */
-	if (InstancePtr->Version > 2)
+	/* Enable TX Q1 Interrupts, and RX Q1 interrupts once a handler for
+	 * them is set */
+	if (InstancePtr->Version > 2) {
 		XEmacPs_IntQ1Enable(InstancePtr, XEMACPS_INTQ1_IXR_ALL_MASK);
+		if (InstancePtr->RecvQ1Handler !=
+		    ((XEmacPs_Handler)(void*)XEmacPs_StubHandler)) {
+			XEmacPs_IntQ1Enable(InstancePtr,
+					    XEMACPS_INTQ1_IXR_RX_MASK);
+		}
+	}
 
 	/* Mark as started */
 	InstancePtr->IsStarted = XIL_COMPONENT_IS_STARTED;
@@ -465,10 +482,14 @@ void XEmacPs_SetQueuePtr(XEmacPs *InstancePtr, UINTPTR QPtr, u8 QueueNum,
 				(QPtr & ULONG64_LO_MASK));
 		}
 	}
-	 else {
+	 else if (Direction == XEMACPS_SEND) {
 		XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
 			XEMACPS_TXQ1BASE_OFFSET,
 			(QPtr & ULONG64_LO_MASK));
+	} else {
+		XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+			XEMACPS_RXQ1BASE_OFFSET,
+			(QPtr & ULONG64_LO_MASK));
 	}
 #ifdef __aarch64__
 	if (Direction == XEMACPS_SEND) {
@@ -309,6 +309,8 @@
  * 3.9   hk   01/23/19 Add RX watermark support
  * 3.11  sd   02/14/20 Add clock support
  * 3.13  nsk  12/14/20 Updated the tcl to not to use the instance names.
+ * 3.17  ag   10/14/26 Add receive priority queue 1 handler and screener
+ *		       APIs for steering received frames to queues.
  *
  * </pre>
  *
@@ -438,6 +440,29 @@ extern "C" {
 #define XEMACPS_HANDLER_DMASEND 1U
 #define XEMACPS_HANDLER_DMARECV 2U
 #define XEMACPS_HANDLER_ERROR   3U
+#define XEMACPS_HANDLER_DMARECV_Q1 4U
+/*@}*/
+
+/** @name Screener register types
+ *
+ * These constants are used as parameters to XEmacPs_GetNumScreeners()
+ * @{
+ */
+#define XEMACPS_SCREEN_T1        1U	/**< Type 1 screeners */
+#define XEMACPS_SCREEN_T2        2U	/**< Type 2 screeners */
+#define XEMACPS_SCREEN_ETHTYPE   3U	/**< Type 2 ethertype registers */
+#define XEMACPS_SCREEN_COMPARE   4U	/**< Type 2 compare registers */
+/*@}*/
+
+/** @name Screener compare offset bases
+ *
+ * Start of the offset of a type 2 compare, see XEmacPs_SetScreenCompare()
+ * @{
+ */
+#define XEMACPS_SCREEN_OFST_SOF     0U	/**< Start of frame */
+#define XEMACPS_SCREEN_OFST_ETYPE   1U	/**< After the ethertype */
+#define XEMACPS_SCREEN_OFST_IPHDR   2U	/**< After the IP header */
+#define XEMACPS_SCREEN_OFST_TCPUDP  3U	/**< After the TCP/UDP header */
 /*@}*/
 
 /* Constants to determine the configuration of the hardware device. They are
@@ -504,6 +529,32 @@ typedef void (*XEmacPs_ErrHandler) (void *CallBackRef, u8 Direction,
 
 /*@}*/
 
+/**
+ * Type 1 screener, steers IP frames to a queue by DS/TC field and/or UDP
+ * destination port. See XEmacPs_SetScreenT1().
+ */
+typedef struct {
+	u8 Queue;		/**< Queue of matching frames */
+	u8 DsTcEnable;		/**< Match the DS/TC field */
+	u8 DsTc;		/**< DS/TC field value */
+	u8 UdpPortEnable;	/**< Match the UDP destination port */
+	u16 UdpPort;		/**< UDP destination port */
+} XEmacPs_ScreenT1;
+
+/**
+ * Type 2 screener, steers frames to a queue by VLAN priority, ethertype
+ * and/or a compare register. See XEmacPs_SetScreenT2().
+ */
+typedef struct {
+	u8 Queue;		/**< Queue of matching frames */
+	u8 VlanPrioEnable;	/**< Match the VLAN priority */
+	u8 VlanPrio;		/**< VLAN priority */
+	u8 EthTypeEnable;	/**< Match an ethertype register */
+	u8 EthTypeIndex;	/**< Index of the ethertype register */
+	u8 CompareEnable;	/**< Match a compare register */
+	u8 CompareIndex;	/**< Index of the compare register */
+} XEmacPs_ScreenT2;
+
 /**
  * This typedef contains configuration information for a device.
  */
@@ -542,6 +593,8 @@ typedef struct XEmacPs_Instance {
 	XEmacPs_Handler RecvHandler;
 	void *SendRef;
 	void *RecvRef;
+	XEmacPs_Handler RecvQ1Handler;	/* Receive priority queue 1 */
+	void *RecvQ1Ref;
 
 	XEmacPs_ErrHandler ErrorHandler;
 	void *ErrorRef;
@@ -649,7 +702,8 @@ typedef struct XEmacPs_Instance {
 #define XEmacPs_IntQ1Enable(InstancePtr, Mask)                            \
 	XEmacPs_WriteReg((InstancePtr)->Config.BaseAddress,             \
 		XEMACPS_INTQ1_IER_OFFSET,                                \
-		((Mask) & XEMACPS_INTQ1_IXR_ALL_MASK));
+		((Mask) & (XEMACPS_INTQ1_IXR_ALL_MASK |                \
+		XEMACPS_INTQ1_IXR_RX_MASK)));
 
 /****************************************************************************/
 /**
@@ -670,7 +724,8 @@ typedef struct XEmacPs_Instance {
 #define XEmacPs_IntQ1Disable(InstancePtr, Mask)                           \
 	XEmacPs_WriteReg((InstancePtr)->Config.BaseAddress,             \
 		XEMACPS_INTQ1_IDR_OFFSET,                               \
-		((Mask) & XEMACPS_INTQ1_IXR_ALL_MASK));
+		((Mask) & (XEMACPS_INTQ1_IXR_ALL_MASK |                \
+		XEMACPS_INTQ1_IXR_RX_MASK)));
 
 /****************************************************************************/
 /**
@@ -835,6 +890,16 @@ LONG XEmacPs_SetTypeIdCheck(XEmacPs *InstancePtr, u32 Id_Check, u8 Index);
 LONG XEmacPs_SendPausePacket(XEmacPs *InstancePtr);
 void XEmacPs_DMABLengthUpdate(XEmacPs *InstancePtr, s32 BLength);
 
+u32 XEmacPs_GetNumScreeners(XEmacPs *InstancePtr, u32 Type);
+LONG XEmacPs_SetScreenT1(XEmacPs *InstancePtr, u8 Index,
+			 const XEmacPs_ScreenT1 *ScreenPtr);
+LONG XEmacPs_SetScreenT2(XEmacPs *InstancePtr, u8 Index,
+			 const XEmacPs_ScreenT2 *ScreenPtr);
+LONG XEmacPs_SetScreenEthType(XEmacPs *InstancePtr, u8 Index, u16 EthType);
+LONG XEmacPs_SetScreenCompare(XEmacPs *InstancePtr, u8 Index, u16 Value,
+			      u16 Mask, u8 Base, u8 Offset);
+void XEmacPs_ClearScreeners(XEmacPs *InstancePtr);
+
 #ifdef __cplusplus
 }
 #endif
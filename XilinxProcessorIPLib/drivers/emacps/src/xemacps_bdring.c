@@ -33,6 +33,9 @@
 * 3.0   kvn  02/13/15 Modified code for MISRA-C:2012 compliance.
 * 3.6   rb   09/08/17 Add XEmacPs_BdRingPtrReset() API to reset BD ring
 * 		      pointers
+* 3.17  ag   10/15/26 Count the frames, BDs and bytes returned by
+*		      XEmacPs_BdRingFromHwTx/Rx in the performance counters
+*		      of the ring.
 *
 * </pre>
 ******************************************************************************/
@@ -632,6 +635,10 @@ u32 XEmacPs_BdRingFromHwTx(XEmacPs_BdRing * RingPtr, u32 BdLimit,
 	u32 Sop = 0U;
 	u32 Status;
 	u32 BdLimitLoc = BdLimit;
+#ifdef XIL_PERF_STATS_ENABLE
+	u32 Bytes = 0U;
+	u32 PktBytes = 0U;
+#endif
 	CurBdPtr = RingPtr->HwHead;
 	BdCount = 0U;
 	BdPartialCount = 0U;
@@ -663,6 +670,9 @@ u32 XEmacPs_BdRingFromHwTx(XEmacPs_BdRing * RingPtr, u32 BdLimit,
 			if (Sop == 0x00000001U) {
 				BdCount++;
 				BdPartialCount++;
+#ifdef XIL_PERF_STATS_ENABLE
+				PktBytes += BdStr & XEMACPS_TXBUF_LEN_MASK;
+#endif
 			}
 
 			/* hardware has processed this BD so check the "last"
@@ -674,6 +684,10 @@ u32 XEmacPs_BdRingFromHwTx(XEmacPs_BdRing * RingPtr, u32 BdLimit,
 			    ((BdStr & XEMACPS_TXBUF_LAST_MASK)!=0x00000000U)) {
 				Sop = 0U;
 				BdPartialCount = 0U;
+#ifdef XIL_PERF_STATS_ENABLE
+				Bytes += PktBytes;
+				PktBytes = 0U;
+#endif
 			}
 
 			/* Reached the end of the work group */
@@ -696,6 +710,7 @@ u32 XEmacPs_BdRingFromHwTx(XEmacPs_BdRing * RingPtr, u32 BdLimit,
 		RingPtr->HwCnt -= BdCount;
 		RingPtr->PostCnt += BdCount;
 		XEMACPS_RING_SEEKAHEAD(RingPtr, RingPtr->HwHead, BdCount);
+		XIL_PERF_STATS_OPS(&RingPtr->Stats, BdCount, Bytes);
 		Status = (BdCount);
 		} else {
 			*BdSetPtr = NULL;
@@ -781,6 +796,9 @@ u32 XEmacPs_BdRingFromHwRx(XEmacPs_BdRing * RingPtr, u32 BdLimit,
 	u32 BdCount;
 	u32 BdPartialCount;
 	u32 Status;
+#ifdef XIL_PERF_STATS_ENABLE
+	u32 Bytes = 0U;
+#endif
 
 	CurBdPtr = RingPtr->HwHead;
 	BdCount = 0U;
@@ -818,6 +836,10 @@ u32 XEmacPs_BdRingFromHwRx(XEmacPs_BdRing * RingPtr, u32 BdLimit,
 			 */
 			if ((BdStr & XEMACPS_RXBUF_EOF_MASK)!=0x00000000U) {
 				BdPartialCount = 0U;
+#ifdef XIL_PERF_STATS_ENABLE
+				/* The last BD holds the frame length */
+				Bytes += BdStr & XEMACPS_RXBUF_LEN_MASK;
+#endif
 			} else {
 				BdPartialCount++;
 			}
@@ -843,6 +865,7 @@ u32 XEmacPs_BdRingFromHwRx(XEmacPs_BdRing * RingPtr, u32 BdLimit,
 			RingPtr->HwCnt -= BdCount;
 			RingPtr->PostCnt += BdCount;
 			XEMACPS_RING_SEEKAHEAD(RingPtr, RingPtr->HwHead, BdCount);
+			XIL_PERF_STATS_OPS(&RingPtr->Stats, BdCount, Bytes);
 			Status = (BdCount);
 		} else {
 			*BdSetPtr = NULL;
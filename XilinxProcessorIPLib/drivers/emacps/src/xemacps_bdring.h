@@ -23,6 +23,8 @@
 * 3.0   kvn  02/13/15 Modified code for MISRA-C:2012 compliance.
 * 3.6   rb   09/08/17 HwCnt variable (in XEmacPs_BdRing structure) is
 *		      changed to volatile.
+* 3.17  ag   10/15/26 Added the Stats performance counters of the ring,
+*		      enabled with XIL_PERF_STATS_ENABLE.
 *
 * </pre>
 *
@@ -35,6 +37,9 @@
 extern "C" {
 #endif
 
+/***************************** Include Files *********************************/
+
+#include "xil_perfstats.h"
 
 /**************************** Type Definitions *******************************/
 
@@ -62,6 +67,9 @@ typedef struct {
 	u32 FreeCnt;    /**< Number of allocatable BDs in the free group */
 	u32 PostCnt;    /**< Number of BDs in post-work group */
 	u32 AllCnt;     /**< Total Number of BDs for channel */
+#ifdef XIL_PERF_STATS_ENABLE
+	Xil_PerfStats Stats; /**< Performance counters */
+#endif
 } XEmacPs_BdRing;
 
 
@@ -26,6 +26,7 @@
  * 3.0   kvn  02/13/15 Modified code for MISRA-C:2012 compliance.
  * 3.0   hk   02/20/15 Added support for jumbo frames.
  * 3.2   hk   02/22/16 Added SGMII support for Zynq Ultrascale+ MPSoC.
+ * 3.17  ag   10/14/26 Added screener APIs to steer received frames to queues.
  * </pre>
  *****************************************************************************/
 
@@ -1130,4 +1131,267 @@ void XEmacPs_DMABLengthUpdate(XEmacPs *InstancePtr, s32 BLength)
 	XEmacPs_WriteReg(InstancePtr->Config.BaseAddress, XEMACPS_DMACR_OFFSET,
 																	Reg);
 }
+
+/*****************************************************************************/
+/**
+* Get the number of screener registers of a type the GEM is built with.
+*
+* @param InstancePtr is a pointer to the instance to be worked on.
+* @param Type is XEMACPS_SCREEN_T1, XEMACPS_SCREEN_T2, XEMACPS_SCREEN_ETHTYPE
+*        or XEMACPS_SCREEN_COMPARE.
+*
+* @return Number of registers, 0 if the GEM has no screeners.
+*
+******************************************************************************/
+u32 XEmacPs_GetNumScreeners(XEmacPs *InstancePtr, u32 Type)
+{
+	u32 Reg;
+	u32 Num;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+
+	if (InstancePtr->Version <= 2U) {
+		return 0U;
+	}
+
+	Reg = XEmacPs_ReadReg(InstancePtr->Config.BaseAddress,
+			      XEMACPS_DCFG8_OFFSET);
+
+	switch (Type) {
+		case XEMACPS_SCREEN_T1:
+			Num = (Reg & XEMACPS_DCFG8_T1SCR_MASK) >>
+				XEMACPS_DCFG8_T1SCR_SHIFT;
+			break;
+		case XEMACPS_SCREEN_T2:
+			Num = (Reg & XEMACPS_DCFG8_T2SCR_MASK) >>
+				XEMACPS_DCFG8_T2SCR_SHIFT;
+			break;
+		case XEMACPS_SCREEN_ETHTYPE:
+			Num = (Reg & XEMACPS_DCFG8_ETHT_MASK) >>
+				XEMACPS_DCFG8_ETHT_SHIFT;
+			break;
+		case XEMACPS_SCREEN_COMPARE:
+			Num = Reg & XEMACPS_DCFG8_CMP_MASK;
+			break;
+		default:
+			Num = 0U;
+			break;
+	}
+
+	return Num;
+}
+
+/*****************************************************************************/
+/**
+* Program a type 1 screener. Matching IP frames are received on the queue of
+* the screener. A screener with neither match enabled steers no frames.
+*
+* @param InstancePtr is a pointer to the instance to be worked on.
+* @param Index is the screener, 0 to XEmacPs_GetNumScreeners() - 1.
+* @param ScreenPtr is the screener setting.
+*
+* @return
+* - XST_SUCCESS if the screener is set
+* - XST_INVALID_PARAM if Index is out of range
+*
+******************************************************************************/
+LONG XEmacPs_SetScreenT1(XEmacPs *InstancePtr, u8 Index,
+			 const XEmacPs_ScreenT1 *ScreenPtr)
+{
+	u32 Reg;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(ScreenPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+
+	if ((u32)Index >= XEmacPs_GetNumScreeners(InstancePtr,
+						  XEMACPS_SCREEN_T1)) {
+		return (LONG)(XST_INVALID_PARAM);
+	}
+
+	Reg = (u32)ScreenPtr->Queue & XEMACPS_SCRT1_QUEUE_MASK;
+	Reg |= ((u32)ScreenPtr->DsTc << XEMACPS_SCRT1_DSTC_SHIFT) &
+		XEMACPS_SCRT1_DSTC_MASK;
+	Reg |= ((u32)ScreenPtr->UdpPort << XEMACPS_SCRT1_UDP_SHIFT) &
+		XEMACPS_SCRT1_UDP_MASK;
+	if (ScreenPtr->DsTcEnable != 0U) {
+		Reg |= XEMACPS_SCRT1_DSTCEN_MASK;
+	}
+	if (ScreenPtr->UdpPortEnable != 0U) {
+		Reg |= XEMACPS_SCRT1_UDPEN_MASK;
+	}
+
+	XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+			 XEMACPS_SCRT1_OFFSET + ((u32)Index * 4U), Reg);
+
+	return (LONG)(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* Program a type 2 screener. Frames matching all enabled fields are received
+* on the queue of the screener. A screener with no match enabled steers no
+* frames.
+*
+* @param InstancePtr is a pointer to the instance to be worked on.
+* @param Index is the screener, 0 to XEmacPs_GetNumScreeners() - 1.
+* @param ScreenPtr is the screener setting. The ethertype and compare
+*        registers it refers to are set with XEmacPs_SetScreenEthType() and
+*        XEmacPs_SetScreenCompare().
+*
+* @return
+* - XST_SUCCESS if the screener is set
+* - XST_INVALID_PARAM if Index, or a register index enabled in the setting,
+*   is out of range
+*
+******************************************************************************/
+LONG XEmacPs_SetScreenT2(XEmacPs *InstancePtr, u8 Index,
+			 const XEmacPs_ScreenT2 *ScreenPtr)
+{
+	u32 Reg;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(ScreenPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+
+	if (((u32)Index >= XEmacPs_GetNumScreeners(InstancePtr,
+						   XEMACPS_SCREEN_T2)) ||
+	    ((ScreenPtr->EthTypeEnable != 0U) &&
+	     ((u32)ScreenPtr->EthTypeIndex >=
+	      XEmacPs_GetNumScreeners(InstancePtr, XEMACPS_SCREEN_ETHTYPE))) ||
+	    ((ScreenPtr->CompareEnable != 0U) &&
+	     ((u32)ScreenPtr->CompareIndex >=
+	      XEmacPs_GetNumScreeners(InstancePtr, XEMACPS_SCREEN_COMPARE)))) {
+		return (LONG)(XST_INVALID_PARAM);
+	}
+
+	Reg = (u32)ScreenPtr->Queue & XEMACPS_SCRT2_QUEUE_MASK;
+	if (ScreenPtr->VlanPrioEnable != 0U) {
+		Reg |= XEMACPS_SCRT2_VLANEN_MASK |
+			(((u32)ScreenPtr->VlanPrio << XEMACPS_SCRT2_VLANPR_SHIFT) &
+			 XEMACPS_SCRT2_VLANPR_MASK);
+	}
+	if (ScreenPtr->EthTypeEnable != 0U) {
+		Reg |= XEMACPS_SCRT2_ETHTEN_MASK |
+			(((u32)ScreenPtr->EthTypeIndex << XEMACPS_SCRT2_ETHT_SHIFT) &
+			 XEMACPS_SCRT2_ETHT_MASK);
+	}
+	if (ScreenPtr->CompareEnable != 0U) {
+		Reg |= XEMACPS_SCRT2_CMPAEN_MASK |
+			(((u32)ScreenPtr->CompareIndex << XEMACPS_SCRT2_CMPA_SHIFT) &
+			 XEMACPS_SCRT2_CMPA_MASK);
+	}
+
+	XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+			 XEMACPS_SCRT2_OFFSET + ((u32)Index * 4U), Reg);
+
+	return (LONG)(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* Set an ethertype register of the type 2 screeners.
+*
+* @param InstancePtr is a pointer to the instance to be worked on.
+* @param Index is the register, 0 to XEmacPs_GetNumScreeners() - 1.
+* @param EthType is the ethertype to match.
+*
+* @return
+* - XST_SUCCESS if the register is set
+* - XST_INVALID_PARAM if Index is out of range
+*
+******************************************************************************/
+LONG XEmacPs_SetScreenEthType(XEmacPs *InstancePtr, u8 Index, u16 EthType)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+
+	if ((u32)Index >= XEmacPs_GetNumScreeners(InstancePtr,
+						  XEMACPS_SCREEN_ETHTYPE)) {
+		return (LONG)(XST_INVALID_PARAM);
+	}
+
+	XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+			 XEMACPS_SCRT2_ETHT_OFFSET + ((u32)Index * 4U),
+			 (u32)EthType);
+
+	return (LONG)(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* Set a compare register of the type 2 screeners. The compare matches when
+* the 16 bits at Offset bytes from Base, masked with Mask, equal Value.
+*
+* @param InstancePtr is a pointer to the instance to be worked on.
+* @param Index is the register, 0 to XEmacPs_GetNumScreeners() - 1.
+* @param Value is the value to match.
+* @param Mask selects the bits compared, 0xFFFF compares all.
+* @param Base is XEMACPS_SCREEN_OFST_SOF, XEMACPS_SCREEN_OFST_ETYPE,
+*        XEMACPS_SCREEN_OFST_IPHDR or XEMACPS_SCREEN_OFST_TCPUDP.
+* @param Offset is the byte offset from Base, 0 to 127.
+*
+* @return
+* - XST_SUCCESS if the register is set
+* - XST_INVALID_PARAM if Index is out of range
+*
+******************************************************************************/
+LONG XEmacPs_SetScreenCompare(XEmacPs *InstancePtr, u8 Index, u16 Value,
+			      u16 Mask, u8 Base, u8 Offset)
+{
+	UINTPTR RegAddr;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(Base <= XEMACPS_SCREEN_OFST_TCPUDP);
+	Xil_AssertNonvoid(Offset <= XEMACPS_SCRT2_CMPW1_OFST_MASK);
+
+	if ((u32)Index >= XEmacPs_GetNumScreeners(InstancePtr,
+						  XEMACPS_SCREEN_COMPARE)) {
+		return (LONG)(XST_INVALID_PARAM);
+	}
+
+	RegAddr = (UINTPTR)((u32)Index * 8U);
+	XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+			 XEMACPS_SCRT2_CMPW0_OFFSET + RegAddr,
+			 ((u32)Value << XEMACPS_SCRT2_CMPW0_VAL_SHIFT) |
+			 (u32)Mask);
+	XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+			 XEMACPS_SCRT2_CMPW1_OFFSET + RegAddr,
+			 ((u32)Base << XEMACPS_SCRT2_CMPW1_BASE_SHIFT) |
+			 (u32)Offset);
+
+	return (LONG)(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* Disable all type 1 and type 2 screeners, all frames are received on queue 0.
+*
+* @param InstancePtr is a pointer to the instance to be worked on.
+*
+* @return None
+*
+******************************************************************************/
+void XEmacPs_ClearScreeners(XEmacPs *InstancePtr)
+{
+	u32 Num;
+	u32 Index;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+
+	Num = XEmacPs_GetNumScreeners(InstancePtr, XEMACPS_SCREEN_T1);
+	for (Index = 0U; Index < Num; Index++) {
+		XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+				 XEMACPS_SCRT1_OFFSET + (Index * 4U), 0U);
+	}
+
+	Num = XEmacPs_GetNumScreeners(InstancePtr, XEMACPS_SCREEN_T2);
+	for (Index = 0U; Index < Num; Index++) {
+		XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+				 XEMACPS_SCRT2_OFFSET + (Index * 4U), 0U);
+	}
+}
 /** @} */
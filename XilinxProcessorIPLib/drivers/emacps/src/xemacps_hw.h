@@ -38,6 +38,7 @@
 * 3.8  hk   09/17/18 Fix PTP interrupt masks.
 * 3.9  hk   01/23/19 Add RX watermark support
 * 3.10 hk   05/16/19 Clear status registers properly in reset
+* 3.17 ag   10/14/26 Add RX Q1, screener and design config 8 definitions.
 * </pre>
 *
 ******************************************************************************/
@@ -281,6 +282,8 @@ typedef enum { MDC_DIV_8 = 0U, MDC_DIV_16, MDC_DIV_32, MDC_DIV_48,
 							reg */
 #define XEMACPS_RXQ1BASE_OFFSET	     0x00000480U /**< RX Q1 Base address
 							reg */
+#define XEMACPS_RXQ1BUFSIZE_OFFSET   0x000004A0U /**< RX Q1 buffer size
+							reg */
 #define XEMACPS_MSBBUF_TXQBASE_OFFSET  0x000004C8U /**< MSB Buffer TX Q Base
 							reg */
 #define XEMACPS_MSBBUF_RXQBASE_OFFSET  0x000004D4U /**< MSB Buffer RX Q Base
@@ -292,6 +295,17 @@ typedef enum { MDC_DIV_8 = 0U, MDC_DIV_16, MDC_DIV_32, MDC_DIV_48,
 #define XEMACPS_INTQ1_IMR_OFFSET     0x00000640U /**< Interrupt Q1 Mask
 							reg */
 
+#define XEMACPS_DCFG8_OFFSET         0x0000029CU /**< Design config 8 reg,
+							screener counts */
+#define XEMACPS_SCRT1_OFFSET         0x00000500U /**< Screener type 1 reg 0 */
+#define XEMACPS_SCRT2_OFFSET         0x00000540U /**< Screener type 2 reg 0 */
+#define XEMACPS_SCRT2_ETHT_OFFSET    0x000006E0U /**< Screener type 2
+							ethertype reg 0 */
+#define XEMACPS_SCRT2_CMPW0_OFFSET   0x00000700U /**< Screener type 2
+							compare 0 word 0 */
+#define XEMACPS_SCRT2_CMPW1_OFFSET   0x00000704U /**< Screener type 2
+							compare 0 word 1 */
+
 /* Define some bit positions for registers. */
 
 /** @name network control register bit definitions
@@ -449,6 +463,63 @@ typedef enum { MDC_DIV_8 = 0U, MDC_DIV_16, MDC_DIV_32, MDC_DIV_48,
 #define XEMACPS_INTQ1_IXR_ALL_MASK	((u32)XEMACPS_INTQ1SR_TXCOMPL_MASK | \
 					 (u32)XEMACPS_INTQ1SR_TXERR_MASK)
 
+#define XEMACPS_INTQ1SR_RXCOMPL_MASK	0x00000002U /**< Frame received OK */
+#define XEMACPS_INTQ1SR_RXUSED_MASK	0x00000004U /**< RX buffer used bit
+						     read */
+
+#define XEMACPS_INTQ1_IXR_RX_MASK	((u32)XEMACPS_INTQ1SR_RXCOMPL_MASK | \
+					 (u32)XEMACPS_INTQ1SR_RXUSED_MASK)
+
+/*@}*/
+
+/**
+ * @name Design config 8 register bit definitions
+ * @{
+ */
+#define XEMACPS_DCFG8_T1SCR_MASK	0xFF000000U /**< Type 1 screeners */
+#define XEMACPS_DCFG8_T1SCR_SHIFT	24U
+#define XEMACPS_DCFG8_T2SCR_MASK	0x00FF0000U /**< Type 2 screeners */
+#define XEMACPS_DCFG8_T2SCR_SHIFT	16U
+#define XEMACPS_DCFG8_ETHT_MASK		0x0000FF00U /**< Type 2 ethertype
+						     registers */
+#define XEMACPS_DCFG8_ETHT_SHIFT	8U
+#define XEMACPS_DCFG8_CMP_MASK		0x000000FFU /**< Type 2 compare
+						     registers */
+/*@}*/
+
+/**
+ * @name Screener type 1 register bit definitions
+ * @{
+ */
+#define XEMACPS_SCRT1_QUEUE_MASK	0x0000000FU /**< Queue of matches */
+#define XEMACPS_SCRT1_DSTC_MASK		0x00000FF0U /**< DS/TC field value */
+#define XEMACPS_SCRT1_DSTC_SHIFT	4U
+#define XEMACPS_SCRT1_UDP_MASK		0x0FFFF000U /**< UDP port value */
+#define XEMACPS_SCRT1_UDP_SHIFT		12U
+#define XEMACPS_SCRT1_DSTCEN_MASK	0x10000000U /**< Match DS/TC field */
+#define XEMACPS_SCRT1_UDPEN_MASK	0x20000000U /**< Match UDP port */
+/*@}*/
+
+/**
+ * @name Screener type 2 register bit definitions
+ * @{
+ */
+#define XEMACPS_SCRT2_QUEUE_MASK	0x0000000FU /**< Queue of matches */
+#define XEMACPS_SCRT2_VLANPR_MASK	0x00000070U /**< VLAN priority */
+#define XEMACPS_SCRT2_VLANPR_SHIFT	4U
+#define XEMACPS_SCRT2_VLANEN_MASK	0x00000100U /**< Match VLAN priority */
+#define XEMACPS_SCRT2_ETHT_MASK		0x00000E00U /**< Ethertype reg index */
+#define XEMACPS_SCRT2_ETHT_SHIFT	9U
+#define XEMACPS_SCRT2_ETHTEN_MASK	0x00001000U /**< Match ethertype */
+#define XEMACPS_SCRT2_CMPA_MASK		0x0003E000U /**< Compare A reg index */
+#define XEMACPS_SCRT2_CMPA_SHIFT	13U
+#define XEMACPS_SCRT2_CMPAEN_MASK	0x00040000U /**< Match compare A */
+
+#define XEMACPS_SCRT2_CMPW0_MASK_MASK	0x0000FFFFU /**< Compare bit mask */
+#define XEMACPS_SCRT2_CMPW0_VAL_SHIFT	16U /**< Compare value */
+#define XEMACPS_SCRT2_CMPW1_OFST_MASK	0x0000007FU /**< Compare byte offset */
+#define XEMACPS_SCRT2_CMPW1_BASE_SHIFT	7U /**< Base of the offset */
+
 /*@}*/
 
 /**
@@ -33,12 +33,17 @@
 * 3.0   kvn  02/13/15 Modified code for MISRA-C:2012 compliance.
 * 3.1   hk   07/27/15 Do not call error handler with '0' error code when
 *                     there is no error. CR# 869403
+* 3.17  ag   10/14/26 Record interrupt handler entry and exit with XIL_TRACE.
+* 3.17  ag   10/14/26 Dispatch receive priority queue 1 interrupts.
+* 3.17  ag   10/15/26 Count interrupts and errors in the performance
+*		      counters of the BD rings.
 * </pre>
 ******************************************************************************/
 
 /***************************** Include Files *********************************/
 
 #include "xemacps.h"
+#include "xil_trace.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -61,8 +66,8 @@
  *
  * @param InstancePtr is a pointer to the instance to be worked on.
  * @param HandlerType indicates what interrupt handler type is.
- *        XEMACPS_HANDLER_DMASEND, XEMACPS_HANDLER_DMARECV and
- *        XEMACPS_HANDLER_ERROR.
+ *        XEMACPS_HANDLER_DMASEND, XEMACPS_HANDLER_DMARECV,
+ *        XEMACPS_HANDLER_DMARECV_Q1 and XEMACPS_HANDLER_ERROR.
  * @param FuncPointer is the pointer to the callback function
  * @param CallBackRef is the upper layer callback reference passed back when
  *        when the callback function is invoked.
@@ -95,6 +100,11 @@ LONG XEmacPs_SetHandler(XEmacPs *InstancePtr, u32 HandlerType,
 		InstancePtr->RecvHandler = ((XEmacPs_Handler)(void *)FuncPointer);
 		InstancePtr->RecvRef = CallBackRef;
 		break;
+	case XEMACPS_HANDLER_DMARECV_Q1:
+		Status = (LONG)(XST_SUCCESS);
+		InstancePtr->RecvQ1Handler = ((XEmacPs_Handler)(void *)FuncPointer);
+		InstancePtr->RecvQ1Ref = CallBackRef;
+		break;
 	case XEMACPS_HANDLER_ERROR:
 		Status = (LONG)(XST_SUCCESS);
 		InstancePtr->ErrorHandler = ((XEmacPs_ErrHandler)(void *)FuncPointer);
@@ -137,6 +147,8 @@ void XEmacPs_IntrHandler(void *XEmacPsPtr)
 	 */
 	RegISR = XEmacPs_ReadReg(InstancePtr->Config.BaseAddress,
 				   XEMACPS_ISR_OFFSET);
+	XIL_TRACE(XIL_TRACE_EVT_EMACPS_IRQ_ENTRY,
+		  InstancePtr->Config.BaseAddress, RegISR);
 
 	/* Read Transmit Q1 ISR */
 
@@ -148,6 +160,20 @@ void XEmacPs_IntrHandler(void *XEmacPsPtr)
 	XEmacPs_WriteReg(InstancePtr->Config.BaseAddress, XEMACPS_ISR_OFFSET,
 			   RegISR);
 
+#ifdef XIL_PERF_STATS_ENABLE
+	if (((RegISR & (XEMACPS_IXR_FRAMERX_MASK | XEMACPS_IXR_RX_ERR_MASK)) !=
+	     0x00000000U) ||
+	    ((RegQ1ISR & XEMACPS_INTQ1_IXR_RX_MASK) != 0x00000000U)) {
+		XIL_PERF_STATS_INTR(&InstancePtr->RxBdRing.Stats);
+	}
+	if (((RegISR & (XEMACPS_IXR_TXCOMPL_MASK | XEMACPS_IXR_TX_ERR_MASK)) !=
+	     0x00000000U) ||
+	    ((RegQ1ISR & (XEMACPS_INTQ1SR_TXCOMPL_MASK |
+			  XEMACPS_INTQ1SR_TXERR_MASK)) != 0x00000000U)) {
+		XIL_PERF_STATS_INTR(&InstancePtr->TxBdRing.Stats);
+	}
+#endif
+
 	/* Receive complete interrupt */
 	if ((RegISR & XEMACPS_IXR_FRAMERX_MASK) != 0x00000000U) {
 		/* Clear RX status register RX complete indication but preserve
@@ -159,6 +185,20 @@ void XEmacPs_IntrHandler(void *XEmacPsPtr)
 		InstancePtr->RecvHandler(InstancePtr->RecvRef);
 	}
 
+	/* Receive Q1 complete or buffer not available interrupt, frames are
+	 * only received on Q1 when screeners steer them there */
+	if ((InstancePtr->Version > 2) &&
+			((RegQ1ISR & XEMACPS_INTQ1_IXR_RX_MASK) != 0x00000000U)) {
+		XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+				   XEMACPS_INTQ1_STS_OFFSET,
+				   (RegQ1ISR & XEMACPS_INTQ1_IXR_RX_MASK));
+		XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
+				   XEMACPS_RXSR_OFFSET,
+				   ((u32)XEMACPS_RXSR_FRAMERX_MASK |
+				   (u32)XEMACPS_RXSR_BUFFNA_MASK));
+		InstancePtr->RecvQ1Handler(InstancePtr->RecvQ1Ref);
+	}
+
 	/* Transmit Q1 complete interrupt */
 	if ((InstancePtr->Version > 2) &&
 			((RegQ1ISR & XEMACPS_INTQ1SR_TXCOMPL_MASK) != 0x00000000U)) {
@@ -206,6 +246,7 @@ void XEmacPs_IntrHandler(void *XEmacPsPtr)
 		}
 
 		if(RegSR != 0) {
+			XIL_PERF_STATS_ERROR(&InstancePtr->RxBdRing.Stats);
 			InstancePtr->ErrorHandler(InstancePtr->ErrorRef,
 						XEMACPS_RECV, RegSR);
 		}
@@ -222,6 +263,7 @@ void XEmacPs_IntrHandler(void *XEmacPsPtr)
 			/* Clear Interrupt Q1 status register */
 			XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
 				   XEMACPS_INTQ1_STS_OFFSET, RegQ1ISR);
+			XIL_PERF_STATS_ERROR(&InstancePtr->TxBdRing.Stats);
 			InstancePtr->ErrorHandler(InstancePtr->ErrorRef, XEMACPS_SEND,
 					  RegQ1ISR);
 	   }
@@ -234,9 +276,12 @@ void XEmacPs_IntrHandler(void *XEmacPsPtr)
 					  XEMACPS_TXSR_OFFSET);
 		XEmacPs_WriteReg(InstancePtr->Config.BaseAddress,
 				   XEMACPS_TXSR_OFFSET, RegSR);
+		XIL_PERF_STATS_ERROR(&InstancePtr->TxBdRing.Stats);
 		InstancePtr->ErrorHandler(InstancePtr->ErrorRef, XEMACPS_SEND,
 					  RegSR);
 	}
 
+	XIL_TRACE(XIL_TRACE_EVT_EMACPS_IRQ_EXIT,
+		  InstancePtr->Config.BaseAddress, 0U);
 }
 /** @} */
@@ -98,6 +98,8 @@
 * 4.6	sne  08/11/19 Fixed compilation error of armcc compiler.
 * 4.7   sne  08/28/20 Modify Makefile to support parallel make execution.
 * 4.8	sne  02/10/21 Fixed doxygen warnings.
+* 4.9	ag   10/15/26 Added XGpio_DiscreteWriteMasked() and
+*		      XGpio_DiscreteReadAll().
 *
 * </pre>
 *****************************************************************************/
@@ -170,6 +172,9 @@ void XGpio_DiscreteWrite(XGpio *InstancePtr, unsigned Channel, u32 Mask);
  */
 void XGpio_DiscreteSet(XGpio *InstancePtr, unsigned Channel, u32 Mask);
 void XGpio_DiscreteClear(XGpio *InstancePtr, unsigned Channel, u32 Mask);
+void XGpio_DiscreteWriteMasked(XGpio *InstancePtr, unsigned Channel, u32 Mask,
+			       u32 Data);
+void XGpio_DiscreteReadAll(XGpio *InstancePtr, u32 *Data);
 
 /*
  * API Functions implemented in xgpio_selftest.c
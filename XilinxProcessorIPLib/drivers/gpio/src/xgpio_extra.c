@@ -30,6 +30,8 @@
 * 3.00a sv   11/21/09 Updated to use HAL Processor APIs. Renamed the macros
 *		      XGpio_mWriteReg to XGpio_WriteReg, and XGpio_mReadReg
 *		      to XGpio_ReadReg.
+* 4.9   ag   10/15/26 Added XGpio_DiscreteWriteMasked() and
+*		      XGpio_DiscreteReadAll().
 * </pre>
 *
 *****************************************************************************/
@@ -136,4 +138,75 @@ void XGpio_DiscreteClear(XGpio * InstancePtr, unsigned Channel, u32 Mask)
 	Current &= ~Mask;
 	XGpio_WriteReg(InstancePtr->BaseAddress, DataOffset, Current);
 }
+
+/****************************************************************************/
+/**
+* Set output discrete(s) selected by a mask to the given values for the
+* specified GPIO channel. This sets and clears bits with a single update of
+* the data register.
+*
+* @param	InstancePtr is a pointer to an XGpio instance to be worked on.
+* @param	Channel contains the channel of the GPIO (1 or 2) to operate on.
+* @param	Mask is the set of bits that will be written in the discrete
+*		data register. All other bits in the data register are
+*		unaffected.
+* @param	Data contains the values of the bits selected by Mask.
+*
+* @return	None.
+*
+* @note
+*
+* The hardware has no masked write register, so the data register is read,
+* merged and written back. The caller must serialize writes to the channel
+* from different contexts.
+*
+* This API can only be used if the GPIO_IO ports in the IP are used for
+* connecting to the external output ports.
+*
+*****************************************************************************/
+void XGpio_DiscreteWriteMasked(XGpio * InstancePtr, unsigned Channel, u32 Mask,
+			       u32 Data)
+{
+	u32 Current;
+	unsigned DataOffset;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid((Channel == 1) ||
+		     ((Channel == 2) && (InstancePtr->IsDual == TRUE)));
+
+	/* Calculate the offset to the data register of the GPIO  */
+	DataOffset = ((Channel - 1) * XGPIO_CHAN_OFFSET) + XGPIO_DATA_OFFSET;
+
+	Current = XGpio_ReadReg(InstancePtr->BaseAddress, DataOffset);
+	Current = (Current & ~Mask) | (Data & Mask);
+	XGpio_WriteReg(InstancePtr->BaseAddress, DataOffset, Current);
+}
+
+/****************************************************************************/
+/**
+* Read the discrete data of all the channels of the GPIO in one call.
+*
+* @param	InstancePtr is a pointer to an XGpio instance to be worked on.
+* @param	Data is an array of two entries. Data[0] is set to the data of
+*		channel 1 and, for dual channel hardware, Data[1] to the data
+*		of channel 2.
+*
+* @return	None.
+*
+* @note		The channels are read back to back.
+*
+*****************************************************************************/
+void XGpio_DiscreteReadAll(XGpio * InstancePtr, u32 *Data)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid(Data != NULL);
+
+	Data[0] = XGpio_ReadReg(InstancePtr->BaseAddress, XGPIO_DATA_OFFSET);
+	if (InstancePtr->IsDual == TRUE) {
+		Data[1] = XGpio_ReadReg(InstancePtr->BaseAddress,
+					XGPIO_CHAN_OFFSET + XGPIO_DATA_OFFSET);
+	}
+}
 /** @} */
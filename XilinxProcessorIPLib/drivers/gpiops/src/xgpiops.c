@@ -34,6 +34,8 @@
 *                     as Pointer to const,Casting operation to a pointer,
 *                     Literal value requires a U suffix.
 * 3.5   sne  03/13/19 Added Versal support.
+* 3.10	ag   10/15/26 Added XGpioPs_WriteMasked(), XGpioPs_ReadBanks() and
+*		      XGpioPs_WriteBanksMasked().
 * </pre>
 *
 ******************************************************************************/
@@ -53,6 +55,9 @@
 /************************** Function Prototypes ******************************/
 
 void StubHandler(void *CallBackRef, u32 Bank, u32 Status); /**< Stub handler */
+static u32 XGpioPs_IsBankValid(const XGpioPs *InstancePtr, u8 Bank);
+static void XGpioPs_WriteMaskedReg(UINTPTR BaseAddr, u8 Bank, u32 Mask,
+				   u32 Data);
 
 /*****************************************************************************/
 /**
@@ -90,6 +95,7 @@ s32 XGpioPs_CfgInitialize(XGpioPs *InstancePtr, const XGpioPs_Config *ConfigPtr,
 	InstancePtr->GpioConfig.BaseAddr = EffectiveAddr;
 	InstancePtr->GpioConfig.DeviceId = ConfigPtr->DeviceId;
 	InstancePtr->Handler = (XGpioPs_Handler)StubHandler;
+	InstancePtr->EventFifo = NULL;
 	InstancePtr->Platform = XGetPlatform_Info();
 
 	/* Initialize the Bank data based on platform */
@@ -658,6 +664,181 @@ u32 XGpioPs_GetOutputEnablePin(const XGpioPs *InstancePtr, u32 Pin)
 				 XGPIOPS_OUTEN_OFFSET) >> (u32)PinNumber) & (u32)1;
 }
 
+/****************************************************************************/
+/**
+*
+* Check whether a bank exists in the GPIO device.
+*
+* @param	InstancePtr is a pointer to the XGpioPs instance.
+* @param	Bank is the bank number.
+*
+* @return	TRUE if the bank exists, FALSE otherwise.
+*
+* @note		None.
+*
+*****************************************************************************/
+static u32 XGpioPs_IsBankValid(const XGpioPs *InstancePtr, u8 Bank)
+{
+	u32 Valid = (u32)FALSE;
+
+	if (Bank < InstancePtr->MaxBanks) {
+		Valid = (u32)TRUE;
+#ifdef versal
+		if (InstancePtr->PmcGpio == (u32)TRUE) {
+			if (Bank == XGPIOPS_TWO) {
+				Valid = (u32)FALSE;
+			}
+		} else {
+			if ((Bank == XGPIOPS_ONE) || (Bank == XGPIOPS_TWO)) {
+				Valid = (u32)FALSE;
+			}
+		}
+#endif
+	}
+
+	return Valid;
+}
+
+/****************************************************************************/
+/**
+*
+* Write the pins of a bank selected by a mask through the Mask and Data
+* registers. Each register covers 16 pins, with a mask bit of 0 in the upper
+* half selecting a pin for the write. A register is not written when none of
+* its pins is selected.
+*
+* @param	BaseAddr is the base address of the GPIO device.
+* @param	Bank is the bank number.
+* @param	Mask selects the pins to write.
+* @param	Data contains the values of the selected pins.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void XGpioPs_WriteMaskedReg(UINTPTR BaseAddr, u8 Bank, u32 Mask,
+				   u32 Data)
+{
+	u32 RegOffset = (u32)Bank * XGPIOPS_DATA_MASK_OFFSET;
+
+	if ((Mask & 0x0000FFFFU) != (u32)0) {
+		XGpioPs_WriteReg(BaseAddr, RegOffset + XGPIOPS_DATA_LSW_OFFSET,
+				 (~Mask << 16U) | (Data & Mask & 0x0000FFFFU));
+	}
+	if ((Mask & 0xFFFF0000U) != (u32)0) {
+		XGpioPs_WriteReg(BaseAddr, RegOffset + XGPIOPS_DATA_MSW_OFFSET,
+				 (~Mask & 0xFFFF0000U) | ((Data & Mask) >> 16U));
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* Write the pins of a bank selected by a mask, leaving the other pins of the
+* bank unchanged. The write is done with the Mask and Data registers, without
+* a read-modify-write of the Data register, so that it is atomic with respect
+* to writes of the other pins.
+*
+* @param	InstancePtr is a pointer to the XGpioPs instance.
+* @param	Bank is the bank number of the GPIO to operate on.
+*		Valid values are 0-3 in Zynq and 0-5 in Zynq Ultrascale+ MP.
+* @param	Mask selects the pins to write, bit 0 is pin 0 of the bank.
+* @param	Data contains the values of the selected pins. Setting pins is
+*		done with Data equal to Mask, clearing them with Data 0.
+*
+* @return	None.
+*
+* @note		Pins 0-15 and 16-31 of the bank are written by two register
+*		writes.
+*
+*****************************************************************************/
+void XGpioPs_WriteMasked(const XGpioPs *InstancePtr, u8 Bank, u32 Mask,
+			 u32 Data)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid(XGpioPs_IsBankValid(InstancePtr, Bank) == (u32)TRUE);
+
+	XGpioPs_WriteMaskedReg(InstancePtr->GpioConfig.BaseAddr, Bank, Mask,
+			       Data);
+}
+
+/****************************************************************************/
+/**
+*
+* Read the input data of several banks.
+*
+* @param	InstancePtr is a pointer to the XGpioPs instance.
+* @param	BankMask selects the banks to read, bit 0 is bank 0.
+* @param	Data is an array indexed by bank number, of at least the
+*		number of banks of the device. The entries of the selected
+*		banks are written.
+*
+* @return	None.
+*
+* @note		The banks are read back to back in increasing order.
+*
+*****************************************************************************/
+void XGpioPs_ReadBanks(const XGpioPs *InstancePtr, u32 BankMask, u32 *Data)
+{
+	u8 Bank;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid(Data != NULL);
+
+	for (Bank = 0U; Bank < InstancePtr->MaxBanks; Bank++) {
+		if ((BankMask & ((u32)1 << Bank)) == (u32)0) {
+			continue;
+		}
+		Xil_AssertVoid(XGpioPs_IsBankValid(InstancePtr, Bank) ==
+			       (u32)TRUE);
+		Data[Bank] = XGpioPs_ReadReg(InstancePtr->GpioConfig.BaseAddr,
+					     ((u32)(Bank) *
+					      XGPIOPS_DATA_BANK_OFFSET) +
+					     XGPIOPS_DATA_RO_OFFSET);
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* Write the pins selected by a mask in several banks, leaving the other pins
+* unchanged. Each bank is written as by XGpioPs_WriteMasked().
+*
+* @param	InstancePtr is a pointer to the XGpioPs instance.
+* @param	BankMask selects the banks to write, bit 0 is bank 0.
+* @param	Mask is an array indexed by bank number of the pins to write.
+* @param	Data is an array indexed by bank number of the values of the
+*		selected pins.
+*
+* @return	None.
+*
+* @note		The banks are written back to back in increasing order.
+*
+*****************************************************************************/
+void XGpioPs_WriteBanksMasked(const XGpioPs *InstancePtr, u32 BankMask,
+			      const u32 *Mask, const u32 *Data)
+{
+	u8 Bank;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid(Mask != NULL);
+	Xil_AssertVoid(Data != NULL);
+
+	for (Bank = 0U; Bank < InstancePtr->MaxBanks; Bank++) {
+		if ((BankMask & ((u32)1 << Bank)) == (u32)0) {
+			continue;
+		}
+		Xil_AssertVoid(XGpioPs_IsBankValid(InstancePtr, Bank) ==
+			       (u32)TRUE);
+		XGpioPs_WriteMaskedReg(InstancePtr->GpioConfig.BaseAddr, Bank,
+				       Mask[Bank], Data[Bank]);
+	}
+}
+
 /****************************************************************************/
 /**
 *
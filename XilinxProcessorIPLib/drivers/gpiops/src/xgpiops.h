@@ -17,6 +17,8 @@
 * The GPIO Controller supports the following features:
 *	- 4 banks
 *	- Masked writes (There are no masked reads)
+*	- Vectored reads and masked writes of several banks in one call
+*	- Time stamped edge event FIFO filled by the interrupt handler
 *	- Bypass mode
 *	- Configurable Interrupts (Level/Edge)
 *
@@ -95,6 +97,8 @@
 * 3.8   sne  08/28/20 Modify Makefile to support parallel make execution.
 * 3.8	sne  09/17/20 Added description for Versal PS and PMC GPIO pins.
 * 3.9	sne  03/15/21 Fixed MISRA-C violations.
+* 3.10	ag   10/15/26 Added XGpioPs_WriteMasked(), XGpioPs_ReadBanks(),
+*		      XGpioPs_WriteBanksMasked() and the edge event FIFO.
 *
 * </pre>
 *
@@ -179,6 +183,40 @@ extern "C" {
  *****************************************************************************/
 typedef void (*XGpioPs_Handler) (void *CallBackRef, u32 Bank, u32 Status);
 
+/****************************************************************************/
+/**
+ * This data type is the time stamp function of the edge event FIFO. It is
+ * called once in each invocation of XGpioPs_IntrHandler(), and should be
+ * cheap, e.g. a read of a free running counter.
+ *
+ * @return	Time stamp in units chosen by the upper layer.
+ *
+ *****************************************************************************/
+typedef u64 (*XGpioPs_TimestampFn) (void);
+
+/**
+ * Edge event recorded by XGpioPs_IntrHandler()
+ */
+typedef struct {
+	u64 Timestamp;		/**< Time stamp of the interrupt */
+	u32 Status;		/**< Pending enabled interrupts of the bank */
+	u32 Data;		/**< Input data of the bank */
+	u8 Bank;		/**< Bank of the event */
+} XGpioPs_EdgeEvent;
+
+/**
+ * Edge event FIFO. The user allocates it and the event buffer, see
+ * XGpioPs_SetEventFifo().
+ */
+typedef struct {
+	XGpioPs_EdgeEvent *Events;	/**< Event buffer */
+	u32 Size;			/**< Events in the buffer, power of 2 */
+	volatile u32 Head;		/**< Written by the handler */
+	volatile u32 Tail;		/**< Written by the reader */
+	volatile u32 Dropped;		/**< Events lost on a full FIFO */
+	XGpioPs_TimestampFn GetTimestamp; /**< Time stamp function */
+} XGpioPs_EventFifo;
+
 /**
  * This typedef contains configuration information for a device.
  */
@@ -201,6 +239,7 @@ typedef struct {
 	u32 MaxPinNum;			/**< Max pins in the GPIO device */
 	u8 MaxBanks;			/**< Max banks in a GPIO device */
         u32 PmcGpio;                    /**< Flag for accessing PS GPIO for versal*/
+	XGpioPs_EventFifo *EventFifo;	/**< Edge event FIFO, NULL if none */
 } XGpioPs;
 
 /************************** Variable Definitions *****************************/
@@ -221,6 +260,11 @@ void XGpioPs_SetDirection(const XGpioPs *InstancePtr, u8 Bank, u32 Direction);
 u32 XGpioPs_GetDirection(const XGpioPs *InstancePtr, u8 Bank);
 void XGpioPs_SetOutputEnable(const XGpioPs *InstancePtr, u8 Bank, u32 OpEnable);
 u32 XGpioPs_GetOutputEnable(const XGpioPs *InstancePtr, u8 Bank);
+void XGpioPs_WriteMasked(const XGpioPs *InstancePtr, u8 Bank, u32 Mask,
+			 u32 Data);
+void XGpioPs_ReadBanks(const XGpioPs *InstancePtr, u32 BankMask, u32 *Data);
+void XGpioPs_WriteBanksMasked(const XGpioPs *InstancePtr, u32 BankMask,
+			      const u32 *Mask, const u32 *Data);
 #ifdef versal
 void XGpioPs_GetBankPin(const XGpioPs *InstancePtr,u8 PinNumber,u8 *BankNumber, u8 *PinNumberInBank);
 #else
@@ -252,6 +296,12 @@ void XGpioPs_GetIntrType(const XGpioPs *InstancePtr, u8 Bank, u32 *IntrType,
 void XGpioPs_SetCallbackHandler(XGpioPs *InstancePtr, void *CallBackRef,
 			     XGpioPs_Handler FuncPointer);
 void XGpioPs_IntrHandler(const XGpioPs *InstancePtr);
+s32 XGpioPs_SetEventFifo(XGpioPs *InstancePtr, XGpioPs_EventFifo *FifoPtr,
+			 XGpioPs_EdgeEvent *Events, u32 Size,
+			 XGpioPs_TimestampFn GetTimestamp);
+u32 XGpioPs_GetEvents(const XGpioPs *InstancePtr, XGpioPs_EdgeEvent *Events,
+		      u32 MaxEvents);
+u32 XGpioPs_GetEventsDropped(const XGpioPs *InstancePtr);
 
 /* Pin APIs in xgpiops_intr.c */
 void XGpioPs_SetIntrTypePin(const XGpioPs *InstancePtr, u32 Pin, u8 IrqType);
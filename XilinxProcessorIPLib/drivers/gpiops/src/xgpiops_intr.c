@@ -34,6 +34,8 @@
 * 3.5   sne  03/20/19 Fixed multiple interrupts problem CR#1024556.
 * 3.6	sne  06/12/19 Fixed IAR compiler warning.
 * 3.6   sne  08/14/19 Added interrupt handler support on versal.
+* 3.10	ag   10/15/26 Added the edge event FIFO filled by
+*		      XGpioPs_IntrHandler().
 *
 * </pre>
 *
@@ -53,6 +55,9 @@
 
 /************************** Function Prototypes ******************************/
 
+static void XGpioPs_PutEvent(const XGpioPs *InstancePtr, u8 Bank, u32 Status,
+			     u64 Timestamp);
+
 /****************************************************************************/
 /**
 *
@@ -749,10 +754,17 @@ void XGpioPs_IntrHandler(const XGpioPs *InstancePtr)
 	u8 Bank;
 	u32 IntrStatus;
 	u32 IntrEnabled;
+	u64 Timestamp = 0U;
 
 	Xil_AssertVoid(InstancePtr != NULL);
 	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
 
+	/* One time stamp for all the banks, as close to the edge as possible */
+	if ((InstancePtr->EventFifo != NULL) &&
+	    (InstancePtr->EventFifo->GetTimestamp != NULL)) {
+		Timestamp = InstancePtr->EventFifo->GetTimestamp();
+	}
+
 	for (Bank = 0U; Bank < InstancePtr->MaxBanks; Bank++) {
 #ifdef versal
 		if(InstancePtr->PmcGpio == (u32)TRUE) {
@@ -770,10 +782,176 @@ void XGpioPs_IntrHandler(const XGpioPs *InstancePtr)
 		if ((IntrStatus & IntrEnabled) != (u32)0) {
 			XGpioPs_IntrClear(InstancePtr, Bank,
 					(IntrStatus & IntrEnabled));
+			if (InstancePtr->EventFifo != NULL) {
+				XGpioPs_PutEvent(InstancePtr, Bank,
+						 (IntrStatus & IntrEnabled),
+						 Timestamp);
+			}
 			InstancePtr->Handler(InstancePtr->
 					CallBackRef, Bank,
 					(IntrStatus & IntrEnabled));
 		}
 	}
 }
+
+/****************************************************************************/
+/**
+*
+* This function records an edge event in the event FIFO. The event is
+* dropped and counted when the FIFO is full.
+*
+* @param	InstancePtr is a pointer to the XGpioPs instance.
+* @param	Bank is the bank number.
+* @param	Status is the pending enabled interrupts of the bank.
+* @param	Timestamp is the time stamp of the interrupt.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XGpioPs_PutEvent(const XGpioPs *InstancePtr, u8 Bank, u32 Status,
+			     u64 Timestamp)
+{
+	XGpioPs_EventFifo *FifoPtr = InstancePtr->EventFifo;
+	XGpioPs_EdgeEvent *EventPtr;
+	u32 Head = FifoPtr->Head;
+
+	if ((Head - FifoPtr->Tail) >= FifoPtr->Size) {
+		FifoPtr->Dropped++;
+		return;
+	}
+
+	EventPtr = &FifoPtr->Events[Head & (FifoPtr->Size - 1U)];
+	EventPtr->Timestamp = Timestamp;
+	EventPtr->Status = Status;
+	EventPtr->Data = XGpioPs_ReadReg(InstancePtr->GpioConfig.BaseAddr,
+					 ((u32)(Bank) *
+					  XGPIOPS_DATA_BANK_OFFSET) +
+					 XGPIOPS_DATA_RO_OFFSET);
+	EventPtr->Bank = Bank;
+
+	/* Publish the event after it is complete */
+	FifoPtr->Head = Head + 1U;
+}
+
+/****************************************************************************/
+/**
+*
+* This function sets the edge event FIFO. XGpioPs_IntrHandler() records an
+* event in it for each bank with pending enabled interrupts, before calling
+* the callback handler.
+*
+* @param	InstancePtr is a pointer to the XGpioPs instance.
+* @param	FifoPtr is a pointer to the FIFO, NULL to stop recording
+*		events.
+* @param	Events is the event buffer.
+* @param	Size is the number of events of the buffer, a power of 2.
+* @param	GetTimestamp is the time stamp function, NULL to record events
+*		without time stamp.
+*
+* @return
+*		- XST_SUCCESS if the FIFO is set.
+*		- XST_INVALID_PARAM if Size is not a power of 2.
+*
+* @note		Interrupts of the device must be disabled while the FIFO is
+*		changed.
+*
+******************************************************************************/
+s32 XGpioPs_SetEventFifo(XGpioPs *InstancePtr, XGpioPs_EventFifo *FifoPtr,
+			 XGpioPs_EdgeEvent *Events, u32 Size,
+			 XGpioPs_TimestampFn GetTimestamp)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if (FifoPtr == NULL) {
+		InstancePtr->EventFifo = NULL;
+		return (s32)XST_SUCCESS;
+	}
+
+	Xil_AssertNonvoid(Events != NULL);
+	if ((Size == (u32)0) || ((Size & (Size - 1U)) != (u32)0)) {
+		return (s32)XST_INVALID_PARAM;
+	}
+
+	FifoPtr->Events = Events;
+	FifoPtr->Size = Size;
+	FifoPtr->Head = 0U;
+	FifoPtr->Tail = 0U;
+	FifoPtr->Dropped = 0U;
+	FifoPtr->GetTimestamp = GetTimestamp;
+	InstancePtr->EventFifo = FifoPtr;
+
+	return (s32)XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* This function reads events from the edge event FIFO, oldest first.
+*
+* @param	InstancePtr is a pointer to the XGpioPs instance.
+* @param	Events is the buffer the events are copied to.
+* @param	MaxEvents is the number of events of the buffer.
+*
+* @return	Number of events read.
+*
+* @note		There must be a single reader. The pins that changed are the
+*		Status bits of an event, and the new levels of edge pins are
+*		the corresponding Data bits.
+*
+******************************************************************************/
+u32 XGpioPs_GetEvents(const XGpioPs *InstancePtr, XGpioPs_EdgeEvent *Events,
+		      u32 MaxEvents)
+{
+	XGpioPs_EventFifo *FifoPtr;
+	u32 Tail;
+	u32 Count = 0U;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(Events != NULL);
+
+	FifoPtr = InstancePtr->EventFifo;
+	if (FifoPtr == NULL) {
+		return 0U;
+	}
+
+	Tail = FifoPtr->Tail;
+	while ((Count < MaxEvents) && (Tail != FifoPtr->Head)) {
+		Events[Count] = FifoPtr->Events[Tail & (FifoPtr->Size - 1U)];
+		Tail++;
+		Count++;
+	}
+	/* Free the entries after they are copied */
+	FifoPtr->Tail = Tail;
+
+	return Count;
+}
+
+/****************************************************************************/
+/**
+*
+* This function returns the number of events dropped because the edge event
+* FIFO was full.
+*
+* @param	InstancePtr is a pointer to the XGpioPs instance.
+*
+* @return	Number of dropped events since XGpioPs_SetEventFifo().
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XGpioPs_GetEventsDropped(const XGpioPs *InstancePtr)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if (InstancePtr->EventFifo == NULL) {
+		return 0U;
+	}
+
+	return InstancePtr->EventFifo->Dropped;
+}
 /** @} */
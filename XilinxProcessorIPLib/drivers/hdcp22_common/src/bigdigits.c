@@ -2465,17 +2465,21 @@ u32 spSimpleRand(u32 lower, u32 upper)
 /**************************/
 /*	[v2.2] Modified to use sliding-window exponentiation.
 	mpModExp_1 is the earlier version [<2.2] now using macros for modular squaring & mult
+	Odd moduli (all RSA moduli) use sliding-window exponentiation with
+	Montgomery multiplication, which avoids a long division per step.
 */
 
-#ifdef NO_ALLOCS
 static int mpModExp_1(u32 y[], const u32 x[], const u32 n[], u32 d[], size_t ndigits);
-#else
+static int mpModExp_mont(u32 y[], const u32 x[], const u32 n[], u32 d[], size_t ndigits);
+#ifndef NO_ALLOCS
 static int mpModExp_windowed(u32 y[], const u32 x[], const u32 n[], u32 d[], size_t ndigits);
 #endif
 
 int mpModExp(u32 y[], const u32 x[], const u32 n[], u32 d[], size_t ndigits)
 	/* Computes y = x^n mod d */
 {
+	if (ndigits > 1 && mpISODD(d, ndigits))
+		return mpModExp_mont(y, x, n, d, ndigits);
 #ifdef NO_ALLOCS
 	return mpModExp_1(y, x, n, d, ndigits);
 #else
@@ -2648,6 +2652,207 @@ done:
 
 
 
+/*
+MONTGOMERY SLIDING-WINDOW EXPONENTIATION
+Ref: Menezes, chap 14, p600 (Algorithm 14.36) and p616 (Algorithm 14.85).
+Ref: Koc, Acar and Kaliski, "Analyzing and Comparing Montgomery
+     Multiplication Algorithms", IEEE Micro, 16(3):26-33, June 1996 (CIOS).
+Works in the Montgomery domain x' = x * R mod m, R = 2^(32 * ndigits), so
+every modular product is a single interleaved multiply-and-reduce pass
+using 32x32->64 bit multiply-accumulate instead of a product followed by
+a long division. Requires m to be odd.
+*/
+
+/* Maximum window size. The table holds 2^(k-1) odd powers of n digits. */
+#ifdef NO_ALLOCS
+#define MONTWINLENMAX 3
+#else
+#define MONTWINLENMAX 4
+#endif
+#define MONTTBLMAX (1 << (MONTWINLENMAX - 1))
+
+static u32 mpMontInv32(u32 m0)
+	/* Returns -m0^{-1} mod 2^32 for odd m0 */
+{
+	u32 inv = m0;	/* Correct to 3 bits for odd m0 */
+	int i;
+
+	/* Each Newton step doubles the number of correct bits */
+	for (i = 0; i < 4; i++)
+		inv *= 2 - m0 * inv;
+
+	return (u32)0 - inv;
+}
+
+static void mpMontMult(u32 w[], const u32 x[], const u32 y[],
+			const u32 m[], u32 minv, u32 t[], size_t ndigits)
+	/*	Computes w = x * y * R^{-1} mod m where x, y < m.
+		t is a temp of ndigits + 2, ndigits > 1. w may overlap x or y.
+	*/
+{
+	u64 uv;
+	u32 c, q;
+	size_t i, j;
+	size_t n = ndigits;
+
+	for (i = 0; i < n + 2; i++)
+		t[i] = 0;
+
+	for (i = 0; i < n; i++)
+	{
+		/* t = t + x * y_i */
+		c = 0;
+		for (j = 0; j < n; j++)
+		{
+			uv = (u64)x[j] * y[i] + t[j] + c;
+			t[j] = (u32)uv;
+			c = (u32)(uv >> BITS_PER_DIGIT);
+		}
+		uv = (u64)t[n] + c;
+		t[n] = (u32)uv;
+		t[n+1] = (u32)(uv >> BITS_PER_DIGIT);
+
+		/* t = (t + q * m) / 2^32 with q chosen so the low digit is zero */
+		q = t[0] * minv;
+		uv = (u64)q * m[0] + t[0];
+		c = (u32)(uv >> BITS_PER_DIGIT);
+		for (j = 1; j < n; j++)
+		{
+			uv = (u64)q * m[j] + t[j] + c;
+			t[j-1] = (u32)uv;
+			c = (u32)(uv >> BITS_PER_DIGIT);
+		}
+		uv = (u64)t[n] + c;
+		t[n-1] = (u32)uv;
+		t[n] = t[n+1] + (u32)(uv >> BITS_PER_DIGIT);
+	}
+
+	/* t < 2m, so at most one subtraction is needed */
+	if (t[n] != 0 || mpCompare(t, m, n) >= 0)
+		mpSubtract(w, t, m, n);
+	else
+		mpSetEqual(w, t, n);
+}
+
+static int mpModExp_mont(u32 yout[], const u32 g[],
+			const u32 e[], u32 m[], size_t ndigits)
+/* Computes y = g^e mod m for odd m using Montgomery multiplication */
+{
+	size_t nbits;	/* Number of significant bits in e */
+	size_t winlen;	/* Window size */
+	size_t ngt;		/* No of elements in gtable */
+	size_t nn = ndigits * 2;
+	size_t i, l, j;
+	u32 wval;	/* Value of current window */
+	u32 minv;	/* -m^{-1} mod 2^32 */
+	int aisone;		/* Flag that A == 1 */
+#ifdef NO_ALLOCS
+	u32 t1[MAX_FIXED_DIGITS * 2];
+	u32 t2[MAX_FIXED_DIGITS * 2];
+	u32 gtable[MONTTBLMAX][MAX_FIXED_DIGITS];	/* g1, g3, g5,... */
+	u32 a[MAX_FIXED_DIGITS * 2];
+	assert(ndigits <= MAX_FIXED_DIGITS);
+#else
+	u32 *t1, *t2, *a;
+	u32 *gtable[MONTTBLMAX];
+	t1 = mpAlloc(nn);
+	t2 = mpAlloc(nn);
+	a = mpAlloc(nn);
+	for (i = 0; i < MONTTBLMAX; i++)
+		gtable[i] = mpAlloc(ndigits);
+#endif
+
+	assert(ndigits != 0);
+
+	nbits = mpBitLength(e, ndigits);
+	/* Catch e==0 => x^0=1 */
+	if (nbits == 0)
+	{
+		mpSetDigit(yout, 1, ndigits);
+		goto done;
+	}
+
+	/* Pick the window size for this size of e */
+	winlen = 1;
+	if (nbits > 16)
+		winlen = 2;
+	if (nbits > 64)
+		winlen = 3;
+	if (nbits > 240)
+		winlen = 4;
+	if (winlen > MONTWINLENMAX)
+		winlen = MONTWINLENMAX;
+	ngt = (size_t)1 << (winlen - 1);
+
+	minv = mpMontInv32(m[0]);
+
+	/* g1 = g * R mod m */
+	mpSetZero(t1, ndigits);
+	mpSetEqual(&t1[ndigits], g, ndigits);
+	mpDivide(t2, a, t1, nn, m, ndigits);
+	mpSetEqual(gtable[0], a, ndigits);
+
+	/* g_{2i+1} = g_{2i-1} * g^2, with g^2 held in a */
+	if (ngt > 1)
+	{
+		mpMontMult(a, gtable[0], gtable[0], m, minv, t1, ndigits);
+		for (i = 1; i < ngt; i++)
+			mpMontMult(gtable[i], gtable[i-1], a, m, minv, t1, ndigits);
+	}
+
+	/* Left to right over the bits of e */
+	aisone = 1;
+	i = nbits;
+	while (i > 0)
+	{
+		if (!mpGetBit((u32 *)e, ndigits, i - 1))
+		{	/* Bit is '0', so just square */
+			if (!aisone)
+				mpMontMult(a, a, a, m, minv, t1, ndigits);
+			i--;
+			continue;
+		}
+
+		/* Longest window e_{i-1}...e_l ending in a '1' bit */
+		l = (i > winlen) ? (i - winlen) : 0;
+		while (!mpGetBit((u32 *)e, ndigits, l))
+			l++;
+
+		wval = 0;
+		for (j = i; j > l; j--)
+		{
+			wval = (wval << 1) | (u32)mpGetBit((u32 *)e, ndigits, j - 1);
+			if (!aisone)
+				mpMontMult(a, a, a, m, minv, t1, ndigits);
+		}
+
+		/* A = A * g_wval */
+		if (aisone)
+		{
+			mpSetEqual(a, gtable[wval >> 1], ndigits);
+			aisone = 0;
+		}
+		else
+		{
+			mpMontMult(a, a, gtable[wval >> 1], m, minv, t1, ndigits);
+		}
+		i = l;
+	}
+
+	/* Convert back, y = A * 1 * R^{-1} mod m */
+	mpSetDigit(t2, 1, ndigits);
+	mpMontMult(yout, a, t2, m, minv, t1, ndigits);
+
+done:
+	mpDESTROY(t1, nn);
+	mpDESTROY(t2, nn);
+	mpDESTROY(a, nn);
+	for (i = 0; i < MONTTBLMAX; i++)
+		mpDESTROY(gtable[i], ndigits);
+
+	return 0;
+}
+
 /* Use sliding window alternative only if NO_ALLOCS not defined */
 #ifndef NO_ALLOCS
 
@@ -31,6 +31,8 @@
 * 2.00  MH   04/14/16 Updated for repeater upstream support.
 * 2.01  MH   02/28/17 Fixed compiler warnings.
 * 2.20  MH   06/08/17 Updated for 64 bit support.
+* 3.10  ag   10/15/26 Calculate the Montgomery constants of p and q when the
+*                     private key is loaded.
 *</pre>
 *
 *****************************************************************************/
@@ -999,6 +1001,12 @@ int XHdcp22Rx_LoadPrivateKey(XHdcp22_Rx *InstancePtr, const u8 *PrivateKeyPtr)
 	    return Status;
 	}
 
+	/* Calculate Montgomery constants of p and q */
+	XHdcp22Rx_CalcMontR(InstancePtr->RModP, InstancePtr->R2ModP,
+		(u8 *)PrivateKey->p, XHDCP22_RX_P_SIZE/4);
+	XHdcp22Rx_CalcMontR(InstancePtr->RModQ, InstancePtr->R2ModQ,
+		(u8 *)PrivateKey->q, XHDCP22_RX_P_SIZE/4);
+
 	return Status;
 }
 
@@ -76,6 +76,8 @@
 *                     to array. Added function XHDCP22Rx_GetVersion.
 * 2.00  MH   04/14/16 Updated for repeater upstream support.
 * 2.01  MH   02/28/17 Fixed compiler warnings.
+* 3.10  ag   10/15/26 Added the Montgomery constants of p and q to the
+*                     instance.
 *</pre>
 *
 *****************************************************************************/
@@ -566,6 +568,14 @@ typedef struct
 	u8 NPrimeP[64];
 	/** Montgomery NPrimeQ array */
 	u8 NPrimeQ[64];
+	/** Montgomery constant R*mod(p) */
+	u32 RModP[16];
+	/** Montgomery constant R^2*mod(p) */
+	u32 R2ModP[16];
+	/** Montgomery constant R*mod(q) */
+	u32 RModQ[16];
+	/** Montgomery constant R^2*mod(q) */
+	u32 R2ModQ[16];
 	/** HDCP-RX authentication and key exchange info */
 	XHdcp22_Rx_Info Info;
 	/** HDCP-RX authentication and key exchange parameters */
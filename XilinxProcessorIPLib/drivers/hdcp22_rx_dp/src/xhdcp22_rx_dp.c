@@ -22,6 +22,8 @@
 * 3.00  JB   12/24/21 File name changed from xhdcp22_rx.c to xhdcp22_rx_dp.c,
 *                     Also all the APIs and sructure names are added with
 *                     suffix _dp.
+* 3.10  ag   10/15/26 Calculate the Montgomery constants of p and q when the
+*                     private key is loaded.
 *</pre>
 *
 *****************************************************************************/
@@ -1041,6 +1043,12 @@ int XHdcp22Rx_Dp_LoadPrivateKey(XHdcp22_Rx_Dp *InstancePtr, const u8 *PrivateKey
 	    return Status;
 	}
 
+	/* Calculate Montgomery constants of p and q */
+	XHdcp22Rx_CalcMontR(InstancePtr->RModP, InstancePtr->R2ModP,
+		(u8 *)PrivateKey->p, XHDCP22_RX_P_SIZE/4);
+	XHdcp22Rx_CalcMontR(InstancePtr->RModQ, InstancePtr->R2ModQ,
+		(u8 *)PrivateKey->q, XHDCP22_RX_P_SIZE/4);
+
 	return Status;
 }
 
@@ -72,6 +72,8 @@
 * 3.00  JB   12/24/21 File name changed from xhdcp22_rx.h to xhdcp22_rx_dp.h,
 *                     Also all the APIs and sructure names are added with
 *                     suffix _dp.
+* 3.10  ag   10/15/26 Added the Montgomery constants of p and q to the
+*                     instance.
 *</pre>
 *
 *****************************************************************************/
@@ -667,6 +669,14 @@ typedef struct
 	u8 NPrimeP[64];
 	/** Montgomery NPrimeQ array */
 	u8 NPrimeQ[64];
+	/** Montgomery constant R*mod(p) */
+	u32 RModP[16];
+	/** Montgomery constant R^2*mod(p) */
+	u32 R2ModP[16];
+	/** Montgomery constant R*mod(q) */
+	u32 RModQ[16];
+	/** Montgomery constant R^2*mod(q) */
+	u32 R2ModQ[16];
 	/** HDCP-RX authentication and key exchange info */
 	XHdcp22_Rx_Dp_Info Info;
 	/** HDCP-RX authentication and key exchange parameters */
@@ -22,6 +22,9 @@
 * 1.00  JB   02/19/19 First Release.
 * 3.00  JB   12/24/21 File name changed from xhdcp22_rx_crypt.c to
 *                     xhdcp22_rx_dp_crypt.c.
+* 3.10  ag   10/15/26 Use fixed window Montgomery exponentiation for RSADP.
+*       ag   10/15/26 Use the Montgomery constants of p and q computed when
+*                     the private key is loaded.
 *</pre>
 *
 *****************************************************************************/
@@ -36,6 +39,9 @@
 #include "xhdcp22_common.h"
 
 /************************** Constant Definitions ****************************/
+#define XHDCP22_RX_MONTEXP_WIN_BITS  4  /**< Window size in bits used by the
+                                          *  modular exponentiation */
+#define XHDCP22_RX_MONTEXP_WIN_SIZE  (1 << XHDCP22_RX_MONTEXP_WIN_BITS)
 
 /**************************** Type Definitions ******************************/
 
@@ -65,7 +71,8 @@ static void XHdcp22Rx_Pkcs1MontMultFiosStub(u32 *U, u32 *A, u32 *B, u32 *N,
 static void XHdcp22Rx_Pkcs1MontMultAdd(u32 *A, u32 C, int SDigit, int NDigits);
 #endif
 static int  XHdcp22Rx_Pkcs1MontExp(XHdcp22_Rx_Dp *InstancePtr, u32 *C, u32 *A, u32 *E,
-	            u32 *N, const u32 *NPrime, int NDigits);
+	            u32 *N, const u32 *NPrime, const u32 *RModN, const u32 *R2ModN,
+	            int NDigits);
 
 /* Functions for implementing other cryptographic tasks */
 static void XHdcp22Rx_ComputeDKey(const u8* Rrx, const u8* Rtx, const u8 *Km,
@@ -157,6 +164,58 @@ int XHdcp22Rx_CalcMontNPrime(u8 *NPrime, const u8 *N, int NDigits)
 	return XST_SUCCESS;
 }
 
+/****************************************************************************/
+/**
+* This function calculates the Montgomery constants R*mod(N) and
+* R^2*mod(N), where R = 2^(NDigits*32). They only depend on the modulus,
+* so they are calculated once when the private key is loaded instead of
+* for every RSA decryption.
+*
+* @param	RModN is the output R*mod(N), NDigits integer.
+* @param	R2ModN is the output R^2*mod(N), NDigits integer.
+* @param	N is the modulus octet string.
+* @param	NDigits is the integer precision of N, in 32 bit digits. This
+* 			should always be 16 for the HDCP2.2 receiver.
+*
+* @return	XST_SUCCESS.
+*
+* @note		None.
+******************************************************************************/
+int XHdcp22Rx_CalcMontR(u32 *RModN, u32 *R2ModN, const u8 *N, int NDigits)
+{
+	/* Verify arguments */
+	Xil_AssertNonvoid(RModN != NULL);
+	Xil_AssertNonvoid(R2ModN != NULL);
+	Xil_AssertNonvoid(N != NULL);
+	Xil_AssertNonvoid(NDigits == 16);
+
+	u32 N_i[XHDCP22_RX_N_SIZE/4];
+	u32 R[XHDCP22_RX_N_SIZE/4];
+	u32 T1[XHDCP22_RX_N_SIZE/4];
+
+	/* Clear variables */
+	memset(N_i, 0, sizeof(N_i));
+	memset(R, 0, sizeof(R));
+	memset(T1, 0, sizeof(T1));
+
+	/* Convert from octet string */
+	mpConvFromOctets(N_i, XHdcp22Rx_MpSizeof(N_i), N, 4*NDigits);
+
+	/* Step 1: R = 2^(NDigits*32) */
+	R[0] = 1;
+	mpShiftLeft(R, R, 32*NDigits, XHdcp22Rx_MpSizeof(R));
+
+	/* Step 2: T1 = R*mod(N) */
+	mpModulo(T1, R, XHdcp22Rx_MpSizeof(R), N_i, NDigits);
+	memcpy(RModN, T1, 4*NDigits);
+
+	/* Step 3: R = R^2*mod(N) */
+	mpModMult(R, T1, T1, N_i, 2*NDigits);
+	memcpy(R2ModN, R, 4*NDigits);
+
+	return XST_SUCCESS;
+}
+
 /****************************************************************************/
 /**
 * This function implements the RSAES-OAEP-Encrypt operation. The message
@@ -369,14 +428,16 @@ static int XHdcp22Rx_Pkcs1Rsadp(XHdcp22_Rx_Dp *InstancePtr, const XHdcp22_Rx_Kpr
 	mpConvFromOctets(C, XHdcp22Rx_MpSizeof(C), EncryptedMessage, XHDCP22_RX_N_SIZE);
 	mpConvFromOctets(D, XHdcp22Rx_MpSizeof(D), InstancePtr->NPrimeP, XHDCP22_RX_P_SIZE);
 	//Status = mpModExp(M1, C, B, A, XHDCP22_RX_N_SIZE/4);
-	Status = XHdcp22Rx_Pkcs1MontExp(InstancePtr, M1, C, B, A, D, 16);
+	Status = XHdcp22Rx_Pkcs1MontExp(InstancePtr, M1, C, B, A, D,
+		InstancePtr->RModP, InstancePtr->R2ModP, 16);
 
 	/* Step 2b part I: Generate m2 = c^dQ * mod(q) */
 	mpConvFromOctets(A, XHdcp22Rx_MpSizeof(A), KprivRx->q, XHDCP22_RX_P_SIZE);
 	mpConvFromOctets(B, XHdcp22Rx_MpSizeof(B), KprivRx->dq, XHDCP22_RX_P_SIZE);
 	mpConvFromOctets(D, XHdcp22Rx_MpSizeof(D), InstancePtr->NPrimeQ, XHDCP22_RX_P_SIZE);
 	//Status = mpModExp(M2, C, D, B, XHDCP22_RX_N_SIZE/4);
-	Status = XHdcp22Rx_Pkcs1MontExp(InstancePtr, M2, C, B, A, D, 16);
+	Status = XHdcp22Rx_Pkcs1MontExp(InstancePtr, M2, C, B, A, D,
+		InstancePtr->RModQ, InstancePtr->R2ModQ, 16);
 
 	/* Step 2b part II: Skip since u=2 */
 
@@ -880,7 +941,11 @@ static void XHdcp22Rx_Pkcs1MontMultFios(XHdcp22_Rx_Dp *InstancePtr, u32 *U,
 /****************************************************************************/
 /**
 * This function performs the modular exponentation operation using the
-* binary square and multiply method.
+* fixed window method. The exponent is processed four bits at a time, so
+* a 512 bit exponent needs 128 Montgomery multiplications in addition to
+* the squarings instead of one for every set bit. Every window multiplies
+* by a table entry, including the entry for a zero window, so the sequence
+* of operations does not depend on the private exponent.
 *
 * C = ModExp(A, E, N) = A^E*mod(N)
 *
@@ -889,6 +954,8 @@ static void XHdcp22Rx_Pkcs1MontMultFios(XHdcp22_Rx_Dp *InstancePtr, u32 *U,
 * @param	E is the exponent
 * @param	N is the modulus
 * @param	NPrime is a constant
+* @param	RModN is the precomputed constant R*mod(N)
+* @param	R2ModN is the precomputed constant R^2*mod(N)
 * @param	NDigits is the integer precision of the arguments (C,A,B,N,NPrime).
 * 			Maximum integer precision is 16.
 *
@@ -897,51 +964,75 @@ static void XHdcp22Rx_Pkcs1MontMultFios(XHdcp22_Rx_Dp *InstancePtr, u32 *U,
 * @note		None.
 *****************************************************************************/
 static int XHdcp22Rx_Pkcs1MontExp(XHdcp22_Rx_Dp *InstancePtr, u32 *C, u32 *A,
-	u32 *E, u32 *N, const u32 *NPrime, int NDigits)
+	u32 *E, u32 *N, const u32 *NPrime, const u32 *RModN, const u32 *R2ModN,
+	int NDigits)
 {
 	int Offset;
+	int Bit;
+	int Index;
+	u32 Window;
 	u32 R[XHDCP22_RX_N_SIZE/4];
 	u32 Abar[XHDCP22_RX_N_SIZE/4];
 	u32 Xbar[XHDCP22_RX_N_SIZE/4];
+	u32 Table[XHDCP22_RX_MONTEXP_WIN_SIZE][XHDCP22_RX_N_SIZE/8];
 
 	memset(R, 0, sizeof(R));
 	memset(Abar, 0, sizeof(Abar));
 	memset(Xbar, 0, sizeof(Xbar));
+	memset(Table, 0, sizeof(Table));
 
 #ifndef _XHDCP22_RX_SW_MMULT_
 	XHdcp22Rx_Pkcs1MontMultFiosInit(InstancePtr, N, NPrime, NDigits);
 #endif
 
-	/* Step 0: R = 2^(NDigits*32) */
-	R[0] = 1;
-	mpShiftLeft(R, R, NDigits*32, XHDCP22_RX_N_SIZE/4);
-
 	/* Step 1: Xbar = 1*R*mod(N) */
-	mpModulo(Xbar, R, XHDCP22_RX_N_SIZE/4, N, NDigits); // Optimization
+	memcpy(Xbar, RModN, 4*NDigits);
 
-	/* Step 2: Abar = A*R*mod(N) */
-	mpModMult(Abar, A, Xbar, N, 2*NDigits);
+	/* Step 2: Abar = A*R*mod(N) = MonPro(A*mod(N), R^2*mod(N)) */
+	mpModulo(Abar, A, XHDCP22_RX_N_SIZE/4, N, NDigits);
+#ifndef _XHDCP22_RX_SW_MMULT_
+	XHdcp22Rx_Pkcs1MontMultFios(InstancePtr, Abar, Abar, (u32 *)R2ModN, NDigits);
+#else
+	XHdcp22Rx_Pkcs1MontMultFiosStub(Abar, Abar, (u32 *)R2ModN, N, NPrime, NDigits);
+#endif
 
-	/* Step 3: Binary square and multiply */
-	for(Offset=32*NDigits-1; Offset>=0; Offset--)
+	/* Step 3: Table[i] = A^i*R*mod(N) */
+	memcpy(Table[0], Xbar, 4*NDigits);
+	memcpy(Table[1], Abar, 4*NDigits);
+	for(Index=2; Index<XHDCP22_RX_MONTEXP_WIN_SIZE; Index++)
 	{
 #ifndef _XHDCP22_RX_SW_MMULT_
-		XHdcp22Rx_Pkcs1MontMultFios(InstancePtr, Xbar, Xbar, Xbar, NDigits);
+		XHdcp22Rx_Pkcs1MontMultFios(InstancePtr, Table[Index], Table[Index-1],
+			Abar, NDigits);
 #else
-		XHdcp22Rx_Pkcs1MontMultFiosStub(Xbar, Xbar, Xbar, N, NPrime, NDigits);
+		XHdcp22Rx_Pkcs1MontMultFiosStub(Table[Index], Table[Index-1], Abar, N,
+			NPrime, NDigits);
 #endif
+	}
 
-		if(mpGetBit(E, NDigits, Offset) == TRUE)
+	/* Step 4: Fixed window square and multiply */
+	for(Offset=32*NDigits-XHDCP22_RX_MONTEXP_WIN_BITS; Offset>=0;
+		Offset-=XHDCP22_RX_MONTEXP_WIN_BITS)
+	{
+		for(Bit=0; Bit<XHDCP22_RX_MONTEXP_WIN_BITS; Bit++)
 		{
 #ifndef _XHDCP22_RX_SW_MMULT_
-			XHdcp22Rx_Pkcs1MontMultFios(InstancePtr, Xbar, Xbar, Abar, NDigits);
+			XHdcp22Rx_Pkcs1MontMultFios(InstancePtr, Xbar, Xbar, Xbar, NDigits);
 #else
-			XHdcp22Rx_Pkcs1MontMultFiosStub(Xbar, Xbar, Abar, N, NPrime, NDigits);
+			XHdcp22Rx_Pkcs1MontMultFiosStub(Xbar, Xbar, Xbar, N, NPrime, NDigits);
 #endif
 		}
+
+		Window = (E[Offset/32] >> (Offset%32)) & (XHDCP22_RX_MONTEXP_WIN_SIZE-1);
+
+#ifndef _XHDCP22_RX_SW_MMULT_
+		XHdcp22Rx_Pkcs1MontMultFios(InstancePtr, Xbar, Xbar, Table[Window], NDigits);
+#else
+		XHdcp22Rx_Pkcs1MontMultFiosStub(Xbar, Xbar, Table[Window], N, NPrime, NDigits);
+#endif
 	}
 
-	/* Step 4: C=MonPro(Xbar,1) */
+	/* Step 5: C=MonPro(Xbar,1) */
 	memset(R, 0, sizeof(R));
 	R[0] = 1;
 
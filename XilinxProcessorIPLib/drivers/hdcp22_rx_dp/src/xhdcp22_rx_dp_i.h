@@ -21,6 +21,7 @@
 * 1.00  JB   02/19/19 First Release.
 * 3.00  JB   12/24/21 File name changed from xhdcp22_rx_i.c to
 *                     xhdcp22_rx_dp_i.c
+* 3.10  ag   10/15/26 Added prototype of XHdcp22Rx_CalcMontR.
 *</pre>
 *
 *****************************************************************************/
@@ -445,6 +446,7 @@ typedef union
 
 /* Crypto Functions */
 int  XHdcp22Rx_CalcMontNPrime(u8 *NPrime, const u8 *N, int NDigits);
+int  XHdcp22Rx_CalcMontR(u32 *RModN, u32 *R2ModN, const u8 *N, int NDigits);
 void XHdcp22Rx_GenerateRandom(XHdcp22_Rx_Dp *InstancePtr, int NumOctets, u8* RandomNumberPtr);
 int  XHdcp22Rx_RsaesOaepEncrypt(const XHdcp22_Rx_KpubRx *KpubRx, const u8 *Message,
 			const u32 MessageLen, const u8 *MaskingSeed, u8 *EncryptedMessage);
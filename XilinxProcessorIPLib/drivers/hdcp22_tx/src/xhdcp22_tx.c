@@ -51,6 +51,9 @@
 *                          RxStatus register.
 * 2.31  YB     03/28/19 Moved the reading of the DDC status from
 *                          XHdcp22Tx_TimerHandler to XHdcp22Tx_Poll.
+* 3.10  ag     10/15/26 Skip the signature verification of a receiver
+*                          certificate that matches the certificate of its
+*                          stored pairing info.
 * </pre>
 *
 ******************************************************************************/
@@ -58,6 +61,7 @@
 /***************************** Include Files *********************************/
 #include "xhdcp22_tx.h"
 #include "xhdcp22_tx_i.h"
+#include "xhdcp22_common.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -1673,6 +1677,7 @@ XHdcp22_Tx_StateType Xhdcp22Tx_StateA1_1(XHdcp22_Tx *InstancePtr)
 	XHdcp22_Tx_PairingInfo *PairingInfoPtr = NULL;
 	const u8* KPubDpcPtr = NULL;
 	XHdcp22_Tx_PairingInfo NewPairingInfo;
+	u8 CertDigest[XHDCP22_TX_SHA256_HASH_SIZE];
 
 	/* receive AKE Send message, wait for 100 ms */
 	Result = XHdcp22Tx_WaitForReceiver(InstancePtr, sizeof(XHdcp22_Tx_AKESendCert), FALSE);
@@ -1694,15 +1699,28 @@ XHdcp22_Tx_StateType Xhdcp22Tx_StateA1_1(XHdcp22_Tx *InstancePtr)
 		return XHDCP22_TX_STATE_A0;
 	}
 
-	/* Verify the signature */
-	KPubDpcPtr = XHdcp22Tx_GetKPubDpc(InstancePtr);
-	XHdcp22Tx_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG,
-	                XHDCP22_TX_LOG_DBG_VERIFY_SIGNATURE);
-	Result = XHdcp22Tx_VerifyCertificate(&MsgPtr->Message.AKESendCert.CertRx,
-	                   KPubDpcPtr, /* N */
-	                   XHDCP22_TX_KPUB_DCP_LLC_N_SIZE,
-	                   &KPubDpcPtr[XHDCP22_TX_KPUB_DCP_LLC_N_SIZE], /* e */
-	                   XHDCP22_TX_KPUB_DCP_LLC_E_SIZE);
+	/* The signature of a certificate identical to the one verified when the
+	 * stored pairing info was created does not need to be verified again */
+	XHdcp22Cmn_Sha256Hash((u8 *)&MsgPtr->Message.AKESendCert.CertRx,
+	                      sizeof(XHdcp22_Tx_CertRx), CertDigest);
+	PairingInfoPtr = XHdcp22Tx_GetPairingInfo(InstancePtr,
+	                      MsgPtr->Message.AKESendCert.CertRx.ReceiverId);
+	if ((PairingInfoPtr != NULL) && (PairingInfoPtr->Ready == TRUE) &&
+	    (memcmp(PairingInfoPtr->CertDigest, CertDigest,
+	            sizeof(CertDigest)) == 0)) {
+		Result = XST_SUCCESS;
+	}
+	else {
+		/* Verify the signature */
+		KPubDpcPtr = XHdcp22Tx_GetKPubDpc(InstancePtr);
+		XHdcp22Tx_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG,
+		                XHDCP22_TX_LOG_DBG_VERIFY_SIGNATURE);
+		Result = XHdcp22Tx_VerifyCertificate(&MsgPtr->Message.AKESendCert.CertRx,
+		                   KPubDpcPtr, /* N */
+		                   XHDCP22_TX_KPUB_DCP_LLC_N_SIZE,
+		                   &KPubDpcPtr[XHDCP22_TX_KPUB_DCP_LLC_N_SIZE], /* e */
+		                   XHDCP22_TX_KPUB_DCP_LLC_E_SIZE);
+	}
 
 	if (Result != XST_SUCCESS) {
 		XHdcp22Tx_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG,
@@ -1755,9 +1773,6 @@ XHdcp22_Tx_StateType Xhdcp22Tx_StateA1_1(XHdcp22_Tx *InstancePtr)
 	memcpy(InstancePtr->Info.Rrx,  MsgPtr->Message.AKESendCert.Rrx,
 			 sizeof(InstancePtr->Info.Rrx));
 
-	/* Get pairing info pointer for the connected receiver */
-	PairingInfoPtr = XHdcp22Tx_GetPairingInfo(InstancePtr, MsgPtr->Message.AKESendCert.CertRx.ReceiverId);
-
 	/********************* Handle Stored Km **********************************/
 	/* If already existing handle Stored Km sequence: Write AKE_Stored_Km
 	 * and wait for H Prime */
@@ -1794,6 +1809,8 @@ XHdcp22_Tx_StateType Xhdcp22Tx_StateA1_1(XHdcp22_Tx *InstancePtr)
 	       sizeof(NewPairingInfo.RxCaps));
 	memcpy(NewPairingInfo.ReceiverId, MsgPtr->Message.AKESendCert.CertRx.ReceiverId,
 	       sizeof(NewPairingInfo.ReceiverId));
+	memcpy(NewPairingInfo.CertDigest, CertDigest,
+	       sizeof(NewPairingInfo.CertDigest));
 
 	/* Generate the hashed Km */
 	XHdcp22Tx_GenerateKm(InstancePtr, NewPairingInfo.Km);
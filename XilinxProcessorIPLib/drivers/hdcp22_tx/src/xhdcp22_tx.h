@@ -60,6 +60,7 @@
 * 2.01  MH     02/28/17 Fixed compiler warnings.
 * 2.20  MH     04/12/17 Added function XHdcp22Tx_IsDwnstrmCapable.
 * 2.30  MH     07/06/17 Changed default polling value to 10 ms.
+* 3.10  ag     10/15/26 Added CertDigest to XHdcp22_Tx_PairingInfo.
 * </pre>
 *
 ******************************************************************************/
@@ -292,6 +293,7 @@ typedef struct {
 	u8 Rrx[8];           /**< Random nonce for Rx (m: Rtx || Rrx). */
 	u8 Km[16];           /**< Km. */
 	u8 Ekh_Km[16];       /**< Ekh(Km). */
+	u8 CertDigest[32];   /**< SHA256 of the verified receiver certificate. */
      u8 Ready;            /**< Indicates a valid entry */
 } XHdcp22_Tx_PairingInfo;
 /**
@@ -61,6 +61,9 @@
 *			delay as per IP specifications
 * 11.2	Nava  02/01/19 Updated the Number of words per frame as mention in the
 *		       ug570
+* 11.4  ag    10/15/26 Added XHwIcap_SetDmaHandler. In polled mode the
+*		       Write/Read FIFO data of the large transfers is moved by
+*		       the DMA handler when one is set.
 * </pre>
 *
 *****************************************************************************/
@@ -72,6 +75,7 @@
 #include "xhwicap.h"
 #include "xparameters.h"
 #include <sleep.h>
+#include "xil_cache.h"
 
 /************************** Constant Definitions ****************************/
 
@@ -114,6 +118,11 @@ static u32 series_ultra_plus_idcodes[NUM_ULTRA_PLUS_SERIES_IDCODES] =
 static void StubStatusHandler(void *CallBackRef, u32 StatusEvent,
 				u32 ByteCount);
 static u32 FindDeviceType(u32 IdCode);
+#if (XPAR_HWICAP_0_MODE == 0) && (XPAR_HWICAP_0_ICAP_DWIDTH != 8) && \
+	(XPAR_HWICAP_0_ICAP_DWIDTH != 16)
+static int DmaWrite(XHwIcap *InstancePtr);
+static int DmaRead(XHwIcap *InstancePtr, u32 *FrameBuffer);
+#endif
 
 /****************************************************************************/
 /**
@@ -161,6 +170,7 @@ int XHwIcap_CfgInitialize(XHwIcap *InstancePtr, XHwIcap_Config *ConfigPtr,
 	 */
 	InstancePtr->HwIcapConfig.BaseAddress = EffectiveAddr;
 	InstancePtr->StatusHandler = (XHwIcap_StatusHandler) StubStatusHandler;
+	InstancePtr->DmaHandler = NULL;
 
 	/** Set IcapWidth **/
 
@@ -397,6 +407,14 @@ int XHwIcap_DeviceWrite(XHwIcap *InstancePtr, u32 *FrameBuffer, u32 NumWords)
 	InstancePtr->RequestedWords = 0x0;
 
 #else
+#if (XPAR_HWICAP_0_ICAP_DWIDTH != 8) && (XPAR_HWICAP_0_ICAP_DWIDTH != 16)
+	if ((InstancePtr->DmaHandler != NULL) &&
+			(InstancePtr->IsPolled == TRUE) &&
+			(NumWords >= XHI_DMA_MIN_WORDS)) {
+		return DmaWrite(InstancePtr);
+	}
+#endif
+
 	/* If FIFOs are enabled, fill the FIFO and initiate transfer */
 
 	WrFifoVacancy = XHwIcap_GetWrFifoVacancy(InstancePtr);
@@ -578,6 +596,14 @@ int XHwIcap_DeviceRead(XHwIcap *InstancePtr, u32 *FrameBuffer, u32 NumWords)
 
 	XHwIcap_StartReadBack(InstancePtr);
 
+#if (XPAR_HWICAP_0_MODE == 0) && (XPAR_HWICAP_0_ICAP_DWIDTH != 8) && \
+	(XPAR_HWICAP_0_ICAP_DWIDTH != 16)
+	if ((InstancePtr->DmaHandler != NULL) &&
+			(NumWords >= XHI_DMA_MIN_WORDS)) {
+		return DmaRead(InstancePtr, FrameBuffer);
+	}
+#endif
+
 	/*
 	 * Read the data from the Read FIFO into the buffer provided by
 	 * the user.
@@ -652,6 +678,37 @@ int XHwIcap_DeviceRead(XHwIcap *InstancePtr, u32 *FrameBuffer, u32 NumWords)
 	return XST_SUCCESS;
 }
 
+/*****************************************************************************/
+/**
+*
+* This function sets the DMA handler used to move the data of the large
+* polled transfers between memory and the Write/Read FIFO. The processor
+* still checks the FIFO vacancy/occupancy and starts the ICAP transfers,
+* the handler only replaces the word by word register accesses.
+*
+* @param	InstancePtr is a pointer to the XHwIcap instance.
+* @param	CallBackRef is the upper layer callback reference passed back
+*		when the handler is called.
+* @param	FuncPtr is the DMA handler, NULL to move the data with the
+*		processor.
+*
+* @return	None.
+*
+* @note		The DMA handler is used only when the HwIcap has FIFOs and a
+*		32 bit ICAP width. The buffers are flushed/invalidated from the
+*		data cache by the driver.
+*
+******************************************************************************/
+void XHwIcap_SetDmaHandler(XHwIcap *InstancePtr, void *CallBackRef,
+				XHwIcap_DmaHandler FuncPtr)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	InstancePtr->DmaHandler = FuncPtr;
+	InstancePtr->DmaRef = CallBackRef;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -811,6 +868,129 @@ END:
         return DeviceType;
 }
 
+#if (XPAR_HWICAP_0_MODE == 0) && (XPAR_HWICAP_0_ICAP_DWIDTH != 8) && \
+	(XPAR_HWICAP_0_ICAP_DWIDTH != 16)
+/****************************************************************************/
+/**
+*
+* This function writes the remaining words of the transfer set up by
+* XHwIcap_DeviceWrite, filling the Write FIFO with the DMA handler up to its
+* vacancy and starting the transfer to the ICAP each time.
+*
+* @param	InstancePtr is a pointer to the XHwIcap instance.
+*
+* @return	XST_SUCCESS or XST_FAILURE if the DMA handler failed.
+*
+* @note		This is a blocking function.
+*
+*****************************************************************************/
+static int DmaWrite(XHwIcap *InstancePtr)
+{
+	u32 WrFifoVacancy;
+	int Status;
+
+	Xil_DCacheFlushRange((UINTPTR)InstancePtr->SendBufferPtr,
+				InstancePtr->RemainingWords * 4);
+
+	while (InstancePtr->RemainingWords > 0) {
+		WrFifoVacancy = XHwIcap_GetWrFifoVacancy(InstancePtr);
+		if (WrFifoVacancy > InstancePtr->RemainingWords) {
+			WrFifoVacancy = InstancePtr->RemainingWords;
+		}
+
+		if (WrFifoVacancy != 0) {
+			Status = InstancePtr->DmaHandler(InstancePtr->DmaRef,
+				(UINTPTR)InstancePtr->SendBufferPtr,
+				InstancePtr->HwIcapConfig.BaseAddress +
+				XHI_WF_OFFSET, WrFifoVacancy * 4);
+			if (Status != XST_SUCCESS) {
+				InstancePtr->IsTransferInProgress = FALSE;
+				return XST_FAILURE;
+			}
+			InstancePtr->RemainingWords -= WrFifoVacancy;
+			InstancePtr->SendBufferPtr += WrFifoVacancy;
+		}
+
+		XHwIcap_StartConfig(InstancePtr);
+		while ((XHwIcap_ReadReg(InstancePtr->HwIcapConfig.BaseAddress,
+					XHI_CR_OFFSET)) & XHI_CR_WRITE_MASK);
+	}
+
+	InstancePtr->IsTransferInProgress = FALSE;
+	InstancePtr->RequestedWords = 0x0;
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* This function reads the words of the readback started by
+* XHwIcap_DeviceRead, draining the Read FIFO with the DMA handler as it
+* fills.
+*
+* @param	InstancePtr is a pointer to the XHwIcap instance.
+* @param	FrameBuffer is a pointer to the memory where the data read
+*		from the ICAP device is stored.
+*
+* @return	XST_SUCCESS, or XST_FAILURE if the DMA handler failed or
+*		there is a timeout.
+*
+* @note		This is a blocking function.
+*
+*****************************************************************************/
+static int DmaRead(XHwIcap *InstancePtr, u32 *FrameBuffer)
+{
+	u32 RdFifoOccupancy;
+	u32 Retries = 0;
+	u32 NumBytes = InstancePtr->RequestedWords * 4;
+	u32 *Data = FrameBuffer;
+	int Status = XST_SUCCESS;
+
+	/*
+	 * No dirty line of the buffer may be evicted over the DMA data.
+	 */
+	Xil_DCacheFlushRange((UINTPTR)FrameBuffer, NumBytes);
+
+	while ((InstancePtr->RemainingWords > 0) && (Status == XST_SUCCESS)) {
+		RdFifoOccupancy = XHwIcap_GetRdFifoOccupancy(InstancePtr);
+		if (RdFifoOccupancy == 0) {
+			Retries++;
+			if (Retries > XHI_MAX_RETRIES) {
+				Status = XST_FAILURE;
+			}
+			continue;
+		}
+		Retries = 0;
+
+		if (RdFifoOccupancy > InstancePtr->RemainingWords) {
+			RdFifoOccupancy = InstancePtr->RemainingWords;
+		}
+		Status = InstancePtr->DmaHandler(InstancePtr->DmaRef,
+				InstancePtr->HwIcapConfig.BaseAddress +
+				XHI_RF_OFFSET, (UINTPTR)Data,
+				RdFifoOccupancy * 4);
+		InstancePtr->RemainingWords -= RdFifoOccupancy;
+		Data += RdFifoOccupancy;
+	}
+
+	Xil_DCacheInvalidateRange((UINTPTR)FrameBuffer, NumBytes);
+
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	while ((XHwIcap_ReadReg(InstancePtr->HwIcapConfig.BaseAddress,
+			XHI_CR_OFFSET)) &
+			XHI_CR_READ_MASK);
+
+	InstancePtr->IsTransferInProgress = FALSE;
+	InstancePtr->RequestedWords = 0x0;
+
+	return XST_SUCCESS;
+}
+#endif
+
 /*****************************************************************************/
 /**
 *
@@ -161,6 +161,9 @@
 * 11.2 Nava   02/08/19 The current version of the driver is not supported for
 *                      families older than 7 series.So removed .o referenced
 *                      function prototypes from the header file.
+* 11.4  ag   10/15/26 Added XHwIcap_SetDmaHandler to move the FIFO data with
+*                     a DMA, and XHwIcap_DeviceWriteFrames and
+*                     XHwIcap_DeviceReadFrames to batch consecutive frames.
 *
 * </pre>
 *
@@ -216,6 +219,26 @@ extern "C" {
 typedef void (*XHwIcap_StatusHandler) (void *CallBackRef, u32 StatusEvent,
 					u32 WordCount);
 
+/**
+ * The DMA handler data type allows the user to move the data between memory
+ * and the Write/Read FIFO with a DMA engine, such as an AXI CDMA in simple
+ * mode, instead of the processor. The handler copies NumBytes from SrcAddr
+ * to DestAddr and returns once the copy is complete. The FIFO side of the
+ * copy is a single register, so it must not be incremented (key hole
+ * read/write of the AXI CDMA).
+ *
+ * @param 	CallBackRef is a callback reference passed in by the
+ *		application layer when setting the DMA handler.
+ * @param	SrcAddr is the source address, a buffer or the Read FIFO.
+ * @param	DestAddr is the destination address, the Write FIFO or a
+ *		buffer.
+ * @param	NumBytes is the number of bytes to copy.
+ *
+ * @return	XST_SUCCESS or XST_FAILURE.
+ */
+typedef int (*XHwIcap_DmaHandler) (void *CallBackRef, UINTPTR SrcAddr,
+					UINTPTR DestAddr, u32 NumBytes);
+
 
 /**
  * This typedef contains configuration information for the device.
@@ -256,6 +279,8 @@ typedef struct {
 	XHwIcap_StatusHandler StatusHandler; /**< Interrupt handler callback */
 	void *StatusRef;	     /**< Callback ref. for the interrupt
 						* handler */
+	XHwIcap_DmaHandler DmaHandler; /**< FIFO data mover, NULL if none */
+	void *DmaRef;		     /**< Callback ref. for the DMA handler */
 
 } XHwIcap;
 
@@ -623,6 +648,8 @@ int XHwIcap_DeviceRead(XHwIcap *InstancePtr, u32 *FrameBuffer, u32 NumWords);
 void XHwIcap_Reset(XHwIcap *InstancePtr);
 void XHwIcap_FlushFifo(XHwIcap *InstancePtr);
 void XHwIcap_Abort(XHwIcap *InstancePtr);
+void XHwIcap_SetDmaHandler(XHwIcap *InstancePtr, void *CallBackRef,
+				XHwIcap_DmaHandler FuncPtr);
 
 /*
  * Functions in xhwicap_sinit.c.
@@ -655,6 +682,10 @@ int XHwIcap_DeviceReadFrame(XHwIcap *InstancePtr, long Top,
 				long Block, long HClkRow,
 				long MajorFrame, long MinorFrame,
 				u32 *FrameBuffer);
+int XHwIcap_DeviceReadFrames(XHwIcap *InstancePtr, long Top,
+				long Block, long HClkRow,
+				long MajorFrame, long MinorFrame,
+				u32 NumFrames, u32 *FrameBuffer);
 
 /*
  * Functions in the xhwicap_device_write_frame.c
@@ -663,6 +694,10 @@ int XHwIcap_DeviceWriteFrame(XHwIcap *InstancePtr, long Top,
 				long Block, long HClkRow,
 				long MajorFrame, long MinorFrame,
 				u32 *FrameData);
+int XHwIcap_DeviceWriteFrames(XHwIcap *InstancePtr, long Top,
+				long Block, long HClkRow,
+				long MajorFrame, long MinorFrame,
+				u32 NumFrames, u32 *FrameData);
 
 /************************** Variable Declarations ***************************/
 
@@ -10,8 +10,8 @@
 * @addtogroup hwicap_v11_4
 * @{
 *
-* This file contains the function that reads a specified frame from the
-* device (ICAP) and stores it in the memory specified by the user.
+* This file contains the functions that read specified frames from the
+* device (ICAP) and store them in the memory specified by the user.
 *
 * @note none.
 *
@@ -29,6 +29,8 @@
 * 6.00a hvm  08/01/11 Added support for K7
 * 10.0  bss  6/24/14  Removed support for families older than 7 series
 * 11.0  MNK  6/12/14  Added support for 8-series family devices.
+* 11.4  ag   10/15/26 Added XHwIcap_DeviceReadFrames to read consecutive
+*		      frames with a single FAR setup and FDRO packet.
 *
 * </pre>
 *
@@ -79,6 +81,41 @@ int XHwIcap_DeviceReadFrame(XHwIcap *InstancePtr, long Top, long Block,
 				long HClkRow, long MajorFrame, long MinorFrame,
 				u32 *FrameBuffer)
 {
+	return XHwIcap_DeviceReadFrames(InstancePtr, Top, Block, HClkRow,
+					MajorFrame, MinorFrame, 1, FrameBuffer);
+}
+
+/****************************************************************************/
+/**
+*
+* Reads consecutive frames from the device and puts them in memory specified
+* by the user. The FAR is set up once and the frames are read in a single
+* FDRO packet, which is what a scrubbing pass over a region needs.
+*
+* @param	InstancePtr - a pointer to the XHwIcap instance to be worked on.
+* @param	Top - top (0) or bottom (1) half of device
+* @param	Block - Block Address (XHI_FAR_CLB_BLOCK,
+*		XHI_FAR_BRAM_BLOCK, XHI_FAR_BRAM_INT_BLOCK)
+* @param	HClkRow - selects the HClk Row
+* @param	MajorFrame - selects the column
+* @param	MinorFrame - selects the first frame inside column
+* @param	NumFrames is the number of frames to read.
+* @param	FrameBuffer is a pointer to the memory where the frames read
+*		from the device are stored. The NumFrames frames are preceded
+*		by the pad frame, and followed by the extra words of the
+*		UltraScale families, as for XHwIcap_DeviceReadFrame.
+*
+* @return	XST_SUCCESS else XST_FAILURE.
+*
+* @note		This is a blocking call.
+*		With a DMA handler set (XHwIcap_SetDmaHandler) the frame data
+*		is moved from the Read FIFO by the DMA.
+*
+*****************************************************************************/
+int XHwIcap_DeviceReadFrames(XHwIcap *InstancePtr, long Top, long Block,
+				long HClkRow, long MajorFrame, long MinorFrame,
+				u32 NumFrames, u32 *FrameBuffer)
+{
 
 	u32 Packet;
 	u32 Data;
@@ -91,6 +128,7 @@ int XHwIcap_DeviceReadFrame(XHwIcap *InstancePtr, long Top, long Block,
 	Xil_AssertNonvoid(InstancePtr != NULL);
 	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
 	Xil_AssertNonvoid(FrameBuffer != NULL);
+	Xil_AssertNonvoid(NumFrames > 0);
 
 	/*
 	 * DUMMY and SYNC
@@ -138,15 +176,18 @@ int XHwIcap_DeviceReadFrame(XHwIcap *InstancePtr, long Top, long Block,
 	 */
 	switch (InstancePtr->DeviceFamily) {
 		case DEVICE_TYPE_7SERIES :
-				TotalWords = InstancePtr->WordsPerFrame << 1;
+				TotalWords = InstancePtr->WordsPerFrame *
+						(NumFrames + 1);
 				NumNoops = 32;
 				break;
 		case DEVICE_TYPE_ULTRA :
-			TotalWords = (InstancePtr->WordsPerFrame << 1) + 10;
+			TotalWords = (InstancePtr->WordsPerFrame *
+					(NumFrames + 1)) + 10;
 			NumNoops = 64;
 				break;
 		case DEVICE_TYPE_ULTRA_PLUS :
-			TotalWords = (InstancePtr->WordsPerFrame << 1) + 25;
+			TotalWords = (InstancePtr->WordsPerFrame *
+					(NumFrames + 1)) + 25;
 			NumNoops = 64;
 				break;
 		default:
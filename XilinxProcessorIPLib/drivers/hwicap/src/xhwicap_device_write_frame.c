@@ -10,7 +10,7 @@
 * @addtogroup hwicap_v11_4
 * @{
 *
-* This file contains the function that writes the frame stored in the
+* This file contains the functions that write the frames stored in the
 * memory to the device (ICAP).
 *
 * @note none.
@@ -30,7 +30,8 @@
 *		      (CR560534)
 * 6.00a hvm  08/01/11 Added support for K7
 * 10.0  bss  6/24/14  Removed support for families older than 7 series
-*
+* 11.4  ag   10/15/26 Added XHwIcap_DeviceWriteFrames to write consecutive
+*		      frames with a single FAR setup and FDRI packet.
 *
 * </pre>
 *
@@ -85,6 +86,42 @@ int XHwIcap_DeviceWriteFrame(XHwIcap *InstancePtr, long Top, long Block,
 				long HClkRow, long MajorFrame, long MinorFrame,
 				u32 *FrameData)
 {
+	return XHwIcap_DeviceWriteFrames(InstancePtr, Top, Block, HClkRow,
+					MajorFrame, MinorFrame, 1, FrameData);
+}
+
+/****************************************************************************/
+/**
+*
+* Writes consecutive frames from the specified buffer and puts them in the
+* device (ICAP). The FAR is set up once and the frames are sent in a single
+* FDRI packet, the FAR of the device incrementing after each frame.
+*
+* @param	InstancePtr is a pointer to the XHwIcap instance.
+* @param	Top - top (0) or bottom (1) half of device
+* @param	Block - Block Address (XHI_FAR_CLB_BLOCK,
+* 		XHI_FAR_BRAM_BLOCK, XHI_FAR_BRAM_INT_BLOCK)
+* @param	HClkRow - selects the HClk Row
+* @param	MajorFrame - selects the column
+* @param	MinorFrame - selects the first frame inside column
+* @param	NumFrames is the number of frames to write.
+* @param	FrameData is a pointer to the pad frame followed by the
+*		NumFrames frames that are to be written to the device.
+*
+* @return	XST_SUCCESS else XST_FAILURE.
+*
+* @note		This is a blocking function.
+*		This function is used in conjunction with the function
+*		XHwIcap_DeviceReadFrames, to write back the frames of data
+*		read using XHwIcap_DeviceReadFrames, in the same layout.
+*		With a DMA handler set (XHwIcap_SetDmaHandler) the frame data
+*		is moved to the Write FIFO by the DMA.
+*
+*****************************************************************************/
+int XHwIcap_DeviceWriteFrames(XHwIcap *InstancePtr, long Top, long Block,
+				long HClkRow, long MajorFrame, long MinorFrame,
+				u32 NumFrames, u32 *FrameData)
+{
 
 	u32 Packet;
 	u32 Data;
@@ -96,6 +133,7 @@ int XHwIcap_DeviceWriteFrame(XHwIcap *InstancePtr, long Top, long Block,
 	Xil_AssertNonvoid(InstancePtr != NULL);
 	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
 	Xil_AssertNonvoid(FrameData != NULL);
+	Xil_AssertNonvoid(NumFrames > 0);
 
 
 	/*
@@ -150,7 +188,7 @@ int XHwIcap_DeviceWriteFrame(XHwIcap *InstancePtr, long Top, long Block,
 	/*
 	 * Setup Packet header.
 	 */
-	TotalWords = InstancePtr->WordsPerFrame << 1;
+	TotalWords = InstancePtr->WordsPerFrame * (NumFrames + 1);
 	if (TotalWords < XHI_TYPE_1_PACKET_MAX_WORDS)  {
 		/*
 		 * Create Type 1 Packet.
@@ -184,7 +222,7 @@ int XHwIcap_DeviceWriteFrame(XHwIcap *InstancePtr, long Top, long Block,
 	 */
 	Status = XHwIcap_DeviceWrite(InstancePtr,
 				(u32 *) &FrameData[InstancePtr->WordsPerFrame],
-				InstancePtr->WordsPerFrame);
+				InstancePtr->WordsPerFrame * NumFrames);
 	if (Status != XST_SUCCESS) {
 		return XST_FAILURE;
 	}
@@ -45,6 +45,7 @@
 *                     Updated XHI_NUM_FRAME_BYTES to 404
 *                     Updated XHI_NUM_FRAME_WORDS to 101
 *                     Updated XHI_NUM_WORDS_FRAME_INCL_NULL_FRAME to 202
+* 11.4  ag   10/15/26 Added XHI_DMA_MIN_WORDS
 *
 * </pre>
 *
@@ -221,6 +222,12 @@ extern "C" {
  */
 #define XHI_MAX_RETRIES			1000
 
+/*
+ * Transfers shorter than this number of words are done by the processor
+ * even when a DMA handler is set
+ */
+#define XHI_DMA_MIN_WORDS		64
+
 /*
  * Mask for the Device ID read from the ID code Register
  */
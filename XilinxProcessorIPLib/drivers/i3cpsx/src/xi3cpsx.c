@@ -18,6 +18,7 @@
 * Ver   Who  Date     Changes
 * ----- ---  -------- ---------------------------------------------
 * 1.00 	sd   11/21/21 First release
+* 1.00 	ag   10/15/26 Initialize the IBI queue
 * </pre>
 *
 ******************************************************************************/
@@ -45,6 +46,9 @@ s32 XI3cPsx_CfgInitialize(XI3cPsx *InstancePtr, XI3cPsx_Config *ConfigPtr,
 	InstancePtr->Config.DeviceId = ConfigPtr->DeviceId;
 	InstancePtr->Config.BaseAddress = EffectiveAddr;
 	InstancePtr->Config.DeviceCount = 2;
+	InstancePtr->IbiHead = 0U;
+	InstancePtr->IbiTail = 0U;
+	InstancePtr->IbiDropped = 0U;
 
 	/* Indicate the instance is now ready to use, initialized without error */
 	InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
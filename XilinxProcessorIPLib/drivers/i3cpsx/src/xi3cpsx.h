@@ -62,12 +62,28 @@
 * - Transfer complete
 * - More Data
 * - Error
+* - In-band interrupt (IBI) status threshold
+*
+* <b>Queued Transfers</b>
+*
+* XI3cPsx_MasterXferPolled() takes a list of SDR and HDR-DDR transfers. The
+* command queue is kept filled while earlier transfers run, and the data
+* FIFOs are moved in bursts sized from the FIFO level registers. Each
+* transfer gets its actual length and error from its response.
+*
+* <b>In-band Interrupts</b>
+*
+* IBIs accepted by the controller are moved from the IBI queue of the
+* controller to a software queue of XI3CPSX_IBI_QUEUE_LEN entries by the
+* interrupt handler or XI3cPsx_IbiPoll(), with a timestamp taken when they
+* are moved. The application takes them with XI3cPsx_IbiGet().
 *
 * <pre> MODIFICATION HISTORY:
 *
 * Ver   Who     Date     Changes
 * ----- ------  -------- -----------------------------------------------
 * 1.00  sd  06/10/22 First release
+* 1.00  ag  10/15/26 Added HDR-DDR and queued transfers, and IBI queue
 * </pre>
 *
 ******************************************************************************/
@@ -108,6 +124,7 @@ extern "C" {
 #define XI3CPSX_EVENT_TRANSF_ABORT		0x0008U  /**< Transfer abort */
 #define XI3CPSX_EVENT_SLV_WR_NACK		0x0009U  /**< I2C Slave write data NACK */
 #define XI3CPSX_EVENT_PEC			0x000CU  /**< PEC */
+#define XI3CPSX_EVENT_IBI			0x0010U  /**< IBI queued */
 
 /** @} */
 
@@ -127,6 +144,25 @@ extern "C" {
 
 #define XI3CPSX_DATA_LEN			0x00FFU  /**< Data length */
 #define XI3CPSX_TRANSFER_ERROR			0xF0000000U  /**< Error */
+
+/** @name Transfer speeds
+ *
+ * Speed of a transfer in the command, XI3cPsx_Xfer.Speed.
+ * @{
+ */
+#define XI3CPSX_SPEED_SDR0		0U  /**< SDR, fastest */
+#define XI3CPSX_SPEED_SDR1		1U  /**< SDR, 8 MHz */
+#define XI3CPSX_SPEED_SDR2		2U  /**< SDR, 6 MHz */
+#define XI3CPSX_SPEED_SDR3		3U  /**< SDR, 4 MHz */
+#define XI3CPSX_SPEED_SDR4		4U  /**< SDR, 2 MHz */
+#define XI3CPSX_SPEED_HDR_DDR		6U  /**< HDR double data rate */
+/** @} */
+
+#define XI3CPSX_MAX_XFER_LEN		0xFFFFU	/**< Max length of a transfer */
+#define XI3CPSX_HDR_READ_CMD		0x80U	/**< Read bit of HDR commands */
+
+#define XI3CPSX_IBI_QUEUE_LEN		16U	/**< IBIs kept, power of 2 */
+#define XI3CPSX_IBI_MAX_PAYLOAD		16U	/**< Payload bytes kept */
 /**************************** Type Definitions *******************************/
 
 /**
@@ -167,6 +203,32 @@ typedef struct {
 	u8 Data_FD;
 } XI3cPsx_Master_Caps;
 
+/**
+ * This typedef describes a transfer of XI3cPsx_MasterXferPolled().
+ */
+typedef struct {
+	u8 *Buf;	/**< Data to write or buffer to read to */
+	u16 Len;	/**< Bytes to transfer */
+	u16 ActualLen;	/**< Bytes transferred, set from the response */
+	u8 DevIndex;	/**< Index of the target in the device address table */
+	u8 Speed;	/**< XI3CPSX_SPEED_* */
+	u8 HdrCmd;	/**< HDR command code, for HDR transfers only */
+	u8 IsRead;	/**< Non zero for a read */
+	u8 Error;	/**< RESPONSE_ERROR_* of the transfer */
+} XI3cPsx_Xfer;
+
+/**
+ * This typedef contains an in-band interrupt taken from the IBI queue.
+ */
+typedef struct {
+	u64 Timestamp;	/**< Time the IBI was queued by the driver */
+	u8 Addr;	/**< Dynamic address of the requester */
+	u8 IsRead;	/**< RnW bit of the IBI, set for SIRs */
+	u8 Nacked;	/**< Non zero if the controller rejected the IBI */
+	u8 Len;		/**< Payload bytes, may exceed the kept payload */
+	u8 Payload[XI3CPSX_IBI_MAX_PAYLOAD]; /**< Payload */
+} XI3cPsx_IbiEntry;
+
 struct CmdInfo
 {
 	u8 Cmd;
@@ -202,6 +264,11 @@ typedef struct {
 
 	XI3cPsx_IntrHandler StatusHandler;  /**< Event handler function */
 	void *CallBackRef;	/**< Callback reference for event handler */
+
+	XI3cPsx_IbiEntry IbiQueue[XI3CPSX_IBI_QUEUE_LEN]; /**< Queued IBIs */
+	volatile u32 IbiHead;	/**< Count of IBIs queued */
+	volatile u32 IbiTail;	/**< Count of IBIs taken */
+	u32 IbiDropped;		/**< IBIs lost because the queue was full */
 } XI3cPsx;
 
 /************************** Variable Definitions *****************************/
@@ -300,6 +367,19 @@ s32 XI3cPsx_MasterRecvPolled(XI3cPsx *InstancePtr, u8 *MsgPtr, s32 ByteCount,
 		 XI3cPsx_Cmd *Cmd);
 void XI3cPsx_MasterInterruptHandler(XI3cPsx *InstancePtr);
 
+/*
+ * Functions for queued transfers, in xi3cpsx_xfer.c
+ */
+s32 XI3cPsx_MasterXferPolled(XI3cPsx *InstancePtr, XI3cPsx_Xfer *Xfers,
+			     u32 NumXfers);
+
+/*
+ * Functions for in-band interrupts, in xi3cpsx_ibi.c
+ */
+s32 XI3cPsx_IbiEnable(XI3cPsx *InstancePtr, u8 DynAddr, u8 Enable);
+u32 XI3cPsx_IbiPoll(XI3cPsx *InstancePtr);
+s32 XI3cPsx_IbiGet(XI3cPsx *InstancePtr, XI3cPsx_IbiEntry *EntryPtr);
+
 /*
  * Functions for device as slave, in XI3cPsx_slave.c
  */
@@ -0,0 +1,225 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xi3cpsx_ibi.c
+* @addtogroup Overview
+* @{
+*
+* Handles in-band interrupts (IBI) in master mode.
+*
+* The IBI queue of the controller is small. IBIs are moved from it to a
+* software queue in the instance as soon as the IBI status threshold is
+* reached, from the interrupt handler or XI3cPsx_IbiPoll(), and are time
+* stamped when moved. The software queue has a single producer and a single
+* consumer, so it is not locked.
+*
+* <pre> MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---  -------- ---------------------------------------------
+* 1.00  ag   10/15/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <string.h>
+#include "xi3cpsx.h"
+#include "xi3cpsx_pr.h"
+#if defined(__aarch64__) || defined(__arm__)
+#include "xtime_l.h"
+#endif
+
+/************************** Constant Definitions *****************************/
+
+#define XI3CPSX_IBI_REJECT_BITS		32U	/**< Bits of IBI_SIR_REQ_REJECT */
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+/************************* Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+* Returns the time used to stamp IBIs.
+*
+* @return	Global timer count, 0 if the processor has no global timer.
+*
+****************************************************************************/
+static u64 XI3cPsx_IbiTimestamp(void)
+{
+#if defined(__aarch64__) || defined(__arm__)
+	XTime Time;
+
+	XTime_GetTime(&Time);
+	return (u64)Time;
+#else
+	return 0U;
+#endif
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function makes the controller accept or reject the slave interrupt
+* requests (SIR) of a device, and enables the IBI threshold interrupt.
+*
+* @param	InstancePtr is a pointer to the XI3cPsx instance.
+* @param	DynAddr is the dynamic address of the device.
+* @param	Enable is non zero to accept the SIRs of the device.
+*
+* @return	XST_SUCCESS.
+*
+* @note		The events of the device must be enabled with the ENEC CCC.
+*		Devices whose addresses map to the same reject bit are
+*		accepted or rejected together.
+*
+****************************************************************************/
+s32 XI3cPsx_IbiEnable(XI3cPsx *InstancePtr, u8 DynAddr, u8 Enable)
+{
+	u32 Bit;
+	u32 Reg;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+
+	/* The reject bit is the sum of address bits 6:5 and 4:0 */
+	Bit = (((u32)DynAddr >> 5U) + ((u32)DynAddr & 0x1FU)) %
+		XI3CPSX_IBI_REJECT_BITS;
+	Reg = XI3cPsx_ReadReg(InstancePtr->Config.BaseAddress,
+			      XI3CPSX_IBI_SIR_REQ_REJECT);
+	if (Enable != 0U) {
+		Reg &= ~BIT(Bit);
+	} else {
+		Reg |= BIT(Bit);
+	}
+	XI3cPsx_WriteReg(InstancePtr->Config.BaseAddress,
+			 XI3CPSX_IBI_SIR_REQ_REJECT, Reg);
+
+	Reg = XI3cPsx_ReadReg(InstancePtr->Config.BaseAddress,
+			      XI3CPSX_INTR_STATUS_EN);
+	XI3cPsx_WriteReg(InstancePtr->Config.BaseAddress, XI3CPSX_INTR_STATUS_EN,
+			 Reg | XI3CPSX_INTR_STATUS_EN_IBI_THLD_STS_EN_MASK);
+	Reg = XI3cPsx_ReadReg(InstancePtr->Config.BaseAddress,
+			      XI3CPSX_INTR_SIGNAL_EN);
+	XI3cPsx_WriteReg(InstancePtr->Config.BaseAddress, XI3CPSX_INTR_SIGNAL_EN,
+			 Reg | XI3CPSX_INTR_SIGNAL_EN_IBI_THLD_SIGNAL_EN_MASK);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function moves the IBIs of the IBI queue of the controller to the
+* software queue. It is called by the interrupt handler, and can be called
+* to poll for IBIs when the interrupt is not used.
+*
+* @param	InstancePtr is a pointer to the XI3cPsx instance.
+*
+* @return	Number of IBIs queued.
+*
+* @note		IBIs that do not fit in the software queue are counted in
+*		IbiDropped. Payload bytes beyond XI3CPSX_IBI_MAX_PAYLOAD are
+*		discarded.
+*
+****************************************************************************/
+u32 XI3cPsx_IbiPoll(XI3cPsx *InstancePtr)
+{
+	XI3cPsx_IbiEntry *EntryPtr;
+	u32 NumIbi;
+	u32 Status;
+	u32 Data;
+	u32 Len;
+	u32 Index;
+	u32 Count = 0U;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+
+	NumIbi = XI3cPsx_ReadReg(InstancePtr->Config.BaseAddress,
+				 XI3CPSX_QUEUE_STATUS_LEVEL);
+	NumIbi = (NumIbi & XI3CPSX_QUEUE_STATUS_LEVEL_IBI_STS_CNT_MASK) >>
+		XI3CPSX_QUEUE_STATUS_LEVEL_IBI_STS_CNT_SHIFT;
+
+	while (NumIbi-- > 0U) {
+		Status = XI3cPsx_ReadReg(InstancePtr->Config.BaseAddress,
+					 XI3CPSX_IBI_QUEUE_STATUS);
+		Len = IBI_QUEUE_STATUS_DATA_LEN(Status);
+
+		if ((InstancePtr->IbiHead - InstancePtr->IbiTail) >=
+		    XI3CPSX_IBI_QUEUE_LEN) {
+			EntryPtr = NULL;
+			InstancePtr->IbiDropped++;
+		} else {
+			EntryPtr = &InstancePtr->IbiQueue[InstancePtr->IbiHead &
+					(XI3CPSX_IBI_QUEUE_LEN - 1U)];
+			EntryPtr->Timestamp = XI3cPsx_IbiTimestamp();
+			EntryPtr->Addr = (u8)(IBI_QUEUE_STATUS_ID(Status) >> 1U);
+			EntryPtr->IsRead = (u8)(IBI_QUEUE_STATUS_ID(Status) & 1U);
+			EntryPtr->Nacked = (u8)((Status &
+					IBI_QUEUE_STATUS_NACK) != 0U);
+			EntryPtr->Len = (u8)Len;
+		}
+
+		/* The payload follows its status in the IBI queue */
+		for (Index = 0U; Index < Len; Index += 4U) {
+			Data = XI3cPsx_ReadReg(InstancePtr->Config.BaseAddress,
+					       XI3CPSX_IBI_QUEUE_STATUS);
+			if ((EntryPtr != NULL) &&
+			    (Index < XI3CPSX_IBI_MAX_PAYLOAD)) {
+				(void)memcpy(&EntryPtr->Payload[Index], &Data,
+					     ((Len - Index) < 4U) ?
+					     (Len - Index) : 4U);
+			}
+		}
+
+		if (EntryPtr != NULL) {
+			InstancePtr->IbiHead++;
+			Count++;
+		}
+	}
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function takes the oldest IBI from the software queue.
+*
+* @param	InstancePtr is a pointer to the XI3cPsx instance.
+* @param	EntryPtr is filled with the IBI.
+*
+* @return
+*		- XST_SUCCESS if an IBI is returned.
+*		- XST_NO_DATA if the queue is empty.
+*
+****************************************************************************/
+s32 XI3cPsx_IbiGet(XI3cPsx *InstancePtr, XI3cPsx_IbiEntry *EntryPtr)
+{
+	u32 Tail;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(EntryPtr != NULL);
+
+	Tail = InstancePtr->IbiTail;
+	if (Tail == InstancePtr->IbiHead) {
+		return XST_NO_DATA;
+	}
+
+	*EntryPtr = InstancePtr->IbiQueue[Tail & (XI3CPSX_IBI_QUEUE_LEN - 1U)];
+	InstancePtr->IbiTail = Tail + 1U;
+
+	return XST_SUCCESS;
+}
+/** @} */
@@ -17,6 +17,7 @@
 * Ver   Who  Date     Changes
 * ----- ---  -------- ---------------------------------------------
 * 1.00  sd  06/10/22 First release
+* 1.00  ag  10/15/26 Queue IBIs from the interrupt handler
 * </pre>
 *
 ******************************************************************************/
@@ -452,6 +453,19 @@ void XI3cPsx_MasterInterruptHandler(XI3cPsx *InstancePtr)
 	 */
 	XI3cPsx_WriteReg(InstancePtr->Config.BaseAddress, (u32)XI3CPSX_INTR_STATUS, IntrStatusReg);
 
+	/* Move IBIs to the software queue before they fill the IBI queue */
+	if ((IntrStatusReg & XI3CPSX_INTR_STATUS_IBI_THLD_STS_MASK) != 0U) {
+		if ((XI3cPsx_IbiPoll(InstancePtr) != 0U) &&
+		    (InstancePtr->StatusHandler != NULL)) {
+			InstancePtr->StatusHandler(InstancePtr->CallBackRef,
+						   XI3CPSX_EVENT_IBI);
+		}
+		if ((IntrStatusReg & (XI3CPSX_INTR_STATUS_RESP_READY_STS_MASK |
+				      XI3CPSX_INTR_STATUS_TRANSFER_ERR_STS_MASK)) == 0U) {
+			return;
+		}
+	}
+
 	Rbuf_level = XI3cPsx_ReadReg(InstancePtr->Config.BaseAddress,
 					XI3CPSX_QUEUE_STATUS_LEVEL);
 
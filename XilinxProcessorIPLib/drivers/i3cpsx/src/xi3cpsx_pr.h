@@ -85,6 +85,7 @@
 #define COMMAND_PORT_CP			BIT(15)
 #define COMMAND_PORT_CMD(x)		((x) << 7)
 #define COMMAND_PORT_TID(x)		((x) << 3)
+#define COMMAND_PORT_TID_MASK		0xFU
 
 #define COMMAND_PORT_ARG_DATA_LEN(x)	((x) << 16)
 #define COMMAND_PORT_ARG_DATA_LEN_MAX	65536
@@ -114,6 +115,10 @@
 #define RESPONSE_PORT_TID(x)		(((x) & GENMASK(27, 24)) >> 24)
 #define RESPONSE_PORT_DATA_LEN(x)	((x) & 0xFFFF)
 
+#define IBI_QUEUE_STATUS_NACK		BIT(31)
+#define IBI_QUEUE_STATUS_ID(x)		(((x) & GENMASK(15, 8)) >> 8)
+#define IBI_QUEUE_STATUS_DATA_LEN(x)	((x) & GENMASK(7, 0))
+
 
 #define SCL_I3C_TIMING_HCNT(x)		(((x) << 16) & GENMASK(23, 16))
 #define SCL_I3C_TIMING_LCNT(x)		((x) & GENMASK(7, 0))
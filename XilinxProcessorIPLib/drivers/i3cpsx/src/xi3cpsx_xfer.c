@@ -0,0 +1,490 @@
+/******************************************************************************
+* Copyright (C) 2026 Advanced Micro Devices, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xi3cpsx_xfer.c
+* @addtogroup Overview
+* @{
+*
+* Handles queued SDR and HDR-DDR transfers in master mode.
+*
+* Transfers are submitted while the command queue has room, so the controller
+* goes from one transfer to the next without waiting for the processor. The
+* data of a transfer that fits in the FIFOs is moved in one burst: writes
+* before their command, reads when their response is taken. A transfer larger
+* than a FIFO is only started when the queue is empty, and nothing is queued
+* behind it, so that its data can be streamed as the FIFO level allows.
+*
+* <pre> MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---  -------- ---------------------------------------------
+* 1.00  ag   10/15/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <string.h>
+#include "xi3cpsx.h"
+#include "xi3cpsx_pr.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XI3CPSX_XFER_MAX_LOOPCNT	1000000U /**< Polls without progress */
+#define XI3CPSX_DEV_INDEX_MAX		32U	/**< Entries the command can
+						  *  address */
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * State of a list of transfers
+ */
+typedef struct {
+	XI3cPsx_Xfer *Xfers;	/**< Transfers */
+	u32 NumXfers;		/**< Number of transfers */
+	u32 Submitted;		/**< Transfers whose command is queued */
+	u32 Completed;		/**< Transfers whose response is taken */
+	u32 RxQueued;		/**< RX FIFO words of queued reads */
+	u32 RxDepth;		/**< RX FIFO depth in words */
+	u32 TxDepth;		/**< TX FIFO depth in words */
+	u32 Streamed;		/**< Bytes moved of a large transfer */
+	u8 Large;		/**< A transfer larger than a FIFO runs */
+} XI3cPsx_XferList;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/* FIFO sizes in QUEUE_SIZE_CAPABILITY are 2^(N + 1) words */
+#define XI3CPSX_FIFO_WORDS(Val)		((u32)1U << ((Val) + 1U))
+#define XI3CPSX_WORDS(Bytes)		(((u32)(Bytes) + 3U) >> 2U)
+
+/************************** Function Prototypes ******************************/
+
+/************************* Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+* Writes bytes of a buffer to the TX FIFO, the last word zero padded.
+*
+* @param	InstancePtr is a pointer to the XI3cPsx instance.
+* @param	Buf is the data.
+* @param	Len is the number of bytes.
+*
+* @return	None.
+*
+****************************************************************************/
+static void XI3cPsx_XferWrFifo(XI3cPsx *InstancePtr, const u8 *Buf, u32 Len)
+{
+	u32 Val;
+	u32 Index;
+
+	for (Index = 0U; (Index + 4U) <= Len; Index += 4U) {
+		(void)memcpy(&Val, &Buf[Index], 4U);
+		XI3cPsx_WriteReg(InstancePtr->Config.BaseAddress,
+				 XI3CPSX_TX_RX_DATA_PORT, Val);
+	}
+	if (Index < Len) {
+		Val = 0U;
+		(void)memcpy(&Val, &Buf[Index], Len - Index);
+		XI3cPsx_WriteReg(InstancePtr->Config.BaseAddress,
+				 XI3CPSX_TX_RX_DATA_PORT, Val);
+	}
+}
+
+/*****************************************************************************/
+/**
+* Reads bytes from the RX FIFO to a buffer, the last word is truncated.
+*
+* @param	InstancePtr is a pointer to the XI3cPsx instance.
+* @param	Buf is the buffer.
+* @param	Len is the number of bytes.
+*
+* @return	None.
+*
+****************************************************************************/
+static void XI3cPsx_XferRdFifo(XI3cPsx *InstancePtr, u8 *Buf, u32 Len)
+{
+	u32 Val;
+	u32 Index;
+
+	for (Index = 0U; (Index + 4U) <= Len; Index += 4U) {
+		Val = XI3cPsx_ReadReg(InstancePtr->Config.BaseAddress,
+				      XI3CPSX_TX_RX_DATA_PORT);
+		(void)memcpy(&Buf[Index], &Val, 4U);
+	}
+	if (Index < Len) {
+		Val = XI3cPsx_ReadReg(InstancePtr->Config.BaseAddress,
+				      XI3CPSX_TX_RX_DATA_PORT);
+		(void)memcpy(&Buf[Index], &Val, Len - Index);
+	}
+}
+
+/*****************************************************************************/
+/**
+* Checks a transfer and builds its command.
+*
+* @param	InstancePtr is a pointer to the XI3cPsx instance.
+* @param	Xfer is the transfer.
+* @param	Tid is the transaction id of the command.
+* @param	IsLast is non zero for the last transfer of the list.
+* @param	Cmd is filled with the command.
+*
+* @return
+*		- XST_SUCCESS if the transfer is valid.
+*		- XST_INVALID_PARAM if the transfer is not valid.
+*		- XST_NO_FEATURE if HDR-DDR is not supported.
+*
+****************************************************************************/
+static s32 XI3cPsx_XferBuildCmd(XI3cPsx *InstancePtr, const XI3cPsx_Xfer *Xfer,
+				u32 Tid, u8 IsLast, XI3cPsx_Cmd *Cmd)
+{
+	u32 HwCaps;
+
+	if ((Xfer->Buf == NULL) || (Xfer->Len == 0U) ||
+	    (Xfer->DevIndex >= XI3CPSX_DEV_INDEX_MAX)) {
+		return XST_INVALID_PARAM;
+	}
+
+	Cmd->TransCmd = COMMAND_PORT_ARG_DATA_LEN((u32)Xfer->Len) |
+			COMMAND_PORT_TRANSFER_ARG;
+	Cmd->TransArg = COMMAND_PORT_SPEED((u32)Xfer->Speed) |
+			COMMAND_PORT_DEV_INDEX((u32)Xfer->DevIndex) |
+			COMMAND_PORT_TID(Tid) | COMMAND_PORT_ROC;
+	if (Xfer->IsRead != 0U) {
+		Cmd->TransArg |= COMMAND_PORT_READ_TRANSFER;
+	}
+	if (IsLast != 0U) {
+		Cmd->TransArg |= COMMAND_PORT_TOC;
+	}
+
+	if (Xfer->Speed == XI3CPSX_SPEED_HDR_DDR) {
+		HwCaps = XI3cPsx_ReadReg(InstancePtr->Config.BaseAddress,
+					 XI3CPSX_HW_CAPABILITY);
+		if ((HwCaps & XI3CPSX_HW_CAPABILITY_HDR_DDR_EN_MASK) == 0U) {
+			return XST_NO_FEATURE;
+		}
+		/* HDR-DDR moves 16 bit words */
+		if ((Xfer->Len & 1U) != 0U) {
+			return XST_INVALID_PARAM;
+		}
+		/* The read bit of the HDR command gives the direction */
+		if (Xfer->IsRead != 0U) {
+			Cmd->TransArg |= COMMAND_PORT_CMD((u32)Xfer->HdrCmd |
+						XI3CPSX_HDR_READ_CMD);
+		} else {
+			Cmd->TransArg |= COMMAND_PORT_CMD((u32)Xfer->HdrCmd &
+						~XI3CPSX_HDR_READ_CMD);
+		}
+		Cmd->TransArg |= COMMAND_PORT_CP;
+	} else if (Xfer->Speed > XI3CPSX_SPEED_SDR4) {
+		return XST_INVALID_PARAM;
+	} else {
+		/* SDR private transfer */
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Queues the commands of the list while the command queue and the FIFOs have
+* room.
+*
+* @param	InstancePtr is a pointer to the XI3cPsx instance.
+* @param	List is the state of the list.
+*
+* @return	Number of commands queued.
+*
+****************************************************************************/
+static u32 XI3cPsx_XferSubmit(XI3cPsx *InstancePtr, XI3cPsx_XferList *List)
+{
+	XI3cPsx_Xfer *Xfer;
+	XI3cPsx_Cmd Cmd;
+	u32 QueueLevel;
+	u32 TxEmpty;
+	u32 Words;
+	u32 Count = 0U;
+
+	while ((List->Submitted < List->NumXfers) && (List->Large == 0U)) {
+		Xfer = &List->Xfers[List->Submitted];
+		Words = XI3CPSX_WORDS(Xfer->Len);
+
+		QueueLevel = XI3cPsx_ReadReg(InstancePtr->Config.BaseAddress,
+					     XI3CPSX_QUEUE_STATUS_LEVEL);
+		/* A command is an argument and a command word */
+		if (((QueueLevel & XI3CPSX_QUEUE_STATUS_LEVEL_CMD_QUEUE_EMPTY_LOC_MASK) >>
+		     XI3CPSX_QUEUE_STATUS_LEVEL_CMD_QUEUE_EMPTY_LOC_SHIFT) < 2U) {
+			break;
+		}
+
+		if (Xfer->IsRead != 0U) {
+			if (Words > List->RxDepth) {
+				if (List->Submitted != List->Completed) {
+					break;
+				}
+				List->Large = 1U;
+			} else if ((List->RxQueued + Words) > List->RxDepth) {
+				break;
+			} else {
+				List->RxQueued += Words;
+			}
+		} else {
+			TxEmpty = XI3cPsx_ReadReg(InstancePtr->Config.BaseAddress,
+						  XI3CPSX_DATA_BUFFER_STATUS_LEVEL);
+			TxEmpty = (TxEmpty & XI3CPSX_DATA_BUFFER_STATUS_LEVEL_TX_BUF_EMPTY_LOC_MASK) >>
+				XI3CPSX_DATA_BUFFER_STATUS_LEVEL_TX_BUF_EMPTY_LOC_SHIFT;
+			if (Words > List->TxDepth) {
+				if (List->Submitted != List->Completed) {
+					break;
+				}
+				/* Prime the FIFO, the rest is streamed */
+				List->Large = 1U;
+				XI3cPsx_XferWrFifo(InstancePtr, Xfer->Buf,
+						   TxEmpty << 2U);
+				List->Streamed = TxEmpty << 2U;
+			} else if (Words > TxEmpty) {
+				break;
+			} else {
+				XI3cPsx_XferWrFifo(InstancePtr, Xfer->Buf,
+						   Xfer->Len);
+			}
+		}
+
+		(void)XI3cPsx_XferBuildCmd(InstancePtr, Xfer,
+				List->Submitted & COMMAND_PORT_TID_MASK,
+				(List->Submitted + 1U) == List->NumXfers, &Cmd);
+		XI3cPsx_WriteReg(InstancePtr->Config.BaseAddress,
+				 XI3CPSX_COMMAND_QUEUE_PORT, Cmd.TransCmd);
+		XI3cPsx_WriteReg(InstancePtr->Config.BaseAddress,
+				 XI3CPSX_COMMAND_QUEUE_PORT, Cmd.TransArg);
+		List->Submitted++;
+		Count++;
+	}
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+* Moves the data of a transfer larger than the FIFO, as far as the FIFO level
+* allows.
+*
+* @param	InstancePtr is a pointer to the XI3cPsx instance.
+* @param	List is the state of the list.
+*
+* @return	Number of bytes moved.
+*
+****************************************************************************/
+static u32 XI3cPsx_XferStream(XI3cPsx *InstancePtr, XI3cPsx_XferList *List)
+{
+	XI3cPsx_Xfer *Xfer = &List->Xfers[List->Completed];
+	u32 Level;
+	u32 Bytes;
+
+	Level = XI3cPsx_ReadReg(InstancePtr->Config.BaseAddress,
+				XI3CPSX_DATA_BUFFER_STATUS_LEVEL);
+	if (Xfer->IsRead != 0U) {
+		/* Whole words only, the tail is read with the response */
+		Bytes = ((Level & XI3CPSX_DATA_BUFFER_STATUS_LEVEL_RX_BUF_BLR_MASK) >>
+			 XI3CPSX_DATA_BUFFER_STATUS_LEVEL_RX_BUF_BLR_SHIFT) << 2U;
+		if (Bytes > ((Xfer->Len - List->Streamed) & ~3U)) {
+			Bytes = (Xfer->Len - List->Streamed) & ~3U;
+		}
+		XI3cPsx_XferRdFifo(InstancePtr, &Xfer->Buf[List->Streamed],
+				   Bytes);
+	} else {
+		Bytes = ((Level & XI3CPSX_DATA_BUFFER_STATUS_LEVEL_TX_BUF_EMPTY_LOC_MASK) >>
+			 XI3CPSX_DATA_BUFFER_STATUS_LEVEL_TX_BUF_EMPTY_LOC_SHIFT) << 2U;
+		if (Bytes > (Xfer->Len - List->Streamed)) {
+			Bytes = Xfer->Len - List->Streamed;
+		}
+		XI3cPsx_XferWrFifo(InstancePtr, &Xfer->Buf[List->Streamed],
+				   Bytes);
+	}
+	List->Streamed += Bytes;
+
+	return Bytes;
+}
+
+/*****************************************************************************/
+/**
+* Takes the responses of completed transfers and reads their data.
+*
+* @param	InstancePtr is a pointer to the XI3cPsx instance.
+* @param	List is the state of the list.
+* @param	Count is set to the number of responses taken.
+*
+* @return
+*		- XST_SUCCESS if the transfers taken completed.
+*		- XST_FAILURE if a transfer failed.
+*
+****************************************************************************/
+static s32 XI3cPsx_XferComplete(XI3cPsx *InstancePtr, XI3cPsx_XferList *List,
+				u32 *Count)
+{
+	XI3cPsx_Xfer *Xfer;
+	u32 NumResp;
+	u32 Resp;
+	u32 Len;
+
+	NumResp = XI3cPsx_ReadReg(InstancePtr->Config.BaseAddress,
+				  XI3CPSX_QUEUE_STATUS_LEVEL);
+	NumResp = (NumResp & XI3CPSX_QUEUE_STATUS_LEVEL_RESP_BUF_BLR_MASK) >>
+		XI3CPSX_QUEUE_STATUS_LEVEL_RESP_BUF_BLR_SHIFT;
+
+	for (*Count = 0U; *Count < NumResp; (*Count)++) {
+		Xfer = &List->Xfers[List->Completed];
+		Resp = XI3cPsx_ReadReg(InstancePtr->Config.BaseAddress,
+				       XI3CPSX_RESPONSE_QUEUE_PORT);
+		Xfer->Error = (u8)RESPONSE_PORT_ERR_STATUS(Resp);
+		Xfer->ActualLen = (u16)RESPONSE_PORT_DATA_LEN(Resp);
+		if ((Xfer->Error == RESPONSE_NO_ERROR) &&
+		    (RESPONSE_PORT_TID(Resp) !=
+		     (List->Completed & COMMAND_PORT_TID_MASK))) {
+			Xfer->Error = RESPONSE_ERROR_TRANSF_ABORT;
+		}
+		if (Xfer->Error != RESPONSE_NO_ERROR) {
+			return XST_FAILURE;
+		}
+
+		if (Xfer->IsRead != 0U) {
+			Len = Xfer->ActualLen;
+			if (Len > Xfer->Len) {
+				Len = Xfer->Len;
+			}
+			if (List->Large != 0U) {
+				if (Len < List->Streamed) {
+					Len = List->Streamed;
+				}
+				XI3cPsx_XferRdFifo(InstancePtr,
+						   &Xfer->Buf[List->Streamed],
+						   Len - List->Streamed);
+			} else {
+				XI3cPsx_XferRdFifo(InstancePtr, Xfer->Buf, Len);
+				List->RxQueued -= XI3CPSX_WORDS(Xfer->Len);
+			}
+		}
+		List->Large = 0U;
+		List->Streamed = 0U;
+		List->Completed++;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function runs a list of transfers in polled mode, in master mode.
+*
+* The commands are queued as long as the command queue and the data FIFOs
+* have room, so that the transfers follow each other on the bus without
+* waiting for the processor. The transfers are separated by repeated starts,
+* the last one ends with a stop. HDR-DDR transfers make the controller enter
+* HDR-DDR mode by itself.
+*
+* @param	InstancePtr is a pointer to the XI3cPsx instance.
+* @param	Xfers is the list of transfers. ActualLen and Error of each
+*		transfer are set from its response.
+* @param	NumXfers is the number of transfers.
+*
+* @return
+*		- XST_SUCCESS if all transfers completed.
+*		- XST_INVALID_PARAM if a transfer is not valid.
+*		- XST_NO_FEATURE if HDR-DDR is not supported.
+*		- XST_FAILURE if a transfer failed. The transfers after it
+*		  have Error set to RESPONSE_ERROR_TRANSF_ABORT.
+*		- XST_TIMEOUT if the controller stopped making progress.
+*
+* @note		This routine is for polled mode transfer only. Reads shorter
+*		than requested are supported, the data read is ActualLen.
+*
+****************************************************************************/
+s32 XI3cPsx_MasterXferPolled(XI3cPsx *InstancePtr, XI3cPsx_Xfer *Xfers,
+			     u32 NumXfers)
+{
+	XI3cPsx_XferList List;
+	XI3cPsx_Cmd Cmd;
+	u32 QueueSize;
+	u32 LoopCnt = 0U;
+	u32 Count;
+	u32 Index;
+	s32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(Xfers != NULL);
+
+	/* Check the whole list before anything is queued */
+	for (Index = 0U; Index < NumXfers; Index++) {
+		Status = XI3cPsx_XferBuildCmd(InstancePtr, &Xfers[Index], 0U,
+					      0U, &Cmd);
+		if (Status != XST_SUCCESS) {
+			return Status;
+		}
+		Xfers[Index].ActualLen = 0U;
+		Xfers[Index].Error = RESPONSE_NO_ERROR;
+	}
+
+	QueueSize = XI3cPsx_ReadReg(InstancePtr->Config.BaseAddress,
+				    XI3CPSX_QUEUE_SIZE_CAPABILITY);
+	List.Xfers = Xfers;
+	List.NumXfers = NumXfers;
+	List.Submitted = 0U;
+	List.Completed = 0U;
+	List.RxQueued = 0U;
+	List.RxDepth = XI3CPSX_FIFO_WORDS((QueueSize &
+			XI3CPSX_QUEUE_SIZE_CAPABILITY_RX_BUF_SIZE_MASK) >>
+			XI3CPSX_QUEUE_SIZE_CAPABILITY_RX_BUF_SIZE_SHIFT);
+	List.TxDepth = XI3CPSX_FIFO_WORDS((QueueSize &
+			XI3CPSX_QUEUE_SIZE_CAPABILITY_TX_BUF_SIZE_MASK) >>
+			XI3CPSX_QUEUE_SIZE_CAPABILITY_TX_BUF_SIZE_SHIFT);
+	List.Streamed = 0U;
+	List.Large = 0U;
+
+	Status = XST_SUCCESS;
+	while (List.Completed < NumXfers) {
+		Count = XI3cPsx_XferSubmit(InstancePtr, &List);
+		if ((List.Large != 0U) && (List.Completed < List.Submitted)) {
+			Count += XI3cPsx_XferStream(InstancePtr, &List);
+		}
+		Status = XI3cPsx_XferComplete(InstancePtr, &List, &Index);
+		if (Status != XST_SUCCESS) {
+			break;
+		}
+		Count += Index;
+
+		if (Count != 0U) {
+			LoopCnt = 0U;
+		} else if (++LoopCnt >= XI3CPSX_XFER_MAX_LOOPCNT) {
+			Status = XST_TIMEOUT;
+			break;
+		} else {
+			/* Nothing moved, poll again */
+		}
+	}
+
+	if (Status != XST_SUCCESS) {
+		for (Index = List.Completed + 1U; Index < NumXfers; Index++) {
+			Xfers[Index].Error = RESPONSE_ERROR_TRANSF_ABORT;
+		}
+		if (Status == XST_TIMEOUT) {
+			Xfers[List.Completed].Error = RESPONSE_ERROR_TRANSF_ABORT;
+		}
+		/* Flush the queues and let the controller leave the halt */
+		XI3cPsx_ResetFifos(InstancePtr);
+		XI3cPsx_WriteReg(InstancePtr->Config.BaseAddress,
+				 XI3CPSX_DEVICE_CTRL,
+				 XI3cPsx_ReadReg(InstancePtr->Config.BaseAddress,
+						 XI3CPSX_DEVICE_CTRL) |
+				 XI3CPSX_DEVICE_CTRL_RESUME_MASK);
+	}
+
+	return Status;
+}
+/** @} */
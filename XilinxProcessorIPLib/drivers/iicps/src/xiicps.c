@@ -31,6 +31,7 @@
 * 3.3   kvn		05/05/16 Modified latest code for MISRA-C:2012 Compliance.
 * 3.11  sd	02/06/20 Added clocking support.
 * 3.11  rna	02/11/20 Moved XIicPs_Reset to xiicps_hw.c
+* 3.16  ag	10/15/26 Drop a message sequence in progress in XIicPs_Abort.
 *
 * </pre>
 *
@@ -122,6 +123,7 @@ s32 XIicPs_CfgInitialize(XIicPs *InstancePtr, XIicPs_Config *ConfigPtr,
 
 	/* Initialize repeated start flag to 0 */
 	InstancePtr->IsRepeatedStart = 0;
+	InstancePtr->SeqMsgPtr = NULL;
 
 	return (s32)XST_SUCCESS;
 }
@@ -192,7 +194,8 @@ static INLINE void StubHandler(void *CallBackRef, u32 StatusEvent)
 *
 * @brief
 * Aborts a transfer in progress by resetting the FIFOs. The byte counts are
-* cleared.
+* cleared. A message sequence in progress is dropped without calling its
+* handlers.
 *
 * @param	InstancePtr is a pointer to the XIicPs instance.
 *
@@ -218,6 +221,11 @@ void XIicPs_Abort(XIicPs *InstancePtr)
 	XIicPs_WriteReg(InstancePtr->Config.BaseAddress,
 			  XIICPS_IDR_OFFSET, XIICPS_IXR_ALL_INTR_MASK);
 
+	if (InstancePtr->SeqMsgPtr != NULL) {
+		InstancePtr->IsRepeatedStart = InstancePtr->SeqSavedRepStart;
+		InstancePtr->SeqMsgPtr = NULL;
+	}
+
 	/*
 	 * Reset the settings in config register and clear the FIFOs.
 	 */
@@ -174,6 +174,8 @@
 * 3.13  rna  05/24/21 Fixed Misra-c violations
 * 3.16  gm   05/10/22 Added support to get the status of receive valid data.
 * 		      Added support for clock stretching and timeout support.
+* 3.16  ag   10/15/26 Added XIicPs_MasterSeq to run a list of messages from
+*		      the interrupt handler with repeated start batching.
 * </pre>
 *
 ******************************************************************************/
@@ -232,6 +234,7 @@ extern "C" {
 #define XIICPS_EVENT_RX_OVR			0x0080U  /**< RX overflow */
 #define XIICPS_EVENT_TX_OVR			0x0100U  /**< TX overflow */
 #define XIICPS_EVENT_RX_UNF			0x0200U  /**< RX underflow */
+#define XIICPS_EVENT_SEQ_DONE		0x0400U  /**< Message sequence done */
 /** @} */
 
 /** name Role constants
@@ -272,6 +275,39 @@ typedef struct {
 #endif
 } XIicPs_Config;
 
+/** @name Message Flags
+ *
+ * Flags of a message passed to XIicPs_MasterSeq().
+ * @{
+ */
+#define XIICPS_MSG_READ		0x01U  /**< Message reads from the slave */
+#define XIICPS_MSG_STOP		0x02U  /**< Send stop after the message even
+					 if the next one is to the same
+					 slave */
+/** @} */
+
+/**
+ * One message of a sequence started with XIicPs_MasterSeq(). Consecutive
+ * messages to the same slave form a batch which is joined by repeated
+ * starts. A batch ends after a read message, a message with
+ * XIICPS_MSG_STOP set or when the slave address changes.
+ */
+typedef struct {
+	u16 SlaveAddr;		/**< Address of the slave */
+	u16 Flags;		/**< XIICPS_MSG_* flags */
+	u8 *BufferPtr;		/**< Data to send or buffer to receive in */
+	s32 ByteCount;		/**< Number of bytes to transfer */
+} XIicPs_Msg;
+
+/**
+ * This handler data type allows the user to be notified of the end of a
+ * batch of a message sequence. NumMsgs messages starting at MsgPtr were
+ * processed and StatusEvent contains the XIICPS_EVENT_* of the batch, zero
+ * or more error events on top of the completion events.
+ */
+typedef void (*XIicPs_SeqHandler) (void *CallBackRef, XIicPs_Msg *MsgPtr,
+				   u32 NumMsgs, u32 StatusEvent);
+
 /**
  * The XIicPs driver instance data. The user is required to allocate a
  * variable of this type for each IIC device in the system. A pointer
@@ -298,6 +334,15 @@ typedef struct {
 	u32 IsClkEnabled;	/**< Input clock enabled */
 #endif
 	void *CallBackRef;	/**< Callback reference for event handler */
+
+	XIicPs_Msg *SeqMsgPtr;	/**< Message sequence (state) */
+	u32 SeqNumMsgs;		/**< Number of messages in sequence (state) */
+	u32 SeqIndex;		/**< Message in progress (state) */
+	u32 SeqBatchStart;	/**< First message of current batch (state) */
+	u32 SeqBatchEvent;	/**< Events of current batch (state) */
+	u32 SeqEvent;		/**< Events of whole sequence (state) */
+	s32 SeqSavedRepStart;	/**< User repeated start option (state) */
+	XIicPs_SeqHandler SeqHandler;	/**< Batch done handler (state) */
 } XIicPs;
 
 /************************** Variable Definitions *****************************/
@@ -411,6 +456,8 @@ s32 XIicPs_MasterRecvPolled(XIicPs *InstancePtr, u8 *MsgPtr, s32 ByteCount,
 void XIicPs_EnableSlaveMonitor(XIicPs *InstancePtr, u16 SlaveAddr);
 void XIicPs_DisableSlaveMonitor(XIicPs *InstancePtr);
 void XIicPs_MasterInterruptHandler(XIicPs *InstancePtr);
+s32 XIicPs_MasterSeq(XIicPs *InstancePtr, XIicPs_Msg *MsgPtr, u32 NumMsgs,
+		XIicPs_SeqHandler FunctionPtr);
 /** @} */
 
 /**
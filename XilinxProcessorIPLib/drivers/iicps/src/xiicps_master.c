@@ -51,6 +51,8 @@
 * 3.13  rna 11/24/20 Added timeout to XIicPs_MasterSendPolled function.
 *	rna 12/17/20 Clear hold bit at correct time in Rx path of ISR
 *	rna 05/24/21 Fix Misra c violations
+* 3.16  ag  10/15/26 Added XIicPs_MasterSeq to run a list of messages from
+*		     the interrupt handler with repeated start batching.
 * </pre>
 *
 ******************************************************************************/
@@ -67,8 +69,13 @@
 
 /***************** Macros (Inline Functions) Definitions *********************/
 #define TX_MAX_LOOPCNT 1000000U	/**< Used to wait in polled function */
+#define SEQ_BUSFREE_LOOPCNT 1000U	/**< Used to wait for stop between
+					  batches of a sequence */
 
 /************************** Function Prototypes ******************************/
+static u32 XIicPs_SeqIsBatchEnd(const XIicPs *InstancePtr, u32 Index);
+static void XIicPs_SeqStartMsg(XIicPs *InstancePtr);
+static u32 XIicPs_SeqAdvance(XIicPs *InstancePtr, u32 StatusEvent);
 
 /************************* Variable Definitions *****************************/
 
@@ -996,6 +1003,14 @@ void XIicPs_MasterInterruptHandler(XIicPs *InstancePtr)
 		StatusEvent |= XIICPS_EVENT_ERROR;
 	}
 
+	/*
+	 * A message sequence in progress consumes the events of its
+	 * messages and only reports the end of the sequence.
+	 */
+	if ((InstancePtr->SeqMsgPtr != NULL) && (StatusEvent != 0U)) {
+		StatusEvent = XIicPs_SeqAdvance(InstancePtr, StatusEvent);
+	}
+
 	/*
 	 * Signal application if there are any events.
 	 */
@@ -1005,4 +1020,231 @@ void XIicPs_MasterInterruptHandler(XIicPs *InstancePtr)
 	}
 
 }
+
+/*****************************************************************************/
+/**
+* @brief
+* This function starts an interrupt-driven sequence of master messages.
+*
+* The messages are executed one after the other from the interrupt handler
+* without involving the application. Consecutive messages to the same slave
+* form a batch: the bus is held between them so the next message starts
+* with a repeated start, and a stop is only sent at the end of the batch.
+* A batch ends after a read message, after a message with XIICPS_MSG_STOP
+* set or when the next message is for another slave. A register read is
+* thus a write of the register address followed by a read to the same
+* slave.
+*
+* At the end of each batch FunctionPtr, if not NULL, is called with the
+* messages of the batch and the events they raised. When a message of a
+* batch fails, the remaining messages of that batch are skipped and the
+* sequence goes on with the next batch. At the end of the sequence the
+* status handler is called once with XIICPS_EVENT_SEQ_DONE and the error
+* events of all batches.
+*
+* @param	InstancePtr is a pointer to the XIicPs instance.
+* @param	MsgPtr is a pointer to the messages. They must stay valid
+*		until the sequence is done.
+* @param	NumMsgs is the number of messages.
+* @param	FunctionPtr is the batch done handler, called with the
+*		callback reference of the status handler. May be NULL.
+*
+* @return
+*		- XST_SUCCESS if the sequence was started.
+*		- XST_DEVICE_BUSY if a sequence is already in progress.
+*
+* @note		This routine is for interrupt-driven transfer only. The
+*		handlers are called in interrupt context.
+*		The controller does not signal the completion of a receive
+*		while HOLD is set, so a read always ends its batch. On Zynq
+*		the driver clears HOLD for sends shorter than the FIFO, such
+*		writes end with a stop rather than a repeated start.
+*
+****************************************************************************/
+s32 XIicPs_MasterSeq(XIicPs *InstancePtr, XIicPs_Msg *MsgPtr, u32 NumMsgs,
+		XIicPs_SeqHandler FunctionPtr)
+{
+	u32 Index;
+
+	/*
+	 * Assert validates the input arguments.
+	 */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(MsgPtr != NULL);
+	Xil_AssertNonvoid(NumMsgs > 0U);
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+
+	for (Index = 0U; Index < NumMsgs; Index++) {
+		Xil_AssertNonvoid(MsgPtr[Index].BufferPtr != NULL);
+		Xil_AssertNonvoid(MsgPtr[Index].ByteCount > 0);
+		Xil_AssertNonvoid((u16)XIICPS_ADDR_MASK >=
+				MsgPtr[Index].SlaveAddr);
+	}
+
+	if (InstancePtr->SeqMsgPtr != NULL) {
+		return (s32)XST_DEVICE_BUSY;
+	}
+
+	InstancePtr->SeqNumMsgs = NumMsgs;
+	InstancePtr->SeqIndex = 0U;
+	InstancePtr->SeqBatchStart = 0U;
+	InstancePtr->SeqBatchEvent = 0U;
+	InstancePtr->SeqEvent = 0U;
+	InstancePtr->SeqHandler = FunctionPtr;
+	InstancePtr->SeqSavedRepStart = InstancePtr->IsRepeatedStart;
+	InstancePtr->SeqMsgPtr = MsgPtr;
+
+	XIicPs_SeqStartMsg(InstancePtr);
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* This function checks whether a message of the sequence is the last one of
+* its batch.
+*
+* @param	InstancePtr is a pointer to the XIicPs instance.
+* @param	Index is the index of the message in the sequence.
+*
+* @return	1 if the bus is to be released after the message, 0 if the
+*		next message follows with a repeated start.
+*
+* @note		None.
+*
+****************************************************************************/
+static u32 XIicPs_SeqIsBatchEnd(const XIicPs *InstancePtr, u32 Index)
+{
+	const XIicPs_Msg *Msg = &InstancePtr->SeqMsgPtr[Index];
+	u32 IsEnd = 0U;
+
+	if (((Index + 1U) >= InstancePtr->SeqNumMsgs) ||
+		((Msg->Flags & (XIICPS_MSG_READ | XIICPS_MSG_STOP)) != 0U) ||
+		(Msg[1].SlaveAddr != Msg->SlaveAddr)) {
+		IsEnd = 1U;
+	}
+
+	return IsEnd;
+}
+
+/*****************************************************************************/
+/**
+* This function starts the current message of the sequence. The repeated
+* start option is set when the next message belongs to the same batch.
+*
+* @param	InstancePtr is a pointer to the XIicPs instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+****************************************************************************/
+static void XIicPs_SeqStartMsg(XIicPs *InstancePtr)
+{
+	XIicPs_Msg *Msg = &InstancePtr->SeqMsgPtr[InstancePtr->SeqIndex];
+	u32 LoopCnt = 0U;
+
+	/*
+	 * A new batch starts after a stop, give the stop some time to
+	 * complete so the start is not rejected as bus busy.
+	 */
+	if ((InstancePtr->SeqIndex == InstancePtr->SeqBatchStart) &&
+		(InstancePtr->SeqIndex != 0U)) {
+		while ((XIicPs_BusIsBusy(InstancePtr) != 0) &&
+			(LoopCnt < SEQ_BUSFREE_LOOPCNT)) {
+			LoopCnt++;
+		}
+	}
+
+	if (XIicPs_SeqIsBatchEnd(InstancePtr, InstancePtr->SeqIndex) != 0U) {
+		InstancePtr->IsRepeatedStart = 0;
+	} else {
+		InstancePtr->IsRepeatedStart = 1;
+	}
+
+	if ((Msg->Flags & XIICPS_MSG_READ) != 0U) {
+		XIicPs_MasterRecv(InstancePtr, Msg->BufferPtr, Msg->ByteCount,
+				Msg->SlaveAddr);
+	} else {
+		XIicPs_MasterSend(InstancePtr, Msg->BufferPtr, Msg->ByteCount,
+				Msg->SlaveAddr);
+	}
+}
+
+/*****************************************************************************/
+/**
+* This function advances the sequence on the events of the current message.
+* It is invoked from the master interrupt handler.
+*
+* @param	InstancePtr is a pointer to the XIicPs instance.
+* @param	StatusEvent is the events raised by the current message.
+*
+* @return	The events to pass to the status handler, 0 while the
+*		sequence is in progress.
+*
+* @note		None.
+*
+****************************************************************************/
+static u32 XIicPs_SeqAdvance(XIicPs *InstancePtr, u32 StatusEvent)
+{
+	u32 DoneEvent = (u32)XIICPS_EVENT_COMPLETE_SEND |
+			(u32)XIICPS_EVENT_COMPLETE_RECV;
+	u32 ErrorEvent;
+	u32 BatchEnd;
+	UINTPTR BaseAddr = InstancePtr->Config.BaseAddress;
+
+	ErrorEvent = StatusEvent & ~(DoneEvent | (u32)XIICPS_EVENT_SLAVE_RDY);
+
+	/*
+	 * Nothing that ends the current message.
+	 */
+	if ((ErrorEvent == 0U) && ((StatusEvent & DoneEvent) == 0U)) {
+		return StatusEvent;
+	}
+
+	InstancePtr->SeqBatchEvent |= StatusEvent;
+	BatchEnd = XIicPs_SeqIsBatchEnd(InstancePtr, InstancePtr->SeqIndex);
+
+	/*
+	 * The rest of a failed batch depends on the failed message, skip it.
+	 */
+	if (ErrorEvent != 0U) {
+		while (BatchEnd == 0U) {
+			InstancePtr->SeqIndex++;
+			BatchEnd = XIicPs_SeqIsBatchEnd(InstancePtr,
+					InstancePtr->SeqIndex);
+		}
+	}
+	InstancePtr->SeqIndex++;
+
+	if (BatchEnd != 0U) {
+		/*
+		 * Release the bus, HOLD is still set after a write or a
+		 * failed message of the batch.
+		 */
+		XIicPs_WriteReg(BaseAddr, XIICPS_CR_OFFSET,
+				XIicPs_ReadReg(BaseAddr, XIICPS_CR_OFFSET) &
+				(~XIICPS_CR_HOLD_MASK));
+
+		if (InstancePtr->SeqHandler != NULL) {
+			InstancePtr->SeqHandler(InstancePtr->CallBackRef,
+				&InstancePtr->SeqMsgPtr[InstancePtr->SeqBatchStart],
+				InstancePtr->SeqIndex - InstancePtr->SeqBatchStart,
+				InstancePtr->SeqBatchEvent);
+		}
+		InstancePtr->SeqEvent |= InstancePtr->SeqBatchEvent;
+		InstancePtr->SeqBatchStart = InstancePtr->SeqIndex;
+		InstancePtr->SeqBatchEvent = 0U;
+	}
+
+	if (InstancePtr->SeqIndex < InstancePtr->SeqNumMsgs) {
+		XIicPs_SeqStartMsg(InstancePtr);
+		return 0U;
+	}
+
+	InstancePtr->IsRepeatedStart = InstancePtr->SeqSavedRepStart;
+	InstancePtr->SeqMsgPtr = NULL;
+
+	return (u32)XIICPS_EVENT_SEQ_DONE | (InstancePtr->SeqEvent & ~DoneEvent);
+}
 /** @} */
@@ -94,6 +94,7 @@
  *	sdd 03/10/21 Fixed misrac warnings.
  *		     Fixed doxygen warnings.
  * 2.11 sdd 11/17/21 Updated tcl to check for microblaze processors
+ * 2.13 ag  10/15/26 Added IPI message queues in xipipsu_queue.c
  * </pre>
  *
  *****************************************************************************/
@@ -0,0 +1,397 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+*
+* @file xipipsu_queue.c
+* @addtogroup ipipsu Overview
+* @{
+*
+* The xipipsu_queue.c file contains the implementation of the IPI message
+* queues.
+* Refer to the header file xipipsu_queue.h for more detailed information.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver	Who	Date	Changes
+* ----- ------ -------- ----------------------------------------------
+* 2.13	ag	10/15/26	First release
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+#include "xipipsu.h"
+#include "xipipsu_hw.h"
+#include "xipipsu_queue.h"
+#if defined (__MICROBLAZE__)
+#include "mb_interface.h"
+#else
+#include "xpseudo_asm.h"
+#endif
+
+/************************** Constant Definitions *****************************/
+#if defined (__MICROBLAZE__)
+#define XIpiPsu_QueueBarrier()	mbar(1) /**< Order shared memory accesses */
+#else
+#define XIpiPsu_QueueBarrier()	dmb() /**< Order shared memory accesses */
+#endif
+
+/****************************************************************************/
+/**
+ * @brief	Get the address of a ring entry
+ *
+ * @param	QueuePtr is the pointer to the queue
+ * @param	RingAddr is the address of the ring
+ * @param	Count is the free running message count
+ *
+ * @return	Address of the entry
+ *
+ */
+static UINTPTR XIpiPsu_QueueEntry(const XIpiPsu_Queue *QueuePtr,
+		UINTPTR RingAddr, u32 Count)
+{
+	return RingAddr + XIPIPSU_QUEUE_ENTRY_OFFSET +
+		((UINTPTR)(Count & (QueuePtr->NumEntries - 1U)) *
+		 XIPIPSU_QUEUE_ENTRY_SIZE);
+}
+
+/****************************************************************************/
+/**
+ * @brief	Ring the doorbell of the remote CPU. No IPI is raised if the
+ *		previous one is not acknowledged yet: the remote clears its
+ *		status before it reads the rings, so it will see the updates.
+ *
+ * @param	QueuePtr is the pointer to the queue
+ *
+ * @return	None
+ *
+ */
+static void XIpiPsu_QueueDoorbell(XIpiPsu_Queue *QueuePtr)
+{
+	/* Make the ring updates visible before checking the status */
+	XIpiPsu_QueueBarrier();
+
+	if ((XIpiPsu_GetObsStatus(QueuePtr->IpiInstPtr) &
+			QueuePtr->RemoteCpuMask) == 0U) {
+		(void)XIpiPsu_TriggerIpi(QueuePtr->IpiInstPtr,
+				QueuePtr->RemoteCpuMask);
+	}
+}
+
+/****************************************************************************/
+/**
+ * @brief	Read the next message of the RX ring
+ *
+ * @param	QueuePtr is the pointer to the queue
+ * @param	MsgPtr is the buffer for the message
+ * @param	MsgLength is the length of the buffer in words
+ * @param	RecvLengthPtr is set to the length of the message
+ *
+ * @return	XST_SUCCESS if a message was read
+ *		XST_NO_DATA if the RX ring is empty
+ *
+ */
+static XStatus XIpiPsu_QueueRead(XIpiPsu_Queue *QueuePtr, u32 *MsgPtr,
+		u32 MsgLength, u32 *RecvLengthPtr)
+{
+	UINTPTR EntryAddr;
+	u32 Head;
+	u32 Length;
+	u32 Index;
+
+	Head = Xil_In32(QueuePtr->RxRingAddr + XIPIPSU_QUEUE_HEAD_OFFSET);
+	if (Head == QueuePtr->RxTail) {
+		return (XStatus)XST_NO_DATA;
+	}
+
+	/* Read the entry only after the head */
+	XIpiPsu_QueueBarrier();
+
+	EntryAddr = XIpiPsu_QueueEntry(QueuePtr, QueuePtr->RxRingAddr,
+			QueuePtr->RxTail);
+	Length = Xil_In32(EntryAddr);
+	if (Length > XIPIPSU_MAX_MSG_LEN) {
+		Length = XIPIPSU_MAX_MSG_LEN;
+	}
+	for (Index = 0U; (Index < Length) && (Index < MsgLength); Index++) {
+		MsgPtr[Index] = Xil_In32(EntryAddr + 4U + (Index * 4U));
+	}
+	*RecvLengthPtr = Index;
+
+	/* Free the entry only once it is read */
+	XIpiPsu_QueueBarrier();
+	QueuePtr->RxTail++;
+	Xil_Out32(QueuePtr->RxRingAddr + XIPIPSU_QUEUE_TAIL_OFFSET,
+			QueuePtr->RxTail);
+
+	return (XStatus)XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+ * @brief	Initialize a message queue to a remote CPU
+ *
+ * @param	QueuePtr is the pointer to the queue
+ * @param	IpiInstPtr is the pointer to the initialized IPI instance
+ * @param	RemoteCpuMask is the Mask of the remote CPU
+ * @param	TxRingAddr is the address of the ring of the sent messages
+ * @param	RxRingAddr is the address of the ring of the received messages,
+ *		the TX ring of the remote
+ * @param	NumEntries is the number of entries of each ring, a power of 2
+ *
+ * @return	XST_SUCCESS if successful
+ *		XST_INVALID_PARAM if the number of entries is not a power of 2
+ *
+ * @note	Both sides have to be initialized before a message is sent.
+ *
+ */
+XStatus XIpiPsu_QueueInit(XIpiPsu_Queue *QueuePtr, XIpiPsu *IpiInstPtr,
+		u32 RemoteCpuMask, UINTPTR TxRingAddr, UINTPTR RxRingAddr,
+		u32 NumEntries)
+{
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(IpiInstPtr != NULL);
+	Xil_AssertNonvoid(IpiInstPtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if ((NumEntries == 0U) || ((NumEntries & (NumEntries - 1U)) != 0U)) {
+		return (XStatus)XST_INVALID_PARAM;
+	}
+
+	QueuePtr->IpiInstPtr = IpiInstPtr;
+	QueuePtr->RemoteCpuMask = RemoteCpuMask;
+	QueuePtr->TxRingAddr = TxRingAddr;
+	QueuePtr->RxRingAddr = RxRingAddr;
+	QueuePtr->NumEntries = NumEntries;
+	QueuePtr->TxHead = 0U;
+	QueuePtr->TxAcked = 0U;
+	QueuePtr->TxPending = 0U;
+	QueuePtr->RxTail = 0U;
+	QueuePtr->RecvHandler = NULL;
+	QueuePtr->RecvRef = NULL;
+	QueuePtr->AckHandler = NULL;
+	QueuePtr->AckRef = NULL;
+
+	/* Each side resets the ring indices it writes */
+	Xil_Out32(TxRingAddr + XIPIPSU_QUEUE_HEAD_OFFSET, 0U);
+	Xil_Out32(TxRingAddr + XIPIPSU_QUEUE_ACKREQ_OFFSET, 0U);
+	Xil_Out32(RxRingAddr + XIPIPSU_QUEUE_TAIL_OFFSET, 0U);
+
+	QueuePtr->IsReady = XIL_COMPONENT_IS_READY;
+
+	return (XStatus)XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+ * @brief	Set the handler called by XIpiPsu_QueueHandler() for each
+ *		received message
+ *
+ * @param	QueuePtr is the pointer to the queue
+ * @param	FuncPtr is the handler
+ * @param	CallBackRef is passed to the handler
+ *
+ * @return	None
+ *
+ */
+void XIpiPsu_QueueSetRecvHandler(XIpiPsu_Queue *QueuePtr,
+		XIpiPsu_QueueRecvHandler FuncPtr, void *CallBackRef)
+{
+	Xil_AssertVoid(QueuePtr != NULL);
+	Xil_AssertVoid(QueuePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	QueuePtr->RecvHandler = FuncPtr;
+	QueuePtr->RecvRef = CallBackRef;
+}
+
+/****************************************************************************/
+/**
+ * @brief	Set the handler called by XIpiPsu_QueueHandler() when the
+ *		remote has consumed sent messages. The remote then rings the
+ *		doorbell back after it has consumed messages.
+ *
+ * @param	QueuePtr is the pointer to the queue
+ * @param	FuncPtr is the handler, NULL to stop the acks
+ * @param	CallBackRef is passed to the handler
+ *
+ * @return	None
+ *
+ */
+void XIpiPsu_QueueSetAckHandler(XIpiPsu_Queue *QueuePtr,
+		XIpiPsu_QueueAckHandler FuncPtr, void *CallBackRef)
+{
+	Xil_AssertVoid(QueuePtr != NULL);
+	Xil_AssertVoid(QueuePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	QueuePtr->AckHandler = FuncPtr;
+	QueuePtr->AckRef = CallBackRef;
+	Xil_Out32(QueuePtr->TxRingAddr + XIPIPSU_QUEUE_ACKREQ_OFFSET,
+			(FuncPtr != NULL) ? 1U : 0U);
+}
+
+/****************************************************************************/
+/**
+ * @brief	Queue a message to the remote CPU. The remote is not notified
+ *		until XIpiPsu_QueueKick() is called.
+ *
+ * @param	QueuePtr is the pointer to the queue
+ * @param	MsgPtr is the message
+ * @param	MsgLength is the length of the message in words, up to
+ *		XIPIPSU_MAX_MSG_LEN
+ *
+ * @return	XST_SUCCESS if successful
+ *		XST_DEVICE_BUSY if the TX ring is full
+ *
+ */
+XStatus XIpiPsu_QueueSend(XIpiPsu_Queue *QueuePtr, const u32 *MsgPtr,
+		u32 MsgLength)
+{
+	UINTPTR EntryAddr;
+	u32 Tail;
+	u32 Index;
+
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(QueuePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(MsgPtr != NULL);
+	Xil_AssertNonvoid(MsgLength <= XIPIPSU_MAX_MSG_LEN);
+
+	Tail = Xil_In32(QueuePtr->TxRingAddr + XIPIPSU_QUEUE_TAIL_OFFSET);
+	if ((QueuePtr->TxHead - Tail) >= QueuePtr->NumEntries) {
+		return (XStatus)XST_DEVICE_BUSY;
+	}
+
+	/* Don't overwrite the entry before the remote has read it */
+	XIpiPsu_QueueBarrier();
+
+	EntryAddr = XIpiPsu_QueueEntry(QueuePtr, QueuePtr->TxRingAddr,
+			QueuePtr->TxHead);
+	Xil_Out32(EntryAddr, MsgLength);
+	for (Index = 0U; Index < MsgLength; Index++) {
+		Xil_Out32(EntryAddr + 4U + (Index * 4U), MsgPtr[Index]);
+	}
+
+	/* Publish the entry only once it is written */
+	XIpiPsu_QueueBarrier();
+	QueuePtr->TxHead++;
+	Xil_Out32(QueuePtr->TxRingAddr + XIPIPSU_QUEUE_HEAD_OFFSET,
+			QueuePtr->TxHead);
+	QueuePtr->TxPending++;
+
+	return (XStatus)XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+ * @brief	Notify the remote CPU of the messages queued since the last
+ *		call, with a single IPI
+ *
+ * @param	QueuePtr is the pointer to the queue
+ *
+ * @return	XST_SUCCESS
+ *
+ */
+XStatus XIpiPsu_QueueKick(XIpiPsu_Queue *QueuePtr)
+{
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(QueuePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if (QueuePtr->TxPending != 0U) {
+		QueuePtr->TxPending = 0U;
+		XIpiPsu_QueueDoorbell(QueuePtr);
+	}
+
+	return (XStatus)XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+ * @brief	Read the next received message, for use without interrupts
+ *
+ * @param	QueuePtr is the pointer to the queue
+ * @param	MsgPtr is the buffer for the message
+ * @param	MsgLength is the length of the buffer in words, a longer
+ *		message is truncated
+ * @param	RecvLengthPtr is set to the length of the message read
+ *
+ * @return	XST_SUCCESS if a message was read
+ *		XST_NO_DATA if no message was received
+ *
+ */
+XStatus XIpiPsu_QueueReceive(XIpiPsu_Queue *QueuePtr, u32 *MsgPtr,
+		u32 MsgLength, u32 *RecvLengthPtr)
+{
+	XStatus Status;
+
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(QueuePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(MsgPtr != NULL);
+	Xil_AssertNonvoid(RecvLengthPtr != NULL);
+
+	Status = XIpiPsu_QueueRead(QueuePtr, MsgPtr, MsgLength, RecvLengthPtr);
+	if ((Status == (XStatus)XST_SUCCESS) &&
+			(Xil_In32(QueuePtr->RxRingAddr +
+				XIPIPSU_QUEUE_HEAD_OFFSET) == QueuePtr->RxTail) &&
+			(Xil_In32(QueuePtr->RxRingAddr +
+				XIPIPSU_QUEUE_ACKREQ_OFFSET) != 0U)) {
+		/* Ack once the ring is drained */
+		XIpiPsu_QueueDoorbell(QueuePtr);
+	}
+
+	return Status;
+}
+
+/****************************************************************************/
+/**
+ * @brief	Handle the doorbell of the remote CPU. This is called from the
+ *		IPI interrupt handler when the status of the remote CPU is set.
+ *		It clears the status, passes all the received messages to the
+ *		receive handler and calls the ack handler for the messages the
+ *		remote has consumed. Without a receive handler, the messages
+ *		are left in the ring for XIpiPsu_QueueReceive().
+ *
+ * @param	QueuePtr is the pointer to the queue
+ *
+ * @return	None
+ *
+ */
+void XIpiPsu_QueueHandler(XIpiPsu_Queue *QueuePtr)
+{
+	u32 Msg[XIPIPSU_MAX_MSG_LEN];
+	u32 Length;
+	u32 NumRead = 0U;
+	u32 Tail;
+
+	Xil_AssertVoid(QueuePtr != NULL);
+	Xil_AssertVoid(QueuePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	/* Clear the status first, a later doorbell raises a new IPI */
+	XIpiPsu_ClearInterruptStatus(QueuePtr->IpiInstPtr,
+			QueuePtr->RemoteCpuMask);
+	XIpiPsu_QueueBarrier();
+
+	while ((QueuePtr->RecvHandler != NULL) &&
+			(XIpiPsu_QueueRead(QueuePtr, Msg, XIPIPSU_MAX_MSG_LEN,
+				&Length) == (XStatus)XST_SUCCESS)) {
+		QueuePtr->RecvHandler(QueuePtr->RecvRef, Msg, Length);
+		NumRead++;
+	}
+
+	if ((NumRead != 0U) && (Xil_In32(QueuePtr->RxRingAddr +
+			XIPIPSU_QUEUE_ACKREQ_OFFSET) != 0U)) {
+		XIpiPsu_QueueDoorbell(QueuePtr);
+	}
+
+	Tail = Xil_In32(QueuePtr->TxRingAddr + XIPIPSU_QUEUE_TAIL_OFFSET);
+	if (Tail != QueuePtr->TxAcked) {
+		if (QueuePtr->AckHandler != NULL) {
+			QueuePtr->AckHandler(QueuePtr->AckRef,
+					Tail - QueuePtr->TxAcked);
+		}
+		QueuePtr->TxAcked = Tail;
+	}
+}
+/** @} */
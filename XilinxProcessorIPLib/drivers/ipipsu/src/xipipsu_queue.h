@@ -0,0 +1,130 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ * @file xipipsu_queue.h
+* @addtogroup ipipsu Overview
+* @{
+* @details
+ *
+ * The xipipsu_queue.h is the header file for the IPI message queues.
+ *
+ * The IPI message buffers hold a single message per target pair, so the
+ * sender has to wait for the ack of each message before it can send the
+ * next one. A message queue instead keeps the messages to a remote CPU in
+ * a ring in shared memory, and uses the IPI only as a doorbell:
+ *
+ * - XIpiPsu_QueueSend() copies a message of up to XIPIPSU_MAX_MSG_LEN words
+ *   to the TX ring, without any IPI. Any number of messages can be queued,
+ *   up to the ring size.
+ * - XIpiPsu_QueueKick() rings the doorbell once for all the queued
+ *   messages. No IPI is raised if the previous one is still pending, as
+ *   the remote will see the new messages when it handles it.
+ * - XIpiPsu_QueueHandler(), called from the IPI interrupt handler for the
+ *   remote CPU, passes all the received messages to the receive handler.
+ *   When the remote has registered an ack handler, the doorbell is rung
+ *   back once the messages are consumed, and its ack handler is called
+ *   with the number of messages consumed.
+ * - Without a receive handler, the messages are left in the ring and read
+ *   with XIpiPsu_QueueReceive(), which rings the ack doorbell once the ring
+ *   is drained.
+ *
+ * Each side passes its TX ring and the TX ring of the remote, as its RX
+ * ring, to XIpiPsu_QueueInit(). The rings of XIPIPSU_QUEUE_RING_SIZE()
+ * bytes have to be in memory shared by both CPUs and not cached, e.g. OCM.
+ * Both sides have to be initialized before any message is sent. The queue
+ * owns the IPI channel with the remote CPU, which can't be used with
+ * XIpiPsu_WriteMessage() at the same time.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver  Who Date     Changes
+ * ---- --- -------- --------------------------------------------------
+ * 2.13 ag  10/15/26 First release
+ * </pre>
+ *
+ *****************************************************************************/
+#ifndef XIPIPSU_QUEUE_H_
+#define XIPIPSU_QUEUE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xipipsu.h"
+
+/************************** Constant Definitions *****************************/
+/*
+ * Ring layout. The head and the ack request, written by the sender, and the
+ * tail, written by the receiver, are on separate cache lines.
+ */
+#define XIPIPSU_QUEUE_HEAD_OFFSET	(0x00U) /**< Messages written */
+#define XIPIPSU_QUEUE_ACKREQ_OFFSET	(0x04U) /**< Sender wants acks */
+#define XIPIPSU_QUEUE_TAIL_OFFSET	(0x40U) /**< Messages read */
+#define XIPIPSU_QUEUE_ENTRY_OFFSET	(0x80U) /**< First message entry */
+#define XIPIPSU_QUEUE_ENTRY_SIZE	(0x40U) /**< Length word and message */
+
+/**
+ * Size in bytes of a ring of NumEntries messages
+ */
+#define XIPIPSU_QUEUE_RING_SIZE(NumEntries) \
+	(XIPIPSU_QUEUE_ENTRY_OFFSET + ((NumEntries) * XIPIPSU_QUEUE_ENTRY_SIZE))
+
+/**************************** Type Definitions *******************************/
+/**
+ * Handler called for each received message
+ */
+typedef void (*XIpiPsu_QueueRecvHandler)(void *CallBackRef, u32 *MsgPtr,
+		u32 MsgLength);
+
+/**
+ * Handler called when the remote has consumed sent messages
+ */
+typedef void (*XIpiPsu_QueueAckHandler)(void *CallBackRef, u32 NumAcked);
+
+/**
+ * The message queue to a remote CPU
+ */
+typedef struct {
+	XIpiPsu *IpiInstPtr; /**< IPI instance */
+	u32 RemoteCpuMask; /**< Mask of the remote CPU */
+	UINTPTR TxRingAddr; /**< Ring of the messages sent */
+	UINTPTR RxRingAddr; /**< Ring of the messages received */
+	u32 NumEntries; /**< Number of entries of each ring */
+	u32 TxHead; /**< Messages written to the TX ring */
+	u32 TxAcked; /**< Messages of the TX ring acked */
+	u32 TxPending; /**< Messages queued since the last doorbell */
+	u32 RxTail; /**< Messages read from the RX ring */
+	XIpiPsu_QueueRecvHandler RecvHandler; /**< Receive handler */
+	void *RecvRef; /**< Receive handler reference */
+	XIpiPsu_QueueAckHandler AckHandler; /**< Ack handler */
+	void *AckRef; /**< Ack handler reference */
+	u32 IsReady; /**< Queue is initialized and ready */
+} XIpiPsu_Queue;
+
+/************************** Function Prototypes *****************************/
+XStatus XIpiPsu_QueueInit(XIpiPsu_Queue *QueuePtr, XIpiPsu *IpiInstPtr,
+		u32 RemoteCpuMask, UINTPTR TxRingAddr, UINTPTR RxRingAddr,
+		u32 NumEntries);
+void XIpiPsu_QueueSetRecvHandler(XIpiPsu_Queue *QueuePtr,
+		XIpiPsu_QueueRecvHandler FuncPtr, void *CallBackRef);
+void XIpiPsu_QueueSetAckHandler(XIpiPsu_Queue *QueuePtr,
+		XIpiPsu_QueueAckHandler FuncPtr, void *CallBackRef);
+XStatus XIpiPsu_QueueSend(XIpiPsu_Queue *QueuePtr, const u32 *MsgPtr,
+		u32 MsgLength);
+XStatus XIpiPsu_QueueKick(XIpiPsu_Queue *QueuePtr);
+XStatus XIpiPsu_QueueReceive(XIpiPsu_Queue *QueuePtr, u32 *MsgPtr,
+		u32 MsgLength, u32 *RecvLengthPtr);
+void XIpiPsu_QueueHandler(XIpiPsu_Queue *QueuePtr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XIPIPSU_QUEUE_H_ */
+/** @} */
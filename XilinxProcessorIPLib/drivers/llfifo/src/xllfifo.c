@@ -33,6 +33,10 @@
  *                     XLlFifo_Initialize APIs.
  * 5.5   sk   06/15/20 In XLlFifo_iRead_Aligned and XLlFifo_iWrite_Aligned add
  *		       type casting to fix gcc warnings.
+ * 5.5   ag   10/14/26 Added the 64 bit burst receive path to
+ *		       XLlFifo_iRead_Aligned and the XLlFifo_RxSetBurst,
+ *		       XLlFifo_RxSetPool, XLlFifo_RxLend and XLlFifo_RxReturn
+ *		       APIs.
  * </pre>
  ******************************************************************************/
 
@@ -125,6 +129,53 @@ u32 XLlFifo_iRxGetLen(XLlFifo *InstancePtr)
 		XLLF_RLF_OFFSET);
 }
 
+/*****************************************************************************/
+/**
+*
+* XLlFifo_iRead_Burst reads <i>WordCount</i> words from the AXI4 data interface
+* of the FIFO referenced by <i>InstancePtr</i> with 64 bit accesses. A 32 bit
+* read aligns the buffer to 64 bits first, and the last odd word is read with
+* a 32 bit access as well.
+*
+* @param    InstancePtr references the FIFO on which to operate.
+*
+* @param    BufPtr specifies the 32 bit aligned memory address to place the
+*           data read.
+*
+* @param    WordCount specifies the number of 32 bit words to read.
+*
+* @return   N/A
+*
+* @note     The FIFO returns the older word in the lower half of a 64 bit
+*           read, so the words land in memory in order on little endian
+*           processors.
+*
+******************************************************************************/
+static void XLlFifo_iRead_Burst(XLlFifo *InstancePtr, u32 *BufPtr,
+				unsigned WordCount)
+{
+	UINTPTR DataAddr = (UINTPTR)InstancePtr->Axi4BaseAddress +
+				XLLF_AXI4_RDFD_OFFSET;
+	u64 *BufPtr64;
+	unsigned Pairs;
+
+	if ((WordCount != 0U) && (((UINTPTR)BufPtr & 0x7) != 0x0)) {
+		*BufPtr = Xil_In32(DataAddr);
+		BufPtr++;
+		WordCount--;
+	}
+
+	BufPtr64 = (u64 *)(void *)BufPtr;
+	for (Pairs = WordCount >> 1; Pairs != 0U; Pairs--) {
+		*BufPtr64 = Xil_In64(DataAddr);
+		BufPtr64++;
+	}
+
+	if ((WordCount & 0x1) != 0U) {
+		*(u32 *)(void *)BufPtr64 = Xil_In32(DataAddr);
+	}
+}
+
 /*****************************************************************************/
 /**
 *
@@ -166,6 +217,11 @@ int XLlFifo_iRead_Aligned(XLlFifo *InstancePtr, void *BufPtr,
 	Xil_AssertNonvoid(((UINTPTR)BufPtr & 0x3) == 0x0);
 	xdbg_printf(XDBG_DEBUG_FIFO_RX, "XLlFifo_iRead_Aligned: after asserts\n");
 
+	if (InstancePtr->RxBurst) {
+		XLlFifo_iRead_Burst(InstancePtr, BufPtrIdx, WordCount);
+		return XST_SUCCESS;
+	}
+
 	while (WordsRemaining) {
 /*		xdbg_printf(XDBG_DEBUG_FIFO_RX,
 			    "XLlFifo_iRead_Aligned: WordsRemaining: %d\n",
@@ -226,6 +282,52 @@ void XLlFifo_iTxSetLen(XLlFifo *InstancePtr, u32 Bytes)
 			Bytes);
 }
 
+/*****************************************************************************/
+/**
+*
+* XLlFifo_iWrite_Burst writes <i>WordCount</i> words to the AXI4 data interface
+* of the FIFO referenced by <i>InstancePtr</i> with 64 bit accesses. A 32 bit
+* write aligns the buffer to 64 bits first, and the last odd word is written
+* with a 32 bit access as well.
+*
+* @param    InstancePtr references the FIFO on which to operate.
+*
+* @param    BufPtr specifies the 32 bit aligned memory address of the data.
+*
+* @param    WordCount specifies the number of 32 bit words to write.
+*
+* @return   N/A
+*
+* @note     The FIFO takes the lower half of a 64 bit write as the older
+*           word, so the words leave memory in order on little endian
+*           processors.
+*
+******************************************************************************/
+static void XLlFifo_iWrite_Burst(XLlFifo *InstancePtr, u32 *BufPtr,
+				 unsigned WordCount)
+{
+	UINTPTR DataAddr = (UINTPTR)InstancePtr->Axi4BaseAddress +
+				XLLF_AXI4_TDFD_OFFSET;
+	u64 *BufPtr64;
+	unsigned Pairs;
+
+	if ((WordCount != 0U) && (((UINTPTR)BufPtr & 0x7) != 0x0)) {
+		Xil_Out32(DataAddr, *BufPtr);
+		BufPtr++;
+		WordCount--;
+	}
+
+	BufPtr64 = (u64 *)(void *)BufPtr;
+	for (Pairs = WordCount >> 1; Pairs != 0U; Pairs--) {
+		Xil_Out64(DataAddr, *BufPtr64);
+		BufPtr64++;
+	}
+
+	if ((WordCount & 0x1) != 0U) {
+		Xil_Out32(DataAddr, *(u32 *)(void *)BufPtr64);
+	}
+}
+
 /*****************************************************************************/
 /**
 *
@@ -273,6 +375,11 @@ int XLlFifo_iWrite_Aligned(XLlFifo *InstancePtr, void *BufPtr,
 	/* assert buffer is 32 bit aligned */
 	Xil_AssertNonvoid(((UINTPTR)BufPtr & 0x3) == 0x0);
 
+	if (InstancePtr->TxBurst) {
+		XLlFifo_iWrite_Burst(InstancePtr, BufPtrIdx, WordCount);
+		return XST_SUCCESS;
+	}
+
 	xdbg_printf(XDBG_DEBUG_FIFO_TX,
 		    "XLlFifo_iWrite_Aligned: WordsRemaining: %d\n",
 		    WordsRemaining);
@@ -416,6 +523,177 @@ void XLlFifo_TxPutWord(XLlFifo *InstancePtr, u32 Word)
 
 }
 
+/****************************************************************************/
+/**
+*
+* XLlFifo_RxSetBurst enables or disables the 64 bit burst receive mode of the
+* FIFO specified by <i>InstancePtr</i>. Burst reads are only available with
+* the AXI4 data interface.
+*
+* @param    InstancePtr references the FIFO on which to operate.
+* @param    Enable is non-zero to enable the burst mode, zero to disable it.
+*
+* @return
+*           - XST_SUCCESS if the mode is set.
+*           - XST_NO_FEATURE if the FIFO uses the AXI4-Lite data interface.
+*
+* @note     The mode must not be changed in the middle of a frame.
+*
+*****************************************************************************/
+int XLlFifo_RxSetBurst(XLlFifo *InstancePtr, u32 Enable)
+{
+	Xil_AssertNonvoid(InstancePtr);
+
+	if (Enable && (InstancePtr->Datainterface == 0)) {
+		return XST_NO_FEATURE;
+	}
+
+	InstancePtr->RxBurst = (Enable != 0U) ? 1U : 0U;
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* XLlFifo_TxSetBurst enables or disables the 64 bit burst transmit mode of the
+* FIFO specified by <i>InstancePtr</i>. Burst writes are only available with
+* the AXI4 data interface.
+*
+* @param    InstancePtr references the FIFO on which to operate.
+* @param    Enable is non-zero to enable the burst mode, zero to disable it.
+*
+* @return
+*           - XST_SUCCESS if the mode is set.
+*           - XST_NO_FEATURE if the FIFO uses the AXI4-Lite data interface.
+*
+* @note     The mode must not be changed in the middle of a frame.
+*
+*****************************************************************************/
+int XLlFifo_TxSetBurst(XLlFifo *InstancePtr, u32 Enable)
+{
+	Xil_AssertNonvoid(InstancePtr);
+
+	if (Enable && (InstancePtr->Datainterface == 0)) {
+		return XST_NO_FEATURE;
+	}
+
+	InstancePtr->TxBurst = (Enable != 0U) ? 1U : 0U;
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* XLlFifo_RxSetPool sets the pool the receive buffers of XLlFifo_RxLend are
+* taken from.
+*
+* @param    InstancePtr references the FIFO on which to operate.
+* @param    Pool references an initialized pool, or NULL to disable
+*           XLlFifo_RxLend. Its block size limits the frame length.
+*
+* @return   N/A
+*
+*****************************************************************************/
+void XLlFifo_RxSetPool(XLlFifo *InstancePtr, Xil_Pool *Pool)
+{
+	Xil_AssertVoid(InstancePtr);
+
+	InstancePtr->RxPool = Pool;
+}
+
+/****************************************************************************/
+/**
+*
+* XLlFifo_RxLend receives the next frame of the FIFO specified by
+* <i>InstancePtr</i> directly into a block of the receive pool and lends the
+* block to the caller.
+*
+* The block is taken from the pool before the frame length is read, so a
+* frame is never started without a buffer to place it in. A frame longer
+* than the pool block size is read out of the FIFO and dropped.
+*
+* @param    InstancePtr references the FIFO on which to operate.
+* @param    BufPtr is set to the block holding the frame.
+* @param    BytesPtr is set to the number of bytes in the frame.
+*
+* @return
+*           - XST_SUCCESS if a frame was received into *BufPtr.
+*           - XST_NO_DATA if no frame is waiting in the FIFO.
+*           - XST_FAILURE if no receive pool is set or the pool is empty,
+*             the frame stays in the FIFO.
+*           - XST_BUFFER_TOO_SMALL if the frame was dropped because it does
+*             not fit in a pool block.
+*
+* @note     The block must be handed back with XLlFifo_RxReturn.
+*
+*****************************************************************************/
+int XLlFifo_RxLend(XLlFifo *InstancePtr, void **BufPtr, u32 *BytesPtr)
+{
+	void *Buf;
+	u32 Bytes;
+	u32 Words;
+
+	Xil_AssertNonvoid(InstancePtr);
+	Xil_AssertNonvoid(BufPtr);
+	Xil_AssertNonvoid(BytesPtr);
+
+	if (XLlFifo_iRxOccupancy(InstancePtr) == 0) {
+		return XST_NO_DATA;
+	}
+
+	if (InstancePtr->RxPool == NULL) {
+		return XST_FAILURE;
+	}
+
+	Buf = Xil_PoolAlloc(InstancePtr->RxPool);
+	if (Buf == NULL) {
+		return XST_FAILURE;
+	}
+
+	Bytes = XLlFifo_iRxGetLen(InstancePtr);
+	Words = (Bytes + FIFO_WIDTH_BYTES - 1) / FIFO_WIDTH_BYTES;
+
+	if ((Words * FIFO_WIDTH_BYTES) > InstancePtr->RxPool->BlockSize) {
+		/* Drain the frame so that the next one can be received */
+		while (Words) {
+			(void)XLlFifo_RxGetWord(InstancePtr);
+			Words--;
+		}
+		Xil_PoolFree(InstancePtr->RxPool, Buf);
+
+		return XST_BUFFER_TOO_SMALL;
+	}
+
+	(void)XLlFifo_iRead_Aligned(InstancePtr, Buf, Words);
+
+	*BufPtr = Buf;
+	*BytesPtr = Bytes;
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* XLlFifo_RxReturn hands a block lent by XLlFifo_RxLend back to the receive
+* pool of the FIFO specified by <i>InstancePtr</i>.
+*
+* @param    InstancePtr references the FIFO on which to operate.
+* @param    BufPtr is the block returned by XLlFifo_RxLend.
+*
+* @return   N/A
+*
+*****************************************************************************/
+void XLlFifo_RxReturn(XLlFifo *InstancePtr, void *BufPtr)
+{
+	Xil_AssertVoid(InstancePtr);
+	Xil_AssertVoid(InstancePtr->RxPool != NULL);
+
+	Xil_PoolFree(InstancePtr->RxPool, BufPtr);
+}
+
 /*****************************************************************************/
 /**
 *
@@ -97,6 +97,24 @@
  * twice in a row. Each frame must be written by writing the data for one
  * frame and then calling iTxSetLen().
  *
+ * <h2>Burst Receive and Transmit</h2>
+ * When the FIFO is built with the AXI4 data interface, XLlFifo_RxSetBurst
+ * switches the receive path to 64 bit reads of the AXI4 receive data
+ * address, which the interconnect issues as two beat bursts. Reads of
+ * 32 bit aligned buffers through XLlFifo_Read and XLlFifo_RxLend use the
+ * burst mode, only the first word of a buffer not aligned to 64 bits and
+ * the last odd word are read with 32 bit accesses. XLlFifo_TxSetBurst does
+ * the same for writes of 32 bit aligned buffers through XLlFifo_Write.
+ *
+ * <h2>Buffer Lending</h2>
+ * XLlFifo_RxLend receives the next frame directly into a block taken from
+ * the pool given to XLlFifo_RxSetPool, so the frame does not pass through
+ * the holding buffer of the streamer or a copy in the application. The
+ * block is lent to the caller, which hands it back with XLlFifo_RxReturn
+ * once it is done with the frame. The pool block size must be at least the
+ * largest frame rounded up to a multiple of 8 bytes. XLlFifo_RxLend and
+ * XLlFifo_Read must not be mixed within one frame.
+ *
  * <h2>Interrupts</h2>
  * This driver does not handle interrupts from the FIFO hardware. The
  * software layer above may make use of the interrupts by setting up its
@@ -162,6 +180,11 @@
  *		       Updated comments in the usage section as per example code.
  *		       Fix doxygen warnings in the driver.
  * 5.5 sd     09/04/20  Makefile update for parallel execution.
+ * 5.5 ag     10/14/26  Added the receive burst mode for the AXI4 data
+ *		        interface, XLlFifo_RxSetBurst, and the buffer lending
+ *		        receive API XLlFifo_RxSetPool, XLlFifo_RxLend and
+ *		        XLlFifo_RxReturn.
+ * 5.5 ag     10/15/26  Added the transmit burst mode, XLlFifo_TxSetBurst.
  * </pre>
  *
  *****************************************************************************/
@@ -178,6 +201,7 @@ extern "C" {
 /* This order needs to be kept this way to avoid xstatus/xil_types conflict */
 #include "xstreamer.h"
 #include "xllfifo_hw.h"
+#include "xil_pool.h"
 
 /**************************** Type Definitions *******************************/
 
@@ -200,6 +224,15 @@ typedef struct XLlFifo {
 	u32 Datainterface;	/**< Data interface of the FIFO. This value is zero
 				 *	if the Datainterface is AXI4-lite.
 				 */
+	u32 RxBurst;		/**< Non-zero if the receive path uses 64 bit
+				 *	reads of the AXI4 data interface
+				 */
+	u32 TxBurst;		/**< Non-zero if the transmit path uses 64 bit
+				 *	writes of the AXI4 data interface
+				 */
+	Xil_Pool *RxPool;	/**< Pool the buffers of XLlFifo_RxLend are
+				 *	taken from
+				 */
 	XStrm_RxFifoStreamer RxStreamer; /**< RxStreamer is the byte streamer
 	                                  *   instance for the receive channel.
 	                                  */
@@ -701,6 +734,11 @@ u32 XLlFifo_iTxVacancy(XLlFifo *InstancePtr);
 void XLlFifo_iTxSetLen(XLlFifo *InstancePtr, u32 Bytes);
 u32 XLlFifo_RxGetWord(XLlFifo *InstancePtr);
 void XLlFifo_TxPutWord(XLlFifo *InstancePtr, u32 Word);
+int XLlFifo_RxSetBurst(XLlFifo *InstancePtr, u32 Enable);
+int XLlFifo_TxSetBurst(XLlFifo *InstancePtr, u32 Enable);
+void XLlFifo_RxSetPool(XLlFifo *InstancePtr, Xil_Pool *Pool);
+int XLlFifo_RxLend(XLlFifo *InstancePtr, void **BufPtr, u32 *BytesPtr);
+void XLlFifo_RxReturn(XLlFifo *InstancePtr, void *BufPtr);
 
 #ifdef __cplusplus
 }
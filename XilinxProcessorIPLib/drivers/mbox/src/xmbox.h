@@ -79,6 +79,24 @@
 * the processor will hang until the requested length is received, which might
 * be quite a long time.
 *
+* <b>Bulk Transfers</b>
+*
+* Moving bulk data through the FIFO is CPU bound. In bulk mode, the data is
+* left in buffers in memory shared by both processors, e.g. BRAM, and the
+* mailbox carries a single word descriptor per buffer:
+*
+*   - XMbox_BulkInit() sets up the pool of buffers sent by this processor and
+*     the pool of the remote. Both processors use the same buffer size and
+*     count, and pass each other's pools swapped.
+*   - XMbox_BulkGetBuffer() returns a free buffer of the local pool, which is
+*     passed to XMbox_BulkSend() once it is filled.
+*   - XMbox_BulkRecv() returns the next buffer sent by the remote, which is
+*     returned to the remote pool with XMbox_BulkRelease() once it is used.
+*   - XMbox_BulkSetBatch() raises the receive threshold interrupt only once
+*     a batch of descriptors is received.
+*
+* Cache maintenance of the buffers is left to the caller.
+*
 * @note
 *
 * This driver is intended to be RTOS and processor independent. It works with
@@ -138,6 +156,7 @@
 * 4.3   sa   04/20/17 Support for FIFO reset using hardware control register.
 *       sd   07/26/17 Modified tcl file to prevent false unconnected flagging.
 * 4.5   sd   09/03/20 Updated makefile for parallel execution.
+* 4.6   ag   10/15/26 Added bulk transfer mode, in file xmbox_bulk.c.
 *
 *</pre>
 *
@@ -157,6 +176,19 @@ extern "C" {
 
 /************************** Constant Definitions *****************************/
 
+/** @name Bulk Transfer Descriptor
+ *
+ * A descriptor is a single mailbox word, so it is sent and received
+ * atomically.
+ * @{
+ */
+#define XMBOX_BULK_MAX_BUFS	128U	/**< Max buffers in a pool */
+#define XMBOX_BULK_DESC_RELEASE	0x80000000U /**< Buffer returned to pool */
+#define XMBOX_BULK_DESC_INDEX_MASK	0x7F000000U /**< Buffer index */
+#define XMBOX_BULK_DESC_INDEX_SHIFT	24U	/**< Buffer index shift */
+#define XMBOX_BULK_DESC_LEN_MASK	0x00FFFFFFU /**< Length in bytes */
+/* @} */
+
 /**************************** Type Definitions *******************************/
 
 /**
@@ -183,6 +215,24 @@ typedef struct {
 	u32 IsReady;		/**< Device is initialized and ready */
 } XMbox;
 
+/**
+ * The bulk transfer state of a mailbox. The buffers are referred to by their
+ * index in the pools, which have to be at the same address for both
+ * processors.
+ */
+typedef struct {
+	XMbox *MboxPtr;		/**< Mailbox carrying the descriptors */
+	UINTPTR TxPoolAddr;	/**< Pool of the buffers sent */
+	UINTPTR RxPoolAddr;	/**< Pool of the buffers received */
+	u32 BufSize;		/**< Size of a buffer in bytes */
+	u32 NumBufs;		/**< Number of buffers in each pool */
+	u32 NumFree;		/**< Number of free buffers in the TX pool */
+	u8 FreeList[XMBOX_BULK_MAX_BUFS]; /**< Free buffers of the TX pool */
+	u32 RxHead;		/**< Descriptors received */
+	u32 RxTail;		/**< Descriptors returned by XMbox_BulkRecv */
+	u32 RxDesc[XMBOX_BULK_MAX_BUFS]; /**< Received data descriptors */
+} XMbox_Bulk;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /************************** Function Prototypes ******************************/
@@ -212,6 +262,18 @@ u32 XMbox_GetStatus(XMbox *InstancePtr);
 void XMbox_SetSendThreshold(XMbox *InstancePtr, u32 Value);
 void XMbox_SetReceiveThreshold(XMbox *InstancePtr, u32 Value);
 
+/*
+ * Bulk transfer functions, in file xmbox_bulk.c
+ */
+int XMbox_BulkInit(XMbox_Bulk *BulkPtr, XMbox *InstancePtr,
+		   UINTPTR TxPoolAddr, UINTPTR RxPoolAddr, u32 BufSize,
+		   u32 NumBufs);
+void *XMbox_BulkGetBuffer(XMbox_Bulk *BulkPtr);
+int XMbox_BulkSend(XMbox_Bulk *BulkPtr, void *BufPtr, u32 Length);
+int XMbox_BulkRecv(XMbox_Bulk *BulkPtr, void **BufPtrPtr, u32 *LengthPtr);
+int XMbox_BulkRelease(XMbox_Bulk *BulkPtr, void *BufPtr);
+void XMbox_BulkSetBatch(XMbox_Bulk *BulkPtr, u32 NumDesc);
+
 /*
  * Static initialization function, in file xmbox_sinit.c
  */
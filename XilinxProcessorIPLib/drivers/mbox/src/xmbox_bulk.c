@@ -0,0 +1,320 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xmbox_bulk.c
+* @addtogroup mbox_v4_5
+* @{
+*
+* Implements the bulk transfer mode, where the mailbox only carries the
+* descriptors of buffers in shared memory.
+* See xmbox.h for more information about the component.
+*
+* A descriptor is a single word holding the index of the buffer in its pool
+* and the length of the data. The same mailbox carries the descriptors of the
+* buffers sent, and the descriptors of the buffers released by the remote,
+* flagged with XMBOX_BULK_DESC_RELEASE. As the remote can't hold more buffers
+* than there are in the pool, the received descriptors always fit in the
+* instance while the released ones are looked for.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- ---------------------------------------------------
+* 4.6   ag   10/15/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+
+/****************************** Include Files ********************************/
+#include "xmbox.h"
+#include "xil_assert.h"
+
+/*************************** Constant Definitions ****************************/
+
+/***************************** Type Definitions ******************************/
+
+/****************** Macros (Inline Functions) Definitions ********************/
+
+/*************************** Variable Definitions ****************************/
+
+/*************************** Function Prototypes *****************************/
+
+/*****************************************************************************/
+/**
+*
+* Reads all the descriptors in the mailbox. The released buffers are put back
+* in the free list, and the descriptors of the buffers received are kept for
+* XMbox_BulkRecv().
+*
+* @param	BulkPtr is a pointer to the bulk transfer instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XMbox_BulkPoll(XMbox_Bulk *BulkPtr)
+{
+	u32 Desc;
+	u32 Index;
+	u32 BytesRecvd;
+
+	while (XMbox_Read(BulkPtr->MboxPtr, &Desc, 4, &BytesRecvd) ==
+	       XST_SUCCESS) {
+		Index = (Desc & XMBOX_BULK_DESC_INDEX_MASK) >>
+			XMBOX_BULK_DESC_INDEX_SHIFT;
+		if (Index >= BulkPtr->NumBufs) {
+			/* Not a descriptor of this pool */
+			continue;
+		}
+
+		if (Desc & XMBOX_BULK_DESC_RELEASE) {
+			BulkPtr->FreeList[BulkPtr->NumFree++] = (u8)Index;
+		} else {
+			BulkPtr->RxDesc[BulkPtr->RxHead %
+					XMBOX_BULK_MAX_BUFS] = Desc;
+			BulkPtr->RxHead++;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Initializes the bulk transfer mode of a mailbox. The pools hold NumBufs
+* buffers of BufSize bytes each. The remote processor initializes its bulk
+* transfer mode with the same buffer size and count, and the pools swapped.
+*
+* @param	BulkPtr is a pointer to the bulk transfer instance.
+* @param	InstancePtr is a pointer to the initialized mailbox.
+* @param	TxPoolAddr is the address of the pool of the buffers sent.
+* @param	RxPoolAddr is the address of the pool of the buffers received.
+* @param	BufSize is the size of a buffer in bytes.
+* @param	NumBufs is the number of buffers in each pool, up to
+*		XMBOX_BULK_MAX_BUFS.
+*
+* @return
+*		- XST_SUCCESS if initialization was successful
+*
+* @note		The mailbox is used only for the descriptors from now on.
+*
+******************************************************************************/
+int XMbox_BulkInit(XMbox_Bulk *BulkPtr, XMbox *InstancePtr,
+		   UINTPTR TxPoolAddr, UINTPTR RxPoolAddr, u32 BufSize,
+		   u32 NumBufs)
+{
+	u32 Index;
+
+	Xil_AssertNonvoid(BulkPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(BufSize != 0);
+	Xil_AssertNonvoid(BufSize <= (XMBOX_BULK_DESC_LEN_MASK + 1));
+	Xil_AssertNonvoid(NumBufs != 0);
+	Xil_AssertNonvoid(NumBufs <= XMBOX_BULK_MAX_BUFS);
+
+	BulkPtr->MboxPtr = InstancePtr;
+	BulkPtr->TxPoolAddr = TxPoolAddr;
+	BulkPtr->RxPoolAddr = RxPoolAddr;
+	BulkPtr->BufSize = BufSize;
+	BulkPtr->NumBufs = NumBufs;
+	BulkPtr->RxHead = 0;
+	BulkPtr->RxTail = 0;
+
+	for (Index = 0; Index < NumBufs; Index++) {
+		BulkPtr->FreeList[Index] = (u8)(NumBufs - 1 - Index);
+	}
+	BulkPtr->NumFree = NumBufs;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* Gets a free buffer of the local pool, to be filled and passed to
+* XMbox_BulkSend().
+*
+* @param	BulkPtr is a pointer to the bulk transfer instance.
+*
+* @return	A pointer to the buffer, or NULL if all the buffers are still
+*		held by the remote.
+*
+* @note		None.
+*
+******************************************************************************/
+void *XMbox_BulkGetBuffer(XMbox_Bulk *BulkPtr)
+{
+	u32 Index;
+
+	Xil_AssertNonvoid(BulkPtr != NULL);
+
+	if (BulkPtr->NumFree == 0) {
+		XMbox_BulkPoll(BulkPtr);
+		if (BulkPtr->NumFree == 0) {
+			return NULL;
+		}
+	}
+
+	Index = BulkPtr->FreeList[--BulkPtr->NumFree];
+
+	return (void *)(BulkPtr->TxPoolAddr + (Index * BulkPtr->BufSize));
+}
+
+/*****************************************************************************/
+/**
+*
+* Sends a buffer of the local pool to the remote. Only its descriptor goes
+* through the mailbox. The buffer belongs to the remote until it releases it.
+*
+* @param	BulkPtr is a pointer to the bulk transfer instance.
+* @param	BufPtr is the buffer returned by XMbox_BulkGetBuffer().
+* @param	Length is the length of the data in bytes.
+*
+* @return
+*		- XST_SUCCESS if the descriptor was sent
+*		- XST_FIFO_NO_ROOM if the mailbox is full, the buffer is still
+*		owned by the caller
+*
+* @note		None.
+*
+******************************************************************************/
+int XMbox_BulkSend(XMbox_Bulk *BulkPtr, void *BufPtr, u32 Length)
+{
+	u32 Desc;
+	u32 Index;
+	u32 BytesSent;
+
+	Xil_AssertNonvoid(BulkPtr != NULL);
+	Xil_AssertNonvoid((UINTPTR)BufPtr >= BulkPtr->TxPoolAddr);
+	Xil_AssertNonvoid(Length <= BulkPtr->BufSize);
+
+	Index = ((UINTPTR)BufPtr - BulkPtr->TxPoolAddr) / BulkPtr->BufSize;
+	Xil_AssertNonvoid(Index < BulkPtr->NumBufs);
+
+	Desc = (Index << XMBOX_BULK_DESC_INDEX_SHIFT) |
+		(Length & XMBOX_BULK_DESC_LEN_MASK);
+
+	return XMbox_Write(BulkPtr->MboxPtr, &Desc, 4, &BytesSent);
+}
+
+/*****************************************************************************/
+/**
+*
+* Receives the next buffer sent by the remote. The data is used in place, and
+* the buffer is returned to the remote with XMbox_BulkRelease().
+*
+* @param	BulkPtr is a pointer to the bulk transfer instance.
+* @param	BufPtrPtr is set to the buffer received.
+* @param	LengthPtr is set to the length of the data in bytes.
+*
+* @return
+*		- XST_SUCCESS if a buffer was received
+*		- XST_NO_DATA if no buffer was sent
+*
+* @note		None.
+*
+******************************************************************************/
+int XMbox_BulkRecv(XMbox_Bulk *BulkPtr, void **BufPtrPtr, u32 *LengthPtr)
+{
+	u32 Desc;
+	u32 Index;
+
+	Xil_AssertNonvoid(BulkPtr != NULL);
+	Xil_AssertNonvoid(BufPtrPtr != NULL);
+	Xil_AssertNonvoid(LengthPtr != NULL);
+
+	if (BulkPtr->RxHead == BulkPtr->RxTail) {
+		XMbox_BulkPoll(BulkPtr);
+		if (BulkPtr->RxHead == BulkPtr->RxTail) {
+			return XST_NO_DATA;
+		}
+	}
+
+	Desc = BulkPtr->RxDesc[BulkPtr->RxTail % XMBOX_BULK_MAX_BUFS];
+	BulkPtr->RxTail++;
+
+	Index = (Desc & XMBOX_BULK_DESC_INDEX_MASK) >>
+		XMBOX_BULK_DESC_INDEX_SHIFT;
+	*BufPtrPtr = (void *)(BulkPtr->RxPoolAddr + (Index * BulkPtr->BufSize));
+	*LengthPtr = Desc & XMBOX_BULK_DESC_LEN_MASK;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* Returns a buffer received with XMbox_BulkRecv() to the pool of the remote.
+*
+* @param	BulkPtr is a pointer to the bulk transfer instance.
+* @param	BufPtr is the buffer returned by XMbox_BulkRecv().
+*
+* @return
+*		- XST_SUCCESS if the buffer was released
+*		- XST_FIFO_NO_ROOM if the mailbox is full, the release has to
+*		be retried
+*
+* @note		None.
+*
+******************************************************************************/
+int XMbox_BulkRelease(XMbox_Bulk *BulkPtr, void *BufPtr)
+{
+	u32 Desc;
+	u32 Index;
+	u32 BytesSent;
+
+	Xil_AssertNonvoid(BulkPtr != NULL);
+	Xil_AssertNonvoid((UINTPTR)BufPtr >= BulkPtr->RxPoolAddr);
+
+	Index = ((UINTPTR)BufPtr - BulkPtr->RxPoolAddr) / BulkPtr->BufSize;
+	Xil_AssertNonvoid(Index < BulkPtr->NumBufs);
+
+	Desc = XMBOX_BULK_DESC_RELEASE | (Index << XMBOX_BULK_DESC_INDEX_SHIFT);
+
+	return XMbox_Write(BulkPtr->MboxPtr, &Desc, 4, &BytesSent);
+}
+
+/*****************************************************************************/
+/**
+*
+* Enables the receive threshold interrupt for a batch of descriptors, so
+* a single interrupt is raised for NumDesc buffers sent or released by the
+* remote. The interrupt handler calls XMbox_BulkRecv() until XST_NO_DATA is
+* returned. This function only applies to the Non-FSL interface, the FSL
+* interrupt being raised while there is data in the FIFO.
+*
+* @param	BulkPtr is a pointer to the bulk transfer instance.
+* @param	NumDesc is the number of descriptors in a batch, from 1 up to
+*		the FIFO depth.
+*
+* @return	None.
+*
+* @note		The remote has to send full batches, or the last descriptors
+*		are only seen by the next poll.
+*
+******************************************************************************/
+void XMbox_BulkSetBatch(XMbox_Bulk *BulkPtr, u32 NumDesc)
+{
+	XMbox *InstancePtr;
+
+	Xil_AssertVoid(BulkPtr != NULL);
+	Xil_AssertVoid(NumDesc != 0);
+
+	InstancePtr = BulkPtr->MboxPtr;
+	if (InstancePtr->Config.UseFSL == 0) {
+		/* RTI is set when the FIFO holds more entries than RIT */
+		XMbox_SetReceiveThreshold(InstancePtr, NumDesc - 1);
+		XMbox_SetInterruptEnable(InstancePtr,
+				XMbox_GetInterruptEnable(InstancePtr) |
+				XMB_IX_RTA);
+	}
+}
+/** @} */
@@ -21,6 +21,8 @@
 * 1.1    rsp    20/02/18 Fix unused variable warning.
 *                        Remove TimeOut variable.CR-979061
 * 1.3    rsp    14/02/19 Populate HasRxLength value from config.
+* 1.7    ag     14/10/26 Set the default scheduling weight of the channels.
+* 1.7    ag     15/10/26 Register the performance counters of the channels.
 *
 ******************************************************************************/
 
@@ -150,8 +152,11 @@ s32 XMcDma_Initialize(XMcdma *InstancePtr, XMcdma_Config *CfgPtr)
 			InstancePtr->Tx_Chan[i].MaxTransferLen =
 					MAX_TRANSFER_LEN(CfgPtr->MaxTransferlen - 1);
 			InstancePtr->Tx_Chan[i].IsRxChan = 0;
+			InstancePtr->Tx_Chan[i].SchedWeight = 1;
 			if (InstancePtr->Config.AddrWidth > 32)
 				InstancePtr->Tx_Chan[i].ext_addr = 1;
+			XIL_PERF_STATS_REGISTER(&InstancePtr->Tx_Chan[i].PerfStats,
+						"mcdma_tx", CfgPtr->BaseAddress);
 		}
 	}
 
@@ -172,8 +177,11 @@ s32 XMcDma_Initialize(XMcdma *InstancePtr, XMcdma_Config *CfgPtr)
 				   MAX_TRANSFER_LEN(CfgPtr->MaxTransferlen - 1);
 
 			InstancePtr->Rx_Chan[i].IsRxChan = 1;
+			InstancePtr->Rx_Chan[i].SchedWeight = 1;
 			if (InstancePtr->Config.AddrWidth > 32)
 				InstancePtr->Rx_Chan[i].ext_addr = 1;
+			XIL_PERF_STATS_REGISTER(&InstancePtr->Rx_Chan[i].PerfStats,
+						"mcdma_rx", CfgPtr->BaseAddress);
 		}
 	}
 
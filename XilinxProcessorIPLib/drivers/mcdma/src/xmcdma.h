@@ -62,6 +62,31 @@
 *   BDs back to the free pool:
 *      - XMcdma_BdChainFree(...)
 *
+* <b> Scheduling and polling </b>
+*
+* XMcdma_SchedNextChan() picks the next channel to submit to in weighted
+* round-robin order among the channels that have work, so that one busy
+* channel cannot starve the others. The weights are set with
+* XMcdma_SetChanSchedWeight().
+*
+* XMcdma_Poll() reaps completed BDs of all channels of one direction, in
+* the same weighted round-robin order, up to a budget. The completed BDs of
+* each channel are passed to the handler installed with XMCDMA_HANDLER_POLL
+* or XMCDMA_TX_HANDLER_POLL, which must free them. Run from a deferred
+* context with the channel interrupts disabled, this bounds the time spent
+* per call in the same way as NAPI polling.
+*
+* Per channel packet, byte, error and drop counters are maintained by
+* XMcdma_BdChainFromHW() and the interrupt handlers, and are read with
+* XMcdma_GetChanStats().
+*
+* XMcdma_ChanDimInit() enables adaptive interrupt moderation on a channel.
+* XMcdma_ChanDimUpdate(), called at a fixed interval, feeds the packets,
+* bytes and interrupts of the channel in that interval to the controller of
+* xil_dim.h, which moves the coalesce count and delay timer of the channel
+* between the lowest latency and the highest coalescing profile as the load
+* changes.
+*
 * The driver also provides API functions to get the status of a completed
 * BD, along with get functions for other fields in the BD.
 *
@@ -123,6 +148,15 @@
 * 			 the gcc warning in mcdma integration test suite.
 * 1.7   sa      08/12/22 Updated the examples to use latest MIG cannoical define
 * 		         i.e XPAR_MIG_0_C0_DDR4_MEMORY_MAP_BASEADDR.
+* 1.7   ag      14/10/26 Added per channel statistics, the weighted
+*                        round-robin channel scheduler XMcdma_SchedNextChan()
+*                        and the budget limited XMcdma_Poll() API. The
+*                        interrupt handlers now rotate the order in which
+*                        channels are serviced.
+* 1.7   ag      14/10/26 Added adaptive interrupt moderation,
+*                        XMcdma_ChanDimInit() and XMcdma_ChanDimUpdate().
+* 1.7   ag      15/10/26 Added the PerfStats performance counters of the
+*                        channels, enabled with XIL_PERF_STATS_ENABLE.
 ******************************************************************************/
 #ifndef XMCDMA_H_
 #define XMCDMA_H_
@@ -138,6 +172,8 @@ extern "C" {
 #include "xil_assert.h"
 #include "xstatus.h"
 #include "xil_cache.h"
+#include "xil_dim.h"
+#include "xil_perfstats.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -149,6 +185,8 @@ extern "C" {
 #define XMCDMA_CHAN_BUSY		2
 #define XMCDMA_BD_MINIMUM_ALIGNMENT	0x40
 #define XMCDMA_AXCACHE			0xB
+#define XMCDMA_POLL_QUANTUM		16	/**< BDs reaped per unit of
+						  *  scheduling weight */
 
 /* Direction flags */
 #define XMCDMA_DEV_TO_MEM		0
@@ -162,6 +200,8 @@ typedef enum {
 	XMCDMA_HANDLER_DONE,     /**< For Done Handler */
 	XMCDMA_HANDLER_ERROR,    /**< For Error Handler */
 	XMCDMA_HANDLER_PKTDROP,    /**< For Error Handler */
+	XMCDMA_TX_HANDLER_POLL,    /**< For MM2S Poll Handler */
+	XMCDMA_HANDLER_POLL,       /**< For S2MM Poll Handler */
 } XMcdma_Handler;
 
 typedef enum {
@@ -175,6 +215,8 @@ typedef void (*XMcdma_ErrorHandler) (void *CallBackRef, u32 Chan_id, u32 ErrorMa
 typedef void (*XMcdma_PktDropHandler) (void *CallBackRef, u32 Chan_Id);
 typedef void (*XMcdma_TxDoneHandler) (void *CallBackRef, u32 Chan_Id);
 typedef void (*XMcdma_TxErrorHandler) (void *CallBackRef, u32 Chan_id, u32 ErrorMask);
+typedef void (*XMcdma_PollHandler) (void *CallBackRef, u32 Chan_Id,
+				    XMcdma_Bd *BdSetPtr, int BdCount);
 
 
 typedef void (*XMcdma_ChanDoneHandler) (void *CallBackRef);
@@ -187,6 +229,13 @@ typedef enum {
 	XMCDMA_WRR_PRIORITY,
 } XMcdma_QScheduler;
 
+typedef struct {
+	u64 Bytes;		/**< Bytes of completed packets */
+	u32 Packets;		/**< Completed packets */
+	u32 Errors;		/**< Completed packets with a BD error */
+	u32 Drops;		/**< Packets dropped by the S2MM channel */
+} XMcdma_ChanStats;
+
 typedef struct {
 	UINTPTR ChanBase;
 	u32 Chan_id;		/* Channel Number */
@@ -229,6 +278,18 @@ typedef struct {
 	                                     * interrupt callback */
 	XMcdma_ChanPktDropHandler PktdropHandler;
 	void *PktDropRef;
+
+	XMcdma_ChanStats Stats;		/**< Channel statistics */
+	u32 SchedWeight;		/**< Weighted round-robin weight */
+	u32 SchedCredit;		/**< Turns left in the current round */
+	u32 DimEnabled;			/**< Adaptive moderation is enabled */
+	u32 DimEvents;			/**< Interrupts in this epoch */
+	u32 DimPackets;			/**< Stats.Packets at the epoch start */
+	u64 DimBytes;			/**< Stats.Bytes at the epoch start */
+	Xil_Dim Dim;			/**< Adaptive moderation controller */
+#ifdef XIL_PERF_STATS_ENABLE
+	Xil_PerfStats PerfStats;	/**< Performance counters */
+#endif
 } XMcdma_ChanCtrl;
 
 typedef struct {
@@ -278,7 +339,18 @@ typedef struct {
 	                                          *  interrupt */
 	void *PktDropRef;                 /**< To be passed to the error
 	                                     * interrupt callback */
-
+	XMcdma_PollHandler TxPollHandler; /**< Call back for MM2S BDs
+	                                     *  reaped by XMcdma_Poll */
+	void *TxPollRef;
+	XMcdma_PollHandler PollHandler;   /**< Call back for S2MM BDs
+	                                     *  reaped by XMcdma_Poll */
+	void *PollRef;
+
+	u32 TxSchedChan;	/**< Last channel picked by the scheduler */
+	u32 TxPollChan;		/**< Last MM2S channel polled */
+	u32 RxPollChan;		/**< Last S2MM channel polled */
+	u32 TxIntrChan;		/**< Last MM2S channel serviced */
+	u32 RxIntrChan;		/**< Last S2MM channel serviced */
 } XMcdma;
 /***************** Macros (Inline Functions) Definitions *********************/
 
@@ -627,6 +699,16 @@ s32 XMcdma_SetCallBack(XMcdma *InstancePtr, XMcdma_Handler HandlerType,
 void XMcdma_ChanIntrHandler(void *Instance);
 s32 XMcdma_ChanSetCallBack(XMcdma_ChanCtrl *Chan, XMcdma_ChanHandler HandlerType,
 			      void *CallBackFunc, void *CallBackRef);
+
+/* Scheduling, polling and statistics */
+void XMcdma_SetChanSchedWeight(XMcdma_ChanCtrl *Chan, u32 Weight);
+u32 XMcdma_SchedNextChan(XMcdma *InstancePtr, u32 ReadyMask);
+u32 XMcdma_Poll(XMcdma *InstancePtr, u32 Direction, u32 Budget);
+void XMcdma_GetChanStats(XMcdma_ChanCtrl *Chan, XMcdma_ChanStats *StatsPtr);
+void XMcdma_ResetChanStats(XMcdma_ChanCtrl *Chan);
+u32 XMcdma_ChanDimInit(XMcdma_ChanCtrl *Chan, const Xil_DimProfile *Profiles,
+		       u32 NumProfiles);
+u32 XMcdma_ChanDimUpdate(XMcdma_ChanCtrl *Chan);
 #ifdef __cplusplus
 }
 
@@ -22,6 +22,9 @@
 *  1.3  rsp  02/11/19 Add top level submit XMcDma_Chan_Sideband_Submit() API
 *                     to program BD control and sideband information.
 *  1.4  rsp  09/17/19 Prefer using dmb in XMcdma_UpdateChanTDesc.
+*  1.7  ag   14/10/26 Update the channel statistics in XMcdma_BdChainFromHW.
+*  1.7  ag   15/10/26 Update the performance counters in
+*                     XMcdma_BdChainFromHW.
 ******************************************************************************/
 
 #include "xmcdma.h"
@@ -462,12 +465,20 @@ int XMcdma_BdChainFromHW(XMcdma_ChanCtrl *Chan, u32 BdLimit, XMcdma_Bd **BdSetPt
 	int BdPartialCount;
 	volatile u32 BdSts;
 	volatile u32 BdCr;
+	u32 PktBytes;
+	u32 PktErrors;
+#ifdef XIL_PERF_STATS_ENABLE
+	u64 StartBytes = Chan->Stats.Bytes;
+	u32 StartErrors = Chan->Stats.Errors;
+#endif
 
 	CurBdPtr = Chan->BdHead;
 	BdCount = 0;
 	BdPartialCount = 0;
 	BdSts = 0;
 	BdCr = 0;
+	PktBytes = 0;
+	PktErrors = 0;
 
 	if (Chan->BdSubmitCnt == 0) {
 		*BdSetPtr = NULL;
@@ -494,10 +505,25 @@ int XMcdma_BdChainFromHW(XMcdma_ChanCtrl *Chan, u32 BdLimit, XMcdma_Bd **BdSetPt
 
 		BdCount++;
 
+		/* Collect the statistics of the packet, committed on its last BD */
+		if (Chan->IsRxChan) {
+			PktBytes += BdSts & Chan->MaxTransferLen;
+		} else {
+			PktBytes += BdCr & Chan->MaxTransferLen;
+		}
+		if (BdSts & XMCDMA_BD_STS_ALL_ERR_MASK) {
+			PktErrors = 1;
+		}
+
 		/* Need to handle Tx case as well */
 		if ((!(Chan->IsRxChan) && (BdCr & XMCDMA_BD_CTRL_EOF_MASK)) ||
 		    (Chan->IsRxChan && (BdSts & XMCDMA_BD_STS_RXEOF_MASK))) {
 			BdPartialCount = 0;
+			Chan->Stats.Packets++;
+			Chan->Stats.Bytes += PktBytes;
+			Chan->Stats.Errors += PktErrors;
+			PktBytes = 0;
+			PktErrors = 0;
 		} else {
 			BdPartialCount++;
 		}
@@ -517,6 +543,11 @@ int XMcdma_BdChainFromHW(XMcdma_ChanCtrl *Chan, u32 BdLimit, XMcdma_Bd **BdSetPt
 		Chan->BdCnt += BdCount;
 		Chan->BdDoneCnt += BdCount;
 		XMCDMA_CHAN_SEEKAHEAD(Chan, Chan->BdHead, BdCount);
+		XIL_PERF_STATS_OPS(&Chan->PerfStats, BdCount,
+				   Chan->Stats.Bytes - StartBytes);
+#ifdef XIL_PERF_STATS_ENABLE
+		Chan->PerfStats.Errors += Chan->Stats.Errors - StartErrors;
+#endif
 
 		return BdCount;
 	} else {
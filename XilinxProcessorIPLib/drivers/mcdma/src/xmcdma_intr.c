@@ -18,6 +18,13 @@
 * Ver   Who     Date     Changes
 * ----- ------  -------- ------------------------------------------------------
 * 1.0    adk    18/07/17 Initial version.
+* 1.7    ag     14/10/26 Service the channels of XMcdma_IntrHandler and
+*                        XMcdma_TxIntrHandler in rotating order, count
+*                        dropped packets and add the poll handler types.
+* 1.7    ag     14/10/26 Count the done interrupts of each channel for
+*                        adaptive interrupt moderation.
+* 1.7    ag     15/10/26 Count interrupts and errors in the performance
+*                        counters of the channels.
 *
 ******************************************************************************/
 
@@ -81,13 +88,21 @@ void XMcdma_ChanIntrHandler(void *Instance)
 		return;
 	}
 
+	XIL_PERF_STATS_INTR(&Chan->PerfStats);
+
 	if ((IrqStatus & (XMCDMA_IRQ_DELAY_MASK | XMCDMA_IRQ_IOC_MASK))) {
                 Chan->ChanState = XMCDMA_CHAN_IDLE;
+		Chan->DimEvents++;
                 Chan->DoneHandler(Chan->DoneRef);
 	}
 
+	if ((IrqStatus & XMCDMA_IRQ_PKTDROP_MASK) && (Chan->IsRxChan)) {
+		Chan->Stats.Drops += XMcdma_GetChanPktDrp_Cnt(Chan, Chan->Chan_id);
+	}
+
 	if ((IrqStatus & XMCDMA_IRQ_ERROR_MASK)) {
 		Chan->ChanState = XMCDMA_CHAN_PAUSE;
+		XIL_PERF_STATS_ERROR(&Chan->PerfStats);
 		Chan->ErrorHandler(Chan->ErrorRef, IrqStatus);
 	}
 }
@@ -188,6 +203,7 @@ void XMcdma_IntrHandler(void *Instance)
 	XMcdma_ChanCtrl *Chan = NULL;
 	u32 i;
 	u32 Chan_SerMask;
+	u32 NumChans = (u32)InstancePtr->Config.RxNumChannels;
 
 	/* Serviced Channel Numbers */
 	while (1) {
@@ -197,9 +213,15 @@ void XMcdma_IntrHandler(void *Instance)
 		if (!Chan_SerMask)
 			goto out;
 
-		for (i = 1, Chan_id = 1; i != 0 && i <= Chan_SerMask;
-			i <<= 1, Chan_id++) {
-			if (Chan_SerMask & i) {
+		/* Start after the channel serviced last, so that under load a
+		 * low numbered channel does not always go first
+		 */
+		for (i = 0, Chan_id = InstancePtr->RxIntrChan; i < NumChans;
+			i++) {
+			if (++Chan_id > NumChans)
+				Chan_id = 1;
+			if (Chan_SerMask & (1U << (Chan_id - 1))) {
+				InstancePtr->RxIntrChan = Chan_id;
 				Chan = XMcdma_GetMcdmaRxChan(InstancePtr,
 							     Chan_id);
 				IrqStatus = XMcdma_ChanGetIrq(Chan);
@@ -209,16 +231,21 @@ void XMcdma_IntrHandler(void *Instance)
 
 				/* If no interrupt is asserted, we do not do anything */
 				 if (!(IrqStatus & XMCDMA_IRQ_ALL_MASK)) {
-					 return;
+					 continue;
 				 }
 
+				 XIL_PERF_STATS_INTR(&Chan->PerfStats);
+
 				 if ((IrqStatus & (XMCDMA_IRQ_DELAY_MASK | XMCDMA_IRQ_IOC_MASK))) {
 					 Chan->ChanState = XMCDMA_CHAN_IDLE;
+					 Chan->DimEvents++;
 					 InstancePtr->DoneHandler(InstancePtr->DoneRef, Chan_id);
 				 }
 
 				 if ((IrqStatus & XMCDMA_IRQ_PKTDROP_MASK)) {
 					 Chan->ChanState = XMCDMA_CHAN_IDLE;
+					 Chan->Stats.Drops +=
+						 XMcdma_GetChanPktDrp_Cnt(Chan, Chan_id);
 					 InstancePtr->PktDropHandler(InstancePtr->PktDropRef, Chan_id);
 				}
 
@@ -227,6 +254,7 @@ void XMcdma_IntrHandler(void *Instance)
 				  */
 				 if ((IrqStatus & XMCDMA_IRQ_ERROR_MASK)) {
 					Chan->ChanState = XMCDMA_CHAN_PAUSE;
+					XIL_PERF_STATS_ERROR(&Chan->PerfStats);
 					InstancePtr->ErrorHandler(InstancePtr->ErrorRef, Chan_id, IrqStatus);
 				 }
 			}
@@ -268,6 +296,7 @@ void XMcdma_TxIntrHandler(void *Instance)
 	XMcdma_ChanCtrl *Chan = NULL;
 	u32 i;
 	u32 Chan_SerMask;
+	u32 NumChans = (u32)InstancePtr->Config.TxNumChannels;
 
 	/* Serviced Channel Numbers */
 	while(1) {
@@ -277,9 +306,13 @@ void XMcdma_TxIntrHandler(void *Instance)
 		if (!Chan_SerMask)
 			goto out;
 
-		for (i = 1, Chan_id = 1; i != 0 && i <= Chan_SerMask;
-			i <<= 1, Chan_id++) {
-			if (Chan_SerMask & i) {
+		/* Start after the channel serviced last */
+		for (i = 0, Chan_id = InstancePtr->TxIntrChan; i < NumChans;
+			i++) {
+			if (++Chan_id > NumChans)
+				Chan_id = 1;
+			if (Chan_SerMask & (1U << (Chan_id - 1))) {
+				InstancePtr->TxIntrChan = Chan_id;
 				Chan = XMcdma_GetMcdmaTxChan(InstancePtr, Chan_id);
 
 				IrqStatus = XMcdma_ChanGetIrq(Chan);
@@ -291,11 +324,14 @@ void XMcdma_TxIntrHandler(void *Instance)
 				  * If no interrupt is asserted, we do not do anything
 				  */
 				 if (!(IrqStatus & XMCDMA_IRQ_ALL_MASK)) {
-					 return;
+					 continue;
 				 }
 
+				 XIL_PERF_STATS_INTR(&Chan->PerfStats);
+
 				 if ((IrqStatus & (XMCDMA_IRQ_DELAY_MASK | XMCDMA_IRQ_IOC_MASK))) {
 					 Chan->ChanState = XMCDMA_CHAN_IDLE;
+					 Chan->DimEvents++;
 					 InstancePtr->TxDoneHandler(InstancePtr->TxDoneRef, Chan_id);
 				 }
 
@@ -304,6 +340,7 @@ void XMcdma_TxIntrHandler(void *Instance)
 				  */
 				 if ((IrqStatus & XMCDMA_IRQ_ERROR_MASK)) {
 					Chan->ChanState = XMCDMA_CHAN_PAUSE;
+					XIL_PERF_STATS_ERROR(&Chan->PerfStats);
 					InstancePtr->TxErrorHandler(InstancePtr->TxErrorRef, Chan_id, IrqStatus);
 				 }
 			}
@@ -328,6 +365,8 @@ out:
 * XMCDMA_HANDLER_DONE      S2MM(RX) Done handler
 * XMCDMA_HANDLER_ERROR     S2MM(RX) Error handler
 * XMCDMA_HANDLER_PKTDROP   S2MM(RX) Packet drop handler
+* XMCDMA_TX_HANDLER_POLL   MM2S(TX) handler for BDs reaped by XMcdma_Poll
+* XMCDMA_HANDLER_POLL      S2MM(RX) handler for BDs reaped by XMcdma_Poll
 *
 * </pre>
 *
@@ -357,7 +396,9 @@ s32 XMcdma_SetCallBack(XMcdma *InstancePtr, XMcdma_Handler HandlerType,
 			  (HandlerType == XMCDMA_TX_HANDLER_ERROR) ||
 			  (HandlerType == XMCDMA_HANDLER_DONE) ||
 			  (HandlerType == XMCDMA_HANDLER_ERROR) ||
-			  (HandlerType == XMCDMA_HANDLER_PKTDROP));
+			  (HandlerType == XMCDMA_HANDLER_PKTDROP) ||
+			  (HandlerType == XMCDMA_TX_HANDLER_POLL) ||
+			  (HandlerType == XMCDMA_HANDLER_POLL));
 
 	/*
 	 * Calls the respective callback function corresponding to
@@ -394,6 +435,18 @@ s32 XMcdma_SetCallBack(XMcdma *InstancePtr, XMcdma_Handler HandlerType,
 		Status = (XST_SUCCESS);
 		break;
 
+	case XMCDMA_TX_HANDLER_POLL:
+		InstancePtr->TxPollHandler = (XMcdma_PollHandler)((void *)CallBackFunc);
+		InstancePtr->TxPollRef = CallBackRef;
+		Status = (XST_SUCCESS);
+		break;
+
+	case XMCDMA_HANDLER_POLL:
+		InstancePtr->PollHandler = (XMcdma_PollHandler)((void *)CallBackFunc);
+		InstancePtr->PollRef = CallBackRef;
+		Status = (XST_SUCCESS);
+		break;
+
 	default:
 		Status = (XST_INVALID_PARAM);
 		break;
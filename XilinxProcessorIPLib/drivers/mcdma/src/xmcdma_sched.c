@@ -0,0 +1,385 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xmcdma_sched.c
+* @addtogroup mcdma_v1_7
+* @{
+*
+* This file contains the weighted round-robin channel scheduler, the budget
+* limited poll function, the channel statistics and the adaptive interrupt
+* moderation of the MCDMA driver.
+*
+* Each channel has a scheduling weight, 1 by default. The scheduler gives a
+* channel up to Weight consecutive turns before moving on to the next
+* channel that has work, and XMcdma_Poll() reaps up to
+* Weight * XMCDMA_POLL_QUANTUM BDs of a channel before moving on.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- ------------------------------------------------------
+* 1.7   ag      14/10/26 Initial version.
+* 1.7   ag      14/10/26 Added XMcdma_ChanDimInit() and XMcdma_ChanDimUpdate().
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xmcdma.h"
+
+/************************** Constant Definitions *****************************/
+
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#define XMCDMA_CHAN_BIT(Chan_id)	((u32)1 << ((Chan_id) - 1))
+
+/**************************** Type Definitions *******************************/
+
+
+/************************** Function Prototypes ******************************/
+
+
+/************************** Variable Definitions *****************************/
+
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function sets the weight of a channel for XMcdma_SchedNextChan() and
+* XMcdma_Poll().
+*
+* @param	Chan is the MCDMA Channel to be worked on.
+* @param	Weight is the number of turns the channel gets per round, it
+*		must not be 0.
+*
+* @return	None.
+*
+* @note		This is a software weight. The weight of the MM2S hardware
+*		scheduler is set with XMCdma_SetChan_Weight().
+*
+******************************************************************************/
+void XMcdma_SetChanSchedWeight(XMcdma_ChanCtrl *Chan, u32 Weight)
+{
+	Xil_AssertVoid(Chan != NULL);
+	Xil_AssertVoid(Weight != 0);
+
+	Chan->SchedWeight = Weight;
+	if (Chan->SchedCredit >= Weight) {
+		Chan->SchedCredit = Weight - 1;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function picks the MM2S channel to submit the next packet to, in
+* weighted round-robin order among the ready channels.
+*
+* @param	InstancePtr is a pointer to the XMcdma instance.
+* @param	ReadyMask has bit (Chan_id - 1) set for each channel that has
+*		a packet waiting and enough free BDs to take it.
+*
+* @return	The channel number, 1 based, or 0 if no channel is ready.
+*
+* @note		Each call that returns a channel uses one turn of that
+*		channel. A channel that is not ready loses the rest of its
+*		turns in the current round.
+*
+******************************************************************************/
+u32 XMcdma_SchedNextChan(XMcdma *InstancePtr, u32 ReadyMask)
+{
+	XMcdma_ChanCtrl *Chan;
+	u32 NumChans;
+	u32 Chan_id;
+	u32 i;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	NumChans = (u32)InstancePtr->Config.TxNumChannels;
+	if (NumChans < 32) {
+		ReadyMask &= ((u32)1 << NumChans) - 1;
+	}
+	if (!ReadyMask) {
+		return 0;
+	}
+
+	/* Stay on the current channel while it has turns left */
+	Chan_id = InstancePtr->TxSchedChan;
+	if (Chan_id && (ReadyMask & XMCDMA_CHAN_BIT(Chan_id))) {
+		Chan = XMcdma_GetMcdmaTxChan(InstancePtr, Chan_id);
+		if (Chan->SchedCredit) {
+			Chan->SchedCredit--;
+			return Chan_id;
+		}
+	}
+
+	for (i = 0; i < NumChans; i++) {
+		if (++Chan_id > NumChans)
+			Chan_id = 1;
+		if (ReadyMask & XMCDMA_CHAN_BIT(Chan_id)) {
+			break;
+		}
+	}
+
+	Chan = XMcdma_GetMcdmaTxChan(InstancePtr, Chan_id);
+	Chan->SchedCredit = Chan->SchedWeight - 1;
+	InstancePtr->TxSchedChan = Chan_id;
+
+	return Chan_id;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reaps the completed BDs of all channels of one direction, up
+* to a budget. The channels are visited in round-robin order starting after
+* the channel visited last, and each visit reaps up to
+* SchedWeight * XMCDMA_POLL_QUANTUM BDs. The completed BDs of a channel are
+* passed to the handler installed with XMCDMA_TX_HANDLER_POLL or
+* XMCDMA_HANDLER_POLL, which must free them with XMcdma_BdChainFree().
+*
+* The intended use is NAPI style: disable the channel interrupts in the done
+* handler and schedule a deferred task, which calls this function until it
+* returns less than Budget and then enables the interrupts again.
+*
+* @param	InstancePtr is a pointer to the XMcdma instance.
+* @param	Direction is XMCDMA_MEM_TO_DEV for MM2S or XMCDMA_DEV_TO_MEM
+*		for S2MM.
+* @param	Budget is the maximum number of BDs to reap.
+*
+* @return	The number of BDs reaped. A value less than Budget means no
+*		completed BDs were left.
+*
+* @note		A packet with more BDs than the per visit limit of its
+*		channel is not reaped, set a larger weight for such channels.
+*
+******************************************************************************/
+u32 XMcdma_Poll(XMcdma *InstancePtr, u32 Direction, u32 Budget)
+{
+	XMcdma_ChanCtrl *Chan;
+	XMcdma_PollHandler Handler;
+	XMcdma_Bd *BdSetPtr;
+	void *Ref;
+	u32 *LastChanPtr;
+	u32 NumChans;
+	u32 Chan_id;
+	u32 Quota;
+	u32 Done = 0;
+	u32 Progress;
+	u32 i;
+	int BdCount;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid((Direction == XMCDMA_MEM_TO_DEV) ||
+			  (Direction == XMCDMA_DEV_TO_MEM));
+
+	if (Direction == XMCDMA_MEM_TO_DEV) {
+		NumChans = (u32)InstancePtr->Config.TxNumChannels;
+		LastChanPtr = &InstancePtr->TxPollChan;
+		Handler = InstancePtr->TxPollHandler;
+		Ref = InstancePtr->TxPollRef;
+	} else {
+		NumChans = (u32)InstancePtr->Config.RxNumChannels;
+		LastChanPtr = &InstancePtr->RxPollChan;
+		Handler = InstancePtr->PollHandler;
+		Ref = InstancePtr->PollRef;
+	}
+
+	Xil_AssertNonvoid(Handler != NULL);
+
+	do {
+		Progress = 0;
+		for (i = 0; (i < NumChans) && (Done < Budget); i++) {
+			Chan_id = *LastChanPtr + 1;
+			if (Chan_id > NumChans)
+				Chan_id = 1;
+			*LastChanPtr = Chan_id;
+
+			if (Direction == XMCDMA_MEM_TO_DEV)
+				Chan = XMcdma_GetMcdmaTxChan(InstancePtr, Chan_id);
+			else
+				Chan = XMcdma_GetMcdmaRxChan(InstancePtr, Chan_id);
+
+			Quota = Chan->SchedWeight * XMCDMA_POLL_QUANTUM;
+			if (Quota > (Budget - Done))
+				Quota = Budget - Done;
+
+			BdCount = XMcdma_BdChainFromHW(Chan, Quota, &BdSetPtr);
+			if (BdCount > 0) {
+				Handler(Ref, Chan_id, BdSetPtr, BdCount);
+				Done += (u32)BdCount;
+				Progress = 1;
+			}
+		}
+	} while (Progress && (Done < Budget));
+
+	return Done;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the statistics of a channel.
+*
+* @param	Chan is the MCDMA Channel to be worked on.
+* @param	StatsPtr is a pointer to the statistics to fill in.
+*
+* @return	None.
+*
+* @note		Packets, bytes and errors are counted by
+*		XMcdma_BdChainFromHW(). Drops are read from the packet drop
+*		counter of the channel when the packet drop interrupt is
+*		serviced, so they are only counted with that interrupt enabled.
+*
+******************************************************************************/
+void XMcdma_GetChanStats(XMcdma_ChanCtrl *Chan, XMcdma_ChanStats *StatsPtr)
+{
+	Xil_AssertVoid(Chan != NULL);
+	Xil_AssertVoid(StatsPtr != NULL);
+
+	*StatsPtr = Chan->Stats;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function clears the statistics of a channel.
+*
+* @param	Chan is the MCDMA Channel to be worked on.
+*
+* @return	None.
+*
+******************************************************************************/
+void XMcdma_ResetChanStats(XMcdma_ChanCtrl *Chan)
+{
+	Xil_AssertVoid(Chan != NULL);
+
+	Chan->Stats.Bytes = 0;
+	Chan->Stats.Packets = 0;
+	Chan->Stats.Errors = 0;
+	Chan->Stats.Drops = 0;
+	Chan->DimPackets = 0;
+	Chan->DimBytes = 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function enables adaptive interrupt moderation on a channel. The
+* channel starts on the first, lowest latency, profile. From then on the
+* coalesce count and delay timer are set by XMcdma_ChanDimUpdate() and must
+* not be changed with XMcdma_SetChanCoalesceDelay().
+*
+* @param	Chan is the MCDMA Channel to be worked on.
+* @param	Profiles is the profile table, ordered from the lowest latency
+*		to the highest coalescing, or NULL for the default table of
+*		xil_dim.h.
+* @param	NumProfiles is the number of profiles in the table.
+*
+* @return
+*		- XST_SUCCESS if the moderation is enabled.
+*		- XST_INVALID_PARAM if the table is empty.
+*		- XST_FAILURE if a profile is out of the range of the coalesce
+*		count or the delay timer.
+*
+* @note		The delay timer of the channel cannot be disabled, a profile
+*		Timer of 0 is applied as 1. Use Xil_DimSetBounds() on Chan->Dim
+*		to limit the profiles used, and thus the added latency.
+*
+******************************************************************************/
+u32 XMcdma_ChanDimInit(XMcdma_ChanCtrl *Chan, const Xil_DimProfile *Profiles,
+		       u32 NumProfiles)
+{
+	const Xil_DimProfile *Profile;
+	u32 Index;
+	u32 Status;
+
+	Xil_AssertNonvoid(Chan != NULL);
+
+	Status = (u32)Xil_DimInit(&Chan->Dim, Profiles, NumProfiles);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	for (Index = 0; Index < Chan->Dim.NumProfiles; Index++) {
+		Profile = &Chan->Dim.Profiles[Index];
+		if ((Profile->Count == 0) || (Profile->Count > 0xFF) ||
+		    (Profile->Timer > 0xFF)) {
+			return XST_FAILURE;
+		}
+	}
+
+	Chan->DimEvents = 0;
+	Chan->DimPackets = Chan->Stats.Packets;
+	Chan->DimBytes = Chan->Stats.Bytes;
+	Chan->DimEnabled = 1;
+
+	Profile = Xil_DimGetProfile(&Chan->Dim);
+
+	return XMcdma_SetChanCoalesceDelay(Chan, Profile->Count,
+			(Profile->Timer != 0) ? Profile->Timer : 1);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function closes one epoch of adaptive interrupt moderation of a
+* channel. The packets and bytes counted in the channel statistics and the
+* done interrupts taken since the previous call are fed to the controller,
+* and the coalesce count and delay timer are updated when it picks a new
+* profile.
+*
+* @param	Chan is the MCDMA Channel to be worked on.
+*
+* @return
+*		- XST_SUCCESS if the epoch was processed.
+*		- XST_NOT_ENABLED if XMcdma_ChanDimInit() was not called.
+*		- XST_FAILURE if the new profile could not be applied.
+*
+* @note		Call this function at a fixed interval, for example from a
+*		timer tick. The current profile, level and state are read with
+*		Xil_DimGetProfile(), Xil_DimGetLevel() and Xil_DimGetState() on
+*		Chan->Dim.
+*
+******************************************************************************/
+u32 XMcdma_ChanDimUpdate(XMcdma_ChanCtrl *Chan)
+{
+	const Xil_DimProfile *Profile;
+	Xil_DimSample Sample;
+	u64 Bytes;
+
+	Xil_AssertNonvoid(Chan != NULL);
+
+	if (!Chan->DimEnabled) {
+		return XST_NOT_ENABLED;
+	}
+
+	Bytes = Chan->Stats.Bytes - Chan->DimBytes;
+	Sample.Packets = Chan->Stats.Packets - Chan->DimPackets;
+	Sample.Bytes = (Bytes > 0xFFFFFFFFU) ? 0xFFFFFFFFU : (u32)Bytes;
+	Sample.Events = Chan->DimEvents;
+
+	Chan->DimPackets = Chan->Stats.Packets;
+	Chan->DimBytes = Chan->Stats.Bytes;
+	Chan->DimEvents = 0;
+
+	if (Xil_DimUpdate(&Chan->Dim, &Sample)) {
+		Profile = Xil_DimGetProfile(&Chan->Dim);
+
+		return XMcdma_SetChanCoalesceDelay(Chan, Profile->Count,
+				(Profile->Timer != 0) ? Profile->Timer : 1);
+	}
+
+	return XST_SUCCESS;
+}
+/** @} */
@@ -147,6 +147,7 @@ u32 XCsiSs_CfgInitialize(XCsiSs *InstancePtr, XCsiSs_Config *CfgPtr,
 		}
 	}
 #endif
+	InstancePtr->CapturePtr = NULL;
 	InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
 	return XST_SUCCESS;
 }
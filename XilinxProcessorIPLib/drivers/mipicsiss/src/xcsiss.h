@@ -124,6 +124,8 @@
 *                  for CR-965028.
 *     ms  03/17/17 Added readme.txt file in examples folder for doxygen
 *                  generation.
+* 1.8 ag  10/15/26 Added the capture pipeline API which counts frames and
+*                  errors per virtual channel and drives frame buffer rings.
 * </pre>
 *
 ******************************************************************************/
@@ -146,6 +148,9 @@ extern "C" {
 #if (XPAR_XIIC_NUM_INSTANCES > 0)
 #include "xiic.h"
 #endif
+#if (XPAR_XV_FRMBUFWR_NUM_INSTANCES > 0)
+#include "xv_frmbufwr_l2.h"
+#endif
 #include "xdebug.h"
 #include "xcsiss_hw.h"
 
@@ -168,6 +173,9 @@ extern "C" {
 #define XCSISS_HANDLER_VCX		XCSI_HANDLER_VCXFRAMEERROR
 /*@}*/
 
+#define XCSISS_CAPTURE_MAX_VC	XCSI_MAX_VC	/**< Virtual channels of the
+						  *  capture pipeline */
+
 /**
 *
 * Callback type which acts as a wrapper on top of CSI Callback.
@@ -186,6 +194,83 @@ extern "C" {
  *****************************************************************************/
 typedef void (*XCsiSs_Callback)(void *CallbackRef, u32 Mask);
 
+/**
+*
+* Callback type of the capture pipeline, called from the interrupt handler or
+* from XCsiSs_CaptureProcess() when a virtual channel completed a frame.
+*
+* @param	CallbackRef is the reference passed to
+*		XCsiSs_CaptureSetCallback().
+* @param	Vc is the virtual channel of the frame.
+*
+* @return	None.
+*
+* @note		None.
+*
+ *****************************************************************************/
+typedef void (*XCsiSs_CaptureCallback)(void *CallbackRef, u32 Vc);
+
+/**
+*
+* Time base of the capture pipeline, used to measure frame periods.
+*
+* @return	Monotonic time in micro seconds.
+*
+* @note		None.
+*
+ *****************************************************************************/
+typedef u64 (*XCsiSs_CaptureTimeFunc)(void);
+
+/**
+ * Statistics of one virtual channel of the capture pipeline
+ */
+typedef struct {
+	u32 FrameCnt;		/**< Frame end packets received */
+	u32 FrameStartCnt;	/**< Frame start packets received */
+	u32 IncompleteCnt;	/**< Frame start packets not followed by a
+				  *  frame end packet */
+	u32 FrameSyncErrCnt;	/**< Frame sync errors reported by the core */
+	u32 FrameLevelErrCnt;	/**< Frame level errors reported by the core */
+	u32 FramePeriodUs;	/**< Average frame period in micro seconds,
+				  *  0 until two frames were received */
+	u32 MaxFramePeriodUs;	/**< Longest frame period in micro seconds */
+	u32 FrameRate;		/**< Frame rate in milli frames per second,
+				  *  derived from FramePeriodUs */
+	u32 RingDropCnt;	/**< Frames dropped by the frame buffer ring */
+	u32 RingLateCnt;	/**< Late frame buffer ring interrupts */
+} XCsiSs_VcStats;
+
+/**
+ * State of one virtual channel of the capture pipeline
+ */
+typedef struct {
+	XCsiSs_VcStats Stats;	/**< Statistics */
+	u64 LastFrameEndUs;	/**< Time of the last frame end packet */
+	u8 InFrame;		/**< Frame start received, frame end pending */
+#if (XPAR_XV_FRMBUFWR_NUM_INSTANCES > 0)
+	XV_FrmbufWr_l2 *FrmbufPtr;	/**< Frame buffer write instance fed
+					  *  by this channel, NULL if none */
+#endif
+} XCsiSs_CaptureVc;
+
+/**
+ * Capture pipeline state. The application allocates it and hands it to
+ * XCsiSs_CaptureInit().
+ */
+typedef struct {
+	XCsiSs_CaptureVc Vc[XCSISS_CAPTURE_MAX_VC];	/**< Virtual channels */
+	u32 VcMask;		/**< Virtual channels added to the pipeline */
+	XCsiSs_CaptureTimeFunc TimeFunc;	/**< Time base, NULL if frame
+						  *  periods are not measured */
+	XCsiSs_CaptureCallback FrameCallback;	/**< Frame end callback */
+	void *FrameCallbackRef;	/**< Reference passed to FrameCallback */
+	u32 SpktOverflowCnt;	/**< Short packet FIFO full events, frame
+				  *  start and end packets may be lost */
+	u8 IsPolled;		/**< Short packets are read by
+				  *  XCsiSs_CaptureProcess() */
+	u8 IsStarted;		/**< Pipeline is started */
+} XCsiSs_Capture;
+
 /**
  * Sub-Core Configuration Table
  */
@@ -252,6 +337,8 @@ typedef struct {
 							  *  information */
 	XCsi_SPktData SpktData;		/**< Short packet */
 	XCsi_VCInfo VCInfo[XCSI_MAX_VC];/**< Virtual Channel information */
+	XCsiSs_Capture *CapturePtr;	/**< Capture pipeline, NULL if
+					  *  not used */
 } XCsiSs;
 
 /************************** Function Prototypes ******************************/
@@ -284,6 +371,26 @@ void XCsiSs_IntrDisable(XCsiSs *InstancePtr, u32 IntrMask);
 u32 XCsiSs_SetCallBack(XCsiSs *InstancePtr, u32 HandlerType,
 			void *CallbackFunc, void *CallbackRef);
 
+/* Capture pipeline functions in xcsiss_capture.c */
+u32 XCsiSs_CaptureInit(XCsiSs *InstancePtr, XCsiSs_Capture *CapturePtr,
+			XCsiSs_CaptureTimeFunc TimeFunc);
+u32 XCsiSs_CaptureAddVc(XCsiSs *InstancePtr, u32 Vc);
+#if (XPAR_XV_FRMBUFWR_NUM_INSTANCES > 0)
+u32 XCsiSs_CaptureBindRing(XCsiSs *InstancePtr, u32 Vc,
+			XV_FrmbufWr_l2 *FrmbufPtr);
+int XCsiSs_CaptureAcquire(XCsiSs *InstancePtr, u32 Vc,
+			const XVFrmbufWr_RingBuf **BufPtr);
+void XCsiSs_CaptureRelease(XCsiSs *InstancePtr, u32 Vc);
+#endif
+void XCsiSs_CaptureSetCallback(XCsiSs *InstancePtr,
+			XCsiSs_CaptureCallback CallbackFunc, void *CallbackRef);
+u32 XCsiSs_CaptureStart(XCsiSs *InstancePtr, u8 Polled);
+void XCsiSs_CaptureStop(XCsiSs *InstancePtr);
+void XCsiSs_CaptureProcess(XCsiSs *InstancePtr);
+void XCsiSs_CaptureGetStats(XCsiSs *InstancePtr, u32 Vc,
+			XCsiSs_VcStats *StatsPtr);
+void XCsiSs_CaptureResetStats(XCsiSs *InstancePtr);
+
 /************************** Variable Declarations ****************************/
 
 #ifdef __cplusplus
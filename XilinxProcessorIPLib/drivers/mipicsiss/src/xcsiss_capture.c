@@ -0,0 +1,792 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc. All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xcsiss_capture.c
+* @addtogroup csiss_v1_6
+* @{
+*
+* This is the capture pipeline of the Xilinx MIPI CSI Rx Subsystem device
+* driver. It follows the frames of each virtual channel through the frame
+* start and frame end short packets, counts the frame sync and frame level
+* errors reported by the core per virtual channel, measures the frame period
+* and, when a virtual channel feeds a Frame Buffer Write core, starts the
+* buffer ring of that core and reports its drops with the channel.
+*
+* The subsystem outputs all virtual channels on one AXI4-Stream, with the
+* virtual channel in TDEST. A design aggregating several cameras routes the
+* channels to one Frame Buffer Write core each, e.g. with an AXI4-Stream
+* switch decoding TDEST. Each core then rotates its buffers from its own
+* interrupt, see XVFrmbufWr_RingSetup(), so that no buffer handling is done
+* on the CSI interrupts.
+*
+* While the pipeline is started it owns the short packet, protocol level and
+* VCX error callbacks of the subsystem, and the frame received interrupt is
+* disabled as it does not tell the virtual channel. All short packets queued
+* in the FIFO are read on each short packet interrupt. In polled mode the
+* short packet interrupt stays disabled and the application calls
+* XCsiSs_CaptureProcess() often enough for the FIFO not to fill up, which
+* leaves only the error interrupts.
+*
+* The short packet register holds a 2 bit virtual channel, so frames are
+* counted for virtual channels 0 to 3. Errors are counted for all channels.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver Who Date     Changes
+* --- --- -------- ------------------------------------------------------------
+* 1.8 ag  10/15/26 Initial release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <string.h>
+#include "xparameters.h"
+#include "xcsi.h"
+#include "xcsiss.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XCSISS_SPKT_DT_FS	0x00	/**< Frame start short packet */
+#define XCSISS_SPKT_DT_FE	0x01	/**< Frame end short packet */
+
+/**< Virtual channels whose errors are reported in the interrupt status
+ *   register, the others are reported in the VCX frame error register */
+#define XCSISS_ISR_MAX_VC	XCSI_V10_MAX_VC
+
+/**< Interrupts used by the capture pipeline */
+#define XCSISS_CAPTURE_INTR_MASK	(XCSI_INTR_SPKT_MASK | \
+					 XCSI_INTR_PROT_MASK)
+
+/**************************** Type Definitions *******************************/
+
+
+/**************************** Local Global ***********************************/
+
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+
+/************************** Function Prototypes ******************************/
+
+static void CsiSs_CaptureIntrDisable(XCsi *CsiPtr, u32 Mask);
+static void CsiSs_CaptureDrainSpkt(XCsiSs *InstancePtr);
+static void CsiSs_CaptureSpktHandler(void *CallbackRef, u32 Mask);
+static void CsiSs_CaptureProtHandler(void *CallbackRef, u32 Mask);
+static void CsiSs_CaptureVcxHandler(void *CallbackRef, u32 Mask);
+static void CsiSs_CaptureCountErrors(XCsiSs_Capture *CapturePtr,
+				u32 Mask, u32 FirstVc, u32 NumVc);
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function initializes the capture pipeline of the subsystem. No virtual
+* channel is added.
+*
+* @param	InstancePtr is a pointer to the Subsystem instance to be
+*		worked on.
+* @param	CapturePtr is a pointer to the capture pipeline state, which
+*		the application allocates and keeps until the pipeline is no
+*		longer used.
+* @param	TimeFunc returns a monotonic time in micro seconds, used to
+*		measure the frame period. NULL if the frame period is not
+*		measured.
+*
+* @return
+*		- XST_SUCCESS if the pipeline is initialized.
+*		- XST_DEVICE_BUSY if the pipeline is started.
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XCsiSs_CaptureInit(XCsiSs *InstancePtr, XCsiSs_Capture *CapturePtr,
+			XCsiSs_CaptureTimeFunc TimeFunc)
+{
+	u32 Index;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(InstancePtr->CsiPtr != NULL);
+	Xil_AssertNonvoid(CapturePtr != NULL);
+
+	if ((InstancePtr->CapturePtr != NULL) &&
+	    (InstancePtr->CapturePtr->IsStarted)) {
+		return XST_DEVICE_BUSY;
+	}
+
+	for (Index = 0; Index < XCSISS_CAPTURE_MAX_VC; Index++) {
+		memset(&CapturePtr->Vc[Index].Stats, 0,
+			sizeof(XCsiSs_VcStats));
+		CapturePtr->Vc[Index].LastFrameEndUs = 0;
+		CapturePtr->Vc[Index].InFrame = FALSE;
+#if (XPAR_XV_FRMBUFWR_NUM_INSTANCES > 0)
+		CapturePtr->Vc[Index].FrmbufPtr = NULL;
+#endif
+	}
+	CapturePtr->VcMask = 0;
+	CapturePtr->TimeFunc = TimeFunc;
+	CapturePtr->FrameCallback = NULL;
+	CapturePtr->FrameCallbackRef = NULL;
+	CapturePtr->SpktOverflowCnt = 0;
+	CapturePtr->IsPolled = FALSE;
+	CapturePtr->IsStarted = FALSE;
+
+	InstancePtr->CapturePtr = CapturePtr;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function adds a virtual channel to the capture pipeline. Frames and
+* errors of the channel are counted once the pipeline is started.
+*
+* @param	InstancePtr is a pointer to the Subsystem instance to be
+*		worked on.
+* @param	Vc is the virtual channel, 0 to XCSISS_CAPTURE_MAX_VC - 1.
+*
+* @return
+*		- XST_SUCCESS if the channel is added.
+*		- XST_DEVICE_BUSY if the pipeline is started.
+*		- XST_INVALID_PARAM if the channel is not supported by the
+*		core.
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XCsiSs_CaptureAddVc(XCsiSs *InstancePtr, u32 Vc)
+{
+	XCsiSs_Capture *CapturePtr;
+	u32 MaxVc;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->CapturePtr != NULL);
+	Xil_AssertNonvoid(Vc < XCSISS_CAPTURE_MAX_VC);
+
+	CapturePtr = InstancePtr->CapturePtr;
+	if (CapturePtr->IsStarted) {
+		return XST_DEVICE_BUSY;
+	}
+
+	MaxVc = InstancePtr->Config.EnableVCx ? XCSI_V20_MAX_VC :
+						XCSI_V10_MAX_VC;
+	if (Vc >= MaxVc) {
+		xdbg_printf(XDBG_DEBUG_ERROR, "CSISS ERR:: Virtual channel "
+				"%d is not supported by the core\n\r", Vc);
+		return XST_INVALID_PARAM;
+	}
+
+	CapturePtr->VcMask |= (1U << Vc);
+
+	return XST_SUCCESS;
+}
+
+#if (XPAR_XV_FRMBUFWR_NUM_INSTANCES > 0)
+/*****************************************************************************/
+/**
+*
+* This function adds a virtual channel to the capture pipeline and binds it to
+* the Frame Buffer Write core the channel is routed to. The buffer ring of the
+* core must be set up with XVFrmbufWr_RingSetup(), and the core configured for
+* the video stream of the channel, before the pipeline is started.
+*
+* @param	InstancePtr is a pointer to the Subsystem instance to be
+*		worked on.
+* @param	Vc is the virtual channel, 0 to XCSISS_CAPTURE_MAX_VC - 1.
+* @param	FrmbufPtr is a pointer to the Frame Buffer Write instance.
+*
+* @return
+*		- XST_SUCCESS if the channel is bound.
+*		- XST_DEVICE_BUSY if the pipeline is started.
+*		- XST_INVALID_PARAM if the channel is not supported by the
+*		core.
+*
+* @note		The interrupt handler of the Frame Buffer Write core must be
+*		connected by the application.
+*
+******************************************************************************/
+u32 XCsiSs_CaptureBindRing(XCsiSs *InstancePtr, u32 Vc,
+			XV_FrmbufWr_l2 *FrmbufPtr)
+{
+	u32 Status;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(FrmbufPtr != NULL);
+
+	Status = XCsiSs_CaptureAddVc(InstancePtr, Vc);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	InstancePtr->CapturePtr->Vc[Vc].FrmbufPtr = FrmbufPtr;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function takes the oldest completed frame of a virtual channel from the
+* buffer ring of its Frame Buffer Write core.
+*
+* @param	InstancePtr is a pointer to the Subsystem instance to be
+*		worked on.
+* @param	Vc is a virtual channel bound with XCsiSs_CaptureBindRing().
+* @param	BufPtr is updated with the buffers of the frame.
+*
+* @return
+*		- XST_SUCCESS if a frame is returned.
+*		- XST_NO_DATA if no frame is completed.
+*
+* @note		See XVFrmbufWr_RingAcquire().
+*
+******************************************************************************/
+int XCsiSs_CaptureAcquire(XCsiSs *InstancePtr, u32 Vc,
+			const XVFrmbufWr_RingBuf **BufPtr)
+{
+	/* Verify arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->CapturePtr != NULL);
+	Xil_AssertNonvoid(Vc < XCSISS_CAPTURE_MAX_VC);
+	Xil_AssertNonvoid(InstancePtr->CapturePtr->Vc[Vc].FrmbufPtr != NULL);
+
+	return XVFrmbufWr_RingAcquire(InstancePtr->CapturePtr->Vc[Vc].FrmbufPtr,
+					BufPtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the frame taken last with XCsiSs_CaptureAcquire() to
+* the buffer ring of the virtual channel.
+*
+* @param	InstancePtr is a pointer to the Subsystem instance to be
+*		worked on.
+* @param	Vc is a virtual channel bound with XCsiSs_CaptureBindRing().
+*
+* @return	None.
+*
+* @note		See XVFrmbufWr_RingRelease().
+*
+******************************************************************************/
+void XCsiSs_CaptureRelease(XCsiSs *InstancePtr, u32 Vc)
+{
+	/* Verify arguments */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->CapturePtr != NULL);
+	Xil_AssertVoid(Vc < XCSISS_CAPTURE_MAX_VC);
+	Xil_AssertVoid(InstancePtr->CapturePtr->Vc[Vc].FrmbufPtr != NULL);
+
+	XVFrmbufWr_RingRelease(InstancePtr->CapturePtr->Vc[Vc].FrmbufPtr);
+}
+#endif
+
+/*****************************************************************************/
+/**
+*
+* This function sets the callback called when a virtual channel of the
+* pipeline completed a frame.
+*
+* @param	InstancePtr is a pointer to the Subsystem instance to be
+*		worked on.
+* @param	CallbackFunc is the callback, NULL to remove it.
+* @param	CallbackRef is passed to the callback.
+*
+* @return	None.
+*
+* @note		The callback is called from the interrupt handler, or from
+*		XCsiSs_CaptureProcess() in polled mode.
+*
+******************************************************************************/
+void XCsiSs_CaptureSetCallback(XCsiSs *InstancePtr,
+			XCsiSs_CaptureCallback CallbackFunc, void *CallbackRef)
+{
+	/* Verify arguments */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->CapturePtr != NULL);
+
+	InstancePtr->CapturePtr->FrameCallbackRef = CallbackRef;
+	InstancePtr->CapturePtr->FrameCallback = CallbackFunc;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function starts the capture pipeline. The subsystem must be configured
+* with XCsiSs_Configure() and is activated by this function.
+*
+* When all virtual channels are allowed in the IP configuration, the core is
+* set to pass only the channels of the pipeline. The buffer rings of the bound
+* Frame Buffer Write cores are started in auto restart mode.
+*
+* @param	InstancePtr is a pointer to the Subsystem instance to be
+*		worked on.
+* @param	Polled is TRUE to read the short packets with
+*		XCsiSs_CaptureProcess() instead of from the interrupt handler.
+*
+* @return
+*		- XST_SUCCESS if the pipeline is started.
+*		- XST_DEVICE_BUSY if the pipeline is started already.
+*		- XST_FAILURE if no virtual channel is added or the core
+*		could not be activated.
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XCsiSs_CaptureStart(XCsiSs *InstancePtr, u8 Polled)
+{
+	XCsiSs_Capture *CapturePtr;
+	XCsi *CsiPtr;
+	u32 IntrMask;
+	u32 Status;
+#if (XPAR_XV_FRMBUFWR_NUM_INSTANCES > 0)
+	u32 Index;
+#endif
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->CapturePtr != NULL);
+
+	CapturePtr = InstancePtr->CapturePtr;
+	CsiPtr = InstancePtr->CsiPtr;
+
+	if (CapturePtr->IsStarted) {
+		return XST_DEVICE_BUSY;
+	}
+	if (CapturePtr->VcMask == 0) {
+		return XST_FAILURE;
+	}
+
+	/* Dynamic VC selection is only possible with all VCs allowed */
+	if (((!InstancePtr->Config.EnableVCx) &&
+	     (InstancePtr->Config.VcNo == XCSI_V10_MAX_VC)) ||
+	    ((InstancePtr->Config.EnableVCx) &&
+	     (InstancePtr->Config.VcNo == XCSI_V20_MAX_VC))) {
+		XCsi_SetVCSelection(CsiPtr, (u16)CapturePtr->VcMask);
+	}
+
+#if (XPAR_XV_FRMBUFWR_NUM_INSTANCES > 0)
+	for (Index = 0; Index < XCSISS_CAPTURE_MAX_VC; Index++) {
+		if (CapturePtr->Vc[Index].FrmbufPtr != NULL) {
+			XVFrmbufWr_RingStart(CapturePtr->Vc[Index].FrmbufPtr,
+						TRUE);
+		}
+	}
+#endif
+
+	XCsi_SetCallBack(CsiPtr, XCSI_HANDLER_SHORTPACKET,
+			(void *)CsiSs_CaptureSpktHandler, InstancePtr);
+	XCsi_SetCallBack(CsiPtr, XCSI_HANDLER_PROTLVL,
+			(void *)CsiSs_CaptureProtHandler, InstancePtr);
+	XCsi_SetCallBack(CsiPtr, XCSI_HANDLER_VCXERR,
+			(void *)CsiSs_CaptureVcxHandler, InstancePtr);
+
+	/* Drop the short packets of frames received before the start */
+	while (XCsi_IsShortPacketFIFONotEmpty(CsiPtr)) {
+		(void)XCsi_ReadReg(CsiPtr->Config.BaseAddr,
+				   XCSI_SPKTR_OFFSET);
+	}
+
+	CapturePtr->IsPolled = Polled ? TRUE : FALSE;
+	CapturePtr->IsStarted = TRUE;
+
+	IntrMask = XCSISS_CAPTURE_INTR_MASK;
+	if (CapturePtr->IsPolled) {
+		IntrMask &= ~XCSI_ISR_SPFIFONE_MASK;
+	}
+	CsiSs_CaptureIntrDisable(CsiPtr, XCSI_INTR_FRAMERCVD_MASK);
+	XCsi_IntrEnable(CsiPtr, IntrMask);
+
+	Status = XCsiSs_Activate(InstancePtr, XCSI_ENABLE);
+	if (Status != XST_SUCCESS) {
+		XCsiSs_CaptureStop(InstancePtr);
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function stops the capture pipeline. The subsystem is deactivated and
+* the Frame Buffer Write cores bound to the pipeline are stopped.
+*
+* @param	InstancePtr is a pointer to the Subsystem instance to be
+*		worked on.
+*
+* @return	None.
+*
+* @note		The statistics are kept until XCsiSs_CaptureResetStats() or
+*		XCsiSs_CaptureInit() is called.
+*
+******************************************************************************/
+void XCsiSs_CaptureStop(XCsiSs *InstancePtr)
+{
+	XCsiSs_Capture *CapturePtr;
+#if (XPAR_XV_FRMBUFWR_NUM_INSTANCES > 0)
+	u32 Index;
+#endif
+
+	/* Verify arguments */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->CapturePtr != NULL);
+
+	CapturePtr = InstancePtr->CapturePtr;
+	if (!CapturePtr->IsStarted) {
+		return;
+	}
+
+	CsiSs_CaptureIntrDisable(InstancePtr->CsiPtr, XCSISS_CAPTURE_INTR_MASK);
+	(void)XCsiSs_Activate(InstancePtr, XCSI_DISABLE);
+
+#if (XPAR_XV_FRMBUFWR_NUM_INSTANCES > 0)
+	for (Index = 0; Index < XCSISS_CAPTURE_MAX_VC; Index++) {
+		if (CapturePtr->Vc[Index].FrmbufPtr != NULL) {
+			(void)XVFrmbufWr_Stop(CapturePtr->Vc[Index].FrmbufPtr);
+		}
+	}
+#endif
+
+	CapturePtr->IsStarted = FALSE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads the short packets queued by the core in polled mode.
+* Nothing is done in interrupt mode or when the pipeline is stopped.
+*
+* @param	InstancePtr is a pointer to the Subsystem instance to be
+*		worked on.
+*
+* @return	None.
+*
+* @note		The short packet FIFO of the core holds a few packets only, two
+*		per frame and virtual channel without line packets. Frame
+*		start and end packets lost to a full FIFO are counted in
+*		SpktOverflowCnt of the pipeline.
+*
+******************************************************************************/
+void XCsiSs_CaptureProcess(XCsiSs *InstancePtr)
+{
+	XCsiSs_Capture *CapturePtr;
+	XCsi *CsiPtr;
+
+	/* Verify arguments */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->CapturePtr != NULL);
+
+	CapturePtr = InstancePtr->CapturePtr;
+	if ((!CapturePtr->IsStarted) || (!CapturePtr->IsPolled)) {
+		return;
+	}
+
+	CsiPtr = InstancePtr->CsiPtr;
+	if (XCsi_GetIntrStatus(CsiPtr) & XCSI_ISR_SPFIFOF_MASK) {
+		CapturePtr->SpktOverflowCnt++;
+		XCsi_InterruptClear(CsiPtr, XCSI_ISR_SPFIFOF_MASK);
+	}
+
+	CsiSs_CaptureDrainSpkt(InstancePtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the statistics of a virtual channel.
+*
+* @param	InstancePtr is a pointer to the Subsystem instance to be
+*		worked on.
+* @param	Vc is the virtual channel, 0 to XCSISS_CAPTURE_MAX_VC - 1.
+* @param	StatsPtr is updated with the statistics.
+*
+* @return	None.
+*
+* @note		The statistics are updated by the interrupt handler while they
+*		are copied, so they may be one event apart from each other.
+*
+******************************************************************************/
+void XCsiSs_CaptureGetStats(XCsiSs *InstancePtr, u32 Vc,
+			XCsiSs_VcStats *StatsPtr)
+{
+	XCsiSs_CaptureVc *VcPtr;
+
+	/* Verify arguments */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->CapturePtr != NULL);
+	Xil_AssertVoid(Vc < XCSISS_CAPTURE_MAX_VC);
+	Xil_AssertVoid(StatsPtr != NULL);
+
+	VcPtr = &InstancePtr->CapturePtr->Vc[Vc];
+	*StatsPtr = VcPtr->Stats;
+
+	StatsPtr->FrameRate = 0;
+	if (StatsPtr->FramePeriodUs != 0) {
+		StatsPtr->FrameRate = (u32)(1000000000ULL /
+					    StatsPtr->FramePeriodUs);
+	}
+
+#if (XPAR_XV_FRMBUFWR_NUM_INSTANCES > 0)
+	if (VcPtr->FrmbufPtr != NULL) {
+		XVFrmbufWr_RingGetStats(VcPtr->FrmbufPtr,
+					&StatsPtr->RingDropCnt,
+					&StatsPtr->RingLateCnt);
+	}
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This function clears the statistics of all virtual channels.
+*
+* @param	InstancePtr is a pointer to the Subsystem instance to be
+*		worked on.
+*
+* @return	None.
+*
+* @note		The drop counts of the buffer rings are cleared when the
+*		rings are started only.
+*
+******************************************************************************/
+void XCsiSs_CaptureResetStats(XCsiSs *InstancePtr)
+{
+	XCsiSs_Capture *CapturePtr;
+	u32 Index;
+
+	/* Verify arguments */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->CapturePtr != NULL);
+
+	CapturePtr = InstancePtr->CapturePtr;
+	for (Index = 0; Index < XCSISS_CAPTURE_MAX_VC; Index++) {
+		memset(&CapturePtr->Vc[Index].Stats, 0,
+			sizeof(XCsiSs_VcStats));
+		CapturePtr->Vc[Index].LastFrameEndUs = 0;
+	}
+	CapturePtr->SpktOverflowCnt = 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function disables interrupts of the CSI core, leaving the others
+* enabled.
+*
+* @param	CsiPtr is a pointer to the CSI instance.
+* @param	Mask is the mask of the interrupts to disable.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void CsiSs_CaptureIntrDisable(XCsi *CsiPtr, u32 Mask)
+{
+	u32 Enabled;
+
+	Enabled = XCsi_ReadReg(CsiPtr->Config.BaseAddr, XCSI_IER_OFFSET);
+	XCsi_WriteReg(CsiPtr->Config.BaseAddr, XCSI_IER_OFFSET,
+			Enabled & ~Mask & XCSI_IER_ALLINTR_MASK);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads all short packets queued by the core and accounts the
+* frame start and frame end packets to their virtual channel.
+*
+* @param	InstancePtr is a pointer to the Subsystem instance to be
+*		worked on.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void CsiSs_CaptureDrainSpkt(XCsiSs *InstancePtr)
+{
+	XCsiSs_Capture *CapturePtr = InstancePtr->CapturePtr;
+	XCsi *CsiPtr = InstancePtr->CsiPtr;
+	XCsiSs_CaptureVc *VcPtr;
+	u64 Now;
+	u64 Period;
+	u64 Average;
+	u32 Value;
+	u32 Vc;
+	u32 DataType;
+
+	while (XCsi_IsShortPacketFIFONotEmpty(CsiPtr)) {
+		Value = XCsi_ReadReg(CsiPtr->Config.BaseAddr,
+				     XCSI_SPKTR_OFFSET);
+		Vc = (Value & XCSI_SPKTR_VC_MASK) >> XCSI_SPKTR_VC_SHIFT;
+		DataType = (Value & XCSI_SPKTR_DT_MASK) >> XCSI_SPKTR_DT_SHIFT;
+
+		if (!(CapturePtr->VcMask & (1U << Vc))) {
+			continue;
+		}
+		VcPtr = &CapturePtr->Vc[Vc];
+
+		if (DataType == XCSISS_SPKT_DT_FS) {
+			if (VcPtr->InFrame) {
+				VcPtr->Stats.IncompleteCnt++;
+			}
+			VcPtr->Stats.FrameStartCnt++;
+			VcPtr->InFrame = TRUE;
+		} else if (DataType == XCSISS_SPKT_DT_FE) {
+			VcPtr->Stats.FrameCnt++;
+			VcPtr->InFrame = FALSE;
+
+			if (CapturePtr->TimeFunc != NULL) {
+				Now = CapturePtr->TimeFunc();
+				if (VcPtr->LastFrameEndUs != 0) {
+					Period = Now - VcPtr->LastFrameEndUs;
+					if (Period > 0xFFFFFFFFU) {
+						Period = 0xFFFFFFFFU;
+					}
+					/* Average over about 8 frames */
+					Average = VcPtr->Stats.FramePeriodUs;
+					if (Average == 0) {
+						Average = Period;
+					}
+					Average = ((Average * 7) + Period) / 8;
+					VcPtr->Stats.FramePeriodUs = (u32)Average;
+					if (Period >
+					    VcPtr->Stats.MaxFramePeriodUs) {
+						VcPtr->Stats.MaxFramePeriodUs =
+							(u32)Period;
+					}
+				}
+				VcPtr->LastFrameEndUs = Now;
+			}
+
+			if (CapturePtr->FrameCallback != NULL) {
+				CapturePtr->FrameCallback(
+					CapturePtr->FrameCallbackRef, Vc);
+			}
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function accounts frame sync and frame level errors to their virtual
+* channel. Each channel has a frame level error bit followed by a frame sync
+* error bit, starting at bit 0 for FirstVc.
+*
+* @param	CapturePtr is a pointer to the capture pipeline.
+* @param	Mask is the error bit mask.
+* @param	FirstVc is the virtual channel of bits 0 and 1.
+* @param	NumVc is the number of virtual channels in Mask.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void CsiSs_CaptureCountErrors(XCsiSs_Capture *CapturePtr,
+				u32 Mask, u32 FirstVc, u32 NumVc)
+{
+	u32 Index;
+	u32 Vc;
+
+	for (Index = 0; (Index < NumVc) && (Mask != 0); Index++, Mask >>= 2) {
+		Vc = FirstVc + Index;
+		if (!(CapturePtr->VcMask & (1U << Vc))) {
+			continue;
+		}
+		if (Mask & XCSI_ISR_VC0FLVLERR_MASK) {
+			CapturePtr->Vc[Vc].Stats.FrameLevelErrCnt++;
+		}
+		if (Mask & XCSI_ISR_VC0FSYNCERR_MASK) {
+			CapturePtr->Vc[Vc].Stats.FrameSyncErrCnt++;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the short packet callback of the capture pipeline.
+*
+* @param	CallbackRef is a pointer to the Subsystem instance.
+* @param	Mask is the short packet interrupt mask.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void CsiSs_CaptureSpktHandler(void *CallbackRef, u32 Mask)
+{
+	XCsiSs *InstancePtr = (XCsiSs *)CallbackRef;
+
+	if (Mask & XCSI_ISR_SPFIFOF_MASK) {
+		InstancePtr->CapturePtr->SpktOverflowCnt++;
+	}
+
+	CsiSs_CaptureDrainSpkt(InstancePtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the protocol level error callback of the capture pipeline.
+* It counts the errors of virtual channels 0 to 3.
+*
+* @param	CallbackRef is a pointer to the Subsystem instance.
+* @param	Mask is the protocol level interrupt mask.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void CsiSs_CaptureProtHandler(void *CallbackRef, u32 Mask)
+{
+	XCsiSs *InstancePtr = (XCsiSs *)CallbackRef;
+
+	/* VCX frame errors are handled by CsiSs_CaptureVcxHandler() */
+	Mask &= ~XCSI_ISR_VCXFE_MASK;
+
+	CsiSs_CaptureCountErrors(InstancePtr->CapturePtr, Mask, 0,
+				 XCSISS_ISR_MAX_VC);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the VCX frame error callback of the capture pipeline. It
+* counts the errors of virtual channels 4 to 15.
+*
+* @param	CallbackRef is a pointer to the Subsystem instance.
+* @param	Mask is the content of the VCX frame error register.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void CsiSs_CaptureVcxHandler(void *CallbackRef, u32 Mask)
+{
+	XCsiSs *InstancePtr = (XCsiSs *)CallbackRef;
+
+	CsiSs_CaptureCountErrors(InstancePtr->CapturePtr, Mask,
+				 XCSISS_ISR_MAX_VC,
+				 XCSISS_CAPTURE_MAX_VC - XCSISS_ISR_MAX_VC);
+}
+/** @} */
@@ -13,6 +13,8 @@ int XMpegtsmux_CfgInitialize(XMpegtsmux *InstancePtr, XMpegtsmux_Config *ConfigP
     Xil_AssertNonvoid(ConfigPtr != NULL);
 
     InstancePtr->Ctrl_BaseAddress = ConfigPtr->Ctrl_BaseAddress;
+    InstancePtr->JobShadowValid = 0;
+    InstancePtr->JobQueue = NULL;
     InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
 
     return XST_SUCCESS;
@@ -20,11 +22,16 @@ int XMpegtsmux_CfgInitialize(XMpegtsmux *InstancePtr, XMpegtsmux_Config *ConfigP
 #endif
 
 void XMpegtsmux_Start(XMpegtsmux *InstancePtr) {
+    u32 Data;
+
     Xil_AssertVoid(InstancePtr != NULL);
     Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
 
+    /* keep auto_restart if it was enabled before */
+    Data = XMpegtsmux_ReadReg(InstancePtr->Ctrl_BaseAddress, XMPEGTSMUX_CTRL_ADDR_AP_CTRL) &
+	    XMPEGTSMUX_CTRL_AUTO_RESTART_MASK;
     XMpegtsmux_WriteReg(InstancePtr->Ctrl_BaseAddress, XMPEGTSMUX_CTRL_ADDR_AP_CTRL,
-			XMPEGTSMUX_CTRL_EN_MASK);
+			Data | XMPEGTSMUX_CTRL_EN_MASK);
 }
 
 u32 XMpegtsmux_IsDone(XMpegtsmux *InstancePtr) {
@@ -88,6 +95,7 @@ void XMpegtsmux_Set_mux_context(XMpegtsmux *InstancePtr, u64 Data) {
     Xil_AssertVoid(InstancePtr != NULL);
     Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
 
+    InstancePtr->JobShadowValid = 0;
     XMpegtsmux_WriteReg(InstancePtr->Ctrl_BaseAddress, XMPEGTSMUX_CTRL_ADDR_HWSTRUCTIN_MUX_CONTEXT_DATA, (u32)(Data));
     XMpegtsmux_WriteReg(InstancePtr->Ctrl_BaseAddress, XMPEGTSMUX_CTRL_ADDR_HWSTRUCTIN_MUX_CONTEXT_DATA + 4, (u32)(Data >> 32));
 }
@@ -107,6 +115,7 @@ void XMpegtsmux_Set_stream_context(XMpegtsmux *InstancePtr, u64 Data) {
     Xil_AssertVoid(InstancePtr != NULL);
     Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
 
+    InstancePtr->JobShadowValid = 0;
     XMpegtsmux_WriteReg(InstancePtr->Ctrl_BaseAddress, XMPEGTSMUX_CTRL_ADDR_HWSTRUCTIN_STREAM_CONTEXT_DATA, (u32)(Data));
     XMpegtsmux_WriteReg(InstancePtr->Ctrl_BaseAddress, XMPEGTSMUX_CTRL_ADDR_HWSTRUCTIN_STREAM_CONTEXT_DATA + 4, (u32)(Data >> 32));
 }
@@ -126,6 +135,7 @@ void XMpegtsmux_Set_data_in(XMpegtsmux *InstancePtr, u32 Data) {
     Xil_AssertVoid(InstancePtr != NULL);
     Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
 
+    InstancePtr->JobShadowValid = 0;
     XMpegtsmux_WriteReg(InstancePtr->Ctrl_BaseAddress, XMPEGTSMUX_CTRL_ADDR_HWSTRUCTIN_DATA_IN_DATA, Data);
 }
 
@@ -143,6 +153,7 @@ void XMpegtsmux_Set_data_out_byte_inf(XMpegtsmux *InstancePtr, u32 Data) {
     Xil_AssertVoid(InstancePtr != NULL);
     Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
 
+    InstancePtr->JobShadowValid = 0;
     XMpegtsmux_WriteReg(InstancePtr->Ctrl_BaseAddress, XMPEGTSMUX_CTRL_ADDR_HWSTRUCTIN_DATA_OUT_BYTE_INF_DATA, Data);
 }
 
@@ -160,6 +171,7 @@ void XMpegtsmux_Set_num_desc(XMpegtsmux *InstancePtr, u32 Data) {
     Xil_AssertVoid(InstancePtr != NULL);
     Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
 
+    InstancePtr->JobShadowValid = 0;
     XMpegtsmux_WriteReg(InstancePtr->Ctrl_BaseAddress, XMPEGTSMUX_CTRL_ADDR_HWSTRUCTIN_NUM_DESC_DATA, Data);
 }
 
@@ -177,6 +189,7 @@ void XMpegtsmux_Set_stream_id_table(XMpegtsmux *InstancePtr, u64 Data) {
     Xil_AssertVoid(InstancePtr != NULL);
     Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
 
+    InstancePtr->JobShadowValid = 0;
     XMpegtsmux_WriteReg(InstancePtr->Ctrl_BaseAddress, XMPEGTSMUX_CTRL_ADDR_HWSTRUCTIN_STREAM_ID_TABLE_DATA, (u32)(Data));
     XMpegtsmux_WriteReg(InstancePtr->Ctrl_BaseAddress, XMPEGTSMUX_CTRL_ADDR_HWSTRUCTIN_STREAM_ID_TABLE_DATA + 4, (u32)(Data >> 32));
 }
@@ -196,6 +209,7 @@ void XMpegtsmux_Set_num_streams_table(XMpegtsmux *InstancePtr, u64 Data) {
     Xil_AssertVoid(InstancePtr != NULL);
     Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
 
+    InstancePtr->JobShadowValid = 0;
     XMpegtsmux_WriteReg(InstancePtr->Ctrl_BaseAddress, XMPEGTSMUX_CTRL_ADDR_HWSTRUCTIN_NUM_STREAMS_TABLE_DATA, (u32)(Data));
     XMpegtsmux_WriteReg(InstancePtr->Ctrl_BaseAddress, XMPEGTSMUX_CTRL_ADDR_HWSTRUCTIN_NUM_STREAMS_TABLE_DATA + 4, (u32)(Data >> 32));
 }
@@ -211,6 +225,47 @@ u64 XMpegtsmux_Get_num_streams_table(XMpegtsmux *InstancePtr) {
     return Data;
 }
 
+static void XMpegtsmux_WriteJobReg(XMpegtsmux *InstancePtr, u32 Offset, u32 Data,
+	u32 Old) {
+    if (!InstancePtr->JobShadowValid || (Data != Old))
+	XMpegtsmux_WriteReg(InstancePtr->Ctrl_BaseAddress, Offset, Data);
+}
+
+static void XMpegtsmux_WriteJobReg64(XMpegtsmux *InstancePtr, u32 Offset, u64 Data,
+	u64 Old) {
+    XMpegtsmux_WriteJobReg(InstancePtr, Offset, (u32)(Data), (u32)(Old));
+    XMpegtsmux_WriteJobReg(InstancePtr, Offset + 4, (u32)(Data >> 32), (u32)(Old >> 32));
+}
+
+/* Writes the arguments of a job, skipping the registers that already hold
+ * the value written by the previous XMpegtsmux_SetJob call. */
+void XMpegtsmux_SetJob(XMpegtsmux *InstancePtr, const XMpegtsmux_Job *JobPtr) {
+    XMpegtsmux_Job *Old;
+
+    Xil_AssertVoid(InstancePtr != NULL);
+    Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+    Xil_AssertVoid(JobPtr != NULL);
+
+    Old = &InstancePtr->JobShadow;
+    XMpegtsmux_WriteJobReg64(InstancePtr, XMPEGTSMUX_CTRL_ADDR_HWSTRUCTIN_MUX_CONTEXT_DATA,
+	    JobPtr->MuxContext, Old->MuxContext);
+    XMpegtsmux_WriteJobReg64(InstancePtr, XMPEGTSMUX_CTRL_ADDR_HWSTRUCTIN_STREAM_CONTEXT_DATA,
+	    JobPtr->StreamContext, Old->StreamContext);
+    XMpegtsmux_WriteJobReg64(InstancePtr, XMPEGTSMUX_CTRL_ADDR_HWSTRUCTIN_STREAM_ID_TABLE_DATA,
+	    JobPtr->StreamIdTable, Old->StreamIdTable);
+    XMpegtsmux_WriteJobReg64(InstancePtr, XMPEGTSMUX_CTRL_ADDR_HWSTRUCTIN_NUM_STREAMS_TABLE_DATA,
+	    JobPtr->NumStreamsTable, Old->NumStreamsTable);
+    XMpegtsmux_WriteJobReg(InstancePtr, XMPEGTSMUX_CTRL_ADDR_HWSTRUCTIN_DATA_IN_DATA,
+	    JobPtr->DataIn, Old->DataIn);
+    XMpegtsmux_WriteJobReg(InstancePtr, XMPEGTSMUX_CTRL_ADDR_HWSTRUCTIN_DATA_OUT_BYTE_INF_DATA,
+	    JobPtr->DataOutByteInf, Old->DataOutByteInf);
+    XMpegtsmux_WriteJobReg(InstancePtr, XMPEGTSMUX_CTRL_ADDR_HWSTRUCTIN_NUM_DESC_DATA,
+	    JobPtr->NumDesc, Old->NumDesc);
+
+    *Old = *JobPtr;
+    InstancePtr->JobShadowValid = 1;
+}
+
 void XMpegtsmux_InterruptGlobalEnable(XMpegtsmux *InstancePtr) {
     Xil_AssertVoid(InstancePtr != NULL);
     Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
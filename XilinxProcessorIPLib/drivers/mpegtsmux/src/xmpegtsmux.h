@@ -35,6 +35,7 @@ extern "C" {
 typedef uint8_t u8;
 typedef uint16_t u16;
 typedef uint32_t u32;
+typedef uint64_t u64;
 #else
 typedef struct {
     u16 DeviceId;
@@ -42,12 +43,35 @@ typedef struct {
 } XMpegtsmux_Config;
 #endif
 
+/*
+ * Register arguments of one muxing job. The mux and stream contexts and the
+ * stream tables stay in memory, so a job that reuses them only differs in
+ * the registers that change.
+ */
+typedef struct {
+    u64 MuxContext;
+    u64 StreamContext;
+    u64 StreamIdTable;
+    u64 NumStreamsTable;
+    u32 DataIn;
+    u32 DataOutByteInf;
+    u32 NumDesc;
+} XMpegtsmux_Job;
+
 typedef void (*XMpegTsMux_Callback)(void *CallbackRef);
 typedef struct {
     u64 Ctrl_BaseAddress;
     u32 IsReady;
     XMpegTsMux_Callback Callback;
     void *CallbackRef;
+    XMpegtsmux_Job JobShadow;    /* Arguments last written by SetJob */
+    u32 JobShadowValid;          /* JobShadow matches the registers */
+    XMpegtsmux_Job *JobQueue;    /* Ring of queued jobs, NULL if unused */
+    u32 JobQueueSize;
+    volatile u32 JobHead;        /* Next job to program, advanced by ISR */
+    volatile u32 JobTail;        /* Next free entry */
+    volatile u32 JobArmed;       /* Next job is programmed, auto restart on */
+    volatile u32 JobRunning;     /* The core is working through the queue */
 } XMpegtsmux;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -103,6 +127,7 @@ void XMpegtsmux_Set_stream_id_table(XMpegtsmux *InstancePtr, u64 Data);
 u64 XMpegtsmux_Get_stream_id_table(XMpegtsmux *InstancePtr);
 void XMpegtsmux_Set_num_streams_table(XMpegtsmux *InstancePtr, u64 Data);
 u64 XMpegtsmux_Get_num_streams_table(XMpegtsmux *InstancePtr);
+void XMpegtsmux_SetJob(XMpegtsmux *InstancePtr, const XMpegtsmux_Job *JobPtr);
 
 void XMpegtsmux_InterruptGlobalEnable(XMpegtsmux *InstancePtr);
 void XMpegtsmux_InterruptGlobalDisable(XMpegtsmux *InstancePtr);
@@ -114,6 +139,11 @@ u32 XMpegtsmux_InterruptGetStatus(XMpegtsmux *InstancePtr);
 void *XMpegTsMuxIntrHandler(void *InstancePtr);
 void XMpegTsMux_SetCallback(XMpegtsmux *InstancePtr, void *CallbackFunc,
 	void *CallbackRef);
+#ifndef __linux__
+int XMpegtsmux_SetJobQueue(XMpegtsmux *InstancePtr, XMpegtsmux_Job *QueuePtr,
+	u32 Size);
+int XMpegtsmux_QueueJob(XMpegtsmux *InstancePtr, const XMpegtsmux_Job *JobPtr);
+#endif
 
 #ifdef __cplusplus
 }
@@ -89,3 +89,5 @@
 #define XMPEGTSMUX_CTRL_IS_IDLE_MASK	                       0x1
 #define XMPEGTSMUX_CTRL_IS_IDLE_SHIFT   	               2
 #define XMPEGTSMUX_CTRL_AUTO_RESTART_MASK	               0x80
+#define XMPEGTSMUX_ISR_DONE_MASK	                       0x1
+#define XMPEGTSMUX_ISR_READY_MASK	                       0x2
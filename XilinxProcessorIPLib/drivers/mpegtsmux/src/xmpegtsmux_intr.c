@@ -13,6 +13,20 @@
  * The functions in this file provides interrupt handler and associated
  * functions.
  *
+ * The interrupt handler can also feed the core from a queue of jobs set up
+ * with XMpegtsmux_SetJobQueue(). The core runs with auto restart enabled:
+ * when it raises ap_ready for a job, it has latched the arguments of that job
+ * and the handler programs the next queued job, so that the core starts it
+ * right after ap_done without waiting for software. When the queue runs empty
+ * auto restart is disabled, and the next XMpegtsmux_QueueJob() starts the core
+ * again. The callback is invoked for every finished job.
+ *
+ * The contexts, stream tables and data descriptors the jobs point to are read
+ * by the core from memory, so they must be flushed from the data cache before
+ * the job is queued. The core raises ap_ready at the start of a job, so each
+ * job must run longer than the interrupt latency for the next one to be
+ * programmed in time.
+ *
  ******************************************************************************/
 
 /***************************** Include Files *********************************/
@@ -20,7 +34,33 @@
 #include "xmpegtsmux_hw.h"
 #include "xmpegtsmux.h"
 
-#define XMPEG_TS_MUX_ISR_DONE_BIT_MASK 0x1
+#define XMPEG_TS_MUX_ISR_DONE_BIT_MASK XMPEGTSMUX_ISR_DONE_MASK
+#define XMPEG_TS_MUX_ISR_READY_BIT_MASK XMPEGTSMUX_ISR_READY_MASK
+
+/*****************************************************************************/
+/**
+ **
+ ** This function programs the next queued job and starts the core with auto
+ ** restart enabled. It is called with the interrupt of the core disabled.
+ **
+ ** @param    InstancePtr is a pointer to the MPEG TS MUX IP instance.
+ **
+ ** @return   None.
+ **
+ ******************************************************************************/
+static void XMpegtsmux_StartNextJob(XMpegtsmux *InstancePtr)
+{
+	XMpegtsmux_SetJob(InstancePtr,
+		&InstancePtr->JobQueue[InstancePtr->JobHead]);
+	InstancePtr->JobHead = (InstancePtr->JobHead + 1) %
+		InstancePtr->JobQueueSize;
+	InstancePtr->JobArmed = 0;
+	InstancePtr->JobRunning = 1;
+
+	XMpegtsmux_WriteReg(InstancePtr->Ctrl_BaseAddress,
+		XMPEGTSMUX_CTRL_ADDR_AP_CTRL,
+		XMPEGTSMUX_CTRL_AUTO_RESTART_MASK | XMPEGTSMUX_CTRL_EN_MASK);
+}
 
 /*****************************************************************************/
 /**
@@ -50,6 +90,98 @@ void XMpegTsMux_SetCallback(XMpegtsmux *InstancePtr, void *CallbackFunc,
 	InstancePtr->CallbackRef = CallbackRef;
 }
 
+/*****************************************************************************/
+/**
+ **
+ ** This function sets up the queue of jobs fed to the core by the interrupt
+ ** handler, and enables the ap_done and ap_ready interrupts of the core.
+ **
+ ** @param    InstancePtr is a pointer to the MPEG TS MUX IP instance.
+ ** @param    QueuePtr is the storage of the queue, Size entries.
+ ** @param    Size is the number of entries. Up to Size - 1 jobs can be
+ **       queued.
+ **
+ ** @return
+ **       - XST_SUCCESS if the queue is set up.
+ **       - XST_DEVICE_BUSY if the core is running.
+ **
+ ** @note     The interrupt handler must be connected to the interrupt
+ **       system before the first job is queued.
+ **
+ ******************************************************************************/
+int XMpegtsmux_SetJobQueue(XMpegtsmux *InstancePtr, XMpegtsmux_Job *QueuePtr,
+	u32 Size)
+{
+	/* Verify arguments. */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(Size > 1);
+
+	if ((InstancePtr->JobQueue != NULL && InstancePtr->JobRunning) ||
+	    !XMpegtsmux_IsIdle(InstancePtr))
+		return XST_DEVICE_BUSY;
+
+	InstancePtr->JobQueue = QueuePtr;
+	InstancePtr->JobQueueSize = Size;
+	InstancePtr->JobHead = 0;
+	InstancePtr->JobTail = 0;
+	InstancePtr->JobArmed = 0;
+	InstancePtr->JobRunning = 0;
+
+	XMpegtsmux_InterruptClear(InstancePtr,
+		XMPEG_TS_MUX_ISR_DONE_BIT_MASK | XMPEG_TS_MUX_ISR_READY_BIT_MASK);
+	XMpegtsmux_InterruptEnable(InstancePtr,
+		XMPEG_TS_MUX_ISR_DONE_BIT_MASK | XMPEG_TS_MUX_ISR_READY_BIT_MASK);
+	XMpegtsmux_InterruptGlobalEnable(InstancePtr);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ **
+ ** This function adds a job to the queue set up by XMpegtsmux_SetJobQueue().
+ ** The job is copied, so the descriptor can be reused by the caller. If the
+ ** core is not working through the queue, the job is started at once.
+ **
+ ** @param    InstancePtr is a pointer to the MPEG TS MUX IP instance.
+ ** @param    JobPtr is the job to add.
+ **
+ ** @return
+ **       - XST_SUCCESS if the job is queued.
+ **       - XST_FAILURE if the queue is full.
+ **
+ ** @note     The function may be called from the callback.
+ **
+ ******************************************************************************/
+int XMpegtsmux_QueueJob(XMpegtsmux *InstancePtr, const XMpegtsmux_Job *JobPtr)
+{
+	u32 Tail;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(InstancePtr->JobQueue != NULL);
+	Xil_AssertNonvoid(JobPtr != NULL);
+
+	Tail = (InstancePtr->JobTail + 1) % InstancePtr->JobQueueSize;
+	if (Tail == InstancePtr->JobHead)
+		return XST_FAILURE;
+
+	/* Keep the handler away while the queue state is looked at */
+	XMpegtsmux_InterruptGlobalDisable(InstancePtr);
+
+	InstancePtr->JobQueue[InstancePtr->JobTail] = *JobPtr;
+	InstancePtr->JobTail = Tail;
+	if (!InstancePtr->JobRunning)
+		XMpegtsmux_StartNextJob(InstancePtr);
+
+	XMpegtsmux_InterruptGlobalEnable(InstancePtr);
+
+	return XST_SUCCESS;
+}
+
 /*****************************************************************************/
 /**
  **
@@ -58,6 +190,9 @@ void XMpegTsMux_SetCallback(XMpegtsmux *InstancePtr, void *CallbackFunc,
  ** This handler clears the pending interrupt and determines if the source is
  ** frame done signal. If yes, calls the registered callback function.
  **
+ ** When a job queue is set up, the handler also programs the next queued job
+ ** on ap_ready and restarts the core on ap_done if it had run out of jobs.
+ **
  ** The application is responsible for connecting this function to the interrupt
  ** system.
  **
@@ -72,16 +207,52 @@ void XMpegTsMux_SetCallback(XMpegtsmux *InstancePtr, void *CallbackFunc,
 void *XMpegTsMuxIntrHandler(void *InstancePtr)
 {
 	XMpegtsmux *Ptr = (XMpegtsmux *) InstancePtr;
+	u32 Status;
 
 	/* Verify arguments */
 	Xil_AssertVoid(Ptr != NULL);
 	Xil_AssertVoid(Ptr->IsReady == XIL_COMPONENT_IS_READY);
 
-	if (XMpegtsmux_InterruptGetStatus(Ptr)) {
-		XMpegtsmux_InterruptClear(Ptr,
-			XMPEG_TS_MUX_ISR_DONE_BIT_MASK);
+	if (Ptr->JobQueue == NULL) {
+		if (XMpegtsmux_InterruptGetStatus(Ptr)) {
+			XMpegtsmux_InterruptClear(Ptr,
+				XMPEG_TS_MUX_ISR_DONE_BIT_MASK);
+			if (Ptr->Callback)
+				Ptr->Callback(Ptr);
+		}
+		return NULL;
+	}
+
+	Status = XMpegtsmux_InterruptGetStatus(Ptr);
+	XMpegtsmux_InterruptClear(Ptr, Status);
+
+	/* With auto restart, ap_done of a job comes before ap_ready of the next */
+	if (Status & XMPEG_TS_MUX_ISR_DONE_BIT_MASK) {
+		if (Ptr->JobArmed) {
+			/* The core restarted on its own with the armed job */
+			Ptr->JobArmed = 0;
+		} else if (Ptr->JobHead != Ptr->JobTail) {
+			XMpegtsmux_StartNextJob(Ptr);
+		} else {
+			Ptr->JobRunning = 0;
+		}
 		if (Ptr->Callback)
 			Ptr->Callback(Ptr);
 	}
+
+	if (Status & XMPEG_TS_MUX_ISR_READY_BIT_MASK) {
+		/* The running job is latched, program the one after it */
+		if (Ptr->JobHead != Ptr->JobTail) {
+			XMpegtsmux_SetJob(Ptr, &Ptr->JobQueue[Ptr->JobHead]);
+			Ptr->JobHead = (Ptr->JobHead + 1) % Ptr->JobQueueSize;
+			Ptr->JobArmed = 1;
+		} else {
+			XMpegtsmux_WriteReg(Ptr->Ctrl_BaseAddress,
+				XMPEGTSMUX_CTRL_ADDR_AP_CTRL, 0);
+			Ptr->JobArmed = 0;
+		}
+	}
+
+	return NULL;
 }
 /** @} */
@@ -127,6 +127,8 @@ int XMpegtsmux_Initialize(XMpegtsmux *InstancePtr, const char* InstanceName) {
     InstancePtr->Ctrl_BaseAddress = (u32)mmap(NULL, InfoPtr->maps[0].size, PROT_READ|PROT_WRITE, MAP_SHARED, InfoPtr->uio_fd, 0 * getpagesize());
     assert(InstancePtr->Ctrl_BaseAddress);
 
+    InstancePtr->JobShadowValid = 0;
+    InstancePtr->JobQueue = NULL;
     InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
 
     return XST_SUCCESS;
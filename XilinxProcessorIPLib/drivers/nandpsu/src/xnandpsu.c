@@ -90,6 +90,10 @@
 * 1.10  akm    01/05/22    Remove assert checks form static and internal APIs.
 * 1.11  akm    03/31/22    Fix unused parameter warning.
 * 1.11  akm    03/31/22    Fix misleading-indentation warning.
+* 1.11  ag     10/14/26    Read the pages of a block with a cache read
+*			   sequence, added multi-plane page program and the
+*			   streaming read APIs, XNandPsu_Read() reads through
+*			   a stream.
 *
 * </pre>
 *
@@ -172,10 +176,13 @@ static s32 XNandPsu_OnfiReadParamPage(XNandPsu *InstancePtr, u32 Target,
 						u8 *Buf);
 
 static s32 XNandPsu_ProgramPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
-							u32 Col, u8 *Buf);
+						u32 Col, u8 *Buf, u8 Cmd2);
 
 static s32 XNandPsu_ReadPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
-							u32 Col, u8 *Buf);
+						u32 Col, u8 *Buf, u32 ReadOp);
+
+static s32 XNandPsu_ReadCacheStart(XNandPsu *InstancePtr, u32 Target,
+								u32 Page);
 
 static s32 XNandPsu_CheckOnDie(XNandPsu *InstancePtr);
 
@@ -574,6 +581,13 @@ static void XNandPsu_InitFeatures(XNandPsu *InstancePtr, OnfiParamPage *Param)
 								1U : 0U;
 	InstancePtr->Features.ExtPrmPage = ((Param->Features & (1U << 7)) != 0U) ?
 								1U : 0U;
+	InstancePtr->Features.CacheRead = ((Param->OptionalCmds & (1U << 1)) !=
+								0U) ? 1U : 0U;
+	InstancePtr->Features.NumPlanes = (Param->PlaneAddrBits <= 3U) ?
+				((u32)1U << Param->PlaneAddrBits) : 1U;
+	InstancePtr->Features.MultiPlaneProg =
+			(((Param->Features & (1U << 3)) != 0U) &&
+			(InstancePtr->Features.NumPlanes > 1U)) ? 1U : 0U;
 }
 
 /*****************************************************************************/
@@ -1488,7 +1502,7 @@ s32 XNandPsu_Write(XNandPsu *InstancePtr, u64 Offset, u64 Length, u8 *SrcBuf)
 		}
 		/* Program page */
 		Status = XNandPsu_ProgramPage(InstancePtr, Target, Page, 0U,
-								BufPtr);
+						BufPtr, ONFI_CMD_PG_PROG2);
 		if (Status != XST_SUCCESS)
 			goto Out;
 
@@ -1533,81 +1547,50 @@ s32 XNandPsu_Read(XNandPsu *InstancePtr, u64 Offset, u64 Length, u8 *DestBuf)
 				InstancePtr->Geometry.DeviceSize);
 
 	s32 Status = XST_FAILURE;
-	u32 Page;
+	XNandPsu_Stream Stream;
 	u32 Col;
-	u32 Target;
-	u32 Block;
-	u32 PartialBytes = 0U;
-	u32 RemLen;
 	u32 NumBytes;
 	u8 *BufPtr;
 	u8 *DestBufPtr = (u8 *)DestBuf;
-	u64 OffsetVar = Offset;
 	u64 LengthVar = Length;
 
+	/* Calculate Column address value */
+	Col = (u32) (Offset & (InstancePtr->Geometry.BytesPerPage - 1U));
+
 	/*
-	 * Check if read operation exceeds flash size when including
-	 * bad blocks.
+	 * The stream reads whole pages from the start of the first page,
+	 * it skips the bad blocks and fails if the read operation exceeds
+	 * flash size when including bad blocks.
 	 */
-	Status = XNandPsu_CalculateLength(InstancePtr, OffsetVar, LengthVar);
+	Status = XNandPsu_StreamStart(InstancePtr, &Stream, Offset - Col,
+							LengthVar + Col);
 	if (Status != XST_SUCCESS) {
 		goto Out;
 	}
 
 	while (LengthVar > 0U) {
-		Block = (u32)(OffsetVar/InstancePtr->Geometry.BlockSize);
 		/*
-		 * Skip the bad block. Increment the offset by block size.
-		 * The flash programming utility must make sure to start
-		 * writing always at a block boundary and skip blocks if any.
-		 */
-		if (XNandPsu_IsBlockBad(InstancePtr, Block) == XST_SUCCESS) {
-			OffsetVar += (u64)InstancePtr->Geometry.BlockSize;
-			continue;
-		}
-		/* Calculate Page and Column address values */
-		Page = (u32) (OffsetVar/InstancePtr->Geometry.BytesPerPage);
-		Col = (u32) (OffsetVar &
-				(InstancePtr->Geometry.BytesPerPage - 1U));
-		PartialBytes = 0U;
-		/*
-		 * Check if partial write.
+		 * Check if partial read.
 		 * If column address is > 0 or Length is < page size
 		 */
 		if ((Col > 0U) ||
 			(LengthVar < InstancePtr->Geometry.BytesPerPage)) {
-			RemLen = InstancePtr->Geometry.BytesPerPage - Col;
-			PartialBytes = ((u32)RemLen < (u32)LengthVar) ?
-						(u32)RemLen : (u32)LengthVar;
-		}
-
-		Target = (u32) (OffsetVar/InstancePtr->Geometry.TargetSize);
-		if (Page > InstancePtr->Geometry.NumTargetPages) {
-			Page %= InstancePtr->Geometry.NumTargetPages;
-		}
-		/* Check if partial read */
-		if (PartialBytes > 0U) {
 			BufPtr = &InstancePtr->PartialDataBuf[0];
-			NumBytes = PartialBytes;
 		} else {
 			BufPtr = DestBufPtr;
-			NumBytes = (InstancePtr->Geometry.BytesPerPage <
-					(u32)LengthVar) ?
-					InstancePtr->Geometry.BytesPerPage :
-					(u32)LengthVar;
 		}
 		/* Read page */
-		Status = XNandPsu_ReadPage(InstancePtr, Target, Page, 0U,
-								BufPtr);
+		Status = XNandPsu_StreamNext(&Stream, BufPtr, &NumBytes);
 		if (Status != XST_SUCCESS) {
 			goto Out;
 		}
-		if (PartialBytes > 0U) {
+		NumBytes -= Col;
+		if (BufPtr != DestBufPtr) {
 			(void)Xil_MemCpy(DestBufPtr, BufPtr + Col, NumBytes);
 		}
 		DestBufPtr += NumBytes;
-		OffsetVar += NumBytes;
 		LengthVar -= NumBytes;
+		Col = 0U;
 	}
 
 	Status = XST_SUCCESS;
@@ -1722,6 +1705,9 @@ Out:
 * @param	Page is the page address value to program.
 * @param	Col is the column address value to program.
 * @param	Buf is the data buffer to program.
+* @param	Cmd2 is the second cycle of the command, ONFI_CMD_PG_PROG2 or
+*		ONFI_CMD_MUL_PG_PROG2 for the planes before the last one of
+*		a multi-plane program.
 *
 * @return
 *		- XST_SUCCESS if successful.
@@ -1731,7 +1717,7 @@ Out:
 *
 ******************************************************************************/
 static s32 XNandPsu_ProgramPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
-							u32 Col, u8 *Buf)
+						u32 Col, u8 *Buf, u8 Cmd2)
 {
 	u32 PktSize;
 	u32 PktCount;
@@ -1747,7 +1733,7 @@ static s32 XNandPsu_ProgramPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
 	}
 	PktCount = InstancePtr->Geometry.BytesPerPage/PktSize;
 
-	XNandPsu_Prepare_Cmd(InstancePtr, ONFI_CMD_PG_PROG1, ONFI_CMD_PG_PROG2,
+	XNandPsu_Prepare_Cmd(InstancePtr, ONFI_CMD_PG_PROG1, Cmd2,
 					1U, 1U, (u8)AddrCycles);
 
 	if (InstancePtr->DmaMode == XNANDPSU_MDMA) {
@@ -1935,16 +1921,24 @@ Out:
 * @param	Page is the page address value to read.
 * @param	Col is the column address value to read.
 * @param	Buf is the data buffer to fill in.
+* @param	ReadOp is the read operation of the Program Register.
+*		- XNANDPSU_PROG_RD_MASK reads the page.
+*		- XNANDPSU_PROG_RD_CACHE_SEQ_MASK reads the page in the cache
+*		register and loads the next page of an open cache read
+*		sequence.
+*		- XNANDPSU_PROG_RD_CACHE_END_MASK reads the page in the cache
+*		register and ends the cache read sequence.
 *
 * @return
 *		- XST_SUCCESS if successful.
 *		- XST_FAILURE if failed.
 *
-* @note		None
+* @note		Page is the page in the cache register for the cache read
+*		operations, which take no address cycles.
 *
 ******************************************************************************/
 static s32 XNandPsu_ReadPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
-							u32 Col, u8 *Buf)
+						u32 Col, u8 *Buf, u32 ReadOp)
 {
 	u32 PktSize;
 	u32 PktCount;
@@ -1960,8 +1954,16 @@ static s32 XNandPsu_ReadPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
 	}
 	PktCount = InstancePtr->Geometry.BytesPerPage/PktSize;
 
-	XNandPsu_Prepare_Cmd(InstancePtr, ONFI_CMD_RD1, ONFI_CMD_RD2,
+	if (ReadOp == XNANDPSU_PROG_RD_CACHE_SEQ_MASK) {
+		XNandPsu_Prepare_Cmd(InstancePtr, ONFI_CMD_RD_CACHE_SEQ,
+					ONFI_CMD_INVALID, 1U, 1U, 0U);
+	} else if (ReadOp == XNANDPSU_PROG_RD_CACHE_END_MASK) {
+		XNandPsu_Prepare_Cmd(InstancePtr, ONFI_CMD_RD_CACHE_END,
+					ONFI_CMD_INVALID, 1U, 1U, 0U);
+	} else {
+		XNandPsu_Prepare_Cmd(InstancePtr, ONFI_CMD_RD1, ONFI_CMD_RD2,
 					1U, 1U, (u8)AddrCycles);
+	}
 
 	if (InstancePtr->DmaMode == XNANDPSU_MDMA) {
 		RegVal = XNANDPSU_INTR_STS_EN_TRANS_COMP_STS_EN_MASK |
@@ -1998,7 +2000,7 @@ static s32 XNandPsu_ReadPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
 
 	/* Set Read command in Program Register */
 	XNandPsu_WriteReg((InstancePtr)->Config.BaseAddress,
-				XNANDPSU_PROG_OFFSET,XNANDPSU_PROG_RD_MASK);
+				XNANDPSU_PROG_OFFSET, ReadOp);
 
 	Status = XNandPsu_Data_ReadWrite(InstancePtr, Buf, PktCount, PktSize, 0, 1);
 
@@ -2051,6 +2053,343 @@ static s32 XNandPsu_ReadPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+*
+* This function starts an ONFI cache read sequence, the page is loaded in
+* the flash array. The pages are then read with XNandPsu_ReadPage().
+*
+* @param	InstancePtr is a pointer to the XNandPsu instance.
+* @param	Target is the chip select value.
+* @param	Page is the first page of the sequence.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if failed.
+*
+* @note		None
+*
+******************************************************************************/
+static s32 XNandPsu_ReadCacheStart(XNandPsu *InstancePtr, u32 Target,
+								u32 Page)
+{
+	s32 Status = XST_FAILURE;
+	u32 AddrCycles = InstancePtr->Geometry.RowAddrCycles +
+				InstancePtr->Geometry.ColAddrCycles;
+
+	/*
+	 * Enable Transfer Complete Interrupt in Interrupt Status Enable
+	 * Register
+	 */
+	XNandPsu_WriteReg((InstancePtr)->Config.BaseAddress,
+			XNANDPSU_INTR_STS_EN_OFFSET,
+			XNANDPSU_INTR_STS_EN_TRANS_COMP_STS_EN_MASK);
+	/* Program Command */
+	XNandPsu_Prepare_Cmd(InstancePtr, ONFI_CMD_RD1, ONFI_CMD_RD2,
+					0U, 0U, (u8)AddrCycles);
+	/* Program Column, Page, Block address */
+	XNandPsu_SetPageColAddr(InstancePtr, Page, 0U);
+	/* Program Memory Address Register2 for chip select */
+	XNandPsu_SelectChip(InstancePtr, Target);
+	/* Set Read Cache Start in Program Register */
+	XNandPsu_WriteReg((InstancePtr)->Config.BaseAddress,
+			XNANDPSU_PROG_OFFSET, XNANDPSU_PROG_RD_CACHE_START_MASK);
+	/* Poll for Transfer Complete event */
+	Status = XNandPsu_WaitFor_Transfer_Complete(InstancePtr);
+	if (Status != XST_SUCCESS) {
+		goto Out;
+	}
+	/* Wait for the page to be loaded */
+	Status = XNandPsu_Device_Ready(InstancePtr, Target);
+Out:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function programs the same page of the blocks of the planes of a LUN
+* with one ONFI multi-plane page program, the planes are programmed in
+* parallel. The pages are programmed one after another when the flash does
+* not support multi-plane program.
+*
+* @param	InstancePtr is a pointer to the XNandPsu instance.
+* @param	Block is the block of the first plane, a multiple of the
+*		number of planes.
+* @param	Page is the page in the blocks to program.
+* @param	SrcBuf is the data to program, one page per plane.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if one of the blocks is bad or the program
+*		failed.
+*
+* @note		None
+*
+******************************************************************************/
+s32 XNandPsu_ProgramPlanes(XNandPsu *InstancePtr, u32 Block, u32 Page,
+							u8 *SrcBuf)
+{
+	/* Assert the input arguments. */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(SrcBuf != NULL);
+	Xil_AssertNonvoid((Block % InstancePtr->Features.NumPlanes) == 0U);
+	Xil_AssertNonvoid((Block + InstancePtr->Features.NumPlanes) <=
+				InstancePtr->Geometry.NumBlocks);
+	Xil_AssertNonvoid(Page < InstancePtr->Geometry.PagesPerBlock);
+
+	s32 Status = XST_FAILURE;
+	u32 Plane;
+	u32 Target;
+	u32 RowPage;
+	u8 Cmd2;
+
+	for (Plane = 0U; Plane < InstancePtr->Features.NumPlanes; Plane++) {
+		if (XNandPsu_IsBlockBad(InstancePtr, Block + Plane) ==
+							XST_SUCCESS) {
+			goto Out;
+		}
+	}
+
+	Target = Block / InstancePtr->Geometry.NumTargetBlocks;
+	for (Plane = 0U; Plane < InstancePtr->Features.NumPlanes; Plane++) {
+		RowPage = ((Block + Plane) * InstancePtr->Geometry.PagesPerBlock) +
+									Page;
+		if (RowPage > InstancePtr->Geometry.NumTargetPages) {
+			RowPage %= InstancePtr->Geometry.NumTargetPages;
+		}
+		/* The last plane starts the program of all the planes */
+		if ((InstancePtr->Features.MultiPlaneProg != 0U) &&
+			((Plane + 1U) < InstancePtr->Features.NumPlanes)) {
+			Cmd2 = ONFI_CMD_MUL_PG_PROG2;
+		} else {
+			Cmd2 = ONFI_CMD_PG_PROG2;
+		}
+		Status = XNandPsu_ProgramPage(InstancePtr, Target, RowPage, 0U,
+			SrcBuf + (Plane * InstancePtr->Geometry.BytesPerPage),
+			Cmd2);
+		if (Status != XST_SUCCESS) {
+			goto Out;
+		}
+		Status = XNandPsu_Device_Ready(InstancePtr, Target);
+		if (Status != XST_SUCCESS) {
+			goto Out;
+		}
+	}
+
+Out:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function starts a stream reading a range of the flash one page at a
+* time. The bad blocks are skipped as in XNandPsu_Read().
+*
+* @param	InstancePtr is a pointer to the XNandPsu instance.
+* @param	StreamPtr is a pointer to the stream to start.
+* @param	Offset is the starting offset of flash to read, aligned to the
+*		page size.
+* @param	Length is the number of bytes to read.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if the range exceeds flash size when including
+*		bad blocks.
+*
+* @note		A stream that is not read to the end must be stopped with
+*		XNandPsu_StreamStop() before the flash is accessed otherwise.
+*
+******************************************************************************/
+s32 XNandPsu_StreamStart(XNandPsu *InstancePtr, XNandPsu_Stream *StreamPtr,
+						u64 Offset, u64 Length)
+{
+	/* Assert the input arguments. */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(StreamPtr != NULL);
+	Xil_AssertNonvoid(Length != 0U);
+	Xil_AssertNonvoid((Offset + Length) <=
+				InstancePtr->Geometry.DeviceSize);
+	Xil_AssertNonvoid((Offset &
+			(InstancePtr->Geometry.BytesPerPage - 1U)) == 0U);
+
+	s32 Status = XST_FAILURE;
+
+	StreamPtr->InstancePtr = InstancePtr;
+	StreamPtr->Offset = Offset;
+	StreamPtr->Remaining = 0U;
+	StreamPtr->CacheOpen = 0U;
+
+	/*
+	 * Check if read operation exceeds flash size when including
+	 * bad blocks.
+	 */
+	Status = XNandPsu_CalculateLength(InstancePtr, Offset, Length);
+	if (Status != XST_SUCCESS) {
+		goto Out;
+	}
+
+	StreamPtr->Remaining = Length;
+Out:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads the next page of a stream.
+*
+* The pages of a block are read with an ONFI cache read sequence when the
+* flash supports it. The page is transferred from the cache register while
+* the next page is loaded in the flash array, the load time of the next
+* page is hidden by the transfer and the ECC check of the page.
+*
+* @param	StreamPtr is a pointer to the stream.
+* @param	DestBuf is the buffer to fill in, of one page.
+* @param	NumBytes is filled in with the number of bytes of the stream
+*		in the page, less than a page for the last page.
+*
+* @return
+*		- XST_SUCCESS if a page is read.
+*		- XST_NO_DATA if the whole range has been read.
+*		- XST_FAILURE if failed or on an uncorrectable ECC error, the
+*		cache read sequence is then dropped.
+*
+* @note		None
+*
+******************************************************************************/
+s32 XNandPsu_StreamNext(XNandPsu_Stream *StreamPtr, u8 *DestBuf,
+							u32 *NumBytes)
+{
+	/* Assert the input arguments. */
+	Xil_AssertNonvoid(StreamPtr != NULL);
+	Xil_AssertNonvoid(StreamPtr->InstancePtr != NULL);
+	Xil_AssertNonvoid(DestBuf != NULL);
+	Xil_AssertNonvoid(NumBytes != NULL);
+
+	XNandPsu *InstancePtr = StreamPtr->InstancePtr;
+	s32 Status = XST_FAILURE;
+	u32 Page;
+	u32 Target;
+	u32 Block;
+	u32 ReadOp;
+	u32 IsLastPage;
+
+	if (StreamPtr->Remaining == 0U) {
+		Status = XST_NO_DATA;
+		goto Out;
+	}
+
+	/*
+	 * Skip the bad blocks. Increment the offset by block size.
+	 * A cache read sequence never crosses a block.
+	 */
+	while (StreamPtr->CacheOpen == 0U) {
+		if (StreamPtr->Offset >= InstancePtr->Geometry.DeviceSize) {
+			goto Out;
+		}
+		Block = (u32)(StreamPtr->Offset/InstancePtr->Geometry.BlockSize);
+		if (XNandPsu_IsBlockBad(InstancePtr, Block) != XST_SUCCESS) {
+			break;
+		}
+		StreamPtr->Offset += (u64)InstancePtr->Geometry.BlockSize;
+	}
+
+	/* Calculate Page address value */
+	Page = (u32) (StreamPtr->Offset/InstancePtr->Geometry.BytesPerPage);
+	Target = (u32) (StreamPtr->Offset/InstancePtr->Geometry.TargetSize);
+	if (Page > InstancePtr->Geometry.NumTargetPages) {
+		Page %= InstancePtr->Geometry.NumTargetPages;
+	}
+	*NumBytes = (InstancePtr->Geometry.BytesPerPage <
+			StreamPtr->Remaining) ?
+			InstancePtr->Geometry.BytesPerPage :
+			(u32)StreamPtr->Remaining;
+
+	/* Check if no more pages of the block are read after this one */
+	IsLastPage = ((StreamPtr->Remaining <=
+			InstancePtr->Geometry.BytesPerPage) ||
+			(((Page + 1U) % InstancePtr->Geometry.PagesPerBlock) ==
+			0U)) ? 1U : 0U;
+
+	if (StreamPtr->CacheOpen != 0U) {
+		ReadOp = (IsLastPage != 0U) ? XNANDPSU_PROG_RD_CACHE_END_MASK :
+					XNANDPSU_PROG_RD_CACHE_SEQ_MASK;
+	} else if ((InstancePtr->Features.CacheRead != 0U) &&
+			(IsLastPage == 0U)) {
+		Status = XNandPsu_ReadCacheStart(InstancePtr, Target, Page);
+		if (Status != XST_SUCCESS) {
+			goto Out;
+		}
+		StreamPtr->CacheOpen = 1U;
+		ReadOp = XNANDPSU_PROG_RD_CACHE_SEQ_MASK;
+	} else {
+		ReadOp = XNANDPSU_PROG_RD_MASK;
+	}
+	if (ReadOp == XNANDPSU_PROG_RD_CACHE_END_MASK) {
+		StreamPtr->CacheOpen = 0U;
+	}
+
+	/* Read page */
+	Status = XNandPsu_ReadPage(InstancePtr, Target, Page, 0U, DestBuf,
+								ReadOp);
+	if (Status != XST_SUCCESS) {
+		if (StreamPtr->CacheOpen != 0U) {
+			/* Drop the page loading in the flash array */
+			StreamPtr->CacheOpen = 0U;
+			(void)XNandPsu_OnfiReset(InstancePtr, Target);
+		}
+		goto Out;
+	}
+
+	StreamPtr->Offset += (u64)InstancePtr->Geometry.BytesPerPage;
+	StreamPtr->Remaining -= *NumBytes;
+Out:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function stops a stream before its end, the cache read sequence in
+* progress is ended.
+*
+* @param	StreamPtr is a pointer to the stream to stop.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if the cache read sequence could not be ended.
+*
+* @note		None
+*
+******************************************************************************/
+s32 XNandPsu_StreamStop(XNandPsu_Stream *StreamPtr)
+{
+	/* Assert the input arguments. */
+	Xil_AssertNonvoid(StreamPtr != NULL);
+	Xil_AssertNonvoid(StreamPtr->InstancePtr != NULL);
+
+	XNandPsu *InstancePtr = StreamPtr->InstancePtr;
+	s32 Status = XST_SUCCESS;
+	u32 Target;
+
+	if (StreamPtr->CacheOpen != 0U) {
+		StreamPtr->CacheOpen = 0U;
+		Target = (u32) (StreamPtr->Offset /
+				InstancePtr->Geometry.TargetSize);
+		/* The page in the cache register is dropped */
+		Status = XNandPsu_ReadPage(InstancePtr, Target, 0U, 0U,
+				&InstancePtr->PartialDataBuf[0],
+				XNANDPSU_PROG_RD_CACHE_END_MASK);
+	}
+	StreamPtr->Remaining = 0U;
+
+	return Status;
+}
+
 /*****************************************************************************/
 /**
 *
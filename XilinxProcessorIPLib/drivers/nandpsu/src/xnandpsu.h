@@ -154,6 +154,8 @@
 * 1.10  akm    01/05/22    Remove assert checks form static and internal APIs.
 * 1.11  akm    03/31/22    Fix unused parameter warning.
 * 1.11  akm    03/31/22    Fix misleading-indentation warning.
+* 1.11  ag     10/14/26    Added cache read sequences, multi-plane page
+*			   program and the streaming read APIs.
 *
 * </pre>
 *
@@ -339,6 +341,9 @@ typedef struct {
 	u32 EzNand;
 	u32 OnDie;
 	u32 ExtPrmPage;
+	u32 CacheRead;		/**< Read cache commands supported */
+	u32 MultiPlaneProg;	/**< Multi-plane page program supported */
+	u32 NumPlanes;		/**< Number of planes of a LUN */
 } XNandPsu_Features;
 
 /**
@@ -400,6 +405,19 @@ typedef struct {
 	u8 Bbt[XNANDPSU_MAX_BLOCKS >> 2];	/**< Bad block table array */
 } XNandPsu;
 
+/**
+ * The XNandPsu_Stream structure reads a range of the flash one page at a
+ * time, skipping the bad blocks. The pages of a block are read with a cache
+ * read sequence when the flash supports it, so the next page is loaded in
+ * the flash array while the current one is transferred.
+ */
+typedef struct {
+	XNandPsu *InstancePtr;	/**< Controller of the stream */
+	u64 Offset;		/**< Flash offset of the next page (state) */
+	u64 Remaining;		/**< Bytes left to read (state) */
+	u8 CacheOpen;		/**< A cache read sequence is open (state) */
+} XNandPsu_Stream;
+
 /******************* Macro Definitions (Inline Functions) *******************/
 
 /*****************************************************************************/
@@ -571,6 +589,17 @@ void XNandPsu_DisableEccMode(XNandPsu *InstancePtr);
 void XNandPsu_Prepare_Cmd(XNandPsu *InstancePtr, u8 Cmd1, u8 Cmd2, u8 EccState,
 			u8 DmaMode, u8 AddrCycles);
 
+s32 XNandPsu_ProgramPlanes(XNandPsu *InstancePtr, u32 Block, u32 Page,
+							u8 *SrcBuf);
+
+s32 XNandPsu_StreamStart(XNandPsu *InstancePtr, XNandPsu_Stream *StreamPtr,
+						u64 Offset, u64 Length);
+
+s32 XNandPsu_StreamNext(XNandPsu_Stream *StreamPtr, u8 *DestBuf,
+							u32 *NumBytes);
+
+s32 XNandPsu_StreamStop(XNandPsu_Stream *StreamPtr);
+
 /* XNandPsu_LookupConfig in xnandpsu_sinit.c */
 XNandPsu_Config *XNandPsu_LookupConfig(u16 DevID);
 
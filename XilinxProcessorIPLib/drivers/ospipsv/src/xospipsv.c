@@ -39,6 +39,7 @@
 *       sk   05/07/21 Fixed MISRAC violations.
 * 1.5   sk   08/17/21 Added DCache invalidate after non-blocking DMA read.
 * 1.6   sk   02/07/22 Replaced driver version in addtogroup with Overview.
+* 1.7   ag   10/15/26 Added the performance counters.
 *
 * </pre>
 *
@@ -165,6 +166,8 @@ u32 XOspiPsv_CfgInitialize(XOspiPsv *InstancePtr,
 		XOspiPsv_Enable(InstancePtr);
 
 		InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
+		XIL_PERF_STATS_REGISTER(&InstancePtr->Stats, "ospipsv",
+				InstancePtr->Config.BaseAddress);
 
 		Status = (u32)XST_SUCCESS;
 	}
@@ -361,6 +364,8 @@ u32 XOspiPsv_PollTransfer(XOspiPsv *InstancePtr, XOspiPsv_Msg *Msg)
 		goto ERROR_PATH;
 	}
 
+	XIL_PERF_STATS_BUSY_BEGIN(&InstancePtr->Stats);
+
 	XOspiPsv_Setup_Devsize(InstancePtr, Msg);
 	if ((Msg->Flags & XOSPIPSV_MSG_FLAG_RX) != (u32)FALSE) {
 		XOspiPsv_Setup_Dev_Read_Instr_Reg(InstancePtr, Msg);
@@ -401,6 +406,13 @@ u32 XOspiPsv_PollTransfer(XOspiPsv *InstancePtr, XOspiPsv_Msg *Msg)
 	} else {
 		Status = XOspiPsv_CheckOspiIdle(InstancePtr);
 	}
+	XIL_PERF_STATS_BUSY_END(&InstancePtr->Stats);
+
+	if (Status == (u32)XST_SUCCESS) {
+		XIL_PERF_STATS_OPS(&InstancePtr->Stats, 1U, Msg->ByteCount);
+	} else {
+		XIL_PERF_STATS_ERROR(&InstancePtr->Stats);
+	}
 
 	XOspiPsv_DeAssertCS(InstancePtr);
 
@@ -688,6 +700,7 @@ u32 XOspiPsv_IntrHandler(XOspiPsv *InstancePtr)
 	Xil_AssertNonvoid(InstancePtr != NULL);
 
 	Msg = InstancePtr->Msg;
+	XIL_PERF_STATS_INTR(&InstancePtr->Stats);
 
 	if (((Msg->Flags & XOSPIPSV_MSG_FLAG_RX) != 0U) &&
 					(Msg->Addrvalid != 0U)) {
@@ -724,6 +737,8 @@ u32 XOspiPsv_IntrHandler(XOspiPsv *InstancePtr)
 						InstancePtr->UnalignReadBuffer, InstancePtr->RxBytes);
 				}
 				InstancePtr->RxBytes = 0U;
+				XIL_PERF_STATS_OPS(&InstancePtr->Stats, 1U,
+						Msg->ByteCount);
 				InstancePtr->StatusHandler(InstancePtr->StatusRef,
 						XST_SPI_TRANSFER_DONE);
 				XOspiPsv_DeAssertCS(InstancePtr);
@@ -733,6 +748,10 @@ u32 XOspiPsv_IntrHandler(XOspiPsv *InstancePtr)
 	} else {
 		StatusReg = XOspiPsv_ReadReg(InstancePtr->Config.BaseAddress,
 					XOSPIPSV_IRQ_STATUS_REG);
+		if ((StatusReg & (XOSPIPSV_IRQ_STATUS_REG_UNDERFLOW_DET_FLD_MASK |
+				XOSPIPSV_IRQ_STATUS_REG_RECV_OVERFLOW_FLD_MASK)) != 0U) {
+			XIL_PERF_STATS_ERROR(&InstancePtr->Stats);
+		}
 		if ((Msg->Flags & XOSPIPSV_MSG_FLAG_RX) != 0U) {
 			if ((StatusReg & XOSPIPSV_IRQ_MASK_REG_STIG_REQ_MASK_FLD_MASK) != 0U) {
 				/* Read the data from FIFO */
@@ -759,6 +778,7 @@ u32 XOspiPsv_IntrHandler(XOspiPsv *InstancePtr)
 			return (u32)XST_FAILURE;
 		}
 
+		XIL_PERF_STATS_OPS(&InstancePtr->Stats, 1U, Msg->ByteCount);
 		InstancePtr->StatusHandler(InstancePtr->StatusRef, StatusReg);
 		XOspiPsv_DeAssertCS(InstancePtr);
 		InstancePtr->IsBusy = (u32)FALSE;
@@ -81,6 +81,9 @@
 *       sk   02/07/22 Added driver details to Overview section.
 *       sk   02/07/22 Restructured the XOspiPsv_ExecuteRxTuning() API to meet
 *                     safety guidelines for CCM metric.
+* 1.7   ag   10/14/26 Added streaming read APIs with ping-pong DMA buffers.
+* 1.7   ag   10/15/26 Added the Stats performance counters, enabled with
+*                     XIL_PERF_STATS_ENABLE.
 *
 * </pre>
 *
@@ -98,6 +101,7 @@ extern "C" {
 #include "xospipsv_hw.h"
 #include "xil_cache.h"
 #include "xil_mem.h"
+#include "xil_perfstats.h"
 #if defined (__aarch64__)
 #include "xil_smc.h"
 #endif
@@ -183,8 +187,66 @@ typedef struct {
 	/**< Buffer used to read the unaligned bytes in DMA */
 	u8 UnalignReadBuffer[4] __attribute__ ((aligned(64))); /**< Read Buffer */
 #endif
+#ifdef XIL_PERF_STATS_ENABLE
+	Xil_PerfStats Stats;	/**< Performance counters, the errors count
+				  *  FIFO underflows and overflows */
+#endif
 } XOspiPsv;
 
+/**
+ * The bank handler data type allows the user to define a callback function
+ * to select the 16MB bank of a flash read with 3 byte addresses. The flash
+ * is selected and no transfer is in progress when the handler is called, so
+ * the handler can use XOspiPsv_PollTransfer() to write the bank or extended
+ * address register of the flash.
+ *
+ * @param	CallBackRef is the callback reference passed in by the upper
+ *		layer in the stream configuration.
+ * @param	ChipSelect is the selected flash, XOSPIPSV_SELECT_FLASH_CS0 or
+ *		XOSPIPSV_SELECT_FLASH_CS1.
+ * @param	Bank is the bank to select.
+ *
+ * @return	XST_SUCCESS if the bank is selected.
+ */
+typedef u32 (*XOspiPsv_BankHandler) (void *CallBackRef, u8 ChipSelect,
+				      u32 Bank);
+
+/**
+ * This typedef contains the read command and buffers of a stream.
+ */
+typedef struct {
+	u8 *BufPtr[2];		/**< Ping-pong buffers, cache line aligned */
+	u32 BufSize;		/**< Size of each buffer, multiple of 4 */
+	u32 FlashSize;		/**< Size of one flash device */
+	u8 Opcode;		/**< Read opcode */
+	u8 ExtendedOpcode;	/**< Extended opcode in dual-byte opcode mode */
+	u8 Addrsize;		/**< Address bytes of the read opcode, 3 or 4 */
+	u8 Dummy;		/**< Dummy cycles of the read opcode */
+	u8 Proto;		/**< Number of Cmd-Addr-Data lines */
+	u8 IsDDROpCode;		/**< 1 if the opcode is a DDR command */
+	XOspiPsv_BankHandler BankHandler; /**< Bank handler, 3 byte addresses */
+	void *BankRef;		/**< Callback reference for the bank handler */
+} XOspiPsv_StreamConfig;
+
+/**
+ * The XOspiPsv_Stream data reads a range of the flash in chunks of up to
+ * BufSize bytes. The DMA fills one buffer while the application processes
+ * the other one.
+ */
+typedef struct {
+	XOspiPsv_StreamConfig Config;	/**< Stream configuration */
+	XOspiPsv *InstancePtr;		/**< Controller of the stream */
+	XOspiPsv_Msg Msg;	/**< Message of the chunk in flight */
+	u32 Addr;		/**< Address of the next chunk (state) */
+	u32 Remaining;		/**< Bytes left to read (state) */
+	u32 Skip;		/**< Bytes to skip in the next chunk (state) */
+	u32 ChunkOffset[2];	/**< Offset of the data in each buffer (state) */
+	u32 ChunkLen[2];	/**< Bytes of data in each buffer (state) */
+	u32 Bank[2];		/**< Selected bank of each flash (state) */
+	u8 Cur;			/**< Buffer of the chunk in flight (state) */
+	u8 InFlight;		/**< A chunk is in flight (state) */
+} XOspiPsv_Stream;
+
 /************************** Variable Definitions *****************************/
 extern XOspiPsv_Config XOspiPsv_ConfigTable[];
 
@@ -423,6 +485,14 @@ u32 XOspiPsv_StartDmaTransfer(XOspiPsv *InstancePtr, XOspiPsv_Msg *Msg);
 u32 XOspiPsv_CheckDmaDone(XOspiPsv *InstancePtr);
 u32 XOspiPsv_SetDllDelay(XOspiPsv *InstancePtr);
 u32 XOspiPsv_ConfigDualByteOpcode(XOspiPsv *InstancePtr, u8 Enable);
+/* Streaming read functions */
+void XOspiPsv_StreamInit(XOspiPsv *InstancePtr, XOspiPsv_Stream *StreamPtr,
+			 const XOspiPsv_StreamConfig *ConfigPtr);
+u32 XOspiPsv_StreamStart(XOspiPsv_Stream *StreamPtr, u32 Address,
+			 u32 ByteCount);
+u32 XOspiPsv_StreamNext(XOspiPsv_Stream *StreamPtr, u8 **BufPtr,
+			u32 *ByteCount);
+u32 XOspiPsv_StreamStop(XOspiPsv_Stream *StreamPtr);
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,386 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xospipsv_stream.c
+* @addtogroup ospipsv Overview
+* @{
+*
+* This file implements the streaming read APIs of the OSPIPSV driver.
+*
+* A stream reads a range of the flash in chunks of up to one buffer, with one
+* indirect read per chunk, through the non-blocking DMA transfer. Each call
+* to XOspiPsv_StreamNext() waits for the chunk in flight, starts the next
+* chunk into the other buffer and returns the finished one, so the
+* application processes a chunk while the next one is read. Chunks never
+* cross the end of a flash device in stacked mode, nor a 16MB bank with 3 byte
+* addresses, the bank handler of the stream selects the bank before the first
+* chunk of a bank. The controller must be in INDAC mode.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who Date     Changes
+* ----- --- -------- -----------------------------------------------
+* 1.7   ag   10/14/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <string.h>
+#include "xospipsv.h"
+#include "sleep.h"
+
+/************************** Constant Definitions *****************************/
+#define XOSPIPSV_STREAM_BANK_SIZE	0x1000000U	/**< 16MB bank */
+#define XOSPIPSV_STREAM_MAX_DELAY	10000000U	/**< Chunk timeout, usec */
+
+/************************** Function Prototypes ******************************/
+static u32 XOspiPsv_StreamIssue(XOspiPsv_Stream *StreamPtr);
+static u32 XOspiPsv_StreamWait(XOspiPsv_Stream *StreamPtr);
+
+/*****************************************************************************/
+/**
+* @brief
+* This function initializes a stream of an OSPIPSV instance.
+*
+* @param	InstancePtr is a pointer to the XOspiPsv instance.
+* @param	StreamPtr is a pointer to the stream.
+* @param	ConfigPtr is the read command and buffers of the stream, it is
+*		copied into the stream.
+*
+* @return	None.
+*
+* @note		The stream assumes bank 0 of the flash is selected when no bank
+*		handler is set.
+*
+******************************************************************************/
+void XOspiPsv_StreamInit(XOspiPsv *InstancePtr, XOspiPsv_Stream *StreamPtr,
+			 const XOspiPsv_StreamConfig *ConfigPtr)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid(StreamPtr != NULL);
+	Xil_AssertVoid(ConfigPtr != NULL);
+	Xil_AssertVoid((ConfigPtr->BufPtr[0] != NULL) &&
+		       (ConfigPtr->BufPtr[1] != NULL));
+	Xil_AssertVoid((ConfigPtr->BufSize != 0U) &&
+		       ((ConfigPtr->BufSize % 4U) == 0U));
+	Xil_AssertVoid((ConfigPtr->FlashSize != 0U) &&
+		       ((ConfigPtr->FlashSize % 4U) == 0U));
+	Xil_AssertVoid((ConfigPtr->Addrsize == 3U) ||
+		       (ConfigPtr->Addrsize == 4U));
+
+	(void)memset(StreamPtr, 0, sizeof(XOspiPsv_Stream));
+	StreamPtr->Config = *ConfigPtr;
+	StreamPtr->InstancePtr = InstancePtr;
+
+	if (ConfigPtr->BankHandler != NULL) {
+		StreamPtr->Bank[0] = 0xFFFFFFFFU;
+		StreamPtr->Bank[1] = 0xFFFFFFFFU;
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function starts a stream and the read of its first chunk.
+*
+* @param	StreamPtr is a pointer to the stream.
+* @param	Address is the flash address to read from. In stacked mode it
+*		spans both flash devices.
+* @param	ByteCount is the number of bytes to read.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_INVALID_PARAM if the range is outside of the flash.
+*		- XST_DEVICE_BUSY if a transfer is already in progress.
+*		- XST_FAILURE if the first chunk could not be started.
+*
+* @note		The range of a previous stream that is not read yet is dropped.
+*
+******************************************************************************/
+u32 XOspiPsv_StreamStart(XOspiPsv_Stream *StreamPtr, u32 Address,
+			 u32 ByteCount)
+{
+	u32 TotalSize;
+	u32 Status;
+
+	Xil_AssertNonvoid(StreamPtr != NULL);
+	Xil_AssertNonvoid(StreamPtr->InstancePtr != NULL);
+	Xil_AssertNonvoid(ByteCount > 0U);
+
+	TotalSize = StreamPtr->Config.FlashSize;
+	if (StreamPtr->InstancePtr->Config.ConnectionMode ==
+	    XOSPIPSV_CONNECTION_MODE_STACKED) {
+		TotalSize <<= 1U;
+	}
+	if ((Address >= TotalSize) || (ByteCount > (TotalSize - Address))) {
+		Status = (u32)XST_INVALID_PARAM;
+		goto ERROR_PATH;
+	}
+
+	Status = XOspiPsv_StreamStop(StreamPtr);
+	if (Status != (u32)XST_SUCCESS) {
+		goto ERROR_PATH;
+	}
+
+	/* The DMA is word aligned, skip the leading bytes of the first word */
+	StreamPtr->Skip = Address % 4U;
+	StreamPtr->Addr = Address - StreamPtr->Skip;
+	StreamPtr->Remaining = ByteCount + StreamPtr->Skip;
+	StreamPtr->Cur = 0U;
+
+	Status = XOspiPsv_StreamIssue(StreamPtr);
+
+ERROR_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function waits for the chunk in flight, starts the read of the next
+* chunk into the other buffer and returns the finished chunk.
+*
+* @param	StreamPtr is a pointer to the stream.
+* @param	BufPtr is filled with the data of the chunk.
+* @param	ByteCount is filled with the number of bytes of the chunk.
+*
+* @return
+*		- XST_SUCCESS if a chunk is returned.
+*		- XST_NO_DATA if the whole range has been returned.
+*		- XST_FAILURE if the chunk failed or timed out, or the next
+*		  chunk could not be started.
+*
+* @note		The chunk stays valid until the next call, the buffer it is in
+*		is then used to read the chunk after the next one.
+*
+******************************************************************************/
+u32 XOspiPsv_StreamNext(XOspiPsv_Stream *StreamPtr, u8 **BufPtr,
+			u32 *ByteCount)
+{
+	u8 Done;
+	u32 Status;
+
+	Xil_AssertNonvoid(StreamPtr != NULL);
+	Xil_AssertNonvoid(BufPtr != NULL);
+	Xil_AssertNonvoid(ByteCount != NULL);
+
+	if (StreamPtr->InFlight == 0U) {
+		Status = (u32)XST_NO_DATA;
+		goto ERROR_PATH;
+	}
+
+	Status = XOspiPsv_StreamWait(StreamPtr);
+	if (Status != (u32)XST_SUCCESS) {
+		goto ERROR_PATH;
+	}
+
+	Done = StreamPtr->Cur;
+	if (StreamPtr->Remaining != 0U) {
+		StreamPtr->Cur ^= 1U;
+		Status = XOspiPsv_StreamIssue(StreamPtr);
+		if (Status != (u32)XST_SUCCESS) {
+			StreamPtr->Remaining = 0U;
+			goto ERROR_PATH;
+		}
+	}
+
+	*BufPtr = StreamPtr->Config.BufPtr[Done] + StreamPtr->ChunkOffset[Done];
+	*ByteCount = StreamPtr->ChunkLen[Done];
+
+ERROR_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function stops a stream, it waits for the chunk in flight and drops
+* the rest of the range.
+*
+* @param	StreamPtr is a pointer to the stream.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if the chunk in flight failed or timed out.
+*
+******************************************************************************/
+u32 XOspiPsv_StreamStop(XOspiPsv_Stream *StreamPtr)
+{
+	u32 Status = (u32)XST_SUCCESS;
+
+	Xil_AssertNonvoid(StreamPtr != NULL);
+
+	if (StreamPtr->InFlight != 0U) {
+		Status = XOspiPsv_StreamWait(StreamPtr);
+	}
+	StreamPtr->Remaining = 0U;
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function starts the read of the next chunk of a stream into the buffer
+* StreamPtr->Cur. The chunk is clipped to the end of the flash device and,
+* with 3 byte addresses, to the end of the bank.
+*
+* @param	StreamPtr is a pointer to the stream.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_DEVICE_BUSY if a transfer is already in progress.
+*		- XST_FAILURE if the bank could not be selected or the chunk
+*		  could not be started.
+*
+******************************************************************************/
+static u32 XOspiPsv_StreamIssue(XOspiPsv_Stream *StreamPtr)
+{
+	XOspiPsv *InstancePtr = StreamPtr->InstancePtr;
+	const XOspiPsv_StreamConfig *ConfigPtr = &StreamPtr->Config;
+	XOspiPsv_Msg *Msg = &StreamPtr->Msg;
+	u32 FlashAddr;
+	u32 Limit;
+	u32 Len;
+	u32 Bank;
+	u8 ChipSelect;
+	u32 Status;
+
+	if (InstancePtr->IsBusy == (u32)TRUE) {
+		Status = (u32)XST_DEVICE_BUSY;
+		goto ERROR_PATH;
+	}
+
+	/* Translate the address based on the connection mode */
+	if ((InstancePtr->Config.ConnectionMode ==
+	     XOSPIPSV_CONNECTION_MODE_STACKED) &&
+	    (StreamPtr->Addr >= ConfigPtr->FlashSize)) {
+		ChipSelect = (u8)XOSPIPSV_SELECT_FLASH_CS1;
+		FlashAddr = StreamPtr->Addr - ConfigPtr->FlashSize;
+	} else {
+		ChipSelect = (u8)XOSPIPSV_SELECT_FLASH_CS0;
+		FlashAddr = StreamPtr->Addr;
+	}
+
+	Limit = ConfigPtr->FlashSize - FlashAddr;
+	if ((ConfigPtr->Addrsize == 3U) && ((XOSPIPSV_STREAM_BANK_SIZE -
+	     (FlashAddr % XOSPIPSV_STREAM_BANK_SIZE)) < Limit)) {
+		Limit = XOSPIPSV_STREAM_BANK_SIZE -
+			(FlashAddr % XOSPIPSV_STREAM_BANK_SIZE);
+	}
+
+	Len = StreamPtr->Remaining;
+	if (Len > ConfigPtr->BufSize) {
+		Len = ConfigPtr->BufSize;
+	}
+	if (Len > Limit) {
+		Len = Limit;
+	}
+
+	(void)XOspiPsv_SelectFlash(InstancePtr, ChipSelect);
+
+	if (ConfigPtr->Addrsize == 3U) {
+		Bank = FlashAddr / XOSPIPSV_STREAM_BANK_SIZE;
+		if (Bank != StreamPtr->Bank[ChipSelect]) {
+			if (ConfigPtr->BankHandler == NULL) {
+				Status = (u32)XST_FAILURE;
+				goto ERROR_PATH;
+			}
+			Status = ConfigPtr->BankHandler(ConfigPtr->BankRef,
+							ChipSelect, Bank);
+			if (Status != (u32)XST_SUCCESS) {
+				StreamPtr->Bank[ChipSelect] = 0xFFFFFFFFU;
+				Status = (u32)XST_FAILURE;
+				goto ERROR_PATH;
+			}
+			StreamPtr->Bank[ChipSelect] = Bank;
+		}
+	}
+
+	/* The DMA reads whole words */
+	Msg->TxBfrPtr = NULL;
+	Msg->RxBfrPtr = ConfigPtr->BufPtr[StreamPtr->Cur];
+	Msg->ByteCount = (Len + 3U) & ~3U;
+	Msg->Flags = XOSPIPSV_MSG_FLAG_RX;
+	Msg->Opcode = ConfigPtr->Opcode;
+	Msg->ExtendedOpcode = ConfigPtr->ExtendedOpcode;
+	Msg->Addr = FlashAddr;
+	Msg->Addrsize = ConfigPtr->Addrsize;
+	Msg->Addrvalid = 1U;
+	Msg->Dummy = ConfigPtr->Dummy;
+	Msg->Proto = ConfigPtr->Proto;
+	Msg->IsDDROpCode = ConfigPtr->IsDDROpCode;
+	Msg->RxAddr64bit = 0U;
+	Msg->Xfer64bit = 0U;
+
+	Status = XOspiPsv_StartDmaTransfer(InstancePtr, Msg);
+	if (Status != (u32)XST_SUCCESS) {
+		goto ERROR_PATH;
+	}
+
+	StreamPtr->ChunkOffset[StreamPtr->Cur] = StreamPtr->Skip;
+	StreamPtr->ChunkLen[StreamPtr->Cur] = Len - StreamPtr->Skip;
+	StreamPtr->Skip = 0U;
+	StreamPtr->Addr += Len;
+	StreamPtr->Remaining -= Len;
+	StreamPtr->InFlight = 1U;
+
+ERROR_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function waits for the chunk in flight of a stream. The busy state of
+* the controller is cleared if the chunk times out, the upper layer is then
+* responsible for resetting the controller.
+*
+* @param	StreamPtr is a pointer to the stream.
+*
+* @return
+*		- XST_SUCCESS if the chunk is done.
+*		- XST_FAILURE if the chunk failed or timed out.
+*
+******************************************************************************/
+static u32 XOspiPsv_StreamWait(XOspiPsv_Stream *StreamPtr)
+{
+	XOspiPsv *InstancePtr = StreamPtr->InstancePtr;
+	u32 DelayCount = 0U;
+	u32 Status;
+
+	StreamPtr->InFlight = 0U;
+
+	Status = XOspiPsv_CheckDmaDone(InstancePtr);
+	while (Status != (u32)XST_SUCCESS) {
+		/* The chunk is done but the controller did not go idle */
+		if (InstancePtr->IsBusy == (u32)FALSE) {
+			break;
+		}
+		if (DelayCount == XOSPIPSV_STREAM_MAX_DELAY) {
+			InstancePtr->IsBusy = (u32)FALSE;
+			break;
+		}
+		usleep(1);
+		DelayCount++;
+		Status = XOspiPsv_CheckDmaDone(InstancePtr);
+	}
+
+	if (Status != (u32)XST_SUCCESS) {
+		StreamPtr->Remaining = 0U;
+		Status = (u32)XST_FAILURE;
+	}
+
+	return Status;
+}
+/** @} */
@@ -74,6 +74,8 @@
  * 1.14 akm 06/24/21 Allow enough time for the controller to reset the FIFOs.
  * 1.14 akm 08/12/21 Perform Dcache invalidate at the end of the DMA transfer.
  * 1.15 akm 10/21/21 Fix MISRA-C violations.
+ * 1.16 ag  10/15/26 Count transfers, interrupts, DMA errors and TX FIFO
+ *		     underruns in the performance counters.
  *
  * </pre>
  *
@@ -180,6 +182,8 @@ s32 XQspiPsu_CfgInitialize(XQspiPsu *InstancePtr,
 		XQspiPsu_Enable(InstancePtr);
 
 		InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
+		XIL_PERF_STATS_REGISTER(&InstancePtr->Stats, "qspipsu",
+					InstancePtr->Config.BaseAddress);
 
 		Status = (s32)XST_SUCCESS;
 	}
@@ -434,6 +438,9 @@ s32 XQspiPsu_PolledTransfer(XQspiPsu *InstancePtr, XQspiPsu_Msg *Msg,
 	u32 IOPending = (u32)FALSE;
 	u32 DmaIntrSts;
 	s32 Status;
+#ifdef XIL_PERF_STATS_ENABLE
+	u64 Bytes = 0U;
+#endif
 
 	Xil_AssertNonvoid(InstancePtr != NULL);
 	Xil_AssertNonvoid(Msg != NULL);
@@ -442,6 +449,9 @@ s32 XQspiPsu_PolledTransfer(XQspiPsu *InstancePtr, XQspiPsu_Msg *Msg,
 
 	for (Index = 0; Index < (s32)NumMsg; Index++) {
 		Xil_AssertNonvoid(Msg[Index].ByteCount > 0U);
+#ifdef XIL_PERF_STATS_ENABLE
+		Bytes += Msg[Index].ByteCount;
+#endif
 	}
 	/*
 	 * Check whether there is another transfer in progress.
@@ -468,6 +478,7 @@ s32 XQspiPsu_PolledTransfer(XQspiPsu *InstancePtr, XQspiPsu_Msg *Msg,
 #if defined  (XCLOCKING)
 	Xil_ClockEnable(InstancePtr->Config.RefClk);
 #endif
+	XIL_PERF_STATS_BUSY_BEGIN(&InstancePtr->Stats);
 	/* Select slave */
 	XQspiPsu_GenFifoEntryCSAssert(InstancePtr);
 
@@ -540,6 +551,8 @@ s32 XQspiPsu_PolledTransfer(XQspiPsu *InstancePtr, XQspiPsu_Msg *Msg,
 	do {
 		QspiPsuStatusReg = XQspiPsu_ReadReg(InstancePtr->Config.BaseAddress, XQSPIPSU_ISR_OFFSET);
 	} while ((QspiPsuStatusReg & XQSPIPSU_ISR_GENFIFOEMPTY_MASK) == (u32)FALSE);
+	XIL_PERF_STATS_BUSY_END(&InstancePtr->Stats);
+	XIL_PERF_STATS_OPS(&InstancePtr->Stats, NumMsg, Bytes);
 
 	/* Clear the busy flag. */
 	InstancePtr->IsBusy = (u32)FALSE;
@@ -665,6 +678,10 @@ s32 XQspiPsu_InterruptHandler(XQspiPsu *InstancePtr)
 	s32 MsgCnt;
 	u8 DeltaMsgCnt = 0;
 	u32 TxRxFlag;
+#ifdef XIL_PERF_STATS_ENABLE
+	s32 Index;
+	u64 Bytes = 0U;
+#endif
 
 	Xil_AssertNonvoid(InstancePtr != NULL);
 	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
@@ -678,6 +695,7 @@ s32 XQspiPsu_InterruptHandler(XQspiPsu *InstancePtr)
 
 	/* QSPIPSU Intr cleared on read */
 	QspiPsuStatusReg = XQspiPsu_ReadReg(InstancePtr->Config.BaseAddress, XQSPIPSU_ISR_OFFSET);
+	XIL_PERF_STATS_INTR(&InstancePtr->Stats);
 	if (InstancePtr->ReadMode == XQSPIPSU_READMODE_DMA) {
 		/* DMA Intr write to clear */
 		DmaIntrStatusReg = XQspiPsu_ReadReg(InstancePtr->Config.BaseAddress,
@@ -686,10 +704,19 @@ s32 XQspiPsu_InterruptHandler(XQspiPsu *InstancePtr)
 					DmaIntrStatusReg);
 	}
 	if (((DmaIntrStatusReg & XQSPIPSU_QSPIDMA_DST_INTR_ERR_MASK) != (u32)FALSE)) {
+		XIL_PERF_STATS_ERROR(&InstancePtr->Stats);
 		/* Call status handler to indicate error */
 		InstancePtr->StatusHandler(InstancePtr->StatusRef,
 				XST_SPI_COMMAND_ERROR, 0);
 	}
+#ifdef XIL_PERF_STATS_ENABLE
+	/* The TX FIFO ran empty before the handler refilled it */
+	if ((MsgCnt < NumMsg) && ((TxRxFlag & XQSPIPSU_MSG_FLAG_TX) != (u32)FALSE) &&
+		((QspiPsuStatusReg & XQSPIPSU_ISR_TXEMPTY_MASK) != (u32)FALSE) &&
+		(InstancePtr->TxBytes > 0)) {
+		XIL_PERF_STATS_ERROR(&InstancePtr->Stats);
+	}
+#endif
 	/* Fill more data to be txed if required */
 	if ((MsgCnt < NumMsg) && ((TxRxFlag & XQSPIPSU_MSG_FLAG_TX) != (u32)FALSE) &&
 		((QspiPsuStatusReg & XQSPIPSU_ISR_TXNOT_FULL_MASK) != (u32)FALSE) &&
@@ -796,6 +823,12 @@ s32 XQspiPsu_InterruptHandler(XQspiPsu *InstancePtr)
 			}
 			/* Clear the busy flag. */
 			InstancePtr->IsBusy = (u32)FALSE;
+#ifdef XIL_PERF_STATS_ENABLE
+			for (Index = 0; Index < NumMsg; Index++) {
+				Bytes += Msg[Index].ByteCount;
+			}
+			XIL_PERF_STATS_OPS(&InstancePtr->Stats, NumMsg, Bytes);
+#endif
 #if defined  (XCLOCKING)
 			Xil_ClockDisable(InstancePtr->Config.RefClk);
 #endif
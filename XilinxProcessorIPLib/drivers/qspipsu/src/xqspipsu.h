@@ -167,6 +167,9 @@
  * 1.13 sne 04/23/21 Fixed doxygen warnings.
  * 1.14 akm 06/24/21 Allow enough time for the controller to reset the FIFOs.
  * 1.14 akm 08/12/21 Perform Dcache invalidate at the end of the DMA transfer.
+ * 1.16 ag  10/14/26 Added streaming read APIs with ping-pong DMA buffers.
+ * 1.16 ag  10/15/26 Added the Stats performance counters, enabled with
+ *		     XIL_PERF_STATS_ENABLE.
  *
  * </pre>
  *
@@ -185,6 +188,7 @@ extern "C" {
 #include "xqspipsu_hw.h"
 #include "xil_cache.h"
 #include "xil_mem.h"
+#include "xil_perfstats.h"
 #if defined  (XCLOCKING)
 #include "xil_clocking.h"
 #endif
@@ -270,8 +274,65 @@ typedef struct {
 	XQspiPsu_Msg *Msg;	/**< Message */
 	XQspiPsu_StatusHandler StatusHandler;	/**< Status Handler */
 	void *StatusRef;	/**< Callback reference for status handler */
+#ifdef XIL_PERF_STATS_ENABLE
+	Xil_PerfStats Stats;	/**< Performance counters, the errors count
+				  *  DMA errors and TX FIFO underruns */
+#endif
 } XQspiPsu;
 
+/**
+ * The bank handler data type allows the user to define a callback function
+ * to select the 16MB bank of a flash read with 3 byte addresses. The flash
+ * is selected and no transfer is in progress when the handler is called, so
+ * the handler can use XQspiPsu_PolledTransfer() to write the bank or
+ * extended address register of the flash.
+ *
+ * @param	CallBackRef is the callback reference passed in by the upper
+ *		layer in the stream configuration.
+ * @param	FlashCS is the selected flash, one of the
+ *		XQSPIPSU_SELECT_FLASH_CS_* values.
+ * @param	Bank is the bank to select.
+ *
+ * @return	XST_SUCCESS if the bank is selected.
+ */
+typedef s32 (*XQspiPsu_BankHandler) (void *CallBackRef, u8 FlashCS, u32 Bank);
+
+/**
+ * This typedef contains the read command and buffers of a stream.
+ */
+typedef struct {
+	u8 *BufPtr[2];		/**< Ping-pong buffers, cache line aligned */
+	u32 BufSize;		/**< Size of each buffer, multiple of 4, min 8 */
+	u32 FlashSize;		/**< Size of one flash device */
+	u8 ReadCmd;		/**< Read command */
+	u8 AddrSize;		/**< Address bytes of the read command, 3 or 4 */
+	u8 AddrBusWidth;	/**< Bus width of the address */
+	u8 DataBusWidth;	/**< Bus width of the dummy cycles and data */
+	u8 DummyCycles;		/**< Dummy cycles of the read command */
+	XQspiPsu_BankHandler BankHandler; /**< Bank handler, 3 byte addresses */
+	void *BankRef;		/**< Callback reference for the bank handler */
+} XQspiPsu_StreamConfig;
+
+/**
+ * The XQspiPsu_Stream data reads a range of the flash in chunks of up to
+ * BufSize bytes. The DMA fills one buffer while the application processes
+ * the other one.
+ */
+typedef struct {
+	XQspiPsu_StreamConfig Config;	/**< Stream configuration */
+	XQspiPsu *InstancePtr;		/**< Controller of the stream */
+	XQspiPsu_Msg Msg[4];		/**< Messages of the chunk in flight */
+	u8 CmdBfr[5];		/**< Command and address (state) */
+	u32 Addr;		/**< Address of the next chunk (state) */
+	u32 Remaining;		/**< Bytes left to read (state) */
+	u32 Skip;		/**< Bytes to skip in the next chunk (state) */
+	u32 ChunkOffset[2];	/**< Offset of the data in each buffer (state) */
+	u32 ChunkLen[2];	/**< Bytes of data in each buffer (state) */
+	u32 Bank[2];		/**< Selected bank of each flash (state) */
+	u8 Cur;			/**< Buffer of the chunk in flight (state) */
+	u8 InFlight;		/**< A chunk is in flight (state) */
+} XQspiPsu_Stream;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /**
@@ -537,6 +598,15 @@ s32 XQspiPsu_StartDmaTransfer(XQspiPsu *InstancePtr, XQspiPsu_Msg *Msg,
 				u32 NumMsg);
 s32 XQspiPsu_CheckDmaDone(XQspiPsu *InstancePtr);
 
+/* Streaming read functions */
+void XQspiPsu_StreamInit(XQspiPsu *InstancePtr, XQspiPsu_Stream *StreamPtr,
+			 const XQspiPsu_StreamConfig *ConfigPtr);
+s32 XQspiPsu_StreamStart(XQspiPsu_Stream *StreamPtr, u32 Address,
+			 u32 ByteCount);
+s32 XQspiPsu_StreamNext(XQspiPsu_Stream *StreamPtr, u8 **BufPtr,
+			u32 *ByteCount);
+s32 XQspiPsu_StreamStop(XQspiPsu_Stream *StreamPtr);
+
 /* Configuration functions */
 s32 XQspiPsu_SetClkPrescaler(const XQspiPsu *InstancePtr, u8 Prescaler);
 void XQspiPsu_SelectFlash(XQspiPsu *InstancePtr, u8 FlashCS, u8 FlashBus);
@@ -0,0 +1,428 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xqspipsu_stream.c
+ * @addtogroup qspipsu Overview
+ * @{
+ *
+ * This file implements the streaming read APIs of the QSPIPSU driver.
+ *
+ * A stream reads a range of the flash in chunks of up to one buffer, with
+ * one read command per chunk, through the non-blocking DMA transfer. Each
+ * call to XQspiPsu_StreamNext() waits for the chunk in flight, starts the
+ * next chunk into the other buffer and returns the finished one, so the
+ * application processes a chunk while the next one is read. Chunks never
+ * cross the end of a flash device in stacked mode, nor a 16MB bank with 3
+ * byte addresses, the bank handler of the stream selects the bank before
+ * the first chunk of a bank.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who Date     Changes
+ * ----- --- -------- -----------------------------------------------
+ * 1.16  ag  10/14/26 First release
+ *
+ * </pre>
+ *
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <string.h>
+#include "xqspipsu.h"
+#include "sleep.h"
+
+/************************** Constant Definitions *****************************/
+#define XQSPIPSU_STREAM_BANK_SIZE	0x1000000U	/**< 16MB bank */
+#define XQSPIPSU_STREAM_MIN_XFER	8U	/**< Minimum DMA chunk */
+#define XQSPIPSU_STREAM_MAX_DELAY	10000000U	/**< Chunk timeout, usec */
+
+/************************** Function Prototypes ******************************/
+static s32 XQspiPsu_StreamIssue(XQspiPsu_Stream *StreamPtr);
+static s32 XQspiPsu_StreamWait(XQspiPsu_Stream *StreamPtr);
+
+/*****************************************************************************/
+/**
+ *
+ * This function initializes a stream of a QSPIPSU instance.
+ *
+ * @param	InstancePtr is a pointer to the XQspiPsu instance.
+ * @param	StreamPtr is a pointer to the stream.
+ * @param	ConfigPtr is the read command and buffers of the stream, it
+ *		is copied into the stream.
+ *
+ * @return	None.
+ *
+ * @note	The stream assumes bank 0 of the flash is selected when no
+ *		bank handler is set.
+ *
+ ******************************************************************************/
+void XQspiPsu_StreamInit(XQspiPsu *InstancePtr, XQspiPsu_Stream *StreamPtr,
+			 const XQspiPsu_StreamConfig *ConfigPtr)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid(StreamPtr != NULL);
+	Xil_AssertVoid(ConfigPtr != NULL);
+	Xil_AssertVoid((ConfigPtr->BufPtr[0] != NULL) &&
+		       (ConfigPtr->BufPtr[1] != NULL));
+	Xil_AssertVoid((ConfigPtr->BufSize >= XQSPIPSU_STREAM_MIN_XFER) &&
+		       ((ConfigPtr->BufSize % 4U) == 0U));
+	Xil_AssertVoid(ConfigPtr->BufSize <= XQSPIPSU_DMA_BYTES_MAX);
+	Xil_AssertVoid((ConfigPtr->FlashSize != 0U) &&
+		       ((ConfigPtr->FlashSize % 4U) == 0U));
+	Xil_AssertVoid((ConfigPtr->AddrSize == 3U) ||
+		       (ConfigPtr->AddrSize == 4U));
+
+	(void)memset(StreamPtr, 0, sizeof(XQspiPsu_Stream));
+	StreamPtr->Config = *ConfigPtr;
+	StreamPtr->InstancePtr = InstancePtr;
+
+	if (ConfigPtr->BankHandler != NULL) {
+		StreamPtr->Bank[0] = 0xFFFFFFFFU;
+		StreamPtr->Bank[1] = 0xFFFFFFFFU;
+	}
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function starts a stream and the read of its first chunk.
+ *
+ * @param	StreamPtr is a pointer to the stream.
+ * @param	Address is the flash address to read from. In stacked and
+ *		parallel modes it spans both flash devices.
+ * @param	ByteCount is the number of bytes to read.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_INVALID_PARAM if the range is outside of the flash.
+ *		- XST_DEVICE_BUSY if a transfer is already in progress.
+ *		- XST_FAILURE if the first chunk could not be started.
+ *
+ * @note	The range of a previous stream that is not read yet is
+ *		dropped.
+ *
+ ******************************************************************************/
+s32 XQspiPsu_StreamStart(XQspiPsu_Stream *StreamPtr, u32 Address,
+			 u32 ByteCount)
+{
+	u32 TotalSize;
+	s32 Status;
+
+	Xil_AssertNonvoid(StreamPtr != NULL);
+	Xil_AssertNonvoid(StreamPtr->InstancePtr != NULL);
+	Xil_AssertNonvoid(ByteCount > 0U);
+
+	TotalSize = StreamPtr->Config.FlashSize;
+	if (StreamPtr->InstancePtr->Config.ConnectionMode !=
+	    XQSPIPSU_CONNECTION_MODE_SINGLE) {
+		TotalSize <<= 1U;
+	}
+	if ((Address >= TotalSize) || (ByteCount > (TotalSize - Address))) {
+		return (s32)XST_INVALID_PARAM;
+	}
+
+	Status = XQspiPsu_StreamStop(StreamPtr);
+	if (Status != (s32)XST_SUCCESS) {
+		return Status;
+	}
+
+	/* The DMA is word aligned, skip the leading bytes of the first word */
+	StreamPtr->Skip = Address % 4U;
+	StreamPtr->Addr = Address - StreamPtr->Skip;
+	StreamPtr->Remaining = ByteCount + StreamPtr->Skip;
+	StreamPtr->Cur = 0U;
+
+	return XQspiPsu_StreamIssue(StreamPtr);
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function waits for the chunk in flight, starts the read of the next
+ * chunk into the other buffer and returns the finished chunk.
+ *
+ * @param	StreamPtr is a pointer to the stream.
+ * @param	BufPtr is filled with the data of the chunk.
+ * @param	ByteCount is filled with the number of bytes of the chunk.
+ *
+ * @return
+ *		- XST_SUCCESS if a chunk is returned.
+ *		- XST_NO_DATA if the whole range has been returned.
+ *		- XST_FAILURE if the chunk timed out or the next chunk could
+ *		  not be started.
+ *
+ * @note	The chunk stays valid until the next call, the buffer it is in
+ *		is then used to read the chunk after the next one.
+ *
+ ******************************************************************************/
+s32 XQspiPsu_StreamNext(XQspiPsu_Stream *StreamPtr, u8 **BufPtr,
+			u32 *ByteCount)
+{
+	u8 Done;
+	s32 Status;
+
+	Xil_AssertNonvoid(StreamPtr != NULL);
+	Xil_AssertNonvoid(BufPtr != NULL);
+	Xil_AssertNonvoid(ByteCount != NULL);
+
+	if (StreamPtr->InFlight == 0U) {
+		return (s32)XST_NO_DATA;
+	}
+
+	Status = XQspiPsu_StreamWait(StreamPtr);
+	if (Status != (s32)XST_SUCCESS) {
+		return Status;
+	}
+
+	Done = StreamPtr->Cur;
+	if (StreamPtr->Remaining != 0U) {
+		StreamPtr->Cur ^= 1U;
+		Status = XQspiPsu_StreamIssue(StreamPtr);
+		if (Status != (s32)XST_SUCCESS) {
+			StreamPtr->Remaining = 0U;
+			return Status;
+		}
+	}
+
+	*BufPtr = StreamPtr->Config.BufPtr[Done] + StreamPtr->ChunkOffset[Done];
+	*ByteCount = StreamPtr->ChunkLen[Done];
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function stops a stream, it waits for the chunk in flight and drops
+ * the rest of the range.
+ *
+ * @param	StreamPtr is a pointer to the stream.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_FAILURE if the chunk in flight timed out.
+ *
+ ******************************************************************************/
+s32 XQspiPsu_StreamStop(XQspiPsu_Stream *StreamPtr)
+{
+	s32 Status = (s32)XST_SUCCESS;
+
+	Xil_AssertNonvoid(StreamPtr != NULL);
+
+	if (StreamPtr->InFlight != 0U) {
+		Status = XQspiPsu_StreamWait(StreamPtr);
+	}
+	StreamPtr->Remaining = 0U;
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function starts the read of the next chunk of a stream into the
+ * buffer StreamPtr->Cur. The chunk is clipped to the end of the flash
+ * device and, with 3 byte addresses, to the end of the bank.
+ *
+ * @param	StreamPtr is a pointer to the stream.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_DEVICE_BUSY if a transfer is already in progress.
+ *		- XST_FAILURE if the bank could not be selected or the chunk
+ *		  could not be started.
+ *
+ ******************************************************************************/
+static s32 XQspiPsu_StreamIssue(XQspiPsu_Stream *StreamPtr)
+{
+	XQspiPsu *InstancePtr = StreamPtr->InstancePtr;
+	const XQspiPsu_StreamConfig *ConfigPtr = &StreamPtr->Config;
+	XQspiPsu_Msg *Msg = StreamPtr->Msg;
+	u32 Parallel;
+	u32 FlashAddr;
+	u32 Limit;
+	u32 Len;
+	u32 XferLen;
+	u32 Back = 0U;
+	u32 Bank;
+	u32 NumMsg = 0U;
+	u8 FlashCS;
+	u8 FlashBus;
+	u8 Index;
+	s32 Status;
+
+	if (InstancePtr->IsBusy == (u32)TRUE) {
+		return (s32)XST_DEVICE_BUSY;
+	}
+
+	/* Translate the address based on the connection mode */
+	Parallel = (InstancePtr->Config.ConnectionMode ==
+		    XQSPIPSU_CONNECTION_MODE_PARALLEL) ? 1U : 0U;
+	if (Parallel != 0U) {
+		FlashCS = XQSPIPSU_SELECT_FLASH_CS_BOTH;
+		FlashBus = XQSPIPSU_SELECT_FLASH_BUS_BOTH;
+		FlashAddr = StreamPtr->Addr >> 1U;
+	} else if ((InstancePtr->Config.ConnectionMode ==
+		    XQSPIPSU_CONNECTION_MODE_STACKED) &&
+		   (StreamPtr->Addr >= ConfigPtr->FlashSize)) {
+		FlashCS = XQSPIPSU_SELECT_FLASH_CS_UPPER;
+		FlashBus = XQSPIPSU_SELECT_FLASH_BUS_LOWER;
+		FlashAddr = StreamPtr->Addr - ConfigPtr->FlashSize;
+	} else {
+		FlashCS = XQSPIPSU_SELECT_FLASH_CS_LOWER;
+		FlashBus = XQSPIPSU_SELECT_FLASH_BUS_LOWER;
+		FlashAddr = StreamPtr->Addr;
+	}
+
+	Limit = ConfigPtr->FlashSize - FlashAddr;
+	if ((ConfigPtr->AddrSize == 3U) && ((XQSPIPSU_STREAM_BANK_SIZE -
+	     (FlashAddr % XQSPIPSU_STREAM_BANK_SIZE)) < Limit)) {
+		Limit = XQSPIPSU_STREAM_BANK_SIZE -
+			(FlashAddr % XQSPIPSU_STREAM_BANK_SIZE);
+	}
+	Limit <<= Parallel;
+
+	Len = StreamPtr->Remaining;
+	if (Len > ConfigPtr->BufSize) {
+		Len = ConfigPtr->BufSize;
+	}
+	if (Len > Limit) {
+		Len = Limit;
+	}
+
+	/*
+	 * The DMA reads whole words and at least 8 bytes. A short chunk at
+	 * the end of the flash or bank is read from before its start.
+	 */
+	XferLen = (Len + 3U) & ~3U;
+	if (XferLen < XQSPIPSU_STREAM_MIN_XFER) {
+		if (Limit < XQSPIPSU_STREAM_MIN_XFER) {
+			Back = XQSPIPSU_STREAM_MIN_XFER - XferLen;
+			FlashAddr -= (Back >> Parallel);
+		}
+		XferLen = XQSPIPSU_STREAM_MIN_XFER;
+	}
+
+	XQspiPsu_SelectFlash(InstancePtr, FlashCS, FlashBus);
+
+	if (ConfigPtr->AddrSize == 3U) {
+		Index = (FlashCS == XQSPIPSU_SELECT_FLASH_CS_UPPER) ? 1U : 0U;
+		Bank = FlashAddr / XQSPIPSU_STREAM_BANK_SIZE;
+		if (Bank != StreamPtr->Bank[Index]) {
+			if (ConfigPtr->BankHandler == NULL) {
+				return (s32)XST_FAILURE;
+			}
+			Status = ConfigPtr->BankHandler(ConfigPtr->BankRef,
+							FlashCS, Bank);
+			if (Status != (s32)XST_SUCCESS) {
+				StreamPtr->Bank[0] = 0xFFFFFFFFU;
+				StreamPtr->Bank[1] = 0xFFFFFFFFU;
+				return (s32)XST_FAILURE;
+			}
+			StreamPtr->Bank[Index] = Bank;
+			if (Parallel != 0U) {
+				StreamPtr->Bank[1] = Bank;
+			}
+		}
+	}
+
+	/* Command and address */
+	StreamPtr->CmdBfr[0] = ConfigPtr->ReadCmd;
+	for (Index = 0U; Index < ConfigPtr->AddrSize; Index++) {
+		StreamPtr->CmdBfr[Index + 1U] = (u8)(FlashAddr >>
+			(8U * ((u32)ConfigPtr->AddrSize - 1U - (u32)Index)));
+	}
+	if (ConfigPtr->AddrBusWidth == XQSPIPSU_SELECT_MODE_SPI) {
+		Msg[NumMsg].TxBfrPtr = StreamPtr->CmdBfr;
+		Msg[NumMsg].ByteCount = (u32)ConfigPtr->AddrSize + 1U;
+		Msg[NumMsg].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+		Msg[NumMsg].Flags = XQSPIPSU_MSG_FLAG_TX;
+		NumMsg++;
+	} else {
+		Msg[NumMsg].TxBfrPtr = StreamPtr->CmdBfr;
+		Msg[NumMsg].ByteCount = 1U;
+		Msg[NumMsg].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+		Msg[NumMsg].Flags = XQSPIPSU_MSG_FLAG_TX;
+		NumMsg++;
+		Msg[NumMsg].TxBfrPtr = &StreamPtr->CmdBfr[1];
+		Msg[NumMsg].ByteCount = ConfigPtr->AddrSize;
+		Msg[NumMsg].BusWidth = ConfigPtr->AddrBusWidth;
+		Msg[NumMsg].Flags = XQSPIPSU_MSG_FLAG_TX;
+		NumMsg++;
+	}
+
+	/* Dummy cycles use the bus width of the data phase */
+	if (ConfigPtr->DummyCycles != 0U) {
+		Msg[NumMsg].TxBfrPtr = NULL;
+		Msg[NumMsg].ByteCount = ConfigPtr->DummyCycles;
+		Msg[NumMsg].BusWidth = ConfigPtr->DataBusWidth;
+		Msg[NumMsg].Flags = 0U;
+		NumMsg++;
+	}
+
+	Msg[NumMsg].TxBfrPtr = NULL;
+	Msg[NumMsg].RxBfrPtr = ConfigPtr->BufPtr[StreamPtr->Cur];
+	Msg[NumMsg].ByteCount = XferLen;
+	Msg[NumMsg].BusWidth = ConfigPtr->DataBusWidth;
+	Msg[NumMsg].Flags = XQSPIPSU_MSG_FLAG_RX;
+	if (Parallel != 0U) {
+		Msg[NumMsg].Flags |= XQSPIPSU_MSG_FLAG_STRIPE;
+	}
+	NumMsg++;
+
+	Status = XQspiPsu_StartDmaTransfer(InstancePtr, Msg, NumMsg);
+	if (Status != (s32)XST_SUCCESS) {
+		return Status;
+	}
+
+	StreamPtr->ChunkOffset[StreamPtr->Cur] = StreamPtr->Skip + Back;
+	StreamPtr->ChunkLen[StreamPtr->Cur] = Len - StreamPtr->Skip;
+	StreamPtr->Skip = 0U;
+	StreamPtr->Addr += Len;
+	StreamPtr->Remaining -= Len;
+	StreamPtr->InFlight = 1U;
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * This function waits for the chunk in flight of a stream, the controller
+ * is aborted if the chunk times out.
+ *
+ * @param	StreamPtr is a pointer to the stream.
+ *
+ * @return
+ *		- XST_SUCCESS if the chunk is done.
+ *		- XST_FAILURE if the chunk timed out.
+ *
+ ******************************************************************************/
+static s32 XQspiPsu_StreamWait(XQspiPsu_Stream *StreamPtr)
+{
+	u32 DelayCount = 0U;
+
+	StreamPtr->InFlight = 0U;
+
+	while (XQspiPsu_CheckDmaDone(StreamPtr->InstancePtr) !=
+	       (s32)XST_SUCCESS) {
+		if (DelayCount == XQSPIPSU_STREAM_MAX_DELAY) {
+			XQspiPsu_Abort(StreamPtr->InstancePtr);
+			StreamPtr->Remaining = 0U;
+			return (s32)XST_FAILURE;
+		}
+		usleep(1);
+		DelayCount++;
+	}
+
+	return (s32)XST_SUCCESS;
+}
+/** @} */
@@ -208,6 +208,10 @@
 * 11.1  cog    11/16/21 Upversion.
 *       cog    01/18/22 Refactor connected data components.
 *       cog    01/18/22 Added safety checks.
+*       ag     10/15/26 Added XRFdc_BeginRegBatch(), XRFdc_CommitRegBatch()
+*                       and XRFdc_DiscardRegBatch().
+*       ag     10/15/26 Added XRFdc_StartUpAsync(), XRFdc_WaitForStartUp()
+*                       and XRFdc_StartUpAll().
 *
 * </pre>
 *
@@ -222,6 +226,7 @@
 
 /***************** Macros (Inline Functions) Definitions *********************/
 static u32 XRFdc_RestartIPSM(XRFdc *InstancePtr, u32 Type, int Tile_Id, u32 Start, u32 End);
+static u32 XRFdc_RunIPSM(XRFdc *InstancePtr, u32 Type, int Tile_Id, u32 Start, u32 End, u32 Flags);
 static void StubHandler(void *CallBackRefPtr, u32 Type, u32 Tile_Id, u32 Block_Id, u32 StatusEvent);
 static void XRFdc_ADCInitialize(XRFdc *InstancePtr);
 static void XRFdc_DACInitialize(XRFdc *InstancePtr);
@@ -233,6 +238,8 @@ static u32 XRFdc_GetADCBlockStatus(XRFdc *InstancePtr, u32 BaseAddr, u32 Tile_Id
 static u32 XRFdc_GetDACBlockStatus(XRFdc *InstancePtr, u32 BaseAddr, u32 Tile_Id, u32 Block_Id,
 				   XRFdc_BlockStatus *BlockStatusPtr);
 static void XRFdc_DumpHSCOMRegs(XRFdc *InstancePtr, u32 Type, int Tile_Id);
+static u32 XRFdc_BatchFind(XRFdc_RegBatch *BatchPtr, u32 Addr);
+static void XRFdc_BatchFlush(XRFdc *InstancePtr);
 static void XRFdc_DumpDACRegs(XRFdc *InstancePtr, int Tile_Id);
 static void XRFdc_DumpADCRegs(XRFdc *InstancePtr, int Tile_Id);
 static u32 XRFdc_WaitForRestartClr(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 BaseAddr, u32 End);
@@ -286,6 +293,8 @@ u32 XRFdc_CfgInitialize(XRFdc *InstancePtr, XRFdc_Config *ConfigPtr)
 	InstancePtr->RFdc_Config = *ConfigPtr;
 	InstancePtr->ADC4GSPS = ConfigPtr->ADCType;
 	InstancePtr->StatusHandler = StubHandler;
+	InstancePtr->RegBatch.IsActive = 0U;
+	InstancePtr->RegBatch.NumEntries = 0U;
 
 	/*
 	 * Indicate the instance is now ready to use.
@@ -674,6 +683,106 @@ u32 XRFdc_StartUp(XRFdc *InstancePtr, u32 Type, int Tile_Id)
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+*
+* The API triggers the restart of the requested tile(s) like XRFdc_StartUp()
+* but returns without waiting for the tile(s) to come up. Call
+* XRFdc_WaitForStartUp() before using the tile(s).
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Type is ADC or DAC. 0 for ADC and 1 for DAC
+* @param    Tile_Id Valid values are 0-3, and -1.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if error occurs.
+*
+* @note     None.
+*
+******************************************************************************/
+u32 XRFdc_StartUpAsync(XRFdc *InstancePtr, u32 Type, int Tile_Id)
+{
+	u32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XRFDC_COMPONENT_IS_READY);
+
+	Status = XRFdc_RunIPSM(InstancePtr, Type, Tile_Id, XRFDC_SM_STATE1, XRFDC_SM_STATE15, XRFDC_IPSM_TRIGGER);
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* The API waits for tile(s) started with XRFdc_StartUpAsync() to come up,
+* i.e. for the PLL to lock and the restart to complete.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Type is ADC or DAC. 0 for ADC and 1 for DAC
+* @param    Tile_Id Valid values are 0-3, and -1.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if a tile timed out.
+*
+* @note     None.
+*
+******************************************************************************/
+u32 XRFdc_WaitForStartUp(XRFdc *InstancePtr, u32 Type, int Tile_Id)
+{
+	u32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XRFDC_COMPONENT_IS_READY);
+
+	Status = XRFdc_RunIPSM(InstancePtr, Type, Tile_Id, XRFDC_SM_STATE1, XRFDC_SM_STATE15, XRFDC_IPSM_WAIT);
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* The API starts all ADC and DAC tiles. All tiles are triggered first and
+* then waited on, so their power-up and calibration sequences run at the
+* same time and the total start-up time is that of the slowest tile rather
+* than the sum over all tiles.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if error occurs.
+*
+* @note     Tiles that take their clock from another tile wait in the clock
+*           detect state until the source tile provides it.
+*
+******************************************************************************/
+u32 XRFdc_StartUpAll(XRFdc *InstancePtr)
+{
+	u32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XRFDC_COMPONENT_IS_READY);
+
+	Status = XRFdc_StartUpAsync(InstancePtr, XRFDC_DAC_TILE, XRFDC_SELECT_ALL_TILES);
+	if (Status != XRFDC_SUCCESS) {
+		goto RETURN_PATH;
+	}
+	Status = XRFdc_StartUpAsync(InstancePtr, XRFDC_ADC_TILE, XRFDC_SELECT_ALL_TILES);
+	if (Status != XRFDC_SUCCESS) {
+		goto RETURN_PATH;
+	}
+	Status = XRFdc_WaitForStartUp(InstancePtr, XRFDC_DAC_TILE, XRFDC_SELECT_ALL_TILES);
+	if (Status != XRFDC_SUCCESS) {
+		goto RETURN_PATH;
+	}
+	Status = XRFdc_WaitForStartUp(InstancePtr, XRFDC_ADC_TILE, XRFDC_SELECT_ALL_TILES);
+
+RETURN_PATH:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -986,6 +1095,33 @@ RETURN_PATH:
 *
 ******************************************************************************/
 static u32 XRFdc_RestartIPSM(XRFdc *InstancePtr, u32 Type, int Tile_Id, u32 Start, u32 End)
+{
+	return XRFdc_RunIPSM(InstancePtr, Type, Tile_Id, Start, End, XRFDC_IPSM_TRIGGER | XRFDC_IPSM_WAIT);
+}
+
+/*****************************************************************************/
+/**
+*
+* Triggers the restart of the requested tile(s) and/or waits for them to
+* reach the end state. Triggering and waiting in separate calls lets all
+* tiles run their state machines at the same time.
+*
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Type is ADC or DAC. 0 for ADC and 1 for DAC
+* @param    Tile_Id Valid values are 0-3, and -1.
+* @param    Start is start state of State Machine
+* @param    End is end state of State Machine.
+* @param    Flags selects XRFDC_IPSM_TRIGGER and/or XRFDC_IPSM_WAIT.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if error occurs.
+*
+* @note     None.
+*
+******************************************************************************/
+static u32 XRFdc_RunIPSM(XRFdc *InstancePtr, u32 Type, int Tile_Id, u32 Start, u32 End, u32 Flags)
 {
 	u32 Status;
 	u32 BaseAddr;
@@ -1026,17 +1162,21 @@ static u32 XRFdc_RestartIPSM(XRFdc *InstancePtr, u32 Type, int Tile_Id, u32 Star
 			    (End == XRFDC_SM_STATE1)) {
 				End = XRFDC_SM_STATE3;
 			}
-			/* Write Start and End states */
-			XRFdc_ClrSetReg(InstancePtr, BaseAddr, XRFDC_RESTART_STATE_OFFSET, XRFDC_PWR_STATE_MASK,
-					(Start << XRFDC_RSR_START_SHIFT) | End);
+			if ((Flags & XRFDC_IPSM_TRIGGER) != 0U) {
+				/* Write Start and End states */
+				XRFdc_ClrSetReg(InstancePtr, BaseAddr, XRFDC_RESTART_STATE_OFFSET,
+						XRFDC_PWR_STATE_MASK, (Start << XRFDC_RSR_START_SHIFT) | End);
 
-			/* Trigger restart */
-			XRFdc_WriteReg(InstancePtr, BaseAddr, XRFDC_RESTART_OFFSET, XRFDC_RESTART_MASK);
+				/* Trigger restart */
+				XRFdc_WriteReg(InstancePtr, BaseAddr, XRFDC_RESTART_OFFSET, XRFDC_RESTART_MASK);
+			}
 
-			/* Wait for restart bit clear */
-			Status = XRFdc_WaitForRestartClr(InstancePtr, Type, Index, BaseAddr, End);
-			if (Status != XRFDC_SUCCESS) {
-				goto RETURN_PATH;
+			if ((Flags & XRFDC_IPSM_WAIT) != 0U) {
+				/* Wait for restart bit clear */
+				Status = XRFdc_WaitForRestartClr(InstancePtr, Type, Index, BaseAddr, End);
+				if (Status != XRFDC_SUCCESS) {
+					goto RETURN_PATH;
+				}
 			}
 		}
 	}
@@ -2063,6 +2203,217 @@ u16 XRFdc_RDReg(XRFdc *InstancePtr, u32 BaseAddr, u32 RegAddr, u16 Mask)
 	return ReadReg;
 }
 
+/*****************************************************************************/
+/**
+*
+* Open a register batch. Until the batch is committed, the 16 bit register
+* accesses of the driver (XRFdc_ReadReg16(), XRFdc_WriteReg16() and so
+* XRFdc_ClrSetReg(), XRFdc_ClrReg() and XRFdc_RDReg()) go to a cache in the
+* instance instead of the device. Each register is read from the device at
+* most once and written at most once, when the batch is committed.
+*
+* A typical use is to wrap several settings calls on one or more tiles, e.g.
+* XRFdc_SetMixerSettings() and XRFdc_SetQMCSettings() on every block, so
+* that the read-modify-write sequences of the calls on shared registers are
+* merged into one write per register.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+*
+* @return
+*           - None
+*
+* @note     Only wrap calls that do not poll status registers or wait on
+*           the device, as the cached values are not refreshed. 32 bit and
+*           8 bit accesses are not batched. Batches do not nest.
+*
+******************************************************************************/
+void XRFdc_BeginRegBatch(XRFdc *InstancePtr)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XRFDC_COMPONENT_IS_READY);
+	Xil_AssertVoid(InstancePtr->RegBatch.IsActive == 0U);
+
+	InstancePtr->RegBatch.NumEntries = 0U;
+	InstancePtr->RegBatch.IsActive = 1U;
+}
+
+/*****************************************************************************/
+/**
+*
+* Write the registers changed in the open register batch to the device and
+* close the batch. The registers are written in the order of their last
+* change, so an update or trigger register written at the end of a settings
+* call is still written after the registers it applies.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+*
+* @return
+*           - None
+*
+******************************************************************************/
+void XRFdc_CommitRegBatch(XRFdc *InstancePtr)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->RegBatch.IsActive != 0U);
+
+	XRFdc_BatchFlush(InstancePtr);
+	InstancePtr->RegBatch.IsActive = 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* Close the open register batch without writing the changed registers to the
+* device, e.g. after one of the batched calls failed.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+*
+* @return
+*           - None
+*
+* @note     Registers already written because the batch was full are not
+*           restored. The driver's copy of the settings is not restored.
+*
+******************************************************************************/
+void XRFdc_DiscardRegBatch(XRFdc *InstancePtr)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	InstancePtr->RegBatch.NumEntries = 0U;
+	InstancePtr->RegBatch.IsActive = 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* Look up a register in the open register batch.
+*
+* @param    BatchPtr is a pointer to the register batch.
+* @param    Addr is the register offset in the IO region.
+*
+* @return
+*           - Index of the entry + 1, or 0 if the register is not cached.
+*
+******************************************************************************/
+static u32 XRFdc_BatchFind(XRFdc_RegBatch *BatchPtr, u32 Addr)
+{
+	u32 Index;
+
+	for (Index = BatchPtr->NumEntries; Index > 0U; Index--) {
+		if (BatchPtr->Entry[Index - 1U].Addr == Addr) {
+			break;
+		}
+	}
+
+	return Index;
+}
+
+/*****************************************************************************/
+/**
+*
+* Write the changed registers of the open register batch to the device and
+* empty the batch. The batch stays open.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+*
+* @return
+*           - None
+*
+******************************************************************************/
+static void XRFdc_BatchFlush(XRFdc *InstancePtr)
+{
+	XRFdc_RegBatch *BatchPtr = &InstancePtr->RegBatch;
+	u32 Index;
+
+	for (Index = 0U; Index < BatchPtr->NumEntries; Index++) {
+		if (BatchPtr->Entry[Index].IsDirty != 0U) {
+			XRFdc_Out16(InstancePtr->io, BatchPtr->Entry[Index].Addr, BatchPtr->Entry[Index].Value);
+		}
+	}
+	BatchPtr->NumEntries = 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* Read a 16 bit register through the open register batch. Used by
+* XRFdc_ReadReg16().
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Addr is the register offset in the IO region.
+*
+* @return
+*           - The cached value, or the value read from the device if the
+*             register is not cached yet.
+*
+******************************************************************************/
+u16 XRFdc_BatchRead16(XRFdc *InstancePtr, u32 Addr)
+{
+	XRFdc_RegBatch *BatchPtr = &InstancePtr->RegBatch;
+	XRFdc_RegBatchEntry *EntryPtr;
+	u32 Index;
+	u16 Value;
+
+	Index = XRFdc_BatchFind(BatchPtr, Addr);
+	if (Index != 0U) {
+		return BatchPtr->Entry[Index - 1U].Value;
+	}
+
+	Value = XRFdc_In16(InstancePtr->io, Addr);
+
+	if (BatchPtr->NumEntries == XRFDC_REG_BATCH_SIZE) {
+		XRFdc_BatchFlush(InstancePtr);
+	}
+	EntryPtr = &BatchPtr->Entry[BatchPtr->NumEntries++];
+	EntryPtr->Addr = Addr;
+	EntryPtr->Value = Value;
+	EntryPtr->IsDirty = 0U;
+
+	return Value;
+}
+
+/*****************************************************************************/
+/**
+*
+* Write a 16 bit register through the open register batch. Used by
+* XRFdc_WriteReg16(). The register moves to the end of the write order.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Addr is the register offset in the IO region.
+* @param    Value is the value to be written.
+*
+* @return
+*           - None
+*
+******************************************************************************/
+void XRFdc_BatchWrite16(XRFdc *InstancePtr, u32 Addr, u16 Value)
+{
+	XRFdc_RegBatch *BatchPtr = &InstancePtr->RegBatch;
+	XRFdc_RegBatchEntry *EntryPtr;
+	u32 Index;
+
+	Index = XRFdc_BatchFind(BatchPtr, Addr);
+	if ((Index != 0U) && (Index == BatchPtr->NumEntries)) {
+		EntryPtr = &BatchPtr->Entry[Index - 1U];
+		EntryPtr->Value = Value;
+		EntryPtr->IsDirty = 1U;
+		return;
+	}
+	if (Index != 0U) {
+		/* Superseded, keep the slot but never match or write it */
+		BatchPtr->Entry[Index - 1U].Addr = XRFDC_REG_BATCH_NO_ADDR;
+		BatchPtr->Entry[Index - 1U].IsDirty = 0U;
+	}
+
+	if (BatchPtr->NumEntries == XRFDC_REG_BATCH_SIZE) {
+		XRFdc_BatchFlush(InstancePtr);
+	}
+	EntryPtr = &BatchPtr->Entry[BatchPtr->NumEntries++];
+	EntryPtr->Addr = Addr;
+	EntryPtr->Value = Value;
+	EntryPtr->IsDirty = 1U;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -284,6 +284,9 @@
 *       cog    11/26/21 Pack all structs for RAFT compatibility.
 *       cog    12/06/21 Rearrange XRFdc_Distribution_Settings.
 *       cog    01/18/22 Added safety checks.
+*       ag     10/15/26 Added register batching, see XRFdc_BeginRegBatch().
+*       ag     10/15/26 Added NCO hop tables, see XRFdc_BuildHopTable().
+*       ag     10/15/26 Added asynchronous tile start-up.
 *
 * </pre>
 *
@@ -488,6 +491,28 @@ typedef struct {
 	u8 MixerType;
 } XRFdc_Mixer_Settings;
 
+/**
+ * NCO hop entry, see XRFdc_BuildHopTable().
+ */
+typedef struct {
+	double Freq; /* NCO frequency in MHz */
+	double PhaseOffset; /* NCO phase offset in degrees */
+	u16 FreqWord[3]; /* Frequency word [15:0], [31:16], [47:32] */
+	u16 PhaseWord[2]; /* Phase word [15:0], [17:16] */
+} XRFdc_Hop_Entry;
+
+/**
+ * NCO hop table of one ADC/DAC block.
+ */
+typedef struct {
+	u32 Type;
+	u32 Tile_Id;
+	u32 Block_Id;
+	u32 EventSource; /* Mixer event source when the table was built */
+	u32 NumHops;
+	XRFdc_Hop_Entry *HopPtr; /* Array of NumHops entries */
+} XRFdc_Hop_Table;
+
 /**
  * ADC block Threshold settings.
  */
@@ -754,6 +779,23 @@ typedef struct {
 	XRFdc_ADCBlock_DigitalDataPath ADCBlock_Digital_Datapath[4];
 } XRFdc_ADC_Tile;
 
+/**
+ * Register Batch Structure.
+ */
+#define XRFDC_REG_BATCH_SIZE 64U
+#define XRFDC_REG_BATCH_NO_ADDR 0xFFFFFFFFU
+typedef struct {
+	u32 Addr; /* Register offset in the IO region */
+	u16 Value; /* Cached register value */
+	u16 IsDirty; /* Set to 1, if the value has to be written */
+} XRFdc_RegBatchEntry;
+
+typedef struct {
+	XRFdc_RegBatchEntry Entry[XRFDC_REG_BATCH_SIZE]; /* In order of last write */
+	u32 NumEntries;
+	u32 IsActive;
+} XRFdc_RegBatch;
+
 /**
  * RFdc Structure.
  */
@@ -769,6 +811,7 @@ typedef struct {
 	XRFdc_StatusHandler StatusHandler; /* Event handler function */
 	void *CallBackRef; /* Callback reference for event handler */
 	u8 UpdateMixerScale; /* Set to 1, if user overwrite mixer scale */
+	XRFdc_RegBatch RegBatch; /* Deferred 16 bit register accesses */
 } XRFdc;
 #ifndef __BAREMETAL__
 #pragma pack()
@@ -1065,6 +1108,9 @@ typedef struct {
 #define XRFDC_SM_STATE7 0x7U
 #define XRFDC_SM_STATE15 0xFU
 
+#define XRFDC_IPSM_TRIGGER 0x1U
+#define XRFDC_IPSM_WAIT 0x2U
+
 #define XRFDC_STATE_OFF 0x0U
 #define XRFDC_STATE_SHUTDOWN 0x1U
 #define XRFDC_STATE_PWRUP 0x3U
@@ -1345,6 +1391,9 @@ XRFdc_Config *XRFdc_LookupConfig(u16 DeviceId);
 u32 XRFdc_RegisterMetal(XRFdc *InstancePtr, u16 DeviceId, struct metal_device **DevicePtr);
 u32 XRFdc_CfgInitialize(XRFdc *InstancePtr, XRFdc_Config *ConfigPtr);
 u32 XRFdc_StartUp(XRFdc *InstancePtr, u32 Type, int Tile_Id);
+u32 XRFdc_StartUpAsync(XRFdc *InstancePtr, u32 Type, int Tile_Id);
+u32 XRFdc_WaitForStartUp(XRFdc *InstancePtr, u32 Type, int Tile_Id);
+u32 XRFdc_StartUpAll(XRFdc *InstancePtr);
 u32 XRFdc_Shutdown(XRFdc *InstancePtr, u32 Type, int Tile_Id);
 u32 XRFdc_Reset(XRFdc *InstancePtr, u32 Type, int Tile_Id);
 u32 XRFdc_CustomStartUp(XRFdc *InstancePtr, u32 Type, int Tile_Id, u32 StartState, u32 EndState);
@@ -1379,6 +1428,10 @@ u32 XRFdc_SetDecoderMode(XRFdc *InstancePtr, u32 Tile_Id, u32 Block_Id, u32 Deco
 u32 XRFdc_UpdateEvent(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id, u32 Event);
 u32 XRFdc_GetDecoderMode(XRFdc *InstancePtr, u32 Tile_Id, u32 Block_Id, u32 *DecoderModePtr);
 u32 XRFdc_ResetNCOPhase(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id);
+u32 XRFdc_BuildHopTable(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id, XRFdc_Hop_Table *TablePtr,
+			XRFdc_Hop_Entry *HopPtr, u32 NumHops);
+u32 XRFdc_ArmHop(XRFdc *InstancePtr, const XRFdc_Hop_Table *TablePtr, u32 HopIndex);
+u32 XRFdc_ArmHopMulti(XRFdc *InstancePtr, const XRFdc_Hop_Table *TablePtr, u32 NumTables, u32 HopIndex);
 void XRFdc_DumpRegs(XRFdc *InstancePtr, u32 Type, int Tile_Id);
 u32 XRFdc_MultiBand(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u8 DigitalDataPathMask, u32 MixerInOutDataType,
 		    u32 DataConverterMask);
@@ -1447,6 +1500,11 @@ u32 XRFdc_ResetInternalFIFOWidthObs(XRFdc *InstancePtr, u32 Tile_Id, u32 Block_I
 void XRFdc_ClrSetReg(XRFdc *InstancePtr, u32 BaseAddr, u32 RegAddr, u16 Mask, u16 Data);
 void XRFdc_ClrReg(XRFdc *InstancePtr, u32 BaseAddr, u32 RegAddr, u16 Mask);
 u16 XRFdc_RDReg(XRFdc *InstancePtr, u32 BaseAddr, u32 RegAddr, u16 Mask);
+void XRFdc_BeginRegBatch(XRFdc *InstancePtr);
+void XRFdc_CommitRegBatch(XRFdc *InstancePtr);
+void XRFdc_DiscardRegBatch(XRFdc *InstancePtr);
+u16 XRFdc_BatchRead16(XRFdc *InstancePtr, u32 Addr);
+void XRFdc_BatchWrite16(XRFdc *InstancePtr, u32 Addr, u16 Value);
 u32 XRFdc_IsHighSpeedADC(XRFdc *InstancePtr, u32 Tile);
 u32 XRFdc_IsDACBlockEnabled(XRFdc *InstancePtr, u32 Tile_Id, u32 Block_Id);
 u32 XRFdc_IsADCBlockEnabled(XRFdc *InstancePtr, u32 Tile_Id, u32 Block_Id);
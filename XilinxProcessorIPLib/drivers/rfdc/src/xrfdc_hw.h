@@ -107,6 +107,8 @@
 *       cog    11/26/21 Reset clock gaters when setting decimation rate.
 *       cog    12/21/21 Read DAC coupling from a register rather than from
 *                       the config structure.
+*       ag     10/15/26 Route 16 bit accesses through the register batch
+*                       while one is open.
 *
 *</pre>
 *
@@ -2332,7 +2334,9 @@ extern "C" {
 *
 ******************************************************************************/
 #define XRFdc_ReadReg16(InstancePtr, BaseAddress, RegOffset)                                                           \
-	XRFdc_In16((InstancePtr->io), ((u32)RegOffset + (u32)BaseAddress))
+	((InstancePtr->RegBatch.IsActive != 0U) ?                                                                      \
+		 XRFdc_BatchRead16((InstancePtr), ((u32)RegOffset + (u32)BaseAddress)) :                               \
+		 XRFdc_In16((InstancePtr->io), ((u32)RegOffset + (u32)BaseAddress)))
 
 /***************************************************************************/
 /**
@@ -2352,7 +2356,15 @@ extern "C" {
 *
 ******************************************************************************/
 #define XRFdc_WriteReg16(InstancePtr, BaseAddress, RegOffset, RegisterValue)                                           \
-	XRFdc_Out16((InstancePtr->io), ((u32)RegOffset + (u32)BaseAddress), (u32)(RegisterValue))
+	do {                                                                                                           \
+		if (InstancePtr->RegBatch.IsActive != 0U) {                                                            \
+			XRFdc_BatchWrite16((InstancePtr), ((u32)RegOffset + (u32)BaseAddress),                         \
+					   (u16)(RegisterValue));                                                      \
+		} else {                                                                                               \
+			XRFdc_Out16((InstancePtr->io), ((u32)RegOffset + (u32)BaseAddress),                            \
+				    (u32)(RegisterValue));                                                             \
+		}                                                                                                      \
+	} while (0)
 
 /****************************************************************************/
 /**
@@ -56,6 +56,7 @@
 * 11.0  cog    05/31/21 Upversion.
 * 11.1  cog    11/16/21 Upversion.
 *       cog    01/18/22 Added safety checks.
+*       ag     10/15/26 Added NCO hop tables, see XRFdc_BuildHopTable().
 * </pre>
 *
 ******************************************************************************/
@@ -74,6 +75,8 @@ static void XRFdc_SetCoarseMixer(XRFdc *InstancePtr, u32 Type, u32 BaseAddr, u32
 static u32 XRFdc_MixerRangeCheck(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id,
 				 XRFdc_Mixer_Settings *MixerSettingsPtr);
 static void XRFdc_MixersOff(XRFdc *InstancePtr, u32 BaseAddr);
+static u32 XRFdc_GetNCOFreqWord(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id, double NCOFreq,
+				double SamplingRate, s64 *FreqWordPtr);
 
 /************************** Function Prototypes ******************************/
 
@@ -118,7 +121,6 @@ u32 XRFdc_SetMixerSettings(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_
 	u8 CalibrationMode = 0U;
 	u32 CoarseMixFreq;
 	double NCOFreq;
-	u32 NyquistZone = 0U;
 	u32 Offset;
 	u32 DatapathMode;
 	u32 BWDiv = XRFDC_FULL_BW_DIVISOR;
@@ -271,27 +273,11 @@ u32 XRFdc_SetMixerSettings(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_
 			}
 		}
 
-		if ((NCOFreq < -(SamplingRate / 2.0)) || (NCOFreq > (SamplingRate / 2.0))) {
-			Status = XRFdc_GetNyquistZone(InstancePtr, Type, Tile_Id, Block_Id, &NyquistZone);
-			if (Status != XRFDC_SUCCESS) {
-				return XRFDC_FAILURE;
-			}
-			do {
-				if (NCOFreq < -(SamplingRate / 2.0)) {
-					NCOFreq += SamplingRate;
-				}
-				if (NCOFreq > (SamplingRate / 2.0)) {
-					NCOFreq -= SamplingRate;
-				}
-			} while ((NCOFreq < -(SamplingRate / 2.0)) || (NCOFreq > (SamplingRate / 2.0)));
-
-			if ((NyquistZone == XRFDC_EVEN_NYQUIST_ZONE) && (NCOFreq != 0)) {
-				NCOFreq *= -1;
-			}
-		}
-
 		/* NCO Frequency */
-		Freq = ((NCOFreq * XRFDC_NCO_FREQ_MULTIPLIER) / SamplingRate);
+		Status = XRFdc_GetNCOFreqWord(InstancePtr, Type, Tile_Id, Block_Id, NCOFreq, SamplingRate, &Freq);
+		if (Status != XRFDC_SUCCESS) {
+			return XRFDC_FAILURE;
+		}
 		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_ADC_NCO_FQWD_LOW_OFFSET, (u16)Freq);
 		ReadReg = (Freq >> XRFDC_NCO_FQWD_MID_SHIFT) & XRFDC_NCO_FQWD_MID_MASK;
 		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_ADC_NCO_FQWD_MID_OFFSET, (u16)ReadReg);
@@ -731,6 +717,333 @@ static void XRFdc_SetCoarseMixer(XRFdc *InstancePtr, u32 Type, u32 BaseAddr, u32
 	XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_MXR_MODE_OFFSET, XRFDC_MIXER_MODE_OFF);
 }
 
+/*****************************************************************************/
+/**
+* Static API used to convert an NCO frequency to the NCO frequency word. The
+* frequency is folded into the first Nyquist zone of the sampling rate.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Type is ADC or DAC. 0 for ADC and 1 for DAC
+* @param    Tile_Id Valid values are 0-3.
+* @param    Block_Id is ADC/DAC block number inside the tile.
+* @param    NCOFreq is the NCO frequency in MHz.
+* @param    SamplingRate is the sampling rate of the mixer in MHz.
+* @param    FreqWordPtr is used to return the 48 bit frequency word.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if the Nyquist zone could not be read.
+*
+* @note     Static API
+*
+******************************************************************************/
+static u32 XRFdc_GetNCOFreqWord(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id, double NCOFreq,
+				double SamplingRate, s64 *FreqWordPtr)
+{
+	u32 Status;
+	u32 NyquistZone = 0U;
+
+	if ((NCOFreq < -(SamplingRate / 2.0)) || (NCOFreq > (SamplingRate / 2.0))) {
+		Status = XRFdc_GetNyquistZone(InstancePtr, Type, Tile_Id, Block_Id, &NyquistZone);
+		if (Status != XRFDC_SUCCESS) {
+			return XRFDC_FAILURE;
+		}
+		do {
+			if (NCOFreq < -(SamplingRate / 2.0)) {
+				NCOFreq += SamplingRate;
+			}
+			if (NCOFreq > (SamplingRate / 2.0)) {
+				NCOFreq -= SamplingRate;
+			}
+		} while ((NCOFreq < -(SamplingRate / 2.0)) || (NCOFreq > (SamplingRate / 2.0)));
+
+		if ((NyquistZone == XRFDC_EVEN_NYQUIST_ZONE) && (NCOFreq != 0)) {
+			NCOFreq *= -1;
+		}
+	}
+
+	*FreqWordPtr = ((NCOFreq * XRFDC_NCO_FREQ_MULTIPLIER) / SamplingRate);
+
+	return XRFDC_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* The API precomputes the NCO frequency and phase words of a hop table so
+* that XRFdc_ArmHop() can retune the NCO of a block with a few register
+* writes. Before calling it, set the fine mixer, the mixer mode and the
+* event source of the block with XRFdc_SetMixerSettings(); hops only change
+* the NCO frequency and phase, the rest of the mixer is kept.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    Type is ADC or DAC. 0 for ADC and 1 DAC
+* @param    Tile_Id Valid values are 0-3.
+* @param    Block_Id is ADC/DAC block number inside the tile. Valid values
+*           are 0-3.
+* @param    TablePtr is a pointer to the hop table to be built.
+* @param    HopPtr is an array of NumHops entries. Freq (MHz) and
+*           PhaseOffset (degrees) of each entry are passed in, the register
+*           words are filled in. The array is referenced by the table.
+* @param    NumHops is the number of entries in HopPtr.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if error occurs.
+*
+* @note     The table has to be rebuilt when the sampling rate, the
+*           Nyquist zone, the calibration mode or the interpolation mode
+*           of the block changes.
+*
+******************************************************************************/
+u32 XRFdc_BuildHopTable(XRFdc *InstancePtr, u32 Type, u32 Tile_Id, u32 Block_Id, XRFdc_Hop_Table *TablePtr,
+			XRFdc_Hop_Entry *HopPtr, u32 NumHops)
+{
+	u32 Status;
+	u32 Hop;
+	double SamplingRate;
+	double NCOFreq;
+	s64 Freq;
+	s32 PhaseOffset;
+	u8 CalibrationMode = 0U;
+	u32 BWDiv = XRFDC_FULL_BW_DIVISOR;
+	XRFdc_Mixer_Settings *MixerConfigPtr;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(TablePtr != NULL);
+	Xil_AssertNonvoid(HopPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XRFDC_COMPONENT_IS_READY);
+
+	Status = XRFdc_CheckDigitalPathEnabled(InstancePtr, Type, Tile_Id, Block_Id);
+	if (Status != XRFDC_SUCCESS) {
+		goto RETURN_PATH;
+	}
+	if (NumHops == 0U) {
+		metal_log(METAL_LOG_ERROR, "\n Empty hop table for %s %u block %u in %s\r\n",
+			  (Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", Tile_Id, Block_Id, __func__);
+		Status = XRFDC_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	if (Type == XRFDC_ADC_TILE) {
+		MixerConfigPtr = &InstancePtr->ADC_Tile[Tile_Id].ADCBlock_Digital_Datapath[Block_Id].Mixer_Settings;
+		SamplingRate = InstancePtr->ADC_Tile[Tile_Id].PLL_Settings.SampleRate;
+		if (InstancePtr->RFdc_Config.IPType < XRFDC_GEN3) {
+			Status = XRFdc_GetCalibrationMode(InstancePtr, Tile_Id, Block_Id, &CalibrationMode);
+			if (Status != XRFDC_SUCCESS) {
+				goto RETURN_PATH;
+			}
+		}
+	} else {
+		MixerConfigPtr = &InstancePtr->DAC_Tile[Tile_Id].DACBlock_Digital_Datapath[Block_Id].Mixer_Settings;
+		if ((InstancePtr->RFdc_Config.IPType >= XRFDC_GEN3) &&
+		    (XRFdc_RDReg(InstancePtr, XRFDC_BLOCK_BASE(XRFDC_DAC_TILE, Tile_Id, Block_Id),
+				 XRFDC_DAC_DATAPATH_OFFSET,
+				 XRFDC_DATAPATH_MODE_MASK) == XRFDC_DAC_INT_MODE_HALF_BW_IMR)) {
+			BWDiv = XRFDC_HALF_BW_DIVISOR;
+		}
+		SamplingRate = InstancePtr->DAC_Tile[Tile_Id].PLL_Settings.SampleRate / BWDiv;
+	}
+	if (SamplingRate <= 0) {
+		metal_log(METAL_LOG_ERROR, "\n Incorrect Sampling rate (%2.4f GHz) for %s %u in %s\r\n", SamplingRate,
+			  (Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", Tile_Id, __func__);
+		Status = XRFDC_FAILURE;
+		goto RETURN_PATH;
+	}
+	SamplingRate *= XRFDC_MILLI;
+
+	for (Hop = 0U; Hop < NumHops; Hop++) {
+		if ((HopPtr[Hop].PhaseOffset >= XRFDC_MIXER_PHASE_OFFSET_UP_LIMIT) ||
+		    (HopPtr[Hop].PhaseOffset <= XRFDC_MIXER_PHASE_OFFSET_LOW_LIMIT)) {
+			metal_log(METAL_LOG_ERROR,
+				  "\n Invalid phase offset value (%lf) in hop %u for %s %u block %u in %s\r\n",
+				  HopPtr[Hop].PhaseOffset, Hop, (Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", Tile_Id,
+				  Block_Id, __func__);
+			Status = XRFDC_FAILURE;
+			goto RETURN_PATH;
+		}
+
+		NCOFreq = HopPtr[Hop].Freq;
+		if (CalibrationMode == XRFDC_CALIB_MODE1) {
+			NCOFreq -= SamplingRate / 2.0;
+		}
+		Status = XRFdc_GetNCOFreqWord(InstancePtr, Type, Tile_Id, Block_Id, NCOFreq, SamplingRate, &Freq);
+		if (Status != XRFDC_SUCCESS) {
+			goto RETURN_PATH;
+		}
+		HopPtr[Hop].FreqWord[0] = (u16)Freq;
+		HopPtr[Hop].FreqWord[1] = (u16)((Freq >> XRFDC_NCO_FQWD_MID_SHIFT) & XRFDC_NCO_FQWD_MID_MASK);
+		HopPtr[Hop].FreqWord[2] = (u16)((Freq >> XRFDC_NCO_FQWD_UPP_SHIFT) & XRFDC_NCO_FQWD_UPP_MASK);
+
+		PhaseOffset = ((HopPtr[Hop].PhaseOffset * XRFDC_NCO_PHASE_MULTIPLIER) /
+			       XRFDC_MIXER_PHASE_OFFSET_UP_LIMIT);
+		HopPtr[Hop].PhaseWord[0] = (u16)PhaseOffset;
+		HopPtr[Hop].PhaseWord[1] = (u16)((PhaseOffset >> XRFDC_NCO_PHASE_UPP_SHIFT) & XRFDC_NCO_PHASE_UPP_MASK);
+	}
+
+	TablePtr->Type = Type;
+	TablePtr->Tile_Id = Tile_Id;
+	TablePtr->Block_Id = Block_Id;
+	TablePtr->EventSource = MixerConfigPtr->EventSource;
+	TablePtr->NumHops = NumHops;
+	TablePtr->HopPtr = HopPtr;
+
+	Status = XRFDC_SUCCESS;
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* The API loads one entry of a hop table into the NCO of the block. Only the
+* frequency and phase registers are written, from the precomputed words.
+* With the immediate event source the hop takes effect at once, otherwise it
+* takes effect on the next event of the source chosen with
+* XRFdc_SetMixerSettings(): XRFdc_UpdateEvent() for the slice and tile
+* sources, or the next SYSREF, marker or PL event.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    TablePtr is a pointer to a table built by XRFdc_BuildHopTable().
+* @param    HopIndex is the entry to be loaded.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if error occurs.
+*
+* @note     No status registers are read, so this can be called between
+*           XRFdc_BeginRegBatch() and XRFdc_CommitRegBatch().
+*
+******************************************************************************/
+u32 XRFdc_ArmHop(XRFdc *InstancePtr, const XRFdc_Hop_Table *TablePtr, u32 HopIndex)
+{
+	u32 Status;
+	u32 BaseAddr;
+	u32 Index;
+	u32 NoOfBlocks;
+	const XRFdc_Hop_Entry *HopPtr;
+	XRFdc_Mixer_Settings *MixerConfigPtr;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(TablePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XRFDC_COMPONENT_IS_READY);
+
+	if (HopIndex >= TablePtr->NumHops) {
+		metal_log(METAL_LOG_ERROR, "\n Invalid hop index (%u) for %s %u block %u in %s\r\n", HopIndex,
+			  (TablePtr->Type == XRFDC_ADC_TILE) ? "ADC" : "DAC", TablePtr->Tile_Id, TablePtr->Block_Id,
+			  __func__);
+		Status = XRFDC_FAILURE;
+		goto RETURN_PATH;
+	}
+	HopPtr = &TablePtr->HopPtr[HopIndex];
+
+	Index = TablePtr->Block_Id;
+	if ((XRFdc_IsHighSpeedADC(InstancePtr, TablePtr->Tile_Id) == 1) && (TablePtr->Type == XRFDC_ADC_TILE)) {
+		NoOfBlocks = XRFDC_NUM_OF_BLKS2;
+		if (TablePtr->Block_Id == XRFDC_BLK_ID1) {
+			Index = XRFDC_BLK_ID2;
+			NoOfBlocks = XRFDC_NUM_OF_BLKS4;
+		}
+	} else {
+		NoOfBlocks = TablePtr->Block_Id + 1U;
+	}
+
+	for (; Index < NoOfBlocks; Index++) {
+		BaseAddr = XRFDC_BLOCK_BASE(TablePtr->Type, TablePtr->Tile_Id, Index);
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_ADC_NCO_FQWD_LOW_OFFSET, HopPtr->FreqWord[0]);
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_ADC_NCO_FQWD_MID_OFFSET, HopPtr->FreqWord[1]);
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_ADC_NCO_FQWD_UPP_OFFSET, HopPtr->FreqWord[2]);
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_NCO_PHASE_LOW_OFFSET, HopPtr->PhaseWord[0]);
+		XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_NCO_PHASE_UPP_OFFSET, HopPtr->PhaseWord[1]);
+		if (TablePtr->EventSource == XRFDC_EVNT_SRC_IMMEDIATE) {
+			XRFdc_ClrSetReg(InstancePtr, BaseAddr,
+					(TablePtr->Type == XRFDC_ADC_TILE) ? XRFDC_ADC_UPDATE_DYN_OFFSET :
+									     XRFDC_DAC_UPDATE_DYN_OFFSET,
+					XRFDC_UPDT_EVNT_MASK, XRFDC_UPDT_EVNT_NCO_MASK);
+		}
+
+		if (TablePtr->Type == XRFDC_ADC_TILE) {
+			MixerConfigPtr =
+				&InstancePtr->ADC_Tile[TablePtr->Tile_Id].ADCBlock_Digital_Datapath[Index].Mixer_Settings;
+		} else {
+			MixerConfigPtr =
+				&InstancePtr->DAC_Tile[TablePtr->Tile_Id].DACBlock_Digital_Datapath[Index].Mixer_Settings;
+		}
+		MixerConfigPtr->Freq = HopPtr->Freq;
+		MixerConfigPtr->PhaseOffset = HopPtr->PhaseOffset;
+	}
+
+	Status = XRFDC_SUCCESS;
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* The API loads the same entry of several hop tables, e.g. one per block of
+* a multi-tile system, and then issues the update event of every tile or
+* slice that uses the tile or slice event source, so the hop takes effect on
+* all of them together. Tables using the SYSREF, marker or PL event source
+* are loaded and take effect on the next such event; this is the way to
+* hop synchronously across tiles.
+*
+* @param    InstancePtr is a pointer to the XRfdc instance.
+* @param    TablePtr is an array of NumTables tables built by
+*           XRFdc_BuildHopTable().
+* @param    NumTables is the number of tables.
+* @param    HopIndex is the entry to be loaded from every table.
+*
+* @return
+*           - XRFDC_SUCCESS if successful.
+*           - XRFDC_FAILURE if error occurs.
+*
+* @note     None.
+*
+******************************************************************************/
+u32 XRFdc_ArmHopMulti(XRFdc *InstancePtr, const XRFdc_Hop_Table *TablePtr, u32 NumTables, u32 HopIndex)
+{
+	u32 Status;
+	u32 Table;
+	u32 BaseAddr;
+	u32 TileMask = 0U;
+	u32 TileBit;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(TablePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XRFDC_COMPONENT_IS_READY);
+
+	for (Table = 0U; Table < NumTables; Table++) {
+		Status = XRFdc_ArmHop(InstancePtr, &TablePtr[Table], HopIndex);
+		if (Status != XRFDC_SUCCESS) {
+			goto RETURN_PATH;
+		}
+	}
+
+	for (Table = 0U; Table < NumTables; Table++) {
+		if (TablePtr[Table].EventSource == XRFDC_EVNT_SRC_SLICE) {
+			BaseAddr = XRFDC_BLOCK_BASE(TablePtr[Table].Type, TablePtr[Table].Tile_Id,
+						    TablePtr[Table].Block_Id);
+			XRFdc_WriteReg16(InstancePtr, BaseAddr,
+					 (TablePtr[Table].Type == XRFDC_ADC_TILE) ? XRFDC_ADC_UPDATE_DYN_OFFSET :
+										    XRFDC_DAC_UPDATE_DYN_OFFSET,
+					 0x1);
+		} else if (TablePtr[Table].EventSource == XRFDC_EVNT_SRC_TILE) {
+			TileBit = 1U << ((TablePtr[Table].Type * XRFDC_NUM_OF_TILES4) + TablePtr[Table].Tile_Id);
+			if ((TileMask & TileBit) != 0U) {
+				continue;
+			}
+			TileMask |= TileBit;
+			BaseAddr = ((TablePtr[Table].Type == XRFDC_ADC_TILE) ?
+					    XRFDC_ADC_TILE_DRP_ADDR(TablePtr[Table].Tile_Id) :
+					    XRFDC_DAC_TILE_DRP_ADDR(TablePtr[Table].Tile_Id)) +
+				   XRFDC_HSCOM_ADDR;
+			XRFdc_WriteReg16(InstancePtr, BaseAddr, XRFDC_HSCOM_UPDT_DYN_OFFSET, 0x1);
+		}
+	}
+
+	Status = XRFDC_SUCCESS;
+RETURN_PATH:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
 *
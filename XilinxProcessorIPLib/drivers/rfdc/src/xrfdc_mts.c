@@ -55,6 +55,8 @@
 *       cog    01/18/22 Added safety checks.
 *       cog    01/18/22 Add cast in XRFdc_MTS_Dtc_Calc.
 *       cog    01/18/22 Initialize DatapathMode in XRFdc_MTS_Latency.
+*       ag     10/15/26 Wait for the DAC SysRef capture disable of all tiles
+*                       at once when reading the markers.
 *
 * </pre>
 *
@@ -890,15 +892,22 @@ static u32 XRFdc_MTS_GetMarker(XRFdc *InstancePtr, u32 Type, u32 Tiles, XRFdc_MT
 	/* Allow the marker counter to run */
 	Status |= XRFdc_MTS_Sysref_Count(InstancePtr, Type, XRFDC_MTS_MARKER_COUNT);
 
-	/* Read master FIFO (FIFO0 in each Tile) */
-	for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
-		if (((1U << Tile_Id) & Tiles) != 0U) {
-			if (Type == XRFDC_DAC_TILE) {
-				/* Disable SysRef Capture before reading it */
+	if (Type == XRFDC_DAC_TILE) {
+		/*
+		 * Disable SysRef Capture of all tiles before reading them, then
+		 * wait once for the disable to take effect on all of them.
+		 */
+		for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+			if (((1U << Tile_Id) & Tiles) != 0U) {
 				XRFdc_MTS_Sysref_Ctrl(InstancePtr, XRFDC_DAC_TILE, Tile_Id, 0, 0, 0);
-				Status |= XRFdc_MTS_Sysref_Count(InstancePtr, Type, XRFDC_MTS_MARKER_COUNT);
 			}
+		}
+		Status |= XRFdc_MTS_Sysref_Count(InstancePtr, Type, XRFDC_MTS_MARKER_COUNT);
+	}
 
+	/* Read master FIFO (FIFO0 in each Tile) */
+	for (Tile_Id = XRFDC_TILE_ID0; Tile_Id < XRFDC_TILE_ID4; Tile_Id++) {
+		if (((1U << Tile_Id) & Tiles) != 0U) {
 			XRFdc_MTS_Marker_Read(InstancePtr, Type, Tile_Id, 0, &Count, &Loc, &Done);
 			MarkersPtr->Count[Tile_Id] = Count;
 			MarkersPtr->Loc[Tile_Id] = Loc;
@@ -144,6 +144,8 @@
 *                     This is fixed with this change.
 * 5.0   dp   04/25/22 Update XScuGic_GetPriorityTriggerType() to read and
 *                     update priority and trigger properly for GICv3.
+* 5.0   ag   10/14/26 Added XScuGic_SetDrainMode, XScuGic_GetIntrStats and
+*                     XScuGic_ResetIntrStats.
 * </pre>
 *
 ******************************************************************************/
@@ -411,6 +413,10 @@ s32  XScuGic_CfgInitialize(XScuGic *InstancePtr,
 
 		InstancePtr->IsReady = 0U;
 		InstancePtr->Config = ConfigPtr;
+		InstancePtr->DrainMode = 0U;
+#if defined (XSCUGIC_INTR_STATS)
+		XScuGic_ResetIntrStats(InstancePtr);
+#endif
 		#if defined(ARMR52)
 		/* Read Distributor base address through IMP_CBAR register */
 		ConfigPtr->DistBaseAddress = mfcp(XREG_IMP_CBAR);
@@ -1314,6 +1320,79 @@ u8 XScuGic_IsInitialized(u32 DeviceId)
 
 	return Device_Initilaized;
 }
+
+/****************************************************************************/
+/**
+* This function enables or disables the drain mode of
+* XScuGic_InterruptHandler. In drain mode the handler keeps acknowledging
+* and servicing pending interrupts, up to XSCUGIC_DRAIN_MAX_INTR, before
+* returning, instead of taking a new exception for every interrupt.
+*
+* @param	InstancePtr is a pointer to the XScuGic instance.
+* @param	Enable is 1 to enable the drain mode and 0 to disable it.
+*
+* @return	None.
+*
+* @note		Drain mode is disabled by default.
+*
+*****************************************************************************/
+void XScuGic_SetDrainMode(XScuGic *InstancePtr, u32 Enable)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	InstancePtr->DrainMode = (Enable != 0U) ? 1U : 0U;
+}
+
+#if defined (XSCUGIC_INTR_STATS)
+/****************************************************************************/
+/**
+* This function returns the statistics of an interrupt: the number of times
+* its handler was called and the longest handler execution in CPU cycles.
+*
+* @param	InstancePtr is a pointer to the XScuGic instance.
+* @param	Int_Id contains the ID of the interrupt source.
+* @param	StatsPtr is a pointer to the statistics to be filled in.
+*
+* @return	None.
+*
+* @note		Handler execution time is read from the PMU cycle counter,
+*		which has to be enabled by the application. MaxCycles stays 0
+*		for compilers without cycle counter access.
+*
+*****************************************************************************/
+void XScuGic_GetIntrStats(XScuGic *InstancePtr, u32 Int_Id,
+				XScuGic_IntrStats *StatsPtr)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(Int_Id < XSCUGIC_MAX_NUM_INTR_INPUTS);
+	Xil_AssertVoid(StatsPtr != NULL);
+
+	*StatsPtr = InstancePtr->IntrStats[Int_Id];
+}
+
+/****************************************************************************/
+/**
+* This function clears the statistics of all interrupts.
+*
+* @param	InstancePtr is a pointer to the XScuGic instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+void XScuGic_ResetIntrStats(XScuGic *InstancePtr)
+{
+	u32 Int_Id;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	for (Int_Id = 0U; Int_Id < XSCUGIC_MAX_NUM_INTR_INPUTS; Int_Id++) {
+		InstancePtr->IntrStats[Int_Id].Hits = 0U;
+		InstancePtr->IntrStats[Int_Id].MaxCycles = 0U;
+	}
+}
+#endif
 #if defined (GICv3)
 /****************************************************************************/
 /**
@@ -179,6 +179,10 @@
 *                     XScuGic_Get_Rdist_Int_Trigger_Index
 * 5.0   dp   11/07/22 Add macros for accessing the GIC Binary Point and
 *                     Running Priority registers of Cortex-R52.
+* 5.0   ag   10/14/26 Added drain mode to service interrupt bursts with a
+*                     single exception entry, and per-interrupt hit and
+*                     handler cycle statistics when XSCUGIC_INTR_STATS is
+*                     defined.
 * </pre>
 *
 ******************************************************************************/
@@ -208,6 +212,14 @@ extern "C" {
 #define ARMA9
 #endif
 
+/*
+ * Maximum number of interrupts serviced by one call of
+ * XScuGic_InterruptHandler in drain mode.
+ */
+#ifndef XSCUGIC_DRAIN_MAX_INTR
+#define XSCUGIC_DRAIN_MAX_INTR	16U
+#endif
+
 #define XSCUGIC500_DCTLR_ARE_NS_ENABLE  0x20
 #define XSCUGIC500_DCTLR_ARE_S_ENABLE  0x10
 /**************************** Type Definitions *******************************/
@@ -234,6 +246,15 @@ typedef struct
 				 Vector table of interrupt handlers */
 } XScuGic_Config;
 
+/**
+ * Per-interrupt statistics, collected when XSCUGIC_INTR_STATS is defined.
+ */
+typedef struct
+{
+	u32 Hits;		/**< Number of times the handler was called */
+	u32 MaxCycles;		/**< Longest handler execution in CPU cycles */
+} XScuGic_IntrStats;
+
 /**
  * The XScuGic driver instance data. The user is required to allocate a
  * variable of this type for every intc device in the system. A pointer
@@ -244,6 +265,11 @@ typedef struct
 	XScuGic_Config *Config;  /**< Configuration table entry */
 	u32 IsReady;		 /**< Device is initialized and ready */
 	u32 UnhandledInterrupts; /**< Intc Statistics */
+	u32 DrainMode;		 /**< Service pending interrupts back to back */
+#if defined (XSCUGIC_INTR_STATS)
+	XScuGic_IntrStats IntrStats[XSCUGIC_MAX_NUM_INTR_INPUTS]; /**<
+				 Per-interrupt statistics */
+#endif
 } XScuGic;
 
 /************************** Variable Definitions *****************************/
@@ -633,6 +659,12 @@ void XScuGic_Stop(XScuGic *InstancePtr);
 void XScuGic_SetCpuID(u32 CpuCoreId);
 u32 XScuGic_GetCpuID(void);
 u8 XScuGic_IsInitialized(u32 DeviceId);
+void XScuGic_SetDrainMode(XScuGic *InstancePtr, u32 Enable);
+#if defined (XSCUGIC_INTR_STATS)
+void XScuGic_GetIntrStats(XScuGic *InstancePtr, u32 Int_Id,
+				XScuGic_IntrStats *StatsPtr);
+void XScuGic_ResetIntrStats(XScuGic *InstancePtr);
+#endif
 /*
  * Initialization functions in xscugic_sinit.c
  */
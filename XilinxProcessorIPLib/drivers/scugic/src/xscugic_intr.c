@@ -40,6 +40,9 @@
 *                     reported by coverity tool. It fixes CR#1006344.
 * 3.10  mus  07/17/18 Updated file to fix the various coding style issues
 *                     reported by checkpatch. It fixes CR#1006344.
+* 5.0   ag   10/14/26 Record interrupt entry and exit with XIL_TRACE.
+* 5.0   ag   10/14/26 Added drain mode and per-interrupt statistics to
+*                     XScuGic_InterruptHandler.
 *
 * </pre>
 *
@@ -59,6 +62,7 @@
 #include "xil_types.h"
 #include "xil_assert.h"
 #include "xscugic.h"
+#include "xil_trace.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -66,6 +70,20 @@
 
 /***************** Macros (Inline Functions) Definitions *********************/
 
+#if defined (XSCUGIC_INTR_STATS)
+/*
+ * Cycle counter used to time the handlers, it has to be enabled by the
+ * application, for example with the Xpm_* APIs or Xil_TraceInit.
+ */
+#if defined (__aarch64__)
+#define XScuGic_CycleCount()	((u32)mfcp(PMCCNTR_EL0))
+#elif defined (__GNUC__)
+#define XScuGic_CycleCount()	((u32)mfcp(XREG_CP15_PERF_CYCLE_COUNTER))
+#else
+#define XScuGic_CycleCount()	(0U)
+#endif
+#endif
+
 /************************** Function Prototypes ******************************/
 
 /************************** Variable Definitions *****************************/
@@ -99,11 +117,24 @@ void XScuGic_InterruptHandler(XScuGic *InstancePtr)
 	    u32 IntIDFull;
 #endif
 	    XScuGic_VectorTableEntry *TablePtr;
+	    u32 NumServiced = 0U;
+#if defined (XSCUGIC_INTR_STATS)
+	    u32 StartCycles;
+	    u32 Cycles;
+#endif
 
 	    /* Assert that the pointer to the instance is valid
 	     */
 	    Xil_AssertVoid(InstancePtr != NULL);
 
+	    /*
+	     * In drain mode keep acknowledging interrupts until the spurious
+	     * ID is returned, so that a burst is serviced with a single
+	     * exception entry. The GIC returns the highest priority pending
+	     * interrupt on every read, so the handlers still run in priority
+	     * order.
+	     */
+	    do {
 	    /*
 	     * Read the int_ack register to identify the highest priority
 	     * interrupt ID and make sure it is valid. Reading Int_Ack will
@@ -139,10 +170,36 @@ void XScuGic_InterruptHandler(XScuGic *InstancePtr)
 	     * based on the IRQSource. A software trigger is cleared by
 	     *.the ACK.
 	     */
+	    XIL_TRACE(XIL_TRACE_EVT_SCUGIC_IRQ_ENTRY, InterruptID, 0U);
+#if defined (XSCUGIC_INTR_STATS)
+	    StartCycles = XScuGic_CycleCount();
+#endif
 	    TablePtr = &(InstancePtr->Config->HandlerTable[InterruptID]);
 		if (TablePtr != NULL) {
 			TablePtr->Handler(TablePtr->CallBackRef);
 		}
+#if defined (XSCUGIC_INTR_STATS)
+	    Cycles = XScuGic_CycleCount() - StartCycles;
+	    InstancePtr->IntrStats[InterruptID].Hits++;
+	    if (Cycles > InstancePtr->IntrStats[InterruptID].MaxCycles) {
+		InstancePtr->IntrStats[InterruptID].MaxCycles = Cycles;
+	    }
+#endif
+	    XIL_TRACE(XIL_TRACE_EVT_SCUGIC_IRQ_EXIT, InterruptID, 0U);
+
+	    /*
+	     * Write to the EOI register, we are all done here.
+	     */
+#if defined (GICv3)
+	   XScuGic_ack_Int(InterruptID);
+#else
+	    XScuGic_CPUWriteReg(InstancePtr, XSCUGIC_EOI_OFFSET, IntIDFull);
+#endif
+	    NumServiced++;
+	    } while ((InstancePtr->DrainMode != 0U) &&
+		     (NumServiced < XSCUGIC_DRAIN_MAX_INTR));
+
+	    return;
 
 IntrExit:
 	    /*
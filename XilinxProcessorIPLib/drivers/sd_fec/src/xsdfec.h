@@ -32,6 +32,9 @@
  * - XSdFecadd_ldpc_params(InstancePtr, CodeId, SCOffset, LAOffset, QCOffset, ParamsPtr) - Add LDPC parameters to a device
  * - XSdFecShareTableSize(ParamsPtr, SCSizePtr, LASizePtr, QCSizePtr)                    - Calculate share table size for a LDPC code
  * - XSdFecInterruptClassifier(InstancePtr)                                              - Classify interrupts
+ * - XSdFecJobQueueInit(QueuePtr, InstancePtr, Type, SubmitHandler, SubmitRef)           - Initialize a job queue
+ * - XSdFecJobSubmit(QueuePtr, JobPtr, NumJobs)                                          - Submit a batch of code blocks
+ * - XSdFecJobComplete(QueuePtr, StatusPtr, NumStatus, ResultPtr)                        - Complete a batch of code blocks
  *
  * In addition, the driver provides set and get functions for all the individual registers defined for the SD-FEC.
  *
@@ -116,6 +119,35 @@ typedef struct {
   u16 Scale;
 } XSdFecTurboParameters;
 
+/** \brief Job queue depth
+ *
+ * Maximum number of code blocks outstanding in a job queue
+ */
+#define XSDFEC_JOB_QUEUE_DEPTH 64
+
+// Job types
+#define XSDFEC_JOB_LDPC  0
+#define XSDFEC_JOB_TURBO 1
+
+// Job flags, LDPC only
+#define XSDFEC_JOB_FLAG_HARD_OP           0x1 // Output hard decisions
+#define XSDFEC_JOB_FLAG_INCLUDE_PARITY_OP 0x2 // Include parity bits in output
+#define XSDFEC_JOB_FLAG_TERM_ON_PASS      0x4 // Stop when all parity checks pass
+#define XSDFEC_JOB_FLAG_TERM_ON_NO_CHANGE 0x8 // Stop when hard decisions do not change
+#define XSDFEC_JOB_FLAG_MASK              0xF
+
+// Control stream word fields
+#define XSDFEC_CTRL_LDPC_CODE_LSB                 0 // LSB for LDPC code number field
+#define XSDFEC_CTRL_LDPC_CODE_MASK       0x0000007f // Bit mask for LDPC code number field
+#define XSDFEC_CTRL_LDPC_FLAGS_LSB               14 // LSB for LDPC job flags, in XSDFEC_JOB_FLAG_* order
+#define XSDFEC_CTRL_LDPC_FLAGS_MASK      0x0003c000 // Bit mask for LDPC job flags
+#define XSDFEC_CTRL_LDPC_MAX_ITERATIONS_LSB      18 // LSB for LDPC maximum iterations field
+#define XSDFEC_CTRL_LDPC_MAX_ITERATIONS_MASK 0x00fc0000 // Bit mask for LDPC maximum iterations field
+#define XSDFEC_CTRL_TURBO_BLOCK_SIZE_LSB          0 // LSB for Turbo block size field
+#define XSDFEC_CTRL_TURBO_BLOCK_SIZE_MASK 0x00007fff // Bit mask for Turbo block size field
+#define XSDFEC_CTRL_ID_LSB                       24 // LSB for block ID field
+#define XSDFEC_CTRL_ID_MASK              0xff000000 // Bit mask for block ID field
+
 /// Default MaxScale Turbo configuration
 #define XSDFEC_TD_PARAM_MAX_DEFAULT     { 0 , 12 }
 /// Default MaxScale Turbo configuration
@@ -134,6 +166,71 @@ typedef struct {
   u8 ReCfgReq;     /**< FPGA requires reprogrammed                        */
 } XSdFecInterruptClass;
 
+/** \brief Code block job
+ *
+ * Describes one code block submitted to a job queue
+ */
+typedef struct {
+  u32     CodeId;        /**< LDPC code number, not used for Turbo      */
+  u32     BlockSize;     /**< Turbo block size, not used for LDPC       */
+  u32     Flags;         /**< XSDFEC_JOB_FLAG_* values, LDPC only       */
+  u32     MaxIterations; /**< LDPC maximum iterations                   */
+  UINTPTR DinAddr;       /**< Input data buffer                         */
+  u32     DinLen;        /**< Input data length in bytes                */
+  UINTPTR DoutAddr;      /**< Output data buffer                        */
+  u32     DoutLen;       /**< Output data length in bytes               */
+  void   *UserData;      /**< Returned with the job result              */
+} XSdFecJob;
+
+/** \brief Code block descriptor
+ *
+ * Control word and data buffers of one queued code block. The control word
+ * stays in place until the block completes and can be used as the source of
+ * the CTRL stream DMA transfer.
+ */
+typedef struct {
+  u32     Ctrl;          /**< Control stream word                       */
+  UINTPTR DinAddr;       /**< Input data buffer                         */
+  u32     DinLen;        /**< Input data length in bytes                */
+  UINTPTR DoutAddr;      /**< Output data buffer                        */
+  u32     DoutLen;       /**< Output data length in bytes               */
+  void   *UserData;      /**< Returned with the job result              */
+} XSdFecJobDesc;
+
+/** \brief Code block result
+ *
+ * Returned for each completed code block
+ */
+typedef struct {
+  void *UserData;        /**< UserData of the job                       */
+  u32   Ctrl;            /**< Control word the block was submitted with */
+  u32   Status;          /**< Status stream word of the block           */
+} XSdFecJobResult;
+
+/** \brief Job submit handler
+ *
+ * Called with a batch of consecutive descriptors. The handler queues one
+ * CTRL, DIN and DOUT (and STATUS) transfer per descriptor with the DMA
+ * engine feeding the device, e.g. AXI DMA or AXI MCDMA buffer descriptors,
+ * and returns XST_SUCCESS when all of them are queued.
+ */
+typedef int (*XSdFecJobSubmitHandler)(void *CallbackRef, XSdFecJobDesc *DescPtr, u32 NumDesc);
+
+/** \brief Job queue
+ *
+ * Contains the code blocks submitted to a device and not yet completed
+ */
+typedef struct {
+  XSdFec                 *FecPtr;        /**< Device the queue feeds          */
+  u32                     Type;          /**< XSDFEC_JOB_LDPC or _TURBO       */
+  XSdFecJobSubmitHandler  SubmitHandler; /**< DMA submit handler              */
+  void                   *SubmitRef;     /**< Passed to SubmitHandler         */
+  XSdFecJobDesc           Desc[XSDFEC_JOB_QUEUE_DEPTH]; /**< Descriptor ring  */
+  u32                     Head;          /**< Oldest outstanding descriptor   */
+  u32                     Count;         /**< Outstanding descriptors         */
+  u32                     NextId;        /**< ID of the next block            */
+} XSdFecJobQueue;
+
 // API Function Prototypes
 /** \brief Device initialization
  *
@@ -204,6 +301,55 @@ void XSdFecShareTableSize(const XSdFecLdpcParameters* ParamsPtr, u32* SCSizePtr,
  */
 XSdFecInterruptClass XSdFecInterruptClassifier(XSdFec *InstancePtr);
 
+/**\brief Initialize a job queue
+ *
+ * Initializes an empty job queue for a device. Blocks submitted to the queue are handed to SubmitHandler in batches.
+ *
+ * NOTE: LDPC jobs use the code numbers added with XSdFecAddLdpcParams, so the queue only supports LDPC on devices not
+ * configured for the 5G NR standard.
+ *
+ * @param QueuePtr      Pointer to job queue struct
+ * @param InstancePtr   Pointer to device instance struct
+ * @param Type          XSDFEC_JOB_LDPC or XSDFEC_JOB_TURBO
+ * @param SubmitHandler Handler queuing the DMA transfers of a batch of descriptors
+ * @param SubmitRef     Passed to SubmitHandler
+ */
+void XSdFecJobQueueInit(XSdFecJobQueue *QueuePtr, XSdFec *InstancePtr, u32 Type, XSdFecJobSubmitHandler SubmitHandler, void *SubmitRef);
+
+/**\brief Submit code blocks
+ *
+ * Builds the control word of each job and hands the descriptors to the submit handler, in at most two calls when
+ * the batch wraps around the descriptor ring. When the second call fails, the jobs of the first call stay outstanding.
+ *
+ * @param QueuePtr  Pointer to job queue struct
+ * @param JobPtr    Array of jobs
+ * @param NumJobs   Number of jobs in JobPtr
+ *
+ * @returns XST_SUCCESS if all jobs are queued, XST_FAILURE if the queue is full or the submit handler failed
+ */
+int XSdFecJobSubmit(XSdFecJobQueue *QueuePtr, const XSdFecJob *JobPtr, u32 NumJobs);
+
+/**\brief Complete code blocks
+ *
+ * Retires the oldest outstanding blocks, one per status stream word. The device completes blocks in submission order.
+ *
+ * @param QueuePtr  Pointer to job queue struct
+ * @param StatusPtr Array of status stream words
+ * @param NumStatus Number of words in StatusPtr
+ * @param ResultPtr Array populated with one result per retired block
+ *
+ * @returns Number of retired blocks
+ */
+u32 XSdFecJobComplete(XSdFecJobQueue *QueuePtr, const u32 *StatusPtr, u32 NumStatus, XSdFecJobResult *ResultPtr);
+
+/**\brief Get outstanding code blocks
+ *
+ * @param QueuePtr  Pointer to job queue struct
+ *
+ * @returns Number of submitted blocks not yet completed
+ */
+u32 XSdFecJobPending(const XSdFecJobQueue *QueuePtr);
+
 // Base API Function Prototypes
 /**
  * CORE_AXI_WR_PROTECT access functions
@@ -0,0 +1,114 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/***************************** Include Files *********************************/
+#include "xsdfec.h"
+#include "xil_cache.h"
+
+/************************** Function Prototypes *****************************/
+static int XSdFecJobSubmitRange(XSdFecJobQueue *QueuePtr, u32 First, u32 Num);
+
+/************************** Function Implementation *************************/
+void XSdFecJobQueueInit(XSdFecJobQueue *QueuePtr, XSdFec *InstancePtr, u32 Type, XSdFecJobSubmitHandler SubmitHandler, void *SubmitRef) {
+  Xil_AssertVoid(QueuePtr      != NULL);
+  Xil_AssertVoid(InstancePtr   != NULL);
+  Xil_AssertVoid(SubmitHandler != NULL);
+  Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+  Xil_AssertVoid(Type == XSDFEC_JOB_LDPC || Type == XSDFEC_JOB_TURBO);
+  Xil_AssertVoid(Type == XSDFEC_JOB_TURBO || InstancePtr->Standard == XSDFEC_STANDARD_OTHER);
+
+  QueuePtr->FecPtr        = InstancePtr;
+  QueuePtr->Type          = Type;
+  QueuePtr->SubmitHandler = SubmitHandler;
+  QueuePtr->SubmitRef     = SubmitRef;
+  QueuePtr->Head          = 0;
+  QueuePtr->Count         = 0;
+  QueuePtr->NextId        = 0;
+}
+
+int XSdFecJobSubmit(XSdFecJobQueue *QueuePtr, const XSdFecJob *JobPtr, u32 NumJobs) {
+  Xil_AssertNonvoid(QueuePtr != NULL);
+  Xil_AssertNonvoid(JobPtr   != NULL);
+
+  if (NumJobs > XSDFEC_JOB_QUEUE_DEPTH - QueuePtr->Count) {
+    return XST_FAILURE;
+  }
+
+  // Build the descriptors behind the outstanding ones
+  u32 first = (QueuePtr->Head + QueuePtr->Count) % XSDFEC_JOB_QUEUE_DEPTH;
+  u32 id    = QueuePtr->NextId;
+  for (u32 i = 0; i < NumJobs; i++) {
+    XSdFecJobDesc* desc = &QueuePtr->Desc[(first + i) % XSDFEC_JOB_QUEUE_DEPTH];
+    u32 ctrl = XSDFEC_CTRL_ID_MASK & (id << XSDFEC_CTRL_ID_LSB);
+    if (QueuePtr->Type == XSDFEC_JOB_LDPC) {
+      Xil_AssertNonvoid(JobPtr[i].CodeId < 128);
+      ctrl |= (XSDFEC_CTRL_LDPC_CODE_MASK           & (JobPtr[i].CodeId                          << XSDFEC_CTRL_LDPC_CODE_LSB));
+      ctrl |= (XSDFEC_CTRL_LDPC_FLAGS_MASK          & ((JobPtr[i].Flags & XSDFEC_JOB_FLAG_MASK) << XSDFEC_CTRL_LDPC_FLAGS_LSB));
+      ctrl |= (XSDFEC_CTRL_LDPC_MAX_ITERATIONS_MASK & (JobPtr[i].MaxIterations                   << XSDFEC_CTRL_LDPC_MAX_ITERATIONS_LSB));
+    } else {
+      ctrl |= (XSDFEC_CTRL_TURBO_BLOCK_SIZE_MASK    & (JobPtr[i].BlockSize                       << XSDFEC_CTRL_TURBO_BLOCK_SIZE_LSB));
+    }
+    desc->Ctrl     = ctrl;
+    desc->DinAddr  = JobPtr[i].DinAddr;
+    desc->DinLen   = JobPtr[i].DinLen;
+    desc->DoutAddr = JobPtr[i].DoutAddr;
+    desc->DoutLen  = JobPtr[i].DoutLen;
+    desc->UserData = JobPtr[i].UserData;
+    id = (id + 1) & (XSDFEC_CTRL_ID_MASK >> XSDFEC_CTRL_ID_LSB);
+  }
+
+  // Hand the batch over in contiguous ranges of the ring
+  u32 num = NumJobs;
+  if (first + num > XSDFEC_JOB_QUEUE_DEPTH) {
+    num = XSDFEC_JOB_QUEUE_DEPTH - first;
+  }
+  if (num && XSdFecJobSubmitRange(QueuePtr, first, num) != XST_SUCCESS) {
+    return XST_FAILURE;
+  }
+  if (NumJobs > num && XSdFecJobSubmitRange(QueuePtr, 0, NumJobs - num) != XST_SUCCESS) {
+    // The first range is queued, keep it outstanding
+    QueuePtr->Count  += num;
+    QueuePtr->NextId  = (QueuePtr->NextId + num) & (XSDFEC_CTRL_ID_MASK >> XSDFEC_CTRL_ID_LSB);
+    return XST_FAILURE;
+  }
+
+  QueuePtr->Count  += NumJobs;
+  QueuePtr->NextId  = id;
+
+  return XST_SUCCESS;
+}
+
+u32 XSdFecJobComplete(XSdFecJobQueue *QueuePtr, const u32 *StatusPtr, u32 NumStatus, XSdFecJobResult *ResultPtr) {
+  Xil_AssertNonvoid(QueuePtr  != NULL);
+  Xil_AssertNonvoid(StatusPtr != NULL || NumStatus == 0);
+  Xil_AssertNonvoid(ResultPtr != NULL || NumStatus == 0);
+
+  if (NumStatus > QueuePtr->Count) {
+    NumStatus = QueuePtr->Count;
+  }
+  for (u32 i = 0; i < NumStatus; i++) {
+    const XSdFecJobDesc* desc = &QueuePtr->Desc[QueuePtr->Head];
+    ResultPtr[i].UserData = desc->UserData;
+    ResultPtr[i].Ctrl     = desc->Ctrl;
+    ResultPtr[i].Status   = StatusPtr[i];
+    QueuePtr->Head = (QueuePtr->Head + 1) % XSDFEC_JOB_QUEUE_DEPTH;
+  }
+  QueuePtr->Count -= NumStatus;
+
+  return NumStatus;
+}
+
+u32 XSdFecJobPending(const XSdFecJobQueue *QueuePtr) {
+  Xil_AssertNonvoid(QueuePtr != NULL);
+  return QueuePtr->Count;
+}
+
+static int XSdFecJobSubmitRange(XSdFecJobQueue *QueuePtr, u32 First, u32 Num) {
+  XSdFecJobDesc* desc = &QueuePtr->Desc[First];
+  // The CTRL stream DMA reads the control words from memory
+  Xil_DCacheFlushRange((UINTPTR)desc, Num * sizeof(XSdFecJobDesc));
+  return QueuePtr->SubmitHandler(QueuePtr->SubmitRef, desc, Num);
+}
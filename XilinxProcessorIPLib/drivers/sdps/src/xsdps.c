@@ -89,6 +89,10 @@
 * 4.0   sk     02/25/22 Add support for eMMC5.1.
 *       sk     04/07/22 Add support to read custom tap delay values from design
 *                       for SD/eMMC.
+*       ag     10/14/26 Initialize the request queue.
+*
+*       ag     10/15/26 Register the performance counters and count the
+*                       transfers and transfer time of the polled APIs.
 *
 * </pre>
 *
@@ -181,6 +185,10 @@ s32 XSdPs_CfgInitialize(XSdPs *InstancePtr, XSdPs_Config *ConfigPtr,
 	InstancePtr->IsBusy = FALSE;
 	InstancePtr->BlkSize = 0U;
 	InstancePtr->IsTuningDone = 0U;
+	InstancePtr->ReqHead = NULL;
+	InstancePtr->ReqTail = NULL;
+	XIL_PERF_STATS_REGISTER(&InstancePtr->Stats, "sdps",
+				InstancePtr->Config.BaseAddress);
 
 	/* Host Controller version is read. */
 	InstancePtr->HC_Version =
@@ -327,18 +335,24 @@ s32 XSdPs_ReadPolled(XSdPs *InstancePtr, u32 Arg, u32 BlkCnt, u8 *Buff)
 	}
 
 	/* Read from the card */
+	XIL_PERF_STATS_BUSY_BEGIN(&InstancePtr->Stats);
 	Status = XSdPs_Read(InstancePtr, Arg, BlkCnt, Buff);
 	if (Status != XST_SUCCESS) {
+		XIL_PERF_STATS_ERROR(&InstancePtr->Stats);
 		Status = XST_FAILURE;
 		goto RETURN_PATH;
 	}
 
 	/* Check for transfer done */
 	Status = XSdps_CheckTransferDone(InstancePtr);
+	XIL_PERF_STATS_BUSY_END(&InstancePtr->Stats);
 	if (Status != XST_SUCCESS) {
+		XIL_PERF_STATS_ERROR(&InstancePtr->Stats);
 		Status = XST_FAILURE;
 		goto RETURN_PATH;
 	}
+	XIL_PERF_STATS_OPS(&InstancePtr->Stats, 1U,
+			   (u64)BlkCnt * InstancePtr->BlkSize);
 
 	if (InstancePtr->Config.IsCacheCoherent == 0U) {
 		Xil_DCacheInvalidateRange((INTPTR)Buff,
@@ -393,18 +407,24 @@ s32 XSdPs_WritePolled(XSdPs *InstancePtr, u32 Arg, u32 BlkCnt, const u8 *Buff)
 	}
 
 	/* Write to the card */
+	XIL_PERF_STATS_BUSY_BEGIN(&InstancePtr->Stats);
 	Status = XSdPs_Write(InstancePtr, Arg, BlkCnt, Buff);
 	if (Status != XST_SUCCESS) {
+		XIL_PERF_STATS_ERROR(&InstancePtr->Stats);
 		Status = XST_FAILURE;
 		goto RETURN_PATH;
 	}
 
 	/* Check for transfer done */
 	Status = XSdps_CheckTransferDone(InstancePtr);
+	XIL_PERF_STATS_BUSY_END(&InstancePtr->Stats);
 	if (Status != XST_SUCCESS) {
+		XIL_PERF_STATS_ERROR(&InstancePtr->Stats);
 		Status = XST_FAILURE;
 		goto RETURN_PATH;
 	}
+	XIL_PERF_STATS_OPS(&InstancePtr->Stats, 1U,
+			   (u64)BlkCnt * InstancePtr->BlkSize);
 
 RETURN_PATH:
 #if defined  (XCLOCKING)
@@ -63,8 +63,19 @@
 * descriptor table and hence care will have to be taken to call read/write
 * API's in a loop for large file sizes.
 *
-* Interrupt mode is not supported because it offers no improvement when used
-* with file system.
+* <b>Interrupt driven transfers</b>
+*
+* Block reads and writes can also be queued with XSdPs_SubmitReq(), any
+* number of them, and complete from XSdPs_IntrHandler(), which the
+* application connects to the interrupt controller. The handler of each
+* request is called from the interrupt handler once its transfer is done,
+* and the next queued request is started from there, so the caller does not
+* wait for the data phase of a transfer. The queue is in software, the SD
+* host controllers supported by this driver have no command queue engine
+* (CQE) for eMMC 5.1 command queuing.
+*
+* While requests are queued the polled and non-blocking transfer APIs
+* return XST_FAILURE, and no other API of the driver may be called.
 *
 * <b>eMMC support</b>
 *
@@ -156,6 +167,10 @@
 *       sk     04/07/22 Add support to read custom tap delay values from design
 *                       for SD/eMMC.
 *       sk     06/03/22 Fix issue in internal clock divider calculation logic.
+*       ag     10/14/26 Added the interrupt driven request queue,
+*                       XSdPs_SubmitReq() and XSdPs_IntrHandler().
+*       ag     10/15/26 Added the Stats performance counters, enabled with
+*                       XIL_PERF_STATS_ENABLE.
 *
 * </pre>
 *
@@ -171,6 +186,7 @@ extern "C" {
 
 #include "xil_printf.h"
 #include "xil_cache.h"
+#include "xil_perfstats.h"
 #include "xstatus.h"
 #include "xsdps_hw.h"
 #include "xplatform_info.h"
@@ -232,6 +248,13 @@ extern "C" {
 
 /** @} */
 
+/** @name Request directions
+ * @{
+ */
+#define XSDPS_REQ_READ		0U	/**< Read blocks from the card */
+#define XSDPS_REQ_WRITE		1U	/**< Write blocks to the card */
+/** @} */
+
 /**************************** Type Definitions *******************************/
 
 /**
@@ -287,6 +310,30 @@ typedef struct {
 }  __attribute__((__packed__))XSdPs_Adma2Descriptor64;
 #endif
 
+struct XSdPs_Req_s;
+
+/**
+ * Completion handler of a request, called from XSdPs_IntrHandler() with
+ * the Status of the request set.
+ */
+typedef void (*XSdPs_ReqHandler)(void *CallBackRef,
+				 struct XSdPs_Req_s *ReqPtr);
+
+/**
+ * A block read or write for XSdPs_SubmitReq(). The request belongs to the
+ * driver from its submission until its handler is called.
+ */
+typedef struct XSdPs_Req_s {
+	struct XSdPs_Req_s *Next;	/**< Next queued request, driver use */
+	u32 Arg;		/**< Address, as passed to XSdPs_ReadPolled() */
+	u32 BlkCnt;		/**< Number of blocks */
+	u8 *Buff;		/**< Data buffer */
+	u8 Dir;			/**< XSDPS_REQ_READ or XSDPS_REQ_WRITE */
+	s32 Status;		/**< XST_SUCCESS or XST_FAILURE once done */
+	XSdPs_ReqHandler Handler;	/**< Completion handler */
+	void *CallBackRef;	/**< Argument of the handler */
+} XSdPs_Req;
+
 /**
  * The XSdPs driver instance data. The user is required to allocate a
  * variable of this type for every SD device in the system. A pointer
@@ -318,6 +365,11 @@ typedef struct {
 	u8  IsBusy;			/**< Busy Flag*/
 	u32 BlkSize;		/**< Block Size*/
 	u8  IsTuningDone;	/**< Flag to indicate HS200 tuning complete */
+	XSdPs_Req *ReqHead;	/**< Queued requests, the head is in flight */
+	XSdPs_Req *ReqTail;	/**< Last queued request */
+#ifdef XIL_PERF_STATS_ENABLE
+	Xil_PerfStats Stats;	/**< Performance counters */
+#endif
 } XSdPs;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -362,6 +414,8 @@ s32 XSdPs_CheckReadTransfer(XSdPs *InstancePtr);
 s32 XSdPs_StartWriteTransfer(XSdPs *InstancePtr, u32 Arg, u32 BlkCnt, u8 *Buff);
 s32 XSdPs_CheckWriteTransfer(XSdPs *InstancePtr);
 s32 XSdPs_Erase(XSdPs *InstancePtr, u32 StartAddr, u32 EndAddr);
+s32 XSdPs_SubmitReq(XSdPs *InstancePtr, XSdPs_Req *ReqPtr);
+void XSdPs_IntrHandler(void *InstancePtr);
 
 #ifdef __cplusplus
 }
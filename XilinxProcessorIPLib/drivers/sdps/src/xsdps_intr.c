@@ -0,0 +1,305 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xsdps_intr.c
+* @addtogroup sdps Overview
+* @{
+*
+* The xsdps_intr.c file contains the interrupt driven request queue of the
+* XSdPs driver.
+*
+* Requests are queued in software and run one at a time. The command of a
+* request is sent and its response polled as in the polled APIs, which
+* takes microseconds; the data phase completes with the transfer complete
+* or error interrupt. The interrupt signals of the controller are enabled
+* only while requests are queued, so the polled APIs keep working once the
+* queue is empty.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ---    -------- -----------------------------------------------
+* 4.0   ag     10/14/26 First release
+*       ag     10/15/26 Count interrupts and completed requests in the
+*                       performance counters.
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xsdps_core.h"
+
+/************************** Constant Definitions *****************************/
+
+/** Normal interrupt signals of a request in flight */
+#define XSDPS_REQ_NORM_INTR_MASK	(XSDPS_INTR_TC_MASK | XSDPS_INTR_ERR_MASK)
+
+/************************** Function Prototypes ******************************/
+static s32 XSdPs_StartReq(XSdPs *InstancePtr, XSdPs_Req *ReqPtr);
+static void XSdPs_CompleteReq(XSdPs *InstancePtr, s32 Status);
+static void XSdPs_StartNextReq(XSdPs *InstancePtr);
+static void XSdPs_SetReqIntr(XSdPs *InstancePtr, u8 Enable);
+
+/*****************************************************************************/
+/**
+* @brief
+* This function queues a block read or write. The request is started when
+* the requests queued before it are done, its handler is called from
+* XSdPs_IntrHandler() when it is done.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+* @param	ReqPtr is the request, with Arg, BlkCnt, Buff, Dir, Handler and
+*		CallBackRef set. The buffer must not be accessed until the
+*		handler is called.
+*
+* @return
+* 		- XST_SUCCESS if the request is queued
+* 		- XST_DEVICE_BUSY if a polled or non-blocking transfer is in
+* 		progress
+* 		- XST_FAILURE if the request could not be started, its
+* 		handler is not called
+*
+* @note		This function can be called from the handler of a request.
+*
+******************************************************************************/
+s32 XSdPs_SubmitReq(XSdPs *InstancePtr, XSdPs_Req *ReqPtr)
+{
+	s32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(ReqPtr != NULL);
+	Xil_AssertNonvoid(ReqPtr->Handler != NULL);
+	Xil_AssertNonvoid(ReqPtr->BlkCnt != 0U);
+	Xil_AssertNonvoid((ReqPtr->Dir == XSDPS_REQ_READ) ||
+			  (ReqPtr->Dir == XSDPS_REQ_WRITE));
+
+	ReqPtr->Next = NULL;
+	ReqPtr->Status = (s32)XST_DEVICE_BUSY;
+
+	/* Keep the interrupt handler off the queue */
+	XSdPs_SetReqIntr(InstancePtr, 0U);
+
+	if (InstancePtr->ReqHead != NULL) {
+		InstancePtr->ReqTail->Next = ReqPtr;
+		InstancePtr->ReqTail = ReqPtr;
+		Status = XST_SUCCESS;
+	} else if (InstancePtr->IsBusy == TRUE) {
+		Status = XST_DEVICE_BUSY;
+	} else {
+		InstancePtr->ReqHead = ReqPtr;
+		InstancePtr->ReqTail = ReqPtr;
+		Status = XSdPs_StartReq(InstancePtr, ReqPtr);
+		if (Status != XST_SUCCESS) {
+			InstancePtr->ReqHead = NULL;
+			InstancePtr->ReqTail = NULL;
+			Status = XST_FAILURE;
+		}
+	}
+
+	if (InstancePtr->ReqHead != NULL) {
+		XSdPs_SetReqIntr(InstancePtr, 1U);
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function is the interrupt handler of the SD host controller. It
+* completes the request in flight, calls its handler and starts the next
+* queued request.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+*
+* @return	None
+*
+* @note		The application connects this function to the interrupt
+*		controller, with the XSdPs instance as its argument.
+*
+******************************************************************************/
+void XSdPs_IntrHandler(void *InstancePtr)
+{
+	XSdPs *SdPtr = (XSdPs *)InstancePtr;
+	u16 StatusReg;
+
+	Xil_AssertVoid(SdPtr != NULL);
+
+	StatusReg = XSdPs_ReadReg16(SdPtr->Config.BaseAddress,
+				XSDPS_NORM_INTR_STS_OFFSET);
+	XIL_PERF_STATS_INTR(&SdPtr->Stats);
+
+	if ((SdPtr->ReqHead != NULL) && (SdPtr->IsBusy == TRUE)) {
+		if ((StatusReg & XSDPS_INTR_ERR_MASK) != 0U) {
+			/* Write to clear error bits */
+			XSdPs_WriteReg16(SdPtr->Config.BaseAddress,
+					XSDPS_ERR_INTR_STS_OFFSET,
+					XSDPS_ERROR_INTR_ALL_MASK);
+			(void)XSdPs_Reset(SdPtr, XSDPS_SWRST_CMD_LINE_MASK |
+					  XSDPS_SWRST_DAT_LINE_MASK);
+			XSdPs_CompleteReq(SdPtr, XST_FAILURE);
+		} else if ((StatusReg & XSDPS_INTR_TC_MASK) != 0U) {
+			/* Write to clear bit */
+			XSdPs_WriteReg16(SdPtr->Config.BaseAddress,
+					XSDPS_NORM_INTR_STS_OFFSET,
+					XSDPS_INTR_TC_MASK);
+			XSdPs_CompleteReq(SdPtr, XST_SUCCESS);
+		} else {
+			/* Transfer still in progress */
+		}
+	}
+
+	XSdPs_StartNextReq(SdPtr);
+
+	XSdPs_SetReqIntr(SdPtr, (SdPtr->ReqHead != NULL) ? 1U : 0U);
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function starts the transfer of a request.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+* @param	ReqPtr is the request.
+*
+* @return
+* 		- XST_SUCCESS if the transfer is started
+* 		- XST_FAILURE if failure
+*
+******************************************************************************/
+static s32 XSdPs_StartReq(XSdPs *InstancePtr, XSdPs_Req *ReqPtr)
+{
+	s32 Status;
+
+#if defined  (XCLOCKING)
+	Xil_ClockEnable(InstancePtr->Config.RefClk);
+#endif
+
+	Status = XSdPs_SetupTransfer(InstancePtr);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	if (ReqPtr->Dir == XSDPS_REQ_READ) {
+		Status = XSdPs_Read(InstancePtr, ReqPtr->Arg, ReqPtr->BlkCnt,
+				    ReqPtr->Buff);
+	} else {
+		Status = XSdPs_Write(InstancePtr, ReqPtr->Arg, ReqPtr->BlkCnt,
+				     ReqPtr->Buff);
+	}
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	InstancePtr->IsBusy = TRUE;
+
+RETURN_PATH:
+#if defined  (XCLOCKING)
+	if (Status != XST_SUCCESS) {
+		Xil_ClockDisable(InstancePtr->Config.RefClk);
+	}
+#endif
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function takes the head request off the queue and calls its handler.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+* @param	Status is the status of the request.
+*
+* @return	None
+*
+******************************************************************************/
+static void XSdPs_CompleteReq(XSdPs *InstancePtr, s32 Status)
+{
+	XSdPs_Req *ReqPtr = InstancePtr->ReqHead;
+
+	if (InstancePtr->IsBusy == TRUE) {
+		InstancePtr->IsBusy = FALSE;
+#if defined  (XCLOCKING)
+		Xil_ClockDisable(InstancePtr->Config.RefClk);
+#endif
+	}
+
+	InstancePtr->ReqHead = ReqPtr->Next;
+	if (InstancePtr->ReqHead == NULL) {
+		InstancePtr->ReqTail = NULL;
+	}
+
+	if ((Status == XST_SUCCESS) && (ReqPtr->Dir == XSDPS_REQ_READ) &&
+	    (InstancePtr->Config.IsCacheCoherent == 0U)) {
+		Xil_DCacheInvalidateRange((INTPTR)ReqPtr->Buff,
+			((INTPTR)ReqPtr->BlkCnt * (INTPTR)InstancePtr->BlkSize));
+	}
+
+#ifdef XIL_PERF_STATS_ENABLE
+	if (Status == XST_SUCCESS) {
+		XIL_PERF_STATS_OPS(&InstancePtr->Stats, 1U,
+				   (u64)ReqPtr->BlkCnt * InstancePtr->BlkSize);
+	} else {
+		XIL_PERF_STATS_ERROR(&InstancePtr->Stats);
+	}
+#endif
+
+	ReqPtr->Next = NULL;
+	ReqPtr->Status = Status;
+	ReqPtr->Handler(ReqPtr->CallBackRef, ReqPtr);
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function starts the head request unless a transfer is in flight,
+* the requests that fail to start are completed with XST_FAILURE.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+*
+* @return	None
+*
+******************************************************************************/
+static void XSdPs_StartNextReq(XSdPs *InstancePtr)
+{
+	while ((InstancePtr->ReqHead != NULL) &&
+	       (InstancePtr->IsBusy == FALSE)) {
+		if (XSdPs_StartReq(InstancePtr, InstancePtr->ReqHead) !=
+		    XST_SUCCESS) {
+			XSdPs_CompleteReq(InstancePtr, XST_FAILURE);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function enables or disables the interrupt signals used by the
+* request queue.
+*
+* @param	InstancePtr is a pointer to the instance to be worked on.
+* @param	Enable is 1 to enable the signals, 0 to disable them.
+*
+* @return	None
+*
+******************************************************************************/
+static void XSdPs_SetReqIntr(XSdPs *InstancePtr, u8 Enable)
+{
+	XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+			XSDPS_NORM_INTR_SIG_EN_OFFSET,
+			(Enable != 0U) ? (u16)XSDPS_REQ_NORM_INTR_MASK : 0U);
+	XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+			XSDPS_ERR_INTR_SIG_EN_OFFSET,
+			(Enable != 0U) ? (u16)XSDPS_ERROR_INTR_ALL_MASK : 0U);
+}
+/** @} */
@@ -80,6 +80,8 @@
 *		      in between multiple transfers.
 * 4.8   akm  01/19/21 Fix multiple byte transfer hang issue, when FIFOs are
 *                     disabled.
+* 4.9   ag   10/15/26 Added XSpi_QueueTransfer(), the interrupt handler starts
+*                     the next segment of the queue when one is done.
 * </pre>
 *
 ******************************************************************************/
@@ -102,6 +104,8 @@
 
 static void StubStatusHandler(void *CallBackRef, u32 StatusEvent,
 				unsigned int ByteCount);
+static int XSpi_StartSegment(XSpi *InstancePtr);
+static int XSpi_NextSegment(XSpi *InstancePtr);
 
 void XSpi_Abort(XSpi *InstancePtr);
 
@@ -174,6 +178,7 @@ int XSpi_CfgInitialize(XSpi *InstancePtr, XSpi_Config *Config,
 	InstancePtr->RecvBufferPtr = NULL;
 	InstancePtr->RequestedBytes = 0;
 	InstancePtr->RemainingBytes = 0;
+	InstancePtr->SegmentPtr = NULL;
 	InstancePtr->BaseAddr = EffectiveAddr;
 	InstancePtr->HasFifos = Config->HasFifos;
 	InstancePtr->FifosDepth = Config->FifosDepth;
@@ -830,6 +835,145 @@ int XSpi_Transfer(XSpi *InstancePtr, u8 *SendBufPtr,
 	return XST_SUCCESS;
 }
 
+/*****************************************************************************/
+/**
+*
+* Transfers a list of segments on the SPI bus. Each segment is sent to its own
+* slave, the slave being deselected in between. In interrupt mode the next
+* segment is started from the interrupt handler as soon as the previous one
+* is done, without going through the upper layer, and the status callback is
+* called once with XST_SPI_TRANSFER_DONE and the total byte count when the
+* last segment is done. In polled mode the segments are transferred one after
+* the other before this function returns.
+*
+* This is meant for sampling a set of slaves, e.g. an array of ADCs, with a
+* single call. For periodic sampling the same list can be passed again from a
+* timer interrupt; XST_DEVICE_BUSY is then returned if the previous run of
+* the list is not finished yet.
+*
+* @param	InstancePtr is a pointer to the XSpi instance to be worked on.
+* @param	SegmentPtr is a pointer to the list of segments. The list and
+*		the buffers it points to must stay valid until the transfer is
+*		done.
+* @param	NumSegments is the number of segments in the list.
+*
+* @return
+*		- XST_SUCCESS if the first segment is handed off to the device,
+*		or in polled mode if all segments were transferred.
+*		- XST_DEVICE_IS_STOPPED if the device must be started before
+*		transferring data.
+*		- XST_DEVICE_BUSY indicates that a data transfer is already in
+*		progress.
+*		- XST_SPI_NO_SLAVE or XST_SPI_TOO_MANY_SLAVES if the slave of a
+*		segment cannot be selected.
+*
+* @note
+*
+* In interrupt mode a segment whose slave cannot be selected ends the queue;
+* the byte count then passed to the status callback only covers the segments
+* done. As for XSpi_Transfer(), this function is not thread-safe.
+*
+******************************************************************************/
+int XSpi_QueueTransfer(XSpi *InstancePtr, const XSpi_Segment *SegmentPtr,
+		       unsigned int NumSegments)
+{
+	u32 GlobalIntrReg;
+	int Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(SegmentPtr != NULL);
+	Xil_AssertNonvoid(NumSegments > 0);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if (InstancePtr->IsBusy) {
+		return XST_DEVICE_BUSY;
+	}
+
+	InstancePtr->SegmentPtr = SegmentPtr;
+	InstancePtr->NumSegments = NumSegments;
+	InstancePtr->SegmentIndex = 0;
+	InstancePtr->QueueBytes = 0;
+
+	GlobalIntrReg = XSpi_IsIntrGlobalEnabled(InstancePtr);
+	Status = XSpi_StartSegment(InstancePtr);
+
+	if ((Status != XST_SUCCESS) || (GlobalIntrReg != TRUE)) {
+		/*
+		 * Polled mode, XSpi_Transfer() returns once the segment is
+		 * done.
+		 */
+		while ((Status == XST_SUCCESS) &&
+		       ((InstancePtr->SegmentIndex + 1) < NumSegments)) {
+			InstancePtr->SegmentIndex++;
+			Status = XSpi_StartSegment(InstancePtr);
+		}
+		InstancePtr->SegmentPtr = NULL;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* Selects the slave of the current segment of the transfer queue and starts
+* its transfer.
+*
+* @param	InstancePtr is a pointer to the XSpi instance to be worked on.
+*
+* @return	The status of XSpi_SetSlaveSelect() or XSpi_Transfer().
+*
+* @note		The device must not be busy.
+*
+******************************************************************************/
+static int XSpi_StartSegment(XSpi *InstancePtr)
+{
+	const XSpi_Segment *SegPtr =
+		&InstancePtr->SegmentPtr[InstancePtr->SegmentIndex];
+	int Status;
+
+	Status = XSpi_SetSlaveSelect(InstancePtr, SegPtr->SlaveMask);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	return XSpi_Transfer(InstancePtr, SegPtr->SendBufPtr,
+			     SegPtr->RecvBufPtr, SegPtr->ByteCount);
+}
+
+/*****************************************************************************/
+/**
+*
+* Moves the transfer queue to its next segment once the current one is done,
+* called from the interrupt handler.
+*
+* @param	InstancePtr is a pointer to the XSpi instance to be worked on.
+*
+* @return
+*		- XST_SUCCESS if the next segment was started.
+*		- XST_FAILURE if the queue is over. RequestedBytes then holds
+*		the number of bytes of all the segments done.
+*
+* @note		None.
+*
+******************************************************************************/
+static int XSpi_NextSegment(XSpi *InstancePtr)
+{
+	InstancePtr->QueueBytes +=
+		InstancePtr->SegmentPtr[InstancePtr->SegmentIndex].ByteCount;
+	InstancePtr->SegmentIndex++;
+
+	if ((InstancePtr->SegmentIndex < InstancePtr->NumSegments) &&
+	    (XSpi_StartSegment(InstancePtr) == XST_SUCCESS)) {
+		return XST_SUCCESS;
+	}
+
+	InstancePtr->RequestedBytes = InstancePtr->QueueBytes;
+	InstancePtr->SegmentPtr = NULL;
+
+	return XST_FAILURE;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -1244,9 +1388,16 @@ void XSpi_InterruptHandler(void *InstancePtr)
 
 			SpiPtr->IsBusy = FALSE;
 
-			SpiPtr->StatusHandler(SpiPtr->StatusRef,
+			/*
+			 * With a transfer queue, start the next segment and
+			 * only inform the upper layer after the last one.
+			 */
+			if ((SpiPtr->SegmentPtr == NULL) ||
+			    (XSpi_NextSegment(SpiPtr) != XST_SUCCESS)) {
+				SpiPtr->StatusHandler(SpiPtr->StatusRef,
 						XST_SPI_TRANSFER_DONE,
 						SpiPtr->RequestedBytes);
+			}
 		}
 	}
 
@@ -1363,6 +1514,7 @@ void XSpi_Abort(XSpi *InstancePtr)
 
 	InstancePtr->RemainingBytes = 0;
 	InstancePtr->RequestedBytes = 0;
+	InstancePtr->SegmentPtr = NULL;
 	InstancePtr->IsBusy = FALSE;
 }
 
@@ -285,6 +285,8 @@
 *                     disabled.
 * 4.9	adk  31/01/22 Fix interrupt controller name in SMP designs, Changes are
 * 		      made in the interrupt app tcl file.
+* 4.9	ag   10/15/26 Added XSpi_QueueTransfer() to run a list of segments
+*		      back to back from the interrupt handler.
 * </pre>
 *
 ******************************************************************************/
@@ -383,6 +385,17 @@ typedef struct {
 	u32 NumInterrupts;	/**< Number of transmit/receive interrupts */
 } XSpi_Stats;
 
+/**
+ * One segment of a transfer queue, see XSpi_QueueTransfer(). Each segment is
+ * a transfer of its own, the slave is deselected between segments.
+ */
+typedef struct {
+	u8 *SendBufPtr;		/**< Buffer to send, must not be NULL */
+	u8 *RecvBufPtr;		/**< Buffer to receive, can be NULL */
+	unsigned int ByteCount;	/**< Number of bytes to send/receive */
+	u32 SlaveMask;		/**< Slave as for XSpi_SetSlaveSelect() */
+} XSpi_Segment;
+
 /**
  * This typedef contains configuration information for the device.
  */
@@ -431,6 +444,11 @@ typedef struct {
 	u32 FlashBaseAddr;    	/**< Used in XIP Mode */
 	u8 XipMode;             /**< 0 if Non-XIP, 1 if XIP Mode */
 	u16 FifosDepth;		/**< TX and RX FIFO Depth */
+
+	const XSpi_Segment *SegmentPtr; /**< Transfer queue (state) */
+	unsigned int NumSegments; /**< Number of segments in the queue (state) */
+	unsigned int SegmentIndex; /**< Segment being transferred (state) */
+	unsigned int QueueBytes; /**< Bytes of the finished segments (state) */
 } XSpi;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -813,6 +831,8 @@ u32 XSpi_GetSlaveSelect(XSpi *InstancePtr);
 
 int XSpi_Transfer(XSpi *InstancePtr, u8 *SendBufPtr, u8 *RecvBufPtr,
 		  unsigned int ByteCount);
+int XSpi_QueueTransfer(XSpi *InstancePtr, const XSpi_Segment *SegmentPtr,
+		       unsigned int NumSegments);
 
 void XSpi_SetStatusHandler(XSpi *InstancePtr, void *CallBackRef,
 			   XSpi_StatusHandler FuncPtr);
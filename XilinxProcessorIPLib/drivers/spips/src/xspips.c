@@ -53,6 +53,8 @@
 * 3.3	akm    08/06/19 Initialized DeviceID in XSpiPs_CfgInitialize function.
 * 3.8   sg     08/16/22 Updated SPI enable and chip selection sequence
 * 			for manual mode.
+* 3.8   ag     10/15/26 Added XSpiPs_QueueTransfer(), the interrupt handler
+* 			starts the next segment of the queue when one is done.
 * </pre>
 *
 ******************************************************************************/
@@ -107,6 +109,7 @@
 
 static void StubStatusHandler(const void *CallBackRef, u32 StatusEvent,
 				u32 ByteCount);
+static s32 XSpiPs_StartSegment(XSpiPs *InstancePtr);
 
 /************************** Variable Definitions *****************************/
 
@@ -176,6 +179,7 @@ s32 XSpiPs_CfgInitialize(XSpiPs *InstancePtr, const XSpiPs_Config *ConfigPtr,
 		InstancePtr->RecvBufferPtr = NULL;
 		InstancePtr->RequestedBytes = 0U;
 		InstancePtr->RemainingBytes = 0U;
+		InstancePtr->SegmentPtr = NULL;
 		InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
 
 		/*
@@ -612,6 +616,89 @@ s32 XSpiPs_PolledTransfer(XSpiPs *InstancePtr, u8 *SendBufPtr,
 	return Status_Polled;
 }
 
+/*****************************************************************************/
+/**
+*
+* Transfers a list of segments on the SPI bus in interrupt mode. Each segment
+* is sent to its own slave with its own delays, and the next segment is
+* started from the interrupt handler as soon as the previous one is done,
+* without going through the upper layer. The status callback is called once,
+* with XST_SPI_TRANSFER_DONE and the total byte count, when the last segment
+* is done.
+*
+* This is meant for sampling a set of slaves, e.g. an array of ADCs, with a
+* single call. For periodic sampling the same list can be passed again from a
+* timer interrupt; XST_DEVICE_BUSY is then returned if the previous run of
+* the list is not finished yet.
+*
+* @param	InstancePtr is a pointer to the XSpiPs instance.
+* @param	SegmentPtr is a pointer to the list of segments. The list and
+*		the buffers it points to must stay valid until the transfer is
+*		done.
+* @param	NumSegments is the number of segments in the list.
+*
+* @return
+*		- XST_SUCCESS if the first segment is handed off to the device.
+*		- XST_DEVICE_BUSY indicates that a data transfer is already in
+*		progress.
+*
+* @note
+*
+* The Delay register is written at the start of each segment, so the delays
+* set with XSpiPs_SetDelays() are overwritten. As for XSpiPs_Transfer(), this
+* function is not thread-safe.
+*
+******************************************************************************/
+s32 XSpiPs_QueueTransfer(XSpiPs *InstancePtr,
+			const XSpiPs_Segment *SegmentPtr, u32 NumSegments)
+{
+	s32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(SegmentPtr != NULL);
+	Xil_AssertNonvoid(NumSegments > 0U);
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)XIL_COMPONENT_IS_READY);
+
+	if (InstancePtr->IsBusy == TRUE) {
+		Status = (s32)XST_DEVICE_BUSY;
+	} else {
+		InstancePtr->SegmentPtr = SegmentPtr;
+		InstancePtr->NumSegments = NumSegments;
+		InstancePtr->SegmentIndex = 0U;
+		InstancePtr->QueueBytes = 0U;
+
+		Status = XSpiPs_StartSegment(InstancePtr);
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* Starts the current segment of the transfer queue. The slave select and the
+* delays of the segment are set before the transfer is started.
+*
+* @param	InstancePtr is a pointer to the XSpiPs instance.
+*
+* @return	The status of XSpiPs_Transfer().
+*
+* @note		The device must not be busy.
+*
+******************************************************************************/
+static s32 XSpiPs_StartSegment(XSpiPs *InstancePtr)
+{
+	const XSpiPs_Segment *SegPtr =
+		&InstancePtr->SegmentPtr[InstancePtr->SegmentIndex];
+
+	(void)XSpiPs_SetSlaveSelect(InstancePtr, SegPtr->SlaveSel);
+	XSpiPs_WriteReg(InstancePtr->Config.BaseAddress, XSPIPS_DR_OFFSET,
+			SegPtr->Delays);
+
+	return XSpiPs_Transfer(InstancePtr, SegPtr->SendBufPtr,
+				SegPtr->RecvBufPtr, SegPtr->ByteCount);
+}
+
 /*****************************************************************************/
 /**
 *
@@ -986,17 +1073,39 @@ void XSpiPs_InterruptHandler(XSpiPs *InstancePtr)
 			 */
 			SpiPtr->IsBusy = FALSE;
 
-			/*
-			 * Disable the device.
-			 */
-			XSpiPs_Disable(SpiPtr);
+			if ((SpiPtr->SegmentPtr != NULL) &&
+				((SpiPtr->SegmentIndex + 1U) <
+				 SpiPtr->NumSegments)) {
+				/*
+				 * Start the next segment of the transfer
+				 * queue, the upper layer is informed once
+				 * the last segment is done.
+				 */
+				SpiPtr->QueueBytes += SpiPtr->SegmentPtr[
+					SpiPtr->SegmentIndex].ByteCount;
+				SpiPtr->SegmentIndex++;
+				(void)XSpiPs_StartSegment(SpiPtr);
+			} else {
+				BytesDone = SpiPtr->RequestedBytes;
+				if (SpiPtr->SegmentPtr != NULL) {
+					BytesDone = SpiPtr->QueueBytes +
+						SpiPtr->SegmentPtr[
+						SpiPtr->SegmentIndex].ByteCount;
+					SpiPtr->SegmentPtr = NULL;
+				}
 
-			/*
-			 * Inform the Transfer done to upper layers.
-			 */
-			SpiPtr->StatusHandler(SpiPtr->StatusRef,
+				/*
+				 * Disable the device.
+				 */
+				XSpiPs_Disable(SpiPtr);
+
+				/*
+				 * Inform the Transfer done to upper layers.
+				 */
+				SpiPtr->StatusHandler(SpiPtr->StatusRef,
 						XST_SPI_TRANSFER_DONE,
-						SpiPtr->RequestedBytes);
+						BytesDone);
+			}
 		} else {
 			/*
 			 * Enable the TXOW interrupt.
@@ -1026,6 +1135,7 @@ void XSpiPs_InterruptHandler(XSpiPs *InstancePtr)
 	if ((IntrStatus & XSPIPS_IXR_RXOVR_MASK) != 0U) {
 		BytesDone = SpiPtr->RequestedBytes - SpiPtr->RemainingBytes;
 		SpiPtr->IsBusy = FALSE;
+		SpiPtr->SegmentPtr = NULL;
 
 		/*
 		 * The Slave select lines are being manually controlled.
@@ -1049,6 +1159,7 @@ void XSpiPs_InterruptHandler(XSpiPs *InstancePtr)
 		BytesDone = SpiPtr->RequestedBytes - SpiPtr->RemainingBytes;
 
 		SpiPtr->IsBusy = FALSE;
+		SpiPtr->SegmentPtr = NULL;
 		/*
 		 * The Slave select lines are being manually controlled.
 		 * Disable them because the transfer is complete.
@@ -1130,6 +1241,7 @@ void XSpiPs_Abort(XSpiPs *InstancePtr)
 
 	InstancePtr->RemainingBytes = 0U;
 	InstancePtr->RequestedBytes = 0U;
+	InstancePtr->SegmentPtr = NULL;
 	InstancePtr->IsBusy = FALSE;
 }
 
@@ -237,6 +237,8 @@
 * 3.6   sg     02/05/21 Added polled mode example for TPM device.
 * 3.7   asa    04/01/22 Updated version to 3.7. Fixed issue in selftest
 *                       example.
+* 3.8   ag     10/15/26 Added XSpiPs_QueueTransfer() to run a list of
+*                       segments back to back from the interrupt handler.
 *
 * </pre>
 *
@@ -378,6 +380,19 @@ extern "C" {
 typedef void (*XSpiPs_StatusHandler) (const void *CallBackRef, u32 StatusEvent,
 					u32 ByteCount);
 
+/**
+ * One segment of a transfer queue, see XSpiPs_QueueTransfer(). Each segment is
+ * a transfer of its own, the slave select is released between segments.
+ */
+typedef struct {
+	u8 *SendBufPtr;		/**< Buffer to send, must not be NULL */
+	u8 *RecvBufPtr;		/**< Buffer to receive, can be NULL */
+	u32 ByteCount;		/**< Number of bytes to send/receive */
+	u32 Delays;		/**< Delay register value used for this segment,
+				  see XSpiPs_SegmentDelays() */
+	u8 SlaveSel;		/**< Slave number as for XSpiPs_SetSlaveSelect() */
+} XSpiPs_Segment;
+
 /**
  * This typedef contains configuration information for the device.
  */
@@ -407,6 +422,11 @@ typedef struct {
 	XSpiPs_StatusHandler StatusHandler;
 	void *StatusRef;  	 /**< Callback reference for status handler */
 
+	const XSpiPs_Segment *SegmentPtr; /**< Transfer queue (state) */
+	u32 NumSegments;	 /**< Number of segments in the queue (state) */
+	u32 SegmentIndex;	 /**< Segment being transferred (state) */
+	u32 QueueBytes;		 /**< Bytes of the finished segments (state) */
+
 } XSpiPs;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -633,6 +653,30 @@ typedef struct {
 #define XSpiPs_Disable(InstancePtr)					\
 	XSpiPs_Out32(((InstancePtr)->Config.BaseAddress) + XSPIPS_ER_OFFSET, 0U)
 
+/****************************************************************************/
+/**
+*
+* Build the Delay register value of a transfer queue segment. The fields are
+* the ones of XSpiPs_SetDelays().
+*
+* @param	DelayNss is the chip select de-assertion delay between words.
+* @param	DelayBtwn is the delay between two slave selects.
+* @param	DelayAfter is the delay between two words.
+* @param	DelayInit is the delay between slave select and the first bit.
+*
+* @return	The value of the XSpiPs_Segment Delays field.
+*
+* @note		C-Style signature:
+*		u32 XSpiPs_SegmentDelays(u8 DelayNss, u8 DelayBtwn,
+*					u8 DelayAfter, u8 DelayInit)
+*
+*****************************************************************************/
+#define XSpiPs_SegmentDelays(DelayNss, DelayBtwn, DelayAfter, DelayInit) \
+	((((u32)(DelayNss) << XSPIPS_DR_NSS_SHIFT) & XSPIPS_DR_NSS_MASK) | \
+	 (((u32)(DelayBtwn) << XSPIPS_DR_BTWN_SHIFT) & XSPIPS_DR_BTWN_MASK) | \
+	 (((u32)(DelayAfter) << XSPIPS_DR_AFTER_SHIFT) & XSPIPS_DR_AFTER_MASK) | \
+	 ((u32)(DelayInit) & XSPIPS_DR_INIT_MASK))
+
 /************************** Function Prototypes ******************************/
 
 /*
@@ -654,6 +698,9 @@ s32 XSpiPs_Transfer(XSpiPs *InstancePtr, u8 *SendBufPtr, u8 *RecvBufPtr,
 s32 XSpiPs_PolledTransfer(XSpiPs *InstancePtr, u8 *SendBufPtr,
 				u8 *RecvBufPtr, u32 ByteCount);
 
+s32 XSpiPs_QueueTransfer(XSpiPs *InstancePtr,
+			const XSpiPs_Segment *SegmentPtr, u32 NumSegments);
+
 void XSpiPs_SetStatusHandler(XSpiPs *InstancePtr, void *CallBackRef,
 				XSpiPs_StatusHandler FunctionPtr);
 void XSpiPs_InterruptHandler(XSpiPs *InstancePtr);
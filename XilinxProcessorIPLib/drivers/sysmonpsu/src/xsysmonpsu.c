@@ -44,6 +44,8 @@
 *       mn     07/31/18 Modified code for MISRA-C:2012 Compliance.
 * 2.7   aad    10/21/20 Modified code for MISRA-C:2012 Compliance.
 * 2.8   cog    10/21/20 Fixed issues where ADCCLK divisor was not updated.
+*       ag     10/15/26 Added XSysMonPsu_GetSeqAdcData and
+*                       XSysMonPsu_SetSeqStats.
 *
 * </pre>
 *
@@ -115,6 +117,7 @@ s32 XSysMonPsu_CfgInitialize(XSysMonPsu *InstancePtr, XSysMonPsu_Config *ConfigP
 
 	/* Set all handlers to stub values, let user configure this data later. */
 	InstancePtr->Handler = (XSysMonPsu_Handler)XSysMonPsu_StubHandler;
+	InstancePtr->SeqStatsPtr = NULL;
 
 	(void)XSysMonPsu_UpdateAdcClkDivisor(InstancePtr, XSYSMON_PS);
 	(void)XSysMonPsu_UpdateAdcClkDivisor(InstancePtr, XSYSMON_PL);
@@ -1741,6 +1744,120 @@ u64 XSysMonPsu_GetSeqAcqTime(XSysMonPsu *InstancePtr, u32 SysmonBlk)
 	return RegValAcq;
 }
 
+/****************************************************************************/
+/**
+*
+* This function reads the conversion results of all the channels enabled in
+* the ADC Channel Selection Sequencer Registers in one sweep. The channel
+* enables are read once and the data registers of the enabled channels are
+* then read back to back, without converting the results.
+*
+* @param	InstancePtr is a pointer to the XSysMonPsu instance.
+* @param	DataPtr is a pointer to an array of XSM_SEQ_NUM_CH raw ADC codes,
+*		indexed by the XSM_CH_* channel number. Only the entries of
+*		enabled channels are written.
+* @param	SysmonBlk is the value that tells whether it is for PS Sysmon
+*       block or PL Sysmon block register region.
+*
+* @return	The mask of the channels read, bit n set for channel n.
+*
+* @note		Use XSysMonPsu_SetSeqChEnables to select the channels. The
+*		raw codes are converted with the XSysMonPsu_RawTo* macros.
+*
+*****************************************************************************/
+u64 XSysMonPsu_GetSeqAdcData(XSysMonPsu *InstancePtr, u16 *DataPtr,
+		u32 SysmonBlk)
+{
+	u64 SeqChMask;
+	u64 ChMask;
+	u32 Channel;
+	UINTPTR EffectiveBaseAddress;
+
+	/* Assert the arguments. */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(DataPtr != NULL);
+	Xil_AssertNonvoid((SysmonBlk == XSYSMON_PS)||(SysmonBlk == XSYSMON_PL));
+
+	SeqChMask = XSysMonPsu_GetSeqChEnables(InstancePtr, SysmonBlk);
+
+	/*
+	 * The two bytes of the first sequencer register are swapped with
+	 * respect to the channel numbers, bit 8 is the temperature (channel
+	 * 0) and bit 0 is the calibration (channel 8).
+	 */
+	ChMask = (SeqChMask & ~(u64)0xFFFFU) | ((SeqChMask & 0xFFU) << 8U) |
+			((SeqChMask >> 8U) & 0xFFU);
+
+	/* Calculate the effective baseaddress based on the Sysmon instance. */
+	EffectiveBaseAddress =
+			XSysMonPsu_GetEffBaseAddress(InstancePtr->Config.BaseAddress,
+					SysmonBlk);
+
+	for (Channel = 0U; Channel < XSM_SEQ_NUM_CH; Channel++) {
+		if ((ChMask & ((u64)1U << Channel)) != 0U) {
+			if (Channel <= XSM_CH_AUX_MAX) {
+				DataPtr[Channel] = (u16)XSysmonPsu_ReadReg(
+						EffectiveBaseAddress +
+						((UINTPTR)Channel << 2U));
+			} else {
+				DataPtr[Channel] = (u16)XSysmonPsu_ReadReg(
+						EffectiveBaseAddress + XSM_ADC_CH_OFFSET +
+						(((UINTPTR)Channel - XSM_CH_SUPPLY7) << 2U));
+			}
+		}
+	}
+
+	return ChMask;
+}
+
+/****************************************************************************/
+/**
+*
+* This function sets the array in which the driver keeps the statistics of
+* the sequencer channels. The statistics are reset and then updated by
+* XSysMonPsu_SeqStatsIntrHandler on every end of sequence interrupt.
+*
+* @param	InstancePtr is a pointer to the XSysMonPsu instance.
+* @param	StatsPtr is a pointer to an array of XSM_SEQ_NUM_CH statistics,
+*		indexed by the XSM_CH_* channel number. NULL stops keeping
+*		statistics.
+* @param	SysmonBlk is the value that tells whether it is for PS Sysmon
+*       block or PL Sysmon block register region.
+*
+* @return	None.
+*
+* @note		The end of sequence interrupt must be enabled with
+*		XSysMonPsu_IntrEnable. It is raised by the PS Sysmon, the
+*		statistics of the PL Sysmon are sampled at that rate.
+*
+*****************************************************************************/
+void XSysMonPsu_SetSeqStats(XSysMonPsu *InstancePtr,
+		XSysMonPsu_ChStats *StatsPtr, u32 SysmonBlk)
+{
+	u32 Channel;
+
+	/* Assert the arguments. */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertVoid((SysmonBlk == XSYSMON_PS)||(SysmonBlk == XSYSMON_PL));
+
+	/* Detach the old array first so the handler does not see a partial one. */
+	InstancePtr->SeqStatsPtr = NULL;
+
+	if (StatsPtr != NULL) {
+		for (Channel = 0U; Channel < XSM_SEQ_NUM_CH; Channel++) {
+			StatsPtr[Channel].Last = 0U;
+			StatsPtr[Channel].Min = 0xFFFFU;
+			StatsPtr[Channel].Max = 0U;
+			StatsPtr[Channel].Count = 0U;
+			StatsPtr[Channel].Sum = 0U;
+		}
+		InstancePtr->SeqStatsBlk = SysmonBlk;
+		InstancePtr->SeqStatsPtr = StatsPtr;
+	}
+}
+
 /****************************************************************************/
 /**
 *
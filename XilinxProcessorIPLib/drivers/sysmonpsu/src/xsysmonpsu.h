@@ -157,6 +157,9 @@
 * 2.6   aad    11/18/19 Fixed typo in alarm macro comments
 * 2.7   aad    10/21/20 Modified code for MISRA-C:2012 Compliance.
 *       aad    17/12/20 Removed undefined function.
+* 2.8   ag     10/15/26 Added XSysMonPsu_GetSeqAdcData to read all sequencer
+*                       channels in one sweep and per channel statistics
+*                       updated on the end of sequence interrupt.
 *
 * </pre>
 *
@@ -213,6 +216,9 @@ extern "C" {
 #define XSM_CH_VCC_PSDDRPLL 57U   /**< VCC_PSDDRPLL */
 #define XSM_CH_DDRPHY_VREF  58U   /**< DDRPHY_VREF */
 #define XSM_CH_RESERVE1     63U   /**< PSGT_AT0 */
+#define XSM_SEQ_NUM_CH      38U   /**< Number of channels covered by the
+					channel sequencer, 0 to
+					XSM_CH_TEMP_REMTE */
 
 /*@}*/
 
@@ -382,6 +388,18 @@ typedef struct {
 	u16 InputClockMHz;	/**< Input clock frequency */
 } XSysMonPsu_Config;
 
+/**
+ * Statistics of one sequencer channel, kept by the driver on the end of
+ * sequence interrupt. All values are raw 16 bit ADC codes.
+ */
+typedef struct {
+	u16 Last;		/**< Latest conversion */
+	u16 Min;		/**< Minimum since the statistics were set */
+	u16 Max;		/**< Maximum since the statistics were set */
+	u32 Count;		/**< Number of conversions accumulated */
+	u64 Sum;		/**< Sum of the conversions accumulated */
+} XSysMonPsu_ChStats;
+
 /**
  * The XSysmonPsu driver instance data. The user is required to allocate a
  * variable of this type for the SYSMON device in the system. A pointer
@@ -393,6 +411,9 @@ typedef struct {
 	XSysMonPsu_Handler Handler;
 	void *CallBackRef;			/**< Callback reference for event handler */
 	u32 IsPlAccessibleByPs;		/**< PL is accessible by PS */
+	XSysMonPsu_ChStats *SeqStatsPtr;	/**< Sequencer channel statistics,
+						  indexed by channel number */
+	u32 SeqStatsBlk;			/**< Sysmon block of statistics */
 } XSysMonPsu;
 
 /* BaseAddress Offsets */
@@ -566,6 +587,24 @@ typedef struct {
 #define XSysMonPsu_VccopsioVoltageToRaw(Voltage)			 		\
 	((s32)((Voltage)*65536.0f/6.0f))
 
+/****************************************************************************/
+/**
+*
+* This macro returns the average raw ADC code of a sequencer channel from its
+* statistics.
+*
+* @param	StatsPtr is a pointer to the XSysMonPsu_ChStats of the channel.
+*
+* @return 	The average raw ADC code, 0 if no conversion was accumulated.
+*
+* @note		C-Style signature:
+*		u16 XSysMonPsu_ChStatsAvg(XSysMonPsu_ChStats *StatsPtr)
+*
+*****************************************************************************/
+#define XSysMonPsu_ChStatsAvg(StatsPtr)						\
+	(((StatsPtr)->Count == 0U) ? (u16)0U :				\
+	(u16)((StatsPtr)->Sum / (StatsPtr)->Count))
+
 /****************************************************************************/
 /**
 *
@@ -640,6 +679,10 @@ u64 XSysMonPsu_GetSeqInputMode(XSysMonPsu *InstancePtr, u32 SysmonBlk);
 s32 XSysMonPsu_SetSeqAcqTime(XSysMonPsu *InstancePtr, u64 AcqCyclesChMask,
 		u32 SysmonBlk);
 u64 XSysMonPsu_GetSeqAcqTime(XSysMonPsu *InstancePtr, u32 SysmonBlk);
+u64 XSysMonPsu_GetSeqAdcData(XSysMonPsu *InstancePtr, u16 *DataPtr,
+		u32 SysmonBlk);
+void XSysMonPsu_SetSeqStats(XSysMonPsu *InstancePtr,
+		XSysMonPsu_ChStats *StatsPtr, u32 SysmonBlk);
 void XSysMonPsu_SetAlarmThreshold(XSysMonPsu *InstancePtr, u8 AlarmThrReg,
 		u16 Value, u32 SysmonBlk);
 u16 XSysMonPsu_GetAlarmThreshold(XSysMonPsu *InstancePtr, u8 AlarmThrReg,
@@ -655,6 +698,7 @@ void XSysMonPsu_IntrDisable(XSysMonPsu *InstancePtr, u64 Mask);
 u64 XSysMonPsu_IntrGetEnabled(XSysMonPsu *InstancePtr);
 u64 XSysMonPsu_IntrGetStatus(XSysMonPsu *InstancePtr);
 void XSysMonPsu_IntrClear(XSysMonPsu *InstancePtr, u64 Mask);
+void XSysMonPsu_SeqStatsIntrHandler(void *CallBackRef);
 
 /* Functions in xsysmonpsu_selftest.c */
 s32 XSysMonPsu_SelfTest(XSysMonPsu *InstancePtr);
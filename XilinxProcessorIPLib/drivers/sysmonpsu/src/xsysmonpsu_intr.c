@@ -17,6 +17,7 @@
 * Ver   Who    Date	Changes
 * ----- -----  -------- -----------------------------------------------
 * 1.0   kvn    12/15/15 First release
+* 2.8   ag     10/15/26 Added XSysMonPsu_SeqStatsIntrHandler.
 * </pre>
 *
 ******************************************************************************/
@@ -221,5 +222,67 @@ void XSysMonPsu_IntrClear(XSysMonPsu *InstancePtr, u64 Mask)
 			  (u32)RegValue);
 }
 
+/****************************************************************************/
+/**
+*
+* This function is the end of sequence interrupt handler which updates the
+* statistics set with XSysMonPsu_SetSeqStats. It reads all the enabled
+* sequencer channels in one sweep and updates the latest, minimum, maximum
+* and accumulated value of each of them. It may be connected directly to the
+* interrupt controller or called from the interrupt handler of the
+* application.
+*
+* @param	CallBackRef is a pointer to the XSysMonPsu instance.
+*
+* @return	None.
+*
+* @note		Only the end of sequence interrupt is cleared, the other
+*		interrupts are left to the application.
+*
+*****************************************************************************/
+void XSysMonPsu_SeqStatsIntrHandler(void *CallBackRef)
+{
+	XSysMonPsu *InstancePtr = (XSysMonPsu *)CallBackRef;
+	XSysMonPsu_ChStats *Stats;
+	u16 Data[XSM_SEQ_NUM_CH];
+	u64 EosMask;
+	u64 ChMask;
+	u32 Channel;
+
+	/* Assert the arguments. */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	EosMask = (u64)XSYSMONPSU_ISR_1_EOS_MASK << XSYSMONPSU_IXR_1_SHIFT;
+	if ((XSysMonPsu_IntrGetStatus(InstancePtr) & EosMask) == 0U) {
+		goto End;
+	}
+	XSysMonPsu_IntrClear(InstancePtr, EosMask);
+
+	Stats = InstancePtr->SeqStatsPtr;
+	if (Stats == NULL) {
+		goto End;
+	}
+
+	ChMask = XSysMonPsu_GetSeqAdcData(InstancePtr, Data,
+			InstancePtr->SeqStatsBlk);
+
+	for (Channel = 0U; Channel < XSM_SEQ_NUM_CH; Channel++) {
+		if ((ChMask & ((u64)1U << Channel)) != 0U) {
+			Stats[Channel].Last = Data[Channel];
+			if (Data[Channel] < Stats[Channel].Min) {
+				Stats[Channel].Min = Data[Channel];
+			}
+			if (Data[Channel] > Stats[Channel].Max) {
+				Stats[Channel].Max = Data[Channel];
+			}
+			Stats[Channel].Sum += Data[Channel];
+			Stats[Channel].Count++;
+		}
+	}
+
+End:
+	return;
+}
 
 /** @} */
@@ -20,6 +20,7 @@
 * Ver   Who    Date     Changes
 * ----- -----  -------- -----------------------------------------------
 * 3.0   cog    03/25/21 Driver Restructure
+* 3.1   ag     10/15/26 Added XSysMonPsv_UpdateSupplyStats.
 *
 *
 * </pre>
@@ -486,3 +487,78 @@ void XSysMonPsv_UnlockRegspace(XSysMonPsv *InstancePtr)
 	XSysMonPsv_WriteReg32(InstancePtr, XSYSMONPSV_PCSR_LOCK,
 			    XSYSMONPSV_LOCK_CODE);
 }
+
+/****************************************************************************/
+/**
+*
+* This function gives the signed value of the mantissa of a supply register.
+*
+* @param	RawData is the supply register value.
+*
+* @return	Mantissa, negative for bipolar supplies with the sign bit set.
+*
+*****************************************************************************/
+static s32 XSysMonPsv_SupplyMantissa(u32 RawData)
+{
+	u32 Mantissa = RawData & XSYSMONPSV_SUPPLY_MANTISSA_MASK;
+	s32 Val = (s32)Mantissa;
+
+	if (((RawData & XSYSMONPSV_SUPPLY_FMT_MASK) != 0U) &&
+	    ((Mantissa >> XSYSMONPSV_SUPPLY_MANTISSA_SIGN) != 0U)) {
+		Val -= (s32)0x10000;
+	}
+
+	return Val;
+}
+
+/****************************************************************************/
+/**
+*
+* This function updates the supply statistics of InstancePtr. All configured
+* supplies are read in one sweep, each supply register is read once. It is
+* called by the interrupt handlers on new data interrupts and may be called
+* by the application from its own handler.
+*
+* @param	InstancePtr is a pointer to the driver instance.
+*
+* @return	None.
+*
+* @note		Nothing is done when no statistics are set.
+*
+*****************************************************************************/
+void XSysMonPsv_UpdateSupplyStats(XSysMonPsv *InstancePtr)
+{
+	XSysMonPsv_SupplyStats *Stats;
+	u32 Supply, SupplyReg, Regval;
+	s32 Val;
+
+	/* Assert the input arguments. */
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	if (InstancePtr->SupplyStats == NULL) {
+		return;
+	}
+
+	for (Supply = 0U; Supply < (u32)EndList; Supply++) {
+		SupplyReg = InstancePtr->Config.Supply_List[Supply];
+		if (SupplyReg != XSYSMONPSV_INVALID_SUPPLY) {
+			XSysMonPsv_ReadReg32(InstancePtr,
+					     XSYSMONPSV_SUPPLY + (SupplyReg * 4U),
+					     &Regval);
+			Val = XSysMonPsv_SupplyMantissa(Regval);
+			Stats = &InstancePtr->SupplyStats[Supply];
+
+			if ((Stats->Count == 0U) ||
+			    (Val < XSysMonPsv_SupplyMantissa(Stats->Min))) {
+				Stats->Min = Regval;
+			}
+			if ((Stats->Count == 0U) ||
+			    (Val > XSysMonPsv_SupplyMantissa(Stats->Max))) {
+				Stats->Max = Regval;
+			}
+			Stats->Last = Regval;
+			Stats->Sum += Val;
+			Stats->Count++;
+		}
+	}
+}
@@ -16,6 +16,7 @@
 * Ver   Who    Date     Changes
 * ----- -----  -------- -----------------------------------------------
 * 3.0   cog    03/25/21 Driver Restructure
+* 3.1   ag     10/15/26 Added XSysMonPsv_UpdateSupplyStats.
 *
 * </pre>
 *
@@ -116,6 +117,7 @@ int XSysMonPsv_InterruptDisable(XSysMonPsv *InstancePtr, u32 Mask, u8 IntrNum);
 int XSysMonPsv_InterruptGetStatus(XSysMonPsv *InstancePtr, u32 *IntrStatus);
 void XSysMonPsv_InterruptClear(XSysMonPsv *InstancePtr, u32 Mask);
 void XSysMonPsv_UnlockRegspace(XSysMonPsv *InstancePtr);
+void XSysMonPsv_UpdateSupplyStats(XSysMonPsv *InstancePtr);
 
 #ifdef __cplusplus
 }
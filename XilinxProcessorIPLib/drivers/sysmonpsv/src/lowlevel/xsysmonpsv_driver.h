@@ -29,6 +29,7 @@
 * 3.0   cog    03/25/21 Driver Restructure
 * 3.1   cog    04/09/22 Remove GIC standalone related functionality for
 *                       arch64 architecture
+*       ag     10/15/26 Added supply statistics kept on new data interrupts.
 *
 * </pre>
 *
@@ -90,6 +91,22 @@ typedef struct {
 
 /*@}*/
 
+/**
+ * @brief This typedef contains the statistics of one supply, kept by the
+ * driver on new data interrupts. Last, Min and Max are raw supply register
+ * values, Sum accumulates the signed mantissas.
+ * @{
+ */
+typedef struct {
+	u32 Last; /**< Latest supply register value */
+	u32 Min; /**< Minimum since the statistics were set */
+	u32 Max; /**< Maximum since the statistics were set */
+	u32 Count; /**< Number of values accumulated */
+	s64 Sum; /**< Sum of the mantissas accumulated */
+} XSysMonPsv_SupplyStats;
+
+/*@}*/
+
 /**
  * @brief The XSysmonPsv driver instance data. The user is required to allocate a
  * variable of this type for the SYSMON device in the system. A pointer
@@ -109,6 +126,8 @@ typedef struct {
                                             handler information */
 	XSysMonPsv_EventHandler OTEvent; /**< OT event handler information */
 #endif
+	XSysMonPsv_SupplyStats *SupplyStats; /**< Supply statistics indexed
+                                                  by XSysMonPsv_Supply */
 	u32 IsReady; /**< Is device ready */
 } XSysMonPsv;
 
@@ -22,6 +22,7 @@
 * 3.0   cog    03/25/21 Driver Restructure
 * 3.1   cog    04/09/22 Remove GIC standalone related functionality for
 *                       arch64 architecture
+*       ag     10/15/26 Update the supply statistics on new data interrupts.
 *
 * </pre>
 *
@@ -290,6 +291,11 @@ void XSysMonPsv_IntrHandler(XSysMonPsv *InstancePtr)
 	DevTempDetected = IntrStatus & XSYSMONPSV_ISR_TEMP_MASK;
 	OTTempDetected = IntrStatus & XSYSMONPSV_ISR_OT_MASK;
 
+	/* Update the supply statistics on new data */
+	if ((IntrStatus & XSYSMONPSV_INTR_NEW_DATA_MASK) != 0U) {
+		XSysMonPsv_UpdateSupplyStats(InstancePtr);
+	}
+
 	/* Handle OT Event */
 	if ((OTTempDetected != 0U) &&
 	    (InstancePtr->OTEvent.IsCallbackSet == 1U)) {
@@ -31,6 +31,8 @@
 * 3.0   cog    03/25/21 Driver Restructure
 * 3.1   cog    04/09/22 Remove GIC standalone related functionality for
 *                       arch64 architecture
+*       ag     10/15/26 Added XSysMonPsv_ReadSupplyRawAll and
+*                       XSysMonPsv_SetSupplyStats.
 *
 * </pre>
 *
@@ -76,6 +78,7 @@ s64 XSysMonPsv_CfgInitialize(XSysMonPsv *InstancePtr, XSysMonPsv_Config *CfgPtr)
 	for (i = 0U; i < XSYSMONPSV_MAX_SUPPLIES; i++) {
 		InstancePtr->Config.Supply_List[i] = CfgPtr->Supply_List[i];
 	}
+	InstancePtr->SupplyStats = NULL;
 
 	/* Indicate the instance is now ready to use, initialized without error */
 	InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
@@ -1172,6 +1175,89 @@ int XSysMonPsv_ReadSupplyRaw(XSysMonPsv *InstancePtr, u32 Supply, u32 *Val)
 	return XSYSMONPSV_SUCCESS;
 }
 
+/******************************************************************************/
+/**
+ * This function reads all the configured supplies in raw in one sweep. Each
+ * supply register is read once and no conversion is done, the values are
+ * converted with XSysMonPsv_RawToVoltage when needed.
+ *
+ * @param	InstancePtr is a pointer to the driver instance.
+ * @param	Val is an array of EndList raw voltages, indexed by
+ *		XSysMonPsv_Supply. Entries of supplies that are not configured
+ *		are not written.
+ *
+ * @return	- -XSYSMONPSV_EINVAL if error
+ * 		- Number of supplies read if successful.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+int XSysMonPsv_ReadSupplyRawAll(XSysMonPsv *InstancePtr, u32 *Val)
+{
+	u32 Supply, SupplyReg;
+	int Count = 0;
+
+	if (InstancePtr == NULL || Val == NULL) {
+		return -XSYSMONPSV_EINVAL;
+	}
+
+	for (Supply = 0U; Supply < (u32)EndList; Supply++) {
+		SupplyReg = InstancePtr->Config.Supply_List[Supply];
+		if (SupplyReg != XSYSMONPSV_INVALID_SUPPLY) {
+			XSysMonPsv_ReadReg32(InstancePtr,
+					     XSYSMONPSV_SUPPLY +
+					     (SupplyReg * 4U), &Val[Supply]);
+			Count++;
+		}
+	}
+
+	return Count;
+}
+
+/******************************************************************************/
+/**
+ * This function sets the array in which the driver keeps the statistics of
+ * the configured supplies. The statistics are reset and then updated on
+ * every new data interrupt by the interrupt handler of the driver.
+ *
+ * @param	InstancePtr is a pointer to the driver instance.
+ * @param	StatsPtr is an array of EndList statistics, indexed by
+ *		XSysMonPsv_Supply. NULL stops keeping statistics.
+ *
+ * @return	- -XSYSMONPSV_EINVAL if error
+ *		- XSYSMONPSV_SUCCESS if successful.
+ *
+ * @note	The new data interrupt source is selected with
+ *		XSysMonPsv_SetNewDataIntSrc, usually the last supply of the
+ *		sequence, and enabled with XSYSMONPSV_INTR_NEW_DATA_MASK.
+ *
+*******************************************************************************/
+int XSysMonPsv_SetSupplyStats(XSysMonPsv *InstancePtr,
+			      XSysMonPsv_SupplyStats *StatsPtr)
+{
+	u32 Supply;
+
+	if (InstancePtr == NULL) {
+		return -XSYSMONPSV_EINVAL;
+	}
+
+	/* Detach the old array first so the handler does not see a partial one */
+	InstancePtr->SupplyStats = NULL;
+
+	if (StatsPtr != NULL) {
+		for (Supply = 0U; Supply < (u32)EndList; Supply++) {
+			StatsPtr[Supply].Last = 0U;
+			StatsPtr[Supply].Min = 0U;
+			StatsPtr[Supply].Max = 0U;
+			StatsPtr[Supply].Count = 0U;
+			StatsPtr[Supply].Sum = 0;
+		}
+		InstancePtr->SupplyStats = StatsPtr;
+	}
+
+	return XSYSMONPSV_SUCCESS;
+}
+
 /******************************************************************************/
 /**
  * This function sets upper threshold voltage for the supply.
@@ -114,6 +114,8 @@
 * 3.0   cog    03/25/21 Driver Restructure
 * 3.1   cog    04/09/22 Remove GIC standalone related functionality for
 *                       arch64 architecture
+*       ag     10/15/26 Added XSysMonPsv_ReadSupplyRawAll and supply
+*                       statistics updated on new data interrupts.
 *
 * </pre>
 *
@@ -345,6 +347,34 @@ static inline u16 XSysMonPsv_FloatToFixed(float Temp)
 	return (u16)RawAdc;
 }
 
+/****************************************************************************/
+/**
+*
+* This function returns the average of a supply from its statistics as a
+* raw supply register value.
+*
+* @param        StatsPtr is a pointer to the statistics of the supply.
+*
+* @return       The average in raw format, 0 if no value was accumulated.
+*
+* @note         Use XSysMonPsv_RawToVoltage to convert the value.
+*
+*****************************************************************************/
+static inline u32 XSysMonPsv_SupplyStatsAvg(
+	const XSysMonPsv_SupplyStats *StatsPtr)
+{
+	s64 Avg;
+
+	if (StatsPtr->Count == 0U) {
+		return 0U;
+	}
+
+	Avg = StatsPtr->Sum / (s64)StatsPtr->Count;
+
+	return (StatsPtr->Last & ~(u32)XSYSMONPSV_SUPPLY_MANTISSA_MASK) |
+	       ((u32)Avg & XSYSMONPSV_SUPPLY_MANTISSA_MASK);
+}
+
 /************************** Function Prototypes ******************************/
 
 /* Functions in xsysmonpsv.c */
@@ -405,6 +435,9 @@ int XSysMonPsv_GetTempThresholdLower(XSysMonPsv *InstancePtr,
 int XSysMonPsv_ReadSupplyProcessed(XSysMonPsv *InstancePtr, int Supply,
 				   float *Val);
 int XSysMonPsv_ReadSupplyRaw(XSysMonPsv *InstancePtr, u32 Supply, u32 *Val);
+int XSysMonPsv_ReadSupplyRawAll(XSysMonPsv *InstancePtr, u32 *Val);
+int XSysMonPsv_SetSupplyStats(XSysMonPsv *InstancePtr,
+			      XSysMonPsv_SupplyStats *StatsPtr);
 int XSysMonPsv_SetSupplyThresholdUpper(XSysMonPsv *InstancePtr, u32 Supply,
 				       u32 Val);
 int XSysMonPsv_SetSupplyThresholdLower(XSysMonPsv *InstancePtr, int Supply,
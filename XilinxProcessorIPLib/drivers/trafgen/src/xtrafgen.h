@@ -96,6 +96,20 @@
 *
 * - XTrafGen_PrintAllCmds(): This function displays the list of commands.  
 *
+* <b>Traffic Profiles</b>
+*
+* Instead of programming each command by hand, a traffic pattern can be
+* described with an XTrafGen_Profile (sequential, random or strided
+* addresses, burst size, read/write mix and target bandwidth). The driver
+* then generates the Command and Parameter RAM programs:
+*
+* - XTrafGen_ProgramProfile(): Builds and writes the command list for a
+*   profile. Bandwidth is limited with per command delays.
+*
+* - XTrafGen_RunSweep(): Runs a profile once per bandwidth step and calls a
+*   user handler around each run, so that throughput can be measured, for
+*   example with the sampled counters of an AXI Performance Monitor.
+*
 * <b>Master RAM Handling</b>
 *
 * AXI Traffic Generator uses MSTRAM to 
@@ -181,6 +195,8 @@
 * 4.2   ms  04/18/17 Modified tcl file to add suffix U for all macros
 *                    definitions of trafgen in xparameters.h
 * 4.4   sd   09/03/20 Updated makefile for parallel execution.
+*       ag   10/15/26 Added traffic profile generation and bandwidth sweeps
+*                    in xtrafgen_profile.c.
 * </pre>
 ******************************************************************************/
 
@@ -230,6 +246,15 @@ extern "C" {
 #define XTG_COMMAND_RAM_SIZE	0x2000	/**< Command RAM (8KB) */
 #define XTG_MASTER_RAM_SIZE	0x2000	/**< Master RAM (8KB) */
 
+/* Traffic profile address patterns */
+#define XTG_PATTERN_SEQ		0	/**< Sequential bursts */
+#define XTG_PATTERN_RAND	1	/**< Random bursts in the region */
+#define XTG_PATTERN_STRIDE	2	/**< Bursts a fixed stride apart */
+
+/* Sweep handler events */
+#define XTG_SWEEP_STEP_START	0	/**< Step programmed, about to start */
+#define XTG_SWEEP_STEP_DONE	1	/**< Step finished or timed out */
+
 /************************** Type Definitions *****************************/
 
 /**
@@ -345,6 +370,60 @@ typedef struct XTrafGen {
 	int IsReady;	/* Device is initialized and ready */	
 } XTrafGen;
 
+/**
+ * Traffic profile
+ *
+ * Describes a traffic pattern from which XTrafGen_ProgramProfile() builds
+ * the command list. Each burst is BurstLen beats of (1 << BeatSize) bytes.
+ */
+typedef struct XTrafGen_Profile {
+	UINTPTR Address;	/**< Start of the target region */
+	u32 RegionSize;		/**< Size of the target region in bytes */
+	u32 Pattern;		/**< XTG_PATTERN_* address pattern */
+	u32 Stride;		/**< Stride in bytes for XTG_PATTERN_STRIDE */
+	u32 Seed;		/**< Seed for XTG_PATTERN_RAND */
+	u32 BurstLen;		/**< Beats per burst, 1 to 256 */
+	u32 BeatSize;		/**< Beat size, a*_size encoding */
+	u32 NumCmds;		/**< Total number of bursts */
+	u32 ReadPercent;	/**< Share of read bursts, 0 to 100 */
+	u32 TargetMBps;		/**< Target bandwidth, 0 for unthrottled */
+	u32 ClockMHz;		/**< Traffic generator clock in MHz */
+} XTrafGen_Profile;
+
+/**
+ * Result of one bandwidth sweep step
+ *
+ * The driver fills in everything but MeasuredMBps, which is left for the
+ * sweep handler to set from its own measurement.
+ */
+typedef struct XTrafGen_SweepResult {
+	u32 TargetMBps;		/**< Requested bandwidth */
+	u32 WrDelay;		/**< Delay between write bursts in clocks */
+	u32 RdDelay;		/**< Delay between read bursts in clocks */
+	u64 Bytes;		/**< Bytes transferred by the step */
+	u32 MeasuredMBps;	/**< Bandwidth reported by the handler */
+	int Status;		/**< XST_SUCCESS or failure of the step */
+} XTrafGen_SweepResult;
+
+/**
+ * Sweep handler. It is called with XTG_SWEEP_STEP_START just before the
+ * master logic is started and with XTG_SWEEP_STEP_DONE when it completes.
+ */
+typedef void (*XTrafGen_SweepHandler)(void *CallBackRef, u32 Event,
+					XTrafGen_SweepResult *ResultPtr);
+
+/**
+ * Bandwidth sweep description
+ */
+typedef struct XTrafGen_Sweep {
+	u32 StartMBps;		/**< Target bandwidth of the first step */
+	u32 EndMBps;		/**< Target bandwidth of the last step */
+	u32 StepMBps;		/**< Bandwidth increment per step */
+	u32 Timeout;		/**< Polls to wait for a step to complete */
+	XTrafGen_SweepHandler Handler;	/**< Measurement handler */
+	void *CallBackRef;	/**< Argument passed to Handler */
+} XTrafGen_Sweep;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /****************************************************************************/
@@ -1190,6 +1269,16 @@ void XTrafGen_AccessMasterRam(XTrafGen *InstancePtr, u32 Offset,
 void XTrafGen_PrintCmds(XTrafGen *InstancePtr);
 int XTrafGen_EraseAllCommands(XTrafGen *InstancePtr);
 
+/*
+ * Traffic profile functions in xtrafgen_profile.c
+ */
+int XTrafGen_ProgramProfile(XTrafGen *InstancePtr,
+				XTrafGen_Profile *ProfilePtr,
+				XTrafGen_SweepResult *ResultPtr);
+int XTrafGen_RunSweep(XTrafGen *InstancePtr, XTrafGen_Profile *ProfilePtr,
+			XTrafGen_Sweep *SweepPtr,
+			XTrafGen_SweepResult *ResultPtr, u32 NumResults);
+
 #ifdef __cplusplus
 }
 #endif
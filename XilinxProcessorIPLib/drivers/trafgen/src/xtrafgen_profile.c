@@ -0,0 +1,427 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xtrafgen_profile.c
+* @addtogroup trafgen_v4_4
+* @{
+*
+* This file implements traffic profile generation for the AXI Traffic
+* Generator. A profile describes the address pattern, burst shape,
+* read/write mix and target bandwidth of the traffic; the driver turns it
+* into Command and Parameter RAM programs using the software command list
+* of xtrafgen.c. Profiles are fully deterministic, random addresses come
+* from a seeded generator, so a run can be repeated exactly.
+*
+* Read and write commands are issued concurrently by the core, one region
+* each. The bandwidth target is split between the two regions in the same
+* ratio as the bursts and enforced with a per command delay in the
+* Parameter RAM.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 4.4   ag   10/15/26 First release
+* </pre>
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xtrafgen.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XTG_PROFILE_MAX_CMDS	(MAX_NUM_ENTRIES - 1)	/**< Commands per
+							  *  region, one entry
+							  *  is kept for the
+							  *  end marker */
+#define XTG_PROFILE_BURST_INCR	1	/**< INCR burst type */
+#define XTG_PROFILE_4K		0x1000	/**< AXI burst boundary */
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+static UINTPTR XTrafGen_ProfileAddr(XTrafGen_Profile *ProfilePtr, u32 Index,
+				u32 BurstBytes, u32 *SeedPtr);
+static u32 XTrafGen_ProfileDelay(XTrafGen_Profile *ProfilePtr,
+				u32 NumDirCmds, u32 BurstBytes);
+static int XTrafGen_ProfileAddRegion(XTrafGen *InstancePtr,
+				XTrafGen_Profile *ProfilePtr, u8 RdWrFlag,
+				u32 NumDirCmds, u32 Delay, u32 *SeedPtr);
+
+/************************** Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+* Program a traffic profile
+*
+* This function erases the command list, generates the read and write
+* commands described by the profile and writes them to the Command and
+* Parameter RAMs. The master logic is not started.
+*
+* @param        InstancePtr is a pointer to the Axi TrafGen instance to be
+*               worked on.
+* @param	ProfilePtr is a pointer to the traffic profile.
+* @param	ResultPtr is a pointer to a result structure in which the
+*		delays and byte count of the program are returned. It may be
+*		NULL.
+*
+* @return
+*		- XST_SUCCESS if successful
+*		- XST_INVALID_PARAM if the profile cannot be generated, e.g.
+*		  a burst crosses a 4 KB boundary, is wider than the master
+*		  interface, or a region needs more than 255 commands
+*		- XST_FAILURE if the core is not in Advanced or Basic mode or
+*		  programming the internal RAMs failed
+*
+* @note		Bandwidth throttling needs the Parameter RAM and so is only
+*		available in Advanced mode.
+*
+*****************************************************************************/
+int XTrafGen_ProgramProfile(XTrafGen *InstancePtr,
+				XTrafGen_Profile *ProfilePtr,
+				XTrafGen_SweepResult *ResultPtr)
+{
+	u32 BurstBytes;
+	u32 MaxBeatSize;
+	u32 NumRdCmds;
+	u32 NumWrCmds;
+	u32 WrDelay;
+	u32 RdDelay;
+	u32 Seed;
+	int Status;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(ProfilePtr != NULL);
+
+	if ((InstancePtr->OperatingMode != XTG_MODE_FULL) &&
+		(InstancePtr->OperatingMode != XTG_MODE_BASIC)) {
+		return XST_FAILURE;
+	}
+
+	MaxBeatSize = (InstancePtr->MasterWidth == XTG_MWIDTH_64) ? 3 : 2;
+	if ((ProfilePtr->BurstLen == 0) ||
+		(ProfilePtr->BurstLen > (XTG_LEN_MASK + 1)) ||
+		(ProfilePtr->BeatSize > MaxBeatSize) ||
+		(ProfilePtr->ReadPercent > 100) ||
+		(ProfilePtr->Pattern > XTG_PATTERN_STRIDE)) {
+		return XST_INVALID_PARAM;
+	}
+
+	/*
+	 * Bursts are placed on multiples of their own size, so a power of
+	 * two size up to 4 KB never crosses a 4 KB boundary.
+	 */
+	BurstBytes = ProfilePtr->BurstLen << ProfilePtr->BeatSize;
+	if (((BurstBytes & (BurstBytes - 1)) != 0) ||
+		(BurstBytes > XTG_PROFILE_4K) ||
+		(ProfilePtr->RegionSize < BurstBytes) ||
+		((ProfilePtr->Address & (BurstBytes - 1)) != 0)) {
+		return XST_INVALID_PARAM;
+	}
+
+	if ((ProfilePtr->TargetMBps != 0) &&
+		((InstancePtr->OperatingMode != XTG_MODE_FULL) ||
+		 (ProfilePtr->ClockMHz == 0))) {
+		return XST_INVALID_PARAM;
+	}
+
+	NumRdCmds = (ProfilePtr->NumCmds * ProfilePtr->ReadPercent) / 100;
+	NumWrCmds = ProfilePtr->NumCmds - NumRdCmds;
+	if ((NumRdCmds > XTG_PROFILE_MAX_CMDS) ||
+		(NumWrCmds > XTG_PROFILE_MAX_CMDS)) {
+		return XST_INVALID_PARAM;
+	}
+
+	WrDelay = XTrafGen_ProfileDelay(ProfilePtr, NumWrCmds, BurstBytes);
+	RdDelay = XTrafGen_ProfileDelay(ProfilePtr, NumRdCmds, BurstBytes);
+
+	Status = XTrafGen_EraseAllCommands(InstancePtr);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Seed = (ProfilePtr->Seed != 0) ? ProfilePtr->Seed : 1;
+
+	Status = XTrafGen_ProfileAddRegion(InstancePtr, ProfilePtr, XTG_WRITE,
+					NumWrCmds, WrDelay, &Seed);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	Status = XTrafGen_ProfileAddRegion(InstancePtr, ProfilePtr, XTG_READ,
+					NumRdCmds, RdDelay, &Seed);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	Status = XTrafGen_WriteCmdsToHw(InstancePtr);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	if (ResultPtr != NULL) {
+		ResultPtr->TargetMBps = ProfilePtr->TargetMBps;
+		ResultPtr->WrDelay = WrDelay;
+		ResultPtr->RdDelay = RdDelay;
+		ResultPtr->Bytes = (u64)ProfilePtr->NumCmds * BurstBytes;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* Run a bandwidth sweep
+*
+* This function runs the profile once for every target bandwidth from
+* StartMBps to EndMBps in steps of StepMBps. For each step the profile is
+* programmed, the sweep handler is called with XTG_SWEEP_STEP_START, the
+* master logic is started and polled for completion, and the handler is
+* called again with XTG_SWEEP_STEP_DONE. The handler is expected to start
+* and read back its throughput measurement (for example the sampled metric
+* counters of an AXI Performance Monitor on the target path) and store it
+* in MeasuredMBps.
+*
+* @param        InstancePtr is a pointer to the Axi TrafGen instance to be
+*               worked on.
+* @param	ProfilePtr is a pointer to the traffic profile. Its
+*		TargetMBps is replaced by the step bandwidth on a copy; the
+*		profile itself is not modified.
+* @param	SweepPtr is a pointer to the sweep description.
+* @param	ResultPtr is a pointer to an array receiving one result per
+*		step.
+* @param	NumResults is the number of entries in ResultPtr. The sweep
+*		stops early when the array is full.
+*
+* @return	Number of steps run. The sweep stops after the first step
+*		whose Status is not XST_SUCCESS.
+*
+*****************************************************************************/
+int XTrafGen_RunSweep(XTrafGen *InstancePtr, XTrafGen_Profile *ProfilePtr,
+			XTrafGen_Sweep *SweepPtr,
+			XTrafGen_SweepResult *ResultPtr, u32 NumResults)
+{
+	XTrafGen_Profile Profile;
+	XTrafGen_SweepResult *StepPtr;
+	u32 TargetMBps;
+	u32 NumSteps = 0;
+	u32 Poll;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(ProfilePtr != NULL);
+	Xil_AssertNonvoid(SweepPtr != NULL);
+	Xil_AssertNonvoid(ResultPtr != NULL);
+	Xil_AssertNonvoid(SweepPtr->StepMBps != 0);
+	Xil_AssertNonvoid(SweepPtr->StartMBps <= SweepPtr->EndMBps);
+	Xil_AssertNonvoid(SweepPtr->Timeout != 0);
+
+	Profile = *ProfilePtr;
+	TargetMBps = SweepPtr->StartMBps;
+
+	while (NumSteps < NumResults) {
+		StepPtr = &ResultPtr[NumSteps];
+		memset(StepPtr, 0, sizeof(XTrafGen_SweepResult));
+		NumSteps++;
+
+		Profile.TargetMBps = TargetMBps;
+		StepPtr->Status = XTrafGen_ProgramProfile(InstancePtr,
+						&Profile, StepPtr);
+		if (StepPtr->Status != XST_SUCCESS) {
+			break;
+		}
+
+		if (SweepPtr->Handler != NULL) {
+			SweepPtr->Handler(SweepPtr->CallBackRef,
+					XTG_SWEEP_STEP_START, StepPtr);
+		}
+
+		XTrafGen_StartMasterLogic(InstancePtr);
+
+		for (Poll = 0; Poll < SweepPtr->Timeout; Poll++) {
+			if (XTrafGen_IsMasterLogicDone(InstancePtr)) {
+				break;
+			}
+		}
+
+		StepPtr->Status = (Poll < SweepPtr->Timeout) ?
+					XST_SUCCESS : XST_FAILURE;
+
+		if (SweepPtr->Handler != NULL) {
+			SweepPtr->Handler(SweepPtr->CallBackRef,
+					XTG_SWEEP_STEP_DONE, StepPtr);
+		}
+
+		/* The master logic is still busy, it cannot be reprogrammed */
+		if (StepPtr->Status != XST_SUCCESS) {
+			break;
+		}
+
+		if ((SweepPtr->EndMBps - TargetMBps) < SweepPtr->StepMBps) {
+			break;
+		}
+		TargetMBps += SweepPtr->StepMBps;
+	}
+
+	return NumSteps;
+}
+
+/*****************************************************************************/
+/**
+* Compute the address of a burst
+*
+* @param	ProfilePtr is a pointer to the traffic profile.
+* @param	Index is the number of the burst within its region.
+* @param	BurstBytes is the size of a burst in bytes.
+* @param	SeedPtr is a pointer to the random generator state.
+*
+* @return	Address of the burst, aligned to BurstBytes.
+*
+*****************************************************************************/
+static UINTPTR XTrafGen_ProfileAddr(XTrafGen_Profile *ProfilePtr, u32 Index,
+				u32 BurstBytes, u32 *SeedPtr)
+{
+	u32 NumSlots;
+	u32 Offset;
+	u32 Seed;
+
+	NumSlots = ProfilePtr->RegionSize / BurstBytes;
+
+	switch (ProfilePtr->Pattern) {
+	case XTG_PATTERN_RAND:
+		/* xorshift32, repeatable for a given seed */
+		Seed = *SeedPtr;
+		Seed ^= Seed << 13;
+		Seed ^= Seed >> 17;
+		Seed ^= Seed << 5;
+		*SeedPtr = Seed;
+		Offset = (Seed % NumSlots) * BurstBytes;
+		break;
+
+	case XTG_PATTERN_STRIDE:
+		Offset = (u32)(((u64)Index * ProfilePtr->Stride) %
+				((u64)NumSlots * BurstBytes));
+		Offset &= ~(BurstBytes - 1);
+		break;
+
+	default:
+		Offset = (Index % NumSlots) * BurstBytes;
+		break;
+	}
+
+	return ProfilePtr->Address + Offset;
+}
+
+/*****************************************************************************/
+/**
+* Compute the delay between the bursts of one region
+*
+* The region gets a share of the target bandwidth in proportion to its
+* number of bursts. The delay is the number of clocks per burst needed to
+* stay at that share, less the clocks the burst itself occupies.
+*
+* @param	ProfilePtr is a pointer to the traffic profile.
+* @param	NumDirCmds is the number of bursts in the region.
+* @param	BurstBytes is the size of a burst in bytes.
+*
+* @return	Delay in clocks, 0 if the region is not throttled.
+*
+*****************************************************************************/
+static u32 XTrafGen_ProfileDelay(XTrafGen_Profile *ProfilePtr,
+				u32 NumDirCmds, u32 BurstBytes)
+{
+	u64 Clocks;
+
+	if ((ProfilePtr->TargetMBps == 0) || (NumDirCmds == 0)) {
+		return 0;
+	}
+
+	Clocks = ((u64)BurstBytes * ProfilePtr->ClockMHz *
+			ProfilePtr->NumCmds) /
+			((u64)ProfilePtr->TargetMBps * NumDirCmds);
+
+	if (Clocks <= ProfilePtr->BurstLen) {
+		return 0;
+	}
+
+	Clocks -= ProfilePtr->BurstLen;
+	if (Clocks > XTG_PARAM_COUNT_MASK) {
+		Clocks = XTG_PARAM_COUNT_MASK;
+	}
+
+	return (u32)Clocks;
+}
+
+/*****************************************************************************/
+/**
+* Add the commands of one region
+*
+* Adds NumDirCmds bursts followed by an invalid command which ends the
+* region.
+*
+* @param        InstancePtr is a pointer to the Axi TrafGen instance to be
+*               worked on.
+* @param	ProfilePtr is a pointer to the traffic profile.
+* @param	RdWrFlag specifies Read or Write Region
+* @param	NumDirCmds is the number of bursts to add.
+* @param	Delay is the delay before each burst in clocks.
+* @param	SeedPtr is a pointer to the random generator state.
+*
+* @return
+*		- XST_SUCCESS if successful
+*		- XST_FAILURE if the command list is full
+*
+*****************************************************************************/
+static int XTrafGen_ProfileAddRegion(XTrafGen *InstancePtr,
+				XTrafGen_Profile *ProfilePtr, u8 RdWrFlag,
+				u32 NumDirCmds, u32 Delay, u32 *SeedPtr)
+{
+	XTrafGen_Cmd Cmd;
+	u32 BurstBytes;
+	u32 Index;
+	int Status;
+
+	if (NumDirCmds == 0) {
+		return XST_SUCCESS;
+	}
+
+	BurstBytes = ProfilePtr->BurstLen << ProfilePtr->BeatSize;
+
+	memset(&Cmd, 0, sizeof(XTrafGen_Cmd));
+	Cmd.RdWrFlag = RdWrFlag;
+	Cmd.CRamCmd.Length = ProfilePtr->BurstLen - 1;
+	Cmd.CRamCmd.Size = ProfilePtr->BeatSize;
+	Cmd.CRamCmd.Burst = XTG_PROFILE_BURST_INCR;
+	Cmd.CRamCmd.ValidCmd = 1;
+	if (Delay != 0) {
+		Cmd.PRamCmd.Opcode = XTG_PARAM_OP_DELAY;
+		Cmd.PRamCmd.OpCntl0 = Delay;
+	}
+
+	for (Index = 0; Index < NumDirCmds; Index++) {
+		Cmd.CRamCmd.Address = XTrafGen_ProfileAddr(ProfilePtr, Index,
+						BurstBytes, SeedPtr);
+		Status = XTrafGen_AddCommand(InstancePtr, &Cmd);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+
+	/* End of region marker */
+	memset(&Cmd, 0, sizeof(XTrafGen_Cmd));
+	Cmd.RdWrFlag = RdWrFlag;
+
+	return XTrafGen_AddCommand(InstancePtr, &Cmd);
+}
+/** @} */
@@ -26,6 +26,7 @@
 * 3.5	NK     09/26/17 Fix the RX Buffer Overflow issue.
 * 3.7   aru    08/17/18 Resolved MISRA-C mandatory violations.(CR#1007755)
 * 3.9   sd     02/06/20 Added clock support
+* 3.11  ag     10/14/26 Initialize the streaming transmit mode state.
 * </pre>
 *
 *****************************************************************************/
@@ -139,6 +140,9 @@ s32 XUartPs_CfgInitialize(XUartPs *InstancePtr,
 
 	InstancePtr->is_rxbs_error = 0U;
 
+	InstancePtr->TxRingEnabled = 0U;
+	InstancePtr->TxRingSent = 0U;
+
 	/* Flag that the driver instance is ready to use */
 	InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
 
@@ -147,6 +147,8 @@
 * 3.7   aru    08/17/18 Resolved MISRA-C:2012 compliance mandatory violations.
 * 3.9   rna    12/03/19 Modified the XUARTPS_MAX_RATE macro.
 * 3.9   sd     02/06/20 Added clock support
+* 3.11  ag     10/14/26 Added streaming transmit mode with a driver owned
+*                       TX ring, XUartPs_TxRingInit and XUartPs_TxRingWrite.
 *
 * </pre>
 *
@@ -166,6 +168,7 @@ extern "C" {
 #include "xstatus.h"
 #include "xuartps_hw.h"
 #include "xplatform_info.h"
+#include "xil_ring.h"
 #if defined  (XCLOCKING)
 #include "xil_clocking.h"
 #endif
@@ -182,6 +185,8 @@ extern "C" {
 
 #define XUARTPS_DFT_BAUDRATE  115200U   /* Default baud rate */
 
+#define XUARTPS_FIFO_DEPTH	64U	/**< Depth of the TX and RX FIFOs */
+
 /** @name Configuration options
  * @{
  */
@@ -332,6 +337,10 @@ typedef struct {
 	void *CallBackRef;	/* Callback reference for event handler */
 	u32 Platform;
 	u8 is_rxbs_error;
+
+	Xil_Ring TxRing;	/* Ring of the streaming transmit mode */
+	u32 TxRingEnabled;	/* Streaming transmit mode is active */
+	u32 TxRingSent;		/* Bytes sent since the last SENT_DATA event */
 } XUartPs;
 
 
@@ -454,6 +463,14 @@ u32 XUartPs_Recv(XUartPs *InstancePtr,u8 *BufferPtr,
 
 s32 XUartPs_SetBaudRate(XUartPs *InstancePtr, u32 BaudRate);
 
+/* Streaming transmit functions in xuartps_txring.c */
+s32 XUartPs_TxRingInit(XUartPs *InstancePtr, u8 *StoragePtr, u32 NumBytes);
+
+u32 XUartPs_TxRingWrite(XUartPs *InstancePtr, const u8 *BufferPtr,
+			   u32 NumBytes);
+
+u32 XUartPs_TxRingPending(XUartPs *InstancePtr);
+
 /* Options functions in xuartps_options.c */
 void XUartPs_SetOptions(XUartPs *InstancePtr, u16 Options);
 
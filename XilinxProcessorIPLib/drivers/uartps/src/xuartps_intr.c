@@ -21,6 +21,8 @@
 * 3.00  kvn    02/13/15 Modified code for MISRA-C:2012 compliance.
 * 3.1	kvn    04/10/15 Modified code for latest RTL changes.
 * 3.7   aru    08/17/18 Resolved MISRA-C mandatory violations.(CR#1007755)
+* 3.11  ag     10/14/26 Refill the TX FIFO from the TX ring in streaming
+*                       transmit mode.
 * </pre>
 *
 *****************************************************************************/
@@ -48,6 +50,9 @@ static void ModemHandler(XUartPs *InstancePtr);
 extern u32 XUartPs_ReceiveBuffer(XUartPs *InstancePtr);
 extern u32 XUartPs_SendBuffer(XUartPs *InstancePtr);
 
+/* Internal function prototype implemented in xuartps_txring.c */
+extern void XUartPs_TxRingHandler(XUartPs *InstancePtr);
+
 /************************** Variable Definitions ****************************/
 
 typedef void (*Handler)(XUartPs *InstancePtr);
@@ -363,11 +368,15 @@ static void SendDataHandler(XUartPs *InstancePtr, u32 IsrStatus)
 {
 
 	/*
-	 * If there are not bytes to be sent from the specified buffer then disable
-	 * the transmit interrupt so it will stop interrupting as it interrupts
-	 * any time the FIFO is empty
+	 * In streaming transmit mode the FIFO is refilled from the TX ring.
+	 * Otherwise, if there are not bytes to be sent from the specified
+	 * buffer then disable the transmit interrupt so it will stop
+	 * interrupting as it interrupts any time the FIFO is empty
 	 */
-	if (InstancePtr->SendBuffer.RemainingBytes == (u32)0) {
+	if (InstancePtr->TxRingEnabled != (u32)0) {
+		XUartPs_TxRingHandler(InstancePtr);
+	}
+	else if (InstancePtr->SendBuffer.RemainingBytes == (u32)0) {
 		XUartPs_WriteReg(InstancePtr->Config.BaseAddress,
 				XUARTPS_IDR_OFFSET,
 				((u32)XUARTPS_IXR_TXEMPTY | (u32)XUARTPS_IXR_TXFULL));
@@ -0,0 +1,233 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+*
+* @file xuartps_txring.c
+* @addtogroup uartps_v3_11
+* @{
+*
+* This file contains the streaming transmit mode of the XUartPs driver. In
+* this mode XUartPs_TxRingWrite copies data into a ring owned by the driver
+* and returns immediately. The TX FIFO is then refilled in bursts from the
+* TX empty interrupt, so the caller never waits for the FIFO.
+*
+* The interrupt handler XUartPs_InterruptHandler must be connected to the
+* interrupt controller. XUartPs_TxRingWrite and the interrupt handler must
+* run on the same processor core.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date	Changes
+* ----- ------ -------- -----------------------------------------------
+* 3.11  ag     10/14/26 First Release
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+
+#include "xuartps.h"
+
+/************************** Constant Definitions ****************************/
+
+/**************************** Type Definitions ******************************/
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+/************************** Function Prototypes *****************************/
+
+static u32 XUartPs_TxRingFill(XUartPs *InstancePtr);
+
+void XUartPs_TxRingHandler(XUartPs *InstancePtr);
+
+/************************** Variable Definitions ****************************/
+
+/****************************************************************************/
+/**
+*
+* This function enables the streaming transmit mode. Data passed to
+* XUartPs_TxRingWrite is held in the given storage until it is moved into
+* the TX FIFO by the interrupt handler.
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+* @param	StoragePtr is a pointer to the ring storage.
+* @param	NumBytes is the size of the storage, it must be a power of two.
+*
+* @return
+*		- XST_SUCCESS if the streaming transmit mode is enabled.
+*		- XST_INVALID_PARAM if NumBytes is not a power of two.
+*
+* @note		XUartPs_Send must not be used while the streaming transmit
+*		mode is enabled.
+*
+*****************************************************************************/
+s32 XUartPs_TxRingInit(XUartPs *InstancePtr, u8 *StoragePtr, u32 NumBytes)
+{
+	s32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(StoragePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	/* Stop the TX empty interrupt while the ring is set up */
+	XUartPs_WriteReg(InstancePtr->Config.BaseAddress, XUARTPS_IDR_OFFSET,
+			 (u32)XUARTPS_IXR_TXEMPTY);
+
+	Status = Xil_RingInit(&InstancePtr->TxRing, StoragePtr, NumBytes, 1U);
+	if (Status == (s32)XST_SUCCESS) {
+		InstancePtr->TxRingSent = 0U;
+		InstancePtr->TxRingEnabled = 1U;
+	}
+
+	return Status;
+}
+
+/****************************************************************************/
+/**
+*
+* This function queues data for transmission in streaming transmit mode and
+* returns without waiting for the data to be sent. The TX FIFO is topped up
+* immediately and the TX empty interrupt is enabled while data remains in
+* the TX ring.
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+* @param	BufferPtr is a pointer to the data to be sent.
+* @param	NumBytes is the number of bytes to be sent.
+*
+* @return	The number of bytes queued, less than NumBytes if the TX ring
+*		does not have enough room.
+*
+* @note		The application handler is called with XUARTPS_EVENT_SENT_DATA
+*		each time the TX ring becomes empty.
+*
+*****************************************************************************/
+u32 XUartPs_TxRingWrite(XUartPs *InstancePtr, const u8 *BufferPtr,
+			   u32 NumBytes)
+{
+	u32 Queued;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(BufferPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(InstancePtr->TxRingEnabled != (u32)0);
+
+	Queued = Xil_RingEnqueueBulk(&InstancePtr->TxRing, BufferPtr, NumBytes);
+
+	/*
+	 * Keep the interrupt handler off the ring while the FIFO is topped up
+	 * from here, and drop a stale TX empty status so that the interrupt
+	 * only fires once the FIFO drains again.
+	 */
+	XUartPs_WriteReg(InstancePtr->Config.BaseAddress, XUARTPS_IDR_OFFSET,
+			 (u32)XUARTPS_IXR_TXEMPTY);
+	XUartPs_WriteReg(InstancePtr->Config.BaseAddress, XUARTPS_ISR_OFFSET,
+			 (u32)XUARTPS_IXR_TXEMPTY);
+
+	InstancePtr->TxRingSent += XUartPs_TxRingFill(InstancePtr);
+
+	if (Xil_RingCount(&InstancePtr->TxRing) != (u32)0) {
+		XUartPs_WriteReg(InstancePtr->Config.BaseAddress,
+				 XUARTPS_IER_OFFSET, (u32)XUARTPS_IXR_TXEMPTY);
+	}
+
+	return Queued;
+}
+
+/****************************************************************************/
+/**
+*
+* This function returns the number of bytes waiting in the TX ring. Bytes
+* already moved into the TX FIFO are not included.
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+*
+* @return	The number of bytes in the TX ring.
+*
+* @note		None.
+*
+*****************************************************************************/
+u32 XUartPs_TxRingPending(XUartPs *InstancePtr)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	return Xil_RingCount(&InstancePtr->TxRing);
+}
+
+/****************************************************************************/
+/*
+*
+* This function handles the TX empty interrupt in streaming transmit mode.
+* It refills the TX FIFO from the TX ring and disables the interrupt once
+* the ring is empty.
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+void XUartPs_TxRingHandler(XUartPs *InstancePtr)
+{
+	u32 Sent;
+
+	InstancePtr->TxRingSent += XUartPs_TxRingFill(InstancePtr);
+
+	if (Xil_RingCount(&InstancePtr->TxRing) == (u32)0) {
+		XUartPs_WriteReg(InstancePtr->Config.BaseAddress,
+				 XUARTPS_IDR_OFFSET, (u32)XUARTPS_IXR_TXEMPTY);
+
+		Sent = InstancePtr->TxRingSent;
+		InstancePtr->TxRingSent = 0U;
+		InstancePtr->Handler(InstancePtr->CallBackRef,
+				     XUARTPS_EVENT_SENT_DATA, Sent);
+	}
+}
+
+/****************************************************************************/
+/*
+*
+* This function moves data from the TX ring into the TX FIFO. An empty FIFO
+* is filled with a single burst of up to XUARTPS_FIFO_DEPTH bytes, otherwise
+* bytes are written until the FIFO is full.
+*
+* @param	InstancePtr is a pointer to the XUartPs instance.
+*
+* @return	The number of bytes written to the TX FIFO.
+*
+* @note		None.
+*
+*****************************************************************************/
+static u32 XUartPs_TxRingFill(XUartPs *InstancePtr)
+{
+	u8 Burst[XUARTPS_FIFO_DEPTH];
+	u32 BaseAddress = InstancePtr->Config.BaseAddress;
+	u32 Count = 0U;
+	u32 Index;
+
+	if ((XUartPs_ReadReg(BaseAddress, XUARTPS_SR_OFFSET) &
+	     (u32)XUARTPS_SR_TXEMPTY) != (u32)0) {
+		Count = Xil_RingDequeueBulk(&InstancePtr->TxRing, Burst,
+					    XUARTPS_FIFO_DEPTH);
+		for (Index = 0U; Index < Count; Index++) {
+			XUartPs_WriteReg(BaseAddress, XUARTPS_FIFO_OFFSET,
+					 (u32)Burst[Index]);
+		}
+	} else {
+		while ((!XUartPs_IsTransmitFull(BaseAddress)) &&
+		       (Xil_RingPop(&InstancePtr->TxRing, Burst) ==
+			(s32)XST_SUCCESS)) {
+			XUartPs_WriteReg(BaseAddress, XUARTPS_FIFO_OFFSET,
+					 (u32)Burst[0]);
+			Count++;
+		}
+	}
+
+	return Count;
+}
+/** @} */
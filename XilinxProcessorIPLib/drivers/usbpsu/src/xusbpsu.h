@@ -91,6 +91,8 @@
 * 1.8	pm    24/07/20 Fixed MISRA-C and Coverity warnings
 * 1.9	pm    03/21/21 Fixed doxygen warnings
 * 1.10	pm    08/30/21 Update MACRO to fix plm compilation warnings
+* 1.12	ag    10/15/26 Added queued and circular multi TRB transfers for bulk
+*			and interrupt endpoints
 *
 * </pre>
 *
@@ -133,7 +135,9 @@ extern "C" {
 /************************** Constant Definitions ****************************/
 
 /** @cond INTERNAL */
+#ifndef NO_OF_TRB_PER_EP
 #define NO_OF_TRB_PER_EP		4U	/**< number of TRB*/
+#endif
 
 #if defined (PLATFORM_ZYNQMP) || defined (versal)
 #define ALIGNMENT_CACHELINE		__attribute__ ((aligned(64)))
@@ -183,6 +187,10 @@ extern "C" {
 						/**< EP status pending request */
 #define XUSBPSU_EP_MISSED_ISOC		(0x00000001U << 6U)
 						/**< EP status missed ISOC */
+#define XUSBPSU_EP_QUEUED		(0x00000001U << 7U)
+						/**< EP status queued transfers */
+#define XUSBPSU_EP_CIRCULAR		(0x00000001U << 8U)
+						/**< EP status circular queue */
 
 #define	XUSBPSU_GHWPARAMS0		0U	/**< Global Hardware Parameter Register 0 */
 #define	XUSBPSU_GHWPARAMS1		1U	/**< Global Hardware Parameter Register 1 */
@@ -453,6 +461,9 @@ typedef struct {
  * @param Type: Type of Endpoint - Control/BULK/INTERRUPT/ISOC
  * @param Direction: Direction - EP_DIR_OUT/EP_DIR_IN
  * @param UnalignedTx: Unaligned Tx flag - 0/1
+ * @param QueueBufPtr: Buffer of each queued TRB
+ * @param QueueLen: Length of each queued TRB
+ * @param QueueCount: Number of queued TRBs owned by the core
  */
 struct XUsbPsu_Ep {
 	void (*Handler)(void *, u32, u32);
@@ -493,6 +504,15 @@ struct XUsbPsu_Ep {
 				 */
 	u8	Direction;	/**< Direction - EP_DIR_OUT/EP_DIR_IN */
 	u8	UnalignedTx;	/**< Unaligned Tx flag - 0/1 */
+	u8	*QueueBufPtr[NO_OF_TRB_PER_EP];	/**< Buffer of each
+						 *   queued TRB
+						 */
+	u32	QueueLen[NO_OF_TRB_PER_EP];	/**< Length of each
+						 *   queued TRB
+						 */
+	u32	QueueCount;	/**< Number of queued TRBs owned by the
+				 *   core
+				 */
 }; /**< Endpoint representation */
 
 /**
@@ -924,6 +944,10 @@ void XUsbPsu_SetEpHandler(struct XUsbPsu *InstancePtr, u8 Epnum,
 s32 XUsbPsu_IsEpStalled(struct XUsbPsu *InstancePtr, u8 Epnum, u8 Dir);
 void XUsbPsu_StopTransfer(struct XUsbPsu *InstancePtr, u8 UsbEpNum,
 				u8 Dir, u8 Force);
+s32 XUsbPsu_EpQueueEnable(struct XUsbPsu *InstancePtr, u8 UsbEpNum,
+				u8 Dir, u8 Circular);
+void XUsbPsu_EpQueueDisable(struct XUsbPsu *InstancePtr, u8 UsbEpNum,
+				u8 Dir);
 
 /*
  * Functions in xusbpsu_intr.c
@@ -27,6 +27,8 @@
 * 1.7 	pm  23/03/20 Restructured the code for more readability and modularity
 * 1.8	pm  24/07/20 Fixed MISRA-C and Coverity warnings
 * 1.12	pm  10/08/22 Update doxygen tag and addtogroup version
+*	ag  10/15/26 Enable XferInProgress events on bulk and interrupt
+*		     endpoints for queued transfers
 *
 * </pre>
 *
@@ -193,6 +195,12 @@ s32 XUsbPsu_SetEpConfig(struct XUsbPsu *InstancePtr, u8 UsbEpNum, u8 Dir,
 		Params->Param1 |= XUSBPSU_DEPCFG_BINTERVAL_M1(Ept->Interval -
 									 1U);
 		Params->Param1 |= XUSBPSU_DEPCFG_XFER_IN_PROGRESS_EN;
+	} else if ((Ept->Type == XUSBPSU_ENDPOINT_XFER_BULK) ||
+			(Ept->Type == XUSBPSU_ENDPOINT_XFER_INT)) {
+		/* Reports each completed TRB of a queued transfer */
+		Params->Param1 |= XUSBPSU_DEPCFG_XFER_IN_PROGRESS_EN;
+	} else {
+		/* Do Nothing. Added for making MISRA-C complaint */
 	}
 
 	return XUsbPsu_SendEpCmd(InstancePtr, UsbEpNum, Dir,
@@ -19,6 +19,7 @@
 * 1.0   pm  03/23/20 First release
 * 1.8	pm  24/07/20 Fixed MISRA-C and Coverity warnings
 * 1.12	pm  10/08/22 Update doxygen tag and addtogroup version
+*	ag  10/15/26 Added queued and circular multi TRB transfers
 *
 * </pre>
 *
@@ -35,6 +36,19 @@
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /************************** Function Prototypes ******************************/
+static void XUsbPsu_EpQueueReset(struct XUsbPsu *InstancePtr,
+				struct XUsbPsu_Ep *Ept);
+static void XUsbPsu_EpQueueFillTrb(struct XUsbPsu *InstancePtr,
+				struct XUsbPsu_Ep *Ept, u8 *BufferPtr,
+				u32 Length);
+static s32 XUsbPsu_EpQueueKick(struct XUsbPsu *InstancePtr,
+				struct XUsbPsu_Ep *Ept);
+static s32 XUsbPsu_EpQueueBuffer(struct XUsbPsu *InstancePtr,
+				struct XUsbPsu_Ep *Ept, u8 *BufferPtr,
+				u32 Length);
+static void XUsbPsu_EpQueueComplete(struct XUsbPsu *InstancePtr,
+				struct XUsbPsu_Ep *Ept,
+				const struct XUsbPsu_Event_Epevt *Event);
 
 /************************** Variable Definitions *****************************/
 
@@ -93,6 +107,11 @@ void XUsbPsu_StopTransfer(struct XUsbPsu *InstancePtr, u8 UsbEpNum,
 
 	Ept->EpStatus &= ~XUSBPSU_EP_BUSY;
 	XUsbPsu_Sleep(100U);
+
+	/* Buffers still queued are dropped with the transfer */
+	if ((Ept->EpStatus & XUSBPSU_EP_QUEUED) != 0U) {
+		XUsbPsu_EpQueueReset(InstancePtr, Ept);
+	}
 }
 
 /****************************************************************************/
@@ -247,6 +266,11 @@ s32 XUsbPsu_EpBufferSend(struct XUsbPsu *InstancePtr, u8 UsbEp,
 		return (s32)XST_FAILURE;
 	}
 
+	if ((Ept->EpStatus & XUSBPSU_EP_QUEUED) != 0U) {
+		return XUsbPsu_EpQueueBuffer(InstancePtr, Ept, BufferPtr,
+						BufferLen);
+	}
+
 	Ept->RequestedBytes = BufferLen;
 	Ept->BytesTxed = 0U;
 	Ept->BufferPtr = BufferPtr;
@@ -396,6 +420,11 @@ s32 XUsbPsu_EpBufferRecv(struct XUsbPsu *InstancePtr, u8 UsbEp,
 		return (s32)XST_FAILURE;
 	}
 
+	if ((Ept->EpStatus & XUSBPSU_EP_QUEUED) != 0U) {
+		return XUsbPsu_EpQueueBuffer(InstancePtr, Ept, BufferPtr,
+						Length);
+	}
+
 	Ept->RequestedBytes = Length;
 	Size = Length;
 	Ept->BytesTxed = 0U;
@@ -678,6 +707,12 @@ void XUsbPsu_EpXferComplete(struct XUsbPsu *InstancePtr,
 
 	Epnum = Event->Epnumber;
 	Ept = &InstancePtr->eps[Epnum];
+
+	if ((Ept->EpStatus & XUSBPSU_EP_QUEUED) != 0U) {
+		XUsbPsu_EpQueueComplete(InstancePtr, Ept, Event);
+		return;
+	}
+
 	Dir = Ept->Direction;
 	TrbPtr = &Ept->EpTrb[Ept->TrbDequeue];
 
@@ -734,6 +769,374 @@ void XUsbPsu_EpXferComplete(struct XUsbPsu *InstancePtr,
 	}
 }
 
+/****************************************************************************/
+/**
+* @brief
+* Switches a bulk or interrupt Endpoint to queued transfers.
+*
+* In queued mode every XUsbPsu_EpBufferSend()/XUsbPsu_EpBufferRecv() call
+* adds one TRB to the endpoint TRB ring instead of starting a new transfer,
+* so up to NO_OF_TRB_PER_EP buffers can be owned by the core at a time and
+* the pipe does not drain between buffers. The endpoint handler is called
+* once per completed buffer, with BufferPtr of the endpoint pointing to it.
+* In circular mode each completed buffer is handed back to the core right
+* after the handler returns, which gives a continuous transfer over a fixed
+* set of buffers.
+*
+* @param	InstancePtr is a pointer to the XUsbPsu instance.
+* @param	UsbEpNum is USB endpoint number.
+* @param	Dir is direction of endpoint
+* 				- XUSBPSU_EP_DIR_IN/XUSBPSU_EP_DIR_OUT.
+* @param	Circular is TRUE to requeue buffers on completion.
+*
+* @return	XST_SUCCESS else XST_FAILURE.
+*
+* @note		The endpoint must be enabled and idle. Queued OUT buffers
+*		must be a multiple of the maximum packet size. The mode is
+*		cleared when the endpoint is disabled.
+*
+****************************************************************************/
+s32 XUsbPsu_EpQueueEnable(struct XUsbPsu *InstancePtr, u8 UsbEpNum,
+				u8 Dir, u8 Circular)
+{
+	struct XUsbPsu_Ep *Ept;
+	u8 PhyEpNum;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid((UsbEpNum > (u8)0U) && (UsbEpNum <= (u8)16U));
+	Xil_AssertNonvoid((Dir == XUSBPSU_EP_DIR_IN) ||
+						(Dir == XUSBPSU_EP_DIR_OUT));
+
+	PhyEpNum = XUSBPSU_PhysicalEp(UsbEpNum, Dir);
+	Ept = &InstancePtr->eps[PhyEpNum];
+
+	if (((Ept->EpStatus & XUSBPSU_EP_ENABLED) == 0U) ||
+		((Ept->EpStatus & XUSBPSU_EP_BUSY) != 0U)) {
+		return (s32)XST_FAILURE;
+	}
+
+	if ((Ept->Type != XUSBPSU_ENDPOINT_XFER_BULK) &&
+		(Ept->Type != XUSBPSU_ENDPOINT_XFER_INT)) {
+		return (s32)XST_FAILURE;
+	}
+
+	XUsbPsu_EpQueueReset(InstancePtr, Ept);
+
+	Ept->EpStatus |= XUSBPSU_EP_QUEUED;
+	if (Circular == (u8)TRUE) {
+		Ept->EpStatus |= XUSBPSU_EP_CIRCULAR;
+	} else {
+		Ept->EpStatus &= ~XUSBPSU_EP_CIRCULAR;
+	}
+
+	return (s32)XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+* @brief
+* Returns an Endpoint to single buffer transfers.
+*
+* Any queued transfer is ended and its buffers are dropped without calling
+* the endpoint handler.
+*
+* @param	InstancePtr is a pointer to the XUsbPsu instance.
+* @param	UsbEpNum is USB endpoint number.
+* @param	Dir is direction of endpoint
+* 				- XUSBPSU_EP_DIR_IN/XUSBPSU_EP_DIR_OUT.
+*
+* @return	None.
+*
+* @note		None.
+*
+****************************************************************************/
+void XUsbPsu_EpQueueDisable(struct XUsbPsu *InstancePtr, u8 UsbEpNum,
+				u8 Dir)
+{
+	struct XUsbPsu_Ep *Ept;
+	u8 PhyEpNum;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid((UsbEpNum > (u8)0U) && (UsbEpNum <= (u8)16U));
+	Xil_AssertVoid((Dir == XUSBPSU_EP_DIR_IN) ||
+						(Dir == XUSBPSU_EP_DIR_OUT));
+
+	PhyEpNum = XUSBPSU_PhysicalEp(UsbEpNum, Dir);
+	Ept = &InstancePtr->eps[PhyEpNum];
+
+	if ((Ept->EpStatus & XUSBPSU_EP_QUEUED) == 0U) {
+		return;
+	}
+
+	if ((Ept->EpStatus & XUSBPSU_EP_BUSY) != 0U) {
+		XUsbPsu_StopTransfer(InstancePtr, UsbEpNum, Dir, (u8)TRUE);
+	}
+
+	XUsbPsu_EpQueueReset(InstancePtr, Ept);
+	Ept->EpStatus &= ~(XUSBPSU_EP_QUEUED | XUSBPSU_EP_CIRCULAR);
+}
+
+/****************************************************************************/
+/**
+* Empties the TRB ring of a queued Endpoint.
+*
+* @param	InstancePtr is a pointer to the XUsbPsu instance.
+* @param	Ept is a pointer to the Endpoint.
+*
+* @return	None.
+*
+* @note		The HWO bit of every ring TRB is cleared so that a new
+*		transfer cannot run into TRBs left from the previous one.
+*
+****************************************************************************/
+static void XUsbPsu_EpQueueReset(struct XUsbPsu *InstancePtr,
+				struct XUsbPsu_Ep *Ept)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < NO_OF_TRB_PER_EP; Index++) {
+		Ept->EpTrb[Index].Ctrl = 0U;
+		Ept->QueueBufPtr[Index] = NULL;
+		Ept->QueueLen[Index] = 0U;
+	}
+
+	if (InstancePtr->ConfigPtr->IsCacheCoherent == (u8)0U) {
+		Xil_DCacheFlushRange((INTPTR)&Ept->EpTrb[0U],
+			NO_OF_TRB_PER_EP * sizeof(struct XUsbPsu_Trb));
+	}
+
+	Ept->QueueCount = 0U;
+	Ept->TrbEnqueue = 0U;
+	Ept->TrbDequeue = 0U;
+}
+
+/****************************************************************************/
+/**
+* Fills the next free TRB of a queued Endpoint and hands it to the core.
+*
+* @param	InstancePtr is a pointer to the XUsbPsu instance.
+* @param	Ept is a pointer to the Endpoint.
+* @param	BufferPtr is pointer to data.
+* @param	Length is length of the buffer.
+*
+* @return	None.
+*
+* @note		The caller checks that a TRB is free. The TRB has no LST bit,
+*		so the core follows the Link TRB to the next one and the
+*		transfer stays active.
+*
+****************************************************************************/
+static void XUsbPsu_EpQueueFillTrb(struct XUsbPsu *InstancePtr,
+				struct XUsbPsu_Ep *Ept, u8 *BufferPtr,
+				u32 Length)
+{
+	struct XUsbPsu_Trb *TrbPtr;
+	u32 Slot;
+
+	Slot = Ept->TrbEnqueue;
+	TrbPtr = &Ept->EpTrb[Slot];
+
+	Ept->QueueBufPtr[Slot] = BufferPtr;
+	Ept->QueueLen[Slot] = Length;
+
+	Ept->TrbEnqueue++;
+	if (Ept->TrbEnqueue == NO_OF_TRB_PER_EP) {
+		Ept->TrbEnqueue = 0U;
+	}
+	Ept->QueueCount++;
+
+	if (InstancePtr->ConfigPtr->IsCacheCoherent == (u8)0U) {
+		if (Ept->Direction == XUSBPSU_EP_DIR_IN) {
+			Xil_DCacheFlushRange((INTPTR)BufferPtr, Length);
+		} else {
+			Xil_DCacheInvalidateRange((INTPTR)BufferPtr, Length);
+		}
+	}
+
+	TrbPtr->BufferPtrLow  = (UINTPTR)BufferPtr;
+	TrbPtr->BufferPtrHigh = ((UINTPTR)BufferPtr >> 16U) >> 16U;
+	TrbPtr->Size = Length & XUSBPSU_TRB_SIZE_MASK;
+	TrbPtr->Ctrl = (XUSBPSU_TRBCTL_NORMAL
+			| XUSBPSU_TRB_CTRL_CSP
+			| XUSBPSU_TRB_CTRL_IOC
+			| XUSBPSU_TRB_CTRL_ISP_IMI
+			| XUSBPSU_TRB_CTRL_HWO);
+
+	if (InstancePtr->ConfigPtr->IsCacheCoherent == (u8)0U) {
+		Xil_DCacheFlushRange((INTPTR)TrbPtr,
+					 sizeof(struct XUsbPsu_Trb));
+	}
+}
+
+/****************************************************************************/
+/**
+* Tells the core about newly queued TRBs.
+*
+* Starts the transfer at the oldest queued TRB if the Endpoint is idle,
+* otherwise updates the running transfer.
+*
+* @param	InstancePtr is a pointer to the XUsbPsu instance.
+* @param	Ept is a pointer to the Endpoint.
+*
+* @return	XST_SUCCESS else XST_FAILURE
+*
+* @note		None.
+*
+****************************************************************************/
+static s32 XUsbPsu_EpQueueKick(struct XUsbPsu *InstancePtr,
+				struct XUsbPsu_Ep *Ept)
+{
+	struct XUsbPsu_EpParams Params;
+	u32 cmd;
+	s32 RetVal;
+
+	Params.Param0 = 0U;
+	Params.Param2 = 0U;
+
+	if ((Ept->EpStatus & XUSBPSU_EP_BUSY) != (u32)0U) {
+		Params.Param1 = 0U;
+		cmd = XUSBPSU_DEPCMD_UPDATETRANSFER;
+		cmd |= XUSBPSU_DEPCMD_PARAM(Ept->ResourceIndex);
+	} else {
+		Params.Param1 = (UINTPTR)&Ept->EpTrb[Ept->TrbDequeue];
+		cmd = XUSBPSU_DEPCMD_STARTTRANSFER;
+	}
+
+	RetVal = XUsbPsu_SendEpCmd(InstancePtr, Ept->UsbEpNum,
+					Ept->Direction, cmd, &Params);
+	if (RetVal != (s32)XST_SUCCESS) {
+		return (s32)XST_FAILURE;
+	}
+
+	if ((Ept->EpStatus & XUSBPSU_EP_BUSY) == (u32)0U) {
+		Ept->ResourceIndex = (u8)XUsbPsu_EpGetTransferIndex(InstancePtr,
+				Ept->UsbEpNum,
+				Ept->Direction);
+
+		Ept->EpStatus |= XUSBPSU_EP_BUSY;
+	}
+
+	return (s32)XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+* Adds a buffer to the TRB ring of a queued Endpoint.
+*
+* @param	InstancePtr is a pointer to the XUsbPsu instance.
+* @param	Ept is a pointer to the Endpoint.
+* @param	BufferPtr is pointer to data. This data buffer is cache-aligned.
+* @param	Length is length of the buffer.
+*
+* @return	XST_SUCCESS else XST_FAILURE if the ring is full or an OUT
+*		buffer is not a multiple of the maximum packet size.
+*
+* @note		None.
+*
+****************************************************************************/
+static s32 XUsbPsu_EpQueueBuffer(struct XUsbPsu *InstancePtr,
+				struct XUsbPsu_Ep *Ept, u8 *BufferPtr,
+				u32 Length)
+{
+	if (Ept->QueueCount == NO_OF_TRB_PER_EP) {
+		return (s32)XST_FAILURE;
+	}
+
+	/*
+	 * 8.2.5 - An OUT transfer size must be a multiple of MaxPacketSize.
+	 * A queued TRB cannot be rounded up like a single transfer as the
+	 * core would write past the end of the buffer.
+	 */
+	if ((Ept->Direction == XUSBPSU_EP_DIR_OUT) &&
+		(!IS_ALIGNED(Length, Ept->MaxSize))) {
+		return (s32)XST_FAILURE;
+	}
+
+	XUsbPsu_EpQueueFillTrb(InstancePtr, Ept, BufferPtr, Length);
+
+	return XUsbPsu_EpQueueKick(InstancePtr, Ept);
+}
+
+/****************************************************************************/
+/**
+* Completes all finished TRBs of a queued Endpoint.
+*
+* One XferInProgress or XferComplete event may stand for several finished
+* TRBs, so every TRB the core has released is completed in one pass and the
+* endpoint handler is called for each. In circular mode the buffers are
+* requeued and the core is updated once for the whole batch.
+*
+* @param	InstancePtr is a pointer to the XUsbPsu instance.
+* @param	Ept is a pointer to the Endpoint.
+* @param	Event is a pointer to the Endpoint event occurred in core.
+*
+* @return	None.
+*
+* @note		None.
+*
+****************************************************************************/
+static void XUsbPsu_EpQueueComplete(struct XUsbPsu *InstancePtr,
+				struct XUsbPsu_Ep *Ept,
+				const struct XUsbPsu_Event_Epevt *Event)
+{
+	struct XUsbPsu_Trb *TrbPtr;
+	u32 Slot;
+	u32 Requeued = 0U;
+
+	if (Event->Endpoint_Event == XUSBPSU_DEPEVT_XFERCOMPLETE) {
+		Ept->EpStatus &= ~(XUSBPSU_EP_BUSY);
+		Ept->ResourceIndex = 0U;
+	}
+
+	while (Ept->QueueCount > 0U) {
+		Slot = Ept->TrbDequeue;
+		TrbPtr = &Ept->EpTrb[Slot];
+
+		if (InstancePtr->ConfigPtr->IsCacheCoherent == (u8)0U) {
+			Xil_DCacheInvalidateRange((INTPTR)TrbPtr,
+						 sizeof(struct XUsbPsu_Trb));
+		}
+
+		if ((TrbPtr->Ctrl & XUSBPSU_TRB_CTRL_HWO) != 0U) {
+			break;
+		}
+
+		Ept->TrbDequeue++;
+		if (Ept->TrbDequeue == NO_OF_TRB_PER_EP) {
+			Ept->TrbDequeue = 0U;
+		}
+		Ept->QueueCount--;
+
+		Ept->BufferPtr = Ept->QueueBufPtr[Slot];
+		Ept->RequestedBytes = Ept->QueueLen[Slot];
+		Ept->BytesTxed = Ept->RequestedBytes -
+				(TrbPtr->Size & XUSBPSU_TRB_SIZE_MASK);
+
+		if ((Ept->Direction == XUSBPSU_EP_DIR_OUT) &&
+			(InstancePtr->ConfigPtr->IsCacheCoherent == (u8)0U)) {
+			Xil_DCacheInvalidateRange((INTPTR)Ept->BufferPtr,
+							 Ept->BytesTxed);
+		}
+
+		if (Ept->Handler != NULL) {
+			Ept->Handler(InstancePtr->AppData, Ept->RequestedBytes,
+							 Ept->BytesTxed);
+		}
+
+		/* The handler may have disabled the queue */
+		if (((Ept->EpStatus & XUSBPSU_EP_CIRCULAR) != 0U) &&
+			(Ept->QueueCount < NO_OF_TRB_PER_EP)) {
+			XUsbPsu_EpQueueFillTrb(InstancePtr, Ept,
+					Ept->BufferPtr, Ept->RequestedBytes);
+			Requeued++;
+		}
+	}
+
+	if (Requeued != 0U) {
+		(void)XUsbPsu_EpQueueKick(InstancePtr, Ept);
+	}
+}
+
 /****************************************************************************/
 /**
 * For Isochronous transfer, get the microframe time and calls respective
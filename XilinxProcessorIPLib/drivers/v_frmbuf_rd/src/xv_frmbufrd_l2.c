@@ -34,6 +34,7 @@
 * 4.10  vv    02/05/19   Added new pixel formats with 12 and 16 bpc.
 * 4.50  pg    01/07/21   Added new registers to support fid_out interlace solution.
 *						Interrupt count support for throughput measurement.
+* 4.60  ag    10/15/26   Added buffer ring with address rotation in the ISR.
 * </pre>
 *
 ******************************************************************************/
@@ -923,6 +924,199 @@ u32 XVFrmbufRd_Get_FieldOut(XV_FrmbufRd_l2 *InstancePtr)
 	return(ReadVal);
 }
 
+/*****************************************************************************/
+/**
+ * This function hands a ring of buffers to the driver. The buffer addresses
+ * are checked once here so that the interrupt handler can program them
+ * without further validation.
+ *
+ * @param  InstancePtr is a pointer to core instance to be worked upon
+ * @param  Bufs is the array of buffer addresses
+ * @param  NumBufs is the number of buffers, 2 to XVFRMBUFRD_RING_MAX_BUFS.
+ *         0 disables the ring.
+ *
+ * @return XST_SUCCESS, XST_INVALID_PARAM or XVFRMBUFRD_ERR_MEM_ADDR_MISALIGNED
+ *
+ * @note   The core must be stopped when the ring is changed
+ *
+ ******************************************************************************/
+int XVFrmbufRd_RingSetup(XV_FrmbufRd_l2 *InstancePtr,
+			 const XVFrmbufRd_RingBuf *Bufs, u32 NumBufs)
+{
+	XVFrmbufRd_Ring *Ring;
+	UINTPTR Align;
+	u32 Idx;
+	int Status = XST_SUCCESS;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	Ring = &InstancePtr->Ring;
+	memset(Ring, 0, sizeof(XVFrmbufRd_Ring));
+
+	if (NumBufs == 0) {
+		return(XST_SUCCESS);
+	}
+
+	if ((Bufs == NULL) || (NumBufs < 2) ||
+	    (NumBufs > XVFRMBUFRD_RING_MAX_BUFS)) {
+		return(XST_INVALID_PARAM);
+	}
+
+	/* Check if addr is aligned to aximm width (2*PPC*32-bits (4Bytes)) */
+	Align = 2 * InstancePtr->FrmbufRd.Config.PixPerClk * 4;
+	for (Idx = 0; Idx < NumBufs; Idx++) {
+		if ((Bufs[Idx].Addr == 0) || ((Bufs[Idx].Addr % Align) != 0) ||
+		    ((Bufs[Idx].ChromaAddr % Align) != 0) ||
+		    ((Bufs[Idx].VChromaAddr % Align) != 0)) {
+			Status = XVFRMBUFRD_ERR_MEM_ADDR_MISALIGNED;
+			break;
+		}
+		Ring->Buf[Idx] = Bufs[Idx];
+	}
+
+	if (Status == XST_SUCCESS) {
+		Ring->NumBufs = NumBufs;
+	}
+	return(Status);
+}
+
+/*****************************************************************************/
+/**
+ * This function starts the core with the buffer ring. The first queued
+ * buffer is programmed here, all further buffers are programmed by the
+ * interrupt handler on ap_ready.
+ *
+ * @param  InstancePtr is a pointer to core instance to be worked upon
+ * @param  AutoRestart if TRUE the core reads frames back to back without
+ *         software intervention. If FALSE the application starts every
+ *         frame with XVFrmbufRd_Start().
+ *
+ * @return XST_SUCCESS if the core was started
+ *         XST_NO_DATA if no frame has been queued
+ *
+ * @note   The ring must have been set up with XVFrmbufRd_RingSetup() and the
+ *         interrupt handler must be connected
+ *
+ ******************************************************************************/
+int XVFrmbufRd_RingStart(XV_FrmbufRd_l2 *InstancePtr, u32 AutoRestart)
+{
+	XVFrmbufRd_Ring *Ring;
+	const XVFrmbufRd_RingBuf *Buf;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->Ring.NumBufs != 0);
+
+	Ring = &InstancePtr->Ring;
+	if (Ring->WrFence == Ring->RdFence) {
+		return(XST_NO_DATA);
+	}
+
+	Ring->NextIdx = Ring->RdFence % Ring->NumBufs;
+	Ring->InFlightCnt = 0;
+	Ring->RdFence++;
+
+	Buf = &Ring->Buf[Ring->NextIdx];
+	XV_frmbufrd_Set_HwReg_frm_buffer_V(&InstancePtr->FrmbufRd, Buf->Addr);
+	if (Buf->ChromaAddr != 0) {
+		XV_frmbufrd_Set_HwReg_frm_buffer2_V(&InstancePtr->FrmbufRd,
+						    Buf->ChromaAddr);
+	}
+	if (Buf->VChromaAddr != 0) {
+		XV_frmbufrd_Set_HwReg_frm_buffer3_V(&InstancePtr->FrmbufRd,
+						    Buf->VChromaAddr);
+	}
+
+	XVFrmbufRd_InterruptEnable(InstancePtr,
+				   XVFRMBUFRD_IRQ_DONE_MASK |
+				   XVFRMBUFRD_IRQ_READY_MASK);
+	if (AutoRestart) {
+		XV_frmbufrd_EnableAutoRestart(&InstancePtr->FrmbufRd);
+	}
+
+	XV_frmbufrd_Start(&InstancePtr->FrmbufRd);
+	return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+ * This function returns the next buffer of the ring the application can
+ * fill with a frame
+ *
+ * @param  InstancePtr is a pointer to core instance to be worked upon
+ * @param  BufPtr is updated with the free buffer
+ *
+ * @return XST_SUCCESS if a buffer is free
+ *         XST_DEVICE_BUSY if all buffers are queued or read by the core
+ *
+ * @note   The frame is handed to the driver with XVFrmbufRd_RingQueue()
+ *
+ ******************************************************************************/
+int XVFrmbufRd_RingGetFree(XV_FrmbufRd_l2 *InstancePtr,
+			   const XVFrmbufRd_RingBuf **BufPtr)
+{
+	XVFrmbufRd_Ring *Ring;
+	u32 WrFence;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(BufPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->Ring.NumBufs != 0);
+
+	Ring = &InstancePtr->Ring;
+	WrFence = Ring->WrFence;
+	if ((WrFence - Ring->RelFence) >= Ring->NumBufs) {
+		return(XST_DEVICE_BUSY);
+	}
+
+	*BufPtr = &Ring->Buf[WrFence % Ring->NumBufs];
+	return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+ * This function queues the buffer returned by XVFrmbufRd_RingGetFree() for
+ * display
+ *
+ * @param  InstancePtr is a pointer to core instance to be worked upon
+ *
+ * @return none
+ *
+ * @note   The frame data must be written to memory (cache flushed) before
+ *         the buffer is queued
+ *
+ ******************************************************************************/
+void XVFrmbufRd_RingQueue(XV_FrmbufRd_l2 *InstancePtr)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid((InstancePtr->Ring.WrFence - InstancePtr->Ring.RelFence) <
+		       InstancePtr->Ring.NumBufs);
+
+	InstancePtr->Ring.WrFence++;
+}
+
+/*****************************************************************************/
+/**
+ * This function reads the buffer ring statistics
+ *
+ * @param  InstancePtr is a pointer to core instance to be worked upon
+ * @param  RepeatCnt is updated with the number of frames repeated because
+ *         no new frame was queued in time
+ * @param  LateCnt is updated with the number of frames whose ap_done was
+ *         serviced too late to keep the ring in step with the core
+ *
+ * @return none
+ *
+ ******************************************************************************/
+void XVFrmbufRd_RingGetStats(XV_FrmbufRd_l2 *InstancePtr,
+			     u32 *RepeatCnt, u32 *LateCnt)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(RepeatCnt != NULL);
+	Xil_AssertVoid(LateCnt != NULL);
+
+	*RepeatCnt = InstancePtr->Ring.RepeatCnt;
+	*LateCnt = InstancePtr->Ring.LateCnt;
+}
+
 /*****************************************************************************/
 /**
  * This function reports the frame buffer read status
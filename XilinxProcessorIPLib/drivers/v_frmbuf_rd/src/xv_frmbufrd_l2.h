@@ -74,6 +74,18 @@
 *     will configure the IP to keep processing frames without sw intervention.
 *   - Polling mode is the default configuration set during driver initialization
 *
+* <b> Buffer Ring </b>
+*
+* Instead of reprogramming the buffer address from a callback for every frame,
+* the application can hand a ring of up to XVFRMBUFRD_RING_MAX_BUFS buffers to
+* the driver using XVFrmbufRd_RingSetup(). Frames are filled into the buffer
+* returned by XVFrmbufRd_RingGetFree() and queued with XVFrmbufRd_RingQueue().
+* After XVFrmbufRd_RingStart() the interrupt handler programs the next queued
+* buffer on every ap_ready, so the address for frame N+1 is in place while
+* frame N is read. A buffer is returned to the application once the core no
+* longer reads it. When no new frame is queued in time the current buffer is
+* shown again and the frame is counted as repeated.
+*
 * <b> Virtual Memory </b>
 *
 * This driver supports Virtual Memory. The RTOS is responsible for calculating
@@ -98,6 +110,7 @@
 * 4.10  vv    02/05/19   Added new pixel formats with 12 and 16 bpc.
 * 4.50  kp    13/07/21   Added new 3 planar video format Y_U_V8
 * 4.60  kp    12/03/21   Added new 3 planar video format Y_U_V10
+* 4.60  ag    10/15/26   Added buffer ring with address rotation in the ISR.
 * </pre>
 *
 ******************************************************************************/
@@ -115,6 +128,9 @@ extern "C" {
 #define XVFRMBUFRD_IRQ_DONE_MASK            (0x01)
 #define XVFRMBUFRD_IRQ_READY_MASK           (0x02)
 
+#define XVFRMBUFRD_RING_MAX_BUFS            (8)
+#define XVFRMBUFRD_RING_MAX_INFLIGHT        (2)
+
 /**************************** Type Definitions *******************************/
 
 /****************** Frame Buffer Read status 4096 - 4100  ********************/
@@ -151,6 +167,34 @@ typedef enum {
 */
 typedef void (*XVFrmbufRd_Callback)(void *CallbackRef);
 
+/**
+ * Buffer addresses of one ring entry. Chroma addresses are only programmed
+ * when non-zero.
+ */
+typedef struct {
+    UINTPTR Addr;          /**< Packed or luma buffer address */
+    UINTPTR ChromaAddr;    /**< UV or U plane buffer address */
+    UINTPTR VChromaAddr;   /**< V plane buffer address */
+} XVFrmbufRd_RingBuf;
+
+/**
+ * Buffer ring state. Buffers are used in ring order, so queued frame K is
+ * always held in buffer (K % NumBufs).
+ */
+typedef struct {
+    XVFrmbufRd_RingBuf Buf[XVFRMBUFRD_RING_MAX_BUFS]; /**< Ring buffers */
+    u32 NumBufs;           /**< Number of buffers, 0 if the ring is unused */
+    u32 NextIdx;           /**< Buffer programmed for the next frame */
+    u32 InFlight[XVFRMBUFRD_RING_MAX_INFLIGHT]; /**< Buffers latched by
+                                                     the core, oldest first */
+    u32 InFlightCnt;       /**< Number of latched frames not yet done */
+    volatile u32 WrFence;  /**< Frames queued by the application */
+    volatile u32 RdFence;  /**< Frames programmed into the core */
+    volatile u32 RelFence; /**< Buffers no longer read by the core */
+    volatile u32 RepeatCnt;/**< Frames repeated because none was queued */
+    volatile u32 LateCnt;  /**< ap_done interrupts serviced too late */
+} XVFrmbufRd_Ring;
+
 /**
  * Frame Buffer Read driver Layer 2 data. The user is required to allocate a
  * variable of this type for every frame buffer read device in the system. A
@@ -170,6 +214,7 @@ typedef struct {
                                 callback */
 
     XVidC_VideoStream Stream;    /**< Output AXIS */
+    XVFrmbufRd_Ring Ring;        /**< Buffer ring */
 }XV_FrmbufRd_l2;
 
 /************************** Macros Definitions *******************************/
@@ -681,6 +726,14 @@ u32 XVFrmbufRd_Get_FidErrorOut(XV_FrmbufRd_l2 *InstancePtr);
 u32 XVFrmbufRd_Get_FidErrorCount(XV_FrmbufRd_l2 *InstancePtr);
 u32 XVFrmbufRd_Get_FieldOut(XV_FrmbufRd_l2 *InstancePtr);
 void XVFrmbufRd_DbgReportStatus(XV_FrmbufRd_l2 *InstancePtr);
+int XVFrmbufRd_RingSetup(XV_FrmbufRd_l2 *InstancePtr,
+                         const XVFrmbufRd_RingBuf *Bufs, u32 NumBufs);
+int XVFrmbufRd_RingStart(XV_FrmbufRd_l2 *InstancePtr, u32 AutoRestart);
+int XVFrmbufRd_RingGetFree(XV_FrmbufRd_l2 *InstancePtr,
+                           const XVFrmbufRd_RingBuf **BufPtr);
+void XVFrmbufRd_RingQueue(XV_FrmbufRd_l2 *InstancePtr);
+void XVFrmbufRd_RingGetStats(XV_FrmbufRd_l2 *InstancePtr,
+                             u32 *RepeatCnt, u32 *LateCnt);
 
 /* Interrupt related function */
 void XVFrmbufRd_InterruptHandler(void *InstancePtr);
@@ -23,6 +23,7 @@
 * 4.20  pg    01/31/20   Removed Frmbuf start function from Interrupt handler.
 * 4.50  pg    01/07/21   Added new registers to support fid_out interlace solution.
 *						Interrupt count support for throughput measurement.
+* 4.60  ag    10/15/26   Rotate buffer ring addresses in the interrupt handler
 * </pre>
 *
 ******************************************************************************/
@@ -30,6 +31,11 @@
 /***************************** Include Files *********************************/
 #include "xv_frmbufrd_l2.h"
 
+/************************** Function Prototypes ******************************/
+static void RingProgram(XV_FrmbufRd_l2 *FrmbufRdPtr, u32 BufIdx);
+static void RingRetire(XVFrmbufRd_Ring *Ring);
+static void RingReady(XV_FrmbufRd_l2 *FrmbufRdPtr);
+static void RingDone(XV_FrmbufRd_l2 *FrmbufRdPtr);
 
 /*****************************************************************************/
 /**
@@ -124,6 +130,9 @@ void XVFrmbufRd_InterruptHandler(void *InstancePtr)
 	if(Status & XVFRMBUFRD_IRQ_DONE_MASK) {
 		/* Clear the interrupt */
 		XV_frmbufrd_InterruptClear(&FrmbufRdPtr->FrmbufRd, XVFRMBUFRD_IRQ_DONE_MASK);
+		if(FrmbufRdPtr->Ring.NumBufs != 0) {
+			RingDone(FrmbufRdPtr);
+		}
 		//Call user registered callback function, if any
 		if(FrmbufRdPtr->FrameDoneCallback) {
 			FrmbufRdPtr->FrameDoneCallback(FrmbufRdPtr->CallbackDoneRef);
@@ -134,10 +143,126 @@ void XVFrmbufRd_InterruptHandler(void *InstancePtr)
 	if(Status & XVFRMBUFRD_IRQ_READY_MASK) {
 		/* Clear the interrupt */
 		XV_frmbufrd_InterruptClear(&FrmbufRdPtr->FrmbufRd, XVFRMBUFRD_IRQ_READY_MASK);
+		if(FrmbufRdPtr->Ring.NumBufs != 0) {
+			RingReady(FrmbufRdPtr);
+		}
 		//Call user registered callback function, if any
 		if(FrmbufRdPtr->FrameReadyCallback) {
 			FrmbufRdPtr->FrameReadyCallback(FrmbufRdPtr->CallbackReadyRef);
 		}
 	}
 }
+
+/*****************************************************************************/
+/**
+*
+* This function programs the addresses of a ring buffer for the next frame
+*
+* @param    FrmbufRdPtr is a pointer to the core instance.
+* @param    BufIdx is the index of the ring buffer.
+*
+* @return   None.
+*
+******************************************************************************/
+static void RingProgram(XV_FrmbufRd_l2 *FrmbufRdPtr, u32 BufIdx)
+{
+	const XVFrmbufRd_RingBuf *Buf = &FrmbufRdPtr->Ring.Buf[BufIdx];
+
+	XV_frmbufrd_Set_HwReg_frm_buffer_V(&FrmbufRdPtr->FrmbufRd, Buf->Addr);
+	if(Buf->ChromaAddr != 0) {
+		XV_frmbufrd_Set_HwReg_frm_buffer2_V(&FrmbufRdPtr->FrmbufRd,
+						    Buf->ChromaAddr);
+	}
+	if(Buf->VChromaAddr != 0) {
+		XV_frmbufrd_Set_HwReg_frm_buffer3_V(&FrmbufRdPtr->FrmbufRd,
+						    Buf->VChromaAddr);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function retires the oldest latched frame. Its buffer is returned to
+* the application unless the core reads it again for a later frame.
+*
+* @param    Ring is a pointer to the buffer ring.
+*
+* @return   None.
+*
+******************************************************************************/
+static void RingRetire(XVFrmbufRd_Ring *Ring)
+{
+	u32 BufIdx = Ring->InFlight[0];
+	u32 InUse = (BufIdx == Ring->NextIdx) ? TRUE : FALSE;
+	u32 Idx;
+
+	for(Idx = 1; Idx < Ring->InFlightCnt; Idx++) {
+		Ring->InFlight[Idx - 1] = Ring->InFlight[Idx];
+		if(Ring->InFlight[Idx] == BufIdx) {
+			InUse = TRUE;
+		}
+	}
+	Ring->InFlightCnt--;
+
+	if(!InUse) {
+		Ring->RelFence++;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function handles ap_ready for the buffer ring. The core has latched
+* the programmed buffer for the frame it just started, so the next queued
+* buffer is programmed for the following frame. Without a queued frame the
+* registers are left unchanged and the current buffer is shown again.
+*
+* @param    FrmbufRdPtr is a pointer to the core instance.
+*
+* @return   None.
+*
+******************************************************************************/
+static void RingReady(XV_FrmbufRd_l2 *FrmbufRdPtr)
+{
+	XVFrmbufRd_Ring *Ring = &FrmbufRdPtr->Ring;
+	u32 NextIdx;
+
+	/*
+	 * The core only starts a frame after the previous one is done, so if the
+	 * in flight list is full the ap_done of the oldest frame was missed
+	 */
+	if(Ring->InFlightCnt == XVFRMBUFRD_RING_MAX_INFLIGHT) {
+		RingRetire(Ring);
+		Ring->LateCnt++;
+	}
+
+	Ring->InFlight[Ring->InFlightCnt] = Ring->NextIdx;
+	Ring->InFlightCnt++;
+
+	if(Ring->RdFence != Ring->WrFence) {
+		NextIdx = Ring->RdFence % Ring->NumBufs;
+		RingProgram(FrmbufRdPtr, NextIdx);
+		Ring->NextIdx = NextIdx;
+		Ring->RdFence++;
+	} else {
+		Ring->RepeatCnt++;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function handles ap_done for the buffer ring
+*
+* @param    FrmbufRdPtr is a pointer to the core instance.
+*
+* @return   None.
+*
+******************************************************************************/
+static void RingDone(XV_FrmbufRd_l2 *FrmbufRdPtr)
+{
+	if(FrmbufRdPtr->Ring.InFlightCnt != 0) {
+		RingRetire(&FrmbufRdPtr->Ring);
+	}
+}
 /** @} */
@@ -34,6 +34,7 @@
 * 4.10  vv    02/05/19   Added new pixel formats with 12 and 16 bpc.
 * 4.50  kp    12/07/21   Added new 3 planar video format Y_U_V8.
 * 4.60  kp    10/27/21   Added new 3 planar video format Y_U_V10.
+* 4.60  ag    10/15/26   Added buffer ring with address rotation in the ISR.
 * </pre>
 *
 ******************************************************************************/
@@ -756,6 +757,190 @@ u32 XVFrmbufWr_GetFieldID(XV_FrmbufWr_l2 *InstancePtr)
   return(ReadVal);
 }
 
+/*****************************************************************************/
+/**
+* This function hands a ring of buffers to the driver. The buffer addresses
+* are checked once here so that the interrupt handler can program them
+* without further validation.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  Bufs is the array of buffer addresses
+* @param  NumBufs is the number of buffers, 2 to XVFRMBUFWR_RING_MAX_BUFS.
+*         0 disables the ring.
+*
+* @return XST_SUCCESS, XST_INVALID_PARAM or XVFRMBUFWR_ERR_MEM_ADDR_MISALIGNED
+*
+* @note   The core must be stopped when the ring is changed
+*
+******************************************************************************/
+int XVFrmbufWr_RingSetup(XV_FrmbufWr_l2 *InstancePtr,
+                         const XVFrmbufWr_RingBuf *Bufs, u32 NumBufs)
+{
+  XVFrmbufWr_Ring *Ring;
+  UINTPTR Align;
+  u32 Idx;
+  int Status = XST_SUCCESS;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+
+  Ring = &InstancePtr->Ring;
+  memset(Ring, 0, sizeof(XVFrmbufWr_Ring));
+
+  if (NumBufs == 0) {
+    return(XST_SUCCESS);
+  }
+
+  if ((Bufs == NULL) || (NumBufs < 2) ||
+      (NumBufs > XVFRMBUFWR_RING_MAX_BUFS)) {
+    return(XST_INVALID_PARAM);
+  }
+
+  /* Check if addr is aligned to aximm width (2*PPC*32-bits (4Bytes)) */
+  Align = 2 * InstancePtr->FrmbufWr.Config.PixPerClk * 4;
+  for (Idx = 0; Idx < NumBufs; Idx++) {
+    if ((Bufs[Idx].Addr == 0) || ((Bufs[Idx].Addr % Align) != 0) ||
+        ((Bufs[Idx].ChromaAddr % Align) != 0) ||
+        ((Bufs[Idx].VChromaAddr % Align) != 0)) {
+      Status = XVFRMBUFWR_ERR_MEM_ADDR_MISALIGNED;
+      break;
+    }
+    Ring->Buf[Idx] = Bufs[Idx];
+  }
+
+  if (Status == XST_SUCCESS) {
+    Ring->NumBufs = NumBufs;
+  }
+  return(Status);
+}
+
+/*****************************************************************************/
+/**
+* This function starts the core with the buffer ring. The first buffer is
+* programmed here, all further buffers are programmed by the interrupt
+* handler on ap_ready.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  AutoRestart if TRUE the core captures frames back to back without
+*         software intervention. If FALSE the application starts every
+*         frame with XVFrmbufWr_Start().
+*
+* @return none
+*
+* @note   The ring must have been set up with XVFrmbufWr_RingSetup() and the
+*         interrupt handler must be connected
+*
+******************************************************************************/
+void XVFrmbufWr_RingStart(XV_FrmbufWr_l2 *InstancePtr, u32 AutoRestart)
+{
+  XVFrmbufWr_Ring *Ring;
+
+  Xil_AssertVoid(InstancePtr != NULL);
+  Xil_AssertVoid(InstancePtr->Ring.NumBufs != 0);
+
+  Ring = &InstancePtr->Ring;
+  Ring->NextIdx = 0;
+  Ring->InFlightCnt = 0;
+  Ring->WrFence = 0;
+  Ring->RdFence = 0;
+  Ring->DropCnt = 0;
+  Ring->LateCnt = 0;
+
+  XV_frmbufwr_Set_HwReg_frm_buffer_V(&InstancePtr->FrmbufWr, Ring->Buf[0].Addr);
+  if (Ring->Buf[0].ChromaAddr != 0) {
+    XV_frmbufwr_Set_HwReg_frm_buffer2_V(&InstancePtr->FrmbufWr,
+                                        Ring->Buf[0].ChromaAddr);
+  }
+  if (Ring->Buf[0].VChromaAddr != 0) {
+    XV_frmbufwr_Set_HwReg_frm_buffer3_V(&InstancePtr->FrmbufWr,
+                                        Ring->Buf[0].VChromaAddr);
+  }
+
+  XVFrmbufWr_InterruptEnable(InstancePtr,
+                             XVFRMBUFWR_IRQ_DONE_MASK |
+                             XVFRMBUFWR_IRQ_READY_MASK);
+  if (AutoRestart) {
+    XV_frmbufwr_EnableAutoRestart(&InstancePtr->FrmbufWr);
+  }
+
+  XV_frmbufwr_Start(&InstancePtr->FrmbufWr);
+}
+
+/*****************************************************************************/
+/**
+* This function returns the oldest completed frame of the buffer ring
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  BufPtr is updated with the buffer holding the frame
+*
+* @return XST_SUCCESS if a frame is available
+*         XST_NO_DATA if no frame has been completed
+*
+* @note   The frame stays owned by the application until it is returned with
+*         XVFrmbufWr_RingRelease(). Frames must be released in order.
+*
+******************************************************************************/
+int XVFrmbufWr_RingAcquire(XV_FrmbufWr_l2 *InstancePtr,
+                           const XVFrmbufWr_RingBuf **BufPtr)
+{
+  XVFrmbufWr_Ring *Ring;
+  u32 RdFence;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid(BufPtr != NULL);
+  Xil_AssertNonvoid(InstancePtr->Ring.NumBufs != 0);
+
+  Ring = &InstancePtr->Ring;
+  RdFence = Ring->RdFence;
+  if (Ring->WrFence == RdFence) {
+    return(XST_NO_DATA);
+  }
+
+  *BufPtr = &Ring->Buf[RdFence % Ring->NumBufs];
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function returns the oldest acquired frame to the buffer ring so that
+* the core can write to it again
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return none
+*
+******************************************************************************/
+void XVFrmbufWr_RingRelease(XV_FrmbufWr_l2 *InstancePtr)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+  Xil_AssertVoid(InstancePtr->Ring.WrFence != InstancePtr->Ring.RdFence);
+
+  InstancePtr->Ring.RdFence++;
+}
+
+/*****************************************************************************/
+/**
+* This function reads the buffer ring statistics
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  DropCnt is updated with the number of frames dropped because no
+*         buffer was free
+* @param  LateCnt is updated with the number of frames whose ap_done was
+*         serviced too late to keep the ring in step with the core
+*
+* @return none
+*
+******************************************************************************/
+void XVFrmbufWr_RingGetStats(XV_FrmbufWr_l2 *InstancePtr,
+                             u32 *DropCnt, u32 *LateCnt)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+  Xil_AssertVoid(DropCnt != NULL);
+  Xil_AssertVoid(LateCnt != NULL);
+
+  *DropCnt = InstancePtr->Ring.DropCnt;
+  *LateCnt = InstancePtr->Ring.LateCnt;
+}
+
 /*****************************************************************************/
 /**
 * This function reports the frame buffer write status
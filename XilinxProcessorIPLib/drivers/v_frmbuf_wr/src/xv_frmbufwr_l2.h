@@ -74,6 +74,19 @@
 *     will configure the IP to keep processing frames without sw intervention.
 *   - Polling mode is the default configuration set during driver initialization
 *
+* <b> Buffer Ring </b>
+*
+* Instead of reprogramming the buffer address from a callback for every frame,
+* the application can hand a ring of up to XVFRMBUFWR_RING_MAX_BUFS buffers to
+* the driver using XVFrmbufWr_RingSetup() and start capture with
+* XVFrmbufWr_RingStart(). The interrupt handler then programs the next free
+* buffer on every ap_ready, so the address for frame N+1 is in place while
+* frame N is written. Completed frames are handed over in order through two
+* fence counters: the driver advances WrFence on ap_done, the application
+* takes frames with XVFrmbufWr_RingAcquire() and returns them with
+* XVFrmbufWr_RingRelease(). When no buffer is free the core rewrites the
+* current buffer and the frame is counted as dropped.
+*
 * <b> Virtual Memory </b>
 *
 * This driver supports Virtual Memory. The RTOS is responsible for calculating
@@ -98,6 +111,7 @@
 * 4.10  vv    02/05/19   Added new pixel formats with 12 and 16 bpc.
 * 4.50  kp    12/07/21   Added new 3 planar video format Y_U_V8.
 * 4.60  kp    10/27/21   Added new 3 planar video format Y_U_V10.
+* 4.60  ag    10/15/26   Added buffer ring with address rotation in the ISR.
 * </pre>
 *
 ******************************************************************************/
@@ -115,6 +129,9 @@ extern "C" {
 #define XVFRMBUFWR_IRQ_DONE_MASK            (0x01)
 #define XVFRMBUFWR_IRQ_READY_MASK           (0x02)
 
+#define XVFRMBUFWR_RING_MAX_BUFS            (8)
+#define XVFRMBUFWR_RING_MAX_INFLIGHT        (2)
+
 /**************************** Type Definitions *******************************/
 
 /****************** Frame Buffer Write status 4096 - 4100  *******************/
@@ -151,6 +168,35 @@ typedef enum {
 */
 typedef void (*XVFrmbufWr_Callback)(void *CallbackRef);
 
+/**
+ * Buffer addresses of one ring entry. Chroma addresses are only programmed
+ * when non-zero.
+ */
+typedef struct {
+    UINTPTR Addr;          /**< Packed or luma buffer address */
+    UINTPTR ChromaAddr;    /**< UV or U plane buffer address */
+    UINTPTR VChromaAddr;   /**< V plane buffer address */
+} XVFrmbufWr_RingBuf;
+
+/**
+ * Buffer ring state. Buffers are used in ring order, so completed frame K
+ * is always held in buffer (K % NumBufs).
+ */
+typedef struct {
+    XVFrmbufWr_RingBuf Buf[XVFRMBUFWR_RING_MAX_BUFS]; /**< Ring buffers */
+    u32 NumBufs;           /**< Number of buffers, 0 if the ring is unused */
+    u32 NextIdx;           /**< Buffer programmed for the next frame */
+    u32 InFlight[XVFRMBUFWR_RING_MAX_INFLIGHT]; /**< Buffers latched by
+                                                     the core, oldest first */
+    u8 InFlightDrop[XVFRMBUFWR_RING_MAX_INFLIGHT]; /**< Frame is rewritten
+                                                        by the next one */
+    u32 InFlightCnt;       /**< Number of latched frames not yet done */
+    volatile u32 WrFence;  /**< Frames completed by the core */
+    volatile u32 RdFence;  /**< Frames released by the application */
+    volatile u32 DropCnt;  /**< Frames lost because no buffer was free */
+    volatile u32 LateCnt;  /**< ap_done interrupts serviced too late */
+} XVFrmbufWr_Ring;
+
 /**
  * Frame Buffer Write driver Layer 2 data. The user is required to allocate a
  * variable of this type for every frame buffer write device in the system. A
@@ -170,6 +216,7 @@ typedef struct {
                                 callback */
 
     XVidC_VideoStream Stream;    /**< Input AXIS */
+    XVFrmbufWr_Ring Ring;        /**< Buffer ring */
 }XV_FrmbufWr_l2;
 
 /************************** Macros Definitions *******************************/
@@ -629,6 +676,14 @@ int XVFrmbufWr_SetVChromaBufferAddr(XV_FrmbufWr_l2 *InstancePtr,
 UINTPTR XVFrmbufWr_GetVChromaBufferAddr(XV_FrmbufWr_l2 *InstancePtr);
 u32 XVFrmbufWr_GetFieldID(XV_FrmbufWr_l2 *InstancePtr);
 void XVFrmbufWr_DbgReportStatus(XV_FrmbufWr_l2 *InstancePtr);
+int XVFrmbufWr_RingSetup(XV_FrmbufWr_l2 *InstancePtr,
+                         const XVFrmbufWr_RingBuf *Bufs, u32 NumBufs);
+void XVFrmbufWr_RingStart(XV_FrmbufWr_l2 *InstancePtr, u32 AutoRestart);
+int XVFrmbufWr_RingAcquire(XV_FrmbufWr_l2 *InstancePtr,
+                           const XVFrmbufWr_RingBuf **BufPtr);
+void XVFrmbufWr_RingRelease(XV_FrmbufWr_l2 *InstancePtr);
+void XVFrmbufWr_RingGetStats(XV_FrmbufWr_l2 *InstancePtr,
+                             u32 *DropCnt, u32 *LateCnt);
 
 /* Interrupt related function */
 void XVFrmbufWr_InterruptHandler(void *InstancePtr);
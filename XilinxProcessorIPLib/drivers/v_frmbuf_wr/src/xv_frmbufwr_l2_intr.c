@@ -21,6 +21,7 @@
 * 1.00  vyc   04/05/17   Initial Release
 * 3.00  vyc   04/04/18   Add interrupt handler for ap_ready
 * 4.20  pg    01/31/20   Removed Frmbufwr_start function from Interrupt handler
+* 4.60  ag    10/15/26   Rotate buffer ring addresses in the interrupt handler
 * </pre>
 *
 ******************************************************************************/
@@ -28,6 +29,11 @@
 /***************************** Include Files *********************************/
 #include "xv_frmbufwr_l2.h"
 
+/************************** Function Prototypes ******************************/
+static void RingProgram(XV_FrmbufWr_l2 *FrmbufWrPtr, u32 BufIdx);
+static void RingRetire(XVFrmbufWr_Ring *Ring);
+static void RingReady(XV_FrmbufWr_l2 *FrmbufWrPtr);
+static void RingDone(XV_FrmbufWr_l2 *FrmbufWrPtr);
 
 /*****************************************************************************/
 /**
@@ -123,6 +129,9 @@ void XVFrmbufWr_InterruptHandler(void *InstancePtr)
   if(Status & XVFRMBUFWR_IRQ_DONE_MASK) {
     /* Clear the interrupt */
     XV_frmbufwr_InterruptClear(&FrmbufWrPtr->FrmbufWr, XVFRMBUFWR_IRQ_DONE_MASK);
+    if(FrmbufWrPtr->Ring.NumBufs != 0) {
+      RingDone(FrmbufWrPtr);
+    }
     //Call user registered callback function, if any
     if(FrmbufWrPtr->FrameDoneCallback) {
           FrmbufWrPtr->FrameDoneCallback(FrmbufWrPtr->CallbackDoneRef);
@@ -133,10 +142,128 @@ void XVFrmbufWr_InterruptHandler(void *InstancePtr)
   if(Status & XVFRMBUFWR_IRQ_READY_MASK) {
     /* Clear the interrupt */
     XV_frmbufwr_InterruptClear(&FrmbufWrPtr->FrmbufWr, XVFRMBUFWR_IRQ_READY_MASK);
+    if(FrmbufWrPtr->Ring.NumBufs != 0) {
+      RingReady(FrmbufWrPtr);
+    }
     //Call user registered callback function, if any
     if(FrmbufWrPtr->FrameReadyCallback) {
           FrmbufWrPtr->FrameReadyCallback(FrmbufWrPtr->CallbackReadyRef);
     }
   }
 }
+
+/*****************************************************************************/
+/**
+*
+* This function programs the addresses of a ring buffer for the next frame
+*
+* @param    FrmbufWrPtr is a pointer to the core instance.
+* @param    BufIdx is the index of the ring buffer.
+*
+* @return   None.
+*
+******************************************************************************/
+static void RingProgram(XV_FrmbufWr_l2 *FrmbufWrPtr, u32 BufIdx)
+{
+  const XVFrmbufWr_RingBuf *Buf = &FrmbufWrPtr->Ring.Buf[BufIdx];
+
+  XV_frmbufwr_Set_HwReg_frm_buffer_V(&FrmbufWrPtr->FrmbufWr, Buf->Addr);
+  if(Buf->ChromaAddr != 0) {
+    XV_frmbufwr_Set_HwReg_frm_buffer2_V(&FrmbufWrPtr->FrmbufWr,
+                                        Buf->ChromaAddr);
+  }
+  if(Buf->VChromaAddr != 0) {
+    XV_frmbufwr_Set_HwReg_frm_buffer3_V(&FrmbufWrPtr->FrmbufWr,
+                                        Buf->VChromaAddr);
+  }
+}
+
+/*****************************************************************************/
+/**
+*
+* This function retires the oldest latched frame. The frame is handed to the
+* application unless it was rewritten by the following frame.
+*
+* @param    Ring is a pointer to the buffer ring.
+*
+* @return   None.
+*
+******************************************************************************/
+static void RingRetire(XVFrmbufWr_Ring *Ring)
+{
+  u32 Idx;
+
+  if(Ring->InFlightDrop[0]) {
+    Ring->DropCnt++;
+  } else {
+    Ring->WrFence++;
+  }
+
+  for(Idx = 1; Idx < Ring->InFlightCnt; Idx++) {
+    Ring->InFlight[Idx - 1] = Ring->InFlight[Idx];
+    Ring->InFlightDrop[Idx - 1] = Ring->InFlightDrop[Idx];
+  }
+  Ring->InFlightCnt--;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function handles ap_ready for the buffer ring. The core has latched
+* the programmed buffer for the frame it just started, so the next free
+* buffer is programmed for the following frame. Without a free buffer the
+* registers are left unchanged and the frame just started is marked as
+* dropped, because the following frame rewrites the same buffer.
+*
+* @param    FrmbufWrPtr is a pointer to the core instance.
+*
+* @return   None.
+*
+******************************************************************************/
+static void RingReady(XV_FrmbufWr_l2 *FrmbufWrPtr)
+{
+  XVFrmbufWr_Ring *Ring = &FrmbufWrPtr->Ring;
+  u32 Held;
+  u32 NextIdx;
+
+  /*
+   * The core only starts a frame after the previous one is done, so if the
+   * in flight list is full the ap_done of the oldest frame was missed
+   */
+  if(Ring->InFlightCnt == XVFRMBUFWR_RING_MAX_INFLIGHT) {
+    RingRetire(Ring);
+    Ring->LateCnt++;
+  }
+
+  Ring->InFlight[Ring->InFlightCnt] = Ring->NextIdx;
+  Ring->InFlightDrop[Ring->InFlightCnt] = FALSE;
+  Ring->InFlightCnt++;
+
+  /* Buffers held by the application plus buffers latched by the core */
+  Held = (Ring->WrFence - Ring->RdFence) + Ring->InFlightCnt;
+  if(Held < Ring->NumBufs) {
+    NextIdx = (Ring->NextIdx + 1) % Ring->NumBufs;
+    RingProgram(FrmbufWrPtr, NextIdx);
+    Ring->NextIdx = NextIdx;
+  } else {
+    Ring->InFlightDrop[Ring->InFlightCnt - 1] = TRUE;
+  }
+}
+
+/*****************************************************************************/
+/**
+*
+* This function handles ap_done for the buffer ring
+*
+* @param    FrmbufWrPtr is a pointer to the core instance.
+*
+* @return   None.
+*
+******************************************************************************/
+static void RingDone(XV_FrmbufWr_l2 *FrmbufWrPtr)
+{
+  if(FrmbufWrPtr->Ring.InFlightCnt != 0) {
+    RingRetire(&FrmbufWrPtr->Ring);
+  }
+}
 /** @} */
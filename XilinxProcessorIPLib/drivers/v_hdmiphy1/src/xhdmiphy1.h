@@ -651,6 +651,25 @@ typedef struct {
     u8 NChannels;       /**< No of Channels. */
 } XHdmiphy1_Hdmi21Cfg;
 
+/** Number of PLL divisor results kept by XHdmiphy1_PllCalculator. */
+#define XHDMIPHY1_PLL_CACHE_SIZE 8
+
+/**
+ * This typedef contains a PLL divisor result of XHdmiphy1_PllCalculator. The
+ * divisors only depend on the PLL type, the reference clock and the line rate,
+ * so a stored result stays valid until the driver is re-initialized.
+ */
+typedef struct {
+    u64 LineRateHz;         /**< Line rate the divisors produce. */
+    u64 PllClkInFreqHz;     /**< PLL reference clock frequency. */
+    u8 ChId;                /**< CMN0/CMN1 for a QPLL, CHA for a CPLL. */
+    u8 IsValid;             /**< Entry holds a result. */
+    u8 M;                   /**< Reference clock divider. */
+    u8 N1;                  /**< Feedback divider (N for QPLL). */
+    u8 N2;                  /**< Second feedback divider (CPLL). */
+    u8 D;                   /**< TX/RX output divider. */
+} XHdmiphy1_PllCacheEntry;
+
 /**
  * This typedef contains configuration information for the Video PHY core.
  */
@@ -712,6 +731,11 @@ typedef struct {
     u8 HdmiIsQpllPresent;           /**< QPLL is present in HW */
     XHdmiphy1_Hdmi21Cfg TxHdmi21Cfg; /**< TX HDMI Config */
     XHdmiphy1_Hdmi21Cfg RxHdmi21Cfg; /**< TX HDMI Config */
+    XHdmiphy1_PllCacheEntry PllCache[XHDMIPHY1_PLL_CACHE_SIZE]; /**< PLL
+                            divisor results for fast
+                            line rate changes. */
+    u8 PllCacheNext;                /**< Next PLL cache entry to
+                            replace. */
 #if ((XPAR_HDMIPHY1_0_TRANSCEIVER != XHDMIPHY1_GTYE5)&&(XPAR_HDMIPHY1_0_TRANSCEIVER != XHDMIPHY1_GTYP))
     XHdmiphy1_IntrHandler IntrCpllLockHandler; /**< Callback function for CPLL
                             lock interrupts. */
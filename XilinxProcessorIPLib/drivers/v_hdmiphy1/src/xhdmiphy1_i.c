@@ -1444,7 +1444,9 @@ XHdmiphy1_SysClkOutSelType XHdmiphy1_Pll2SysClkOut(XHdmiphy1_PllType PllSelect)
 *		- XST_FAILURE otherwise.
 *
 * @note		If successful, the channel's PllParams structure will be
-*		modified with the valid PLL parameters.
+*		modified with the valid PLL parameters. Results are kept in
+*		the instance PLL cache so that a later request for the same
+*		line rate skips the divisor search.
 *
 ******************************************************************************/
 u32 XHdmiphy1_PllCalculator(XHdmiphy1 *InstancePtr, u8 QuadId,
@@ -1455,7 +1457,10 @@ u32 XHdmiphy1_PllCalculator(XHdmiphy1 *InstancePtr, u8 QuadId,
 	u64 PllClkOutFreqHz;
 	u64 CalcLineRateFreqHz;
 	u8 Id, Id0, Id1;
+	u8 MVal, N1Val, N2Val, DVal;
+	u8 CacheId;
 	u64 PllClkInFreqHzIn = PllClkInFreqHz;
+	XHdmiphy1_PllCacheEntry *CachePtr;
 	XHdmiphy1_Channel *PllPtr = &InstancePtr->Quads[QuadId].
 		Plls[XHDMIPHY1_CH2IDX(ChId)];
 
@@ -1465,6 +1470,24 @@ u32 XHdmiphy1_PllCalculator(XHdmiphy1 *InstancePtr, u8 QuadId,
 					PllPtr->PllRefClkSel);
 	}
 
+	/* The CPLLs share one VCO range, each QPLL has its own. */
+	CacheId = XHDMIPHY1_ISCH(ChId) ? XHDMIPHY1_CHANNEL_ID_CHA : ChId;
+
+	/* Reuse the divisors found for a previous request of the same
+	 * PLL type, reference clock and line rate. */
+	for (Id = 0; Id < XHDMIPHY1_PLL_CACHE_SIZE; Id++) {
+		CachePtr = &InstancePtr->PllCache[Id];
+		if (CachePtr->IsValid && (CachePtr->ChId == CacheId) &&
+		    (CachePtr->PllClkInFreqHz == PllClkInFreqHzIn) &&
+		    (CachePtr->LineRateHz == PllPtr->LineRateHz)) {
+			MVal = CachePtr->M;
+			N1Val = CachePtr->N1;
+			N2Val = CachePtr->N2;
+			DVal = CachePtr->D;
+			goto calc_done;
+		}
+	}
+
 	/* Select PLL value table offsets. */
 	const XHdmiphy1_GtPllDivs *GtPllDivs;
 	if (XHDMIPHY1_ISCH(ChId)) {
@@ -1495,7 +1518,11 @@ u32 XHdmiphy1_PllCalculator(XHdmiphy1 *InstancePtr, u8 QuadId,
 		for (D = GtPllDivs->D; *D != 0; D++) {
 			CalcLineRateFreqHz = PllClkOutFreqHz / *D;
 			if (CalcLineRateFreqHz == PllPtr->LineRateHz) {
-				goto calc_done;
+				MVal = *M;
+				N1Val = *N1;
+				N2Val = *N2;
+				DVal = *D;
+				goto calc_store;
 			}
 		}
 	}
@@ -1504,11 +1531,24 @@ u32 XHdmiphy1_PllCalculator(XHdmiphy1 *InstancePtr, u8 QuadId,
 	/* Calculation failed, don't change divisor settings. */
 	return XST_FAILURE;
 
+calc_store:
+	CachePtr = &InstancePtr->PllCache[InstancePtr->PllCacheNext];
+	CachePtr->LineRateHz = PllPtr->LineRateHz;
+	CachePtr->PllClkInFreqHz = PllClkInFreqHzIn;
+	CachePtr->ChId = CacheId;
+	CachePtr->M = MVal;
+	CachePtr->N1 = N1Val;
+	CachePtr->N2 = N2Val;
+	CachePtr->D = DVal;
+	CachePtr->IsValid = TRUE;
+	InstancePtr->PllCacheNext = (InstancePtr->PllCacheNext + 1) %
+					XHDMIPHY1_PLL_CACHE_SIZE;
+
 calc_done:
 	/* Found the multiplier and divisor values for requested line rate. */
-	PllPtr->PllParams.MRefClkDiv = *M;
-	PllPtr->PllParams.NFbDiv = *N1;
-	PllPtr->PllParams.N2FbDiv = *N2; /* Won't be used for QPLL.*/
+	PllPtr->PllParams.MRefClkDiv = MVal;
+	PllPtr->PllParams.NFbDiv = N1Val;
+	PllPtr->PllParams.N2FbDiv = N2Val; /* Won't be used for QPLL.*/
 	PllPtr->PllParams.IsLowerBand = 1; /* Won't be used for CPLL. */
 
 	if (XHDMIPHY1_ISCMN(ChId)) {
@@ -1519,7 +1559,7 @@ calc_done:
 	XHdmiphy1_Ch2Ids(InstancePtr, ChId, &Id0, &Id1);
 	for (Id = Id0; Id <= Id1; Id++) {
 		InstancePtr->Quads[QuadId].Plls[XHDMIPHY1_CH2IDX(Id)].OutDiv[Dir] =
-			*D;
+			DVal;
 		if (Dir == XHDMIPHY1_DIR_RX) {
 			XHdmiphy1_CfgSetCdr(InstancePtr,\
 				QuadId, (XHdmiphy1_ChannelId)Id);
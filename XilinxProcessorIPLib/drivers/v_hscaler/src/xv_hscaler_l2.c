@@ -30,6 +30,7 @@
 *       rco   02/09/17   Fix c++ compilation warnings
 *	jsr   09/07/18 Fix for 64-bit driver support
 * 3.3   vsa   04/07/20   Improve quality with better coefficient tables
+* 3.4   ag    10/15/26   Skip reloading unchanged filter coefficients
 * </pre>
 *
 ******************************************************************************/
@@ -247,6 +248,12 @@ static void XV_HScalerSelectCoeff(XV_Hscaler_l2 *InstancePtr,
 	numTaps = XV_HSCALER_TAPS_6;
   }
 
+  /* Selected table is already held in the local coefficient store */
+  if(coeff == InstancePtr->CoeffTbl)
+  {
+    return;
+  }
+
   XV_HScalerLoadExtCoeff(InstancePtr,
                          numPhases,
                          numTaps,
@@ -254,6 +261,7 @@ static void XV_HScalerSelectCoeff(XV_Hscaler_l2 *InstancePtr,
 
   /* Disable use of external coefficients */
   InstancePtr->UseExtCoeff = FALSE;
+  InstancePtr->CoeffTbl = coeff;
 }
 
 /*****************************************************************************/
@@ -328,6 +336,30 @@ void XV_HScalerLoadExtCoeff(XV_Hscaler_l2 *InstancePtr,
 
   /* Enable use of external coefficients */
   InstancePtr->UseExtCoeff = TRUE;
+
+  /* Coefficient store changed and needs to be programmed into the core */
+  InstancePtr->CoeffTbl = NULL;
+  InstancePtr->CoeffLoaded = FALSE;
+}
+
+/*****************************************************************************/
+/**
+* This function discards the record of the coefficients programmed into the
+* core so that the next call to XV_HScalerSetup reloads them. The
+* coefficient memory of the core is not cleared by a core reset, so this is
+* only required if its contents may have been lost otherwise.
+*
+* @param  InstancePtr is a pointer to the core instance to be worked on.
+*
+* @return None
+*
+******************************************************************************/
+void XV_HScalerInvalidateCoeff(XV_Hscaler_l2 *InstancePtr)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+
+  InstancePtr->CoeffTbl = NULL;
+  InstancePtr->CoeffLoaded = FALSE;
 }
 
 /*****************************************************************************/
@@ -632,8 +664,12 @@ int XV_HScalerSetup(XV_Hscaler_l2  *InstancePtr,
       /* Determine coefficient table to use */
       XV_HScalerSelectCoeff(InstancePtr, WidthIn, WidthOut);
     }
-    /* Program generated coefficients into the IP register bank */
-    XV_HScalerSetCoeff(InstancePtr);
+    /* Program coefficients into the IP register bank if they changed */
+    if(!InstancePtr->CoeffLoaded)
+    {
+      XV_HScalerSetCoeff(InstancePtr);
+      InstancePtr->CoeffLoaded = TRUE;
+    }
   }
 
   /* Compute Phase for 1 line */
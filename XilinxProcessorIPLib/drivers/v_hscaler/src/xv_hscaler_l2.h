@@ -70,6 +70,8 @@
 *       dmc   12/17/15   Add macro to query the Is422Enabled flag that was
 *                        added to the XV_hscaler_Config structure
 * 3.0   mpe   04/28/16   Added optional color format conversion handling
+* 3.4   ag    10/15/26   Added coefficient load tracking and
+*                        XV_HScalerInvalidateCoeff
 * </pre>
 *
 ******************************************************************************/
@@ -124,6 +126,8 @@ typedef struct
   XV_hscaler Hsc; /*<< Layer 1 instance */
   u8 UseExtCoeff;
   short coeff[XV_HSCALER_MAX_H_PHASES][XV_HSCALER_MAX_H_TAPS];
+  const short *CoeffTbl; /*<< Fixed table held in coeff, NULL if none */
+  u8 CoeffLoaded;        /*<< coeff already programmed into the core */
   u64 phasesH[XV_HSCALER_MAX_LINE_WIDTH];
   u64 phasesH_H[XV_HSCALER_MAX_LINE_WIDTH];
 }XV_Hscaler_l2;
@@ -170,6 +174,7 @@ typedef struct
 int XV_HScalerInitialize(XV_Hscaler_l2 *InstancePtr, u16 DeviceId);
 void XV_HScalerStart(XV_Hscaler_l2 *InstancePtr);
 void XV_HScalerStop(XV_Hscaler_l2 *InstancePtr);
+void XV_HScalerInvalidateCoeff(XV_Hscaler_l2 *InstancePtr);
 void XV_HScalerLoadExtCoeff(XV_Hscaler_l2 *InstancePtr,
                             u16 num_phases,
                             u16 num_taps,
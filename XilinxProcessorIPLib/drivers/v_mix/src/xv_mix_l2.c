@@ -48,6 +48,8 @@
 * 6.00  pg    01/10/20   Add Colorimetry feature.
 *                        Program Mixer CSC registers to do color conversion
 *                        from YUV to RGB and RGB to YUV.
+* 6.40  ag    10/15/26   Route layer register accesses through a shadow so
+*                        updates can be staged and committed at frame done.
 * </pre>
 *
 ******************************************************************************/
@@ -93,6 +95,9 @@ static void SetPowerOnDefaultState(XV_Mix_l2 *InstancePtr);
 static int IsWindowValid(XVidC_VideoStream *Strm,
                          XVidC_VideoWindow *Win,
                          XVMix_Scalefactor ScaleFactor);
+static XVMix_ShadowReg *ShadowLookup(XVMix_Shadow *Shadow, u32 Offset);
+static void MixWriteReg(XV_Mix_l2 *InstancePtr, u32 Offset, u32 Data);
+static u32 MixReadReg(XV_Mix_l2 *InstancePtr, u32 Offset);
 
 /*****************************************************************************/
 /**
@@ -270,6 +275,190 @@ void XVMix_Stop(XV_Mix_l2 *InstancePtr)
         return;
 }
 
+/*****************************************************************************/
+/**
+* This function returns the shadow entry of a register, allocating a free
+* entry if the register is not in the shadow yet
+*
+* @param  Shadow is a pointer to the register shadow
+* @param  Offset is the register offset
+*
+* @return Pointer to the entry or NULL if the shadow is full
+*
+******************************************************************************/
+static XVMix_ShadowReg *ShadowLookup(XVMix_Shadow *Shadow, u32 Offset)
+{
+  XVMix_ShadowReg *Reg;
+  u32 Idx = (Offset >> 3) & (XVMIX_SHADOW_MAX_REGS - 1);
+  u32 Cnt;
+
+  for(Cnt = 0; Cnt < XVMIX_SHADOW_MAX_REGS; Cnt++) {
+    Reg = &Shadow->Reg[Idx];
+    if(Reg->Offset == Offset) {
+      return(Reg);
+    }
+    if(Reg->Offset == 0) {
+      Reg->Offset = Offset;
+      return(Reg);
+    }
+    Idx = (Idx + 1) & (XVMIX_SHADOW_MAX_REGS - 1);
+  }
+  return(NULL);
+}
+
+/*****************************************************************************/
+/**
+* This function writes a core register. While an update is being staged the
+* value is only recorded in the shadow.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  Offset is the register offset
+* @param  Data is the value to write
+*
+* @return none
+*
+******************************************************************************/
+static void MixWriteReg(XV_Mix_l2 *InstancePtr, u32 Offset, u32 Data)
+{
+  XVMix_Shadow *Shadow = &InstancePtr->Shadow;
+  XVMix_ShadowReg *Reg = ShadowLookup(Shadow, Offset);
+
+  if(Reg == NULL) {
+    /* Shadow is full, write through */
+    XV_mix_WriteReg(InstancePtr->Mix.Config.BaseAddress, Offset, Data);
+    return;
+  }
+
+  Reg->Value = Data;
+  if(Shadow->Staging) {
+    if(!Reg->IsDirty) {
+      Reg->IsDirty = TRUE;
+      Shadow->Dirty[Shadow->NumDirty] = (u16)(Reg - Shadow->Reg);
+      Shadow->NumDirty++;
+    }
+  } else {
+    XV_mix_WriteReg(InstancePtr->Mix.Config.BaseAddress, Offset, Data);
+    Reg->Committed = Data;
+    Reg->IsKnown = TRUE;
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function reads a core register, returning the staged value if the
+* register has been updated in the current transaction
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  Offset is the register offset
+*
+* @return Register value
+*
+******************************************************************************/
+static u32 MixReadReg(XV_Mix_l2 *InstancePtr, u32 Offset)
+{
+  XVMix_Shadow *Shadow = &InstancePtr->Shadow;
+  XVMix_ShadowReg *Reg;
+
+  if(Shadow->NumDirty != 0) {
+    Reg = ShadowLookup(Shadow, Offset);
+    if((Reg != NULL) && (Reg->IsDirty)) {
+      return(Reg->Value);
+    }
+  }
+  return(XV_mix_ReadReg(InstancePtr->Mix.Config.BaseAddress, Offset));
+}
+
+/*****************************************************************************/
+/**
+* This function starts staging an update. Until XVMix_CommitUpdate() is
+* called the layer setters only record the new register values.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return XST_SUCCESS if staging started
+*         XST_DEVICE_BUSY if the previous update is still pending
+*
+******************************************************************************/
+int XVMix_BeginUpdate(XV_Mix_l2 *InstancePtr)
+{
+  Xil_AssertNonvoid(InstancePtr != NULL);
+
+  if(InstancePtr->Shadow.CommitPending) {
+    return(XST_DEVICE_BUSY);
+  }
+
+  InstancePtr->Shadow.Staging = TRUE;
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function commits the staged update. In interrupt mode the registers
+* are written by the interrupt handler at the next frame done, so that all
+* changes take effect on the same frame. Otherwise they are written now.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return none
+*
+* @note   Use XVMix_IsUpdatePending() to check if the update has been applied
+*
+******************************************************************************/
+void XVMix_CommitUpdate(XV_Mix_l2 *InstancePtr)
+{
+  u32 IntrEnabled;
+
+  Xil_AssertVoid(InstancePtr != NULL);
+
+  InstancePtr->Shadow.Staging = FALSE;
+  if(InstancePtr->Shadow.NumDirty == 0) {
+    return;
+  }
+
+  IntrEnabled = XV_mix_ReadReg(InstancePtr->Mix.Config.BaseAddress,
+                               XV_MIX_CTRL_ADDR_GIE);
+  if(IntrEnabled) {
+    InstancePtr->Shadow.CommitPending = TRUE;
+  } else {
+    XVMix_ApplyUpdate(InstancePtr);
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function writes the staged registers to the core, skipping the ones
+* whose value did not change
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return none
+*
+* @note   Called by the interrupt handler for a pending update
+*
+******************************************************************************/
+void XVMix_ApplyUpdate(XV_Mix_l2 *InstancePtr)
+{
+  XVMix_Shadow *Shadow;
+  XVMix_ShadowReg *Reg;
+  u32 Idx;
+
+  Xil_AssertVoid(InstancePtr != NULL);
+
+  Shadow = &InstancePtr->Shadow;
+  for(Idx = 0; Idx < Shadow->NumDirty; Idx++) {
+    Reg = &Shadow->Reg[Shadow->Dirty[Idx]];
+    if((!Reg->IsKnown) || (Reg->Committed != Reg->Value)) {
+      XV_mix_WriteReg(InstancePtr->Mix.Config.BaseAddress,
+                      Reg->Offset, Reg->Value);
+      Reg->Committed = Reg->Value;
+      Reg->IsKnown = TRUE;
+    }
+    Reg->IsDirty = FALSE;
+  }
+  Shadow->NumDirty = 0;
+  Shadow->CommitPending = FALSE;
+}
+
 /*****************************************************************************/
 /**
 * This function validates if the requested window is within the frame boundary
@@ -348,7 +537,6 @@ void XVMix_SetVidStream(XV_Mix_l2 *InstancePtr,
 ******************************************************************************/
 int XVMix_LayerEnable(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
 {
-  XV_mix *MixPtr;
   u32 NumLayers, CurrenState;
   int Status = XST_FAILURE;
 
@@ -356,21 +544,20 @@ int XVMix_LayerEnable(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
   Xil_AssertNonvoid((LayerId >= XVMIX_LAYER_MASTER) &&
                     (LayerId < XVMIX_LAYER_LAST));
 
-  MixPtr = &InstancePtr->Mix;
   NumLayers = XVMix_GetNumLayers(InstancePtr);
 
   //Check if request is to enable all layers or single layer
   if(LayerId == XVMIX_LAYER_ALL) {
-    XV_mix_Set_HwReg_layerEnable(MixPtr, XVMIX_MASK_ENABLE_ALL_LAYERS);
+    MixWriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LAYERENABLE_DATA, XVMIX_MASK_ENABLE_ALL_LAYERS);
     Status = XST_SUCCESS;
   }
   else if((LayerId < NumLayers) ||
           ((LayerId == XVMIX_LAYER_LOGO) &&
            (XVMix_IsLogoEnabled(InstancePtr)))) {
 
-    CurrenState = XV_mix_Get_HwReg_layerEnable(MixPtr);
+    CurrenState = MixReadReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LAYERENABLE_DATA);
     CurrenState |= (1<<LayerId);
-    XV_mix_Set_HwReg_layerEnable(MixPtr, CurrenState);
+    MixWriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LAYERENABLE_DATA, CurrenState);
     Status = XST_SUCCESS;
   }
   return(Status);
@@ -390,7 +577,6 @@ int XVMix_LayerEnable(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
 ******************************************************************************/
 int XVMix_LayerDisable(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
 {
-  XV_mix *MixPtr;
   u32 NumLayers, CurrenState;
   int Status = XST_FAILURE;
 
@@ -398,20 +584,19 @@ int XVMix_LayerDisable(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
   Xil_AssertNonvoid((LayerId >= XVMIX_LAYER_MASTER) &&
                     (LayerId < XVMIX_LAYER_LAST));
 
-  MixPtr = &InstancePtr->Mix;
   NumLayers = XVMix_GetNumLayers(InstancePtr);
 
   //Check if request is to disable all layers or single layer
   if(LayerId == XVMIX_LAYER_ALL) {
-    XV_mix_Set_HwReg_layerEnable(MixPtr, XVMIX_MASK_DISABLE_ALL_LAYERS);
+    MixWriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LAYERENABLE_DATA, XVMIX_MASK_DISABLE_ALL_LAYERS);
     Status = XST_SUCCESS;
   }
   else if((LayerId < NumLayers) ||
           ((LayerId == XVMIX_LAYER_LOGO) &&
            (XVMix_IsLogoEnabled(InstancePtr)))) {
-    CurrenState = XV_mix_Get_HwReg_layerEnable(MixPtr);
+    CurrenState = MixReadReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LAYERENABLE_DATA);
     CurrenState &= ~(1<<LayerId);
-    XV_mix_Set_HwReg_layerEnable(MixPtr, CurrenState);
+    MixWriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LAYERENABLE_DATA, CurrenState);
     Status = XST_SUCCESS;
   }
   return(Status);
@@ -430,16 +615,14 @@ int XVMix_LayerDisable(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
 ******************************************************************************/
 int XVMix_IsLayerEnabled(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
 {
-  XV_mix *MixPtr;
   u32 State, Mask;
 
   Xil_AssertNonvoid(InstancePtr != NULL);
   Xil_AssertNonvoid((LayerId >= XVMIX_LAYER_MASTER) &&
                     (LayerId < XVMIX_LAYER_LAST));
 
-  MixPtr = &InstancePtr->Mix;
   Mask = (1<<LayerId);
-  State = XV_mix_Get_HwReg_layerEnable(MixPtr);
+  State = MixReadReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LAYERENABLE_DATA);
   return ((State & Mask) ? TRUE : FALSE);
 }
 
@@ -486,9 +669,9 @@ void XVMix_SetBackgndColor(XV_Mix_l2 *InstancePtr,
   }
 
   /* Set Background Color */
-  XV_mix_Set_HwReg_background_Y_R(&InstancePtr->Mix, y_r_val);
-  XV_mix_Set_HwReg_background_U_G(&InstancePtr->Mix, u_g_val);
-  XV_mix_Set_HwReg_background_V_B(&InstancePtr->Mix, v_b_val);
+  MixWriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_BACKGROUND_Y_R_DATA, y_r_val);
+  MixWriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_BACKGROUND_U_G_DATA, u_g_val);
+  MixWriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_BACKGROUND_V_B_DATA, v_b_val);
 }
 
 /*****************************************************************************/
@@ -544,10 +727,10 @@ int XVMix_SetLayerWindow(XV_Mix_l2 *InstancePtr,
                           (Win->Width  <= MixPtr->Config.MaxLogoWidth) &&
                           (Win->Height <= MixPtr->Config.MaxLogoHeight));
          if(WinResInRange) {
-            XV_mix_Set_HwReg_logoStartX(MixPtr, Win->StartX);
-            XV_mix_Set_HwReg_logoStartY(MixPtr, Win->StartY);
-            XV_mix_Set_HwReg_logoWidth(MixPtr,  Win->Width);
-            XV_mix_Set_HwReg_logoHeight(MixPtr, Win->Height);
+            MixWriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOSTARTX_DATA, Win->StartX);
+            MixWriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOSTARTY_DATA, Win->StartY);
+            MixWriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOWIDTH_DATA, Win->Width);
+            MixWriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOHEIGHT_DATA, Win->Height);
 
             InstancePtr->Layer[LayerId].Win = *Win;
             Status = XST_SUCCESS;
@@ -597,18 +780,18 @@ int XVMix_SetLayerWindow(XV_Mix_l2 *InstancePtr,
              BaseStrideReg = XV_MIX_CTRL_ADDR_HWREG_LAYERSTRIDE_0_DATA;
              Offset = LayerId*XVMIX_REG_OFFSET;
 
-             XV_mix_WriteReg(MixPtr->Config.BaseAddress,
-                             (BaseStartXReg+Offset), Win->StartX);
-             XV_mix_WriteReg(MixPtr->Config.BaseAddress,
-                             (BaseStartYReg+Offset), Win->StartY);
-             XV_mix_WriteReg(MixPtr->Config.BaseAddress,
-                             (BaseWidthReg+Offset),  Win->Width);
-             XV_mix_WriteReg(MixPtr->Config.BaseAddress,
-                             (BaseHeightReg+Offset), Win->Height);
+             MixWriteReg(InstancePtr,
+                         (BaseStartXReg+Offset), Win->StartX);
+             MixWriteReg(InstancePtr,
+                         (BaseStartYReg+Offset), Win->StartY);
+             MixWriteReg(InstancePtr,
+                         (BaseWidthReg+Offset),  Win->Width);
+             MixWriteReg(InstancePtr,
+                         (BaseHeightReg+Offset), Win->Height);
 
              if(!XVMix_IsLayerInterfaceStream(InstancePtr, LayerId)) {
-                XV_mix_WriteReg(MixPtr->Config.BaseAddress,
-                                (BaseStrideReg+Offset), StrideInBytes);
+                MixWriteReg(InstancePtr,
+                            (BaseStrideReg+Offset), StrideInBytes);
              }
              InstancePtr->Layer[LayerId].Win = *Win;
              Status = XST_SUCCESS;
@@ -642,7 +825,6 @@ int XVMix_GetLayerWindow(XV_Mix_l2 *InstancePtr,
                          XVMix_LayerId LayerId,
                          XVidC_VideoWindow *Win)
 {
-  XV_mix *MixPtr;
   int Status = XST_FAILURE;
 
   Xil_AssertNonvoid(InstancePtr != NULL);
@@ -650,16 +832,14 @@ int XVMix_GetLayerWindow(XV_Mix_l2 *InstancePtr,
                     (LayerId <= XVMIX_LAYER_LOGO));
   Xil_AssertNonvoid(Win != NULL);
 
-  MixPtr = &InstancePtr->Mix;
-
   switch(LayerId) {
     case XVMIX_LAYER_LOGO:
       if(XVMix_IsLogoEnabled(InstancePtr)) {
 
-        Win->StartX = XV_mix_Get_HwReg_logoStartX(MixPtr);
-        Win->StartY = XV_mix_Get_HwReg_logoStartY(MixPtr);
-        Win->Width  = XV_mix_Get_HwReg_logoWidth(MixPtr);
-        Win->Height = XV_mix_Get_HwReg_logoHeight(MixPtr);
+        Win->StartX = MixReadReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOSTARTX_DATA);
+        Win->StartY = MixReadReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOSTARTY_DATA);
+        Win->Width  = MixReadReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOWIDTH_DATA);
+        Win->Height = MixReadReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOHEIGHT_DATA);
 
         Status = XST_SUCCESS;
       } else {
@@ -680,14 +860,14 @@ int XVMix_GetLayerWindow(XV_Mix_l2 *InstancePtr,
         BaseHeightReg = XV_MIX_CTRL_ADDR_HWREG_LAYERHEIGHT_0_DATA;
         Offset = LayerId*XVMIX_REG_OFFSET;
 
-        Win->StartX = XV_mix_ReadReg(MixPtr->Config.BaseAddress,
-                                     (BaseStartXReg+Offset));
-        Win->StartY = XV_mix_ReadReg(MixPtr->Config.BaseAddress,
-                                     (BaseStartYReg+Offset));
-        Win->Width  = XV_mix_ReadReg(MixPtr->Config.BaseAddress,
-                                     (BaseWidthReg+Offset));
-        Win->Height = XV_mix_ReadReg(MixPtr->Config.BaseAddress,
-                                     (BaseHeightReg+Offset));
+        Win->StartX = MixReadReg(InstancePtr,
+                                 (BaseStartXReg+Offset));
+        Win->StartY = MixReadReg(InstancePtr,
+                                 (BaseStartYReg+Offset));
+        Win->Width  = MixReadReg(InstancePtr,
+                                 (BaseWidthReg+Offset));
+        Win->Height = MixReadReg(InstancePtr,
+                                 (BaseHeightReg+Offset));
 
         Status = XST_SUCCESS;
       } else {
@@ -719,7 +899,6 @@ int XVMix_MoveLayerWindow(XV_Mix_l2 *InstancePtr,
                           u16 StartX,
                           u16 StartY)
 {
-  XV_mix *MixPtr;
   XVidC_VideoWindow CurrWin;
   XVMix_Scalefactor Scale;
   int Status = XST_FAILURE;
@@ -748,14 +927,12 @@ int XVMix_MoveLayerWindow(XV_Mix_l2 *InstancePtr,
       return(XVMIX_ERR_LAYER_WINDOW_INVALID);
   }
 
-  MixPtr = &InstancePtr->Mix;
-
   switch(LayerId) {
     case XVMIX_LAYER_LOGO:
       if(XVMix_IsLogoEnabled(InstancePtr)) {
 
-        XV_mix_Set_HwReg_logoStartX(MixPtr, StartX);
-        XV_mix_Set_HwReg_logoStartY(MixPtr, StartY);
+        MixWriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOSTARTX_DATA, StartX);
+        MixWriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOSTARTY_DATA, StartY);
 
         InstancePtr->Layer[LayerId].Win.StartX = StartX;
         InstancePtr->Layer[LayerId].Win.StartY = StartY;
@@ -772,10 +949,10 @@ int XVMix_MoveLayerWindow(XV_Mix_l2 *InstancePtr,
         BaseStartYReg = XV_MIX_CTRL_ADDR_HWREG_LAYERSTARTY_0_DATA;
         Offset = LayerId*XVMIX_REG_OFFSET;
 
-        XV_mix_WriteReg(MixPtr->Config.BaseAddress,
-                        (BaseStartXReg+Offset), StartX);
-        XV_mix_WriteReg(MixPtr->Config.BaseAddress,
-                        (BaseStartYReg+Offset), StartY);
+        MixWriteReg(InstancePtr,
+                    (BaseStartXReg+Offset), StartX);
+        MixWriteReg(InstancePtr,
+                    (BaseStartYReg+Offset), StartY);
 
         InstancePtr->Layer[LayerId].Win.StartX = StartX;
         InstancePtr->Layer[LayerId].Win.StartY = StartY;
@@ -803,7 +980,6 @@ int XVMix_SetLayerScaleFactor(XV_Mix_l2 *InstancePtr,
                               XVMix_LayerId LayerId,
                               XVMix_Scalefactor Scale)
 {
-  XV_mix *MixPtr;
   XVidC_VideoWindow CurrWin;
   int Status = XST_FAILURE;
   int WinStatus;
@@ -824,12 +1000,10 @@ int XVMix_SetLayerScaleFactor(XV_Mix_l2 *InstancePtr,
       return(XVMIX_ERR_LAYER_WINDOW_INVALID);
   }
 
-  MixPtr = &InstancePtr->Mix;
-
   switch(LayerId) {
     case XVMIX_LAYER_LOGO:
       if(XVMix_IsLogoEnabled(InstancePtr)) {
-        XV_mix_Set_HwReg_logoScaleFactor(MixPtr, Scale);
+        MixWriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOSCALEFACTOR_DATA, Scale);
         Status = XST_SUCCESS;
       }
       break;
@@ -841,8 +1015,8 @@ int XVMix_SetLayerScaleFactor(XV_Mix_l2 *InstancePtr,
         u32 BaseReg;
 
         BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYERSCALEFACTOR_0_DATA;
-        XV_mix_WriteReg(MixPtr->Config.BaseAddress,
-                        (BaseReg+(LayerId*XVMIX_REG_OFFSET)), Scale);
+        MixWriteReg(InstancePtr,
+                    (BaseReg+(LayerId*XVMIX_REG_OFFSET)), Scale);
 
         Status = XST_SUCCESS;
       }
@@ -865,19 +1039,16 @@ int XVMix_SetLayerScaleFactor(XV_Mix_l2 *InstancePtr,
 ******************************************************************************/
 int XVMix_GetLayerScaleFactor(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
 {
-  XV_mix *MixPtr;
   u32 ReadVal = ~0;
 
   Xil_AssertNonvoid(InstancePtr != NULL);
   Xil_AssertNonvoid((LayerId > XVMIX_LAYER_MASTER) &&
                     (LayerId <= XVMIX_LAYER_LOGO));
 
-  MixPtr = &InstancePtr->Mix;
-
   switch(LayerId) {
     case XVMIX_LAYER_LOGO:
       if(XVMix_IsLogoEnabled(InstancePtr)) {
-        ReadVal = XV_mix_Get_HwReg_logoScaleFactor(MixPtr);
+        ReadVal = MixReadReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOSCALEFACTOR_DATA);
       }
       break;
 
@@ -887,8 +1058,8 @@ int XVMix_GetLayerScaleFactor(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
         u32 BaseReg;
 
         BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYERSCALEFACTOR_0_DATA;
-        ReadVal = XV_mix_ReadReg(MixPtr->Config.BaseAddress,
-                                 (BaseReg+(LayerId*XVMIX_REG_OFFSET)));
+        ReadVal = MixReadReg(InstancePtr,
+                             (BaseReg+(LayerId*XVMIX_REG_OFFSET)));
       }
       break;
   }
@@ -912,7 +1083,6 @@ int XVMix_SetLayerAlpha(XV_Mix_l2 *InstancePtr,
                         XVMix_LayerId LayerId,
                         u16 Alpha)
 {
-  XV_mix *MixPtr;
   int Status = XST_FAILURE;
 
   Xil_AssertNonvoid(InstancePtr != NULL);
@@ -920,12 +1090,10 @@ int XVMix_SetLayerAlpha(XV_Mix_l2 *InstancePtr,
                     (LayerId <= XVMIX_LAYER_LOGO));
   Xil_AssertNonvoid(Alpha <= XVMIX_ALPHA_MAX);
 
-  MixPtr = &InstancePtr->Mix;
-
   switch(LayerId) {
     case XVMIX_LAYER_LOGO:
       if(XVMix_IsLogoEnabled(InstancePtr)) {
-        XV_mix_Set_HwReg_logoAlpha(MixPtr, Alpha);
+        MixWriteReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOALPHA_DATA, Alpha);
         Status = XST_SUCCESS;
       } else {
         Status = XVMIX_ERR_DISABLED_IN_HW;
@@ -938,8 +1106,8 @@ int XVMix_SetLayerAlpha(XV_Mix_l2 *InstancePtr,
         u32 BaseReg;
 
         BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYERALPHA_0_DATA;
-        XV_mix_WriteReg(MixPtr->Config.BaseAddress,
-                        (BaseReg+(LayerId*XVMIX_REG_OFFSET)), Alpha);
+        MixWriteReg(InstancePtr,
+                    (BaseReg+(LayerId*XVMIX_REG_OFFSET)), Alpha);
         Status = XST_SUCCESS;
       } else {
         Status = XVMIX_ERR_DISABLED_IN_HW;
@@ -963,19 +1131,16 @@ int XVMix_SetLayerAlpha(XV_Mix_l2 *InstancePtr,
 ******************************************************************************/
 int XVMix_GetLayerAlpha(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
 {
-  XV_mix *MixPtr;
   u32 ReadVal = ~0;
 
   Xil_AssertNonvoid(InstancePtr != NULL);
   Xil_AssertNonvoid((LayerId > XVMIX_LAYER_MASTER) &&
                     (LayerId <= XVMIX_LAYER_LOGO));
 
-  MixPtr = &InstancePtr->Mix;
-
   switch(LayerId) {
     case XVMIX_LAYER_LOGO:
       if(XVMix_IsLogoEnabled(InstancePtr)) {
-        ReadVal = XV_mix_Get_HwReg_logoAlpha(MixPtr);
+        ReadVal = MixReadReg(InstancePtr, XV_MIX_CTRL_ADDR_HWREG_LOGOALPHA_DATA);
       }
       break;
 
@@ -985,8 +1150,8 @@ int XVMix_GetLayerAlpha(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
         u32 BaseReg;
 
         BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYERALPHA_0_DATA;
-        ReadVal = XV_mix_ReadReg(MixPtr->Config.BaseAddress,
-                                 (BaseReg+(LayerId*XVMIX_REG_OFFSET)));
+        ReadVal = MixReadReg(InstancePtr,
+                             (BaseReg+(LayerId*XVMIX_REG_OFFSET)));
       }
       break;
   }
@@ -1030,8 +1195,8 @@ int XVMix_SetLayerColorFormat(XV_Mix_l2 *InstancePtr,
           u32 BaseReg;
 
           BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYERVIDEOFORMAT_0_DATA;
-          XV_mix_WriteReg(MixPtr->Config.BaseAddress,
-                          (BaseReg+(LayerId*XVMIX_REG_OFFSET)), Cfmt);
+          MixWriteReg(InstancePtr,
+                      (BaseReg+(LayerId*XVMIX_REG_OFFSET)), Cfmt);
       }
       InstancePtr->Layer[LayerId].ColorFormat = Cfmt;
       Status = XST_SUCCESS;
@@ -1076,8 +1241,8 @@ int XVMix_GetLayerColorFormat(XV_Mix_l2 *InstancePtr,
           u32 BaseReg;
 
           BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYERVIDEOFORMAT_0_DATA;
-          *Cfmt = XV_mix_ReadReg(MixPtr->Config.BaseAddress,
-                                 (BaseReg+(LayerId*XVMIX_REG_OFFSET)));
+          *Cfmt = MixReadReg(InstancePtr,
+                             (BaseReg+(LayerId*XVMIX_REG_OFFSET)));
       }
 #endif
       if (LayerId == XVMIX_LAYER_MASTER) {
@@ -1108,7 +1273,6 @@ int XVMix_SetLayerBufferAddr(XV_Mix_l2 *InstancePtr,
                              XVMix_LayerId LayerId,
                              UINTPTR Addr)
 {
-  XV_mix *MixPtr;
   UINTPTR BaseReg, Align;
   u32 WinValid = FALSE;
   int Status = XST_FAILURE;
@@ -1118,8 +1282,6 @@ int XVMix_SetLayerBufferAddr(XV_Mix_l2 *InstancePtr,
                     (LayerId < XVMIX_LAYER_LOGO));
   Xil_AssertNonvoid(Addr != 0);
 
-  MixPtr = &InstancePtr->Mix;
-
   if(LayerId < XVMix_GetNumLayers(InstancePtr)) {
       /* Check if addr is aligned to aximm width (2*PPC*32-bits (4Bytes)) */
       Align = 2 * InstancePtr->Mix.Config.PixPerClk * 4;
@@ -1133,8 +1295,8 @@ int XVMix_SetLayerBufferAddr(XV_Mix_l2 *InstancePtr,
       if(WinValid) {
         BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF1_V_DATA;
 
-        XV_mix_WriteReg(MixPtr->Config.BaseAddress,
-                        (BaseReg+((LayerId-1)*XVMIX_REG_OFFSET)), Addr);
+        MixWriteReg(InstancePtr,
+                    (BaseReg+((LayerId-1)*XVMIX_REG_OFFSET)), Addr);
 
         InstancePtr->Layer[LayerId].BufAddr = Addr;
         Status = XST_SUCCESS;
@@ -1157,7 +1319,6 @@ int XVMix_SetLayerBufferAddr(XV_Mix_l2 *InstancePtr,
 ******************************************************************************/
 UINTPTR XVMix_GetLayerBufferAddr(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
 {
-  XV_mix *MixPtr;
   u32 BaseReg;
   UINTPTR ReadVal = 0;
 
@@ -1165,13 +1326,11 @@ UINTPTR XVMix_GetLayerBufferAddr(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
   Xil_AssertNonvoid((LayerId > XVMIX_LAYER_MASTER) &&
                     (LayerId < XVMIX_LAYER_LOGO));
 
-  MixPtr = &InstancePtr->Mix;
-
   if(LayerId < XVMix_GetNumLayers(InstancePtr)) {
         BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF1_V_DATA;
 
-        ReadVal = XV_mix_ReadReg(MixPtr->Config.BaseAddress,
-                                 (BaseReg+((LayerId-1)*XVMIX_REG_OFFSET)));
+        ReadVal = MixReadReg(InstancePtr,
+                             (BaseReg+((LayerId-1)*XVMIX_REG_OFFSET)));
   }
   return(ReadVal);
 }
@@ -1194,7 +1353,6 @@ int XVMix_SetLayerChromaBufferAddr(XV_Mix_l2 *InstancePtr,
                                    XVMix_LayerId LayerId,
                                    UINTPTR Addr)
 {
-  XV_mix *MixPtr;
   UINTPTR BaseReg, Align;
   u32 WinValid = FALSE;
   int Status = XST_FAILURE;
@@ -1204,8 +1362,6 @@ int XVMix_SetLayerChromaBufferAddr(XV_Mix_l2 *InstancePtr,
                     (LayerId < XVMIX_LAYER_LOGO));
   Xil_AssertNonvoid(Addr != 0);
 
-  MixPtr = &InstancePtr->Mix;
-
   if(LayerId < XVMix_GetNumLayers(InstancePtr)) {
       /* Check if addr is aligned to aximm width (2*PPC*32-bits (4Bytes)) */
       Align = 2 * InstancePtr->Mix.Config.PixPerClk * 4;
@@ -1219,8 +1375,8 @@ int XVMix_SetLayerChromaBufferAddr(XV_Mix_l2 *InstancePtr,
       if(WinValid) {
         BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF2_V_DATA;
 
-        XV_mix_WriteReg(MixPtr->Config.BaseAddress,
-                        (BaseReg+((LayerId-1)*XVMIX_REG_OFFSET)), Addr);
+        MixWriteReg(InstancePtr,
+                    (BaseReg+((LayerId-1)*XVMIX_REG_OFFSET)), Addr);
 
         InstancePtr->Layer[LayerId].ChromaBufAddr = Addr;
         Status = XST_SUCCESS;
@@ -1245,7 +1401,6 @@ int XVMix_SetLayerChromaBufferAddr(XV_Mix_l2 *InstancePtr,
 UINTPTR XVMix_GetLayerChromaBufferAddr(XV_Mix_l2 *InstancePtr,
                                        XVMix_LayerId LayerId)
 {
-  XV_mix *MixPtr;
   u32 BaseReg;
   UINTPTR ReadVal = 0;
 
@@ -1253,13 +1408,11 @@ UINTPTR XVMix_GetLayerChromaBufferAddr(XV_Mix_l2 *InstancePtr,
   Xil_AssertNonvoid((LayerId > XVMIX_LAYER_MASTER) &&
                     (LayerId < XVMIX_LAYER_LOGO));
 
-  MixPtr = &InstancePtr->Mix;
-
   if(LayerId < XVMix_GetNumLayers(InstancePtr)) {
         BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF2_V_DATA;
 
-        ReadVal = XV_mix_ReadReg(MixPtr->Config.BaseAddress,
-                                 (BaseReg+((LayerId-1)*XVMIX_REG_OFFSET)));
+        ReadVal = MixReadReg(InstancePtr,
+                             (BaseReg+((LayerId-1)*XVMIX_REG_OFFSET)));
   }
   return(ReadVal);
 }
@@ -79,6 +79,19 @@
 *     will configure the IP to keep processing frames without sw intervention.
 *   - Polling mode is the default configuration set during driver initialization
 *
+* <b> Staged Updates </b>
+*
+* Layer settings (enable, window, scale, alpha, buffer addresses, logo and
+* background) can be updated as one transaction. After XVMix_BeginUpdate()
+* the layer setters only record register values in a RAM shadow, and
+* getters return the staged values. XVMix_CommitUpdate() ends the
+* transaction. In interrupt mode the staged registers are written by the
+* interrupt handler at frame done, just before the next frame is started,
+* so all changes take effect on the same frame. In polling mode they are
+* written immediately. Registers whose value did not change since the last
+* write through the layer-2 API are skipped. Registers written directly
+* with the layer-1 API are not tracked by the shadow.
+*
 * <b> Virtual Memory </b>
 *
 * This driver supports Virtual Memory. The RTOS is responsible for calculating
@@ -106,6 +119,7 @@
 * 4.00  vyc   04/04/18   Add 8th overlayer
 *                        Move logo layer enable from bit 8 to bit 15
 * 6.00  pg    01/10/20   Add Colorimetry Feature
+* 6.40  ag    10/15/26   Add staged layer updates committed at frame done
 * </pre>
 *
 ******************************************************************************/
@@ -128,6 +142,8 @@ extern "C" {
 #define XVMIX_IRQ_READY_MASK             (0x02)
 
 #define XVMIX_CSC_COEFF_FRACTIONAL_BITS	(12)
+
+#define XVMIX_SHADOW_MAX_REGS            (256)
 #define XVMIX_CSC_COEFF_DIVISOR	(10000)
 #define XVMIX_CSC_MAX_ROWS		(3)
 #define XVMIX_CSC_MAX_COLS		(3)
@@ -280,6 +296,28 @@ typedef struct {
     };
 }XVMix_Layer;
 
+/**
+ * This typedef contains the shadow copy of one core register
+ */
+typedef struct {
+    u32 Offset;       /**< Register offset, 0 if the entry is unused */
+    u32 Value;        /**< Latest value set through the layer-2 API */
+    u32 Committed;    /**< Value last written to the core */
+    u8 IsKnown;       /**< Committed holds the core register value */
+    u8 IsDirty;       /**< Entry is in the dirty list */
+}XVMix_ShadowReg;
+
+/**
+ * This typedef contains the register shadow used for staged updates
+ */
+typedef struct {
+    XVMix_ShadowReg Reg[XVMIX_SHADOW_MAX_REGS]; /**< Hashed by offset */
+    u16 Dirty[XVMIX_SHADOW_MAX_REGS]; /**< Entries staged since last commit */
+    u32 NumDirty;                     /**< Number of staged entries */
+    u32 Staging;                      /**< Setters write to the shadow */
+    volatile u32 CommitPending;       /**< Written by ISR at frame done */
+}XVMix_Shadow;
+
 /**
 * Callback type for interrupt.
 *
@@ -312,6 +350,7 @@ typedef struct {
     XVMix_BackgroundId BkgndColor;
 
     XVidC_VideoStream Stream;    /**< Input AXIS */
+    XVMix_Shadow Shadow;         /**< Register shadow for staged updates */
 }XV_Mix_l2;
 
 /************************** Macros Definitions *******************************/
@@ -469,6 +508,19 @@ typedef struct {
 #define XVMix_IsLayerInterfaceStream(InstancePtr, LayerId) \
  ((InstancePtr)->Mix.Config.LayerIntrfType[LayerId-1] == XVMIX_LAYER_TYPE_STREAM)
 
+/*****************************************************************************/
+/**
+*
+* This macro checks if a committed update still waits for frame done
+*
+* @param    InstancePtr is a pointer to the core instance.
+*
+* @return   TRUE(1)/FALSE(0)
+*
+******************************************************************************/
+#define XVMix_IsUpdatePending(InstancePtr) \
+                              ((InstancePtr)->Shadow.CommitPending)
+
 /**************************** Function Prototypes *****************************/
 int XVMix_Initialize(XV_Mix_l2 *InstancePtr, u16 DeviceId);
 void XVMix_Start(XV_Mix_l2 *InstancePtr);
@@ -533,6 +585,10 @@ int XVMix_LoadLogoPixelAlpha(XV_Mix_l2 *InstancePtr,
                              XVidC_VideoWindow *Win,
                              u8 *ABuffer);
 
+int XVMix_BeginUpdate(XV_Mix_l2 *InstancePtr);
+void XVMix_CommitUpdate(XV_Mix_l2 *InstancePtr);
+void XVMix_ApplyUpdate(XV_Mix_l2 *InstancePtr);
+
 void XVMix_DbgReportStatus(XV_Mix_l2 *InstancePtr);
 void XVMix_DbgLayerInfo(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId);
 
@@ -20,6 +20,7 @@
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  rco   12/14/15   Initial Release
 *             02/12/16   Move user call back before frame start trigger
+* 6.40  ag    10/15/26   Apply committed staged update before frame start
 *
 * </pre>
 *
@@ -98,6 +99,9 @@ void XVMix_InterruptHandler(void *InstancePtr)
 
   /* Check for Done Signal */
   if(Status & XVMIX_IRQ_DONE_MASK) {
+    if(MixPtr->Shadow.CommitPending) {
+      XVMix_ApplyUpdate(MixPtr);
+    }
     //Call user registered callback function, if any
     if(MixPtr->FrameDoneCallback) {
 	      MixPtr->FrameDoneCallback(MixPtr->CallbackRef);
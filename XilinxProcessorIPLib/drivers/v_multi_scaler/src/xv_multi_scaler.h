@@ -105,6 +105,8 @@ typedef struct {
     XVMultiScaler_Callback FrameDoneCallback;
     void *CallbackRef;
     u8 OutBitMask;
+    const short *VCoeffLoaded[XV_MAX_OUTS];
+    const short *HCoeffLoaded[XV_MAX_OUTS];
 } XV_multi_scaler;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -344,30 +344,25 @@ void XV_MultiScalerSetNumOutputs(XV_multi_scaler *InstancePtr, u32 NumOuts)
 
 /*****************************************************************************/
 /**
-* This function programs the computed filter coefficients and phase data into
-* core registers
+* This function selects the fixed coefficient table for one scaling
+* direction. The selection depends only on the scaling ratio bucket and the
+* number of taps of the core, so the returned table pointer identifies the
+* (ratio, taps, phases) set loaded into a channel's coefficient bank.
 *
 * @param	MscPtr is a pointer to the core instance to be worked on.
-* @param	NumOut is the output channel number.
+* @param	SizeIn is the input width or height.
+* @param	SizeOut is the output width or height.
 *
-* @return None
+* @return Pointer to the selected coefficient table.
 *
 ******************************************************************************/
-static void XV_MultiScalerSetCoeff(XV_multi_scaler *MscPtr,
-		XV_multi_scaler_Video_Config *MS_cfg)
+static const short *XV_MultiScalerSelectCoeff(XV_multi_scaler *MscPtr,
+		u32 SizeIn, u32 SizeOut)
 {
-	u32 num_phases = 1<<MscPtr->PhaseShift;
-	u32 num_taps	= MscPtr->NumTaps/2;
-	u32 val;
-	u32 i;
-	u32 j;
-	u32 baseAddr;
-	short *coeff;
-	u32 vfltcoef_offset;
-	u32 hfltcoef_offset;
+	const short *coeff = NULL;
 	float scale;
 
-	scale = (float)MS_cfg->HeightIn / MS_cfg->HeightOut;
+	scale = (float)SizeIn / SizeOut;
 	if ((scale >= 2) && (scale < 2.5))
 	{
 		if(MscPtr->NumTaps == 6)
@@ -415,11 +410,32 @@ static void XV_MultiScalerSetCoeff(XV_multi_scaler *MscPtr,
 	if(scale < 1)
 		coeff = &XV_multiscaler_fixedcoeff_taps6_12C[0][0];
 
-	vfltcoef_offset = XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_VFLTCOEFF_0_BASE +
-		MS_cfg->ChannelId *
-		XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_FLTCOEFF_OFFSET;
+	return coeff;
+}
+
+/*****************************************************************************/
+/**
+* This function writes a coefficient table into one coefficient bank of the
+* core
+*
+* @param	MscPtr is a pointer to the core instance to be worked on.
+* @param	BankOffset is the register offset of the coefficient bank.
+* @param	coeff is the coefficient table to be written.
+*
+* @return None
+*
+******************************************************************************/
+static void XV_MultiScalerWriteCoeff(XV_multi_scaler *MscPtr,
+		u32 BankOffset, const short *coeff)
+{
+	u32 num_phases = 1<<MscPtr->PhaseShift;
+	u32 num_taps	= MscPtr->NumTaps/2;
+	u32 val;
+	u32 i;
+	u32 j;
+	u32 baseAddr;
 
-	baseAddr = MscPtr->Ctrl_BaseAddress + vfltcoef_offset;
+	baseAddr = MscPtr->Ctrl_BaseAddress + BankOffset;
 	for (i = 0; i < num_phases; i++) {
 		for (j = 0; j < XV_MULTISCALER_TAPS_12; j = j + 2) {
 			val = (coeff[i * XV_MULTISCALER_TAPS_12 + (j + 1)] << 16) |
@@ -428,67 +444,70 @@ static void XV_MultiScalerSetCoeff(XV_multi_scaler *MscPtr,
 					((i * num_taps + j / 2) * 4), val);
 		}
 	}
+}
 
-	scale = (float)MS_cfg->WidthIn / MS_cfg->WidthOut;
-	if ((scale >= 2) && (scale < 2.5))
-	{
-		if(MscPtr->NumTaps == 6)
-			coeff = &XV_multiscaler_fixedcoeff_taps6_6C[0][0];
-		else
-			coeff = &XV_multiscaler_fixedcoeff_taps8_12C[0][0];
-	}
-	if ((scale >= 2.5) && (scale < 3))
-	{
-		if(MscPtr->NumTaps >= 10)
-			coeff = &XV_multiscaler_fixedcoeff_taps10_12C[0][0];
-		else
-		{
-			if(MscPtr->NumTaps == 6)
-				coeff = &XV_multiscaler_fixedcoeff_taps6_6C[0][0];
-			else
-				coeff = &XV_multiscaler_fixedcoeff_taps8_8C[0][0];
-		}
+/*****************************************************************************/
+/**
+* This function programs the computed filter coefficients and phase data into
+* core registers. Each channel has its own vertical and horizontal coefficient
+* bank; a bank is only rewritten when the selected table differs from the one
+* last loaded into it, so reconfiguring channels whose scaling ratios have not
+* changed costs no coefficient writes.
+*
+* @param	MscPtr is a pointer to the core instance to be worked on.
+* @param	MS_cfg is a pointer to the multi scaler config structure.
+*
+* @return None
+*
+******************************************************************************/
+static void XV_MultiScalerSetCoeff(XV_multi_scaler *MscPtr,
+		XV_multi_scaler_Video_Config *MS_cfg)
+{
+	const short *coeff;
+	u32 vfltcoef_offset;
+	u32 hfltcoef_offset;
+	u32 ch = MS_cfg->ChannelId;
+
+	coeff = XV_MultiScalerSelectCoeff(MscPtr, MS_cfg->HeightIn,
+			MS_cfg->HeightOut);
+	if (coeff != MscPtr->VCoeffLoaded[ch]) {
+		vfltcoef_offset = XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_VFLTCOEFF_0_BASE +
+			ch * XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_FLTCOEFF_OFFSET;
+		XV_MultiScalerWriteCoeff(MscPtr, vfltcoef_offset, coeff);
+		MscPtr->VCoeffLoaded[ch] = coeff;
 	}
 
-	if ((scale >= 3) && (scale < 3.5))
-		if(MscPtr->NumTaps == 12)
-			coeff = &XV_multiscaler_fixedcoeff_taps12_12C[0][0];
-		else
-		{
-			if(MscPtr->NumTaps == 6)
-				coeff = &XV_multiscaler_fixedcoeff_taps6_6C[0][0];
-			if(MscPtr->NumTaps == 8)
-				coeff = &XV_multiscaler_fixedcoeff_taps8_8C[0][0];
-			if(MscPtr->NumTaps == 10)
-				coeff = &XV_multiscaler_fixedcoeff_taps10_10C[0][0];
-		}
-
-	if ((scale >= 3.5) || (scale < 2 && scale >= 1))
-	{
-		if(MscPtr->NumTaps == 6)
-			coeff = &XV_multiscaler_fixedcoeff_taps6_6C[0][0];
-		if(MscPtr->NumTaps == 8)
-			coeff = &XV_multiscaler_fixedcoeff_taps8_8C[0][0];
-		if(MscPtr->NumTaps == 10)
-			coeff = &XV_multiscaler_fixedcoeff_taps10_10C[0][0];
-		if(MscPtr->NumTaps == 12)
-			coeff = &XV_multiscaler_fixedcoeff_taps12_12C[0][0];
+	coeff = XV_MultiScalerSelectCoeff(MscPtr, MS_cfg->WidthIn,
+			MS_cfg->WidthOut);
+	if (coeff != MscPtr->HCoeffLoaded[ch]) {
+		hfltcoef_offset = XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_HFLTCOEFF_0_BASE +
+			ch * XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_FLTCOEFF_OFFSET;
+		XV_MultiScalerWriteCoeff(MscPtr, hfltcoef_offset, coeff);
+		MscPtr->HCoeffLoaded[ch] = coeff;
 	}
-	if(scale < 1)
-		coeff = &XV_multiscaler_fixedcoeff_taps6_12C[0][0];
+}
 
-	hfltcoef_offset = XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_HFLTCOEFF_0_BASE +
-		MS_cfg->ChannelId *
-		XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_FLTCOEFF_OFFSET;
+/*****************************************************************************/
+/**
+* This function forgets which coefficient tables are loaded in the core so
+* that the next channel configuration rewrites every coefficient bank. The
+* coefficient banks are not cleared by a core reset, so this is only required
+* if their contents may have been lost otherwise.
+*
+* @param	InstancePtr is a pointer to the core instance to be worked on.
+*
+* @return None
+*
+******************************************************************************/
+void XV_MultiScalerInvalidateCoeff(XV_multi_scaler *InstancePtr)
+{
+	u32 i;
 
-	baseAddr = MscPtr->Ctrl_BaseAddress + hfltcoef_offset;
-	for (i = 0; i < num_phases; i++) {
-		for (j = 0; j < XV_MULTISCALER_TAPS_12; j = j + 2) {
-			val = (coeff[i * XV_MULTISCALER_TAPS_12 + (j + 1)] << 16) |
-				(coeff[i * XV_MULTISCALER_TAPS_12 + j] & 0x0000FFFF);
-			XV_multi_scaler_WriteReg(baseAddr,
-					((i * num_taps + j / 2) * 4), val);
-		}
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	for (i = 0; i < XV_MAX_OUTS; i++) {
+		InstancePtr->VCoeffLoaded[i] = NULL;
+		InstancePtr->HCoeffLoaded[i] = NULL;
 	}
 }
 
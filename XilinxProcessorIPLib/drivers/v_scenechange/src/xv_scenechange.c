@@ -14,6 +14,7 @@ int XV_scenechange_CfgInitialize(XV_scenechange *InstancePtr, XV_scenechange_Con
 
     InstancePtr->Ctrl_BaseAddress = ConfigPtr->Ctrl_BaseAddress;
     InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
+    XV_scenechange_ClearSadHistory(InstancePtr);
 
     return XST_SUCCESS;
 }
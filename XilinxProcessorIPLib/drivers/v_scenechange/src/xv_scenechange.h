@@ -38,6 +38,7 @@ extern "C" {
 #define XV_SCD_IDLE_TIMEOUT		(1000000)
 #define XV_SCD_MEMORY_MODE		1
 #define XV_SCD_STREAM_MODE		0
+#define XV_SCD_SAD_HISTORY_DEPTH	16
 
 /**************************** Type Definitions ******************************/
 
@@ -91,6 +92,17 @@ typedef struct {
     u8  StreamEnable;
     XVScdClrFmt VFormat;
 } XVScdLayerConfig;
+
+/**
+ * SAD results of all enabled streams captured at one frame done interrupt.
+ */
+typedef struct {
+    u32 FrameNum;     /**< Frame count at capture */
+    u32 StreamMask;   /**< Streams with a valid SAD */
+    u32 DetMask;      /**< Streams with SAD over their threshold */
+    u32 SAD[XV_SCD_IP_MAX_STREAMS];
+} XVScdSadFrame;
+
 typedef struct {
     UINTPTR Ctrl_BaseAddress;
     u32 IsReady;
@@ -100,6 +112,13 @@ typedef struct {
     XV_scenechange_Config *ScdConfig;
     XVScdLayerConfig LayerConfig[XV_SCD_IP_MAX_STREAMS];
     XVSceneChange_Callback FrameDoneCallback;
+    void *SadDoneCallbackRef;
+    XVSceneChange_Callback SadDoneCallback;
+    XVScdSadFrame SadHistory[XV_SCD_SAD_HISTORY_DEPTH]; /**< Circular SAD
+                                                          *  history */
+    u32 SadHistoryHead;  /**< Index of the latest history entry */
+    u32 SadHistoryCount; /**< Number of valid history entries */
+    u32 FrameCount;      /**< Frames captured since the last clear */
 } XV_scenechange;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -263,6 +282,13 @@ int XV_scenechange_Layer_config(XV_scenechange *InstancePtr, u8 layerid);
 void XV_scenechange_Layer_stream_enable(XV_scenechange *InstancePtr, u32 Data);
 u32 XV_scenechange_Stop(XV_scenechange *InstancePtr);
 u32 XV_scenechange_WaitForIdle(XV_scenechange *InstancePtr);
+void XV_scenechange_SetSadDoneCallback(XV_scenechange *InstancePtr,
+				       void *CallbackFunc, void *CallbackRef);
+void XV_scenechange_ClearSadHistory(XV_scenechange *InstancePtr);
+int XV_scenechange_GetFrameSAD(XV_scenechange *InstancePtr, u32 Age,
+			       XVScdSadFrame *FramePtr);
+u32 XV_scenechange_GetSadHistory(XV_scenechange *InstancePtr, u8 LayerId,
+				 u32 *SadBuf, u32 Count);
 #ifdef __cplusplus
 }
 #endif
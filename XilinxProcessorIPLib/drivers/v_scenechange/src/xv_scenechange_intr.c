@@ -19,6 +19,8 @@
  * Ver   Who    Date     Changes
  * ----- ---- -------- -------------------------------------------------------
  * 1.00  praveenv   13/09/18   Initial Release
+ * 1.4   ag         10/15/26   Capture the SAD of all streams in a circular
+ *                             history and add a per-frame SAD done callback.
  * </pre>
  *
  ******************************************************************************/
@@ -45,26 +47,53 @@ static u32 XV_scenechange_get_sad(XV_scenechange *InstancePtr, u8 streamid)
 
 static void XV_scenechange_handler(XV_scenechange *ScdPtr)
 {
-	u32 index, Data, SADTF, SAD;
+	XVScdSadFrame *FramePtr;
+	XVScdLayerConfig *LayerPtr;
+	u32 index, Data, SAD;
 
 	Data = XV_scenechange_Get_HwReg_stream_enable(ScdPtr);
 
+	/* Capture all streams of this frame in the next history entry */
+	ScdPtr->SadHistoryHead = (ScdPtr->SadHistoryHead + 1) %
+				 XV_SCD_SAD_HISTORY_DEPTH;
+	if (ScdPtr->SadHistoryCount < XV_SCD_SAD_HISTORY_DEPTH)
+		ScdPtr->SadHistoryCount++;
+
+	FramePtr = &ScdPtr->SadHistory[ScdPtr->SadHistoryHead];
+	FramePtr->FrameNum = ScdPtr->FrameCount++;
+	FramePtr->StreamMask = 0;
+	FramePtr->DetMask = 0;
+
 	for (index = 0; index < ScdPtr->ScdConfig->NumStreams; index++) {
 		if (Data & (1 << index)) {
+			LayerPtr = &ScdPtr->LayerConfig[index];
 			SAD = XV_scenechange_get_sad(ScdPtr, index);
-			SADTF = ((SAD * ScdPtr->LayerConfig[index].SubSample) /
-					(ScdPtr->LayerConfig[index].Height *
-					 ScdPtr->LayerConfig[index].Width));
 
-			ScdPtr->LayerConfig[index].SAD = SAD;
-
-			if (SADTF >= ScdPtr->LayerConfig[index].Threshold) {
+			LayerPtr->SAD = SAD;
+			FramePtr->SAD[index] = SAD;
+			FramePtr->StreamMask |= (1 << index);
+
+			/*
+			 * Same as (SAD * SubSample) / (Height * Width) >=
+			 * Threshold without the division and without
+			 * overflowing 32 bits.
+			 */
+			if (((u64)SAD * LayerPtr->SubSample) >=
+			    ((u64)LayerPtr->Threshold * LayerPtr->Height *
+			     LayerPtr->Width)) {
+				FramePtr->DetMask |= (1 << index);
 				ScdPtr->ScdLayerDetSAD = SAD;
 				ScdPtr->ScdDetLayerId = index;
-				ScdPtr->FrameDoneCallback(ScdPtr);
+				if (ScdPtr->FrameDoneCallback)
+					ScdPtr->FrameDoneCallback(ScdPtr);
 			}
+		} else {
+			FramePtr->SAD[index] = 0;
 		}
 	}
+
+	if (ScdPtr->SadDoneCallback)
+		ScdPtr->SadDoneCallback(ScdPtr->SadDoneCallbackRef);
 }
 
 /*****************************************************************************/
@@ -95,6 +124,37 @@ void XV_scenechange_SetCallback(XV_scenechange *InstancePtr,
 	InstancePtr->CallbackRef = CallbackRef;
 }
 
+/*****************************************************************************/
+/**
+ *
+ * This function installs a callback function that is invoked once per frame
+ * done interrupt after the SAD values of all enabled streams were captured in
+ * the SAD history. The callback can fetch the results of every stream with
+ * XV_scenechange_GetFrameSAD instead of polling the SAD registers.
+ *
+ * @param    InstancePtr is a pointer to the SceneChange IP instance.
+ * @param    CallbackFunc is the address of the callback function.
+ * @param    CallbackRef is a user data item that will be passed to the
+ *       callback function when it is invoked.
+ *
+ * @return	None.
+ *
+ * @note     The callback installed with XV_scenechange_SetCallback is still
+ *       invoked for every stream whose SAD exceeds its threshold, before
+ *       this callback.
+ *
+ ******************************************************************************/
+void XV_scenechange_SetSadDoneCallback(XV_scenechange *InstancePtr,
+		void *CallbackFunc, void *CallbackRef)
+{
+	/* Verify arguments. */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(CallbackFunc != NULL);
+
+	InstancePtr->SadDoneCallback = (XVSceneChange_Callback)CallbackFunc;
+	InstancePtr->SadDoneCallbackRef = CallbackRef;
+}
+
 /*****************************************************************************/
 /**
  *
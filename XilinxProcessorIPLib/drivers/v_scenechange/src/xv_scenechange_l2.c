@@ -26,6 +26,7 @@
  *			 software to flush pending transactions.IP is expecting
  *			 a hard reset, when flushing is done.(There is a flush
  *			 status bit and is asserted when the flush is done).
+ * 1.4   ag   10/15/26   Added SAD history read functions.
  * <pre>
  *
  * ****************************************************************************/
@@ -262,3 +263,90 @@ void XV_scenechange_EnableInterrupts(void *InstancePtr)
 	XV_scenechange_InterruptEnable(InstancePtr,
 			XV_SCENECHANGE_CTRL_ADDR_ISR_AP_DONE);
 }
+
+/*****************************************************************************/
+/**
+* This function discards the SAD history and restarts the frame count.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return None
+*
+******************************************************************************/
+void XV_scenechange_ClearSadHistory(XV_scenechange *InstancePtr)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	InstancePtr->SadHistoryHead = XV_SCD_SAD_HISTORY_DEPTH - 1;
+	InstancePtr->SadHistoryCount = 0;
+	InstancePtr->FrameCount = 0;
+}
+
+/*****************************************************************************/
+/**
+* This function returns the SAD results of all streams captured at one frame
+* done interrupt. The values come from the driver history, so no register is
+* read.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  Age selects the frame, 0 being the latest captured frame and
+*         XV_SCD_SAD_HISTORY_DEPTH - 1 the oldest one kept
+* @param  FramePtr is filled with the frame results
+*
+* @return XST_SUCCESS if the frame is in the history
+*         XST_FAILURE if fewer than Age + 1 frames were captured
+*
+******************************************************************************/
+int XV_scenechange_GetFrameSAD(XV_scenechange *InstancePtr, u32 Age,
+			       XVScdSadFrame *FramePtr)
+{
+	u32 Index;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(FramePtr != NULL);
+
+	if (Age >= InstancePtr->SadHistoryCount)
+		return XST_FAILURE;
+
+	Index = (InstancePtr->SadHistoryHead + XV_SCD_SAD_HISTORY_DEPTH - Age) %
+		XV_SCD_SAD_HISTORY_DEPTH;
+	*FramePtr = InstancePtr->SadHistory[Index];
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* This function copies the SAD history of one stream, latest value first.
+* Frames in which the stream was disabled are skipped.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  LayerId is the stream to read
+* @param  SadBuf receives up to Count SAD values
+* @param  Count is the size of SadBuf
+*
+* @return Number of SAD values copied to SadBuf
+*
+******************************************************************************/
+u32 XV_scenechange_GetSadHistory(XV_scenechange *InstancePtr, u8 LayerId,
+				 u32 *SadBuf, u32 Count)
+{
+	XVScdSadFrame *FramePtr;
+	u32 Age, Index, Num = 0;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(LayerId < XV_SCD_IP_MAX_STREAMS);
+	Xil_AssertNonvoid(SadBuf != NULL);
+
+	for (Age = 0; (Age < InstancePtr->SadHistoryCount) && (Num < Count);
+	     Age++) {
+		Index = (InstancePtr->SadHistoryHead +
+			 XV_SCD_SAD_HISTORY_DEPTH - Age) %
+			XV_SCD_SAD_HISTORY_DEPTH;
+		FramePtr = &InstancePtr->SadHistory[Index];
+		if (FramePtr->StreamMask & (1 << LayerId))
+			SadBuf[Num++] = FramePtr->SAD[LayerId];
+	}
+
+	return Num;
+}
@@ -128,6 +128,7 @@ int XV_scenechange_Initialize(XV_scenechange *InstancePtr, const char* InstanceN
     assert(InstancePtr->Ctrl_BaseAddress);
 
     InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
+    XV_scenechange_ClearSadHistory(InstancePtr);
 
     return XST_SUCCESS;
 }
@@ -27,6 +27,7 @@
 *       rco   02/09/17   Fix c++ compilation warnings
 *	jsr   09/07/18 Fix for 64-bit driver support
 * 3.1   vsa   04/07/20   Improve quality with new coefficients
+* 3.2   ag    10/15/26   Skip reloading unchanged filter coefficients
 *
 * </pre>
 *
@@ -233,6 +234,12 @@ static void XV_VScalerSelectCoeff(XV_Vscaler_l2 *InstancePtr,
 	numTaps = XV_VSCALER_TAPS_6;
   }
 
+  /* Selected table is already held in the local coefficient store */
+  if(coeff == InstancePtr->CoeffTbl)
+  {
+    return;
+  }
+
   XV_VScalerLoadExtCoeff(InstancePtr,
 		                 numPhases,
 		                 numTaps,
@@ -240,6 +247,7 @@ static void XV_VScalerSelectCoeff(XV_Vscaler_l2 *InstancePtr,
 
   /* Disable use of external coefficients */
   InstancePtr->UseExtCoeff = FALSE;
+  InstancePtr->CoeffTbl = coeff;
 }
 
 /*****************************************************************************/
@@ -314,6 +322,30 @@ void XV_VScalerLoadExtCoeff(XV_Vscaler_l2 *InstancePtr,
 
   /* Enable use of external coefficients */
   InstancePtr->UseExtCoeff = TRUE;
+
+  /* Coefficient store changed and needs to be programmed into the core */
+  InstancePtr->CoeffTbl = NULL;
+  InstancePtr->CoeffLoaded = FALSE;
+}
+
+/*****************************************************************************/
+/**
+* This function discards the record of the coefficients programmed into the
+* core so that the next call to XV_VScalerSetup reloads them. The
+* coefficient memory of the core is not cleared by a core reset, so this is
+* only required if its contents may have been lost otherwise.
+*
+* @param  InstancePtr is a pointer to the core instance to be worked on.
+*
+* @return None
+*
+******************************************************************************/
+void XV_VScalerInvalidateCoeff(XV_Vscaler_l2 *InstancePtr)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+
+  InstancePtr->CoeffTbl = NULL;
+  InstancePtr->CoeffLoaded = FALSE;
 }
 
 /*****************************************************************************/
@@ -397,8 +429,12 @@ int XV_VScalerSetup(XV_Vscaler_l2  *InstancePtr,
       XV_VScalerSelectCoeff(InstancePtr,  HeightIn, HeightOut);
     }
 
-    /* Program coefficients into the IP register bank */
-    XV_VScalerSetCoeff(InstancePtr);
+    /* Program coefficients into the IP register bank if they changed */
+    if(!InstancePtr->CoeffLoaded)
+    {
+      XV_VScalerSetCoeff(InstancePtr);
+      InstancePtr->CoeffLoaded = TRUE;
+    }
   }
 
   LineRate = (HeightIn * STEP_PRECISION)/HeightOut;
@@ -69,6 +69,8 @@
 * 2.00  rco   11/05/15   Integrate layer-1 with layer-2
 * 3.0   mpe   04/28/16   Added optional color format conversion handling
 * 3.1   vsa   04/07/20   Improve quality with new coefficients
+* 3.2   ag    10/15/26   Added coefficient load tracking and
+*                        XV_VScalerInvalidateCoeff
 *
 * </pre>
 *
@@ -124,6 +126,8 @@ typedef struct
   XV_vscaler Vsc; /*<< Layer 1 instance */
   u8 UseExtCoeff;
   short coeff[XV_VSCALER_MAX_V_PHASES][XV_VSCALER_MAX_V_TAPS];
+  const short *CoeffTbl; /*<< Fixed table held in coeff, NULL if none */
+  u8 CoeffLoaded;        /*<< coeff already programmed into the core */
 }XV_Vscaler_l2;
 
 /************************** Macros Definitions *******************************/
@@ -144,6 +148,7 @@ typedef struct
 int XV_VScalerInitialize(XV_Vscaler_l2 *InstancePtr, u16 DeviceId);
 void XV_VScalerStart(XV_Vscaler_l2 *InstancePtr);
 void XV_VScalerStop(XV_Vscaler_l2 *InstancePtr);
+void XV_VScalerInvalidateCoeff(XV_Vscaler_l2 *InstancePtr);
 void XV_VScalerLoadExtCoeff(XV_Vscaler_l2 *InstancePtr,
                             u16 num_phases,
                             u16 num_taps,
@@ -17,6 +17,7 @@ s32 XV_warp_filter_CfgInitialize(XV_warp_filter *InstancePtr, XV_warp_filter_Con
 
     InstancePtr->WarpFilterDesc_BaseAddr = 0;
     InstancePtr->NumDescriptors = 0;
+    InstancePtr->NumJobs = 0;
 
     return XST_SUCCESS;
 }
@@ -29,6 +29,9 @@ extern "C" {
 #endif
 #include "xv_warp_filter_hw.h"
 
+/************************** Constant Definitions ****************************/
+#define XV_WARP_FILTER_MAX_JOBS	8	/*Max jobs queued for one submission*/
+
 /**************************** Type Definitions ******************************/
 #ifdef __linux__
 typedef uint8_t u8;
@@ -56,6 +59,9 @@ typedef struct {
     void *CallbackRef;
 	UINTPTR WarpFilterDesc_BaseAddr;
 	u32 NumDescriptors;
+	u32 JobFirstDesc[XV_WARP_FILTER_MAX_JOBS];	/*First descriptor of job*/
+	u32 JobNumDesc[XV_WARP_FILTER_MAX_JOBS];	/*Descriptors in job*/
+	u32 NumJobs;					/*Jobs queued*/
 } XV_warp_filter;
 
 typedef u32 word_type;
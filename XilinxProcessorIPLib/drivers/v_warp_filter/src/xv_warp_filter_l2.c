@@ -20,15 +20,21 @@ typedef u16 offset_t;
 #define XV_WAIT_FOR_FLUSH_DONE		         (25)
 #define XV_WAIT_FOR_FLUSH_DONE_TIMEOUT		 (2000)
 #define WARP_FILTER_ADDR_WIDTH				 128
+#define WARP_FILTER_DESC_STRIDE	\
+	align_up(sizeof(XVWarpFilter_Desc), WARP_FILTER_ADDR_WIDTH/8)
 
 /**************************Static Function Prototypes ************************/
 static void *XVWarpFilter_AlignedMalloc(size_t align, size_t size);
 static void XVWarpFilter_AlignedFree(void * ptr);
+static XVWarpFilter_Desc *XVWarpFilter_GetDesc(XV_warp_filter *InstancePtr,
+		u32 DescNum);
 
 /************************** Function Definitions *****************************/
 /*****************************************************************************/
 /**
-* This function creates the descriptors.
+* This function creates the descriptors. The descriptors are allocated as one
+* contiguous table, chained in order, so that a descriptor is located by index
+* and the table can be kept and reused across frames.
 *
 * @param  InstancePtr is a pointer to core instance to be worked upon
 * @param  num_desc is the number of descriptors to be created
@@ -40,29 +46,32 @@ static void XVWarpFilter_AlignedFree(void * ptr);
 s32 XVWarpFilter_SetNumOfDescriptors(XV_warp_filter *InstancePtr,
 		u32 num_descriptors)
 {
-	XVWarpFilter_Desc *descptr = NULL, *currptr, *prevptr;
+	XVWarpFilter_Desc *currptr;
+	UINTPTR descbase;
 	u32 descnum;
 
 	Xil_AssertNonvoid(InstancePtr);
 
+	descbase = (UINTPTR)XVWarpFilter_AlignedMalloc(WARP_FILTER_ADDR_WIDTH/8,
+			num_descriptors * WARP_FILTER_DESC_STRIDE);
+	if (!descbase)
+		return XST_FAILURE;
+
 	for (descnum = 0; descnum < num_descriptors; descnum++)
 	{
-		currptr = (XVWarpFilter_Desc *)XVWarpFilter_AlignedMalloc(WARP_FILTER_ADDR_WIDTH/8,
-				sizeof(XVWarpFilter_Desc));
-		memset((u32 *)currptr, 0, sizeof(XVWarpFilter_Desc));
-
-		if (descnum == 0)
-			descptr = currptr;
-		if (descnum > 0)
-			prevptr->Warp_NextDescAddr = (u64)currptr;
+		currptr = (XVWarpFilter_Desc *)(descbase +
+				descnum * WARP_FILTER_DESC_STRIDE);
+
 		if (descnum == (num_descriptors - 1))
 			currptr->Warp_NextDescAddr = (u64)0;
-
-		prevptr = currptr;
+		else
+			currptr->Warp_NextDescAddr = (u64)((UINTPTR)currptr +
+					WARP_FILTER_DESC_STRIDE);
 	}
 
-	InstancePtr->WarpFilterDesc_BaseAddr = (u64)descptr;
+	InstancePtr->WarpFilterDesc_BaseAddr = descbase;
 	InstancePtr->NumDescriptors = descnum;
+	InstancePtr->NumJobs = 0;
 
 	return XST_SUCCESS;
 }
@@ -78,21 +87,14 @@ s32 XVWarpFilter_SetNumOfDescriptors(XV_warp_filter *InstancePtr,
 ******************************************************************************/
 void XVWarpFilter_ClearNumOfDescriptors(XV_warp_filter *InstancePtr)
 {
-	XVWarpFilter_Desc *head, *tmpptr;
-
 	Xil_AssertVoid(InstancePtr);
 
-	head = (XVWarpFilter_Desc *)InstancePtr->WarpFilterDesc_BaseAddr;
-
-	while(head->Warp_NextDescAddr) {
-		tmpptr = (XVWarpFilter_Desc *)head->Warp_NextDescAddr;
-		XVWarpFilter_AlignedFree(head);
-		head = tmpptr;
-	}
+	if (InstancePtr->WarpFilterDesc_BaseAddr)
+		XVWarpFilter_AlignedFree((void *)InstancePtr->WarpFilterDesc_BaseAddr);
 
-	XVWarpFilter_AlignedFree(head);
 	InstancePtr->WarpFilterDesc_BaseAddr = 0;
 	InstancePtr->NumDescriptors = 0;
+	InstancePtr->NumJobs = 0;
 }
 
 /*****************************************************************************/
@@ -118,7 +120,6 @@ s32 XVWarpFilter_ProgramDescriptor(XV_warp_filter *InstancePtr, u32 DescNum,
 		u32 lblock_count, u32 line_num)
 {
 	XVWarpFilter_Desc *descptr;
-	u32 i;
 
 	Xil_AssertNonvoid(InstancePtr);
 
@@ -127,10 +128,7 @@ s32 XVWarpFilter_ProgramDescriptor(XV_warp_filter *InstancePtr, u32 DescNum,
 		return XST_FAILURE;
 	}
 
-	descptr = (XVWarpFilter_Desc *)InstancePtr->WarpFilterDesc_BaseAddr;
-	for (i = 0; i < DescNum; i++) {
-		descptr = (XVWarpFilter_Desc *)descptr->Warp_NextDescAddr;
-	}
+	descptr = XVWarpFilter_GetDesc(InstancePtr, DescNum);
 
 	descptr->height = configPtr->height;
 	descptr->width = configPtr->width;
@@ -165,7 +163,6 @@ s32 XVWarpFilter_update_src_frame_addr(XV_warp_filter *InstancePtr,
 		u32 Descnum, u64 src_buf_addr)
 {
 	XVWarpFilter_Desc *descptr;
-	u32 i;
 
 	Xil_AssertNonvoid(InstancePtr);
 
@@ -174,10 +171,7 @@ s32 XVWarpFilter_update_src_frame_addr(XV_warp_filter *InstancePtr,
 		return XST_FAILURE;
 	}
 
-	descptr = (XVWarpFilter_Desc *)InstancePtr->WarpFilterDesc_BaseAddr;
-	for (i = 0; i < Descnum; i++) {
-		descptr = (XVWarpFilter_Desc *)descptr->Warp_NextDescAddr;
-	}
+	descptr = XVWarpFilter_GetDesc(InstancePtr, Descnum);
 
 	descptr->src_buf_addr = src_buf_addr;
 
@@ -202,15 +196,16 @@ s32 XVWarpFilter_update_dst_frame_addr(XV_warp_filter *InstancePtr,
 		u32 Descnum, u64 dest_buf_addr)
 {
 	XVWarpFilter_Desc *descptr;
-	u32 i;
 
 	Xil_AssertNonvoid(InstancePtr);
 
-	descptr = (XVWarpFilter_Desc *)InstancePtr->WarpFilterDesc_BaseAddr;
-	for (i = 0; i < Descnum; i++) {
-		descptr = (XVWarpFilter_Desc *)descptr->Warp_NextDescAddr;
+	if (Descnum >= InstancePtr->NumDescriptors) {
+		xil_printf("Wrong descriptor\n\r");
+		return XST_FAILURE;
 	}
 
+	descptr = XVWarpFilter_GetDesc(InstancePtr, Descnum);
+
 	descptr->dest_buf_addr = dest_buf_addr;
 
 	XV_warp_filter_Set_desc_addr(InstancePtr, (u64)descptr);
@@ -218,6 +213,154 @@ s32 XVWarpFilter_update_dst_frame_addr(XV_warp_filter *InstancePtr,
 	return XST_SUCCESS;
 }
 
+/*****************************************************************************/
+/**
+* This function patches the frame buffer addresses of a range of descriptors.
+* Only the addresses are rewritten; the remaining descriptor contents are
+* reused as programmed, so a descriptor set built once with
+* XVWarpFilter_ProgramDescriptor can be retargeted to new frames with a
+* single call per frame.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  FirstDesc is the first descriptor number to be updated
+* @param  NumDesc is the number of descriptors to be updated
+* @param  src_buf_addr is the array of NumDesc source frame buffer addresses,
+*         or NULL to keep the source addresses
+* @param  dest_buf_addr is the array of NumDesc destination frame buffer
+*         addresses, or NULL to keep the destination addresses
+*
+* @return XST_SUCCESS if descriptors are updated
+*         XST_FAILURE if the descriptor range is not valid.
+*
+******************************************************************************/
+s32 XVWarpFilter_UpdateFrameAddrs(XV_warp_filter *InstancePtr, u32 FirstDesc,
+		u32 NumDesc, const u64 *src_buf_addr, const u64 *dest_buf_addr)
+{
+	XVWarpFilter_Desc *descptr;
+	u32 i;
+
+	Xil_AssertNonvoid(InstancePtr);
+
+	if ((NumDesc == 0) || (FirstDesc >= InstancePtr->NumDescriptors) ||
+	    (NumDesc > (InstancePtr->NumDescriptors - FirstDesc))) {
+		xil_printf("Wrong descriptor\n\r");
+		return XST_FAILURE;
+	}
+
+	for (i = 0; i < NumDesc; i++) {
+		descptr = XVWarpFilter_GetDesc(InstancePtr, FirstDesc + i);
+		if (src_buf_addr)
+			descptr->src_buf_addr = src_buf_addr[i];
+		if (dest_buf_addr)
+			descptr->dest_buf_addr = dest_buf_addr[i];
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* This function adds a job to the submission queue. A job is a range of
+* consecutive descriptors, typically the descriptor set of one stream.
+* Jobs are chained together and processed in one run of the core by
+* XVWarpFilter_SubmitJobs.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  FirstDesc is the first descriptor number of the job
+* @param  NumDesc is the number of descriptors in the job
+*
+* @return XST_SUCCESS if the job is queued
+*         XST_FAILURE if the descriptor range is not valid or the queue
+*         is full.
+*
+******************************************************************************/
+s32 XVWarpFilter_QueueJob(XV_warp_filter *InstancePtr, u32 FirstDesc,
+		u32 NumDesc)
+{
+	Xil_AssertNonvoid(InstancePtr);
+
+	if ((NumDesc == 0) || (FirstDesc >= InstancePtr->NumDescriptors) ||
+	    (NumDesc > (InstancePtr->NumDescriptors - FirstDesc))) {
+		xil_printf("Wrong descriptor\n\r");
+		return XST_FAILURE;
+	}
+
+	if (InstancePtr->NumJobs >= XV_WARP_FILTER_MAX_JOBS)
+		return XST_FAILURE;
+
+	InstancePtr->JobFirstDesc[InstancePtr->NumJobs] = FirstDesc;
+	InstancePtr->JobNumDesc[InstancePtr->NumJobs] = NumDesc;
+	InstancePtr->NumJobs++;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* This function chains all queued jobs into one descriptor list, points the
+* core at its head and starts the core. Only the next descriptor address of
+* the last descriptor of each job is rewritten. The queue is emptied on
+* success.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return XST_SUCCESS if the jobs are submitted
+*         XST_NO_DATA if no job is queued
+*         XST_DEVICE_BUSY if the core is still processing
+*
+******************************************************************************/
+s32 XVWarpFilter_SubmitJobs(XV_warp_filter *InstancePtr)
+{
+	XVWarpFilter_Desc *tailptr;
+	u32 job;
+	u64 next;
+
+	Xil_AssertNonvoid(InstancePtr);
+
+	if (InstancePtr->NumJobs == 0)
+		return XST_NO_DATA;
+
+	if (!XV_warp_filter_IsIdle(InstancePtr))
+		return XST_DEVICE_BUSY;
+
+	for (job = 0; job < InstancePtr->NumJobs; job++) {
+		tailptr = XVWarpFilter_GetDesc(InstancePtr,
+				InstancePtr->JobFirstDesc[job] +
+				InstancePtr->JobNumDesc[job] - 1);
+		if (job == (InstancePtr->NumJobs - 1))
+			next = (u64)0;
+		else
+			next = (u64)(UINTPTR)XVWarpFilter_GetDesc(InstancePtr,
+					InstancePtr->JobFirstDesc[job + 1]);
+		tailptr->Warp_NextDescAddr = next;
+	}
+
+	XV_warp_filter_Set_desc_addr(InstancePtr,
+			(u64)(UINTPTR)XVWarpFilter_GetDesc(InstancePtr,
+					InstancePtr->JobFirstDesc[0]));
+	InstancePtr->NumJobs = 0;
+
+	XV_warp_filter_Start(InstancePtr);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* This function discards all queued jobs without submitting them.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return none
+*
+******************************************************************************/
+void XVWarpFilter_ClearJobs(XV_warp_filter *InstancePtr)
+{
+	Xil_AssertVoid(InstancePtr);
+
+	InstancePtr->NumJobs = 0;
+}
+
 /*****************************************************************************/
 /**
 * This function Enables the Interrupts for the core instance
@@ -308,6 +451,24 @@ s32 XVWarpFilter_Stop(XV_warp_filter *InstancePtr)
   return(Status);
 }
 
+/*****************************************************************************/
+/**
+* This function returns the descriptor at the given index of the descriptor
+* table.
+*
+* @param	InstancePtr is a pointer to core instance to be worked upon
+* @param	DescNum is the descriptor number.
+*
+* @return	Pointer to the descriptor.
+*
+******************************************************************************/
+static XVWarpFilter_Desc *XVWarpFilter_GetDesc(XV_warp_filter *InstancePtr,
+		u32 DescNum)
+{
+	return (XVWarpFilter_Desc *)(InstancePtr->WarpFilterDesc_BaseAddr +
+			DescNum * WARP_FILTER_DESC_STRIDE);
+}
+
 /*****************************************************************************/
 /*****************************************************************************/
 /**
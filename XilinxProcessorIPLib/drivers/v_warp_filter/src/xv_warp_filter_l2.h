@@ -67,6 +67,12 @@ s32 XVWarpFilter_update_src_frame_addr(XV_warp_filter *InstancePtr,
 		u32 Descnum, u64 src_buf_addr);
 s32 XVWarpFilter_update_dst_frame_addr(XV_warp_filter *InstancePtr,
 		u32 Descnum, u64 dest_buf_addr);
+s32 XVWarpFilter_UpdateFrameAddrs(XV_warp_filter *InstancePtr, u32 FirstDesc,
+		u32 NumDesc, const u64 *src_buf_addr, const u64 *dest_buf_addr);
+s32 XVWarpFilter_QueueJob(XV_warp_filter *InstancePtr, u32 FirstDesc,
+		u32 NumDesc);
+s32 XVWarpFilter_SubmitJobs(XV_warp_filter *InstancePtr);
+void XVWarpFilter_ClearJobs(XV_warp_filter *InstancePtr);
 void XVWarpFilter_Start(XV_warp_filter *InstancePtr);
 s32 XVWarpFilter_Stop(XV_warp_filter *InstancePtr);
 #endif
@@ -0,0 +1,324 @@
+/*******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+*******************************************************************************/
+
+/******************************************************************************/
+/**
+ *
+ * @file xvidc_framelog.c
+ * @addtogroup video_common_v4_13
+ * @{
+ *
+ * Contains the implementation of the per-frame timestamp log. See
+ * xvidc_framelog.h for a description of its use.
+ *
+ * @note	None.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 4.13  ag   10/15/26 Initial release.
+ * </pre>
+ *
+*******************************************************************************/
+
+/******************************* Include Files ********************************/
+
+#include "xil_assert.h"
+#include "xstatus.h"
+#include "xvidc_framelog.h"
+
+/**************************** Function Prototypes *****************************/
+
+static void XVidC_FrameLogAddLatency(XVidC_FrameLog *LogPtr,
+		XVidC_FrameLogStats *StatsPtr, u64 Latency);
+
+/*************************** Function Definitions *****************************/
+
+/******************************************************************************/
+/**
+ * This function initializes a frame log and clears all marks and statistics.
+ *
+ * @param	LogPtr is a pointer to the XVidC_FrameLog instance.
+ * @param	NumStages is the number of pipeline stages to log, stage 0
+ *		being the reference stage.
+ * @param	TimeFunc returns the current time.
+ * @param	TimeRef is passed to TimeFunc.
+ * @param	BinWidth is the width of one latency histogram bin in the
+ *		units of TimeFunc.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+void XVidC_FrameLogInit(XVidC_FrameLog *LogPtr, u8 NumStages,
+		XVidC_FrameLogTimeFunc TimeFunc, void *TimeRef, u64 BinWidth)
+{
+	/* Verify arguments. */
+	Xil_AssertVoid(LogPtr != NULL);
+	Xil_AssertVoid((NumStages > 0) &&
+		       (NumStages <= XVIDC_FRAMELOG_MAX_STAGES));
+	Xil_AssertVoid(TimeFunc != NULL);
+	Xil_AssertVoid(BinWidth != 0);
+
+	LogPtr->NumStages = NumStages;
+	LogPtr->TimeFunc = TimeFunc;
+	LogPtr->TimeRef = TimeRef;
+	LogPtr->BinWidth = BinWidth;
+
+	XVidC_FrameLogReset(LogPtr);
+}
+
+/******************************************************************************/
+/**
+ * This function clears all marks and statistics of a frame log.
+ *
+ * @param	LogPtr is a pointer to the XVidC_FrameLog instance.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+void XVidC_FrameLogReset(XVidC_FrameLog *LogPtr)
+{
+	XVidC_FrameLogStage *StagePtr;
+	u32 StageId;
+	u32 Index;
+
+	/* Verify arguments. */
+	Xil_AssertVoid(LogPtr != NULL);
+
+	for (StageId = 0; StageId < XVIDC_FRAMELOG_MAX_STAGES; StageId++) {
+		StagePtr = &LogPtr->Stage[StageId];
+
+		for (Index = 0; Index < XVIDC_FRAMELOG_DEPTH; Index++) {
+			StagePtr->Mark[Index].SeqId = XVIDC_FRAMELOG_SEQ_AUTO;
+			StagePtr->Mark[Index].TimeStamp = 0;
+		}
+		StagePtr->LastSeqId = 0;
+
+		StagePtr->Stats.FrameCnt = 0;
+		StagePtr->Stats.DropCnt = 0;
+		StagePtr->Stats.RepeatCnt = 0;
+		StagePtr->Stats.LatencyCnt = 0;
+		StagePtr->Stats.LatencyMin = 0;
+		StagePtr->Stats.LatencyMax = 0;
+		StagePtr->Stats.LatencySum = 0;
+		for (Index = 0; Index < XVIDC_FRAMELOG_HIST_BINS; Index++) {
+			StagePtr->Stats.Hist[Index] = 0;
+		}
+	}
+}
+
+/******************************************************************************/
+/**
+ * This function records that a stage finished a frame. It is meant to be
+ * called from the frame done handler of the stage.
+ *
+ * @param	LogPtr is a pointer to the XVidC_FrameLog instance.
+ * @param	StageId is the stage that finished the frame.
+ * @param	SeqId is the sequence ID of the frame, or
+ *		XVIDC_FRAMELOG_SEQ_AUTO to use the stage's frame count.
+ *
+ * @return	None.
+ *
+ * @note	A sequence ID that skips ahead counts the skipped frames as
+ *		dropped. A repeated sequence ID is counted as repeat and keeps
+ *		the timestamp of its first mark. A sequence ID older than the
+ *		last one is logged without updating the drop count.
+ *
+*******************************************************************************/
+void XVidC_FrameLogMark(XVidC_FrameLog *LogPtr, u8 StageId, u32 SeqId)
+{
+	XVidC_FrameLogStage *StagePtr;
+	XVidC_FrameMark *MarkPtr;
+	u64 TimeStamp;
+	u64 Latency;
+	u32 Gap;
+
+	/* Verify arguments. */
+	Xil_AssertVoid(LogPtr != NULL);
+	Xil_AssertVoid(StageId < LogPtr->NumStages);
+
+	TimeStamp = LogPtr->TimeFunc(LogPtr->TimeRef);
+	StagePtr = &LogPtr->Stage[StageId];
+
+	if (SeqId == XVIDC_FRAMELOG_SEQ_AUTO) {
+		SeqId = StagePtr->Stats.FrameCnt;
+	}
+
+	if (StagePtr->Stats.FrameCnt > 0) {
+		Gap = SeqId - StagePtr->LastSeqId;
+		if (Gap == 0) {
+			StagePtr->Stats.RepeatCnt++;
+			return;
+		}
+		if (Gap < 0x80000000) {
+			StagePtr->Stats.DropCnt += Gap - 1;
+		}
+	}
+	StagePtr->LastSeqId = SeqId;
+	StagePtr->Stats.FrameCnt++;
+
+	MarkPtr = &StagePtr->Mark[SeqId & (XVIDC_FRAMELOG_DEPTH - 1)];
+	MarkPtr->SeqId = SeqId;
+	MarkPtr->TimeStamp = TimeStamp;
+
+	if ((StageId != 0) &&
+	    (XVidC_FrameLogGetLatency(LogPtr, StageId, SeqId, &Latency) ==
+	     XST_SUCCESS)) {
+		XVidC_FrameLogAddLatency(LogPtr, &StagePtr->Stats, Latency);
+	}
+}
+
+/******************************************************************************/
+/**
+ * This function returns the latency of one frame between the reference stage
+ * and a stage.
+ *
+ * @param	LogPtr is a pointer to the XVidC_FrameLog instance.
+ * @param	StageId is the stage to measure.
+ * @param	SeqId is the sequence ID of the frame.
+ * @param	LatencyPtr is set to the latency in the units of the timestamp
+ *		function.
+ *
+ * @return
+ *		- XST_SUCCESS if both stages still hold a mark of the frame.
+ *		- XST_FAILURE otherwise.
+ *
+ * @note	Only the last XVIDC_FRAMELOG_DEPTH frames of a stage are kept.
+ *
+*******************************************************************************/
+int XVidC_FrameLogGetLatency(const XVidC_FrameLog *LogPtr, u8 StageId,
+		u32 SeqId, u64 *LatencyPtr)
+{
+	const XVidC_FrameMark *RefPtr;
+	const XVidC_FrameMark *MarkPtr;
+	u32 Index;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(LogPtr != NULL);
+	Xil_AssertNonvoid(StageId < LogPtr->NumStages);
+	Xil_AssertNonvoid(LatencyPtr != NULL);
+
+	Index = SeqId & (XVIDC_FRAMELOG_DEPTH - 1);
+	RefPtr = &LogPtr->Stage[0].Mark[Index];
+	MarkPtr = &LogPtr->Stage[StageId].Mark[Index];
+
+	if ((RefPtr->SeqId != SeqId) || (MarkPtr->SeqId != SeqId) ||
+	    (MarkPtr->TimeStamp < RefPtr->TimeStamp)) {
+		return XST_FAILURE;
+	}
+
+	*LatencyPtr = MarkPtr->TimeStamp - RefPtr->TimeStamp;
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function returns the statistics of a stage.
+ *
+ * @param	LogPtr is a pointer to the XVidC_FrameLog instance.
+ * @param	StageId is the stage to query.
+ *
+ * @return	A pointer to the statistics of the stage. The latency fields
+ *		of stage 0 are always zero.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+const XVidC_FrameLogStats *XVidC_FrameLogGetStats(const XVidC_FrameLog *LogPtr,
+		u8 StageId)
+{
+	/* Verify arguments. */
+	Xil_AssertNonvoid(LogPtr != NULL);
+	Xil_AssertNonvoid(StageId < LogPtr->NumStages);
+
+	return &LogPtr->Stage[StageId].Stats;
+}
+
+/******************************************************************************/
+/**
+ * This function prints the statistics of all stages.
+ *
+ * @param	LogPtr is a pointer to the XVidC_FrameLog instance.
+ *
+ * @return	None.
+ *
+ * @note	Latencies are printed in the units of the timestamp function,
+ *		truncated to 32 bits.
+ *
+*******************************************************************************/
+void XVidC_FrameLogReport(const XVidC_FrameLog *LogPtr)
+{
+	const XVidC_FrameLogStats *StatsPtr;
+	u32 StageId;
+	u32 Index;
+	u64 Mean;
+
+	/* Verify arguments. */
+	Xil_AssertVoid(LogPtr != NULL);
+
+	xil_printf("\r\nFrame log (latency to stage 0):\r\n");
+	for (StageId = 0; StageId < LogPtr->NumStages; StageId++) {
+		StatsPtr = &LogPtr->Stage[StageId].Stats;
+		Mean = (StatsPtr->LatencyCnt) ?
+			(StatsPtr->LatencySum / StatsPtr->LatencyCnt) : 0;
+
+		xil_printf("\tStage %d: frames %d, dropped %d, repeated %d\r\n",
+			   StageId, StatsPtr->FrameCnt, StatsPtr->DropCnt,
+			   StatsPtr->RepeatCnt);
+		if (StageId == 0) {
+			continue;
+		}
+		xil_printf("\t\tlatency min %d, mean %d, max %d\r\n",
+			   (u32)StatsPtr->LatencyMin, (u32)Mean,
+			   (u32)StatsPtr->LatencyMax);
+		xil_printf("\t\thistogram:");
+		for (Index = 0; Index < XVIDC_FRAMELOG_HIST_BINS; Index++) {
+			xil_printf(" %d", StatsPtr->Hist[Index]);
+		}
+		xil_printf("\r\n");
+	}
+}
+
+/******************************************************************************/
+/**
+ * This function adds one latency to the statistics of a stage.
+ *
+ * @param	LogPtr is a pointer to the XVidC_FrameLog instance.
+ * @param	StatsPtr is a pointer to the statistics of the stage.
+ * @param	Latency is the latency of the frame.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static void XVidC_FrameLogAddLatency(XVidC_FrameLog *LogPtr,
+		XVidC_FrameLogStats *StatsPtr, u64 Latency)
+{
+	u64 Bin;
+
+	if ((StatsPtr->LatencyCnt == 0) || (Latency < StatsPtr->LatencyMin)) {
+		StatsPtr->LatencyMin = Latency;
+	}
+	if (Latency > StatsPtr->LatencyMax) {
+		StatsPtr->LatencyMax = Latency;
+	}
+	StatsPtr->LatencySum += Latency;
+	StatsPtr->LatencyCnt++;
+
+	Bin = Latency / LogPtr->BinWidth;
+	if (Bin >= XVIDC_FRAMELOG_HIST_BINS) {
+		Bin = XVIDC_FRAMELOG_HIST_BINS - 1;
+	}
+	StatsPtr->Hist[Bin]++;
+}
+/** @} */
@@ -0,0 +1,144 @@
+/*******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+*******************************************************************************/
+
+/******************************************************************************/
+/**
+ *
+ * @file xvidc_framelog.h
+ * @addtogroup video_common_v4_13
+ * @{
+ * @details
+ *
+ * Contains a per-frame timestamp log used to measure the latency a video
+ * pipeline adds between its stages, e.g. HDMI RX, frame buffer write, frame
+ * buffer read, video mixer and HDMI TX.
+ *
+ * Each stage calls XVidC_FrameLogMark from its frame done handler (the
+ * callback the application already installs with the driver, e.g.
+ * XVFrmbufWr_SetCallback or XVMix_SetCallback) with the sequence ID of the
+ * frame it finished. The mark only stores a timestamp in a ring and updates
+ * the stage counters, so it is safe to call from interrupt context.
+ *
+ * Stage 0 is the reference stage, normally the receiver. The latency of a
+ * frame at stage N is the time between its marks at stage 0 and at stage N.
+ * For every stage the log keeps the minimum, maximum and mean latency, a
+ * histogram of the latency and the number of dropped and repeated frames.
+ * Comparing the latency of adjacent stages shows which stage adds a frame.
+ *
+ * The sequence ID is assigned by the application, normally a frame counter
+ * incremented by the reference stage and carried with the frame buffer
+ * address to the later stages. A stage that cannot know the sequence ID may
+ * pass XVIDC_FRAMELOG_SEQ_AUTO, in which case the stage counts its own
+ * frames; this is only meaningful for stages that never drop or repeat.
+ *
+ * Timestamps are read through a user supplied function, e.g. a wrapper of
+ * XTime_GetTime or of a free running AXI timer. The latency and histogram
+ * bin width are in the units of that timer.
+ *
+ * @note	The log is not thread safe. Marks of all stages must come from
+ *		the same interrupt level, and the statistics must be read with
+ *		that interrupt masked.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 4.13  ag   10/15/26 Initial release.
+ * </pre>
+ *
+*******************************************************************************/
+
+#ifndef XVIDC_FRAMELOG_H_  /* Prevent circular inclusions by using protection
+			    * macros. */
+#define XVIDC_FRAMELOG_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************* Include Files ********************************/
+
+#include "xvidc.h"
+
+/************************** Constant Definitions ******************************/
+
+#define XVIDC_FRAMELOG_MAX_STAGES	8	/**< Stages per log. */
+#define XVIDC_FRAMELOG_DEPTH		16	/**< Frames kept per stage,
+						  *  power of 2. */
+#define XVIDC_FRAMELOG_HIST_BINS	16	/**< Latency histogram bins,
+						  *  the last one collects the
+						  *  overflow. */
+#define XVIDC_FRAMELOG_SEQ_AUTO		0xFFFFFFFF /**< Use the stage's own
+						     *  frame count. */
+
+/****************************** Type Definitions ******************************/
+
+/**
+ * Timestamp function. It returns a free running time in any unit.
+ */
+typedef u64 (*XVidC_FrameLogTimeFunc)(void *TimeRef);
+
+/**
+ * This typedef contains one frame mark of a stage.
+ */
+typedef struct {
+	u32 SeqId;		/**< Sequence ID of the frame. */
+	u64 TimeStamp;		/**< Time of the mark. */
+} XVidC_FrameMark;
+
+/**
+ * This typedef contains the statistics of one stage.
+ */
+typedef struct {
+	u32 FrameCnt;		/**< Frames marked. */
+	u32 DropCnt;		/**< Sequence IDs skipped. */
+	u32 RepeatCnt;		/**< Sequence IDs marked more than once. */
+	u32 LatencyCnt;		/**< Frames with a measured latency. */
+	u64 LatencyMin;		/**< Minimum latency to stage 0. */
+	u64 LatencyMax;		/**< Maximum latency to stage 0. */
+	u64 LatencySum;		/**< Sum of the measured latencies. */
+	u32 Hist[XVIDC_FRAMELOG_HIST_BINS]; /**< Latency histogram. */
+} XVidC_FrameLogStats;
+
+/**
+ * This typedef contains the state of one stage.
+ */
+typedef struct {
+	XVidC_FrameMark Mark[XVIDC_FRAMELOG_DEPTH]; /**< Ring of the latest
+						      *  marks. */
+	u32 LastSeqId;		/**< Sequence ID of the latest mark. */
+	XVidC_FrameLogStats Stats;
+} XVidC_FrameLogStage;
+
+/**
+ * This typedef contains the frame log.
+ */
+typedef struct {
+	XVidC_FrameLogStage Stage[XVIDC_FRAMELOG_MAX_STAGES];
+	u8 NumStages;		/**< Stages in use. */
+	u64 BinWidth;		/**< Histogram bin width in timer units. */
+	XVidC_FrameLogTimeFunc TimeFunc; /**< Timestamp function. */
+	void *TimeRef;		/**< Passed to TimeFunc. */
+} XVidC_FrameLog;
+
+/**************************** Function Prototypes *****************************/
+
+void XVidC_FrameLogInit(XVidC_FrameLog *LogPtr, u8 NumStages,
+		XVidC_FrameLogTimeFunc TimeFunc, void *TimeRef, u64 BinWidth);
+void XVidC_FrameLogReset(XVidC_FrameLog *LogPtr);
+void XVidC_FrameLogMark(XVidC_FrameLog *LogPtr, u8 StageId, u32 SeqId);
+int XVidC_FrameLogGetLatency(const XVidC_FrameLog *LogPtr, u8 StageId,
+		u32 SeqId, u64 *LatencyPtr);
+const XVidC_FrameLogStats *XVidC_FrameLogGetStats(const XVidC_FrameLog *LogPtr,
+		u8 StageId);
+void XVidC_FrameLogReport(const XVidC_FrameLog *LogPtr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XVIDC_FRAMELOG_H_ */
+/** @} */
@@ -0,0 +1,343 @@
+/*******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+*******************************************************************************/
+
+/******************************************************************************/
+/**
+ *
+ * @file xvidc_pipeline.c
+ * @addtogroup video_common_v4_13
+ * @{
+ *
+ * Contains the implementation of the stream pipeline object. See
+ * xvidc_pipeline.h for a description of its use.
+ *
+ * @note	None.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 4.13  ag   10/15/26 Initial release.
+ * </pre>
+ *
+*******************************************************************************/
+
+/******************************* Include Files ********************************/
+
+#include "xil_assert.h"
+#include "xstatus.h"
+#include "xvidc_pipeline.h"
+
+/**************************** Function Prototypes *****************************/
+
+static u8 XVidC_PipelineIsSameStream(const XVidC_VideoStream *Stream1,
+		const XVidC_VideoStream *Stream2);
+static int XVidC_PipelineSetOutStream(XVidC_Pipeline *PipePtr);
+static void XVidC_PipelineStopStages(XVidC_Pipeline *PipePtr);
+
+/*************************** Function Definitions *****************************/
+
+/******************************************************************************/
+/**
+ * This function initializes a pipeline object. All stage handlers are
+ * cleared and the output follows the input stream.
+ *
+ * @param	PipePtr is a pointer to the XVidC_Pipeline instance.
+ * @param	SyncMode is the output synchronization mode.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+void XVidC_PipelineInit(XVidC_Pipeline *PipePtr, XVidC_PipeSyncMode SyncMode)
+{
+	u32 Index;
+
+	/* Verify arguments. */
+	Xil_AssertVoid(PipePtr != NULL);
+	Xil_AssertVoid(SyncMode <= XVIDC_PIPE_SYNC_GENLOCK);
+
+	for (Index = 0; Index < XVIDC_PIPE_NUM_STAGES; Index++) {
+		PipePtr->Stage[Index].SetupHandler = NULL;
+		PipePtr->Stage[Index].StartHandler = NULL;
+		PipePtr->Stage[Index].StopHandler = NULL;
+		PipePtr->Stage[Index].CallbackRef = NULL;
+	}
+
+	PipePtr->SyncMode = SyncMode;
+	PipePtr->OutVmId = XVIDC_VM_NOT_SUPPORTED;
+	PipePtr->State = XVIDC_PIPE_STATE_IDLE;
+	PipePtr->IsConfigured = FALSE;
+	PipePtr->ReconfigCnt = 0;
+	PipePtr->RestartCnt = 0;
+}
+
+/******************************************************************************/
+/**
+ * This function installs the handlers of one pipeline stage.
+ *
+ * @param	PipePtr is a pointer to the XVidC_Pipeline instance.
+ * @param	StageId is the stage to be installed.
+ * @param	SetupHandler configures the stage for the pipeline streams.
+ * @param	StartHandler starts the stage.
+ * @param	StopHandler stops the stage.
+ * @param	CallbackRef is passed to the handlers.
+ *
+ * @return	None.
+ *
+ * @note	Any of the handlers may be NULL. Installing a stage invalidates
+ *		the current configuration, so the next stream up runs the full
+ *		setup sequence.
+ *
+*******************************************************************************/
+void XVidC_PipelineSetStage(XVidC_Pipeline *PipePtr, XVidC_PipeStageId StageId,
+		XVidC_PipeStageHandler SetupHandler,
+		XVidC_PipeStageHandler StartHandler,
+		XVidC_PipeStopHandler StopHandler, void *CallbackRef)
+{
+	/* Verify arguments. */
+	Xil_AssertVoid(PipePtr != NULL);
+	Xil_AssertVoid(StageId < XVIDC_PIPE_NUM_STAGES);
+
+	PipePtr->Stage[StageId].SetupHandler = SetupHandler;
+	PipePtr->Stage[StageId].StartHandler = StartHandler;
+	PipePtr->Stage[StageId].StopHandler = StopHandler;
+	PipePtr->Stage[StageId].CallbackRef = CallbackRef;
+	PipePtr->IsConfigured = FALSE;
+}
+
+/******************************************************************************/
+/**
+ * This function sets the output video mode used in free-run mode.
+ *
+ * @param	PipePtr is a pointer to the XVidC_Pipeline instance.
+ * @param	OutVmId is the output video mode, or XVIDC_VM_NOT_SUPPORTED to
+ *		follow the input stream.
+ *
+ * @return	None.
+ *
+ * @note	The new mode takes effect on the next stream up.
+ *
+*******************************************************************************/
+void XVidC_PipelineSetOutputMode(XVidC_Pipeline *PipePtr,
+		XVidC_VideoMode OutVmId)
+{
+	/* Verify arguments. */
+	Xil_AssertVoid(PipePtr != NULL);
+
+	PipePtr->OutVmId = OutVmId;
+	PipePtr->IsConfigured = FALSE;
+}
+
+/******************************************************************************/
+/**
+ * This function brings the pipeline up for a new input stream. Running
+ * stages are stopped from the source back to the sink. Unless the stages are
+ * already configured for the same stream, the output stream is derived and
+ * every stage is set up from the sink to the source. Finally every stage is
+ * started from the sink to the source.
+ *
+ * @param	PipePtr is a pointer to the XVidC_Pipeline instance.
+ * @param	InStreamPtr is the stream detected by the sink.
+ *
+ * @return
+ *		- XST_SUCCESS if the pipeline is running.
+ *		- XST_FAILURE if the output stream could not be derived or a
+ *		  stage handler failed. All stages are stopped and the pipeline
+ *		  is in the XVIDC_PIPE_STATE_ERROR state.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+int XVidC_PipelineStreamUp(XVidC_Pipeline *PipePtr,
+		const XVidC_VideoStream *InStreamPtr)
+{
+	XVidC_PipeStage *StagePtr;
+	u32 Index;
+	int Status;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(PipePtr != NULL);
+	Xil_AssertNonvoid(InStreamPtr != NULL);
+
+	if (PipePtr->IsConfigured &&
+	    XVidC_PipelineIsSameStream(&PipePtr->InStream, InStreamPtr)) {
+		if (PipePtr->State == XVIDC_PIPE_STATE_RUNNING) {
+			return XST_SUCCESS;
+		}
+		PipePtr->RestartCnt++;
+	}
+	else {
+		PipePtr->IsConfigured = FALSE;
+	}
+
+	XVidC_PipelineStopStages(PipePtr);
+
+	if (!PipePtr->IsConfigured) {
+		PipePtr->InStream = *InStreamPtr;
+		if (XVidC_PipelineSetOutStream(PipePtr) != XST_SUCCESS) {
+			PipePtr->State = XVIDC_PIPE_STATE_ERROR;
+			return XST_FAILURE;
+		}
+
+		for (Index = 0; Index < XVIDC_PIPE_NUM_STAGES; Index++) {
+			StagePtr = &PipePtr->Stage[Index];
+			if (StagePtr->SetupHandler) {
+				Status = StagePtr->SetupHandler(
+						StagePtr->CallbackRef, PipePtr);
+				if (Status != XST_SUCCESS) {
+					XVidC_PipelineStopStages(PipePtr);
+					PipePtr->State = XVIDC_PIPE_STATE_ERROR;
+					return XST_FAILURE;
+				}
+			}
+		}
+
+		PipePtr->IsConfigured = TRUE;
+		PipePtr->ReconfigCnt++;
+	}
+
+	for (Index = 0; Index < XVIDC_PIPE_NUM_STAGES; Index++) {
+		StagePtr = &PipePtr->Stage[Index];
+		if (StagePtr->StartHandler) {
+			Status = StagePtr->StartHandler(StagePtr->CallbackRef,
+							PipePtr);
+			if (Status != XST_SUCCESS) {
+				XVidC_PipelineStopStages(PipePtr);
+				PipePtr->State = XVIDC_PIPE_STATE_ERROR;
+				return XST_FAILURE;
+			}
+		}
+	}
+
+	PipePtr->State = XVIDC_PIPE_STATE_RUNNING;
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function stops all pipeline stages from the source back to the sink.
+ * The stage configuration is kept, so a following stream up with the same
+ * stream only restarts the stages.
+ *
+ * @param	PipePtr is a pointer to the XVidC_Pipeline instance.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+void XVidC_PipelineStreamDown(XVidC_Pipeline *PipePtr)
+{
+	/* Verify arguments. */
+	Xil_AssertVoid(PipePtr != NULL);
+
+	XVidC_PipelineStopStages(PipePtr);
+	PipePtr->State = XVIDC_PIPE_STATE_IDLE;
+}
+
+/******************************************************************************/
+/**
+ * This function discards the stage configuration so that the next stream up
+ * runs the full setup sequence, e.g. after one of the cores was reset.
+ *
+ * @param	PipePtr is a pointer to the XVidC_Pipeline instance.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+void XVidC_PipelineInvalidate(XVidC_Pipeline *PipePtr)
+{
+	/* Verify arguments. */
+	Xil_AssertVoid(PipePtr != NULL);
+
+	PipePtr->IsConfigured = FALSE;
+}
+
+/******************************************************************************/
+/**
+ * This function checks whether two streams need the same pipeline
+ * configuration.
+ *
+ * @param	Stream1 is a pointer to the first stream.
+ * @param	Stream2 is a pointer to the second stream.
+ *
+ * @return	TRUE if the streams match, FALSE otherwise.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u8 XVidC_PipelineIsSameStream(const XVidC_VideoStream *Stream1,
+		const XVidC_VideoStream *Stream2)
+{
+	return ((Stream1->Timing.HActive == Stream2->Timing.HActive) &&
+		(Stream1->Timing.VActive == Stream2->Timing.VActive) &&
+		(Stream1->Timing.HTotal == Stream2->Timing.HTotal) &&
+		(Stream1->Timing.F0PVTotal == Stream2->Timing.F0PVTotal) &&
+		(Stream1->FrameRate == Stream2->FrameRate) &&
+		(Stream1->IsInterlaced == Stream2->IsInterlaced) &&
+		(Stream1->ColorFormatId == Stream2->ColorFormatId) &&
+		(Stream1->ColorDepth == Stream2->ColorDepth) &&
+		(Stream1->PixPerClk == Stream2->PixPerClk));
+}
+
+/******************************************************************************/
+/**
+ * This function derives the output stream from the input stream according to
+ * the synchronization mode.
+ *
+ * @param	PipePtr is a pointer to the XVidC_Pipeline instance.
+ *
+ * @return
+ *		- XST_SUCCESS if the output stream was set.
+ *		- XST_FAILURE if the free-run output mode is not known.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static int XVidC_PipelineSetOutStream(XVidC_Pipeline *PipePtr)
+{
+	PipePtr->OutStream = PipePtr->InStream;
+
+	if ((PipePtr->SyncMode != XVIDC_PIPE_SYNC_FREERUN) ||
+	    (PipePtr->OutVmId == XVIDC_VM_NOT_SUPPORTED)) {
+		return XST_SUCCESS;
+	}
+
+	return XVidC_SetVideoStream(&PipePtr->OutStream, PipePtr->OutVmId,
+				    PipePtr->InStream.ColorFormatId,
+				    PipePtr->InStream.ColorDepth,
+				    PipePtr->InStream.PixPerClk);
+}
+
+/******************************************************************************/
+/**
+ * This function stops all stages from the source back to the sink.
+ *
+ * @param	PipePtr is a pointer to the XVidC_Pipeline instance.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static void XVidC_PipelineStopStages(XVidC_Pipeline *PipePtr)
+{
+	XVidC_PipeStage *StagePtr;
+	u32 Index;
+
+	for (Index = XVIDC_PIPE_NUM_STAGES; Index > 0; Index--) {
+		StagePtr = &PipePtr->Stage[Index - 1];
+		if (StagePtr->StopHandler) {
+			StagePtr->StopHandler(StagePtr->CallbackRef);
+		}
+	}
+}
+/** @} */
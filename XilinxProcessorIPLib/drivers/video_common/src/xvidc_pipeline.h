@@ -0,0 +1,188 @@
+/*******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+*******************************************************************************/
+
+/******************************************************************************/
+/**
+ *
+ * @file xvidc_pipeline.h
+ * @addtogroup video_common_v4_13
+ * @{
+ * @details
+ *
+ * Contains a generic stream pipeline object used to link a video receiver to
+ * a video transmitter through optional frame buffer stages, e.g. an HDMI
+ * RX to TX passthrough built from XV_HdmiRxSs1, XV_FrmbufWr, XV_FrmbufRd and
+ * XV_HdmiTxSs1.
+ *
+ * video_common sits below the drivers it links, so the pipeline does not call
+ * them directly. Instead the application registers a set of handlers per
+ * stage (XVidC_PipelineSetStage) that wrap the driver calls:
+ *
+ *	- XVIDC_PIPE_STAGE_SINK:   receiver, e.g. enable the RX video bridge.
+ *	- XVIDC_PIPE_STAGE_WRITE:  frame buffer write ring setup/start.
+ *	- XVIDC_PIPE_STAGE_READ:   frame buffer read ring setup/start.
+ *	- XVIDC_PIPE_STAGE_SOURCE: transmitter stream and clock configuration.
+ *
+ * The receiver stream-up callback calls XVidC_PipelineStreamUp with the
+ * detected stream and the stream-down callback calls
+ * XVidC_PipelineStreamDown. On stream up all stages are stopped from
+ * the source back to the sink, set up from the sink to the source
+ * and started in the same order, as one sequence. A stream up with the same
+ * stream as the one the stages are configured for skips the setup and
+ * only restarts the stages, which keeps recovery from a cable glitch or
+ * re-lock short.
+ *
+ * The synchronization mode selects how the output stream relates to the input
+ * stream and is available to the handlers through the pipeline object:
+ *
+ *	- XVIDC_PIPE_SYNC_GENLOCK:   the transmitter clock is derived from the
+ *				     receiver clock and the output timing equals
+ *				     the input timing. The read stage may start
+ *				     as soon as the first lines are written.
+ *	- XVIDC_PIPE_SYNC_FRAMELOCK: the output timing equals the input timing but
+ *				     the transmitter runs from its own clock; the
+ *				     frame buffer ring absorbs the drift.
+ *	- XVIDC_PIPE_SYNC_FREERUN:   the output uses the mode set with
+ *				     XVidC_PipelineSetOutputMode (or follows the
+ *				     input if none is set); frames are repeated
+ *				     or dropped by the frame buffer ring.
+ *
+ * @note	The pipeline is not thread safe. Stream up and stream down must
+ *		be called from the same context.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 4.13  ag   10/15/26 Initial release.
+ * </pre>
+ *
+*******************************************************************************/
+
+#ifndef XVIDC_PIPELINE_H_  /* Prevent circular inclusions by using protection
+			    * macros. */
+#define XVIDC_PIPELINE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************* Include Files ********************************/
+
+#include "xvidc.h"
+
+/************************** Constant Definitions ******************************/
+
+/**
+ * This typedef enumerates the pipeline stages in stream order.
+ */
+typedef enum {
+	XVIDC_PIPE_STAGE_SINK = 0,
+	XVIDC_PIPE_STAGE_WRITE,
+	XVIDC_PIPE_STAGE_READ,
+	XVIDC_PIPE_STAGE_SOURCE,
+	XVIDC_PIPE_NUM_STAGES
+} XVidC_PipeStageId;
+
+/**
+ * This typedef enumerates the output synchronization modes.
+ */
+typedef enum {
+	XVIDC_PIPE_SYNC_FREERUN = 0,
+	XVIDC_PIPE_SYNC_FRAMELOCK,
+	XVIDC_PIPE_SYNC_GENLOCK
+} XVidC_PipeSyncMode;
+
+/**
+ * This typedef enumerates the pipeline states.
+ */
+typedef enum {
+	XVIDC_PIPE_STATE_IDLE = 0,
+	XVIDC_PIPE_STATE_RUNNING,
+	XVIDC_PIPE_STATE_ERROR
+} XVidC_PipeState;
+
+/****************************** Type Definitions ******************************/
+
+struct XVidC_Pipeline_s;
+
+/**
+ * Stage handler used to set up and start a stage. It returns XST_SUCCESS or
+ * an error code, which aborts the sequence.
+ */
+typedef int (*XVidC_PipeStageHandler)(void *CallbackRef,
+		const struct XVidC_Pipeline_s *PipePtr);
+
+/**
+ * Stage handler used to stop a stage.
+ */
+typedef void (*XVidC_PipeStopHandler)(void *CallbackRef);
+
+/**
+ * This typedef contains the handlers of one pipeline stage. Any handler may
+ * be NULL if the stage does not need it.
+ */
+typedef struct {
+	XVidC_PipeStageHandler	SetupHandler;	/**< Configure for the stream. */
+	XVidC_PipeStageHandler	StartHandler;	/**< Start processing. */
+	XVidC_PipeStopHandler	StopHandler;	/**< Stop processing. */
+	void			*CallbackRef;	/**< Passed to the handlers. */
+} XVidC_PipeStage;
+
+/**
+ * This typedef contains the pipeline object.
+ */
+typedef struct XVidC_Pipeline_s {
+	XVidC_PipeStage		Stage[XVIDC_PIPE_NUM_STAGES];
+	XVidC_PipeSyncMode	SyncMode;	/**< Output synchronization. */
+	XVidC_VideoMode		OutVmId;	/**< Free-run output mode or
+						  *  XVIDC_VM_NOT_SUPPORTED to
+						  *  follow the input. */
+	XVidC_VideoStream	InStream;	/**< Stream from the sink. */
+	XVidC_VideoStream	OutStream;	/**< Stream to the source. */
+	XVidC_PipeState		State;
+	u8			IsConfigured;	/**< Stages set up for
+						  *  InStream. */
+	u32			ReconfigCnt;	/**< Full setup sequences. */
+	u32			RestartCnt;	/**< Restarts without setup. */
+} XVidC_Pipeline;
+
+/**************************** Macros Definitions ******************************/
+
+/******************************************************************************/
+/**
+ * This macro returns the current state of the pipeline.
+ *
+ * @param	PipePtr is a pointer to the XVidC_Pipeline instance.
+ *
+ * @return	The current XVidC_PipeState.
+ *
+ * @note	C-style signature:
+ *		XVidC_PipeState XVidC_PipelineGetState(XVidC_Pipeline *PipePtr)
+ *
+*******************************************************************************/
+#define XVidC_PipelineGetState(PipePtr) ((PipePtr)->State)
+
+/**************************** Function Prototypes *****************************/
+
+void XVidC_PipelineInit(XVidC_Pipeline *PipePtr, XVidC_PipeSyncMode SyncMode);
+void XVidC_PipelineSetStage(XVidC_Pipeline *PipePtr, XVidC_PipeStageId StageId,
+		XVidC_PipeStageHandler SetupHandler,
+		XVidC_PipeStageHandler StartHandler,
+		XVidC_PipeStopHandler StopHandler, void *CallbackRef);
+void XVidC_PipelineSetOutputMode(XVidC_Pipeline *PipePtr,
+		XVidC_VideoMode OutVmId);
+int XVidC_PipelineStreamUp(XVidC_Pipeline *PipePtr,
+		const XVidC_VideoStream *InStreamPtr);
+void XVidC_PipelineStreamDown(XVidC_Pipeline *PipePtr);
+void XVidC_PipelineInvalidate(XVidC_Pipeline *PipePtr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XVIDC_PIPELINE_H_ */
+/** @} */
@@ -0,0 +1,623 @@
+/*******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+*******************************************************************************/
+
+/******************************************************************************/
+/**
+ *
+ * @file xvidc_swcsc.c
+ * @addtogroup video_common_v4_13
+ * @{
+ *
+ * Contains the software color space conversion, chroma resampling and test
+ * pattern fill routines. See xvidc_swcsc.h for a description of their use.
+ *
+ * @note	None.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 4.13  ag   10/15/26 Initial release.
+ * </pre>
+ *
+*******************************************************************************/
+
+/******************************* Include Files ********************************/
+
+#include <string.h>
+#include "xil_assert.h"
+#include "xstatus.h"
+#include "xvidc_swcsc.h"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define XVIDC_SWCSC_NEON
+#endif
+
+/************************** Constant Definitions ******************************/
+
+#define XVIDC_SWCSC_FRAC_BITS	12
+#define XVIDC_SWCSC_ROUND	(1 << (XVIDC_SWCSC_FRAC_BITS - 1))
+#define XVIDC_SWCSC_NUM_BARS	8
+
+/**
+ * YCbCr (16-235) to RGB (0-255) coefficients, as programmed by the v_csc
+ * driver. Rows are R, G, B; columns are Y, Cb, Cr and the offset.
+ */
+static const s16 XVidC_SwYcc2Rgb[XVIDC_BT_NUM_SUPPORTED][3][4] = {
+	/* XVIDC_BT_2020 */
+	{{4769, 0, 6875, -234}, {4769, -767, -2664, 89},
+	 {4769, 8772, 0, -293}},
+	/* XVIDC_BT_709 */
+	{{4769, 0, 7342, -248}, {4769, -873, -2182, 77},
+	 {4769, 8652, 0, -289}},
+	/* XVIDC_BT_601 */
+	{{4769, 0, 6515, -223}, {4769, -1604, -3330, 136},
+	 {4769, 8262, 0, -277}},
+};
+
+/**
+ * RGB (0-255) to YCbCr (16-235) coefficients, as programmed by the v_csc
+ * driver. Rows are Y, Cb, Cr; columns are R, G, B and the offset.
+ */
+static const s16 XVidC_SwRgb2Ycc[XVIDC_BT_NUM_SUPPORTED][3][4] = {
+	/* XVIDC_BT_2020 */
+	{{924, 2385, 208, 16}, {-502, -1296, 1798, 128},
+	 {1798, -1654, -144, 128}},
+	/* XVIDC_BT_709 */
+	{{747, 2515, 253, 16}, {-412, -1386, 1798, 128},
+	 {1798, -1633, -165, 128}},
+	/* XVIDC_BT_601 */
+	{{1051, 2064, 400, 16}, {-607, -1191, 1799, 128},
+	 {1799, -1506, -292, 128}},
+};
+
+/** Color bar colors of the v_tpg core, as R, G, B. */
+static const u8 XVidC_SwBarColor[XVIDC_SWCSC_NUM_BARS][3] = {
+	{255, 255, 255}, {255, 255, 0}, {0, 255, 255}, {0, 255, 0},
+	{255, 0, 255}, {255, 0, 0}, {0, 0, 255}, {0, 0, 0}
+};
+
+/**************************** Function Prototypes *****************************/
+
+static void XVidC_SwYuvRowToRgb(const u8 *YPtr, const u8 *UvPtr,
+		u8 IsPlanar, u8 *DstPtr, u32 Width, const s16 (*K)[4]);
+static void XVidC_SwRgbRowToYuyv(const u8 *SrcPtr, u8 *DstPtr, u32 Width,
+		const s16 (*K)[4]);
+
+/*************************** Function Definitions *****************************/
+
+/******************************************************************************/
+/**
+ * This function applies one row of a conversion matrix to a pixel.
+ *
+ * @param	A is the first component.
+ * @param	B is the second component.
+ * @param	C is the third component.
+ * @param	K is the matrix row, the coefficients followed by the offset.
+ *
+ * @return	The output component, clipped to 0-255.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static inline u8 XVidC_SwCscCh(s32 A, s32 B, s32 C, const s16 *K)
+{
+	s32 Val;
+
+	Val = ((K[0] * A + K[1] * B + K[2] * C + XVIDC_SWCSC_ROUND) >>
+	       XVIDC_SWCSC_FRAC_BITS) + K[3];
+
+	return (u8)((Val < 0) ? 0 : ((Val > 255) ? 255 : Val));
+}
+
+#ifdef XVIDC_SWCSC_NEON
+/******************************************************************************/
+/**
+ * This function applies one row of a conversion matrix to 8 pixels. It gives
+ * the same result as XVidC_SwCscCh.
+ *
+ * @param	A is the first component.
+ * @param	B is the second component.
+ * @param	C is the third component.
+ * @param	K is the matrix row, the coefficients followed by the offset.
+ *
+ * @return	The output components, clipped to 0-255.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static inline uint8x8_t XVidC_SwCscChNeon(uint8x8_t A, uint8x8_t B,
+		uint8x8_t C, const s16 *K)
+{
+	int16x8_t A16 = vreinterpretq_s16_u16(vmovl_u8(A));
+	int16x8_t B16 = vreinterpretq_s16_u16(vmovl_u8(B));
+	int16x8_t C16 = vreinterpretq_s16_u16(vmovl_u8(C));
+	int32x4_t Lo, Hi;
+
+	Lo = vmull_n_s16(vget_low_s16(A16), K[0]);
+	Lo = vmlal_n_s16(Lo, vget_low_s16(B16), K[1]);
+	Lo = vmlal_n_s16(Lo, vget_low_s16(C16), K[2]);
+	Hi = vmull_n_s16(vget_high_s16(A16), K[0]);
+	Hi = vmlal_n_s16(Hi, vget_high_s16(B16), K[1]);
+	Hi = vmlal_n_s16(Hi, vget_high_s16(C16), K[2]);
+
+	Lo = vshrq_n_s32(vaddq_s32(Lo, vdupq_n_s32(XVIDC_SWCSC_ROUND)),
+			 XVIDC_SWCSC_FRAC_BITS);
+	Hi = vshrq_n_s32(vaddq_s32(Hi, vdupq_n_s32(XVIDC_SWCSC_ROUND)),
+			 XVIDC_SWCSC_FRAC_BITS);
+	Lo = vaddq_s32(Lo, vdupq_n_s32(K[3]));
+	Hi = vaddq_s32(Hi, vdupq_n_s32(K[3]));
+
+	return vqmovun_s16(vcombine_s16(vqmovn_s32(Lo), vqmovn_s32(Hi)));
+}
+#endif
+
+/******************************************************************************/
+/**
+ * This function converts one line of 4:2:2 or 4:2:0 YCbCr to RGB.
+ *
+ * @param	YPtr is the first luma sample of the line.
+ * @param	UvPtr is the first chroma sample of the line.
+ * @param	IsPlanar is TRUE for a separate luma and chroma line (4:2:0)
+ *		and FALSE for YUYV, in which case UvPtr is not used.
+ * @param	DstPtr is the RGB line.
+ * @param	Width is the line width in pixels.
+ * @param	K is the YCbCr to RGB matrix.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static void XVidC_SwYuvRowToRgb(const u8 *YPtr, const u8 *UvPtr,
+		u8 IsPlanar, u8 *DstPtr, u32 Width, const s16 (*K)[4])
+{
+	const u8 *Y0Ptr;
+	const u8 *CPtr;
+	u32 YStep;
+	u32 X = 0;
+
+#ifdef XVIDC_SWCSC_NEON
+	for (; (X + 16) <= Width; X += 16) {
+		uint8x8_t Ye, Yo, U, V;
+		uint8x8x2_t R, G, B;
+		uint8x16x3_t Out;
+
+		if (IsPlanar) {
+			uint8x8x2_t InY = vld2_u8(YPtr + X);
+			uint8x8x2_t InC = vld2_u8(UvPtr + X);
+
+			Ye = InY.val[0];
+			Yo = InY.val[1];
+			U = InC.val[0];
+			V = InC.val[1];
+		}
+		else {
+			uint8x8x4_t In = vld4_u8(YPtr + (2 * X));
+
+			Ye = In.val[0];
+			U = In.val[1];
+			Yo = In.val[2];
+			V = In.val[3];
+		}
+
+		R = vzip_u8(XVidC_SwCscChNeon(Ye, U, V, K[0]),
+			    XVidC_SwCscChNeon(Yo, U, V, K[0]));
+		G = vzip_u8(XVidC_SwCscChNeon(Ye, U, V, K[1]),
+			    XVidC_SwCscChNeon(Yo, U, V, K[1]));
+		B = vzip_u8(XVidC_SwCscChNeon(Ye, U, V, K[2]),
+			    XVidC_SwCscChNeon(Yo, U, V, K[2]));
+
+		Out.val[0] = vcombine_u8(R.val[0], R.val[1]);
+		Out.val[1] = vcombine_u8(G.val[0], G.val[1]);
+		Out.val[2] = vcombine_u8(B.val[0], B.val[1]);
+		vst3q_u8(DstPtr + (3 * X), Out);
+	}
+#endif
+
+	YStep = (IsPlanar) ? 1 : 2;
+	for (; X < Width; X += 2) {
+		Y0Ptr = YPtr + (YStep * X);
+		CPtr = (IsPlanar) ? (UvPtr + X) : (Y0Ptr + 1);
+
+		DstPtr[(3 * X) + 0] = XVidC_SwCscCh(Y0Ptr[0], CPtr[0],
+						    CPtr[YStep], K[0]);
+		DstPtr[(3 * X) + 1] = XVidC_SwCscCh(Y0Ptr[0], CPtr[0],
+						    CPtr[YStep], K[1]);
+		DstPtr[(3 * X) + 2] = XVidC_SwCscCh(Y0Ptr[0], CPtr[0],
+						    CPtr[YStep], K[2]);
+		DstPtr[(3 * X) + 3] = XVidC_SwCscCh(Y0Ptr[YStep], CPtr[0],
+						    CPtr[YStep], K[0]);
+		DstPtr[(3 * X) + 4] = XVidC_SwCscCh(Y0Ptr[YStep], CPtr[0],
+						    CPtr[YStep], K[1]);
+		DstPtr[(3 * X) + 5] = XVidC_SwCscCh(Y0Ptr[YStep], CPtr[0],
+						    CPtr[YStep], K[2]);
+	}
+}
+
+/******************************************************************************/
+/**
+ * This function converts one line of RGB to YUYV. The chroma of a pixel pair
+ * is computed from the average of the two pixels.
+ *
+ * @param	SrcPtr is the RGB line.
+ * @param	DstPtr is the YUYV line.
+ * @param	Width is the line width in pixels.
+ * @param	K is the RGB to YCbCr matrix.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static void XVidC_SwRgbRowToYuyv(const u8 *SrcPtr, u8 *DstPtr, u32 Width,
+		const s16 (*K)[4])
+{
+	const u8 *PixPtr;
+	u32 Ra, Ga, Ba;
+	u32 X = 0;
+
+#ifdef XVIDC_SWCSC_NEON
+	for (; (X + 16) <= Width; X += 16) {
+		uint8x16x3_t In = vld3q_u8(SrcPtr + (3 * X));
+		uint8x16x2_t R = vuzpq_u8(In.val[0], In.val[0]);
+		uint8x16x2_t G = vuzpq_u8(In.val[1], In.val[1]);
+		uint8x16x2_t B = vuzpq_u8(In.val[2], In.val[2]);
+		uint8x8_t Re = vget_low_u8(R.val[0]);
+		uint8x8_t Ro = vget_low_u8(R.val[1]);
+		uint8x8_t Ge = vget_low_u8(G.val[0]);
+		uint8x8_t Go = vget_low_u8(G.val[1]);
+		uint8x8_t Be = vget_low_u8(B.val[0]);
+		uint8x8_t Bo = vget_low_u8(B.val[1]);
+		uint8x8_t Rav = vrhadd_u8(Re, Ro);
+		uint8x8_t Gav = vrhadd_u8(Ge, Go);
+		uint8x8_t Bav = vrhadd_u8(Be, Bo);
+		uint8x8x4_t Out;
+
+		Out.val[0] = XVidC_SwCscChNeon(Re, Ge, Be, K[0]);
+		Out.val[1] = XVidC_SwCscChNeon(Rav, Gav, Bav, K[1]);
+		Out.val[2] = XVidC_SwCscChNeon(Ro, Go, Bo, K[0]);
+		Out.val[3] = XVidC_SwCscChNeon(Rav, Gav, Bav, K[2]);
+		vst4_u8(DstPtr + (2 * X), Out);
+	}
+#endif
+
+	for (; X < Width; X += 2) {
+		PixPtr = SrcPtr + (3 * X);
+		Ra = (PixPtr[0] + PixPtr[3] + 1) >> 1;
+		Ga = (PixPtr[1] + PixPtr[4] + 1) >> 1;
+		Ba = (PixPtr[2] + PixPtr[5] + 1) >> 1;
+
+		DstPtr[(2 * X) + 0] = XVidC_SwCscCh(PixPtr[0], PixPtr[1],
+						    PixPtr[2], K[0]);
+		DstPtr[(2 * X) + 1] = XVidC_SwCscCh(Ra, Ga, Ba, K[1]);
+		DstPtr[(2 * X) + 2] = XVidC_SwCscCh(PixPtr[3], PixPtr[4],
+						    PixPtr[5], K[0]);
+		DstPtr[(2 * X) + 3] = XVidC_SwCscCh(Ra, Ga, Ba, K[2]);
+	}
+}
+
+/******************************************************************************/
+/**
+ * This function converts a YUYV (4:2:2) frame to RGB.
+ *
+ * @param	SrcPtr is the YUYV frame.
+ * @param	SrcStride is the YUYV line pitch.
+ * @param	DstPtr is the RGB frame.
+ * @param	DstStride is the RGB line pitch.
+ * @param	Width is the frame width in pixels.
+ * @param	Height is the frame height in lines.
+ * @param	Std is the color standard of the YUYV frame.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+void XVidC_SwYuyvToRgb(const u8 *SrcPtr, u32 SrcStride, u8 *DstPtr,
+		u32 DstStride, u32 Width, u32 Height, XVidC_ColorStd Std)
+{
+	u32 Line;
+
+	/* Verify arguments. */
+	Xil_AssertVoid(SrcPtr != NULL);
+	Xil_AssertVoid(DstPtr != NULL);
+	Xil_AssertVoid((Width % 2) == 0);
+	Xil_AssertVoid(Std < XVIDC_BT_NUM_SUPPORTED);
+
+	for (Line = 0; Line < Height; Line++) {
+		XVidC_SwYuvRowToRgb(SrcPtr + (Line * SrcStride), NULL, FALSE,
+				    DstPtr + (Line * DstStride), Width,
+				    XVidC_SwYcc2Rgb[Std]);
+	}
+}
+
+/******************************************************************************/
+/**
+ * This function converts an RGB frame to YUYV (4:2:2).
+ *
+ * @param	SrcPtr is the RGB frame.
+ * @param	SrcStride is the RGB line pitch.
+ * @param	DstPtr is the YUYV frame.
+ * @param	DstStride is the YUYV line pitch.
+ * @param	Width is the frame width in pixels.
+ * @param	Height is the frame height in lines.
+ * @param	Std is the color standard of the YUYV frame.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+void XVidC_SwRgbToYuyv(const u8 *SrcPtr, u32 SrcStride, u8 *DstPtr,
+		u32 DstStride, u32 Width, u32 Height, XVidC_ColorStd Std)
+{
+	u32 Line;
+
+	/* Verify arguments. */
+	Xil_AssertVoid(SrcPtr != NULL);
+	Xil_AssertVoid(DstPtr != NULL);
+	Xil_AssertVoid((Width % 2) == 0);
+	Xil_AssertVoid(Std < XVIDC_BT_NUM_SUPPORTED);
+
+	for (Line = 0; Line < Height; Line++) {
+		XVidC_SwRgbRowToYuyv(SrcPtr + (Line * SrcStride),
+				     DstPtr + (Line * DstStride), Width,
+				     XVidC_SwRgb2Ycc[Std]);
+	}
+}
+
+/******************************************************************************/
+/**
+ * This function converts a 4:2:0 frame (luma plane and interleaved chroma
+ * plane) to RGB.
+ *
+ * @param	YPtr is the luma plane.
+ * @param	UvPtr is the chroma plane.
+ * @param	SrcStride is the line pitch of both planes.
+ * @param	DstPtr is the RGB frame.
+ * @param	DstStride is the RGB line pitch.
+ * @param	Width is the frame width in pixels.
+ * @param	Height is the frame height in lines.
+ * @param	Std is the color standard of the 4:2:0 frame.
+ *
+ * @return	None.
+ *
+ * @note	Each chroma line is used for two luma lines.
+ *
+*******************************************************************************/
+void XVidC_SwYuv420ToRgb(const u8 *YPtr, const u8 *UvPtr, u32 SrcStride,
+		u8 *DstPtr, u32 DstStride, u32 Width, u32 Height,
+		XVidC_ColorStd Std)
+{
+	u32 Line;
+
+	/* Verify arguments. */
+	Xil_AssertVoid(YPtr != NULL);
+	Xil_AssertVoid(UvPtr != NULL);
+	Xil_AssertVoid(DstPtr != NULL);
+	Xil_AssertVoid((Width % 2) == 0);
+	Xil_AssertVoid(Std < XVIDC_BT_NUM_SUPPORTED);
+
+	for (Line = 0; Line < Height; Line++) {
+		XVidC_SwYuvRowToRgb(YPtr + (Line * SrcStride),
+				    UvPtr + ((Line / 2) * SrcStride), TRUE,
+				    DstPtr + (Line * DstStride), Width,
+				    XVidC_SwYcc2Rgb[Std]);
+	}
+}
+
+/******************************************************************************/
+/**
+ * This function up samples a 4:2:0 frame (luma plane and interleaved chroma
+ * plane) to YUYV (4:2:2) by repeating each chroma line.
+ *
+ * @param	YPtr is the luma plane.
+ * @param	UvPtr is the chroma plane.
+ * @param	SrcStride is the line pitch of both planes.
+ * @param	DstPtr is the YUYV frame.
+ * @param	DstStride is the YUYV line pitch.
+ * @param	Width is the frame width in pixels.
+ * @param	Height is the frame height in lines.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+void XVidC_SwYuv420ToYuyv(const u8 *YPtr, const u8 *UvPtr, u32 SrcStride,
+		u8 *DstPtr, u32 DstStride, u32 Width, u32 Height)
+{
+	const u8 *YLinePtr;
+	const u8 *CLinePtr;
+	u8 *DstLinePtr;
+	u32 Line;
+	u32 X;
+
+	/* Verify arguments. */
+	Xil_AssertVoid(YPtr != NULL);
+	Xil_AssertVoid(UvPtr != NULL);
+	Xil_AssertVoid(DstPtr != NULL);
+	Xil_AssertVoid((Width % 2) == 0);
+
+	for (Line = 0; Line < Height; Line++) {
+		YLinePtr = YPtr + (Line * SrcStride);
+		CLinePtr = UvPtr + ((Line / 2) * SrcStride);
+		DstLinePtr = DstPtr + (Line * DstStride);
+
+		for (X = 0; X < Width; X += 2) {
+			DstLinePtr[(2 * X) + 0] = YLinePtr[X];
+			DstLinePtr[(2 * X) + 1] = CLinePtr[X];
+			DstLinePtr[(2 * X) + 2] = YLinePtr[X + 1];
+			DstLinePtr[(2 * X) + 3] = CLinePtr[X + 1];
+		}
+	}
+}
+
+/******************************************************************************/
+/**
+ * This function down samples a YUYV (4:2:2) frame to 4:2:0 (luma plane and
+ * interleaved chroma plane) by averaging each pair of chroma lines.
+ *
+ * @param	SrcPtr is the YUYV frame.
+ * @param	SrcStride is the YUYV line pitch.
+ * @param	YPtr is the luma plane.
+ * @param	UvPtr is the chroma plane.
+ * @param	DstStride is the line pitch of both planes.
+ * @param	Width is the frame width in pixels.
+ * @param	Height is the frame height in lines.
+ *
+ * @return	None.
+ *
+ * @note	The last line of an odd height frame keeps its own chroma.
+ *
+*******************************************************************************/
+void XVidC_SwYuyvToYuv420(const u8 *SrcPtr, u32 SrcStride, u8 *YPtr,
+		u8 *UvPtr, u32 DstStride, u32 Width, u32 Height)
+{
+	const u8 *Src0Ptr;
+	const u8 *Src1Ptr;
+	u8 *YLinePtr;
+	u8 *CLinePtr;
+	u32 Line;
+	u32 X;
+
+	/* Verify arguments. */
+	Xil_AssertVoid(SrcPtr != NULL);
+	Xil_AssertVoid(YPtr != NULL);
+	Xil_AssertVoid(UvPtr != NULL);
+	Xil_AssertVoid((Width % 2) == 0);
+
+	for (Line = 0; Line < Height; Line++) {
+		Src0Ptr = SrcPtr + (Line * SrcStride);
+		YLinePtr = YPtr + (Line * DstStride);
+
+		for (X = 0; X < Width; X++) {
+			YLinePtr[X] = Src0Ptr[2 * X];
+		}
+
+		if (Line % 2) {
+			continue;
+		}
+
+		Src1Ptr = ((Line + 1) < Height) ? (Src0Ptr + SrcStride) :
+						  Src0Ptr;
+		CLinePtr = UvPtr + ((Line / 2) * DstStride);
+		for (X = 0; X < Width; X++) {
+			CLinePtr[X] = (Src0Ptr[(2 * X) + 1] +
+				       Src1Ptr[(2 * X) + 1] + 1) >> 1;
+		}
+	}
+}
+
+/******************************************************************************/
+/**
+ * This function fills a frame with the 8 vertical color bars of the v_tpg
+ * core (XTPG_BKGND_COLOR_BARS): white, yellow, cyan, green, magenta, red,
+ * blue and black.
+ *
+ * @param	DstPtr is the frame, or the luma plane for 4:2:0.
+ * @param	UvPtr is the chroma plane for 4:2:0, otherwise not used.
+ * @param	DstStride is the line pitch.
+ * @param	Width is the frame width in pixels.
+ * @param	Height is the frame height in lines.
+ * @param	ColorFormat is XVIDC_CSF_MEM_RGB8, XVIDC_CSF_MEM_YUYV8 or
+ *		XVIDC_CSF_MEM_Y_UV8_420.
+ * @param	Std is the color standard used for the YCbCr formats.
+ *
+ * @return
+ *		- XST_SUCCESS if the frame was filled.
+ *		- XST_FAILURE if the color format is not supported.
+ *
+ * @note	The bar width is rounded down to an even number of pixels; the
+ *		last bar takes the remaining pixels.
+ *
+*******************************************************************************/
+int XVidC_SwFillColorBars(u8 *DstPtr, u8 *UvPtr, u32 DstStride, u32 Width,
+		u32 Height, XVidC_ColorFormat ColorFormat, XVidC_ColorStd Std)
+{
+	u8 BarYcc[XVIDC_SWCSC_NUM_BARS][3];
+	const u8 *RgbPtr;
+	u32 LineBytes;
+	u32 BarWidth;
+	u32 Bar;
+	u32 Line;
+	u32 X;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(DstPtr != NULL);
+	Xil_AssertNonvoid((Width % 2) == 0);
+	Xil_AssertNonvoid(Std < XVIDC_BT_NUM_SUPPORTED);
+
+	if ((ColorFormat != XVIDC_CSF_MEM_RGB8) &&
+	    (ColorFormat != XVIDC_CSF_MEM_YUYV8) &&
+	    (ColorFormat != XVIDC_CSF_MEM_Y_UV8_420)) {
+		return XST_FAILURE;
+	}
+	if ((ColorFormat == XVIDC_CSF_MEM_Y_UV8_420) && (UvPtr == NULL)) {
+		return XST_FAILURE;
+	}
+
+	for (Bar = 0; Bar < XVIDC_SWCSC_NUM_BARS; Bar++) {
+		RgbPtr = XVidC_SwBarColor[Bar];
+		for (X = 0; X < 3; X++) {
+			BarYcc[Bar][X] = XVidC_SwCscCh(RgbPtr[0], RgbPtr[1],
+					RgbPtr[2], XVidC_SwRgb2Ycc[Std][X]);
+		}
+	}
+
+	BarWidth = (Width / XVIDC_SWCSC_NUM_BARS) & ~1;
+
+	/* Fill the first line, then copy it */
+	for (X = 0; X < Width; X += 2) {
+		Bar = (BarWidth) ? (X / BarWidth) : 0;
+		if (Bar >= XVIDC_SWCSC_NUM_BARS) {
+			Bar = XVIDC_SWCSC_NUM_BARS - 1;
+		}
+
+		switch (ColorFormat) {
+		case XVIDC_CSF_MEM_RGB8:
+			RgbPtr = XVidC_SwBarColor[Bar];
+			DstPtr[(3 * X) + 0] = RgbPtr[0];
+			DstPtr[(3 * X) + 1] = RgbPtr[1];
+			DstPtr[(3 * X) + 2] = RgbPtr[2];
+			DstPtr[(3 * X) + 3] = RgbPtr[0];
+			DstPtr[(3 * X) + 4] = RgbPtr[1];
+			DstPtr[(3 * X) + 5] = RgbPtr[2];
+			break;
+
+		case XVIDC_CSF_MEM_YUYV8:
+			DstPtr[(2 * X) + 0] = BarYcc[Bar][0];
+			DstPtr[(2 * X) + 1] = BarYcc[Bar][1];
+			DstPtr[(2 * X) + 2] = BarYcc[Bar][0];
+			DstPtr[(2 * X) + 3] = BarYcc[Bar][2];
+			break;
+
+		default:
+			DstPtr[X] = BarYcc[Bar][0];
+			DstPtr[X + 1] = BarYcc[Bar][0];
+			UvPtr[X] = BarYcc[Bar][1];
+			UvPtr[X + 1] = BarYcc[Bar][2];
+			break;
+		}
+	}
+
+	LineBytes = (ColorFormat == XVIDC_CSF_MEM_RGB8) ? (3 * Width) :
+		    (ColorFormat == XVIDC_CSF_MEM_YUYV8) ? (2 * Width) : Width;
+	for (Line = 1; Line < Height; Line++) {
+		memcpy(DstPtr + (Line * DstStride), DstPtr, LineBytes);
+	}
+
+	if (ColorFormat == XVIDC_CSF_MEM_Y_UV8_420) {
+		for (Line = 1; Line < ((Height + 1) / 2); Line++) {
+			memcpy(UvPtr + (Line * DstStride), UvPtr, Width);
+		}
+	}
+
+	return XST_SUCCESS;
+}
+/** @} */
@@ -0,0 +1,80 @@
+/*******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+*******************************************************************************/
+
+/******************************************************************************/
+/**
+ *
+ * @file xvidc_swcsc.h
+ * @addtogroup video_common_v4_13
+ * @{
+ * @details
+ *
+ * Contains software color space conversion, chroma resampling and test
+ * pattern fill routines for frame buffers in memory. They are meant for
+ * designs without a v_csc, v_tpg or chroma resampler core, for a software
+ * preview path and for checking the output of those cores.
+ *
+ * Supported memory formats (8 bits per component):
+ *	- XVIDC_CSF_MEM_RGB8:      R, G, B bytes.
+ *	- XVIDC_CSF_MEM_YUYV8:     Y0, U, Y1, V bytes (4:2:2).
+ *	- XVIDC_CSF_MEM_Y_UV8_420: Y plane followed by an interleaved U, V
+ *				   plane of half height (4:2:0).
+ *
+ * The conversions use the 12 fractional bit coefficients and the offsets
+ * the v_csc driver programs for full range RGB and limited range YCbCr
+ * (XVIDC_CR_0_255), for the BT.601, BT.709 and BT.2020 standards. Chroma is
+ * down sampled by averaging neighbor samples and up sampled by repeating
+ * them, like the nearest neighbor mode of the chroma resampler cores.
+ *
+ * On ARM targets with NEON (__ARM_NEON) the RGB/YUYV conversions process 16
+ * pixels per iteration with NEON intrinsics. The NEON and the C paths give
+ * bit identical results.
+ *
+ * @note	Width must be even. Strides are in bytes.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 4.13  ag   10/15/26 Initial release.
+ * </pre>
+ *
+*******************************************************************************/
+
+#ifndef XVIDC_SWCSC_H_  /* Prevent circular inclusions by using protection
+			 * macros. */
+#define XVIDC_SWCSC_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************* Include Files ********************************/
+
+#include "xvidc.h"
+
+/**************************** Function Prototypes *****************************/
+
+void XVidC_SwYuyvToRgb(const u8 *SrcPtr, u32 SrcStride, u8 *DstPtr,
+		u32 DstStride, u32 Width, u32 Height, XVidC_ColorStd Std);
+void XVidC_SwRgbToYuyv(const u8 *SrcPtr, u32 SrcStride, u8 *DstPtr,
+		u32 DstStride, u32 Width, u32 Height, XVidC_ColorStd Std);
+void XVidC_SwYuv420ToRgb(const u8 *YPtr, const u8 *UvPtr, u32 SrcStride,
+		u8 *DstPtr, u32 DstStride, u32 Width, u32 Height,
+		XVidC_ColorStd Std);
+void XVidC_SwYuv420ToYuyv(const u8 *YPtr, const u8 *UvPtr, u32 SrcStride,
+		u8 *DstPtr, u32 DstStride, u32 Width, u32 Height);
+void XVidC_SwYuyvToYuv420(const u8 *SrcPtr, u32 SrcStride, u8 *YPtr,
+		u8 *UvPtr, u32 DstStride, u32 Width, u32 Height);
+int XVidC_SwFillColorBars(u8 *DstPtr, u8 *UvPtr, u32 DstStride, u32 Width,
+		u32 Height, XVidC_ColorFormat ColorFormat, XVidC_ColorStd Std);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XVIDC_SWCSC_H_ */
+/** @} */
@@ -24,6 +24,8 @@
 * 2.00  dmc   03/03/16  Remove xil_print's and report errors via event log
 * 2.10  rco   07/21/16  Used UINTPTR instead of u32 for Address
 * 2.3   rco   02/09/17  Fix c++ warnings
+* 2.11  ag    10/15/26  Use one word aligned frame store pitch for both
+*                       channels, added XVprocSs_VdmaGetFrameStoreSize
 * </pre>
 *
 ******************************************************************************/
@@ -35,6 +37,65 @@
 #define XVDMA_RESET_TIMEOUT   (1000000) //10ms at 10ns time period (100MHz clock))
 
 /************************** Function Prototypes ******************************/
+static u32 XVprocSs_VdmaGetStride(XAxiVdma *XVdmaPtr, u32 FrameWidth,
+                                  u32 PixelWidthInBits);
+
+/*****************************************************************************/
+/**
+* This function computes the line pitch of the frame stores. The pitch is the
+* packed line size rounded up to the wider of the two AXI-MM data widths, so
+* each line starts on a bus word boundary and both channels use the same
+* layout, whether or not they include a data realignment engine.
+*
+* @param  XVdmaPtr is the pointer to the VDMA instance
+* @param  FrameWidth is the active width of the frame
+* @param  PixelWidthInBits is Bits Per Pixel of the frame store
+*
+* @return Line pitch in bytes
+*
+*******************************************************************************/
+static u32 XVprocSs_VdmaGetStride(XAxiVdma *XVdmaPtr, u32 FrameWidth,
+                                  u32 PixelWidthInBits)
+{
+  u32 alignBytes;
+
+  alignBytes = XVdmaPtr->WriteChannel.WordLength;
+  if(XVdmaPtr->ReadChannel.WordLength > alignBytes)
+  {
+    alignBytes = XVdmaPtr->ReadChannel.WordLength;
+  }
+  alignBytes -= 1;
+
+  return((((FrameWidth * PixelWidthInBits)/8) + alignBytes) & ~(alignBytes));
+}
+
+/*****************************************************************************/
+/**
+* This function returns the size of one VDMA frame store
+*
+* @param  XVprocSsPtr is the pointer to the VPSS instance
+* @param  FrameWidth is the active width of the frame
+* @param  FrameHeight is the active height of the frame
+* @param  PixelWidthInBits is Bits Per Pixel of the frame store
+*
+* @return Frame store size in bytes, 0 if the subsystem has no VDMA
+*
+*******************************************************************************/
+u32 XVprocSs_VdmaGetFrameStoreSize(XVprocSs *XVprocSsPtr,
+                                   u32 FrameWidth,
+                                   u32 FrameHeight,
+                                   u32 PixelWidthInBits)
+{
+  XAxiVdma *XVdmaPtr = XVprocSsPtr->VdmaPtr;
+
+  if(!XVdmaPtr)
+  {
+    return(0);
+  }
+
+  return(XVprocSs_VdmaGetStride(XVdmaPtr, FrameWidth, PixelWidthInBits) *
+         FrameHeight);
+}
 
 /*****************************************************************************/
 /**
@@ -147,18 +208,18 @@ int XVprocSs_VdmaWriteSetup(XVprocSs *XVprocSsPtr,
   {
 	memset(&WriteCfg, 0, sizeof(XAxiVdma_DmaSetup));
     HSizeInBytes   = (window->Width  * PixelWidthInBits)/8;
-    StrideInBytes  = (FrameWidth     * PixelWidthInBits)/8;
+    StrideInBytes  = XVprocSs_VdmaGetStride(XVdmaPtr, FrameWidth,
+                                            PixelWidthInBits);
     StartHPosBytes = (window->StartX * PixelWidthInBits)/8;
 
     /* If DMA engine does not support unaligned transfers then align block
-     * offset, hsize and stride to next data width boundary (aximm)
+     * offset and hsize to next data width boundary (aximm)
      */
     if(!XVdmaPtr->WriteChannel.HasDRE)
     {
       alignBytes = XVdmaPtr->WriteChannel.WordLength-1;
 
       HSizeInBytes   = (HSizeInBytes   + alignBytes) & ~(alignBytes);
-      StrideInBytes  = (StrideInBytes  + alignBytes) & ~(alignBytes);
       StartHPosBytes = (StartHPosBytes + alignBytes) & ~(alignBytes);
     }
 
@@ -250,19 +311,19 @@ int XVprocSs_VdmaReadSetup(XVprocSs *XVprocSsPtr,
   if(XVdmaPtr)
   {
     HSizeInBytes   = (window->Width  * PixelWidthInBits)/8;
-    StrideInBytes  = (FrameWidth     * PixelWidthInBits)/8;
+    StrideInBytes  = XVprocSs_VdmaGetStride(XVdmaPtr, FrameWidth,
+                                            PixelWidthInBits);
     StartHPosBytes = (window->StartX * PixelWidthInBits)/8;
 
     /* If DMA engine does not support unaligned transfers then align block
-     * offset, hsize and stride
-     * Block offset and Stride are aligned to aximm width
+     * offset and hsize
+     * Block offset is aligned to aximm width
      * hsize is aligned to axis width
      */
     if(!XVdmaPtr->ReadChannel.HasDRE)
     {
       alignBytes = XVdmaPtr->ReadChannel.WordLength-1;
 
-      StrideInBytes  = (StrideInBytes  + alignBytes) & ~(alignBytes);
       StartHPosBytes = (StartHPosBytes + alignBytes) & ~(alignBytes);
 
       /* align hsize to stream width (axis) */
@@ -47,6 +47,7 @@
 * 1.00  rco  07/21/15  Initial Release
 * 2.00  dmc  03/03/16  Pass VPSS pointer to routines for event log reporting
 * 2.10  rco  07/21/16  Used UINTPTR instead of u32 for Address
+* 2.11  ag   10/15/26  Added XVprocSs_VdmaGetFrameStoreSize
 * </pre>
 *
 ******************************************************************************/
@@ -89,6 +90,10 @@ int XVprocSs_VdmaReadSetup(XVprocSs *XVprocSsPtr,
                            u32 FrameHeight,
                            u32 PixelWidthInBits);
 int XVprocSs_VdmaStartTransfer(XVprocSs *XVprocSsPtr);
+u32 XVprocSs_VdmaGetFrameStoreSize(XVprocSs *XVprocSsPtr,
+                                   u32 FrameWidth,
+                                   u32 FrameHeight,
+                                   u32 PixelWidthInBits);
 void XVprocSs_VdmaDbgReportStatus(XVprocSs *XVprocSsPtr, u32 PixelWidthInBits);
 void XVprocSs_VdmaSetWinToUpScaleMode(XVprocSs *XVprocSsPtr, u32 updateCh);
 void XVprocSs_VdmaSetWinToDnScaleMode(XVprocSs *XVprocSsPtr, u32 updateCh);
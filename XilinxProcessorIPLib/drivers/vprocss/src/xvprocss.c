@@ -37,6 +37,8 @@
 * 2.40  vyc  10/04/17   Added support for conversion from 420/422/444/RGB to
 *                       420/422/444/RGB with CSC-only topology
 * 2.50  vyc  04/04/18   Fix for HScaler setup with 420 input
+* 2.11  ag   10/15/26   Size the deinterlacer buffer offset from the packed
+*                       VDMA frame store size
 *
 * </pre>
 *
@@ -129,6 +131,7 @@ const u16 XVprocSs_PixelHStep[3][4] =
 
 /************************** Function Prototypes ******************************/
 static void SetPowerOnDefaultState(XVprocSs *XVprocSsPtr);
+static u8 GetPixelWidthInBits(XVprocSs *XVprocSsPtr);
 static void GetIncludedSubcores(XVprocSs *XVprocSsPtr);
 static int ValidateSubsystemConfig(XVprocSs *InstancePtr);
 static int ValidateScalerOnlyConfig(XVprocSs *XVprocSsPtr);
@@ -453,16 +456,12 @@ int XVprocSs_CfgInitialize(XVprocSs *InstancePtr, XVprocSs_Config *CfgPtr,
 
     /* Set Deinterlacer buffer offset in allocated DDR Frame Buffer memory */
     if(InstancePtr->VdmaPtr) {
-      u32 Bpc; //bytes per component
-
-      Bpc = (InstancePtr->Config.ColorDepth + 7)/8;
-
-      //compute buffer size based on subsystem configuration
+      //compute buffer size from the packed VDMA pixel width
       //For 1 4K2K buffer (YUV444 16-bit) size is ~48MB
-      bufsize = InstancePtr->Config.MaxWidth *
-		        InstancePtr->Config.MaxHeight *
-		        InstancePtr->Config.NumVidComponents *
-		        Bpc;
+      bufsize = XVprocSs_VdmaGetFrameStoreSize(InstancePtr,
+                                               InstancePtr->Config.MaxWidth,
+                                               InstancePtr->Config.MaxHeight,
+                                               GetPixelWidthInBits(InstancePtr));
 
       //VDMA requires 4 buffers for total size of ~190MB
       vdmaBufReq = InstancePtr->VdmaPtr->MaxNumFrames * bufsize;
@@ -501,6 +500,48 @@ int XVprocSs_CfgInitialize(XVprocSs *InstancePtr, XVprocSs_Config *CfgPtr,
   return(XST_SUCCESS);
 }
 
+/*****************************************************************************/
+/**
+* This function computes the number of bits one pixel takes in the VDMA frame
+* stores. The AXI-MM data is packed, except at 1 and 2 pixels per clock with
+* 10 bits per component where the HW pads each pixel to the next byte.
+*
+* @param  XVprocSsPtr is a pointer to the Subsystem instance to be worked on.
+*
+* @return Bits per pixel in the frame stores
+*
+******************************************************************************/
+static u8 GetPixelWidthInBits(XVprocSs *XVprocSsPtr)
+{
+  u8 PixelWidthInBits;
+
+  PixelWidthInBits = XVprocSsPtr->Config.NumVidComponents *
+                     XVprocSsPtr->Config.ColorDepth;
+  switch(XVprocSsPtr->Config.PixPerClock)
+  {
+    case XVIDC_PPC_1:
+    case XVIDC_PPC_2:
+	 if(XVprocSsPtr->Config.ColorDepth == XVIDC_BPC_10)
+	 {
+	   /* Align the bit width to next byte boundary for this particular case
+	    * Num_Channel	Color Depth		PixelWidth		Align
+	    * ----------------------------------------------------
+	    *    2				10				20			 24
+	    *    3				10				30			 32
+	    *
+	    *    HW will do the bit padding for 20->24 and 30->32
+	    */
+	   PixelWidthInBits = ((PixelWidthInBits + 7)/8)*8;
+	 }
+	 break;
+
+    default:
+	 break;
+  }
+
+  return PixelWidthInBits;
+}
+
 /*****************************************************************************/
 /**
 * This function configures the Video Processing subsystem internal blocks
@@ -549,29 +590,7 @@ static void SetPowerOnDefaultState(XVprocSs *XVprocSsPtr)
   XVprocSs_SetVidStreamOut(XVprocSsPtr, &vidStrmOut);
 
   /* compute data width supported by Vdma */
-  XVprocSsPtr->CtxtData.PixelWidthInBits = XVprocSsPtr->Config.NumVidComponents *
-			                               XVprocSsPtr->VidIn.ColorDepth;
-  switch(XVprocSsPtr->Config.PixPerClock)
-  {
-    case XVIDC_PPC_1:
-    case XVIDC_PPC_2:
-	 if(XVprocSsPtr->Config.ColorDepth == XVIDC_BPC_10)
-	 {
-	   /* Align the bit width to next byte boundary for this particular case
-	    * Num_Channel	Color Depth		PixelWidth		Align
-	    * ----------------------------------------------------
-	    *    2				10				20			 24
-	    *    3				10				30			 32
-	    *
-	    *    HW will do the bit padding for 20->24 and 30->32
-	    */
-	   XVprocSsPtr->CtxtData.PixelWidthInBits = ((XVprocSsPtr->CtxtData.PixelWidthInBits + 7)/8)*8;
-	 }
-	 break;
-
-    default:
-	 break;
-  }
+  XVprocSsPtr->CtxtData.PixelWidthInBits = GetPixelWidthInBits(XVprocSsPtr);
 
   /* Set default Pip/Zoom window increment step size */
   switch(XVprocSsPtr->Config.ColorDepth)
@@ -0,0 +1,503 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+*******************************************************************************/
+
+/******************************************************************************/
+/**
+* @file xdmapcie_rc_bar_bandwidth_example.c
+*
+* This file contains a design example for using XDMA PCIe IP and its driver
+* when it is configured as a Root Port. It measures the read and write
+* bandwidth to the BAR of an end point.
+*
+* The example enumerates the PCIe system, picks one of the BAR windows the
+* enumeration assigned to the end points and maps it: prefetchable BARs as
+* normal non cacheable memory, so that stores are merged into large posted
+* writes, all other BARs as device memory. It then measures
+*	- processor stores and loads to the BAR,
+*	- DMA transfers between DDR and the BAR through ZDMA, if the design has
+*	  one.
+*
+* @note
+*
+* This example should be used only when XDMA PCIe IP is configured as
+* root complex.
+*
+* The example overwrites the first XDMAPCIE_BW_SIZE bytes of the BAR. The
+* BAR must be backed by plain memory, such as a block RAM behind the BAR of
+* an XDMA end point; registers with side effects must not be tested.
+*
+* The time stamps are taken with XTime_GetTime(), so the example runs on ARM
+* processors only.
+*
+*<pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- ---------------------------------------------------
+* 1.6	ag	10/15/2026	Initial version of XDMA PCIe root complex BAR
+*			bandwidth example
+*</pre>
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+
+#include "xparameters.h"	/* Defines for XPAR constants */
+#include "xdmapcie.h"		/* XDmaPcie level 1 interface */
+#include "xil_printf.h"
+#include "xil_cache.h"
+#include "xtime_l.h"
+#include "xpseudo_asm.h"
+#include "sleep.h"
+#ifdef XPAR_XZDMA_NUM_INSTANCES
+#include "xzdma.h"
+#endif
+
+
+/************************** Constant Definitions ****************************/
+
+/* Parameters for the waiting for link up routine */
+#define XDMAPCIE_LINK_WAIT_MAX_RETRIES 		10
+#define XDMAPCIE_LINK_WAIT_USLEEP_MIN 		90000
+
+#define XDMAPCIE_DEVICE_ID 	XPAR_XDMAPCIE_0_DEVICE_ID
+
+#ifdef XPAR_XZDMA_NUM_INSTANCES
+#define ZDMA_DEVICE_ID		XPAR_XZDMA_0_DEVICE_ID
+#define ZDMA_TIMEOUT		100000000U
+#endif
+
+/*
+ * Recorded BAR window to test, see XDmaPcie_GetBarWindow()
+ */
+#define XDMAPCIE_BW_WINDOW	0
+
+/*
+ * Bytes transferred per pass, limited to the size of the BAR
+ */
+#define XDMAPCIE_BW_SIZE	0x100000U
+
+/*
+ * Passes per measurement
+ */
+#define XDMAPCIE_BW_PASSES	16U
+
+/*
+ * Command register offsets
+ */
+#define PCIE_CFG_CMD_MEM_EN	0x00000002 /* Memory access enable */
+#define PCIE_CFG_CMD_BUSM_EN	0x00000004 /* Bus master enable */
+
+#define PCIE_CFG_CMD_STATUS_REG		0x0001 /*
+						* Command/Status Register
+						* Offset
+						*/
+#define PCIE_CFG_PRI_SEC_BUS_REG	0x0006 /*
+						* Primary/Sec.Bus Register
+						* Offset
+						*/
+#define PCIE_CFG_PRIM_SEC_BUS		0x00070100
+
+
+/**************************** Type Definitions ******************************/
+
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+
+/************************** Function Prototypes *****************************/
+
+int PcieInitRootComplex(XDmaPcie *XdmaPciePtr, u16 DeviceId);
+static void PcieCpuBandwidth(UINTPTR BarAddr, u32 Size);
+#ifdef XPAR_XZDMA_NUM_INSTANCES
+static int PcieDmaBandwidth(UINTPTR BarAddr, u32 Size);
+#endif
+
+
+/************************** Variable Definitions ****************************/
+
+/* Allocate PCIe Root Complex IP Instance */
+XDmaPcie XdmaPcieInstance;
+
+#ifdef XPAR_XZDMA_NUM_INSTANCES
+XZDma ZDma;
+
+/* DDR side of the DMA transfers */
+u8 DmaBuffer[XDMAPCIE_BW_SIZE] __attribute__ ((aligned (64)));
+#endif
+
+/****************************************************************************/
+/**
+* This function is the entry point for the PCIe Root Complex BAR bandwidth
+* Example
+*
+* @param 	None
+*
+* @return
+*		- XST_SUCCESS if successful
+*		- XST_FAILURE if unsuccessful.
+*
+* @note 	None.
+*
+*****************************************************************************/
+int main(void)
+{
+	XDmaPcie_BarWindow *WindowPtr;
+	u32 Size;
+	u32 Index;
+	int Status;
+
+	/* Initialize Root Complex */
+	Status = PcieInitRootComplex(&XdmaPcieInstance, XDMAPCIE_DEVICE_ID);
+	if (Status != XST_SUCCESS) {
+		xil_printf("XdmaPcie rc bar bandwidth Example Failed\r\n");
+		return XST_FAILURE;
+	}
+
+	/* Scan PCIe Fabric, this assigns the BAR windows */
+	XDmaPcie_EnumerateFabric(&XdmaPcieInstance);
+
+	for (Index = 0; Index < XDmaPcie_GetNumBarWindows(&XdmaPcieInstance);
+								Index++) {
+		WindowPtr = XDmaPcie_GetBarWindow(&XdmaPcieInstance, Index);
+		xil_printf("Window %d: %02X:%02X.%X BAR %d at 0x%08X%08X, "
+			"%d KB%s%s\r\n", Index, WindowPtr->Bus,
+			WindowPtr->Device, WindowPtr->Function,
+			WindowPtr->BarNo, (u32)(WindowPtr->Addr >> 32),
+			(u32)WindowPtr->Addr, (u32)(WindowPtr->Size / 1024),
+			WindowPtr->Is64Bit ? ", 64 bit" : "",
+			WindowPtr->Prefetchable ? ", prefetchable" : "");
+	}
+
+	WindowPtr = XDmaPcie_GetBarWindow(&XdmaPcieInstance,
+						XDMAPCIE_BW_WINDOW);
+	if (WindowPtr == NULL) {
+		xil_printf("No BAR window %d to test\r\n", XDMAPCIE_BW_WINDOW);
+		xil_printf("XdmaPcie rc bar bandwidth Example Failed\r\n");
+		return XST_FAILURE;
+	}
+
+	Status = XST_INVALID_PARAM;
+	if (WindowPtr->Prefetchable == TRUE) {
+		Status = XDmaPcie_MapBarWindow(&XdmaPcieInstance, WindowPtr,
+							XDMAPCIE_BAR_MAP_WC);
+	}
+	if (Status == XST_INVALID_PARAM) {
+		Status = XDmaPcie_MapBarWindow(&XdmaPcieInstance, WindowPtr,
+						XDMAPCIE_BAR_MAP_DEVICE);
+		xil_printf("BAR mapped as device memory\r\n");
+	} else {
+		xil_printf("BAR mapped as write combining memory\r\n");
+	}
+	if ((Status != XST_SUCCESS) && (Status != XST_NO_FEATURE)) {
+		xil_printf("Failed to map the BAR\r\n");
+		xil_printf("XdmaPcie rc bar bandwidth Example Failed\r\n");
+		return XST_FAILURE;
+	}
+
+	Size = XDMAPCIE_BW_SIZE;
+	if (WindowPtr->Size < Size) {
+		Size = (u32)WindowPtr->Size;
+	}
+
+	PcieCpuBandwidth((UINTPTR)WindowPtr->Addr, Size);
+
+#ifdef XPAR_XZDMA_NUM_INSTANCES
+	Status = PcieDmaBandwidth((UINTPTR)WindowPtr->Addr, Size);
+	if (Status != XST_SUCCESS) {
+		xil_printf("XdmaPcie rc bar bandwidth Example Failed\r\n");
+		return XST_FAILURE;
+	}
+#endif
+
+	xil_printf("Successfully ran XdmaPcie rc bar bandwidth Example\r\n");
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+* This function prints the bandwidth of a measurement.
+*
+* @param	Name is the name of the measurement.
+* @param	Bytes is the number of bytes transferred.
+* @param	Ticks is the time taken, in XTime counts.
+*
+* @return	None.
+*
+* @note 	None.
+*
+******************************************************************************/
+static void PciePrintBandwidth(const char *Name, u64 Bytes, XTime Ticks)
+{
+	u64 KBps = 0;
+
+	if (Ticks != 0) {
+		KBps = (Bytes * COUNTS_PER_SECOND) / ((u64)Ticks * 1024U);
+	}
+
+	xil_printf("%s: %d MB/s\r\n", Name, (u32)(KBps / 1024U));
+}
+
+/****************************************************************************/
+/**
+* This function measures processor stores and loads to a BAR.
+*
+* @param	BarAddr is the address of the BAR.
+* @param	Size is the number of bytes to transfer per pass.
+*
+* @return	None.
+*
+* @note 	The stores are 64 bit wide; on a window mapped as write
+*		combining memory they reach the link as merged writes. Loads
+*		are always non posted reads, one TLP per load.
+*
+******************************************************************************/
+static void PcieCpuBandwidth(UINTPTR BarAddr, u32 Size)
+{
+	volatile u64 *BarPtr = (volatile u64 *)BarAddr;
+	u64 Sum = 0;
+	XTime Start;
+	XTime End;
+	u32 Pass;
+	u32 Index;
+
+	XTime_GetTime(&Start);
+	for (Pass = 0; Pass < XDMAPCIE_BW_PASSES; Pass++) {
+		for (Index = 0; Index < (Size / sizeof(u64)); Index++) {
+			BarPtr[Index] = Index;
+		}
+	}
+	/* Wait for the posted writes to leave the processor */
+	dsb();
+	XTime_GetTime(&End);
+	PciePrintBandwidth("CPU write", (u64)Size * XDMAPCIE_BW_PASSES,
+								End - Start);
+
+	XTime_GetTime(&Start);
+	for (Pass = 0; Pass < XDMAPCIE_BW_PASSES; Pass++) {
+		for (Index = 0; Index < (Size / sizeof(u64)); Index++) {
+			Sum += BarPtr[Index];
+		}
+	}
+	XTime_GetTime(&End);
+	PciePrintBandwidth("CPU read", (u64)Size * XDMAPCIE_BW_PASSES,
+								End - Start);
+
+	/* Every pass read back what the last write pass stored */
+	if (Sum != ((u64)XDMAPCIE_BW_PASSES * (Size / sizeof(u64)) *
+				((Size / sizeof(u64)) - 1U) / 2U)) {
+		xil_printf("CPU read back mismatch\r\n");
+	}
+}
+
+#ifdef XPAR_XZDMA_NUM_INSTANCES
+/****************************************************************************/
+/**
+* This function runs one ZDMA transfer in polled mode.
+*
+* @param	SrcAddr is the source address.
+* @param	DstAddr is the destination address.
+* @param	Size is the number of bytes to transfer.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if unsuccessful.
+*
+* @note 	None.
+*
+******************************************************************************/
+static int PcieDmaTransfer(UINTPTR SrcAddr, UINTPTR DstAddr, u32 Size)
+{
+	XZDma_Transfer Data;
+	u32 Timeout = ZDMA_TIMEOUT;
+
+	Data.SrcAddr = SrcAddr;
+	Data.DstAddr = DstAddr;
+	Data.Size = Size;
+	Data.SrcCoherent = 0;
+	Data.DstCoherent = 0;
+	Data.Pause = 0;
+
+	XZDma_IntrClear(&ZDma, XZDMA_IXR_ALL_INTR_MASK);
+	if (XZDma_Start(&ZDma, &Data, 1) != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	while ((XZDma_IntrGetStatus(&ZDma) & XZDMA_IXR_DMA_DONE_MASK) == 0U) {
+		if (--Timeout == 0U) {
+			return XST_FAILURE;
+		}
+	}
+	XZDma_IntrClear(&ZDma, XZDMA_IXR_ALL_INTR_MASK);
+
+	/* No interrupt handler runs to move the channel back to idle */
+	ZDma.ChannelState = XZDMA_IDLE;
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+* This function measures ZDMA transfers between DDR and a BAR.
+*
+* @param	BarAddr is the address of the BAR.
+* @param	Size is the number of bytes to transfer per pass.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if unsuccessful.
+*
+* @note 	None.
+*
+******************************************************************************/
+static int PcieDmaBandwidth(UINTPTR BarAddr, u32 Size)
+{
+	XZDma_Config *ConfigPtr;
+	XZDma_DataConfig DataConfig;
+	XTime Start;
+	XTime End;
+	u32 Index;
+	u32 Pass;
+
+	ConfigPtr = XZDma_LookupConfig(ZDMA_DEVICE_ID);
+	if (ConfigPtr == NULL) {
+		return XST_FAILURE;
+	}
+	if (XZDma_CfgInitialize(&ZDma, ConfigPtr,
+				ConfigPtr->BaseAddress) != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+	if (XZDma_SetMode(&ZDma, FALSE, XZDMA_NORMAL_MODE) != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/* Longest bursts, the BAR is the slow side */
+	XZDma_GetChDataConfig(&ZDma, &DataConfig);
+	DataConfig.OverFetch = 0;
+	DataConfig.SrcIssue = 0x1F;
+	DataConfig.SrcBurstType = XZDMA_INCR_BURST;
+	DataConfig.SrcBurstLen = 0xF;
+	DataConfig.DstBurstType = XZDMA_INCR_BURST;
+	DataConfig.DstBurstLen = 0xF;
+	XZDma_SetChDataConfig(&ZDma, &DataConfig);
+	XZDma_DisableIntr(&ZDma, XZDMA_IXR_ALL_INTR_MASK);
+
+	for (Index = 0; Index < Size; Index++) {
+		DmaBuffer[Index] = (u8)Index;
+	}
+	Xil_DCacheFlushRange((UINTPTR)DmaBuffer, Size);
+
+	XTime_GetTime(&Start);
+	for (Pass = 0; Pass < XDMAPCIE_BW_PASSES; Pass++) {
+		if (PcieDmaTransfer((UINTPTR)DmaBuffer, BarAddr,
+						Size) != XST_SUCCESS) {
+			xil_printf("DMA write timed out\r\n");
+			return XST_FAILURE;
+		}
+	}
+	XTime_GetTime(&End);
+	PciePrintBandwidth("DMA write", (u64)Size * XDMAPCIE_BW_PASSES,
+								End - Start);
+
+	memset(DmaBuffer, 0, Size);
+	Xil_DCacheFlushRange((UINTPTR)DmaBuffer, Size);
+
+	XTime_GetTime(&Start);
+	for (Pass = 0; Pass < XDMAPCIE_BW_PASSES; Pass++) {
+		if (PcieDmaTransfer(BarAddr, (UINTPTR)DmaBuffer,
+						Size) != XST_SUCCESS) {
+			xil_printf("DMA read timed out\r\n");
+			return XST_FAILURE;
+		}
+	}
+	XTime_GetTime(&End);
+	PciePrintBandwidth("DMA read", (u64)Size * XDMAPCIE_BW_PASSES,
+								End - Start);
+
+	Xil_DCacheInvalidateRange((UINTPTR)DmaBuffer, Size);
+	for (Index = 0; Index < Size; Index++) {
+		if (DmaBuffer[Index] != (u8)Index) {
+			xil_printf("DMA read back mismatch at 0x%x\r\n", Index);
+			return XST_FAILURE;
+		}
+	}
+
+	return XST_SUCCESS;
+}
+#endif
+
+/****************************************************************************/
+/**
+* This function initializes a XDMA PCIe IP built as a root complex
+*
+*
+* @param	XdmaPciePtr is a pointer to an instance of XDmaPcie data
+*		structure represents a root complex IP.
+* @param 	DeviceId is XDMA PCIe IP unique ID
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if unsuccessful.
+*
+* @note 	None.
+*
+*
+******************************************************************************/
+int PcieInitRootComplex(XDmaPcie *XdmaPciePtr, u16 DeviceId)
+{
+	int Status;
+	int Retries;
+	u32 HeaderData;
+	XDmaPcie_Config *ConfigPtr;
+
+	ConfigPtr = XDmaPcie_LookupConfig(DeviceId);
+
+	Status = XDmaPcie_CfgInitialize(XdmaPciePtr, ConfigPtr,
+						ConfigPtr->BaseAddress);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Failed to initialize PCIe Root Complex"
+							"IP Instance\r\n");
+		return XST_FAILURE;
+	}
+
+	if(!XdmaPciePtr->Config.IncludeRootComplex) {
+		xil_printf("Failed to initialize...XDMA PCIE is configured"
+							" as endpoint\r\n");
+		return XST_FAILURE;
+	}
+
+	/* Make sure all interrupts disabled and cleared */
+	XDmaPcie_DisableInterrupts(XdmaPciePtr, XDMAPCIE_IM_ENABLE_ALL_MASK);
+	XDmaPcie_ClearPendingInterrupts(XdmaPciePtr,
+						XDMAPCIE_ID_CLEAR_ALL_MASK);
+
+	/* Make sure link is up. */
+	Status = FALSE;
+	for (Retries = 0; Retries < XDMAPCIE_LINK_WAIT_MAX_RETRIES; Retries++) {
+		if (XDmaPcie_IsLinkUp(XdmaPciePtr)){
+			Status = TRUE;
+			break;
+		}
+		usleep(XDMAPCIE_LINK_WAIT_USLEEP_MIN);
+	}
+	if (Status != TRUE ) {
+		xil_printf("Link is not up\r\n");
+		return XST_FAILURE;
+	}
+
+	xil_printf("Link is up\r\n");
+
+	/* Set up the PCIe header of this Root Complex */
+	XDmaPcie_ReadLocalConfigSpace(XdmaPciePtr,
+					PCIE_CFG_CMD_STATUS_REG, &HeaderData);
+	HeaderData |= (PCIE_CFG_CMD_BUSM_EN | PCIE_CFG_CMD_MEM_EN);
+	XDmaPcie_WriteLocalConfigSpace(XdmaPciePtr,
+					PCIE_CFG_CMD_STATUS_REG, HeaderData);
+
+	/* Set up Bus number */
+	XDmaPcie_WriteLocalConfigSpace(XdmaPciePtr,
+			PCIE_CFG_PRI_SEC_BUS_REG, PCIE_CFG_PRIM_SEC_BUS);
+
+	return XST_SUCCESS;
+}
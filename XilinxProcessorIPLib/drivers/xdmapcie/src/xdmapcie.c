@@ -16,6 +16,9 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- ---------------------------------------------------
 * 1.0	tk	01/30/2019	First release
+* 1.6	ag	10/15/2026	Align BARs to their size, place only prefetchable
+*			64 bit BARs in prefetchable memory and record the
+*			BAR windows of end points.
 * </pre>
 *
 *****************************************************************************/
@@ -109,32 +112,38 @@ static u8 XdmaPcie_IsValidAddr(u64 Addr)
 /**
 * This function reserves bar memory address.
 *
+* Prefetchable 64 bit BARs are placed in prefetchable memory, all other BARs in
+* non prefetchable memory, which is the only memory type a bridge forwards
+* without address translation for 32 bit BARs. The address is aligned to the
+* size of the BAR as required by the PCIe specification.
+*
 * @param   InstancePtr pointer to XDmaPcie Instance Pointer
-* @param   mem_type type of bar memory. address mem or IO.
-* @param   mem_as bar memory tpye 32 or 64 bit
-* @param   size	u64 size to increase
+* @param   MemBarArdSize bar memory tpye 32 or 64 bit
+* @param   Prefetchable TRUE if the bar is prefetchable
+* @param   Size	u64 size of the bar, a power of 2
 *
 * @return  bar address
 *
 *******************************************************************************/
 static u64 XDmaPcie_ReserveBarMem(XDmaPcie *InstancePtr,
-		u8 MemBarArdSize, u64 Size)
+		u8 MemBarArdSize, u8 Prefetchable, u64 Size)
 {
 	u64 Ret = 0;
 
 	if ((MemBarArdSize == XDMAPCIE_BAR_MEM_TYPE_64) &&
+	    (Prefetchable == TRUE) &&
 	    (XdmaPcie_IsValidAddr(InstancePtr->Config.PMemBaseAddr) == TRUE)) {
-		Ret = InstancePtr->Config.PMemBaseAddr;
-		InstancePtr->Config.PMemBaseAddr = InstancePtr->Config.PMemBaseAddr
-							+ Size;
-		Xil_AssertNonvoid(InstancePtr->Config.PMemBaseAddr <=
+		Ret = (InstancePtr->Config.PMemBaseAddr + Size - 1U) &
+			(~(Size - 1U));
+		Xil_AssertNonvoid((Ret + Size) <=
 				InstancePtr->Config.PMemMaxAddr);
+		InstancePtr->Config.PMemBaseAddr = Ret + Size;
 	} else {
-		Ret = InstancePtr->Config.NpMemBaseAddr;
-		InstancePtr->Config.NpMemBaseAddr = InstancePtr->Config.NpMemBaseAddr
-							+ Size;
-		Xil_AssertNonvoid(InstancePtr->Config.NpMemBaseAddr <=
+		Ret = ((u64)InstancePtr->Config.NpMemBaseAddr + Size - 1U) &
+			(~(Size - 1U));
+		Xil_AssertNonvoid((Ret + Size) <=
 				InstancePtr->Config.NpMemMaxAddr);
+		InstancePtr->Config.NpMemBaseAddr = (u32)(Ret + Size);
 	}
 
 	return Ret;
@@ -144,11 +153,12 @@ static u32 XDmaPcie_ReserveBarMem(XDmaPcie *InstancePtr, u32 Size)
 {
 	u32 Ret = 0;
 
-	Ret = InstancePtr->Config.NpMemBaseAddr;
-	InstancePtr->Config.NpMemBaseAddr = InstancePtr->Config.NpMemBaseAddr
-						+ Size;
-	Xil_AssertNonvoid(InstancePtr->Config.NpMemBaseAddr <=
+	/* BARs are aligned to their size */
+	Ret = (InstancePtr->Config.NpMemBaseAddr + Size - 1U) & (~(Size - 1U));
+	Xil_AssertNonvoid(Ret >= InstancePtr->Config.NpMemBaseAddr);
+	Xil_AssertNonvoid((Ret + Size - 1U) <
 			InstancePtr->Config.NpMemMaxAddr);
+	InstancePtr->Config.NpMemBaseAddr = Ret + Size;
 
 	return Ret;
 }
@@ -157,10 +167,10 @@ static u32 XDmaPcie_ReserveBarMem(XDmaPcie *InstancePtr, u32 Size)
 static int XDmaPcie_PositionRightmostSetbit(u64 Size)
 {
 	int Position = 0;
-	int Bit = 1;
+	u64 Bit = 1;
 
 	/* ignore 4 bits */
-	Size = Size & (~(0xf));
+	Size = Size & (~((u64)0xf));
 
 	while (!(Size & Bit)) {
 		Bit = Bit << 1;
@@ -169,6 +179,49 @@ static int XDmaPcie_PositionRightmostSetbit(u64 Size)
 
 	return Position;
 }
+
+/******************************************************************************/
+/**
+* This function records an end point BAR assigned during enumeration as a BAR
+* window of the instance.
+*
+* @param   InstancePtr pointer to XDmaPcie Instance Pointer
+* @param   Bus
+* @param   Device
+* @param   Function
+* @param   BarNo number of the BAR
+* @param   Addr address assigned to the BAR
+* @param   Size size of the BAR
+* @param   Is64Bit TRUE if the BAR takes a 64 bit address
+* @param   Prefetchable TRUE if the BAR is prefetchable
+*
+*******************************************************************************/
+static void XDmaPcie_AddBarWindow(XDmaPcie *InstancePtr, u8 Bus, u8 Device,
+		u8 Function, u8 BarNo, u64 Addr, u64 Size, u8 Is64Bit,
+		u8 Prefetchable)
+{
+	XDmaPcie_BarWindow *WindowPtr;
+
+	if (InstancePtr->NumBarWindows >= XDMAPCIE_MAX_BAR_WINDOWS) {
+		XDmaPcie_Dbg(
+			"bus: %d, device: %d, function: %d: BAR %d is not "
+			"recorded, increase XDMAPCIE_MAX_BAR_WINDOWS\r\n",
+			Bus, Device, Function, BarNo);
+		return;
+	}
+
+	WindowPtr = &InstancePtr->BarWindows[InstancePtr->NumBarWindows];
+	WindowPtr->Addr = Addr;
+	WindowPtr->Size = Size;
+	WindowPtr->Bus = Bus;
+	WindowPtr->Device = Device;
+	WindowPtr->Function = Function;
+	WindowPtr->BarNo = BarNo;
+	WindowPtr->Is64Bit = Is64Bit;
+	WindowPtr->Prefetchable = Prefetchable;
+	InstancePtr->NumBarWindows++;
+}
+
 /******************************************************************************/
 /**
 * This function increments to next 1Mb page starting position of
@@ -203,10 +256,11 @@ static int XDmaPcie_AllocBarSpace(XDmaPcie *InstancePtr, u32 Headertype, u8 Bus,
 {
 	u32 Data = DATA_MASK_32;
 	u32 Location = 0;
-	u32 Size = 0, TestWrite;
+	u32 Size = 0;
+	u64 BarSize;
 #if defined(__aarch64__) || defined(__arch64__)
 	u64 BarAddr;
-	u32 Size_1 = 0, *PPtr;
+	u32 Size_1 = 0;
 	u32 Location_1 = 0;
 	u8 MemAs;
 #else
@@ -214,6 +268,8 @@ static int XDmaPcie_AllocBarSpace(XDmaPcie *InstancePtr, u32 Headertype, u8 Bus,
 #endif
 	u32 Tmp;
 	u8 BarNo;
+	u8 Is64Bit;
+	u8 Prefetchable;
 
 	u8 MaxBars = 0;
 
@@ -254,8 +310,13 @@ static int XDmaPcie_AllocBarSpace(XDmaPcie *InstancePtr, u32 Headertype, u8 Bus,
 			continue;
 		}
 
+		Is64Bit = ((Size & XDMAPCIE_CFG_BAR_MEM_AS_MASK) ==
+				XDMAPCIE_BAR_MEM_TYPE_64) ? TRUE : FALSE;
+		Prefetchable = ((Size & XDMAPCIE_CFG_BAR_PREFETCH_MASK) != 0U) ?
+				TRUE : FALSE;
+
 		/* check for 32 bit AS or 64 bit AS */
-		if ((Size & XDMAPCIE_CFG_BAR_MEM_AS_MASK) == XDMAPCIE_BAR_MEM_TYPE_64) {
+		if (Is64Bit == TRUE) {
 #if defined(__aarch64__) || defined(__arch64__)
 			/* 64 bit AS is required */
 			MemAs = XDMAPCIE_BAR_MEM_TYPE_64;
@@ -273,15 +334,13 @@ static int XDmaPcie_AllocBarSpace(XDmaPcie *InstancePtr, u32 Headertype, u8 Bus,
 						Location_1);
 
 			/* Merge two bars for size */
-			PPtr = (u32 *)&BarAddr;
-			*PPtr = Size;
-			*(PPtr + 1) = Size_1;
+			BarSize = ((u64)Size_1 << EIGHT_HEX_NIBBLES) | Size;
 
-			TestWrite = XDmaPcie_PositionRightmostSetbit(BarAddr);
-			/* actual bar size is 2 << TestWrite */
-			BarAddr =
-				XDmaPcie_ReserveBarMem(InstancePtr, MemAs,
-						(2 << (TestWrite - 1)));
+			/* actual bar size is the lowest writable bit */
+			BarSize = (u64)1 <<
+				XDmaPcie_PositionRightmostSetbit(BarSize);
+			BarAddr = XDmaPcie_ReserveBarMem(InstancePtr, MemAs,
+						Prefetchable, BarSize);
 
 			Tmp = (u32)BarAddr;
 
@@ -294,48 +353,34 @@ static int XDmaPcie_AllocBarSpace(XDmaPcie *InstancePtr, u32 Headertype, u8 Bus,
 			/* Write actual bar address here */
 			XDmaPcie_WriteReg((InstancePtr->Config.Ecam),
 						Location_1, Tmp);
-			XDmaPcie_Dbg(
-				"bus: %d, device: %d, function: %d: BAR %d, "
-				"ADDR: 0x%p size : %dK\r\n",
-				Bus, Device, Function, BarNo, BarAddr,
-				((2 << (TestWrite - 1)) / 1024));
 #else
-			TestWrite = XDmaPcie_PositionRightmostSetbit(Size);
-
-			/* actual bar size is 2 << TestWrite */
-			BarAddr =
-				XDmaPcie_ReserveBarMem(InstancePtr,
-						(2 << (TestWrite - 1)));
+			/* actual bar size is the lowest writable bit */
+			BarSize = (u64)1 <<
+				XDmaPcie_PositionRightmostSetbit(Size);
+			BarAddr = XDmaPcie_ReserveBarMem(InstancePtr,
+						(u32)BarSize);
 
 			Tmp = (u32)BarAddr;
 
 			/* Write actual bar address here */
 			XDmaPcie_WriteReg((InstancePtr->Config.Ecam), Location,
 					Tmp);
-			XDmaPcie_Dbg(
-				"bus: %d, device: %d, function: %d: BAR %d, "
-				"ADDR: 0x%p size : %dK\r\n",
-				Bus, Device, Function, BarNo, BarAddr,
-				((2 << (TestWrite - 1)) / 1024));
-
 #endif
 
 		} else {
-			TestWrite = XDmaPcie_PositionRightmostSetbit(Size);
+			/* actual bar size is the lowest writable bit */
+			BarSize = (u64)1 <<
+				XDmaPcie_PositionRightmostSetbit(Size);
 
 #if defined(__aarch64__) || defined(__arch64__)
 			/* 32 bit AS is required */
 			MemAs = XDMAPCIE_BAR_MEM_TYPE_32;
 
-			/* actual bar size is 2 << TestWrite */
-			BarAddr =
-				XDmaPcie_ReserveBarMem(InstancePtr, MemAs,
-						(2 << (TestWrite - 1)));
+			BarAddr = XDmaPcie_ReserveBarMem(InstancePtr, MemAs,
+						Prefetchable, BarSize);
 #else
-			/* actual bar size is 2 << TestWrite */
-			BarAddr =
-				XDmaPcie_ReserveBarMem(InstancePtr,
-						(2 << (TestWrite - 1)));
+			BarAddr = XDmaPcie_ReserveBarMem(InstancePtr,
+						(u32)BarSize);
 #endif
 
 			Tmp = (u32)BarAddr;
@@ -343,15 +388,22 @@ static int XDmaPcie_AllocBarSpace(XDmaPcie *InstancePtr, u32 Headertype, u8 Bus,
 			/* Write actual bar address here */
 			XDmaPcie_WriteReg((InstancePtr->Config.Ecam), Location,
 					Tmp);
-			XDmaPcie_Dbg(
-				"bus: %d, device: %d, function: %d: BAR %d, "
-				"ADDR: 0x%p size : %dK\r\n",
-				Bus, Device, Function, BarNo, BarAddr,
-				((2 << (TestWrite - 1)) / 1024));
 		}
+		XDmaPcie_Dbg(
+			"bus: %d, device: %d, function: %d: BAR %d, "
+			"ADDR: 0x%p size : %dK\r\n",
+			Bus, Device, Function, BarNo, BarAddr,
+			(u32)(BarSize / 1024));
+
+		if (Headertype == XDMAPCIE_CFG_HEADER_O_TYPE) {
+			XDmaPcie_AddBarWindow(InstancePtr, Bus, Device,
+					Function, BarNo, BarAddr, BarSize,
+					Is64Bit, Prefetchable);
+		}
+
 		/* no need to probe next bar if present BAR requires 64 bit AS
 		 */
-		if ((Size & XDMAPCIE_CFG_BAR_MEM_AS_MASK) == XDMAPCIE_BAR_MEM_TYPE_64)
+		if (Is64Bit == TRUE)
 			BarNo = BarNo + 1;
 	}
 
@@ -42,6 +42,16 @@
 * the caller to enable/disable each individual interrupt as well as get/clear
 * pending interrupts. Implementation of callback handlers is left to the user.
 *
+* <b>BAR Windows</b>
+*
+* When the IP is a root complex, XDmaPcie_EnumerateFabric() assigns memory to
+* the BARs of every end point it finds and records each assignment as a BAR
+* window in the instance. Prefetchable 64 bit BARs are placed in prefetchable
+* memory, all other memory BARs in non prefetchable memory, each aligned to its
+* size. XDmaPcie_FindBarWindow() looks a window up and XDmaPcie_MapBarWindow()
+* sets its memory attributes: device memory, or normal non cacheable memory so
+* that stores to a prefetchable BAR can be merged into larger PCIe writes.
+*
 * @note
 *
 * <pre>
@@ -50,6 +60,9 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- ---------------------------------------------------
 * 1.0	tk	01/30/2019	First release
+* 1.6	ag	10/15/2026	Record the BAR windows assigned to end points during
+*			enumeration and add xdmapcie_bar.c to look them up and
+*			map them as device or write combining memory.
 * </pre>
 *
 *****************************************************************************/
@@ -90,6 +103,20 @@ extern "C" {
 #define XDMAPCIE_VSEC1		0x00 /**< First VSEC Register */
 #define XDMAPCIE_VSEC2		0x01 /**< Second VSEC Register */
 
+/*
+ * Maximum number of end point BAR windows recorded during enumeration.
+ */
+#ifndef XDMAPCIE_MAX_BAR_WINDOWS
+#define XDMAPCIE_MAX_BAR_WINDOWS	32
+#endif
+
+/*
+ * Memory types for XDmaPcie_MapBarWindow().
+ */
+#define XDMAPCIE_BAR_MAP_DEVICE	0x00 /**< Device memory */
+#define XDMAPCIE_BAR_MAP_WC	0x01 /**< Normal non cacheable memory,
+				       * prefetchable BARs only */
+
 /**************************** Type Definitions ******************************/
 
 /**
@@ -122,6 +149,21 @@ typedef  struct {
 
 } XDmaPcie_Config;
 
+/**
+ * A memory BAR of an end point and the address assigned to it during
+ * enumeration.
+ */
+typedef struct {
+	u64 Addr;		/**< Address assigned to the BAR */
+	u64 Size;		/**< Size of the BAR in bytes */
+	u8 Bus;			/**< Bus number of the end point */
+	u8 Device;		/**< Device number of the end point */
+	u8 Function;		/**< Function number of the end point */
+	u8 BarNo;		/**< BAR number, 0 to 5 */
+	u8 Is64Bit;		/**< BAR takes a 64 bit address */
+	u8 Prefetchable;	/**< BAR is prefetchable */
+} XDmaPcie_BarWindow;
+
 /**
  * The XDmaPcie driver instance data. The user is required to allocate a
  * variable of this type for every PCIe device in the system that will be
@@ -134,6 +176,10 @@ typedef struct {
 	u32 IsReady;			/**< Is IP been initialized and ready */
 	u32 MaxNumOfBuses;		/**< If this is RC IP, Max Number of
 					 * Buses */
+	XDmaPcie_BarWindow BarWindows[XDMAPCIE_MAX_BAR_WINDOWS];
+					/**< End point BARs assigned during
+					 * enumeration */
+	u32 NumBarWindows;		/**< Number of valid BarWindows */
 
 } XDmaPcie;
 
@@ -274,6 +320,17 @@ u64 XDmaPcie_GetCapability(XDmaPcie *InstancePtr, u8 Bus, u8 Device,
 u8 XDmaPcie_PrintAllCapabilites(XDmaPcie *InstancePtr, u8 Bus, u8 Device,
 		u8 Function);
 
+/*
+ * BAR Window Functions.
+ * This API is implemented in xdmapcie_bar.c
+ */
+u32 XDmaPcie_GetNumBarWindows(XDmaPcie *InstancePtr);
+XDmaPcie_BarWindow *XDmaPcie_GetBarWindow(XDmaPcie *InstancePtr, u32 Index);
+XDmaPcie_BarWindow *XDmaPcie_FindBarWindow(XDmaPcie *InstancePtr, u8 Bus,
+		u8 Device, u8 Function, u8 BarNo);
+int XDmaPcie_MapBarWindow(XDmaPcie *InstancePtr,
+		XDmaPcie_BarWindow *WindowPtr, u8 MemType);
+
 #ifdef __cplusplus
 }
 #endif
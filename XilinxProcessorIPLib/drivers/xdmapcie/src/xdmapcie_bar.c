@@ -0,0 +1,288 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+*******************************************************************************/
+
+/******************************************************************************/
+/**
+* @file xdmapcie_bar.c
+*
+* Implements the functions to look up the end point BAR windows recorded by
+* XDmaPcie_EnumerateFabric() and to map them into the memory map of the
+* processor.
+*
+* A window mapped as XDMAPCIE_BAR_MAP_WC is normal non cacheable memory: the
+* processor may merge and reorder stores to it, so that a stream of stores is
+* sent as large posted writes instead of one TLP per store. This is allowed for
+* prefetchable BARs only. All other windows are mapped as device memory.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- ---------------------------------------------------
+* 1.6	ag	10/15/2026	First release
+* </pre>
+*
+*******************************************************************************/
+
+/******************************** Include Files *******************************/
+#include "xdmapcie.h"
+#include "xdmapcie_common.h"
+#if defined(ARMR5) || defined(ARMR52)
+#include "xreg_cortexr5.h"
+#include "xil_mpu.h"
+#elif defined(__aarch64__) || defined(__arm__)
+#include "xil_mmu.h"
+#endif
+
+/**************************** Constant Definitions ****************************/
+
+/*
+ * Granule of the translation table entries set by Xil_SetTlbAttributes()
+ */
+#if defined(__aarch64__)
+#define XDMAPCIE_MMU_BLOCK_4GB	0x100000000ULL
+#define XDMAPCIE_MMU_BLOCK_LOW	0x200000ULL	/* 2MB below 4GB */
+#define XDMAPCIE_MMU_BLOCK_HIGH	0x40000000ULL	/* 1GB above 4GB */
+#else
+#define XDMAPCIE_MMU_BLOCK_LOW	0x100000ULL	/* 1MB sections */
+#endif
+
+/****************************** Type Definitions ******************************/
+
+/******************** Macros (Inline Functions) Definitions *******************/
+
+/**************************** Variable Definitions ****************************/
+
+/***************************** Function Prototypes ****************************/
+
+#if !defined(ARMR5) && !defined(ARMR52) && \
+	(defined(__aarch64__) || defined(__arm__))
+/******************************************************************************/
+/**
+* This function returns the size of the translation table entry that maps an
+* address.
+*
+* @param   Addr is the address.
+*
+* @return  Size of the block or section in bytes.
+*
+*******************************************************************************/
+static u64 XDmaPcie_MmuBlockSize(u64 Addr)
+{
+#if defined(__aarch64__)
+	if (Addr >= XDMAPCIE_MMU_BLOCK_4GB) {
+		return XDMAPCIE_MMU_BLOCK_HIGH;
+	}
+#else
+	(void)Addr;
+#endif
+	return XDMAPCIE_MMU_BLOCK_LOW;
+}
+
+/******************************************************************************/
+/**
+* This function checks whether a window shares a translation table entry with
+* a window that is not prefetchable. Such a window would be mapped as normal
+* memory as well when the entry is changed.
+*
+* @param   InstancePtr pointer to XDmaPcie Instance Pointer
+* @param   WindowPtr is the window to check.
+*
+* @return  TRUE if an entry is shared, FALSE otherwise.
+*
+*******************************************************************************/
+static u8 XDmaPcie_SharesMmuBlock(XDmaPcie *InstancePtr,
+		XDmaPcie_BarWindow *WindowPtr)
+{
+	XDmaPcie_BarWindow *OtherPtr;
+	u64 Start;
+	u64 End;
+	u32 Index;
+
+	Start = WindowPtr->Addr &
+		(~(XDmaPcie_MmuBlockSize(WindowPtr->Addr) - 1U));
+	End = WindowPtr->Addr + WindowPtr->Size - 1U;
+	End = (End & (~(XDmaPcie_MmuBlockSize(End) - 1U))) +
+		XDmaPcie_MmuBlockSize(End);
+
+	for (Index = 0; Index < InstancePtr->NumBarWindows; Index++) {
+		OtherPtr = &InstancePtr->BarWindows[Index];
+		if ((OtherPtr->Prefetchable == TRUE) ||
+		    ((OtherPtr->Addr + OtherPtr->Size) <= Start) ||
+		    (OtherPtr->Addr >= End)) {
+			continue;
+		}
+		return TRUE;
+	}
+
+	return FALSE;
+}
+#endif
+
+/******************************************************************************/
+/**
+* This function returns the number of end point BAR windows recorded by the
+* last enumeration.
+*
+* @param   InstancePtr pointer to XDmaPcie Instance Pointer
+*
+* @return  Number of BAR windows.
+*
+*******************************************************************************/
+u32 XDmaPcie_GetNumBarWindows(XDmaPcie *InstancePtr)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	return InstancePtr->NumBarWindows;
+}
+
+/******************************************************************************/
+/**
+* This function returns a BAR window recorded by the last enumeration.
+*
+* @param   InstancePtr pointer to XDmaPcie Instance Pointer
+* @param   Index is the number of the window, from 0 to
+*	   XDmaPcie_GetNumBarWindows() - 1.
+*
+* @return  Pointer to the window, NULL if Index is out of range.
+*
+*******************************************************************************/
+XDmaPcie_BarWindow *XDmaPcie_GetBarWindow(XDmaPcie *InstancePtr, u32 Index)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if (Index >= InstancePtr->NumBarWindows) {
+		return NULL;
+	}
+
+	return &InstancePtr->BarWindows[Index];
+}
+
+/******************************************************************************/
+/**
+* This function looks up the window of a BAR of an end point.
+*
+* @param   InstancePtr pointer to XDmaPcie Instance Pointer
+* @param   Bus is the number of the Bus
+* @param   Device is the number of the Device
+* @param   Function is number of the Function
+* @param   BarNo is the number of the BAR, the lower one for a 64 bit BAR.
+*
+* @return  Pointer to the window, NULL if the BAR was not assigned.
+*
+*******************************************************************************/
+XDmaPcie_BarWindow *XDmaPcie_FindBarWindow(XDmaPcie *InstancePtr, u8 Bus,
+		u8 Device, u8 Function, u8 BarNo)
+{
+	XDmaPcie_BarWindow *WindowPtr;
+	u32 Index;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	for (Index = 0; Index < InstancePtr->NumBarWindows; Index++) {
+		WindowPtr = &InstancePtr->BarWindows[Index];
+		if ((WindowPtr->Bus == Bus) && (WindowPtr->Device == Device) &&
+		    (WindowPtr->Function == Function) &&
+		    (WindowPtr->BarNo == BarNo)) {
+			return WindowPtr;
+		}
+	}
+
+	return NULL;
+}
+
+/******************************************************************************/
+/**
+* This function sets the memory attributes of a BAR window.
+*
+* @param   InstancePtr pointer to XDmaPcie Instance Pointer
+* @param   WindowPtr is the window to map.
+* @param   MemType is XDMAPCIE_BAR_MAP_DEVICE or XDMAPCIE_BAR_MAP_WC.
+*
+* @return
+*		- XST_SUCCESS if the window is mapped.
+*		- XST_INVALID_PARAM if XDMAPCIE_BAR_MAP_WC is requested for a
+*		BAR that is not prefetchable, or that shares a translation
+*		table entry with one that is not.
+*		- XST_FAILURE if no MPU region is free.
+*		- XST_NO_FEATURE if the processor has no MMU or MPU.
+*
+* @note		On Cortex-A processors the attributes are set for whole
+*		translation table entries: 2MB below 4GB and 1GB above on
+*		64 bit processors, 1MB sections on 32 bit processors. On
+*		Cortex-R processors the window takes an MPU region.
+*
+*******************************************************************************/
+int XDmaPcie_MapBarWindow(XDmaPcie *InstancePtr,
+		XDmaPcie_BarWindow *WindowPtr, u8 MemType)
+{
+#if defined(ARMR5) || defined(ARMR52)
+	u32 Attrib;
+#elif defined(__aarch64__) || defined(__arm__)
+	u32 Attrib;
+	u64 Addr;
+	u64 End;
+#endif
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(WindowPtr != NULL);
+	Xil_AssertNonvoid((MemType == XDMAPCIE_BAR_MAP_DEVICE) ||
+			(MemType == XDMAPCIE_BAR_MAP_WC));
+
+	if ((MemType == XDMAPCIE_BAR_MAP_WC) &&
+	    (WindowPtr->Prefetchable != TRUE)) {
+		XDmaPcie_Err("bus: %d, device: %d, function: %d: BAR %d is "
+			"not prefetchable\r\n", WindowPtr->Bus,
+			WindowPtr->Device, WindowPtr->Function,
+			WindowPtr->BarNo);
+		return XST_INVALID_PARAM;
+	}
+
+#if defined(ARMR5) || defined(ARMR52)
+	if (MemType == XDMAPCIE_BAR_MAP_WC) {
+		Attrib = NORM_NSHARED_NCACHE | PRIV_RW_USER_RW;
+	} else {
+		Attrib = DEVICE_NONSHARED | PRIV_RW_USER_RW;
+	}
+
+	/* BARs are a power of 2 in size and aligned to it, as regions are */
+	if (Xil_SetMPURegion((INTPTR)WindowPtr->Addr, WindowPtr->Size,
+			Attrib) != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+#elif defined(__aarch64__) || defined(__arm__)
+	if (MemType == XDMAPCIE_BAR_MAP_WC) {
+		if (XDmaPcie_SharesMmuBlock(InstancePtr, WindowPtr) == TRUE) {
+			XDmaPcie_Err("bus: %d, device: %d, function: %d: "
+				"BAR %d shares a translation table entry "
+				"with a non prefetchable BAR\r\n",
+				WindowPtr->Bus, WindowPtr->Device,
+				WindowPtr->Function, WindowPtr->BarNo);
+			return XST_INVALID_PARAM;
+		}
+		Attrib = NORM_NONCACHE;
+	} else {
+		Attrib = DEVICE_MEMORY;
+	}
+
+	Addr = WindowPtr->Addr;
+	End = WindowPtr->Addr + WindowPtr->Size;
+	while (Addr < End) {
+		Xil_SetTlbAttributes((UINTPTR)Addr, Attrib);
+		Addr = (Addr & (~(XDmaPcie_MmuBlockSize(Addr) - 1U))) +
+			XDmaPcie_MmuBlockSize(Addr);
+	}
+
+	return XST_SUCCESS;
+#else
+	return XST_NO_FEATURE;
+#endif
+}
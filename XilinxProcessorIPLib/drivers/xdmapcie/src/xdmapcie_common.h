@@ -15,6 +15,7 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- ---------------------------------------------------
 * 1.0	tk	01/30/2019	First release
+* 1.6	ag	10/15/2026	Added XDMAPCIE_CFG_BAR_PREFETCH_MASK.
 * </pre>
 *
 *******************************************************************************/
@@ -65,6 +66,8 @@ extern "C" {
 
 #define XDMAPCIE_CFG_BAR_MEM_AS_MASK	0x6	/* 32b or 64b address space */
 
+#define XDMAPCIE_CFG_BAR_PREFETCH_MASK	0x8	/* Prefetchable memory */
+
 /* PCIe Base Addr */
 #define XDMAPCIE_CFG_BAR_BASE_OFFSET 	0x0004
 
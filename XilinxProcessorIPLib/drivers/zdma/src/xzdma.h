@@ -50,6 +50,17 @@
 * functions by using XZDma_SetCallBack API. In this version Descriptor done
 * option is disabled.
 *
+* <b> Job queue </b>
+* The job queue turns one or more ZDMA channels into a shared copy offload.
+* Jobs of (source, destination, size, callback) are added with
+* XZDma_QueueEnqueue() and are issued to the idle channels of the queue as a
+* single descriptor chain of up to XZDMA_QUEUE_MAX_BATCH jobs per channel.
+* When a chain completes, the callbacks of all its jobs are called and the
+* next chain is issued on that channel. Each channel must be set to scatter
+* gather mode and given descriptor memory with XZDma_CreateBDList() before
+* it is added with XZDma_QueueAddChannel(). Completions are taken either
+* from XZDma_IntrHandler or, without interrupts, from XZDma_QueuePoll().
+*
 * <b> Virtual Memory </b>
 *
 * This driver supports Virtual Memory. The RTOS is responsible for calculating
@@ -115,6 +126,9 @@
 *                        in applications directly.
 * 1.14	adk	03/15/22 Fixed syntax errors in zdma_tapp.tcl file, when stdout
 * 			 is configured as none.
+* 1.15  ag      10/14/26 Added the job queue, XZDma_QueueInitialize(),
+*			 XZDma_QueueAddChannel(), XZDma_QueueEnqueue() and
+*			 XZDma_QueuePoll().
 * </pre>
 *
 ******************************************************************************/
@@ -136,6 +150,15 @@ extern "C" {
 
 /************************** Constant Definitions *****************************/
 
+/** @name Job queue limits
+ * @{
+ */
+#define XZDMA_QUEUE_MAX_CHANNELS	8U	/**< Channels per queue */
+#ifndef XZDMA_QUEUE_MAX_BATCH
+#define XZDMA_QUEUE_MAX_BATCH		16U	/**< Jobs per descriptor
+						  *  chain */
+#endif
+/*@}*/
 
 /**************************** Type Definitions *******************************/
 
@@ -352,6 +375,62 @@ typedef struct {
 				  *  this transfer only for SG mode */
 } XZDma_Transfer;
 
+/******************************************************************************/
+/**
+* Callback type for the completion of a queued job.
+*
+* @param 	CallBackRef is the reference passed to XZDma_QueueEnqueue().
+* @param	Status is XST_SUCCESS, or XST_FAILURE if the channel reported
+*		an AXI error for the chain holding the job.
+*******************************************************************************/
+typedef void (*XZDma_JobHandler) (void *CallBackRef, s32 Status);
+
+/**
+* This typedef contains a job of the job queue.
+*/
+typedef struct {
+	UINTPTR SrcAddr;		/**< Source address */
+	UINTPTR DstAddr;		/**< Destination address */
+	u32 Size;			/**< Size in bytes */
+	XZDma_JobHandler Handler;	/**< Completion callback, can be
+					  *  NULL */
+	void *CallBackRef;		/**< Passed to Handler */
+} XZDma_Job;
+
+struct XZDma_Queue;
+
+/**
+* This typedef contains the per channel state of the job queue.
+*/
+typedef struct {
+	XZDma *InstancePtr;		/**< Channel driver instance */
+	struct XZDma_Queue *QueuePtr;	/**< Queue of the channel */
+	XZDma_Job Jobs[2][XZDMA_QUEUE_MAX_BATCH];
+					/**< Jobs of the chain in flight and
+					  *  of the chain completing */
+	u32 Slot;			/**< Jobs[] row of the chain in
+					  *  flight */
+	XZDma_Transfer Xfer[XZDMA_QUEUE_MAX_BATCH];
+					/**< Chain passed to XZDma_Start */
+	u32 NumJobs;			/**< Jobs in flight, 0 when idle */
+	u32 MaxJobs;			/**< Chain length limit */
+} XZDma_QueueChan;
+
+/**
+* This typedef contains the job queue. JobsPtr is a ring of pending jobs,
+* Head and Tail are free running indexes.
+*/
+typedef struct XZDma_Queue {
+	XZDma_QueueChan Chan[XZDMA_QUEUE_MAX_CHANNELS];
+	u32 NumChans;			/**< Channels added to the queue */
+	XZDma_Job *JobsPtr;		/**< Pending job storage */
+	u32 Size;			/**< Ring size, a power of two */
+	volatile u32 Head;		/**< Next job to be added */
+	volatile u32 Tail;		/**< Next job to be issued */
+	u32 DoneCnt;			/**< Completed jobs */
+	u32 ErrorCnt;			/**< Jobs completed with an error */
+} XZDma_Queue;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /*****************************************************************************/
@@ -692,6 +771,15 @@ void XZDma_ScatterGather(XZDma *InstancePtr, XZDma_Transfer *Data,
 								u32 Num);
 void XZDma_Enable(XZDma *InstancePtr);
 
+s32 XZDma_QueueInitialize(XZDma_Queue *QueuePtr, XZDma_Job *JobsPtr,
+			  u32 Size);
+s32 XZDma_QueueAddChannel(XZDma_Queue *QueuePtr, XZDma *InstancePtr);
+s32 XZDma_QueueEnqueue(XZDma_Queue *QueuePtr, UINTPTR SrcAddr,
+		       UINTPTR DstAddr, u32 Size, XZDma_JobHandler Handler,
+		       void *CallBackRef);
+u32 XZDma_QueuePoll(XZDma_Queue *QueuePtr);
+u32 XZDma_QueuePending(XZDma_Queue *QueuePtr);
+
 /*@}*/
 
 #ifdef __cplusplus
@@ -21,6 +21,9 @@
 * 1.0   vns     2/27/15  First release
 * 1.6   aru     08/18/18 Resolved MISRA-C mandatory violations.(CR#1007757)
 * 1.8   aru    07/02/19  Fix coverity warnings.
+* 1.15  ag     10/14/26  Clear the pending interrupts before calling the
+*                        callbacks, so that a transfer started from the done
+*                        callback cannot have its done interrupt cleared.
 * </pre>
 *
 ******************************************************************************/
@@ -79,6 +82,9 @@ void XZDma_IntrHandler(void *Instance)
 	PendingIntr = (u32)(XZDma_IntrGetStatus(InstancePtr));
 	PendingIntr &= (~XZDma_GetIntrMask(InstancePtr));
 
+	/* Clear pending interrupt(s) */
+	XZDma_IntrClear(InstancePtr, PendingIntr);
+
 	/* ZDMA transfer has completed */
 	ErrorStatus = (PendingIntr) & (XZDMA_IXR_DMA_DONE_MASK);
 	if ((ErrorStatus) != 0U) {
@@ -104,9 +110,6 @@ void XZDma_IntrHandler(void *Instance)
 		}
 		InstancePtr->ErrorHandler(InstancePtr->ErrorRef, ErrorStatus);
 	}
-
-	/* Clear pending interrupt(s) */
-	XZDma_IntrClear(InstancePtr, PendingIntr);
 }
 
 /*****************************************************************************/
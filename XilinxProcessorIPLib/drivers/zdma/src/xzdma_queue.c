@@ -0,0 +1,437 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xzdma_queue.c
+* @addtogroup zdma_v1_14
+* @{
+*
+* This file contains the job queue of the ZDMA driver. Jobs are kept in a
+* ring supplied by the user and are issued to the idle channels of the queue
+* as descriptor chains built by XZDma_Start(). Please see xzdma.h for more
+* details of the driver.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- ------------------------------------------------------
+* 1.15  ag     10/14/26  First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <string.h>
+#include "xzdma.h"
+
+/************************** Constant Definitions *****************************/
+
+/**
+ * Errors after which the channel stops and the chain in flight is failed
+ */
+#define XZDMA_QUEUE_ERR_MASK	(XZDMA_IXR_AXI_WR_DATA_MASK | \
+				 XZDMA_IXR_AXI_RD_DATA_MASK | \
+				 XZDMA_IXR_AXI_RD_DST_DSCR_MASK | \
+				 XZDMA_IXR_AXI_RD_SRC_DSCR_MASK)
+
+/**************************** Type Definitions *******************************/
+
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+
+/************************** Function Prototypes ******************************/
+
+static void XZDma_QueueIssue(XZDma_QueueChan *ChanPtr);
+static void XZDma_QueueComplete(XZDma_QueueChan *ChanPtr, s32 Status);
+static void XZDma_QueueDoneHandler(void *CallBackRef);
+static void XZDma_QueueErrorHandler(void *CallBackRef, u32 Mask);
+
+/************************** Variable Definitions *****************************/
+
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function initializes a job queue without any channel.
+*
+* @param	QueuePtr is a pointer to the job queue.
+* @param	JobsPtr is a pointer to the storage of the pending jobs.
+* @param	Size is the number of jobs JobsPtr can hold, it must be a
+*		power of two.
+*
+* @return
+*		- XST_SUCCESS if the queue is initialized.
+*		- XST_INVALID_PARAM if Size is not a power of two.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XZDma_QueueInitialize(XZDma_Queue *QueuePtr, XZDma_Job *JobsPtr,
+			  u32 Size)
+{
+	/* Verify arguments */
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(JobsPtr != NULL);
+
+	if ((Size == 0U) || ((Size & (Size - 1U)) != 0U)) {
+		return XST_INVALID_PARAM;
+	}
+
+	(void)memset(QueuePtr, 0, sizeof(XZDma_Queue));
+	QueuePtr->JobsPtr = JobsPtr;
+	QueuePtr->Size = Size;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function adds a ZDMA channel to a job queue. The done and error
+* callbacks of the channel are taken over by the queue.
+*
+* @param	QueuePtr is a pointer to the job queue.
+* @param	InstancePtr is a pointer to the XZDma instance of the channel.
+*		It must be in scatter gather normal mode, set by
+*		XZDma_SetMode(), with descriptor memory given by
+*		XZDma_CreateBDList().
+*
+* @return
+*		- XST_SUCCESS if the channel is added.
+*		- XST_FAILURE if the queue has XZDMA_QUEUE_MAX_CHANNELS
+*		  channels, or the channel is not in scatter gather mode, or
+*		  is busy.
+*
+* @note		To take completions from interrupts, connect
+*		XZDma_IntrHandler of the channel to the interrupt system.
+*		Otherwise call XZDma_QueuePoll().
+*
+******************************************************************************/
+s32 XZDma_QueueAddChannel(XZDma_Queue *QueuePtr, XZDma *InstancePtr)
+{
+	XZDma_QueueChan *ChanPtr;
+	u32 MaxJobs;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == (u32)(XIL_COMPONENT_IS_READY));
+
+	if ((QueuePtr->NumChans >= XZDMA_QUEUE_MAX_CHANNELS) ||
+	    (InstancePtr->IsSgDma != TRUE) ||
+	    (InstancePtr->Descriptor.DscrCount == 0U) ||
+	    (InstancePtr->ChannelState != XZDMA_IDLE)) {
+		return XST_FAILURE;
+	}
+
+	MaxJobs = InstancePtr->Descriptor.DscrCount;
+	if (MaxJobs > XZDMA_QUEUE_MAX_BATCH) {
+		MaxJobs = XZDMA_QUEUE_MAX_BATCH;
+	}
+
+	ChanPtr = &QueuePtr->Chan[QueuePtr->NumChans];
+	ChanPtr->InstancePtr = InstancePtr;
+	ChanPtr->QueuePtr = QueuePtr;
+	ChanPtr->NumJobs = 0U;
+	ChanPtr->MaxJobs = MaxJobs;
+
+	(void)XZDma_SetCallBack(InstancePtr, XZDMA_HANDLER_DONE,
+			(void *)XZDma_QueueDoneHandler, (void *)ChanPtr);
+	(void)XZDma_SetCallBack(InstancePtr, XZDMA_HANDLER_ERROR,
+			(void *)XZDma_QueueErrorHandler, (void *)ChanPtr);
+	XZDma_EnableIntr(InstancePtr, (XZDMA_IXR_DMA_DONE_MASK |
+				       XZDMA_QUEUE_ERR_MASK));
+
+	QueuePtr->NumChans++;
+
+	/* Start on jobs added before the channel */
+	XZDma_QueueIssue(ChanPtr);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function adds a copy job to the queue and issues the pending jobs to
+* the idle channels. It returns without waiting for the copy.
+*
+* @param	QueuePtr is a pointer to the job queue.
+* @param	SrcAddr is the source address.
+* @param	DstAddr is the destination address.
+* @param	Size is the number of bytes to copy.
+* @param	Handler is called when the copy completes, it can be NULL.
+* @param	CallBackRef is passed to Handler.
+*
+* @return
+*		- XST_SUCCESS if the job is queued.
+*		- XST_INVALID_PARAM if Size is 0 or larger than the descriptor
+*		  size field.
+*		- XST_FAILURE if the queue is full.
+*
+* @note		Cache maintenance of the source and destination buffers is
+*		left to the caller. This function must not be preempted by
+*		the interrupt handler of a channel of the queue, it is the
+*		caller's responsibility to provide a mutual exclusion
+*		mechanism, for example by disabling interrupts.
+*
+******************************************************************************/
+s32 XZDma_QueueEnqueue(XZDma_Queue *QueuePtr, UINTPTR SrcAddr,
+		       UINTPTR DstAddr, u32 Size, XZDma_JobHandler Handler,
+		       void *CallBackRef)
+{
+	XZDma_Job *JobPtr;
+	u32 Index;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(SrcAddr != 0U);
+	Xil_AssertNonvoid(DstAddr != 0U);
+
+	if ((Size == 0U) || (Size > XZDMA_WORD2_SIZE_MASK)) {
+		return XST_INVALID_PARAM;
+	}
+
+	if ((QueuePtr->Head - QueuePtr->Tail) >= QueuePtr->Size) {
+		return XST_FAILURE;
+	}
+
+	JobPtr = &QueuePtr->JobsPtr[QueuePtr->Head & (QueuePtr->Size - 1U)];
+	JobPtr->SrcAddr = SrcAddr;
+	JobPtr->DstAddr = DstAddr;
+	JobPtr->Size = Size;
+	JobPtr->Handler = Handler;
+	JobPtr->CallBackRef = CallBackRef;
+	QueuePtr->Head++;
+
+	for (Index = 0U; Index < QueuePtr->NumChans; Index++) {
+		if (QueuePtr->Chan[Index].NumJobs == 0U) {
+			XZDma_QueueIssue(&QueuePtr->Chan[Index]);
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks the channels of the queue for completed chains when
+* the channel interrupts are not used. The callbacks of the completed jobs
+* are called and the next chains are issued.
+*
+* @param	QueuePtr is a pointer to the job queue.
+*
+* @return	The number of jobs completed by this call.
+*
+* @note		Do not use together with XZDma_IntrHandler on the same
+*		channels.
+*
+******************************************************************************/
+u32 XZDma_QueuePoll(XZDma_Queue *QueuePtr)
+{
+	XZDma_QueueChan *ChanPtr;
+	u32 Pending;
+	u32 Done = 0U;
+	u32 Index;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(QueuePtr != NULL);
+
+	for (Index = 0U; Index < QueuePtr->NumChans; Index++) {
+		ChanPtr = &QueuePtr->Chan[Index];
+		if (ChanPtr->NumJobs == 0U) {
+			continue;
+		}
+
+		Pending = XZDma_IntrGetStatus(ChanPtr->InstancePtr);
+		if ((Pending & XZDMA_QUEUE_ERR_MASK) != 0U) {
+			XZDma_IntrClear(ChanPtr->InstancePtr, Pending);
+			ChanPtr->InstancePtr->ChannelState = XZDMA_IDLE;
+			Done += ChanPtr->NumJobs;
+			XZDma_QueueComplete(ChanPtr, XST_FAILURE);
+		}
+		else if ((Pending & XZDMA_IXR_DMA_DONE_MASK) != 0U) {
+			XZDma_IntrClear(ChanPtr->InstancePtr, Pending);
+			ChanPtr->InstancePtr->ChannelState = XZDMA_IDLE;
+			Done += ChanPtr->NumJobs;
+			XZDma_QueueComplete(ChanPtr, XST_SUCCESS);
+		}
+		else {
+			/* Chain still in progress */
+		}
+	}
+
+	return Done;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the number of jobs not yet completed, queued or in
+* flight.
+*
+* @param	QueuePtr is a pointer to the job queue.
+*
+* @return	The number of jobs not yet completed.
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XZDma_QueuePending(XZDma_Queue *QueuePtr)
+{
+	u32 Count;
+	u32 Index;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(QueuePtr != NULL);
+
+	Count = QueuePtr->Head - QueuePtr->Tail;
+	for (Index = 0U; Index < QueuePtr->NumChans; Index++) {
+		Count += QueuePtr->Chan[Index].NumJobs;
+	}
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function moves up to MaxJobs pending jobs to an idle channel and
+* starts them as one descriptor chain.
+*
+* @param	ChanPtr is a pointer to the queue channel.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XZDma_QueueIssue(XZDma_QueueChan *ChanPtr)
+{
+	XZDma_Queue *QueuePtr = ChanPtr->QueuePtr;
+	XZDma_Job *JobPtr;
+	u32 Count;
+	u32 Index;
+
+	Count = QueuePtr->Head - QueuePtr->Tail;
+	if ((Count == 0U) || (ChanPtr->NumJobs != 0U)) {
+		return;
+	}
+	if (Count > ChanPtr->MaxJobs) {
+		Count = ChanPtr->MaxJobs;
+	}
+
+	for (Index = 0U; Index < Count; Index++) {
+		JobPtr = &QueuePtr->JobsPtr[(QueuePtr->Tail + Index) &
+					    (QueuePtr->Size - 1U)];
+		ChanPtr->Jobs[ChanPtr->Slot][Index] = *JobPtr;
+		ChanPtr->Xfer[Index].SrcAddr = JobPtr->SrcAddr;
+		ChanPtr->Xfer[Index].DstAddr = JobPtr->DstAddr;
+		ChanPtr->Xfer[Index].Size = JobPtr->Size;
+		ChanPtr->Xfer[Index].SrcCoherent =
+			ChanPtr->InstancePtr->Config.IsCacheCoherent;
+		ChanPtr->Xfer[Index].DstCoherent =
+			ChanPtr->InstancePtr->Config.IsCacheCoherent;
+		ChanPtr->Xfer[Index].Pause = FALSE;
+	}
+	QueuePtr->Tail += Count;
+	ChanPtr->NumJobs = Count;
+
+	(void)XZDma_Start(ChanPtr->InstancePtr, ChanPtr->Xfer, Count);
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function calls the callbacks of the jobs of the chain in
+* flight on a channel and issues the next chain.
+*
+* @param	ChanPtr is a pointer to the queue channel.
+* @param	Status is passed to the job callbacks.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XZDma_QueueComplete(XZDma_QueueChan *ChanPtr, s32 Status)
+{
+	XZDma_Queue *QueuePtr = ChanPtr->QueuePtr;
+	XZDma_Job *JobPtr = ChanPtr->Jobs[ChanPtr->Slot];
+	u32 Count = ChanPtr->NumJobs;
+	u32 Index;
+
+	QueuePtr->DoneCnt += Count;
+	if (Status != (s32)XST_SUCCESS) {
+		QueuePtr->ErrorCnt += Count;
+	}
+
+	/*
+	 * Start the next chain before the callbacks run, so that the channel
+	 * stays busy. It uses the other row of Jobs[] and does not overwrite
+	 * the jobs being completed.
+	 */
+	ChanPtr->NumJobs = 0U;
+	ChanPtr->Slot ^= 1U;
+	XZDma_QueueIssue(ChanPtr);
+
+	for (Index = 0U; Index < Count; Index++) {
+		if (JobPtr[Index].Handler != NULL) {
+			JobPtr[Index].Handler(JobPtr[Index].CallBackRef, Status);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function is the done callback of the channels of a queue.
+*
+* @param	CallBackRef is a pointer to the queue channel.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XZDma_QueueDoneHandler(void *CallBackRef)
+{
+	XZDma_QueueChan *ChanPtr = (XZDma_QueueChan *)CallBackRef;
+
+	if (ChanPtr->NumJobs != 0U) {
+		XZDma_QueueComplete(ChanPtr, XST_SUCCESS);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function is the error callback of the channels of a queue.
+*
+* @param	CallBackRef is a pointer to the queue channel.
+* @param	Mask is the error interrupt status.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XZDma_QueueErrorHandler(void *CallBackRef, u32 Mask)
+{
+	XZDma_QueueChan *ChanPtr = (XZDma_QueueChan *)CallBackRef;
+
+	if (((Mask & XZDMA_QUEUE_ERR_MASK) != 0U) && (ChanPtr->NumJobs != 0U)) {
+		XZDma_QueueComplete(ChanPtr, XST_FAILURE);
+	}
+}
+/** @} */
@@ -77,6 +77,14 @@
 #       	      functionality from PMU counters for CortexR5 BSP.
 #       bm   07/06/22 Added logic to include files from versal_net directory
 #       adk  09/08/22 When xiltimer is enabled don't pull xpm_counter.c file.
+# 8.1   ag   10/14/26 Added bulk_mem_dma config parameter to offload bulk
+#       	      memory operations to ZDMA.
+# 8.1   ag   10/14/26 Added xil_trace config parameter to enable hot-path
+#       	      event tracing.
+# 8.1   ag   10/14/26 Added xil_printf_binlog config parameter to select the
+#       	      deferred binary logging backend.
+# 8.1   ag   10/15/26 Added perf_stats config parameter to enable driver
+#       	      performance counters.
 ##############################################################################
 
 # ----------------------------------------------------------------------------
@@ -914,6 +922,30 @@ proc generate {os_handle} {
 	 puts $file_handle " "
 	 puts $file_handle "/* Definition for xilinx interrupt wrapper support  */"
          puts $file_handle "#define XIL_INTERRUPT"
+     }
+     set bulk_mem_dma_supported [common::get_property CONFIG.bulk_mem_dma $os_handle ]
+     if {$bulk_mem_dma_supported == true} {
+	 puts $file_handle " "
+	 puts $file_handle "/* Definition for ZDMA offload of bulk memory operations */"
+         puts $file_handle "#define XIL_BULK_MEM_DMA"
+     }
+     set xil_trace_supported [common::get_property CONFIG.xil_trace $os_handle ]
+     if {$xil_trace_supported == true} {
+	 puts $file_handle " "
+	 puts $file_handle "/* Definition for hot-path event tracing */"
+         puts $file_handle "#define XIL_TRACE_ENABLE"
+     }
+     set xil_binlog_supported [common::get_property CONFIG.xil_printf_binlog $os_handle ]
+     if {$xil_binlog_supported == true} {
+	 puts $file_handle " "
+	 puts $file_handle "/* Definition for deferred binary logging backend */"
+         puts $file_handle "#define XIL_BINLOG_ENABLE"
+     }
+     set perf_stats_supported [common::get_property CONFIG.perf_stats $os_handle ]
+     if {$perf_stats_supported == true} {
+	 puts $file_handle " "
+	 puts $file_handle "/* Definition for driver performance counters */"
+         puts $file_handle "#define XIL_PERF_STATS_ENABLE"
      }
 	 puts $file_handle " "
 	 puts $file_handle "/* Definitions for sleep timer configuration */"
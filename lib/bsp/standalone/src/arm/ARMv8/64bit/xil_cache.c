@@ -61,6 +61,10 @@
 *                    macro. Xil_DCacheFlushRange macro points to the
 *                    Xil_DCacheInvalidateRange API to avoid code duplication.
 * 8.0 mus  02/24/22  Added support for CortexA78 processor in VERSAL NET SoC
+* 8.1 ag   10/14/26  Added Xil_DCacheInvalidateRanges API to maintain a list
+*                    of address ranges with a single barrier, falling back
+*                    to set/way maintenance of the whole cache above
+*                    XIL_DCACHE_SETWAY_THRESHOLD bytes.
 *
 * </pre>
 *
@@ -567,6 +571,74 @@ void Xil_DCacheInvalidateRange(INTPTR  adr, INTPTR len)
 	mtcpsr(currmask);
 }
 
+/****************************************************************************/
+/**
+* @brief	Invalidate the Data cache for a list of address ranges.
+*			The cachelines present in the address ranges are cleaned and
+*			invalidated, with a single barrier after the last range. When
+*			the total length of the ranges is XIL_DCACHE_SETWAY_THRESHOLD
+*			bytes or more, the whole Data cache is flushed by set/way
+*			instead, which is cheaper than walking the ranges line by line.
+*
+* @param	Ranges: Pointer to the list of address ranges.
+* @param	NumRanges: Number of entries in the list.
+*
+* @return	None.
+*
+* @note		Set/way maintenance only operates on the caches of the
+*			executing cluster. Set XIL_DCACHE_SETWAY_THRESHOLD to a value
+*			larger than any batch when the ranges may be cached by other
+*			masters and need maintenance by address.
+*
+****************************************************************************/
+void Xil_DCacheInvalidateRanges(const Xil_CacheRange *Ranges, u32 NumRanges)
+{
+#if !defined (VERSAL_NET)
+	const INTPTR cacheline = 64U;
+	INTPTR adr;
+	INTPTR end;
+	u32 currmask;
+#endif
+	INTPTR Total = 0;
+	u32 Index;
+
+	for (Index = 0U; Index < NumRanges; Index++) {
+		Total += Ranges[Index].Len;
+	}
+
+	if (Total >= (INTPTR)XIL_DCACHE_SETWAY_THRESHOLD) {
+		Xil_DCacheFlush();
+		return;
+	}
+
+#if defined (VERSAL_NET)
+	/*
+	 * Consecutive CIVAC instructions need the NOP workaround implemented
+	 * in Xil_DCacheInvalidateRange, maintain the ranges through it.
+	 */
+	for (Index = 0U; Index < NumRanges; Index++) {
+		Xil_DCacheInvalidateRange(Ranges[Index].Addr, Ranges[Index].Len);
+	}
+#else
+	currmask = mfcpsr();
+	mtcpsr(currmask | IRQ_FIQ_MASK);
+	for (Index = 0U; Index < NumRanges; Index++) {
+		if (Ranges[Index].Len == 0) {
+			continue;
+		}
+		adr = Ranges[Index].Addr & (~0x3F);
+		end = Ranges[Index].Addr + Ranges[Index].Len;
+		while (adr < end) {
+			mtcpdc(CIVAC,adr);
+			adr += cacheline;
+		}
+	}
+	/* Wait for invalidate of all the ranges to complete */
+	dsb();
+	mtcpsr(currmask);
+#endif
+}
+
 /****************************************************************************/
 /**
 * @brief	Flush the Data cache.
@@ -23,6 +23,8 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- -----------------------------------------------
 * 5.00 	pkp  05/29/14 First release
+* 8.1   ag   10/14/26 Added Xil_DCacheInvalidateRanges and
+*                     Xil_DCacheFlushRanges APIs
 * </pre>
 *
 ******************************************************************************/
@@ -47,14 +49,34 @@ extern "C" {
  *@endcond
  */
 
+/**
+ * Total length of a Xil_DCacheInvalidateRanges/Xil_DCacheFlushRanges batch
+ * from which the whole Data cache is flushed by set/way. It can be
+ * overridden through compiler flags.
+ */
+#ifndef XIL_DCACHE_SETWAY_THRESHOLD
+#define XIL_DCACHE_SETWAY_THRESHOLD	0x200000U
+#endif
+
+/**************************** Type Definitions *******************************/
+/**
+ * Address range for Xil_DCacheInvalidateRanges/Xil_DCacheFlushRanges
+ */
+typedef struct {
+	INTPTR Addr;	/**< Start address of the range */
+	INTPTR Len;	/**< Length of the range in bytes */
+} Xil_CacheRange;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 #define Xil_DCacheFlushRange Xil_DCacheInvalidateRange
+#define Xil_DCacheFlushRanges Xil_DCacheInvalidateRanges
 
 /************************** Function Prototypes ******************************/
 void Xil_DCacheEnable(void);
 void Xil_DCacheDisable(void);
 void Xil_DCacheInvalidate(void);
 void Xil_DCacheInvalidateRange(INTPTR adr, INTPTR len);
+void Xil_DCacheInvalidateRanges(const Xil_CacheRange *Ranges, u32 NumRanges);
 void Xil_DCacheInvalidateLine(INTPTR adr);
 void Xil_DCacheFlush(void);
 void Xil_DCacheFlushLine(INTPTR adr);
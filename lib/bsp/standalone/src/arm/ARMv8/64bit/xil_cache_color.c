@@ -0,0 +1,199 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_cache_color.c
+*
+* This file contains the L2 cache coloring page pools. Refer xil_cache_color.h
+* for the description.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 8.1   ag   10/15/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xil_cache_color.h"
+#include "xpseudo_asm.h"
+#include "xreg_cortexa53.h"
+#include "xstatus.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XIL_CACHE_COLOR_L2_SELECT	0x2U	/* CSSELR value of the L2 cache */
+#define XIL_CACHE_COLOR_MAX		32U	/* Colors a color mask can hold */
+
+/************************** Variable Definitions *****************************/
+
+static u32 NumColors;
+
+/****************************************************************************/
+/**
+* @brief	This function returns the number of colors of the L2 cache,
+*		the size of a way divided by the page size.
+*
+* @return	Number of colors, at most 32.
+*
+****************************************************************************/
+u32 Xil_CacheColorNum(void)
+{
+	u64 CsidReg;
+	u32 LineSize;
+	u32 NumSet;
+
+	if (NumColors == 0U) {
+		mtcp(CSSELR_EL1, XIL_CACHE_COLOR_L2_SELECT);
+		isb();
+		CsidReg = mfcp(CCSIDR_EL1);
+
+		LineSize = 1U << (((u32)CsidReg & 0x00000007U) + 0x00000004U);
+		NumSet = (((u32)CsidReg >> 13U) & 0x00007FFFU) + 0x00000001U;
+
+		NumColors = (LineSize * NumSet) / XIL_CACHE_COLOR_PAGE;
+		if (NumColors == 0U) {
+			NumColors = 1U;
+		} else if (NumColors > XIL_CACHE_COLOR_MAX) {
+			NumColors = XIL_CACHE_COLOR_MAX;
+		} else {
+			/* The number of colors is usable as it is */
+		}
+	}
+
+	return NumColors;
+}
+
+/****************************************************************************/
+/**
+* @brief	This function returns the color of an address.
+*
+* @param	Addr: Physical address.
+*
+* @return	Color of the page of the address.
+*
+****************************************************************************/
+u32 Xil_CacheColorOf(UINTPTR Addr)
+{
+	return (u32)((Addr / XIL_CACHE_COLOR_PAGE) % Xil_CacheColorNum());
+}
+
+/****************************************************************************/
+/**
+* @brief	This function initializes a pool with the pages of a region
+*		whose colors are in a color mask.
+*
+* @param	PoolPtr: Pointer to the pool.
+* @param	Base: Start of the region, page aligned.
+* @param	Size: Size of the region, multiple of the page size.
+* @param	ColorMask: Colors of the pool, bit n for color n.
+*
+* @return
+*		- XST_SUCCESS if the pool is initialized.
+*		- XST_INVALID_PARAM if the region is not page aligned or has
+*		  no page of the colors.
+*
+* @note		The region must be cacheable memory not used otherwise. Pages
+*		of the region with other colors are not used by the pool, they
+*		can be given to another pool.
+*
+****************************************************************************/
+s32 Xil_CacheColorPoolInit(Xil_CacheColorPool *PoolPtr, UINTPTR Base,
+			   u64 Size, u32 ColorMask)
+{
+	UINTPTR Page;
+	UINTPTR Last = 0U;
+
+	if ((PoolPtr == NULL) || (Size == 0U) ||
+	    ((Base & (XIL_CACHE_COLOR_PAGE - 1U)) != 0U) ||
+	    ((Size & (XIL_CACHE_COLOR_PAGE - 1U)) != 0U)) {
+		return (s32)XST_INVALID_PARAM;
+	}
+
+	PoolPtr->Base = Base;
+	PoolPtr->Size = Size;
+	PoolPtr->ColorMask = ColorMask;
+	PoolPtr->NumFree = 0U;
+	PoolPtr->FreeList = 0U;
+
+	/* Link the pages in address order */
+	for (Page = Base; Page < (Base + Size); Page += XIL_CACHE_COLOR_PAGE) {
+		if ((ColorMask & (1U << Xil_CacheColorOf(Page))) == 0U) {
+			continue;
+		}
+		*(UINTPTR *)Page = 0U;
+		if (Last == 0U) {
+			PoolPtr->FreeList = Page;
+		} else {
+			*(UINTPTR *)Last = Page;
+		}
+		Last = Page;
+		PoolPtr->NumFree++;
+	}
+
+	if (PoolPtr->NumFree == 0U) {
+		return (s32)XST_INVALID_PARAM;
+	}
+
+	return (s32)XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+* @brief	This function takes a page from a pool.
+*
+* @param	PoolPtr: Pointer to the pool.
+*
+* @return	Page aligned pointer to the page, NULL if the pool is empty.
+*
+****************************************************************************/
+void *Xil_CacheColorAlloc(Xil_CacheColorPool *PoolPtr)
+{
+	UINTPTR Page;
+
+	if ((PoolPtr == NULL) || (PoolPtr->FreeList == 0U)) {
+		return NULL;
+	}
+
+	Page = PoolPtr->FreeList;
+	PoolPtr->FreeList = *(UINTPTR *)Page;
+	PoolPtr->NumFree--;
+
+	return (void *)Page;
+}
+
+/****************************************************************************/
+/**
+* @brief	This function gives a page back to its pool.
+*
+* @param	PoolPtr: Pointer to the pool.
+* @param	Page: Page returned by Xil_CacheColorAlloc for the pool.
+*
+* @return	None.
+*
+****************************************************************************/
+void Xil_CacheColorFree(Xil_CacheColorPool *PoolPtr, void *Page)
+{
+	UINTPTR Addr = (UINTPTR)Page;
+
+	if ((PoolPtr == NULL) || (Addr < PoolPtr->Base) ||
+	    ((u64)(Addr - PoolPtr->Base) >= PoolPtr->Size) ||
+	    ((Addr & (XIL_CACHE_COLOR_PAGE - 1U)) != 0U)) {
+		return;
+	}
+
+	*(UINTPTR *)Addr = PoolPtr->FreeList;
+	PoolPtr->FreeList = Addr;
+	PoolPtr->NumFree++;
+}
+/**
+* @} End of "addtogroup a53_64_cache_color_apis".
+*/
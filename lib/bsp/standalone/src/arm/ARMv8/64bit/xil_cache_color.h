@@ -0,0 +1,84 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_cache_color.h
+*
+* @addtogroup a53_64_cache_color_apis Cortex A53 64bit Processor Cache Coloring
+*
+* The cache coloring functions partition the L2 cache between software
+* components by the memory pages they use. The L2 set of an address is
+* selected by address bits above the page offset, so the 4KB pages of a
+* memory region fall into XIL_CACHE_COLOR_PAGE sized colors, and pages of
+* different colors never evict each other from L2.
+*
+* A color pool hands out the pages of a region whose colors are in a color
+* mask. Latency critical code uses pages from a pool of colors reserved for
+* it, for example the data of interrupt handlers and control loops, while
+* bulk processing uses pages from a pool of the other colors. Bulk buffers
+* that the CPU does not access, such as DMA frame buffers, should be mapped
+* non-cacheable with Xil_MmuMapRegion so they do not use L2 at all.
+*
+* The MMU maps memory flat, so pages are used at their physical address and
+* the data of a component must fit in pages, or be split across them.
+*
+* @{
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 8.1   ag   10/15/26 First release
+* </pre>
+*
+******************************************************************************/
+
+#ifndef XIL_CACHE_COLOR_H
+#define XIL_CACHE_COLOR_H
+
+#include "xil_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/************************** Constant Definitions *****************************/
+
+#define XIL_CACHE_COLOR_PAGE	0x1000U	/**< Page size of the colors */
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * Pool of the pages of a memory region with colors in a color mask. Free
+ * pages are linked through their first word.
+ */
+typedef struct {
+	UINTPTR Base;		/**< Start of the region */
+	u64 Size;		/**< Size of the region */
+	u32 ColorMask;		/**< Colors of the pool, bit n for color n */
+	u32 NumFree;		/**< Number of free pages */
+	UINTPTR FreeList;	/**< First free page, 0 if none */
+} Xil_CacheColorPool;
+
+/************************** Function Prototypes ******************************/
+
+u32 Xil_CacheColorNum(void);
+u32 Xil_CacheColorOf(UINTPTR Addr);
+s32 Xil_CacheColorPoolInit(Xil_CacheColorPool *PoolPtr, UINTPTR Base,
+			   u64 Size, u32 ColorMask);
+void *Xil_CacheColorAlloc(Xil_CacheColorPool *PoolPtr);
+void Xil_CacheColorFree(Xil_CacheColorPool *PoolPtr, void *Page);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/**
+* @} End of "addtogroup a53_64_cache_color_apis".
+*/
@@ -19,6 +19,7 @@
 * ----- ---- -------- ---------------------------------------------------
 * 5.00 	pkp  05/29/14 First release
 * 6.02  pkp	 01/22/17 Added support for EL1 non-secure
+* 8.1   ag   10/14/26 Added Xil_MmuMapRegion and Xil_MmuMapRegions
 * </pre>
 *
 * @note
@@ -33,6 +34,7 @@
 #include "xpseudo_asm.h"
 #include "xil_types.h"
 #include "xil_mmu.h"
+#include "xstatus.h"
 #include "bspconfig.h"
 /***************** Macros (Inline Functions) Definitions *********************/
 
@@ -44,12 +46,24 @@
 #define BLOCK_SIZE_1GB 0x40000000U
 #define ADDRESS_LIMIT_4GB 0x100000000UL
 
+#define MMU_ENTRIES_PER_TABLE	512U
+#define MMU_DESC_TYPE_MASK	0x3UL
+#define MMU_DESC_BLOCK		0x1UL
+#define MMU_DESC_TABLE		0x3UL
+#define MMU_DESC_ADDR_MASK	0x0000FFFFFFFFF000UL
+
 /************************** Variable Definitions *****************************/
 
 extern INTPTR MMUTableL1;
 extern INTPTR MMUTableL2;
 
 /************************** Function Prototypes ******************************/
+
+static s32 Xil_MmuCheckRegion(UINTPTR Addr, u64 Size);
+static void Xil_MmuUpdateRegion(UINTPTR Addr, u64 Size, u64 Attrib);
+static void Xil_MmuReplaceL1(INTPTR *Entry, u64 Desc);
+static void Xil_MmuTlbInvalidate(void);
+
 /*****************************************************************************/
 /**
 * @brief	It sets the memory attributes for a section, in the translation
@@ -101,3 +115,210 @@ void Xil_SetTlbAttributes(UINTPTR Addr, u64 attrib)
     isb(); /* synchronize context on this processor */
 
 }
+
+/*****************************************************************************/
+/**
+* @brief	It maps a region with the given memory attributes, using 1GB
+*			block descriptors for every 1GB aligned gigabyte covered by the
+*			region and 2MB block descriptors for the rest. Addresses are
+*			mapped flat, as in the default translation table.
+*
+* @param	Addr: 64-bit start address of the region, 2MB aligned, or 1GB
+*			aligned if the address is greater than 4GB.
+* @param	Size: size of the region in bytes, multiple of 2MB, or multiple
+*			of 1GB for the part of the region above 4GB.
+* @param	Attrib: Attribute for the region, for example NORM_WB_CACHE,
+*			NORM_NONCACHE or DEVICE_MEMORY from xil_mmu.h.
+*
+* @return	XST_SUCCESS if the region is mapped, XST_INVALID_PARAM if the
+*			region is not aligned as described above.
+*
+* @note		The caches are flushed and the TLBs are invalidated once for
+*			the whole region. The region must not contain the code, stack
+*			or translation tables in use when the block size of a gigabyte
+*			below 4GB changes, as its mapping is invalid for a short time.
+*
+******************************************************************************/
+s32 Xil_MmuMapRegion(UINTPTR Addr, u64 Size, u64 Attrib)
+{
+	Xil_MmuRegion Region;
+
+	Region.Addr = Addr;
+	Region.Size = Size;
+	Region.Attrib = Attrib;
+
+	return Xil_MmuMapRegions(&Region, 1U);
+}
+
+/*****************************************************************************/
+/**
+* @brief	It maps a set of regions as Xil_MmuMapRegion does, with a single
+*			cache flush and TLB invalidation for all of them.
+*
+* @param	Regions: pointer to the array of regions.
+* @param	Count: number of regions in the array.
+*
+* @return	XST_SUCCESS if all regions are mapped, XST_INVALID_PARAM if a
+*			region is not aligned, in which case no region is mapped.
+*
+******************************************************************************/
+s32 Xil_MmuMapRegions(const Xil_MmuRegion *Regions, u32 Count)
+{
+	u32 Index;
+
+	if ((Regions == NULL) || (Count == 0U)) {
+		return (s32)XST_INVALID_PARAM;
+	}
+
+	for (Index = 0U; Index < Count; Index++) {
+		if (Xil_MmuCheckRegion(Regions[Index].Addr,
+				Regions[Index].Size) != (s32)XST_SUCCESS) {
+			return (s32)XST_INVALID_PARAM;
+		}
+	}
+
+	for (Index = 0U; Index < Count; Index++) {
+		Xil_MmuUpdateRegion(Regions[Index].Addr, Regions[Index].Size,
+				Regions[Index].Attrib);
+	}
+
+	Xil_DCacheFlush();
+	Xil_MmuTlbInvalidate();
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* @brief	It checks the alignment of a region to be mapped.
+*
+* @param	Addr: start address of the region.
+* @param	Size: size of the region in bytes.
+*
+* @return	XST_SUCCESS if the region can be mapped, XST_INVALID_PARAM
+*			otherwise.
+*
+******************************************************************************/
+static s32 Xil_MmuCheckRegion(UINTPTR Addr, u64 Size)
+{
+	u64 End = (u64)Addr + Size;
+
+	if ((Size == 0U) || (End < (u64)Addr) ||
+			(((u64)Addr & (BLOCK_SIZE_2MB - 1U)) != 0U) ||
+			((Size & (BLOCK_SIZE_2MB - 1U)) != 0U)) {
+		return (s32)XST_INVALID_PARAM;
+	}
+
+	/* Only 1GB blocks are available above 4GB */
+	if ((End > ADDRESS_LIMIT_4GB) &&
+			((((u64)Addr >= ADDRESS_LIMIT_4GB) &&
+			(((u64)Addr & (BLOCK_SIZE_1GB - 1U)) != 0U)) ||
+			((End & (BLOCK_SIZE_1GB - 1U)) != 0U))) {
+		return (s32)XST_INVALID_PARAM;
+	}
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* @brief	It writes the block descriptors of a region. A gigabyte below
+*			4GB mapped with a 1GB block gets its level 2 table back when a
+*			part of it is remapped with 2MB blocks.
+*
+* @param	Addr: start address of the region.
+* @param	Size: size of the region in bytes.
+* @param	Attrib: Attribute for the region.
+*
+* @return	None.
+*
+******************************************************************************/
+static void Xil_MmuUpdateRegion(UINTPTR Addr, u64 Size, u64 Attrib)
+{
+	INTPTR *L1Entry;
+	INTPTR *L2Table;
+	u64 Desc;
+	u64 Base;
+	u32 Index;
+
+	while (Size != 0U) {
+		L1Entry = &MMUTableL1 + ((u64)Addr / BLOCK_SIZE_1GB);
+
+		if ((((u64)Addr & (BLOCK_SIZE_1GB - 1U)) == 0U) &&
+				(Size >= BLOCK_SIZE_1GB)) {
+			Desc = (u64)Addr | Attrib;
+			if (((u64)Addr < ADDRESS_LIMIT_4GB) &&
+				(((u64)*L1Entry & MMU_DESC_TYPE_MASK) ==
+				MMU_DESC_TABLE)) {
+				Xil_MmuReplaceL1(L1Entry, Desc);
+			} else {
+				*L1Entry = (INTPTR)Desc;
+			}
+			Addr += BLOCK_SIZE_1GB;
+			Size -= BLOCK_SIZE_1GB;
+			continue;
+		}
+
+		/* 2MB blocks, the region is below 4GB as checked */
+		L2Table = &MMUTableL2 + (((u64)Addr / BLOCK_SIZE_1GB) *
+				MMU_ENTRIES_PER_TABLE);
+		Desc = (u64)*L1Entry;
+		if ((Desc & MMU_DESC_TYPE_MASK) == MMU_DESC_BLOCK) {
+			/* Split the 1GB block, keeping its attributes */
+			Base = Desc & MMU_DESC_ADDR_MASK;
+			Desc &= ~MMU_DESC_ADDR_MASK;
+			for (Index = 0U; Index < MMU_ENTRIES_PER_TABLE; Index++) {
+				L2Table[Index] = (INTPTR)((Base +
+					((u64)Index * BLOCK_SIZE_2MB)) | Desc);
+			}
+			dsb();
+			Xil_MmuReplaceL1(L1Entry,
+				(u64)(UINTPTR)L2Table | MMU_DESC_TABLE);
+		}
+
+		Index = (u32)(((u64)Addr & (BLOCK_SIZE_1GB - 1U)) /
+				BLOCK_SIZE_2MB);
+		L2Table[Index] = (INTPTR)((u64)Addr | Attrib);
+		Addr += BLOCK_SIZE_2MB;
+		Size -= BLOCK_SIZE_2MB;
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief	It replaces a level 1 descriptor with one of a different type,
+*			following the break-before-make sequence.
+*
+* @param	Entry: pointer to the level 1 descriptor.
+* @param	Desc: new descriptor.
+*
+* @return	None.
+*
+******************************************************************************/
+static void Xil_MmuReplaceL1(INTPTR *Entry, u64 Desc)
+{
+	*Entry = 0;
+	Xil_DCacheFlushRange((INTPTR)Entry, sizeof(INTPTR));
+	Xil_MmuTlbInvalidate();
+	*Entry = (INTPTR)Desc;
+}
+
+/*****************************************************************************/
+/**
+* @brief	It invalidates the TLBs of the current exception level.
+*
+* @return	None.
+*
+******************************************************************************/
+static void Xil_MmuTlbInvalidate(void)
+{
+	dsb();
+
+	if (EL3 == 1)
+		mtcptlbi(ALLE3);
+	else if (EL1_NONSECURE == 1)
+		mtcptlbi(VMALLE1);
+
+	dsb(); /* ensure completion of the BP and TLB invalidation */
+	isb(); /* synchronize context on this processor */
+}
@@ -20,6 +20,8 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- ---------------------------------------------------
 * 5.00 	pkp  05/29/14 First release
+* 8.1   ag   10/14/26 Added Xil_MmuMapRegion and Xil_MmuMapRegions to map
+*                     regions with 2MB or 1GB block descriptors at run time.
 * </pre>
 *
 * @note
@@ -43,6 +45,15 @@ extern "C" {
 
 /**************************** Type Definitions *******************************/
 
+/**
+ * Region to be mapped by Xil_MmuMapRegions.
+ */
+typedef struct {
+	UINTPTR Addr;	/**< Start address, 2MB aligned */
+	u64 Size;	/**< Size in bytes, multiple of 2MB */
+	u64 Attrib;	/**< Memory attributes, for example NORM_WB_CACHE */
+} Xil_MmuRegion;
+
 /************************** Constant Definitions *****************************/
 
 /**
@@ -83,6 +94,8 @@ extern "C" {
  */
 
 void Xil_SetTlbAttributes(UINTPTR Addr, u64 attrib);
+s32 Xil_MmuMapRegion(UINTPTR Addr, u64 Size, u64 Attrib);
+s32 Xil_MmuMapRegions(const Xil_MmuRegion *Regions, u32 Count);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,277 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+* @file xil_trace.c
+*
+* This file contains the hot-path event tracer. Refer xil_trace.h for the
+* description of the tracer.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- ---------------------------------------------------
+* 8.1   ag   10/14/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files ********************************/
+
+#include "xil_trace.h"
+
+#ifdef XIL_TRACE_ENABLE
+#include "xil_printf.h"
+#include "xpseudo_asm.h"
+#if defined (__GNUC__) && !defined (ARMA53_32) && !defined (XIL_TRACE_USE_XTIME)
+#include "xpm_counter.h"
+#define XIL_TRACE_USE_PMU
+#else
+#include "xtime_l.h"
+#endif
+
+/************************** Constant Definitions ****************************/
+
+#define XIL_TRACE_IRQ_FIQ_MASK	0xC0U	/* Mask IRQ and FIQ interrupts */
+#define XIL_TRACE_RING_MASK	(XIL_TRACE_RING_SIZE - 1U)
+
+#define XIL_TRACE_PMCR_E	0x1U		/* Enable all counters */
+#define XIL_TRACE_PMCR_C	0x4U		/* Reset cycle counter */
+#define XIL_TRACE_PMCNTEN_C	0x80000000U	/* Cycle counter enable */
+
+/**************************** Type Definitions ******************************/
+
+/**
+ * Per-core ring. Index is free running, the record written next is
+ * Records[Index & XIL_TRACE_RING_MASK].
+ */
+typedef struct {
+	Xil_TraceRecord Records[XIL_TRACE_RING_SIZE];
+	u32 Index;
+} Xil_TraceRing;
+
+/************************** Variable Definitions ****************************/
+
+static Xil_TraceRing TraceRings[XIL_TRACE_NUM_CPUS];
+
+/************************** Function Prototypes *****************************/
+
+static u32 Xil_TraceCpuId(void);
+static u32 Xil_TraceTimestamp(void);
+
+/*****************************************************************************/
+/**
+* @brief       This function enables the PMU cycle counter used for the
+*              timestamps and clears the ring of the calling core. It must be
+*              called on every core that records events.
+*
+* @return      None.
+*
+* @note        In AArch64 EL1 non-secure, the cycle counter must not be
+*              trapped by a higher exception level.
+*
+*****************************************************************************/
+void Xil_TraceInit(void)
+{
+#if defined (XIL_TRACE_USE_PMU)
+	u32 Reg;
+
+#if defined (__aarch64__)
+	Reg = (u32)mfcp(PMCR_EL0);
+	mtcp(PMCR_EL0, (u64)(Reg | XIL_TRACE_PMCR_E | XIL_TRACE_PMCR_C));
+	Reg = (u32)mfcp(PMCNTENSET_EL0);
+	mtcp(PMCNTENSET_EL0, (u64)(Reg | XIL_TRACE_PMCNTEN_C));
+#else
+	Reg = mfcp(XREG_CP15_PERF_MONITOR_CTRL);
+	mtcp(XREG_CP15_PERF_MONITOR_CTRL,
+		Reg | XIL_TRACE_PMCR_E | XIL_TRACE_PMCR_C);
+	Reg = mfcp(XREG_CP15_COUNT_ENABLE_SET);
+	mtcp(XREG_CP15_COUNT_ENABLE_SET, Reg | XIL_TRACE_PMCNTEN_C);
+#endif
+	isb();
+#endif
+
+	Xil_TraceReset(Xil_TraceCpuId());
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function records an event in the ring of the calling
+*              core, overwriting the oldest record when the ring is full.
+*              Use the XIL_TRACE macro instead of calling it directly so the
+*              call is removed when tracing is disabled.
+*
+* @param       EventId: event ID, see XIL_TRACE_EVT_*
+* @param       Arg0: first event argument
+* @param       Arg1: second event argument
+*
+* @return      None.
+*
+* @note        Safe to call from interrupt handlers.
+*
+*****************************************************************************/
+void Xil_TraceEvent(u32 EventId, u32 Arg0, u32 Arg1)
+{
+	Xil_TraceRing *Ring;
+	Xil_TraceRecord *Rec;
+	u32 Flags;
+
+	Flags = (u32)mfcpsr();
+	mtcpsr(Flags | XIL_TRACE_IRQ_FIQ_MASK);
+
+	Ring = &TraceRings[Xil_TraceCpuId()];
+	Rec = &Ring->Records[Ring->Index & XIL_TRACE_RING_MASK];
+	Rec->Timestamp = Xil_TraceTimestamp();
+	Rec->EventId = EventId;
+	Rec->Arg0 = Arg0;
+	Rec->Arg1 = Arg1;
+	Ring->Index++;
+
+	mtcpsr(Flags);
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function copies the records of a core, oldest first. The
+*              destination can be a reserved DDR region read out by a
+*              debugger or by another core.
+*
+* @param       Cpu: core index, less than XIL_TRACE_NUM_CPUS
+* @param       Dst: pointer to the destination records
+* @param       MaxRecords: capacity of Dst in records
+*
+* @return      Number of records copied.
+*
+* @note        Events recorded by the core while the copy is in progress can
+*              overwrite the oldest records being copied.
+*
+*****************************************************************************/
+u32 Xil_TraceDump(u32 Cpu, Xil_TraceRecord *Dst, u32 MaxRecords)
+{
+	const Xil_TraceRing *Ring;
+	u32 End;
+	u32 Count;
+	u32 Start;
+	u32 i;
+
+	if ((Cpu >= XIL_TRACE_NUM_CPUS) || (Dst == NULL)) {
+		return 0U;
+	}
+
+	Ring = &TraceRings[Cpu];
+	End = *(volatile const u32 *)&Ring->Index;
+	Count = (End > XIL_TRACE_RING_SIZE) ? XIL_TRACE_RING_SIZE : End;
+	if (Count > MaxRecords) {
+		Count = MaxRecords;
+	}
+
+	Start = End - Count;
+	for (i = 0U; i < Count; i++) {
+		Dst[i] = Ring->Records[(Start + i) & XIL_TRACE_RING_MASK];
+	}
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function prints the records of a core, oldest first,
+*              over the console as "timestamp event arg0 arg1" in hex.
+*
+* @param       Cpu: core index, less than XIL_TRACE_NUM_CPUS
+*
+* @return      None.
+*
+* @note        Printing is slow, stop generating events before calling it.
+*
+*****************************************************************************/
+void Xil_TracePrint(u32 Cpu)
+{
+	const Xil_TraceRing *Ring;
+	const Xil_TraceRecord *Rec;
+	u32 End;
+	u32 Index;
+
+	if (Cpu >= XIL_TRACE_NUM_CPUS) {
+		return;
+	}
+
+	Ring = &TraceRings[Cpu];
+	End = *(volatile const u32 *)&Ring->Index;
+	Index = (End > XIL_TRACE_RING_SIZE) ? (End - XIL_TRACE_RING_SIZE) : 0U;
+
+	xil_printf("trace cpu %d: %d records\r\n", (s32)Cpu,
+		(s32)(End - Index));
+	for (; Index != End; Index++) {
+		Rec = &Ring->Records[Index & XIL_TRACE_RING_MASK];
+		xil_printf("%08x %08x %08x %08x\r\n", Rec->Timestamp,
+			Rec->EventId, Rec->Arg0, Rec->Arg1);
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function discards all records of a core.
+*
+* @param       Cpu: core index, less than XIL_TRACE_NUM_CPUS
+*
+* @return      None.
+*
+*****************************************************************************/
+void Xil_TraceReset(u32 Cpu)
+{
+	if (Cpu < XIL_TRACE_NUM_CPUS) {
+		TraceRings[Cpu].Index = 0U;
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function returns the index of the executing core.
+*
+* @return      Core index, less than XIL_TRACE_NUM_CPUS.
+*
+*****************************************************************************/
+static u32 Xil_TraceCpuId(void)
+{
+#if (XIL_TRACE_NUM_CPUS > 1U)
+	u64 Mpidr = mfcp(MPIDR_EL1);
+	u32 CpuId;
+
+	/* Multi-threading cores report the core number in affinity level 1 */
+	if ((Mpidr & ((u64)1U << 24U)) != 0U) {
+		CpuId = (u32)(((Mpidr >> 16U) & 0xFFU) * 4U) +
+			(u32)((Mpidr >> 8U) & 0xFFU);
+	} else {
+		CpuId = (u32)(Mpidr & 0xFFU);
+	}
+
+	return CpuId % XIL_TRACE_NUM_CPUS;
+#else
+	return 0U;
+#endif
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function returns the timestamp of a new record.
+*
+* @return      PMU cycle count or low 32 bits of the global timer.
+*
+*****************************************************************************/
+static u32 Xil_TraceTimestamp(void)
+{
+#if defined (XIL_TRACE_USE_PMU)
+	return (u32)Xpm_ReadCycleCounterVal();
+#else
+	XTime Now;
+
+	XTime_GetTime(&Now);
+	return (u32)Now;
+#endif
+}
+#endif /* XIL_TRACE_ENABLE */
@@ -0,0 +1,134 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+* @file xil_trace.h
+*
+* @addtogroup arm_trace_apis ARM Processor Hot-path Trace APIs
+*
+* The xil_trace.h file contains a lightweight event tracer for hot paths
+* such as interrupt handlers. Every event is stored as a fixed 16 byte
+* record in a per-core ring buffer, the oldest records are overwritten once
+* the ring is full. Each record holds a timestamp, an event ID and two
+* arguments.
+*
+* The timestamp is the PMU cycle counter (enabled by Xil_TraceInit) for GCC
+* and armclang builds, and the low 32 bits of XTime_GetTime otherwise or
+* when XIL_TRACE_USE_XTIME is defined.
+*
+* The XIL_TRACE macro compiles to nothing unless the BSP is built with the
+* xil_trace parameter, which defines XIL_TRACE_ENABLE, so instrumentation
+* can stay in driver sources at no cost. Rings can be read back with
+* Xil_TraceDump, for example into a DDR region for offline analysis, or
+* printed over the console with Xil_TracePrint.
+*
+* @{
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- ---------------------------------------------------
+* 8.1   ag   10/14/26 First release
+*       ag   10/15/26 Add the FreeRTOS event IDs
+* </pre>
+*
+******************************************************************************/
+
+#ifndef XIL_TRACE_H /* prevent circular inclusions */
+#define XIL_TRACE_H /* by using protection macros */
+
+/***************************** Include Files ********************************/
+
+#include "xil_types.h"
+#include "xparameters.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/************************** Constant Definitions ****************************/
+
+/**
+ * Number of records per core, must be a power of two.
+ */
+#ifndef XIL_TRACE_RING_SIZE
+#define XIL_TRACE_RING_SIZE	1024U
+#endif
+
+/**
+ * Number of per-core rings.
+ */
+#ifndef XIL_TRACE_NUM_CPUS
+#if defined (__aarch64__) && defined (VERSAL_NET)
+#define XIL_TRACE_NUM_CPUS	16U
+#elif defined (__aarch64__)
+#define XIL_TRACE_NUM_CPUS	4U
+#else
+#define XIL_TRACE_NUM_CPUS	1U
+#endif
+#endif
+
+/** @name Event IDs
+ *
+ * The upper 16 bits of an event ID identify the source, the lower 16 bits
+ * the event. IDs from XIL_TRACE_EVT_USER onwards are free for applications.
+ * @{
+ */
+#define XIL_TRACE_EVT_SCUGIC_IRQ_ENTRY	0x00010001U /**< Arg0: interrupt ID */
+#define XIL_TRACE_EVT_SCUGIC_IRQ_EXIT	0x00010002U /**< Arg0: interrupt ID */
+#define XIL_TRACE_EVT_EMACPS_IRQ_ENTRY	0x00020001U /**< Arg0: base address,
+						  *  Arg1: interrupt status */
+#define XIL_TRACE_EVT_EMACPS_IRQ_EXIT	0x00020002U /**< Arg0: base address */
+#define XIL_TRACE_EVT_FREERTOS		0x00030000U /**< FreeRTOS kernel event,
+						  *  plus the event number */
+#define XIL_TRACE_EVT_FREERTOS_DATA	0x0003FFFFU /**< Data of the previous
+						  *  FreeRTOS event, Arg0: low
+						  *  32 bits, Arg1: high 32 bits */
+#define XIL_TRACE_EVT_USER		0x80000000U
+/* @} */
+
+/**************************** Type Definitions ******************************/
+
+/**
+ * Trace record, 16 bytes.
+ */
+typedef struct {
+	u32 Timestamp;		/**< Cycle counter or global timer value */
+	u32 EventId;		/**< Event ID */
+	u32 Arg0;		/**< First event argument */
+	u32 Arg1;		/**< Second event argument */
+} Xil_TraceRecord;
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+/**
+ * Records an event when tracing is enabled in the BSP.
+ */
+#ifdef XIL_TRACE_ENABLE
+#define XIL_TRACE(EventId, Arg0, Arg1)	\
+	Xil_TraceEvent((u32)(EventId), (u32)(Arg0), (u32)(Arg1))
+#else
+#define XIL_TRACE(EventId, Arg0, Arg1)
+#endif
+
+/************************** Function Prototypes *****************************/
+
+#ifdef XIL_TRACE_ENABLE
+void Xil_TraceInit(void);
+void Xil_TraceEvent(u32 EventId, u32 Arg0, u32 Arg1);
+u32 Xil_TraceDump(u32 Cpu, Xil_TraceRecord *Dst, u32 MaxRecords);
+void Xil_TracePrint(u32 Cpu);
+void Xil_TraceReset(u32 Cpu);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XIL_TRACE_H */
+/**
+* @} End of "addtogroup arm_trace_apis".
+*/
@@ -85,6 +85,9 @@
 *                     not needed for Zynq architecture.
 *                     Replace dsb with Xil_L2CacheSync as applicable as the latter
 *                     is more efficient while handling L2 cache maintenance.
+* 8.1   ag   10/15/26 Added Xil_L2CacheLockRange, Xil_L2CacheSetWayMask,
+*                     Xil_L2CacheUnlockAll and Xil_L2CacheGetLockedWays to
+*                     pin code and data in L2 cache ways.
 * </pre>
 *
 ******************************************************************************/
@@ -100,6 +103,7 @@
 #include "xl2cc.h"
 #include "xil_errata.h"
 #include "xil_exception.h"
+#include "xstatus.h"
 
 /************************** Function Prototypes ******************************/
 
@@ -112,6 +116,20 @@
 	extern s32  __undef_stack;
 #endif
 
+#ifndef USE_AMP
+#define L2_ALL_WAYS	0xFFU	/* Ways of the 8-way L2 cache */
+#define L2_CACHE_LINE	32U	/* L2 cache line size */
+
+/* Ways pinned by Xil_L2CacheLockRange */
+static u32 L2LockedWays;
+
+/* Ways each master allocates to, set by Xil_L2CacheSetWayMask */
+static u32 L2MasterWays[XPS_L2CC_CACHE_LCKDWN_MASTERS] = {
+	L2_ALL_WAYS, L2_ALL_WAYS, L2_ALL_WAYS, L2_ALL_WAYS,
+	L2_ALL_WAYS, L2_ALL_WAYS, L2_ALL_WAYS, L2_ALL_WAYS
+};
+#endif
+
 #ifndef USE_AMP
 /****************************************************************************
 *
@@ -1519,4 +1537,191 @@ void Xil_L2CacheStoreLine(u32 adr)
 	Xil_Out32(XPS_L2CC_BASEADDR + XPS_L2CC_CACHE_CLEAN_PA_OFFSET, adr);
 	Xil_L2CacheSync();
 }
+
+/****************************************************************************
+*
+* Write the data and instruction lockdown registers of a master.
+*
+* @param	Master: master number, from 0 to 7.
+* @param	Locked: ways the master does not allocate to.
+*
+* @return	None.
+*
+****************************************************************************/
+static void Xil_L2CacheWriteLockdown(u32 Master, u32 Locked)
+{
+	u32 Offset = Master * XPS_L2CC_CACHE_LCKDWN_STRIDE;
+
+	Xil_Out32(XPS_L2CC_BASEADDR + XPS_L2CC_CACHE_DLCKDWN_0_WAY_OFFSET +
+		  Offset, Locked & L2_ALL_WAYS);
+	Xil_Out32(XPS_L2CC_BASEADDR + XPS_L2CC_CACHE_ILCKDWN_0_WAY_OFFSET +
+		  Offset, Locked & L2_ALL_WAYS);
+}
+
+/****************************************************************************
+*
+* Write the lockdown registers of all masters from the pinned ways and the
+* ways of each master.
+*
+* @return	None.
+*
+****************************************************************************/
+static void Xil_L2CacheUpdateLockdown(void)
+{
+	u32 Master;
+
+	for (Master = 0U; Master < XPS_L2CC_CACHE_LCKDWN_MASTERS; Master++) {
+		Xil_L2CacheWriteLockdown(Master,
+			(~L2MasterWays[Master]) | L2LockedWays);
+	}
+	Xil_L2CacheSync();
+}
+
+/****************************************************************************/
+/**
+* @brief	Load a memory range into L2 cache ways and lock the ways, so the
+*			range stays in L2 cache whatever the other traffic is. The
+*			ways are locked for all masters, accesses to the range still
+*			hit in the locked ways.
+*
+* @param	adr: 32bit start address of the range.
+* @param	len: Length of the range in bytes, at most the size of the
+*			ways of WayMask.
+* @param	WayMask: Ways to load the range into, bit n for way n. The
+*			ways must not be locked already.
+*
+* @return
+*			- XST_SUCCESS if the range is loaded and the ways locked.
+*			- XST_INVALID_PARAM if WayMask is not valid or the range
+*			  does not fit in its ways.
+*
+* @note		The range is loaded with the lockdown registers of the master
+*			of the calling CPU, which is its CPU number. Other data that the
+*			CPU accesses while loading can be loaded into the ways as well.
+*			Lock ranges that are not written by DMA.
+*
+****************************************************************************/
+s32 Xil_L2CacheLockRange(u32 adr, u32 len, u32 WayMask)
+{
+	u32 currmask;
+	u32 WaySize;
+	u32 NumWays = 0U;
+	u32 Way;
+	u32 Master;
+	u32 CpuId;
+	u32 LocalAddr;
+	u32 end;
+
+	if ((WayMask == 0U) || ((WayMask & ~L2_ALL_WAYS) != 0U) ||
+	    ((WayMask & L2LockedWays) != 0U) || (len == 0U)) {
+		return (s32)XST_INVALID_PARAM;
+	}
+
+	WaySize = 0x2000U << ((Xil_In32(XPS_L2CC_BASEADDR +
+			XPS_L2CC_AUX_CNTRL_OFFSET) & XPS_L2CC_AUX_WAY_SIZE_MASK) >>
+			XPS_L2CC_AUX_WAY_SIZE_SHIFT);
+	for (Way = 0U; Way < 8U; Way++) {
+		if ((WayMask & (1U << Way)) != 0U) {
+			NumWays++;
+		}
+	}
+	if (len > (NumWays * WaySize)) {
+		return (s32)XST_INVALID_PARAM;
+	}
+
+#ifdef __GNUC__
+	CpuId = mfcp(XREG_CP15_MULTI_PROC_AFFINITY);
+#elif defined (__ICCARM__)
+	mfcp(XREG_CP15_MULTI_PROC_AFFINITY, CpuId);
+#else
+	{ volatile register u32 Reg __asm(XREG_CP15_MULTI_PROC_AFFINITY);
+	  CpuId = Reg; }
+#endif
+	CpuId &= 0x3U;
+
+	currmask = mfcpsr();
+	mtcpsr(currmask | IRQ_FIQ_MASK);
+
+	/* Evict the range from L1 and L2 so that reading it allocates */
+	Xil_DCacheFlushRange((INTPTR)adr, len);
+
+	/* Lock the target ways for every master but the calling CPU */
+	for (Master = 0U; Master < XPS_L2CC_CACHE_LCKDWN_MASTERS; Master++) {
+		Xil_L2CacheWriteLockdown(Master, (Master == CpuId) ? ~WayMask :
+			((~L2MasterWays[Master]) | L2LockedWays | WayMask));
+	}
+	Xil_L2CacheSync();
+
+	LocalAddr = adr & ~(L2_CACHE_LINE - 1U);
+	end = adr + len;
+	while (LocalAddr < end) {
+		(void)Xil_In32(LocalAddr);
+		LocalAddr += L2_CACHE_LINE;
+	}
+	dsb();
+
+	L2LockedWays |= WayMask;
+	Xil_L2CacheUpdateLockdown();
+
+	mtcpsr(currmask);
+
+	return (s32)XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+* @brief	Set the L2 cache ways a master allocates to, to partition the
+*			L2 cache between masters. Ways locked by Xil_L2CacheLockRange
+*			stay locked.
+*
+* @param	Master: Master number, from 0 to 7. The master of a CPU is
+*			its CPU number.
+* @param	WayMask: Ways the master allocates to, bit n for way n.
+*
+* @return
+*			- XST_SUCCESS if the ways are set.
+*			- XST_INVALID_PARAM if Master or WayMask is not valid.
+*
+* @note		A master whose ways are all locked does not allocate in the L2
+*			cache.
+*
+****************************************************************************/
+s32 Xil_L2CacheSetWayMask(u32 Master, u32 WayMask)
+{
+	if ((Master >= XPS_L2CC_CACHE_LCKDWN_MASTERS) ||
+	    ((WayMask & ~L2_ALL_WAYS) != 0U)) {
+		return (s32)XST_INVALID_PARAM;
+	}
+
+	L2MasterWays[Master] = WayMask;
+	Xil_L2CacheUpdateLockdown();
+
+	return (s32)XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+* @brief	Unlock the ways locked by Xil_L2CacheLockRange. The ways of the
+*			masters set by Xil_L2CacheSetWayMask are kept.
+*
+* @return	None.
+*
+****************************************************************************/
+void Xil_L2CacheUnlockAll(void)
+{
+	L2LockedWays = 0U;
+	Xil_L2CacheUpdateLockdown();
+}
+
+/****************************************************************************/
+/**
+* @brief	Get the ways locked by Xil_L2CacheLockRange.
+*
+* @return	Locked ways, bit n for way n.
+*
+****************************************************************************/
+u32 Xil_L2CacheGetLockedWays(void)
+{
+	return L2LockedWays;
+}
 #endif
@@ -21,6 +21,7 @@
 * ----- ---- -------- -----------------------------------------------
 * 1.00a ecm  01/24/10 First release
 * 6.8   aru  09/06/18 Removed compilation warnings for ARMCC toolchain.
+* 8.1   ag   10/15/26 Added L2 cache way lockdown APIs.
 * </pre>
 *
 ******************************************************************************/
@@ -64,6 +65,10 @@ void Xil_L2CacheFlush(void);
 void Xil_L2CacheFlushLine(u32 adr);
 void Xil_L2CacheFlushRange(u32 adr, u32 len);
 void Xil_L2CacheStoreLine(u32 adr);
+s32 Xil_L2CacheLockRange(u32 adr, u32 len, u32 WayMask);
+s32 Xil_L2CacheSetWayMask(u32 Master, u32 WayMask);
+void Xil_L2CacheUnlockAll(void);
+u32 Xil_L2CacheGetLockedWays(void);
 
 #ifdef __cplusplus
 }
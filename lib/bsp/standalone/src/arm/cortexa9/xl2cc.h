@@ -18,6 +18,7 @@
 * 1.00a sdm  02/01/10 Initial version
 * 3.10a srt 04/18/13 Implemented ARM Erratas. Please refer to file
 *		      'xil_errata.h' for errata description
+* 8.1   ag   10/15/26 Added lockdown by master register stride and way masks
 * </pre>
 *
 * @note
@@ -85,6 +86,9 @@ extern "C" {
 #define XPS_L2CC_CACHE_DLCKDWN_7_WAY_OFFSET	0x0938U		/* Cache Data Lockdown 7 by Way */
 #define XPS_L2CC_CACHE_ILCKDWN_7_WAY_OFFSET	0x093CU		/* Cache Instruction Lockdown 7 by Way */
 
+#define XPS_L2CC_CACHE_LCKDWN_STRIDE		0x0008U		/* Lockdown registers of the next master */
+#define XPS_L2CC_CACHE_LCKDWN_MASTERS		8U		/* Masters with lockdown registers */
+
 #define XPS_L2CC_CACHE_LCKDWN_LINE_ENABLE_OFFSET 0x0950U		/* Cache Lockdown Line Enable */
 #define XPS_L2CC_CACHE_UUNLOCK_ALL_WAY_OFFSET	0x0954U		/* Cache Unlock All Lines by Way */
 
@@ -114,6 +118,7 @@ extern "C" {
 #define XPS_L2CC_AUX_SBDLE_MASK		0x00000800U	/* Store buffer device limitation Enable */
 #define XPS_L2CC_AUX_HPSODRE_MASK	0x00000400U	/* High Priority for SO and Dev Reads Enable */
 #define XPS_L2CC_AUX_FLZE_MASK		0x00000001U	/* Full line of zero enable */
+#define XPS_L2CC_AUX_WAY_SIZE_SHIFT	17U		/* Way-size, 8KB << value */
 
 #define XPS_L2CC_AUX_REG_DEFAULT_MASK	0x72360000U	/* Enable all prefetching, */
                                                     /* Cache replacement policy, Parity enable, */
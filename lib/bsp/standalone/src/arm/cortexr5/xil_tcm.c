@@ -0,0 +1,258 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+* @file xil_tcm.c
+*
+* This file contains the loader of TCM code and the overlay manager. Refer
+* xil_tcm.h for the description and the linker script sections.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- ---------------------------------------------------
+* 8.1   ag   10/15/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files ********************************/
+
+#include "xil_tcm.h"
+#include "xil_printf.h"
+#include "xstatus.h"
+#include "xpseudo_asm.h"
+
+/************************** Constant Definitions ****************************/
+
+#define XIL_TCM_BTCM_OFFSET	0x20000U	/* BTCM address in the R5 view */
+
+/**************************** Type Definitions ******************************/
+
+/**
+ * Overlay resident in a TCM range.
+ */
+typedef struct {
+	UINTPTR RunAddr;
+	Xil_TcmOverlay *OverlayPtr;
+} Xil_TcmResident;
+
+/************************** Variable Definitions ****************************/
+
+/*
+ * Defined by the linker script. They are weak so that applications whose
+ * linker script has no .tcm_text section still link.
+ */
+extern u8 __tcm_text_start[] __attribute__((weak));
+extern u8 __tcm_text_end[] __attribute__((weak));
+extern u8 __tcm_text_load[] __attribute__((weak));
+
+static Xil_TcmResident Resident[XIL_TCM_OVERLAY_RANGES];
+
+/************************** Function Prototypes *****************************/
+
+static void Xil_TcmCopy(UINTPTR Dst, UINTPTR Src, u32 Len);
+static const char *Xil_TcmName(UINTPTR Addr);
+
+/*****************************************************************************/
+/**
+* @brief       This function copies the TCM text from its load address to
+*              TCM. It is called by the boot code before main.
+*
+* @return      None.
+*
+*****************************************************************************/
+void Xil_TcmInit(void)
+{
+	UINTPTR Start = (UINTPTR)__tcm_text_start;
+	UINTPTR End = (UINTPTR)__tcm_text_end;
+	UINTPTR Load = (UINTPTR)__tcm_text_load;
+	u32 Index;
+
+	if ((End > Start) && (Load != 0U) && (Load != Start)) {
+		Xil_TcmCopy(Start, Load, (u32)(End - Start));
+	}
+
+	for (Index = 0U; Index < XIL_TCM_OVERLAY_RANGES; Index++) {
+		Resident[Index].RunAddr = 0U;
+		Resident[Index].OverlayPtr = NULL;
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function loads an overlay to its TCM range, replacing the
+*              overlay loaded there. Nothing is copied if the overlay is
+*              already loaded.
+*
+* @param       OverlayPtr: Pointer to the overlay descriptor.
+*
+* @return
+*              - XST_SUCCESS if the overlay is loaded.
+*              - XST_INVALID_PARAM if the descriptor is not valid.
+*              - XST_FAILURE if overlays are already loaded to
+*                XIL_TCM_OVERLAY_RANGES other ranges.
+*
+* @note        No function of the replaced overlay may run, or be called by
+*              an enabled interrupt handler, while the overlay is loaded.
+*
+*****************************************************************************/
+s32 Xil_TcmOverlayLoad(Xil_TcmOverlay *OverlayPtr)
+{
+	s32 Status = XST_FAILURE;
+	u32 Index;
+	u32 Free = XIL_TCM_OVERLAY_RANGES;
+
+	if ((OverlayPtr == NULL) || (OverlayPtr->LoadEnd < OverlayPtr->LoadStart)) {
+		Status = XST_INVALID_PARAM;
+		goto END;
+	}
+
+	for (Index = 0U; Index < XIL_TCM_OVERLAY_RANGES; Index++) {
+		if (Resident[Index].RunAddr == OverlayPtr->RunAddr) {
+			break;
+		}
+		if ((Resident[Index].OverlayPtr == NULL) &&
+		    (Free == XIL_TCM_OVERLAY_RANGES)) {
+			Free = Index;
+		}
+	}
+
+	if (Index == XIL_TCM_OVERLAY_RANGES) {
+		if (Free == XIL_TCM_OVERLAY_RANGES) {
+			goto END;
+		}
+		Index = Free;
+		Resident[Index].RunAddr = OverlayPtr->RunAddr;
+	} else if (Resident[Index].OverlayPtr == OverlayPtr) {
+		Status = XST_SUCCESS;
+		goto END;
+	} else {
+		/* Another overlay is loaded to the range */
+	}
+
+	Resident[Index].OverlayPtr = NULL;
+	Xil_TcmCopy(OverlayPtr->RunAddr, OverlayPtr->LoadStart,
+		    (u32)(OverlayPtr->LoadEnd - OverlayPtr->LoadStart));
+	Resident[Index].OverlayPtr = OverlayPtr;
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function tells whether an overlay is loaded.
+*
+* @param       OverlayPtr: Pointer to the overlay descriptor.
+*
+* @return      1 if the overlay is loaded, 0 otherwise.
+*
+*****************************************************************************/
+u32 Xil_TcmOverlayIsLoaded(const Xil_TcmOverlay *OverlayPtr)
+{
+	u32 Index;
+	u32 Loaded = 0U;
+
+	for (Index = 0U; Index < XIL_TCM_OVERLAY_RANGES; Index++) {
+		if ((OverlayPtr != NULL) &&
+		    (Resident[Index].OverlayPtr == OverlayPtr)) {
+			Loaded = 1U;
+		}
+	}
+
+	return Loaded;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function prints the TCM used by the TCM text and by
+*              overlays.
+*
+* @param       Overlays: Array of overlay descriptors, can be NULL.
+* @param       NumOverlays: Number of descriptors in Overlays.
+*
+* @return      None.
+*
+*****************************************************************************/
+void Xil_TcmReport(Xil_TcmOverlay *const *Overlays, u32 NumOverlays)
+{
+	UINTPTR Start = (UINTPTR)__tcm_text_start;
+	UINTPTR End = (UINTPTR)__tcm_text_end;
+	const Xil_TcmOverlay *OverlayPtr;
+	u32 Index;
+
+	if (End > Start) {
+		xil_printf("tcm text: %s 0x%08x %d bytes\r\n", Xil_TcmName(Start),
+			   (u32)Start, (u32)(End - Start));
+	} else {
+		xil_printf("tcm text: none\r\n");
+	}
+
+	for (Index = 0U; (Overlays != NULL) && (Index < NumOverlays); Index++) {
+		OverlayPtr = Overlays[Index];
+		xil_printf("overlay %s: %s 0x%08x %d bytes%s\r\n", OverlayPtr->Name,
+			   Xil_TcmName(OverlayPtr->RunAddr),
+			   (u32)OverlayPtr->RunAddr,
+			   (u32)(OverlayPtr->LoadEnd - OverlayPtr->LoadStart),
+			   (Xil_TcmOverlayIsLoaded(OverlayPtr) != 0U) ?
+			   " loaded" : "");
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function copies code to TCM and makes it visible to
+*              instruction fetches.
+*
+* @param       Dst: TCM address.
+* @param       Src: Load address.
+* @param       Len: Number of bytes.
+*
+* @return      None.
+*
+*****************************************************************************/
+static void Xil_TcmCopy(UINTPTR Dst, UINTPTR Src, u32 Len)
+{
+	u32 Offset = 0U;
+
+	if (((Dst | Src) & 0x3U) == 0U) {
+		for (; (Offset + 4U) <= Len; Offset += 4U) {
+			*(volatile u32 *)(Dst + Offset) = *(const u32 *)(Src + Offset);
+		}
+	}
+	for (; Offset < Len; Offset++) {
+		*(volatile u8 *)(Dst + Offset) = *(const u8 *)(Src + Offset);
+	}
+
+	/* TCM is not cached, the copy only needs to complete */
+	dsb();
+	isb();
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function returns the name of the TCM of an address.
+*
+* @param       Addr: Address in the R5 view.
+*
+* @return      "atcm" or "btcm", "tcm" for Cortex-R52.
+*
+*****************************************************************************/
+static const char *Xil_TcmName(UINTPTR Addr)
+{
+#if defined (ARMR52)
+	(void)Addr;
+	return "tcm";
+#else
+	return ((Addr & XIL_TCM_BTCM_OFFSET) != 0U) ? "btcm" : "atcm";
+#endif
+}
+/**
+* @} End of "addtogroup r5_tcm_apis".
+*/
@@ -0,0 +1,134 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+* @file xil_tcm.h
+*
+* @addtogroup r5_tcm_apis Cortex R5 Processor TCM Code Placement APIs
+*
+* The xil_tcm.h file provides placement of hot code, such as interrupt
+* handlers and control loops, in the tightly coupled memories (TCM).
+*
+* Functions tagged with XIL_TCM_TEXT are linked to run from TCM and are
+* copied there from their load address by the boot code, before main is
+* called. Functions tagged with XIL_TCM_OVERLAY(Name) are grouped in
+* overlays, which share the same TCM range and are copied there on demand
+* with Xil_TcmOverlayLoad.
+*
+* The linker script places the sections. For GCC, the following fragment
+* links .tcm_text to ATCM, and two overlays to BTCM, with their load copies
+* in DDR. Memory region names are those of the generated linker script.
+*
+* <pre>
+*	.tcm_text : {
+*		__tcm_text_start = .;
+*		*(.tcm_text)
+*		*(.text.XScuGic_InterruptHandler)
+*		__tcm_text_end = .;
+*	} > psu_r5_0_atcm_MEM_0 AT> psu_r5_ddr_0_MEM_0
+*	__tcm_text_load = LOADADDR(.tcm_text);
+*
+*	OVERLAY : NOCROSSREFS {
+*		.tcm_ovl_ctrl { __tcm_ovl_ctrl_start = .; *(.tcm_ovl_ctrl) }
+*		.tcm_ovl_dma { __tcm_ovl_dma_start = .; *(.tcm_ovl_dma) }
+*	} > psu_r5_0_btcm_MEM_0 AT> psu_r5_ddr_0_MEM_0
+* </pre>
+*
+* Functions of the BSP and of drivers, such as XAxiDma_BdRingFromHw, can be
+* placed in TCM without changing their sources by naming their sections in
+* the fragment, when they are built with -ffunction-sections.
+*
+* The linker inserts long branch veneers for calls between TCM and DDR, and
+* NOCROSSREFS makes it report calls between overlays of the same range.
+* When the linker script has no .tcm_text section, Xil_TcmInit does
+* nothing.
+*
+* @{
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- ---------------------------------------------------
+* 8.1   ag   10/15/26 First release
+* </pre>
+*
+******************************************************************************/
+
+#ifndef XIL_TCM_H /* prevent circular inclusions */
+#define XIL_TCM_H /* by using protection macros */
+
+/***************************** Include Files ********************************/
+
+#include "xil_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/************************** Constant Definitions ****************************/
+
+/**
+ * Number of TCM ranges overlays can be loaded to.
+ */
+#ifndef XIL_TCM_OVERLAY_RANGES
+#define XIL_TCM_OVERLAY_RANGES	2U
+#endif
+
+/**************************** Type Definitions ******************************/
+
+/**
+ * Overlay descriptor, defined with XIL_TCM_OVERLAY_DEFINE.
+ */
+typedef struct {
+	const char *Name;	/**< Overlay name */
+	UINTPTR LoadStart;	/**< Start of the load copy */
+	UINTPTR LoadEnd;	/**< End of the load copy */
+	UINTPTR RunAddr;	/**< TCM address the overlay runs from */
+} Xil_TcmOverlay;
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+/**
+ * Places a function in the TCM text loaded at startup.
+ */
+#define XIL_TCM_TEXT	__attribute__((section(".tcm_text"), noinline))
+
+/**
+ * Places a function in the overlay Name.
+ */
+#define XIL_TCM_OVERLAY(Name) \
+	__attribute__((section(".tcm_ovl_" #Name), noinline))
+
+/**
+ * Defines the descriptor XilTcmOverlay_Name of the overlay Name, from the
+ * symbols of the linker script.
+ */
+#define XIL_TCM_OVERLAY_DEFINE(Name) \
+	extern u8 __load_start_tcm_ovl_##Name[]; \
+	extern u8 __load_stop_tcm_ovl_##Name[]; \
+	extern u8 __tcm_ovl_##Name##_start[]; \
+	Xil_TcmOverlay XilTcmOverlay_##Name = { \
+		#Name, \
+		(UINTPTR)__load_start_tcm_ovl_##Name, \
+		(UINTPTR)__load_stop_tcm_ovl_##Name, \
+		(UINTPTR)__tcm_ovl_##Name##_start \
+	}
+
+/************************** Function Prototypes *****************************/
+
+void Xil_TcmInit(void);
+s32 Xil_TcmOverlayLoad(Xil_TcmOverlay *OverlayPtr);
+u32 Xil_TcmOverlayIsLoaded(const Xil_TcmOverlay *OverlayPtr);
+void Xil_TcmReport(Xil_TcmOverlay *const *Overlays, u32 NumOverlays);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XIL_TCM_H */
+/**
+* @} End of "addtogroup r5_tcm_apis".
+*/
@@ -0,0 +1,297 @@
+/******************************************************************************/
+/**
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+* @file xil_binlog.c
+*
+* This file contains the deferred binary logging backend. Refer
+* xil_binlog.h for the description of the backend and the stream format.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who      Date     Changes
+* ----- -------- -------- -----------------------------------------------
+* 8.1   ag       10/14/26 First release.
+*       ag       10/15/26 Allow Xil_BinLogDrain to be called from the kick
+*                         callback and pick up records added meanwhile.
+*
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+
+#include "xil_binlog.h"
+#if defined (__aarch64__) || defined (__arm__) || defined (__ICCARM__)
+#include "xpseudo_asm.h"
+#elif defined (__MICROBLAZE__)
+#include "mb_interface.h"
+#endif
+
+/************************** Constant Definitions ****************************/
+
+#if defined (__aarch64__) || defined (__arm__) || defined (__ICCARM__)
+#define XIL_BINLOG_IRQ_FIQ_MASK	0xC0U	/* Mask IRQ and FIQ interrupts */
+#elif defined (__MICROBLAZE__)
+#define XIL_BINLOG_MSR_IE_MASK	0x2U	/* MSR interrupt enable bit */
+#endif
+
+#define XIL_BINLOG_RING_BYTES	(XIL_BINLOG_RING_WORDS * sizeof(u32))
+#define XIL_BINLOG_BYTE_MASK	(XIL_BINLOG_RING_BYTES - 1U)
+#define XIL_BINLOG_WORD_MASK	(XIL_BINLOG_RING_WORDS - 1U)
+
+/************************** Variable Definitions ****************************/
+
+#if defined (__GNUC__)
+extern const char8 __start_xil_binlog_fmt[] __attribute__ ((weak));
+#endif
+
+static u32 BinLogRing[XIL_BINLOG_RING_WORDS];
+static volatile u32 BinLogHead;		/* Write offset in bytes */
+static volatile u32 BinLogTail;		/* Read offset in bytes */
+static u32 BinLogSeq;
+static u32 BinLogDropCount;
+static volatile u32 BinLogDraining;	/* Set while the ring is drained */
+
+static Xil_BinLogOutput BinLogOutput;
+static Xil_BinLogKick BinLogKick;
+static void *BinLogRef;
+
+/************************** Function Prototypes *****************************/
+
+static UINTPTR Xil_BinLogIrqSave(void);
+static void Xil_BinLogIrqRestore(UINTPTR Flags);
+
+/*****************************************************************************/
+/**
+* @brief       This function appends a record to the log ring. It is called
+*              through the XIL_BINLOG macro.
+*
+* @param       Fmt: format string located in the xil_binlog_fmt section
+* @param       Args: pointer to the arguments
+* @param       NumArgs: number of arguments, XIL_BINLOG_MAX_ARGS at most
+*
+* @return      None.
+*
+* @note        Safe to call from interrupt handlers. The record is dropped
+*              if the ring does not have room for it.
+*
+*****************************************************************************/
+void Xil_BinLogWrite(const char8 *Fmt, const u32 *Args, u32 NumArgs)
+{
+	UINTPTR Flags;
+	u32 Head;
+	u32 Len;
+	u32 Id;
+	u32 Index;
+	u32 i;
+	u32 WasEmpty;
+
+	if (NumArgs > XIL_BINLOG_MAX_ARGS) {
+		NumArgs = XIL_BINLOG_MAX_ARGS;
+	}
+	Len = (NumArgs + 2U) * (u32)sizeof(u32);
+
+#if defined (__GNUC__)
+	if (__start_xil_binlog_fmt != NULL) {
+		Id = (u32)((UINTPTR)Fmt - (UINTPTR)__start_xil_binlog_fmt);
+	} else {
+		Id = (u32)(UINTPTR)Fmt;
+	}
+#else
+	Id = (u32)(UINTPTR)Fmt;
+#endif
+
+	Flags = Xil_BinLogIrqSave();
+
+	Head = BinLogHead;
+	if ((XIL_BINLOG_RING_BYTES - (Head - BinLogTail)) < Len) {
+		BinLogDropCount++;
+		Xil_BinLogIrqRestore(Flags);
+		return;
+	}
+	WasEmpty = (Head == BinLogTail) ? 1U : 0U;
+
+	Index = Head / (u32)sizeof(u32);
+	BinLogRing[Index & XIL_BINLOG_WORD_MASK] = (XIL_BINLOG_SYNC << 24U) |
+		(NumArgs << 16U) | (BinLogSeq & 0xFFFFU);
+	BinLogRing[(Index + 1U) & XIL_BINLOG_WORD_MASK] = Id;
+	for (i = 0U; i < NumArgs; i++) {
+		BinLogRing[(Index + 2U + i) & XIL_BINLOG_WORD_MASK] = Args[i];
+	}
+	BinLogSeq++;
+	BinLogHead = Head + Len;
+
+	Xil_BinLogIrqRestore(Flags);
+
+	if ((WasEmpty != 0U) && (BinLogKick != NULL)) {
+		BinLogKick(BinLogRef);
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function registers the output used to drain the ring.
+*
+* @param       Output: non-blocking output, for example a UART FIFO fill
+* @param       Kick: called when a record is added to an empty ring, can be
+*              NULL
+* @param       Ref: argument passed to Output and Kick
+*
+* @return      None.
+*
+*****************************************************************************/
+void Xil_BinLogSetSink(Xil_BinLogOutput Output, Xil_BinLogKick Kick,
+		void *Ref)
+{
+	UINTPTR Flags = Xil_BinLogIrqSave();
+
+	BinLogOutput = Output;
+	BinLogKick = Kick;
+	BinLogRef = Ref;
+
+	Xil_BinLogIrqRestore(Flags);
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function passes pending log bytes to the registered
+*              output until the ring is empty or the output stops accepting
+*              data. It is intended to be called from the UART transmit
+*              interrupt handler or from an idle loop.
+*
+* @return      Number of bytes drained, 0 if no output is registered.
+*
+* @note        It can also be called from the kick callback. A call made
+*              while the ring is being drained, for example from an
+*              interrupt handler that logs a message, returns 0 and the
+*              records are drained by the call in progress.
+*
+*****************************************************************************/
+u32 Xil_BinLogDrain(void)
+{
+	const u8 *Buf = (const u8 *)BinLogRing;
+	u32 Head;
+	u32 Tail;
+	u32 Total = 0U;
+	u32 Chunk;
+	u32 Sent = 0U;
+
+	if ((BinLogOutput == NULL) || (BinLogDraining != 0U)) {
+		return 0U;
+	}
+
+	do {
+		BinLogDraining = 1U;
+		Tail = BinLogTail;
+		Head = BinLogHead;
+		while (Tail != Head) {
+			Chunk = XIL_BINLOG_RING_BYTES -
+				(Tail & XIL_BINLOG_BYTE_MASK);
+			if (Chunk > (Head - Tail)) {
+				Chunk = Head - Tail;
+			}
+			Sent = BinLogOutput(BinLogRef,
+					&Buf[Tail & XIL_BINLOG_BYTE_MASK], Chunk);
+			Tail += Sent;
+			BinLogTail = Tail;
+			Total += Sent;
+			if (Sent < Chunk) {
+				break;
+			}
+			/* Records added by interrupt handlers meanwhile */
+			Head = BinLogHead;
+		}
+		BinLogDraining = 0U;
+		/* A record added just before the flag was cleared did not drain */
+	} while ((Tail == Head) && (BinLogTail != BinLogHead));
+
+	return Total;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function empties the ring, blocking until all bytes have
+*              been written. Without a registered output the bytes are
+*              written with outbyte.
+*
+* @return      None.
+*
+*****************************************************************************/
+void Xil_BinLogFlush(void)
+{
+	const u8 *Buf = (const u8 *)BinLogRing;
+	u32 Tail;
+
+	if (BinLogOutput != NULL) {
+		while (BinLogTail != BinLogHead) {
+			(void)Xil_BinLogDrain();
+		}
+		return;
+	}
+
+	Tail = BinLogTail;
+	while (Tail != BinLogHead) {
+		outbyte((char)Buf[Tail & XIL_BINLOG_BYTE_MASK]);
+		Tail++;
+		BinLogTail = Tail;
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function returns the number of records dropped because
+*              the ring was full.
+*
+* @return      Number of dropped records.
+*
+*****************************************************************************/
+u32 Xil_BinLogDropped(void)
+{
+	return BinLogDropCount;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function masks interrupts and returns the previous state.
+*
+* @return      Interrupt state to be passed to Xil_BinLogIrqRestore.
+*
+*****************************************************************************/
+static UINTPTR Xil_BinLogIrqSave(void)
+{
+	UINTPTR Flags = 0U;
+
+#if defined (XIL_BINLOG_IRQ_FIQ_MASK)
+	Flags = (UINTPTR)mfcpsr();
+	mtcpsr((u32)Flags | XIL_BINLOG_IRQ_FIQ_MASK);
+#elif defined (XIL_BINLOG_MSR_IE_MASK)
+	Flags = mfmsr();
+	mtmsr(Flags & ~(UINTPTR)XIL_BINLOG_MSR_IE_MASK);
+#endif
+
+	return Flags;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function restores the interrupt state.
+*
+* @param       Flags: value returned by Xil_BinLogIrqSave
+*
+*****************************************************************************/
+static void Xil_BinLogIrqRestore(UINTPTR Flags)
+{
+#if defined (XIL_BINLOG_IRQ_FIQ_MASK)
+	mtcpsr((u32)Flags);
+#elif defined (XIL_BINLOG_MSR_IE_MASK)
+	mtmsr(Flags);
+#else
+	(void)Flags;
+#endif
+}
@@ -0,0 +1,193 @@
+/******************************************************************************/
+/**
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+* @file xil_binlog.h
+*
+* @addtogroup common_binlog_apis Deferred Binary Logging
+*
+* The xil_binlog.h file contains a deferred logging backend for xil_printf
+* style messages. Instead of formatting the message and writing it to the
+* UART character by character, XIL_BINLOG stores a format ID and the raw
+* arguments in a RAM ring and returns. The ring is drained later, either
+* from a UART transmit interrupt through a sink registered with
+* Xil_BinLogSetSink, or by Xil_BinLogFlush, and a host tool expands the
+* messages using the format strings in the ELF file.
+*
+* - The backend is selected at build time. Without XIL_BINLOG_ENABLE, which
+*   is defined by the BSP parameter xil_printf_binlog, XIL_BINLOG expands to
+*   xil_printf so call sites work unchanged in text mode.
+* - Format strings are placed in the xil_binlog_fmt section and the format
+*   ID is the offset of the string in that section.
+* - Arguments must be integers of at most 32 bits, at most
+*   XIL_BINLOG_MAX_ARGS of them. XIL_BINLOG rejects other arguments, such
+*   as strings, pointers and 64-bit integers, at build time. Callers that
+*   also print such messages check them with XIL_BINLOG_IS_INT_ONLY and
+*   format them as text instead.
+* - Records that do not fit in the ring are dropped and counted.
+*
+* Stream format, all words little endian on the supported processors:
+* <pre>
+*   word 0: XIL_BINLOG_SYNC << 24 | number of arguments << 16 | sequence
+*   word 1: format ID
+*   word 2: first argument, followed by the remaining arguments
+* </pre>
+*
+* @{
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who      Date     Changes
+* ----- -------- -------- -----------------------------------------------
+* 8.1   ag       10/14/26 First release.
+*       ag       10/15/26 Reject arguments that are not integers of at most
+*                         32 bits at build time and added
+*                         XIL_BINLOG_IS_INT_ONLY.
+*
+* </pre>
+*
+*****************************************************************************/
+#ifndef XIL_BINLOG_H		/* prevent circular inclusions */
+#define XIL_BINLOG_H		/* by using protection macros */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files ********************************/
+
+#include "xil_types.h"
+#include "xil_printf.h"
+
+/************************** Constant Definitions ****************************/
+
+/**
+ * Size of the log ring in 32-bit words, must be a power of two.
+ */
+#ifndef XIL_BINLOG_RING_WORDS
+#define XIL_BINLOG_RING_WORDS	1024U
+#endif
+
+/** Maximum number of arguments of a record */
+#define XIL_BINLOG_MAX_ARGS	8U
+
+/** Marker in the top byte of the first word of every record */
+#define XIL_BINLOG_SYNC		0xA5U
+
+/**************************** Type Definitions ******************************/
+
+/**
+ * Non-blocking output of a drained chunk, for example a UART FIFO fill.
+ * Returns the number of bytes accepted, which can be less than Len.
+ */
+typedef u32 (*Xil_BinLogOutput)(void *Ref, const u8 *Buf, u32 Len);
+
+/**
+ * Called when a record is added to an empty ring, for example to enable
+ * the UART transmit empty interrupt that calls Xil_BinLogDrain.
+ */
+typedef void (*Xil_BinLogKick)(void *Ref);
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#if defined (XIL_BINLOG_ENABLE) && defined (__GNUC__)
+/* _Generic associations of the integer types of at most 32 bits */
+#if defined (__LP64__)
+#define XIL_BINLOG_LONG_ASSOC(Val)
+#else
+#define XIL_BINLOG_LONG_ASSOC(Val)	, long: Val, unsigned long: Val
+#endif
+#define XIL_BINLOG_INT_ASSOC(Val)	_Bool: Val, char: Val, \
+	signed char: Val, unsigned char: Val, short: Val, \
+	unsigned short: Val, int: Val, unsigned int: Val \
+	XIL_BINLOG_LONG_ASSOC(Val)
+
+/* Record word of an argument, a build error if it is not an integer */
+#define XIL_BINLOG_ARG(Arg)	(u32)_Generic((Arg), \
+	XIL_BINLOG_INT_ASSOC((Arg))),
+/* Record word of an argument, 0 if it is not an integer */
+#define XIL_BINLOG_ANY_ARG(Arg)	(u32)_Generic((Arg), \
+	XIL_BINLOG_INT_ASSOC((Arg)), default: 0U),
+/* 1U if an argument is an integer, 0U otherwise */
+#define XIL_BINLOG_INT_ARG(Arg)	_Generic((Arg), \
+	XIL_BINLOG_INT_ASSOC(1U), default: 0U) &
+
+/*
+ * Applies Op to each of 1 to XIL_BINLOG_MAX_ARGS + 1 arguments. More
+ * arguments fail to build.
+ */
+#define XIL_BINLOG_CAT(A, B)	XIL_BINLOG_CAT_(A, B)
+#define XIL_BINLOG_CAT_(A, B)	A##B
+#define XIL_BINLOG_COUNT(...)	XIL_BINLOG_COUNT_(__VA_ARGS__, \
+	9, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define XIL_BINLOG_COUNT_(A1, A2, A3, A4, A5, A6, A7, A8, A9, N, ...)	N
+#define XIL_BINLOG_MAP(Op, ...)	XIL_BINLOG_CAT(XIL_BINLOG_MAP_, \
+	XIL_BINLOG_COUNT(__VA_ARGS__))(Op, __VA_ARGS__)
+#define XIL_BINLOG_MAP_1(Op, A)	Op(A)
+#define XIL_BINLOG_MAP_2(Op, A, ...)	Op(A) XIL_BINLOG_MAP_1(Op, __VA_ARGS__)
+#define XIL_BINLOG_MAP_3(Op, A, ...)	Op(A) XIL_BINLOG_MAP_2(Op, __VA_ARGS__)
+#define XIL_BINLOG_MAP_4(Op, A, ...)	Op(A) XIL_BINLOG_MAP_3(Op, __VA_ARGS__)
+#define XIL_BINLOG_MAP_5(Op, A, ...)	Op(A) XIL_BINLOG_MAP_4(Op, __VA_ARGS__)
+#define XIL_BINLOG_MAP_6(Op, A, ...)	Op(A) XIL_BINLOG_MAP_5(Op, __VA_ARGS__)
+#define XIL_BINLOG_MAP_7(Op, A, ...)	Op(A) XIL_BINLOG_MAP_6(Op, __VA_ARGS__)
+#define XIL_BINLOG_MAP_8(Op, A, ...)	Op(A) XIL_BINLOG_MAP_7(Op, __VA_ARGS__)
+#define XIL_BINLOG_MAP_9(Op, A, ...)	Op(A) XIL_BINLOG_MAP_8(Op, __VA_ARGS__)
+
+/* Records a message, ArgOp gives the record word of each argument */
+#define XIL_BINLOG_RECORD(ArgOp, Fmt, ...)	do { \
+	static const char8 XilBinLogFmt[] \
+		__attribute__ ((section ("xil_binlog_fmt"), used)) = Fmt; \
+	const u32 XilBinLogArgs[] = { \
+		XIL_BINLOG_MAP(ArgOp, 0U, ##__VA_ARGS__) }; \
+	Xil_BinLogWrite(XilBinLogFmt, &XilBinLogArgs[1], \
+		(u32)(sizeof(XilBinLogArgs) / sizeof(u32)) - 1U); \
+	} while (0)
+
+/**
+ * Logs a message, with the arguments of xil_printf. Arguments must be
+ * integers of at most 32 bits.
+ */
+#define XIL_BINLOG(Fmt, ...) \
+	XIL_BINLOG_RECORD(XIL_BINLOG_ARG, Fmt, ##__VA_ARGS__)
+
+/**
+ * Constant expression, 1U if all arguments of a message are integers of at
+ * most 32 bits and the message can be logged, 0U otherwise. The arguments
+ * are not evaluated.
+ */
+#define XIL_BINLOG_IS_INT_ONLY(Fmt, ...) \
+	(XIL_BINLOG_MAP(XIL_BINLOG_INT_ARG, 0U, ##__VA_ARGS__) 1U)
+
+/**
+ * Logs a message for which XIL_BINLOG_IS_INT_ONLY is 1U. Other arguments
+ * are recorded as 0, so the message must be formatted as text instead.
+ */
+#define XIL_BINLOG_INT_ONLY(Fmt, ...) \
+	XIL_BINLOG_RECORD(XIL_BINLOG_ANY_ARG, Fmt, ##__VA_ARGS__)
+#else
+#define XIL_BINLOG(Fmt, ...)	xil_printf(Fmt, ##__VA_ARGS__)
+#define XIL_BINLOG_IS_INT_ONLY(Fmt, ...)	(0U)
+#define XIL_BINLOG_INT_ONLY(Fmt, ...)	xil_printf(Fmt, ##__VA_ARGS__)
+#endif
+
+/************************** Function Prototypes *****************************/
+
+void Xil_BinLogWrite(const char8 *Fmt, const u32 *Args, u32 NumArgs);
+void Xil_BinLogSetSink(Xil_BinLogOutput Output, Xil_BinLogKick Kick,
+		void *Ref);
+u32 Xil_BinLogDrain(void);
+void Xil_BinLogFlush(void);
+u32 Xil_BinLogDropped(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XIL_BINLOG_H */
+/**
+* @} End of "addtogroup common_binlog_apis".
+*/
@@ -0,0 +1,546 @@
+/******************************************************************************/
+/**
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+* @file xil_bulkmem.c
+*
+* This file contains the bulk memory copy and fill APIs. Refer xil_bulkmem.h
+* for the offload policy.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who      Date     Changes
+* ----- -------- -------- -----------------------------------------------
+* 8.1   ag       10/14/26 First release.
+*
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+
+#include <string.h>
+#include "xil_types.h"
+#include "xil_mem.h"
+#include "xil_bulkmem.h"
+#include "xil_cache.h"
+
+#ifdef XIL_BULKMEM_USE_ZDMA
+#include "xzdma.h"
+#endif
+
+/************************** Constant Definitions ****************************/
+
+#ifdef XIL_BULKMEM_USE_ZDMA
+/* Maximum number of ZDMA channels managed by the service */
+#define XIL_BULKMEM_MAX_CHANNELS	16U
+
+/* Largest transfer handed to a single ZDMA simple mode transfer */
+#define XIL_BULKMEM_DMA_MAX_SIZE	0x3FFFFFC0U
+
+/* Write only mode pattern is 128 bit wide, destination is kept aligned */
+#define XIL_BULKMEM_FILL_ALIGN		16U
+
+#define XIL_BULKMEM_CHANNEL_NONE	(-1)
+
+/* Interrupt status bits that terminate a simple mode transfer with error */
+#define XIL_BULKMEM_ZDMA_ERR_MASK	(XZDMA_IXR_ERR_MASK & \
+					~XZDMA_IXR_DMA_PAUSE_MASK)
+#endif
+
+#if defined (__aarch64__) && defined (__GNUC__)
+/* Non-temporal loops move 64 bytes per iteration on 16 byte aligned data */
+#define XIL_BULKMEM_NT_BURST		64U
+#define XIL_BULKMEM_NT_ALIGN_MASK	0xFU
+#endif
+
+/**************************** Type Definitions ******************************/
+
+#ifdef XIL_BULKMEM_USE_ZDMA
+typedef struct {
+	XZDma Inst;		/**< ZDMA driver instance */
+	UINTPTR Src;		/**< Source of the transfer in flight */
+	UINTPTR Dst;		/**< Destination of the transfer in flight */
+	u32 Size;		/**< Size of the transfer in flight */
+	u32 Pattern[4];		/**< Fill pattern for write only mode */
+	u8 IsOwned;		/**< Channel is handed to the service */
+	u8 IsBusy;		/**< Channel has a transfer in flight */
+	u8 IsFill;		/**< Transfer in flight is a fill */
+} XBulkMem_Channel;
+#endif
+
+/************************** Variable Definitions ****************************/
+
+#ifdef XIL_BULKMEM_USE_ZDMA
+static XBulkMem_Channel BulkMemChannels[XIL_BULKMEM_MAX_CHANNELS];
+#endif
+
+/************************** Function Prototypes *****************************/
+
+static void Xil_BulkMemCpyCpu(void *Dst, const void *Src, u32 Cnt);
+static void Xil_BulkMemSetCpu(void *Dst, u8 Val, u32 Cnt);
+
+#ifdef XIL_BULKMEM_USE_ZDMA
+static s32 Xil_BulkMemStart(UINTPTR Dst, UINTPTR Src, u8 Val, u32 Cnt,
+		u8 IsFill);
+static u32 Xil_BulkMemPoll(s32 Channel);
+#endif
+
+/*****************************************************************************/
+/**
+* @brief       This function hands ZDMA channels to the bulk memory service.
+*
+* @param       ChannelMask: bit mask of ZDMA device IDs to be used, bit n
+*              selects device ID n
+*
+* @return      XST_SUCCESS if at least one channel is initialized or the BSP
+*              is built without ZDMA offload, XST_FAILURE otherwise.
+*
+*****************************************************************************/
+s32 Xil_BulkMemInit(u32 ChannelMask)
+{
+#ifdef XIL_BULKMEM_USE_ZDMA
+	s32 Status = XST_FAILURE;
+	XZDma_Config *Config;
+	u32 Index;
+
+	for (Index = 0U; (Index < XPAR_XZDMA_NUM_INSTANCES) &&
+			(Index < XIL_BULKMEM_MAX_CHANNELS); Index++) {
+		BulkMemChannels[Index].IsOwned = 0U;
+		BulkMemChannels[Index].IsBusy = 0U;
+		if ((ChannelMask & ((u32)1U << Index)) == 0U) {
+			continue;
+		}
+		Config = XZDma_LookupConfig((u16)Index);
+		if (Config == NULL) {
+			continue;
+		}
+		if (XZDma_CfgInitialize(&BulkMemChannels[Index].Inst, Config,
+				Config->BaseAddress) != XST_SUCCESS) {
+			continue;
+		}
+		XZDma_DisableIntr(&BulkMemChannels[Index].Inst,
+				XZDMA_IXR_ALL_INTR_MASK);
+		BulkMemChannels[Index].IsOwned = 1U;
+		Status = XST_SUCCESS;
+	}
+
+	return Status;
+#else
+	(void)ChannelMask;
+	return XST_SUCCESS;
+#endif
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function copies memory from one location to other. Large
+*              copies are offloaded to ZDMA or copied with non-temporal
+*              stores.
+*
+* @param       Dst: pointer pointing to destination memory
+*
+* @param       Src: pointer pointing to source memory
+*
+* @param       Cnt: 32 bit length of bytes to be copied
+*
+*****************************************************************************/
+void Xil_BulkMemCpy(void *Dst, const void *Src, u32 Cnt)
+{
+	XBulkMem_Handle Handle;
+
+	Xil_BulkMemCpyAsync(Dst, Src, Cnt, &Handle);
+	Xil_BulkMemWait(&Handle);
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function fills memory with a byte value. Large fills are
+*              offloaded to ZDMA write only mode or done with non-temporal
+*              stores.
+*
+* @param       Dst: pointer pointing to destination memory
+*
+* @param       Val: byte value to be written
+*
+* @param       Cnt: 32 bit length of bytes to be filled
+*
+*****************************************************************************/
+void Xil_BulkMemSet(void *Dst, u8 Val, u32 Cnt)
+{
+	XBulkMem_Handle Handle;
+
+	Xil_BulkMemSetAsync(Dst, Val, Cnt, &Handle);
+	Xil_BulkMemWait(&Handle);
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function starts a copy and returns without waiting for
+*              its completion when it is offloaded to ZDMA. Copies that are
+*              not offloaded are completed before returning.
+*
+* @param       Dst: pointer pointing to destination memory
+*
+* @param       Src: pointer pointing to source memory
+*
+* @param       Cnt: 32 bit length of bytes to be copied
+*
+* @param       Handle: completion handle to be passed to Xil_BulkMemWait or
+*              Xil_BulkMemIsDone
+*
+* @note        Source and destination buffers must not be accessed until
+*              the transfer is reported complete.
+*
+*****************************************************************************/
+void Xil_BulkMemCpyAsync(void *Dst, const void *Src, u32 Cnt,
+		XBulkMem_Handle *Handle)
+{
+	Handle->Dst = (UINTPTR)Dst;
+	Handle->Size = Cnt;
+#ifdef XIL_BULKMEM_USE_ZDMA
+	Handle->Channel = XIL_BULKMEM_CHANNEL_NONE;
+	if ((Cnt >= XIL_BULKMEM_DMA_THRESHOLD) &&
+			(Cnt <= XIL_BULKMEM_DMA_MAX_SIZE)) {
+		Handle->Channel = Xil_BulkMemStart((UINTPTR)Dst,
+				(UINTPTR)Src, 0U, Cnt, 0U);
+	}
+	if (Handle->Channel != XIL_BULKMEM_CHANNEL_NONE) {
+		return;
+	}
+#else
+	Handle->Channel = -1;
+#endif
+	Xil_BulkMemCpyCpu(Dst, Src, Cnt);
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function starts a fill and returns without waiting for
+*              its completion when it is offloaded to ZDMA. Fills that are
+*              not offloaded are completed before returning.
+*
+* @param       Dst: pointer pointing to destination memory
+*
+* @param       Val: byte value to be written
+*
+* @param       Cnt: 32 bit length of bytes to be filled
+*
+* @param       Handle: completion handle to be passed to Xil_BulkMemWait or
+*              Xil_BulkMemIsDone
+*
+*****************************************************************************/
+void Xil_BulkMemSetAsync(void *Dst, u8 Val, u32 Cnt,
+		XBulkMem_Handle *Handle)
+{
+	Handle->Dst = (UINTPTR)Dst;
+	Handle->Size = Cnt;
+#ifdef XIL_BULKMEM_USE_ZDMA
+	Handle->Channel = XIL_BULKMEM_CHANNEL_NONE;
+	if ((Cnt >= XIL_BULKMEM_DMA_THRESHOLD) &&
+			(Cnt <= XIL_BULKMEM_DMA_MAX_SIZE)) {
+		u32 Head = (u32)((XIL_BULKMEM_FILL_ALIGN -
+			((UINTPTR)Dst & (XIL_BULKMEM_FILL_ALIGN - 1U))) &
+			(XIL_BULKMEM_FILL_ALIGN - 1U));
+		u32 Body = (Cnt - Head) & ~(XIL_BULKMEM_FILL_ALIGN - 1U);
+		u8 *Ptr = (u8 *)Dst;
+
+		Handle->Channel = Xil_BulkMemStart((UINTPTR)(Ptr + Head), 0U,
+				Val, Body, 1U);
+		if (Handle->Channel != XIL_BULKMEM_CHANNEL_NONE) {
+			/* Head and tail are not part of the DMA buffer */
+			(void)memset(Ptr, (s32)Val, Head);
+			(void)memset(Ptr + Head + Body, (s32)Val,
+					Cnt - Head - Body);
+			return;
+		}
+	}
+#else
+	Handle->Channel = -1;
+#endif
+	Xil_BulkMemSetCpu(Dst, Val, Cnt);
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function checks whether an asynchronous transfer is
+*              complete. The channel is released once completion is
+*              reported.
+*
+* @param       Handle: completion handle of the transfer
+*
+* @return      TRUE if the transfer is complete, FALSE otherwise.
+*
+*****************************************************************************/
+u32 Xil_BulkMemIsDone(XBulkMem_Handle *Handle)
+{
+#ifdef XIL_BULKMEM_USE_ZDMA
+	if (Handle->Channel == XIL_BULKMEM_CHANNEL_NONE) {
+		return (u32)TRUE;
+	}
+	if (Xil_BulkMemPoll(Handle->Channel) == (u32)FALSE) {
+		return (u32)FALSE;
+	}
+	Handle->Channel = XIL_BULKMEM_CHANNEL_NONE;
+#else
+	(void)Handle;
+#endif
+	return (u32)TRUE;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function waits for an asynchronous transfer to complete.
+*
+* @param       Handle: completion handle of the transfer
+*
+*****************************************************************************/
+void Xil_BulkMemWait(XBulkMem_Handle *Handle)
+{
+	while (Xil_BulkMemIsDone(Handle) == (u32)FALSE) {
+		;
+	}
+}
+
+#ifdef XIL_BULKMEM_USE_ZDMA
+/*****************************************************************************/
+/**
+* @brief       This function starts a transfer on an idle ZDMA channel.
+*
+* @param       Dst: destination address
+*
+* @param       Src: source address, unused for fills
+*
+* @param       Val: fill value, unused for copies
+*
+* @param       Cnt: length of the transfer in bytes
+*
+* @param       IsFill: 1 for a write only mode fill, 0 for a copy
+*
+* @return      Index of the channel used, XIL_BULKMEM_CHANNEL_NONE if all
+*              channels are busy.
+*
+*****************************************************************************/
+static s32 Xil_BulkMemStart(UINTPTR Dst, UINTPTR Src, u8 Val, u32 Cnt,
+		u8 IsFill)
+{
+	XBulkMem_Channel *Chan = NULL;
+	XZDma_Transfer Data;
+	u32 Index;
+
+	for (Index = 0U; (Index < XPAR_XZDMA_NUM_INSTANCES) &&
+			(Index < XIL_BULKMEM_MAX_CHANNELS); Index++) {
+		if ((BulkMemChannels[Index].IsOwned != 0U) &&
+				(BulkMemChannels[Index].IsBusy == 0U)) {
+			Chan = &BulkMemChannels[Index];
+			break;
+		}
+	}
+	if (Chan == NULL) {
+		return XIL_BULKMEM_CHANNEL_NONE;
+	}
+
+	if (XZDma_SetMode(&Chan->Inst, FALSE, (IsFill != 0U) ?
+			XZDMA_WRONLY_MODE : XZDMA_NORMAL_MODE) != XST_SUCCESS) {
+		return XIL_BULKMEM_CHANNEL_NONE;
+	}
+
+	if (Chan->Inst.Config.IsCacheCoherent == 0U) {
+		if (IsFill == 0U) {
+			Xil_DCacheFlushRange((INTPTR)Src, (INTPTR)Cnt);
+		}
+		/* Write back dirty lines so they are not evicted over DMA data */
+		Xil_DCacheFlushRange((INTPTR)Dst, (INTPTR)Cnt);
+	}
+
+	Chan->Src = Src;
+	Chan->Dst = Dst;
+	Chan->Size = Cnt;
+	Chan->IsFill = IsFill;
+	Chan->IsBusy = 1U;
+
+	if (IsFill != 0U) {
+		Chan->Pattern[0] = (u32)Val * 0x01010101U;
+		Chan->Pattern[1] = Chan->Pattern[0];
+		Chan->Pattern[2] = Chan->Pattern[0];
+		Chan->Pattern[3] = Chan->Pattern[0];
+		XZDma_WOData(&Chan->Inst, Chan->Pattern);
+	}
+
+	Data.SrcAddr = Src;
+	Data.DstAddr = Dst;
+	Data.Size = Cnt;
+	Data.SrcCoherent = Chan->Inst.Config.IsCacheCoherent;
+	Data.DstCoherent = Chan->Inst.Config.IsCacheCoherent;
+	Data.Pause = 0U;
+
+	XZDma_IntrClear(&Chan->Inst, XZDMA_IXR_ALL_INTR_MASK);
+	(void)XZDma_Start(&Chan->Inst, &Data, 1U);
+
+	return (s32)Index;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function polls a ZDMA channel for completion. A channel
+*              that reports an error is reset and the transfer is redone by
+*              the CPU, so the caller always observes a completed transfer.
+*
+* @param       Channel: index of the channel
+*
+* @return      TRUE if the transfer is complete, FALSE otherwise.
+*
+*****************************************************************************/
+static u32 Xil_BulkMemPoll(s32 Channel)
+{
+	XBulkMem_Channel *Chan = &BulkMemChannels[Channel];
+	u32 Status;
+
+	Status = XZDma_IntrGetStatus(&Chan->Inst);
+	if ((Status & (XZDMA_IXR_DMA_DONE_MASK |
+			XIL_BULKMEM_ZDMA_ERR_MASK)) == 0U) {
+		return (u32)FALSE;
+	}
+
+	XZDma_IntrClear(&Chan->Inst, Status);
+	Chan->Inst.ChannelState = XZDMA_IDLE;
+
+	if (Chan->Inst.Config.IsCacheCoherent == 0U) {
+		Xil_DCacheInvalidateRange((INTPTR)Chan->Dst, (INTPTR)Chan->Size);
+	}
+
+	if ((Status & XIL_BULKMEM_ZDMA_ERR_MASK) != 0U) {
+		XZDma_Reset(&Chan->Inst);
+		Chan->Inst.ChannelState = XZDMA_IDLE;
+		if (Chan->IsFill != 0U) {
+			Xil_BulkMemSetCpu((void *)Chan->Dst,
+					(u8)Chan->Pattern[0], Chan->Size);
+		} else {
+			Xil_BulkMemCpyCpu((void *)Chan->Dst,
+					(const void *)Chan->Src, Chan->Size);
+		}
+	}
+	Chan->IsBusy = 0U;
+
+	return (u32)TRUE;
+}
+#endif
+
+/*****************************************************************************/
+/**
+* @brief       This function copies memory with the CPU. On AArch64 copies
+*              above XIL_BULKMEM_DMA_THRESHOLD use LDNP/STNP to avoid
+*              allocating the buffers into the data caches.
+*
+* @param       Dst: pointer pointing to destination memory
+*
+* @param       Src: pointer pointing to source memory
+*
+* @param       Cnt: 32 bit length of bytes to be copied
+*
+*****************************************************************************/
+static void Xil_BulkMemCpyCpu(void *Dst, const void *Src, u32 Cnt)
+{
+#ifdef XIL_BULKMEM_NT_BURST
+	u8 *d = (u8 *)Dst;
+	const u8 *s = (const u8 *)Src;
+	u32 Head;
+	u64 Bursts;
+
+	/*
+	 * XIL_BULKMEM_DMA_THRESHOLD can be overridden, the burst loop needs at
+	 * least one burst after the alignment head
+	 */
+	if ((Cnt >= XIL_BULKMEM_DMA_THRESHOLD) &&
+			(Cnt >= (2U * XIL_BULKMEM_NT_BURST)) &&
+			((((UINTPTR)d ^ (UINTPTR)s) & XIL_BULKMEM_NT_ALIGN_MASK) == 0U)) {
+		Head = (u32)((XIL_BULKMEM_NT_ALIGN_MASK + 1U -
+			((UINTPTR)d & XIL_BULKMEM_NT_ALIGN_MASK)) &
+			XIL_BULKMEM_NT_ALIGN_MASK);
+		Xil_MemCpy(d, s, Head);
+		d += Head;
+		s += Head;
+		Cnt -= Head;
+		Bursts = Cnt / XIL_BULKMEM_NT_BURST;
+		Cnt -= (u32)(Bursts * XIL_BULKMEM_NT_BURST);
+
+		__asm__ __volatile__(
+			"1:\n"
+			"ldnp x4, x5, [%1, #0]\n"
+			"ldnp x6, x7, [%1, #16]\n"
+			"ldnp x8, x9, [%1, #32]\n"
+			"ldnp x10, x11, [%1, #48]\n"
+			"add %1, %1, #64\n"
+			"stnp x4, x5, [%0, #0]\n"
+			"stnp x6, x7, [%0, #16]\n"
+			"stnp x8, x9, [%0, #32]\n"
+			"stnp x10, x11, [%0, #48]\n"
+			"add %0, %0, #64\n"
+			"subs %2, %2, #1\n"
+			"b.ne 1b\n"
+			: "+r" (d), "+r" (s), "+r" (Bursts)
+			:
+			: "x4", "x5", "x6", "x7", "x8", "x9", "x10", "x11",
+			  "cc", "memory");
+		Dst = d;
+		Src = s;
+	}
+#endif
+	Xil_MemCpy(Dst, Src, Cnt);
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function fills memory with the CPU. On AArch64 fills
+*              above XIL_BULKMEM_DMA_THRESHOLD use STNP to avoid allocating
+*              the buffer into the data caches.
+*
+* @param       Dst: pointer pointing to destination memory
+*
+* @param       Val: byte value to be written
+*
+* @param       Cnt: 32 bit length of bytes to be filled
+*
+*****************************************************************************/
+static void Xil_BulkMemSetCpu(void *Dst, u8 Val, u32 Cnt)
+{
+#ifdef XIL_BULKMEM_NT_BURST
+	u8 *d = (u8 *)Dst;
+	u64 Pattern = (u64)Val * 0x0101010101010101UL;
+	u32 Head;
+	u64 Bursts;
+
+	/* The burst loop needs at least one burst after the alignment head */
+	if ((Cnt >= XIL_BULKMEM_DMA_THRESHOLD) &&
+			(Cnt >= (2U * XIL_BULKMEM_NT_BURST))) {
+		Head = (u32)((XIL_BULKMEM_NT_ALIGN_MASK + 1U -
+			((UINTPTR)d & XIL_BULKMEM_NT_ALIGN_MASK)) &
+			XIL_BULKMEM_NT_ALIGN_MASK);
+		(void)memset(d, (s32)Val, Head);
+		d += Head;
+		Cnt -= Head;
+		Bursts = Cnt / XIL_BULKMEM_NT_BURST;
+		Cnt -= (u32)(Bursts * XIL_BULKMEM_NT_BURST);
+
+		__asm__ __volatile__(
+			"1:\n"
+			"stnp %2, %2, [%0, #0]\n"
+			"stnp %2, %2, [%0, #16]\n"
+			"stnp %2, %2, [%0, #32]\n"
+			"stnp %2, %2, [%0, #48]\n"
+			"add %0, %0, #64\n"
+			"subs %1, %1, #1\n"
+			"b.ne 1b\n"
+			: "+r" (d), "+r" (Bursts)
+			: "r" (Pattern)
+			: "cc", "memory");
+		Dst = d;
+	}
+#endif
+	(void)memset(Dst, (s32)Val, Cnt);
+}
@@ -0,0 +1,95 @@
+/******************************************************************************/
+/**
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+* @file xil_bulkmem.h
+*
+* @addtogroup common_mem_operation_api Customized APIs for Memory Operations
+*
+* The xil_bulkmem.h file contains prototypes of the bulk memory copy and fill
+* APIs. Requests larger than XIL_BULKMEM_DMA_THRESHOLD are offloaded to an
+* idle ZDMA channel when the BSP is built with bulk_mem_dma enabled and the
+* design has ZDMA instances. When no channel is available, AArch64 targets
+* fall back to non-temporal LDNP/STNP loops, which do not allocate into the
+* data caches, and other targets fall back to Xil_MemCpy/memset.
+*
+* ZDMA channels handed to Xil_BulkMemInit are owned by this service and must
+* not be used by the application. Completion is detected by polling, the
+* ZDMA interrupts are left disabled.
+*
+* @{
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who      Date     Changes
+* ----- -------- -------- -----------------------------------------------
+* 8.1   ag       10/14/26 First release.
+*
+* </pre>
+*
+*****************************************************************************/
+#ifndef XIL_BULKMEM_H		/* prevent circular inclusions */
+#define XIL_BULKMEM_H		/* by using protection macros */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files ********************************/
+
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xparameters.h"
+
+/************************** Constant Definitions ****************************/
+
+/**
+ * Requests of this size and above are offloaded to ZDMA or handled with
+ * non-temporal stores. It can be overridden through compiler flags.
+ */
+#ifndef XIL_BULKMEM_DMA_THRESHOLD
+#define XIL_BULKMEM_DMA_THRESHOLD	0x10000U
+#endif
+
+#if defined (XIL_BULK_MEM_DMA) && defined (XPAR_XZDMA_NUM_INSTANCES)
+#define XIL_BULKMEM_USE_ZDMA
+#endif
+
+/**************************** Type Definitions ******************************/
+
+/**
+ * Completion handle returned by the asynchronous APIs. It is owned by the
+ * caller and must stay valid until Xil_BulkMemWait returns or
+ * Xil_BulkMemIsDone reports completion.
+ */
+typedef struct {
+	UINTPTR Dst;		/**< Destination of the transfer */
+	u32 Size;		/**< Size of the transfer in bytes */
+	s32 Channel;		/**< ZDMA channel index, -1 when the transfer
+				  *  was completed by the CPU */
+} XBulkMem_Handle;
+
+/************************** Function Prototypes *****************************/
+
+s32 Xil_BulkMemInit(u32 ChannelMask);
+void Xil_BulkMemCpy(void *Dst, const void *Src, u32 Cnt);
+void Xil_BulkMemSet(void *Dst, u8 Val, u32 Cnt);
+void Xil_BulkMemCpyAsync(void *Dst, const void *Src, u32 Cnt,
+		XBulkMem_Handle *Handle);
+void Xil_BulkMemSetAsync(void *Dst, u8 Val, u32 Cnt,
+		XBulkMem_Handle *Handle);
+u32 Xil_BulkMemIsDone(XBulkMem_Handle *Handle);
+void Xil_BulkMemWait(XBulkMem_Handle *Handle);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XIL_BULKMEM_H */
+/**
+* @} End of "addtogroup common_mem_operation_api".
+*/
@@ -0,0 +1,333 @@
+/******************************************************************************/
+/**
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+* @file xil_dim.c
+*
+* This file contains the adaptive interrupt moderation controller.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who      Date     Changes
+* ----- -------- -------- -----------------------------------------------
+* 8.1   ag       10/14/26 First release.
+*
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+
+#include "xil_dim.h"
+
+/************************** Constant Definitions ****************************/
+
+#define XIL_DIM_WORSE	0U
+#define XIL_DIM_SAME	1U
+#define XIL_DIM_BETTER	2U
+
+/************************** Variable Definitions ****************************/
+
+/**
+ * Default profiles, from an interrupt per packet up to 32 packets per
+ * interrupt.
+ */
+const Xil_DimProfile Xil_DimDefaultProfiles[XIL_DIM_DEFAULT_PROFILES] = {
+	{ 1U, 0U },
+	{ 2U, 4U },
+	{ 4U, 8U },
+	{ 8U, 16U },
+	{ 16U, 32U },
+	{ 32U, 64U },
+};
+
+/************************** Function Prototypes *****************************/
+
+static u32 Xil_DimDiffers(u32 Curr, u32 Prev);
+static u32 Xil_DimCompare(const Xil_DimSample *Curr,
+			  const Xil_DimSample *Prev);
+static void Xil_DimPark(Xil_Dim *Dim);
+static void Xil_DimStep(Xil_Dim *Dim);
+
+/*****************************************************************************/
+/**
+* @brief       This function initializes a moderation controller at the
+*              lowest latency profile.
+*
+* @param       Dim: pointer to the controller
+* @param       Profiles: profile table ordered from the lowest latency to the
+*              highest coalescing, or NULL for Xil_DimDefaultProfiles. The
+*              table is not copied.
+* @param       NumProfiles: number of profiles in the table, ignored if
+*              Profiles is NULL
+*
+* @return      XST_SUCCESS on success, XST_INVALID_PARAM if the table is
+*              empty.
+*
+*****************************************************************************/
+s32 Xil_DimInit(Xil_Dim *Dim, const Xil_DimProfile *Profiles,
+		u32 NumProfiles)
+{
+	if (Dim == NULL) {
+		return (s32)XST_INVALID_PARAM;
+	}
+
+	if (Profiles == NULL) {
+		Profiles = Xil_DimDefaultProfiles;
+		NumProfiles = XIL_DIM_DEFAULT_PROFILES;
+	}
+
+	if (NumProfiles == 0U) {
+		return (s32)XST_INVALID_PARAM;
+	}
+
+	Dim->Profiles = Profiles;
+	Dim->NumProfiles = NumProfiles;
+	Dim->MinLevel = 0U;
+	Dim->MaxLevel = NumProfiles - 1U;
+	Dim->Level = 0U;
+	Dim->Rest = 0U;
+	Dim->Prev.Packets = 0U;
+	Dim->Prev.Bytes = 0U;
+	Dim->Prev.Events = 0U;
+	Dim->Epochs = 0U;
+	Dim->Changes = 0U;
+	Xil_DimPark(Dim);
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function limits the profiles a controller uses. The
+*              current profile is moved into the new bounds.
+*
+* @param       Dim: pointer to the controller
+* @param       MinLevel: lowest profile to use
+* @param       MaxLevel: highest profile to use, it bounds the latency added
+*              by coalescing
+*
+* @return      XST_SUCCESS on success, XST_INVALID_PARAM if the bounds are
+*              not within the profile table.
+*
+*****************************************************************************/
+s32 Xil_DimSetBounds(Xil_Dim *Dim, u32 MinLevel, u32 MaxLevel)
+{
+	if ((Dim == NULL) || (MinLevel > MaxLevel) ||
+	    (MaxLevel >= Dim->NumProfiles)) {
+		return (s32)XST_INVALID_PARAM;
+	}
+
+	Dim->MinLevel = MinLevel;
+	Dim->MaxLevel = MaxLevel;
+
+	if (Dim->Level < MinLevel) {
+		Dim->Level = MinLevel;
+		Dim->Changes++;
+	} else if (Dim->Level > MaxLevel) {
+		Dim->Level = MaxLevel;
+		Dim->Changes++;
+	} else {
+		/* Level is within the new bounds */
+	}
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function feeds the load of one epoch to a controller and
+*              moves it to a new profile if needed.
+*
+* @param       Dim: pointer to the controller
+* @param       Sample: load of the epoch, epochs must be of equal length
+*
+* @return      1 if the profile changed and must be applied to the hardware,
+*              0 otherwise.
+*
+*****************************************************************************/
+u32 Xil_DimUpdate(Xil_Dim *Dim, const Xil_DimSample *Sample)
+{
+	u32 OldLevel = Dim->Level;
+	u32 Result;
+
+	Dim->Epochs++;
+
+	if (Sample->Packets == 0U) {
+		/* Idle, be ready for the next packet with the least latency */
+		Dim->Level = Dim->MinLevel;
+		Xil_DimPark(Dim);
+		Dim->Prev = *Sample;
+		goto Done;
+	}
+
+	Result = Xil_DimCompare(Sample, &Dim->Prev);
+
+	switch (Dim->State) {
+	case XIL_DIM_STATE_PARKED:
+		if (Result == XIL_DIM_SAME) {
+			/* Compare against the epoch the park was decided on */
+			goto Done;
+		}
+		Dim->State = (Dim->Level > Dim->MinLevel) ?
+			XIL_DIM_STATE_DOWN : XIL_DIM_STATE_UP;
+		Xil_DimStep(Dim);
+		break;
+
+	case XIL_DIM_STATE_RESTING:
+		Dim->Rest--;
+		if (Dim->Rest == 0U) {
+			Dim->State = (Dim->Level > Dim->MinLevel) ?
+				XIL_DIM_STATE_DOWN : XIL_DIM_STATE_UP;
+			Xil_DimStep(Dim);
+		}
+		break;
+
+	default:
+		if (Result != XIL_DIM_BETTER) {
+			/*
+			 * The last step did not help. Step back once, and
+			 * park if stepping back did not help either.
+			 */
+			if (Dim->Turns != 0U) {
+				Xil_DimPark(Dim);
+				break;
+			}
+			Dim->State = (Dim->State == XIL_DIM_STATE_UP) ?
+				XIL_DIM_STATE_DOWN : XIL_DIM_STATE_UP;
+			Dim->Turns++;
+			Dim->Steps = 0U;
+		}
+		Xil_DimStep(Dim);
+		break;
+	}
+
+	Dim->Prev = *Sample;
+
+Done:
+	if (Dim->Level != OldLevel) {
+		Dim->Changes++;
+		return 1U;
+	}
+
+	return 0U;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function tells whether two values differ by at least
+*              XIL_DIM_SIGNIFICANT_PCT percent of the previous one.
+*
+* @param       Curr: value of the current epoch
+* @param       Prev: value of the previous epoch
+*
+* @return      1 if the values differ significantly, 0 otherwise.
+*
+*****************************************************************************/
+static u32 Xil_DimDiffers(u32 Curr, u32 Prev)
+{
+	u64 Diff;
+
+	if (Prev == 0U) {
+		return (Curr != 0U) ? 1U : 0U;
+	}
+
+	Diff = (Curr > Prev) ? (u64)(Curr - Prev) : (u64)(Prev - Curr);
+
+	return ((Diff * 100U) >= ((u64)Prev * XIL_DIM_SIGNIFICANT_PCT)) ?
+		1U : 0U;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function compares the load of two epochs. A higher
+*              throughput is better, at the same throughput fewer interrupts
+*              are better.
+*
+* @param       Curr: load of the current epoch
+* @param       Prev: load of the previous epoch
+*
+* @return      XIL_DIM_BETTER, XIL_DIM_SAME or XIL_DIM_WORSE.
+*
+*****************************************************************************/
+static u32 Xil_DimCompare(const Xil_DimSample *Curr,
+			  const Xil_DimSample *Prev)
+{
+	u32 CurrRate = Curr->Packets;
+	u32 PrevRate = Prev->Packets;
+
+	if ((Curr->Bytes != 0U) && (Prev->Bytes != 0U)) {
+		CurrRate = Curr->Bytes;
+		PrevRate = Prev->Bytes;
+	}
+
+	if (Xil_DimDiffers(CurrRate, PrevRate) != 0U) {
+		return (CurrRate > PrevRate) ? XIL_DIM_BETTER : XIL_DIM_WORSE;
+	}
+
+	if (Xil_DimDiffers(Curr->Events, Prev->Events) != 0U) {
+		return (Curr->Events < Prev->Events) ?
+			XIL_DIM_BETTER : XIL_DIM_WORSE;
+	}
+
+	return XIL_DIM_SAME;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function parks a controller on its current profile.
+*
+* @param       Dim: pointer to the controller
+*
+* @return      None.
+*
+*****************************************************************************/
+static void Xil_DimPark(Xil_Dim *Dim)
+{
+	Dim->State = XIL_DIM_STATE_PARKED;
+	Dim->Steps = 0U;
+	Dim->Turns = 0U;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function moves a controller one profile in its current
+*              direction. The controller parks at the bounds and rests after
+*              XIL_DIM_MAX_STEPS steps in one direction.
+*
+* @param       Dim: pointer to the controller
+*
+* @return      None.
+*
+*****************************************************************************/
+static void Xil_DimStep(Xil_Dim *Dim)
+{
+	if (Dim->Steps >= XIL_DIM_MAX_STEPS) {
+		Dim->State = XIL_DIM_STATE_RESTING;
+		Dim->Rest = XIL_DIM_REST_EPOCHS;
+		Dim->Steps = 0U;
+		Dim->Turns = 0U;
+		return;
+	}
+
+	if (Dim->State == XIL_DIM_STATE_UP) {
+		if (Dim->Level >= Dim->MaxLevel) {
+			Xil_DimPark(Dim);
+			return;
+		}
+		Dim->Level++;
+	} else {
+		if (Dim->Level <= Dim->MinLevel) {
+			Xil_DimPark(Dim);
+			return;
+		}
+		Dim->Level--;
+	}
+
+	Dim->Steps++;
+}
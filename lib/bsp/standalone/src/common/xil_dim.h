@@ -0,0 +1,153 @@
+/******************************************************************************/
+/**
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+* @file xil_dim.h
+*
+* @addtogroup common_dim_apis Adaptive Interrupt Moderation
+*
+* The xil_dim.h file contains a controller that adapts the interrupt
+* coalescing of a completion ring to its load. The controller steps through
+* a table of profiles, each a coalesce count and a delay timer value, ordered
+* from the lowest latency to the highest coalescing.
+*
+* - The owner of the ring calls Xil_DimUpdate once per epoch, a fixed
+*   interval such as a timer tick, with the packets, bytes and interrupts
+*   of that epoch.
+* - The controller compares the epoch with the previous one and keeps
+*   stepping in the same direction while the throughput improves, or the
+*   interrupt count drops at the same throughput. It turns around when the
+*   result gets worse and parks once it settles between two profiles.
+* - An idle epoch returns the controller to the lowest latency profile and
+*   a parked controller leaves the park when the load changes.
+* - Xil_DimSetBounds limits the profiles used, the highest profile allowed
+*   bounds the added latency.
+*
+* The AXI DMA and MCDMA drivers use this controller for their rings and
+* channels, see XAxiDma_BdRingDimUpdate and XMcdma_ChanDimUpdate.
+*
+* @{
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who      Date     Changes
+* ----- -------- -------- -----------------------------------------------
+* 8.1   ag       10/14/26 First release.
+*
+* </pre>
+*
+*****************************************************************************/
+#ifndef XIL_DIM_H		/* prevent circular inclusions */
+#define XIL_DIM_H		/* by using protection macros */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files ********************************/
+
+#include "xil_types.h"
+#include "xstatus.h"
+
+/************************** Constant Definitions ****************************/
+
+/**
+ * @name Controller states
+ * @{
+ */
+#define XIL_DIM_STATE_PARKED	0U	/**< Settled on a profile */
+#define XIL_DIM_STATE_UP	1U	/**< Moving to more coalescing */
+#define XIL_DIM_STATE_DOWN	2U	/**< Moving to less latency */
+#define XIL_DIM_STATE_RESTING	3U	/**< Paused after too many steps */
+/*@}*/
+
+/** Number of profiles in the default profile table */
+#define XIL_DIM_DEFAULT_PROFILES	6U
+
+/** Steps in one direction before the controller rests */
+#ifndef XIL_DIM_MAX_STEPS
+#define XIL_DIM_MAX_STEPS	10U
+#endif
+
+/** Epochs the controller rests before it starts stepping again */
+#ifndef XIL_DIM_REST_EPOCHS
+#define XIL_DIM_REST_EPOCHS	5U
+#endif
+
+/** Percentage by which two epochs must differ to count as a change */
+#ifndef XIL_DIM_SIGNIFICANT_PCT
+#define XIL_DIM_SIGNIFICANT_PCT	10U
+#endif
+
+/**************************** Type Definitions ******************************/
+
+/**
+ * One moderation profile. The units of Timer are those of the delay timer
+ * of the DMA engine the profile is applied to.
+ */
+typedef struct {
+	u32 Count;		/**< Interrupt coalesce count */
+	u32 Timer;		/**< Interrupt delay timer, 0 disables it */
+} Xil_DimProfile;
+
+/**
+ * Load of one epoch.
+ */
+typedef struct {
+	u32 Packets;		/**< Packets completed */
+	u32 Bytes;		/**< Bytes completed, 0 if not counted */
+	u32 Events;		/**< Interrupts taken */
+} Xil_DimSample;
+
+/**
+ * Moderation controller of one ring.
+ */
+typedef struct {
+	const Xil_DimProfile *Profiles;	/**< Profile table */
+	u32 NumProfiles;	/**< Number of profiles in the table */
+	u32 MinLevel;		/**< Lowest profile used */
+	u32 MaxLevel;		/**< Highest profile used */
+	u32 Level;		/**< Current profile */
+	u32 State;		/**< XIL_DIM_STATE_* */
+	u32 Steps;		/**< Steps in the current direction */
+	u32 Turns;		/**< Direction changes since the last park */
+	u32 Rest;		/**< Epochs left to rest */
+	Xil_DimSample Prev;	/**< Load of the previous epoch */
+	u32 Epochs;		/**< Epochs seen */
+	u32 Changes;		/**< Profile changes made */
+} Xil_Dim;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/** Returns the current profile of a controller */
+#define Xil_DimGetProfile(Dim)	(&(Dim)->Profiles[(Dim)->Level])
+
+/** Returns the index of the current profile of a controller */
+#define Xil_DimGetLevel(Dim)	((Dim)->Level)
+
+/** Returns the state of a controller, one of XIL_DIM_STATE_* */
+#define Xil_DimGetState(Dim)	((Dim)->State)
+
+/************************** Variable Definitions ****************************/
+
+extern const Xil_DimProfile Xil_DimDefaultProfiles[XIL_DIM_DEFAULT_PROFILES];
+
+/************************** Function Prototypes *****************************/
+
+s32 Xil_DimInit(Xil_Dim *Dim, const Xil_DimProfile *Profiles,
+		u32 NumProfiles);
+s32 Xil_DimSetBounds(Xil_Dim *Dim, u32 MinLevel, u32 MaxLevel);
+u32 Xil_DimUpdate(Xil_Dim *Dim, const Xil_DimSample *Sample);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XIL_DIM_H */
+/**
+* @} End of "addtogroup common_dim_apis".
+*/
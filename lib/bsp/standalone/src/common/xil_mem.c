@@ -22,6 +22,9 @@
 * 			  violations.
 * 7.7	sk	 01/10/22 Include xil_mem.h header file to fix Xil_MemCpy
 * 			  prototype misra_c_2012_rule_8_4 violation.
+* 8.1   ag       10/14/26 Copy the bulk of equally aligned buffers with
+*                         LDP/STP bursts on AArch64 and LDM/STM bursts on
+*                         Cortex-R5/R52.
 *
 * </pre>
 *
@@ -32,10 +35,88 @@
 #include "xil_types.h"
 #include "xil_mem.h"
 
+/************************** Constant Definitions ****************************/
+
+/*
+ * Width of the burst loop selected for the processor at build time. The
+ * AArch64 path moves 64 bytes per iteration with LDP/STP pairs, the
+ * Cortex-R5/R52 path moves 32 bytes per iteration with an 8 register
+ * LDM/STM burst. Other processors use the word copy loop.
+ */
+#if defined (__aarch64__) && defined (__GNUC__)
+#define XIL_MEM_BURST_SIZE	64U
+#define XIL_MEM_ALIGN_MASK	0x7U
+#elif defined (ARMR5) && defined (__GNUC__)
+#define XIL_MEM_BURST_SIZE	32U
+#define XIL_MEM_ALIGN_MASK	0x3U
+#endif
+
+/************************** Function Prototypes *****************************/
+
+#ifdef XIL_MEM_BURST_SIZE
+static void Xil_MemCpyBurst(char *d, const char *s, u32 bursts);
+#endif
+
 /***************** Inline Functions Definitions ********************/
+#ifdef XIL_MEM_BURST_SIZE
+/*****************************************************************************/
+/**
+* @brief       This function copies XIL_MEM_BURST_SIZE byte blocks using the
+*              widest load/store instructions supported by the processor.
+*
+* @param       d: pointer to destination memory, aligned to
+*              XIL_MEM_ALIGN_MASK + 1
+*
+* @param       s: pointer to source memory, aligned to
+*              XIL_MEM_ALIGN_MASK + 1
+*
+* @param       bursts: number of XIL_MEM_BURST_SIZE byte blocks to be copied
+*
+*****************************************************************************/
+static void Xil_MemCpyBurst(char *d, const char *s, u32 bursts)
+{
+#if defined (__aarch64__)
+	u64 Count = bursts;
+
+	__asm__ __volatile__(
+		"1:\n"
+		"ldp x4, x5, [%1, #0]\n"
+		"ldp x6, x7, [%1, #16]\n"
+		"ldp x8, x9, [%1, #32]\n"
+		"ldp x10, x11, [%1, #48]\n"
+		"add %1, %1, #64\n"
+		"stp x4, x5, [%0, #0]\n"
+		"stp x6, x7, [%0, #16]\n"
+		"stp x8, x9, [%0, #32]\n"
+		"stp x10, x11, [%0, #48]\n"
+		"add %0, %0, #64\n"
+		"subs %2, %2, #1\n"
+		"b.ne 1b\n"
+		: "+r" (d), "+r" (s), "+r" (Count)
+		:
+		: "x4", "x5", "x6", "x7", "x8", "x9", "x10", "x11",
+		  "cc", "memory");
+#else
+	__asm__ __volatile__(
+		"1:\n"
+		"ldmia %1!, {r3-r6, r8-r10, r12}\n"
+		"stmia %0!, {r3-r6, r8-r10, r12}\n"
+		"subs %2, %2, #1\n"
+		"bne 1b\n"
+		: "+r" (d), "+r" (s), "+r" (bursts)
+		:
+		: "r3", "r4", "r5", "r6", "r8", "r9", "r10", "r12",
+		  "cc", "memory");
+#endif
+}
+#endif
+
 /*****************************************************************************/
 /**
 * @brief       This  function copies memory from once location to other.
+*              When source and destination share the same alignment, the
+*              head bytes are copied until both are aligned and the bulk of
+*              the buffer is moved with the burst loop of the processor.
 *
 * @param       dst: pointer pointing to destination memory
 *
@@ -49,6 +130,25 @@ void Xil_MemCpy(void* dst, const void* src, u32 cnt)
 	char *d = (char*)(void *)dst;
 	const char *s = src;
 
+#ifdef XIL_MEM_BURST_SIZE
+	if ((((UINTPTR)d ^ (UINTPTR)s) & XIL_MEM_ALIGN_MASK) == 0U) {
+		while ((((UINTPTR)d & XIL_MEM_ALIGN_MASK) != 0U) && (cnt > 0U)) {
+			*d = *s;
+			d += 1U;
+			s += 1U;
+			cnt -= 1U;
+		}
+		if (cnt >= XIL_MEM_BURST_SIZE) {
+			u32 Bursts = cnt / XIL_MEM_BURST_SIZE;
+
+			Xil_MemCpyBurst(d, s, Bursts);
+			d += Bursts * XIL_MEM_BURST_SIZE;
+			s += Bursts * XIL_MEM_BURST_SIZE;
+			cnt -= Bursts * XIL_MEM_BURST_SIZE;
+		}
+	}
+#endif
+
 	while (cnt >= sizeof (s32)) {
 		*(s32*)d = *(s32*)s;
 		d += sizeof (s32);
@@ -0,0 +1,316 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+* @file xil_perfstats.c
+*
+* This file contains the registry of driver performance counters. Refer
+* xil_perfstats.h for the description.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who      Date     Changes
+* ----- -------- -------- -----------------------------------------------
+* 8.1   ag       10/15/26 First release.
+*
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+
+#include "xil_perfstats.h"
+
+#ifdef XIL_PERF_STATS_ENABLE
+#include "xil_printf.h"
+#include "xstatus.h"
+
+/************************** Function Prototypes *****************************/
+
+static void Xil_PerfStatsPrintOne(void *CallBackRef,
+				  const Xil_PerfStats *Stats);
+static void Xil_PerfStatsPrintU64(const char *Label, u64 Value);
+
+/************************** Variable Definitions ****************************/
+
+static Xil_PerfStats *Blocks[XIL_PERF_STATS_MAX_BLOCKS];
+static Xil_PerfStatsClock Clock;
+
+/*****************************************************************************/
+/**
+* @brief       This function clears a counter block and adds it to the
+*              registry. Registering a block again only clears it.
+*
+* @param       Stats: pointer to the counter block
+* @param       Name: driver or channel name, not copied
+* @param       BaseAddress: base address of the instance
+*
+* @return
+*              - XST_SUCCESS if the block is registered.
+*              - XST_FAILURE if the registry is full, the block still
+*                counts but is not visited by Xil_PerfStatsWalk.
+*
+* @note        The registry is not locked, register blocks before enabling
+*              the interrupts of the instance.
+*
+*****************************************************************************/
+s32 Xil_PerfStatsRegister(Xil_PerfStats *Stats, const char *Name,
+			  UINTPTR BaseAddress)
+{
+	u32 Index;
+	u32 Free = XIL_PERF_STATS_MAX_BLOCKS;
+
+	if (Stats == NULL) {
+		return (s32)XST_FAILURE;
+	}
+
+	Stats->Name = Name;
+	Stats->BaseAddress = BaseAddress;
+	Xil_PerfStatsReset(Stats);
+
+	for (Index = 0U; Index < XIL_PERF_STATS_MAX_BLOCKS; Index++) {
+		if (Blocks[Index] == Stats) {
+			return (s32)XST_SUCCESS;
+		}
+		if ((Blocks[Index] == NULL) &&
+		    (Free == XIL_PERF_STATS_MAX_BLOCKS)) {
+			Free = Index;
+		}
+	}
+
+	if (Free == XIL_PERF_STATS_MAX_BLOCKS) {
+		return (s32)XST_FAILURE;
+	}
+
+	Blocks[Free] = Stats;
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function removes a counter block from the registry.
+*
+* @param       Stats: pointer to the counter block
+*
+* @return      None.
+*
+*****************************************************************************/
+void Xil_PerfStatsUnregister(Xil_PerfStats *Stats)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < XIL_PERF_STATS_MAX_BLOCKS; Index++) {
+		if ((Stats != NULL) && (Blocks[Index] == Stats)) {
+			Blocks[Index] = NULL;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function counts a batch of operations completed in one
+*              call.
+*
+* @param       Stats: pointer to the counter block
+* @param       NumOps: number of operations, 0 is not counted
+* @param       NumBytes: bytes moved by the operations
+*
+* @return      None.
+*
+*****************************************************************************/
+void Xil_PerfStatsAddOps(Xil_PerfStats *Stats, u32 NumOps, u64 NumBytes)
+{
+	if (NumOps == 0U) {
+		return;
+	}
+
+	Stats->Ops += NumOps;
+	Stats->Bytes += NumBytes;
+	if (NumOps > Stats->MaxBatch) {
+		Stats->MaxBatch = NumOps;
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function sets the clock that times busy waits.
+*
+* @param       ClockFn: free running clock, for example XTime_GetTime, or
+*              NULL to stop timing busy waits
+*
+* @return      None.
+*
+*****************************************************************************/
+void Xil_PerfStatsSetClock(Xil_PerfStatsClock ClockFn)
+{
+	Clock = ClockFn;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function reads the busy wait clock.
+*
+* @return      Clock count, 0 if no clock is set.
+*
+*****************************************************************************/
+u64 Xil_PerfStatsNow(void)
+{
+	u64 Now = 0U;
+
+	if (Clock != NULL) {
+		Now = Clock();
+	}
+
+	return Now;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function copies the counters of a block.
+*
+* @param       Stats: pointer to the counter block
+* @param       Snapshot: pointer to the copy
+*
+* @return      None.
+*
+*****************************************************************************/
+void Xil_PerfStatsGet(const Xil_PerfStats *Stats, Xil_PerfStats *Snapshot)
+{
+	if ((Stats == NULL) || (Snapshot == NULL)) {
+		return;
+	}
+
+	*Snapshot = *Stats;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function clears the counters of a block. The name, base
+*              address and registration are kept.
+*
+* @param       Stats: pointer to the counter block
+*
+* @return      None.
+*
+*****************************************************************************/
+void Xil_PerfStatsReset(Xil_PerfStats *Stats)
+{
+	if (Stats == NULL) {
+		return;
+	}
+
+	Stats->Ops = 0U;
+	Stats->Bytes = 0U;
+	Stats->Intrs = 0U;
+	Stats->BusyCycles = 0U;
+	Stats->BusyStart = 0U;
+	Stats->Errors = 0U;
+	Stats->MaxBatch = 0U;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function clears the counters of every registered block.
+*
+* @return      None.
+*
+*****************************************************************************/
+void Xil_PerfStatsResetAll(void)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < XIL_PERF_STATS_MAX_BLOCKS; Index++) {
+		Xil_PerfStatsReset(Blocks[Index]);
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function calls a visitor for every registered block.
+*
+* @param       Visitor: function called with each block
+* @param       CallBackRef: argument passed to the visitor
+*
+* @return      None.
+*
+* @note        The visitor must not register or unregister blocks.
+*
+*****************************************************************************/
+void Xil_PerfStatsWalk(Xil_PerfStatsVisitor Visitor, void *CallBackRef)
+{
+	u32 Index;
+
+	if (Visitor == NULL) {
+		return;
+	}
+
+	for (Index = 0U; Index < XIL_PERF_STATS_MAX_BLOCKS; Index++) {
+		if (Blocks[Index] != NULL) {
+			Visitor(CallBackRef, Blocks[Index]);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function prints every registered block with xil_printf.
+*              The 64-bit counters are printed in hexadecimal.
+*
+* @return      None.
+*
+*****************************************************************************/
+void Xil_PerfStatsPrint(void)
+{
+	Xil_PerfStatsWalk(Xil_PerfStatsPrintOne, NULL);
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function prints one block.
+*
+* @param       CallBackRef: unused
+* @param       Stats: pointer to the counter block
+*
+* @return      None.
+*
+*****************************************************************************/
+static void Xil_PerfStatsPrintOne(void *CallBackRef,
+				  const Xil_PerfStats *Stats)
+{
+	(void)CallBackRef;
+
+	xil_printf("%s 0x%08x:", (Stats->Name != NULL) ? Stats->Name : "?",
+		   (u32)Stats->BaseAddress);
+	Xil_PerfStatsPrintU64(" ops", Stats->Ops);
+	Xil_PerfStatsPrintU64(" bytes", Stats->Bytes);
+	Xil_PerfStatsPrintU64(" intrs", Stats->Intrs);
+	Xil_PerfStatsPrintU64(" busy", Stats->BusyCycles);
+	xil_printf(" errors %d maxbatch %d\r\n", Stats->Errors,
+		   Stats->MaxBatch);
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function prints a 64-bit counter in hexadecimal, as
+*              xil_printf has no 64-bit format on 32-bit processors.
+*
+* @param       Label: text printed before the value
+* @param       Value: counter value
+*
+* @return      None.
+*
+*****************************************************************************/
+static void Xil_PerfStatsPrintU64(const char *Label, u64 Value)
+{
+	xil_printf("%s 0x%08x%08x", Label, (u32)(Value >> 32U), (u32)Value);
+}
+
+#endif /* XIL_PERF_STATS_ENABLE */
+/**
+* @} End of "addtogroup common_perfstats_apis".
+*/
@@ -0,0 +1,158 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+* @file xil_perfstats.h
+*
+* @addtogroup common_perfstats_apis Driver Performance Counters
+*
+* The xil_perfstats.h file contains a counter block that drivers keep per
+* instance, or per channel, on their hot paths, and a registry through which
+* an application reads all of them.
+*
+* - A counter block counts operations and their bytes, interrupts, errors,
+*   the time spent busy waiting on the hardware and the largest number of
+*   operations completed in a single call.
+* - A driver registers its blocks from its CfgInitialize function, with the
+*   driver name and the base address of the instance. The registry holds
+*   pointers to the blocks, so drivers that clear their instance on
+*   initialization can register again.
+* - Xil_PerfStatsGet and Xil_PerfStatsReset query and clear one block,
+*   Xil_PerfStatsWalk visits every registered block and Xil_PerfStatsPrint
+*   prints all of them.
+* - Busy waits are timed with the clock set by Xil_PerfStatsSetClock, for
+*   example XTime_GetTime. Without a clock they are not timed.
+*
+* The counter blocks and the XIL_PERF_STATS_* macros compile to nothing
+* unless the BSP is built with the perf_stats parameter, which defines
+* XIL_PERF_STATS_ENABLE, so the instrumentation stays in the driver sources
+* at no cost.
+*
+* Counters are updated without locks, from the thread that owns the driver
+* instance and from its interrupt handler. A reading taken while the driver
+* runs can be off by the operation in flight.
+*
+* @{
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who      Date     Changes
+* ----- -------- -------- -----------------------------------------------
+* 8.1   ag       10/15/26 First release.
+*
+* </pre>
+*
+*****************************************************************************/
+#ifndef XIL_PERFSTATS_H		/* prevent circular inclusions */
+#define XIL_PERFSTATS_H		/* by using protection macros */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files ********************************/
+
+#include "xil_types.h"
+#include "xparameters.h"
+
+/************************** Constant Definitions ****************************/
+
+/**
+ * Number of counter blocks the registry holds.
+ */
+#ifndef XIL_PERF_STATS_MAX_BLOCKS
+#define XIL_PERF_STATS_MAX_BLOCKS	64U
+#endif
+
+/**************************** Type Definitions ******************************/
+
+/**
+ * Time source of busy wait timing, returns a free running count.
+ */
+typedef u64 (*Xil_PerfStatsClock)(void);
+
+/**
+ * Counter block of one driver instance or channel.
+ */
+typedef struct {
+	const char *Name;	/**< Driver or channel name */
+	UINTPTR BaseAddress;	/**< Base address of the instance */
+	u64 Ops;		/**< Operations completed */
+	u64 Bytes;		/**< Bytes moved by the operations */
+	u64 Intrs;		/**< Interrupts handled */
+	u64 BusyCycles;		/**< Clock counts spent busy waiting */
+	u64 BusyStart;		/**< Clock at the start of the busy wait */
+	u32 Errors;		/**< Errors reported by the hardware */
+	u32 MaxBatch;		/**< Most operations completed in one call */
+} Xil_PerfStats;
+
+/**
+ * Visitor of Xil_PerfStatsWalk.
+ */
+typedef void (*Xil_PerfStatsVisitor)(void *CallBackRef,
+				     const Xil_PerfStats *Stats);
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#ifdef XIL_PERF_STATS_ENABLE
+
+/** Registers a counter block */
+#define XIL_PERF_STATS_REGISTER(Stats, Name, BaseAddress) \
+	Xil_PerfStatsRegister((Stats), (Name), (UINTPTR)(BaseAddress))
+
+/** Counts a batch of operations and their bytes */
+#define XIL_PERF_STATS_OPS(Stats, NumOps, NumBytes) \
+	Xil_PerfStatsAddOps((Stats), (u32)(NumOps), (u64)(NumBytes))
+
+/** Counts an interrupt */
+#define XIL_PERF_STATS_INTR(Stats)	((Stats)->Intrs++)
+
+/** Counts an error */
+#define XIL_PERF_STATS_ERROR(Stats)	((Stats)->Errors++)
+
+/** Starts timing a busy wait */
+#define XIL_PERF_STATS_BUSY_BEGIN(Stats) \
+	((Stats)->BusyStart = Xil_PerfStatsNow())
+
+/** Ends timing a busy wait */
+#define XIL_PERF_STATS_BUSY_END(Stats) \
+	((Stats)->BusyCycles += Xil_PerfStatsNow() - (Stats)->BusyStart)
+
+#else
+
+#define XIL_PERF_STATS_REGISTER(Stats, Name, BaseAddress)
+#define XIL_PERF_STATS_OPS(Stats, NumOps, NumBytes)
+#define XIL_PERF_STATS_INTR(Stats)
+#define XIL_PERF_STATS_ERROR(Stats)
+#define XIL_PERF_STATS_BUSY_BEGIN(Stats)
+#define XIL_PERF_STATS_BUSY_END(Stats)
+
+#endif
+
+/************************** Function Prototypes *****************************/
+
+#ifdef XIL_PERF_STATS_ENABLE
+s32 Xil_PerfStatsRegister(Xil_PerfStats *Stats, const char *Name,
+			  UINTPTR BaseAddress);
+void Xil_PerfStatsUnregister(Xil_PerfStats *Stats);
+void Xil_PerfStatsAddOps(Xil_PerfStats *Stats, u32 NumOps, u64 NumBytes);
+void Xil_PerfStatsSetClock(Xil_PerfStatsClock Clock);
+u64 Xil_PerfStatsNow(void);
+void Xil_PerfStatsGet(const Xil_PerfStats *Stats, Xil_PerfStats *Snapshot);
+void Xil_PerfStatsReset(Xil_PerfStats *Stats);
+void Xil_PerfStatsResetAll(void);
+void Xil_PerfStatsWalk(Xil_PerfStatsVisitor Visitor, void *CallBackRef);
+void Xil_PerfStatsPrint(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XIL_PERFSTATS_H */
+/**
+* @} End of "addtogroup common_perfstats_apis".
+*/
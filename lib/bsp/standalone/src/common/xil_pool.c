@@ -0,0 +1,525 @@
+/******************************************************************************/
+/**
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+* @file xil_pool.c
+*
+* This file contains the fixed size block pool allocator. Refer xil_pool.h
+* for the description of the allocator.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who      Date     Changes
+* ----- -------- -------- -----------------------------------------------
+* 8.1   ag       10/14/26 First release.
+*
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "xil_pool.h"
+#if defined (__aarch64__) || defined (__arm__) || defined (__ICCARM__)
+#include "xpseudo_asm.h"
+#elif defined (__MICROBLAZE__)
+#include "mb_interface.h"
+#endif
+
+/************************** Constant Definitions ****************************/
+
+#if defined (__aarch64__) || defined (__arm__) || defined (__ICCARM__)
+#define XIL_POOL_IRQ_FIQ_MASK	0xC0U	/* Mask IRQ and FIQ interrupts */
+#elif defined (__MICROBLAZE__)
+#define XIL_POOL_MSR_IE_MASK	0x2U	/* MSR interrupt enable bit */
+#endif
+
+/**************************** Type Definitions ******************************/
+
+typedef struct Xil_PoolBlock {
+	struct Xil_PoolBlock *Next;
+} Xil_PoolBlock;
+
+/************************** Variable Definitions ****************************/
+
+static Xil_PoolSet *PoolDefaultSet;
+
+/************************** Function Prototypes *****************************/
+
+static UINTPTR Xil_PoolIrqSave(void);
+static void Xil_PoolIrqRestore(UINTPTR Flags);
+#if (XIL_POOL_NUM_CPUS > 1U)
+static u32 Xil_PoolCpuId(void);
+static void Xil_PoolLockShared(Xil_Pool *Pool);
+static void Xil_PoolUnlockShared(Xil_Pool *Pool);
+#endif
+
+/*****************************************************************************/
+/**
+* @brief       This function initializes a pool over caller provided memory.
+*
+* @param       Pool: pointer to the pool instance
+* @param       Mem: pointer to the pool memory
+* @param       MemSize: size of the pool memory in bytes
+* @param       BlockSize: size of a block in bytes
+* @param       Align: alignment of every block, a power of two. Pass
+*              XIL_POOL_CACHELINE for blocks used as DMA buffers.
+*
+* @return      XST_SUCCESS on success, XST_INVALID_PARAM if the parameters
+*              are invalid or the memory cannot hold a single block.
+*
+*****************************************************************************/
+s32 Xil_PoolInit(Xil_Pool *Pool, void *Mem, u32 MemSize, u32 BlockSize,
+		u32 Align)
+{
+	UINTPTR Start;
+	UINTPTR End;
+	Xil_PoolBlock *Block;
+	u32 Index;
+
+	if ((Pool == NULL) || (Mem == NULL) || (BlockSize == 0U) ||
+			(Align == 0U) || ((Align & (Align - 1U)) != 0U)) {
+		return (s32)XST_INVALID_PARAM;
+	}
+
+	if (Align < sizeof(void *)) {
+		Align = sizeof(void *);
+	}
+	if (BlockSize < sizeof(Xil_PoolBlock)) {
+		BlockSize = sizeof(Xil_PoolBlock);
+	}
+	BlockSize = (BlockSize + Align - 1U) & ~(Align - 1U);
+
+	Start = ((UINTPTR)Mem + Align - 1U) & ~((UINTPTR)Align - 1U);
+	End = (UINTPTR)Mem + MemSize;
+	if ((Start + BlockSize) > End) {
+		return (s32)XST_INVALID_PARAM;
+	}
+
+	(void)memset(Pool, 0, sizeof(*Pool));
+	Pool->BlockSize = BlockSize;
+	Pool->NumBlocks = (u32)((End - Start) / BlockSize);
+	Pool->Start = Start;
+	Pool->End = Start + ((UINTPTR)Pool->NumBlocks * BlockSize);
+
+	/* Chain the blocks in address order */
+	for (Index = Pool->NumBlocks; Index > 0U; Index--) {
+		Block = (Xil_PoolBlock *)(Start +
+				((UINTPTR)(Index - 1U) * BlockSize));
+		Block->Next = (Xil_PoolBlock *)Pool->FreeList;
+		Pool->FreeList = Block;
+	}
+	Pool->FreeCount = Pool->NumBlocks;
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function allocates a block from a pool.
+*
+* @param       Pool: pointer to the pool instance
+*
+* @return      Pointer to the block, NULL if the pool is exhausted.
+*
+*****************************************************************************/
+void *Xil_PoolAlloc(Xil_Pool *Pool)
+{
+	Xil_PoolBlock *Block;
+	UINTPTR Flags;
+#if (XIL_POOL_NUM_CPUS > 1U)
+	Xil_PoolCpuCache *Cache;
+	u32 Count;
+#endif
+
+	Flags = Xil_PoolIrqSave();
+#if (XIL_POOL_NUM_CPUS > 1U)
+	Cache = &Pool->Cpu[Xil_PoolCpuId()];
+	if (Cache->Head == NULL) {
+		/* Refill the per-core cache with a batch from the shared list */
+		Xil_PoolLockShared(Pool);
+		for (Count = 0U; (Count < XIL_POOL_CPU_BATCH) &&
+				(Pool->FreeList != NULL); Count++) {
+			Block = (Xil_PoolBlock *)Pool->FreeList;
+			Pool->FreeList = Block->Next;
+			Block->Next = (Xil_PoolBlock *)Cache->Head;
+			Cache->Head = Block;
+		}
+		Pool->FreeCount -= Count;
+		Cache->Count += Count;
+		Xil_PoolUnlockShared(Pool);
+	}
+	Block = (Xil_PoolBlock *)Cache->Head;
+	if (Block != NULL) {
+		Cache->Head = Block->Next;
+		Cache->Count--;
+	}
+#else
+	Block = (Xil_PoolBlock *)Pool->FreeList;
+	if (Block != NULL) {
+		Pool->FreeList = Block->Next;
+		Pool->FreeCount--;
+	}
+#endif
+	Xil_PoolIrqRestore(Flags);
+
+	return (void *)Block;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function returns a block to its pool.
+*
+* @param       Pool: pointer to the pool instance
+* @param       Block: pointer to a block allocated from the pool
+*
+*****************************************************************************/
+void Xil_PoolFree(Xil_Pool *Pool, void *Block)
+{
+	Xil_PoolBlock *Free = (Xil_PoolBlock *)Block;
+	UINTPTR Flags;
+#if (XIL_POOL_NUM_CPUS > 1U)
+	Xil_PoolCpuCache *Cache;
+	u32 Count;
+#endif
+
+	if (Block == NULL) {
+		return;
+	}
+
+	Flags = Xil_PoolIrqSave();
+#if (XIL_POOL_NUM_CPUS > 1U)
+	Cache = &Pool->Cpu[Xil_PoolCpuId()];
+	Free->Next = (Xil_PoolBlock *)Cache->Head;
+	Cache->Head = Free;
+	Cache->Count++;
+	if (Cache->Count >= (2U * XIL_POOL_CPU_BATCH)) {
+		/* Drain a batch so idle cores do not hoard free blocks */
+		Xil_PoolLockShared(Pool);
+		for (Count = 0U; Count < XIL_POOL_CPU_BATCH; Count++) {
+			Free = (Xil_PoolBlock *)Cache->Head;
+			Cache->Head = Free->Next;
+			Free->Next = (Xil_PoolBlock *)Pool->FreeList;
+			Pool->FreeList = Free;
+		}
+		Pool->FreeCount += XIL_POOL_CPU_BATCH;
+		Cache->Count -= XIL_POOL_CPU_BATCH;
+		Xil_PoolUnlockShared(Pool);
+	}
+#else
+	Free->Next = (Xil_PoolBlock *)Pool->FreeList;
+	Pool->FreeList = Free;
+	Pool->FreeCount++;
+#endif
+	Xil_PoolIrqRestore(Flags);
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function checks whether a block belongs to a pool.
+*
+* @param       Pool: pointer to the pool instance
+* @param       Block: pointer to the block
+*
+* @return      TRUE if the block is part of the pool memory, FALSE otherwise.
+*
+*****************************************************************************/
+u32 Xil_PoolOwns(const Xil_Pool *Pool, const void *Block)
+{
+	UINTPTR Addr = (UINTPTR)Block;
+
+	if ((Addr >= Pool->Start) && (Addr < Pool->End)) {
+		return (u32)TRUE;
+	}
+
+	return (u32)FALSE;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function returns the number of free blocks of a pool,
+*              including the blocks held in per-core caches.
+*
+* @param       Pool: pointer to the pool instance
+*
+* @return      Number of free blocks.
+*
+*****************************************************************************/
+u32 Xil_PoolFreeBlocks(const Xil_Pool *Pool)
+{
+	u32 Count = Pool->FreeCount;
+#if (XIL_POOL_NUM_CPUS > 1U)
+	u32 Index;
+
+	for (Index = 0U; Index < XIL_POOL_NUM_CPUS; Index++) {
+		Count += Pool->Cpu[Index].Count;
+	}
+#endif
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function adds a pool to a pool set as a size class.
+*              Pools must be added in increasing order of block size.
+*
+* @param       Set: pointer to the pool set, zero initialized before the
+*              first call
+* @param       Pool: pointer to an initialized pool
+*
+* @return      XST_SUCCESS on success, XST_FAILURE if the set is full or the
+*              pool is out of order.
+*
+*****************************************************************************/
+s32 Xil_PoolSetAdd(Xil_PoolSet *Set, Xil_Pool *Pool)
+{
+	if ((Set->NumPools >= XIL_POOL_MAX_CLASSES) || ((Set->NumPools != 0U) &&
+			(Set->Pools[Set->NumPools - 1U]->BlockSize >=
+			 Pool->BlockSize))) {
+		return (s32)XST_FAILURE;
+	}
+
+	Set->Pools[Set->NumPools] = Pool;
+	Set->NumPools++;
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function allocates a block from the smallest size class
+*              that fits the request. A larger class is used when the best
+*              fitting class is exhausted.
+*
+* @param       Set: pointer to the pool set
+* @param       Size: requested size in bytes
+*
+* @return      Pointer to the block, NULL if no class can serve the request.
+*
+*****************************************************************************/
+void *Xil_PoolSetAlloc(Xil_PoolSet *Set, u32 Size)
+{
+	void *Block = NULL;
+	u32 Index;
+
+	for (Index = 0U; (Index < Set->NumPools) && (Block == NULL); Index++) {
+		if (Set->Pools[Index]->BlockSize >= Size) {
+			Block = Xil_PoolAlloc(Set->Pools[Index]);
+		}
+	}
+
+	return Block;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function returns a block to the size class owning it.
+*
+* @param       Set: pointer to the pool set
+* @param       Block: pointer to the block
+*
+* @return      XST_SUCCESS if the block is released, XST_FAILURE if it does
+*              not belong to the set.
+*
+*****************************************************************************/
+s32 Xil_PoolSetFree(Xil_PoolSet *Set, void *Block)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < Set->NumPools; Index++) {
+		if (Xil_PoolOwns(Set->Pools[Index], Block) == (u32)TRUE) {
+			Xil_PoolFree(Set->Pools[Index], Block);
+			return (s32)XST_SUCCESS;
+		}
+	}
+
+	return (s32)XST_FAILURE;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function registers the pool set backing Xil_PoolMalloc,
+*              Xil_PoolCalloc and Xil_PoolFreeAny.
+*
+* @param       Set: pointer to the pool set, NULL to use malloc only
+*
+* @note        Blocks allocated from a set must be freed before the set is
+*              replaced.
+*
+*****************************************************************************/
+void Xil_PoolSetDefault(Xil_PoolSet *Set)
+{
+	PoolDefaultSet = Set;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function allocates memory from the default pool set,
+*              falling back to malloc when no size class can serve it.
+*
+* @param       Size: requested size in bytes
+*
+* @return      Pointer to the memory, NULL on failure.
+*
+*****************************************************************************/
+void *Xil_PoolMalloc(u32 Size)
+{
+	void *Block = NULL;
+
+	if (PoolDefaultSet != NULL) {
+		Block = Xil_PoolSetAlloc(PoolDefaultSet, Size);
+	}
+	if (Block == NULL) {
+		Block = malloc(Size);
+	}
+
+	return Block;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function allocates zero initialized memory from the
+*              default pool set, falling back to malloc.
+*
+* @param       Count: number of elements
+* @param       Size: size of an element in bytes
+*
+* @return      Pointer to the memory, NULL on failure.
+*
+*****************************************************************************/
+void *Xil_PoolCalloc(u32 Count, u32 Size)
+{
+	void *Block;
+
+	if ((Size != 0U) && (Count > (0xFFFFFFFFU / Size))) {
+		return NULL;
+	}
+
+	Block = Xil_PoolMalloc(Count * Size);
+	if (Block != NULL) {
+		(void)memset(Block, 0, Count * Size);
+	}
+
+	return Block;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function frees memory obtained from Xil_PoolMalloc or
+*              Xil_PoolCalloc.
+*
+* @param       Block: pointer to the memory
+*
+*****************************************************************************/
+void Xil_PoolFreeAny(void *Block)
+{
+	if (Block == NULL) {
+		return;
+	}
+	if ((PoolDefaultSet == NULL) ||
+			(Xil_PoolSetFree(PoolDefaultSet, Block) != XST_SUCCESS)) {
+		free(Block);
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function masks interrupts and returns the previous state.
+*
+* @return      Interrupt state to be passed to Xil_PoolIrqRestore.
+*
+*****************************************************************************/
+static UINTPTR Xil_PoolIrqSave(void)
+{
+	UINTPTR Flags = 0U;
+
+#if defined (XIL_POOL_IRQ_FIQ_MASK)
+	Flags = (UINTPTR)mfcpsr();
+	mtcpsr((u32)Flags | XIL_POOL_IRQ_FIQ_MASK);
+#elif defined (XIL_POOL_MSR_IE_MASK)
+	Flags = mfmsr();
+	mtmsr(Flags & ~(UINTPTR)XIL_POOL_MSR_IE_MASK);
+#endif
+
+	return Flags;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function restores the interrupt state.
+*
+* @param       Flags: value returned by Xil_PoolIrqSave
+*
+*****************************************************************************/
+static void Xil_PoolIrqRestore(UINTPTR Flags)
+{
+#if defined (XIL_POOL_IRQ_FIQ_MASK)
+	mtcpsr((u32)Flags);
+#elif defined (XIL_POOL_MSR_IE_MASK)
+	mtmsr(Flags);
+#else
+	(void)Flags;
+#endif
+}
+
+#if (XIL_POOL_NUM_CPUS > 1U)
+/*****************************************************************************/
+/**
+* @brief       This function returns the index of the executing core.
+*
+* @return      Core index, less than XIL_POOL_NUM_CPUS.
+*
+*****************************************************************************/
+static u32 Xil_PoolCpuId(void)
+{
+	u64 Mpidr = mfcp(MPIDR_EL1);
+	u32 CpuId;
+
+	/* Multi-threading cores report the core number in affinity level 1 */
+	if ((Mpidr & ((u64)1U << 24U)) != 0U) {
+		CpuId = (u32)(((Mpidr >> 16U) & 0xFFU) * 4U) +
+			(u32)((Mpidr >> 8U) & 0xFFU);
+	} else {
+		CpuId = (u32)(Mpidr & 0xFFU);
+	}
+
+	return CpuId % XIL_POOL_NUM_CPUS;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function takes the lock protecting the shared free list.
+*
+* @param       Pool: pointer to the pool instance
+*
+*****************************************************************************/
+static void Xil_PoolLockShared(Xil_Pool *Pool)
+{
+	while (__atomic_exchange_n(&Pool->Lock, 1U, __ATOMIC_ACQUIRE) != 0U) {
+		while (__atomic_load_n(&Pool->Lock, __ATOMIC_RELAXED) != 0U) {
+			;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function releases the lock protecting the shared free
+*              list.
+*
+* @param       Pool: pointer to the pool instance
+*
+*****************************************************************************/
+static void Xil_PoolUnlockShared(Xil_Pool *Pool)
+{
+	__atomic_store_n(&Pool->Lock, 0U, __ATOMIC_RELEASE);
+}
+#endif
@@ -0,0 +1,175 @@
+/******************************************************************************/
+/**
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+* @file xil_pool.h
+*
+* @addtogroup common_pool_apis Fixed Size Block Pool Allocator
+*
+* The xil_pool.h file contains the fixed size block pool allocator. A pool
+* carves caller provided memory into blocks of one size and hands them out
+* in constant time from a free list, so allocation latency does not depend
+* on heap fragmentation. A pool set groups pools of increasing block size
+* into size classes.
+*
+* - Pool memory can be placed in OCM or TCM with XIL_POOL_SECTION and the
+*   corresponding section in the linker script.
+* - Blocks can be aligned to the cache line size so they can be handed to
+*   DMA engines without sharing cache lines with other data.
+* - On SMP AArch64 targets every core keeps a small cache of free blocks,
+*   the shared free list is only locked to refill or drain that cache.
+* - Alloc and free are safe from interrupt handlers, IRQ and FIQ are masked
+*   for the duration of the list update.
+*
+* A pool set registered with Xil_PoolSetDefault backs Xil_PoolMalloc and
+* Xil_PoolFreeAny. These fall back to malloc and free when no size class
+* fits, and are used by the xilffs, lwIP and libmetal allocation hooks.
+*
+* @{
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who      Date     Changes
+* ----- -------- -------- -----------------------------------------------
+* 8.1   ag       10/14/26 First release.
+*
+* </pre>
+*
+*****************************************************************************/
+#ifndef XIL_POOL_H		/* prevent circular inclusions */
+#define XIL_POOL_H		/* by using protection macros */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files ********************************/
+
+#include "xil_types.h"
+#include "xstatus.h"
+
+/************************** Constant Definitions ****************************/
+
+/**
+ * Cache line size, to be passed as alignment for DMA capable pools.
+ */
+#if defined (__aarch64__) || defined (ARMA53_32)
+#define XIL_POOL_CACHELINE	64U
+#else
+#define XIL_POOL_CACHELINE	32U
+#endif
+
+/**
+ * Number of per-core free block caches. Cores are identified through
+ * MPIDR on AArch64, other processors use a single shared free list.
+ */
+#ifndef XIL_POOL_NUM_CPUS
+#if defined (__aarch64__) && defined (VERSAL_NET)
+#define XIL_POOL_NUM_CPUS	16U
+#elif defined (__aarch64__)
+#define XIL_POOL_NUM_CPUS	4U
+#else
+#define XIL_POOL_NUM_CPUS	1U
+#endif
+#endif
+
+/**
+ * Number of blocks moved between a per-core cache and the shared free list
+ * at a time.
+ */
+#ifndef XIL_POOL_CPU_BATCH
+#define XIL_POOL_CPU_BATCH	8U
+#endif
+
+/** Maximum number of size classes in a pool set */
+#define XIL_POOL_MAX_CLASSES	8U
+
+/**************************** Type Definitions ******************************/
+
+/**
+ * Per-core cache of free blocks, padded to a cache line.
+ */
+typedef struct {
+	void *Head;		/**< First free block */
+	u32 Count;		/**< Number of blocks in the cache */
+	u8 Pad[XIL_POOL_CACHELINE - sizeof(void *) - sizeof(u32)];
+} Xil_PoolCpuCache;
+
+/**
+ * Pool of fixed size blocks.
+ */
+typedef struct {
+	UINTPTR Start;		/**< Address of the first block */
+	UINTPTR End;		/**< Address past the last block */
+	u32 BlockSize;		/**< Size of a block including alignment */
+	u32 NumBlocks;		/**< Number of blocks in the pool */
+	void *FreeList;		/**< Shared list of free blocks */
+	u32 FreeCount;		/**< Number of blocks in the shared list */
+	u32 Lock;		/**< Shared list lock for SMP targets */
+#if (XIL_POOL_NUM_CPUS > 1U)
+	Xil_PoolCpuCache Cpu[XIL_POOL_NUM_CPUS]; /**< Per-core caches */
+#endif
+} Xil_Pool;
+
+/**
+ * Set of pools ordered by increasing block size.
+ */
+typedef struct {
+	Xil_Pool *Pools[XIL_POOL_MAX_CLASSES];	/**< Size classes */
+	u32 NumPools;		/**< Number of size classes */
+} Xil_PoolSet;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/**
+ * Places pool storage into a linker section, for example ".ocm_pool".
+ */
+#if defined (__GNUC__)
+#define XIL_POOL_SECTION(Name)	__attribute__ ((section (Name)))
+#else
+#define XIL_POOL_SECTION(Name)
+#endif
+
+/**
+ * Defines cache line aligned storage for NumBlocks blocks of BlockSize
+ * bytes each, BlockSize must be a multiple of XIL_POOL_CACHELINE.
+ */
+#if defined (__GNUC__)
+#define XIL_POOL_STORAGE(Name, BlockSize, NumBlocks) \
+	u8 Name[(BlockSize) * (NumBlocks)] \
+		__attribute__ ((aligned (XIL_POOL_CACHELINE)))
+#else
+#define XIL_POOL_STORAGE(Name, BlockSize, NumBlocks) \
+	u8 Name[(BlockSize) * (NumBlocks)]
+#endif
+
+/************************** Function Prototypes *****************************/
+
+s32 Xil_PoolInit(Xil_Pool *Pool, void *Mem, u32 MemSize, u32 BlockSize,
+		u32 Align);
+void *Xil_PoolAlloc(Xil_Pool *Pool);
+void Xil_PoolFree(Xil_Pool *Pool, void *Block);
+u32 Xil_PoolOwns(const Xil_Pool *Pool, const void *Block);
+u32 Xil_PoolFreeBlocks(const Xil_Pool *Pool);
+
+s32 Xil_PoolSetAdd(Xil_PoolSet *Set, Xil_Pool *Pool);
+void *Xil_PoolSetAlloc(Xil_PoolSet *Set, u32 Size);
+s32 Xil_PoolSetFree(Xil_PoolSet *Set, void *Block);
+
+void Xil_PoolSetDefault(Xil_PoolSet *Set);
+void *Xil_PoolMalloc(u32 Size);
+void *Xil_PoolCalloc(u32 Count, u32 Size);
+void Xil_PoolFreeAny(void *Block);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XIL_POOL_H */
+/**
+* @} End of "addtogroup common_pool_apis".
+*/
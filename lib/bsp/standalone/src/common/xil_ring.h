@@ -0,0 +1,365 @@
+/******************************************************************************/
+/**
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+* @file xil_ring.h
+*
+* @addtogroup common_ring_apis Lock-free Single Producer Single Consumer Ring
+*
+* The xil_ring.h file contains a header only, lock-free ring buffer for one
+* producer and one consumer, typically an interrupt handler and a thread or
+* two processor cores. Neither side has to disable interrupts or take a
+* lock, as long as each side is accessed from a single context.
+*
+* - The number of elements must be a power of two. Head and tail indices are
+*   free running and wrap through the mask, so the full capacity is usable.
+* - The head (written by the producer) and tail (written by the consumer)
+*   indices live in separate cache lines to avoid false sharing.
+* - Publishing an index is a release operation and reading the index of the
+*   other side is an acquire operation, so element data is always visible
+*   before the index that covers it.
+*
+* Elements are copied in and out by value; use an element size of
+* sizeof(void *) to pass buffer pointers.
+*
+* @{
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who      Date     Changes
+* ----- -------- -------- -----------------------------------------------
+* 8.1   ag       10/14/26 First release.
+*
+* </pre>
+*
+*****************************************************************************/
+#ifndef XIL_RING_H		/* prevent circular inclusions */
+#define XIL_RING_H		/* by using protection macros */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files ********************************/
+
+#include <string.h>
+#include "xil_types.h"
+#include "xstatus.h"
+#if defined (__ICCARM__)
+#include "xpseudo_asm.h"
+#endif
+
+/************************** Constant Definitions ****************************/
+
+/**
+ * Cache line size used to pad the producer and consumer indices.
+ */
+#ifndef XIL_RING_CACHELINE
+#if defined (__aarch64__) || defined (ARMA53_32)
+#define XIL_RING_CACHELINE	64U
+#else
+#define XIL_RING_CACHELINE	32U
+#endif
+#endif
+
+/**
+ *@cond nocomments
+ */
+#if defined (__GNUC__)
+#define XIL_RING_LOAD_ACQUIRE(p)	__atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define XIL_RING_STORE_RELEASE(p, v)	__atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#else
+#define XIL_RING_LOAD_ACQUIRE(p)	Xil_RingLoadAcquire(p)
+#define XIL_RING_STORE_RELEASE(p, v)	Xil_RingStoreRelease((p), (v))
+#endif
+/**
+ *@endcond
+ */
+
+/**************************** Type Definitions ******************************/
+
+/**
+ * Ring instance. The producer writes Head, the consumer writes Tail; all
+ * other members are set once by Xil_RingInit. The padding keeps the two
+ * indices a full cache line apart.
+ */
+typedef struct {
+	u32 Head;		/**< Producer index */
+	u8 HeadPad[XIL_RING_CACHELINE - sizeof(u32)];
+	u32 Tail;		/**< Consumer index */
+	u8 TailPad[XIL_RING_CACHELINE - sizeof(u32)];
+	u8 *Buf;		/**< Element storage */
+	u32 Mask;		/**< Number of elements - 1 */
+	u32 ElemSize;		/**< Size of an element in bytes */
+} Xil_Ring;
+
+/***************** Inline Functions Definitions ********************/
+
+/**
+ *@cond nocomments
+ */
+#if !defined (__GNUC__)
+static inline u32 Xil_RingLoadAcquire(const u32 *Index)
+{
+	u32 Value = *(const volatile u32 *)Index;
+
+	dmb();
+	return Value;
+}
+
+static inline void Xil_RingStoreRelease(u32 *Index, u32 Value)
+{
+	dmb();
+	*(volatile u32 *)Index = Value;
+}
+#endif
+
+static inline void Xil_RingCopy(void *Dst, const void *Src, u32 Size)
+{
+	/* Fixed size copies for the common element sizes */
+	switch (Size) {
+	case sizeof(u8):
+		*(u8 *)Dst = *(const u8 *)Src;
+		break;
+	case sizeof(u16):
+		*(u16 *)Dst = *(const u16 *)Src;
+		break;
+	case sizeof(u32):
+		*(u32 *)Dst = *(const u32 *)Src;
+		break;
+	case sizeof(u64):
+		*(u64 *)Dst = *(const u64 *)Src;
+		break;
+	default:
+		(void)memcpy(Dst, Src, Size);
+		break;
+	}
+}
+
+static inline void Xil_RingCopyOut(const Xil_Ring *Ring, void *Dst,
+		u32 Index, u32 Count)
+{
+	u32 First = (Index & Ring->Mask);
+	u32 Chunk = Ring->Mask + 1U - First;
+
+	if (Chunk > Count) {
+		Chunk = Count;
+	}
+	(void)memcpy(Dst, &Ring->Buf[First * Ring->ElemSize],
+			Chunk * Ring->ElemSize);
+	(void)memcpy((u8 *)Dst + (Chunk * Ring->ElemSize), Ring->Buf,
+			(Count - Chunk) * Ring->ElemSize);
+}
+
+static inline void Xil_RingCopyIn(Xil_Ring *Ring, const void *Src,
+		u32 Index, u32 Count)
+{
+	u32 First = (Index & Ring->Mask);
+	u32 Chunk = Ring->Mask + 1U - First;
+
+	if (Chunk > Count) {
+		Chunk = Count;
+	}
+	(void)memcpy(&Ring->Buf[First * Ring->ElemSize], Src,
+			Chunk * Ring->ElemSize);
+	(void)memcpy(Ring->Buf, (const u8 *)Src + (Chunk * Ring->ElemSize),
+			(Count - Chunk) * Ring->ElemSize);
+}
+/**
+ *@endcond
+ */
+
+/*****************************************************************************/
+/**
+* @brief       This function initializes a ring over caller provided storage.
+*
+* @param       Ring: pointer to the ring instance
+* @param       Storage: pointer to NumElems * ElemSize bytes of storage,
+*              aligned for the element type
+* @param       NumElems: number of elements, must be a power of two
+* @param       ElemSize: size of an element in bytes
+*
+* @return      XST_SUCCESS on success, XST_INVALID_PARAM if NumElems is not a
+*              power of two or a parameter is NULL or zero.
+*
+* @note        Must be called before the producer and consumer start.
+*
+*****************************************************************************/
+static inline s32 Xil_RingInit(Xil_Ring *Ring, void *Storage, u32 NumElems,
+		u32 ElemSize)
+{
+	if ((Ring == NULL) || (Storage == NULL) || (NumElems == 0U) ||
+			(ElemSize == 0U) ||
+			((NumElems & (NumElems - 1U)) != 0U)) {
+		return (s32)XST_INVALID_PARAM;
+	}
+
+	Ring->Head = 0U;
+	Ring->Tail = 0U;
+	Ring->Buf = (u8 *)Storage;
+	Ring->Mask = NumElems - 1U;
+	Ring->ElemSize = ElemSize;
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function returns the number of elements in the ring. The
+*              value is exact when called from the producer or the consumer.
+*
+* @param       Ring: pointer to the ring instance
+*
+* @return      Number of elements present in the ring.
+*
+*****************************************************************************/
+static inline u32 Xil_RingCount(Xil_Ring *Ring)
+{
+	u32 Head = XIL_RING_LOAD_ACQUIRE(&Ring->Head);
+	u32 Tail = XIL_RING_LOAD_ACQUIRE(&Ring->Tail);
+
+	return Head - Tail;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function returns the number of free elements in the ring.
+*
+* @param       Ring: pointer to the ring instance
+*
+* @return      Number of elements that can be pushed.
+*
+*****************************************************************************/
+static inline u32 Xil_RingSpace(Xil_Ring *Ring)
+{
+	return (Ring->Mask + 1U) - Xil_RingCount(Ring);
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function pushes one element. To be called by the
+*              producer only.
+*
+* @param       Ring: pointer to the ring instance
+* @param       Elem: pointer to the element to be copied into the ring
+*
+* @return      XST_SUCCESS if the element is pushed, XST_FAILURE if the ring
+*              is full.
+*
+*****************************************************************************/
+static inline s32 Xil_RingPush(Xil_Ring *Ring, const void *Elem)
+{
+	u32 Head = Ring->Head;
+	u32 Tail = XIL_RING_LOAD_ACQUIRE(&Ring->Tail);
+
+	if ((Head - Tail) > Ring->Mask) {
+		return (s32)XST_FAILURE;
+	}
+
+	Xil_RingCopy(&Ring->Buf[(Head & Ring->Mask) * Ring->ElemSize], Elem,
+			Ring->ElemSize);
+	XIL_RING_STORE_RELEASE(&Ring->Head, Head + 1U);
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function pops one element. To be called by the consumer
+*              only.
+*
+* @param       Ring: pointer to the ring instance
+* @param       Elem: pointer to the memory receiving the element
+*
+* @return      XST_SUCCESS if an element is popped, XST_NO_DATA if the ring
+*              is empty.
+*
+*****************************************************************************/
+static inline s32 Xil_RingPop(Xil_Ring *Ring, void *Elem)
+{
+	u32 Tail = Ring->Tail;
+	u32 Head = XIL_RING_LOAD_ACQUIRE(&Ring->Head);
+
+	if (Head == Tail) {
+		return (s32)XST_NO_DATA;
+	}
+
+	Xil_RingCopy(Elem, &Ring->Buf[(Tail & Ring->Mask) * Ring->ElemSize],
+			Ring->ElemSize);
+	XIL_RING_STORE_RELEASE(&Ring->Tail, Tail + 1U);
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function pushes up to Count elements with a single index
+*              update. To be called by the producer only.
+*
+* @param       Ring: pointer to the ring instance
+* @param       Elems: pointer to the array of elements
+* @param       Count: number of elements in the array
+*
+* @return      Number of elements pushed, less than Count when the ring
+*              becomes full.
+*
+*****************************************************************************/
+static inline u32 Xil_RingEnqueueBulk(Xil_Ring *Ring, const void *Elems,
+		u32 Count)
+{
+	u32 Head = Ring->Head;
+	u32 Tail = XIL_RING_LOAD_ACQUIRE(&Ring->Tail);
+	u32 Space = (Ring->Mask + 1U) - (Head - Tail);
+
+	if (Count > Space) {
+		Count = Space;
+	}
+	if (Count != 0U) {
+		Xil_RingCopyIn(Ring, Elems, Head, Count);
+		XIL_RING_STORE_RELEASE(&Ring->Head, Head + Count);
+	}
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function pops up to Count elements with a single index
+*              update. To be called by the consumer only.
+*
+* @param       Ring: pointer to the ring instance
+* @param       Elems: pointer to the array receiving the elements
+* @param       Count: capacity of the array in elements
+*
+* @return      Number of elements popped.
+*
+*****************************************************************************/
+static inline u32 Xil_RingDequeueBulk(Xil_Ring *Ring, void *Elems, u32 Count)
+{
+	u32 Tail = Ring->Tail;
+	u32 Head = XIL_RING_LOAD_ACQUIRE(&Ring->Head);
+	u32 Avail = Head - Tail;
+
+	if (Count > Avail) {
+		Count = Avail;
+	}
+	if (Count != 0U) {
+		Xil_RingCopyOut(Ring, Elems, Tail, Count);
+		XIL_RING_STORE_RELEASE(&Ring->Tail, Tail + Count);
+	}
+
+	return Count;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XIL_RING_H */
+/**
+* @} End of "addtogroup common_ring_apis".
+*/
@@ -21,6 +21,8 @@
 * ----- ---- ---------- -------------------------------------------------------
 * 1.00  bsv   07/02/20   First release
 * 2.00  bsv   03/15/22   Fix bug in stacked mode
+* 2.01  ag    10/15/26   Split page program into Xbir_QspiWriteStart and
+*                        Xbir_QspiIsWriteDone for the upload pipeline
 *
 * </pre>
 *
@@ -704,24 +706,24 @@ END:
 /*****************************************************************************/
 /**
  * @brief
- * This function writes to the  serial Flash connected to the QSPIPSU interface.
- * All the data put into the buffer must be in the same page of the device with
- * page boundaries being on 256 byte boundaries.
+ * This function starts a page program of the serial Flash connected to the
+ * QSPIPSU interface and returns without waiting for it to complete. All the
+ * data put into the buffer must be in the same page of the device with page
+ * boundaries being on 256 byte boundaries. Completion is polled with
+ * Xbir_QspiIsWriteDone.
  *
  * @param	Address 	Address to write data to in the Flash.
- * @param	Length 		Number of bytes to write.
  * @param	WrBuffer	Pointer to data to be written
+ * @param	Length 		Number of bytes to write.
  *
- * @return	XST_SUCCESS on successful write
+ * @return	XST_SUCCESS if the page program is started
  * 		Error code on failure
  *
  ******************************************************************************/
-int Xbir_QspiWrite(u32 Address, u8 *WrBuffer, u32 Length)
+int Xbir_QspiWriteStart(u32 Address, u8 *WrBuffer, u32 Length)
 {
 	int Status = XST_FAILURE;
 	u8 WrEnableCmd;
-	u8 RdStatusCmd;
-	u8 FlashStatus[2U] = {0U};
 	u8 WrCmd[5U];
 	u32 RealAddr;
 	u32 CmdByteCount;
@@ -778,6 +780,93 @@ int Xbir_QspiWrite(u32 Address, u8 *WrBuffer, u32 Length)
 	}
 
 	Status = XQspiPsu_PolledTransfer(&QspiPsuInstance, FlashMsg, 2U);
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function reads the flash status once to check whether the program
+ * started by Xbir_QspiWriteStart has completed.
+ *
+ * @param	IsDone	Set to TRUE if the flash is ready, FALSE if it is
+ *			still programming
+ *
+ * @return	XST_SUCCESS if the status is read
+ * 		Error code on failure
+ *
+ ******************************************************************************/
+int Xbir_QspiIsWriteDone(u8 *IsDone)
+{
+	int Status = XST_FAILURE;
+	u8 RdStatusCmd;
+	u8 FlashStatus[2U] = {0U};
+	XQspiPsu_Msg FlashMsg[2U] = {0U};
+
+	RdStatusCmd = StatusCmd;
+	FlashMsg[0U].TxBfrPtr = &RdStatusCmd;
+	FlashMsg[0U].RxBfrPtr = NULL;
+	FlashMsg[0U].ByteCount = 1U;
+	FlashMsg[0U].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	FlashMsg[0U].Flags = XQSPIPSU_MSG_FLAG_TX;
+
+	FlashMsg[1U].TxBfrPtr = NULL;
+	FlashMsg[1U].RxBfrPtr = FlashStatus;
+	FlashMsg[1U].ByteCount = 2U;
+	FlashMsg[1U].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	FlashMsg[1U].Flags = XQSPIPSU_MSG_FLAG_RX;
+	if (QspiPsuInstance.Config.ConnectionMode ==
+			XQSPIPSU_CONNECTION_MODE_PARALLEL) {
+		FlashMsg[1U].Flags |= XQSPIPSU_MSG_FLAG_STRIPE;
+	}
+
+	Status = XQspiPsu_PolledTransfer(&QspiPsuInstance, FlashMsg, 2U);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	if (QspiPsuInstance.Config.ConnectionMode ==
+			XQSPIPSU_CONNECTION_MODE_PARALLEL) {
+		if (FsrFlag) {
+			FlashStatus[1U] &= FlashStatus[0U];
+		} else {
+			FlashStatus[1U] |= FlashStatus[0U];
+		}
+	}
+
+	if (FsrFlag != 0U) {
+		*IsDone = ((FlashStatus[1U] & 0x80U) != 0U) ? TRUE : FALSE;
+	} else {
+		*IsDone = ((FlashStatus[1U] & 0x01U) == 0U) ? TRUE : FALSE;
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function writes to the  serial Flash connected to the QSPIPSU interface.
+ * All the data put into the buffer must be in the same page of the device with
+ * page boundaries being on 256 byte boundaries.
+ *
+ * @param	Address 	Address to write data to in the Flash.
+ * @param	Length 		Number of bytes to write.
+ * @param	WrBuffer	Pointer to data to be written
+ *
+ * @return	XST_SUCCESS on successful write
+ * 		Error code on failure
+ *
+ ******************************************************************************/
+int Xbir_QspiWrite(u32 Address, u8 *WrBuffer, u32 Length)
+{
+	int Status = XST_FAILURE;
+	u8 IsDone = FALSE;
+
+	Status = Xbir_QspiWriteStart(Address, WrBuffer, Length);
 	if (Status != XST_SUCCESS) {
 		goto END;
 	}
@@ -786,47 +875,11 @@ int Xbir_QspiWrite(u32 Address, u8 *WrBuffer, u32 Length)
 	 * Wait for the write command to the Flash to be completed, it takes
 	 * some time for the data to be written
 	 */
-	while (1U) {
-		RdStatusCmd = StatusCmd;
-		FlashMsg[0U].TxBfrPtr = &RdStatusCmd;
-		FlashMsg[0U].RxBfrPtr = NULL;
-		FlashMsg[0U].ByteCount = 1U;
-		FlashMsg[0U].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
-		FlashMsg[0U].Flags = XQSPIPSU_MSG_FLAG_TX;
-
-		FlashMsg[1U].TxBfrPtr = NULL;
-		FlashMsg[1U].RxBfrPtr = FlashStatus;
-		FlashMsg[1U].ByteCount = 2U;
-		FlashMsg[1U].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
-		FlashMsg[1U].Flags = XQSPIPSU_MSG_FLAG_RX;
-		if (QspiPsuInstance.Config.ConnectionMode ==
-				XQSPIPSU_CONNECTION_MODE_PARALLEL) {
-			FlashMsg[1U].Flags |= XQSPIPSU_MSG_FLAG_STRIPE;
-		}
-
-		Status = XQspiPsu_PolledTransfer(&QspiPsuInstance, FlashMsg, 2U);
+	while (IsDone == FALSE) {
+		Status = Xbir_QspiIsWriteDone(&IsDone);
 		if (Status != XST_SUCCESS) {
 			goto END;
 		}
-
-		if (QspiPsuInstance.Config.ConnectionMode ==
-				XQSPIPSU_CONNECTION_MODE_PARALLEL) {
-			if (FsrFlag) {
-				FlashStatus[1U] &= FlashStatus[0U];
-			} else {
-				FlashStatus[1U] |= FlashStatus[0U];
-			}
-		}
-
-		if (FsrFlag != 0U) {
-			if ((FlashStatus[1U] & 0x80U) != 0U) {
-				break;
-			}
-		} else {
-			if ((FlashStatus[1U] & 0x01U) == 0U) {
-				break;
-			}
-		}
 	}
 
 END:
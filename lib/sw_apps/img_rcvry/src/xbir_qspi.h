@@ -16,6 +16,7 @@
 * Ver   Who    Date       Changes
 * ----- ---- ---------- -------------------------------------------------------
 * 1.00  bsv   07/02/20   First release
+* 2.01  ag    10/15/26   Added Xbir_QspiWriteStart and Xbir_QspiIsWriteDone
 *
 * </pre>
 *
@@ -50,6 +51,8 @@ int Xbir_QspiRead (u32 SrcAddr, u8 *DestAddr, u32 Length);
 int Xbir_QspiWrite(u32 Addr, u8 *WrBuff, u32 Len);
 int Xbir_QspiFlashErase(u32 Address, u32 Length);
 int Xbir_QspiWrite(u32 Address, u8 *WrBuffer, u32 Length);
+int Xbir_QspiWriteStart(u32 Address, u8 *WrBuffer, u32 Length);
+int Xbir_QspiIsWriteDone(u8 *IsDone);
 void Xbir_QspiGetPageSize(u16 *PageSize);
 void Xbir_QspiGetSectorSize(u32 *SectorSize);
 void Xbir_QspiEraseStatsInit(void);
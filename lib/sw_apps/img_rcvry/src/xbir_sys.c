@@ -24,6 +24,8 @@
 * 2.00  bsv   03/13/22   Added error prints for unrecognized Eeprom
 * 3.00  skd   07/28/22   Added support to work with kv260 and kr260
 *                        starter kit xsa
+* 3.01  ag    10/15/26   Program QSPI from a staging buffer while the
+*                        image is received
 *
 * </pre>
 *
@@ -139,10 +141,27 @@
 typedef int (*Xbir_ReadDevice) (u32 Offset, u8 *Data, u32 Size);
 typedef int (*Xbir_EraseDevice) (u32 Offset, u32 Size);
 
+/*
+ * Image data queued in WriteBuffer for QSPI. Pages are programmed from the
+ * background tasks and from Xbir_SysWriteFlash while further data is
+ * received, so the network is not stalled by every page program.
+ */
+typedef struct {
+	u32 Head;	/* Index in WriteBuffer of the next byte to program */
+	u32 Count;	/* Bytes queued, including the page being programmed */
+	u32 WrAddr;	/* Flash address of the byte at Head */
+	u32 InFlight;	/* Size of the page being programmed, 0 if none */
+	u8 IsLast;	/* Last data of the image is queued */
+	int Status;	/* First error of the image being written */
+} Xbir_SysFlashPipe;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /************************** Function Prototypes ******************************/
 static void Xbir_SysReadAndCorrectBootImgInfo (void);
+static int Xbir_SysFlashPipeRun (u8 Wait);
+static void Xbir_SysFlashPipeWaitIdle (void);
+static void Xbir_SysFlashPipeReset (u32 Offset);
 static int Xbir_SysWriteBootImageInfo (Xbir_SysBootImgInfo *BootImgInfo,
 	u32 Offset);
 static int Xbir_SysValidateBootImgInfo (Xbir_SysBootImgInfo *BootImgInfo,
@@ -209,6 +228,7 @@ static Xbir_SysInfo SysInfo = {0U};
 static Xbir_CCInfo CCInfo = {0U};
 u32 EmacBaseAddr = 0U;
 static u32 CalcCrc = 0xFFFFFFFFU;
+static Xbir_SysFlashPipe FlashPipe = {0U};
 
 /*****************************************************************************/
 /**
@@ -596,6 +616,7 @@ int Xbir_SysUpdateBootImgStatus (u8 ImgABootable, u8 ImgBBootable,
 		goto END;
 	}
 
+	Xbir_SysFlashPipeWaitIdle();
 	memcpy ((void *)&BootImgInfo, (void *)&BootImgStatus,
 		sizeof(BootImgInfo));
 
@@ -640,7 +661,11 @@ END:
 /*****************************************************************************/
 /**
  * @brief
- * This function writes data to QSPI.
+ * This function queues data to be written to QSPI. The data is copied to the
+ * staging buffer and programmed page by page in the background while further
+ * data is received. The function only waits for the flash when the staging
+ * buffer is full, and for the last data of the image, which is written
+ * completely before the function returns.
  *
  * @param	Offset	QSPI address where data is to be written
  * @param	Data	Pointer to Data to be written
@@ -655,55 +680,179 @@ int Xbir_SysWriteFlash (u32 Offset, u8 *Data, u32 Size,
 	Xbir_ImgDataStatus IsLast)
 {
 	int Status = XST_FAILURE;
-	u32 DataSize = Size;
-	u32 WrAddr = Offset;
-	u8 *WrBuff = Data;
-	static u32 PrevPendingDataLen = 0U;
-	u16 PageSize;
+	u32 Tail;
+	u32 Len;
 
-	Xbir_QspiGetPageSize(&PageSize);
+	if (Size > sizeof(WriteBuffer)) {
+		Xbir_Printf("ERROR: Invalid image size\r\n");
+		Status = XBIR_ERROR_IMAGE_SIZE;
+		goto END;
+	}
 
-	if (PrevPendingDataLen > 0U) {
-		if ((Size + PrevPendingDataLen) > sizeof(WriteBuffer)) {
-			Xbir_Printf("ERROR: Invalid image size\r\n");
-			Status = XBIR_ERROR_IMAGE_SIZE;
-			goto END;
-		}
-		memcpy (&WriteBuffer[PrevPendingDataLen], Data, Size);
-		DataSize += PrevPendingDataLen;
-		WrAddr -= PrevPendingDataLen;
-		WrBuff = WriteBuffer;
+	/* Data that does not follow the queued data starts a new image */
+	if ((FlashPipe.WrAddr + FlashPipe.Count) != Offset) {
+		Xbir_SysFlashPipeReset(Offset);
 	}
 
-	while (DataSize >= PageSize) {
-		Status = Xbir_QspiWrite(WrAddr, WrBuff, PageSize);
-		if (Status != XST_SUCCESS) {
-			Xbir_Printf("ERROR: Image write failed\r\n");
-			Status = XBIR_ERROR_IMAGE_WRITE;
-			goto END;
-		}
-		WrAddr += PageSize;
-		WrBuff += PageSize;
-		DataSize -= PageSize;
+	while ((FlashPipe.Status == XST_SUCCESS) &&
+		((sizeof(WriteBuffer) - FlashPipe.Count) < Size)) {
+		(void)Xbir_SysFlashPipeRun(FALSE);
+	}
+	if (FlashPipe.Status != XST_SUCCESS) {
+		Status = FlashPipe.Status;
+		goto LAST;
 	}
 
-	if (XBIR_SYS_PARTIAL_DATA_CHUNK == IsLast) {
-		memcpy(WriteBuffer, WrBuff, DataSize);
-		PrevPendingDataLen = DataSize;
+	Tail = (FlashPipe.Head + FlashPipe.Count) % sizeof(WriteBuffer);
+	Len = sizeof(WriteBuffer) - Tail;
+	if (Len > Size) {
+		Len = Size;
+	}
+	memcpy(&WriteBuffer[Tail], Data, Len);
+	memcpy(WriteBuffer, &Data[Len], Size - Len);
+	FlashPipe.Count += Size;
+
+	if (XBIR_SYS_LAST_DATA_CHUNK == IsLast) {
+		FlashPipe.IsLast = TRUE;
+		Status = Xbir_SysFlashPipeRun(TRUE);
 	}
 	else {
-		PrevPendingDataLen = 0U;
-		if (DataSize > 0U) {
-			Status = Xbir_QspiWrite(WrAddr, WrBuff, DataSize);
+		Status = Xbir_SysFlashPipeRun(FALSE);
+	}
+
+LAST:
+	if (XBIR_SYS_LAST_DATA_CHUNK == IsLast) {
+		Xbir_SysFlashPipeReset(FlashPipe.WrAddr + FlashPipe.Count);
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function advances the QSPI upload pipeline. It checks whether the page
+ * program in progress has completed and starts the next one if a full page,
+ * or the last data of the image, is queued.
+ *
+ * @param	Wait	TRUE to program all that can be programmed before
+ *			returning, FALSE to return after starting at most one
+ *			page program
+ *
+ * @return	XST_SUCCESS if no error occurred so far for the image
+ *		Error code on failure
+ *
+ *****************************************************************************/
+static int Xbir_SysFlashPipeRun (u8 Wait)
+{
+	int Status;
+	u8 IsDone;
+	u16 PageSize;
+	u32 Len;
+
+	Xbir_QspiGetPageSize(&PageSize);
+
+	while (FlashPipe.Status == XST_SUCCESS) {
+		if (FlashPipe.InFlight > 0U) {
+			Status = Xbir_QspiIsWriteDone(&IsDone);
 			if (Status != XST_SUCCESS) {
 				Xbir_Printf("ERROR: Image write failed\r\n");
-				Status = XBIR_ERROR_IMAGE_WRITE;
+				FlashPipe.Status = XBIR_ERROR_IMAGE_WRITE;
+				break;
+			}
+			if (IsDone == FALSE) {
+				if (Wait == FALSE) {
+					break;
+				}
+				continue;
 			}
+			FlashPipe.Head = (FlashPipe.Head + FlashPipe.InFlight) %
+				sizeof(WriteBuffer);
+			FlashPipe.WrAddr += FlashPipe.InFlight;
+			FlashPipe.Count -= FlashPipe.InFlight;
+			FlashPipe.InFlight = 0U;
+		}
+
+		/*
+		 * Head stays page aligned and the staging buffer is a multiple
+		 * of the page size, so a page never wraps around the buffer
+		 */
+		if (FlashPipe.Count >= PageSize) {
+			Len = PageSize;
+		}
+		else if ((FlashPipe.IsLast == TRUE) && (FlashPipe.Count > 0U)) {
+			Len = FlashPipe.Count;
+		}
+		else {
+			break;
+		}
+
+		Status = Xbir_QspiWriteStart(FlashPipe.WrAddr,
+			&WriteBuffer[FlashPipe.Head], Len);
+		if (Status != XST_SUCCESS) {
+			Xbir_Printf("ERROR: Image write failed\r\n");
+			FlashPipe.Status = XBIR_ERROR_IMAGE_WRITE;
+			break;
+		}
+		FlashPipe.InFlight = Len;
+
+		if (Wait == FALSE) {
+			break;
 		}
 	}
 
-END:
-	return Status;
+	return FlashPipe.Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function waits for the page program in progress, if any, so that
+ * QSPI can be accessed for other purposes.
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void Xbir_SysFlashPipeWaitIdle (void)
+{
+	u8 IsDone = FALSE;
+
+	while ((FlashPipe.InFlight > 0U) && (IsDone == FALSE)) {
+		if (Xbir_QspiIsWriteDone(&IsDone) != XST_SUCCESS) {
+			break;
+		}
+	}
+
+	if (FlashPipe.InFlight > 0U) {
+		FlashPipe.Head = (FlashPipe.Head + FlashPipe.InFlight) %
+			sizeof(WriteBuffer);
+		FlashPipe.WrAddr += FlashPipe.InFlight;
+		FlashPipe.Count -= FlashPipe.InFlight;
+		FlashPipe.InFlight = 0U;
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function empties the QSPI upload pipeline, dropping data that is not
+ * programmed yet, and prepares it for an image starting at Offset.
+ *
+ * @param	Offset	QSPI address of the next data to be queued
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void Xbir_SysFlashPipeReset (u32 Offset)
+{
+	Xbir_SysFlashPipeWaitIdle();
+
+	FlashPipe.Head = 0U;
+	FlashPipe.Count = 0U;
+	FlashPipe.WrAddr = Offset;
+	FlashPipe.IsLast = FALSE;
+	FlashPipe.Status = XST_SUCCESS;
 }
 
 /*****************************************************************************/
@@ -725,6 +874,8 @@ int Xbir_SysEraseBootImg (Xbir_SysBootImgId BootImgId)
 	Xbir_EraseDevice EraseDevice = NULL;
 
 	if (FlashEraseStats->State == XBIR_FLASH_ERASE_NOTSTARTED) {
+		/* Drop what is left of an upload that was not completed */
+		Xbir_SysFlashPipeReset(0U);
 		Xbir_QspiEraseStatsInit();
 		FlashEraseStats->State = XBIR_FLASH_ERASE_REQUESTED;
 		FlashEraseStats->CurrentImgErased = (u8)BootImgId;
@@ -1231,6 +1382,7 @@ int Xbir_SysValidateCrc (Xbir_SysBootImgId BootImgId, u32 Size, u32 InCrc)
 	u32 Offset;
 	u32 Crc;
 
+	Xbir_SysFlashPipeWaitIdle();
 	if (XBIR_SYS_BOOT_IMG_A_ID == BootImgId) {
 		Offset = BootImgStatus.BootImgAOffset;
 	}
@@ -1278,7 +1430,11 @@ void Xbir_SysExecuteBackgroundTasks(void)
 {
 	Xbir_FlashEraseStats *FlashEraseStats = Xbir_GetFlashEraseStats();
 
-	if (FlashEraseStats->State == XBIR_FLASH_ERASE_STARTED) {
+	/* Keep the flash programming while the network is idle */
+	(void)Xbir_SysFlashPipeRun(FALSE);
+
+	if ((FlashEraseStats->State == XBIR_FLASH_ERASE_STARTED) &&
+		(FlashPipe.InFlight == 0U)) {
 		(void)Xbir_SysEraseBootImg(FlashEraseStats->CurrentImgErased);
 	}
 }
@@ -1305,6 +1461,11 @@ int Xbir_SysWriteSD (u32 Offset, u8 *Data, u32 Size, Xbir_ImgDataStatus IsLast)
 	u8 *WrBuff = Data;
 	static u32 PrevPendingDataLen = 0U;
 
+	/* WriteBuffer is shared with the QSPI upload pipeline */
+	if (FlashPipe.Count > 0U) {
+		Xbir_SysFlashPipeReset(0U);
+	}
+
 	if (PrevPendingDataLen > 0U) {
 		if ((Size + PrevPendingDataLen) > sizeof(WriteBuffer)) {
 			Xbir_Printf("ERROR: Invalid image size\r\n");
@@ -236,6 +236,7 @@ static err_t Xbir_WsHttpRecvCallback (void *Arg, struct tcp_pcb *Tpcb,
 {
 	err_t OutputError = ERR_VAL;
 	Xbir_HttpArg *HttpArg = (Xbir_HttpArg *) Arg;
+	struct pbuf *Buf;
 
 	if ((Error != ERR_OK) || (Pkt == NULL)) {
 		Xbir_HttpClose(Tpcb);
@@ -257,23 +258,31 @@ static err_t Xbir_WsHttpRecvCallback (void *Arg, struct tcp_pcb *Tpcb,
 	}
 
 	/* Acknowledge that we've read the payload */
-	tcp_recved(Tpcb, Pkt->len);
-
-	HttpArg->PktCount++;
-
-	/* Is it first packet after connection? */
-	if(HttpArg->PktCount == 1) {
-		/* Read and decipher the request
-		 * This function takes care of generating a response, sending it,
-		 * and closing the connection if all data have been sent. If
-		 * not, then it sets up the appropriate arguments to the sent
-		 * callback handler.
-		 */
-
-		Xbir_HttpProcessReq(Tpcb, Pkt->payload, Pkt->len);
-	}
-	else {
-		Xbir_HttpProcessAdditionalPayload(Tpcb, Pkt->payload, Pkt->len);
+	tcp_recved(Tpcb, Pkt->tot_len);
+
+	/*
+	 * Segments received out of order are handed over chained to the
+	 * segment that fills the gap, process each of them
+	 */
+	for (Buf = Pkt; Buf != NULL; Buf = Buf->next) {
+		HttpArg->PktCount++;
+
+		/* Is it first packet after connection? */
+		if(HttpArg->PktCount == 1) {
+			/* Read and decipher the request
+			 * This function takes care of generating a response,
+			 * sending it, and closing the connection if all data
+			 * have been sent. If not, then it sets up the
+			 * appropriate arguments to the sent callback handler.
+			 */
+
+			Xbir_HttpProcessReq(Tpcb, Buf->payload, Buf->len);
+		}
+		else if (Xbir_HttpProcessAdditionalPayload(Tpcb, Buf->payload,
+			Buf->len) != XST_SUCCESS) {
+			/* Connection is closed */
+			break;
+		}
 	}
 
 	pbuf_free(Pkt);
@@ -0,0 +1,84 @@
+#/******************************************************************************
+#* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+#* SPDX-License-Identifier: MIT
+#******************************************************************************/
+
+proc swapp_get_name {} {
+    return "IPC Benchmark"
+}
+
+proc swapp_get_description {} {
+    return " IPC latency and throughput benchmark between the APU and the RPU over IPI, shared memory and xilmailbox. Build it for psu_cortexa53_0 and psu_cortexr5_0. "
+}
+
+proc check_standalone_os {} {
+    set oslist [hsi::get_os]
+
+    if { [llength $oslist] != 1 } {
+        return 0
+    }
+    set os [lindex $oslist 0]
+
+    if { $os != "standalone" } {
+        error "This application is supported only on the Standalone Board Support Package."
+    }
+}
+
+proc swapp_is_supported_sw {} {
+    # make sure we are using standalone OS
+    check_standalone_os
+
+    # make sure xilmailbox and metal libs are available
+    set librarylist_1 [hsi::get_libs -filter "NAME==xilmailbox"]
+    set librarylist_2 [hsi::get_libs -filter "NAME==libmetal"]
+
+    if { ([llength $librarylist_1] == 0) || ([llength $librarylist_2] == 0) } {
+        error "This application requires xilmailbox and Libmetal libraries in the Board Support Package."
+    }
+}
+
+proc get_proc_type {} {
+    set proc_instance [hsi::get_sw_processor]
+    set hw_processor [common::get_property HW_INSTANCE $proc_instance]
+    return [common::get_property IP_NAME [hsi::get_cells -hier $hw_processor]]
+}
+
+proc swapp_is_supported_hw {} {
+    # check processor type
+    set proc_type [get_proc_type]
+
+    if { ( $proc_type != "psu_cortexa53" ) && ( $proc_type != "psu_cortexr5" ) } {
+        error "This application is supported only for Cortex-A53 and Cortex-R5 processors."
+    }
+
+    return 1
+}
+
+proc swapp_generate {} {
+    if { [get_proc_type] == "psu_cortexr5" } {
+        foreach entry [glob -nocomplain -type f [file join machine zynqmp_r5 *]] {
+            file copy -force $entry "."
+        }
+    }
+
+    file delete -force "machine"
+
+    return
+}
+
+proc swapp_get_linker_constraints {} {
+    if { [get_proc_type] == "psu_cortexr5" } {
+        # don't generate a linker script, we provide one
+        return "lscript no"
+    }
+
+    return ""
+}
+
+proc swapp_get_supported_processors {} {
+    return "psu_cortexa53 psu_cortexr5"
+}
+
+proc swapp_get_supported_os {} {
+    return "standalone"
+}
@@ -0,0 +1,208 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************
+ * bench_ipi.c
+ * IPI transports: the raw IPI message buffers, where each message waits for
+ * the ack of the previous one, and the IPI message queues, where a batch of
+ * messages in shared memory is notified with a single IPI.
+ *
+ * Both sides poll the IPI interrupt status, the interrupt is not used.
+ *****************************************************************************/
+
+#include "xipipsu.h"
+#include "xipipsu_queue.h"
+#include "ipc_bench.h"
+
+#define BENCH_IPI_TIMEOUT	10000000U
+
+static XIpiPsu ipi_inst;
+static u32 ipi_initialized;
+static XIpiPsu_Queue queue;
+
+static int bench_ipi_init(void)
+{
+	XIpiPsu_Config *cfg;
+
+	if (ipi_initialized != 0U)
+		return 0;
+
+	cfg = XIpiPsu_LookupConfig(BENCH_IPI_DEVICE_ID);
+	if (cfg == NULL)
+		return -1;
+	if (XIpiPsu_CfgInitialize(&ipi_inst, cfg, cfg->BaseAddress) != XST_SUCCESS)
+		return -1;
+	XIpiPsu_ClearInterruptStatus(&ipi_inst, XIPIPSU_ALL_MASK);
+
+	ipi_initialized = 1U;
+	return 0;
+}
+
+/* Wait for an IPI from the remote and acknowledge it */
+static void bench_ipi_wait(void)
+{
+	while ((XIpiPsu_GetInterruptStatus(&ipi_inst) &
+		BENCH_REMOTE_IPI_MASK) == 0U)
+		;
+	XIpiPsu_ClearInterruptStatus(&ipi_inst, BENCH_REMOTE_IPI_MASK);
+}
+
+static int bench_ipi_send(u32 *msg, u32 size)
+{
+	if (XIpiPsu_WriteMessage(&ipi_inst, BENCH_REMOTE_IPI_MASK, msg,
+				 size / 4U, XIPIPSU_BUF_TYPE_MSG) != XST_SUCCESS)
+		return -1;
+	if (XIpiPsu_TriggerIpi(&ipi_inst, BENCH_REMOTE_IPI_MASK) != XST_SUCCESS)
+		return -1;
+	if (XIpiPsu_PollForAck(&ipi_inst, BENCH_REMOTE_IPI_MASK,
+			       BENCH_IPI_TIMEOUT) != XST_SUCCESS)
+		return -1;
+	return 0;
+}
+
+static int bench_ipi_ping(u32 size)
+{
+	u32 msg[XIPIPSU_MAX_MSG_LEN] = { 0U };
+
+	if (bench_ipi_send(msg, size) != 0)
+		return -1;
+	if (XIpiPsu_ReadMessage(&ipi_inst, BENCH_REMOTE_IPI_MASK, msg,
+				size / 4U, XIPIPSU_BUF_TYPE_RESP) != XST_SUCCESS)
+		return -1;
+	return 0;
+}
+
+static int bench_ipi_stream(u32 size, u32 batch, u32 count)
+{
+	u32 msg[XIPIPSU_MAX_MSG_LEN] = { 0U };
+	u32 i;
+
+	(void)batch;
+	for (i = 0U; i < count; i++) {
+		if (bench_ipi_send(msg, size) != 0)
+			return -1;
+	}
+	return 0;
+}
+
+static void bench_ipi_serve(u32 mode, u32 size, u32 batch, u32 count)
+{
+	u32 msg[XIPIPSU_MAX_MSG_LEN];
+	u32 i;
+
+	(void)batch;
+	for (i = 0U; i < count; i++) {
+		while ((XIpiPsu_GetInterruptStatus(&ipi_inst) &
+			BENCH_REMOTE_IPI_MASK) == 0U)
+			;
+		(void)XIpiPsu_ReadMessage(&ipi_inst, BENCH_REMOTE_IPI_MASK,
+					  msg, size / 4U, XIPIPSU_BUF_TYPE_MSG);
+		if (mode == BENCH_MODE_LATENCY)
+			(void)XIpiPsu_WriteMessage(&ipi_inst,
+						   BENCH_REMOTE_IPI_MASK, msg,
+						   size / 4U,
+						   XIPIPSU_BUF_TYPE_RESP);
+		/* Clearing the status acks the message */
+		XIpiPsu_ClearInterruptStatus(&ipi_inst, BENCH_REMOTE_IPI_MASK);
+	}
+}
+
+const struct bench_transport bench_ipi = {
+	.name = "ipi",
+	.max_size = XIPIPSU_MAX_MSG_LEN * 4U,
+	.max_batch = 1U,
+	.init = bench_ipi_init,
+	.ping = bench_ipi_ping,
+	.stream = bench_ipi_stream,
+	.serve = bench_ipi_serve,
+};
+
+static int bench_queue_init(void)
+{
+	UINTPTR rings = BENCH_SHM_BASE + BENCH_QUEUE_OFFSET;
+	UINTPTR ring_size = XIPIPSU_QUEUE_RING_SIZE(BENCH_QUEUE_ENTRIES);
+
+	if (bench_ipi_init() != 0)
+		return -1;
+
+	/* The initiator sends on the first ring */
+	if (XIpiPsu_QueueInit(&queue, &ipi_inst, BENCH_REMOTE_IPI_MASK,
+			      BENCH_IS_INITIATOR ? rings : rings + ring_size,
+			      BENCH_IS_INITIATOR ? rings + ring_size : rings,
+			      BENCH_QUEUE_ENTRIES) != XST_SUCCESS)
+		return -1;
+	return 0;
+}
+
+static void bench_queue_recv(u32 *msg)
+{
+	u32 len;
+
+	while (XIpiPsu_QueueReceive(&queue, msg, XIPIPSU_MAX_MSG_LEN,
+				    &len) != XST_SUCCESS)
+		bench_ipi_wait();
+}
+
+static void bench_queue_send(u32 *msg, u32 size)
+{
+	while (XIpiPsu_QueueSend(&queue, msg, size / 4U) != XST_SUCCESS) {
+		/* Full, make sure the remote drains the queued messages */
+		(void)XIpiPsu_QueueKick(&queue);
+	}
+}
+
+static int bench_queue_ping(u32 size)
+{
+	u32 msg[XIPIPSU_MAX_MSG_LEN] = { 0U };
+
+	bench_queue_send(msg, size);
+	(void)XIpiPsu_QueueKick(&queue);
+	bench_queue_recv(msg);
+	return 0;
+}
+
+static int bench_queue_stream(u32 size, u32 batch, u32 count)
+{
+	u32 msg[XIPIPSU_MAX_MSG_LEN] = { 0U };
+	u32 i;
+
+	for (i = 1U; i <= count; i++) {
+		bench_queue_send(msg, size);
+		if (((i % batch) == 0U) || (i == count))
+			(void)XIpiPsu_QueueKick(&queue);
+	}
+	/* The remote answers once it has read all the messages */
+	bench_queue_recv(msg);
+	return 0;
+}
+
+static void bench_queue_serve(u32 mode, u32 size, u32 batch, u32 count)
+{
+	u32 msg[XIPIPSU_MAX_MSG_LEN];
+	u32 i;
+
+	(void)batch;
+	for (i = 0U; i < count; i++) {
+		bench_queue_recv(msg);
+		if (mode == BENCH_MODE_LATENCY) {
+			bench_queue_send(msg, size);
+			(void)XIpiPsu_QueueKick(&queue);
+		}
+	}
+	if (mode == BENCH_MODE_THROUGHPUT) {
+		bench_queue_send(msg, 4U);
+		(void)XIpiPsu_QueueKick(&queue);
+	}
+}
+
+const struct bench_transport bench_ipi_queue = {
+	.name = "ipi_queue",
+	.max_size = XIPIPSU_MAX_MSG_LEN * 4U,
+	.max_batch = BENCH_QUEUE_ENTRIES,
+	.init = bench_queue_init,
+	.ping = bench_queue_ping,
+	.stream = bench_queue_stream,
+	.serve = bench_queue_serve,
+};
@@ -0,0 +1,104 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************
+ * bench_mailbox.c
+ * xilmailbox transport. The messages go through the IPI message buffers and
+ * are notified with the IPI interrupt, so this measures the interrupt path
+ * of the IPI transport. Each request is a blocking send, it returns once the
+ * interrupt handler of the remote has run.
+ *****************************************************************************/
+
+#include "xilmailbox.h"
+#include "ipc_bench.h"
+
+static XMailbox mbox;
+/* Messages notified by the remote, counted by the receive handler */
+static volatile u32 mbox_rx_count;
+
+static void bench_mailbox_recv_handler(void *ref)
+{
+	(void)ref;
+	mbox_rx_count++;
+}
+
+static int bench_mailbox_init(void)
+{
+	if (XMailbox_Initialize(&mbox, BENCH_IPI_DEVICE_ID) != XST_SUCCESS)
+		return -1;
+	if (XMailbox_SetCallBack(&mbox, XMAILBOX_RECV_HANDLER,
+				 (void *)bench_mailbox_recv_handler,
+				 (void *)&mbox) != XST_SUCCESS)
+		return -1;
+	return 0;
+}
+
+static int bench_mailbox_ping(u32 size)
+{
+	u32 msg[XMAILBOX_MAX_MSG_LEN] = { 0U };
+	u32 count = mbox_rx_count;
+
+	if (XMailbox_SendData(&mbox, BENCH_REMOTE_IPI_MASK, msg, size / 4U,
+			      XILMBOX_MSG_TYPE_REQ, 1U) != XST_SUCCESS)
+		return -1;
+	while (mbox_rx_count == count)
+		;
+	if (XMailbox_Recv(&mbox, BENCH_REMOTE_IPI_MASK, msg, size / 4U,
+			  XILMBOX_MSG_TYPE_RESP) != XST_SUCCESS)
+		return -1;
+	return 0;
+}
+
+static int bench_mailbox_stream(u32 size, u32 batch, u32 count)
+{
+	u32 msg[XMAILBOX_MAX_MSG_LEN] = { 0U };
+	u32 i;
+
+	(void)batch;
+	for (i = 0U; i < count; i++) {
+		if (XMailbox_SendData(&mbox, BENCH_REMOTE_IPI_MASK, msg,
+				      size / 4U, XILMBOX_MSG_TYPE_REQ,
+				      1U) != XST_SUCCESS)
+			return -1;
+	}
+	return 0;
+}
+
+static void bench_mailbox_serve(u32 mode, u32 size, u32 batch, u32 count)
+{
+	u32 msg[XMAILBOX_MAX_MSG_LEN];
+	u32 done = mbox_rx_count;
+	u32 i;
+
+	(void)batch;
+	if (mode == BENCH_MODE_THROUGHPUT) {
+		/* The next request may overwrite the message, only count them */
+		while ((mbox_rx_count - done) < count)
+			;
+		(void)XMailbox_Recv(&mbox, BENCH_REMOTE_IPI_MASK, msg,
+				    size / 4U, XILMBOX_MSG_TYPE_REQ);
+		return;
+	}
+
+	for (i = 0U; i < count; i++) {
+		while (mbox_rx_count == done)
+			;
+		done++;
+		(void)XMailbox_Recv(&mbox, BENCH_REMOTE_IPI_MASK, msg,
+				    size / 4U, XILMBOX_MSG_TYPE_REQ);
+		(void)XMailbox_SendData(&mbox, BENCH_REMOTE_IPI_MASK, msg,
+					size / 4U, XILMBOX_MSG_TYPE_RESP, 0U);
+	}
+}
+
+const struct bench_transport bench_mailbox = {
+	.name = "mailbox",
+	.max_size = XMAILBOX_MAX_MSG_LEN * 4U,
+	.max_batch = 1U,
+	.init = bench_mailbox_init,
+	.ping = bench_mailbox_ping,
+	.stream = bench_mailbox_stream,
+	.serve = bench_mailbox_serve,
+};
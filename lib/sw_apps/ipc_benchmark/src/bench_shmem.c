@@ -0,0 +1,129 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************
+ * bench_shmem.c
+ * libmetal shared memory transport. The messages are copied into a ring of
+ * slots with metal_io_block_write(), and the indexes are polled, there is
+ * no interrupt.
+ *
+ * The initiator publishes its head index once per batch, or when the ring
+ * is full, and the responder publishes its tail index after each message.
+ * For the latency, the responder copies the message back in the reply slot
+ * and publishes the index of the message it answers.
+ *****************************************************************************/
+
+#include <metal/io.h>
+#include "ipc_bench.h"
+
+#define SHMEM_HEAD		0x00U	/* messages written by the initiator */
+#define SHMEM_TAIL		0x40U	/* messages read by the responder */
+#define SHMEM_REPLY		0x80U	/* message answered by the responder */
+#define SHMEM_SLOT_SIZE		0x10000U
+#define SHMEM_SLOTS		4U
+#define SHMEM_SLOT(i)		(0x1000U + (((i) % SHMEM_SLOTS) * SHMEM_SLOT_SIZE))
+#define SHMEM_REPLY_SLOT	(0x1000U + (SHMEM_SLOTS * SHMEM_SLOT_SIZE))
+
+static struct metal_io_region shmem_io;
+static metal_phys_addr_t shmem_phys = BENCH_SHM_BASE + BENCH_DATA_OFFSET;
+static u8 shmem_buf[SHMEM_SLOT_SIZE];
+/* Free running message index, head on the initiator, tail on the responder */
+static u32 shmem_index;
+
+static int bench_shmem_init(void)
+{
+	metal_io_init(&shmem_io,
+		      (void *)(UINTPTR)(BENCH_SHM_BASE + BENCH_DATA_OFFSET),
+		      &shmem_phys, BENCH_DATA_SIZE, (unsigned int)-1, 0, NULL);
+	shmem_index = 0U;
+
+	/* The initiator waits for the responder to be ready before it sends */
+	if (!BENCH_IS_INITIATOR) {
+		metal_io_write32(&shmem_io, SHMEM_HEAD, 0U);
+		metal_io_write32(&shmem_io, SHMEM_TAIL, 0U);
+		metal_io_write32(&shmem_io, SHMEM_REPLY, 0U);
+	}
+	return 0;
+}
+
+static int bench_shmem_ping(u32 size)
+{
+	u32 seq = shmem_index++;
+
+	(void)metal_io_block_write(&shmem_io, SHMEM_SLOT(seq), shmem_buf, size);
+	metal_io_write32(&shmem_io, SHMEM_HEAD, seq + 1U);
+	while (metal_io_read32(&shmem_io, SHMEM_REPLY) != (seq + 1U))
+		;
+	(void)metal_io_block_read(&shmem_io, SHMEM_REPLY_SLOT, shmem_buf, size);
+	return 0;
+}
+
+static int bench_shmem_stream(u32 size, u32 batch, u32 count)
+{
+	u32 head = shmem_index;
+	u32 end = shmem_index + count;
+	u32 i;
+
+	for (i = shmem_index; i != end; i++) {
+		if ((i - metal_io_read32(&shmem_io, SHMEM_TAIL)) >= SHMEM_SLOTS) {
+			/* Full, publish the pending messages and wait */
+			if (head != i) {
+				head = i;
+				metal_io_write32(&shmem_io, SHMEM_HEAD, head);
+			}
+			while ((i - metal_io_read32(&shmem_io, SHMEM_TAIL)) >=
+			       SHMEM_SLOTS)
+				;
+		}
+		(void)metal_io_block_write(&shmem_io, SHMEM_SLOT(i), shmem_buf,
+					   size);
+		if ((((i + 1U - shmem_index) % batch) == 0U) ||
+		    ((i + 1U) == end)) {
+			head = i + 1U;
+			metal_io_write32(&shmem_io, SHMEM_HEAD, head);
+		}
+	}
+	shmem_index = end;
+	while (metal_io_read32(&shmem_io, SHMEM_TAIL) != end)
+		;
+	return 0;
+}
+
+static void bench_shmem_serve(u32 mode, u32 size, u32 batch, u32 count)
+{
+	u32 end = shmem_index + count;
+	u32 head;
+
+	(void)batch;
+	while (shmem_index != end) {
+		while ((head = metal_io_read32(&shmem_io, SHMEM_HEAD)) ==
+		       shmem_index)
+			;
+		for (; shmem_index != head; shmem_index++) {
+			(void)metal_io_block_read(&shmem_io,
+						  SHMEM_SLOT(shmem_index),
+						  shmem_buf, size);
+			if (mode == BENCH_MODE_LATENCY) {
+				(void)metal_io_block_write(&shmem_io,
+							   SHMEM_REPLY_SLOT,
+							   shmem_buf, size);
+				metal_io_write32(&shmem_io, SHMEM_REPLY,
+						 shmem_index + 1U);
+			}
+			metal_io_write32(&shmem_io, SHMEM_TAIL,
+					 shmem_index + 1U);
+		}
+	}
+}
+
+const struct bench_transport bench_shmem = {
+	.name = "shmem",
+	.max_size = SHMEM_SLOT_SIZE,
+	.max_batch = BENCH_QUEUE_ENTRIES,
+	.init = bench_shmem_init,
+	.ping = bench_shmem_ping,
+	.stream = bench_shmem_stream,
+	.serve = bench_shmem_serve,
+};
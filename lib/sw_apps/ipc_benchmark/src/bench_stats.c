@@ -0,0 +1,108 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************
+ * bench_stats.c
+ * Latency percentiles, histograms and throughput reports.
+ *****************************************************************************/
+
+#include <stdlib.h>
+#include "xil_printf.h"
+#include "ipc_bench.h"
+
+/* Histogram buckets, doubling from BENCH_HIST_MIN_NS */
+#define BENCH_HIST_BUCKETS	12U
+#define BENCH_HIST_MIN_NS	250U
+#define BENCH_HIST_BAR		40U
+
+static u32 samples[BENCH_SAMPLES];
+static u32 num_samples;
+
+static int bench_cmp(const void *a, const void *b)
+{
+	u32 x = *(const u32 *)a;
+	u32 y = *(const u32 *)b;
+
+	return (x > y) - (x < y);
+}
+
+void bench_stats_reset(void)
+{
+	num_samples = 0U;
+}
+
+void bench_stats_record(u64 ticks)
+{
+	u64 ns = bench_ticks_to_ns(ticks);
+
+	if (num_samples < BENCH_SAMPLES)
+		samples[num_samples++] = (ns > 0xFFFFFFFFU) ? 0xFFFFFFFFU : (u32)ns;
+}
+
+static u32 bench_percentile(u32 pct)
+{
+	return samples[((num_samples - 1U) * pct) / 100U];
+}
+
+void bench_stats_report(const char *name, u32 size)
+{
+	u32 hist[BENCH_HIST_BUCKETS] = { 0U };
+	u32 max_count = 0U;
+	u32 limit;
+	u32 i, j;
+
+	if (num_samples == 0U)
+		return;
+
+	qsort(samples, num_samples, sizeof(samples[0]), bench_cmp);
+	xil_printf("%s latency, %d bytes: min %d p50 %d p90 %d p99 %d max %d ns\r\n",
+		   name, size, samples[0], bench_percentile(50U),
+		   bench_percentile(90U), bench_percentile(99U),
+		   samples[num_samples - 1U]);
+
+	for (i = 0U; i < num_samples; i++) {
+		limit = BENCH_HIST_MIN_NS;
+		for (j = 0U; j < (BENCH_HIST_BUCKETS - 1U); j++) {
+			if (samples[i] < limit)
+				break;
+			limit <<= 1U;
+		}
+		hist[j]++;
+	}
+	for (j = 0U; j < BENCH_HIST_BUCKETS; j++) {
+		if (hist[j] > max_count)
+			max_count = hist[j];
+	}
+
+	limit = BENCH_HIST_MIN_NS;
+	for (j = 0U; j < BENCH_HIST_BUCKETS; j++) {
+		if (hist[j] != 0U) {
+			if (j < (BENCH_HIST_BUCKETS - 1U))
+				xil_printf("  < %8d ns %5d ", limit, hist[j]);
+			else
+				xil_printf("  >=%8d ns %5d ", limit >> 1U, hist[j]);
+			for (i = 0U; i < (hist[j] * BENCH_HIST_BAR) / max_count; i++)
+				xil_printf("#");
+			xil_printf("\r\n");
+		}
+		limit <<= 1U;
+	}
+}
+
+void bench_throughput_report(const char *name, u32 size, u32 batch,
+			     u32 count, u64 ticks)
+{
+	u64 ns = bench_ticks_to_ns(ticks);
+	u64 msgs_per_sec;
+	u64 kb_per_sec;
+
+	if (ns == 0U)
+		ns = 1U;
+	msgs_per_sec = ((u64)count * 1000000000U) / ns;
+	kb_per_sec = ((u64)count * size * 1000000000U) / (ns * 1024U);
+
+	xil_printf("%s throughput, %d bytes, batch %d: %d msgs/s %d KB/s\r\n",
+		   name, size, batch, (u32)msgs_per_sec, (u32)kb_per_sec);
+}
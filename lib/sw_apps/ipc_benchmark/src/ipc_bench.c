@@ -0,0 +1,228 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************
+ * ipc_bench.c
+ * IPC latency and throughput benchmark between the APU and the RPU.
+ *
+ * Build this application for psu_cortexa53_0 and for psu_cortexr5_0, start
+ * the RPU and then the APU. For each transport, the APU:
+ *
+ *  1. Measures the round trip time of BENCH_SAMPLES messages of each size,
+ *     and reports the percentiles and a histogram.
+ *  2. Streams BENCH_MSGS messages of each size, notifying the RPU once per
+ *     batch for each batch depth, and reports the throughput.
+ *
+ * The transports are the raw IPI message buffers, the IPI message queues,
+ * a libmetal shared memory ring and xilmailbox. xilmailbox installs its
+ * IPI interrupt handler, so it runs last. RPMsg latency is measured by the
+ * openamp_echo_test application, with Linux on the APU.
+ *
+ * Build with IPC_BENCH_USE_PMU defined to time stamp with the PMU cycle
+ * counter instead of the global timer.
+ *****************************************************************************/
+
+#include "xil_printf.h"
+#include "xil_cache.h"
+#include "xtime_l.h"
+#if defined (ARMR5)
+#include "xil_mpu.h"
+#include "xreg_cortexr5.h"
+#else
+#include "xil_mmu.h"
+#endif
+#if defined (IPC_BENCH_USE_PMU)
+#include "xpm_counter.h"
+#endif
+#include <metal/sys.h>
+#include "ipc_bench.h"
+
+static const struct bench_transport *const bench_transports[] = {
+	&bench_ipi,
+	&bench_ipi_queue,
+	&bench_shmem,
+	&bench_mailbox,
+};
+
+#define BENCH_NUM_TRANSPORTS \
+	(sizeof(bench_transports) / sizeof(bench_transports[0]))
+
+static const u32 bench_sizes[] = {
+	4U, 8U, 16U, 32U, 256U, 1024U, 4096U, 16384U, 65536U
+};
+
+static const u32 bench_batches[] = { 1U, 4U, 16U, 64U };
+
+#define BENCH_ARRAY_SIZE(a)	(sizeof(a) / sizeof((a)[0]))
+
+static struct bench_ctrl *const ctrl =
+	(struct bench_ctrl *)(UINTPTR)(BENCH_SHM_BASE + BENCH_CTRL_OFFSET);
+
+u64 bench_now(void)
+{
+#if defined (IPC_BENCH_USE_PMU)
+	return (u64)Xpm_ReadCycleCounterVal();
+#else
+	XTime now;
+
+	XTime_GetTime(&now);
+	return (u64)now;
+#endif
+}
+
+u64 bench_ticks_to_ns(u64 ticks)
+{
+#if defined (IPC_BENCH_USE_PMU)
+	return (ticks * 1000U) / (XPAR_CPU_CORTEXA53_0_CPU_CLK_FREQ_HZ / 1000000U);
+#else
+	return (ticks * 1000U) / (COUNTS_PER_SECOND / 1000000U);
+#endif
+}
+
+static void bench_map_shm(void)
+{
+#if defined (ARMR5)
+	Xil_SetMPURegion(BENCH_SHM_BASE, BENCH_SHM_SIZE,
+			 NORM_SHARED_NCACHE | PRIV_RW_USER_RW);
+#else
+	/* The shared memory is within a single 2MB block */
+	Xil_SetTlbAttributes(BENCH_SHM_BASE, NORM_NONCACHE);
+#endif
+}
+
+#if BENCH_IS_INITIATOR
+/*
+ * Start a test on the responder and wait until it is ready for the messages.
+ */
+static void bench_start(u32 transport, u32 mode, u32 size, u32 batch,
+			u32 count)
+{
+	u32 seq = ctrl->seq + 1U;
+
+	ctrl->transport = transport;
+	ctrl->mode = mode;
+	ctrl->size = size;
+	ctrl->batch = batch;
+	ctrl->count = count;
+	ctrl->cmd = BENCH_CMD_RUN;
+	ctrl->seq = seq;
+	while (ctrl->ready != seq)
+		;
+}
+
+static void bench_run(u32 index)
+{
+	const struct bench_transport *t = bench_transports[index];
+	u64 start;
+	u32 i, j, k;
+
+	xil_printf("\r\n=== %s ===\r\n", t->name);
+	if (t->init() != 0) {
+		xil_printf("%s: init failed\r\n", t->name);
+		return;
+	}
+
+	for (i = 0U; i < BENCH_ARRAY_SIZE(bench_sizes); i++) {
+		u32 size = bench_sizes[i];
+
+		if (size > t->max_size)
+			break;
+
+		bench_start(index, BENCH_MODE_LATENCY, size, 1U, BENCH_SAMPLES);
+		bench_stats_reset();
+		for (k = 0U; k < BENCH_SAMPLES; k++) {
+			start = bench_now();
+			if (t->ping(size) != 0) {
+				xil_printf("%s: ping failed\r\n", t->name);
+				return;
+			}
+			bench_stats_record(bench_now() - start);
+		}
+		bench_stats_report(t->name, size);
+
+		for (j = 0U; j < BENCH_ARRAY_SIZE(bench_batches); j++) {
+			u32 batch = bench_batches[j];
+
+			if (batch > t->max_batch)
+				break;
+
+			bench_start(index, BENCH_MODE_THROUGHPUT, size, batch,
+				    BENCH_MSGS);
+			start = bench_now();
+			if (t->stream(size, batch, BENCH_MSGS) != 0) {
+				xil_printf("%s: stream failed\r\n", t->name);
+				return;
+			}
+			bench_throughput_report(t->name, size, batch,
+						BENCH_MSGS, bench_now() - start);
+		}
+	}
+}
+
+int main(void)
+{
+	struct metal_init_params metal_param = METAL_INIT_DEFAULTS;
+	u32 i;
+
+	Xil_ICacheEnable();
+	Xil_DCacheEnable();
+	bench_map_shm();
+	metal_init(&metal_param);
+
+	xil_printf("IPC benchmark, APU to RPU\r\n");
+
+	for (i = 0U; i < BENCH_NUM_TRANSPORTS; i++)
+		bench_run(i);
+
+	ctrl->cmd = BENCH_CMD_EXIT;
+	ctrl->seq = ctrl->seq + 1U;
+	xil_printf("\r\nIPC benchmark done\r\n");
+
+	metal_finish();
+	return 0;
+}
+#else
+int main(void)
+{
+	struct metal_init_params metal_param = METAL_INIT_DEFAULTS;
+	u32 initialized = 0U;
+	u32 seq = 0U;
+	const struct bench_transport *t;
+
+	Xil_ICacheEnable();
+	Xil_DCacheEnable();
+	bench_map_shm();
+	metal_init(&metal_param);
+
+	xil_printf("IPC benchmark, RPU responder\r\n");
+	ctrl->cmd = BENCH_CMD_NONE;
+	ctrl->ready = 0U;
+	ctrl->seq = 0U;
+	while (1) {
+		while (ctrl->seq == seq)
+			;
+		seq = ctrl->seq;
+		if (ctrl->cmd == BENCH_CMD_EXIT)
+			break;
+		if (ctrl->transport >= BENCH_NUM_TRANSPORTS)
+			continue;
+
+		t = bench_transports[ctrl->transport];
+		if ((initialized & (1U << ctrl->transport)) == 0U) {
+			if (t->init() != 0) {
+				xil_printf("%s: init failed\r\n", t->name);
+				break;
+			}
+			initialized |= 1U << ctrl->transport;
+		}
+
+		ctrl->ready = seq;
+		t->serve(ctrl->mode, ctrl->size, ctrl->batch, ctrl->count);
+	}
+
+	metal_finish();
+	return 0;
+}
+#endif
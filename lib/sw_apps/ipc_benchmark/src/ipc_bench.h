@@ -0,0 +1,99 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************
+ * ipc_bench.h
+ * Common definitions of the IPC benchmark.
+ *
+ * The same application runs on the APU, which drives the benchmark and takes
+ * the measurements, and on the RPU, which answers. Both sides agree on the
+ * test to run through a control block at the start of the shared memory.
+ *****************************************************************************/
+
+#ifndef __IPC_BENCH_H__
+#define __IPC_BENCH_H__
+
+#include "xil_types.h"
+#include "xparameters.h"
+
+#if defined (ARMR5)
+#define BENCH_IS_INITIATOR	0
+#define BENCH_LOCAL_IPI_MASK	XPAR_XIPIPS_TARGET_PSU_CORTEXR5_0_CH0_MASK
+#define BENCH_REMOTE_IPI_MASK	XPAR_XIPIPS_TARGET_PSU_CORTEXA53_0_CH0_MASK
+#else
+#define BENCH_IS_INITIATOR	1
+#define BENCH_LOCAL_IPI_MASK	XPAR_XIPIPS_TARGET_PSU_CORTEXA53_0_CH0_MASK
+#define BENCH_REMOTE_IPI_MASK	XPAR_XIPIPS_TARGET_PSU_CORTEXR5_0_CH0_MASK
+#endif
+
+#define BENCH_IPI_DEVICE_ID	XPAR_XIPIPSU_0_DEVICE_ID
+
+/* Shared memory, mapped non-cached on both sides */
+#define BENCH_SHM_BASE		0x3ED80000U
+#define BENCH_SHM_SIZE		0x00080000U
+#define BENCH_CTRL_OFFSET	0x00000000U /* struct bench_ctrl */
+#define BENCH_QUEUE_OFFSET	0x00001000U /* IPI queue rings */
+#define BENCH_QUEUE_ENTRIES	64U
+#define BENCH_DATA_OFFSET	0x00010000U /* shmem transport */
+#define BENCH_DATA_SIZE		(BENCH_SHM_SIZE - BENCH_DATA_OFFSET)
+
+#define BENCH_SAMPLES		1000U /* round trips per latency test */
+#define BENCH_MSGS		4096U /* messages per throughput test */
+
+/* Test modes */
+#define BENCH_MODE_LATENCY	1U
+#define BENCH_MODE_THROUGHPUT	2U
+
+/* Control block commands */
+#define BENCH_CMD_NONE		0U
+#define BENCH_CMD_RUN		1U
+#define BENCH_CMD_EXIT		2U
+
+/**
+ * Control block in shared memory. The initiator writes the test and bumps
+ * seq, the responder sets ready to seq once it waits for the messages.
+ */
+struct bench_ctrl {
+	volatile u32 cmd;
+	volatile u32 transport;
+	volatile u32 mode;
+	volatile u32 size;
+	volatile u32 batch;
+	volatile u32 count;
+	volatile u32 seq;
+	volatile u32 ready;
+};
+
+/**
+ * An IPC transport. The initiator measures ping() for the latency and
+ * stream() for the throughput, the responder answers with serve().
+ */
+struct bench_transport {
+	const char *name;
+	u32 max_size;	/* largest message in bytes */
+	u32 max_batch;	/* largest batch of messages per notification */
+	int (*init)(void);
+	int (*ping)(u32 size);
+	int (*stream)(u32 size, u32 batch, u32 count);
+	void (*serve)(u32 mode, u32 size, u32 batch, u32 count);
+};
+
+extern const struct bench_transport bench_ipi;
+extern const struct bench_transport bench_ipi_queue;
+extern const struct bench_transport bench_shmem;
+extern const struct bench_transport bench_mailbox;
+
+/* Time stamps, from the PMU cycle counter or the global timer */
+u64 bench_now(void);
+u64 bench_ticks_to_ns(u64 ticks);
+
+/* bench_stats.c */
+void bench_stats_reset(void);
+void bench_stats_record(u64 ticks);
+void bench_stats_report(const char *name, u32 size);
+void bench_throughput_report(const char *name, u32 size, u32 batch,
+			     u32 count, u64 ticks);
+
+#endif /* __IPC_BENCH_H__ */
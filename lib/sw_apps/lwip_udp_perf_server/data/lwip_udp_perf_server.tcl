@@ -41,6 +41,11 @@ proc check_emac_hw {} {
         return;
     }
 
+    set temacs [hsi::get_cells -hier -filter { ip_name == "xxv_ethernet" }];
+    if { [llength $temacs] != 0 } {
+        return;
+    }
+
     set temacs [hsi::get_cells -hier -filter { ip_name == "ps7_ethernet" }];
     if { [llength $temacs] != 0 } {
             return;
@@ -214,6 +219,14 @@ proc generate_emac_config {fp} {
         }
     }
 
+    set temacs [hsi::get_cells -hier -filter { ip_name == "xxv_ethernet" }];
+    if { [llength $temacs] > 0 } {
+        set temac [lindex $temacs 0]
+        set emac_baseaddr [string toupper "XPAR_${temac}_BASEADDR"];
+        puts $fp "#define PLATFORM_EMAC_BASEADDR $emac_baseaddr";
+        return;
+    }
+
     set temacs [hsi::get_cells -hier -filter { ip_name == "ps7_ethernet" }];
     if { [llength $temacs] > 0 } {
             puts $fp "#define PLATFORM_EMAC_BASEADDR XPAR_XEMACPS_0_BASEADDR";
@@ -0,0 +1,110 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "xparameters.h"
+#include "xil_types.h"
+#include "xil_printf.h"
+
+#include "platform.h"
+#include "memory_config.h"
+#include "membench.h"
+
+/*
+ * membench.c: Characterize the memory ranges present in the Hardware Design.
+ *
+ * For every memory range, STREAM bandwidth (copy, scale, add, triad) and
+ * pointer-chase latency are measured in a window at the start of the range,
+ * first with the cache attributes the BSP set up and then with each cache
+ * attribute of the processor, where the window covers whole attribute
+ * blocks of the range.
+ *
+ * Results are printed one per line as comma separated values prefixed with
+ * "MEMBENCH", after a header line naming the columns. Other lines start with
+ * '#', so the log can be fed to a CSV parser after filtering on the prefix.
+ */
+
+void membench_result(char8 *region, char8 *attr, char8 *test, u32 bytes,
+        u32 value, char8 *unit)
+{
+    xil_printf("MEMBENCH,%s,%s,%s,%d,%d,%s\n\r", region, attr, test, bytes,
+            value, unit);
+}
+
+static void membench_run(char8 *region, char8 *attr, UINTPTR base, u32 size)
+{
+    membench_stream(region, attr, base, size);
+    membench_latency(region, attr, base, size);
+}
+
+static void membench_range(struct memory_range_s *range)
+{
+    u64 end = range->base + range->size;
+    u64 granule = membench_attr_granule((UINTPTR)range->base);
+    u64 base = (range->base + 0x3FU) & ~(u64)0x3FU;
+    u64 attr_size = 0U;
+    u64 size;
+    u32 sweep = 0U;
+    u32 i;
+
+    if (membench_attr_count() != 0U) {
+        if (granule == 0U) {
+            sweep = 1U;
+        } else {
+            u64 gbase = (range->base + granule - 1U) & ~(granule - 1U);
+            u64 gend = end & ~(granule - 1U);
+
+            /* Attributes can only be changed on blocks inside the range */
+            if (gend > gbase) {
+                base = gbase;
+                sweep = 1U;
+            }
+        }
+    }
+    if (base >= end) {
+        return;
+    }
+    size = end - base;
+    if (size > MEMBENCH_WINDOW_MAX) {
+        size = MEMBENCH_WINDOW_MAX;
+    }
+    if ((sweep != 0U) && (granule != 0U)) {
+        attr_size = (size + granule - 1U) & ~(granule - 1U);
+    }
+
+    xil_printf("# %s (%s): window 0x%lx, 0x%x bytes\n\r", range->name,
+            range->ip, (UINTPTR)base, (u32)size);
+
+    membench_run(range->name, "bsp", (UINTPTR)base, (u32)size);
+
+    if (sweep == 0U) {
+        return;
+    }
+    for (i = 0U; i < membench_attr_count(); i++) {
+        const struct membench_attr_s *attr = membench_attr_get(i);
+
+        membench_attr_apply(attr, (UINTPTR)base, (u32)attr_size);
+        membench_run(range->name, attr->name, (UINTPTR)base, (u32)size);
+    }
+    membench_attr_restore((UINTPTR)base, (u32)attr_size);
+}
+
+int main()
+{
+    sint32 i;
+
+    init_platform();
+    membench_timer_init();
+
+    print("# --Starting Memory Benchmark Application--\n\r");
+    print("MEMBENCH,region,attr,test,bytes,value,unit\n\r");
+
+    for (i = 0; i < n_memory_ranges; i++) {
+        membench_range(&memory_ranges[i]);
+    }
+
+    print("# --Memory Benchmark Application Complete--\n\r");
+    cleanup_platform();
+    return 0;
+}
@@ -0,0 +1,52 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef __MEMBENCH_H_
+#define __MEMBENCH_H_
+
+#include "xil_types.h"
+#include "memory_config.h"
+
+/* Largest part of a memory range used by the benchmark */
+#if defined (ARMR5)
+#define MEMBENCH_WINDOW_MAX	0x400000U
+#else
+#define MEMBENCH_WINDOW_MAX	0xC00000U
+#endif
+
+/* STREAM element, the native register width */
+#if defined (__aarch64__)
+typedef u64 membench_elem_t;
+#else
+typedef u32 membench_elem_t;
+#endif
+
+/* A cache attribute the benchmark measures the memories with */
+struct membench_attr_s {
+    char8 *name;
+    u64 attr;
+};
+
+/* membench_arch.c: timer and cache attribute control of the processor */
+void membench_timer_init(void);
+u64 membench_now(void);
+u64 membench_ticks_per_sec(void);
+u32 membench_attr_count(void);
+const struct membench_attr_s *membench_attr_get(u32 idx);
+u64 membench_attr_granule(UINTPTR addr);
+void membench_attr_apply(const struct membench_attr_s *attr, UINTPTR base, u32 size);
+void membench_attr_restore(UINTPTR base, u32 size);
+
+/* membench_stream.c */
+void membench_stream(char8 *region, char8 *attr, UINTPTR base, u32 size);
+
+/* membench_latency.c */
+void membench_latency(char8 *region, char8 *attr, UINTPTR base, u32 size);
+
+/* membench.c: result output */
+void membench_result(char8 *region, char8 *attr, char8 *test, u32 bytes,
+        u32 value, char8 *unit);
+
+#endif
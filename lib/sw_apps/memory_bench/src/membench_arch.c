@@ -0,0 +1,212 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "xparameters.h"
+#include "xil_types.h"
+#include "xil_cache.h"
+
+#include "membench.h"
+
+/*
+ * membench_arch.c: Processor specific parts of the memory benchmark.
+ *
+ * Time stamps come from the global timer (XTime_GetTime) on ARM and from an
+ * AXI Timer on MicroBlaze. 32-bit counters are extended to 64 bits.
+ *
+ * Cache attributes are changed with Xil_SetTlbAttributes on the Cortex-A
+ * processors, which works on 2MB blocks (1GB above 4GB) in AArch64 and 1MB
+ * sections in AArch32. The translation table has no query API, so blocks
+ * which were benchmarked are left Normal write-back cacheable, the BSP
+ * default for memory. On the Cortex-R5 a dedicated MPU region overlays the
+ * window and is disabled again afterwards. On MicroBlaze the D-Cache can only
+ * be switched as a whole.
+ */
+
+#if defined (__MICROBLAZE__)
+#include "xtmrctr.h"
+#else
+#include "xtime_l.h"
+#endif
+
+#if defined (ARMR5)
+#include "xil_mpu.h"
+#elif defined (__aarch64__) || defined (__arm__)
+#include "xil_mmu.h"
+#endif
+
+static u32 membench_timer_last;
+static u64 membench_timer_high;
+
+#if defined (__MICROBLAZE__)
+static XTmrCtr membench_timer;
+#endif
+
+#if defined (ARMR5)
+#define MEMBENCH_ATTR_GRANULE	MEMBENCH_WINDOW_MAX
+
+static u32 membench_mpu_region = 0xFFU;
+
+static const struct membench_attr_s membench_attrs[] = {
+    { "noncache", NORM_NSHARED_NCACHE | PRIV_RW_USER_RW },
+    { "wt", NORM_NSHARED_WT_NWA | PRIV_RW_USER_RW },
+    { "wb", NORM_NSHARED_WB_WA | PRIV_RW_USER_RW },
+};
+#elif defined (__aarch64__) || defined (__arm__)
+static const struct membench_attr_s membench_attrs[] = {
+    { "noncache", NORM_NONCACHE },
+    { "wt", NORM_WT_CACHE },
+    { "wb", NORM_WB_CACHE },
+};
+#elif defined (XPAR_MICROBLAZE_USE_DCACHE) && (XPAR_MICROBLAZE_USE_DCACHE != 0)
+#define MEMBENCH_DCACHE_SWITCH
+
+static const struct membench_attr_s membench_attrs[] = {
+    { "dcache-off", 0U },
+    { "dcache-on", 1U },
+};
+#endif
+
+/* Extend a 32-bit counter, it is read well within one wrap period */
+static u64 membench_timer_extend(u32 now)
+{
+    if (now < membench_timer_last) {
+        membench_timer_high += 0x100000000ULL;
+    }
+    membench_timer_last = now;
+
+    return membench_timer_high | now;
+}
+
+void membench_timer_init(void)
+{
+    membench_timer_last = 0U;
+    membench_timer_high = 0U;
+
+#if defined (__MICROBLAZE__)
+    XTmrCtr_Initialize(&membench_timer, XPAR_TMRCTR_0_DEVICE_ID);
+    XTmrCtr_SetOptions(&membench_timer, 0U, XTC_AUTO_RELOAD_OPTION);
+    XTmrCtr_SetResetValue(&membench_timer, 0U, 0U);
+    XTmrCtr_Start(&membench_timer, 0U);
+#endif
+}
+
+u64 membench_now(void)
+{
+#if defined (__MICROBLAZE__)
+    return membench_timer_extend(XTmrCtr_GetValue(&membench_timer, 0U));
+#else
+    XTime now;
+
+    XTime_GetTime(&now);
+    if (sizeof(now) > sizeof(u32)) {
+        return (u64)now;
+    }
+
+    return membench_timer_extend((u32)now);
+#endif
+}
+
+u64 membench_ticks_per_sec(void)
+{
+#if defined (__MICROBLAZE__)
+    return XPAR_TMRCTR_0_CLOCK_FREQ_HZ;
+#else
+    return COUNTS_PER_SECOND;
+#endif
+}
+
+u32 membench_attr_count(void)
+{
+#if defined (__aarch64__) || defined (__arm__) || defined (MEMBENCH_DCACHE_SWITCH)
+    return sizeof(membench_attrs) / sizeof(membench_attrs[0]);
+#else
+    return 0U;
+#endif
+}
+
+const struct membench_attr_s *membench_attr_get(u32 idx)
+{
+#if defined (__aarch64__) || defined (__arm__) || defined (MEMBENCH_DCACHE_SWITCH)
+    return &membench_attrs[idx];
+#else
+    (void)idx;
+    return NULL;
+#endif
+}
+
+/*
+ * Size and alignment of the blocks the attributes are changed in, 0 when
+ * the attribute applies to the whole address space.
+ */
+u64 membench_attr_granule(UINTPTR addr)
+{
+#if defined (ARMR5)
+    (void)addr;
+    return MEMBENCH_ATTR_GRANULE;
+#elif defined (__aarch64__)
+    return (addr < 0x100000000ULL) ? 0x200000ULL : 0x40000000ULL;
+#elif defined (__arm__)
+    (void)addr;
+    return 0x100000U;
+#else
+    (void)addr;
+    return 0U;
+#endif
+}
+
+void membench_attr_apply(const struct membench_attr_s *attr, UINTPTR base, u32 size)
+{
+#if defined (ARMR5)
+    (void)size;
+    if (membench_mpu_region == 0xFFU) {
+        membench_mpu_region = Xil_GetNextMPURegion();
+        if (membench_mpu_region == 0xFFU) {
+            return;
+        }
+    }
+    Xil_SetMPURegionByRegNum(membench_mpu_region, (INTPTR)base,
+            MEMBENCH_ATTR_GRANULE, (u32)attr->attr);
+#elif defined (__aarch64__) || defined (__arm__)
+    u64 granule = membench_attr_granule(base);
+    u64 offset;
+
+    for (offset = 0U; offset < size; offset += granule) {
+        Xil_SetTlbAttributes(base + (UINTPTR)offset, attr->attr);
+    }
+#elif defined (MEMBENCH_DCACHE_SWITCH)
+    (void)base;
+    (void)size;
+    if (attr->attr != 0U) {
+        Xil_DCacheEnable();
+    } else {
+        Xil_DCacheDisable();
+    }
+#else
+    (void)attr;
+    (void)base;
+    (void)size;
+#endif
+}
+
+void membench_attr_restore(UINTPTR base, u32 size)
+{
+#if defined (ARMR5)
+    (void)base;
+    (void)size;
+    if (membench_mpu_region != 0xFFU) {
+        Xil_DisableMPURegionByRegNum(membench_mpu_region);
+        membench_mpu_region = 0xFFU;
+    }
+#elif defined (__aarch64__) || defined (__arm__)
+    membench_attr_apply(&membench_attrs[2], base, size);
+#elif defined (MEMBENCH_DCACHE_SWITCH)
+    (void)base;
+    (void)size;
+    Xil_DCacheEnable();
+#else
+    (void)base;
+    (void)size;
+#endif
+}
@@ -0,0 +1,101 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "xil_types.h"
+
+#include "membench.h"
+
+/*
+ * membench_latency.c: Pointer-chase load latency.
+ *
+ * For working sets doubling from MEMBENCH_CHASE_MIN up to the window, one
+ * node per cache line is linked into a single random cycle, which defeats
+ * the prefetchers, and the dependent loads following it are timed. The
+ * latency steps show where the working set leaves each cache level.
+ */
+
+#define MEMBENCH_CHASE_MIN	0x1000U
+#define MEMBENCH_CHASE_STRIDE	64U
+#define MEMBENCH_CHASE_LOADS	0x40000U
+
+struct membench_node_s {
+    struct membench_node_s *next;
+    u32 idx;
+};
+
+/* Keeps the end of the chase alive */
+volatile struct membench_node_s *membench_chase_sink;
+
+static u32 membench_rand_state = 1U;
+
+static u32 membench_rand(void)
+{
+    membench_rand_state = (membench_rand_state * 1664525U) + 1013904223U;
+
+    /* The low bits of the LCG are weak */
+    return membench_rand_state >> 8;
+}
+
+static struct membench_node_s *membench_node(UINTPTR base, u32 i)
+{
+    return (struct membench_node_s *)(base + ((UINTPTR)i * MEMBENCH_CHASE_STRIDE));
+}
+
+static void membench_chase_build(UINTPTR base, u32 n)
+{
+    u32 i, j, tmp;
+
+    for (i = 0U; i < n; i++) {
+        membench_node(base, i)->idx = i;
+    }
+
+    /* Sattolo's shuffle gives a single cycle through all nodes */
+    for (i = n - 1U; i > 0U; i--) {
+        j = membench_rand() % i;
+        tmp = membench_node(base, i)->idx;
+        membench_node(base, i)->idx = membench_node(base, j)->idx;
+        membench_node(base, j)->idx = tmp;
+    }
+
+    for (i = 0U; i < n; i++) {
+        membench_node(base, i)->next = membench_node(base, membench_node(base, i)->idx);
+    }
+}
+
+static u64 membench_chase(struct membench_node_s *p, u32 loads)
+{
+    u64 start;
+    u32 i;
+
+    start = membench_now();
+    for (i = 0U; i < loads; i += 8U) {
+        p = p->next; p = p->next; p = p->next; p = p->next;
+        p = p->next; p = p->next; p = p->next; p = p->next;
+    }
+    membench_chase_sink = p;
+
+    return membench_now() - start;
+}
+
+void membench_latency(char8 *region, char8 *attr, UINTPTR base, u32 size)
+{
+    struct membench_node_s *head = membench_node(base, 0U);
+    u64 ticks;
+    u32 ws, n;
+
+    for (ws = MEMBENCH_CHASE_MIN; (ws <= size) && (ws != 0U); ws <<= 1) {
+        n = ws / MEMBENCH_CHASE_STRIDE;
+        membench_chase_build(base, n);
+
+        /* Warm up the caches and TLBs with one lap */
+        (void)membench_chase(head, (n + 7U) & ~7U);
+        ticks = membench_chase(head, MEMBENCH_CHASE_LOADS);
+
+        /* Latency of one load in ps */
+        membench_result(region, attr, "latency", ws,
+                (u32)((((ticks * 1000000U) / MEMBENCH_CHASE_LOADS) * 1000000U) /
+                    membench_ticks_per_sec()), "ps");
+    }
+}
@@ -0,0 +1,140 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "xil_types.h"
+
+#include "membench.h"
+
+/*
+ * membench_stream.c: STREAM copy, scale, add and triad kernels.
+ *
+ * The window is split into the three arrays a, b and c. Like STREAM, every
+ * kernel runs MEMBENCH_STREAM_NTIMES times and the best run is reported, the
+ * first run warming up caches and TLBs. Elements are integers of the native
+ * register width instead of doubles, so the kernels stay memory bound on
+ * processors without a double precision FPU.
+ */
+
+#define MEMBENCH_STREAM_NTIMES	5U
+#define MEMBENCH_STREAM_SCALAR	3U
+
+enum {
+    MEMBENCH_COPY,
+    MEMBENCH_SCALE,
+    MEMBENCH_ADD,
+    MEMBENCH_TRIAD,
+    MEMBENCH_KERNELS
+};
+
+static const struct {
+    char8 *name;
+    u32 arrays;	/* arrays accessed per element */
+} membench_kernels[MEMBENCH_KERNELS] = {
+    { "copy", 2U },
+    { "scale", 2U },
+    { "add", 3U },
+    { "triad", 3U },
+};
+
+static u32 membench_stream_check(const membench_elem_t *a, const membench_elem_t *b,
+        const membench_elem_t *c, u32 n)
+{
+    membench_elem_t aj = 1U, bj = 2U, cj = 0U;
+    u32 idx[3];
+    u32 i, k;
+
+    /* Replay the kernels on one element, as STREAM validates its arrays */
+    for (k = 0U; k < MEMBENCH_STREAM_NTIMES; k++) {
+        cj = aj;
+        bj = MEMBENCH_STREAM_SCALAR * cj;
+        cj = aj + bj;
+        aj = bj + (MEMBENCH_STREAM_SCALAR * cj);
+    }
+
+    idx[0] = 0U;
+    idx[1] = n / 2U;
+    idx[2] = n - 1U;
+    for (i = 0U; i < 3U; i++) {
+        if ((a[idx[i]] != aj) || (b[idx[i]] != bj) || (c[idx[i]] != cj)) {
+            return 0U;
+        }
+    }
+
+    return 1U;
+}
+
+void membench_stream(char8 *region, char8 *attr, UINTPTR base, u32 size)
+{
+    membench_elem_t *a = (membench_elem_t *)base;
+    membench_elem_t *b, *c;
+    u64 best[MEMBENCH_KERNELS];
+    u64 start, ticks;
+    u32 array_size = (size / 3U) & ~0x3FU;
+    u32 n = array_size / sizeof(membench_elem_t);
+    u32 i, j, k;
+
+    if (n == 0U) {
+        return;
+    }
+    b = (membench_elem_t *)(base + array_size);
+    c = (membench_elem_t *)(base + (2U * array_size));
+
+    for (j = 0U; j < n; j++) {
+        a[j] = 1U;
+        b[j] = 2U;
+        c[j] = 0U;
+    }
+
+    for (i = 0U; i < MEMBENCH_KERNELS; i++) {
+        best[i] = ~0ULL;
+    }
+
+    for (k = 0U; k < MEMBENCH_STREAM_NTIMES; k++) {
+        start = membench_now();
+        for (j = 0U; j < n; j++) {
+            c[j] = a[j];
+        }
+        ticks = membench_now() - start;
+        best[MEMBENCH_COPY] = (ticks < best[MEMBENCH_COPY]) ? ticks : best[MEMBENCH_COPY];
+
+        start = membench_now();
+        for (j = 0U; j < n; j++) {
+            b[j] = MEMBENCH_STREAM_SCALAR * c[j];
+        }
+        ticks = membench_now() - start;
+        best[MEMBENCH_SCALE] = (ticks < best[MEMBENCH_SCALE]) ? ticks : best[MEMBENCH_SCALE];
+
+        start = membench_now();
+        for (j = 0U; j < n; j++) {
+            c[j] = a[j] + b[j];
+        }
+        ticks = membench_now() - start;
+        best[MEMBENCH_ADD] = (ticks < best[MEMBENCH_ADD]) ? ticks : best[MEMBENCH_ADD];
+
+        start = membench_now();
+        for (j = 0U; j < n; j++) {
+            a[j] = b[j] + (MEMBENCH_STREAM_SCALAR * c[j]);
+        }
+        ticks = membench_now() - start;
+        best[MEMBENCH_TRIAD] = (ticks < best[MEMBENCH_TRIAD]) ? ticks : best[MEMBENCH_TRIAD];
+    }
+
+    if (membench_stream_check(a, b, c, n) == 0U) {
+        membench_result(region, attr, "stream-check", array_size, 0U, "fail");
+        return;
+    }
+
+    for (i = 0U; i < MEMBENCH_KERNELS; i++) {
+        u64 bytes = (u64)array_size * membench_kernels[i].arrays;
+
+        if (best[i] == 0U) {
+            best[i] = 1U;
+        }
+        /* Bandwidth in MB/s */
+        membench_result(region, attr, membench_kernels[i].name, array_size,
+                (u32)((bytes * membench_ticks_per_sec()) / (best[i] * 1000000U)),
+                "MB/s");
+    }
+}
@@ -0,0 +1,55 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "xparameters.h"
+#include "xil_cache.h"
+
+#include "platform_config.h"
+
+#ifdef STDOUT_IS_16550
+#include "xuartns550_l.h"
+#endif
+
+void
+enable_caches()
+{
+#ifdef __MICROBLAZE__
+#ifdef XPAR_MICROBLAZE_USE_ICACHE
+    Xil_ICacheEnable();
+#endif
+#ifdef XPAR_MICROBLAZE_USE_DCACHE
+    Xil_DCacheEnable();
+#endif
+#elif __arm__
+    // For ARM, BSP enables caches by default.
+#endif
+}
+
+void
+disable_caches()
+{
+    Xil_DCacheDisable();
+    Xil_ICacheDisable();
+}
+
+void
+init_platform()
+{
+    // The benchmark measures the memories with the cache configuration of
+    // the BSP first, so caches are left as the BSP set them up.
+    enable_caches();
+
+    /* if we have a uart 16550, then that needs to be initialized */
+#ifdef STDOUT_IS_16550
+    XUartNs550_SetBaud(STDOUT_BASEADDR, XPAR_XUARTNS550_CLOCK_HZ, 9600);
+    XUartNs550_SetLineControlReg(STDOUT_BASEADDR, XUN_LCR_8_DATA_BITS);
+#endif
+}
+
+void
+cleanup_platform()
+{
+    disable_caches();
+}
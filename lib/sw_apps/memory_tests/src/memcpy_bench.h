@@ -0,0 +1,13 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef __MEMCPY_BENCH_H_
+#define __MEMCPY_BENCH_H_
+
+#include "memory_config.h"
+
+void memcpy_bench_range(struct memory_range_s *range);
+
+#endif
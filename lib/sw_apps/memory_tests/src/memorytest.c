@@ -11,6 +11,8 @@
 
 #include "platform.h"
 #include "memory_config.h"
+#include "memcpy_bench.h"
+#include "memtest_engine.h"
 #include "xil_printf.h"
 
 /*
@@ -89,6 +91,15 @@ int main()
         test_memory_range(&memory_ranges[i]);
     }
 
+    for (i = 0; i < n_memory_ranges; i++) {
+        memcpy_bench_range(&memory_ranges[i]);
+    }
+
+    memtest_engine_init();
+    for (i = 0; i < n_memory_ranges; i++) {
+        memtest_engine_range(&memory_ranges[i]);
+    }
+
     print("--Memory Test Application Complete--\n\r");
     print("Successfully ran Memory Test Application");
     cleanup_platform();
@@ -0,0 +1,366 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "xparameters.h"
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xil_io.h"
+#include "xil_printf.h"
+
+#include "memtest_engine.h"
+
+/*
+ * memtest_engine.c: Bandwidth saturating memory test of the memory ranges
+ * present in the Hardware Design.
+ *
+ * A window at the start of each range is split into slices. The background
+ * pattern of all slices is written in parallel, one ZDMA channel per slice
+ * running in write only mode, while the CPU waits for the channels to
+ * complete. Designs without ZDMA fall back to CPU stores. Every slice is then
+ * put through a March C- test using 128-bit (NEON on AArch64) accesses as
+ * the memory cell, followed by an address-in-address pass which catches
+ * aliased and stuck address lines.
+ *
+ * For every slice, the March throughput and the first failing addresses are
+ * reported.
+ *
+ * The test uses the global timer through XTime_GetTime and hence is
+ * available only on ARM processors.
+ */
+
+#if defined (__aarch64__) || defined (__arm__)
+#include "xtime_l.h"
+#if defined (__aarch64__)
+#include <arm_neon.h>
+#endif
+#if defined (XPAR_XZDMA_NUM_INSTANCES)
+#include "xzdma.h"
+#define MEMTEST_ENGINE_USE_ZDMA
+#endif
+
+#define MEMTEST_ENGINE_MAX_SLICES	8U
+#define MEMTEST_ENGINE_WINDOW		0x400000U
+#define MEMTEST_ENGINE_MIN_SLICE	0x1000U
+#define MEMTEST_ENGINE_MAX_ERRORS	4U
+#define MEMTEST_ENGINE_PATTERN		0xA5A55A5AU
+#define MEMTEST_ENGINE_ZDMA_TIMEOUT	0x4000000U
+
+/* Number of full passes over a slice made by the March C- elements */
+#define MEMTEST_ENGINE_MARCH_PASSES	9U
+
+struct memtest_slice_s {
+    UINTPTR base;
+    u32 size;
+    u32 n_errors;
+    UINTPTR error_addr[MEMTEST_ENGINE_MAX_ERRORS];
+};
+
+static struct memtest_slice_s memtest_slices[MEMTEST_ENGINE_MAX_SLICES];
+
+#ifdef MEMTEST_ENGINE_USE_ZDMA
+static XZDma memtest_zdma[MEMTEST_ENGINE_MAX_SLICES];
+static u32 memtest_zdma_count;
+#endif
+
+static u32 memtest_mbps(u64 bytes, u64 ticks)
+{
+    if (ticks == 0U) {
+        ticks = 1U;
+    }
+
+    return (u32)((bytes * (u64)COUNTS_PER_SECOND) / (ticks * 1000000U));
+}
+
+#if defined (__aarch64__)
+static inline void memtest_store128(UINTPTR addr, u32 pattern)
+{
+    vst1q_u32((u32 *)addr, vdupq_n_u32(pattern));
+}
+
+static inline u32 memtest_match128(UINTPTR addr, u32 pattern)
+{
+    uint32x4_t eq = vceqq_u32(vld1q_u32((const u32 *)addr), vdupq_n_u32(pattern));
+
+    return (vminvq_u32(eq) == 0xFFFFFFFFU) ? 1U : 0U;
+}
+#else
+static inline void memtest_store128(UINTPTR addr, u32 pattern)
+{
+    u64 val = ((u64)pattern << 32) | pattern;
+
+    ((volatile u64 *)addr)[0] = val;
+    ((volatile u64 *)addr)[1] = val;
+}
+
+static inline u32 memtest_match128(UINTPTR addr, u32 pattern)
+{
+    u64 val = ((u64)pattern << 32) | pattern;
+
+    return ((((volatile u64 *)addr)[0] == val) &&
+            (((volatile u64 *)addr)[1] == val)) ? 1U : 0U;
+}
+#endif
+
+static void memtest_record_error(struct memtest_slice_s *slice, UINTPTR addr)
+{
+    if (slice->n_errors < MEMTEST_ENGINE_MAX_ERRORS) {
+        slice->error_addr[slice->n_errors] = addr;
+    }
+    slice->n_errors++;
+}
+
+/* Pin down the failing words of a 128-bit cell which did not match */
+static void memtest_record_cell(struct memtest_slice_s *slice, UINTPTR addr, u32 pattern)
+{
+    u32 i;
+
+    for (i = 0U; i < 16U; i += 4U) {
+        if (Xil_In32(addr + i) != pattern) {
+            memtest_record_error(slice, addr + i);
+        }
+    }
+}
+
+static void memtest_fill_cpu(struct memtest_slice_s *slice, u32 pattern)
+{
+    UINTPTR addr;
+
+    for (addr = slice->base; addr < (slice->base + slice->size); addr += 16U) {
+        memtest_store128(addr, pattern);
+    }
+}
+
+#ifdef MEMTEST_ENGINE_USE_ZDMA
+static XStatus memtest_fill_zdma(u32 n_slices, u32 pattern)
+{
+    u32 wo_data[4] = { pattern, pattern, pattern, pattern };
+    XZDma_Transfer data;
+    u32 timeout;
+    u32 i;
+
+    /* Kick off every channel before waiting on any of them */
+    for (i = 0U; i < n_slices; i++) {
+        XZDma_WOData(&memtest_zdma[i], wo_data);
+
+        data.SrcAddr = 0U;
+        data.DstAddr = memtest_slices[i].base;
+        data.Size = memtest_slices[i].size;
+        data.SrcCoherent = memtest_zdma[i].Config.IsCacheCoherent;
+        data.DstCoherent = memtest_zdma[i].Config.IsCacheCoherent;
+        data.Pause = 0U;
+
+        XZDma_IntrClear(&memtest_zdma[i], XZDMA_IXR_ALL_INTR_MASK);
+        if (XZDma_Start(&memtest_zdma[i], &data, 1U) != XST_SUCCESS) {
+            return XST_FAILURE;
+        }
+    }
+
+    for (i = 0U; i < n_slices; i++) {
+        timeout = MEMTEST_ENGINE_ZDMA_TIMEOUT;
+        while ((XZDma_IntrGetStatus(&memtest_zdma[i]) & XZDMA_IXR_DMA_DONE_MASK) == 0U) {
+            if (--timeout == 0U) {
+                return XST_FAILURE;
+            }
+        }
+        XZDma_IntrClear(&memtest_zdma[i], XZDMA_IXR_ALL_INTR_MASK);
+
+        /* No interrupt handler runs to move the channel back to idle */
+        memtest_zdma[i].ChannelState = XZDMA_IDLE;
+    }
+
+    return XST_SUCCESS;
+}
+#endif
+
+/*
+ * One March element: read each cell expecting 'expect' and, when 'write' is
+ * set, replace it with the complement. Cells are visited in ascending or
+ * descending address order.
+ */
+static void memtest_march_element(struct memtest_slice_s *slice, u32 ascending,
+        u32 expect, u32 write)
+{
+    UINTPTR addr;
+    u32 i;
+    u32 n_cells = slice->size / 16U;
+
+    for (i = 0U; i < n_cells; i++) {
+        if (ascending != 0U) {
+            addr = slice->base + ((UINTPTR)i * 16U);
+        } else {
+            addr = slice->base + ((UINTPTR)(n_cells - 1U - i) * 16U);
+        }
+
+        if (memtest_match128(addr, expect) == 0U) {
+            memtest_record_cell(slice, addr, expect);
+        }
+        if (write != 0U) {
+            memtest_store128(addr, ~expect);
+        }
+    }
+}
+
+/* March C-, the initial (w0) element being the parallel fill */
+static u32 memtest_march(struct memtest_slice_s *slice, u32 pattern)
+{
+    XTime start, end;
+
+    XTime_GetTime(&start);
+    memtest_march_element(slice, 1U, pattern, 1U);
+    memtest_march_element(slice, 1U, ~pattern, 1U);
+    memtest_march_element(slice, 0U, pattern, 1U);
+    memtest_march_element(slice, 0U, ~pattern, 1U);
+    memtest_march_element(slice, 1U, pattern, 0U);
+    XTime_GetTime(&end);
+
+    return memtest_mbps((u64)slice->size * MEMTEST_ENGINE_MARCH_PASSES,
+            (u64)(end - start));
+}
+
+static void memtest_address_in_address(struct memtest_slice_s *slice)
+{
+    UINTPTR addr;
+
+    for (addr = slice->base; addr < (slice->base + slice->size); addr += 8U) {
+        *(volatile u64 *)addr = (u64)addr;
+    }
+    for (addr = slice->base; addr < (slice->base + slice->size); addr += 8U) {
+        if (*(volatile u64 *)addr != (u64)addr) {
+            memtest_record_error(slice, addr);
+        }
+    }
+}
+
+void memtest_engine_init(void)
+{
+#ifdef MEMTEST_ENGINE_USE_ZDMA
+    XZDma_Config *config;
+    XZDma_DataConfig data_config;
+    u16 i;
+
+    memtest_zdma_count = 0U;
+    for (i = 0U; (i < XPAR_XZDMA_NUM_INSTANCES) &&
+            (memtest_zdma_count < MEMTEST_ENGINE_MAX_SLICES); i++) {
+        XZDma *zdma = &memtest_zdma[memtest_zdma_count];
+
+        config = XZDma_LookupConfig(i);
+        if (config == NULL) {
+            continue;
+        }
+        if (XZDma_CfgInitialize(zdma, config, config->BaseAddress) != XST_SUCCESS) {
+            continue;
+        }
+        if (XZDma_SetMode(zdma, FALSE, XZDMA_WRONLY_MODE) != XST_SUCCESS) {
+            continue;
+        }
+
+        XZDma_GetChDataConfig(zdma, &data_config);
+        data_config.OverFetch = 0U;
+        data_config.SrcIssue = 0x1FU;
+        data_config.SrcBurstType = XZDMA_INCR_BURST;
+        data_config.SrcBurstLen = 0xFU;
+        data_config.DstBurstType = XZDMA_INCR_BURST;
+        data_config.DstBurstLen = 0xFU;
+        if (config->IsCacheCoherent != 0U) {
+            data_config.SrcCache = 0xFU;
+            data_config.DstCache = 0xFU;
+        }
+        XZDma_SetChDataConfig(zdma, &data_config);
+
+        XZDma_DisableIntr(zdma, XZDMA_IXR_ALL_INTR_MASK);
+        memtest_zdma_count++;
+    }
+#endif
+}
+
+void memtest_engine_range(struct memory_range_s *range)
+{
+    UINTPTR base = ((UINTPTR)range->base + 0x3FU) & ~(UINTPTR)0x3FU;
+    u32 window = range->size - (u32)(base - (UINTPTR)range->base);
+    u32 n_slices = MEMTEST_ENGINE_MAX_SLICES;
+    u32 slice_size;
+    u32 fill_mbps;
+    u32 use_zdma = 0U;
+    XTime start, end;
+    u32 i, j;
+
+    if (range->size < (u32)(base - (UINTPTR)range->base)) {
+        return;
+    }
+    if (window > MEMTEST_ENGINE_WINDOW) {
+        window = MEMTEST_ENGINE_WINDOW;
+    }
+
+#ifdef MEMTEST_ENGINE_USE_ZDMA
+    if (memtest_zdma_count != 0U) {
+        n_slices = memtest_zdma_count;
+        use_zdma = 1U;
+    }
+#endif
+    slice_size = (window / n_slices) & ~0x3FU;
+    if (slice_size < MEMTEST_ENGINE_MIN_SLICE) {
+        n_slices = 1U;
+        slice_size = window & ~0x3FU;
+    }
+    if (slice_size == 0U) {
+        return;
+    }
+
+    for (i = 0U; i < n_slices; i++) {
+        memtest_slices[i].base = base + ((UINTPTR)i * slice_size);
+        memtest_slices[i].size = slice_size;
+        memtest_slices[i].n_errors = 0U;
+    }
+
+    print("Parallel memory test: "); print(range->name); print("\n\r");
+
+    XTime_GetTime(&start);
+#ifdef MEMTEST_ENGINE_USE_ZDMA
+    if (use_zdma != 0U) {
+        if (memtest_fill_zdma(n_slices, MEMTEST_ENGINE_PATTERN) != XST_SUCCESS) {
+            print("    ZDMA fill failed, using CPU stores\n\r");
+            use_zdma = 0U;
+        }
+    }
+#endif
+    if (use_zdma == 0U) {
+        for (i = 0U; i < n_slices; i++) {
+            memtest_fill_cpu(&memtest_slices[i], MEMTEST_ENGINE_PATTERN);
+        }
+    }
+    XTime_GetTime(&end);
+    fill_mbps = memtest_mbps((u64)slice_size * n_slices, (u64)(end - start));
+
+    xil_printf("    fill of %d slices of 0x%x bytes (%s): %d MB/s\n\r", n_slices,
+            slice_size, (use_zdma != 0U) ? "ZDMA" : "CPU", fill_mbps);
+
+    for (i = 0U; i < n_slices; i++) {
+        struct memtest_slice_s *slice = &memtest_slices[i];
+        u32 march_mbps = memtest_march(slice, MEMTEST_ENGINE_PATTERN);
+
+        memtest_address_in_address(slice);
+
+        xil_printf("    slice %d at 0x%lx: March C- %d MB/s, %s", i, slice->base,
+                march_mbps, (slice->n_errors == 0U) ? "PASSED!" : "FAILED!");
+        if (slice->n_errors != 0U) {
+            xil_printf(" (%d errors)", slice->n_errors);
+        }
+        print("\n\r");
+
+        for (j = 0U; (j < slice->n_errors) && (j < MEMTEST_ENGINE_MAX_ERRORS); j++) {
+            xil_printf("        error at 0x%lx\n\r", slice->error_addr[j]);
+        }
+    }
+}
+#else
+void memtest_engine_init(void)
+{
+}
+
+void memtest_engine_range(struct memory_range_s *range)
+{
+    (void)range;
+}
+#endif
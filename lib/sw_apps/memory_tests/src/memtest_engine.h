@@ -0,0 +1,14 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef __MEMTEST_ENGINE_H_
+#define __MEMTEST_ENGINE_H_
+
+#include "memory_config.h"
+
+void memtest_engine_init(void);
+void memtest_engine_range(struct memory_range_s *range);
+
+#endif
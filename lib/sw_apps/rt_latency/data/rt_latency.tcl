@@ -0,0 +1,99 @@
+#/******************************************************************************
+#* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+#* SPDX-License-Identifier: MIT
+#******************************************************************************/
+
+proc swapp_get_name {} {
+    return "Real-Time Latency Benchmark"
+}
+
+proc swapp_get_description {} {
+    return " Interrupt latency, exception entry overhead and, on FreeRTOS, task switch and queue round trip times, with min/avg/p99/max histograms. Results of the Standalone and FreeRTOS BSPs are directly comparable. "
+}
+
+proc get_os {} {
+    set oslist [hsi::get_os]
+
+    if { [llength $oslist] != 1 } {
+        return 0
+    }
+    return [lindex $oslist 0]
+}
+
+proc check_supported_os {} {
+    set os [get_os]
+
+    if { $os == 0 } {
+        return 0
+    }
+    if { ( $os != "standalone" ) && ( [string match -nocase "freertos*" "$os"] == 0 ) } {
+        error "This application is supported only on the Standalone and FreeRTOS Board Support Packages."
+    }
+}
+
+proc swapp_is_supported_sw {} {
+    check_supported_os
+
+    return 1
+}
+
+proc get_proc_type {} {
+    set proc_instance [hsi::get_sw_processor]
+    set hw_processor [common::get_property HW_INSTANCE $proc_instance]
+    return [common::get_property IP_NAME [hsi::get_cells -hier $hw_processor]]
+}
+
+proc swapp_is_supported_hw {} {
+    set proc_type [get_proc_type]
+
+    if { ( $proc_type != "psu_cortexa53" ) && ( $proc_type != "psu_cortexr5" ) &&
+         ( $proc_type != "psv_cortexa72" ) && ( $proc_type != "psv_cortexr5" ) } {
+        error "This application is supported only for CortexA53/CortexR5/CortexA72 processors."
+    }
+
+    if { ( $proc_type == "psu_cortexa53" ) && ( [string match -nocase "freertos*" [get_os]] > 0 ) } {
+        set compiler [common::get_property CONFIG.compiler [hsi::get_sw_processor]]
+        if { [string compare -nocase $compiler "arm-none-eabi-gcc"] == 0 } {
+            error "ERROR: FreeRTOS is not supported for 32bit A53"
+        }
+    }
+
+    # the interrupts are raised by a TTC
+    if { [llength [hsi::get_cells -hier -filter { IP_NAME == "psu_ttc" || IP_NAME == "psv_ttc" }]] == 0 } {
+        error "This application requires a TTC in the hardware."
+    }
+
+    return 1
+}
+
+proc swapp_generate {} {
+    set os [get_os]
+
+    if { $os == "standalone" } {
+        set osdir "generic"
+    } elseif { [string match -nocase "freertos*" "$os"] > 0 } {
+        set osdir "freertos"
+    } else {
+        error "Invalid OS: $os"
+    }
+
+    foreach entry [glob -nocomplain -type f [file join system $osdir *]] {
+        file copy -force $entry "."
+    }
+
+    file delete -force "system"
+
+    return
+}
+
+proc swapp_get_linker_constraints {} {
+    return ""
+}
+
+proc swapp_get_supported_processors {} {
+    return "psu_cortexa53 psu_cortexr5 psv_cortexa72 psv_cortexr5"
+}
+
+proc swapp_get_supported_os {} {
+    return "freertos10_xilinx standalone"
+}
@@ -0,0 +1,206 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************
+ * rt_latency.c
+ * Interrupt latency tests, common to all BSPs.
+ *
+ * ttc-irq:	A TTC counter in interval mode raises an interrupt every
+ *		1/RT_TTC_HZ s. The counter restarts from 0 when the interrupt
+ *		is raised, so its value read first thing in the handler is the
+ *		latency from the event to the handler, including the exception
+ *		entry and the GIC dispatch, at TTC resolution.
+ * sgi-entry:	A software generated interrupt to this CPU is raised after
+ *		taking a time stamp, the handler takes the second one.
+ * sgi-return:	Time from raising the SGI until the interrupted code resumes,
+ *		the full exception entry and exit overhead.
+ *****************************************************************************/
+
+#include "xil_printf.h"
+#include "xstatus.h"
+#include "xtime_l.h"
+#include "xttcps.h"
+#include "rt_latency.h"
+
+static XTtcPs rt_ttc;
+static u32 rt_ttc_count_hz;
+static void (*rt_ttc_hook)(void);
+
+static volatile u64 rt_sgi_stamp;
+static volatile u32 rt_sgi_taken;
+static volatile u32 rt_sgi_record;
+
+u64 rt_now(void)
+{
+	XTime now;
+
+	XTime_GetTime(&now);
+
+	return (u64)now;
+}
+
+u32 rt_ticks_to_ns(u64 ticks)
+{
+	/* XTime wraps at 32 bits on the Cortex-R5 */
+	if (sizeof(XTime) == sizeof(u32))
+		ticks &= 0xFFFFFFFFU;
+
+	return (u32)((ticks * 1000000000U) / COUNTS_PER_SECOND);
+}
+
+static u32 rt_ttc_counts_to_ns(u32 counts)
+{
+	return (u32)(((u64)counts * 1000000000U) / rt_ttc_count_hz);
+}
+
+u32 rt_ttc_elapsed_ns(void)
+{
+	return rt_ttc_counts_to_ns(XTtcPs_GetCounterValue(&rt_ttc));
+}
+
+static void rt_ttc_handler(void *ref)
+{
+	XTtcPs *ttc = (XTtcPs *)ref;
+	u32 counts = XTtcPs_GetCounterValue(ttc);
+
+	XTtcPs_ClearInterruptStatus(ttc, XTtcPs_GetInterruptStatus(ttc));
+
+	if (rt_ttc_hook != NULL)
+		rt_ttc_hook();
+	else
+		rt_stats_record(rt_ttc_counts_to_ns(counts));
+}
+
+/*
+ * Start the TTC interrupts. Without a hook the handler records the latency,
+ * with one the hook is called instead, for the OS layer to measure further.
+ */
+s32 rt_ttc_start(void (*hook)(void))
+{
+	XTtcPs_Config *config;
+	XInterval interval;
+	u8 prescaler;
+	s32 status;
+
+	config = XTtcPs_LookupConfig(RT_TTC_DEVICE_ID);
+	if (config == NULL)
+		return XST_FAILURE;
+
+	status = XTtcPs_CfgInitialize(&rt_ttc, config, config->BaseAddress);
+	if (status == XST_DEVICE_IS_STARTED) {
+		XTtcPs_Stop(&rt_ttc);
+		status = XTtcPs_CfgInitialize(&rt_ttc, config, config->BaseAddress);
+	}
+	if (status != XST_SUCCESS)
+		return XST_FAILURE;
+
+	XTtcPs_SetOptions(&rt_ttc, XTTCPS_OPTION_INTERVAL_MODE |
+			  XTTCPS_OPTION_WAVE_DISABLE);
+	XTtcPs_CalcIntervalFromFreq(&rt_ttc, RT_TTC_HZ, &interval, &prescaler);
+	if (prescaler == 0xFFU)
+		return XST_FAILURE;
+	XTtcPs_SetInterval(&rt_ttc, interval);
+	XTtcPs_SetPrescaler(&rt_ttc, prescaler);
+
+	rt_ttc_count_hz = config->InputClockHz;
+	if (prescaler < XTTCPS_CLK_CNTRL_PS_DISABLE)
+		rt_ttc_count_hz >>= (prescaler + 1U);
+
+	rt_ttc_hook = hook;
+	status = rt_os_intr_connect(RT_TTC_INTR_ID, rt_ttc_handler, &rt_ttc);
+	if (status != XST_SUCCESS)
+		return XST_FAILURE;
+	rt_os_intr_enable(RT_TTC_INTR_ID);
+
+	XTtcPs_EnableInterrupts(&rt_ttc, XTTCPS_IXR_INTERVAL_MASK);
+	XTtcPs_Start(&rt_ttc);
+
+	return XST_SUCCESS;
+}
+
+void rt_ttc_stop(void)
+{
+	XTtcPs_Stop(&rt_ttc);
+	XTtcPs_DisableInterrupts(&rt_ttc, XTTCPS_IXR_INTERVAL_MASK);
+	rt_os_intr_disable(RT_TTC_INTR_ID);
+}
+
+static void rt_ttc_irq_test(void)
+{
+	rt_stats_reset();
+	if (rt_ttc_start(NULL) != XST_SUCCESS) {
+		xil_printf("# ttc-irq: TTC setup failed\r\n");
+		return;
+	}
+	while (rt_stats_count() < RT_SAMPLES)
+		rt_os_wait();
+	rt_ttc_stop();
+
+	xil_printf("# ttc-irq: TTC resolution %d ns\r\n",
+		   rt_ttc_counts_to_ns(1U));
+	rt_stats_report("ttc-irq");
+}
+
+static void rt_sgi_handler(void *ref)
+{
+	(void)ref;
+
+	if (rt_sgi_record != 0U)
+		rt_stats_record(rt_ticks_to_ns(rt_now() - rt_sgi_stamp));
+	rt_sgi_taken = 1U;
+}
+
+static void rt_sgi_test(void)
+{
+	u64 start;
+	u32 i;
+
+	if (rt_os_intr_connect(RT_SGI_ID, rt_sgi_handler, NULL) != XST_SUCCESS) {
+		xil_printf("# sgi: connect failed\r\n");
+		return;
+	}
+	rt_os_intr_enable(RT_SGI_ID);
+
+	/* Entry: the handler takes the second time stamp */
+	rt_stats_reset();
+	rt_sgi_record = 1U;
+	for (i = 0U; i < RT_SAMPLES; i++) {
+		rt_sgi_taken = 0U;
+		rt_sgi_stamp = rt_now();
+		XScuGic_SoftwareIntr(rt_os_gic(), RT_SGI_ID, XSCUGIC_SPI_CPU_MASK);
+		while (rt_sgi_taken == 0U)
+			;
+	}
+	rt_stats_report("sgi-entry");
+
+	/* Return: until the interrupted code sees the flag of the handler */
+	rt_stats_reset();
+	rt_sgi_record = 0U;
+	for (i = 0U; i < RT_SAMPLES; i++) {
+		rt_sgi_taken = 0U;
+		start = rt_now();
+		XScuGic_SoftwareIntr(rt_os_gic(), RT_SGI_ID, XSCUGIC_SPI_CPU_MASK);
+		while (rt_sgi_taken == 0U)
+			;
+		rt_stats_record(rt_ticks_to_ns(rt_now() - start));
+	}
+	rt_stats_report("sgi-return");
+
+	rt_os_intr_disable(RT_SGI_ID);
+}
+
+void rt_latency_run(void)
+{
+	xil_printf("# --Starting real-time latency benchmark on %s--\r\n",
+		   rt_os_name);
+	xil_printf("# time stamp resolution %d ns\r\n", rt_ticks_to_ns(1U));
+	xil_printf("RTLAT,os,test,samples,min,avg,p50,p99,max\r\n");
+
+	rt_ttc_irq_test();
+	rt_sgi_test();
+	rt_os_bench();
+
+	xil_printf("# --Real-time latency benchmark complete--\r\n");
+}
@@ -0,0 +1,64 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************
+ * rt_latency.h
+ * Common definitions of the real-time latency benchmark.
+ *
+ * The interrupt tests are shared by all BSPs, the OS layer (rt_os.c, copied
+ * from system/<os> when the application is generated) provides interrupt
+ * registration and the scheduler tests of the OS.
+ *****************************************************************************/
+
+#ifndef __RT_LATENCY_H__
+#define __RT_LATENCY_H__
+
+#include "xil_types.h"
+#include "xil_exception.h"
+#include "xparameters.h"
+#include "xscugic.h"
+
+/*
+ * TTC counter raising the interrupts. The FreeRTOS tick uses configTIMER_ID,
+ * TTC0 counter 0 by default; define both macros in the compiler flags to
+ * move the benchmark to another counter.
+ */
+#ifndef RT_TTC_DEVICE_ID
+#define RT_TTC_DEVICE_ID	XPAR_XTTCPS_1_DEVICE_ID
+#define RT_TTC_INTR_ID		XPAR_XTTCPS_1_INTR
+#endif
+
+#define RT_TTC_HZ		2000U	/* interrupt rate of the TTC test */
+#define RT_SGI_ID		7U	/* software generated interrupt */
+#define RT_SAMPLES		10000U	/* samples per test */
+
+/* Name of the BSP the results were taken on, for the result lines */
+extern const char *rt_os_name;
+
+/* Time stamps from XTime_GetTime */
+u64 rt_now(void);
+u32 rt_ticks_to_ns(u64 ticks);
+
+/* rt_latency.c */
+void rt_latency_run(void);
+s32 rt_ttc_start(void (*hook)(void));
+void rt_ttc_stop(void);
+u32 rt_ttc_elapsed_ns(void);
+
+/* rt_stats.c */
+void rt_stats_reset(void);
+void rt_stats_record(u32 ns);
+u32 rt_stats_count(void);
+void rt_stats_report(const char *test);
+
+/* rt_os.c */
+s32 rt_os_intr_connect(u16 intr_id, Xil_InterruptHandler handler, void *ref);
+void rt_os_intr_enable(u16 intr_id);
+void rt_os_intr_disable(u16 intr_id);
+XScuGic *rt_os_gic(void);
+void rt_os_wait(void);
+void rt_os_bench(void);
+
+#endif /* __RT_LATENCY_H__ */
@@ -0,0 +1,113 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************
+ * rt_stats.c
+ * Latency statistics and histograms.
+ *
+ * Every test prints min/avg/p50/p99/max, a histogram with buckets doubling
+ * from RT_HIST_MIN_NS and one result line of the form
+ * "RTLAT,<os>,<test>,<samples>,<min>,<avg>,<p50>,<p99>,<max>" in ns, which is
+ * what runs on different BSPs and port configurations are compared on.
+ *****************************************************************************/
+
+#include <stdlib.h>
+#include "xil_printf.h"
+#include "rt_latency.h"
+
+#define RT_HIST_BUCKETS		14U
+#define RT_HIST_MIN_NS		64U
+#define RT_HIST_BAR		40U
+
+static u32 samples[RT_SAMPLES];
+static volatile u32 num_samples;
+
+static int rt_cmp(const void *a, const void *b)
+{
+	u32 x = *(const u32 *)a;
+	u32 y = *(const u32 *)b;
+
+	return (x > y) - (x < y);
+}
+
+void rt_stats_reset(void)
+{
+	num_samples = 0U;
+}
+
+/* Called from interrupt handlers too */
+void rt_stats_record(u32 ns)
+{
+	if (num_samples < RT_SAMPLES) {
+		samples[num_samples] = ns;
+		num_samples++;
+	}
+}
+
+u32 rt_stats_count(void)
+{
+	return num_samples;
+}
+
+static u32 rt_percentile(u32 pct)
+{
+	return samples[((num_samples - 1U) * pct) / 100U];
+}
+
+void rt_stats_report(const char *test)
+{
+	u32 hist[RT_HIST_BUCKETS] = { 0U };
+	u32 max_count = 0U;
+	u64 sum = 0U;
+	u32 avg;
+	u32 limit;
+	u32 i, j;
+
+	if (num_samples == 0U) {
+		xil_printf("# %s: no samples\r\n", test);
+		return;
+	}
+
+	qsort(samples, num_samples, sizeof(samples[0]), rt_cmp);
+	for (i = 0U; i < num_samples; i++)
+		sum += samples[i];
+	avg = (u32)(sum / num_samples);
+
+	xil_printf("# %s: min %d avg %d p50 %d p99 %d max %d ns\r\n", test,
+		   samples[0], avg, rt_percentile(50U), rt_percentile(99U),
+		   samples[num_samples - 1U]);
+
+	for (i = 0U; i < num_samples; i++) {
+		limit = RT_HIST_MIN_NS;
+		for (j = 0U; j < (RT_HIST_BUCKETS - 1U); j++) {
+			if (samples[i] < limit)
+				break;
+			limit <<= 1U;
+		}
+		hist[j]++;
+	}
+	for (j = 0U; j < RT_HIST_BUCKETS; j++) {
+		if (hist[j] > max_count)
+			max_count = hist[j];
+	}
+
+	limit = RT_HIST_MIN_NS;
+	for (j = 0U; j < RT_HIST_BUCKETS; j++) {
+		if (hist[j] != 0U) {
+			if (j < (RT_HIST_BUCKETS - 1U))
+				xil_printf("#   < %8d ns %5d ", limit, hist[j]);
+			else
+				xil_printf("#   >=%8d ns %5d ", limit >> 1U, hist[j]);
+			for (i = 0U; i < (hist[j] * RT_HIST_BAR) / max_count; i++)
+				xil_printf("#");
+			xil_printf("\r\n");
+		}
+		limit <<= 1U;
+	}
+
+	xil_printf("RTLAT,%s,%s,%d,%d,%d,%d,%d,%d\r\n", rt_os_name, test,
+		   num_samples, samples[0], avg, rt_percentile(50U),
+		   rt_percentile(99U), samples[num_samples - 1U]);
+}
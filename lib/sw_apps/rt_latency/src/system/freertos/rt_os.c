@@ -0,0 +1,241 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************
+ * rt_os.c
+ * FreeRTOS BSP layer of the real-time latency benchmark.
+ *
+ * Interrupts are installed through the port, which owns the GIC. The
+ * benchmark runs in a task and adds the scheduler tests:
+ *
+ * irq-to-task:		TTC interrupt to a task woken by a notification from
+ *			the handler, at TTC resolution.
+ * notify-switch:	xTaskNotifyGive() to a blocked higher priority task
+ *			until it runs.
+ * yield-switch:	taskYIELD() to a task of the same priority.
+ * queue-roundtrip:	xQueueSend() to a higher priority task until its
+ *			answer is received back.
+ *****************************************************************************/
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "xil_printf.h"
+#include "xstatus.h"
+#include "rt_latency.h"
+
+#if defined (configTIMER_ID) && (configTIMER_ID == RT_TTC_DEVICE_ID)
+#error "The FreeRTOS tick uses the TTC counter of the benchmark, define RT_TTC_DEVICE_ID and RT_TTC_INTR_ID"
+#endif
+
+#define RT_MAIN_PRIORITY	(tskIDLE_PRIORITY + 2U)
+#define RT_STACK_SIZE		(configMINIMAL_STACK_SIZE * 4U)
+
+extern XScuGic xInterruptController;
+
+const char *rt_os_name = "freertos";
+
+static TaskHandle_t rt_main_task;
+static TaskHandle_t rt_peer_task;
+static QueueHandle_t rt_ping_queue;
+static QueueHandle_t rt_pong_queue;
+static volatile u64 rt_switch_stamp;
+static volatile u32 rt_switch_pending;
+
+s32 rt_os_intr_connect(u16 intr_id, Xil_InterruptHandler handler, void *ref)
+{
+	if (xPortInstallInterruptHandler(intr_id, handler, ref) != pdPASS)
+		return XST_FAILURE;
+
+	return XST_SUCCESS;
+}
+
+void rt_os_intr_enable(u16 intr_id)
+{
+	vPortEnableInterrupt(intr_id);
+}
+
+void rt_os_intr_disable(u16 intr_id)
+{
+	vPortDisableInterrupt(intr_id);
+}
+
+XScuGic *rt_os_gic(void)
+{
+	return &xInterruptController;
+}
+
+void rt_os_wait(void)
+{
+	vTaskDelay(1);
+}
+
+static void rt_irq_hook(void)
+{
+	BaseType_t woken = pdFALSE;
+
+	vTaskNotifyGiveFromISR(rt_main_task, &woken);
+	portYIELD_FROM_ISR(woken);
+}
+
+static void rt_irq_to_task_test(void)
+{
+	u32 i;
+
+	rt_stats_reset();
+	if (rt_ttc_start(rt_irq_hook) != XST_SUCCESS) {
+		xil_printf("# irq-to-task: TTC setup failed\r\n");
+		return;
+	}
+	for (i = 0U; i < RT_SAMPLES; i++) {
+		(void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		rt_stats_record(rt_ttc_elapsed_ns());
+	}
+	rt_ttc_stop();
+	rt_stats_report("irq-to-task");
+}
+
+static void rt_notify_peer(void *arg)
+{
+	(void)arg;
+
+	for (;;) {
+		(void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		rt_stats_record(rt_ticks_to_ns(rt_now() - rt_switch_stamp));
+	}
+}
+
+static void rt_yield_peer(void *arg)
+{
+	(void)arg;
+
+	for (;;) {
+		if (rt_switch_pending != 0U) {
+			rt_stats_record(rt_ticks_to_ns(rt_now() - rt_switch_stamp));
+			rt_switch_pending = 0U;
+		}
+		taskYIELD();
+	}
+}
+
+static void rt_queue_peer(void *arg)
+{
+	u32 msg;
+
+	(void)arg;
+
+	for (;;) {
+		(void)xQueueReceive(rt_ping_queue, &msg, portMAX_DELAY);
+		(void)xQueueSend(rt_pong_queue, &msg, portMAX_DELAY);
+	}
+}
+
+static s32 rt_peer_create(TaskFunction_t peer, UBaseType_t priority)
+{
+	if (xTaskCreate(peer, "rt_peer", RT_STACK_SIZE, NULL, priority,
+			&rt_peer_task) != pdPASS) {
+		xil_printf("# peer task creation failed\r\n");
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+static void rt_peer_delete(void)
+{
+	vTaskDelete(rt_peer_task);
+	/* Let the idle task free the peer */
+	vTaskDelay(1);
+}
+
+static void rt_notify_switch_test(void)
+{
+	u32 i;
+
+	if (rt_peer_create(rt_notify_peer, RT_MAIN_PRIORITY + 1U) != XST_SUCCESS)
+		return;
+
+	rt_stats_reset();
+	for (i = 0U; i < RT_SAMPLES; i++) {
+		rt_switch_stamp = rt_now();
+		(void)xTaskNotifyGive(rt_peer_task);
+	}
+	rt_peer_delete();
+	rt_stats_report("notify-switch");
+}
+
+static void rt_yield_switch_test(void)
+{
+	u32 i;
+
+	if (rt_peer_create(rt_yield_peer, RT_MAIN_PRIORITY) != XST_SUCCESS)
+		return;
+
+	rt_stats_reset();
+	for (i = 0U; i < RT_SAMPLES; i++) {
+		rt_switch_stamp = rt_now();
+		rt_switch_pending = 1U;
+		taskYIELD();
+	}
+	rt_peer_delete();
+	rt_stats_report("yield-switch");
+}
+
+static void rt_queue_roundtrip_test(void)
+{
+	u64 start;
+	u32 msg;
+	u32 i;
+
+	if (rt_peer_create(rt_queue_peer, RT_MAIN_PRIORITY + 1U) != XST_SUCCESS)
+		return;
+
+	rt_stats_reset();
+	for (i = 0U; i < RT_SAMPLES; i++) {
+		start = rt_now();
+		(void)xQueueSend(rt_ping_queue, &i, portMAX_DELAY);
+		(void)xQueueReceive(rt_pong_queue, &msg, portMAX_DELAY);
+		rt_stats_record(rt_ticks_to_ns(rt_now() - start));
+	}
+	rt_peer_delete();
+	rt_stats_report("queue-roundtrip");
+}
+
+void rt_os_bench(void)
+{
+	rt_irq_to_task_test();
+	rt_notify_switch_test();
+	rt_yield_switch_test();
+	rt_queue_roundtrip_test();
+}
+
+static void rt_main(void *arg)
+{
+	(void)arg;
+
+	rt_latency_run();
+	vTaskDelete(NULL);
+}
+
+int main(void)
+{
+	rt_ping_queue = xQueueCreate(1U, sizeof(u32));
+	rt_pong_queue = xQueueCreate(1U, sizeof(u32));
+	if ((rt_ping_queue == NULL) || (rt_pong_queue == NULL)) {
+		xil_printf("# queue creation failed\r\n");
+		return XST_FAILURE;
+	}
+
+	if (xTaskCreate(rt_main, "rt_main", RT_STACK_SIZE, NULL,
+			RT_MAIN_PRIORITY, &rt_main_task) != pdPASS) {
+		xil_printf("# task creation failed\r\n");
+		return XST_FAILURE;
+	}
+
+	vTaskStartScheduler();
+
+	for (;;)
+		;
+}
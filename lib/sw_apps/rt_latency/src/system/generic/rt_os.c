@@ -0,0 +1,86 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************
+ * rt_os.c
+ * Standalone BSP layer of the real-time latency benchmark.
+ *
+ * The application owns the GIC. There is no scheduler, so only the
+ * interrupt tests run.
+ *****************************************************************************/
+
+#include "xil_printf.h"
+#include "xstatus.h"
+#include "rt_latency.h"
+
+#define RT_GIC_DEVICE_ID	XPAR_SCUGIC_SINGLE_DEVICE_ID
+
+const char *rt_os_name = "standalone";
+
+static XScuGic rt_gic;
+
+s32 rt_os_intr_connect(u16 intr_id, Xil_InterruptHandler handler, void *ref)
+{
+	return XScuGic_Connect(&rt_gic, intr_id, handler, ref);
+}
+
+void rt_os_intr_enable(u16 intr_id)
+{
+	XScuGic_Enable(&rt_gic, intr_id);
+}
+
+void rt_os_intr_disable(u16 intr_id)
+{
+	XScuGic_Disable(&rt_gic, intr_id);
+}
+
+XScuGic *rt_os_gic(void)
+{
+	return &rt_gic;
+}
+
+void rt_os_wait(void)
+{
+}
+
+void rt_os_bench(void)
+{
+	xil_printf("# task switch and queue tests need the FreeRTOS BSP\r\n");
+}
+
+static s32 rt_gic_init(void)
+{
+	XScuGic_Config *config;
+	s32 status;
+
+	config = XScuGic_LookupConfig(RT_GIC_DEVICE_ID);
+	if (config == NULL)
+		return XST_FAILURE;
+
+	status = XScuGic_CfgInitialize(&rt_gic, config,
+				       config->CpuBaseAddress);
+	if (status != XST_SUCCESS)
+		return XST_FAILURE;
+
+	Xil_ExceptionInit();
+	Xil_ExceptionRegisterHandler(XIL_EXCEPTION_ID_INT,
+				     (Xil_ExceptionHandler)XScuGic_InterruptHandler,
+				     &rt_gic);
+	Xil_ExceptionEnable();
+
+	return XST_SUCCESS;
+}
+
+int main(void)
+{
+	if (rt_gic_init() != XST_SUCCESS) {
+		xil_printf("# GIC setup failed\r\n");
+		return XST_FAILURE;
+	}
+
+	rt_latency_run();
+
+	return 0;
+}
@@ -21,6 +21,22 @@
  *      You can also subsequently modify these sources to adapt the bootloader for any
  *      specific scenario that you might require it for.
  *
+ *      The flash is read in blocks of FLASH_READ_BLOCK_SIZE bytes and the SREC lines
+ *      are parsed from the block. Data records for contiguous addresses are collected
+ *      and copied to memory in runs of up to SREC_COALESCE_BYTES bytes.
+ *
+ *      For a faster boot the image may instead be stored as a binary image, which is
+ *      copied to memory without any parsing. It starts with a header of 32 bit big
+ *      endian fields:
+ *
+ *      0x00    BIN_IMAGE_MAGIC ("XBIN")
+ *      0x04    load address
+ *      0x08    length of the data in bytes
+ *      0x0C    entry point
+ *      0x10    32 bit sum of the data bytes
+ *      0x14    data, e.g. from "mb-objcopy -O binary" of an application linked to a
+ *              single memory region
+ *
  */
 
 
@@ -38,11 +54,23 @@
 #define CR       13
 #define RECORD_TYPE	2
 #define BYTE_COUNT	2
-#define RECORD_TERMINATOR	2
 
 /* Comment the following line, if you want a smaller and faster bootloader which will be silent */
 #define VERBOSE
 
+/* Number of bytes read from flash in one SPI transfer, may be set in blconfig.h */
+#ifndef FLASH_READ_BLOCK_SIZE
+#define FLASH_READ_BLOCK_SIZE	1024
+#endif
+
+/* Size of the buffer collecting contiguous SREC data, may be set in blconfig.h */
+#ifndef SREC_COALESCE_BYTES
+#define SREC_COALESCE_BYTES	1024
+#endif
+
+#define BIN_IMAGE_MAGIC		"XBIN"
+#define BIN_IMAGE_HDR_SIZE	20
+
 /* Declarations */
 static void display_progress (uint32_t lines);
 static uint8_t load_exec ();
@@ -96,7 +124,11 @@ uint8  grab_hex_byte (uint8 *buf);
 /* Declarations */
 static void display_progress (uint32_t lines);
 static uint8_t load_exec ();
+static uint8_t load_srec (void (**laddr)());
+static uint8_t load_bin (void (**laddr)());
 static uint8_t flash_get_srec_line (uint8_t *buf);
+static uint8_t flash_get_bytes (uint8_t *buf, uint32_t len);
+static void flush_records (void);
 extern void init_stdout();
 uint8  grab_hex_byte (uint8 *buf);
 int FlashReadID(void);
@@ -113,14 +145,24 @@ static XSpi Spi;
 
 int mode = READ_WRITE_EXTRA_BYTES;
 
-u8 WriteBuffer[PAGE_SIZE + READ_WRITE_EXTRA_BYTES];
+u8 WriteBuffer[READ_WRITE_EXTRA_BYTES_4BYTE_MODE];
 /*
- * Buffer used during Read transactions.
+ * Buffer used during the Read ID transaction, the image is read through
+ * the block buffers.
  */
-u8 ReadBuffer[PAGE_SIZE + READ_WRITE_EXTRA_BYTES];
+u8 ReadBuffer[READ_WRITE_EXTRA_BYTES_4BYTE_MODE];
 
 u8 FlashID[3];
 
+/*
+ * Buffers of the block reads. The image data of the block starts after the
+ * command and address bytes.
+ */
+static u8 BlockTxBuffer[FLASH_READ_BLOCK_SIZE + READ_WRITE_EXTRA_BYTES_4BYTE_MODE];
+static u8 BlockRxBuffer[FLASH_READ_BLOCK_SIZE + READ_WRITE_EXTRA_BYTES_4BYTE_MODE];
+static u32 block_pos;	/* Next byte of the block to consume */
+static u32 block_len;	/* Number of image bytes in the block */
+
 extern int srec_line;
 
 #ifdef __cplusplus
@@ -136,7 +178,11 @@ extern void outbyte(char c);
 /* Data structures */
 static srec_info_t srinfo;
 static uint8_t sr_buf[SREC_MAX_BYTES];
-static uint8_t sr_data_buf[SREC_DATA_MAX_BYTES];
+
+/* Data of contiguous SREC records not yet copied to memory */
+static uint8_t coalesce_buf[SREC_COALESCE_BYTES];
+static uint8_t *coalesce_addr;
+static uint32_t coalesce_len;
 
 u32 flbuf;
 
@@ -146,7 +192,8 @@ static int8_t *errors[] = {
 	"Error while copying executable image into RAM",
 	"Error while reading an SREC line from flash",
 	"SREC line is corrupted",
-	"SREC has invalid checksum."
+	"SREC has invalid checksum.",
+	"Binary image has invalid checksum."
 };
 #endif
 
@@ -223,7 +270,7 @@ int main()
 	/* If we reach here, we are in error */
 
 #ifdef VERBOSE
-	if (ret > LD_SREC_LINE_ERROR) {
+	if ((ret > LD_SREC_LINE_ERROR) && (ret < BIN_CKSUM_ERROR)) {
 		print ("ERROR in SREC line: ");
 		putnum (srec_line);
 		print (errors[ret]);
@@ -363,11 +410,9 @@ static uint8_t load_exec ()
 {
 	uint8_t ret;
 	void (*laddr)();
-	int8_t done = 0;
+	uint8_t magic[4];
 	int Status;
 
-	srinfo.sr_data = sr_data_buf;
-
 	if(FlashID[FLASH_SIZE] > FLASH_16_MB) {
 		Status = FlashEnterExit4BAddMode(&Spi, ENTER_4B);
 		if(Status != XST_SUCCESS) {
@@ -375,10 +420,55 @@ static uint8_t load_exec ()
 		}
 		mode = READ_WRITE_EXTRA_BYTES_4BYTE_MODE;
 	}
+
+	if ((ret = flash_get_bytes (magic, sizeof(magic))) != 0)
+		return ret;
+
+	if (memcmp (magic, BIN_IMAGE_MAGIC, sizeof(magic)) == 0) {
+		ret = load_bin (&laddr);
+	} else {
+		/* Parse the SREC image from its start, still in the block */
+		block_pos -= sizeof(magic);
+		flbuf -= sizeof(magic);
+		ret = load_srec (&laddr);
+	}
+	if (ret != 0)
+		return ret;
+
+	if(FlashID[FLASH_SIZE] > FLASH_16_MB) {
+		Status = FlashEnterExit4BAddMode(&Spi, EXIT_4B);
+		if(Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+		mode = READ_WRITE_EXTRA_BYTES;
+	}
+#ifdef VERBOSE
+	print ("\r\nExecuting program starting at address: ");
+	putnum ((uint32_t)laddr);
+	print ("\r\n");
+#endif
+	(*laddr)();
+
+	/* We will be dead at this point */
+	return 0;
+}
+
+static uint8_t load_srec (void (**laddr)())
+{
+	uint8_t ret;
+	int8_t done = 0;
+
+	coalesce_len = 0;
+
 	while (!done) {
 		if ((ret = flash_get_srec_line (sr_buf)) != 0)
 			return ret;
 
+		/* Decode the data straight behind the data collected so far */
+		if ((SREC_COALESCE_BYTES - coalesce_len) < SREC_DATA_MAX_BYTES)
+			flush_records ();
+		srinfo.sr_data = &coalesce_buf[coalesce_len];
+
 		if ((ret = decode_srec_line (sr_buf, &srinfo)) != 0)
 			return ret;
 
@@ -391,110 +481,158 @@ static uint8_t load_exec ()
 			case SREC_TYPE_1:
 			case SREC_TYPE_2:
 			case SREC_TYPE_3:
-				memcpy ((void*)srinfo.addr, (void*)srinfo.sr_data, srinfo.dlen);
+				if (coalesce_len == 0) {
+					coalesce_addr = srinfo.addr;
+				} else if ((coalesce_addr + coalesce_len) != srinfo.addr) {
+					/* Not contiguous, start a new run with this record */
+					flush_records ();
+					memmove (coalesce_buf, srinfo.sr_data, srinfo.dlen);
+					coalesce_addr = srinfo.addr;
+				}
+				coalesce_len += srinfo.dlen;
 				break;
 			case SREC_TYPE_5:
 				break;
 			case SREC_TYPE_7:
 			case SREC_TYPE_8:
 			case SREC_TYPE_9:
-				laddr = (void (*)())srinfo.addr;
+				flush_records ();
+				*laddr = (void (*)())srinfo.addr;
 				done = 1;
 				ret = 0;
 				break;
 		}
 	}
 
-	if(FlashID[FLASH_SIZE] > FLASH_16_MB) {
-		Status = FlashEnterExit4BAddMode(&Spi, EXIT_4B);
-		if(Status != XST_SUCCESS) {
-			return XST_FAILURE;
-		}
-		mode = READ_WRITE_EXTRA_BYTES;
+	return 0;
+}
+
+static void flush_records (void)
+{
+	if (coalesce_len > 0) {
+		memcpy ((void*)coalesce_addr, (void*)coalesce_buf, coalesce_len);
+		coalesce_len = 0;
 	}
+}
+
+static uint32_t get_be32 (uint8_t *buf)
+{
+	return ((uint32_t)buf[0] << 24) | ((uint32_t)buf[1] << 16) |
+		((uint32_t)buf[2] << 8) | (uint32_t)buf[3];
+}
+
+static uint8_t load_bin (void (**laddr)())
+{
+	uint8_t ret;
+	uint8_t hdr[BIN_IMAGE_HDR_SIZE - 4];
+	uint8_t *addr;
+	uint32_t len;
+	uint32_t sum = 0;
+	uint32_t i;
+
+	if ((ret = flash_get_bytes (hdr, sizeof(hdr))) != 0)
+		return ret;
+
+	addr = (uint8_t *)get_be32 (&hdr[0]);
+	len = get_be32 (&hdr[4]);
+	*laddr = (void (*)())get_be32 (&hdr[8]);
+
 #ifdef VERBOSE
-	print ("\r\nExecuting program starting at address: ");
-	putnum ((uint32_t)laddr);
+	print ("Loading binary image to address: ");
+	putnum ((uint32_t)addr);
 	print ("\r\n");
 #endif
-	(*laddr)();
 
-	/* We will be dead at this point */
+	if ((ret = flash_get_bytes (addr, len)) != 0)
+		return ret;
+
+	for (i = 0; i < len; i++)
+		sum += addr[i];
+	if (sum != get_be32 (&hdr[12]))
+		return BIN_CKSUM_ERROR;
+
 	return 0;
 }
 
-static uint8_t flash_get_srec_line (uint8_t *buf)
+/*
+ * Copies the next len bytes of the image to buf, reading a new block from
+ * flash each time the current one is consumed.
+ */
+static uint8_t flash_get_bytes (uint8_t *buf, uint32_t len)
 {
 	int Status;
-	int i;
-	int len;
-	u8 ReadCmd = READ_CMD;
+	u32 count;
+
+	while (len > 0) {
+		if (block_pos == block_len) {
+			if(mode == READ_WRITE_EXTRA_BYTES) {
+				BlockTxBuffer[BYTE1] = READ_CMD;
+				BlockTxBuffer[BYTE2] = (u8) (flbuf >> 16);
+				BlockTxBuffer[BYTE3] = (u8) (flbuf >> 8);
+				BlockTxBuffer[BYTE4] = (u8) flbuf;
+			} else {
+				BlockTxBuffer[BYTE1] = READ_CMD;
+				BlockTxBuffer[BYTE2] = (u8) (flbuf >> 24);
+				BlockTxBuffer[BYTE3] = (u8) (flbuf >> 16);
+				BlockTxBuffer[BYTE4] = (u8) (flbuf >> 8);
+				BlockTxBuffer[BYTE5] = (u8) flbuf;
+			}
+
+			Status = XSpi_Transfer(&Spi, BlockTxBuffer, BlockRxBuffer,
+						FLASH_READ_BLOCK_SIZE + mode);
+			if(Status != XST_SUCCESS) {
+				return LD_SREC_LINE_ERROR;
+			}
+
+			block_pos = 0;
+			block_len = FLASH_READ_BLOCK_SIZE;
+		}
 
-	/*
-	 * Read 1st 4bytes of a record. Its contains the information about
-	 * the type of the record and number of bytes that follow in the
-	 * rest of the record (address + data + checksum).
-	 */
-	if(mode == READ_WRITE_EXTRA_BYTES) {
-		WriteBuffer[BYTE1] = ReadCmd;
-		WriteBuffer[BYTE2] = (u8) (flbuf >> 16);
-		WriteBuffer[BYTE3] = (u8) (flbuf >> 8);
-		WriteBuffer[BYTE4] = (u8) flbuf;
-	} else {
-		WriteBuffer[BYTE1] = ReadCmd;
-		WriteBuffer[BYTE2] = (u8) (flbuf >> 24);
-		WriteBuffer[BYTE3] = (u8) (flbuf >> 16);
-		WriteBuffer[BYTE4] = (u8) (flbuf >> 8);
-		WriteBuffer[BYTE5] = (u8) flbuf;
-	}
+		count = block_len - block_pos;
+		if (count > len)
+			count = len;
 
-	Status = XSpi_Transfer(&Spi, WriteBuffer, ReadBuffer,
-				(RECORD_TYPE + BYTE_COUNT + mode));
-	if(Status != XST_SUCCESS) {
-		return XST_FAILURE;
+		memcpy (buf, &BlockRxBuffer[mode + block_pos], count);
+		block_pos += count;
+		flbuf += count;
+		buf += count;
+		len -= count;
 	}
 
-	flbuf += RECORD_TYPE + BYTE_COUNT;
+	return 0;
+}
 
-	/*
-	 * Get the number of bytes (address + data + checksum) in a record.
-	 */
-	len = grab_hex_byte((ReadBuffer + mode + RECORD_TYPE)) * 2;
+static uint8_t flash_get_srec_line (uint8_t *buf)
+{
+	uint8_t ret;
+	int len;
 
-	for(i = 0; i < (RECORD_TYPE + BYTE_COUNT); i++)
-		*buf++ = ReadBuffer[mode + i];
+	/* Skip the terminator of the previous record, CR LF or LF alone */
+	do {
+		if ((ret = flash_get_bytes (buf, 1)) != 0)
+			return ret;
+	} while ((buf[0] == CR) || (buf[0] == '\n'));
 
 	/*
-	 * Read address + data + checksum from the record.
+	 * Read the rest of the 1st 4bytes of a record. Its contains the
+	 * information about the type of the record and number of bytes that
+	 * follow in the rest of the record (address + data + checksum).
 	 */
-	if(mode == READ_WRITE_EXTRA_BYTES) {
-		WriteBuffer[BYTE1] = ReadCmd;
-		WriteBuffer[BYTE2] = (u8) (flbuf >> 16);
-		WriteBuffer[BYTE3] = (u8) (flbuf >> 8);
-		WriteBuffer[BYTE4] = (u8) flbuf;
-	} else {
-		WriteBuffer[BYTE1] = ReadCmd;
-		WriteBuffer[BYTE2] = (u8) (flbuf >> 24);
-		WriteBuffer[BYTE3] = (u8) (flbuf >> 16);
-		WriteBuffer[BYTE4] = (u8) (flbuf >> 8);
-		WriteBuffer[BYTE5] = (u8) flbuf;
-	}
+	if ((ret = flash_get_bytes (buf + 1, RECORD_TYPE + BYTE_COUNT - 1)) != 0)
+		return ret;
 
-	Status = XSpi_Transfer(&Spi, WriteBuffer, ReadBuffer, (len + mode));
-	if(Status != XST_SUCCESS) {
-		return XST_FAILURE;
-	}
-
-	flbuf += (len + RECORD_TERMINATOR);
-
-	for(i = 0; i < len; i++)
-		*buf++ = ReadBuffer[mode + i];
+	/*
+	 * Get the number of bytes (address + data + checksum) in a record.
+	 */
+	len = grab_hex_byte(buf + RECORD_TYPE) * 2;
 
 	if ((RECORD_TYPE + BYTE_COUNT + len) > SREC_MAX_BYTES)
 		return LD_SREC_LINE_ERROR;
 
-	return 0;
-
+	/*
+	 * Read address + data + checksum from the record.
+	 */
+	return flash_get_bytes (buf + RECORD_TYPE + BYTE_COUNT, len);
 }
 #ifdef __PPC__
 
@@ -9,5 +9,6 @@
 #define LD_SREC_LINE_ERROR  2
 #define SREC_PARSE_ERROR    3
 #define SREC_CKSUM_ERROR    4
+#define BIN_CKSUM_ERROR     5
 
 #endif /* BL_ERRORS_H */
@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+###############################################################################
+# Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+# SPDX-License-Identifier: MIT
+###############################################################################
+#
+# Parser for the PLM debug log buffer of a PLM built with PLM_PRINT_BINLOG.
+#
+# The debug log holds the prints formatted as text mixed with binary log
+# records (see xil_binlog.h in the standalone BSP). The records are expanded
+# using the format strings in the xil_binlog_fmt section of the PLM ELF file.
+# The debug log is retrieved from the PLM using the event logging command
+# with sub command 2 (retrieve debug log buffer) and dumped to a binary
+# file, for example with "mrd -bin -file log.bin <addr> <words>" from xsdb.
+#
+# MODIFICATION HISTORY:
+#
+# Ver   Who  Date        Changes
+# ----- ---- ---------- -------------------------------------------------------
+# 1.00  ag   10/15/2026 First release
+#
+###############################################################################
+
+import argparse
+import re
+import struct
+import sys
+
+BINLOG_SECTION = "xil_binlog_fmt"
+BINLOG_SYNC = 0xA5
+BINLOG_MAX_ARGS = 8
+
+# Conversions of xil_printf
+SPEC_RE = re.compile(r"%([-0]*)([0-9]*)(l*)([a-zA-Z%])")
+
+
+def read_section(path, name):
+    """Returns the contents of an ELF section, 32 or 64-bit."""
+    with open(path, "rb") as f:
+        elf = f.read()
+    if elf[:4] != b"\x7fELF":
+        raise ValueError("%s is not an ELF file" % path)
+    is64 = elf[4] == 2
+    end = "<" if elf[5] == 1 else ">"
+    if is64:
+        shoff, = struct.unpack_from(end + "Q", elf, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from(end + "HHH", elf, 0x3A)
+        shdr = end + "IIQQQQIIQQ"
+    else:
+        shoff, = struct.unpack_from(end + "I", elf, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from(end + "HHH", elf, 0x2E)
+        shdr = end + "IIIIIIIIII"
+    sections = [struct.unpack_from(shdr, elf, shoff + i * shentsize)
+                for i in range(shnum)]
+    names = sections[shstrndx]
+    for sec in sections:
+        start = names[4] + sec[0]
+        if elf[start:elf.index(b"\0", start)].decode() == name:
+            return elf[sec[4]:sec[4] + sec[5]]
+    raise ValueError("%s has no %s section" % (path, name))
+
+
+def read_formats(data):
+    """Returns the format strings of the section by format ID, which is
+    the offset of the string in the section."""
+    formats = {}
+    offset = 0
+    for text in data.split(b"\0"):
+        if text:
+            formats[offset] = text.decode("latin-1")
+        offset += len(text) + 1
+    return formats
+
+
+def arg_count(fmt):
+    return sum(1 for m in SPEC_RE.finditer(fmt) if m.group(4) != "%")
+
+
+def expand(fmt, args):
+    """Formats a record the way xil_printf does."""
+    values = iter(args)
+
+    def convert(m):
+        flags, width, _, conv = m.groups()
+        if conv == "%":
+            return "%"
+        value = next(values)
+        if conv in "di":
+            value -= (value & 0x80000000) << 1
+            conv = "d"
+        elif conv == "u":
+            conv = "d"
+        elif conv in "xX":
+            pass
+        elif conv == "c":
+            return chr(value & 0xFF)
+        else:
+            return "<%%%s 0x%x>" % (conv, value)
+        return ("%" + flags + width + conv) % value
+
+    return SPEC_RE.sub(convert, fmt)
+
+
+def parse(data, formats):
+    """Yields the text of the log with the records expanded. Bytes that do
+    not start a valid record are text."""
+    index = 0
+    text = []
+    seq = None
+    while index < len(data):
+        record = None
+        if index + 8 <= len(data) and data[index + 3] == BINLOG_SYNC:
+            header, fmt_id = struct.unpack_from("<II", data, index)
+            nargs = (header >> 16) & 0xFF
+            fmt = formats.get(fmt_id)
+            if (nargs <= BINLOG_MAX_ARGS and fmt is not None and
+                    arg_count(fmt) == nargs and
+                    index + 8 + nargs * 4 <= len(data)):
+                args = struct.unpack_from("<%dI" % nargs, data, index + 8)
+                record = (header & 0xFFFF, fmt, args)
+        if record is None:
+            if data[index] != 0:
+                text.append(chr(data[index]))
+            index += 1
+            continue
+        if text:
+            yield "".join(text)
+            text = []
+        if seq is not None and record[0] != seq:
+            yield "[%u binary log records lost]\n" % ((record[0] - seq) & 0xFFFF)
+        seq = (record[0] + 1) & 0xFFFF
+        yield expand(record[1], record[2])
+        index += 8 + len(record[2]) * 4
+    if text:
+        yield "".join(text)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Decode the PLM debug log buffer with binary log records")
+    parser.add_argument("elf", help="PLM ELF file")
+    parser.add_argument("dump", help="binary dump of the debug log buffer")
+    args = parser.parse_args()
+
+    formats = read_formats(read_section(args.elf, BINLOG_SECTION))
+    with open(args.dump, "rb") as f:
+        data = f.read()
+    for text in parse(data, formats):
+        sys.stdout.write(text)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
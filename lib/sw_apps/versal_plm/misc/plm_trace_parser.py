@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+###############################################################################
+# Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+# SPDX-License-Identifier: MIT
+###############################################################################
+#
+# Parser for the PLM trace log buffer.
+#
+# The trace log is retrieved from the PLM using the event logging command
+# with sub command 6 (retrieve trace log buffer) and dumped to a binary file,
+# for example with "mrd -bin -file trace.bin <addr> <words>" from xsdb.
+#
+# MODIFICATION HISTORY:
+#
+# Ver   Who  Date        Changes
+# ----- ---- ---------- -------------------------------------------------------
+# 1.00  ag   10/14/2026 First release
+#
+###############################################################################
+
+import argparse
+import csv
+import struct
+import sys
+
+TRACE_LOG_LOAD_IMAGE = 0x1
+TRACE_LOG_PRTN_PERF = 0x2
+
+# Number of words in each known trace event
+TRACE_EVENT_LEN = {
+    TRACE_LOG_LOAD_IMAGE: 4,
+    TRACE_LOG_PRTN_PERF: 10,
+}
+
+TRACE_EVENT_ID_MASK = 0xFFFF
+TRACE_LOG_LEN_SHIFT = 16
+
+PRTN_PERF_FIELDS = ["time_ms", "image_id", "partition", "bytes", "total_us",
+                    "copy_us", "secure_us", "exec_us"]
+
+
+def read_words(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    count = len(data) // 4
+    return list(struct.unpack("<%dI" % count, data[:count * 4]))
+
+
+def parse(words):
+    """Yields (event id, record words). Words that do not start a known
+    record are skipped, so a partially overwritten record at the start of
+    a wrapped buffer or unused space at the end is ignored."""
+    index = 0
+    while index < len(words):
+        header = words[index]
+        event = header & TRACE_EVENT_ID_MASK
+        length = header >> TRACE_LOG_LEN_SHIFT
+        if (TRACE_EVENT_LEN.get(event) != length or
+                index + length > len(words)):
+            index += 1
+            continue
+        yield event, words[index:index + length]
+        index += length
+
+
+def time_ms(record):
+    return "%u.%03u" % (record[1], record[2])
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Decode the PLM trace log buffer")
+    parser.add_argument("dump", help="binary dump of the trace log buffer")
+    parser.add_argument("--csv", metavar="FILE",
+                        help="write partition load records as CSV")
+    args = parser.parse_args()
+
+    rows = []
+    for event, record in parse(read_words(args.dump)):
+        if event == TRACE_LOG_LOAD_IMAGE:
+            print("%12s ms  Load image 0x%08x" % (time_ms(record), record[3]))
+        elif event == TRACE_LOG_PRTN_PERF:
+            rows.append([time_ms(record), "0x%08x" % record[3]] + record[4:])
+            print("%12s ms  Image 0x%08x Partition %u: %u bytes, total %u us,"
+                  " copy %u us, secure %u us, exec %u us" %
+                  ((time_ms(record),) + tuple(record[3:])))
+
+    if args.csv:
+        with open(args.csv, "w", newline="") as f:
+            writer = csv.writer(f)
+            writer.writerow(PRTN_PERF_FIELDS)
+            writer.writerows(rows)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -38,6 +38,7 @@
 * 1.05  am   11/24/2021 Fixed doxygen warning
 * 1.06  bm   07/06/2022 Refactor versal and versal_net code
 *       bm   07/13/2022 Added compatibility check for In-Place PLM Update
+*       ag   10/15/2026 Register the debug log buffer as binary log output
 *
 * </pre>
 *
@@ -142,6 +143,9 @@ static int XPlm_Init(void)
 	if (XPlmi_IsPlmUpdateDone() != (u8)TRUE) {
 		XPlmi_InitDebugLogBuffer();
 	}
+#ifdef XPLMI_PRINT_BINLOG
+	XPlmi_InitBinLog();
+#endif
 
 	/** Initialize the processor, enable exceptions */
 	Status = XPlm_InitProc();
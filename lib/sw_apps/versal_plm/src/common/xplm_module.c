@@ -45,6 +45,7 @@
 *       bm   07/06/2022 Refactor versal and versal_net code
 *       ma   07/08/2022 Added support for secure lockdown
 *       dc   07/13/2022 Added OCP init calls
+* 1.08  ag   10/15/2026 Moved STL and SEM init to separate startup tasks
 *
 * </pre>
 *
@@ -72,12 +73,6 @@
 #ifndef VERSAL_NET
 #include "xplmi_ssit.h"
 #endif
-#ifdef XPLM_SEM
-#include "xilsem.h"
-#endif
-#ifdef PLM_ENABLE_STL
-#include "xplm_stl.h"
-#endif
 #ifdef PLM_OCP
 #include "xocp_keymgmt.h"
 #endif
@@ -118,7 +113,7 @@ int XPlm_ModuleInit(void *Arg)
 	 * 	-PM
 	 * 	-Loader
 	 * 	-Secure
-	 * 	-STL
+	 * STL and SEM are initialized as separate startup tasks
 	 */
 
 	Status = XPlmi_Init();
@@ -156,18 +151,6 @@ int XPlm_ModuleInit(void *Arg)
 #ifdef PLM_PUF
 	XPuf_Init();
 #endif
-#ifdef PLM_ENABLE_STL
-	Status = XPlm_StlInit();
-	if (Status != XST_SUCCESS) {
-		goto END;
-	}
-#endif
-#ifdef XPLM_SEM
-	Status = XSem_Init();
-	if (Status != XST_SUCCESS) {
-		goto END;
-	}
-#endif
 /* OCP module is applicable only for Versalnet */
 #ifdef PLM_OCP
 	Status = XOcp_KeyInit();
@@ -26,6 +26,7 @@
 * 1.03  rb   01/28/2021 Added Sem PreInit API to have CDO command handler
 *                       initialization, removed unused header file
 *       rb   03/09/2021 Updated Sem Init API call
+* 1.04  ag   10/15/2026 Updated XPlm_SemInit to run as a startup task
 *
 * </pre>
 *
@@ -56,12 +57,15 @@
 /**
  * @brief	It calls the XilSEM Init API to register CDO loader commands
  *
+ * @param	Arg is not used
+ *
  * @return	Status as defined in XilSEM library
  *
  *****************************************************************************/
-int XPlm_SemInit(void)
+int XPlm_SemInit(void *Arg)
 {
 	int Status = XST_FAILURE;
+	(void)Arg;
 
 	Status = XSem_Init();
 
@@ -23,6 +23,7 @@
 *       kc   03/23/2020 Minor code cleanup
 * 1.02  rb   01/28/2021 Added Sem PreInit prototype, updated header file
 *       rb   03/09/2021 Updated Sem Init API call
+* 1.03  ag   10/15/2026 Updated XPlm_SemInit to run as a startup task
 *
 * </pre>
 *
@@ -48,7 +49,7 @@ extern "C" {
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /************************** Function Prototypes ******************************/
-int XPlm_SemInit(void);
+int XPlm_SemInit(void *Arg);
 int XPlm_SemScanInit(void *Arg);
 
 /************************** Variable Definitions *****************************/
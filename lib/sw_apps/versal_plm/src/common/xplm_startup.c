@@ -42,6 +42,8 @@
 *       ma   07/13/2022 Fix bug in enabling SLVERR for RTC
 *       ma   07/29/2022 Replaced XPAR_XIPIPSU_0_DEVICE_ID macro with
 *                       XPLMI_IPI_DEVICE_ID
+* 1.07  ag   10/15/2026 Replaced sequential startup task list with a
+*                       dependency graph
 *
 * </pre>
 *
@@ -60,67 +62,140 @@
 #ifdef XPLM_SEM
 #include "xplm_sem_init.h"
 #endif
+#ifdef PLM_ENABLE_STL
+#include "xplm_stl.h"
+#endif
 
 /************************** Constant Definitions *****************************/
+/* Startup graph node indexes */
+#define XPLM_STARTUP_MODULE_INIT	(0U)
+#define XPLM_STARTUP_SEM_INIT		(1U)
+#define XPLM_STARTUP_STL_INIT		(2U)
+#define XPLM_STARTUP_PMC_CDO		(3U)
+#define XPLM_STARTUP_BOOT_PDI		(4U)
+#define XPLM_STARTUP_AFTER_BOOT_PDI	(5U)
+#define XPLM_STARTUP_KEEP_ALIVE		(6U)
+#define XPLM_STARTUP_SEM_SCAN		(7U)
+#define XPLM_STARTUP_NODE_MAX		(8U)
 
 /**************************** Type Definitions *******************************/
 typedef int (*TaskHandler)(void * PrivData);
 typedef struct {
-	TaskHandler Handler; /**< Task handler */
+	TaskHandler Handler; /**< Task handler, NULL if node is not present */
 	void * PrivData; /**< Private data */
+	u32 DepMask; /**< Nodes which must complete before this node starts */
 } StartupTaskHandler;
 
 /***************** Macros (Inline Functions) Definitions *********************/
+#define XPLM_STARTUP_DEP(Node)		((u32)1U << (Node))
 
 /************************** Function Prototypes ******************************/
-static int XPlm_PreBootTasks(void *Arg);
+static int XPlm_PmcCdoTasks(void *Arg);
+static int XPlm_StartupTaskRun(void *Arg);
+static int XPlm_TriggerStartupTasks(void);
 
 /************************** Variable Definitions *****************************/
+#ifdef XPLMI_IPI_DEVICE_ID
+static u32 MilliSeconds = XPLM_DEFAULT_FTTI_TIME;
+#endif /* XPLMI_IPI_DEVICE_ID */
+
+/**
+ * Startup task graph of the PLM, indexed by the XPLM_STARTUP_* node
+ * indexes. A node is triggered as soon as all the nodes in its DepMask have
+ * completed, so independent nodes do not wait for unrelated work queued
+ * before them.
+ */
+static const StartupTaskHandler StartUpTaskList[XPLM_STARTUP_NODE_MAX] = {
+	{XPlm_ModuleInit, NULL, 0U},
+#ifdef XPLM_SEM
+	/* SEM registers CDO command handlers, so it precedes the PMC CDO */
+	{XPlm_SemInit, NULL, XPLM_STARTUP_DEP(XPLM_STARTUP_MODULE_INIT)},
+#else
+	{NULL, NULL, 0U},
+#endif
+#ifdef PLM_ENABLE_STL
+	{XPlm_StlInit, NULL, XPLM_STARTUP_DEP(XPLM_STARTUP_MODULE_INIT)},
+#else
+	{NULL, NULL, 0U},
+#endif
+	{XPlm_PmcCdoTasks, NULL, XPLM_STARTUP_DEP(XPLM_STARTUP_MODULE_INIT) |
+		XPLM_STARTUP_DEP(XPLM_STARTUP_SEM_INIT)},
+	{XPlm_LoadBootPdi, NULL, XPLM_STARTUP_DEP(XPLM_STARTUP_PMC_CDO) |
+		XPLM_STARTUP_DEP(XPLM_STARTUP_STL_INIT)},
+	{XPlm_HookAfterBootPdi, NULL, XPLM_STARTUP_DEP(XPLM_STARTUP_BOOT_PDI)},
+#ifdef XPLMI_IPI_DEVICE_ID
+	{XPlm_CreateKeepAliveTask, (void *)&MilliSeconds,
+		XPLM_STARTUP_DEP(XPLM_STARTUP_BOOT_PDI)},
+#else
+	{NULL, NULL, 0U},
+#endif /* XPLMI_IPI_DEVICE_ID */
+#ifdef XPLM_SEM
+	{XPlm_SemScanInit, NULL, XPLM_STARTUP_DEP(XPLM_STARTUP_BOOT_PDI)},
+#else
+	{NULL, NULL, 0U},
+#endif
+};
+
+/* Nodes completed and nodes already handed to the task scheduler */
+static u32 StartupDoneMask;
+static u32 StartupTriggeredMask;
 
 /*****************************************************************************/
 
 /*****************************************************************************/
 /**
- * @brief This function call all the init functions of all the different
- * modules. As a part of init functions, modules can register the
- * command handlers, interrupt handlers with the interface layer.
+ * @brief This function adds the startup task graph of the PLM. Nodes with
+ * no dependencies are triggered right away and the remaining nodes are
+ * triggered as their dependencies complete. As a part of the module init
+ * node, modules can register the command handlers, interrupt handlers with
+ * the interface layer.
  *
  * @return	Status as defined in xplmi_status.h
  *
  *****************************************************************************/
 int XPlm_AddStartUpTasks(void)
+{
+	u32 Index;
+
+	StartupDoneMask = 0U;
+	StartupTriggeredMask = 0U;
+	/* Nodes not present in this configuration are treated as complete */
+	for (Index = 0U; Index < XPLM_STARTUP_NODE_MAX; Index++) {
+		if (StartUpTaskList[Index].Handler == NULL) {
+			StartupDoneMask |= XPLM_STARTUP_DEP(Index);
+			StartupTriggeredMask |= XPLM_STARTUP_DEP(Index);
+		}
+	}
+
+	return XPlm_TriggerStartupTasks();
+}
+
+/*****************************************************************************/
+/**
+ * @brief This function creates and triggers a task for every startup node
+ * whose dependencies have all completed and which is not triggered yet.
+ *
+ * @return	Status as defined in xplmi_status.h
+ *
+ *****************************************************************************/
+static int XPlm_TriggerStartupTasks(void)
 {
 	int Status = XST_FAILURE;
 	u32 Index;
 	XPlmi_TaskNode *Task;
-#ifdef XPLMI_IPI_DEVICE_ID
-	static u32 MilliSeconds = XPLM_DEFAULT_FTTI_TIME;
-#endif /* XPLMI_IPI_DEVICE_ID */
 
-	/**
-	 * Start up tasks of the PLM.
-	 * Current they point to the loading of the Boot PDI.
-	 */
-	const StartupTaskHandler StartUpTaskList[] = {
-		{XPlm_PreBootTasks, NULL},
-		{XPlm_LoadBootPdi, NULL},
-		{XPlm_HookAfterBootPdi, NULL},
-#ifdef XPLMI_IPI_DEVICE_ID
-		{XPlm_CreateKeepAliveTask, (void *)&MilliSeconds},
-#endif /* XPLMI_IPI_DEVICE_ID */
-#ifdef XPLM_SEM
-		{XPlm_SemScanInit, NULL},
-#endif
-	};
-
-	for (Index = 0U; Index < XPLMI_ARRAY_SIZE(StartUpTaskList); Index++) {
+	for (Index = 0U; Index < XPLM_STARTUP_NODE_MAX; Index++) {
+		if (((StartupTriggeredMask & XPLM_STARTUP_DEP(Index)) != 0U) ||
+			((StartUpTaskList[Index].DepMask & ~StartupDoneMask) != 0U)) {
+			continue;
+		}
 		Task = XPlmi_TaskCreate(XPLM_TASK_PRIORITY_0,
-			StartUpTaskList[Index].Handler,
-			StartUpTaskList[Index].PrivData);
+			XPlm_StartupTaskRun, (void *)(UINTPTR)Index);
 		if (Task == NULL) {
 			Status = XPlmi_UpdateStatus(XPLM_ERR_TASK_CREATE, 0);
 			goto END;
 		}
+		StartupTriggeredMask |= XPLM_STARTUP_DEP(Index);
 		microblaze_disable_interrupts();
 		XPlmi_TaskTriggerNow(Task);
 		microblaze_enable_interrupts();
@@ -131,6 +206,35 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief This function runs a startup graph node and triggers the nodes
+ * which become ready on its successful completion. A failing node is
+ * reported to the error manager through the task status and its dependent
+ * nodes are not started.
+ *
+ * @param	Arg is the index of the startup node
+ *
+ * @return	Status as defined in xplmi_status.h
+ *
+ *****************************************************************************/
+static int XPlm_StartupTaskRun(void *Arg)
+{
+	int Status = XST_FAILURE;
+	u32 Index = (u32)(UINTPTR)Arg;
+
+	Status = StartUpTaskList[Index].Handler(StartUpTaskList[Index].PrivData);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	StartupDoneMask |= XPLM_STARTUP_DEP(Index);
+	Status = XPlm_TriggerStartupTasks();
+
+END:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
 * @brief	This function enables SLVERR for PMC related modules
@@ -192,22 +296,17 @@ static void XPlm_EnableSlaveErrors(void)
 
 /*****************************************************************************/
 /**
-* @brief	This function executes pre boot tasks
+* @brief	This function enables slave errors and processes the PMC CDO
 *
-* @param	Arg is the argument passed to pre boot tasks
+* @param	Arg is the argument passed to PMC CDO tasks
 *
 * @return	Status as defined in xplmi_status.h
 *
 *****************************************************************************/
-static int XPlm_PreBootTasks(void* Arg)
+static int XPlm_PmcCdoTasks(void* Arg)
 {
 	int Status = XST_FAILURE;
 
-	Status = XPlm_ModuleInit(Arg);
-	if (Status != XST_SUCCESS) {
-		goto END;
-	}
-
 	/* Enable SLVERR's */
 	XPlm_EnableSlaveErrors();
 
@@ -21,6 +21,7 @@
 * 1.02  bsv  08/13/2021 Remove unwanted header file
 *       bsv  08/13/2021 Removed unwanted goto statements
 * 1.03  rama 01/18/2022 Included xplmi_status.h to fix compilation failure
+* 1.04  ag   10/15/2026 Updated XPlm_StlInit to run as a startup task
 *
 * </pre>
 *
@@ -80,12 +81,15 @@ END:
  * @brief This function initializes the STL module and registers the
  * STL handler.
  *
+ * @param	Arg is not used
+ *
  * @return	Status as defined in xplmi_status.h
  *
  *****************************************************************************/
-int XPlm_StlInit(void)
+int XPlm_StlInit(void *Arg)
 {
 	int Status = XST_FAILURE;
+	(void)Arg;
 
 	Status = XStl_Init(XPlm_ChangeStlPeriodicity);
 	if (Status != XST_SUCCESS) {
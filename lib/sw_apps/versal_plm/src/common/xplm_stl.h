@@ -18,6 +18,7 @@
 * 1.00  rama 08/12/2020 Initial release
 * 1.01  rama 03/22/2021 Updated hook for periodic STL execution and FTTI
 *                       configuration
+* 1.02  ag   10/15/2026 Updated XPlm_StlInit to run as a startup task
 *
 * </pre>
 *
@@ -43,7 +44,7 @@ extern "C" {
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /************************** Function Prototypes ******************************/
-int XPlm_StlInit(void);
+int XPlm_StlInit(void *Arg);
 int XPlm_PeriodicStlHook(void);
 
 /************************** Variable Definitions *****************************/
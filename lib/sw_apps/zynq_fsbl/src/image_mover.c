@@ -53,6 +53,9 @@
 *                       which is being used instead of one from DDR.
 *                       Deleted GetImageHeaderAndSignature() and added
 *                       GetNAuthImageHeader()
+* 13.0  ag  10/15/26    Bitstreams from non linear boot devices are read in
+*                       chunks and sent to the PCAP while the next chunk is
+*                       read, with the MD5 checksum calculated on the way.
 *
 * </pre>
 *
@@ -93,6 +96,7 @@
 u32 ValidateParition(u32 StartAddr, u32 Length, u32 ChecksumOffset);
 u32 GetPartitionChecksum(u32 ChecksumOffset, u8 *Checksum);
 u32 CalcPartitionChecksum(u32 SourceAddr, u32 DataLength, u8 *Checksum);
+u32 ComparePartitionChecksum(u8 *CalcChecksum, u32 ChecksumOffset);
 
 /************************** Variable Definitions *****************************/
 /*
@@ -154,6 +158,8 @@ u32 LoadBootImage(void)
 	u32 PartitionStartAddr;
 	u32 PartitionChecksumOffset;
 	u8 ExecAddrFlag = 0 ;
+	u8 PipelinedPartitionFlag;
+	u8 CalcChecksum[MD5_CHECKSUM_SIZE];
 	u32 Status;
 	PartHeader *HeaderPtr;
 	u32 EfuseStatusRegValue;
@@ -423,6 +429,17 @@ u32 LoadBootImage(void)
         	ExecAddress = PartitionExecAddr;
         }
 
+		/*
+		 * Plain bitstreams from non linear boot devices are sent to the
+		 * PCAP while being read, the checksum is calculated on the way
+		 */
+		if (PLPartitionFlag && (!LinearBootDeviceFlag) &&
+				(!SignedPartitionFlag) && (!EncryptedPartitionFlag)) {
+			PipelinedPartitionFlag = 1;
+		} else {
+			PipelinedPartitionFlag = 0;
+		}
+
 		/*
 		 * FSBL user hook call before bitstream download
 		 */
@@ -438,14 +455,32 @@ u32 LoadBootImage(void)
 		/*
 		 * Move partitions from boot device
 		 */
-		Status = PartitionMove(ImageStartAddress, HeaderPtr);
+		if (PipelinedPartitionFlag) {
+			Status = PartitionPipelinedLoad(ImageStartAddress, HeaderPtr,
+					CalcChecksum);
+		} else {
+			Status = PartitionMove(ImageStartAddress, HeaderPtr);
+		}
 		if (Status != XST_SUCCESS) {
 			fsbl_printf(DEBUG_GENERAL,"PARTITION_MOVE_FAIL\r\n");
 			OutputStatus(PARTITION_MOVE_FAIL);
 			FsblFallback();
 		}
 
-		if ((SignedPartitionFlag) || (PartitionChecksumFlag)) {
+		if (PipelinedPartitionFlag) {
+			if (PartitionChecksumFlag) {
+				Status = ComparePartitionChecksum(CalcChecksum,
+						ImageStartAddress +
+						(PartitionChecksumOffset << WORD_LENGTH_SHIFT));
+				if (Status != XST_SUCCESS) {
+					fsbl_printf(DEBUG_GENERAL,"PARTITION_CHECKSUM_FAIL\r\n");
+					OutputStatus(PARTITION_CHECKSUM_FAIL);
+					FsblFallback();
+				}
+
+				fsbl_printf(DEBUG_INFO, "Partition Validation Done\r\n");
+			}
+		} else if ((SignedPartitionFlag) || (PartitionChecksumFlag)) {
 			if(PLPartitionFlag) {
 				/*
 				 * PL partition loaded in to DDR temporary address
@@ -1203,6 +1238,133 @@ u32 PartitionMove(u32 ImageBaseAddress, PartHeader *Header)
 	return XST_SUCCESS;
 }
 
+/******************************************************************************/
+/**
+*
+* This function loads a non secure bitstream partition from a non linear boot
+* device into the fabric. The partition is read in PIPELINE_CHUNK_SIZE chunks
+* into two DDR buffers in turn, and each chunk is sent to the PCAP while the
+* next one is read. With a partition checksum, the MD5 is calculated over
+* the chunks as they are read, so no separate pass over the partition is
+* needed.
+*
+* @param	ImageBaseAddress Base address on flash
+* @param	Header Partition header pointer
+* @param	Checksum is where the calculated MD5 checksum is stored, if the
+*		partition has a checksum
+*
+* @return
+*		- XST_SUCCESS if the bitstream is loaded
+*		- XST_FAILURE if reading or loading the bitstream failed
+*
+* @note		The fabric is programmed before the checksum can be
+*		compared. The configuration logic still checks the CRC of the
+*		bitstream, and on a checksum mismatch the caller falls back to
+*		the next image, which programs the fabric again.
+*
+*******************************************************************************/
+u32 PartitionPipelinedLoad(u32 ImageBaseAddress, PartHeader *Header,
+				u8 *Checksum)
+{
+	u32 SourceAddr;
+	u32 Buffer;
+	u32 BitstreamLength;
+	u32 TotalLength;
+	u32 Offset = 0;
+	u32 Length;
+	u32 DmaLength;
+	u32 Index = 0;
+	u32 Pending = 0;
+	u32 LastChunk = 0;
+	u32 Status;
+	MD5Context Context;
+
+	SourceAddr = ImageBaseAddress;
+	SourceAddr += Header->PartitionStart<<WORD_LENGTH_SHIFT;
+	BitstreamLength = Header->ImageWordLen << WORD_LENGTH_SHIFT;
+
+	/*
+	 * The checksum covers the whole partition
+	 */
+	if (PartitionChecksumFlag) {
+		TotalLength = Header->PartitionWordLen << WORD_LENGTH_SHIFT;
+		MD5Init(&Context);
+	} else {
+		TotalLength = BitstreamLength;
+	}
+
+	Status = PcapStartChunkedLoad();
+	if (Status != XST_SUCCESS) {
+		fsbl_printf(DEBUG_GENERAL, "PCAP Init Failed\r\n");
+		return XST_FAILURE;
+	}
+
+	while (Offset < TotalLength) {
+		Length = TotalLength - Offset;
+		if (Length > PIPELINE_CHUNK_SIZE) {
+			Length = PIPELINE_CHUNK_SIZE;
+		}
+
+		/*
+		 * The buffer was last sent by the DMA completed before the
+		 * previous chunk was started
+		 */
+		Buffer = DDR_TEMP_START_ADDR + ((Index & 1) * PIPELINE_CHUNK_SIZE);
+
+		Status = MoveImage(SourceAddr + Offset, Buffer, Length);
+		if (Status != XST_SUCCESS) {
+			fsbl_printf(DEBUG_GENERAL, "Move Image Failed\r\n");
+			return XST_FAILURE;
+		}
+
+		if (PartitionChecksumFlag) {
+			MD5Update(&Context, (u8 *)Buffer, Length, 0);
+		}
+
+		if (Pending) {
+			Status = PcapWaitChunk(LastChunk);
+			if (Status != XST_SUCCESS) {
+				fsbl_printf(DEBUG_GENERAL, "PCAP Bitstream Download Failed\r\n");
+				return XST_FAILURE;
+			}
+			Pending = 0;
+		}
+
+		if (Offset < BitstreamLength) {
+			DmaLength = BitstreamLength - Offset;
+			if (DmaLength > Length) {
+				DmaLength = Length;
+			}
+			LastChunk = ((Offset + DmaLength) == BitstreamLength);
+
+			Status = PcapLoadChunk((u32 *)Buffer,
+					DmaLength >> WORD_LENGTH_SHIFT, LastChunk);
+			if (Status != XST_SUCCESS) {
+				fsbl_printf(DEBUG_GENERAL, "PCAP Bitstream Download Failed\r\n");
+				return XST_FAILURE;
+			}
+			Pending = 1;
+		}
+
+		Offset += Length;
+		Index++;
+	}
+
+	if (Pending) {
+		Status = PcapWaitChunk(LastChunk);
+		if (Status != XST_SUCCESS) {
+			fsbl_printf(DEBUG_GENERAL, "PCAP Bitstream Download Failed\r\n");
+			return XST_FAILURE;
+		}
+	}
+
+	if (PartitionChecksumFlag) {
+		MD5Final(&Context, Checksum, 0);
+	}
+
+	return XST_SUCCESS;
+}
+
 
 /******************************************************************************/
 /**
@@ -1257,10 +1419,8 @@ u32 DecryptPartition(u32 StartAddr, u32 DataLength, u32 ImageLength)
 *******************************************************************************/
 u32 ValidateParition(u32 StartAddr, u32 Length, u32 ChecksumOffset)
 {
-    u8  Checksum[MD5_CHECKSUM_SIZE];
     u8  CalcChecksum[MD5_CHECKSUM_SIZE];
     u32 Status;
-    u32 Index;
 
 #ifdef	XPAR_XWDTPS_0_BASEADDR
 	/*
@@ -1269,6 +1429,38 @@ u32 ValidateParition(u32 StartAddr, u32 Length, u32 ChecksumOffset)
 	XWdtPs_RestartWdt(&Watchdog);
 #endif
 
+    /*
+     * Calculate checksum for the partition
+     */
+    Status = CalcPartitionChecksum(StartAddr, Length, &CalcChecksum[0]);
+	if(Status != XST_SUCCESS) {
+        return XST_FAILURE;
+    }
+
+    return ComparePartitionChecksum(&CalcChecksum[0], ChecksumOffset);
+}
+
+
+/******************************************************************************/
+/**
+*
+* This function compares a calculated checksum with the one in the image
+*
+* @param	Calculated checksum pointer
+* @param	Partition check sum offset
+* @return
+*		- XST_SUCCESS if the checksums match
+*		- XST_FAILURE if partition data is corrupted
+*
+* @note		None
+*
+*******************************************************************************/
+u32 ComparePartitionChecksum(u8 *CalcChecksum, u32 ChecksumOffset)
+{
+    u8  Checksum[MD5_CHECKSUM_SIZE];
+    u32 Status;
+    u32 Index;
+
     /*
      * Get checksum from flash
      */
@@ -1285,14 +1477,6 @@ u32 ValidateParition(u32 StartAddr, u32 Length, u32 ChecksumOffset)
 
     fsbl_printf(DEBUG_INFO, "\r\n");
 
-    /*
-     * Calculate checksum for the partition
-     */
-    Status = CalcPartitionChecksum(StartAddr, Length, &CalcChecksum[0]);
-	if(Status != XST_SUCCESS) {
-        return XST_FAILURE;
-    }
-
     fsbl_printf(DEBUG_INFO, "Calculated checksum\r\n");
 
     for (Index = 0; Index < MD5_CHECKSUM_SIZE; Index++) {
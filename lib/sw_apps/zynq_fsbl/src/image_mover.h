@@ -22,6 +22,7 @@
 * 8.00a kc	01/16/13	Added defines for partition owner attribute
 * 9.0   vns	03/21/22	Deleted GetImageHeaderAndSignature() and added
 *				GetNAuthImageHeader()
+* 10.0  ag	10/15/26	Added PartitionPipelinedLoad()
 * </pre>
 *
 * @note
@@ -76,6 +77,9 @@ extern "C" {
 
 #define ATTRIBUTE_PARTITION_OWNER_FSBL	0x00000	/* FSBL Partition Owner */
 
+/* Bytes read from flash per PCAP DMA of a pipelined bitstream load */
+#define PIPELINE_CHUNK_SIZE			0x40000
+
 
 /**************************** Type Definitions *******************************/
 typedef u32 (*ImageMoverType)( u32 SourceAddress,
@@ -122,6 +126,8 @@ void HeaderDump(PartHeader *Header);
 u32 GetPartitionCount(PartHeader *Header);
 u32 ValidateHeader(PartHeader *Header);
 u32 DecryptPartition(u32 StartAddr, u32 DataLength, u32 ImageLength);
+u32 PartitionPipelinedLoad(u32 ImageBaseAddress, PartHeader *Header,
+				u8 *Checksum);
 
 /************************** Variable Definitions *****************************/
 
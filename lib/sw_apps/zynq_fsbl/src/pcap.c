@@ -59,6 +59,9 @@
 * 											In pcap.c, check pl power
 * 											through MCTRL register for
 * 											3.0 and later versions of silicon.
+* 17.00a ag  10/15/26   Added PcapStartChunkedLoad(), PcapLoadChunk() and
+* 						PcapWaitChunk() to download a bitstream in chunks
+* 						while the next chunk is read from flash.
 * </pre>
 *
 * @note
@@ -351,6 +354,149 @@ u32 PcapLoadPartition(u32 *SourceDataPtr, u32 *DestinationDataPtr,
 	return XST_SUCCESS;
 }
 
+/******************************************************************************/
+/**
+*
+* This function prepares the fabric for a non secure bitstream download in
+* chunks, sent with PcapLoadChunk().
+*
+* @param	None
+*
+* @return
+*		- XST_SUCCESS if the fabric is ready for the download
+*		- XST_FAILURE if the initialization fails
+*
+* @note		None
+*
+****************************************************************************/
+u32 PcapStartChunkedLoad(void)
+{
+	u32 Status;
+
+	/*
+	 * Clear the PCAP status registers
+	 */
+	Status = ClearPcapStatus();
+	if (Status != XST_SUCCESS) {
+		fsbl_printf(DEBUG_INFO,"PCAP_CLEAR_STATUS_FAIL \r\n");
+		return XST_FAILURE;
+	}
+
+	/*
+	 * New Bitstream download initialization sequence
+	 */
+	Status = FabricInit();
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+*
+* This function starts the DMA of one chunk of a non secure bitstream to the
+* PCAP and returns without waiting for it. The chunks are sent in order, the
+* previous one must be completed with PcapWaitChunk().
+*
+* @param 	SourceDataPtr is a pointer to the chunk
+* @param 	WordLength is the length of the chunk in words
+* @param 	LastChunk is 1 for the last chunk of the bitstream
+*
+* @return
+*		- XST_SUCCESS if the transfer is started
+*		- XST_FAILURE if the transfer can not be started
+*
+* @note		None
+*
+****************************************************************************/
+u32 PcapLoadChunk(u32 *SourceDataPtr, u32 WordLength, u32 LastChunk)
+{
+	u32 Status;
+	u32 *DestinationDataPtr = (u32*)XDCFG_DMA_INVALID_ADDRESS;
+
+#ifdef	XPAR_XWDTPS_0_BASEADDR
+	/*
+	 * Prevent WDT reset
+	 */
+	XWdtPs_RestartWdt(&Watchdog);
+#endif
+
+	/*
+	 * Only the last DMA command of the bitstream waits for the PCAP
+	 */
+	if (LastChunk) {
+		SourceDataPtr = (u32*)((u32)SourceDataPtr | PCAP_LAST_TRANSFER);
+		DestinationDataPtr = (u32*)((u32)DestinationDataPtr | PCAP_LAST_TRANSFER);
+	}
+
+	Status = XDcfg_Transfer(DcfgInstPtr, (u8 *)SourceDataPtr,
+					WordLength,
+					(u8 *)DestinationDataPtr,
+					WordLength, XDCFG_NON_SECURE_PCAP_WRITE);
+	if (Status != XST_SUCCESS) {
+		fsbl_printf(DEBUG_INFO,"Status of XDcfg_Transfer = %lu \r \n",Status);
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+*
+* This function waits for the DMA of a chunk started by PcapLoadChunk(), and
+* after the last chunk for the FPGA done.
+*
+* @param 	LastChunk is 1 for the last chunk of the bitstream
+*
+* @return
+*		- XST_SUCCESS if the chunk is transferred
+*		- XST_FAILURE if the transfer fails
+*
+* @note		None
+*
+****************************************************************************/
+u32 PcapWaitChunk(u32 LastChunk)
+{
+	u32 Status;
+	u32 IntrStsReg;
+
+	/*
+	 * Poll for the DMA done
+	 */
+	Status = XDcfgPollDone(XDCFG_IXR_DMA_DONE_MASK, MAX_COUNT);
+	if (Status != XST_SUCCESS) {
+		fsbl_printf(DEBUG_INFO,"PCAP_DMA_DONE_FAIL \r\n");
+		return XST_FAILURE;
+	}
+
+	if (LastChunk) {
+		/*
+		 * Poll for FPGA Done
+		 */
+		Status = XDcfgPollDone(XDCFG_IXR_PCFG_DONE_MASK, MAX_COUNT);
+		if (Status != XST_SUCCESS) {
+			fsbl_printf(DEBUG_INFO,"PCAP_FPGA_DONE_FAIL\r\n");
+			return XST_FAILURE;
+		}
+
+		fsbl_printf(DEBUG_INFO,"FPGA Done ! \n\r");
+	}
+
+	/*
+	 * Check for errors
+	 */
+	IntrStsReg = XDcfg_IntrGetStatus(DcfgInstPtr);
+	if (IntrStsReg & FSBL_XDCFG_IXR_ERROR_FLAGS_MASK) {
+		fsbl_printf(DEBUG_INFO,"Errors in PCAP \r\n");
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
 /******************************************************************************/
 /**
 *
@@ -22,6 +22,7 @@
 * 						Fabric Initialization sequence is modified to check
 * 						the PL power before sequence starts and checking INIT_B
 * 						reset status twice in case of failure.
+* 17.00a ag  10/15/26   Added the chunked bitstream load functions
 * </pre>
 *
 * @note
@@ -72,6 +73,9 @@ u32 PcapLoadPartition(u32 *SourceData, u32 *DestinationData, u32 SourceLength,
 		 	u32 DestinationLength, u32 Flags);
 u32 PcapDataTransfer(u32 *SourceData, u32 *DestinationData, u32 SourceLength,
  			u32 DestinationLength, u32 Flags);
+u32 PcapStartChunkedLoad(void);
+u32 PcapLoadChunk(u32 *SourceDataPtr, u32 WordLength, u32 LastChunk);
+u32 PcapWaitChunk(u32 LastChunk);
 /************************** Variable Definitions *****************************/
 #ifdef __cplusplus
 }
@@ -39,6 +39,8 @@
 *       bsv  05/03/21 Add provision to load bitstream from OCM with DDR
 *                     present in design
 * 8.0   bsv  07/13/21 Remove unwanted CsuDma initializations
+*       ag   10/15/26 Added XFsbl_AuthenticationWithHash() for partitions
+*                     hashed while they are copied
 *
 * </pre>
 *
@@ -54,6 +56,7 @@
 u32 XFsbl_SpkVer(u64 AcOffset, u32 HashLen);
 u32 XFsbl_PpkVer(u64 AcOffset, u32 HashLen);
 void XFsbl_ReadPpkHash(u32 *PpkHash, u8 PpkSelect);
+static u32 XFsbl_PartitionHashVer(u64 AcOffset, u8 *PartitionHash);
 #endif
 /*****************************************************************************/
 #if defined(XFSBL_BS)
@@ -249,16 +252,10 @@ static u32 XFsbl_PartitionSignVer(const XFsblPs *FsblInstancePtr, u64 PartitionO
 {
 
 	u8 PartitionHash[XFSBL_HASH_TYPE_SHA3] __attribute__ ((aligned (4))) = {0};
-	u8 * SpkModular;
-	u8* SpkModularEx;
-	u32 SpkExp;
-	u8 * AcPtr = (u8*)(PTRSIZE) AcOffset;
-	u32 Status;
+	u32 Status = XFSBL_SUCCESS;
 	u32 HashDataLen;
 	void * ShaCtx = (void * )NULL;
-	u8 XFsbl_RsaSha3Array[512] = {0};
 	u32 HashLen = XFSBL_HASH_TYPE_SHA3;
-	s32 SStatus;
 
 	XFsbl_Printf(DEBUG_INFO, "Doing Partition Sign verification\r\n");
 
@@ -287,7 +284,6 @@ static u32 XFsbl_PartitionSignVer(const XFsblPs *FsblInstancePtr, u64 PartitionO
 			XFsbl_Printf(DEBUG_GENERAL,
 			"XFsbl_PartitionVer: XFSBL_ERROR_PART_RSA_DECRYPT\r\n");
 			Status = XFSBL_ERROR_PART_RSA_DECRYPT;
-			goto END;
 		}
 
 #endif
@@ -306,11 +302,41 @@ static u32 XFsbl_PartitionSignVer(const XFsblPs *FsblInstancePtr, u64 PartitionO
 
 #endif
 
-	/* Calculate hash for (AC - signature size) */
-	XFsbl_ShaUpdate(ShaCtx, (u8 *)(PTRSIZE)AcOffset,
+	if (Status == XFSBL_SUCCESS) {
+		/* Calculate hash for (AC - signature size) */
+		XFsbl_ShaUpdate(ShaCtx, (u8 *)(PTRSIZE)AcOffset,
 			(XFSBL_AUTH_CERT_MIN_SIZE - XFSBL_FSBL_SIG_SIZE), HashLen);
 
-	XFsbl_ShaFinish(ShaCtx, (u8 *)PartitionHash, HashLen);
+		XFsbl_ShaFinish(ShaCtx, (u8 *)PartitionHash, HashLen);
+
+		Status = XFsbl_PartitionHashVer(AcOffset, PartitionHash);
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * Verifies the partition signature in the authentication certificate
+ * against the partition hash, using the SPK of the certificate.
+ *
+ * @param	AcOffset is the address of the authentication certificate
+ * @param	PartitionHash is the SHA3 hash of the partition data followed
+ *		by the authentication certificate up to the partition signature
+ *
+ * @return	XFSBL_SUCCESS if the signature matches, error code otherwise
+ *
+ ******************************************************************************/
+static u32 XFsbl_PartitionHashVer(u64 AcOffset, u8 *PartitionHash)
+{
+	u8 * SpkModular;
+	u8* SpkModularEx;
+	u32 SpkExp;
+	u8 * AcPtr = (u8*)(PTRSIZE) AcOffset;
+	u32 Status;
+	u8 XFsbl_RsaSha3Array[512] = {0};
+	u32 HashLen = XFSBL_HASH_TYPE_SHA3;
+	s32 SStatus;
 
 	/* Set SPK pointer */
 	AcPtr += (XFSBL_RSA_AC_ALIGN + XFSBL_PPK_SIZE);
@@ -413,6 +439,35 @@ END:
         return Status;
 }
 
+/*****************************************************************************/
+/**
+ * Authenticates a partition whose hash has already been calculated, as done
+ * by the partition copy when the partition is hashed while it is copied.
+ *
+ * @param	AcOffset is the address of the authentication certificate
+ * @param	PartitionHash is the SHA3 hash of the partition data followed
+ *		by the authentication certificate up to the partition signature
+ *
+ * @return	XFSBL_SUCCESS on successful authentication, error code otherwise
+ *
+ ******************************************************************************/
+u32 XFsbl_AuthenticationWithHash(u64 AcOffset, u8 *PartitionHash)
+{
+	u32 Status;
+
+	/* Do SPK Signature verification using PPK */
+	Status = XFsbl_SpkVer(AcOffset, XFSBL_HASH_TYPE_SHA3);
+	if (XFSBL_SUCCESS != Status) {
+		goto END;
+	}
+
+	/* Do Partition Signature verification using SPK */
+	Status = XFsbl_PartitionHashVer(AcOffset, PartitionHash);
+
+END:
+	return Status;
+}
+
 /*****************************************************************************/
 /*
 * This function is used to read PPK0/PPK1 hash from efuse based on PPK
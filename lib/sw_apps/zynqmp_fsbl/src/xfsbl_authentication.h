@@ -28,6 +28,8 @@
 *       bsv  04/01/21 Added TPM support
 *       bsv  05/03/21 Add provision to load bitstream from OCM with DDR
 *                     present in design
+*       ag   10/15/26 Added prototypes for hashing partitions while they
+*                     are copied
 *
 * </pre>
 *
@@ -106,6 +108,8 @@ void XFsbl_ShaDigest(const u8 *In, const u32 Size, u8 *Out, u32 HashLen);
 void XFsbl_ShaFinish(void * Ctx, u8 * Hash, u32 HashLen);
 void XFsbl_ShaStart(void * Ctx, u32 HashLen);
 void XFsbl_ShaUpdate(void * Ctx, u8 * Data, u32 Size, u32 HashLen);
+u32 XFsbl_ShaUpdateAsync(void * Ctx, u8 * Data, u32 Size, u32 HashLen);
+u32 XFsbl_ShaWaitForUpdate(void * Ctx, u32 HashLen);
 #ifdef XFSBL_PL_LOAD_FROM_OCM
 #ifdef XFSBL_BS
 u32 XFsbl_ShaUpdate_DdrLess(const XFsblPs *FsblInstancePtr, void *Ctx,
@@ -117,6 +121,7 @@ u32 XFsbl_ShaUpdate_DdrLess(const XFsblPs *FsblInstancePtr, void *Ctx,
 u32 XFsbl_Authentication(const XFsblPs * FsblInstancePtr, u64 PartitionOffset,
 				u32 PartitionLen, u64 AcOffset,
 				u32 PartitionNum);
+u32 XFsbl_AuthenticationWithHash(u64 AcOffset, u8 *PartitionHash);
 u32 XFsbl_CompareHashs(u8 *Hash1, u8 *Hash2, u32 HashLen);
 u32 XFsbl_Sha3PadSelect(XSecure_Sha3PadType PadType);
 u32 XFsbl_BhAuthentication(const XFsblPs * FsblInstancePtr, u8 *Data,
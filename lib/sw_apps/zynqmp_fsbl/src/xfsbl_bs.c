@@ -21,6 +21,8 @@
  *                     section
  * 3.0   bsv  05/03/21 Add provision to load bitstream from OCM with DDR
  *                     present in design
+ * 4.0   ag   10/15/26 Copy the next bitstream chunk from the boot device while
+ *                     the current one is written to PCAP
  *
  * </pre>
  *
@@ -32,14 +34,21 @@
 #include "xfsbl_hw.h"
 #ifdef XFSBL_BS
 #include "xfsbl_bs.h"
+#include "xfsbl_usb.h"
 
 /************************** Constant Definitions *****************************/
 
 /**************************** Type Definitions *******************************/
 
 /***************** Macros (Inline Functions) Definitions *********************/
+#ifdef XFSBL_PL_LOAD_FROM_OCM
+/* Each half of ReadBuffer holds one chunk of the chunked transfer */
+#define XFSBL_BS_CHUNK_SIZE		(READ_BUFFER_SIZE / 2U)
+#endif
 
 /************************** Function Prototypes ******************************/
+static void XFsbl_PcapWriteStart(u32 WrSize, const u8 *WrAddr);
+static u32 XFsbl_PcapWriteWait(void);
 
 /************************** Variable Definitions *****************************/
 /* Global OCM buffer to store data chunks */
@@ -167,8 +176,25 @@ u32 XFsbl_PcapWaitForDone(void) {
  *
  *****************************************************************************/
 u32 XFsbl_WriteToPcap(u32 WrSize, u8 *WrAddr) {
+	XFsbl_PcapWriteStart(WrSize, WrAddr);
+
+	return XFsbl_PcapWriteWait();
+}
+
+/*****************************************************************************/
+/** This function starts the CSU DMA transfer of data to the PCAP interface
+ * and returns without waiting for it to complete.
+ *
+ * @param	WrSize: Number of 32bit words that the DMA should write to
+ *          the PCAP interface
+ * @param   WrAddr: Linear memory space from where CSUDMA will read
+ *	        the data to be written to PCAP interface
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XFsbl_PcapWriteStart(u32 WrSize, const u8 *WrAddr) {
 	u32 RegVal;
-	u32 Status;
 
 	/*
 	 * Setup the  SSS, setup the PCAP to receive from DMA source
@@ -180,6 +206,18 @@ u32 XFsbl_WriteToPcap(u32 WrSize, u8 *WrAddr) {
 
 	/* Setup the source DMA channel */
 	XCsuDma_Transfer(&CsuDma, XCSUDMA_SRC_CHANNEL, (PTRSIZE) WrAddr, WrSize, 0);
+}
+
+/*****************************************************************************/
+/** This function waits for the transfer started by XFsbl_PcapWriteStart
+ *
+ * @param	None
+ *
+ * @return	error status based on implemented functionality (SUCCESS by default)
+ *
+ *****************************************************************************/
+static u32 XFsbl_PcapWriteWait(void) {
+	u32 Status;
 
 	/* wait for the SRC_DMA to complete and the pcap to be IDLE */
 	XCsuDma_WaitForDone(&CsuDma, XCSUDMA_SRC_CHANNEL){}
@@ -189,11 +227,8 @@ u32 XFsbl_WriteToPcap(u32 WrSize, u8 *WrAddr) {
 
 	XFsbl_Printf(DEBUG_INFO, "DMA transfer done \r\n");
 	Status = XFsbl_PcapWaitForDone();
-	if (Status != XFSBL_SUCCESS) {
-		goto END;
-	}
 
-	END: return Status;
+	return Status;
 }
 
 /*****************************************************************************/
@@ -257,12 +292,15 @@ u32 XFsbl_PLWaitForDone(void) {
 u32 XFsbl_ChunkedBSTxfer(XFsblPs *FsblInstancePtr, u32 PartitionNum)
 {
 	u32 Status = XFSBL_SUCCESS;
+	u32 PcapStatus;
 	XFsblPs_PartitionHeader *PartitionHeader;
-	u32 NumChunks = 0U;
 	u32 RemainingBytes = 0U;
-	u32 Index = 0U;
+	u32 ChunkSize;
+	u8 *ChunkPtr;
+	u32 BufIndex = 0U;
+	u32 IsPcapBusy = FALSE;
+	u32 IsOverlapped = TRUE;
 	u32 BitStreamSizeWord = 0U;
-	u32 BitStreamSizeByte = 0U;
 	u32 ImageOffset = 0U;
 	u32 StartAddrByte = 0U;
 
@@ -285,44 +323,63 @@ u32 XFsbl_ChunkedBSTxfer(XFsblPs *FsblInstancePtr, u32 PartitionNum)
 			StartAddrByte);
 
 	/* Converting size in words to bytes */
-	BitStreamSizeByte = BitStreamSizeWord*4;
+	RemainingBytes = BitStreamSizeWord*4;
 
-	NumChunks = BitStreamSizeByte / READ_BUFFER_SIZE;
-	RemainingBytes = BitStreamSizeByte % READ_BUFFER_SIZE;
+#ifdef XFSBL_USB
+	/* USB copy uses the CSU DMA as well, so it can not overlap */
+	if (FsblInstancePtr->DeviceOps.DeviceCopy == XFsbl_UsbCopy) {
+		IsOverlapped = FALSE;
+	}
+#endif
 
-	for(Index = 0; Index < NumChunks; Index++)
+	/**
+	 * Copy a chunk into one half of ReadBuffer while the chunk in the
+	 * other half is written to PCAP
+	 */
+	while (RemainingBytes != 0U)
 	{
-		Status = FsblInstancePtr->DeviceOps.DeviceCopy(StartAddrByte,
-				(PTRSIZE)ReadBuffer, READ_BUFFER_SIZE);
+		if (RemainingBytes > XFSBL_BS_CHUNK_SIZE) {
+			ChunkSize = XFSBL_BS_CHUNK_SIZE;
+		}
+		else {
+			ChunkSize = RemainingBytes;
+		}
+		ChunkPtr = &ReadBuffer[BufIndex * XFSBL_BS_CHUNK_SIZE];
 
+		Status = FsblInstancePtr->DeviceOps.DeviceCopy(StartAddrByte,
+				(PTRSIZE)ChunkPtr, ChunkSize);
+		if (IsPcapBusy == TRUE) {
+			IsPcapBusy = FALSE;
+			PcapStatus = XFsbl_PcapWriteWait();
+			if (XFSBL_SUCCESS == Status) {
+				Status = PcapStatus;
+			}
+		}
 		if (XFSBL_SUCCESS != Status)
 		{
 			XFsbl_Printf(DEBUG_GENERAL,
-				"Copy of chunk from flash to OCM failed \r\n");
+				"Copy of chunk from flash to PCAP failed \r\n");
 			goto END;
 		}
 
-		Status = XFsbl_WriteToPcap((READ_BUFFER_SIZE/4), &ReadBuffer[0]);
-		if (XFSBL_SUCCESS != Status)
-		{
-			goto END;
+		XFsbl_PcapWriteStart((ChunkSize/4U), ChunkPtr);
+		IsPcapBusy = TRUE;
+		if (IsOverlapped == FALSE) {
+			IsPcapBusy = FALSE;
+			Status = XFsbl_PcapWriteWait();
+			if (XFSBL_SUCCESS != Status)
+			{
+				goto END;
+			}
 		}
 
-		StartAddrByte += READ_BUFFER_SIZE;
+		StartAddrByte += ChunkSize;
+		RemainingBytes -= ChunkSize;
+		BufIndex ^= 1U;
 	}
 
-	if(RemainingBytes != 0U)
-	{
-		Status = FsblInstancePtr->DeviceOps.DeviceCopy(StartAddrByte,
-					(PTRSIZE)ReadBuffer, RemainingBytes);
-		if (XFSBL_SUCCESS != Status)
-		{
-			XFsbl_Printf(DEBUG_GENERAL,
-				"Copy of chunk from flash to OCM failed \r\n");
-			goto END;
-		}
-
-		Status = XFsbl_WriteToPcap((RemainingBytes/4), &ReadBuffer[0]);
+	if (IsPcapBusy == TRUE) {
+		Status = XFsbl_PcapWriteWait();
 	}
 
 END:
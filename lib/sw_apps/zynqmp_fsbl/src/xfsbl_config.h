@@ -30,6 +30,8 @@
 *       bsv  05/15/21 Support to ensure authenticated images boot as
 *                     non-secure when RSA_EN is not programmed is disabled by
 *                     default
+*       ag   10/15/26 Added FSBL_AUTH_PIPELINE_EXCLUDE_VAL configuration
+*       ag   10/15/26 Added FSBL_DDR_TRAIN_CACHE_EXCLUDE_VAL configuration
 *
 *</pre>
 *
@@ -138,6 +140,10 @@ extern "C" {
  *     - FSBL_UNPROVISIONED_AUTH_SIGN_EXCLUDE_VAL Code to "load authenticated
  *       partitions as non secure when EFUSEs are not programmed and when boot
  *       header is not authenticated" is excluded
+ *     - FSBL_AUTH_PIPELINE_EXCLUDE_VAL Hashing of authenticated partitions
+ *       while they are copied is excluded
+ *     - FSBL_DDR_TRAIN_CACHE_EXCLUDE_VAL Reuse of DDR training results saved
+ *       through XFsbl_HookSaveDdrTrainData() is excluded
  */
 #ifndef FSBL_NAND_EXCLUDE_VAL
 #define FSBL_NAND_EXCLUDE_VAL			(0U)
@@ -211,6 +217,14 @@ extern "C" {
 #define FSBL_UNPROVISIONED_AUTH_SIGN_EXCLUDE_VAL	(1U)
 #endif
 
+#ifndef FSBL_AUTH_PIPELINE_EXCLUDE_VAL
+#define FSBL_AUTH_PIPELINE_EXCLUDE_VAL		(0U)
+#endif
+
+#ifndef FSBL_DDR_TRAIN_CACHE_EXCLUDE_VAL
+#define FSBL_DDR_TRAIN_CACHE_EXCLUDE_VAL	(1U)
+#endif
+
 #if (FSBL_NAND_EXCLUDE_VAL) && (!defined(FSBL_NAND_EXCLUDE))
 #define FSBL_NAND_EXCLUDE
 #endif
@@ -286,6 +300,16 @@ extern "C" {
 #define FSBL_UNPROVISIONED_AUTH_SIGN_EXCLUDE
 #endif
 
+#if (FSBL_AUTH_PIPELINE_EXCLUDE_VAL == 1U) && \
+	(!defined(FSBL_AUTH_PIPELINE_EXCLUDE))
+#define FSBL_AUTH_PIPELINE_EXCLUDE
+#endif
+
+#if (FSBL_DDR_TRAIN_CACHE_EXCLUDE_VAL == 0U) && \
+	(!defined(XFSBL_ENABLE_DDR_TRAIN_CACHE))
+#define XFSBL_ENABLE_DDR_TRAIN_CACHE
+#endif
+
 /************************** Function Prototypes ******************************/
 
 /************************** Variable Definitions *****************************/
@@ -31,6 +31,8 @@
  *       mn   12/24/19 Enable Address Mirroring based on SPD data
  *       bsv  02/05/20 Added support for ZCU208 board
  * 4.0   mn   10/28/21 Added support for ZCU670 board
+ * 4.1   ag   10/15/26 Reuse saved DDR training results when the silicon,
+ *                     DIMM, board and temperature match
  *
  * </pre>
  *
@@ -46,6 +48,9 @@
 
 #include "xiicps.h"
 #include "xfsbl_ddr_init.h"
+#ifdef XFSBL_ENABLE_DDR_TRAIN_CACHE
+#include "xil_cache.h"
+#endif
 
 /************************** Constant Definitions *****************************/
 
@@ -183,6 +188,17 @@
 
 #define XFSBL_DDRPHY_BASE_ADDR		0xFD080000U
 
+/* DX0GCR0 and the distance between the byte lane register blocks */
+#define XFSBL_DDRPHY_DX_BASE_ADDR	(XFSBL_DDRPHY_BASE_ADDR + 0x700U)
+#define XFSBL_DDRPHY_DX_STRIDE		0x100U
+
+/* PIR to hand over to the controller without any training step */
+#define XFSBL_DDRPHY_PIR_CTLDINIT	0x00040001U
+
+/* DDR region written by the check of restored training data */
+#define XFSBL_DDR_TRAIN_TEST_ADDR	0x100000U
+#define XFSBL_DDR_TRAIN_TEST_WORDS	256U
+
 #define XFSBL_DBI_INFO			XPAR_PSU_DDRC_0_DDR_DATA_MASK_AND_DBI
 
 #define XFSBL_VIDEOBUF			XPAR_PSU_DDRC_0_VIDEO_BUFFER_SIZE
@@ -5753,20 +5769,359 @@ static void XFsbl_MrsFunc(u32 Addr, u32 Rank, u32 Mr07)
 	}
 }
 
+/*****************************************************************************/
+/**
+ * This function runs the DDR-PHY training steps and waits for them to
+ * complete
+ *
+ * @param	PDimmPtr is pointer to DDR Parameters Structure
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XFsbl_DdrPhyRunTraining(XFsbl_DimmParams *PDimmPtr)
+{
+	u32 PollVal = 0U;
+	u32 RegVal = 0U;
+
+	if ((PDimmPtr->MemType == SPD_MEMTYPE_DDR3) ||
+			(PDimmPtr->MemType == SPD_MEMTYPE_DDR4)) {
+		if (PDimmPtr->DeskewTrn == 0U)
+			Xil_Out32(DDR_PHY_PIR_OFFSET, 0x0004CE01U);
+		else
+			Xil_Out32(DDR_PHY_PIR_OFFSET, 0x0004FE01U);
+	} else if (PDimmPtr->MemType == SPD_MEMTYPE_LPDDR3) {
+		if (PDimmPtr->Ddp == 1U) {
+			XFSBL_PROG_REG(DDR_PHY_RANKIDR_OFFSET,
+					DDR_PHY_RANKIDR_RANKWID_MASK,
+					DDR_PHY_RANKIDR_RANKWID_SHIFT, 1U);
+			XFSBL_PROG_REG(DDR_PHY_ODTCR_OFFSET,
+					DDR_PHY_ODTCR_WRODT_MASK,
+					DDR_PHY_ODTCR_WRODT_SHIFT, 1U);
+			XFSBL_PROG_REG(DDR_PHY_RANKIDR_OFFSET,
+					DDR_PHY_RANKIDR_RANKWID_MASK,
+					DDR_PHY_RANKIDR_RANKWID_SHIFT, 0U);
+		}
+
+		if (PDimmPtr->Zc1650)
+			Xil_Out32(DDR_PHY_PIR_OFFSET, 0x0004FE01U);
+		else {
+			if (PDimmPtr->GateExt)
+				if (PDimmPtr->DeskewTrn == 0U)
+					Xil_Out32(DDR_PHY_PIR_OFFSET, 0x0004CA05U);
+				else
+					Xil_Out32(DDR_PHY_PIR_OFFSET, 0x0004FA05U);
+			else
+				if (PDimmPtr->DeskewTrn == 0U)
+					Xil_Out32(DDR_PHY_PIR_OFFSET, 0x0004CE05U);
+				else
+					Xil_Out32(DDR_PHY_PIR_OFFSET, 0x0004FE05U);
+		}
+	} else if (PDimmPtr->MemType == SPD_MEMTYPE_LPDDR4) {
+		if (PDimmPtr->DeskewTrn == 0U)
+			Xil_Out32(DDR_PHY_PIR_OFFSET, 0x0014CE01U);
+		else
+			Xil_Out32(DDR_PHY_PIR_OFFSET, 0x0014FE01U);
+	}
+
+	if ((PDimmPtr->MemType == SPD_MEMTYPE_DDR3) ||
+			(PDimmPtr->MemType == SPD_MEMTYPE_DDR4)) {
+		PollVal = 0x80000CFFU;
+	} else if (PDimmPtr->MemType == SPD_MEMTYPE_LPDDR3) {
+		if (PDimmPtr->Zc1650) {
+			PollVal = 0x80000FFFU;
+		} else {
+			if (PDimmPtr->GateExt)
+				PollVal = 0x80001CBFU;
+			else
+				PollVal = 0x80001CFFU;
+		}
+	} else if (PDimmPtr->MemType == SPD_MEMTYPE_LPDDR4) {
+		PollVal = 0x80008CFFU;
+	}
+	if (PDimmPtr->DeskewTrn != 0U) {
+		PollVal |= 0x300U;
+	}
+
+	if (PDimmPtr->MemType != SPD_MEMTYPE_LPDDR4) {
+		RegVal = Xil_In32(DDR_PHY_PGSR0_OFFSET);
+		while (RegVal != PollVal) {
+			RegVal = Xil_In32(DDR_PHY_PGSR0_OFFSET);
+		}
+	} else {
+		while (RegVal != 0x8000007EU)
+			RegVal = Xil_In32(DDR_PHY_PGSR0_OFFSET);
+
+		RegVal = Xil_In32(XFSBL_DDRPHY_BASE_ADDR + 0x200U);
+		RegVal &= ~(0xFU << 28U);
+		Xil_Out32(XFSBL_DDRPHY_BASE_ADDR + 0x200U, RegVal);
+
+		RegVal = Xil_In32(DDR_PHY_PGSR0_OFFSET);
+		while (RegVal != PollVal)
+			RegVal = Xil_In32(DDR_PHY_PGSR0_OFFSET);
+
+
+		RegVal &= ~(0xFU << 28U);
+		RegVal |= (0x8U << 28U);
+		Xil_Out32(XFSBL_DDRPHY_BASE_ADDR + 0x200U, RegVal);
+	}
+}
+
+/* Byte lane registers holding the training results */
+static const u32 XFsbl_DdrTrainRegOffsets[XFSBL_DDR_TRAIN_LANE_REGS] = {
+	0x14U, 0x18U,				/* GCR5-6: host and DRAM VREF */
+	0x40U, 0x44U, 0x48U, 0x50U, 0x54U, 0x58U, 0x60U, /* BDLR0-6 */
+	0x80U, 0x84U, 0x88U, 0x8CU, 0x90U, 0x94U,	/* LCDLR0-5 */
+	0xC0U					/* GTR0 */
+};
+
+/*****************************************************************************/
+/**
+ * This function writes saved training results to the DDR-PHY instead of
+ * running the training steps, and hands over to the controller
+ *
+ * @param	TrainRegs are the values of the XFsbl_DdrTrainRegOffsets
+ *		registers of all byte lanes
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XFsbl_DdrRestoreTrainRegs(const u32 *TrainRegs)
+{
+	u32 Lane;
+	u32 Index;
+
+	/* Hold the VT compensation while the delay lines are written */
+	XFSBL_PROG_REG(DDR_PHY_PGCR6_OFFSET, DDR_PHY_PGCR6_INHVT_MASK,
+			DDR_PHY_PGCR6_INHVT_SHIFT, 0x1U);
+
+	for (Lane = 0U; Lane < XFSBL_DDR_TRAIN_LANES; Lane++) {
+		for (Index = 0U; Index < XFSBL_DDR_TRAIN_LANE_REGS; Index++) {
+			Xil_Out32(XFSBL_DDRPHY_DX_BASE_ADDR +
+					(Lane * XFSBL_DDRPHY_DX_STRIDE) +
+					XFsbl_DdrTrainRegOffsets[Index],
+					*TrainRegs);
+			TrainRegs++;
+		}
+	}
+
+	XFSBL_PROG_REG(DDR_PHY_PGCR6_OFFSET, DDR_PHY_PGCR6_INHVT_MASK,
+			DDR_PHY_PGCR6_INHVT_SHIFT, 0x0U);
+
+	Xil_Out32(DDR_PHY_PIR_OFFSET, XFSBL_DDRPHY_PIR_CTLDINIT);
+	XFSBL_POLL(DDR_PHY_PGSR0_OFFSET, 0x1U, 0x1U);
+}
+
+#ifdef XFSBL_ENABLE_DDR_TRAIN_CACHE
+/*****************************************************************************/
+/**
+ * This function calculates the checksum used for the SPD data and the saved
+ * training data
+ *
+ * @param	Data is pointer to the data
+ * @param	Size is the number of bytes
+ *
+ * @return	Fletcher-32 checksum of the data
+ *
+ *****************************************************************************/
+static u32 XFsbl_DdrTrainChecksum(const u8 *Data, u32 Size)
+{
+	u32 Sum1 = 0U;
+	u32 Sum2 = 0U;
+	u32 Index;
+
+	for (Index = 0U; Index < Size; Index++) {
+		Sum1 = (Sum1 + Data[Index]) % 0xFFFFU;
+		Sum2 = (Sum2 + Sum1) % 0xFFFFU;
+	}
+
+	return (Sum2 << 16U) | Sum1;
+}
+
+/*****************************************************************************/
+/**
+ * This function fills in what identifies the conditions of a training
+ *
+ * @param	SpdData is the SPD data read from the EEPROM
+ * @param	TrainPtr is pointer to the training data
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XFsbl_DdrTrainGetIdent(u8 *SpdData, XFsbl_DdrTrainData *TrainPtr)
+{
+	TrainPtr->Magic = XFSBL_DDR_TRAIN_MAGIC;
+	TrainPtr->Version = XFSBL_DDR_TRAIN_VERSION;
+	TrainPtr->IdCode = Xil_In32(CSU_IDCODE);
+	TrainPtr->BoardId = XFSBL_DDR_TRAIN_BOARD_ID;
+	TrainPtr->SpdSum = XFsbl_DdrTrainChecksum(SpdData, 512U);
+	/* The ADC code is in bits 15:6 of the temperature register */
+	TrainPtr->Temperature = (Xil_In32(AMS_PS_SYSMON_BASEADDR) >> 6U) & 0x3FFU;
+}
+
+/*****************************************************************************/
+/**
+ * This function gets the saved training data and checks that it was taken
+ * on this silicon, DIMM and board, at about the current temperature
+ *
+ * @param	SpdData is the SPD data read from the EEPROM
+ * @param	TrainPtr is pointer to where the training data is read to
+ *
+ * @return	XFSBL_SUCCESS if the data can be used, XFSBL_FAILURE otherwise
+ *
+ *****************************************************************************/
+static u32 XFsbl_DdrTrainLoad(u8 *SpdData, XFsbl_DdrTrainData *TrainPtr)
+{
+	XFsbl_DdrTrainData Ident;
+	u32 TempDiff;
+	u32 Status = XFSBL_FAILURE;
+
+	if (XFsbl_HookGetDdrTrainData((u8 *)TrainPtr,
+			sizeof(XFsbl_DdrTrainData)) != XFSBL_SUCCESS) {
+		goto END;
+	}
+
+	if (TrainPtr->Checksum != XFsbl_DdrTrainChecksum((u8 *)TrainPtr,
+			sizeof(XFsbl_DdrTrainData) - sizeof(u32))) {
+		XFsbl_Printf(DEBUG_INFO, "DDR training data corrupted\n\r");
+		goto END;
+	}
+
+	XFsbl_DdrTrainGetIdent(SpdData, &Ident);
+	if ((TrainPtr->Magic != Ident.Magic) ||
+			(TrainPtr->Version != Ident.Version) ||
+			(TrainPtr->IdCode != Ident.IdCode) ||
+			(TrainPtr->BoardId != Ident.BoardId) ||
+			(TrainPtr->SpdSum != Ident.SpdSum)) {
+		XFsbl_Printf(DEBUG_INFO, "DDR training data does not match\n\r");
+		goto END;
+	}
+
+	if (TrainPtr->Temperature > Ident.Temperature) {
+		TempDiff = TrainPtr->Temperature - Ident.Temperature;
+	} else {
+		TempDiff = Ident.Temperature - TrainPtr->Temperature;
+	}
+	if (TempDiff > XFSBL_DDR_TRAIN_TEMP_DELTA) {
+		XFsbl_Printf(DEBUG_INFO, "DDR training data taken at another "
+				"temperature\n\r");
+		goto END;
+	}
+
+	Status = XFSBL_SUCCESS;
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function reads the training results from the DDR-PHY and saves them
+ * through XFsbl_HookSaveDdrTrainData()
+ *
+ * @param	SpdData is the SPD data read from the EEPROM
+ * @param	TrainPtr is pointer to the training data buffer
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XFsbl_DdrTrainSave(u8 *SpdData, XFsbl_DdrTrainData *TrainPtr)
+{
+	u32 Lane;
+	u32 Index;
+	u32 *RegPtr = TrainPtr->Regs;
+
+	XFsbl_DdrTrainGetIdent(SpdData, TrainPtr);
+
+	for (Lane = 0U; Lane < XFSBL_DDR_TRAIN_LANES; Lane++) {
+		for (Index = 0U; Index < XFSBL_DDR_TRAIN_LANE_REGS; Index++) {
+			*RegPtr = Xil_In32(XFSBL_DDRPHY_DX_BASE_ADDR +
+					(Lane * XFSBL_DDRPHY_DX_STRIDE) +
+					XFsbl_DdrTrainRegOffsets[Index]);
+			RegPtr++;
+		}
+	}
+
+	TrainPtr->Checksum = XFsbl_DdrTrainChecksum((u8 *)TrainPtr,
+			sizeof(XFsbl_DdrTrainData) - sizeof(u32));
+
+	if (XFsbl_HookSaveDdrTrainData((const u8 *)TrainPtr,
+			sizeof(XFsbl_DdrTrainData)) != XFSBL_SUCCESS) {
+		XFsbl_Printf(DEBUG_GENERAL, "DDR training data not saved\n\r");
+	}
+}
+
+/*****************************************************************************/
+/**
+ * This function writes and reads back address dependent patterns and their
+ * complements, to check the DDR after a training or a restore. Full 64 bit
+ * words are written, so that the ECC of the region is valid.
+ *
+ * @param	None
+ *
+ * @return	XFSBL_SUCCESS if all the patterns are read back,
+ *		XFSBL_FAILURE otherwise
+ *
+ *****************************************************************************/
+static u32 XFsbl_DdrTrainCheckMem(void)
+{
+	UINTPTR Addr;
+	u64 Pattern;
+	u32 Pass;
+	u32 Index;
+	u32 Status = XFSBL_FAILURE;
+
+	for (Pass = 0U; Pass < 2U; Pass++) {
+		for (Index = 0U; Index < XFSBL_DDR_TRAIN_TEST_WORDS; Index++) {
+			Addr = XFSBL_DDR_TRAIN_TEST_ADDR + (Index * 8U);
+			Pattern = ((u64)Addr << 32U) ^ (u64)Addr ^
+				0xA5A5A5A55A5A5A5AU;
+			if (Pass != 0U) {
+				Pattern = ~Pattern;
+			}
+			Xil_Out64(Addr, Pattern);
+		}
+		Xil_DCacheFlushRange(XFSBL_DDR_TRAIN_TEST_ADDR,
+				XFSBL_DDR_TRAIN_TEST_WORDS * 8U);
+		Xil_DCacheInvalidateRange(XFSBL_DDR_TRAIN_TEST_ADDR,
+				XFSBL_DDR_TRAIN_TEST_WORDS * 8U);
+
+		for (Index = 0U; Index < XFSBL_DDR_TRAIN_TEST_WORDS; Index++) {
+			Addr = XFSBL_DDR_TRAIN_TEST_ADDR + (Index * 8U);
+			Pattern = ((u64)Addr << 32U) ^ (u64)Addr ^
+				0xA5A5A5A55A5A5A5AU;
+			if (Pass != 0U) {
+				Pattern = ~Pattern;
+			}
+			if (Xil_In64(Addr) != Pattern) {
+				XFsbl_Printf(DEBUG_INFO, "DDR check failed at "
+						"0x%0lx\n\r", Addr);
+				goto END;
+			}
+		}
+	}
+
+	Status = XFSBL_SUCCESS;
+END:
+	return Status;
+}
+#endif
+
 /*****************************************************************************/
 /**
  * This function performs the DDR/PHY training sequence to initialize the DDR
  *
  * @param	DdrDataPtr is pointer to DDR Initialization Data Structure
+ * @param	TrainRegs are saved training results to restore instead of
+ *		running the training steps, NULL to train
  *
  * @return	Returns XFSBL_SUCCESS or XFSBL_FAILURE
  *
  *****************************************************************************/
-static u32 XFsbl_DdrcPhyTraining(struct DdrcInitData *DdrDataPtr)
+static u32 XFsbl_DdrcPhyTraining(struct DdrcInitData *DdrDataPtr,
+		const u32 *TrainRegs)
 {
 	XFsbl_DimmParams *PDimmPtr = &DdrDataPtr->PDimm;
 	u32 ActiveRanks;
-	u32 PollVal = 0U;
 	u32 CurTRefPrd;
 	u32 RegVal = 0U;
 	u32 PllRetry = 100U;
@@ -5986,86 +6341,13 @@ static u32 XFsbl_DdrcPhyTraining(struct DdrcInitData *DdrDataPtr)
 	XFSBL_PROG_REG(DDR_PHY_PGCR1_OFFSET, DDR_PHY_PGCR1_PUBMODE_MASK,
 			DDR_PHY_PGCR1_PUBMODE_SHIFT, 1U);
 
-	if ((PDimmPtr->MemType == SPD_MEMTYPE_DDR3) ||
-			(PDimmPtr->MemType == SPD_MEMTYPE_DDR4)) {
-		if (PDimmPtr->DeskewTrn == 0U)
-			Xil_Out32(DDR_PHY_PIR_OFFSET, 0x0004CE01U);
-		else
-			Xil_Out32(DDR_PHY_PIR_OFFSET, 0x0004FE01U);
-	} else if (PDimmPtr->MemType == SPD_MEMTYPE_LPDDR3) {
-		if (PDimmPtr->Ddp == 1U) {
-			XFSBL_PROG_REG(DDR_PHY_RANKIDR_OFFSET,
-					DDR_PHY_RANKIDR_RANKWID_MASK,
-					DDR_PHY_RANKIDR_RANKWID_SHIFT, 1U);
-			XFSBL_PROG_REG(DDR_PHY_ODTCR_OFFSET,
-					DDR_PHY_ODTCR_WRODT_MASK,
-					DDR_PHY_ODTCR_WRODT_SHIFT, 1U);
-			XFSBL_PROG_REG(DDR_PHY_RANKIDR_OFFSET,
-					DDR_PHY_RANKIDR_RANKWID_MASK,
-					DDR_PHY_RANKIDR_RANKWID_SHIFT, 0U);
-		}
-
-		if (PDimmPtr->Zc1650)
-			Xil_Out32(DDR_PHY_PIR_OFFSET, 0x0004FE01U);
-		else {
-			if (PDimmPtr->GateExt)
-				if (PDimmPtr->DeskewTrn == 0U)
-					Xil_Out32(DDR_PHY_PIR_OFFSET, 0x0004CA05U);
-				else
-					Xil_Out32(DDR_PHY_PIR_OFFSET, 0x0004FA05U);
-			else
-				if (PDimmPtr->DeskewTrn == 0U)
-					Xil_Out32(DDR_PHY_PIR_OFFSET, 0x0004CE05U);
-				else
-					Xil_Out32(DDR_PHY_PIR_OFFSET, 0x0004FE05U);
-		}
-	} else if (PDimmPtr->MemType == SPD_MEMTYPE_LPDDR4) {
-		if (PDimmPtr->DeskewTrn == 0U)
-			Xil_Out32(DDR_PHY_PIR_OFFSET, 0x0014CE01U);
-		else
-			Xil_Out32(DDR_PHY_PIR_OFFSET, 0x0014FE01U);
-	}
-
-	if ((PDimmPtr->MemType == SPD_MEMTYPE_DDR3) ||
-			(PDimmPtr->MemType == SPD_MEMTYPE_DDR4)) {
-		PollVal = 0x80000CFFU;
-	} else if (PDimmPtr->MemType == SPD_MEMTYPE_LPDDR3) {
-		if (PDimmPtr->Zc1650) {
-			PollVal = 0x80000FFFU;
-		} else {
-			if (PDimmPtr->GateExt)
-				PollVal = 0x80001CBFU;
-			else
-				PollVal = 0x80001CFFU;
-		}
-	} else if (PDimmPtr->MemType == SPD_MEMTYPE_LPDDR4) {
-		PollVal = 0x80008CFFU;
-	}
-	if (PDimmPtr->DeskewTrn != 0U) {
-		PollVal |= 0x300U;
-	}
-
-	if (PDimmPtr->MemType != SPD_MEMTYPE_LPDDR4) {
-		RegVal = Xil_In32(DDR_PHY_PGSR0_OFFSET);
-		while (RegVal != PollVal) {
-			RegVal = Xil_In32(DDR_PHY_PGSR0_OFFSET);
-		}
+	/* Saved results are only restored for DDR3 and DDR4 */
+	if ((TrainRegs != NULL) &&
+			((PDimmPtr->MemType == SPD_MEMTYPE_DDR3) ||
+			(PDimmPtr->MemType == SPD_MEMTYPE_DDR4))) {
+		XFsbl_DdrRestoreTrainRegs(TrainRegs);
 	} else {
-		while (RegVal != 0x8000007EU)
-			RegVal = Xil_In32(DDR_PHY_PGSR0_OFFSET);
-
-		RegVal = Xil_In32(XFSBL_DDRPHY_BASE_ADDR + 0x200U);
-		RegVal &= ~(0xFU << 28U);
-		Xil_Out32(XFSBL_DDRPHY_BASE_ADDR + 0x200U, RegVal);
-
-		RegVal = Xil_In32(DDR_PHY_PGSR0_OFFSET);
-		while (RegVal != PollVal)
-			RegVal = Xil_In32(DDR_PHY_PGSR0_OFFSET);
-
-
-		RegVal &= ~(0xFU << 28U);
-		RegVal |= (0x8U << 28U);
-		Xil_Out32(XFSBL_DDRPHY_BASE_ADDR + 0x200U, RegVal);
+		XFsbl_DdrPhyRunTraining(PDimmPtr);
 	}
 
 	if (PDimmPtr->MemType != SPD_MEMTYPE_LPDDR4) {
@@ -6822,38 +7104,30 @@ END:
 
 /*****************************************************************************/
 /**
- * This function checks for the DDR SPD data and Initializes the same based on
- * configuration parameters obtained from SPD data.
+ * This function initializes the DDR controller and DDR-PHY from the SPD data
+ * and trains the DDR, or restores saved training results.
  *
- * @param	None
+ * @param	SpdData is the SPD data read from the EEPROM
+ * @param	DdrDataPtr is pointer to DDR Initialization Data Structure
+ * @param	SelfRefresh is non zero if the DDR is kept in self refresh and
+ *		must not be trained
+ * @param	TrainRegs are saved training results, NULL to train
  *
- * @return	returns the error codes described in xfsbl_error.h on any error
- *			returns XFSBL_SUCCESS on success
+ * @return	returns XFSBL_SUCCESS on success, error code otherwise
  *
  *****************************************************************************/
-u32 XFsbl_DdrInit(void)
+static u32 XFsbl_DdrInitSeq(u8 *SpdData, struct DdrcInitData *DdrDataPtr,
+		u32 SelfRefresh, const u32 *TrainRegs)
 {
 	u32 Status;
-	u8 SpdData[512U];
 #if !(defined(XPS_BOARD_ZCU102) || defined(XPS_BOARD_ZCU106) \
 	|| defined(XPS_BOARD_ZCU111) || defined(XPS_BOARD_ZCU216) \
-	|| defined(XPS_BOARD_ZCU208) || defined(XPS_BOARD_ZCU670)) \
-	|| defined(XFSBL_ENABLE_DDR_SR)
+	|| defined(XPS_BOARD_ZCU208) || defined(XPS_BOARD_ZCU670))
 	u32 RegVal;
 #endif
 
-	/* Define and Initialize the DDR Initialization data */
-	struct DdrcInitData DdrData = {
-		.AddrMapCsBit0 = 0x0U,
-		.AddrMapRowBits2To10 = 0x0U,
-	};
-
-	/* Get the Model Part Number from the SPD stored in EEPROM */
-	Status = XFsbl_IicReadSpdEeprom(SpdData);
-	if (Status != XFSBL_SUCCESS) {
-		Status = XFSBL_FAILURE;
-		goto END;
-	}
+	/* Initialize the DDR Initialization data */
+	memset(DdrDataPtr, 0U, sizeof(struct DdrcInitData));
 
 #if defined(XPS_BOARD_ZCU102) || defined(XPS_BOARD_ZCU106) \
 	|| defined(XPS_BOARD_ZCU111) || defined(XPS_BOARD_ZCU216) \
@@ -6862,20 +7136,20 @@ u32 XFsbl_DdrInit(void)
 	 * support only for DDR4 DIMMs. Skip checking for DDR type for these
 	 * boards.
 	 */
-	Status = XFsbl_Ddr4Init(SpdData, &DdrData);
+	Status = XFsbl_Ddr4Init(SpdData, DdrDataPtr);
 	if (XFSBL_SUCCESS != Status) {
 		Status = XFSBL_FAILURE;
 		goto END;
 	}
 #else
 	/* Determine the DIMM parameters to be used for register writes */
-	Status = XFsbl_DdrComputeDimmParameters(SpdData, &DdrData);
+	Status = XFsbl_DdrComputeDimmParameters(SpdData, DdrDataPtr);
 	if (Status != XFSBL_SUCCESS) {
 		goto END;
 	}
 
 	/* Initialize the Parameters with their default values */
-	XFsbl_InitilizeDdrParams(&DdrData);
+	XFsbl_InitilizeDdrParams(DdrDataPtr);
 
 	/* Assert Reset for DDR controller */
 	RegVal = Xil_In32(CRF_APB_RST_DDR_SS_OFFSET);
@@ -6883,7 +7157,7 @@ u32 XFsbl_DdrInit(void)
 	Xil_Out32(CRF_APB_RST_DDR_SS_OFFSET, RegVal);
 
 	/* Calculate and Write all the registers of DDR Controller */
-	Status = XFsbl_DdrcRegsInit(&DdrData);
+	Status = XFsbl_DdrcRegsInit(DdrDataPtr);
 	if (Status != XFSBL_SUCCESS) {
 		Status = XFSBL_FAILURE;
 		goto END;
@@ -6895,37 +7169,100 @@ u32 XFsbl_DdrInit(void)
 	Xil_Out32(CRF_APB_RST_DDR_SS_OFFSET, RegVal);
 
 	/* Calculate and Write all the registers of DDR-PHY Controller */
-	Status = XFsbl_PhyRegsInit(&DdrData);
+	Status = XFsbl_PhyRegsInit(DdrDataPtr);
 	if (Status != XFSBL_SUCCESS) {
 		Status = XFSBL_FAILURE;
 		goto END;
 	}
 #endif
 
-#ifdef XFSBL_ENABLE_DDR_SR
-	/* Check if DDR is in self refresh mode */
-	RegVal = Xil_In32(XFSBL_DDR_STATUS_REGISTER_OFFSET) &
-		DDR_STATUS_FLAG_MASK;
-	if (!RegVal) {
+	if (!SelfRefresh) {
 		/* Execute the Training Sequence */
-		Status = XFsbl_DdrcPhyTraining(&DdrData);
+		Status = XFsbl_DdrcPhyTraining(DdrDataPtr, TrainRegs);
 		if (Status != XFSBL_SUCCESS) {
 			Status = XFSBL_FAILURE;
 			goto END;
 		}
 	}
-#else
-	/* Execute the Training Sequence */
-	Status = XFsbl_DdrcPhyTraining(&DdrData);
+
+	Status = XFSBL_SUCCESS;
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function checks for the DDR SPD data and Initializes the same based on
+ * configuration parameters obtained from SPD data.
+ *
+ * With XFSBL_ENABLE_DDR_TRAIN_CACHE, training results saved on an earlier
+ * boot are restored instead of training the DDR, if they match the silicon,
+ * DIMM, board and temperature and the DDR passes a pattern check with them.
+ * Otherwise the DDR is trained and the new results are saved.
+ *
+ * @param	None
+ *
+ * @return	returns the error codes described in xfsbl_error.h on any error
+ *			returns XFSBL_SUCCESS on success
+ *
+ *****************************************************************************/
+u32 XFsbl_DdrInit(void)
+{
+	u32 Status;
+	u8 SpdData[512U];
+	u32 SelfRefresh = 0U;
+	struct DdrcInitData DdrData;
+#ifdef XFSBL_ENABLE_DDR_TRAIN_CACHE
+	XFsbl_DdrTrainData TrainData;
+#endif
+
+	/* Get the Model Part Number from the SPD stored in EEPROM */
+	Status = XFsbl_IicReadSpdEeprom(SpdData);
 	if (Status != XFSBL_SUCCESS) {
 		Status = XFSBL_FAILURE;
 		goto END;
 	}
+
+#ifdef XFSBL_ENABLE_DDR_SR
+	/* Check if DDR is in self refresh mode */
+	SelfRefresh = Xil_In32(XFSBL_DDR_STATUS_REGISTER_OFFSET) &
+		DDR_STATUS_FLAG_MASK;
+#endif
+
+#ifdef XFSBL_ENABLE_DDR_TRAIN_CACHE
+	/* The DDR content is kept in self refresh, so it is not checked */
+	if ((!SelfRefresh) &&
+			(XFsbl_DdrTrainLoad(SpdData, &TrainData) == XFSBL_SUCCESS)) {
+		Status = XFsbl_DdrInitSeq(SpdData, &DdrData, SelfRefresh,
+				TrainData.Regs);
+		if ((Status == XFSBL_SUCCESS) &&
+				(XFsbl_DdrTrainCheckMem() == XFSBL_SUCCESS)) {
+			XFsbl_Printf(DEBUG_INFO, "DDR training data restored\n\r");
+			goto END;
+		}
+		XFsbl_Printf(DEBUG_GENERAL, "DDR training data rejected, "
+				"training DDR\n\r");
+	}
+#endif
+
+	Status = XFsbl_DdrInitSeq(SpdData, &DdrData, SelfRefresh, NULL);
+	if (Status != XFSBL_SUCCESS) {
+		goto END;
+	}
+
+#ifdef XFSBL_ENABLE_DDR_TRAIN_CACHE
+	if ((!SelfRefresh) &&
+			((DdrData.PDimm.MemType == SPD_MEMTYPE_DDR3) ||
+			(DdrData.PDimm.MemType == SPD_MEMTYPE_DDR4)) &&
+			(XFsbl_DdrTrainCheckMem() == XFSBL_SUCCESS)) {
+		XFsbl_DdrTrainSave(SpdData, &TrainData);
+	}
 #endif
 
 	Status = XFSBL_SUCCESS;
 END:
 	return Status;
 }
+
 #endif /* XPAR_DYNAMIC_DDR_ENABLED */
 #endif /* XFSBL_PS_DDR */
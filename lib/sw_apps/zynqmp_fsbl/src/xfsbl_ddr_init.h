@@ -26,6 +26,7 @@
  * 3.0   bsv  11/12/19 Added support for ZCU216 board
  *       mn   12/24/19 Enable Address Mirroring based on SPD data
  *       bsv  02/05/20 Added support for ZCU208 board
+ * 4.1   ag   10/15/26 Added the DDR training data cache
  *
  * </pre>
  *
@@ -1858,6 +1859,42 @@ struct DdrcInitData {
 	XFsbl_DimmParams PDimm;
 };
 
+/* Registers saved per byte lane (GCR5-6, BDLR0-6, LCDLR0-5, GTR0) */
+#define XFSBL_DDR_TRAIN_LANE_REGS	16U
+/* Byte lanes DX0 to DX8 */
+#define XFSBL_DDR_TRAIN_LANES		9U
+#define XFSBL_DDR_TRAIN_NUM_REGS	(XFSBL_DDR_TRAIN_LANE_REGS * \
+						XFSBL_DDR_TRAIN_LANES)
+
+#define XFSBL_DDR_TRAIN_MAGIC		0x44545243U	/* "DTRC" */
+#define XFSBL_DDR_TRAIN_VERSION		1U
+
+/* Board identifier stored with the training data, set per board */
+#ifndef XFSBL_DDR_TRAIN_BOARD_ID
+#define XFSBL_DDR_TRAIN_BOARD_ID	0U
+#endif
+
+/* Allowed PS SYSMON temperature change in ADC codes, about 0.5 C each */
+#ifndef XFSBL_DDR_TRAIN_TEMP_DELTA
+#define XFSBL_DDR_TRAIN_TEMP_DELTA	20U
+#endif
+
+/*
+ * DDR training results saved by XFsbl_HookSaveDdrTrainData() after a full
+ * training and restored on the next boots, as long as the silicon, DIMM,
+ * board and temperature still match
+ */
+typedef struct {
+	u32 Magic;
+	u32 Version;
+	u32 IdCode;		/* CSU IDCODE of the silicon */
+	u32 BoardId;		/* XFSBL_DDR_TRAIN_BOARD_ID */
+	u32 SpdSum;		/* Checksum of the SPD data */
+	u32 Temperature;	/* PS SYSMON temperature ADC code */
+	u32 Regs[XFSBL_DDR_TRAIN_NUM_REGS];
+	u32 Checksum;		/* Checksum of all the fields above */
+} XFsbl_DdrTrainData;
+
 u32 XFsbl_DdrInit(void);
 
 #endif /* XPAR_DYNAMIC_DDR_ENABLED */
@@ -19,6 +19,7 @@
 * 1.00  kc   04/21/14 Initial release
 * 2.0   bv   12/05/16 Made compliance to MISRAC 2012 guidelines
 *       ssc  03/25/17 Set correct value for SYSMON ANALOG_BUS register
+*       ag   10/15/26 Added the DDR training data hooks
 *
 * </pre>
 *
@@ -189,3 +190,55 @@ u32 XFsbl_HookGetPosBootType(void)
 	return WarmBoot;
 }
 #endif
+
+#ifdef XFSBL_ENABLE_DDR_TRAIN_CACHE
+/*****************************************************************************/
+/**
+ * This function reads the DDR training data saved by
+ * XFsbl_HookSaveDdrTrainData(), for example from a reserved flash region.
+ * It is called before the DDR is initialized, so the data can not be read
+ * through DDR. FSBL checks the data and trains the DDR again if it does not
+ * match.
+ *
+ * @param DataPtr is where the data is copied to
+ * @param Size is the number of bytes to copy
+ *
+ * @return XFSBL_SUCCESS if the data is copied, XFSBL_FAILURE if no data is
+ * 	available (default)
+ *
+ *****************************************************************************/
+u32 XFsbl_HookGetDdrTrainData(u8 *DataPtr, u32 Size)
+{
+	u32 Status = XFSBL_FAILURE;
+
+	(void)DataPtr;
+	(void)Size;
+
+	/* Add the code here */
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function saves the DDR training data after a full training, for
+ * XFsbl_HookGetDdrTrainData() to return on the next boots.
+ *
+ * @param DataPtr is the data to save
+ * @param Size is the number of bytes to save
+ *
+ * @return error status based on implemented functionality (SUCCESS by default)
+ *
+ *****************************************************************************/
+u32 XFsbl_HookSaveDdrTrainData(const u8 *DataPtr, u32 Size)
+{
+	u32 Status = XFSBL_SUCCESS;
+
+	(void)DataPtr;
+	(void)Size;
+
+	/* Add the code here */
+
+	return Status;
+}
+#endif
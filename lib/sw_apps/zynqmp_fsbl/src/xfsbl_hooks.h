@@ -17,6 +17,7 @@
 * Ver   Who  Date        Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  kc   10/21/13 Initial release
+*       ag   10/15/26 Added the DDR training data hooks
 *
 * </pre>
 *
@@ -55,6 +56,10 @@ u32 XFsbl_HookPsuInit(void);
 
 u32 XFsbl_HookGetPosBootType(void);
 
+u32 XFsbl_HookGetDdrTrainData(u8 *DataPtr, u32 Size);
+
+u32 XFsbl_HookSaveDdrTrainData(const u8 *DataPtr, u32 Size);
+
 #ifdef __cplusplus
 }
 #endif
@@ -28,6 +28,7 @@
 *       bsv  05/03/21 Add provision to load bitstream from OCM with DDR
 *                     present in design
 * 6.0   bsv  08/03/22 Fix ECC error count for R5 FSBL
+*       ag   10/15/26 Added XFSBL_AUTH_PIPELINE definition
 *
 * </pre>
 *
@@ -902,6 +903,14 @@ extern "C" {
 #define XFSBL_FORCE_ENC
 #endif
 
+/*
+ * Definition for hashing authenticated partitions chunk by chunk
+ * while they are copied from the boot device
+ */
+#if defined(XFSBL_SECURE) && !defined(FSBL_AUTH_PIPELINE_EXCLUDE)
+#define XFSBL_AUTH_PIPELINE
+#endif
+
 #define XFSBL_QSPI_LINEAR_BASE_ADDRESS_START		(0xC0000000U)
 #define XFSBL_QSPI_LINEAR_BASE_ADDRESS_END		(0xDFFFFFFFU)
 
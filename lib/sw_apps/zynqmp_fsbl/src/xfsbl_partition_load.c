@@ -50,6 +50,8 @@
 *       bsv  05/15/21 Support to ensure authenticated images boot as
 *                     non-secure when RSA_EN is not programmed and boot header
 *                     is not authenticated is disabled by default
+* 4.0   ag   10/15/26 Authenticated partitions are hashed chunk by chunk
+*                     while they are copied from the boot device
 *
 * </pre>
 *
@@ -68,6 +70,7 @@
 #include "psu_init.h"
 #include "xfsbl_plpartition_valid.h"
 #include "xfsbl_tpm.h"
+#include "xfsbl_usb.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -90,6 +93,10 @@
 #define XFSBL_EL2_VAL		(4U)
 #define XFSBL_EL3_VAL		(6U)
 #endif
+#ifdef XFSBL_AUTH_PIPELINE
+/* Size of the chunks copied while the previous chunk is hashed */
+#define XFSBL_AUTH_CHUNK_SIZE	(0x20000U)
+#endif
 
 /************************** Function Prototypes ******************************/
 static u32 XFsbl_PartitionHeaderValidation(XFsblPs * FsblInstancePtr,
@@ -124,6 +131,10 @@ static void XFsbl_SetR5ExcepVectorLoVec(void);
 #ifdef XFSBL_TPM
 static u8 XFsbl_GetPcrIndex(const XFsblPs * FsblInstancePtr, u32 PartitionNum);
 #endif
+#ifdef XFSBL_AUTH_PIPELINE
+static u32 XFsbl_HashedCopy(const XFsblPs * FsblInstancePtr, u32 SrcAddress,
+		PTRSIZE LoadAddress, u32 Length);
+#endif
 
 /************************** Variable Definitions *****************************/
 #ifdef ARMR5
@@ -144,6 +155,11 @@ u8 HashsOfChunks[HASH_BUFFER_SIZE] __attribute__((section (".bss.bitstream_buffe
 u8 HashsOfChunks[HASH_BUFFER_SIZE] __attribute__((section (".bitstream_buffer")));
 #endif
 #endif
+#ifdef XFSBL_AUTH_PIPELINE
+/* Hash of the partition calculated by XFsbl_HashedCopy */
+static u8 PartitionCopyHash[XFSBL_HASH_TYPE_SHA3] __attribute__ ((aligned (4)));
+static u32 IsPartitionCopyHashed = FALSE;
+#endif
 #endif
 
 /* buffer for storing chunks for bitstream */
@@ -859,6 +875,9 @@ static u32 XFsbl_PartitionCopy(XFsblPs * FsblInstancePtr, u32 PartitionNum)
 	u32 Length;
 	u32 RunningCpu;
 	u32 RegVal;
+#ifdef XFSBL_AUTH_PIPELINE
+	u32 IsHashedCopy = FALSE;
+#endif
 
 #ifdef ARMR5
 	u32 Index;
@@ -872,6 +891,10 @@ static u32 XFsbl_PartitionCopy(XFsblPs * FsblInstancePtr, u32 PartitionNum)
 
 	RunningCpu = FsblInstancePtr->ProcessorID;
 
+#ifdef XFSBL_AUTH_PIPELINE
+	IsPartitionCopyHashed = FALSE;
+#endif
+
 	/**
 	 * Check for XIP image
 	 * No need to copy for XIP image
@@ -948,6 +971,24 @@ static u32 XFsbl_PartitionCopy(XFsblPs * FsblInstancePtr, u32 PartitionNum)
 		{
 			goto END;
 		}
+
+#ifdef XFSBL_AUTH_PIPELINE
+		/**
+		 * Hash the partition while it is copied, unless the copy
+		 * itself uses the CSU DMA
+		 */
+#ifndef FSBL_UNPROVISIONED_AUTH_SIGN_EXCLUDE
+		if (FsblInstancePtr->AuthEnabled == TRUE)
+#endif
+		{
+			IsHashedCopy = TRUE;
+		}
+#ifdef XFSBL_USB
+		if (FsblInstancePtr->DeviceOps.DeviceCopy == XFsbl_UsbCopy) {
+			IsHashedCopy = FALSE;
+		}
+#endif
+#endif
 	}
 #endif
 
@@ -1108,8 +1149,16 @@ static u32 XFsbl_PartitionCopy(XFsblPs * FsblInstancePtr, u32 PartitionNum)
 	/**
 	 * Copy the partition to PS_DDR/PL_DDR/TCM
 	 */
-	Status = FsblInstancePtr->DeviceOps.DeviceCopy(SrcAddress,
+#ifdef XFSBL_AUTH_PIPELINE
+	if (IsHashedCopy == TRUE) {
+		Status = XFsbl_HashedCopy(FsblInstancePtr, SrcAddress,
+					LoadAddress, Length);
+	} else
+#endif
+	{
+		Status = FsblInstancePtr->DeviceOps.DeviceCopy(SrcAddress,
 					LoadAddress, Length);
+	}
 
 #ifdef XFSBL_PERF
 	XFsbl_MeasurePerfTime(tCur);
@@ -1358,9 +1407,20 @@ static u32 XFsbl_PartitionValidation(XFsblPs * FsblInstancePtr,
 			 * Authentication for non bitstream partition in DDR
 			 * less system
 			 */
-			Status = XFsbl_Authentication(FsblInstancePtr, LoadAddress,
-					Length, (PTRSIZE)AuthBuffer,
-					PartitionNum);
+#ifdef XFSBL_AUTH_PIPELINE
+			if (IsPartitionCopyHashed == TRUE) {
+				/* Partition is already hashed by the copy */
+				IsPartitionCopyHashed = FALSE;
+				Status = XFsbl_AuthenticationWithHash(
+						(PTRSIZE)AuthBuffer,
+						PartitionCopyHash);
+			} else
+#endif
+			{
+				Status = XFsbl_Authentication(FsblInstancePtr,
+						LoadAddress, Length,
+						(PTRSIZE)AuthBuffer, PartitionNum);
+			}
 			if (Status != XFSBL_SUCCESS) {
 				goto END;
 			}
@@ -1955,6 +2015,94 @@ static void XFsbl_CalculateSHA(const XFsblPs * FsblInstancePtr,
 		XFSBL_HASH_TYPE_SHA3);
 }
 
+#ifdef XFSBL_AUTH_PIPELINE
+/*****************************************************************************/
+/**
+ * This function copies an authenticated partition in chunks and hashes each
+ * chunk with the CSU DMA while the next chunk is copied from the boot device.
+ * The boot device copy does not use the CSU DMA, so both run in parallel.
+ * The hash also covers the authentication certificate up to the partition
+ * signature, which is already in AuthBuffer, so that it can be passed to
+ * XFsbl_AuthenticationWithHash.
+ *
+ * @param	FsblInstancePtr is pointer to the XFsbl Instance
+ * @param	SrcAddress is the address of the partition in the boot device
+ * @param	LoadAddress is the address the partition is copied to
+ * @param	Length is the length of the partition without the
+ *		authentication certificate
+ *
+ * @return	returns the error codes described in xfsbl_error.h on any error
+ * 			returns XFSBL_SUCCESS on success
+ *
+ *****************************************************************************/
+static u32 XFsbl_HashedCopy(const XFsblPs * FsblInstancePtr, u32 SrcAddress,
+		PTRSIZE LoadAddress, u32 Length)
+{
+	u32 Status = XFSBL_SUCCESS;
+	u32 Offset = 0U;
+	u32 ChunkLen;
+	u32 IsUpdatePending = FALSE;
+
+	XFsbl_ShaStart(NULL, XFSBL_HASH_TYPE_SHA3);
+
+	while (Offset < Length) {
+		ChunkLen = Length - Offset;
+		if (ChunkLen > XFSBL_AUTH_CHUNK_SIZE) {
+			ChunkLen = XFSBL_AUTH_CHUNK_SIZE;
+		}
+
+		/* Copy this chunk while the previous one is hashed */
+		Status = FsblInstancePtr->DeviceOps.DeviceCopy(
+				SrcAddress + Offset, LoadAddress + Offset,
+				ChunkLen);
+		if (IsUpdatePending == TRUE) {
+			IsUpdatePending = FALSE;
+			if (XFsbl_ShaWaitForUpdate(NULL,
+				XFSBL_HASH_TYPE_SHA3) != XFSBL_SUCCESS) {
+				Status = XFSBL_ERROR_PART_SIGNATURE;
+				XFsbl_Printf(DEBUG_GENERAL,
+					"XFsbl_HashedCopy: SHA3 update failed\r\n");
+			}
+		}
+		if (Status != XFSBL_SUCCESS) {
+			goto END;
+		}
+
+		Status = XFsbl_ShaUpdateAsync(NULL,
+				(u8 *)(LoadAddress + Offset), ChunkLen,
+				XFSBL_HASH_TYPE_SHA3);
+		if (Status != XFSBL_SUCCESS) {
+			Status = XFSBL_ERROR_PART_SIGNATURE;
+			XFsbl_Printf(DEBUG_GENERAL,
+				"XFsbl_HashedCopy: SHA3 update failed\r\n");
+			goto END;
+		}
+		IsUpdatePending = TRUE;
+		Offset += ChunkLen;
+	}
+
+	if (IsUpdatePending == TRUE) {
+		if (XFsbl_ShaWaitForUpdate(NULL, XFSBL_HASH_TYPE_SHA3) !=
+				XFSBL_SUCCESS) {
+			Status = XFSBL_ERROR_PART_SIGNATURE;
+			XFsbl_Printf(DEBUG_GENERAL,
+				"XFsbl_HashedCopy: SHA3 update failed\r\n");
+			goto END;
+		}
+	}
+
+	/* Calculate hash for (AC - signature size) */
+	XFsbl_ShaUpdate(NULL, AuthBuffer,
+		(XFSBL_AUTH_CERT_MIN_SIZE - XFSBL_FSBL_SIG_SIZE),
+		XFSBL_HASH_TYPE_SHA3);
+	XFsbl_ShaFinish(NULL, PartitionCopyHash, XFSBL_HASH_TYPE_SHA3);
+	IsPartitionCopyHashed = TRUE;
+
+END:
+	return Status;
+}
+#endif
+
 #ifdef XFSBL_ENABLE_DDR_SR
 /*****************************************************************************/
 /**
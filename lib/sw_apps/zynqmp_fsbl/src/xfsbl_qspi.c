@@ -31,6 +31,8 @@
 *                     64 byte aligned
 *       bsv  05/03/22 Replace memcpy with Xil_MemCpy to avoid non-word aligned
 *                     access to memory
+* 8.0   ag   10/15/26 Switch to the fastest QSPI clock that reads back the
+*                     same data as the default clock
 *
 * </pre>
 *
@@ -64,6 +66,8 @@
 static u32 FlashReadID(XQspiPsu *QspiPsuPtr);
 static u32 MacronixEnable4B(XQspiPsu *QspiPsuPtr);
 static u32 MacronixEnableQPIMode(XQspiPsu *QspiPsuPtr, int Enable);
+static u32 XFsbl_QspiTuneClock(u32 (*CopyFunc)(u32 SrcAddress,
+		PTRSIZE DestAddress, u32 Length));
 
 /************************** Variable Definitions *****************************/
 static XQspiPsu QspiPsuInstance __attribute__ ((aligned(64)));
@@ -78,6 +82,10 @@ static u8 ReadBuffer[10] __attribute__ ((aligned(32)));
 static u8 WriteBuffer[10] __attribute__ ((aligned(32)));
 static u32 MacronixFlash = 0U;
 u8 MultiDie = (u8)FALSE;
+#if (XFSBL_QSPI_MAX_FREQ_HZ != 0U)
+static u8 TuneRefBuffer[XFSBL_QSPI_TUNE_LEN] __attribute__ ((aligned(64)));
+static u8 TuneBuffer[XFSBL_QSPI_TUNE_LEN] __attribute__ ((aligned(64)));
+#endif
 
 /******************************************************************************
 *
@@ -258,7 +266,8 @@ u32 XFsbl_Qspi24Init(u32 DeviceFlags)
 	/*
 	 * Set the pre-scaler for QSPI clock
 	 */
-	Status = XQspiPsu_SetClkPrescaler(&QspiPsuInstance, XQSPIPSU_CLK_PRESCALE_8);
+	Status = XQspiPsu_SetClkPrescaler(&QspiPsuInstance,
+			XFSBL_QSPI_DEFAULT_PRESCALER);
 
 	if (Status != XFSBL_SUCCESS) {
 		UStatus = XFSBL_ERROR_QSPI_PRESCALER_CLK;
@@ -354,6 +363,8 @@ u32 XFsbl_Qspi24Init(u32 DeviceFlags)
 		QspiFlashSize = 2 * QspiFlashSize;
 	}
 
+	UStatus = XFsbl_QspiTuneClock(XFsbl_Qspi24Copy);
+
 END:
 	return UStatus;
 }
@@ -965,7 +976,8 @@ u32 XFsbl_Qspi32Init(u32 DeviceFlags)
 	/*
 	 * Set the pre-scaler for QSPI clock
 	 */
-	Status = XQspiPsu_SetClkPrescaler(&QspiPsuInstance, XQSPIPSU_CLK_PRESCALE_8);
+	Status = XQspiPsu_SetClkPrescaler(&QspiPsuInstance,
+			XFSBL_QSPI_DEFAULT_PRESCALER);
 
 	if (Status != XFSBL_SUCCESS) {
 		UStatus = XFSBL_ERROR_QSPI_PRESCALER_CLK;
@@ -1083,7 +1095,82 @@ u32 XFsbl_Qspi32Init(u32 DeviceFlags)
 		QspiFlashSize = 2 * QspiFlashSize;
 	}
 
+	UStatus = XFsbl_QspiTuneClock(XFsbl_Qspi32Copy);
+
+END:
+	return UStatus;
+}
+
+/******************************************************************************
+*
+* This function switches the QSPI clock from the default prescaler to the
+* fastest one that does not exceed XFSBL_QSPI_MAX_FREQ_HZ. The driver sets
+* the tap delays and the loopback clock for the new frequency. The start of
+* the flash is read with both prescalers and the faster one is kept only if
+* the data matches, otherwise the default prescaler is restored.
+*
+* @param	CopyFunc is the copy function of the addressing mode in use
+*
+* @return	XFSBL_SUCCESS if the flash can be read with the default or the
+*		faster prescaler, otherwise the error of the copy function.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 XFsbl_QspiTuneClock(u32 (*CopyFunc)(u32 SrcAddress,
+		PTRSIZE DestAddress, u32 Length))
+{
+	u32 UStatus = XFSBL_SUCCESS;
+#if (XFSBL_QSPI_MAX_FREQ_HZ != 0U)
+	u8 Prescaler = XQSPIPSU_CLK_PRESCALE_2;
+	u32 Index;
+
+	/* Find the fastest prescaler within the maximum frequency */
+	while ((Prescaler < XFSBL_QSPI_DEFAULT_PRESCALER) &&
+		((QspiPsuInstance.Config.InputClockHz >> (Prescaler + 1U)) >
+			XFSBL_QSPI_MAX_FREQ_HZ)) {
+		Prescaler++;
+	}
+	if (Prescaler >= XFSBL_QSPI_DEFAULT_PRESCALER) {
+		goto END;
+	}
+
+	UStatus = CopyFunc(0U, (PTRSIZE)TuneRefBuffer, XFSBL_QSPI_TUNE_LEN);
+	if (UStatus != XFSBL_SUCCESS) {
+		goto END;
+	}
+
+	if (XQspiPsu_SetClkPrescaler(&QspiPsuInstance, Prescaler) !=
+			XST_SUCCESS) {
+		goto RESTORE;
+	}
+	if (CopyFunc(0U, (PTRSIZE)TuneBuffer, XFSBL_QSPI_TUNE_LEN) !=
+			XFSBL_SUCCESS) {
+		goto RESTORE;
+	}
+	for (Index = 0U; Index < XFSBL_QSPI_TUNE_LEN; Index++) {
+		if (TuneBuffer[Index] != TuneRefBuffer[Index]) {
+			goto RESTORE;
+		}
+	}
+
+	XFsbl_Printf(DEBUG_INFO, "QSPI clock is %d Hz\r\n",
+		QspiPsuInstance.Config.InputClockHz >> (Prescaler + 1U));
+	goto END;
+
+RESTORE:
+	XFsbl_Printf(DEBUG_GENERAL, "QSPI clock tuning failed,"
+		" using the default prescaler\r\n");
+	if (XQspiPsu_SetClkPrescaler(&QspiPsuInstance,
+			XFSBL_QSPI_DEFAULT_PRESCALER) != XST_SUCCESS) {
+		UStatus = XFSBL_ERROR_QSPI_PRESCALER_CLK;
+		XFsbl_Printf(DEBUG_GENERAL,"XFSBL_ERROR_QSPI_PRESCALER_CLK\r\n");
+	}
+
 END:
+#else
+	(void)CopyFunc;
+#endif
 	return UStatus;
 }
 
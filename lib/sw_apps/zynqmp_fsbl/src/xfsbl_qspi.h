@@ -27,6 +27,7 @@
 * 5.0   bsv  11/15/20 Added Macronix 2G flash support
 * 6.0   bsv  07/29/21 Added Winbond 2G flash support
 *       bsv  09/08/21 Added MultiDie read support for Micron 2G flash part
+* 7.0   ag   10/15/26 Added XFSBL_QSPI_MAX_FREQ_HZ for QSPI clock tuning
 *
 * </pre>
 *
@@ -101,6 +102,23 @@ extern "C" {
  */
 #define DMA_DATA_TRAN_SIZE		(0x20000000U)
 
+/*
+ * Maximum QSPI clock used for boot. After the flash is identified, the
+ * fastest prescaler that does not exceed it is selected if the flash reads
+ * back the same data as with the default prescaler. Defining it as 0 keeps
+ * the default prescaler.
+ */
+#ifndef XFSBL_QSPI_MAX_FREQ_HZ
+#define XFSBL_QSPI_MAX_FREQ_HZ		XQSPIPSU_FREQ_100MHZ
+#endif
+
+/*
+ * Prescaler used to identify the flash, and the length read to compare it
+ * against the faster clock
+ */
+#define XFSBL_QSPI_DEFAULT_PRESCALER	XQSPIPSU_CLK_PRESCALE_8
+#define XFSBL_QSPI_TUNE_LEN		(256U)
+
 /*
  * The following defines are for dual flash interface.
  */
@@ -23,6 +23,7 @@
  * 4.0   har  06/17/20  Removed references to unused algorithms
  * 5.0   bsv  03/11/21  Fixed build issues
  *       kpt  03/16/21  Updated function headers with appropriate description
+ * 6.0   ag   10/15/26  Added XFsbl_ShaUpdateAsync() and XFsbl_ShaWaitForUpdate()
  *
  * </pre>
  *
@@ -131,6 +132,65 @@ void XFsbl_ShaUpdate(void * Ctx, u8 * Data, u32 Size, u32 HashLen)
 	}
 }
 
+/*****************************************************************************
+ * This function starts the update of the SHA3 engine with the input data
+ * and returns without waiting for the CSU DMA transfer to complete.
+ *
+ * @param       Ctx      Pointer to a callback function
+ * @param       Data     Pointer to the input data that is used for
+ *                       hash calculation, it must not be modified until
+ *                       XFsbl_ShaWaitForUpdate() returns
+ * @param       Size     Size of the input data that is provided
+ *                       for hash calculation
+ * @param       HashLen  Length of the hash that is used to determine sha3
+ *                       hashing
+ *
+ * @return      XFSBL_SUCCESS if the transfer is started
+ *              XFSBL_FAILURE otherwise
+ *
+ ******************************************************************************/
+u32 XFsbl_ShaUpdateAsync(void * Ctx, u8 * Data, u32 Size, u32 HashLen)
+{
+	u32 Status = XFSBL_FAILURE;
+
+	if(XFSBL_HASH_TYPE_SHA3 == HashLen)
+	{
+		if (XSecure_Sha3UpdateAsync(&SecureSha3, Data, Size) ==
+				(u32)XST_SUCCESS) {
+			Status = XFSBL_SUCCESS;
+		}
+	}
+
+	return Status;
+}
+
+/*****************************************************************************
+ * This function waits for the update started by XFsbl_ShaUpdateAsync()
+ * to complete.
+ *
+ * @param       Ctx      Pointer to a callback function
+ * @param       HashLen  Length of the hash that is used to determine sha3
+ *                       hashing
+ *
+ * @return      XFSBL_SUCCESS if the update is complete
+ *              XFSBL_FAILURE on timeout
+ *
+ ******************************************************************************/
+u32 XFsbl_ShaWaitForUpdate(void * Ctx, u32 HashLen)
+{
+	u32 Status = XFSBL_FAILURE;
+
+	if(XFSBL_HASH_TYPE_SHA3 == HashLen)
+	{
+		if (XSecure_Sha3WaitForUpdate(&SecureSha3) ==
+				(u32)XST_SUCCESS) {
+			Status = XFSBL_SUCCESS;
+		}
+	}
+
+	return Status;
+}
+
 #ifdef XFSBL_SECURE
 /*****************************************************************************
  *
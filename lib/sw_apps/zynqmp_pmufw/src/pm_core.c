@@ -52,6 +52,10 @@
 #include "xpfw_mod_wdt.h"
 #endif
 
+#ifdef ENABLE_APU_DVFS
+#include "xpfw_mod_dvfs.h"
+#endif
+
 #define MIO_TRI_PIN32	(32U)
 #define MIO_TRI_PIN33	(33U)
 #define MIO_TRI_PIN34	(34U)
@@ -77,8 +81,24 @@
 #define DYNAMIC_MIO_CONFIG_BITMASK	(0ULL)
 #endif /* ENABLE_DYNAMIC_MIO_CONFIG */
 
+#ifdef ENABLE_PM_API_STATS
+#define PM_API_STATS_BITMASK	(1ULL << (u64)PM_IOCTL_GET_API_STATS)
+
+/* Number of calls received for each PM API ID */
+static u32 pmApiCallCnt[PM_API_MAX];
+#else
+#define PM_API_STATS_BITMASK	(0ULL)
+#endif /* ENABLE_PM_API_STATS */
+
+#ifdef ENABLE_APU_DVFS
+#define APU_DVFS_BITMASK	(1ULL << (u64)PM_IOCTL_SET_APU_LOAD)
+#else
+#define APU_DVFS_BITMASK	(0ULL)
+#endif /* ENABLE_APU_DVFS */
+
 #define PM_IOCTL_FEATURE_BITMASK (			\
-	(FEATURE_CONFIG_BITMASK) | (DYNAMIC_MIO_CONFIG_BITMASK))
+	(FEATURE_CONFIG_BITMASK) | (DYNAMIC_MIO_CONFIG_BITMASK) |	\
+	(PM_API_STATS_BITMASK) | (APU_DVFS_BITMASK))
 /*
  * PM error numbers, mostly used to identify erroneous usage of EEMI. Note:
  * these errors are errors from the perspective of using EEMI API. PMU-FW
@@ -2088,6 +2108,29 @@ static void PmDevIoctl(const PmMaster* const master, const u32 deviceId,
 		status = PmSetUsbConfig(deviceId, (XPm_UsbConfigType)arg1, arg2);
 		break;
 #endif /* ENABLE_DYNAMIC_MIO_CONFIG */
+#ifdef ENABLE_PM_API_STATS
+	case PM_IOCTL_GET_API_STATS:
+		/* arg1 is the PM API ID, non-zero arg2 clears the counter */
+		if (arg1 >= (u32)PM_API_MAX) {
+			status = XST_INVALID_PARAM;
+			break;
+		}
+		value = pmApiCallCnt[arg1];
+		if (0U != arg2) {
+			pmApiCallCnt[arg1] = 0U;
+		}
+		status = XST_SUCCESS;
+		break;
+#endif /* ENABLE_PM_API_STATS */
+#ifdef ENABLE_APU_DVFS
+	case PM_IOCTL_SET_APU_LOAD:
+		if (&pmMasterApu_g != master) {
+			status = XST_PM_NO_ACCESS;
+			break;
+		}
+		status = ApuDvfsSetLoad(arg1);
+		break;
+#endif /* ENABLE_APU_DVFS */
 	default:
 		status = XST_INVALID_PARAM;
 		break;
@@ -2240,6 +2283,11 @@ void PmProcessRequest(PmMaster *const master, const u32 *pload)
 		IPI_RESPONSE1(master->ipiMask, XST_PM_NO_ACCESS);
 		goto done;
 	}
+#ifdef ENABLE_PM_API_STATS
+	if (pload[0] < (u32)PM_API_MAX) {
+		pmApiCallCnt[pload[0]]++;
+	}
+#endif
 	switch (pload[0]) {
 	case PM_API(PM_SELF_SUSPEND):
 		address = ((u64) pload[5]) << 32ULL;
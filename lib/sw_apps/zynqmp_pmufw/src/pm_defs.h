@@ -149,6 +149,14 @@ typedef enum {
 	/* Set USB config */
 	PM_IOCTL_SET_USB_CONFIG = 32,
 #endif /* ENABLE_DYNAMIC_MIO_CONFIG */
+#ifdef ENABLE_PM_API_STATS
+	/* Get (and optionally clear) call count of a PM API */
+	PM_IOCTL_GET_API_STATS = 33,
+#endif /* ENABLE_PM_API_STATS */
+#ifdef ENABLE_APU_DVFS
+	/* APU load hint for the clock governor */
+	PM_IOCTL_SET_APU_LOAD = 34,
+#endif /* ENABLE_APU_DVFS */
 	PM_IOCTL_MAX,
 } XPm_IoctlId;
 #endif /* ENABLE_IOCTL */
@@ -221,6 +221,7 @@ PmMaster pmMasterApu_g = {
 	.nid = NODE_APU,
 	.ipiMask = IPI_PMU_0_IER_APU_MASK,
 	.reqs = NULL,
+	.wakeReqs = NULL,
 	.nextMaster = NULL,
 	.wakePerms = 0U,
 	.suspendPerms = 0U,
@@ -249,6 +250,7 @@ PmMaster pmMasterRpu_g = {
 	.nid = NODE_RPU,
 	.ipiMask = IPI_PMU_0_IER_RPU_0_MASK,
 	.reqs = NULL,
+	.wakeReqs = NULL,
 	.wakePerms = 0U,
 	.suspendPerms = 0U,
 	.suspendTimeout = 0U,
@@ -276,6 +278,7 @@ PmMaster pmMasterRpu0_g = {
 	.nid = NODE_RPU_0,
 	.ipiMask = 0U,
 	.reqs = NULL,
+	.wakeReqs = NULL,
 	.wakePerms = 0U,
 	.suspendPerms = 0U,
 	.suspendTimeout = 0U,
@@ -301,6 +304,7 @@ PmMaster pmMasterRpu1_g = {
 	.nid = NODE_RPU_1,
 	.ipiMask = 0U,
 	.reqs = NULL,
+	.wakeReqs = NULL,
 	.nextMaster = NULL,
 	.wakePerms = 0U,
 	.suspendPerms = 0U,
@@ -385,6 +389,7 @@ void PmMasterClearConfig(void)
 
 		/* Clear requirements of the master */
 		mst->reqs = NULL;
+		mst->wakeReqs = NULL;
 
 		/* Clear the pointer to the next master */
 		next = mst->nextMaster;
@@ -755,6 +760,7 @@ static s32 PmMasterForceDownCleanup(PmMaster* const master)
 	PmWakeUpCancelScheduled(master);
 	PmNotifierUnregisterAll(master);
 	master->wakeProc = NULL;
+	master->wakeReqs = NULL;
 	master->suspendRequest.initiator = NULL;
 
 	return status;
@@ -849,7 +855,7 @@ s32 PmMasterFsm(PmMaster* const master, const PmMasterEvent event)
 		break;
 	case PM_MASTER_EVENT_WAKE:
 		if (PM_MASTER_STATE_SUSPENDED == master->state) {
-			status = PmRequirementUpdateScheduled(master, false);
+			status = PmRequirementRestoreScheduled(master);
 			if (XST_SUCCESS == status) {
 				PmWakeUpCancelScheduled(master);
 			}
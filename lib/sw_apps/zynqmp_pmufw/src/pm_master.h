@@ -84,6 +84,8 @@ typedef struct {
  * @reqs        Pointer to the master's list of requirements for slaves'
  *              capabilities. For every slave that the master can use there has
  *              to be a dedicated requirements structure
+ * @wakeReqs    Pointer to the list of requirements changed when the master
+ *              suspended, which need to be restored when it wakes-up
  * @nextMaster  Pointer to the next used master in the system
  * @gic         If the master has its own GIC which is controlled by the PMU,
  *              this is a pointer to it.
@@ -118,6 +120,7 @@ struct PmMaster {
 	PmProc** const procs;
 	PmProc* wakeProc;
 	PmRequirement* reqs;
+	PmRequirement* wakeReqs;
 	PmMaster* nextMaster;
 	const PmGicProxy* const gic;
 	s32 (*const evalState)(const u32 state);
@@ -878,27 +878,38 @@ static const PmAccessRegion pmAccessTable[] = {
 static bool PmGetMmioAccess(const PmMaster *const master, const u32 address,
 			    enum mmio_access_type type)
 {
+	/*
+	 * Index of the last region that granted access. Masters tend to poll
+	 * the same registers, so the cached region is checked before the scan.
+	 */
+	static u32 lastIdx = 0U;
 	u32 i;
+	u32 mask;
 	bool permission = false;
 
 	if (NULL == master) {
 		goto done;
 	}
 
-	for (i = 0U; i < ARRAY_SIZE(pmAccessTable); i++) {
-		if ((address >= pmAccessTable[i].startAddr) &&
-		    (address <= pmAccessTable[i].endAddr)) {
-
-			u32 mask = master->ipiMask;
+	mask = master->ipiMask;
+	if (MMIO_ACCESS_TYPE_WRITE == type) {
+		mask <<= WRITE_PERM_SHIFT;
+	}
 
-			if (MMIO_ACCESS_TYPE_WRITE == type) {
-				mask <<= WRITE_PERM_SHIFT;
-			}
+	if ((address >= pmAccessTable[lastIdx].startAddr) &&
+	    (address <= pmAccessTable[lastIdx].endAddr) &&
+	    (0U != (pmAccessTable[lastIdx].access & mask))) {
+		permission = true;
+		goto done;
+	}
 
-			if (0U != (pmAccessTable[i].access & mask)) {
-				permission = true;
-				break;
-			}
+	for (i = 0U; i < ARRAY_SIZE(pmAccessTable); i++) {
+		if ((address >= pmAccessTable[i].startAddr) &&
+		    (address <= pmAccessTable[i].endAddr) &&
+		    (0U != (pmAccessTable[i].access & mask))) {
+			lastIdx = i;
+			permission = true;
+			break;
 		}
 	}
 
@@ -246,11 +246,13 @@ done:
  * current requirements. Default requirements has priority over current
  * requirements.
  */
-s32 PmRequirementUpdateScheduled(const PmMaster* const master, const bool swap)
+s32 PmRequirementUpdateScheduled(PmMaster* const master, const bool swap)
 {
 	s32 status = XST_SUCCESS;
 	PmRequirement* req = master->reqs;
+	PmRequirement** wakeTail = &master->wakeReqs;
 
+	master->wakeReqs = NULL;
 	while (NULL != req) {
 		if (req->currReq != req->nextReq) {
 			u32 tmpReq = req->nextReq;
@@ -266,6 +268,10 @@ s32 PmRequirementUpdateScheduled(const PmMaster* const master, const bool swap)
 					/* Save current requirements as next */
 					req->nextReq = req->currReq;
 				}
+				/* Link the requirement to be restored on wake */
+				req->nextWake = NULL;
+				*wakeTail = req;
+				wakeTail = &req->nextWake;
 			}
 
 			req->currReq = (u8)tmpReq;
@@ -275,6 +281,8 @@ s32 PmRequirementUpdateScheduled(const PmMaster* const master, const bool swap)
 			/* if rom works correctly, status should be always ok */
 			if (XST_SUCCESS != status) {
 				PmErr("updating %s\r\n", req->slave->node.name);
+				/* Wake-up will have to walk all requirements */
+				master->wakeReqs = NULL;
 				break;
 			}
 		}
@@ -284,6 +292,46 @@ s32 PmRequirementUpdateScheduled(const PmMaster* const master, const bool swap)
 	return status;
 }
 
+/**
+ * PmRequirementRestoreScheduled() - Restore requirements of a master which
+ *                                   were swapped when the master suspended
+ * @master  Master that is waking-up
+ *
+ * @return  Status of updating the slaves
+ *
+ * @note    Only the requirements linked when the master suspended are
+ *          visited, so the wake-up latency does not depend on the number of
+ *          slaves the master is using. If the list was not built the function
+ *          falls back to walking all requirements of the master.
+ */
+s32 PmRequirementRestoreScheduled(PmMaster* const master)
+{
+	s32 status = XST_SUCCESS;
+	PmRequirement* req = master->wakeReqs;
+
+	if (NULL == req) {
+		status = PmRequirementUpdateScheduled(master, false);
+		goto done;
+	}
+
+	master->wakeReqs = NULL;
+	while (NULL != req) {
+		if (req->currReq != req->nextReq) {
+			req->currReq = req->nextReq;
+
+			status = PmUpdateSlave(req->slave);
+			if (XST_SUCCESS != status) {
+				PmErr("updating %s\r\n", req->slave->node.name);
+				break;
+			}
+		}
+		req = req->nextWake;
+	}
+
+done:
+	return status;
+}
+
 /**
  * PmRequirementCancelScheduled() - Called when master aborts suspend, to cancel
  * scheduled requirements (slave capabilities requests)
@@ -74,6 +74,8 @@ typedef enum {
  * @info        Contains information about master's request - a bit for
  *              encoding has master requested or released node, and a bit to
  *              encode has master requested a wake-up of this slave.
+ * @nextWake    Pointer to the next master's requirement to be restored when
+ *              the master wakes-up (linked when the master suspends)
  */
 struct PmRequirement {
 	PmSlave* slave;
@@ -86,6 +88,7 @@ struct PmRequirement {
 	u8 nextReq;
 	u32 latencyReq;
 	u8 info;
+	PmRequirement* nextWake;
 };
 
 /*********************************************************************
@@ -100,7 +103,8 @@ void PmRequirementClear(PmRequirement* const req);
 
 s32 PmRequirementSchedule(PmRequirement* const masterReq, const u32 caps);
 s32 PmRequirementUpdate(PmRequirement* const masterReq, const u32 caps);
-s32 PmRequirementUpdateScheduled(const PmMaster* const master, const bool swap);
+s32 PmRequirementUpdateScheduled(PmMaster* const master, const bool swap);
+s32 PmRequirementRestoreScheduled(PmMaster* const master);
 s32 PmRequirementRequest(PmRequirement* const req, const u32 caps);
 s32 PmRequirementRelease(PmRequirement* const first, const PmReleaseScope scope);
 
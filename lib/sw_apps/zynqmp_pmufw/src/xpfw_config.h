@@ -112,6 +112,10 @@ extern "C" {
  * 	                             line when system shutdown request comes
  *	- ENABLE_DYNAMIC_MIO_CONFIG: Enables IOCTL support for configuring MIO
  *				     regiisters
+ *	- ENABLE_PM_API_STATS: Enables per PM API call counters, readable
+ *			       through IOCTL
+ *	- ENABLE_APU_DVFS: Enables APU clock governor driven by load hints
+ *			   received through IOCTL
  */
 #ifndef ENABLE_PM_VAL
 #define	ENABLE_PM_VAL						(1U)
@@ -281,6 +285,14 @@ extern "C" {
 #define ENABLE_DDR_XMPU_VAL			(0U)
 #endif
 
+#ifndef ENABLE_PM_API_STATS_VAL
+#define ENABLE_PM_API_STATS_VAL			(0U)
+#endif
+
+#ifndef ENABLE_APU_DVFS_VAL
+#define ENABLE_APU_DVFS_VAL			(0U)
+#endif
+
 /*
  * XPFW_CFG_PMU_DEFAULT_WDT_TIMEOUT
  * 		Default watchdog timeout
@@ -563,6 +575,26 @@ extern "C" {
 #define ENABLE_DDR_XMPU
 #endif
 
+#if (ENABLE_PM_API_STATS_VAL) && (!defined(ENABLE_PM_API_STATS))
+#define ENABLE_PM_API_STATS
+#endif
+
+#if defined(ENABLE_PM_API_STATS)
+#ifndef ENABLE_IOCTL
+#define ENABLE_IOCTL
+#endif
+#endif
+
+#if (ENABLE_APU_DVFS_VAL) && (!defined(ENABLE_APU_DVFS))
+#define ENABLE_APU_DVFS
+#endif
+
+#if defined(ENABLE_APU_DVFS)
+#ifndef ENABLE_IOCTL
+#define ENABLE_IOCTL
+#endif
+#endif
+
 #ifdef __cplusplus
 }
 #endif
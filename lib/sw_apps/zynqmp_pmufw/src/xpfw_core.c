@@ -305,6 +305,21 @@ XStatus XPfw_CoreScheduleTask(const XPfw_Module_t *ModPtr, u32 Interval,
 	return Status;
 }
 
+XStatus XPfw_CoreScheduleTaskUs(const XPfw_Module_t *ModPtr, u32 IntervalUs,
+		VoidFunction_t CallbackRef)
+{
+	XStatus Status;
+
+	if ((ModPtr != NULL) && (CorePtr != NULL)) {
+		Status = XPfw_SchedulerAddTaskUs(&CorePtr->Scheduler, ModPtr->ModId,
+				IntervalUs, CallbackRef);
+	} else {
+		Status = XST_FAILURE;
+	}
+
+	return Status;
+}
+
 s32 XPfw_CoreRemoveTask(const XPfw_Module_t *ModPtr, u32 Interval,
 		VoidFunction_t CallbackRef)
 {
@@ -0,0 +1,198 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+#include "xpfw_default.h"
+#include "xpfw_config.h"
+#include "xpfw_module.h"
+#include "xpfw_core.h"
+#include "xpfw_mod_dvfs.h"
+
+#ifdef ENABLE_APU_DVFS
+#include "pm_master.h"
+#include "crf_apb.h"
+
+#ifndef ENABLE_PM
+#error "ERROR: APU DVFS governor requires PM to be enabled! Define ENABLE_PM"
+#endif
+
+#ifndef ENABLE_SCHEDULER
+#error "ERROR: APU DVFS governor requires scheduler to be enabled! Define ENABLE_SCHEDULER"
+#endif
+
+#define ACPU_DIVISOR_MAX	(CRF_APB_ACPU_CTRL_DIVISOR0_MASK >> \
+				 CRF_APB_ACPU_CTRL_DIVISOR0_SHIFT)
+
+static const XPfw_Module_t *DvfsModPtr;
+
+/*
+ * DIVISOR0 field values of the operating points, computed when the governor
+ * starts so that switching is a single read-modify-write of ACPU_CTRL.
+ * Index 0 is the clock the APU was running at (peak).
+ */
+static u32 DvfsOpDiv[XPFW_DVFS_OP_COUNT];
+static u32 DvfsOpIdx;
+
+/* Filtered and previous filtered load in percent */
+static u32 DvfsLoad;
+static u32 DvfsPrevLoad;
+static u32 DvfsDownCnt;
+static u8 DvfsActive;
+
+/****************************************************************************/
+/**
+ * @brief  Precompute DIVISOR0 values of the operating points from the APU
+ *         clock currently configured in ACPU_CTRL.
+ *
+ * @param  None.
+ *
+ * @return None.
+ *
+ * @note   Only the divisor is changed, APLL stays locked, so switching
+ *         between the operating points does not need a PLL relock.
+ *
+ ****************************************************************************/
+static void DvfsPrepareOps(void)
+{
+	u32 Div = (XPfw_Read32(CRF_APB_ACPU_CTRL) &
+		   CRF_APB_ACPU_CTRL_DIVISOR0_MASK) >>
+		  CRF_APB_ACPU_CTRL_DIVISOR0_SHIFT;
+	u32 OpDiv;
+	u32 Idx;
+
+	if (0U == Div) {
+		Div = 1U;
+	}
+
+	for (Idx = 0U; Idx < XPFW_DVFS_OP_COUNT; Idx++) {
+		OpDiv = Div * (Idx + 1U);
+		if (OpDiv > ACPU_DIVISOR_MAX) {
+			OpDiv = ACPU_DIVISOR_MAX;
+		}
+		DvfsOpDiv[Idx] = OpDiv << CRF_APB_ACPU_CTRL_DIVISOR0_SHIFT;
+	}
+	DvfsOpIdx = 0U;
+}
+
+static void DvfsSetOp(u32 Idx)
+{
+	XPfw_RMW32(CRF_APB_ACPU_CTRL, CRF_APB_ACPU_CTRL_DIVISOR0_MASK,
+		   DvfsOpDiv[Idx]);
+	DvfsOpIdx = Idx;
+}
+
+/****************************************************************************/
+/**
+ * @brief  Governor task, steps the APU operating point based on the load.
+ *
+ * @param  None.
+ *
+ * @return None.
+ *
+ * @note   The load is predicted from its trend, so a rising load reaches the
+ *         peak clock one period earlier. Stepping up goes directly to the
+ *         peak clock, stepping down goes one operating point at a time after
+ *         XPFW_DVFS_DOWN_SAMPLES periods of low load (hysteresis).
+ *
+ ****************************************************************************/
+static void DvfsGovernorTask(void)
+{
+	u32 Predicted = DvfsLoad;
+	u32 NextIdx = DvfsOpIdx;
+
+	if (false == PmMasterIsActive(&pmMasterApu_g)) {
+		goto done;
+	}
+
+	if (DvfsLoad > DvfsPrevLoad) {
+		Predicted += DvfsLoad - DvfsPrevLoad;
+	}
+	DvfsPrevLoad = DvfsLoad;
+
+	if (Predicted >= XPFW_DVFS_UP_THRESHOLD) {
+		DvfsDownCnt = 0U;
+		NextIdx = 0U;
+	} else if (DvfsLoad <= XPFW_DVFS_DOWN_THRESHOLD) {
+		DvfsDownCnt++;
+		if ((DvfsDownCnt >= XPFW_DVFS_DOWN_SAMPLES) &&
+		    (DvfsOpIdx < (XPFW_DVFS_OP_COUNT - 1U))) {
+			DvfsDownCnt = 0U;
+			NextIdx = DvfsOpIdx + 1U;
+		}
+	} else {
+		DvfsDownCnt = 0U;
+	}
+
+	if (NextIdx != DvfsOpIdx) {
+		DvfsSetOp(NextIdx);
+	}
+
+done:
+	return;
+}
+
+/****************************************************************************/
+/**
+ * @brief  Load hint from the APU, received through IOCTL call.
+ *
+ * @param  Load APU load in percent. First hint starts the governor, a value
+ *         above XPFW_DVFS_LOAD_MAX stops it and restores the peak clock.
+ *
+ * @return XST_SUCCESS if successful else XST_FAILURE
+ *
+ * @note   None.
+ *
+ ****************************************************************************/
+s32 ApuDvfsSetLoad(u32 Load)
+{
+	s32 Status = XST_SUCCESS;
+
+	if (Load > XPFW_DVFS_LOAD_MAX) {
+		if (0U != DvfsActive) {
+			DvfsSetOp(0U);
+			DvfsActive = 0U;
+			Status = XPfw_CoreRemoveTask(DvfsModPtr, XPFW_DVFS_PERIOD,
+						     DvfsGovernorTask);
+		}
+		goto done;
+	}
+
+	if (0U == DvfsActive) {
+		DvfsPrepareOps();
+		DvfsLoad = Load;
+		DvfsPrevLoad = Load;
+		DvfsDownCnt = 0U;
+		Status = XPfw_CoreScheduleTask(DvfsModPtr, XPFW_DVFS_PERIOD,
+					       DvfsGovernorTask);
+		if (XST_SUCCESS != Status) {
+			XPfw_Printf(DEBUG_ERROR,"DVFS (MOD-%d):Scheduling governor failed.\r\n",
+				    DvfsModPtr->ModId);
+			goto done;
+		}
+		DvfsActive = 1U;
+		goto done;
+	}
+
+	/* Exponential moving average, weight of the new hint is 1/4 */
+	DvfsLoad = ((3U * DvfsLoad) + Load) / 4U;
+
+done:
+	return Status;
+}
+
+/*
+ * Create a Mod and assign the Handlers. We will call this function
+ * from XPfw_UserStartup()
+ */
+void ModApuDvfsInit(void)
+{
+	DvfsModPtr = XPfw_CoreCreateMod();
+	if (NULL == DvfsModPtr) {
+		XPfw_Printf(DEBUG_ERROR,"DVFS: Module creation failed\r\n");
+	}
+}
+
+#else /* ENABLE_APU_DVFS */
+void ModApuDvfsInit(void) { }
+#endif /* ENABLE_APU_DVFS */
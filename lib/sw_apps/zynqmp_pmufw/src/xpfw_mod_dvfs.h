@@ -0,0 +1,45 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+#ifndef XPFW_MOD_DVFS_H_
+#define XPFW_MOD_DVFS_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "xpfw_config.h"
+#include "xil_types.h"
+
+/* Governor sampling period in ms */
+#ifndef XPFW_DVFS_PERIOD
+#define XPFW_DVFS_PERIOD		10U
+#endif
+
+/* Number of operating points, each one divides the peak APU clock further */
+#define XPFW_DVFS_OP_COUNT		4U
+
+/* Load thresholds in percent for stepping the operating point */
+#define XPFW_DVFS_UP_THRESHOLD		80U
+#define XPFW_DVFS_DOWN_THRESHOLD	30U
+
+/* Consecutive low load samples required before stepping down */
+#define XPFW_DVFS_DOWN_SAMPLES		5U
+
+/* Load hint value which stops the governor and restores the peak clock */
+#define XPFW_DVFS_LOAD_MAX		100U
+
+#ifdef ENABLE_APU_DVFS
+s32 ApuDvfsSetLoad(u32 Load);
+#endif
+
+void ModApuDvfsInit(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XPFW_MOD_DVFS_H_ */
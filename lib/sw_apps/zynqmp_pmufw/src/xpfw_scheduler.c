@@ -7,11 +7,11 @@
 #include "xpfw_scheduler.h"
 
 /**
- * PMU PIT Clock Frequency and Tick Calculation
+ * PMU PIT Clock Frequency
  */
 #define PMU_PIT_CLK_FREQ	XPFW_CFG_PMU_CLK_FREQ
-#define TICK_MILLISECONDS	10U
-#define COUNT_PER_TICK ((PMU_PIT_CLK_FREQ / 1000U)* TICK_MILLISECONDS )
+#define US_PER_SECOND		1000000U
+#define US_PER_MILLISECOND	1000U
 
 /**
  * Microblaze IOModule PIT Register Offsets
@@ -21,19 +21,36 @@
 #define PIT_COUNTER_OFFSET	4U
 #define PIT_CONTROL_OFFSET	8U
 
-static u32 is_task_active(XPfw_Scheduler_t *SchedPtr, u32 TaskListIndex)
+/**
+ * PIT Control values. PIT is used in one-shot mode and is loaded with the
+ * time to the earliest task deadline, so the PMU is not woken up by the
+ * scheduler when no task is due.
+ */
+#define PIT_CONTROL_STOP	0U
+#define PIT_CONTROL_ONE_SHOT	1U
+#define PIT_MAX_LOAD		0xFFFFFFFFU
+
+/**
+ * Disable interrupts while the PIT and the deadlines are updated, tasks can
+ * be added and removed both from interrupt handlers and from the main loop
+ */
+#define SCHED_LOCK(Msr)		{ (Msr) = mfmsr(); microblaze_disable_interrupts(); }
+#define SCHED_UNLOCK(Msr)	{ mtmsr(Msr); }
+
+static u64 XPfw_SchedulerUsToCount(u32 MicroSeconds)
+{
+	return ((u64)MicroSeconds * (u64)PMU_PIT_CLK_FREQ) / (u64)US_PER_SECOND;
+}
+
+static u32 is_task_pending(const XPfw_Scheduler_t *SchedPtr, u32 TaskListIndex)
 {
 	u32 ReturnVal;
 
-	/* Periodic */
-	if ((0U != SchedPtr->TaskList[TaskListIndex].Interval)
-		&& (NULL != SchedPtr->TaskList[TaskListIndex].Callback)
-		&& (0U == (SchedPtr->Tick
-				% SchedPtr->TaskList[TaskListIndex].Interval))) {
-		ReturnVal = (u32)TRUE;
-	} else if ((0U == SchedPtr->TaskList[TaskListIndex].Interval)
-			&& (NULL != SchedPtr->TaskList[TaskListIndex].Callback)) {
-		/* Non-Periodic */
+	/* Non-periodic tasks wait only for their first trigger */
+	if ((NULL != SchedPtr->TaskList[TaskListIndex].Callback)
+		&& ((0U != SchedPtr->TaskList[TaskListIndex].Interval)
+			|| (XPFW_TASK_STATUS_TRIGGERED !=
+				SchedPtr->TaskList[TaskListIndex].Status))) {
 		ReturnVal = (u32)TRUE;
 	} else {
 		ReturnVal = (u32)FALSE;
@@ -56,6 +73,69 @@ static u32 is_task_non_periodic(XPfw_Scheduler_t *SchedPtr, u32 TaskListIndex)
 	return ReturnVal;
 }
 
+/*
+ * Stop the PIT and account the time elapsed since it was loaded. Counter
+ * stays at zero once the one-shot PIT has expired.
+ */
+static u64 XPfw_SchedulerUpdateTime(XPfw_Scheduler_t *SchedPtr)
+{
+	u32 Count;
+
+	if (0U != SchedPtr->PitLoad) {
+		Count = XPfw_Read32(SchedPtr->PitBaseAddr + PIT_COUNTER_OFFSET);
+		XPfw_Write32(SchedPtr->PitBaseAddr + PIT_CONTROL_OFFSET,
+				PIT_CONTROL_STOP);
+		if (Count <= SchedPtr->PitLoad) {
+			SchedPtr->Time += (u64)(SchedPtr->PitLoad - Count);
+		}
+		SchedPtr->PitLoad = 0U;
+	}
+
+	return SchedPtr->Time;
+}
+
+/* Load the PIT with the time to the earliest pending deadline */
+static void XPfw_SchedulerArm(XPfw_Scheduler_t *SchedPtr)
+{
+	u32 Idx;
+	u64 Next = ~(u64)0U;
+	u64 Load;
+
+	if ((u32)TRUE != SchedPtr->Enabled) {
+		goto done;
+	}
+
+	for (Idx = 0U; Idx < XPFW_SCHED_MAX_TASK; Idx++) {
+		if (((u32)TRUE == is_task_pending(SchedPtr, Idx)) &&
+			(SchedPtr->TaskList[Idx].Deadline < Next)) {
+			Next = SchedPtr->TaskList[Idx].Deadline;
+		}
+	}
+
+	/* No task to wait for, keep the PIT stopped */
+	if (~(u64)0U == Next) {
+		goto done;
+	}
+
+	if (Next > SchedPtr->Time) {
+		Load = Next - SchedPtr->Time;
+	} else {
+		Load = 1U;
+	}
+	if (Load > (u64)PIT_MAX_LOAD) {
+		Load = (u64)PIT_MAX_LOAD;
+	}
+
+	SchedPtr->PitLoad = (u32)Load;
+	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_PRELOAD_OFFSET,
+			SchedPtr->PitLoad);
+	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_CONTROL_OFFSET,
+			PIT_CONTROL_ONE_SHOT);
+
+done:
+	return;
+}
+
 XStatus XPfw_SchedulerInit(XPfw_Scheduler_t *SchedPtr, u32 PitBaseAddr)
 {
 	u32 Idx;
@@ -71,12 +151,16 @@ XStatus XPfw_SchedulerInit(XPfw_Scheduler_t *SchedPtr, u32 PitBaseAddr)
 		SchedPtr->TaskList[Idx].Interval = 0U;
 		SchedPtr->TaskList[Idx].Callback = NULL;
 		SchedPtr->TaskList[Idx].Status = XPFW_TASK_STATUS_DISABLED;
+		SchedPtr->TaskList[Idx].Deadline = 0U;
 	}
 
 	SchedPtr->Enabled = (u32)FALSE;
 	SchedPtr->PitBaseAddr = PitBaseAddr;
 	SchedPtr->Tick = 0U;
-	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_CONTROL_OFFSET, 0U);
+	SchedPtr->PitLoad = 0U;
+	SchedPtr->Time = 0U;
+	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_CONTROL_OFFSET,
+			PIT_CONTROL_STOP);
 
 	/* Successfully completed init */
 	Status = XST_SUCCESS;
@@ -88,17 +172,17 @@ done:
 XStatus XPfw_SchedulerStart(XPfw_Scheduler_t *SchedPtr)
 {
 	XStatus Status;
+	u32 Msr;
 
 	if (SchedPtr == NULL) {
 		Status = XST_FAILURE;
 		goto done;
 	}
 
+	SCHED_LOCK(Msr);
 	SchedPtr->Enabled = (u32)TRUE;
-
-	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_PRELOAD_OFFSET,
-			COUNT_PER_TICK);
-	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_CONTROL_OFFSET, 3U);
+	XPfw_SchedulerArm(SchedPtr);
+	SCHED_UNLOCK(Msr);
 	Status = XST_SUCCESS;
 
 done:
@@ -107,10 +191,14 @@ done:
 
 XStatus XPfw_SchedulerStop(XPfw_Scheduler_t *SchedPtr)
 {
-	SchedPtr->Enabled = (u32)FALSE;
+	u32 Msr;
 
+	SCHED_LOCK(Msr);
+	SchedPtr->Enabled = (u32)FALSE;
+	(void)XPfw_SchedulerUpdateTime(SchedPtr);
 	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_PRELOAD_OFFSET, 0U );
 	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_CONTROL_OFFSET, 0U );
+	SCHED_UNLOCK(Msr);
 
 	return XST_SUCCESS;
 }
@@ -118,15 +206,32 @@ XStatus XPfw_SchedulerStop(XPfw_Scheduler_t *SchedPtr)
 void XPfw_SchedulerTickHandler(XPfw_Scheduler_t *SchedPtr)
 {
 	u32 Idx;
+	u64 Now;
+	u64 Interval;
+	struct XPfw_Task_t *TaskPtr;
 
 	SchedPtr->Tick++;
+	Now = XPfw_SchedulerUpdateTime(SchedPtr);
+
 	for (Idx = 0U; Idx < XPFW_SCHED_MAX_TASK; Idx++) {
+		TaskPtr = &SchedPtr->TaskList[Idx];
 		/* Check if it this task can be triggered */
-		if ((u32)TRUE == is_task_active(SchedPtr, Idx)) {
+		if (((u32)TRUE == is_task_pending(SchedPtr, Idx)) &&
+			(TaskPtr->Deadline <= Now)) {
 			/* Mark the Task as TRIGGERED */
-			SchedPtr->TaskList[Idx].Status = XPFW_TASK_STATUS_TRIGGERED;
+			TaskPtr->Status = XPFW_TASK_STATUS_TRIGGERED;
+			if (0U != TaskPtr->Interval) {
+				Interval = XPfw_SchedulerUsToCount(TaskPtr->Interval);
+				TaskPtr->Deadline += Interval;
+				/* Skip the periods which are already missed */
+				if (TaskPtr->Deadline <= Now) {
+					TaskPtr->Deadline = Now + Interval;
+				}
+			}
 		}
 	}
+
+	XPfw_SchedulerArm(SchedPtr);
 }
 
 void XPfw_SchedulerProcess(XPfw_Scheduler_t *SchedPtr)
@@ -152,9 +257,18 @@ void XPfw_SchedulerProcess(XPfw_Scheduler_t *SchedPtr)
 }
 
 XStatus XPfw_SchedulerAddTask(XPfw_Scheduler_t *SchedPtr, u32 OwnerId,u32 MilliSeconds, XPfw_Callback_t CallbackFn)
+{
+	return XPfw_SchedulerAddTaskUs(SchedPtr, OwnerId,
+			MilliSeconds * US_PER_MILLISECOND, CallbackFn);
+}
+
+XStatus XPfw_SchedulerAddTaskUs(XPfw_Scheduler_t *SchedPtr, u32 OwnerId,u32 MicroSeconds, XPfw_Callback_t CallbackFn)
 {
 	u32 Idx;
 	XStatus Status;
+	u32 Msr;
+
+	SCHED_LOCK(Msr);
 
 	/* Get the Next Free Task Index */
 	for (Idx=0U;Idx < XPFW_SCHED_MAX_TASK;Idx++) {
@@ -169,13 +283,22 @@ XStatus XPfw_SchedulerAddTask(XPfw_Scheduler_t *SchedPtr, u32 OwnerId,u32 MilliS
 		goto done;
 	}
 
-	/* Add Interval as a factor of TICK_MILLISECONDS */
-	SchedPtr->TaskList[Idx].Interval = MilliSeconds/TICK_MILLISECONDS;
+	/*
+	 * First trigger is one period from now, non-periodic task is
+	 * triggered right away
+	 */
+	SchedPtr->TaskList[Idx].Interval = MicroSeconds;
 	SchedPtr->TaskList[Idx].OwnerId = OwnerId;
+	SchedPtr->TaskList[Idx].Status = XPFW_TASK_STATUS_DISABLED;
+	SchedPtr->TaskList[Idx].Deadline =
+			XPfw_SchedulerUpdateTime(SchedPtr) +
+			XPfw_SchedulerUsToCount(MicroSeconds);
 	SchedPtr->TaskList[Idx].Callback = CallbackFn;
+	XPfw_SchedulerArm(SchedPtr);
 	Status = XST_SUCCESS;
 
 done:
+	SCHED_UNLOCK(Msr);
 	return Status;
 }
 
@@ -183,12 +306,16 @@ XStatus XPfw_SchedulerRemoveTask(XPfw_Scheduler_t *SchedPtr, u32 OwnerId, u32 Mi
 {
 	u32 Idx;
 	u32 TaskCount = 0U;
+	u32 Msr;
+
+	SCHED_LOCK(Msr);
 
 	/*Find the Task Index */
 	for (Idx = 0U; Idx < XPFW_SCHED_MAX_TASK; Idx++) {
 		if ((CallbackFn == SchedPtr->TaskList[Idx].Callback) &&
 		    (SchedPtr->TaskList[Idx].OwnerId == OwnerId) &&
-		    ((SchedPtr->TaskList[Idx].Interval == (MilliSeconds/TICK_MILLISECONDS)) ||
+		    ((SchedPtr->TaskList[Idx].Interval ==
+				(MilliSeconds * US_PER_MILLISECOND)) ||
 				(0U == MilliSeconds))) {
 			SchedPtr->TaskList[Idx].Interval = 0U;
 			SchedPtr->TaskList[Idx].OwnerId = 0U;
@@ -197,6 +324,14 @@ XStatus XPfw_SchedulerRemoveTask(XPfw_Scheduler_t *SchedPtr, u32 OwnerId, u32 Mi
 		}
 	}
 
+	/* Earliest deadline may have changed */
+	if (TaskCount > 0U) {
+		(void)XPfw_SchedulerUpdateTime(SchedPtr);
+		XPfw_SchedulerArm(SchedPtr);
+	}
+
+	SCHED_UNLOCK(Msr);
+
 	XPfw_Printf(DEBUG_DETAILED,"%s: Removed %lu tasks\r\n",
 			__func__, TaskCount);
 
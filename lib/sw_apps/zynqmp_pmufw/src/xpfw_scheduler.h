@@ -22,17 +22,20 @@ extern "C" {
 typedef void (*XPfw_Callback_t) (void);
 
 struct XPfw_Task_t{
-	u32 Interval;
+	u32 Interval;	/* Period in microseconds, 0 for non-periodic task */
 	u32 OwnerId;
 	u32 Status;
 	XPfw_Callback_t Callback;
+	u64 Deadline;	/* Scheduler time of next trigger in PIT counts */
 };
 
 typedef struct {
 	struct XPfw_Task_t TaskList[XPFW_SCHED_MAX_TASK];
 	u32 PitBaseAddr;
-	u32 Tick;
+	u32 Tick;	/* Number of PIT expiries */
 	u32 Enabled;
+	u32 PitLoad;	/* Counts loaded in the one-shot PIT, 0 if stopped */
+	u64 Time;	/* Scheduler time in PIT counts when PIT was loaded */
 } XPfw_Scheduler_t ;
 
 void XPfw_SchedulerTickHandler(XPfw_Scheduler_t *SchedPtr);
@@ -41,6 +44,7 @@ XStatus XPfw_SchedulerStart(XPfw_Scheduler_t *SchedPtr);
 XStatus XPfw_SchedulerStop(XPfw_Scheduler_t *SchedPtr);
 void XPfw_SchedulerProcess(XPfw_Scheduler_t *SchedPtr);
 XStatus XPfw_SchedulerAddTask(XPfw_Scheduler_t *SchedPtr, u32 OwnerId,u32 MilliSeconds, XPfw_Callback_t CallbackFn);
+XStatus XPfw_SchedulerAddTaskUs(XPfw_Scheduler_t *SchedPtr, u32 OwnerId,u32 MicroSeconds, XPfw_Callback_t CallbackFn);
 XStatus XPfw_SchedulerRemoveTask(XPfw_Scheduler_t *SchedPtr, u32 OwnerId, u32 MilliSeconds, XPfw_Callback_t CallbackFn);
 
 #ifdef __cplusplus
@@ -26,6 +26,7 @@
 #include "xpfw_mod_rpu.h"
 #include "xpfw_mod_extwdt.h"
 #include "xpfw_mod_overtemp.h"
+#include "xpfw_mod_dvfs.h"
 
 #if defined (XPAR_LPD_IS_CACHE_COHERENT) || defined (XPAR_FPD_IS_CACHE_COHERENT) || defined (XPAR_PL_IS_CACHE_COHERENT)
 /*****************************************************************************
@@ -81,4 +82,5 @@ void XPfw_UserStartUp(void)
 #ifndef ENABLE_RUNTIME_OVERTEMP
 	ModOverTempInit();
 #endif
+	ModApuDvfsInit();
 }
@@ -0,0 +1,60 @@
+###############################################################################
+# Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+# SPDX-License-Identifier: MIT
+##############################################################################
+# Modification History
+#
+# Ver   Who  Date     Changes
+# ----- ---- -------- -----------------------------------------------
+# 1.0   ag   10/14/26 Initial Release
+##############################################################################
+
+#---------------------------------------------
+# dmaengine_drc
+#---------------------------------------------
+proc dmaengine_drc {libhandle} {
+	# at least one of the supported DMA engines must be in the design
+	set dmas [hsi::get_cells -hier -filter {IP_NAME=="axi_dma" || IP_NAME=="axi_mcdma" || IP_NAME=="axi_cdma" || IP_NAME=="psu_gdma" || IP_NAME=="psu_adma" || IP_NAME=="psv_gdma" || IP_NAME=="psv_adma" || IP_NAME=="psu_csudma" || IP_NAME=="psv_pmc_dma" || IP_NAME=="ps7_dma"}]
+	if {[llength $dmas] == 0} {
+		error "ERROR: xildmaengine library requires a DMA engine in the design" "" "mdt_error"
+	}
+}
+
+proc generate {libhandle} {
+
+}
+
+
+#-------
+# post_generate: called after generate called on all libraries
+#-------
+proc post_generate {libhandle} {
+	xgen_opts_file $libhandle
+}
+
+#-------
+# execs_generate: called after BSP's, libraries and drivers have been compiled
+#-------
+proc execs_generate {libhandle} {
+
+}
+
+proc xgen_opts_file {libhandle} {
+
+	# Copy the include files to the include directory
+	set srcdir src
+	set dstdir [file join .. .. include]
+
+	# Create dstdir if it does not exist
+	if { ! [file exists $dstdir] } {
+		file mkdir $dstdir
+	}
+
+	# Get list of files in the srcdir
+	set sources [glob -join $srcdir *.h]
+
+	# Copy each of the files in the list to dstdir
+	foreach source $sources {
+		file copy -force $source $dstdir
+	}
+}
@@ -0,0 +1,708 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xdmaengine.c
+ * @addtogroup xildmaengine Overview
+ * @{
+ * @details
+ *
+ * This file contains the engine registry, the channel allocation and the
+ * transaction queue of the XilDmaEngine library. The engine specific parts
+ * are in xdmaengine_<engine>.c.
+ *
+ * Each channel keeps its submitted transactions in a list, oldest first.
+ * The backend Start operation passes segments to hardware and accounts for
+ * them in completion units, BDs or segments depending on the engine. The
+ * backend reports completed units with XDmaEngine_Complete(), and a
+ * transaction is done once every unit of every segment has completed, or
+ * an error occurred and nothing of it is left in hardware.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   ag   10/14/26 First release
+ * </pre>
+ *
+ *****************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xdmaengine.h"
+#include "xil_cache.h"
+
+/************************** Function Prototypes ******************************/
+static void XDmaEngine_Span(const XDmaEngine_Txn *Txn, u32 Index,
+			    UINTPTR *SrcPtr, UINTPTR *DstPtr, u32 *LenPtr);
+static void XDmaEngine_CachePre(XDmaEngine_Txn *Txn);
+static void XDmaEngine_CachePost(XDmaEngine_Txn *Txn);
+static u32 XDmaEngine_Load(const XDmaEngine *Engine);
+static u32 XDmaEngine_IsDone(const XDmaEngine_Txn *Txn);
+static u32 XDmaEngine_Reap(XDmaEngine_Chan *Chan);
+static void XDmaEngine_Kick(XDmaEngine_Chan *Chan);
+
+/************************** Variable Definitions *****************************/
+static XDmaEngine *XDmaEngine_List;
+
+/*****************************************************************************/
+/**
+ * This function registers an engine with the library. It is called by the
+ * bind functions of the engines once the channels are set up.
+ *
+ * @param Engine is the engine to register.
+ *
+ * @return
+ *	- XST_SUCCESS if the engine is registered
+ *	- XST_INVALID_PARAM if the engine has no operations or too many
+ *	  channels
+ *
+ ****************************************************************************/
+s32 XDmaEngine_Register(XDmaEngine *Engine)
+{
+	XDmaEngine_Chan *Chan;
+	u32 Index;
+
+	Xil_AssertNonvoid(Engine != NULL);
+
+	if ((Engine->Ops == NULL) || (Engine->Ops->Start == NULL) ||
+	    (Engine->NumChans > XDMAENGINE_MAX_CHANS)) {
+		return (s32)XST_INVALID_PARAM;
+	}
+
+	for (Index = 0U; Index < Engine->NumChans; Index++) {
+		Chan = &Engine->Chans[Index];
+		Chan->Engine = Engine;
+		Chan->InUse = 0U;
+		Chan->Pending = 0U;
+		Chan->Head = NULL;
+		Chan->Tail = NULL;
+	}
+
+	Engine->Next = XDmaEngine_List;
+	XDmaEngine_List = Engine;
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function removes an engine from the library. Its channels must be
+ * released first.
+ *
+ * @param Engine is the engine to remove.
+ *
+ * @return None
+ *
+ ****************************************************************************/
+void XDmaEngine_Unregister(XDmaEngine *Engine)
+{
+	XDmaEngine **LinkPtr = &XDmaEngine_List;
+
+	Xil_AssertVoid(Engine != NULL);
+
+	while (*LinkPtr != NULL) {
+		if (*LinkPtr == Engine) {
+			*LinkPtr = Engine->Next;
+			break;
+		}
+		LinkPtr = &(*LinkPtr)->Next;
+	}
+}
+
+/*****************************************************************************/
+/**
+ * This function hands out a free channel with the given direction and
+ * capabilities. When several engines have one, the channel of the engine
+ * with the fewest bytes outstanding is taken.
+ *
+ * @param Direction is XDMAENGINE_MEM_TO_MEM, XDMAENGINE_MEM_TO_DEV or
+ *	  XDMAENGINE_DEV_TO_MEM.
+ * @param Caps is the set of XDMAENGINE_CAP_* flags the channel must have.
+ *
+ * @return The channel, or NULL if no free channel matches.
+ *
+ ****************************************************************************/
+XDmaEngine_Chan *XDmaEngine_RequestChan(u32 Direction, u32 Caps)
+{
+	XDmaEngine *Engine;
+	XDmaEngine_Chan *Chan;
+	XDmaEngine_Chan *Best = NULL;
+	u32 BestLoad = 0U;
+	u32 Load;
+	u32 Index;
+
+	for (Engine = XDmaEngine_List; Engine != NULL; Engine = Engine->Next) {
+		Load = XDmaEngine_Load(Engine);
+		if ((Best != NULL) && (Load >= BestLoad)) {
+			continue;
+		}
+
+		for (Index = 0U; Index < Engine->NumChans; Index++) {
+			Chan = &Engine->Chans[Index];
+			if ((Chan->InUse == 0U) &&
+			    (Chan->Direction == Direction) &&
+			    ((Chan->Caps & Caps) == Caps)) {
+				Best = Chan;
+				BestLoad = Load;
+				break;
+			}
+		}
+	}
+
+	if (Best != NULL) {
+		Best->InUse = 1U;
+	}
+
+	return Best;
+}
+
+/*****************************************************************************/
+/**
+ * This function hands out a given channel of an engine.
+ *
+ * @param Engine is the engine.
+ * @param Index is the channel index, in the order listed by the bind
+ *	  function of the engine.
+ *
+ * @return The channel, or NULL if it does not exist or is in use.
+ *
+ ****************************************************************************/
+XDmaEngine_Chan *XDmaEngine_RequestEngineChan(XDmaEngine *Engine, u32 Index)
+{
+	XDmaEngine_Chan *Chan;
+
+	Xil_AssertNonvoid(Engine != NULL);
+
+	if (Index >= Engine->NumChans) {
+		return NULL;
+	}
+
+	Chan = &Engine->Chans[Index];
+	if (Chan->InUse != 0U) {
+		return NULL;
+	}
+	Chan->InUse = 1U;
+
+	return Chan;
+}
+
+/*****************************************************************************/
+/**
+ * This function releases a channel handed out by XDmaEngine_RequestChan()
+ * or XDmaEngine_RequestEngineChan(). No transaction may be outstanding.
+ *
+ * @param Chan is the channel.
+ *
+ * @return None
+ *
+ ****************************************************************************/
+void XDmaEngine_ReleaseChan(XDmaEngine_Chan *Chan)
+{
+	Xil_AssertVoid(Chan != NULL);
+	Xil_AssertVoid(Chan->Head == NULL);
+
+	Chan->InUse = 0U;
+}
+
+/*****************************************************************************/
+/**
+ * This function prepares a scatter gather transaction.
+ *
+ * @param Chan is the channel.
+ * @param Txn is the transaction to prepare.
+ * @param Sg is the list of segments, it must stay valid until the
+ *	  transaction completes.
+ * @param NumSg is the number of segments.
+ * @param Flags is a set of XDMAENGINE_FLAG_SRC_KEYHOLE,
+ *	  XDMAENGINE_FLAG_DST_KEYHOLE and XDMAENGINE_FLAG_NO_CACHE.
+ *
+ * @return
+ *	- XST_SUCCESS if the transaction is prepared
+ *	- XST_INVALID_PARAM if a segment is empty or the total length does
+ *	  not fit in 32 bits, or the engine rejects a segment
+ *	- XST_NO_FEATURE if the channel does not support keyhole transfers
+ *
+ ****************************************************************************/
+s32 XDmaEngine_PrepSg(XDmaEngine_Chan *Chan, XDmaEngine_Txn *Txn,
+		      const XDmaEngine_Sg *Sg, u32 NumSg, u32 Flags)
+{
+	u64 Bytes = 0U;
+	u32 Index;
+
+	Xil_AssertNonvoid(Chan != NULL);
+	Xil_AssertNonvoid(Txn != NULL);
+	Xil_AssertNonvoid(Sg != NULL);
+
+	Flags &= ~XDMAENGINE_FLAG_2D;
+	if (((Flags & (XDMAENGINE_FLAG_SRC_KEYHOLE |
+		       XDMAENGINE_FLAG_DST_KEYHOLE)) != 0U) &&
+	    ((Chan->Caps & XDMAENGINE_CAP_KEYHOLE) == 0U)) {
+		return (s32)XST_NO_FEATURE;
+	}
+
+	if (NumSg == 0U) {
+		return (s32)XST_INVALID_PARAM;
+	}
+
+	for (Index = 0U; Index < NumSg; Index++) {
+		if (Sg[Index].Length == 0U) {
+			return (s32)XST_INVALID_PARAM;
+		}
+		Bytes += Sg[Index].Length;
+	}
+
+	if (Bytes > 0xFFFFFFFFU) {
+		return (s32)XST_INVALID_PARAM;
+	}
+
+	Txn->Chan = Chan;
+	Txn->Sg = Sg;
+	Txn->NumSg = NumSg;
+	Txn->Flags = Flags;
+	Txn->Bytes = (u32)Bytes;
+
+	if (Chan->Engine->Ops->Prep != NULL) {
+		return Chan->Engine->Ops->Prep(Chan, Txn);
+	}
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function prepares a 2D transaction of Shape->Height lines of
+ * Shape->Width bytes.
+ *
+ * @param Chan is the channel, it must have XDMAENGINE_CAP_2D.
+ * @param Txn is the transaction to prepare.
+ * @param SrcAddr is the address of the first source line.
+ * @param DstAddr is the address of the first destination line.
+ * @param Shape is the shape of the transaction, it is copied.
+ * @param Flags is 0 or XDMAENGINE_FLAG_NO_CACHE.
+ *
+ * @return
+ *	- XST_SUCCESS if the transaction is prepared
+ *	- XST_INVALID_PARAM if the shape is empty or too large, or the
+ *	  engine rejects it
+ *	- XST_NO_FEATURE if the channel does not support 2D transactions
+ *
+ ****************************************************************************/
+s32 XDmaEngine_Prep2D(XDmaEngine_Chan *Chan, XDmaEngine_Txn *Txn,
+		      UINTPTR SrcAddr, UINTPTR DstAddr,
+		      const XDmaEngine_2D *Shape, u32 Flags)
+{
+	u64 Bytes;
+
+	Xil_AssertNonvoid(Chan != NULL);
+	Xil_AssertNonvoid(Txn != NULL);
+	Xil_AssertNonvoid(Shape != NULL);
+
+	if ((Chan->Caps & XDMAENGINE_CAP_2D) == 0U) {
+		return (s32)XST_NO_FEATURE;
+	}
+
+	Bytes = (u64)Shape->Width * Shape->Height;
+	if ((Bytes == 0U) || (Bytes > 0xFFFFFFFFU)) {
+		return (s32)XST_INVALID_PARAM;
+	}
+
+	Txn->Chan = Chan;
+	Txn->Seg2D.SrcAddr = SrcAddr;
+	Txn->Seg2D.DstAddr = DstAddr;
+	Txn->Seg2D.Length = Shape->Width;
+	Txn->Shape = *Shape;
+	Txn->Sg = &Txn->Seg2D;
+	Txn->NumSg = 1U;
+	Txn->Flags = (Flags & XDMAENGINE_FLAG_NO_CACHE) | XDMAENGINE_FLAG_2D;
+	Txn->Bytes = (u32)Bytes;
+
+	if (Chan->Engine->Ops->Prep != NULL) {
+		return Chan->Engine->Ops->Prep(Chan, Txn);
+	}
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function submits a prepared transaction. It is passed to hardware
+ * right away if the engine has room, and queued on the channel otherwise.
+ *
+ * @param Txn is the prepared transaction.
+ * @param Callback is called when the transaction completes, it can be
+ *	  NULL.
+ * @param CallBackRef is passed to Callback.
+ *
+ * @return XST_SUCCESS. Errors of the engine are reported to Callback.
+ *
+ * @note The callback can run before this function returns.
+ *
+ ****************************************************************************/
+s32 XDmaEngine_Submit(XDmaEngine_Txn *Txn, XDmaEngine_Callback Callback,
+		      void *CallBackRef)
+{
+	XDmaEngine_Chan *Chan;
+
+	Xil_AssertNonvoid(Txn != NULL);
+	Xil_AssertNonvoid(Txn->Chan != NULL);
+
+	Chan = Txn->Chan;
+
+	Txn->Callback = Callback;
+	Txn->CallBackRef = CallBackRef;
+	Txn->Issued = 0U;
+	Txn->Units = 0U;
+	Txn->UnitsDone = 0U;
+	Txn->Status = (s32)XST_SUCCESS;
+	Txn->Next = NULL;
+
+	XDmaEngine_CachePre(Txn);
+
+	if (Chan->Tail != NULL) {
+		Chan->Tail->Next = Txn;
+	} else {
+		Chan->Head = Txn;
+	}
+	Chan->Tail = Txn;
+	Chan->Pending += Txn->Bytes;
+
+	XDmaEngine_Kick(Chan);
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function collects the completions of a channel of a polled engine.
+ * Call it from the interrupt handler of the engine, or periodically. It
+ * does nothing for interrupt driven engines.
+ *
+ * @param Chan is the channel.
+ *
+ * @return None
+ *
+ ****************************************************************************/
+void XDmaEngine_Poll(XDmaEngine_Chan *Chan)
+{
+	Xil_AssertVoid(Chan != NULL);
+
+	if (Chan->Engine->Ops->Poll != NULL) {
+		Chan->Engine->Ops->Poll(Chan);
+	}
+}
+
+/*****************************************************************************/
+/**
+ * This function returns the channel with the fewest bytes outstanding out
+ * of a set of channels, for example channels of different engines that can
+ * all serve a data path.
+ *
+ * @param Chans is the set of channels.
+ * @param NumChans is the number of channels in the set.
+ *
+ * @return The least loaded channel, or NULL if NumChans is 0.
+ *
+ ****************************************************************************/
+XDmaEngine_Chan *XDmaEngine_LeastLoaded(XDmaEngine_Chan **Chans, u32 NumChans)
+{
+	XDmaEngine_Chan *Best = NULL;
+	u32 Index;
+
+	Xil_AssertNonvoid(Chans != NULL);
+
+	for (Index = 0U; Index < NumChans; Index++) {
+		if ((Best == NULL) || (Chans[Index]->Pending < Best->Pending)) {
+			Best = Chans[Index];
+		}
+	}
+
+	return Best;
+}
+
+/*****************************************************************************/
+/**
+ * This function is called by engine backends to report completed units.
+ *
+ * @param Chan is the channel.
+ * @param Txn is the transaction the units belong to, or NULL to credit
+ *	  them to the oldest transactions in submission order.
+ * @param Units is the number of completed units.
+ * @param Status is XST_SUCCESS, or the error of the units.
+ *
+ * @return None
+ *
+ ****************************************************************************/
+void XDmaEngine_Complete(XDmaEngine_Chan *Chan, XDmaEngine_Txn *Txn,
+			 u32 Units, s32 Status)
+{
+	XDmaEngine_Txn *Cur;
+	u32 Count;
+
+	if (Txn != NULL) {
+		Txn->UnitsDone += Units;
+		if ((Status != (s32)XST_SUCCESS) &&
+		    (Txn->Status == (s32)XST_SUCCESS)) {
+			Txn->Status = Status;
+		}
+	} else {
+		for (Cur = Chan->Head; (Cur != NULL) && (Units != 0U);
+		     Cur = Cur->Next) {
+			Count = Cur->Units - Cur->UnitsDone;
+			if (Count > Units) {
+				Count = Units;
+			}
+			Cur->UnitsDone += Count;
+			Units -= Count;
+			if ((Status != (s32)XST_SUCCESS) &&
+			    (Cur->Status == (s32)XST_SUCCESS)) {
+				Cur->Status = Status;
+			}
+		}
+	}
+
+	(void)XDmaEngine_Reap(Chan);
+	XDmaEngine_Kick(Chan);
+}
+
+/*****************************************************************************/
+/**
+ * This function returns the span of one segment of a transaction. For a 2D
+ * transaction the span covers every line.
+ *
+ * @param Txn is the transaction.
+ * @param Index is the segment.
+ * @param SrcPtr is set to the source address.
+ * @param DstPtr is set to the destination address.
+ * @param LenPtr is set to the length of the span.
+ *
+ * @return None
+ *
+ ****************************************************************************/
+static void XDmaEngine_Span(const XDmaEngine_Txn *Txn, u32 Index,
+			    UINTPTR *SrcPtr, UINTPTR *DstPtr, u32 *LenPtr)
+{
+	*SrcPtr = Txn->Sg[Index].SrcAddr;
+	*DstPtr = Txn->Sg[Index].DstAddr;
+	*LenPtr = Txn->Sg[Index].Length;
+}
+
+/*****************************************************************************/
+/**
+ * This function flushes the memory buffers of a transaction before it is
+ * submitted.
+ *
+ * @param Txn is the transaction.
+ *
+ * @return None
+ *
+ ****************************************************************************/
+static void XDmaEngine_CachePre(XDmaEngine_Txn *Txn)
+{
+	u32 Direction = Txn->Chan->Direction;
+	UINTPTR Src;
+	UINTPTR Dst;
+	u32 SrcLen;
+	u32 DstLen;
+	u32 Index;
+
+	if (((Txn->Chan->Caps & XDMAENGINE_CAP_COHERENT) != 0U) ||
+	    ((Txn->Flags & XDMAENGINE_FLAG_NO_CACHE) != 0U)) {
+		return;
+	}
+
+	for (Index = 0U; Index < Txn->NumSg; Index++) {
+		XDmaEngine_Span(Txn, Index, &Src, &Dst, &SrcLen);
+		DstLen = SrcLen;
+		if ((Txn->Flags & XDMAENGINE_FLAG_2D) != 0U) {
+			SrcLen += (Txn->Shape.Height - 1U) * Txn->Shape.SrcStride;
+			DstLen += (Txn->Shape.Height - 1U) * Txn->Shape.DstStride;
+		}
+
+		if ((Direction != XDMAENGINE_DEV_TO_MEM) &&
+		    ((Txn->Flags & XDMAENGINE_FLAG_SRC_KEYHOLE) == 0U)) {
+			Xil_DCacheFlushRange((INTPTR)Src, (INTPTR)SrcLen);
+		}
+		if ((Direction != XDMAENGINE_MEM_TO_DEV) &&
+		    ((Txn->Flags & XDMAENGINE_FLAG_DST_KEYHOLE) == 0U)) {
+			Xil_DCacheFlushRange((INTPTR)Dst, (INTPTR)DstLen);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+ * This function invalidates the destination buffers of a completed
+ * transaction, dropping lines the processor fetched speculatively while the
+ * engine was writing.
+ *
+ * @param Txn is the transaction.
+ *
+ * @return None
+ *
+ ****************************************************************************/
+static void XDmaEngine_CachePost(XDmaEngine_Txn *Txn)
+{
+	UINTPTR Src;
+	UINTPTR Dst;
+	u32 Len;
+	u32 Index;
+
+	if (((Txn->Chan->Caps & XDMAENGINE_CAP_COHERENT) != 0U) ||
+	    ((Txn->Flags & (XDMAENGINE_FLAG_NO_CACHE |
+			    XDMAENGINE_FLAG_DST_KEYHOLE)) != 0U) ||
+	    (Txn->Chan->Direction == XDMAENGINE_MEM_TO_DEV)) {
+		return;
+	}
+
+	for (Index = 0U; Index < Txn->NumSg; Index++) {
+		XDmaEngine_Span(Txn, Index, &Src, &Dst, &Len);
+		if ((Txn->Flags & XDMAENGINE_FLAG_2D) != 0U) {
+			Len += (Txn->Shape.Height - 1U) * Txn->Shape.DstStride;
+		}
+		Xil_DCacheInvalidateRange((INTPTR)Dst, (INTPTR)Len);
+	}
+}
+
+/*****************************************************************************/
+/**
+ * This function returns the bytes outstanding on all channels of an engine.
+ *
+ * @param Engine is the engine.
+ *
+ * @return The outstanding bytes.
+ *
+ ****************************************************************************/
+static u32 XDmaEngine_Load(const XDmaEngine *Engine)
+{
+	u32 Load = 0U;
+	u32 Index;
+
+	for (Index = 0U; Index < Engine->NumChans; Index++) {
+		Load += Engine->Chans[Index].Pending;
+	}
+
+	return Load;
+}
+
+/*****************************************************************************/
+/**
+ * This function tells whether a transaction is done. It is done when all
+ * its segments completed, or when it failed and none of its segments is
+ * left in hardware.
+ *
+ * @param Txn is the transaction.
+ *
+ * @return 1 if the transaction is done, 0 otherwise.
+ *
+ ****************************************************************************/
+static u32 XDmaEngine_IsDone(const XDmaEngine_Txn *Txn)
+{
+	if (Txn->UnitsDone != Txn->Units) {
+		return 0U;
+	}
+
+	return ((Txn->Issued == Txn->NumSg) ||
+		(Txn->Status != (s32)XST_SUCCESS)) ? 1U : 0U;
+}
+
+/*****************************************************************************/
+/**
+ * This function removes the done transactions of a channel and calls their
+ * callbacks. The list is walked again from the start after each callback,
+ * since a callback may submit new transactions.
+ *
+ * @param Chan is the channel.
+ *
+ * @return The number of transactions removed.
+ *
+ ****************************************************************************/
+static u32 XDmaEngine_Reap(XDmaEngine_Chan *Chan)
+{
+	XDmaEngine_Txn *Prev;
+	XDmaEngine_Txn *Txn;
+	u32 Count = 0U;
+
+Restart:
+	Prev = NULL;
+	for (Txn = Chan->Head; Txn != NULL; Txn = Txn->Next) {
+		if (XDmaEngine_IsDone(Txn) != 0U) {
+			if (Prev != NULL) {
+				Prev->Next = Txn->Next;
+			} else {
+				Chan->Head = Txn->Next;
+			}
+			if (Chan->Tail == Txn) {
+				Chan->Tail = Prev;
+			}
+			Chan->Pending -= Txn->Bytes;
+			Txn->Next = NULL;
+			Count++;
+
+			XDmaEngine_CachePost(Txn);
+			if (Txn->Callback != NULL) {
+				Txn->Callback(Txn->CallBackRef, Txn->Status);
+			}
+			goto Restart;
+		}
+		Prev = Txn;
+	}
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+ * This function passes queued segments of a channel to hardware, as far as
+ * the engine has room. Serial engines only get the next segment of the
+ * oldest transaction, once its previous segment completed.
+ *
+ * @param Chan is the channel.
+ *
+ * @return None
+ *
+ ****************************************************************************/
+static void XDmaEngine_Kick(XDmaEngine_Chan *Chan)
+{
+	const XDmaEngine_Ops *Ops = Chan->Engine->Ops;
+	XDmaEngine_Txn *Txn;
+	s32 Status;
+	u32 Failed;
+
+	do {
+		Failed = 0U;
+
+		for (Txn = Chan->Head; Txn != NULL; Txn = Txn->Next) {
+			if ((Txn->Issued == Txn->NumSg) ||
+			    (Txn->Status != (s32)XST_SUCCESS)) {
+				if (Ops->Serial != 0U) {
+					break;
+				}
+				continue;
+			}
+
+			if ((Ops->Serial != 0U) &&
+			    (Txn->UnitsDone != Txn->Units)) {
+				break;
+			}
+
+			Status = Ops->Start(Chan, Txn);
+			if (Status == (s32)XST_DEVICE_BUSY) {
+				break;
+			}
+			if (Status != (s32)XST_SUCCESS) {
+				Txn->Status = Status;
+				Failed = 1U;
+			}
+			if ((Ops->Serial != 0U) ||
+			    (Txn->Issued != Txn->NumSg)) {
+				break;
+			}
+		}
+	} while ((Failed != 0U) && (XDmaEngine_Reap(Chan) != 0U));
+}
+/** @} */
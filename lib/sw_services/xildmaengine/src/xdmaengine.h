@@ -0,0 +1,317 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xdmaengine.h
+ * @addtogroup xildmaengine Overview
+ * @{
+ * @details
+ *
+ * The XilDmaEngine library provides one interface to the DMA engines of the
+ * AXI DMA, AXI MCDMA, AXI CDMA, ZDMA, CSU DMA and PS DMA (PL330) drivers, so
+ * that a data path can be moved from one engine to another without being
+ * rewritten.
+ *
+ * An engine is a driver instance bound to the library with the bind function
+ * of its driver, for example XDmaEngine_BindAxiDma(). Binding registers the
+ * channels of the engine together with their direction and capabilities.
+ *
+ * <b> Usage </b>
+ * - XDmaEngine_RequestChan() hands out a free channel with the requested
+ *   direction and capabilities, from the least loaded engine that has one.
+ * - XDmaEngine_PrepSg() or XDmaEngine_Prep2D() prepares a transaction on the
+ *   channel. The segment list must stay valid until the transaction
+ *   completes.
+ * - XDmaEngine_Submit() queues the transaction. The completion callback is
+ *   called once all segments are done, or an error occurred.
+ * - XDmaEngine_Poll() collects completions of polled engines and must be
+ *   called from the interrupt handler of the engine or a polling loop.
+ *   Engines whose driver owns the interrupt handler, AXI CDMA in scatter
+ *   gather mode and PS DMA, complete from that handler instead.
+ * - XDmaEngine_LeastLoaded() picks the channel with the fewest bytes
+ *   outstanding out of a set of channels, to spread transactions over
+ *   several engines.
+ *
+ * <b> Cache maintenance </b>
+ * Unless the engine is cache coherent or the transaction has the
+ * XDMAENGINE_FLAG_NO_CACHE flag, the memory buffers of a transaction are
+ * flushed when it is submitted and the destination buffers are invalidated
+ * again when it completes. Buffers of fixed address (keyhole) sides are not
+ * touched.
+ *
+ * <b> Concurrency </b>
+ * XDmaEngine_Submit() and the completion path of a channel must not preempt
+ * each other. Submit with the engine interrupt masked when the completion
+ * path runs from an interrupt handler. Completion callbacks may submit new
+ * transactions.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   ag   10/14/26 First release
+ * </pre>
+ *
+ *****************************************************************************/
+#ifndef XDMAENGINE_H
+#define XDMAENGINE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+#include "xil_assert.h"
+#include "xstatus.h"
+#include "xparameters.h"
+
+/************************** Constant Definitions *****************************/
+
+/**
+ * @name Transfer directions
+ * @{
+ */
+#define XDMAENGINE_MEM_TO_MEM		0U /**< Memory to memory copy */
+#define XDMAENGINE_MEM_TO_DEV		1U /**< Memory to stream */
+#define XDMAENGINE_DEV_TO_MEM		2U /**< Stream to memory */
+/*@}*/
+
+/**
+ * @name Channel capabilities
+ * @{
+ */
+#define XDMAENGINE_CAP_SG		0x1U /**< Segments of a transaction
+					       *  are queued to hardware as
+					       *  one chain */
+#define XDMAENGINE_CAP_2D		0x2U /**< 2D strided transactions */
+#define XDMAENGINE_CAP_KEYHOLE		0x4U /**< Fixed address source or
+					       *  destination */
+#define XDMAENGINE_CAP_COHERENT		0x8U /**< Cache coherent, no cache
+					       *  maintenance needed */
+/*@}*/
+
+/**
+ * @name Transaction flags
+ * @{
+ */
+#define XDMAENGINE_FLAG_SRC_KEYHOLE	0x1U /**< Source address is fixed */
+#define XDMAENGINE_FLAG_DST_KEYHOLE	0x2U /**< Destination address is
+					       *  fixed */
+#define XDMAENGINE_FLAG_NO_CACHE	0x4U /**< The caller does the cache
+					       *  maintenance */
+#define XDMAENGINE_FLAG_2D		0x8U /**< Set by XDmaEngine_Prep2D() */
+/*@}*/
+
+/**
+ * @name Engine types
+ * @{
+ */
+#define XDMAENGINE_TYPE_AXIDMA		0U /**< AXI DMA */
+#define XDMAENGINE_TYPE_MCDMA		1U /**< AXI MCDMA */
+#define XDMAENGINE_TYPE_AXICDMA		2U /**< AXI CDMA */
+#define XDMAENGINE_TYPE_ZDMA		3U /**< ZDMA */
+#define XDMAENGINE_TYPE_CSUDMA		4U /**< CSU DMA */
+#define XDMAENGINE_TYPE_DMAPS		5U /**< PS DMA (PL330) */
+/*@}*/
+
+/** Maximum number of channels of one engine */
+#ifndef XDMAENGINE_MAX_CHANS
+#define XDMAENGINE_MAX_CHANS		32U
+#endif
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * One segment of a transaction. SrcAddr is ignored for XDMAENGINE_DEV_TO_MEM
+ * channels and DstAddr for XDMAENGINE_MEM_TO_DEV channels.
+ */
+typedef struct {
+	UINTPTR SrcAddr;	/**< Source address */
+	UINTPTR DstAddr;	/**< Destination address */
+	u32 Length;		/**< Length in bytes */
+} XDmaEngine_Sg;
+
+/**
+ * Shape of a 2D transaction, Height lines of Width bytes.
+ */
+typedef struct {
+	u32 Width;		/**< Bytes per line */
+	u32 Height;		/**< Number of lines */
+	u32 SrcStride;		/**< Bytes between source lines */
+	u32 DstStride;		/**< Bytes between destination lines */
+} XDmaEngine_2D;
+
+/**
+ * Completion callback of a transaction.
+ *
+ * @param	CallBackRef is the reference passed to XDmaEngine_Submit().
+ * @param	Status is XST_SUCCESS, or the error reported by the engine.
+ */
+typedef void (*XDmaEngine_Callback) (void *CallBackRef, s32 Status);
+
+struct XDmaEngine_Chan;
+
+/**
+ * A transaction. It is owned by the library from XDmaEngine_Submit() until
+ * its callback is called.
+ */
+typedef struct XDmaEngine_Txn {
+	struct XDmaEngine_Chan *Chan;	/**< Channel of the transaction */
+	const XDmaEngine_Sg *Sg;	/**< Segments */
+	u32 NumSg;			/**< Number of segments */
+	XDmaEngine_Sg Seg2D;		/**< First line of a 2D transaction */
+	XDmaEngine_2D Shape;		/**< Shape of a 2D transaction */
+	u32 Flags;			/**< XDMAENGINE_FLAG_* */
+	u32 Bytes;			/**< Total length of the segments */
+	u32 Issued;			/**< Segments passed to hardware */
+	u32 Units;			/**< Completion units expected for the
+					  *  issued segments, BDs or
+					  *  segments, see the engine */
+	u32 UnitsDone;			/**< Completion units seen */
+	s32 Status;			/**< First error, or XST_SUCCESS */
+	XDmaEngine_Callback Callback;	/**< Completion callback */
+	void *CallBackRef;		/**< Passed to Callback */
+	struct XDmaEngine_Txn *Next;	/**< Next submitted transaction */
+} XDmaEngine_Txn;
+
+/**
+ * A channel of an engine.
+ */
+typedef struct XDmaEngine_Chan {
+	struct XDmaEngine *Engine;	/**< Engine of the channel */
+	u32 Direction;			/**< XDMAENGINE_MEM_TO_MEM, ... */
+	u32 Caps;			/**< XDMAENGINE_CAP_* */
+	u32 HwId;			/**< Channel number in the driver */
+	void *HwChan;			/**< Channel object of the driver */
+	u32 InUse;			/**< Handed out by RequestChan */
+	u32 Pending;			/**< Bytes submitted and not yet
+					  *  completed */
+	XDmaEngine_Txn *Head;		/**< Oldest submitted transaction */
+	XDmaEngine_Txn *Tail;		/**< Newest submitted transaction */
+} XDmaEngine_Chan;
+
+/**
+ * Operations an engine backend provides.
+ */
+typedef struct {
+	/** Checks a transaction before it is submitted, can be NULL */
+	s32 (*Prep) (XDmaEngine_Chan *Chan, XDmaEngine_Txn *Txn);
+	/**
+	 * Passes segments of Txn, from Txn->Issued on, to hardware and
+	 * advances Txn->Issued and Txn->Units. Returns XST_SUCCESS once
+	 * every segment is issued, XST_DEVICE_BUSY to be called again after
+	 * the next completion, or an error that fails the transaction.
+	 * Serial engines issue one segment per call.
+	 */
+	s32 (*Start) (XDmaEngine_Chan *Chan, XDmaEngine_Txn *Txn);
+	/** Collects completions, NULL for interrupt driven engines */
+	void (*Poll) (XDmaEngine_Chan *Chan);
+	/** Non-zero if only the oldest transaction may be in hardware */
+	u32 Serial;
+} XDmaEngine_Ops;
+
+/**
+ * An engine, the driver instance and the channels behind it.
+ */
+typedef struct XDmaEngine {
+	u32 Type;			/**< XDMAENGINE_TYPE_* */
+	void *InstancePtr;		/**< Driver instance */
+	const XDmaEngine_Ops *Ops;	/**< Backend operations */
+	XDmaEngine_Chan Chans[XDMAENGINE_MAX_CHANS]; /**< Channels */
+	u32 NumChans;			/**< Number of channels */
+	struct XDmaEngine *Next;	/**< Next registered engine */
+} XDmaEngine;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/*****************************************************************************/
+/**
+ * This macro returns the capabilities of a channel.
+ *
+ * @param	Chan is the channel.
+ *
+ * @return	XDMAENGINE_CAP_* flags of the channel.
+ *
+ * @note	C-style signature:
+ *		u32 XDmaEngine_GetCaps(XDmaEngine_Chan *Chan)
+ *
+ *****************************************************************************/
+#define XDmaEngine_GetCaps(Chan)	((Chan)->Caps)
+
+/*****************************************************************************/
+/**
+ * This macro returns the number of bytes submitted on a channel and not yet
+ * completed.
+ *
+ * @param	Chan is the channel.
+ *
+ * @return	Outstanding bytes of the channel.
+ *
+ * @note	C-style signature:
+ *		u32 XDmaEngine_Pending(XDmaEngine_Chan *Chan)
+ *
+ *****************************************************************************/
+#define XDmaEngine_Pending(Chan)	((Chan)->Pending)
+
+/************************** Function Prototypes ******************************/
+
+/* Channel and transaction functions, xdmaengine.c */
+XDmaEngine_Chan *XDmaEngine_RequestChan(u32 Direction, u32 Caps);
+XDmaEngine_Chan *XDmaEngine_RequestEngineChan(XDmaEngine *Engine,
+					      u32 Index);
+void XDmaEngine_ReleaseChan(XDmaEngine_Chan *Chan);
+s32 XDmaEngine_PrepSg(XDmaEngine_Chan *Chan, XDmaEngine_Txn *Txn,
+		      const XDmaEngine_Sg *Sg, u32 NumSg, u32 Flags);
+s32 XDmaEngine_Prep2D(XDmaEngine_Chan *Chan, XDmaEngine_Txn *Txn,
+		      UINTPTR SrcAddr, UINTPTR DstAddr,
+		      const XDmaEngine_2D *Shape, u32 Flags);
+s32 XDmaEngine_Submit(XDmaEngine_Txn *Txn, XDmaEngine_Callback Callback,
+		      void *CallBackRef);
+void XDmaEngine_Poll(XDmaEngine_Chan *Chan);
+XDmaEngine_Chan *XDmaEngine_LeastLoaded(XDmaEngine_Chan **Chans,
+					u32 NumChans);
+
+/* Backend functions, xdmaengine.c */
+s32 XDmaEngine_Register(XDmaEngine *Engine);
+void XDmaEngine_Unregister(XDmaEngine *Engine);
+void XDmaEngine_Complete(XDmaEngine_Chan *Chan, XDmaEngine_Txn *Txn,
+			 u32 Units, s32 Status);
+
+/* Engine bind functions, xdmaengine_<engine>.c */
+#ifdef XPAR_XAXIDMA_NUM_INSTANCES
+#include "xaxidma.h"
+s32 XDmaEngine_BindAxiDma(XDmaEngine *Engine, XAxiDma *InstancePtr);
+#endif
+#ifdef XPAR_XMCDMA_NUM_INSTANCES
+#include "xmcdma.h"
+s32 XDmaEngine_BindMcdma(XDmaEngine *Engine, XMcdma *InstancePtr);
+#endif
+#ifdef XPAR_XAXICDMA_NUM_INSTANCES
+#include "xaxicdma.h"
+s32 XDmaEngine_BindAxiCdma(XDmaEngine *Engine, XAxiCdma *InstancePtr);
+#endif
+#ifdef XPAR_XZDMA_NUM_INSTANCES
+#include "xzdma.h"
+s32 XDmaEngine_BindZDma(XDmaEngine *Engine, XZDma_Queue *QueuePtr);
+#endif
+#ifdef XPAR_XCSUDMA_NUM_INSTANCES
+#include "xcsudma.h"
+s32 XDmaEngine_BindCsuDma(XDmaEngine *Engine, XCsuDma *InstancePtr);
+#endif
+#ifdef XPAR_XDMAPS_NUM_INSTANCES
+#include "xdmaps.h"
+s32 XDmaEngine_BindDmaPs(XDmaEngine *Engine, XDmaPs *InstancePtr);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XDMAENGINE_H */
+/** @} */
@@ -0,0 +1,312 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xdmaengine_axicdma.c
+ * @addtogroup xildmaengine Overview
+ * @{
+ *
+ * This file contains the AXI CDMA backend of the XilDmaEngine library.
+ *
+ * The CDMA is one XDMAENGINE_MEM_TO_MEM channel.
+ *
+ * With a BD ring the backend runs in scatter gather mode. Every segment, or
+ * the shape of a 2D transaction, is submitted as one transfer with
+ * XAxiCdma_2DTransfer() and completes from XAxiCdma_IntrHandler(), which the
+ * application connects to the interrupt controller. The BD ring must be
+ * created by the application before the instance is bound.
+ *
+ * Without a BD ring the backend runs in simple mode. The segments are
+ * transferred one at a time and polled, call XDmaEngine_Poll()
+ * periodically. Only simple mode supports keyhole transfers, since the
+ * keyhole setting applies to every BD queued in hardware.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   ag   10/14/26 First release
+ * </pre>
+ *
+ *****************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xdmaengine.h"
+
+#ifdef XPAR_XAXICDMA_NUM_INSTANCES
+
+/************************** Function Prototypes ******************************/
+static s32 XDmaEngine_AxiCdmaPrep(XDmaEngine_Chan *Chan, XDmaEngine_Txn *Txn);
+static s32 XDmaEngine_AxiCdmaStart(XDmaEngine_Chan *Chan, XDmaEngine_Txn *Txn);
+static void XDmaEngine_AxiCdmaDone(void *CallBackRef, u32 IrqMask,
+				   int *NumBdPtr);
+static s32 XDmaEngine_AxiCdmaStartSimple(XDmaEngine_Chan *Chan,
+					 XDmaEngine_Txn *Txn);
+static void XDmaEngine_AxiCdmaPollSimple(XDmaEngine_Chan *Chan);
+
+/************************** Variable Definitions *****************************/
+static const XDmaEngine_Ops XDmaEngine_AxiCdmaSgOps = {
+	XDmaEngine_AxiCdmaPrep,
+	XDmaEngine_AxiCdmaStart,
+	NULL,
+	0U
+};
+
+static const XDmaEngine_Ops XDmaEngine_AxiCdmaSimpleOps = {
+	XDmaEngine_AxiCdmaPrep,
+	XDmaEngine_AxiCdmaStartSimple,
+	XDmaEngine_AxiCdmaPollSimple,
+	1U
+};
+
+/*****************************************************************************/
+/**
+ * This function binds an initialized AXI CDMA instance to the library. In
+ * simple mode the simple transfer interrupts are disabled, completions are
+ * polled.
+ *
+ * @param Engine is the engine to set up.
+ * @param InstancePtr is the AXI CDMA instance. A BD ring created on it
+ *	  selects scatter gather mode.
+ *
+ * @return XST_SUCCESS, or the error of XDmaEngine_Register().
+ *
+ ****************************************************************************/
+s32 XDmaEngine_BindAxiCdma(XDmaEngine *Engine, XAxiCdma *InstancePtr)
+{
+	XDmaEngine_Chan *Chan;
+
+	Xil_AssertNonvoid(Engine != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->Initialized != 0);
+
+	Chan = &Engine->Chans[0];
+
+	Engine->Type = XDMAENGINE_TYPE_AXICDMA;
+	Engine->InstancePtr = InstancePtr;
+	Engine->NumChans = 1U;
+
+	Chan->Direction = XDMAENGINE_MEM_TO_MEM;
+	Chan->HwId = 0U;
+	Chan->HwChan = InstancePtr;
+
+	if ((InstancePtr->SimpleOnlyBuild == 0) &&
+	    (InstancePtr->AllBdCnt != 0)) {
+		Engine->Ops = &XDmaEngine_AxiCdmaSgOps;
+		Chan->Caps = XDMAENGINE_CAP_SG | XDMAENGINE_CAP_2D;
+	} else {
+		Engine->Ops = &XDmaEngine_AxiCdmaSimpleOps;
+		Chan->Caps = XDMAENGINE_CAP_KEYHOLE;
+		XAxiCdma_IntrDisable(InstancePtr,
+				     XAXICDMA_XR_IRQ_SIMPLE_ALL_MASK);
+	}
+
+	return XDmaEngine_Register(Engine);
+}
+
+/*****************************************************************************/
+/**
+ * This function checks the segments of a transaction against the limits of
+ * simple mode.
+ *
+ * @param Chan is the channel.
+ * @param Txn is the transaction.
+ *
+ * @return XST_SUCCESS, or XST_INVALID_PARAM if a segment is longer than a
+ *	   simple transfer can be.
+ *
+ ****************************************************************************/
+static s32 XDmaEngine_AxiCdmaPrep(XDmaEngine_Chan *Chan, XDmaEngine_Txn *Txn)
+{
+	XAxiCdma *InstancePtr = (XAxiCdma *)Chan->HwChan;
+	u32 Index;
+
+	if (Chan->Engine->Ops->Serial == 0U) {
+		/* The driver splits long segments over several BDs */
+		return (s32)XST_SUCCESS;
+	}
+
+	for (Index = 0U; Index < Txn->NumSg; Index++) {
+		if (Txn->Sg[Index].Length > (u32)InstancePtr->MaxTransLen) {
+			return (s32)XST_INVALID_PARAM;
+		}
+	}
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function submits the segments of a transaction from Txn->Issued on,
+ * as far as the BD ring and the handler list of the driver have room.
+ *
+ * @param Chan is the channel.
+ * @param Txn is the transaction.
+ *
+ * @return XST_SUCCESS, XST_DEVICE_BUSY, or the error of the driver.
+ *
+ ****************************************************************************/
+static s32 XDmaEngine_AxiCdmaStart(XDmaEngine_Chan *Chan, XDmaEngine_Txn *Txn)
+{
+	XAxiCdma *InstancePtr = (XAxiCdma *)Chan->HwChan;
+	const XDmaEngine_Sg *Sg;
+	XAxiCdma_2DShape Shape;
+	int Status;
+
+	while (Txn->Issued < Txn->NumSg) {
+		Sg = &Txn->Sg[Txn->Issued];
+
+		if ((Txn->Flags & XDMAENGINE_FLAG_2D) != 0U) {
+			Shape.Width = Txn->Shape.Width;
+			Shape.Height = Txn->Shape.Height;
+			Shape.SrcStride = Txn->Shape.SrcStride;
+			Shape.DstStride = Txn->Shape.DstStride;
+		} else {
+			Shape.Width = Sg->Length;
+			Shape.Height = 1U;
+			Shape.SrcStride = Sg->Length;
+			Shape.DstStride = Sg->Length;
+		}
+
+		Status = XAxiCdma_2DTransfer(InstancePtr, Sg->SrcAddr,
+					     Sg->DstAddr, &Shape,
+					     XDmaEngine_AxiCdmaDone, Txn);
+		if (Status == XST_FIFO_NO_ROOM) {
+			return (s32)XST_DEVICE_BUSY;
+		}
+		if ((Status == XST_FAILURE) &&
+		    ((int)XAxiCdma_BdRingGetFreeCnt(InstancePtr) <
+		     InstancePtr->AllBdCnt)) {
+			/* Out of BDs, retry once transfers in flight are done */
+			return (s32)XST_DEVICE_BUSY;
+		}
+		if (Status != XST_SUCCESS) {
+			return (s32)Status;
+		}
+
+		Txn->Issued++;
+		Txn->Units++;
+	}
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function is the callback of a scatter gather transfer. It is called
+ * by XAxiCdma_IntrHandler() and frees the completed BDs of the transfer.
+ *
+ * @param CallBackRef is the transaction of the transfer.
+ * @param IrqMask is the interrupt mask passed by the driver.
+ * @param NumBdPtr is the number of BDs of the transfer not yet freed.
+ *
+ * @return None
+ *
+ ****************************************************************************/
+static void XDmaEngine_AxiCdmaDone(void *CallBackRef, u32 IrqMask,
+				   int *NumBdPtr)
+{
+	XDmaEngine_Txn *Txn = (XDmaEngine_Txn *)CallBackRef;
+	XAxiCdma *InstancePtr = (XAxiCdma *)Txn->Chan->HwChan;
+	XAxiCdma_Bd *BdSetPtr;
+	int NumBd;
+
+	if ((IrqMask & XAXICDMA_XR_IRQ_ERROR_MASK) != 0U) {
+		/* The driver resets the engine, the BDs are lost */
+		*NumBdPtr = 0;
+		XDmaEngine_Complete(Txn->Chan, Txn, 1U, (s32)XST_DMA_ERROR);
+		return;
+	}
+
+	NumBd = (int)XAxiCdma_BdRingFromHw(InstancePtr, *NumBdPtr, &BdSetPtr);
+	if (NumBd <= 0) {
+		return;
+	}
+
+	(void)XAxiCdma_BdRingFree(InstancePtr, NumBd, BdSetPtr);
+	*NumBdPtr -= NumBd;
+
+	if (*NumBdPtr == 0) {
+		XDmaEngine_Complete(Txn->Chan, Txn, 1U, (s32)XST_SUCCESS);
+	}
+}
+
+/*****************************************************************************/
+/**
+ * This function starts the next segment of a transaction in simple mode.
+ *
+ * @param Chan is the channel.
+ * @param Txn is the transaction.
+ *
+ * @return XST_SUCCESS, or the error of the driver.
+ *
+ ****************************************************************************/
+static s32 XDmaEngine_AxiCdmaStartSimple(XDmaEngine_Chan *Chan,
+					 XDmaEngine_Txn *Txn)
+{
+	XAxiCdma *InstancePtr = (XAxiCdma *)Chan->HwChan;
+	const XDmaEngine_Sg *Sg = &Txn->Sg[Txn->Issued];
+	int Status;
+
+	Status = XAxiCdma_SelectKeyHole(InstancePtr, XAXICDMA_KEYHOLE_READ,
+			((Txn->Flags & XDMAENGINE_FLAG_SRC_KEYHOLE) != 0U) ?
+			TRUE : FALSE);
+	if (Status == XST_SUCCESS) {
+		Status = XAxiCdma_SelectKeyHole(InstancePtr,
+			XAXICDMA_KEYHOLE_WRITE,
+			((Txn->Flags & XDMAENGINE_FLAG_DST_KEYHOLE) != 0U) ?
+			TRUE : FALSE);
+	}
+	if (Status != XST_SUCCESS) {
+		return (s32)Status;
+	}
+
+	Status = (int)XAxiCdma_SimpleTransfer(InstancePtr, Sg->SrcAddr,
+					      Sg->DstAddr, (int)Sg->Length,
+					      NULL, NULL);
+	if (Status != XST_SUCCESS) {
+		return (s32)Status;
+	}
+
+	Txn->Issued++;
+	Txn->Units++;
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function checks whether the segment in flight on the channel in
+ * simple mode is done.
+ *
+ * @param Chan is the channel.
+ *
+ * @return None
+ *
+ ****************************************************************************/
+static void XDmaEngine_AxiCdmaPollSimple(XDmaEngine_Chan *Chan)
+{
+	XAxiCdma *InstancePtr = (XAxiCdma *)Chan->HwChan;
+	XDmaEngine_Txn *Txn = Chan->Head;
+
+	if ((Txn == NULL) || (Txn->UnitsDone == Txn->Units)) {
+		return;
+	}
+
+	if (XAxiCdma_GetError(InstancePtr) != 0U) {
+		XAxiCdma_Reset(InstancePtr);
+		XDmaEngine_Complete(Chan, Txn, 1U, (s32)XST_DMA_ERROR);
+	} else if (XAxiCdma_IsBusy(InstancePtr) == 0) {
+		XDmaEngine_Complete(Chan, Txn, 1U, (s32)XST_SUCCESS);
+	} else {
+		/* Segment still in flight */
+	}
+}
+
+#endif /* XPAR_XAXICDMA_NUM_INSTANCES */
+/** @} */
@@ -0,0 +1,341 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xdmaengine_axidma.c
+ * @addtogroup xildmaengine Overview
+ * @{
+ *
+ * This file contains the AXI DMA backend of the XilDmaEngine library.
+ *
+ * The MM2S channel is an XDMAENGINE_MEM_TO_DEV channel and the S2MM channel
+ * an XDMAENGINE_DEV_TO_MEM channel. In scatter gather mode every segment of a
+ * transaction takes one BD, and a transaction on the MM2S channel is sent as
+ * one packet. The BD rings must be created and started by the application
+ * before they are bound. In simple mode the segments are transferred one at
+ * a time.
+ *
+ * The backend is polled, call XDmaEngine_Poll() from the interrupt handler
+ * of the channel after acknowledging the interrupt, or periodically.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   ag   10/14/26 First release
+ * </pre>
+ *
+ *****************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xdmaengine.h"
+
+#ifdef XPAR_XAXIDMA_NUM_INSTANCES
+
+/************************** Constant Definitions *****************************/
+
+/** Number of BDs reaped per call of XAxiDma_BdRingReapVec() */
+#define XDMAENGINE_AXIDMA_REAP		16
+
+/************************** Function Prototypes ******************************/
+static s32 XDmaEngine_AxiDmaPrep(XDmaEngine_Chan *Chan, XDmaEngine_Txn *Txn);
+static s32 XDmaEngine_AxiDmaStart(XDmaEngine_Chan *Chan, XDmaEngine_Txn *Txn);
+static void XDmaEngine_AxiDmaPoll(XDmaEngine_Chan *Chan);
+static s32 XDmaEngine_AxiDmaStartSimple(XDmaEngine_Chan *Chan,
+					XDmaEngine_Txn *Txn);
+static void XDmaEngine_AxiDmaPollSimple(XDmaEngine_Chan *Chan);
+
+/************************** Variable Definitions *****************************/
+static const XDmaEngine_Ops XDmaEngine_AxiDmaSgOps = {
+	XDmaEngine_AxiDmaPrep,
+	XDmaEngine_AxiDmaStart,
+	XDmaEngine_AxiDmaPoll,
+	0U
+};
+
+static const XDmaEngine_Ops XDmaEngine_AxiDmaSimpleOps = {
+	XDmaEngine_AxiDmaPrep,
+	XDmaEngine_AxiDmaStartSimple,
+	XDmaEngine_AxiDmaPollSimple,
+	1U
+};
+
+/*****************************************************************************/
+/**
+ * This function binds an initialized AXI DMA instance to the library.
+ *
+ * @param Engine is the engine to set up.
+ * @param InstancePtr is the AXI DMA instance. In scatter gather mode its BD
+ *	  rings must be created and started.
+ *
+ * @return XST_SUCCESS, or the error of XDmaEngine_Register().
+ *
+ ****************************************************************************/
+s32 XDmaEngine_BindAxiDma(XDmaEngine *Engine, XAxiDma *InstancePtr)
+{
+	XDmaEngine_Chan *Chan;
+	u32 Caps;
+
+	Xil_AssertNonvoid(Engine != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->Initialized != 0);
+
+	Engine->Type = XDMAENGINE_TYPE_AXIDMA;
+	Engine->InstancePtr = InstancePtr;
+	Engine->NumChans = 0U;
+
+	if (InstancePtr->HasSg != 0) {
+		Engine->Ops = &XDmaEngine_AxiDmaSgOps;
+		Caps = XDMAENGINE_CAP_SG;
+	} else {
+		Engine->Ops = &XDmaEngine_AxiDmaSimpleOps;
+		Caps = 0U;
+	}
+
+	if (InstancePtr->HasMm2S != 0) {
+		Chan = &Engine->Chans[Engine->NumChans];
+		Chan->Direction = XDMAENGINE_MEM_TO_DEV;
+		Chan->Caps = Caps;
+		Chan->HwId = XAXIDMA_DMA_TO_DEVICE;
+		Chan->HwChan = XAxiDma_GetTxRing(InstancePtr);
+		Engine->NumChans++;
+	}
+
+	if (InstancePtr->HasS2Mm != 0) {
+		Chan = &Engine->Chans[Engine->NumChans];
+		Chan->Direction = XDMAENGINE_DEV_TO_MEM;
+		Chan->Caps = Caps;
+		Chan->HwId = XAXIDMA_DEVICE_TO_DMA;
+		Chan->HwChan = XAxiDma_GetRxRing(InstancePtr);
+		Engine->NumChans++;
+	}
+
+	return XDmaEngine_Register(Engine);
+}
+
+/*****************************************************************************/
+/**
+ * This function checks that the segments of a transaction fit the BDs and
+ * the BD ring of a channel.
+ *
+ * @param Chan is the channel.
+ * @param Txn is the transaction.
+ *
+ * @return XST_SUCCESS, or XST_INVALID_PARAM if a segment is longer than a
+ *	   BD can transfer or the transaction has more segments than the ring
+ *	   has BDs.
+ *
+ ****************************************************************************/
+static s32 XDmaEngine_AxiDmaPrep(XDmaEngine_Chan *Chan, XDmaEngine_Txn *Txn)
+{
+	XAxiDma_BdRing *RingPtr = (XAxiDma_BdRing *)Chan->HwChan;
+	XAxiDma *InstancePtr = (XAxiDma *)Chan->Engine->InstancePtr;
+	u32 Index;
+
+	if ((InstancePtr->HasSg != 0) &&
+	    (Txn->NumSg > (u32)XAxiDma_BdRingGetCnt(RingPtr))) {
+		return (s32)XST_INVALID_PARAM;
+	}
+
+	for (Index = 0U; Index < Txn->NumSg; Index++) {
+		if (Txn->Sg[Index].Length > RingPtr->MaxTransferLen) {
+			return (s32)XST_INVALID_PARAM;
+		}
+	}
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function passes all segments of a transaction to the BD ring of a
+ * channel. The transaction waits for the ring to drain if it does not have
+ * enough free BDs.
+ *
+ * @param Chan is the channel.
+ * @param Txn is the transaction.
+ *
+ * @return XST_SUCCESS, XST_DEVICE_BUSY, or the error of the driver.
+ *
+ ****************************************************************************/
+static s32 XDmaEngine_AxiDmaStart(XDmaEngine_Chan *Chan, XDmaEngine_Txn *Txn)
+{
+	XAxiDma_BdRing *RingPtr = (XAxiDma_BdRing *)Chan->HwChan;
+	XAxiDma *InstancePtr = (XAxiDma *)Chan->Engine->InstancePtr;
+	XAxiDma_Bd *BdSetPtr;
+	XAxiDma_Bd *BdPtr;
+	UINTPTR Addr;
+	u32 Ctrl;
+	u32 Index;
+	s32 Status;
+
+	if ((u32)XAxiDma_BdRingGetFreeCnt(RingPtr) < Txn->NumSg) {
+		return (s32)XST_DEVICE_BUSY;
+	}
+
+	Status = XAxiDma_BdRingAlloc(RingPtr, (int)Txn->NumSg, &BdSetPtr);
+	if (Status != XST_SUCCESS) {
+		return (s32)XST_DEVICE_BUSY;
+	}
+
+	BdPtr = BdSetPtr;
+	for (Index = 0U; Index < Txn->NumSg; Index++) {
+		if (Chan->Direction == XDMAENGINE_MEM_TO_DEV) {
+			Addr = Txn->Sg[Index].SrcAddr;
+			Ctrl = 0U;
+			if (Index == 0U) {
+				Ctrl |= XAXIDMA_BD_CTRL_TXSOF_MASK;
+			}
+			if (Index == (Txn->NumSg - 1U)) {
+				Ctrl |= XAXIDMA_BD_CTRL_TXEOF_MASK;
+			}
+		} else {
+			Addr = Txn->Sg[Index].DstAddr;
+			Ctrl = 0U;
+		}
+
+		if (InstancePtr->MicroDmaMode != 0) {
+			Status = (s32)XAxiDma_BdSetBufAddrMicroMode(BdPtr, Addr);
+		} else {
+			Status = (s32)XAxiDma_BdSetBufAddr(BdPtr, Addr);
+		}
+		if (Status == XST_SUCCESS) {
+			Status = XAxiDma_BdSetLength(BdPtr,
+						     Txn->Sg[Index].Length,
+						     RingPtr->MaxTransferLen);
+		}
+		if (Status != XST_SUCCESS) {
+			(void)XAxiDma_BdRingUnAlloc(RingPtr, (int)Txn->NumSg,
+						    BdSetPtr);
+			return (s32)XST_INVALID_PARAM;
+		}
+
+		XAxiDma_BdSetCtrl(BdPtr, Ctrl);
+		BdPtr = (XAxiDma_Bd *)XAxiDma_BdRingNext(RingPtr, BdPtr);
+	}
+
+	Status = XAxiDma_BdRingToHw(RingPtr, (int)Txn->NumSg, BdSetPtr);
+	if (Status != XST_SUCCESS) {
+		(void)XAxiDma_BdRingUnAlloc(RingPtr, (int)Txn->NumSg, BdSetPtr);
+		return Status;
+	}
+
+	Txn->Issued = Txn->NumSg;
+	Txn->Units += Txn->NumSg;
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function reaps the completed BDs of a channel and credits them to
+ * the transactions in submission order.
+ *
+ * @param Chan is the channel.
+ *
+ * @return None
+ *
+ ****************************************************************************/
+static void XDmaEngine_AxiDmaPoll(XDmaEngine_Chan *Chan)
+{
+	XAxiDma_BdRing *RingPtr = (XAxiDma_BdRing *)Chan->HwChan;
+	XAxiDma_BdResult Res[XDMAENGINE_AXIDMA_REAP];
+	u32 Good;
+	int NumBd;
+	int Index;
+
+	do {
+		NumBd = XAxiDma_BdRingReapVec(RingPtr, Res,
+					      XDMAENGINE_AXIDMA_REAP);
+
+		Good = 0U;
+		for (Index = 0; Index < NumBd; Index++) {
+			if ((Res[Index].Status &
+			     XAXIDMA_BD_STS_ALL_ERR_MASK) == 0U) {
+				Good++;
+				continue;
+			}
+			if (Good != 0U) {
+				XDmaEngine_Complete(Chan, NULL, Good,
+						    (s32)XST_SUCCESS);
+				Good = 0U;
+			}
+			XDmaEngine_Complete(Chan, NULL, 1U,
+					    (s32)XST_DMA_ERROR);
+		}
+		if (Good != 0U) {
+			XDmaEngine_Complete(Chan, NULL, Good, (s32)XST_SUCCESS);
+		}
+	} while (NumBd == XDMAENGINE_AXIDMA_REAP);
+}
+
+/*****************************************************************************/
+/**
+ * This function starts the next segment of a transaction in simple mode.
+ *
+ * @param Chan is the channel.
+ * @param Txn is the transaction.
+ *
+ * @return XST_SUCCESS, or the error of XAxiDma_SimpleTransfer().
+ *
+ ****************************************************************************/
+static s32 XDmaEngine_AxiDmaStartSimple(XDmaEngine_Chan *Chan,
+					XDmaEngine_Txn *Txn)
+{
+	const XDmaEngine_Sg *Sg = &Txn->Sg[Txn->Issued];
+	UINTPTR Addr;
+	u32 Status;
+
+	Addr = (Chan->Direction == XDMAENGINE_MEM_TO_DEV) ?
+		Sg->SrcAddr : Sg->DstAddr;
+
+	Status = XAxiDma_SimpleTransfer((XAxiDma *)Chan->Engine->InstancePtr,
+					Addr, Sg->Length, (int)Chan->HwId);
+	if (Status != (u32)XST_SUCCESS) {
+		return (s32)Status;
+	}
+
+	Txn->Issued++;
+	Txn->Units++;
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function checks whether the segment in flight on a channel in
+ * simple mode is done.
+ *
+ * @param Chan is the channel.
+ *
+ * @return None
+ *
+ ****************************************************************************/
+static void XDmaEngine_AxiDmaPollSimple(XDmaEngine_Chan *Chan)
+{
+	XAxiDma_BdRing *RingPtr = (XAxiDma_BdRing *)Chan->HwChan;
+	XDmaEngine_Txn *Txn = Chan->Head;
+	u32 Sr;
+
+	if ((Txn == NULL) || (Txn->UnitsDone == Txn->Units)) {
+		return;
+	}
+
+	Sr = XAxiDma_ReadReg(RingPtr->ChanBase, XAXIDMA_SR_OFFSET);
+	if ((Sr & XAXIDMA_ERR_ALL_MASK) != 0U) {
+		XDmaEngine_Complete(Chan, Txn, 1U, (s32)XST_DMA_ERROR);
+	} else if (XAxiDma_Busy((XAxiDma *)Chan->Engine->InstancePtr,
+				(int)Chan->HwId) == FALSE) {
+		XDmaEngine_Complete(Chan, Txn, 1U, (s32)XST_SUCCESS);
+	} else {
+		/* Segment still in flight */
+	}
+}
+
+#endif /* XPAR_XAXIDMA_NUM_INSTANCES */
+/** @} */
@@ -0,0 +1,216 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xdmaengine_csudma.c
+ * @addtogroup xildmaengine Overview
+ * @{
+ *
+ * This file contains the CSU DMA backend of the XilDmaEngine library.
+ *
+ * The source channel of the CSU DMA is an XDMAENGINE_MEM_TO_DEV channel and
+ * the destination channel an XDMAENGINE_DEV_TO_MEM channel, with the secure
+ * stream switch as the device. The segments are transferred one at a time
+ * and must be multiples of 4 bytes. The end of message is signaled with the
+ * last word of a transaction on the source channel. A keyhole transaction
+ * uses fixed AXI bursts on the memory side.
+ *
+ * The backend is polled, call XDmaEngine_Poll() from the interrupt handler
+ * of the CSU DMA, or periodically. Polling clears the done and error
+ * interrupts of the channel.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   ag   10/14/26 First release
+ * </pre>
+ *
+ *****************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xdmaengine.h"
+
+#ifdef XPAR_XCSUDMA_NUM_INSTANCES
+
+/************************** Constant Definitions *****************************/
+
+/** Interrupts of a channel that fail the segment in flight */
+#define XDMAENGINE_CSUDMA_ERR_MASK	(XCSUDMA_IXR_AXI_WRERR_MASK | \
+					 XCSUDMA_IXR_INVALID_APB_MASK)
+
+/************************** Function Prototypes ******************************/
+static s32 XDmaEngine_CsuDmaPrep(XDmaEngine_Chan *Chan, XDmaEngine_Txn *Txn);
+static s32 XDmaEngine_CsuDmaStart(XDmaEngine_Chan *Chan, XDmaEngine_Txn *Txn);
+static void XDmaEngine_CsuDmaPoll(XDmaEngine_Chan *Chan);
+
+/************************** Variable Definitions *****************************/
+static const XDmaEngine_Ops XDmaEngine_CsuDmaOps = {
+	XDmaEngine_CsuDmaPrep,
+	XDmaEngine_CsuDmaStart,
+	XDmaEngine_CsuDmaPoll,
+	1U
+};
+
+/*****************************************************************************/
+/**
+ * This function binds an initialized CSU DMA instance to the library.
+ *
+ * @param Engine is the engine to set up.
+ * @param InstancePtr is the CSU DMA instance.
+ *
+ * @return XST_SUCCESS, or the error of XDmaEngine_Register().
+ *
+ ****************************************************************************/
+s32 XDmaEngine_BindCsuDma(XDmaEngine *Engine, XCsuDma *InstancePtr)
+{
+	XDmaEngine_Chan *Chan;
+
+	Xil_AssertNonvoid(Engine != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	Engine->Type = XDMAENGINE_TYPE_CSUDMA;
+	Engine->InstancePtr = InstancePtr;
+	Engine->Ops = &XDmaEngine_CsuDmaOps;
+	Engine->NumChans = 2U;
+
+	Chan = &Engine->Chans[0];
+	Chan->Direction = XDMAENGINE_MEM_TO_DEV;
+	Chan->Caps = XDMAENGINE_CAP_KEYHOLE;
+	Chan->HwId = (u32)XCSUDMA_SRC_CHANNEL;
+	Chan->HwChan = InstancePtr;
+
+	Chan = &Engine->Chans[1];
+	Chan->Direction = XDMAENGINE_DEV_TO_MEM;
+	Chan->Caps = XDMAENGINE_CAP_KEYHOLE;
+	Chan->HwId = (u32)XCSUDMA_DST_CHANNEL;
+	Chan->HwChan = InstancePtr;
+
+	return XDmaEngine_Register(Engine);
+}
+
+/*****************************************************************************/
+/**
+ * This function checks a transaction against the CSU DMA: segments are
+ * whole words within the size field, and only the memory side of the
+ * channel can be a keyhole.
+ *
+ * @param Chan is the channel.
+ * @param Txn is the transaction.
+ *
+ * @return XST_SUCCESS, or XST_INVALID_PARAM if the transaction does not
+ *	   fit.
+ *
+ ****************************************************************************/
+static s32 XDmaEngine_CsuDmaPrep(XDmaEngine_Chan *Chan, XDmaEngine_Txn *Txn)
+{
+	u32 Index;
+
+	if ((Chan->Direction == XDMAENGINE_MEM_TO_DEV) &&
+	    ((Txn->Flags & XDMAENGINE_FLAG_DST_KEYHOLE) != 0U)) {
+		return (s32)XST_INVALID_PARAM;
+	}
+	if ((Chan->Direction == XDMAENGINE_DEV_TO_MEM) &&
+	    ((Txn->Flags & XDMAENGINE_FLAG_SRC_KEYHOLE) != 0U)) {
+		return (s32)XST_INVALID_PARAM;
+	}
+
+	for (Index = 0U; Index < Txn->NumSg; Index++) {
+		if (((Txn->Sg[Index].Length & 0x3U) != 0U) ||
+		    ((Txn->Sg[Index].Length >> 2U) > XCSUDMA_SIZE_MAX)) {
+			return (s32)XST_INVALID_PARAM;
+		}
+	}
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function starts the next segment of a transaction. The burst type
+ * of the channel is set when the first segment starts.
+ *
+ * @param Chan is the channel.
+ * @param Txn is the transaction.
+ *
+ * @return XST_SUCCESS.
+ *
+ ****************************************************************************/
+static s32 XDmaEngine_CsuDmaStart(XDmaEngine_Chan *Chan, XDmaEngine_Txn *Txn)
+{
+	XCsuDma *InstancePtr = (XCsuDma *)Chan->HwChan;
+	XCsuDma_Channel Channel = (XCsuDma_Channel)Chan->HwId;
+	const XDmaEngine_Sg *Sg = &Txn->Sg[Txn->Issued];
+	XCsuDma_Configure Config;
+	UINTPTR Addr;
+	u8 Last = 0U;
+
+	if (Txn->Issued == 0U) {
+		XCsuDma_GetConfig(InstancePtr, Channel, &Config);
+		Config.AxiBurstType = ((Txn->Flags &
+			(XDMAENGINE_FLAG_SRC_KEYHOLE |
+			 XDMAENGINE_FLAG_DST_KEYHOLE)) != 0U) ? 1U : 0U;
+		XCsuDma_SetConfig(InstancePtr, Channel, &Config);
+	}
+
+	if (Chan->Direction == XDMAENGINE_MEM_TO_DEV) {
+		Addr = Sg->SrcAddr;
+		if (Txn->Issued == (Txn->NumSg - 1U)) {
+			Last = 1U;
+		}
+	} else {
+		Addr = Sg->DstAddr;
+	}
+
+	XCsuDma_IntrClear(InstancePtr, Channel, XCSUDMA_IXR_DONE_MASK);
+	XCsuDma_Transfer(InstancePtr, Channel, (u64)Addr, Sg->Length >> 2U,
+			 Last);
+
+	Txn->Issued++;
+	Txn->Units++;
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function checks whether the segment in flight on a channel is done.
+ *
+ * @param Chan is the channel.
+ *
+ * @return None
+ *
+ ****************************************************************************/
+static void XDmaEngine_CsuDmaPoll(XDmaEngine_Chan *Chan)
+{
+	XCsuDma *InstancePtr = (XCsuDma *)Chan->HwChan;
+	XCsuDma_Channel Channel = (XCsuDma_Channel)Chan->HwId;
+	XDmaEngine_Txn *Txn = Chan->Head;
+	u32 Status;
+
+	if ((Txn == NULL) || (Txn->UnitsDone == Txn->Units)) {
+		return;
+	}
+
+	Status = XCsuDma_IntrGetStatus(InstancePtr, Channel);
+	if ((Status & XDMAENGINE_CSUDMA_ERR_MASK) != 0U) {
+		XCsuDma_IntrClear(InstancePtr, Channel,
+				  Status & (XDMAENGINE_CSUDMA_ERR_MASK |
+					    XCSUDMA_IXR_DONE_MASK));
+		XDmaEngine_Complete(Chan, Txn, 1U, (s32)XST_DMA_ERROR);
+	} else if ((Status & XCSUDMA_IXR_DONE_MASK) != 0U) {
+		XCsuDma_IntrClear(InstancePtr, Channel, XCSUDMA_IXR_DONE_MASK);
+		XDmaEngine_Complete(Chan, Txn, 1U, (s32)XST_SUCCESS);
+	} else {
+		/* Segment still in flight */
+	}
+}
+
+#endif /* XPAR_XCSUDMA_NUM_INSTANCES */
+/** @} */
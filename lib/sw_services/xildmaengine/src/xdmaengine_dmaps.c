@@ -0,0 +1,185 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xdmaengine_dmaps.c
+ * @addtogroup xildmaengine Overview
+ * @{
+ *
+ * This file contains the PS DMA (PL330) backend of the XilDmaEngine library.
+ *
+ * Every channel of the DMAC is an XDMAENGINE_MEM_TO_MEM channel. The
+ * segments of a transaction are run one at a time as driver generated
+ * programs, which the driver caches by geometry, so segments of the same
+ * shape do not generate their program again. Keyhole sides use a fixed
+ * address.
+ *
+ * The backend takes its completions from the done and fault handlers of the
+ * driver, the application connects the interrupt handlers of the DMAC.
+ * Binding replaces the done handlers of all channels and the fault handler.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   ag   10/14/26 First release
+ * </pre>
+ *
+ *****************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <string.h>
+#include "xdmaengine.h"
+
+#ifdef XPAR_XDMAPS_NUM_INSTANCES
+
+/************************** Constant Definitions *****************************/
+
+/** Burst size and length used for both sides of a transfer */
+#define XDMAENGINE_DMAPS_BURST_SIZE	4U
+#define XDMAENGINE_DMAPS_BURST_LEN	4U
+
+/************************** Function Prototypes ******************************/
+static s32 XDmaEngine_DmaPsStart(XDmaEngine_Chan *Chan, XDmaEngine_Txn *Txn);
+static void XDmaEngine_DmaPsDone(unsigned int Channel, XDmaPs_Cmd *DmaCmd,
+				 void *CallbackRef);
+
+/************************** Variable Definitions *****************************/
+static const XDmaEngine_Ops XDmaEngine_DmaPsOps = {
+	NULL,
+	XDmaEngine_DmaPsStart,
+	NULL,
+	1U
+};
+
+/** Commands of the segments in flight, per DMAC and channel */
+static XDmaPs_Cmd XDmaEngine_DmaPsCmd[XPAR_XDMAPS_NUM_INSTANCES]
+				     [XDMAPS_CHANNELS_PER_DEV];
+
+/*****************************************************************************/
+/**
+ * This function binds an initialized PS DMA instance to the library.
+ *
+ * @param Engine is the engine to set up.
+ * @param InstancePtr is the PS DMA instance.
+ *
+ * @return XST_SUCCESS, or the error of the driver or of
+ *	   XDmaEngine_Register().
+ *
+ ****************************************************************************/
+s32 XDmaEngine_BindDmaPs(XDmaEngine *Engine, XDmaPs *InstancePtr)
+{
+	XDmaEngine_Chan *Chan;
+	u32 Index;
+	int Status;
+
+	Xil_AssertNonvoid(Engine != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(InstancePtr->Config.DeviceId <
+			  XPAR_XDMAPS_NUM_INSTANCES);
+
+	Engine->Type = XDMAENGINE_TYPE_DMAPS;
+	Engine->InstancePtr = InstancePtr;
+	Engine->Ops = &XDmaEngine_DmaPsOps;
+	Engine->NumChans = XDMAPS_CHANNELS_PER_DEV;
+
+	for (Index = 0U; Index < XDMAPS_CHANNELS_PER_DEV; Index++) {
+		Chan = &Engine->Chans[Index];
+		Chan->Direction = XDMAENGINE_MEM_TO_MEM;
+		Chan->Caps = XDMAENGINE_CAP_KEYHOLE;
+		Chan->HwId = Index;
+		Chan->HwChan = &XDmaEngine_DmaPsCmd[InstancePtr->Config.DeviceId]
+						   [Index];
+
+		Status = XDmaPs_SetDoneHandler(InstancePtr, Index,
+					       XDmaEngine_DmaPsDone, Engine);
+		if (Status != XST_SUCCESS) {
+			return (s32)Status;
+		}
+	}
+
+	Status = XDmaPs_SetFaultHandler(InstancePtr, XDmaEngine_DmaPsDone,
+					Engine);
+	if (Status != XST_SUCCESS) {
+		return (s32)Status;
+	}
+
+	return XDmaEngine_Register(Engine);
+}
+
+/*****************************************************************************/
+/**
+ * This function starts the next segment of a transaction.
+ *
+ * @param Chan is the channel.
+ * @param Txn is the transaction.
+ *
+ * @return XST_SUCCESS, or the error of XDmaPs_Start().
+ *
+ ****************************************************************************/
+static s32 XDmaEngine_DmaPsStart(XDmaEngine_Chan *Chan, XDmaEngine_Txn *Txn)
+{
+	XDmaPs_Cmd *Cmd = (XDmaPs_Cmd *)Chan->HwChan;
+	const XDmaEngine_Sg *Sg = &Txn->Sg[Txn->Issued];
+	int Status;
+
+	(void)memset(Cmd, 0, sizeof(XDmaPs_Cmd));
+
+	Cmd->ChanCtrl.SrcBurstSize = XDMAENGINE_DMAPS_BURST_SIZE;
+	Cmd->ChanCtrl.SrcBurstLen = XDMAENGINE_DMAPS_BURST_LEN;
+	Cmd->ChanCtrl.SrcInc = ((Txn->Flags &
+				 XDMAENGINE_FLAG_SRC_KEYHOLE) != 0U) ? 0U : 1U;
+	Cmd->ChanCtrl.DstBurstSize = XDMAENGINE_DMAPS_BURST_SIZE;
+	Cmd->ChanCtrl.DstBurstLen = XDMAENGINE_DMAPS_BURST_LEN;
+	Cmd->ChanCtrl.DstInc = ((Txn->Flags &
+				 XDMAENGINE_FLAG_DST_KEYHOLE) != 0U) ? 0U : 1U;
+	Cmd->BD.SrcAddr = (u32)Sg->SrcAddr;
+	Cmd->BD.DstAddr = (u32)Sg->DstAddr;
+	Cmd->BD.Length = Sg->Length;
+
+	Status = XDmaPs_Start((XDmaPs *)Chan->Engine->InstancePtr, Chan->HwId,
+			      Cmd, 0);
+	if (Status != XST_SUCCESS) {
+		return (s32)Status;
+	}
+
+	Txn->Issued++;
+	Txn->Units++;
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function is the done and fault handler of the channels.
+ *
+ * @param Channel is the channel of the DMAC.
+ * @param DmaCmd is the finished command.
+ * @param CallbackRef is the engine.
+ *
+ * @return None
+ *
+ ****************************************************************************/
+static void XDmaEngine_DmaPsDone(unsigned int Channel, XDmaPs_Cmd *DmaCmd,
+				 void *CallbackRef)
+{
+	XDmaEngine *Engine = (XDmaEngine *)CallbackRef;
+	XDmaEngine_Chan *Chan = &Engine->Chans[Channel];
+
+	if (Chan->Head == NULL) {
+		return;
+	}
+
+	XDmaEngine_Complete(Chan, Chan->Head, 1U,
+			    (DmaCmd->DmaStatus == 0) ? (s32)XST_SUCCESS :
+			    (s32)XST_DMA_ERROR);
+}
+
+#endif /* XPAR_XDMAPS_NUM_INSTANCES */
+/** @} */
@@ -0,0 +1,280 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xdmaengine_mcdma.c
+ * @addtogroup xildmaengine Overview
+ * @{
+ *
+ * This file contains the AXI MCDMA backend of the XilDmaEngine library.
+ *
+ * Every MM2S channel of the MCDMA is an XDMAENGINE_MEM_TO_DEV channel and
+ * every S2MM channel an XDMAENGINE_DEV_TO_MEM channel, MM2S channels first.
+ * A segment longer than the maximum transfer length of the channel is split
+ * over several BDs by the driver, and a transaction on an MM2S channel is
+ * sent as one packet. The BD chains must be created by the application
+ * before the instance is bound.
+ *
+ * The backend is polled, call XDmaEngine_Poll() from the done handler of
+ * the channel, or periodically.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   ag   10/14/26 First release
+ * </pre>
+ *
+ *****************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xdmaengine.h"
+
+#ifdef XPAR_XMCDMA_NUM_INSTANCES
+
+/************************** Function Prototypes ******************************/
+static u32 XDmaEngine_McdmaBds(const XMcdma_ChanCtrl *ChanPtr, u32 Length);
+static s32 XDmaEngine_McdmaPrep(XDmaEngine_Chan *Chan, XDmaEngine_Txn *Txn);
+static s32 XDmaEngine_McdmaStart(XDmaEngine_Chan *Chan, XDmaEngine_Txn *Txn);
+static void XDmaEngine_McdmaPoll(XDmaEngine_Chan *Chan);
+
+/************************** Variable Definitions *****************************/
+static const XDmaEngine_Ops XDmaEngine_McdmaOps = {
+	XDmaEngine_McdmaPrep,
+	XDmaEngine_McdmaStart,
+	XDmaEngine_McdmaPoll,
+	0U
+};
+
+/*****************************************************************************/
+/**
+ * This function binds an initialized MCDMA instance to the library.
+ *
+ * @param Engine is the engine to set up.
+ * @param InstancePtr is the MCDMA instance, the BD chains of its channels
+ *	  must be created.
+ *
+ * @return
+ *	- XST_SUCCESS if the engine is bound
+ *	- XST_INVALID_PARAM if the MCDMA has more than XDMAENGINE_MAX_CHANS
+ *	  channels
+ *
+ ****************************************************************************/
+s32 XDmaEngine_BindMcdma(XDmaEngine *Engine, XMcdma *InstancePtr)
+{
+	XDmaEngine_Chan *Chan;
+	u32 Caps;
+	u32 NumTx = 0U;
+	u32 NumRx = 0U;
+	u32 Index;
+
+	Xil_AssertNonvoid(Engine != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if (InstancePtr->Config.HasMM2S != 0) {
+		NumTx = (u32)InstancePtr->Config.TxNumChannels;
+	}
+	if (InstancePtr->Config.HasS2MM != 0) {
+		NumRx = (u32)InstancePtr->Config.RxNumChannels;
+	}
+	if ((NumTx + NumRx) > XDMAENGINE_MAX_CHANS) {
+		return (s32)XST_INVALID_PARAM;
+	}
+
+	Engine->Type = XDMAENGINE_TYPE_MCDMA;
+	Engine->InstancePtr = InstancePtr;
+	Engine->Ops = &XDmaEngine_McdmaOps;
+	Engine->NumChans = 0U;
+
+	Caps = XDMAENGINE_CAP_SG;
+	if (InstancePtr->Config.IsTxCacheCoherent != 0U) {
+		Caps |= XDMAENGINE_CAP_COHERENT;
+	}
+	for (Index = 1U; Index <= NumTx; Index++) {
+		Chan = &Engine->Chans[Engine->NumChans];
+		Chan->Direction = XDMAENGINE_MEM_TO_DEV;
+		Chan->Caps = Caps;
+		Chan->HwId = Index;
+		Chan->HwChan = XMcdma_GetMcdmaTxChan(InstancePtr, Index);
+		Engine->NumChans++;
+	}
+
+	Caps = XDMAENGINE_CAP_SG;
+	if (InstancePtr->Config.IsRxCacheCoherent != 0U) {
+		Caps |= XDMAENGINE_CAP_COHERENT;
+	}
+	for (Index = 1U; Index <= NumRx; Index++) {
+		Chan = &Engine->Chans[Engine->NumChans];
+		Chan->Direction = XDMAENGINE_DEV_TO_MEM;
+		Chan->Caps = Caps;
+		Chan->HwId = Index;
+		Chan->HwChan = XMcdma_GetMcdmaRxChan(InstancePtr, Index);
+		Engine->NumChans++;
+	}
+
+	return XDmaEngine_Register(Engine);
+}
+
+/*****************************************************************************/
+/**
+ * This function returns the number of BDs the driver uses for a segment.
+ *
+ * @param ChanPtr is the MCDMA channel.
+ * @param Length is the length of the segment.
+ *
+ * @return The number of BDs.
+ *
+ ****************************************************************************/
+static u32 XDmaEngine_McdmaBds(const XMcdma_ChanCtrl *ChanPtr, u32 Length)
+{
+	return (u32)(((u64)Length + ChanPtr->MaxTransferLen - 1U) /
+		     ChanPtr->MaxTransferLen);
+}
+
+/*****************************************************************************/
+/**
+ * This function checks that a transaction fits the BD chain of a channel.
+ *
+ * @param Chan is the channel.
+ * @param Txn is the transaction.
+ *
+ * @return XST_SUCCESS, or XST_INVALID_PARAM if the transaction needs more
+ *	   BDs than the chain has.
+ *
+ ****************************************************************************/
+static s32 XDmaEngine_McdmaPrep(XDmaEngine_Chan *Chan, XDmaEngine_Txn *Txn)
+{
+	XMcdma_ChanCtrl *ChanPtr = (XMcdma_ChanCtrl *)Chan->HwChan;
+	u32 Total;
+	u64 NumBd = 0U;
+	u32 Index;
+
+	Total = ChanPtr->BdCnt + ChanPtr->BdPendingCnt + ChanPtr->BdSubmitCnt +
+		ChanPtr->BdDoneCnt;
+
+	for (Index = 0U; Index < Txn->NumSg; Index++) {
+		NumBd += XDmaEngine_McdmaBds(ChanPtr, Txn->Sg[Index].Length);
+	}
+
+	return (NumBd > Total) ? (s32)XST_INVALID_PARAM : (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function passes all segments of a transaction to the BD chain of a
+ * channel. The transaction waits for the chain to drain if it does not have
+ * enough free BDs.
+ *
+ * @param Chan is the channel.
+ * @param Txn is the transaction.
+ *
+ * @return XST_SUCCESS, XST_DEVICE_BUSY, or the error of the driver.
+ *
+ ****************************************************************************/
+static s32 XDmaEngine_McdmaStart(XDmaEngine_Chan *Chan, XDmaEngine_Txn *Txn)
+{
+	XMcdma_ChanCtrl *ChanPtr = (XMcdma_ChanCtrl *)Chan->HwChan;
+	XMcdma_Bd *FirstBdPtr = ChanPtr->BdRestart;
+	UINTPTR Addr;
+	u32 NumBd = 0U;
+	u32 Ctrl;
+	u32 Index;
+	u32 Status;
+
+	for (Index = 0U; Index < Txn->NumSg; Index++) {
+		NumBd += XDmaEngine_McdmaBds(ChanPtr, Txn->Sg[Index].Length);
+	}
+	if (NumBd > ChanPtr->BdCnt) {
+		return (s32)XST_DEVICE_BUSY;
+	}
+
+	for (Index = 0U; Index < Txn->NumSg; Index++) {
+		Addr = (Chan->Direction == XDMAENGINE_MEM_TO_DEV) ?
+			Txn->Sg[Index].SrcAddr : Txn->Sg[Index].DstAddr;
+		Status = XMcDma_ChanSubmit(ChanPtr, Addr, Txn->Sg[Index].Length);
+		if (Status != (u32)XST_SUCCESS) {
+			return (s32)Status;
+		}
+	}
+
+	if (Chan->Direction == XDMAENGINE_MEM_TO_DEV) {
+		Ctrl = XMCDMA_BD_CTRL_SOF_MASK;
+		if (FirstBdPtr == ChanPtr->BdTail) {
+			Ctrl |= XMCDMA_BD_CTRL_EOF_MASK;
+		} else {
+			XMcDma_BdSetCtrl(ChanPtr->BdTail,
+					 XMCDMA_BD_CTRL_EOF_MASK);
+			XMCDMA_CACHE_FLUSH((UINTPTR)ChanPtr->BdTail);
+		}
+		XMcDma_BdSetCtrl(FirstBdPtr, Ctrl);
+		XMCDMA_CACHE_FLUSH((UINTPTR)FirstBdPtr);
+	}
+
+	Status = XMcDma_ChanToHw(ChanPtr);
+	if (Status != (u32)XST_SUCCESS) {
+		return (s32)Status;
+	}
+
+	Txn->Issued = Txn->NumSg;
+	Txn->Units += NumBd;
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function collects the completed BDs of a channel and credits them to
+ * the transactions in submission order. The channel halts on a BD error, so
+ * BDs from the first failed one on are reported as failed.
+ *
+ * @param Chan is the channel.
+ *
+ * @return None
+ *
+ ****************************************************************************/
+static void XDmaEngine_McdmaPoll(XDmaEngine_Chan *Chan)
+{
+	XMcdma_ChanCtrl *ChanPtr = (XMcdma_ChanCtrl *)Chan->HwChan;
+	XMcdma_Bd *BdSetPtr;
+	XMcdma_Bd *BdPtr;
+	u32 Offset;
+	u32 Good;
+	int NumBd;
+
+	NumBd = XMcdma_BdChainFromHW(ChanPtr, ChanPtr->BdSubmitCnt, &BdSetPtr);
+	if (NumBd <= 0) {
+		return;
+	}
+
+	Offset = (ChanPtr->IsRxChan != 0U) ? XMCDMA_BD_STS_OFFSET :
+		XMCDMA_BD_SIDEBAND_STS_OFFSET;
+
+	BdPtr = BdSetPtr;
+	for (Good = 0U; Good < (u32)NumBd; Good++) {
+		if ((XMcdma_BdRead(BdPtr, Offset) &
+		     XMCDMA_BD_STS_ALL_ERR_MASK) != 0U) {
+			break;
+		}
+		BdPtr = (XMcdma_Bd *)XMcdma_BdChainNextBd(ChanPtr, BdPtr);
+	}
+
+	/* Free the BDs first, the callbacks may submit new ones */
+	(void)XMcdma_BdChainFree(ChanPtr, NumBd, BdSetPtr);
+
+	if (Good != 0U) {
+		XDmaEngine_Complete(Chan, NULL, Good, (s32)XST_SUCCESS);
+	}
+	if (Good != (u32)NumBd) {
+		XDmaEngine_Complete(Chan, NULL, (u32)NumBd - Good,
+				    (s32)XST_DMA_ERROR);
+	}
+}
+
+#endif /* XPAR_XMCDMA_NUM_INSTANCES */
+/** @} */
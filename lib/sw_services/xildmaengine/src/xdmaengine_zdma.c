@@ -0,0 +1,191 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xdmaengine_zdma.c
+ * @addtogroup xildmaengine Overview
+ * @{
+ *
+ * This file contains the ZDMA backend of the XilDmaEngine library.
+ *
+ * The backend is bound to a ZDMA job queue rather than to one ZDMA channel,
+ * so that all channels of the queue serve one XDMAENGINE_MEM_TO_MEM channel.
+ * Every segment is one job of the queue. Jobs can complete out of order
+ * when the queue has several channels, a transaction completes once all
+ * its jobs did.
+ *
+ * Completions are taken from XZDma_IntrHandler() of the channels, or from
+ * XDmaEngine_Poll() without interrupts.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.0   ag   10/14/26 First release
+ * </pre>
+ *
+ *****************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xdmaengine.h"
+
+#ifdef XPAR_XZDMA_NUM_INSTANCES
+
+/************************** Function Prototypes ******************************/
+static s32 XDmaEngine_ZDmaPrep(XDmaEngine_Chan *Chan, XDmaEngine_Txn *Txn);
+static s32 XDmaEngine_ZDmaStart(XDmaEngine_Chan *Chan, XDmaEngine_Txn *Txn);
+static void XDmaEngine_ZDmaPoll(XDmaEngine_Chan *Chan);
+static void XDmaEngine_ZDmaDone(void *CallBackRef, s32 Status);
+
+/************************** Variable Definitions *****************************/
+static const XDmaEngine_Ops XDmaEngine_ZDmaOps = {
+	XDmaEngine_ZDmaPrep,
+	XDmaEngine_ZDmaStart,
+	XDmaEngine_ZDmaPoll,
+	0U
+};
+
+/*****************************************************************************/
+/**
+ * This function binds a ZDMA job queue to the library. The channel is cache
+ * coherent if all channels of the queue are.
+ *
+ * @param Engine is the engine to set up.
+ * @param QueuePtr is the job queue, its channels must be added.
+ *
+ * @return XST_SUCCESS, or the error of XDmaEngine_Register().
+ *
+ ****************************************************************************/
+s32 XDmaEngine_BindZDma(XDmaEngine *Engine, XZDma_Queue *QueuePtr)
+{
+	XDmaEngine_Chan *Chan;
+	u32 Index;
+
+	Xil_AssertNonvoid(Engine != NULL);
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(QueuePtr->NumChans != 0U);
+
+	Chan = &Engine->Chans[0];
+
+	Engine->Type = XDMAENGINE_TYPE_ZDMA;
+	Engine->InstancePtr = QueuePtr;
+	Engine->Ops = &XDmaEngine_ZDmaOps;
+	Engine->NumChans = 1U;
+
+	Chan->Direction = XDMAENGINE_MEM_TO_MEM;
+	Chan->Caps = XDMAENGINE_CAP_SG | XDMAENGINE_CAP_COHERENT;
+	Chan->HwId = 0U;
+	Chan->HwChan = QueuePtr;
+
+	for (Index = 0U; Index < QueuePtr->NumChans; Index++) {
+		if (QueuePtr->Chan[Index].InstancePtr->Config.IsCacheCoherent ==
+		    0U) {
+			Chan->Caps &= ~XDMAENGINE_CAP_COHERENT;
+		}
+	}
+
+	return XDmaEngine_Register(Engine);
+}
+
+/*****************************************************************************/
+/**
+ * This function checks the segments of a transaction against the size
+ * field of the ZDMA descriptors.
+ *
+ * @param Chan is the channel.
+ * @param Txn is the transaction.
+ *
+ * @return XST_SUCCESS, or XST_INVALID_PARAM if a segment is too long.
+ *
+ ****************************************************************************/
+static s32 XDmaEngine_ZDmaPrep(XDmaEngine_Chan *Chan, XDmaEngine_Txn *Txn)
+{
+	u32 Index;
+
+	(void)Chan;
+
+	for (Index = 0U; Index < Txn->NumSg; Index++) {
+		if (Txn->Sg[Index].Length > XZDMA_WORD2_SIZE_MASK) {
+			return (s32)XST_INVALID_PARAM;
+		}
+	}
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function queues the segments of a transaction from Txn->Issued on,
+ * as far as the job queue has room.
+ *
+ * @param Chan is the channel.
+ * @param Txn is the transaction.
+ *
+ * @return XST_SUCCESS, XST_DEVICE_BUSY, or the error of the driver.
+ *
+ ****************************************************************************/
+static s32 XDmaEngine_ZDmaStart(XDmaEngine_Chan *Chan, XDmaEngine_Txn *Txn)
+{
+	XZDma_Queue *QueuePtr = (XZDma_Queue *)Chan->HwChan;
+	const XDmaEngine_Sg *Sg;
+	s32 Status;
+
+	while (Txn->Issued < Txn->NumSg) {
+		Sg = &Txn->Sg[Txn->Issued];
+
+		Status = XZDma_QueueEnqueue(QueuePtr, Sg->SrcAddr, Sg->DstAddr,
+					    Sg->Length, XDmaEngine_ZDmaDone,
+					    Txn);
+		if (Status == XST_FAILURE) {
+			/* Queue is full */
+			return (s32)XST_DEVICE_BUSY;
+		}
+		if (Status != XST_SUCCESS) {
+			return Status;
+		}
+
+		Txn->Issued++;
+		Txn->Units++;
+	}
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function collects the completed jobs of the queue.
+ *
+ * @param Chan is the channel.
+ *
+ * @return None
+ *
+ ****************************************************************************/
+static void XDmaEngine_ZDmaPoll(XDmaEngine_Chan *Chan)
+{
+	(void)XZDma_QueuePoll((XZDma_Queue *)Chan->HwChan);
+}
+
+/*****************************************************************************/
+/**
+ * This function is the completion callback of a job.
+ *
+ * @param CallBackRef is the transaction of the job.
+ * @param Status is the status of the job.
+ *
+ * @return None
+ *
+ ****************************************************************************/
+static void XDmaEngine_ZDmaDone(void *CallBackRef, s32 Status)
+{
+	XDmaEngine_Txn *Txn = (XDmaEngine_Txn *)CallBackRef;
+
+	XDmaEngine_Complete(Txn->Chan, Txn, 1U, Status);
+}
+
+#endif /* XPAR_XZDMA_NUM_INSTANCES */
+/** @} */
@@ -88,12 +88,25 @@ proc xgen_opts_file {libhandle} {
 	set use_lfn [common::get_property CONFIG.use_lfn $libhandle]
 	set use_mkfs [common::get_property CONFIG.use_mkfs $libhandle]
 	set use_trim [common::get_property CONFIG.use_trim $libhandle]
+	set direct_io [common::get_property CONFIG.direct_io $libhandle]
+	set sector_size [common::get_property CONFIG.sector_size $libhandle]
+	set use_fastseek [common::get_property CONFIG.use_fastseek $libhandle]
+	set fastseek_threshold [common::get_property CONFIG.fastseek_threshold $libhandle]
+	set fastseek_tables [common::get_property CONFIG.fastseek_tables $libhandle]
+	set fastseek_table_size [common::get_property CONFIG.fastseek_table_size $libhandle]
 	set enable_multi_partition [common::get_property CONFIG.enable_multi_partition $libhandle]
 	set num_logical_vol [common::get_property CONFIG.num_logical_vol $libhandle]
 	set use_strfunc [common::get_property CONFIG.use_strfunc $libhandle]
 	set set_fs_rpath [common::get_property CONFIG.set_fs_rpath $libhandle]
 	set word_access [common::get_property CONFIG.word_access $libhandle]
 	set use_chmod [common::get_property CONFIG.use_chmod $libhandle]
+	set use_xil_pool [common::get_property CONFIG.use_xil_pool $libhandle]
+	set enable_reentrant [common::get_property CONFIG.enable_reentrant $libhandle]
+	set fs_timeout [common::get_property CONFIG.fs_timeout $libhandle]
+	set cache_sectors [common::get_property CONFIG.cache_sectors $libhandle]
+	set cache_read_ahead [common::get_property CONFIG.cache_read_ahead $libhandle]
+	set cache_write_back [common::get_property CONFIG.cache_write_back $libhandle]
+	set cache_pin_fat [common::get_property CONFIG.cache_pin_fat $libhandle]
 
 	# do processor specific checks
 	set proc  [hsi::get_sw_processor];
@@ -144,6 +157,11 @@ proc xgen_opts_file {libhandle} {
 			puts $file_handle "\#define FILE_SYSTEM_FS_EXFAT"
 			set use_lfn 1
 		}
+		if {$enable_reentrant == true && $use_lfn == 1} {
+			puts "WARNING : Static LFN buffer can not be used when reentrant\
+					Setting back the LFN buffer to the stack (2)\n"
+			set use_lfn 2
+		}
 		if {$use_lfn > 0 && $use_lfn < 4} {
 			puts $file_handle "\#define FILE_SYSTEM_USE_LFN $use_lfn"
 		}
@@ -164,6 +182,35 @@ proc xgen_opts_file {libhandle} {
 		if {$use_trim == true} {
 			puts $file_handle "\#define FILE_SYSTEM_USE_TRIM"
 		}
+		if {$direct_io == true} {
+			puts $file_handle "\#define FILE_SYSTEM_DIRECT_IO"
+		}
+		if {$sector_size != 512} {
+			if {$fs_interface != 1 || ($sector_size != 1024 && $sector_size != 2048 && $sector_size != 4096)} {
+				puts "WARNING : Invalid sector size or interface for it, setting \
+						back to 512\n"
+			} else {
+				puts $file_handle "\#define FILE_SYSTEM_SECTOR_SIZE $sector_size"
+			}
+		}
+		if {$use_fastseek == true} {
+			puts $file_handle "\#define FILE_SYSTEM_USE_FASTSEEK"
+			if {$fastseek_threshold > 0} {
+				if {$fastseek_tables < 1} {
+					puts "WARNING : Fast seek pool needs at least 1 table\
+							Setting back the num of tables to 1\n"
+					set fastseek_tables 1
+				}
+				if {$fastseek_table_size < 4} {
+					puts "WARNING : Fast seek table needs at least 4 items\
+							Setting back the table size to 4\n"
+					set fastseek_table_size 4
+				}
+				puts $file_handle "\#define FILE_SYSTEM_FASTSEEK_THRESHOLD $fastseek_threshold"
+				puts $file_handle "\#define FILE_SYSTEM_FASTSEEK_TABLES $fastseek_tables"
+				puts $file_handle "\#define FILE_SYSTEM_FASTSEEK_TBL_SIZE $fastseek_table_size"
+			}
+		}
 		if {$num_logical_vol > 10} {
 			puts "WARNING : File System supports only up to 10 logical drives\
 					Setting back the num of vol to 10\n"
@@ -183,6 +230,61 @@ proc xgen_opts_file {libhandle} {
 		}
 		puts $file_handle "\#define FILE_SYSTEM_SET_FS_RPATH $set_fs_rpath"
 
+		if {$fs_interface == 1 && $cache_sectors > 0} {
+			if {$cache_sectors < 2} {
+				puts "WARNING : Block cache needs at least 2 sectors\
+						Setting back the cache sectors to 2\n"
+				set cache_sectors 2
+			}
+			puts $file_handle "\#define FILE_SYSTEM_CACHE_SECTORS $cache_sectors"
+			# Each drive has its own half of the cache when reentrant
+			set cache_parts 1
+			if {$enable_reentrant == true} {
+				set cache_parts 2
+			}
+			set max_read_ahead [expr $cache_sectors / (2 * $cache_parts)]
+			if {$cache_read_ahead > $max_read_ahead} {
+				puts "WARNING : Read-ahead can not exceed half of the cache\
+						Setting back the read-ahead to $max_read_ahead\n"
+				set cache_read_ahead $max_read_ahead
+			}
+			if {$cache_read_ahead > 1} {
+				puts $file_handle "\#define FILE_SYSTEM_CACHE_READ_AHEAD $cache_read_ahead"
+			}
+			if {$cache_write_back == true} {
+				puts $file_handle "\#define FILE_SYSTEM_CACHE_WRITE_BACK"
+			}
+			if {$cache_pin_fat == true} {
+				puts $file_handle "\#define FILE_SYSTEM_CACHE_PIN_FAT"
+			}
+		}
+
+		if {$enable_reentrant == true} {
+			set os_name [common::get_property NAME [hsi::get_os]]
+			if { [string compare -nocase "freertos10_xilinx" $os_name] != 0} {
+				error "ERROR: Reentrant xilffs requires \"freertos\" OS" "" "mdt_error"
+			}
+			puts $file_handle "\#define FILE_SYSTEM_REENTRANT"
+			puts $file_handle "\#define FILE_SYSTEM_FS_TIMEOUT $fs_timeout"
+
+			# Interrupts of the SD controllers, in the order of the drives
+			if {$fs_interface == 1} {
+				set sw_processor [hsi::get_sw_processor]
+				set processor [hsi::get_cells -hier [common::get_property HW_INSTANCE $sw_processor]]
+				set sd_intr_ids {}
+				foreach periph [get_ffs_periphs $processor] {
+					if {[string match "*1" $periph]} {
+						lappend sd_intr_ids "XPS_SDIO1_INT_ID"
+					} else {
+						lappend sd_intr_ids "XPS_SDIO0_INT_ID"
+					}
+				}
+				if {[llength $sd_intr_ids] > 0} {
+					puts $file_handle "\#define FILE_SYSTEM_SD_INTR_IDS {[join $sd_intr_ids ", "]}"
+				}
+			}
+		}
+
 		# MB does not allow word access from RAM
 		if {$proc_type != "microblaze" && $word_access == true} {
 			puts $file_handle "\#define FILE_SYSTEM_WORD_ACCESS"
@@ -191,6 +293,10 @@ proc xgen_opts_file {libhandle} {
 		error  "ERROR: Invalid interface selected \n"
 	}
 
+	if {$use_xil_pool == true} {
+		puts $file_handle "\#define FILE_SYSTEM_USE_XIL_POOL"
+	}
+
 	close $file_handle
 
 	# Copy the include files to the include directory
@@ -29,6 +29,12 @@
 *		write files using ADMA2 in polled mode.
 *		The file system can be used to read from and write to an
 *		SD card that is already formatted as FATFS.
+*		With FF_CACHE_SECTORS set in ffconf.h, single sector
+*		reads and writes go through an LRU block cache, with
+*		optional read-ahead, write-back and FAT pinning.
+*		With FF_FS_REENTRANT (FreeRTOS), each SD drive has its own
+*		lock and its transfers complete from the interrupt of its
+*		controller, so transfers on different drives overlap.
 *
 * <pre>
 * MODIFICATION HISTORY:
@@ -66,6 +72,12 @@
 * 4.5   sk   03/31/21 Maintain discrete global variables for each controller.
 * 4.6   sk   07/20/21 Fixed compilation warning in RAM interface.
 * 4.8   sk   05/05/22 Replace standard lib functions with Xilinx functions.
+*       ag   10/14/26 Added an optional LRU block cache with read-ahead,
+*                     write-back and FAT pinning for the SD interface.
+*       ag   10/14/26 Added per drive locks and interrupt driven transfers
+*                     for FF_FS_REENTRANT on FreeRTOS.
+*       ag   10/14/26 Split large transfers at the ADMA2 table size and
+*                     support logical sectors larger than the card blocks.
 *
 * </pre>
 *
@@ -78,6 +90,9 @@
 
 #ifdef FILE_SYSTEM_INTERFACE_SD
 #include "xsdps.h"		/* SD device driver */
+#if FF_FS_REENTRANT
+#include "xparameters_ps.h"	/* Interrupt IDs of the SD controllers */
+#endif
 #endif
 #include "sleep.h"
 #include "xil_printf.h"
@@ -86,6 +101,13 @@
 #define SD_CD_DELAY		10000U
 #define XSDPS_NUM_INSTANCES	2
 
+#ifdef FILE_SYSTEM_INTERFACE_SD
+/* 512 byte blocks of the card in a FatFs sector */
+#define SD_BLKS_PER_SS		((u32)FF_MAX_SS / XSDPS_BLK_SIZE_512_MASK)
+/* Blocks of one transfer, 32 ADMA2 descriptors of 64 KiB in the driver */
+#define SD_XFER_MAX_BLKS	((32U * XSDPS_DESC_MAX_LENGTH) / XSDPS_BLK_SIZE_512_MASK)
+#endif
+
 #ifdef FILE_SYSTEM_INTERFACE_RAM
 #include "xparameters.h"
 
@@ -114,6 +136,705 @@ static u32 CardDetect[XSDPS_NUM_INSTANCES];
 static u32 WriteProtect[XSDPS_NUM_INSTANCES];
 static u32 SlotType[XSDPS_NUM_INSTANCES];
 static u8 HostCntrlrVer[XSDPS_NUM_INSTANCES];
+
+#if FF_FS_REENTRANT
+/*
+ * Interrupt IDs of the controllers of the drives, the xilffs tcl sets them
+ * from the SD controllers of the design
+ */
+#ifndef FILE_SYSTEM_SD_INTR_IDS
+#define FILE_SYSTEM_SD_INTR_IDS	{XPS_SDIO0_INT_ID, XPS_SDIO1_INT_ID}
+#endif
+static const u16 SdIntrId[XSDPS_NUM_INSTANCES] = FILE_SYSTEM_SD_INTR_IDS;
+static SemaphoreHandle_t DrvLock[XSDPS_NUM_INSTANCES];	/* Serializes the drive */
+static SemaphoreHandle_t DrvDone[XSDPS_NUM_INSTANCES];	/* Given on transfer completion */
+
+#define SD_LOCK(pdrv)		sd_lock(pdrv)
+#define SD_UNLOCK(pdrv)		(void)xSemaphoreGive(DrvLock[(pdrv)])
+#else
+#define SD_LOCK(pdrv)		RES_OK
+#define SD_UNLOCK(pdrv)
+#endif
+#endif
+
+#if defined(FILE_SYSTEM_INTERFACE_SD) && (FF_CACHE_SECTORS > 0)
+#if FF_CACHE_SECTORS < 2
+#error "FF_CACHE_SECTORS must be 0 or at least 2"
+#endif
+
+/*
+ * With FF_FS_REENTRANT, each drive gets its own part of the cache, so that
+ * drives are accessed concurrently under their own lock.
+ */
+#if FF_FS_REENTRANT
+#define CACHE_PARTS		XSDPS_NUM_INSTANCES
+#define CACHE_PART(pdrv)	((UINT)(pdrv))
+#else
+#define CACHE_PARTS		1
+#define CACHE_PART(pdrv)	0U
+#endif
+#define CACHE_PART_SIZE		((UINT)FF_CACHE_SECTORS / (UINT)CACHE_PARTS)
+#define CACHE_FIRST(pdrv)	(CACHE_PART(pdrv) * CACHE_PART_SIZE)
+#define CACHE_END(pdrv)		(CACHE_FIRST(pdrv) + CACHE_PART_SIZE)
+
+#if (FF_CACHE_READ_AHEAD * 2 * CACHE_PARTS) > FF_CACHE_SECTORS
+#error "FF_CACHE_READ_AHEAD must not exceed half of FF_CACHE_SECTORS (per drive with FF_FS_REENTRANT)"
+#endif
+
+#define CACHE_SS		((UINT)FF_MAX_SS)
+#define CACHE_NONE		((UINT)FF_CACHE_SECTORS)	/* No cache entry */
+#define CACHE_PIN_MAX		(CACHE_PART_SIZE / 2U)
+
+/*
+ * Block cache entry, the data of entry n is CacheData[n]
+ */
+typedef struct {
+	DWORD Sector;	/* Cached sector (LBA) */
+	u32 Stamp;	/* Last use, for LRU replacement */
+	BYTE Drv;	/* Physical drive of the sector */
+	BYTE Valid;	/* Data is valid */
+	BYTE Dirty;	/* Data is newer than the disk */
+	BYTE Pinned;	/* FAT sector, evicted last */
+} CacheEntry;
+
+static CacheEntry Cache[FF_CACHE_SECTORS];
+static BYTE CacheData[FF_CACHE_SECTORS][FF_MAX_SS] __attribute__ ((aligned(64)));
+static u32 CacheStamp[CACHE_PARTS];
+
+#if FF_CACHE_READ_AHEAD > 1
+static BYTE CacheStage[CACHE_PARTS][FF_CACHE_READ_AHEAD][FF_MAX_SS] __attribute__ ((aligned(64)));
+static DWORD CacheNext[XSDPS_NUM_INSTANCES];	/* Sector after the last single sector read */
+#endif
+
+#if FF_CACHE_PIN_FAT
+static DWORD FatStart[XSDPS_NUM_INSTANCES];	/* FAT region of the drive */
+static DWORD FatEnd[XSDPS_NUM_INSTANCES];
+static UINT CachePinned[CACHE_PARTS];
+#endif
+#endif
+
+#if defined(FILE_SYSTEM_INTERFACE_SD) && FF_FS_REENTRANT
+/*****************************************************************************/
+/**
+*
+* Takes the lock of a drive, the lock and the completion semaphore of the
+* drive are created on first use.
+*
+* @param	pdrv - Drive number
+*
+* @return	RES_OK or RES_ERROR
+*
+******************************************************************************/
+static DRESULT sd_lock (BYTE pdrv)
+{
+	if (DrvLock[pdrv] == NULL) {
+		vTaskSuspendAll();
+		if (DrvLock[pdrv] == NULL) {
+			DrvDone[pdrv] = xSemaphoreCreateBinary();
+			if (DrvDone[pdrv] != NULL) {
+				DrvLock[pdrv] = xSemaphoreCreateMutex();
+			}
+		}
+		(void)xTaskResumeAll();
+		if (DrvLock[pdrv] == NULL) {
+			return RES_ERROR;
+		}
+	}
+
+	if (xSemaphoreTake(DrvLock[pdrv], FF_FS_TIMEOUT) != pdTRUE) {
+		return RES_ERROR;
+	}
+
+	return RES_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* Completion handler of the SD requests, called from XSdPs_IntrHandler().
+*
+* @param	CallBackRef - Completion semaphore of the drive
+* @param	ReqPtr - Completed request
+*
+* @return	None
+*
+******************************************************************************/
+static void sd_req_done (void *CallBackRef, XSdPs_Req *ReqPtr)
+{
+	BaseType_t Woken = pdFALSE;
+
+	(void)ReqPtr;
+
+	(void)xSemaphoreGiveFromISR((SemaphoreHandle_t)CallBackRef, &Woken);
+	portYIELD_FROM_ISR(Woken);
+}
+
+/*****************************************************************************/
+/**
+*
+* Transfers sectors with an interrupt driven request, the calling task
+* blocks until the transfer is done while other drives and tasks run.
+*
+* @param	pdrv - Drive number
+* @param	*buff - Pointer to the data buffer
+* @param	Arg - Block or byte address, as for XSdPs_ReadPolled()
+* @param	count - Sector count
+* @param	Dir - XSDPS_REQ_READ or XSDPS_REQ_WRITE
+*
+* @return	XST_SUCCESS or XST_FAILURE
+*
+******************************************************************************/
+static s32 sd_xfer (BYTE pdrv, BYTE *buff, u32 Arg, UINT count, u8 Dir)
+{
+	XSdPs_Req Req;
+
+	Req.Arg = Arg;
+	Req.BlkCnt = (u32)count;
+	Req.Buff = buff;
+	Req.Dir = Dir;
+	Req.Handler = sd_req_done;
+	Req.CallBackRef = (void *)DrvDone[pdrv];
+
+	if (XSdPs_SubmitReq(&SdInstance[pdrv], &Req) != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+	(void)xSemaphoreTake(DrvDone[pdrv], portMAX_DELAY);
+
+	return Req.Status;
+}
+#endif
+
+#ifdef FILE_SYSTEM_INTERFACE_SD
+/*****************************************************************************/
+/**
+*
+* Reads sectors from the SD card using ADMA2, in polled mode or, with
+* FF_FS_REENTRANT, with an interrupt driven request. Large reads are
+* split at the size of the ADMA2 descriptor table of the driver.
+*
+* @param	pdrv - Drive number
+* @param	*buff - Pointer to the data buffer to store read data
+* @param	sector - Start sector number
+* @param	count - Sector count
+*
+* @return	RES_OK or RES_ERROR
+*
+******************************************************************************/
+static DRESULT sd_read (BYTE pdrv, BYTE *buff, DWORD sector, UINT count)
+{
+	s32 Status;
+	DWORD LocSector;
+	DWORD Blk = sector * SD_BLKS_PER_SS;
+	u32 BlkLeft = (u32)count * SD_BLKS_PER_SS;
+	u32 BlkCnt;
+	BYTE *LocBuff = buff;
+
+	while (BlkLeft > 0U) {
+		BlkCnt = (BlkLeft > SD_XFER_MAX_BLKS) ? SD_XFER_MAX_BLKS : BlkLeft;
+
+		/* Convert LBA to byte address if needed */
+		LocSector = Blk;
+		if ((SdInstance[pdrv].HCS) == 0U) {
+			LocSector *= (DWORD)XSDPS_BLK_SIZE_512_MASK;
+		}
+
+#if FF_FS_REENTRANT
+		Status = sd_xfer(pdrv, LocBuff, (u32)LocSector, BlkCnt, XSDPS_REQ_READ);
+#else
+		Status  = XSdPs_ReadPolled(&SdInstance[pdrv], (u32)LocSector, BlkCnt, LocBuff);
+#endif
+		if (Status != XST_SUCCESS) {
+			return RES_ERROR;
+		}
+
+		LocBuff += BlkCnt * XSDPS_BLK_SIZE_512_MASK;
+		Blk += BlkCnt;
+		BlkLeft -= BlkCnt;
+	}
+
+	return RES_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* Writes sectors to the SD card using ADMA2, in polled mode or, with
+* FF_FS_REENTRANT, with an interrupt driven request. Large writes are
+* split at the size of the ADMA2 descriptor table of the driver.
+*
+* @param	pdrv - Drive number
+* @param	*buff - Pointer to the data to be written
+* @param	sector - Start sector number
+* @param	count - Sector count
+*
+* @return	RES_OK or RES_ERROR
+*
+******************************************************************************/
+static DRESULT sd_write (BYTE pdrv, const BYTE *buff, DWORD sector, UINT count)
+{
+	s32 Status;
+	DWORD LocSector;
+	DWORD Blk = sector * SD_BLKS_PER_SS;
+	u32 BlkLeft = (u32)count * SD_BLKS_PER_SS;
+	u32 BlkCnt;
+	const BYTE *LocBuff = buff;
+
+	while (BlkLeft > 0U) {
+		BlkCnt = (BlkLeft > SD_XFER_MAX_BLKS) ? SD_XFER_MAX_BLKS : BlkLeft;
+
+		/* Convert LBA to byte address if needed */
+		LocSector = Blk;
+		if ((SdInstance[pdrv].HCS) == 0U) {
+			LocSector *= (DWORD)XSDPS_BLK_SIZE_512_MASK;
+		}
+
+#if FF_FS_REENTRANT
+		Status = sd_xfer(pdrv, (BYTE *)LocBuff, (u32)LocSector, BlkCnt, XSDPS_REQ_WRITE);
+#else
+		Status  = XSdPs_WritePolled(&SdInstance[pdrv], (u32)LocSector, BlkCnt, LocBuff);
+#endif
+		if (Status != XST_SUCCESS) {
+			return RES_ERROR;
+		}
+
+		LocBuff += BlkCnt * XSDPS_BLK_SIZE_512_MASK;
+		Blk += BlkCnt;
+		BlkLeft -= BlkCnt;
+	}
+
+	return RES_OK;
+}
+#endif
+
+#if defined(FILE_SYSTEM_INTERFACE_SD) && (FF_CACHE_SECTORS > 0)
+/*****************************************************************************/
+/**
+*
+* Looks up a sector in the block cache.
+*
+* @param	pdrv - Drive number
+* @param	sector - Sector number
+*
+* @return	Index of the cache entry, or CACHE_NONE if not cached
+*
+******************************************************************************/
+static UINT cache_find (BYTE pdrv, DWORD sector)
+{
+	UINT Index;
+
+	for (Index = CACHE_FIRST(pdrv); Index < CACHE_END(pdrv); Index++) {
+		if ((Cache[Index].Valid != 0U) && (Cache[Index].Drv == pdrv) &&
+		    (Cache[Index].Sector == sector)) {
+			return Index;
+		}
+	}
+
+	return CACHE_NONE;
+}
+
+/*****************************************************************************/
+/**
+*
+* Writes a dirty cache entry back to the disk.
+*
+* @param	Index - Cache entry
+*
+* @return	RES_OK or RES_ERROR
+*
+******************************************************************************/
+static DRESULT cache_clean (UINT Index)
+{
+	DRESULT res;
+
+	if ((Cache[Index].Valid == 0U) || (Cache[Index].Dirty == 0U)) {
+		return RES_OK;
+	}
+
+	res = sd_write(Cache[Index].Drv, CacheData[Index], Cache[Index].Sector, 1U);
+	if (res == RES_OK) {
+		Cache[Index].Dirty = 0U;
+	}
+
+	return res;
+}
+
+/*****************************************************************************/
+/**
+*
+* Drops a cache entry without writing it back.
+*
+* @param	Index - Cache entry
+*
+* @return	None
+*
+******************************************************************************/
+static void cache_drop (UINT Index)
+{
+#if FF_CACHE_PIN_FAT
+	if (Cache[Index].Pinned != 0U) {
+		CachePinned[CACHE_PART(Cache[Index].Drv)]--;
+	}
+#endif
+	Cache[Index].Valid = 0U;
+	Cache[Index].Dirty = 0U;
+	Cache[Index].Pinned = 0U;
+}
+
+#if FF_CACHE_PIN_FAT
+/*****************************************************************************/
+/**
+*
+* Records the FAT region of a drive if the sector is a FAT or exFAT boot
+* sector.
+*
+* @param	pdrv - Drive number
+* @param	sector - Sector number
+* @param	*Data - Pointer to the sector data
+*
+* @return	None
+*
+******************************************************************************/
+static void cache_check_vbr (BYTE pdrv, DWORD sector, const BYTE *Data)
+{
+	DWORD Start;
+	DWORD Size;
+
+	if ((Data[510] != 0x55U) || (Data[511] != 0xAAU)) {
+		return;
+	}
+
+	if (Xil_SMemCmp(&Data[3], 8U, "EXFAT   ", 8U, 8U) == 0) {
+		Start = (DWORD)Data[80] | ((DWORD)Data[81] << 8U) |
+			((DWORD)Data[82] << 16U) | ((DWORD)Data[83] << 24U);
+		Size = (DWORD)Data[84] | ((DWORD)Data[85] << 8U) |
+			((DWORD)Data[86] << 16U) | ((DWORD)Data[87] << 24U);
+		Size *= (DWORD)Data[110];
+	} else if (((Data[0] == 0xEBU) || (Data[0] == 0xE9U) || (Data[0] == 0xE8U)) &&
+		   ((((UINT)Data[12] << 8U) | (UINT)Data[11]) == CACHE_SS) &&
+		   ((Data[16] == 1U) || (Data[16] == 2U))) {
+		Start = (DWORD)Data[14] | ((DWORD)Data[15] << 8U);
+		Size = (DWORD)Data[22] | ((DWORD)Data[23] << 8U);
+		if (Size == 0U) {
+			Size = (DWORD)Data[36] | ((DWORD)Data[37] << 8U) |
+				((DWORD)Data[38] << 16U) | ((DWORD)Data[39] << 24U);
+		}
+		Size *= (DWORD)Data[16];
+	} else {
+		return;
+	}
+
+	FatStart[pdrv] = sector + Start;
+	FatEnd[pdrv] = FatStart[pdrv] + Size;
+}
+#endif
+
+/*****************************************************************************/
+/**
+*
+* Allocates a cache entry for a sector. An invalid entry is taken first,
+* then the least recently used unpinned entry, then the least recently
+* used pinned entry. A dirty victim is written back.
+* The entry is returned invalid, the caller fills in the data.
+*
+* @param	pdrv - Drive number
+* @param	sector - Sector number
+* @param	*IndexPtr - Pointer to store the cache entry
+*
+* @return	RES_OK or RES_ERROR
+*
+******************************************************************************/
+static DRESULT cache_alloc (BYTE pdrv, DWORD sector, UINT *IndexPtr)
+{
+	UINT Index;
+	UINT Victim = CACHE_NONE;
+	UINT PinnedVictim = CACHE_NONE;
+	DRESULT res;
+
+	for (Index = CACHE_FIRST(pdrv); Index < CACHE_END(pdrv); Index++) {
+		if (Cache[Index].Valid == 0U) {
+			Victim = Index;
+			break;
+		}
+		if (Cache[Index].Pinned != 0U) {
+			if ((PinnedVictim == CACHE_NONE) ||
+			    ((s32)(Cache[Index].Stamp - Cache[PinnedVictim].Stamp) < 0)) {
+				PinnedVictim = Index;
+			}
+		} else if ((Victim == CACHE_NONE) ||
+			   ((s32)(Cache[Index].Stamp - Cache[Victim].Stamp) < 0)) {
+			Victim = Index;
+		}
+	}
+	if (Victim == CACHE_NONE) {
+		Victim = PinnedVictim;
+	}
+
+	res = cache_clean(Victim);
+	if (res != RES_OK) {
+		return res;
+	}
+	cache_drop(Victim);
+
+	Cache[Victim].Drv = pdrv;
+	Cache[Victim].Sector = sector;
+	Cache[Victim].Stamp = ++CacheStamp[CACHE_PART(pdrv)];
+#if FF_CACHE_PIN_FAT
+	if ((sector >= FatStart[pdrv]) && (sector < FatEnd[pdrv]) &&
+	    (CachePinned[CACHE_PART(pdrv)] < CACHE_PIN_MAX)) {
+		Cache[Victim].Pinned = 1U;
+		CachePinned[CACHE_PART(pdrv)]++;
+	}
+#endif
+
+	*IndexPtr = Victim;
+
+	return RES_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* Reads a sector missing from the cache into a new entry. If the previous
+* sector of the drive was the last one read, the following sectors up to
+* FF_CACHE_READ_AHEAD are read with it.
+*
+* @param	pdrv - Drive number
+* @param	sector - Sector number
+* @param	*IndexPtr - Pointer to store the cache entry of the sector
+*
+* @return	RES_OK or RES_ERROR
+*
+******************************************************************************/
+static DRESULT cache_fill (BYTE pdrv, DWORD sector, UINT *IndexPtr)
+{
+	UINT Index;
+	DRESULT res;
+#if FF_CACHE_READ_AHEAD > 1
+	UINT Num = 1U;
+	UINT Cnt;
+	DWORD MaxSectors = (DWORD)(SdInstance[pdrv].SectorCount / SD_BLKS_PER_SS);
+
+	if (sector == CacheNext[pdrv]) {
+		Num = (UINT)FF_CACHE_READ_AHEAD;
+		if ((MaxSectors != 0U) && (sector < MaxSectors) &&
+		    ((MaxSectors - sector) < (DWORD)Num)) {
+			Num = (UINT)(MaxSectors - sector);
+		}
+		/* Stop at the first sector already cached */
+		for (Cnt = 1U; Cnt < Num; Cnt++) {
+			if (cache_find(pdrv, sector + Cnt) != CACHE_NONE) {
+				Num = Cnt;
+				break;
+			}
+		}
+	}
+
+	if (Num > 1U) {
+		res = sd_read(pdrv, CacheStage[CACHE_PART(pdrv)][0], sector, Num);
+		if (res != RES_OK) {
+			return res;
+		}
+
+		/* The requested sector goes last, as most recently used */
+		for (Cnt = Num; Cnt > 0U; Cnt--) {
+			res = cache_alloc(pdrv, sector + Cnt - 1U, &Index);
+			if (res != RES_OK) {
+				return res;
+			}
+			(void)Xil_SMemCpy(CacheData[Index], CACHE_SS,
+					CacheStage[CACHE_PART(pdrv)][Cnt - 1U], CACHE_SS, CACHE_SS);
+			Cache[Index].Valid = 1U;
+		}
+#if FF_CACHE_PIN_FAT
+		cache_check_vbr(pdrv, sector, CacheData[Index]);
+#endif
+		*IndexPtr = Index;
+
+		return RES_OK;
+	}
+#endif
+
+	res = cache_alloc(pdrv, sector, &Index);
+	if (res != RES_OK) {
+		return res;
+	}
+
+	res = sd_read(pdrv, CacheData[Index], sector, 1U);
+	if (res != RES_OK) {
+		return res;
+	}
+	Cache[Index].Valid = 1U;
+#if FF_CACHE_PIN_FAT
+	cache_check_vbr(pdrv, sector, CacheData[Index]);
+#endif
+	*IndexPtr = Index;
+
+	return RES_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* Reads sectors through the block cache. A single sector is served from the
+* cache. Multiple sectors are read from the disk, the dirty cached sectors
+* among them are copied over the data read.
+*
+* @param	pdrv - Drive number
+* @param	*buff - Pointer to the data buffer to store read data
+* @param	sector - Start sector number
+* @param	count - Sector count
+*
+* @return	RES_OK or RES_ERROR
+*
+******************************************************************************/
+static DRESULT cache_read (BYTE pdrv, BYTE *buff, DWORD sector, UINT count)
+{
+	UINT Index;
+	DRESULT res;
+
+	if (count == 1U) {
+		Index = cache_find(pdrv, sector);
+		if (Index == CACHE_NONE) {
+			res = cache_fill(pdrv, sector, &Index);
+			if (res != RES_OK) {
+				return res;
+			}
+		}
+		Cache[Index].Stamp = ++CacheStamp[CACHE_PART(pdrv)];
+		(void)Xil_SMemCpy(buff, CACHE_SS, CacheData[Index], CACHE_SS, CACHE_SS);
+#if FF_CACHE_READ_AHEAD > 1
+		CacheNext[pdrv] = sector + 1U;
+#endif
+		return RES_OK;
+	}
+
+	res = sd_read(pdrv, buff, sector, count);
+	if (res != RES_OK) {
+		return res;
+	}
+
+	for (Index = CACHE_FIRST(pdrv); Index < CACHE_END(pdrv); Index++) {
+		if ((Cache[Index].Valid != 0U) && (Cache[Index].Dirty != 0U) &&
+		    (Cache[Index].Drv == pdrv) && (Cache[Index].Sector >= sector) &&
+		    ((Cache[Index].Sector - sector) < (DWORD)count)) {
+			(void)Xil_SMemCpy(buff + ((Cache[Index].Sector - sector) * CACHE_SS),
+					CACHE_SS, CacheData[Index], CACHE_SS, CACHE_SS);
+		}
+	}
+
+	return RES_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* Writes sectors through the block cache. With FF_CACHE_WRITE_BACK, a single
+* sector is only written to the cache. Otherwise the sectors are written to
+* the disk, a single sector is also cached and the cached sectors among
+* multiple ones are updated.
+*
+* @param	pdrv - Drive number
+* @param	*buff - Pointer to the data to be written
+* @param	sector - Start sector number
+* @param	count - Sector count
+*
+* @return	RES_OK or RES_ERROR
+*
+******************************************************************************/
+static DRESULT cache_write (BYTE pdrv, const BYTE *buff, DWORD sector, UINT count)
+{
+	UINT Index;
+	DRESULT res;
+
+	if (count == 1U) {
+#if !FF_CACHE_WRITE_BACK
+		res = sd_write(pdrv, buff, sector, 1U);
+		if (res != RES_OK) {
+			return res;
+		}
+#endif
+		Index = cache_find(pdrv, sector);
+		if (Index == CACHE_NONE) {
+			res = cache_alloc(pdrv, sector, &Index);
+			if (res != RES_OK) {
+				return res;
+			}
+		}
+		(void)Xil_SMemCpy(CacheData[Index], CACHE_SS, buff, CACHE_SS, CACHE_SS);
+		Cache[Index].Valid = 1U;
+		Cache[Index].Dirty = (BYTE)FF_CACHE_WRITE_BACK;
+		Cache[Index].Stamp = ++CacheStamp[CACHE_PART(pdrv)];
+
+		return RES_OK;
+	}
+
+	res = sd_write(pdrv, buff, sector, count);
+	if (res != RES_OK) {
+		return res;
+	}
+
+	for (Index = CACHE_FIRST(pdrv); Index < CACHE_END(pdrv); Index++) {
+		if ((Cache[Index].Valid != 0U) && (Cache[Index].Drv == pdrv) &&
+		    (Cache[Index].Sector >= sector) &&
+		    ((Cache[Index].Sector - sector) < (DWORD)count)) {
+			(void)Xil_SMemCpy(CacheData[Index], CACHE_SS,
+					buff + ((Cache[Index].Sector - sector) * CACHE_SS),
+					CACHE_SS, CACHE_SS);
+			Cache[Index].Dirty = 0U;
+		}
+	}
+
+	return RES_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* Writes the dirty cached sectors of a drive back to the disk.
+*
+* @param	pdrv - Drive number
+*
+* @return	RES_OK or RES_ERROR
+*
+******************************************************************************/
+static DRESULT cache_sync (BYTE pdrv)
+{
+	UINT Index;
+	DRESULT res = RES_OK;
+
+	for (Index = CACHE_FIRST(pdrv); Index < CACHE_END(pdrv); Index++) {
+		if ((Cache[Index].Drv == pdrv) && (cache_clean(Index) != RES_OK)) {
+			res = RES_ERROR;
+		}
+	}
+
+	return res;
+}
+
+/*****************************************************************************/
+/**
+*
+* Drops the cached sectors of a drive in a range, dirty ones included.
+*
+* @param	pdrv - Drive number
+* @param	sector - Start sector number
+* @param	count - Sector count, 0 for all sectors
+*
+* @return	None
+*
+******************************************************************************/
+static void cache_invalidate (BYTE pdrv, DWORD sector, DWORD count)
+{
+	UINT Index;
+
+	for (Index = CACHE_FIRST(pdrv); Index < CACHE_END(pdrv); Index++) {
+		if ((Cache[Index].Valid != 0U) && (Cache[Index].Drv == pdrv) &&
+		    ((count == 0U) || ((Cache[Index].Sector >= sector) &&
+		     ((Cache[Index].Sector - sector) < count)))) {
+			cache_drop(Index);
+		}
+	}
+}
 #endif
 
 /*-----------------------------------------------------------------------*/
@@ -277,22 +998,43 @@ DSTATUS disk_initialize (
 		return s;
 	}
 
+	if (SD_LOCK(pdrv) != RES_OK) {
+		s |= STA_NOINIT;
+		return s;
+	}
+
 	SdInstance[pdrv].IsReady = 0U;
 
 	Status = XSdPs_CfgInitialize(&SdInstance[pdrv], SdConfig,
 					SdConfig->BaseAddress);
-	if (Status != XST_SUCCESS) {
-		s |= STA_NOINIT;
-		return s;
+	if (Status == XST_SUCCESS) {
+		Status = XSdPs_CardInitialize(&SdInstance[pdrv]);
+	}
+#if FF_FS_REENTRANT
+	/* Complete the transfers of the drive from its interrupt */
+	if ((Status == XST_SUCCESS) &&
+	    (xPortInstallInterruptHandler(SdIntrId[pdrv],
+			(XInterruptHandler)XSdPs_IntrHandler,
+			&SdInstance[pdrv]) != pdPASS)) {
+		Status = XST_FAILURE;
+	}
+	if (Status == XST_SUCCESS) {
+		vPortEnableInterrupt(SdIntrId[pdrv]);
 	}
+#endif
+
+#if FF_CACHE_SECTORS > 0
+	/* The card may have changed, drop its cached sectors */
+	cache_invalidate(pdrv, 0U, 0U);
+#endif
+
+	SD_UNLOCK(pdrv);
 
-	Status = XSdPs_CardInitialize(&SdInstance[pdrv]);
 	if (Status != XST_SUCCESS) {
 		s |= STA_NOINIT;
 		return s;
 	}
 
-
 	/*
 	 * Disk is initialized.
 	 * Store the same in Stat.
@@ -346,8 +1088,7 @@ DRESULT disk_read (
 {
 	DSTATUS s;
 #ifdef FILE_SYSTEM_INTERFACE_SD
-	s32 Status = XST_FAILURE;
-	DWORD LocSector = sector;
+	DRESULT res;
 #endif
 
 	s = disk_status(pdrv);
@@ -360,14 +1101,18 @@ DRESULT disk_read (
 	}
 
 #ifdef FILE_SYSTEM_INTERFACE_SD
-	/* Convert LBA to byte address if needed */
-	if ((SdInstance[pdrv].HCS) == 0U) {
-		LocSector *= (DWORD)XSDPS_BLK_SIZE_512_MASK;
+	res = SD_LOCK(pdrv);
+	if (res != RES_OK) {
+		return res;
 	}
-
-	Status  = XSdPs_ReadPolled(&SdInstance[pdrv], (u32)LocSector, count, buff);
-	if (Status != XST_SUCCESS) {
-		return RES_ERROR;
+#if FF_CACHE_SECTORS > 0
+	res = cache_read(pdrv, buff, sector, count);
+#else
+	res = sd_read(pdrv, buff, sector, count);
+#endif
+	SD_UNLOCK(pdrv);
+	if (res != RES_OK) {
+		return res;
 	}
 #endif
 
@@ -402,14 +1147,22 @@ DRESULT disk_ioctl (
 	if ((disk_status(pdrv) & STA_NOINIT) != 0U) {	/* Check if card is in the socket */
 		return RES_NOTRDY;
 	}
+	if (SD_LOCK(pdrv) != RES_OK) {
+		return RES_ERROR;
+	}
 
 	switch (cmd) {
 		case (BYTE)CTRL_SYNC :	/* Make sure that no pending write process */
+#if FF_CACHE_SECTORS > 0
+			res = cache_sync(pdrv);
+#else
 			res = RES_OK;
+#endif
 			break;
 
 		case (BYTE)GET_SECTOR_COUNT : /* Get number of sectors on the disk (DWORD) */
-			(*((DWORD *)(void *)LocBuff)) = (DWORD)SdInstance[pdrv].SectorCount;
+			(*((DWORD *)(void *)LocBuff)) = (DWORD)(SdInstance[pdrv].SectorCount /
+					SD_BLKS_PER_SS);
 			res = RES_OK;
 			break;
 
@@ -419,6 +1172,12 @@ DRESULT disk_ioctl (
 			break;
 
 		case (BYTE)CTRL_TRIM :	/* Erase the data */
+#if FF_CACHE_SECTORS > 0
+			cache_invalidate(pdrv, SendBuff[0], SendBuff[1] - SendBuff[0] + 1U);
+#endif
+			/* Convert sectors to card blocks, the end is inclusive */
+			SendBuff[0] *= SD_BLKS_PER_SS;
+			SendBuff[1] = (SendBuff[1] * SD_BLKS_PER_SS) + (SD_BLKS_PER_SS - 1U);
 			if ((SdInstance[pdrv].HCS) == 0U) {
 				SendBuff[0] *= (DWORD)XSDPS_BLK_SIZE_512_MASK;
 				SendBuff[1] *= (DWORD)XSDPS_BLK_SIZE_512_MASK;
@@ -431,6 +1190,8 @@ DRESULT disk_ioctl (
 			res = RES_PARERR;
 			break;
 	}
+
+	SD_UNLOCK(pdrv);
 #endif
 
 #ifdef FILE_SYSTEM_INTERFACE_RAM
@@ -516,8 +1277,7 @@ DRESULT disk_write (
 {
 	DSTATUS s;
 #ifdef FILE_SYSTEM_INTERFACE_SD
-	s32 Status = XST_FAILURE;
-	DWORD LocSector = sector;
+	DRESULT res;
 #endif
 
 	s = disk_status(pdrv);
@@ -529,16 +1289,19 @@ DRESULT disk_write (
 	}
 
 #ifdef FILE_SYSTEM_INTERFACE_SD
-	/* Convert LBA to byte address if needed */
-	if ((SdInstance[pdrv].HCS) == 0U) {
-		LocSector *= (DWORD)XSDPS_BLK_SIZE_512_MASK;
+	res = SD_LOCK(pdrv);
+	if (res != RES_OK) {
+		return res;
 	}
-
-	Status  = XSdPs_WritePolled(&SdInstance[pdrv], (u32)LocSector, count, buff);
-	if (Status != XST_SUCCESS) {
-		return RES_ERROR;
+#if FF_CACHE_SECTORS > 0
+	res = cache_write(pdrv, buff, sector, count);
+#else
+	res = sd_write(pdrv, buff, sector, count);
+#endif
+	SD_UNLOCK(pdrv);
+	if (res != RES_OK) {
+		return res;
 	}
-
 #endif
 
 #ifdef FILE_SYSTEM_INTERFACE_RAM
@@ -31,6 +31,12 @@
 *       mn   04/23/20 Add partition 0 for supporting default partition
 * 4.7   sk   11/11/21 Add DCache invalidate for last unaligned byte count
 *                     (< 512 bytes) in f_read().
+* 4.8   ag   10/14/26 Build the cluster link map of large files on open from
+*                     a static pool of tables (FF_FASTSEEK_THRESHOLD).
+*       ag   10/14/26 Extend direct transfers over contiguous clusters
+*                     (FF_USE_DIRECT_IO).
+*       ag   10/15/26 Keep the link map table pool in each filesystem object,
+*                     so that it is covered by the volume lock.
 ******************************************************************************/
 #include "xparameters.h"
 #if (defined FILE_SYSTEM_INTERFACE_SD) || (defined FILE_SYSTEM_INTERFACE_RAM)
@@ -1666,11 +1672,151 @@ static DWORD clmt_clust (	/* <2:Error, >=2:Cluster number */
 	return cl + *tbl;	/* Return the cluster number */
 }
 
+
+
+
+/*-----------------------------------------------------------------------*/
+/* FAT handling - Create the link map table of a file                    */
+/*-----------------------------------------------------------------------*/
+
+static FRESULT create_clmt (	/* FR_OK(0):succeeded, !=0:error */
+	FIL* fp			/* Pointer to the file object, cltbl[0] holds the table size */
+)
+{
+	DWORD cl, pcl, ncl, tcl, tlen, ulen, *tbl;
+	FATFS *fs = fp->obj.fs;
+
+
+	tbl = fp->cltbl;
+	tlen = *tbl++; ulen = 2;	/* Given table size and required table size */
+	cl = fp->obj.sclust;		/* Origin of the chain */
+	if (cl != 0) {
+		do {
+			/* Get a fragment */
+			tcl = cl; ncl = 0; ulen += 2;	/* Top, length and used items */
+			do {
+				pcl = cl; ncl++;
+				cl = get_fat(&fp->obj, cl);
+				if (cl <= 1) return FR_INT_ERR;
+				if (cl == 0xFFFFFFFF) return FR_DISK_ERR;
+			} while (cl == pcl + 1);
+			if (ulen <= tlen) {		/* Store the length and top of the fragment */
+				*tbl++ = ncl; *tbl++ = tcl;
+			}
+		} while (cl < fs->n_fatent);	/* Repeat until end of chain */
+	}
+	*fp->cltbl = ulen;	/* Number of items used */
+	if (ulen > tlen) return FR_NOT_ENOUGH_CORE;	/* Given table size is smaller than required */
+	*tbl = 0;		/* Terminate table */
+	return FR_OK;
+}
+
+
+
+#if FF_FASTSEEK_THRESHOLD > 0
+/*-----------------------------------------------------------------------*/
+/* Link map table pool - Attach a table to a file                        */
+/*-----------------------------------------------------------------------*/
+
+static void clmt_attach (
+	FIL* fp			/* Pointer to the file object */
+)
+{
+	FATFS *fs = fp->obj.fs;
+	UINT i;
+
+
+	for (i = 0; i < FF_FASTSEEK_TABLES && fs->clmt_used[i]; i++) ;	/* Find a free table of the volume */
+	if (i == FF_FASTSEEK_TABLES) return;	/* No free table, use the FAT chain */
+
+	fs->clmt_pool[i][0] = FF_FASTSEEK_TBL_SIZE;
+	fp->cltbl = fs->clmt_pool[i];
+	if (create_clmt(fp) == FR_OK) {
+		fs->clmt_used[i] = 1;
+	} else {
+		fp->cltbl = 0;		/* Too fragmented or error, use the FAT chain */
+	}
+}
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Link map table pool - Release the table of a file                     */
+/*-----------------------------------------------------------------------*/
+
+static void clmt_release (
+	FIL* fp			/* Pointer to the file object */
+)
+{
+	FATFS *fs = fp->obj.fs;
+	UINT i;
+
+
+	for (i = 0; i < FF_FASTSEEK_TABLES; i++) {
+		if (fp->cltbl == fs->clmt_pool[i]) {	/* Tables set by the application are left alone */
+			fs->clmt_used[i] = 0;
+			fp->cltbl = 0;
+			break;
+		}
+	}
+}
+#endif
+
 #endif	/* FF_USE_FASTSEEK */
 
 
 
 
+#if FF_USE_DIRECT_IO
+/*-----------------------------------------------------------------------*/
+/* FAT handling - Extend a direct transfer over contiguous clusters      */
+/*-----------------------------------------------------------------------*/
+
+static FRESULT extend_direct (	/* FR_OK(0):succeeded, !=0:error */
+	FIL* fp,		/* Pointer to the file object, fp->clust is the current cluster */
+	UINT csect,		/* Sector offset of the transfer in the current cluster */
+	UINT* cc,		/* Sectors requested, returns the sectors on contiguous clusters */
+	int stretch		/* Stretch the chain (write) or not (read) */
+)
+{
+	FATFS *fs = fp->obj.fs;
+	DWORD clst = fp->clust, ncl;
+	UINT n = fs->csize - csect;		/* Sectors up to the end of the current cluster */
+
+
+	while (*cc > n) {
+#if FF_USE_FASTSEEK
+		if (fp->cltbl) {
+			ncl = clmt_clust(fp, fp->fptr + (FSIZE_t)n * SS(fs));	/* Get cluster# from the CLMT */
+		} else
+#endif
+#if !FF_FS_READONLY
+		if (stretch) {
+			if (FF_FS_EXFAT && fp->fptr + (FSIZE_t)n * SS(fs) > fp->obj.objsize) {	/* No FAT chain object needs correct objsize to generate FAT value */
+				fp->obj.objsize = fp->fptr + (FSIZE_t)n * SS(fs);
+				fp->flag |= FA_MODIFIED;
+			}
+			ncl = create_chain(&fp->obj, clst);	/* Follow or stretch the chain */
+		} else
+#endif
+		{
+			ncl = get_fat(&fp->obj, clst);		/* Follow the chain */
+		}
+		if (ncl == 0xFFFFFFFF) return FR_DISK_ERR;
+		if (ncl != clst + 1) break;		/* End of the contiguous run, left to the caller */
+		clst = ncl;
+		n += fs->csize;
+	}
+	if (*cc > n) *cc = n;
+	fp->clust = clst;		/* Last cluster of the transfer */
+	(void)stretch;
+	return FR_OK;
+}
+#endif
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Directory handling - Fill a cluster with zeros                        */
 /*-----------------------------------------------------------------------*/
@@ -3287,6 +3433,9 @@ static FRESULT find_volume (	/* FR_OK(0): successful, !=0: an error occurred */
 	/* Following code attempts to mount the volume. (analyze BPB and initialize the filesystem object) */
 
 	fs->fs_type = 0;					/* Clear the filesystem object */
+#if FF_USE_FASTSEEK && FF_FASTSEEK_THRESHOLD > 0
+	mem_set(fs->clmt_used, 0, sizeof fs->clmt_used);	/* Files of the previous mount are invalid */
+#endif
 	fs->pdrv = LD2PD(vol);				/* Bind the logical drive and a physical drive */
 	stat = disk_initialize(fs->pdrv);	/* Initialize the physical drive */
 	if (stat & STA_NOINIT) { 			/* Check if the initialization succeeded */
@@ -3733,6 +3882,11 @@ FRESULT f_open (
 					}
 				}
 			}
+#endif
+#if FF_USE_FASTSEEK && FF_FASTSEEK_THRESHOLD > 0
+			if (res == FR_OK && fp->obj.objsize >= FF_FASTSEEK_THRESHOLD) {
+				clmt_attach(fp);	/* Enable fast seek mode on a large file */
+			}
 #endif
 		}
 
@@ -3800,7 +3954,12 @@ FRESULT f_read (
 			cc = btr / SS(fs);					/* When remaining bytes >= sector size, */
 			if (cc > 0) {						/* Read maximum contiguous sectors directly */
 				if (csect + cc > fs->csize) {	/* Clip at cluster boundary */
+#if FF_USE_DIRECT_IO
+					res = extend_direct(fp, csect, &cc, 0);	/* or at the end of the contiguous clusters */
+					if (res != FR_OK) ABORT(fs, res);
+#else
 					cc = fs->csize - csect;
+#endif
 				}
 				if (disk_read(fs->pdrv, rbuff, sect, cc) != RES_OK) ABORT(fs, FR_DISK_ERR);
 #if !FF_FS_READONLY && FF_FS_MINIMIZE <= 2		/* Replace one of the read sectors with cached data if it contains a dirty sector */
@@ -3897,6 +4056,12 @@ FRESULT f_write (
 #if FF_USE_FASTSEEK
 					if (fp->cltbl) {
 						clst = clmt_clust(fp, fp->fptr);	/* Get cluster# from the CLMT */
+#if FF_FASTSEEK_THRESHOLD > 0
+						if (clst == 0) {		/* Past the end of the table, */
+							clmt_release(fp);	/* drop a table of the pool */
+							if (!fp->cltbl) clst = create_chain(&fp->obj, fp->clust);	/* and stretch the chain */
+						}
+#endif
 					} else
 #endif
 					{
@@ -3923,7 +4088,12 @@ FRESULT f_write (
 			cc = btw / SS(fs);				/* When remaining bytes >= sector size, */
 			if (cc > 0) {					/* Write maximum contiguous sectors directly */
 				if (csect + cc > fs->csize) {	/* Clip at cluster boundary */
+#if FF_USE_DIRECT_IO
+					res = extend_direct(fp, csect, &cc, 1);	/* or at the end of the contiguous clusters */
+					if (res != FR_OK) ABORT(fs, res);
+#else
 					cc = fs->csize - csect;
+#endif
 				}
 				if (disk_write(fs->pdrv, wbuff, sect, cc) != RES_OK) ABORT(fs, FR_DISK_ERR);
 #if FF_FS_MINIMIZE <= 2
@@ -4075,6 +4245,9 @@ FRESULT f_close (
 	{
 		res = validate(&fp->obj, &fs);	/* Lock volume */
 		if (res == FR_OK) {
+#if FF_USE_FASTSEEK && FF_FASTSEEK_THRESHOLD > 0
+			clmt_release(fp);	/* Return the link map table to the pool */
+#endif
 #if FF_FS_LOCK != 0
 			res = dec_lock(fp->obj.lockid);		/* Decrement file open counter */
 			if (res == FR_OK) fp->obj.fs = 0;	/* Invalidate file object */
@@ -4286,7 +4459,7 @@ FRESULT f_lseek (
 	DWORD clst, bcs, nsect;
 	FSIZE_t ifptr;
 #if FF_USE_FASTSEEK
-	DWORD cl, pcl, ncl, tcl, dsc, tlen, ulen, *tbl;
+	DWORD dsc;
 #endif
 
 	res = validate(&fp->obj, &fs);		/* Check validity of the file object */
@@ -4299,32 +4472,15 @@ FRESULT f_lseek (
 	if (res != FR_OK) LEAVE_FF(fs, res);
 
 #if FF_USE_FASTSEEK
+#if FF_FASTSEEK_THRESHOLD > 0 && !FF_FS_READONLY
+	if (fp->cltbl && ofs != CREATE_LINKMAP && ofs > fp->obj.objsize && (fp->flag & FA_WRITE)) {
+		clmt_release(fp);	/* The file is extended, drop a table of the pool */
+	}
+#endif
 	if (fp->cltbl) {	/* Fast seek */
 		if (ofs == CREATE_LINKMAP) {	/* Create CLMT */
-			tbl = fp->cltbl;
-			tlen = *tbl++; ulen = 2;	/* Given table size and required table size */
-			cl = fp->obj.sclust;		/* Origin of the chain */
-			if (cl != 0) {
-				do {
-					/* Get a fragment */
-					tcl = cl; ncl = 0; ulen += 2;	/* Top, length and used items */
-					do {
-						pcl = cl; ncl++;
-						cl = get_fat(&fp->obj, cl);
-						if (cl <= 1) ABORT(fs, FR_INT_ERR);
-						if (cl == 0xFFFFFFFF) ABORT(fs, FR_DISK_ERR);
-					} while (cl == pcl + 1);
-					if (ulen <= tlen) {		/* Store the length and top of the fragment */
-						*tbl++ = ncl; *tbl++ = tcl;
-					}
-				} while (cl < fs->n_fatent);	/* Repeat until end of chain */
-			}
-			*fp->cltbl = ulen;	/* Number of items used */
-			if (ulen <= tlen) {
-				*tbl = 0;		/* Terminate table */
-			} else {
-				res = FR_NOT_ENOUGH_CORE;	/* Given table size is smaller than required */
-			}
+			res = create_clmt(fp);
+			if (res == FR_INT_ERR || res == FR_DISK_ERR) ABORT(fs, res);
 		} else {						/* Fast seek */
 			if (ofs > fp->obj.objsize) ofs = fp->obj.objsize;	/* Clip offset at the file size */
 			fp->fptr = ofs;				/* Set file pointer */
@@ -4759,6 +4915,9 @@ FRESULT f_truncate (
 	if (!(fp->flag & FA_WRITE)) LEAVE_FF(fs, FR_DENIED);	/* Check access mode */
 
 	if (fp->fptr < fp->obj.objsize) {	/* Process when fptr is not on the eof */
+#if FF_USE_FASTSEEK && FF_FASTSEEK_THRESHOLD > 0
+		clmt_release(fp);	/* The table of the pool maps removed clusters */
+#endif
 		if (fp->fptr == 0) {	/* When set file size to zero, remove entire cluster chain */
 			res = remove_chain(&fp->obj, fp->obj.sclust, 0);
 			fp->obj.sclust = 0;
@@ -5,6 +5,9 @@
 
 
 #include "ff.h"
+#ifdef FILE_SYSTEM_USE_XIL_POOL
+#include "xil_pool.h"
+#endif
 
 
 
@@ -18,7 +21,11 @@ void* ff_memalloc (	/* Returns pointer to the allocated memory block (null on no
 	UINT msize		/* Number of bytes to allocate */
 )
 {
+#ifdef FILE_SYSTEM_USE_XIL_POOL
+	return Xil_PoolMalloc(msize);	/* Allocate from the BSP block pools */
+#else
 	return malloc(msize);	/* Allocate a new memory block with POSIX API */
+#endif
 }
 
 
@@ -30,7 +37,11 @@ void ff_memfree (
 	void* mblock	/* Pointer to the memory block to free (nothing to do for null) */
 )
 {
+#ifdef FILE_SYSTEM_USE_XIL_POOL
+	Xil_PoolFreeAny(mblock);	/* Free to the BSP block pools */
+#else
 	free(mblock);	/* Free the memory block with POSIX API */
+#endif
 }
 
 #endif
@@ -56,8 +67,8 @@ int ff_cre_syncobj (	/* 1:Function succeeded, 0:Could not create the sync object
 )
 {
 	/* Win32 */
-	*sobj = CreateMutex(NULL, FALSE, NULL);
-	return (int)(*sobj != INVALID_HANDLE_VALUE);
+//	*sobj = CreateMutex(NULL, FALSE, NULL);
+//	return (int)(*sobj != INVALID_HANDLE_VALUE);
 
 	/* uITRON */
 //	T_CSEM csem = {TA_TPRI,1,1};
@@ -70,8 +81,9 @@ int ff_cre_syncobj (	/* 1:Function succeeded, 0:Could not create the sync object
 //	return (int)(err == OS_NO_ERR);
 
 	/* FreeRTOS */
-//	*sobj = xSemaphoreCreateMutex();
-//	return (int)(*sobj != NULL);
+	(void)vol;
+	*sobj = xSemaphoreCreateMutex();
+	return (int)(*sobj != NULL);
 
 	/* CMSIS-RTOS */
 //	*sobj = osMutexCreate(Mutex + vol);
@@ -92,7 +104,7 @@ int ff_del_syncobj (	/* 1:Function succeeded, 0:Could not delete due to an error
 )
 {
 	/* Win32 */
-	return (int)CloseHandle(sobj);
+//	return (int)CloseHandle(sobj);
 
 	/* uITRON */
 //	return (int)(del_sem(sobj) == E_OK);
@@ -103,8 +115,8 @@ int ff_del_syncobj (	/* 1:Function succeeded, 0:Could not delete due to an error
 //	return (int)(err == OS_NO_ERR);
 
 	/* FreeRTOS */
-//  vSemaphoreDelete(sobj);
-//	return 1;
+	vSemaphoreDelete(sobj);
+	return 1;
 
 	/* CMSIS-RTOS */
 //	return (int)(osMutexDelete(sobj) == osOK);
@@ -123,7 +135,7 @@ int ff_req_grant (	/* 1:Got a grant to access the volume, 0:Could not get a gran
 )
 {
 	/* Win32 */
-	return (int)(WaitForSingleObject(sobj, FF_FS_TIMEOUT) == WAIT_OBJECT_0);
+//	return (int)(WaitForSingleObject(sobj, FF_FS_TIMEOUT) == WAIT_OBJECT_0);
 
 	/* uITRON */
 //	return (int)(wai_sem(sobj) == E_OK);
@@ -134,7 +146,7 @@ int ff_req_grant (	/* 1:Got a grant to access the volume, 0:Could not get a gran
 //	return (int)(err == OS_NO_ERR);
 
 	/* FreeRTOS */
-//	return (int)(xSemaphoreTake(sobj, FF_FS_TIMEOUT) == pdTRUE);
+	return (int)(xSemaphoreTake(sobj, FF_FS_TIMEOUT) == pdTRUE);
 
 	/* CMSIS-RTOS */
 //	return (int)(osMutexWait(sobj, FF_FS_TIMEOUT) == osOK);
@@ -152,7 +164,7 @@ void ff_rel_grant (
 )
 {
 	/* Win32 */
-	ReleaseMutex(sobj);
+//	ReleaseMutex(sobj);
 
 	/* uITRON */
 //	sig_sem(sobj);
@@ -161,7 +173,7 @@ void ff_rel_grant (
 //	OSMutexPost(sobj);
 
 	/* FreeRTOS */
-//	xSemaphoreGive(sobj);
+	(void)xSemaphoreGive(sobj);
 
 	/* CMSIS-RTOS */
 //	osMutexRelease(sobj);
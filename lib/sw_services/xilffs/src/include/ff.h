@@ -135,6 +135,10 @@ typedef struct {
 	DWORD	dirbase;		/* Root directory base sector/cluster */
 	DWORD	database;		/* Data base sector */
 	DWORD	winsect;		/* Current sector appearing in the win[] */
+#if FF_USE_FASTSEEK && FF_FASTSEEK_THRESHOLD > 0
+	BYTE	clmt_used[FF_FASTSEEK_TABLES];	/* Link map tables in use */
+	DWORD	clmt_pool[FF_FASTSEEK_TABLES][FF_FASTSEEK_TBL_SIZE];	/* Link map tables built on open */
+#endif
 #ifdef __ICCARM__
 #pragma data_alignment = 32
 	BYTE	win[FF_MAX_SS];
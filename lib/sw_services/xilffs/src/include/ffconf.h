@@ -62,10 +62,48 @@ extern "C" {
 /* This option switches f_mkfs() function. (0:Disable or 1:Enable) */
 
 
+#ifdef FILE_SYSTEM_DIRECT_IO
+#define FF_USE_DIRECT_IO	1
+#else
+#define FF_USE_DIRECT_IO	0
+#endif
+/* This option extends the direct transfers of f_read() and f_write() between the
+/  application buffer and the disk over the contiguous clusters of the file, instead
+/  of clipping them at every cluster boundary. (0:Disable or 1:Enable) */
+
+
+#ifdef FILE_SYSTEM_USE_FASTSEEK
+#define FF_USE_FASTSEEK	1
+#else
 #define FF_USE_FASTSEEK	0
+#endif
 /* This option switches fast seek function. (0:Disable or 1:Enable) */
 
 
+#ifdef FILE_SYSTEM_FASTSEEK_THRESHOLD
+#define FF_FASTSEEK_THRESHOLD	FILE_SYSTEM_FASTSEEK_THRESHOLD
+#else
+#define FF_FASTSEEK_THRESHOLD	0
+#endif
+#ifdef FILE_SYSTEM_FASTSEEK_TABLES
+#define FF_FASTSEEK_TABLES		FILE_SYSTEM_FASTSEEK_TABLES
+#else
+#define FF_FASTSEEK_TABLES		4
+#endif
+#ifdef FILE_SYSTEM_FASTSEEK_TBL_SIZE
+#define FF_FASTSEEK_TBL_SIZE	FILE_SYSTEM_FASTSEEK_TBL_SIZE
+#else
+#define FF_FASTSEEK_TBL_SIZE	64
+#endif
+/* With fast seek enabled, f_open() builds the cluster link map table of files of
+/  FF_FASTSEEK_THRESHOLD bytes or more (0:Disable) from a pool, in each FATFS, of
+/  FF_FASTSEEK_TABLES tables of FF_FASTSEEK_TBL_SIZE items each, so the application
+/  does not need to set cltbl. A table maps (FF_FASTSEEK_TBL_SIZE - 2) / 2 fragments,
+/  more fragmented files, or files opened while all tables are in use, use the FAT
+/  chain. The table goes back to the pool on f_close(), and when the file is extended
+/  or truncated. */
+
+
 #define FF_USE_EXPAND	0
 /* This option switches f_expand function. (0:Disable or 1:Enable) */
 
@@ -248,14 +286,21 @@ extern "C" {
 /  function will be available. */
 
 
+#ifdef FILE_SYSTEM_SECTOR_SIZE
+#define FF_MIN_SS		FILE_SYSTEM_SECTOR_SIZE
+#define FF_MAX_SS		FILE_SYSTEM_SECTOR_SIZE
+#else
 #define FF_MIN_SS		512
 #define FF_MAX_SS		512
+#endif
 /* This set of options configures the range of sector size to be supported. (512,
 /  1024, 2048 or 4096) Always set both 512 for most systems, generic memory card and
 /  harddisk. But a larger value may be required for on-board flash memory and some
 /  type of optical media. When FF_MAX_SS is larger than FF_MIN_SS, FatFs is configured
 /  for variable sector size mode and disk_ioctl() function needs to implement
-/  GET_SECTOR_SIZE command. */
+/  GET_SECTOR_SIZE command.
+/  With the SD interface, a sector of 1024 to 4096 bytes is made of consecutive 512 byte
+/  blocks of the card, for eMMC volumes formatted with 4 KiB logical sectors. */
 
 
 #ifdef FILE_SYSTEM_USE_TRIM
@@ -328,9 +373,15 @@ extern "C" {
 /      lock control is independent of re-entrancy. */
 
 
+#ifdef FILE_SYSTEM_REENTRANT
+#define FF_FS_REENTRANT	1
+#define FF_FS_TIMEOUT	pdMS_TO_TICKS(FILE_SYSTEM_FS_TIMEOUT)
+#define FF_SYNC_t		SemaphoreHandle_t
+#else
 #define FF_FS_REENTRANT	0
 #define FF_FS_TIMEOUT	1000
 #define FF_SYNC_t		HANDLE
+#endif
 /* The option FF_FS_REENTRANT switches the re-entrancy (thread safe) of the FatFs
 /  module itself. Note that regardless of this option, file access to different
 /  volume is always re-entrant and volume control functions, f_mount(), f_mkfs()
@@ -346,9 +397,18 @@ extern "C" {
 /  The FF_FS_TIMEOUT defines timeout period in unit of time tick.
 /  The FF_SYNC_t defines O/S dependent sync object type. e.g. HANDLE, ID, OS_EVENT*,
 /  SemaphoreHandle_t and etc. A header file for O/S definitions needs to be
-/  included somewhere in the scope of ff.h. */
+/  included somewhere in the scope of ff.h.
+/
+/  xilffs enables re-entrancy on FreeRTOS, with a mutex for each volume and FF_FS_TIMEOUT
+/  in milliseconds. diskio.c then also locks each SD drive and completes its transfers
+/  from the interrupt of its controller, so that volumes on different drives are
+/  accessed concurrently. */
 
 /* #include <windows.h>	// O/S definitions  */
+#ifdef FILE_SYSTEM_REENTRANT
+#include "FreeRTOS.h"	/* FreeRTOS mutexes of the volumes and drives */
+#include "semphr.h"
+#endif
 
 #ifdef FILE_SYSTEM_WORD_ACCESS
 #define FF_WORD_ACCESS	1
@@ -377,6 +437,54 @@ extern "C" {
 /   PIC32       0           H8/300H     0           x86         0/1
 */
 
+/*---------------------------------------------------------------------------/
+/ Disk Cache Configurations
+/---------------------------------------------------------------------------*/
+
+#ifdef FILE_SYSTEM_CACHE_SECTORS
+#define FF_CACHE_SECTORS	FILE_SYSTEM_CACHE_SECTORS
+#else
+#define FF_CACHE_SECTORS	0
+#endif
+/* This option sets the number of sectors held by the block cache of diskio.c
+/  for the SD interface, shared by all drives. (0:Disable or 2 and more)
+/  Single sector accesses, which FatFs uses for the FAT, directories and partial
+/  file sectors, go through the cache. Multi-sector accesses go to the disk and
+/  only pick up the dirty sectors of the cache. */
+
+
+#ifdef FILE_SYSTEM_CACHE_READ_AHEAD
+#define FF_CACHE_READ_AHEAD	FILE_SYSTEM_CACHE_READ_AHEAD
+#else
+#define FF_CACHE_READ_AHEAD	0
+#endif
+/* This option sets the number of sectors read in one go when a single sector
+/  read misses the cache right after the previous sector of the drive was read.
+/  (0 or 1:Disable, 2 up to FF_CACHE_SECTORS / 2) */
+
+
+#ifdef FILE_SYSTEM_CACHE_WRITE_BACK
+#define FF_CACHE_WRITE_BACK	1
+#else
+#define FF_CACHE_WRITE_BACK	0
+#endif
+/* This option switches the cache of single sector writes. (0:Write-through or
+/  1:Write-back) With write-back, written sectors stay in the cache until they
+/  are evicted or the CTRL_SYNC command of disk_ioctl() is issued, which f_sync()
+/  and f_close() do. */
+
+
+#ifdef FILE_SYSTEM_CACHE_PIN_FAT
+#define FF_CACHE_PIN_FAT	1
+#else
+#define FF_CACHE_PIN_FAT	0
+#endif
+/* This option keeps the FAT sectors in the cache. (0:Disable or 1:Enable)
+/  The FAT of a drive is located from the boot sector of the last volume mounted on it.
+/  Up to half of the cache is pinned, pinned sectors are evicted only when no other
+/  sector can be. */
+
+
 #ifdef __cplusplus
 }
 #endif
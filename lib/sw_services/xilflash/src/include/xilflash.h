@@ -88,6 +88,13 @@
 * only after the erase operation is completed successfully or an error is
 * reported.
 *
+* The erase can also be run without blocking. XFlash_EraseStart() sends the
+* erase command of the first block(s) and returns, XFlash_PollStatus() is then
+* called until it no longer returns XFLASH_BUSY. Each call reads the status of
+* the device(s) once and sends the erase command of the next block(s) when the
+* previous ones are done, so the application can do other work meanwhile. No
+* other library call can be made while a non-blocking erase is in progress.
+*
 * <b>Sector Protection</b>
 *
 * The Flash Device is divided into Blocks. Each Block can be protected
@@ -198,6 +205,9 @@
 *                     in write operation(CR-1029074).
 * 4.7	akm  07/23/19 Initialized Status variable to XST_FAILURE.
 * 4.8	sne  04/23/21 Fixed doxygen warnings.
+* 4.9	ag   10/14/26 Added XFlash_EraseStart() and XFlash_PollStatus() for
+*		      non-blocking erase, AMD parts now erase multiple blocks
+*		      per command and program through the write buffer.
 * </pre>
 *
 ***************************************************************************/
@@ -454,6 +464,17 @@ typedef struct XFlashTag {
 					 */
 	XFlashVendorData VendorData;	/* Part specific data */
 
+	struct {
+		u32 Offset;		/* Offset of the erase in progress */
+		u32 Bytes;		/* Bytes of the erase in progress */
+		u32 PollOffset;		/* Offset of the first block being
+					 * erased, where status is polled */
+		u16 Region;		/* Region of the next block */
+		u16 Block;		/* Next block to erase */
+		u16 BlocksLeft;		/* Blocks left to send the erase
+					 * command to */
+		u16 InProgress;		/* Non-blocking erase in progress */
+	} EraseState;
 
 	struct {
 		int (*Read) (struct XFlashTag * InstancePtr, u32 Offset,
@@ -465,6 +486,11 @@ typedef struct XFlashTag {
 		int (*Erase) (struct XFlashTag * InstancePtr, u32 Offset,
 				u32 Bytes);
 
+		int (*EraseStart) (struct XFlashTag * InstancePtr, u32 Offset,
+				u32 Bytes);
+
+		int (*PollStatus) (struct XFlashTag * InstancePtr);
+
 		int (*Lock) (struct XFlashTag * InstancePtr, u32 Offset, u32
 									Bytes);
 
@@ -620,6 +646,8 @@ int XFlash_DeviceControl(XFlash * InstancePtr, u32 Command,
 int XFlash_Read(XFlash * InstancePtr, u32 Offset, u32 Bytes, void *DestPtr);
 int XFlash_Write(XFlash * InstancePtr, u32 Offset, u32 Bytes, void *SrcPtr);
 int XFlash_Erase(XFlash * InstancePtr, u32 Offset, u32 Bytes);
+int XFlash_EraseStart(XFlash * InstancePtr, u32 Offset, u32 Bytes);
+int XFlash_PollStatus(XFlash * InstancePtr);
 int XFlash_Lock(XFlash * InstancePtr, u32 Offset, u32 Bytes);
 int XFlash_Unlock(XFlash * InstancePtr, u32 Offset, u32 Bytes);
 int XFlash_IsReady(XFlash * InstancePtr);
@@ -24,6 +24,9 @@
 *		      (CR 781697).
 * 4.7   akm  07/10/19 Updated XFlashAmd_Write() to use adjusted base address
 *                     in write operation(CR-1029074).
+* 4.9	ag   10/14/26 Added the write buffer abort and erase queue
+*		      definitions, XFlashAmd_EraseStart() and
+*		      XFlashAmd_PollStatus().
 * </pre>
 *
 ******************************************************************************/
@@ -70,6 +73,8 @@ extern "C" {
 #define XFL_AMD_CMD_WRITE_BUFFER	(0x0025) /* Write to Buffer command */
 #define XFL_AMD_CMD_PROGRAM_BUFFER	(0x0029) /* Program Buffer to Flash
 							command */
+#define XFL_AMD_CMD_BUFFER_ABORT_RESET	(0x00F0) /* Write to Buffer Abort
+							Reset command */
 #define XFL_AMD_CMD_UNLOCK_BYPASS_RESET1 (0x0090) /* Unlock bypass 1 command */
 #define XFL_AMD_CMD_UNLOCK_BYPASS_RESET2 (0x0000) /* Unlock bypass 1 command */
 #define XFL_AMD_CMD_ERASE_CHIP		(0x0010) /* Chip erase command */
@@ -103,6 +108,12 @@ extern "C" {
 						  * mask */
 #define XFL_AMD_SR_ERASE_ERROR_MASK	(0x0020) /* Alternate erase operation
 						  * completed mask */
+#define XFL_AMD_SR_BUFFER_ABORT_MASK	(0x0002) /* Write to buffer aborted
+						  * mask */
+
+#define XFL_AMD_MAX_ERASE_QUEUE		(32)	 /* Maximum number of blocks
+						  * sent with one sector erase
+						  * command */
 
 #define XFL_AMD_TOP_BOOT		(0x03)	 /* Top boot device */
 #define XFL_AMD_BOTTOM_BOOT		(0x02)	 /* Bottom boot device */
@@ -141,6 +152,8 @@ int XFlashAmd_Write(XFlash * InstancePtr, u32 Offset, u32 Bytes,
 		    void *SrcPtr);
 
 int XFlashAmd_Erase(XFlash * InstancePtr, u32 Offset, u32 Bytes);
+int XFlashAmd_EraseStart(XFlash * InstancePtr, u32 Offset, u32 Bytes);
+int XFlashAmd_PollStatus(XFlash * InstancePtr);
 
 int XFlashAmd_Lock(XFlash * InstancePtr, u32 Offset, u32 Bytes);
 int XFlashAmd_Unlock(XFlash * InstancePtr, u32 Offset, u32 Bytes);
@@ -36,6 +36,8 @@
 *		      fixes the CR 662317.
 *		      CR 662317 Description - Xilinx Platform Flash on ML605
 *		      fails to work.
+* 4.9	ag   10/14/26 Added XFlashIntel_EraseStart() and
+*		      XFlashIntel_PollStatus().
 *
 * </pre>
 *
@@ -240,6 +242,8 @@ int XFlashIntel_Write(XFlash * InstancePtr, u32 Offset, u32 Bytes,
 		      void *SrcPtr);
 
 int XFlashIntel_Erase(XFlash * InstancePtr, u32 Offset, u32 Bytes);
+int XFlashIntel_EraseStart(XFlash * InstancePtr, u32 Offset, u32 Bytes);
+int XFlashIntel_PollStatus(XFlash * InstancePtr);
 
 int XFlashIntel_Lock(XFlash * InstancePtr, u32 Offset, u32 Bytes);
 int XFlashIntel_Unlock(XFlash * InstancePtr, u32 Offset, u32 Bytes);
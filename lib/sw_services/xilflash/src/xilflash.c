@@ -39,6 +39,7 @@
 *		      CR 662317 Description - Xilinx Platform Flash on ML605
 *		      fails to work.
 * 4.4   ms   08/03/17 Added tags and modified comment lines style for doxygen.
+* 4.9	ag   10/14/26 Added XFlash_EraseStart() and XFlash_PollStatus().
 * </pre>
 *
 *
@@ -122,6 +123,7 @@ int XFlash_Initialize(XFlash * InstancePtr, u32 BaseAddress, u8 BusWidth,
 	}
 
 	InstancePtr->IsReady = 0;
+	InstancePtr->EraseState.InProgress = 0;
 	InstancePtr->Geometry.BaseAddress = BaseAddress;
 	InstancePtr->IsPlatformFlash = IsPlatformFlash;
 
@@ -293,6 +295,78 @@ int XFlash_Erase(XFlash * InstancePtr, u32 Offset, u32 Bytes)
 	return (InstancePtr->VTable.Erase(InstancePtr, Offset, Bytes));
 }
 
+/*****************************************************************************/
+/**
+* @brief
+* This function starts erasing the specified address range in the flash
+* device and returns without waiting for the erase to complete. The erase is
+* completed by calling XFlash_PollStatus() until it no longer returns
+* XFLASH_BUSY.
+*
+* @param	InstancePtr	Pointer to the XFlash instance.
+* @param	Offset		Offset into the device(s) address space from
+*				which to begin erasure.
+* @param	Bytes		Number of bytes to erase.
+*
+* @return
+*		- XST_SUCCESS if the erase is started.
+*		- XFLASH_ADDRESS_ERROR if the destination address range is
+*		  not completely within the addressable areas of the device(s).
+*		- XFLASH_BUSY if a non-blocking erase is already in progress.
+*
+* @note		No other library function may be called until
+*		XFlash_PollStatus() reports the erase is done, and the flash
+*		must not be read meanwhile. Due to flash memory design, the
+*		range actually erased may be larger than what was specified by
+*		the Offset & Bytes parameters.
+*
+******************************************************************************/
+int XFlash_EraseStart(XFlash * InstancePtr, u32 Offset, u32 Bytes)
+{
+	if(InstancePtr == NULL) {
+		return XST_FAILURE;
+	}
+
+	if(InstancePtr->IsReady != XIL_COMPONENT_IS_READY) {
+		return XST_FAILURE;
+	}
+
+	return (InstancePtr->VTable.EraseStart(InstancePtr, Offset, Bytes));
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function checks the progress of the erase started by
+* XFlash_EraseStart(). The status of the device(s) is read once. When the
+* blocks being erased are done, the erase command of the next blocks is sent,
+* when the last blocks are done the device(s) are returned to read mode.
+*
+* @param	InstancePtr	Pointer to the XFlash instance.
+*
+* @return
+*		- XFLASH_BUSY if the erase is still in progress.
+*		- XST_SUCCESS if the erase is done, or if no erase was
+*		  started.
+*		- XFLASH_ERROR if the device(s) reported an erase error. The
+*		  erase is abandoned.
+*
+* @note		None.
+*
+******************************************************************************/
+int XFlash_PollStatus(XFlash * InstancePtr)
+{
+	if(InstancePtr == NULL) {
+		return XST_FAILURE;
+	}
+
+	if(InstancePtr->IsReady != XIL_COMPONENT_IS_READY) {
+		return XST_FAILURE;
+	}
+
+	return (InstancePtr->VTable.PollStatus(InstancePtr));
+}
+
 /*****************************************************************************/
 /**
 * @brief
@@ -629,6 +703,8 @@ static int SetVTable(XFlash * InstancePtr)
 			InstancePtr->VTable.Read = XFlashIntel_Read;
 			InstancePtr->VTable.Write = XFlashIntel_Write;
 			InstancePtr->VTable.Erase = XFlashIntel_Erase;
+			InstancePtr->VTable.EraseStart = XFlashIntel_EraseStart;
+			InstancePtr->VTable.PollStatus = XFlashIntel_PollStatus;
 			InstancePtr->VTable.Lock = XFlashIntel_Lock;
 			InstancePtr->VTable.Unlock = XFlashIntel_Unlock;
 			InstancePtr->VTable.Initialize = XFlashIntel_Initialize;
@@ -644,6 +720,8 @@ static int SetVTable(XFlash * InstancePtr)
 			InstancePtr->VTable.Read = XFlashAmd_Read;
 			InstancePtr->VTable.Write = XFlashAmd_Write;
 			InstancePtr->VTable.Erase = XFlashAmd_Erase;
+			InstancePtr->VTable.EraseStart = XFlashAmd_EraseStart;
+			InstancePtr->VTable.PollStatus = XFlashAmd_PollStatus;
 			InstancePtr->VTable.Lock = XFlashAmd_Lock;
 			InstancePtr->VTable.Unlock = XFlashAmd_Unlock;
 			InstancePtr->VTable.EraseChip = XFlashAmd_EraseChip;
@@ -57,6 +57,11 @@
 * 4.7	akm  07/10/19 Updated XFlashAmd_Write() to use adjusted base address
 *		      in write operation(CR-1029074).
 * 4.7	akm  07/23/19 Initialized Status variable to XST_FAILURE.
+* 4.9	ag   10/14/26 Added XFlashAmd_EraseStart() and XFlashAmd_PollStatus().
+*		      Erase sends up to XFL_AMD_MAX_ERASE_QUEUE blocks per
+*		      sector erase command and polls the blocks being erased.
+*		      Parts with a write buffer are programmed a buffer at a
+*		      time, buffer programs don't cross buffer boundaries.
 * </pre>
 *
 ******************************************************************************/
@@ -161,6 +166,8 @@ static void ExitExtendedBlockMode(XFlash * InstancePtr);
 static int CheckBlockProtection(XFlash * InstancePtr, u32 Offset);
 static void  FlashPause(u32 MicroSeconds);
 static int XFlashAmd_ResetBank(XFlash * InstancePtr, u32 Offset, u32 Bytes);
+static void EraseNextBlocks(XFlash * InstancePtr);
+static int CheckToggle(XFlash * InstancePtr, u32 Offset, u32 ErrorMask);
 extern int XFlashGeometry_ToBlock(XFlashGeometry * InstancePtr,
 				u32 AbsoluteOffset,
 				u16 *Region, u16 *Block, u32 *BlockOffset);
@@ -174,6 +181,8 @@ static int WriteBufferAmd(XFlash * InstancePtr, void *DestPtr,
                          void *SrcPtr, u32 Bytes);
 static int WriteBufferSpansion(XFlash * InstancePtr, void *DestPtr,
                          void *SrcPtr, u32 Bytes);
+static int WriteBufferedAmd(XFlash * InstancePtr, void *DestPtr,
+			    void *SrcPtr, u32 Bytes);
 void AmdDevice_is_Ready(XFlash * InstancePtr);
 
 /************************** Variable Definitions *****************************/
@@ -306,6 +315,15 @@ int XFlashAmd_Initialize(XFlash * InstancePtr)
 	 */
 	GetPartID(InstancePtr);
 
+	/*
+	 * Parts other than the Spansion parts accept further blocks while the
+	 * sector erase timer of a sector erase command runs.
+	 */
+	if (InstancePtr->Properties.PartID.ManufacturerID != 0x01) {
+		InstancePtr->Properties.ProgCap.EraseQueueSize =
+						XFL_AMD_MAX_ERASE_QUEUE;
+	}
+
 	/*
 	 * Setup bank information as per the boot block location.
 	 */
@@ -624,25 +642,66 @@ int XFlashAmd_Write(XFlash * InstancePtr, u32 Offset, u32 Bytes, void *SrcPtr)
 *
 ******************************************************************************/
 int XFlashAmd_Erase(XFlash * InstancePtr, u32 Offset, u32 Bytes)
+{
+	int Status = (int)XST_FAILURE;
+
+	Status = XFlashAmd_EraseStart(InstancePtr, Offset, Bytes);
+	if (Status != XST_SUCCESS) {
+		return (Status);
+	}
+
+	/* Poll until all the blocks are erased. */
+	do {
+		Status = XFlashAmd_PollStatus(InstancePtr);
+	} while (Status == XFLASH_BUSY);
+
+	return (Status);
+}
+
+/*****************************************************************************/
+/**
+*
+* Starts erasing the specified address range in the AMD Flash device. The
+* sector erase command of the first block(s) is sent, the following blocks
+* are sent by XFlashAmd_PollStatus().
+*
+* @param	InstancePtr is the pointer to the XFlash instance.
+* @param	Offset is the offset into the device(s) address space from which
+*		to begin erasure.
+* @param	Bytes is the number of bytes to erase.
+*
+* @return
+*		- XST_SUCCESS if the erase is started.
+*		- XFLASH_ADDRESS_ERROR if the destination address range is
+*		  not completely within the addressable areas of the device(s).
+*		- XFLASH_BUSY if an erase is already in progress.
+*		- XST_FAILURE if failed.
+*
+* @note		Application has to check block protection status of all the
+*		which needs to be erased before calling this API.
+*
+******************************************************************************/
+int XFlashAmd_EraseStart(XFlash * InstancePtr, u32 Offset, u32 Bytes)
 {
 	u16 StartRegion;
 	u16 EndRegion;
 	u16 StartBlock;
 	u16 EndBlock;
-	u16 BlocksLeft;
-	u16 BlocksQueued;
 	u32 Dummy;
 	u32 StartOffset;
 	u32 EndOffset;
 	int Status = (int)XST_FAILURE;
 	XFlashGeometry *GeomPtr;
-	XFlashVendorData_Amd *DevDataPtr;
 
 	/* Verify inputs are valid. */
 	if (InstancePtr == NULL) {
 		return (XST_FAILURE);
 	}
 
+	if (InstancePtr->EraseState.InProgress != 0) {
+		return (XFLASH_BUSY);
+	}
+
 	GeomPtr = &InstancePtr->Geometry;
 
 	/* Handle case when zero bytes is provided. */
@@ -679,27 +738,71 @@ int XFlashAmd_Erase(XFlash * InstancePtr, u32 Offset, u32 Bytes)
 		return (XFLASH_ADDRESS_ERROR);
 	}
 
-	/*
-	 * Erase loop. Queue up as many blocks at a time until all are erased.
-	 */
-	DevDataPtr = GET_PARTDATA(InstancePtr);
-	BlocksLeft = XFL_GEOMETRY_BLOCK_DIFF(GeomPtr, StartRegion, StartBlock,
-					     EndRegion, EndBlock);
-
-	while (BlocksLeft > 0) {
-		BlocksQueued = EnqueueEraseBlocks(InstancePtr, &StartRegion,
-						  &StartBlock, BlocksLeft);
-		BlocksLeft -= BlocksQueued;
-		Status = DevDataPtr->PollSR(GeomPtr->BaseAddress, StartOffset);
-		if (Status != XFLASH_READY) {
-			(void) XFlashAmd_ResetBank(InstancePtr, StartOffset,
-				Bytes);
-			return (Status);
-		}
+	InstancePtr->EraseState.Offset = StartOffset;
+	InstancePtr->EraseState.Bytes = Bytes;
+	InstancePtr->EraseState.Region = StartRegion;
+	InstancePtr->EraseState.Block = StartBlock;
+	InstancePtr->EraseState.BlocksLeft = XFL_GEOMETRY_BLOCK_DIFF(GeomPtr,
+						StartRegion, StartBlock,
+						EndRegion, EndBlock);
+	InstancePtr->EraseState.InProgress = 1;
+
+	EraseNextBlocks(InstancePtr);
+
+	return (XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+*
+* Checks the progress of the erase started by XFlashAmd_EraseStart(). The
+* toggle bits are read once, the sector erase command of the next block(s) is
+* sent when the previous ones are erased.
+*
+* @param	InstancePtr is the pointer to the XFlash instance.
+*
+* @return
+*		- XFLASH_BUSY if the erase is in progress.
+*		- XST_SUCCESS if the erase is done or no erase is in progress.
+*		- XFLASH_ERROR if the erase failed. The erase is abandoned.
+*		- XST_FAILURE if failed.
+*
+* @note		None.
+*
+******************************************************************************/
+int XFlashAmd_PollStatus(XFlash * InstancePtr)
+{
+	int Status = (int)XST_FAILURE;
+
+	/* Verify inputs are valid. */
+	if (InstancePtr == NULL) {
+		return (XST_FAILURE);
+	}
+
+	if (InstancePtr->EraseState.InProgress == 0) {
+		return (XST_SUCCESS);
+	}
+
+	Status = CheckToggle(InstancePtr, InstancePtr->EraseState.PollOffset,
+			     XFL_AMD_SR_ERASE_ERROR_MASK);
+	if (Status == XFLASH_BUSY) {
+		return (XFLASH_BUSY);
+	}
+
+	if ((Status == XFLASH_READY) &&
+	    (InstancePtr->EraseState.BlocksLeft > 0)) {
+		EraseNextBlocks(InstancePtr);
+		return (XFLASH_BUSY);
 	}
 
 	/* Reset the bank(s) so that it returns to the read mode. */
-	(void) XFlashAmd_ResetBank(InstancePtr, StartOffset, Bytes);
+	InstancePtr->EraseState.InProgress = 0;
+	(void) XFlashAmd_ResetBank(InstancePtr, InstancePtr->EraseState.Offset,
+				   InstancePtr->EraseState.Bytes);
+
+	if (Status != XFLASH_READY) {
+		return (Status);
+	}
 
 	return (XST_SUCCESS);
 }
@@ -1641,35 +1744,34 @@ static int WriteBuffer16(XFlash * InstancePtr, void *DestPtr,
 static int WriteBufferSpansion(XFlash * InstancePtr, void *DestPtr,
                          void *SrcPtr, u32 Bytes)
 {
-       u32 DestinationPtr = (u32)DestPtr;
-       u32 BaseAddress= InstancePtr->Geometry.BaseAddress;
-       u16* Tempsrcptr = (u16 *)SrcPtr;
-       u32 Index = 0;
-       int Status = (int)XST_FAILURE;
-       XFlashVendorData_Amd *DevDataPtr = GET_PARTDATA(InstancePtr);
-       u32 BufferSize = InstancePtr->Properties.ProgCap.WriteBufferSize;
-
-	while (Bytes != 0)
-	{
-		/* Bytes to write should not exceed the buffer size. */
-		if (Bytes > BufferSize)
-		{
-			Status = WriteSingleBuffer(InstancePtr, DestPtr,
-						Tempsrcptr, BufferSize);
-			Bytes = Bytes - BufferSize;
-			DestPtr = DestPtr + BufferSize;
-			Tempsrcptr = Tempsrcptr + BufferSize/2;
-		}
-		else
-		{
-			Status = WriteSingleBuffer(InstancePtr, DestPtr,
-						Tempsrcptr, Bytes);
-			Bytes = 0;
+	u32 DestinationPtr = (u32)DestPtr;
+	u16 *Tempsrcptr = (u16 *)SrcPtr;
+	u32 BufferWords = InstancePtr->Properties.ProgCap.WriteBufferSize / 2;
+	u32 WordsLeft = (Bytes + 1) / 2;
+	u32 WordCount;
+	int Status = (int)XST_FAILURE;
+
+	while (WordsLeft != 0) {
+		/*
+		 * A buffer program should not cross a write buffer boundary.
+		 * DestPtr is a word offset, WriteSingleBuffer() takes a byte
+		 * offset.
+		 */
+		WordCount = BufferWords - (DestinationPtr & (BufferWords - 1));
+		if (WordCount > WordsLeft) {
+			WordCount = WordsLeft;
 		}
-		if (Status != XST_SUCCESS)
-		{
+
+		Status = WriteSingleBuffer(InstancePtr,
+					(void *)(DestinationPtr * 2),
+					Tempsrcptr, WordCount * 2);
+		if (Status != XST_SUCCESS) {
 			return Status;
 		}
+
+		DestinationPtr += WordCount;
+		Tempsrcptr += WordCount;
+		WordsLeft -= WordCount;
 	}
 
 	Status = (int)XST_SUCCESS;
@@ -1709,6 +1811,11 @@ static int WriteBufferAmd(XFlash * InstancePtr, void *DestPtr,
 	int Status = (int)XST_FAILURE;
 	XFlashVendorData_Amd *DevDataPtr = GET_PARTDATA(InstancePtr);
 
+	/* Parts with a write buffer are programmed a buffer at a time. */
+	if (InstancePtr->Properties.ProgCap.WriteBufferSize != 0) {
+		return (WriteBufferedAmd(InstancePtr, DestPtr, SrcPtr, Bytes));
+	}
+
 	/* Send the Unlock Bypass command. */
 	DevDataPtr->SendCmdSeq(BaseAddress,
 				XFL_AMD_CMD1_ADDR, XFL_AMD_CMD2_ADDR,
@@ -1746,6 +1853,107 @@ static int WriteBufferAmd(XFlash * InstancePtr, void *DestPtr,
 
 	return (XST_SUCCESS);
 }
+/*****************************************************************************/
+/**
+*
+* This function is used to program Amd devices that have a write buffer. It
+* does not erase the flash first and will fail if the block(s) are not erased
+* first. Each write to buffer command programs the data up to the next write
+* buffer boundary.
+*
+* @param	InstancePtr is the instance to work on.
+* @param	DestPtr is the word offset of the destination in flash memory
+*		space.
+* @param	SrcPtr is the source data.
+* @param	Bytes is the number of bytes to program.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XFLASH_ERROR if a write error occurred or the buffer program
+*		  was aborted.
+*
+* @note		None.
+*
+******************************************************************************/
+static int WriteBufferedAmd(XFlash * InstancePtr, void *DestPtr,
+			    void *SrcPtr, u32 Bytes)
+{
+	u16 *SourcePtr = (u16*)SrcPtr;
+	u32 DestinationPtr = (u32)DestPtr;
+	u32 BaseAddress = InstancePtr->Geometry.BaseAddress;
+	u32 BufferWords = InstancePtr->Properties.ProgCap.WriteBufferSize / 2;
+	u32 WordsLeft = (Bytes + 1) / 2;
+	u32 WordCount;
+	u32 SectorAddress;
+	u32 Index;
+	u32 Dummy;
+	u16 Region;
+	u16 Block;
+	int Status = (int)XST_FAILURE;
+	XFlashVendorData_Amd *DevDataPtr = GET_PARTDATA(InstancePtr);
+
+	while (WordsLeft != 0) {
+		/* A buffer program must not cross a write buffer boundary. */
+		WordCount = BufferWords - (DestinationPtr & (BufferWords - 1));
+		if (WordCount > WordsLeft) {
+			WordCount = WordsLeft;
+		}
+
+		(void) XFlashGeometry_ToBlock(&InstancePtr->Geometry,
+					      DestinationPtr, &Region, &Block,
+					      &Dummy);
+		(void) XFlashGeometry_ToAbsolute(&InstancePtr->Geometry, Region,
+						 Block, 0, &SectorAddress);
+
+		/* Send Write to Buffer command at the sector address. */
+		DevDataPtr->SendCmdSeq(BaseAddress,
+					XFL_AMD_CMD1_ADDR, XFL_AMD_CMD2_ADDR,
+					XFL_AMD_CMD1_DATA, XFL_AMD_CMD2_DATA);
+		DevDataPtr->WriteFlash(BaseAddress, SectorAddress,
+					XFL_AMD_CMD_WRITE_BUFFER);
+		DevDataPtr->WriteFlash(BaseAddress, SectorAddress,
+					WordCount - 1);
+
+		/* Write Data to Buffer. */
+		for (Index = 0; Index < WordCount; Index++) {
+			DevDataPtr->WriteFlash(BaseAddress,
+					DestinationPtr + Index,
+					SourcePtr[Index]);
+		}
+
+		/* Send Write buffer program confirm command. */
+		DevDataPtr->WriteFlash(BaseAddress, SectorAddress,
+					XFL_AMD_CMD_PROGRAM_BUFFER);
+
+		/*
+		 * Poll the last word loaded, DQ1 set while DQ6 toggles
+		 * means the buffer program was aborted.
+		 */
+		do {
+			Status = CheckToggle(InstancePtr,
+					DestinationPtr + WordCount - 1,
+					XFL_AMD_SR_ERASE_ERROR_MASK |
+					XFL_AMD_SR_BUFFER_ABORT_MASK);
+		} while (Status == XFLASH_BUSY);
+
+		if (Status != XFLASH_READY) {
+			/* Write to Buffer Abort Reset. */
+			DevDataPtr->SendCmdSeq(BaseAddress,
+					XFL_AMD_CMD1_ADDR, XFL_AMD_CMD2_ADDR,
+					XFL_AMD_CMD1_DATA, XFL_AMD_CMD2_DATA);
+			DevDataPtr->SendCmd(BaseAddress, XFL_AMD_CMD1_ADDR,
+					XFL_AMD_CMD_BUFFER_ABORT_RESET);
+			return (XFLASH_ERROR);
+		}
+
+		DestinationPtr += WordCount;
+		SourcePtr += WordCount;
+		WordsLeft -= WordCount;
+	}
+
+	return (XST_SUCCESS);
+}
+
 /*****************************************************************************/
 /**
 *
@@ -2225,6 +2433,83 @@ static int PollSR32(u32 BaseAddr , u32 BlockAddr)
 	}
 }
 
+/*****************************************************************************/
+/**
+*
+* Reads the toggle bits once to check the progress of an erase or program
+* operation. This is one pass of the PollSR algorithm for any bus width.
+*
+* @param	InstancePtr is the instance to work on.
+* @param	Offset is the offset of a location being erased or programmed.
+* @param	ErrorMask holds the status bits that indicate the operation may
+*		have failed, DQ5 and, for buffer programs, DQ1.
+*
+* @return	- XFLASH_READY if the operation is done.
+*		- XFLASH_BUSY if the operation is in progress.
+*		- XFLASH_ERROR if the operation failed.
+*
+* @note		None.
+*
+******************************************************************************/
+static int CheckToggle(XFlash * InstancePtr, u32 Offset, u32 ErrorMask)
+{
+	u32 BaseAddress = InstancePtr->Geometry.BaseAddress;
+	u32 StatusReg1;
+	u32 StatusReg2;
+	XFlashVendorData_Amd *DevDataPtr = GET_PARTDATA(InstancePtr);
+
+	/* Read DQ6 twice, no toggle means the operation is done. */
+	StatusReg1 = (u32)DevDataPtr->GetStatus(BaseAddress, Offset);
+	StatusReg2 = (u32)DevDataPtr->GetStatus(BaseAddress, Offset);
+	if ((StatusReg1 & XFL_AMD_SR_ERASE_COMPL_MASK) ==
+		(StatusReg2 & XFL_AMD_SR_ERASE_COMPL_MASK)) {
+		return (XFLASH_READY);
+	}
+
+	if ((StatusReg2 & ErrorMask) == 0) {
+		return (XFLASH_BUSY);
+	}
+
+	/* An error bit is set, DQ6 still toggling means fail. */
+	StatusReg1 = (u32)DevDataPtr->GetStatus(BaseAddress, Offset);
+	StatusReg2 = (u32)DevDataPtr->GetStatus(BaseAddress, Offset);
+	if ((StatusReg1 & XFL_AMD_SR_ERASE_COMPL_MASK) ==
+		(StatusReg2 & XFL_AMD_SR_ERASE_COMPL_MASK)) {
+		return (XFLASH_READY);
+	}
+
+	return (XFLASH_ERROR);
+}
+
+/*****************************************************************************/
+/**
+*
+* Sends the sector erase command of the next block(s) of the erase in
+* progress. The toggle bits are polled at the first block sent.
+*
+* @param	InstancePtr is the pointer to xflash object to work on.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void EraseNextBlocks(XFlash * InstancePtr)
+{
+	u16 BlocksQueued;
+
+	(void) XFlashGeometry_ToAbsolute(&InstancePtr->Geometry,
+					 InstancePtr->EraseState.Region,
+					 InstancePtr->EraseState.Block, 0,
+					 &InstancePtr->EraseState.PollOffset);
+
+	BlocksQueued = EnqueueEraseBlocks(InstancePtr,
+					  &InstancePtr->EraseState.Region,
+					  &InstancePtr->EraseState.Block,
+					  InstancePtr->EraseState.BlocksLeft);
+	InstancePtr->EraseState.BlocksLeft -= BlocksQueued;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -2297,16 +2582,18 @@ static void GetPartID(XFlash * InstancePtr)
 *		Region and Block parameters are incremented the number of blocks
 *		queued.
 *
-* @note		Limitation: Only support enqueuing one block at a time.
+* @note		Up to ProgCap.EraseQueueSize blocks are sent with one sector
+*		erase command.
 *
 ******************************************************************************/
 static u16 EnqueueEraseBlocks(XFlash * InstancePtr, u16 *Region,
 			      u16 *Block, u16 MaxBlocks)
 {
 	u32 BlockAddress;
+	u32 FirstAddress;
+	u16 BlocksQueued;
 	XFlashGeometry *GeomPtr;
 	XFlashVendorData_Amd *DevDataPtr;
-	volatile u16 FlashStatus;
 
 	/*
 	 * If for some reason the maximum number of blocks to enqueue is
@@ -2344,9 +2631,38 @@ static u16 EnqueueEraseBlocks(XFlash * InstancePtr, u16 *Region,
 
 	/* Increment Region/Block. */
 	XFL_GEOMETRY_INCREMENT(GeomPtr, *Region, *Block);
+	BlocksQueued = 1;
+	FirstAddress = BlockAddress;
+
+	/*
+	 * Further blocks are accepted while the sector erase timer runs, DQ3
+	 * is set once it expired and the erase started. A block sent while
+	 * DQ3 was being set may not have been accepted, it is left for the
+	 * next sector erase command.
+	 */
+	while ((BlocksQueued < MaxBlocks) && (BlocksQueued <
+		InstancePtr->Properties.ProgCap.EraseQueueSize)) {
+		if ((DevDataPtr->GetStatus(GeomPtr->BaseAddress, FirstAddress) &
+			XFL_AMD_SR_ERASE_START_MASK) != 0) {
+			break;
+		}
+
+		(void) XFlashGeometry_ToAbsolute(GeomPtr, *Region, *Block, 0,
+						 &BlockAddress);
+		DevDataPtr->WriteFlash(GeomPtr->BaseAddress, BlockAddress,
+				XFL_AMD_CMD_ERASE_BLOCK);
+
+		if ((DevDataPtr->GetStatus(GeomPtr->BaseAddress, FirstAddress) &
+			XFL_AMD_SR_ERASE_START_MASK) != 0) {
+			break;
+		}
+
+		XFL_GEOMETRY_INCREMENT(GeomPtr, *Region, *Block);
+		BlocksQueued++;
+	}
 
 	/* Return the number of blocks enqueued. */
-	return (1);
+	return (BlocksQueued);
 }
 
 /*****************************************************************************/
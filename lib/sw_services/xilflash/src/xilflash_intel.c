@@ -72,6 +72,9 @@
 *		      with AXI interface.
 * 4.1	nsk  08/06/15 Fixed CR 835008.
 * 4.7	akm  07/23/19 Initialized Status variable to XST_FAILURE.
+* 4.9	ag   10/14/26 Added XFlashIntel_EraseStart() and
+*		      XFlashIntel_PollStatus(), XFlashIntel_Erase() uses them
+*		      and polls the status of the block being erased.
 * </pre>
 *
 ******************************************************************************/
@@ -186,6 +189,7 @@ static void GetPartID(XFlash *InstancePtr);
 static int XFlashIntel_ResetBank(XFlash *InstancePtr, u32 Offset, u32 Bytes);
 static u16 EnqueueEraseBlocks(XFlash *InstancePtr, u16 *RegionPtr,
 				u16 *BlockPtr, u16 MaxBlocks);
+static void EraseNextBlocks(XFlash *InstancePtr);
 
 extern int XFlashGeometry_ToBlock(XFlashGeometry *InstancePtr,
 				u32 AbsoluteOffset,
@@ -477,13 +481,51 @@ int XFlashIntel_Write(XFlash *InstancePtr, u32 Offset, u32 Bytes, void *SrcPtr)
 *
 ******************************************************************************/
 int XFlashIntel_Erase(XFlash *InstancePtr, u32 Offset, u32 Bytes)
+{
+	int Status = (int)XST_FAILURE;
+
+	Status = XFlashIntel_EraseStart(InstancePtr, Offset, Bytes);
+	if (Status != XST_SUCCESS) {
+		return (Status);
+	}
+
+	/*
+	 * Poll until all the blocks are erased.
+	 */
+	do {
+		Status = XFlashIntel_PollStatus(InstancePtr);
+	} while (Status == XFLASH_BUSY);
+
+	return (Status);
+}
+
+/*****************************************************************************/
+/**
+*
+* Starts erasing the specified address range in the Intel Flash device. The
+* erase command of the first block is sent, the following blocks are sent by
+* XFlashIntel_PollStatus().
+*
+* @param	InstancePtr is the pointer to the XFlash instance.
+* @param	Offset is the offset into the device(s) address space from which
+*		to begin erasure.
+* @param	Bytes is the number of bytes to erase.
+*
+* @return
+*		- XST_SUCCESS if the erase is started.
+*		- XFLASH_ADDRESS_ERROR if the destination address range is
+*		  not completely within the addressable areas of the device(s).
+*		- XFLASH_BUSY if an erase is already in progress.
+*
+* @note		None.
+*
+******************************************************************************/
+int XFlashIntel_EraseStart(XFlash *InstancePtr, u32 Offset, u32 Bytes)
 {
 	u16 StartRegion, EndRegion;
 	u16 StartBlock, EndBlock;
-	u16 BlocksLeft, BlocksQueued;
 	u32 Dummy;
 	XFlashGeometry *GeomPtr;
-	XFlashVendorData_Intel *DevDataPtr;
 	int Status = (int)XST_FAILURE;
 
 	/*
@@ -493,6 +535,10 @@ int XFlashIntel_Erase(XFlash *InstancePtr, u32 Offset, u32 Bytes)
 		return XST_FAILURE;
 	}
 
+	if (InstancePtr->EraseState.InProgress != 0) {
+		return (XFLASH_BUSY);
+	}
+
 	GeomPtr = &InstancePtr->Geometry;
 
 	/*
@@ -522,30 +568,77 @@ int XFlashIntel_Erase(XFlash *InstancePtr, u32 Offset, u32 Bytes)
 		return (XFLASH_ADDRESS_ERROR);
 	}
 
+	InstancePtr->EraseState.Offset = Offset;
+	InstancePtr->EraseState.Bytes = Bytes;
+	InstancePtr->EraseState.Region = StartRegion;
+	InstancePtr->EraseState.Block = StartBlock;
+	InstancePtr->EraseState.BlocksLeft = XFL_GEOMETRY_BLOCK_DIFF(GeomPtr,
+						StartRegion, StartBlock,
+						EndRegion, EndBlock);
+	InstancePtr->EraseState.InProgress = 1;
+
+	EraseNextBlocks(InstancePtr);
+
+	return (XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+*
+* Checks the progress of the erase started by XFlashIntel_EraseStart(). The
+* status register is read once, the erase command of the next block is sent
+* when the WSM is done with the previous one.
+*
+* @param	InstancePtr is the pointer to the XFlash instance.
+*
+* @return
+*		- XFLASH_BUSY if the erase is in progress.
+*		- XST_SUCCESS if the erase is done or no erase is in progress.
+*		- XFLASH_ERROR if the WSM reported an error. The erase is
+*		  abandoned.
+*
+* @note		None.
+*
+******************************************************************************/
+int XFlashIntel_PollStatus(XFlash *InstancePtr)
+{
+	XFlashVendorData_Intel *DevDataPtr;
+	int Status = (int)XST_FAILURE;
+
 	/*
-	 * Erase loop. Queue up as many blocks at a time until all are erased.
+	 * Verify inputs are valid.
 	 */
-	DevDataPtr = GET_PARTDATA(InstancePtr);
-	BlocksLeft = XFL_GEOMETRY_BLOCK_DIFF(GeomPtr, StartRegion, StartBlock,
-					     EndRegion, EndBlock);
+	if(InstancePtr == NULL) {
+		return XST_FAILURE;
+	}
 
-	while (BlocksLeft > 0) {
-		BlocksQueued = EnqueueEraseBlocks(InstancePtr, &StartRegion,
-						  &StartBlock, BlocksLeft);
-		BlocksLeft -= BlocksQueued;
+	if (InstancePtr->EraseState.InProgress == 0) {
+		return (XST_SUCCESS);
+	}
 
-		Status = DevDataPtr->PollSR(InstancePtr, Offset);
-		if (Status != XFLASH_READY) {
-			(void) XFlashIntel_ResetBank(InstancePtr, Offset,
-						     Bytes);
-			return (Status);
-		}
+	DevDataPtr = GET_PARTDATA(InstancePtr);
+	Status = DevDataPtr->GetStatus(InstancePtr,
+				       InstancePtr->EraseState.PollOffset);
+	if (Status == XFLASH_BUSY) {
+		return (XFLASH_BUSY);
+	}
+
+	if ((Status == XFLASH_READY) &&
+	    (InstancePtr->EraseState.BlocksLeft > 0)) {
+		EraseNextBlocks(InstancePtr);
+		return (XFLASH_BUSY);
 	}
 
 	/*
 	 * Reset the bank(s) so that it returns to the read mode.
 	 */
-	(void) XFlashIntel_ResetBank(InstancePtr, Offset, Bytes);
+	InstancePtr->EraseState.InProgress = 0;
+	(void) XFlashIntel_ResetBank(InstancePtr, InstancePtr->EraseState.Offset,
+				     InstancePtr->EraseState.Bytes);
+
+	if (Status != XFLASH_READY) {
+		return (Status);
+	}
 
 	return (XST_SUCCESS);
 }
@@ -3181,6 +3274,35 @@ static int SetRYBY(XFlash *InstancePtr, u32 Mode)
 	return (XST_SUCCESS);
 }
 
+/*****************************************************************************/
+/**
+*
+* Sends the erase command of the next block(s) of the erase in progress. The
+* status of the erase is read from the first block sent.
+*
+* @param	InstancePtr is the pointer to xflash object to work on.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void EraseNextBlocks(XFlash *InstancePtr)
+{
+	u16 BlocksQueued;
+
+	(void) XFlashGeometry_ToAbsolute(&InstancePtr->Geometry,
+					 InstancePtr->EraseState.Region,
+					 InstancePtr->EraseState.Block, 0,
+					 &InstancePtr->EraseState.PollOffset);
+
+	BlocksQueued = EnqueueEraseBlocks(InstancePtr,
+					  &InstancePtr->EraseState.Region,
+					  &InstancePtr->EraseState.Block,
+					  InstancePtr->EraseState.BlocksLeft);
+	InstancePtr->EraseState.BlocksLeft -= BlocksQueued;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -43,6 +43,7 @@
 #                       to provide the access to the xilfpga library to get the
 #                       xilfpga version and supported feature list info.
 # 6.2  Nava   01/19/22  Added build time flag to skip eFUSE checks.
+# 6.3  ag     10/15/26  Added build time flags for the bitstream cache.
 #
 ##############################################################################
 
@@ -192,6 +193,13 @@ proc generate {lib_handle} {
 	puts $conffile "#define XFPGA_SKIP_EFUSE_CHECK"
    }
 
+   set value  [common::get_property CONFIG.bitstream_cache_en $lib_handle]
+   if {$value == true} {
+	puts $conffile "#define XFPGA_BITSTREAM_CACHE"
+	set value  [common::get_property CONFIG.bitstream_cache_entries $lib_handle]
+	puts $conffile "#define XFPGA_CACHE_MAX_ENTRIES ${value}U"
+   }
+
    set value  [common::get_property CONFIG.debug_mode $lib_handle]
 
    if {$value == true} {
@@ -125,6 +125,8 @@
  * 6.3 Nava  06/22/22  Skip eFUSE checks to allow xilfpga to load non-secure
  *                     bitstream in secure boot platform.
  * 6.3 Nava  08/05/22  Added doxygen tags.
+ * 6.3 ag    10/15/26  Added chunked readback compare and moved the readback
+ *                     command sequence to helper functions.
  *
  * </pre>
  *
@@ -227,6 +229,14 @@ static u32 XFpga_GetConfigRegPcap(const XFpga *InstancePtr);
 #endif
 #if defined(XFPGA_READ_CONFIG_DATA)
 static u32 XFpga_GetPLConfigDataPcap(const XFpga *InstancePtr);
+static u32 XFpga_ComparePLConfigDataPcap(const XFpga *InstancePtr);
+static u32 XFpga_ReadbackInit(void);
+static u32 XFpga_ReadbackCmd(u32 *CmdBuf, u32 Far, u32 NumWords);
+static u32 XFpga_ReadbackEnd(void);
+static u32 XFpga_CompareChunkLen(const XFpga_ReadbackCompare *ComparePtr,
+				 u32 Offset);
+static void XFpga_CompareChunk(XFpga_ReadbackCompare *ComparePtr,
+			       UINTPTR ChunkAddr, u32 Offset, u32 Len);
 static u32 XFpga_PcapWaitForidle(void);
 static u32 Xfpga_Type2Pkt(u8 OpCode, u32 Size);
 #endif
@@ -319,6 +329,7 @@ u32 XFpga_Initialize(XFpga *InstancePtr) {
 #endif
 #if defined(XFPGA_READ_CONFIG_DATA)
 	InstancePtr->XFpga_GetConfigData = XFpga_GetPLConfigDataPcap;
+	InstancePtr->XFpga_CompareConfigData = XFpga_ComparePLConfigDataPcap;
 #endif
 	/* Initialize CSU DMA driver */
 	CsuDmaPtr = Xsecure_GetCsuDma();
@@ -2239,25 +2250,19 @@ END:
 #if defined(XFPGA_READ_CONFIG_DATA)
 /*****************************************************************************/
 /**
- * This function performs the readback of fpga configuration data.
- *
- * @param InstancePtr Pointer to the XFpga structure.
+ * This function prepares the PCAP for the readback of fpga configuration
+ * data.
  *
  * @return
  *               - XFPGA_SUCCESS if successful
- *               - XFPGA_FAILURE if unsuccessful
+ *               - Error code if unsuccessful
  *
- * @note None.
+ * @note The PCAP clock is enabled, the caller disables it.
  ****************************************************************************/
-static u32 XFpga_GetPLConfigDataPcap(const XFpga *InstancePtr)
+static u32 XFpga_ReadbackInit(void)
 {
 	volatile u32 Status = XFPGA_FAILURE;
-	UINTPTR Address = InstancePtr->ReadInfo.ReadbackAddr;
-	u32 NumFrames = InstancePtr->ReadInfo.ConfigReg_NumFrames;
 	u32 RegVal;
-	u32 cmdindex;
-	u32 CmdBuf[XFPGA_DATA_CONFIG_CMD_LEN];
-	s32 i;
 
 	Status = XFpga_GetFirmwareState();
 
@@ -2292,9 +2297,28 @@ static u32 XFpga_GetPLConfigDataPcap(const XFpga *InstancePtr)
 	if (Status != XFPGA_SUCCESS) {
 		Status = XPFGA_ERROR_PCAP_INIT;
 		Xfpga_Printf(XFPGA_DEBUG, "PCAP init failed\n\r");
-		goto END;
 	}
 
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function builds the command sequence that reads back configuration
+ * data from a frame address.
+ *
+ * @param CmdBuf Buffer of XFPGA_DATA_CONFIG_CMD_LEN words for the commands.
+ * @param Far Frame address of the first frame.
+ * @param NumWords Number of words to read back.
+ *
+ * @return Number of command words.
+ ****************************************************************************/
+static u32 XFpga_ReadbackCmd(u32 *CmdBuf, u32 Far, u32 NumWords)
+{
+	u32 cmdindex;
+	s32 i;
+
 	cmdindex = 0U;
 
 	/* Step 1 */
@@ -2345,14 +2369,14 @@ static u32 XFpga_GetPLConfigDataPcap(const XFpga *InstancePtr)
 	/* Step 7 */         /* Type 1 Write 1 Word to FAR */
 	CmdBuf[cmdindex] = Xfpga_RegAddr(FAR1, OPCODE_WRITE, 0x1U);
 	cmdindex++;
-	CmdBuf[cmdindex] = 0x00000000U; /* FAR Address = 00000000 */
+	CmdBuf[cmdindex] = Far; /* FAR Address */
 	cmdindex++;
 
 	/* Step 8 */          /* Type 1 Read 0 Words from FDRO */
 	CmdBuf[cmdindex] =  Xfpga_RegAddr(FDRO, OPCODE_READ, 0U);
 	cmdindex++;
 			      /* Type 2 Read Wordlenght Words from FDRO */
-	CmdBuf[cmdindex] = Xfpga_Type2Pkt(OPCODE_READ, NumFrames);
+	CmdBuf[cmdindex] = Xfpga_Type2Pkt(OPCODE_READ, NumWords);
 	cmdindex++;
 
 	/* Step 9 --- 64 NOOPS Words */
@@ -2361,6 +2385,102 @@ static u32 XFpga_GetPLConfigDataPcap(const XFpga *InstancePtr)
 		cmdindex++;
 	}
 
+	return cmdindex;
+}
+
+/*****************************************************************************/
+/**
+ * This function waits for the readback to complete and restarts the fpga.
+ *
+ * @return
+ *               - XFPGA_SUCCESS if successful
+ *               - XFPGA_FAILURE if unsuccessful
+ ****************************************************************************/
+static u32 XFpga_ReadbackEnd(void)
+{
+	volatile u32 Status = XFPGA_FAILURE;
+	u32 CmdBuf[XFPGA_DATA_CONFIG_CMD_LEN];
+	u32 cmdindex;
+
+	Status = XFpga_PcapWaitForidle();
+	if (Status != XFPGA_SUCCESS) {
+		Xfpga_Printf(XFPGA_DEBUG, "Reading data from PL through PCAP Failed\n\r");
+		Status = XFPGA_FAILURE;
+		goto END;
+	}
+
+	cmdindex = 0U;
+	/* Step 11 */
+	CmdBuf[cmdindex] = 0x20000000U; /* Type 1 NOOP Word 0 */
+	cmdindex++;
+
+	/* Step 12 */
+	CmdBuf[cmdindex] = 0x30008001U; /* Type 1 Write 1 Word to CMD */
+	cmdindex++;
+	CmdBuf[cmdindex] = 0x00000005U; /* START Command */
+	cmdindex++;
+	CmdBuf[cmdindex] = 0x20000000U; /* Type 1 NOOP Word 0 */
+	cmdindex++;
+
+	/* Step 13 */
+	CmdBuf[cmdindex] = 0x30008001U; /* Type 1 Write 1 Word to CMD */
+	cmdindex++;
+	CmdBuf[cmdindex] = 0x00000007U; /* RCRC Command */
+	cmdindex++;
+	CmdBuf[cmdindex] = 0x20000000U; /* Type 1 NOOP Word 0 */
+	cmdindex++;
+
+	/* Step 14 */
+	CmdBuf[cmdindex] = 0x30008001U; /* Type 1 Write 1 Word to CMD */
+	cmdindex++;
+	CmdBuf[cmdindex] = 0x0000000DU; /* DESYNC Command */
+	cmdindex++;
+
+	/* Step 15 */
+	CmdBuf[cmdindex] = 0x20000000U; /* Type 1 NOOP Word 0 */
+	cmdindex++;
+	CmdBuf[cmdindex] = 0x20000000U; /* Type 1 NOOP Word 0 */
+	cmdindex++;
+
+	Status = XFPGA_FAILURE;
+	Status = XFpga_WriteToPcap(cmdindex, (UINTPTR)CmdBuf);
+	if (Status != XFPGA_SUCCESS) {
+		Xfpga_Printf(XFPGA_DEBUG, "Write to PCAP 1 Failed\n\r");
+		Status = XFPGA_FAILURE;
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function performs the readback of fpga configuration data.
+ *
+ * @param InstancePtr Pointer to the XFpga structure.
+ *
+ * @return
+ *               - XFPGA_SUCCESS if successful
+ *               - XFPGA_FAILURE if unsuccessful
+ *
+ * @note None.
+ ****************************************************************************/
+static u32 XFpga_GetPLConfigDataPcap(const XFpga *InstancePtr)
+{
+	volatile u32 Status = XFPGA_FAILURE;
+	UINTPTR Address = InstancePtr->ReadInfo.ReadbackAddr;
+	u32 NumFrames = InstancePtr->ReadInfo.ConfigReg_NumFrames;
+	u32 RegVal;
+	u32 cmdindex;
+	u32 CmdBuf[XFPGA_DATA_CONFIG_CMD_LEN];
+
+	Status = XFpga_ReadbackInit();
+	if (Status != XFPGA_SUCCESS) {
+		goto END;
+	}
+
+	cmdindex = XFpga_ReadbackCmd(CmdBuf, 0U, NumFrames);
+
 	XCsuDma_EnableIntr(CsuDmaPtr, XCSUDMA_DST_CHANNEL,
 			   XCSUDMA_IXR_DST_MASK);
 
@@ -2407,52 +2527,208 @@ static u32 XFpga_GetPLConfigDataPcap(const XFpga *InstancePtr)
 	XCsuDma_IntrClear(CsuDmaPtr, XCSUDMA_DST_CHANNEL, XCSUDMA_IXR_DONE_MASK);
 
 	Status = XFPGA_FAILURE;
-	Status = XFpga_PcapWaitForidle();
+	Status = XFpga_ReadbackEnd();
+END:
+	/* Disable the PCAP clk */
+	RegVal = Xil_In32(PCAP_CLK_CTRL);
+	Xil_Out32(PCAP_CLK_CTRL, RegVal & ~(PCAP_CLK_EN_MASK));
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function returns the length of the next readback DMA transfer of a
+ * compare. The pad words are read back first, then chunks of frames.
+ *
+ * @param ComparePtr Pointer to the compare description.
+ * @param Offset Words read back so far.
+ *
+ * @return Number of words of the transfer.
+ ****************************************************************************/
+static u32 XFpga_CompareChunkLen(const XFpga_ReadbackCompare *ComparePtr,
+				 u32 Offset)
+{
+	u32 ChunkWords = ComparePtr->ChunkFrames * XFPGA_WORDS_PER_FRAME;
+	u32 Len;
+
+	if (Offset < ComparePtr->PadWords) {
+		Len = ComparePtr->PadWords - Offset;
+	} else {
+		Len = ComparePtr->PadWords +
+			(ComparePtr->NumFrames * XFPGA_WORDS_PER_FRAME) - Offset;
+	}
+
+	if (Len > ChunkWords) {
+		Len = ChunkWords;
+	}
+
+	return Len;
+}
+
+/*****************************************************************************/
+/**
+ * This function compares the frames of a readback chunk with the golden
+ * image, and records the frames that do not match.
+ *
+ * @param ComparePtr Pointer to the compare description.
+ * @param ChunkAddr Address of the chunk.
+ * @param Offset Word offset of the chunk in the readback.
+ * @param Len Number of words of the chunk.
+ *
+ * @return None.
+ ****************************************************************************/
+static void XFpga_CompareChunk(XFpga_ReadbackCompare *ComparePtr,
+			       UINTPTR ChunkAddr, u32 Offset, u32 Len)
+{
+	const u32 *Data = (const u32 *)ChunkAddr;
+	const u32 *Golden;
+	const u32 *Mask = NULL;
+	u32 Frame;
+	u32 Word;
+	u32 Diff;
+
+	if (Offset < ComparePtr->PadWords) {
+		/* Pad words are not compared */
+		goto END;
+	}
+
+	Frame = (Offset - ComparePtr->PadWords) / XFPGA_WORDS_PER_FRAME;
+	Golden = (const u32 *)(ComparePtr->GoldenAddr +
+		((Offset - ComparePtr->PadWords) * 4U));
+	if (ComparePtr->MaskAddr != 0U) {
+		Mask = (const u32 *)(ComparePtr->MaskAddr +
+			((Offset - ComparePtr->PadWords) * 4U));
+	}
+
+	for (Word = 0U; Word < Len; Word++) {
+		Diff = Data[Word] ^ Golden[Word];
+		if (Mask != NULL) {
+			Diff &= Mask[Word];
+		}
+		if (Diff != 0U) {
+			/* Record the frame, and skip to the next one */
+			if (ComparePtr->NumMismatch < ComparePtr->MaxMismatch) {
+				ComparePtr->MismatchPtr[ComparePtr->NumMismatch] =
+					Frame + (Word / XFPGA_WORDS_PER_FRAME);
+			}
+			ComparePtr->NumMismatch++;
+			Word = ((Word / XFPGA_WORDS_PER_FRAME) + 1U) *
+				XFPGA_WORDS_PER_FRAME - 1U;
+		}
+	}
+
+END:
+	return;
+}
+
+/*****************************************************************************/
+/**
+ * This function reads back fpga configuration frames in chunks and compares
+ * them with a golden image.
+ *
+ * The destination DMA fills one chunk buffer while the previous chunk is
+ * compared. The PCAP read has no flow control, so the next transfer is
+ * started before the compare of the previous chunk, which is much faster
+ * than the reduced PCAP clock.
+ *
+ * @param InstancePtr Pointer to the XFpga structure.
+ *
+ * @return
+ *               - XFPGA_SUCCESS if successful
+ *               - XFPGA_FAILURE if unsuccessful
+ *
+ * @note None.
+ ****************************************************************************/
+static u32 XFpga_ComparePLConfigDataPcap(const XFpga *InstancePtr)
+{
+	volatile u32 Status = XFPGA_FAILURE;
+	XFpga_ReadbackCompare *ComparePtr = InstancePtr->ReadInfo.ComparePtr;
+	u32 ChunkBytes = ComparePtr->ChunkFrames * XFPGA_WORDS_PER_FRAME * 4U;
+	u32 NumWords = ComparePtr->PadWords +
+		(ComparePtr->NumFrames * XFPGA_WORDS_PER_FRAME);
+	UINTPTR ChunkAddr[2U];
+	u32 CmdBuf[XFPGA_DATA_CONFIG_CMD_LEN];
+	u32 cmdindex;
+	u32 RegVal;
+	u32 Offset = 0U;
+	u32 Len;
+	u32 Next;
+	u32 Index = 0U;
+
+	ChunkAddr[0U] = ComparePtr->ChunkAddr;
+	ChunkAddr[1U] = ComparePtr->ChunkAddr + ChunkBytes;
+
+	Status = XFpga_ReadbackInit();
 	if (Status != XFPGA_SUCCESS) {
-		Xfpga_Printf(XFPGA_DEBUG, "Reading data from PL through PCAP Failed\n\r");
-		Status = XFPGA_FAILURE;
 		goto END;
 	}
 
-	cmdindex = 0U;
-	/* Step 11 */
-	CmdBuf[cmdindex] = 0x20000000U; /* Type 1 NOOP Word 0 */
-	cmdindex++;
+	cmdindex = XFpga_ReadbackCmd(CmdBuf, ComparePtr->StartFar, NumWords);
 
-	/* Step 12 */
-	CmdBuf[cmdindex] = 0x30008001U; /* Type 1 Write 1 Word to CMD */
-	cmdindex++;
-	CmdBuf[cmdindex] = 0x00000005U; /* START Command */
-	cmdindex++;
-	CmdBuf[cmdindex] = 0x20000000U; /* Type 1 NOOP Word 0 */
-	cmdindex++;
+	XCsuDma_EnableIntr(CsuDmaPtr, XCSUDMA_DST_CHANNEL,
+			   XCSUDMA_IXR_DST_MASK);
 
-	/* Step 13 */
-	CmdBuf[cmdindex] = 0x30008001U; /* Type 1 Write 1 Word to CMD */
-	cmdindex++;
-	CmdBuf[cmdindex] = 0x00000007U; /* RCRC Command */
-	cmdindex++;
-	CmdBuf[cmdindex] = 0x20000000U; /* Type 1 NOOP Word 0 */
-	cmdindex++;
+	/* Flush the DMA buffers */
+	Xil_DCacheFlushRange(ComparePtr->ChunkAddr, 2U * ChunkBytes);
 
-	/* Step 14 */
-	CmdBuf[cmdindex] = 0x30008001U; /* Type 1 Write 1 Word to CMD */
-	cmdindex++;
-	CmdBuf[cmdindex] = 0x0000000DU; /* DESYNC Command */
-	cmdindex++;
+	/* Set up the Destination DMA Channel for the first chunk */
+	Len = XFpga_CompareChunkLen(ComparePtr, Offset);
+	XCsuDma_Transfer(CsuDmaPtr, XCSUDMA_DST_CHANNEL,
+			 ChunkAddr[Index], Len, 0U);
 
-	/* Step 15 */
-	CmdBuf[cmdindex] = 0x20000000U; /* Type 1 NOOP Word 0 */
-	cmdindex++;
-	CmdBuf[cmdindex] = 0x20000000U; /* Type 1 NOOP Word 0 */
-	cmdindex++;
+	Status = XFPGA_FAILURE;
+	Status = XFpga_PcapWaitForDone();
+	if (Status != XFPGA_SUCCESS) {
+		Xfpga_Printf(XFPGA_DEBUG, "Write to PCAP Failed\n\r");
+		Status = XFPGA_FAILURE;
+		goto END;
+	}
 
 	Status = XFPGA_FAILURE;
 	Status = XFpga_WriteToPcap(cmdindex, (UINTPTR)CmdBuf);
 	if (Status != XFPGA_SUCCESS) {
-		Xfpga_Printf(XFPGA_DEBUG, "Write to PCAP 1 Failed\n\r");
+		Xfpga_Printf(XFPGA_DEBUG, "Write to PCAP Failed\n\r");
 		Status = XFPGA_FAILURE;
+		goto END;
 	}
+
+	/*
+	 * Setup the  SSS, setup the DMA to receive from PCAP source
+	 */
+	Xil_Out32(CSU_CSU_SSS_CFG, XFPGA_CSU_SSS_SRC_DST_DMA);
+	Xil_Out32(CSU_PCAP_RDWR, 0x1U);
+
+	while (Offset < NumWords) {
+		Status = XFPGA_FAILURE;
+		Status = XCsuDma_WaitForDoneTimeout(CsuDmaPtr,
+						    XCSUDMA_DST_CHANNEL);
+		if (Status != XFPGA_SUCCESS) {
+			Xfpga_Printf(XFPGA_DEBUG, "Read from PCAP Failed\n\r");
+			Status = XFPGA_FAILURE;
+			goto END;
+		}
+		XCsuDma_IntrClear(CsuDmaPtr, XCSUDMA_DST_CHANNEL,
+				  XCSUDMA_IXR_DONE_MASK);
+
+		/* Start the next chunk before comparing this one */
+		Next = Offset + Len;
+		if (Next < NumWords) {
+			XCsuDma_Transfer(CsuDmaPtr, XCSUDMA_DST_CHANNEL,
+				ChunkAddr[Index ^ 1U],
+				XFpga_CompareChunkLen(ComparePtr, Next), 0U);
+		}
+
+		Xil_DCacheInvalidateRange(ChunkAddr[Index], Len * 4U);
+		XFpga_CompareChunk(ComparePtr, ChunkAddr[Index], Offset, Len);
+
+		Offset = Next;
+		Len = XFpga_CompareChunkLen(ComparePtr, Offset);
+		Index ^= 1U;
+	}
+
+	Status = XFPGA_FAILURE;
+	Status = XFpga_ReadbackEnd();
 END:
 	/* Disable the PCAP clk */
 	RegVal = Xil_In32(PCAP_CLK_CTRL);
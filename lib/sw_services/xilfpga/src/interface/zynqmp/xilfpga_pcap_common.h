@@ -63,6 +63,7 @@
  *                      function arguments to read KeyAddr and
  *                      Size(Bitstream size).
  * 6.3  Nava  08/05/22  Added doxygen tags.
+ * 6.3  ag    10/15/26  Added XFpga_ReadbackCompare structure.
  * </pre>
  *
  * @note
@@ -111,16 +112,50 @@ typedef struct {
 		u32 Flags;
 }XFpga_Write;
 
+/**
+ * Structure to describe a readback compare of PL configuration frames.
+ *
+ * @param GoldenAddr	Expected frame data, NumFrames frames.
+ * @param MaskAddr	Mask of the bits to compare, in the layout of the
+ *			golden data. 0 compares all bits.
+ * @param ChunkAddr	Two chunk buffers of ChunkFrames frames each, the
+ *			readback DMA fills one while the other is compared.
+ * @param MismatchPtr	Filled with the indexes, from StartFar, of the
+ *			frames that do not match.
+ * @param StartFar	Frame address of the first frame to read back.
+ * @param NumFrames	Number of frames to compare.
+ * @param PadWords	Words read back before the first frame (pad frame
+ *			and dummy words), which are not compared.
+ * @param ChunkFrames	Frames read back per DMA transfer.
+ * @param MaxMismatch	Number of entries of MismatchPtr.
+ * @param NumMismatch	Set to the number of frames that do not match, it
+ *			may be more than MaxMismatch.
+ */
+typedef struct {
+		UINTPTR GoldenAddr;
+		UINTPTR MaskAddr;
+		UINTPTR ChunkAddr;
+		u32 *MismatchPtr;
+		u32 StartFar;
+		u32 NumFrames;
+		u32 PadWords;
+		u32 ChunkFrames;
+		u32 MaxMismatch;
+		u32 NumMismatch;
+}XFpga_ReadbackCompare;
+
 /**
  * Structure to store the PL Image details.
  *
  * @param ReadbackAddr	Address which is used to store the PL readback data.
  * @param ConfigReg		Configuration register value to be returned (or)
  * 			The number of Fpga configuration frames to read
+ * @param ComparePtr	Readback compare to run.
  */
 typedef struct {
 		UINTPTR ReadbackAddr;
 		u32 ConfigReg_NumFrames;
+		XFpga_ReadbackCompare *ComparePtr;
 }XFpga_Read;
 
 /************************** Variable Definitions *****************************/
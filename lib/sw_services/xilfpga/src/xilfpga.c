@@ -72,6 +72,7 @@
  *                      to provide the access to the xilfpga library to get the
  *                      xilfpga version and supported feature list info.
  * 6.3 Nava   08/05/22  Added doxygen tags.
+ * 6.3 ag     10/15/26  Added XFpga_ComparePlConfigData() API.
  *</pre>
  *
  *@note
@@ -447,6 +448,59 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * This function reads back a range of PL configuration frames and compares
+ * them with a golden image. The frames are read back in chunks by the CSU
+ * DMA, and each chunk is compared while the next one is read back, so that
+ * the full readback is never stored. Only the indexes of the frames that do
+ * not match are returned.
+ *
+ * @param InstancePtr Pointer to the XFpga structure
+ *
+ * @param ComparePtr Pointer to the readback compare description. Its
+ *		     NumMismatch and MismatchPtr entries are updated.
+ *
+ * @return
+ *	- XFPGA_SUCCESS, if the readback completed, whether the frames match
+ *	  or not
+ *	- XFPGA_FAILURE, if unsuccessful
+ *	- XFPGA_INVALID_PARAM, if the compare description is invalid
+ *	- XFPGA_OPS_NOT_IMPLEMENTED, if implementation not exists.
+ * @note
+ *	- This API is not supported for the Versal platform.
+ *
+ ****************************************************************************/
+u32 XFpga_ComparePlConfigData(XFpga *InstancePtr,
+			      XFpga_ReadbackCompare *ComparePtr)
+{
+	u32 Status = XFPGA_FAILURE;
+
+	/* Validate the input arguments */
+	if ((InstancePtr == NULL) || (ComparePtr == NULL) ||
+	    (ComparePtr->GoldenAddr == 0U) || (ComparePtr->ChunkAddr == 0U) ||
+	    (ComparePtr->NumFrames == 0U) || (ComparePtr->ChunkFrames == 0U) ||
+	    ((ComparePtr->MismatchPtr == NULL) &&
+	     (ComparePtr->MaxMismatch != 0U))) {
+		Status = XFPGA_INVALID_PARAM;
+		goto END;
+	}
+
+	if (InstancePtr->XFpga_CompareConfigData == NULL) {
+		Status = XFPGA_OPS_NOT_IMPLEMENTED;
+		Xfpga_Printf(XFPGA_DEBUG,
+		"XFpga_ComparePlConfigData Implementation not exists..\r\n");
+		goto END;
+	}
+
+	ComparePtr->NumMismatch = 0U;
+	InstancePtr->ReadInfo.ComparePtr = ComparePtr;
+	Status = InstancePtr->XFpga_CompareConfigData(InstancePtr);
+
+END:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * This function provides PL specific configuration register values
@@ -85,6 +85,10 @@
  *                      xilfpga version and supported feature list info.
  * 6.2  Nava  03/11/22  Fixed an "implicit declaration of function" warning.
  * 6.3  Nava  08/05/22  Added doxygen tags.
+ * 6.3  ag    10/15/26  Added the bitstream cache API's to keep validated
+ *                      partial bitstreams resident in DDR.
+ * 6.3  ag    10/15/26  Added XFpga_ComparePlConfigData() API to compare
+ *                      the readback frames with a golden image.
  *
  * </pre>
  *
@@ -121,6 +125,7 @@ extern "C" {
  * @param Xfpga_GetConfigReg Returns the value of the specified configuration
  *			     register
  * @param XFpga_GetConfigData Provides the FPGA readback data.
+ * @param XFpga_CompareConfigData Compares the FPGA readback data.
  * @param PLInfo Which is used to store the secure image data.
  * @param WriteInfo XFpga_Write structure which is used to store the PL Write
  *                  Image details.
@@ -137,6 +142,7 @@ typedef struct XFpgatag{
 	u32 (*XFpga_GetInterfaceStatus)(void);
 	u32 (*XFpga_GetConfigReg)(const struct XFpgatag *InstancePtr);
 	u32 (*XFpga_GetConfigData)(const struct XFpgatag *InstancePtr);
+	u32 (*XFpga_CompareConfigData)(const struct XFpgatag *InstancePtr);
 #ifndef XFPGA_SECURE_IPI_MODE_EN
 	XFpga_Info	PLInfo;
 #endif
@@ -147,6 +153,63 @@ typedef struct XFpgatag{
 	u32 FeatureList;
 #endif
 }XFpga;
+
+#ifdef XFPGA_BITSTREAM_CACHE
+/**
+ * Function used to copy Length bytes of an image from the boot media at
+ * SrcAddr into the cache memory at DestAddr. Returns XFPGA_SUCCESS on success.
+ */
+typedef u32 (*XFpga_CacheReadFunc)(UINTPTR SrcAddr, UINTPTR DestAddr,
+				   u32 Length);
+
+/**
+ * Structure to a slot of the bitstream cache.
+ *
+ * @param SlotAddr Address of the slot in the cache memory.
+ * @param SrcAddr Address of the image on the boot media.
+ * @param BitstreamAddr Configuration data found by the image validation.
+ * @param KeyAddr Aes key address which is used for decryption.
+ * @param Size Size of the configuration data.
+ * @param ImageSize Size of the image.
+ * @param Flags Flags of the image, updated by the image validation.
+ * @param Id Identifier of the image.
+ * @param LastUsed Use count of the last load, for the LRU eviction.
+ * @param Copied Bytes of the image copied so far.
+ * @param State XFPGA_CACHE_FREE, XFPGA_CACHE_FETCHING or XFPGA_CACHE_VALID.
+ */
+typedef struct {
+	UINTPTR SlotAddr;
+	UINTPTR SrcAddr;
+	UINTPTR BitstreamAddr;
+	UINTPTR KeyAddr;
+	u32 Size;
+	u32 ImageSize;
+	u32 Flags;
+	u32 Id;
+	u32 LastUsed;
+	u32 Copied;
+	u32 State;
+} XFpga_CacheEntry;
+
+/**
+ * Structure to the bitstream cache instance.
+ *
+ * @param FpgaPtr XFpga instance used to validate and load the images.
+ * @param ReadFunc Copy from the boot media, NULL for linear memory.
+ * @param SlotSize Size of a slot.
+ * @param NumSlots Number of slots.
+ * @param UseCount Incremented on each use of the cache.
+ * @param Entry Slots of the cache.
+ */
+typedef struct {
+	XFpga *FpgaPtr;
+	XFpga_CacheReadFunc ReadFunc;
+	u32 SlotSize;
+	u32 NumSlots;
+	u32 UseCount;
+	XFpga_CacheEntry Entry[XFPGA_CACHE_MAX_ENTRIES];
+} XFpga_Cache;
+#endif
 /************************** Variable Definitions *****************************/
 /***************** Macros (Inline Functions) Definitions *********************/
 #define XFPGA_SUCCESS			(0x0U)
@@ -157,6 +220,7 @@ typedef struct XFpgatag{
 #define XFPGA_POST_CONFIG_ERROR		(0x5U)
 #define XFPGA_OPS_NOT_IMPLEMENTED	(0x6U)
 #define XFPGA_INVALID_PARAM		(0x8U)
+#define XFPGA_CACHE_MISS		(0x9U)
 
 #ifndef versal
 #define XFPGA_FULLBIT_EN			(0x00000000U)
@@ -224,11 +288,25 @@ typedef struct XFpgatag{
 #define TIMER           17U /* Watchdog Timer Register */
 #define BOOTSTS         22U /* Boot History Status Register */
 #define CTL1            24U /* Control Register 1 */
+
+/* Words of a configuration frame */
+#define XFPGA_WORDS_PER_FRAME	(93U)
 #else
 #define XFPGA_PDI_LOAD			(0x00000000U)
 #define XFPGA_DELAYED_PDI_LOAD		(0x00000001U)
 #endif
 
+#ifdef XFPGA_BITSTREAM_CACHE
+/* Bitstream cache slot states */
+#define XFPGA_CACHE_FREE		(0x0U)
+#define XFPGA_CACHE_FETCHING		(0x1U)
+#define XFPGA_CACHE_VALID		(0x2U)
+
+#define XFPGA_CACHE_WORD_LEN		(4U)
+/* Bytes copied by each XFpga_CacheProcess() call */
+#define XFPGA_CACHE_CHUNK_SIZE		(0x10000U)
+#endif
+
 #define Xfpga_Printf(DebugType, ...) \
 	if ((DebugType) != 0U) \
 	{xil_printf (__VA_ARGS__); }
@@ -260,9 +338,25 @@ u32 XFpga_PL_Preconfig(XFpga *InstancePtr);
 u32 XFpga_Write_Pl(XFpga *InstancePtr,UINTPTR BitstreamImageAddr,
 		   UINTPTR KeyAddr, u32 Size, u32 Flags);
 u32 XFpga_PL_PostConfig(XFpga *InstancePtr);
+#ifdef XFPGA_BITSTREAM_CACHE
+u32 XFpga_CacheInit(XFpga_Cache *CachePtr, XFpga *InstancePtr,
+		    UINTPTR BaseAddr, u32 SlotSize, u32 NumSlots,
+		    XFpga_CacheReadFunc ReadFunc);
+u32 XFpga_CachePrefetch(XFpga_Cache *CachePtr, u32 Id, UINTPTR SrcAddr,
+			UINTPTR KeyAddr, u32 Size, u32 Flags);
+u32 XFpga_CacheProcess(XFpga_Cache *CachePtr);
+u32 XFpga_CacheAdd(XFpga_Cache *CachePtr, u32 Id, UINTPTR SrcAddr,
+		   UINTPTR KeyAddr, u32 Size, u32 Flags);
+u32 XFpga_CacheLoad(XFpga_Cache *CachePtr, u32 Id);
+u32 XFpga_CacheGetBitstream(XFpga_Cache *CachePtr, u32 Id,
+			    UINTPTR *AddrPtr, u32 *SizePtr);
+void XFpga_CacheInvalidate(XFpga_Cache *CachePtr, u32 Id);
+#endif
 #ifndef versal
 u32 XFpga_GetPlConfigData(XFpga *InstancePtr, UINTPTR ReadbackAddr,
 			  u32 NumFrames);
+u32 XFpga_ComparePlConfigData(XFpga *InstancePtr,
+			      XFpga_ReadbackCompare *ComparePtr);
 u32 XFpga_GetPlConfigReg(XFpga *InstancePtr, UINTPTR ReadbackAddr,
 			 u32 ConfigRegAddr);
 u32 XFpga_InterfaceStatus(XFpga *InstancePtr);
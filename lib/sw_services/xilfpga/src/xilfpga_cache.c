@@ -0,0 +1,540 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xilfpga_cache.c
+ * @addtogroup xilfpga_zynq_versal XilFPGA APIs for Versal ACAPs and Zynq UltraScale+ MPSoCs
+ * This file contains the definitions of the bitstream cache functions.
+ *
+ * @{
+ * @details
+ *
+ * The bitstream cache keeps the Reconfigurable Module (RM) bitstreams of a
+ * DFX design resident in a DDR region, split in equal slots. Each image is
+ * copied from the boot media and validated once, when it enters the cache,
+ * so swapping to a cached RM only writes the already validated configuration
+ * data to the PL. When all the slots are used, the least recently loaded
+ * image is evicted.
+ *
+ * An image can be added synchronously with XFpga_CacheAdd(), or queued with
+ * XFpga_CachePrefetch() and copied in the background, one chunk per call of
+ * XFpga_CacheProcess(), from the idle loop of the application or from a low
+ * priority task. XFpga_CacheLoad() completes a pending prefetch of the
+ * requested image before it loads it.
+ *
+ * For PRC (Partial Reconfiguration Controller) managed partitions,
+ * XFpga_CacheGetBitstream() returns the address and size of the cached
+ * configuration data, to be programmed with XPrc_SetBsAddress() and
+ * XPrc_SetBsSize() before the trigger is sent.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 6.3  ag    10/15/26  First release
+ *</pre>
+ *
+ *@note
+ *	- The secure images are still authenticated and decrypted when they
+ *	  are written to the PL, the DDR copy is not trusted.
+ *****************************************************************************/
+/***************************** Include Files *********************************/
+#include "xilfpga.h"
+#include "xil_cache.h"
+
+#ifdef XFPGA_BITSTREAM_CACHE
+/************************** Function Prototypes ******************************/
+/* @cond nocomments */
+static XFpga_CacheEntry *XFpga_CacheLookup(XFpga_Cache *CachePtr, u32 Id);
+static XFpga_CacheEntry *XFpga_CacheAlloc(XFpga_Cache *CachePtr);
+static u32 XFpga_CacheFetch(XFpga_Cache *CachePtr, XFpga_CacheEntry *EntryPtr);
+/* @endcond */
+/************************** Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+ * This function initializes the bitstream cache over a DDR region.
+ *
+ * @param CachePtr Pointer to the XFpga_Cache structure.
+ *
+ * @param InstancePtr Pointer to the initialized XFpga structure used to
+ *		      validate and load the cached images.
+ *
+ * @param BaseAddr Base address of the cache region, word aligned.
+ *
+ * @param SlotSize Size of one slot, it bounds the size of a cached image.
+ *
+ * @param NumSlots Number of slots, up to XFPGA_CACHE_MAX_ENTRIES. The cache
+ *		   region is SlotSize * NumSlots bytes.
+ *
+ * @param ReadFunc Function used to copy an image from the boot media into a
+ *		   slot. NULL copies from linear memory.
+ *
+ * @return
+ *	- XFPGA_SUCCESS on success
+ *	- XFPGA_INVALID_PARAM on invalid input.
+ *****************************************************************************/
+u32 XFpga_CacheInit(XFpga_Cache *CachePtr, XFpga *InstancePtr,
+		    UINTPTR BaseAddr, u32 SlotSize, u32 NumSlots,
+		    XFpga_CacheReadFunc ReadFunc)
+{
+	u32 Status = XFPGA_INVALID_PARAM;
+	u32 Index;
+
+	if ((CachePtr == NULL) || (InstancePtr == NULL) ||
+	    (NumSlots == 0U) || (NumSlots > XFPGA_CACHE_MAX_ENTRIES) ||
+	    (SlotSize == 0U) || ((SlotSize % XFPGA_CACHE_WORD_LEN) != 0U) ||
+	    ((BaseAddr % XFPGA_CACHE_WORD_LEN) != 0U)) {
+		goto END;
+	}
+
+	CachePtr->FpgaPtr = InstancePtr;
+	CachePtr->ReadFunc = ReadFunc;
+	CachePtr->SlotSize = SlotSize;
+	CachePtr->NumSlots = NumSlots;
+	CachePtr->UseCount = 0U;
+	for (Index = 0U; Index < NumSlots; Index++) {
+		CachePtr->Entry[Index].SlotAddr = BaseAddr +
+						  ((UINTPTR)Index * SlotSize);
+		CachePtr->Entry[Index].State = XFPGA_CACHE_FREE;
+	}
+	Status = XFPGA_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function queues the copy of a bitstream image into the cache. The
+ * copy is done by XFpga_CacheProcess(). Nothing is done if the image is
+ * already cached or queued.
+ *
+ * @param CachePtr Pointer to the XFpga_Cache structure.
+ *
+ * @param Id Identifier chosen by the caller for the image.
+ *
+ * @param SrcAddr Address of the image on the boot media.
+ *
+ * @param KeyAddr Aes key address which is used for decryption.
+ *
+ * @param Size Size of the image, up to the slot size.
+ *
+ * @param Flags Flags of the image, as for XFpga_BitStream_Load().
+ *
+ * @return
+ *	- XFPGA_SUCCESS on success
+ *	- XFPGA_INVALID_PARAM on invalid input.
+ *	- XFPGA_FAILURE if every slot is being fetched.
+ *****************************************************************************/
+u32 XFpga_CachePrefetch(XFpga_Cache *CachePtr, u32 Id, UINTPTR SrcAddr,
+			UINTPTR KeyAddr, u32 Size, u32 Flags)
+{
+	u32 Status = XFPGA_INVALID_PARAM;
+	XFpga_CacheEntry *EntryPtr;
+
+	if ((CachePtr == NULL) || (Size == 0U) ||
+	    (Size > CachePtr->SlotSize)) {
+		goto END;
+	}
+
+	if (XFpga_CacheLookup(CachePtr, Id) != NULL) {
+		Status = XFPGA_SUCCESS;
+		goto END;
+	}
+
+	EntryPtr = XFpga_CacheAlloc(CachePtr);
+	if (EntryPtr == NULL) {
+		Status = XFPGA_FAILURE;
+		goto END;
+	}
+
+	EntryPtr->Id = Id;
+	EntryPtr->SrcAddr = SrcAddr;
+	EntryPtr->KeyAddr = KeyAddr;
+	EntryPtr->ImageSize = Size;
+	EntryPtr->Flags = Flags;
+	EntryPtr->Copied = 0U;
+	CachePtr->UseCount++;
+	EntryPtr->LastUsed = CachePtr->UseCount;
+	EntryPtr->State = XFPGA_CACHE_FETCHING;
+	Status = XFPGA_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function copies one chunk of the oldest queued prefetch, and
+ * validates the image once it is complete. It returns immediately when
+ * nothing is queued.
+ *
+ * @param CachePtr Pointer to the XFpga_Cache structure.
+ *
+ * @return
+ *	- XFPGA_SUCCESS on success
+ *	- XFPGA_INVALID_PARAM on invalid input.
+ *	- Error code of the copy or of XFpga_ValidateImage(), the image is
+ *	  dropped from the cache.
+ *****************************************************************************/
+u32 XFpga_CacheProcess(XFpga_Cache *CachePtr)
+{
+	u32 Status = XFPGA_INVALID_PARAM;
+	XFpga_CacheEntry *EntryPtr = NULL;
+	XFpga_CacheEntry *NextPtr;
+	u32 Index;
+
+	if (CachePtr == NULL) {
+		goto END;
+	}
+
+	for (Index = 0U; Index < CachePtr->NumSlots; Index++) {
+		NextPtr = &CachePtr->Entry[Index];
+		if ((NextPtr->State == XFPGA_CACHE_FETCHING) &&
+		    ((EntryPtr == NULL) ||
+		     ((NextPtr->LastUsed - EntryPtr->LastUsed) >= 0x80000000U))) {
+			EntryPtr = NextPtr;
+		}
+	}
+
+	Status = XFPGA_SUCCESS;
+	if (EntryPtr != NULL) {
+		Status = XFpga_CacheFetch(CachePtr, EntryPtr);
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function copies a bitstream image into the cache and validates it.
+ *
+ * @param CachePtr Pointer to the XFpga_Cache structure.
+ *
+ * @param Id Identifier chosen by the caller for the image.
+ *
+ * @param SrcAddr Address of the image on the boot media.
+ *
+ * @param KeyAddr Aes key address which is used for decryption.
+ *
+ * @param Size Size of the image, up to the slot size.
+ *
+ * @param Flags Flags of the image, as for XFpga_BitStream_Load().
+ *
+ * @return
+ *	- XFPGA_SUCCESS on success
+ *	- Error code on failure.
+ *****************************************************************************/
+u32 XFpga_CacheAdd(XFpga_Cache *CachePtr, u32 Id, UINTPTR SrcAddr,
+		   UINTPTR KeyAddr, u32 Size, u32 Flags)
+{
+	u32 Status;
+	XFpga_CacheEntry *EntryPtr;
+
+	Status = XFpga_CachePrefetch(CachePtr, Id, SrcAddr, KeyAddr,
+				     Size, Flags);
+	if (Status != XFPGA_SUCCESS) {
+		goto END;
+	}
+
+	EntryPtr = XFpga_CacheLookup(CachePtr, Id);
+	while ((Status == XFPGA_SUCCESS) &&
+	       (EntryPtr->State == XFPGA_CACHE_FETCHING)) {
+		Status = XFpga_CacheFetch(CachePtr, EntryPtr);
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function loads a cached bitstream image into the PL. A pending
+ * prefetch of the image is completed first.
+ *
+ * @param CachePtr Pointer to the XFpga_Cache structure.
+ *
+ * @param Id Identifier of the image.
+ *
+ * @return
+ *	- XFPGA_SUCCESS on success
+ *	- XFPGA_CACHE_MISS if the image is not in the cache.
+ *	- Error code on failure.
+ *	- XFPGA_PRE_CONFIG_ERROR.
+ *	- XFPGA_WRITE_BITSTREAM_ERROR.
+ *	- XFPGA_POST_CONFIG_ERROR.
+ *****************************************************************************/
+u32 XFpga_CacheLoad(XFpga_Cache *CachePtr, u32 Id)
+{
+	volatile u32 Status = XFPGA_INVALID_PARAM;
+	XFpga_CacheEntry *EntryPtr;
+	XFpga *InstancePtr;
+
+	if (CachePtr == NULL) {
+		goto END;
+	}
+
+	EntryPtr = XFpga_CacheLookup(CachePtr, Id);
+	if (EntryPtr == NULL) {
+		Status = XFPGA_CACHE_MISS;
+		goto END;
+	}
+
+	Status = XFPGA_SUCCESS;
+	while ((Status == XFPGA_SUCCESS) &&
+	       (EntryPtr->State == XFPGA_CACHE_FETCHING)) {
+		Status = XFpga_CacheFetch(CachePtr, EntryPtr);
+	}
+	if (Status != XFPGA_SUCCESS) {
+		goto END;
+	}
+
+	CachePtr->UseCount++;
+	EntryPtr->LastUsed = CachePtr->UseCount;
+	InstancePtr = CachePtr->FpgaPtr;
+
+	/* Prepare the FPGA to receive configuration Data */
+	Status = XFPGA_PRE_CONFIG_ERROR;
+	Status = XFpga_PL_Preconfig(InstancePtr);
+	if ((Status != XFPGA_SUCCESS) &&
+	    (Status != XFPGA_OPS_NOT_IMPLEMENTED)) {
+		goto END;
+	}
+
+	/* write the validated configuration data into the PL */
+	Status = XFPGA_WRITE_BITSTREAM_ERROR;
+	Status = XFpga_Write_Pl(InstancePtr, EntryPtr->BitstreamAddr,
+				EntryPtr->KeyAddr, EntryPtr->Size,
+				EntryPtr->Flags);
+	if (Status != XFPGA_SUCCESS) {
+		goto END;
+	}
+
+	/* set FPGA to operating state after writing */
+	Status = XFPGA_POST_CONFIG_ERROR;
+	Status = XFpga_PL_PostConfig(InstancePtr);
+	if (Status == XFPGA_OPS_NOT_IMPLEMENTED) {
+		Status = XFPGA_SUCCESS;
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function provides the validated configuration data of a cached
+ * image, so that a PRC can fetch it directly.
+ *
+ * @param CachePtr Pointer to the XFpga_Cache structure.
+ *
+ * @param Id Identifier of the image.
+ *
+ * @param AddrPtr Used to return the address of the configuration data.
+ *
+ * @param SizePtr Used to return the size of the configuration data.
+ *
+ * @return
+ *	- XFPGA_SUCCESS on success
+ *	- XFPGA_INVALID_PARAM on invalid input.
+ *	- XFPGA_CACHE_MISS if the image is not in the cache or is still
+ *	  being fetched.
+ *****************************************************************************/
+u32 XFpga_CacheGetBitstream(XFpga_Cache *CachePtr, u32 Id,
+			    UINTPTR *AddrPtr, u32 *SizePtr)
+{
+	u32 Status = XFPGA_INVALID_PARAM;
+	XFpga_CacheEntry *EntryPtr;
+
+	if ((CachePtr == NULL) || (AddrPtr == NULL) || (SizePtr == NULL)) {
+		goto END;
+	}
+
+	EntryPtr = XFpga_CacheLookup(CachePtr, Id);
+	if ((EntryPtr == NULL) || (EntryPtr->State != XFPGA_CACHE_VALID)) {
+		Status = XFPGA_CACHE_MISS;
+		goto END;
+	}
+
+	CachePtr->UseCount++;
+	EntryPtr->LastUsed = CachePtr->UseCount;
+	*AddrPtr = EntryPtr->BitstreamAddr;
+	*SizePtr = EntryPtr->Size;
+	Status = XFPGA_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function drops an image from the cache, for instance when it is
+ * updated on the boot media.
+ *
+ * @param CachePtr Pointer to the XFpga_Cache structure.
+ *
+ * @param Id Identifier of the image.
+ *
+ * @return None
+ *****************************************************************************/
+void XFpga_CacheInvalidate(XFpga_Cache *CachePtr, u32 Id)
+{
+	XFpga_CacheEntry *EntryPtr;
+
+	Xil_AssertVoid(CachePtr != NULL);
+
+	EntryPtr = XFpga_CacheLookup(CachePtr, Id);
+	if (EntryPtr != NULL) {
+		EntryPtr->State = XFPGA_CACHE_FREE;
+	}
+}
+
+/* @cond nocomments */
+/*****************************************************************************/
+/**
+ * This function looks up a cached or queued image.
+ *
+ * @param CachePtr Pointer to the XFpga_Cache structure.
+ *
+ * @param Id Identifier of the image.
+ *
+ * @return Pointer to the entry, NULL if the image is not in the cache.
+ *****************************************************************************/
+static XFpga_CacheEntry *XFpga_CacheLookup(XFpga_Cache *CachePtr, u32 Id)
+{
+	XFpga_CacheEntry *EntryPtr = NULL;
+	u32 Index;
+
+	for (Index = 0U; Index < CachePtr->NumSlots; Index++) {
+		if ((CachePtr->Entry[Index].State != XFPGA_CACHE_FREE) &&
+		    (CachePtr->Entry[Index].Id == Id)) {
+			EntryPtr = &CachePtr->Entry[Index];
+			break;
+		}
+	}
+
+	return EntryPtr;
+}
+
+/*****************************************************************************/
+/**
+ * This function returns a free slot, or evicts the least recently used
+ * validated image. The slots being fetched are never evicted.
+ *
+ * @param CachePtr Pointer to the XFpga_Cache structure.
+ *
+ * @return Pointer to the entry, NULL if every slot is being fetched.
+ *****************************************************************************/
+static XFpga_CacheEntry *XFpga_CacheAlloc(XFpga_Cache *CachePtr)
+{
+	XFpga_CacheEntry *EntryPtr = NULL;
+	XFpga_CacheEntry *NextPtr;
+	u32 Index;
+
+	for (Index = 0U; Index < CachePtr->NumSlots; Index++) {
+		NextPtr = &CachePtr->Entry[Index];
+		if (NextPtr->State == XFPGA_CACHE_FREE) {
+			EntryPtr = NextPtr;
+			break;
+		}
+		/* Older use count, with the wrap around */
+		if ((NextPtr->State == XFPGA_CACHE_VALID) &&
+		    ((EntryPtr == NULL) ||
+		     ((NextPtr->LastUsed - EntryPtr->LastUsed) >= 0x80000000U))) {
+			EntryPtr = NextPtr;
+		}
+	}
+
+	if (EntryPtr != NULL) {
+		EntryPtr->State = XFPGA_CACHE_FREE;
+	}
+
+	return EntryPtr;
+}
+
+/*****************************************************************************/
+/**
+ * This function copies the next chunk of an image into its slot. Once the
+ * copy is complete, the slot is flushed to the memory read by the PL
+ * programming interface and the image is validated. The configuration data
+ * found by the validation is recorded, so that it is not validated again.
+ *
+ * @param CachePtr Pointer to the XFpga_Cache structure.
+ *
+ * @param EntryPtr Pointer to the entry being fetched.
+ *
+ * @return
+ *	- XFPGA_SUCCESS on success
+ *	- Error code on failure, the entry is freed.
+ *****************************************************************************/
+static u32 XFpga_CacheFetch(XFpga_Cache *CachePtr, XFpga_CacheEntry *EntryPtr)
+{
+	volatile u32 Status = XFPGA_FAILURE;
+	XFpga *InstancePtr = CachePtr->FpgaPtr;
+	u32 Len = EntryPtr->ImageSize - EntryPtr->Copied;
+
+	if (Len > XFPGA_CACHE_CHUNK_SIZE) {
+		Len = XFPGA_CACHE_CHUNK_SIZE;
+	}
+
+	if (CachePtr->ReadFunc != NULL) {
+		Status = CachePtr->ReadFunc(EntryPtr->SrcAddr + EntryPtr->Copied,
+					    EntryPtr->SlotAddr + EntryPtr->Copied,
+					    Len);
+	} else {
+		Status = (u32)Xil_SMemCpy(
+				(void *)(EntryPtr->SlotAddr + EntryPtr->Copied),
+				Len,
+				(const void *)(EntryPtr->SrcAddr + EntryPtr->Copied),
+				Len, Len);
+	}
+	if (Status != XFPGA_SUCCESS) {
+		Xfpga_Printf(XFPGA_DEBUG,
+		"Fail to copy the image 0x%08x into the cache\r\n", EntryPtr->Id);
+		goto END;
+	}
+
+	EntryPtr->Copied += Len;
+	if (EntryPtr->Copied < EntryPtr->ImageSize) {
+		goto END;
+	}
+
+	Xil_DCacheFlushRange(EntryPtr->SlotAddr, EntryPtr->ImageSize);
+
+	Status = XFPGA_VALIDATE_ERROR;
+	Status = XFpga_ValidateImage(InstancePtr, EntryPtr->SlotAddr,
+				     EntryPtr->KeyAddr, EntryPtr->ImageSize,
+				     EntryPtr->Flags);
+	if (Status == XFPGA_OPS_NOT_IMPLEMENTED) {
+		EntryPtr->BitstreamAddr = EntryPtr->SlotAddr;
+		EntryPtr->Size = EntryPtr->ImageSize;
+		Status = XFPGA_SUCCESS;
+	} else if (Status == XFPGA_SUCCESS) {
+		EntryPtr->BitstreamAddr = InstancePtr->WriteInfo.BitstreamAddr;
+		EntryPtr->KeyAddr = InstancePtr->WriteInfo.KeyAddr;
+		EntryPtr->Size = InstancePtr->WriteInfo.Size;
+		EntryPtr->Flags = InstancePtr->WriteInfo.Flags;
+	} else {
+		Xfpga_Printf(XFPGA_DEBUG,
+		"Cached image 0x%08x failed the validation Error Code: 0x%08x\r\n",
+		EntryPtr->Id, Status);
+		goto END;
+	}
+	EntryPtr->State = XFPGA_CACHE_VALID;
+
+END:
+	if (Status != XFPGA_SUCCESS) {
+		EntryPtr->State = XFPGA_CACHE_FREE;
+	}
+	return Status;
+}
+/* @endcond */
+#endif /* XFPGA_BITSTREAM_CACHE */
+/** @} */
@@ -516,6 +516,9 @@
  *                    flashes.
  * 5.14 akm  08/01/19 Initialized Status variable to XST_FAILURE.
  * 5.14	akm  09/09/19 Added message regarding deprecation of Xilisf.
+ * 5.15 ag   10/14/26 Added XIP memory-mapped read mode for QSPIPSU and
+ *                    OSPIPSV interfaces.
+ *      ag   10/14/26 Added background erase/program scheduler.
  *
  *
  * </pre>
@@ -544,6 +547,15 @@ extern "C" {
 #include "xospipsv.h"
 #endif
 
+/**
+ * XIP memory-mapped read mode is available on the ZynqMP QSPIPSU (linear
+ * mode) and the OSPIPSV (DAC mode) interfaces.
+ */
+#if (defined(XPAR_XISF_INTERFACE_QSPIPSU) && !defined(versal)) || \
+	defined(XPAR_XISF_INTERFACE_OSPIPSV)
+#define XISF_XIP_SUPPORT
+#endif
+
 /**
  * The following definitions specify the type of Serial Flash family.
  * Based on the Serial Flash family selected, some part of the code is included
@@ -568,6 +580,17 @@ extern "C" {
 #include "xilisf_intelstm.h"
 #endif
 
+/**
+ * The background erase/program scheduler is available on the QSPIPSU and
+ * OSPIPSV interfaces for the STM and Spansion flash families.
+ */
+#if (defined(XPAR_XISF_INTERFACE_QSPIPSU) || \
+	defined(XPAR_XISF_INTERFACE_OSPIPSV)) && \
+	((XPAR_XISF_FLASH_FAMILY == STM) || \
+	(XPAR_XISF_FLASH_FAMILY == SPANSION))
+#define XISF_SCHED_SUPPORT
+#endif
+
 /************************** Constant Definitions *****************************/
 
 /**
@@ -897,6 +920,46 @@ typedef void (*XIsf_StatusHandler) (void *CallBackRef, u32 StatusEvent,
 typedef void (*XIsf_StatusHandler) (void *CallBackRef, u32 StatusEvent);
 #endif
 
+#ifdef XISF_XIP_SUPPORT
+/**
+ * The following definitions specify the options of the XIP mode, passed in
+ * XIsf_XipParam.Options.
+ */
+#define XISF_XIP_CACHEABLE	0x1U	/**< Map the region as normal
+					  *  cacheable memory
+					  */
+#define XISF_XIP_CODE		0x2U	/**< The region holds code, the
+					  *  instruction cache is
+					  *  invalidated after erase/program
+					  */
+#define XISF_XIP_QUAD_READ	0x4U	/**< Use quad output fast read in
+					  *  linear mode (QSPIPSU only)
+					  */
+
+/**
+ * The following definitions specify the state of the XIP mode.
+ */
+#define XISF_XIP_STATE_OFF	0U	/**< XIP mode is disabled */
+#define XISF_XIP_STATE_ON	1U	/**< Flash is memory mapped */
+#define XISF_XIP_STATE_SUSPENDED 2U	/**< Suspended around erase/program */
+
+/**
+ * The following structure definition specifies the parameters passed to the
+ * XIsf_XipEnable API.
+ */
+typedef struct {
+	u32 Address;		/**< Flash offset of the region mapped as normal
+				  *  cacheable memory
+				  */
+	u32 Size;		/**< Size of the cacheable region, 0 for none */
+	u32 Options;		/**< XIP options, XISF_XIP_* */
+	int NumDummyBytes;	/**< Number of dummy bytes of the read command,
+				  *  used with XISF_XIP_QUAD_READ on QSPIPSU
+				  *  and for the octal read on OSPIPSV
+				  */
+} XIsf_XipParam;
+#endif
+
 /**
  * The following definition specifies the instance structure of the Serial
  * Flash.
@@ -995,6 +1058,10 @@ typedef struct {
 		(XIsf_Iface *InstancePtr, u8 PreScaler);
 #endif
 	XIsf_StatusHandler StatusHandler;
+#ifdef XISF_XIP_SUPPORT
+	u8 XipState;		/**< XIP mode state, XISF_XIP_STATE_* */
+	XIsf_XipParam XipParam;	/**< Parameters of the XIP mode */
+#endif
 } XIsf;
 
 /**
@@ -1089,6 +1156,87 @@ typedef struct {
 				  */
 } XIsf_BufferReadParam;
 
+#ifdef XISF_SCHED_SUPPORT
+/**
+ * The following definitions specify the type of a scheduler operation.
+ */
+#define XISF_SCHED_READ		0U	/**< Read, served ahead of the queued
+					  *  erase/program operations
+					  */
+#define XISF_SCHED_PROGRAM	1U	/**< Program, adjacent programs are
+					  *  coalesced into page programs
+					  */
+#define XISF_SCHED_ERASE	2U	/**< Erase of the sector at Address */
+
+/**
+ * The following definitions specify the options of the scheduler.
+ */
+#define XISF_SCHED_ERASE_SUSPEND 0x1U	/**< Suspend an erase to serve reads,
+					  *  the flash must support erase
+					  *  suspend (0x75/0x7A)
+					  */
+
+/**
+ * The following definitions specify the state of the scheduler.
+ */
+#define XISF_SCHED_STATE_IDLE		0U /**< Flash is ready */
+#define XISF_SCHED_STATE_PROGRAM	1U /**< Page program in progress */
+#define XISF_SCHED_STATE_ERASE		2U /**< Erase in progress */
+#define XISF_SCHED_STATE_SUSPENDING	3U /**< Erase suspend requested */
+#define XISF_SCHED_STATE_SUSPENDED	4U /**< Erase is suspended */
+
+#define XISF_SCHED_PAGE_SIZE	256U	/**< Largest page program issued */
+
+struct XIsf_SchedOp;
+
+/**
+ * The following definition specifies the completion handler of a scheduler
+ * operation. It is called from XIsf_SchedPoll().
+ */
+typedef void (*XIsf_SchedHandler)(void *CallBackRef,
+		struct XIsf_SchedOp *OpPtr);
+
+/**
+ * The following structure definition specifies an operation queued with
+ * XIsf_SchedSubmit. It is owned by the scheduler until its handler is called.
+ */
+typedef struct XIsf_SchedOp {
+	struct XIsf_SchedOp *Next;	/**< Next queued operation */
+	u8 Type;		/**< Type of the operation, XISF_SCHED_* */
+	u32 Address;		/**< Address in the Serial Flash */
+	u8 *BufPtr;		/**< Data of a program, buffer of a read */
+	u32 NumBytes;		/**< Number of bytes, unused for erase */
+	int Status;		/**< XST_SUCCESS or XST_FAILURE once done */
+	XIsf_SchedHandler Handler;	/**< Completion handler, or NULL */
+	void *CallBackRef;	/**< Argument of the completion handler */
+} XIsf_SchedOp;
+
+/**
+ * The following structure definition specifies the scheduler instance.
+ */
+typedef struct {
+	XIsf *IsfPtr;		/**< Serial Flash instance */
+	u32 Options;		/**< Scheduler options, XISF_SCHED_* */
+	XIsf_ReadOperation ReadOp;	/**< Read operation used for reads */
+	int NumDummyBytes;	/**< Dummy bytes of the read operation */
+	u32 SuspendHold;	/**< Number of polls an erase runs after a
+				  *  resume before it is suspended again
+				  */
+	u8 State;		/**< Scheduler state, XISF_SCHED_STATE_* */
+	u32 HoldCount;		/**< Polls since the erase was resumed */
+	XIsf_SchedOp *Head;	/**< First queued operation */
+	XIsf_SchedOp *Tail;	/**< Last queued operation */
+	XIsf_SchedOp *Erase;	/**< Erase in progress or suspended */
+	XIsf_SchedOp *Prog;	/**< Program with bytes left to program */
+	u32 ProgOffset;		/**< Bytes of Prog already issued */
+	XIsf_SchedOp *ProgDone;	/**< Programs completed by the page
+				  *  program in progress
+				  */
+	u8 CmdBuf[5];		/**< Command and address bytes */
+	u8 PageBuf[XISF_SCHED_PAGE_SIZE]; /**< Coalesced page data */
+} XIsf_Sched;
+#endif
+
 
 /************************** Variable Declaration *****************************/
 
@@ -1205,6 +1353,31 @@ int XIsf_MicronFlashExit4BAddMode(XIsf *InstancePtr);
 u32 XIsf_Get_ProtoType(XIsf *InstancePtr, int Read);
 #endif
 
+#ifdef XISF_XIP_SUPPORT
+/*
+ * Functions for the XIP memory-mapped read mode.
+ */
+int XIsf_XipEnable(XIsf *InstancePtr, XIsf_XipParam *XipParamPtr);
+int XIsf_XipDisable(XIsf *InstancePtr);
+u8 *XIsf_XipGetAddr(XIsf *InstancePtr, u32 Address);
+
+/*
+ * Functions used by XIsf_Write and XIsf_Erase around erase/program.
+ */
+int XIsf_XipSuspend(XIsf *InstancePtr);
+int XIsf_XipResume(XIsf *InstancePtr, u32 Address, u32 ByteCount);
+#endif
+
+#ifdef XISF_SCHED_SUPPORT
+/*
+ * Functions for the background erase/program scheduler.
+ */
+int XIsf_SchedInit(XIsf_Sched *SchedPtr, XIsf *InstancePtr, u32 Options,
+		XIsf_ReadOperation ReadOp, int NumDummyBytes);
+int XIsf_SchedSubmit(XIsf_Sched *SchedPtr, XIsf_SchedOp *OpPtr);
+int XIsf_SchedPoll(XIsf_Sched *SchedPtr);
+#endif
+
 /*
  * Function related to Sector protection.
  */
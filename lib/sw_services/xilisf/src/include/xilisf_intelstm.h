@@ -47,6 +47,7 @@
  * 5.13	akm  02/26/19 Added support for ISSI serial NOR Flash Devices.
  *			   PR# 11442
  * 5.13 sk   02/28/19 Added support for SST26WF016B flash.
+ * 5.15 ag   10/14/26 Added erase suspend and resume commands.
  * </pre>
  *
  ******************************************************************************/
@@ -246,6 +247,8 @@ extern "C" {
  * Definitions of Erase commands.
  */
 #define XISF_CMD_BULK_ERASE		0xC7	/**< Bulk Erase command */
+#define XISF_CMD_ERASE_SUSPEND		0x75	/**< Erase Suspend command */
+#define XISF_CMD_ERASE_RESUME		0x7A	/**< Erase Resume command */
 
 
 #if ((XPAR_XISF_FLASH_FAMILY == INTEL) || (XPAR_XISF_FLASH_FAMILY == STM) || \
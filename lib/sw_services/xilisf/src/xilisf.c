@@ -93,6 +93,7 @@
  * 	         	   PR# 11442
  *      sk   02/28/19 Added support for SST26WF016B flash.
  * 5.14	akm  08/01/19 Initialized Status variable to XST_FAILURE.
+ * 5.15 ag   10/14/26 Suspend XIP mode in XIsf_WriteEnable.
  *
  *
  * </pre>
@@ -849,6 +850,9 @@ int XIsf_Initialize(XIsf *InstancePtr, XIsf_Iface *SpiInstPtr, u8 SlaveSelect,
 	InstancePtr->IsReady = FALSE;
 	InstancePtr->SpiSlaveSelect = SlaveSelect;
 	InstancePtr->WriteBufPtr = WritePtr;
+#ifdef XISF_XIP_SUPPORT
+	InstancePtr->XipState = XISF_XIP_STATE_OFF;
+#endif
 
 #ifdef XPAR_XISF_INTERFACE_AXISPI
 	if (SpiInstPtr->IsStarted != XIL_COMPONENT_IS_STARTED)
@@ -1326,6 +1330,15 @@ int XIsf_WriteEnable(XIsf *InstancePtr, u8 WriteEnable)
 
 	Xil_AssertNonvoid(NULLPtr == NULL);
 
+#ifdef XISF_XIP_SUPPORT
+	/*
+	 * XIP mode stays suspended until the erase/program which follows the
+	 * write enable is done.
+	 */
+	if (XIsf_XipSuspend(InstancePtr) != (int)XST_SUCCESS)
+		return (int)(XST_FAILURE);
+#endif
+
 #ifdef XPAR_XISF_INTERFACE_QSPIPSU
 	FlashMsg[0].TxBfrPtr = WriteEnableBuf;
 	FlashMsg[0].RxBfrPtr = NULL;
@@ -48,6 +48,7 @@
  *      sk   02/11/19 Added support for OSPI flash interface.
  *      sk   02/15/19 4B Sector erase command is not supported by all QSPI
  *                    Micron flashes hence used used 3B sector erase command.
+ * 5.15 ag   10/14/26 Suspend and resume XIP mode around XIsf_Erase.
  *
  * </pre>
  *
@@ -146,6 +147,11 @@ int XIsf_Erase(XIsf *InstancePtr, XIsf_EraseOperation Operation, u32 Address)
 	if (InstancePtr->IsReady != TRUE)
 		return (int)(XST_FAILURE);
 
+#ifdef XISF_XIP_SUPPORT
+	if (XIsf_XipSuspend(InstancePtr) != (int)XST_SUCCESS)
+		return (int)(XST_FAILURE);
+#endif
+
 	switch (Operation) {
 #ifndef XPAR_XISF_INTERFACE_OSPIPSV
 	case XISF_PAGE_ERASE:
@@ -196,6 +202,13 @@ int XIsf_Erase(XIsf *InstancePtr, XIsf_EraseOperation Operation, u32 Address)
 #endif
 	}
 
+#ifdef XISF_XIP_SUPPORT
+	if (XIsf_XipResume(InstancePtr, Address,
+			(Operation == XISF_SECTOR_ERASE) ?
+			InstancePtr->SectorSize : 0U) != (int)XST_SUCCESS)
+		Status = (int)(XST_FAILURE);
+#endif
+
 	return Status;
 }
 
@@ -0,0 +1,849 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xilisf_sched.c
+ *
+ * This file contains the background erase/program scheduler of the library.
+ * Refer xilisf.h for a detailed description.
+ *
+ * XIsf_Erase() and XIsf_Write() wait for the flash to finish, a sector erase
+ * takes hundreds of milliseconds. The scheduler queues the operations and
+ * XIsf_SchedPoll(), called from a timer or the main loop, issues them and
+ * reads the status register once per call instead of waiting:
+ *	- Reads are served as soon as the flash is ready, ahead of the queued
+ *	  erase/program operations they do not overlap.
+ *	- With XISF_SCHED_ERASE_SUSPEND an erase in progress is suspended to
+ *	  serve a pending read outside the erased sector, and resumed after.
+ *	- A program is issued one page at a time. When a program ends inside a
+ *	  page and the next queued operation programs the following bytes, both
+ *	  are coalesced into one page program.
+ *
+ * Only the single connection mode and the polling transfer mode are
+ * supported. While operations are queued the flash must not be accessed
+ * other than through the scheduler, and XIP mode must be disabled. If
+ * XIsf_SchedPoll() is called from an interrupt handler, that interrupt must be
+ * disabled around XIsf_SchedSubmit().
+ *
+ * <pre>
+ *
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who      Date     Changes
+ * ----- -------  -------- -----------------------------------------------
+ * 5.15  ag       10/14/26 First release
+ *
+ * </pre>
+ *
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <string.h>
+#include "include/xilisf.h"
+
+#ifdef XISF_SCHED_SUPPORT
+
+/************************** Constant Definitions *****************************/
+
+#define XISF_SCHED_SUSPEND_HOLD	1U	/**< Default polls between a resume
+					  *  and the next suspend
+					  */
+#ifdef XPAR_XISF_INTERFACE_OSPIPSV
+#define XISF_SCHED_STIG_BYTES	8U	/**< Largest program in INDAC mode */
+#endif
+
+/************************** Function Prototypes ******************************/
+
+static XIsf_SchedOp *XIsf_SchedNextRead(XIsf_Sched *SchedPtr);
+static u32 XIsf_SchedOverlaps(XIsf_Sched *SchedPtr, const XIsf_SchedOp *ReadPtr,
+			      const XIsf_SchedOp *OpPtr);
+static void XIsf_SchedUnlink(XIsf_Sched *SchedPtr, XIsf_SchedOp *OpPtr);
+static void XIsf_SchedComplete(XIsf_SchedOp *OpPtr, int Status);
+static void XIsf_SchedAbort(XIsf_Sched *SchedPtr);
+static int XIsf_SchedStartProg(XIsf_Sched *SchedPtr);
+static int XIsf_SchedStartErase(XIsf_Sched *SchedPtr, u32 Address);
+static int XIsf_SchedSendCmd(XIsf_Sched *SchedPtr, u8 Command);
+static int XIsf_SchedIsReady(XIsf_Sched *SchedPtr, u8 *ReadyPtr);
+#ifdef XPAR_XISF_INTERFACE_QSPIPSU
+static u32 XIsf_SchedSetAddr(XIsf_Sched *SchedPtr, u8 Command, u32 Address,
+			     u8 FourByte);
+#endif
+
+/************************** Variable Definitions *****************************/
+
+#ifdef XPAR_XISF_INTERFACE_QSPIPSU
+static XQspiPsu_Msg SchedMsg[2];
+#else
+static XOspiPsv_Msg SchedMsg;
+#endif
+
+/************************** Function Definitions ******************************/
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This API initializes a scheduler for an initialized XIsf instance.
+ *
+ * @param	SchedPtr	Pointer to the scheduler instance.
+ * @param	InstancePtr	Pointer to the XIsf instance.
+ * @param	Options		Scheduler options, XISF_SCHED_ERASE_SUSPEND or 0.
+ * @param	ReadOp		Read operation of XIsf_Read() used for the
+ *				reads, such as XISF_READ.
+ * @param	NumDummyBytes	Dummy bytes of the read operation.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_FAILURE if it fails.
+ *
+ * @note	SchedPtr->SuspendHold can be changed after this call to let an
+ *		erase run longer between two suspends.
+ *
+ ******************************************************************************/
+int XIsf_SchedInit(XIsf_Sched *SchedPtr, XIsf *InstancePtr, u32 Options,
+		XIsf_ReadOperation ReadOp, int NumDummyBytes)
+{
+	if ((SchedPtr == NULL) || (InstancePtr == NULL))
+		return (int)XST_FAILURE;
+
+	if (InstancePtr->IsReady != TRUE)
+		return (int)XST_FAILURE;
+
+	if (InstancePtr->SpiInstPtr->Config.ConnectionMode != 0U)
+		return (int)XST_FAILURE;
+
+	if (XIsf_GetTransferMode(InstancePtr) == XISF_INTERRUPT_MODE)
+		return (int)XST_FAILURE;
+
+	SchedPtr->IsfPtr = InstancePtr;
+	SchedPtr->Options = Options;
+	SchedPtr->ReadOp = ReadOp;
+	SchedPtr->NumDummyBytes = NumDummyBytes;
+	SchedPtr->SuspendHold = XISF_SCHED_SUSPEND_HOLD;
+	SchedPtr->State = XISF_SCHED_STATE_IDLE;
+	SchedPtr->HoldCount = 0U;
+	SchedPtr->Head = NULL;
+	SchedPtr->Tail = NULL;
+	SchedPtr->Erase = NULL;
+	SchedPtr->Prog = NULL;
+	SchedPtr->ProgOffset = 0U;
+	SchedPtr->ProgDone = NULL;
+
+	return (int)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This API queues an operation. The operation is started by XIsf_SchedPoll(),
+ * which also calls its handler when it is done.
+ *
+ * @param	SchedPtr	Pointer to the scheduler instance.
+ * @param	OpPtr		Pointer to the operation, with Type, Address,
+ *				BufPtr, NumBytes, Handler and CallBackRef set.
+ *				The buffer must not be changed or accessed until
+ *				the operation is done.
+ *
+ * @return
+ *		- XST_SUCCESS if the operation is queued.
+ *		- XST_FAILURE if the operation is not valid.
+ *
+ ******************************************************************************/
+int XIsf_SchedSubmit(XIsf_Sched *SchedPtr, XIsf_SchedOp *OpPtr)
+{
+	if ((SchedPtr == NULL) || (OpPtr == NULL))
+		return (int)XST_FAILURE;
+
+	if (OpPtr->Type > XISF_SCHED_ERASE)
+		return (int)XST_FAILURE;
+
+	if ((OpPtr->Type != XISF_SCHED_ERASE) &&
+		((OpPtr->BufPtr == NULL) || (OpPtr->NumBytes == 0U)))
+		return (int)XST_FAILURE;
+
+	OpPtr->Next = NULL;
+	OpPtr->Status = (int)XST_DEVICE_BUSY;
+
+	if (SchedPtr->Head == NULL)
+		SchedPtr->Head = OpPtr;
+	else
+		SchedPtr->Tail->Next = OpPtr;
+	SchedPtr->Tail = OpPtr;
+
+	return (int)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This API runs the scheduler. It reads the status register of the flash
+ * when an erase or program is in progress, completes the finished operation
+ * and starts the next ones. It does not wait for the flash.
+ *
+ * @param	SchedPtr	Pointer to the scheduler instance.
+ *
+ * @return
+ *		- XST_SUCCESS if no operation is queued or in progress.
+ *		- XST_DEVICE_BUSY if operations are left.
+ *		- XST_FAILURE if a transfer failed, the operations in progress
+ *		are completed with XST_FAILURE.
+ *
+ ******************************************************************************/
+int XIsf_SchedPoll(XIsf_Sched *SchedPtr)
+{
+	XIsf_SchedOp *OpPtr;
+	XIsf_ReadParam ReadParam;
+	int Status;
+	u8 Ready;
+
+	if (SchedPtr == NULL)
+		return (int)XST_FAILURE;
+
+	if ((SchedPtr->State != XISF_SCHED_STATE_IDLE) &&
+		(SchedPtr->State != XISF_SCHED_STATE_SUSPENDED)) {
+		Status = XIsf_SchedIsReady(SchedPtr, &Ready);
+		if (Status != (int)XST_SUCCESS) {
+			XIsf_SchedAbort(SchedPtr);
+			return (int)XST_FAILURE;
+		}
+
+		if (Ready == FALSE) {
+			if (SchedPtr->State != XISF_SCHED_STATE_ERASE)
+				return (int)XST_DEVICE_BUSY;
+
+			SchedPtr->HoldCount++;
+			if (((SchedPtr->Options & XISF_SCHED_ERASE_SUSPEND) !=
+				0U) &&
+				(SchedPtr->HoldCount >= SchedPtr->SuspendHold) &&
+				(XIsf_SchedNextRead(SchedPtr) != NULL)) {
+				Status = XIsf_SchedSendCmd(SchedPtr,
+						XISF_CMD_ERASE_SUSPEND);
+				if (Status != (int)XST_SUCCESS) {
+					XIsf_SchedAbort(SchedPtr);
+					return (int)XST_FAILURE;
+				}
+				SchedPtr->State = XISF_SCHED_STATE_SUSPENDING;
+			}
+			return (int)XST_DEVICE_BUSY;
+		}
+
+		if (SchedPtr->State == XISF_SCHED_STATE_SUSPENDING) {
+			SchedPtr->State = XISF_SCHED_STATE_SUSPENDED;
+		} else if (SchedPtr->State == XISF_SCHED_STATE_ERASE) {
+			OpPtr = SchedPtr->Erase;
+			SchedPtr->Erase = NULL;
+			SchedPtr->State = XISF_SCHED_STATE_IDLE;
+			XIsf_SchedComplete(OpPtr, (int)XST_SUCCESS);
+		} else {
+			SchedPtr->State = XISF_SCHED_STATE_IDLE;
+			while (SchedPtr->ProgDone != NULL) {
+				OpPtr = SchedPtr->ProgDone;
+				SchedPtr->ProgDone = OpPtr->Next;
+				XIsf_SchedComplete(OpPtr, (int)XST_SUCCESS);
+			}
+		}
+	}
+
+	/*
+	 * Serve the reads which do not overlap an operation ahead of them
+	 */
+	OpPtr = XIsf_SchedNextRead(SchedPtr);
+	while (OpPtr != NULL) {
+		XIsf_SchedUnlink(SchedPtr, OpPtr);
+		ReadParam.Address = OpPtr->Address;
+		ReadParam.ReadPtr = OpPtr->BufPtr;
+		ReadParam.NumBytes = OpPtr->NumBytes;
+		ReadParam.NumDummyBytes = SchedPtr->NumDummyBytes;
+		Status = XIsf_Read(SchedPtr->IsfPtr, SchedPtr->ReadOp,
+				&ReadParam);
+		XIsf_SchedComplete(OpPtr, (Status == (int)XST_SUCCESS) ?
+				(int)XST_SUCCESS : (int)XST_FAILURE);
+		OpPtr = XIsf_SchedNextRead(SchedPtr);
+	}
+
+	if (SchedPtr->State == XISF_SCHED_STATE_SUSPENDED) {
+		Status = XIsf_SchedSendCmd(SchedPtr, XISF_CMD_ERASE_RESUME);
+		if (Status != (int)XST_SUCCESS) {
+			XIsf_SchedAbort(SchedPtr);
+			return (int)XST_FAILURE;
+		}
+		SchedPtr->State = XISF_SCHED_STATE_ERASE;
+		SchedPtr->HoldCount = 0U;
+		return (int)XST_DEVICE_BUSY;
+	}
+
+	if ((SchedPtr->Prog == NULL) && (SchedPtr->Head != NULL)) {
+		OpPtr = SchedPtr->Head;
+		XIsf_SchedUnlink(SchedPtr, OpPtr);
+		if (OpPtr->Type == XISF_SCHED_PROGRAM) {
+			SchedPtr->Prog = OpPtr;
+			SchedPtr->ProgOffset = 0U;
+		} else {
+			SchedPtr->Erase = OpPtr;
+			Status = XIsf_SchedStartErase(SchedPtr, OpPtr->Address);
+			if (Status != (int)XST_SUCCESS) {
+				XIsf_SchedAbort(SchedPtr);
+				return (int)XST_FAILURE;
+			}
+			SchedPtr->State = XISF_SCHED_STATE_ERASE;
+			SchedPtr->HoldCount = 0U;
+		}
+	}
+
+	if ((SchedPtr->Prog != NULL) &&
+		(SchedPtr->State == XISF_SCHED_STATE_IDLE)) {
+		Status = XIsf_SchedStartProg(SchedPtr);
+		if (Status != (int)XST_SUCCESS) {
+			XIsf_SchedAbort(SchedPtr);
+			return (int)XST_FAILURE;
+		}
+		SchedPtr->State = XISF_SCHED_STATE_PROGRAM;
+	}
+
+	if ((SchedPtr->State == XISF_SCHED_STATE_IDLE) &&
+		(SchedPtr->Head == NULL))
+		return (int)XST_SUCCESS;
+
+	return (int)XST_DEVICE_BUSY;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function finds the first queued read which does not overlap the
+ * operation in progress or a queued erase/program ahead of it.
+ *
+ * @param	SchedPtr	Pointer to the scheduler instance.
+ *
+ * @return	The read, or NULL.
+ *
+ ******************************************************************************/
+static XIsf_SchedOp *XIsf_SchedNextRead(XIsf_Sched *SchedPtr)
+{
+	XIsf_SchedOp *OpPtr;
+	XIsf_SchedOp *PrevPtr;
+	u32 Blocked;
+
+	for (OpPtr = SchedPtr->Head; OpPtr != NULL; OpPtr = OpPtr->Next) {
+		if (OpPtr->Type != XISF_SCHED_READ)
+			continue;
+
+		Blocked = XIsf_SchedOverlaps(SchedPtr, OpPtr, SchedPtr->Erase) |
+			XIsf_SchedOverlaps(SchedPtr, OpPtr, SchedPtr->Prog);
+		for (PrevPtr = SchedPtr->ProgDone; PrevPtr != NULL;
+				PrevPtr = PrevPtr->Next)
+			Blocked |= XIsf_SchedOverlaps(SchedPtr, OpPtr, PrevPtr);
+		for (PrevPtr = SchedPtr->Head; PrevPtr != OpPtr;
+				PrevPtr = PrevPtr->Next)
+			Blocked |= XIsf_SchedOverlaps(SchedPtr, OpPtr, PrevPtr);
+
+		if (Blocked == 0U)
+			return OpPtr;
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function checks whether a read overlaps an erase or program.
+ *
+ * @param	SchedPtr	Pointer to the scheduler instance.
+ * @param	ReadPtr		Pointer to the read.
+ * @param	OpPtr		Pointer to the other operation, or NULL.
+ *
+ * @return	1 if the read overlaps an erase or program, else 0.
+ *
+ ******************************************************************************/
+static u32 XIsf_SchedOverlaps(XIsf_Sched *SchedPtr, const XIsf_SchedOp *ReadPtr,
+			      const XIsf_SchedOp *OpPtr)
+{
+	u32 Start;
+	u32 Size;
+
+	if ((OpPtr == NULL) || (OpPtr->Type == XISF_SCHED_READ))
+		return 0U;
+
+	if (OpPtr->Type == XISF_SCHED_ERASE) {
+		Size = SchedPtr->IsfPtr->SectorSize;
+		Start = OpPtr->Address & ~(Size - 1U);
+	} else {
+		Size = OpPtr->NumBytes;
+		Start = OpPtr->Address;
+	}
+
+	if ((ReadPtr->Address - Start < Size) ||
+		(Start - ReadPtr->Address < ReadPtr->NumBytes))
+		return 1U;
+
+	return 0U;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function removes an operation from the queue.
+ *
+ * @param	SchedPtr	Pointer to the scheduler instance.
+ * @param	OpPtr		Pointer to the queued operation.
+ *
+ * @return	None
+ *
+ ******************************************************************************/
+static void XIsf_SchedUnlink(XIsf_Sched *SchedPtr, XIsf_SchedOp *OpPtr)
+{
+	XIsf_SchedOp *PrevPtr = NULL;
+	XIsf_SchedOp *CurPtr = SchedPtr->Head;
+
+	while ((CurPtr != NULL) && (CurPtr != OpPtr)) {
+		PrevPtr = CurPtr;
+		CurPtr = CurPtr->Next;
+	}
+
+	if (CurPtr == NULL)
+		return;
+
+	if (PrevPtr == NULL)
+		SchedPtr->Head = OpPtr->Next;
+	else
+		PrevPtr->Next = OpPtr->Next;
+
+	if (SchedPtr->Tail == OpPtr)
+		SchedPtr->Tail = PrevPtr;
+
+	OpPtr->Next = NULL;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function sets the status of an operation and calls its handler.
+ *
+ * @param	OpPtr		Pointer to the operation.
+ * @param	Status		Status of the operation.
+ *
+ * @return	None
+ *
+ ******************************************************************************/
+static void XIsf_SchedComplete(XIsf_SchedOp *OpPtr, int Status)
+{
+	OpPtr->Next = NULL;
+	OpPtr->Status = Status;
+
+	if (OpPtr->Handler != NULL)
+		OpPtr->Handler(OpPtr->CallBackRef, OpPtr);
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function completes the operations in progress with XST_FAILURE. The
+ * queued operations are kept.
+ *
+ * @param	SchedPtr	Pointer to the scheduler instance.
+ *
+ * @return	None
+ *
+ ******************************************************************************/
+static void XIsf_SchedAbort(XIsf_Sched *SchedPtr)
+{
+	XIsf_SchedOp *OpPtr;
+
+	SchedPtr->State = XISF_SCHED_STATE_IDLE;
+
+	if (SchedPtr->Erase != NULL) {
+		OpPtr = SchedPtr->Erase;
+		SchedPtr->Erase = NULL;
+		XIsf_SchedComplete(OpPtr, (int)XST_FAILURE);
+	}
+
+	while (SchedPtr->ProgDone != NULL) {
+		OpPtr = SchedPtr->ProgDone;
+		SchedPtr->ProgDone = OpPtr->Next;
+		XIsf_SchedComplete(OpPtr, (int)XST_FAILURE);
+	}
+
+	if (SchedPtr->Prog != NULL) {
+		OpPtr = SchedPtr->Prog;
+		SchedPtr->Prog = NULL;
+		XIsf_SchedComplete(OpPtr, (int)XST_FAILURE);
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function issues the next page program of SchedPtr->Prog. The page is
+ * filled with the following queued programs when they are contiguous.
+ *
+ * @param	SchedPtr	Pointer to the scheduler instance.
+ *
+ * @return	XST_SUCCESS if successful else XST_FAILURE.
+ *
+ ******************************************************************************/
+static int XIsf_SchedStartProg(XIsf_Sched *SchedPtr)
+{
+	XIsf *InstancePtr = SchedPtr->IsfPtr;
+	XIsf_SchedOp *OpPtr = SchedPtr->Prog;
+	XIsf_SchedOp *NextPtr;
+	XIsf_SchedOp *LastPtr;
+	u8 *DataPtr;
+	u8 *NULLPtr = NULL;
+	u32 Address;
+	u32 Room;
+	u32 Len;
+	u32 Count;
+	int Status;
+#ifdef XPAR_XISF_INTERFACE_QSPIPSU
+	u32 CmdByteCount;
+	u8 Command;
+	u8 FourByte = FALSE;
+#endif
+
+	Address = OpPtr->Address + SchedPtr->ProgOffset;
+	Room = (u32)InstancePtr->BytesPerPage -
+		(Address % (u32)InstancePtr->BytesPerPage);
+	if (Room > XISF_SCHED_PAGE_SIZE)
+		Room = XISF_SCHED_PAGE_SIZE;
+#ifdef XPAR_XISF_INTERFACE_OSPIPSV
+	if ((InstancePtr->SpiInstPtr->OpMode != XOSPIPSV_DAC_MODE) &&
+		(Room > XISF_SCHED_STIG_BYTES))
+		Room = XISF_SCHED_STIG_BYTES;
+#endif
+
+	Len = OpPtr->NumBytes - SchedPtr->ProgOffset;
+	if (Len > Room)
+		Len = Room;
+	DataPtr = OpPtr->BufPtr + SchedPtr->ProgOffset;
+	SchedPtr->ProgOffset += Len;
+
+	/*
+	 * Coalesce the following contiguous programs into the page
+	 */
+	if (SchedPtr->ProgOffset == OpPtr->NumBytes) {
+		SchedPtr->ProgDone = OpPtr;
+		LastPtr = OpPtr;
+		SchedPtr->Prog = NULL;
+		SchedPtr->ProgOffset = 0U;
+
+		while ((Len < Room) && (SchedPtr->Head != NULL) &&
+			(SchedPtr->Head->Type == XISF_SCHED_PROGRAM) &&
+			(SchedPtr->Head->Address == (Address + Len))) {
+			if (DataPtr != SchedPtr->PageBuf) {
+				(void)memcpy(SchedPtr->PageBuf, DataPtr, Len);
+				DataPtr = SchedPtr->PageBuf;
+			}
+
+			NextPtr = SchedPtr->Head;
+			XIsf_SchedUnlink(SchedPtr, NextPtr);
+			Count = Room - Len;
+			if (Count > NextPtr->NumBytes)
+				Count = NextPtr->NumBytes;
+			(void)memcpy(&SchedPtr->PageBuf[Len], NextPtr->BufPtr,
+					Count);
+			Len += Count;
+
+			if (Count == NextPtr->NumBytes) {
+				LastPtr->Next = NextPtr;
+				LastPtr = NextPtr;
+			} else {
+				SchedPtr->Prog = NextPtr;
+				SchedPtr->ProgOffset = Count;
+			}
+		}
+	}
+
+	Status = XIsf_WriteEnable(InstancePtr, XISF_WRITE_ENABLE);
+	if (Status != (int)XST_SUCCESS)
+		return (int)XST_FAILURE;
+
+#ifdef XPAR_XISF_INTERFACE_QSPIPSU
+	Command = XISF_CMD_PAGEPROG_WRITE;
+#if (XPAR_XISF_FLASH_FAMILY == SPANSION)
+	if ((InstancePtr->FourByteAddrMode == TRUE) &&
+		((InstancePtr->ManufacturerID ==
+				XISF_MANUFACTURER_ID_SPANSION) ||
+		(InstancePtr->ManufacturerID ==
+				XISF_MANUFACTURER_ID_MICRON) ||
+		(InstancePtr->ManufacturerID ==
+				XISF_MANUFACTURER_ID_MICRON_OCTAL))) {
+		FourByte = TRUE;
+		if (InstancePtr->ManufacturerID != XISF_MANUFACTURER_ID_MICRON)
+			Command = XISF_CMD_PAGEPROG_WRITE_4BYTE;
+	}
+#endif
+	CmdByteCount = XIsf_SchedSetAddr(SchedPtr, Command, Address, FourByte);
+
+	SchedMsg[0].TxBfrPtr = SchedPtr->CmdBuf;
+	SchedMsg[0].RxBfrPtr = NULL;
+	SchedMsg[0].ByteCount = CmdByteCount;
+	SchedMsg[0].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	SchedMsg[0].Flags = XQSPIPSU_MSG_FLAG_TX;
+
+	SchedMsg[1].TxBfrPtr = DataPtr;
+	SchedMsg[1].RxBfrPtr = NULL;
+	SchedMsg[1].ByteCount = Len;
+	SchedMsg[1].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	SchedMsg[1].Flags = XQSPIPSU_MSG_FLAG_TX;
+
+	InstancePtr->SpiInstPtr->Msg = SchedMsg;
+	Status = XIsf_Transfer(InstancePtr, NULLPtr, NULLPtr, 2);
+#else
+	SchedMsg.Opcode = XISF_CMD_PAGEPROG_WRITE_4BYTE;
+	if (InstancePtr->SpiInstPtr->OpMode == XOSPIPSV_DAC_MODE)
+		SchedMsg.Opcode = XISF_CMD_OCTAL_WRITE_4B;
+	SchedMsg.Addrvalid = 1;
+	SchedMsg.TxBfrPtr = DataPtr;
+	SchedMsg.RxBfrPtr = NULL;
+	SchedMsg.ByteCount = Len;
+	SchedMsg.Flags = XOSPIPSV_MSG_FLAG_TX;
+	SchedMsg.Addrsize = 4;
+	SchedMsg.Addr = Address;
+	SchedMsg.Proto = XIsf_Get_ProtoType(InstancePtr, 0);
+	SchedMsg.Dummy = 0;
+	if (InstancePtr->SpiInstPtr->SdrDdrMode == XOSPIPSV_EDGE_MODE_DDR_PHY)
+		SchedMsg.Proto = XOSPIPSV_WRITE_8_8_8;
+	SchedMsg.IsDDROpCode = 0;
+
+	InstancePtr->SpiInstPtr->Msg = &SchedMsg;
+	Status = XIsf_Transfer(InstancePtr, NULLPtr, NULLPtr,
+			SchedMsg.ByteCount);
+#endif
+	if (Status != (int)XST_SUCCESS)
+		return (int)XST_FAILURE;
+
+	return (int)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function issues the sector erase of an erase operation.
+ *
+ * @param	SchedPtr	Pointer to the scheduler instance.
+ * @param	Address		Address in the sector to erase.
+ *
+ * @return	XST_SUCCESS if successful else XST_FAILURE.
+ *
+ ******************************************************************************/
+static int XIsf_SchedStartErase(XIsf_Sched *SchedPtr, u32 Address)
+{
+	XIsf *InstancePtr = SchedPtr->IsfPtr;
+	u8 *NULLPtr = NULL;
+	int Status;
+#ifdef XPAR_XISF_INTERFACE_QSPIPSU
+	u8 Command = XISF_CMD_SECTOR_ERASE;
+	u8 FourByte = FALSE;
+#endif
+
+	Status = XIsf_WriteEnable(InstancePtr, XISF_WRITE_ENABLE);
+	if (Status != (int)XST_SUCCESS)
+		return (int)XST_FAILURE;
+
+#ifdef XPAR_XISF_INTERFACE_QSPIPSU
+#if (XPAR_XISF_FLASH_FAMILY == SPANSION)
+	FourByte = InstancePtr->FourByteAddrMode;
+	if ((FourByte == TRUE) &&
+		(InstancePtr->ManufacturerID == XISF_MANUFACTURER_ID_SPANSION))
+		Command = XISF_CMD_4BYTE_SECTOR_ERASE;
+#endif
+	SchedMsg[0].TxBfrPtr = SchedPtr->CmdBuf;
+	SchedMsg[0].RxBfrPtr = NULL;
+	SchedMsg[0].ByteCount = XIsf_SchedSetAddr(SchedPtr, Command, Address,
+			FourByte);
+	SchedMsg[0].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	SchedMsg[0].Flags = XQSPIPSU_MSG_FLAG_TX;
+	InstancePtr->SpiInstPtr->Msg = SchedMsg;
+
+	Status = XIsf_Transfer(InstancePtr, NULLPtr, NULLPtr, 1);
+#else
+	SchedMsg.Opcode = XISF_CMD_4BYTE_SECTOR_ERASE;
+	SchedMsg.Addrsize = 4;
+	SchedMsg.Addrvalid = 1;
+	SchedMsg.TxBfrPtr = NULL;
+	SchedMsg.RxBfrPtr = NULL;
+	SchedMsg.ByteCount = 0;
+	SchedMsg.Flags = XOSPIPSV_MSG_FLAG_TX;
+	SchedMsg.Addr = Address;
+	SchedMsg.IsDDROpCode = 0;
+	SchedMsg.Proto = 0;
+	SchedMsg.Dummy = 0;
+	if (InstancePtr->SpiInstPtr->SdrDdrMode == XOSPIPSV_EDGE_MODE_DDR_PHY)
+		SchedMsg.Proto = XOSPIPSV_WRITE_8_8_0;
+	InstancePtr->SpiInstPtr->Msg = &SchedMsg;
+	Status = XIsf_Transfer(InstancePtr, NULLPtr, NULLPtr, 0);
+#endif
+	if (Status != (int)XST_SUCCESS)
+		return (int)XST_FAILURE;
+
+	return (int)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function sends a command without address or data, such as erase
+ * suspend or erase resume.
+ *
+ * @param	SchedPtr	Pointer to the scheduler instance.
+ * @param	Command		Command to send.
+ *
+ * @return	XST_SUCCESS if successful else XST_FAILURE.
+ *
+ ******************************************************************************/
+static int XIsf_SchedSendCmd(XIsf_Sched *SchedPtr, u8 Command)
+{
+	XIsf *InstancePtr = SchedPtr->IsfPtr;
+	u8 *NULLPtr = NULL;
+	int Status;
+
+#ifdef XPAR_XISF_INTERFACE_QSPIPSU
+	SchedPtr->CmdBuf[BYTE1] = Command;
+	SchedMsg[0].TxBfrPtr = SchedPtr->CmdBuf;
+	SchedMsg[0].RxBfrPtr = NULL;
+	SchedMsg[0].ByteCount = 1;
+	SchedMsg[0].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	SchedMsg[0].Flags = XQSPIPSU_MSG_FLAG_TX;
+	InstancePtr->SpiInstPtr->Msg = SchedMsg;
+
+	Status = XIsf_Transfer(InstancePtr, NULLPtr, NULLPtr, 1);
+#else
+	SchedMsg.Opcode = Command;
+	SchedMsg.Addrsize = 0;
+	SchedMsg.Addrvalid = 0;
+	SchedMsg.TxBfrPtr = NULL;
+	SchedMsg.RxBfrPtr = NULL;
+	SchedMsg.ByteCount = 0;
+	SchedMsg.Flags = XOSPIPSV_MSG_FLAG_TX;
+	SchedMsg.IsDDROpCode = 0;
+	SchedMsg.Proto = 0;
+	SchedMsg.Dummy = 0;
+	if (InstancePtr->SpiInstPtr->SdrDdrMode == XOSPIPSV_EDGE_MODE_DDR_PHY)
+		SchedMsg.Proto = XOSPIPSV_WRITE_8_0_0;
+	InstancePtr->SpiInstPtr->Msg = &SchedMsg;
+	Status = XIsf_Transfer(InstancePtr, NULLPtr, NULLPtr, 0);
+#endif
+	if (Status != (int)XST_SUCCESS)
+		return (int)XST_FAILURE;
+
+	return (int)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function reads the status of the flash once.
+ *
+ * @param	SchedPtr	Pointer to the scheduler instance.
+ * @param	ReadyPtr	Set to TRUE when no erase or program is in
+ *				progress, or the erase is suspended.
+ *
+ * @return	XST_SUCCESS if successful else XST_FAILURE.
+ *
+ ******************************************************************************/
+static int XIsf_SchedIsReady(XIsf_Sched *SchedPtr, u8 *ReadyPtr)
+{
+	XIsf *InstancePtr = SchedPtr->IsfPtr;
+	u8 FlashStatus[2] __attribute__ ((aligned(4))) = {0};
+	u8 *NULLPtr = NULL;
+	int Status;
+#ifdef XPAR_XISF_INTERFACE_QSPIPSU
+	u8 FSRFlag = 0;
+
+	SchedPtr->CmdBuf[BYTE1] = READ_STATUS_CMD;
+	if ((InstancePtr->NumDie > (u8)1) &&
+		(InstancePtr->ManufacturerID ==
+				(u32)XISF_MANUFACTURER_ID_MICRON)) {
+		SchedPtr->CmdBuf[BYTE1] = READ_FLAG_STATUS_CMD;
+		FSRFlag = 1;
+	}
+
+	SchedMsg[0].TxBfrPtr = SchedPtr->CmdBuf;
+	SchedMsg[0].RxBfrPtr = NULL;
+	SchedMsg[0].ByteCount = 1;
+	SchedMsg[0].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	SchedMsg[0].Flags = XQSPIPSU_MSG_FLAG_TX;
+
+	SchedMsg[1].TxBfrPtr = NULL;
+	SchedMsg[1].RxBfrPtr = FlashStatus;
+	SchedMsg[1].ByteCount = 2;
+	SchedMsg[1].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	SchedMsg[1].Flags = XQSPIPSU_MSG_FLAG_RX;
+	InstancePtr->SpiInstPtr->Msg = SchedMsg;
+
+	Status = XIsf_Transfer(InstancePtr, NULLPtr, NULLPtr, 2);
+	if (Status != (int)XST_SUCCESS)
+		return (int)XST_FAILURE;
+
+	if (FSRFlag != 0U)
+		*ReadyPtr = ((FlashStatus[1] & 0x80U) != 0U) ? TRUE : FALSE;
+	else
+		*ReadyPtr = ((FlashStatus[1] & 0x01U) == 0U) ? TRUE : FALSE;
+#else
+	SchedMsg.Opcode = READ_FLAG_STATUS_CMD;
+	SchedMsg.Addrsize = 0;
+	SchedMsg.Addrvalid = 0;
+	SchedMsg.TxBfrPtr = NULL;
+	SchedMsg.RxBfrPtr = FlashStatus;
+	SchedMsg.ByteCount = 1;
+	SchedMsg.Flags = XOSPIPSV_MSG_FLAG_RX;
+	SchedMsg.Dummy = 0;
+	SchedMsg.IsDDROpCode = 0;
+	SchedMsg.Proto = 0;
+	if (InstancePtr->SpiInstPtr->SdrDdrMode == XOSPIPSV_EDGE_MODE_DDR_PHY) {
+		SchedMsg.Proto = XOSPIPSV_READ_8_0_8;
+		SchedMsg.ByteCount = 2;
+		SchedMsg.Dummy = 8;
+	}
+	InstancePtr->SpiInstPtr->Msg = &SchedMsg;
+	Status = XIsf_Transfer(InstancePtr, NULLPtr, NULLPtr,
+			SchedMsg.ByteCount);
+	if (Status != (int)XST_SUCCESS)
+		return (int)XST_FAILURE;
+
+	*ReadyPtr = ((FlashStatus[0] & 0x80U) != 0U) ? TRUE : FALSE;
+#endif
+
+	return (int)XST_SUCCESS;
+}
+
+#ifdef XPAR_XISF_INTERFACE_QSPIPSU
+/*****************************************************************************/
+/**
+ * @brief
+ * This function fills the command buffer with a command and its address.
+ *
+ * @param	SchedPtr	Pointer to the scheduler instance.
+ * @param	Command		Command byte.
+ * @param	Address		Address in the Serial Flash.
+ * @param	FourByte	TRUE to send a four byte address.
+ *
+ * @return	Number of bytes of the command and address.
+ *
+ ******************************************************************************/
+static u32 XIsf_SchedSetAddr(XIsf_Sched *SchedPtr, u8 Command, u32 Address,
+			     u8 FourByte)
+{
+	u32 RealAddr = GetRealAddr(SchedPtr->IsfPtr->SpiInstPtr, Address);
+
+	SchedPtr->CmdBuf[BYTE1] = Command;
+	if (FourByte == TRUE) {
+		SchedPtr->CmdBuf[BYTE2] = (u8)(RealAddr >> XISF_ADDR_SHIFT24);
+		SchedPtr->CmdBuf[BYTE3] = (u8)(RealAddr >> XISF_ADDR_SHIFT16);
+		SchedPtr->CmdBuf[BYTE4] = (u8)(RealAddr >> XISF_ADDR_SHIFT8);
+		SchedPtr->CmdBuf[BYTE5] = (u8)RealAddr;
+		return 5U;
+	}
+
+	SchedPtr->CmdBuf[BYTE2] = (u8)(RealAddr >> XISF_ADDR_SHIFT16);
+	SchedPtr->CmdBuf[BYTE3] = (u8)(RealAddr >> XISF_ADDR_SHIFT8);
+	SchedPtr->CmdBuf[BYTE4] = (u8)RealAddr;
+	return 4U;
+}
+#endif
+#endif /* XISF_SCHED_SUPPORT */
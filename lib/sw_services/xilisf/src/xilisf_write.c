@@ -42,6 +42,7 @@
  *      sk   02/15/19 4B write command is not supported by all QSPI Micron
  *                    flashes hence used used 3B write command.
  * 5.14 akm  08/01/19 Initialized Status variable to XST_FAILURE.
+ * 5.15 ag   10/14/26 Suspend and resume XIP mode around XIsf_Write.
  *
  * </pre>
  *
@@ -248,6 +249,11 @@ int XIsf_Write(XIsf *InstancePtr, XIsf_WriteOperation Operation,
 	if (OpParamPtr == NULL)
 		return (int)XST_FAILURE;
 
+#ifdef XISF_XIP_SUPPORT
+	if (XIsf_XipSuspend(InstancePtr) != (int)XST_SUCCESS)
+		return (int)XST_FAILURE;
+#endif
+
 	switch (Operation) {
 	case XISF_WRITE:
 		WriteParamPtr = (XIsf_WriteParam *)(void *) OpParamPtr;
@@ -423,6 +429,18 @@ int XIsf_Write(XIsf *InstancePtr, XIsf_WriteOperation Operation,
 #endif
 	}
 
+#ifdef XISF_XIP_SUPPORT
+	if (Operation == XISF_WRITE) {
+		WriteParamPtr = (XIsf_WriteParam *)(void *) OpParamPtr;
+		if (XIsf_XipResume(InstancePtr, WriteParamPtr->Address,
+				WriteParamPtr->NumBytes) != (int)XST_SUCCESS)
+			Status = (int)XST_FAILURE;
+	} else {
+		if (XIsf_XipResume(InstancePtr, 0U, 0U) != (int)XST_SUCCESS)
+			Status = (int)XST_FAILURE;
+	}
+#endif
+
 	return Status;
 }
 
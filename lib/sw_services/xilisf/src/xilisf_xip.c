@@ -0,0 +1,427 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xilisf_xip.c
+ *
+ * This file contains the library functions of the XIP memory-mapped read mode.
+ * Refer xilisf.h for a detailed description.
+ *
+ * In XIP mode the flash is read through the linear window of the controller,
+ * linear mode on the ZynqMP QSPIPSU interface and DAC mode on the OSPIPSV
+ * interface. A region of the window can be mapped as normal cacheable memory
+ * for read-mostly data or code. XIsf_Write() and XIsf_Erase() suspend XIP
+ * mode, which maps the region back as device memory and selects the indirect
+ * mode of the controller, and resume it when the operation is done.
+ * XIsf_WriteEnable() suspends it until the erase/program which follows.
+ *
+ * Only the single connection mode is supported. The other operations of the
+ * library must be used with XIP mode disabled. Quad reads in linear mode need
+ * the quad enable bit of the flash set by the application.
+ *
+ * <pre>
+ *
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who      Date     Changes
+ * ----- -------  -------- -----------------------------------------------
+ * 5.15  ag       10/14/26 First release
+ *
+ * </pre>
+ *
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "include/xilisf.h"
+
+#ifdef XISF_XIP_SUPPORT
+#include "xil_cache.h"
+#if defined(__aarch64__) || defined(ARMA53_32)
+#include "xil_mmu.h"
+#endif
+
+/************************** Constant Definitions *****************************/
+
+/*
+ * Base address of the linear window and translation table granule used to
+ * map the cacheable region.
+ */
+#ifdef XPAR_XISF_INTERFACE_OSPIPSV
+#define XISF_XIP_BASEADDR	XOSPIPSV_LINEAR_ADDR_BASE
+#define XISF_XIP_WINDOW_SIZE	0x20000000U	/**< 512 MB */
+#elif defined(XPAR_PSU_QSPI_LINEAR_0_S_AXI_BASEADDR)
+#define XISF_XIP_BASEADDR	XPAR_PSU_QSPI_LINEAR_0_S_AXI_BASEADDR
+#define XISF_XIP_WINDOW_SIZE	0x20000000U	/**< 512 MB */
+#else
+#define XISF_XIP_BASEADDR	0xC0000000U
+#define XISF_XIP_WINDOW_SIZE	0x20000000U	/**< 512 MB */
+#endif
+
+#if defined(__aarch64__)
+#define XISF_XIP_BLOCK_SIZE	0x200000U	/**< 2 MB blocks */
+#elif defined(ARMA53_32)
+#define XISF_XIP_BLOCK_SIZE	0x100000U	/**< 1 MB sections */
+#endif
+
+#ifdef XPAR_XISF_INTERFACE_QSPIPSU
+#define XISF_XIP_LQSPI_ADDR_4BYTE	0x08000000U /**< 32 bit addressing */
+#define XISF_XIP_LQSPI_DUMMY_SHIFT	8U	/**< Dummy bytes field */
+#define XISF_XIP_LQSPI_DUMMY_MASK	0x00000700U
+#endif
+
+/************************** Function Prototypes ******************************/
+
+static int XIsf_XipSetMode(XIsf *InstancePtr);
+static int XIsf_XipSetIndirect(XIsf *InstancePtr);
+static void XIsf_XipMapRegion(XIsf *InstancePtr, u8 Cacheable);
+
+/************************** Function Definitions ******************************/
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This API switches the flash into XIP memory-mapped read mode.
+ *
+ * @param	InstancePtr	Pointer to the XIsf instance.
+ * @param	XipParamPtr	Pointer to the XIP parameters.
+ *			XipParamPtr->Address and XipParamPtr->Size give the
+ *			region mapped as normal cacheable memory when
+ *			XISF_XIP_CACHEABLE is set in XipParamPtr->Options. The
+ *			region is extended to the translation table granule,
+ *			2 MB on 64-bit and 1 MB on 32-bit ARMv8.
+ *			XISF_XIP_CODE invalidates the instruction cache after
+ *			erase/program.
+ *			XISF_XIP_QUAD_READ selects the quad output fast read
+ *			command in linear mode, with XipParamPtr->NumDummyBytes
+ *			dummy bytes.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_FAILURE if it fails.
+ *
+ * @note
+ *		- The cacheable region is only supported on ARMv8 processors.
+ *		- XIP mode is only supported in polling mode.
+ *		- Use XIsf_XipGetAddr() to get the address of a flash offset.
+ *
+ ******************************************************************************/
+int XIsf_XipEnable(XIsf *InstancePtr, XIsf_XipParam *XipParamPtr)
+{
+	int Status;
+
+	if (InstancePtr == NULL)
+		return (int)XST_FAILURE;
+
+	if (InstancePtr->IsReady != TRUE)
+		return (int)XST_FAILURE;
+
+	if (XipParamPtr == NULL)
+		return (int)XST_FAILURE;
+
+	if (InstancePtr->XipState != XISF_XIP_STATE_OFF)
+		return (int)XST_FAILURE;
+
+	if (InstancePtr->SpiInstPtr->Config.ConnectionMode != 0U)
+		return (int)XST_FAILURE;
+
+	if (XIsf_GetTransferMode(InstancePtr) == XISF_INTERRUPT_MODE)
+		return (int)XST_FAILURE;
+
+	if ((XipParamPtr->Options & XISF_XIP_CACHEABLE) != 0U) {
+#ifdef XISF_XIP_BLOCK_SIZE
+		if ((XipParamPtr->Size == 0U) ||
+			(XipParamPtr->Address >= XISF_XIP_WINDOW_SIZE) ||
+			(XipParamPtr->Size >
+				(XISF_XIP_WINDOW_SIZE - XipParamPtr->Address)))
+			return (int)XST_FAILURE;
+#else
+		return (int)XST_FAILURE;
+#endif
+	}
+
+	InstancePtr->XipParam = *XipParamPtr;
+
+	Status = XIsf_XipSetMode(InstancePtr);
+	if (Status != (int)XST_SUCCESS) {
+		(void)XIsf_XipSetIndirect(InstancePtr);
+		return (int)XST_FAILURE;
+	}
+
+	XIsf_XipMapRegion(InstancePtr, TRUE);
+
+	InstancePtr->XipState = XISF_XIP_STATE_ON;
+
+	return (int)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This API leaves XIP mode. The cacheable region is mapped back as device
+ * memory and the indirect mode of the controller is selected.
+ *
+ * @param	InstancePtr	Pointer to the XIsf instance.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_FAILURE if it fails.
+ *
+ ******************************************************************************/
+int XIsf_XipDisable(XIsf *InstancePtr)
+{
+	int Status;
+
+	if (InstancePtr == NULL)
+		return (int)XST_FAILURE;
+
+	if (InstancePtr->XipState == XISF_XIP_STATE_OFF)
+		return (int)XST_SUCCESS;
+
+	if (InstancePtr->XipState == XISF_XIP_STATE_ON)
+		XIsf_XipMapRegion(InstancePtr, FALSE);
+
+	Status = XIsf_XipSetIndirect(InstancePtr);
+
+	InstancePtr->XipState = XISF_XIP_STATE_OFF;
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This API returns the address at which a flash offset is read in XIP mode.
+ *
+ * @param	InstancePtr	Pointer to the XIsf instance.
+ * @param	Address		Offset in the Serial Flash.
+ *
+ * @return	Address in the linear window, NULL if XIP mode is disabled or
+ *		the offset is outside the window.
+ *
+ ******************************************************************************/
+u8 *XIsf_XipGetAddr(XIsf *InstancePtr, u32 Address)
+{
+	if ((InstancePtr == NULL) ||
+		(InstancePtr->XipState == XISF_XIP_STATE_OFF) ||
+		(Address >= XISF_XIP_WINDOW_SIZE))
+		return NULL;
+
+	return (u8 *)(UINTPTR)(XISF_XIP_BASEADDR + Address);
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This API suspends XIP mode before an erase or program operation. It does
+ * nothing if XIP mode is disabled.
+ *
+ * @param	InstancePtr	Pointer to the XIsf instance.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_FAILURE if it fails.
+ *
+ * @note	The region is mapped as device memory first, so no speculative
+ *		read reaches the window while the controller is in indirect
+ *		mode.
+ *
+ ******************************************************************************/
+int XIsf_XipSuspend(XIsf *InstancePtr)
+{
+	int Status;
+
+	if (InstancePtr->XipState != XISF_XIP_STATE_ON)
+		return (int)XST_SUCCESS;
+
+	XIsf_XipMapRegion(InstancePtr, FALSE);
+
+	Status = XIsf_XipSetIndirect(InstancePtr);
+	if (Status != (int)XST_SUCCESS) {
+		XIsf_XipMapRegion(InstancePtr, TRUE);
+		return (int)XST_FAILURE;
+	}
+
+	InstancePtr->XipState = XISF_XIP_STATE_SUSPENDED;
+
+	return (int)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This API resumes XIP mode after an erase or program operation. It does
+ * nothing if XIP mode was not suspended.
+ *
+ * @param	InstancePtr	Pointer to the XIsf instance.
+ * @param	Address		Offset of the erased or programmed range.
+ * @param	ByteCount	Size of the range, 0 for the whole flash.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_FAILURE if it fails, XIP mode is disabled.
+ *
+ * @note	Remapping the region cleans and invalidates the data cache,
+ *		so only the instruction cache is invalidated here.
+ *
+ ******************************************************************************/
+int XIsf_XipResume(XIsf *InstancePtr, u32 Address, u32 ByteCount)
+{
+	int Status;
+
+	if (InstancePtr->XipState != XISF_XIP_STATE_SUSPENDED)
+		return (int)XST_SUCCESS;
+
+	Status = XIsf_XipSetMode(InstancePtr);
+	if (Status != (int)XST_SUCCESS) {
+		(void)XIsf_XipSetIndirect(InstancePtr);
+		InstancePtr->XipState = XISF_XIP_STATE_OFF;
+		return (int)XST_FAILURE;
+	}
+
+	XIsf_XipMapRegion(InstancePtr, TRUE);
+
+	if ((InstancePtr->XipParam.Options & XISF_XIP_CODE) != 0U) {
+		if ((ByteCount == 0U) || (Address >= XISF_XIP_WINDOW_SIZE)) {
+			Xil_ICacheInvalidate();
+		} else {
+			Xil_ICacheInvalidateRange(
+				(INTPTR)(XISF_XIP_BASEADDR + Address),
+				ByteCount);
+		}
+	}
+
+	InstancePtr->XipState = XISF_XIP_STATE_ON;
+
+	return (int)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function selects the memory-mapped mode of the controller.
+ *
+ * @param	InstancePtr	Pointer to the XIsf instance.
+ *
+ * @return	XST_SUCCESS if successful else XST_FAILURE.
+ *
+ ******************************************************************************/
+static int XIsf_XipSetMode(XIsf *InstancePtr)
+{
+#ifdef XPAR_XISF_INTERFACE_QSPIPSU
+	u32 Options = XQSPIPSU_LQSPI_MODE_OPTION | XQSPIPSU_CFG_WP_HOLD_MASK;
+	u32 LqspiCr;
+
+	if (InstancePtr->FourByteAddrMode != TRUE)
+		Options |= XQSPIPSU_LQSPI_LESS_THEN_SIXTEENMB;
+
+	if (XQspiPsu_SetOptions(InstancePtr->SpiInstPtr, Options) !=
+			XST_SUCCESS)
+		return (int)XST_FAILURE;
+
+	if ((InstancePtr->XipParam.Options & XISF_XIP_QUAD_READ) != 0U) {
+		LqspiCr = XQSPIPSU_LQSPI_CR_LINEAR_MASK |
+			(((u32)InstancePtr->XipParam.NumDummyBytes <<
+			XISF_XIP_LQSPI_DUMMY_SHIFT) &
+			XISF_XIP_LQSPI_DUMMY_MASK);
+		if (InstancePtr->FourByteAddrMode == TRUE) {
+			LqspiCr |= XISF_XIP_LQSPI_ADDR_4BYTE |
+				XISF_CMD_QUAD_OP_FAST_READ_4B;
+		} else {
+			LqspiCr |= XISF_CMD_QUAD_OP_FAST_READ;
+		}
+		XQspiPsu_WriteReg(XQSPIPS_BASEADDR, XQSPIPSU_LQSPI_CR_OFFSET,
+				LqspiCr);
+	}
+
+	XQspiPsu_Select(InstancePtr->SpiInstPtr, XQSPIPSU_SEL_LQSPI_MASK);
+
+	return (int)XST_SUCCESS;
+#else
+	XIsf_ReadParam ReadParam;
+	u8 ReadBuf[8] __attribute__ ((aligned(64)));
+
+	if (XOspiPsv_SetOptions(InstancePtr->SpiInstPtr,
+			XOSPIPSV_DAC_EN_OPTION) != (u32)XST_SUCCESS)
+		return (int)XST_FAILURE;
+
+	/*
+	 * A direct read programs the read instruction of the controller, which
+	 * is then used for the accesses to the linear window.
+	 */
+	ReadParam.Address = 0U;
+	ReadParam.ReadPtr = ReadBuf;
+	ReadParam.NumBytes = 4U;
+	ReadParam.NumDummyBytes = InstancePtr->XipParam.NumDummyBytes;
+
+	return XIsf_Read(InstancePtr, XISF_OCTAL_IO_FAST_READ, &ReadParam);
+#endif
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function selects the indirect mode of the controller used for the
+ * other operations of the library.
+ *
+ * @param	InstancePtr	Pointer to the XIsf instance.
+ *
+ * @return	XST_SUCCESS if successful else XST_FAILURE.
+ *
+ ******************************************************************************/
+static int XIsf_XipSetIndirect(XIsf *InstancePtr)
+{
+#ifdef XPAR_XISF_INTERFACE_QSPIPSU
+	XQspiPsu_Select(InstancePtr->SpiInstPtr, XQSPIPSU_SEL_GQSPI_MASK);
+
+	if (XQspiPsu_SetOptions(InstancePtr->SpiInstPtr, XISF_SPI_OPTIONS) !=
+			XST_SUCCESS)
+		return (int)XST_FAILURE;
+#else
+	if (XOspiPsv_SetOptions(InstancePtr->SpiInstPtr,
+			XOSPIPSV_IDAC_EN_OPTION) != (u32)XST_SUCCESS)
+		return (int)XST_FAILURE;
+#endif
+
+	return (int)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function maps the cacheable region as normal cacheable or as device
+ * memory. It does nothing if XISF_XIP_CACHEABLE is not set.
+ *
+ * @param	InstancePtr	Pointer to the XIsf instance.
+ * @param	Cacheable	TRUE for normal cacheable, FALSE for device.
+ *
+ * @return	None
+ *
+ ******************************************************************************/
+static void XIsf_XipMapRegion(XIsf *InstancePtr, u8 Cacheable)
+{
+#ifdef XISF_XIP_BLOCK_SIZE
+	UINTPTR Addr;
+	UINTPTR End;
+
+	if ((InstancePtr->XipParam.Options & XISF_XIP_CACHEABLE) == 0U)
+		return;
+
+	Addr = (UINTPTR)XISF_XIP_BASEADDR + InstancePtr->XipParam.Address;
+	End = Addr + InstancePtr->XipParam.Size;
+	Addr &= ~((UINTPTR)XISF_XIP_BLOCK_SIZE - 1U);
+
+	for (; Addr < End; Addr += XISF_XIP_BLOCK_SIZE) {
+		Xil_SetTlbAttributes(Addr, (Cacheable == TRUE) ?
+				NORM_WB_CACHE : DEVICE_MEMORY);
+	}
+#else
+	(void)InstancePtr;
+	(void)Cacheable;
+#endif
+}
+#endif /* XISF_XIP_SUPPORT */
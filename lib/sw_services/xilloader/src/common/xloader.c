@@ -139,6 +139,7 @@
 *       dc   07/27/2022 Added goto END in error case for header failures
 *       ma   08/08/2022 Check EAM errors between each image load
 *       ng   18/08/2022 Modified DelayedHandoffCpus condition to handle all possible values
+*       ag   10/14/2026 Restore cached partitions while restarting images
 *
 * </pre>
 *
@@ -169,6 +170,7 @@
 #include "xplmi_event_logging.h"
 #include "xplmi_wdt.h"
 #include "xloader_plat.h"
+#include "xloader_prtn_cache.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -1329,6 +1331,7 @@ int XLoader_RestartImage(u32 ImageId, u32 *FuncID)
 	 */
 	 PdiPtr->PdiType = XLOADER_PDI_TYPE_PARTIAL;
 	 PdiPtr->PdiSrc = XLOADER_PDI_SRC_DDR;
+	XLoader_PrtnCacheSetRestart((u8)TRUE);
 	for (Index = (int)PdiList->Count - 1; Index >= 0; Index--) {
 		PdiAddr = PdiList->PdiAddr[Index];
 		Status = XLoader_PdiInit(PdiPtr, XLOADER_PDI_SRC_DDR, PdiAddr);
@@ -1376,6 +1379,7 @@ END1:
 	Status = XLoader_StartImage(PdiPtr);
 
 END:
+	XLoader_PrtnCacheSetRestart((u8)FALSE);
 	if (Status == XST_SUCCESS) {
 		XPlmi_Out32(PMC_GLOBAL_DONE, XLOADER_PDI_LOAD_COMPLETE);
 	}
@@ -88,6 +88,7 @@
 *       bsv  07/08/22 Changes related to Optional data in Image header table
 *       kpt  07/24/22 Added support to go into secure lockdown when KAT fails
 *       kpt  08/03/22 Added volatile keyword to avoid compiler optimization of loop redundancy checks
+*       ag   10/15/26 Invalidated PUF regeneration cache when PUF key is zeroized
 *
 * </pre>
 *
@@ -2668,6 +2669,13 @@ static int XLoader_DecryptBlkKey(const XSecure_Aes *AesInstPtr,
 		PufData->ReadOption = XPUF_READ_FROM_EFUSE_CACHE;
 	}
 
+	/* PUF key zeroized in AES can not be reused from regeneration cache */
+	if ((XPlmi_In32(AesInstPtr->BaseAddress +
+		XSECURE_AES_KEY_ZEROED_STATUS_OFFSET) & XSECURE_PUF_KEY_ZEROED_MASK)
+		== XSECURE_PUF_KEY_ZEROED_MASK) {
+		XPuf_RegenerationCacheInvalidate();
+	}
+
 	Status = XPuf_Regeneration(PufData);
 	if (Status != XST_SUCCESS) {
 		XPlmi_Printf(DEBUG_GENERAL, "Failed at PUF regeneration with status "
@@ -62,6 +62,8 @@
 *       bm   07/18/2022 Shutdown modules gracefully during update
 *       ma   07/27/2022 Added support for CFrame data clear check which is
 *                       required during PL secure lockdown
+*       ag   10/14/2026 Added command to configure partition cache
+*       ag   10/15/2026 Invalidate partition cache on image store changes
 *
 * </pre>
 *
@@ -85,6 +87,7 @@
 #include "xloader_ddr.h"
 #include "xplmi_plat.h"
 #include "xloader_plat.h"
+#include "xloader_prtn_cache.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -128,6 +131,10 @@ static XPlmi_Module XPlmi_Loader;
 #define XLOADER_CMD_GET_HANDOFF_PARAM_DESTADDR_HIGH_INDEX	(0U)
 #define XLOADER_CMD_GET_HANDOFF_PARAM_DESTADDR_LOW_INDEX	(1U)
 #define XLOADER_CMD_GET_HANDOFF_PARAM_DEST_SIZE_INDEX	(2U)
+#define XLOADER_CMD_PRTN_CACHE_IMGID_INDEX		(0U)
+#define XLOADER_CMD_PRTN_CACHE_ADDR_HIGH_INDEX		(1U)
+#define XLOADER_CMD_PRTN_CACHE_ADDR_LOW_INDEX		(2U)
+#define XLOADER_CMD_PRTN_CACHE_SIZE_INDEX		(3U)
 #define XLOADER_RESP_CMD_EXEC_STATUS_INDEX	(0U)
 #define XLOADER_RESP_CMD_FEATURES_CMD_SUPPORTED	(1U)
 #define XLOADER_RESP_CMD_READBACK_PROCESSED_LEN_INDEX	(1U)
@@ -153,6 +160,7 @@ static XPlmi_Module XPlmi_Loader;
 /* Loader command defines */
 #define XLOADER_CMD_READBACK_CMD_ID				(0x7U)
 #define XLOADER_CMD_UPDATE_MULTIBOOT_CMD_ID	(0x8U)
+#define XLOADER_CMD_CONFIG_PRTN_CACHE_CMD_ID	(0xDU)
 
 #define XLOADER_IMG_HDR_TBL_EXPORT_MASK0	(0x00021F7FU)
 #define XLOADER_IMG_HDR_EXPORT_MASK0	(0x00003FFBU)
@@ -606,6 +614,8 @@ static int XLoader_AddImageStorePdi(XPlmi_Cmd *Cmd)
 	}
 	PdiList->PdiAddr[Index] = PdiAddr;
 	PdiList->Count++;
+	/* Images of the new PDI replace the cached ones on restart */
+	XLoader_PrtnCacheInvalidate();
 
 END:
 	return Status;
@@ -655,6 +665,7 @@ static int XLoader_RemoveImageStorePdi(XPlmi_Cmd *Cmd)
 		goto END;
 	}
 	PdiList->Count--;
+	XLoader_PrtnCacheInvalidate();
 	if (PdiList->Count == 0U) {
 		Status = XLoader_DdrRelease();
 		if (Status != XST_SUCCESS) {
@@ -891,6 +902,38 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function configures the DDR region used to cache the
+ *          non CDO partitions of an image. Cached partitions are restored
+ *          from this region when the image is restarted. A size of zero
+ *          removes the cache of the image.
+ *
+ *  Command payload parameters are:
+ *	- Image ID
+ *	- Cache High Address
+ *	- Cache Low Address
+ *	- Cache Size in bytes
+ *
+ * @param	Cmd is pointer to the command structure
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XLoader_ConfigPrtnCache(XPlmi_Cmd *Cmd)
+{
+	int Status = XST_FAILURE;
+	u64 Addr = ((u64)Cmd->Payload[XLOADER_CMD_PRTN_CACHE_ADDR_HIGH_INDEX] <<
+		32U) | (u64)Cmd->Payload[XLOADER_CMD_PRTN_CACHE_ADDR_LOW_INDEX];
+
+	Status = XLoader_PrtnCacheConfig(
+		Cmd->Payload[XLOADER_CMD_PRTN_CACHE_IMGID_INDEX], Addr,
+		Cmd->Payload[XLOADER_CMD_PRTN_CACHE_SIZE_INDEX]);
+	Cmd->Response[XLOADER_RESP_CMD_EXEC_STATUS_INDEX] = (u32)Status;
+
+	return Status;
+}
+
 /**
  * @{
  * @cond xloader_internal
@@ -918,7 +961,9 @@ static int XLoader_CheckIpiAccess(u32 CmdId, u32 IpiReqType)
 	if (((ModuleCmdId == XLOADER_CMD_READBACK_CMD_ID) &&
 		(ModuleCmdIdTmp == XLOADER_CMD_READBACK_CMD_ID)) ||
 		((ModuleCmdId == XLOADER_CMD_UPDATE_MULTIBOOT_CMD_ID) &&
-		(ModuleCmdIdTmp == XLOADER_CMD_UPDATE_MULTIBOOT_CMD_ID))) {
+		(ModuleCmdIdTmp == XLOADER_CMD_UPDATE_MULTIBOOT_CMD_ID)) ||
+		((ModuleCmdId == XLOADER_CMD_CONFIG_PRTN_CACHE_CMD_ID) &&
+		(ModuleCmdIdTmp == XLOADER_CMD_CONFIG_PRTN_CACHE_CMD_ID))) {
 		if ((XPLMI_CMD_SECURE == IpiRequestType) &&
 			(XPLMI_CMD_SECURE == IpiRequestTypeTmp)) {
 			Status = XST_SUCCESS;
@@ -927,7 +972,9 @@ static int XLoader_CheckIpiAccess(u32 CmdId, u32 IpiReqType)
 	else if (((ModuleCmdId != XLOADER_CMD_READBACK_CMD_ID) &&
 		(ModuleCmdIdTmp != XLOADER_CMD_READBACK_CMD_ID)) &&
 		((ModuleCmdId != XLOADER_CMD_UPDATE_MULTIBOOT_CMD_ID) &&
-		(ModuleCmdIdTmp != XLOADER_CMD_UPDATE_MULTIBOOT_CMD_ID))) {
+		(ModuleCmdIdTmp != XLOADER_CMD_UPDATE_MULTIBOOT_CMD_ID)) &&
+		((ModuleCmdId != XLOADER_CMD_CONFIG_PRTN_CACHE_CMD_ID) &&
+		(ModuleCmdIdTmp != XLOADER_CMD_CONFIG_PRTN_CACHE_CMD_ID))) {
 		if (ModuleCmdId == ModuleCmdIdTmp) {
 			Status = XST_SUCCESS;
 		}
@@ -958,7 +1005,8 @@ static const XPlmi_ModuleCmd XLoader_Cmds[] =
 	XPLMI_MODULE_COMMAND(XLoader_AddImageStorePdi),
 	XPLMI_MODULE_COMMAND(XLoader_RemoveImageStorePdi),
 	XPLMI_MODULE_COMMAND(XLoader_GetATFHandOffParams),
-	XPLMI_MODULE_COMMAND(XLoader_CframeDataClearCheck)
+	XPLMI_MODULE_COMMAND(XLoader_CframeDataClearCheck),
+	XPLMI_MODULE_COMMAND(XLoader_ConfigPrtnCache)
 };
 
 /*****************************************************************************/
@@ -31,6 +31,7 @@
 * 1.05  bsv  10/26/2021 Code clean up
 *       bm   07/06/2022 Refactor versal and versal_net code
 *       is   09/12/2022 Remove PM_CAP_SECURE capability when requesting DDR_0
+*       ag   10/14/2026 Use both PMC DMAs for blocking DDR copies
 *
 * </pre>
 *
@@ -134,9 +135,14 @@ int XLoader_DdrCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
 	/* Update the flags for NON blocking DMA call */
 	if (Flags == XPLMI_DEVICE_COPY_STATE_INITIATE) {
 		DmaFlags |= XPLMI_DMA_SRC_NONBLK;
+		Status = XPlmi_DmaXfr(SrcAddr, DestAddr,
+			Length >> (XPLMI_WORD_LEN_SHIFT), DmaFlags);
+	}
+	else {
+		/* Blocking copies are split across both PMC DMAs */
+		Status = XPlmi_DmaXfrSplit(SrcAddr, DestAddr,
+			Length >> (XPLMI_WORD_LEN_SHIFT), DmaFlags);
 	}
-	Status = XPlmi_DmaXfr(SrcAddr, DestAddr, Length >> (XPLMI_WORD_LEN_SHIFT),
-		DmaFlags);
 
 END:
 	return Status;
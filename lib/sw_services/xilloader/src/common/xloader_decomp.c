@@ -0,0 +1,388 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xloader_decomp.c
+*
+* This file contains the code to load compressed partitions. A partition is
+* compressed if XIH_PH_ATTRB_COMPRESSED_MASK is set in its attributes. The
+* partition data has the below layout, all words being little endian.
+*
+*	Word 0: XLOADER_DECOMP_MAGIC
+*	Word 1: Decompressed length in bytes
+*	Blocks: Block header word followed by the block data padded to a word.
+*		Header bits [30:0] hold the block data length in bytes and bit 31
+*		is set if the block is stored without compression. A header of
+*		zero marks the end of the partition data.
+*
+* Compressed blocks use the LZ4 block format. Matches can refer to the output
+* of previous blocks, so the blocks are decoded straight to the destination.
+* The compressed data is read from the boot device into the two PMC RAM chunk
+* buffers and the read of the next buffer is started before the blocks in the
+* current buffer are decoded, which overlaps the device copy with decoding.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  ag   10/14/2026 First release
+*
+* </pre>
+*
+* @note
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xloader_decomp.h"
+#include "xloader_plat.h"
+#include "xplmi_hw.h"
+#include "xplmi_debug.h"
+#include "xplmi_plat.h"
+#include "xplmi.h"
+#include "xil_mem.h"
+
+/************************** Constant Definitions *****************************/
+#define XLOADER_DECOMP_MAGIC		(0x345A4C58U) /**< "XLZ4" */
+#define XLOADER_DECOMP_HDR_LEN		(8U) /**< Magic and length words */
+#define XLOADER_DECOMP_BLK_HDR_LEN	(4U) /**< Block header word */
+#define XLOADER_DECOMP_BLK_STORED_MASK	(0x80000000U) /**< Stored block */
+#define XLOADER_DECOMP_BLK_LEN_MASK	(0x7FFFFFFFU) /**< Block data length */
+#define XLOADER_DECOMP_BUF_LEN		XLOADER_SECURE_CHUNK_SIZE /**< Length
+						of each PMC RAM buffer */
+#define XLOADER_DECOMP_MIN_MATCH	(4U) /**< Minimum LZ4 match length */
+#define XLOADER_DECOMP_LEN_EXT		(15U) /**< Token value that has
+						extra length bytes */
+#define XLOADER_DECOMP_LEN_EXT_BYTE	(255U) /**< Extra length byte that is
+						followed by another */
+#define XLOADER_DECOMP_LIT_SHIFT	(4U) /**< Literal length in token */
+#define XLOADER_DECOMP_MATCH_MASK	(0xFU) /**< Match length in token */
+
+/**************************** Type Definitions *******************************/
+/* Output of the decoder */
+typedef struct {
+	u8 *Start; /**< Start of the decompressed data */
+	u8 *Next; /**< Next byte to be written */
+	u8 *End; /**< End of the decompressed data */
+} XLoader_DecompOut;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define XLOADER_DECOMP_ALIGN_LEN(Len)	(((Len) + XPLMI_WORD_LEN_MASK) & \
+						(~XPLMI_WORD_LEN_MASK))
+
+/************************** Function Prototypes ******************************/
+static int XLoader_DecompReadLen(const u8 **In, const u8 *InEnd, u32 *Len);
+static int XLoader_DecompBlock(const u8 *In, u32 InLen, XLoader_DecompOut *Out);
+static int XLoader_DecompBuf(u32 BufAddr, u32 Ofst, u32 End,
+	XLoader_DecompOut *Out);
+
+/************************** Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+ * @brief	This function adds the extra length bytes of an LZ4 literal or
+ * match length to the given length.
+ *
+ * @param	In is pointer to the next input byte, updated on return
+ * @param	InEnd is end of the input
+ * @param	Len is pointer to the length to be updated
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XLoader_DecompReadLen(const u8 **In, const u8 *InEnd, u32 *Len)
+{
+	int Status = XST_FAILURE;
+	const u8 *Ptr = *In;
+	u32 Byte;
+
+	do {
+		if (Ptr >= InEnd) {
+			goto END;
+		}
+		Byte = *Ptr;
+		++Ptr;
+		*Len += Byte;
+	} while (Byte == XLOADER_DECOMP_LEN_EXT_BYTE);
+	*In = Ptr;
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function decodes an LZ4 block to the output.
+ *
+ * @param	In is pointer to the block data
+ * @param	InLen is the length of the block data in bytes
+ * @param	Out is pointer to the decoder output
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XLoader_DecompBlock(const u8 *In, u32 InLen, XLoader_DecompOut *Out)
+{
+	int Status = XST_FAILURE;
+	const u8 *InEnd = In + InLen;
+	u8 *Match;
+	u32 Token;
+	u32 Len;
+	u32 Ofst;
+
+	while (In < InEnd) {
+		Token = *In;
+		++In;
+
+		/* Literals */
+		Len = Token >> XLOADER_DECOMP_LIT_SHIFT;
+		if (Len == XLOADER_DECOMP_LEN_EXT) {
+			if (XLoader_DecompReadLen(&In, InEnd, &Len) != XST_SUCCESS) {
+				goto END;
+			}
+		}
+		if ((Len > (u32)(InEnd - In)) ||
+			(Len > (u32)(Out->End - Out->Next))) {
+			goto END;
+		}
+		Xil_MemCpy(Out->Next, In, Len);
+		Out->Next += Len;
+		In += Len;
+		/* Last sequence of the block has only literals */
+		if (In == InEnd) {
+			break;
+		}
+
+		/* Match */
+		if ((u32)(InEnd - In) < 2U) {
+			goto END;
+		}
+		Ofst = (u32)In[0U] | ((u32)In[1U] << 8U);
+		In += 2U;
+		if ((Ofst == 0U) || (Ofst > (u32)(Out->Next - Out->Start))) {
+			goto END;
+		}
+		Len = Token & XLOADER_DECOMP_MATCH_MASK;
+		if (Len == XLOADER_DECOMP_LEN_EXT) {
+			if (XLoader_DecompReadLen(&In, InEnd, &Len) != XST_SUCCESS) {
+				goto END;
+			}
+		}
+		Len += XLOADER_DECOMP_MIN_MATCH;
+		if (Len > (u32)(Out->End - Out->Next)) {
+			goto END;
+		}
+		Match = Out->Next - Ofst;
+		if (Ofst >= Len) {
+			Xil_MemCpy(Out->Next, Match, Len);
+			Out->Next += Len;
+		}
+		else {
+			/* Overlapping match repeats the last Ofst bytes */
+			while (Len > 0U) {
+				*Out->Next = *Match;
+				++Out->Next;
+				++Match;
+				--Len;
+			}
+		}
+	}
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function decodes the complete blocks in a PMC RAM buffer.
+ *
+ * @param	BufAddr is the address of the buffer
+ * @param	Ofst is the offset of the first block header in the buffer
+ * @param	End is the offset after the last complete block in the buffer
+ * @param	Out is pointer to the decoder output
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XLoader_DecompBuf(u32 BufAddr, u32 Ofst, u32 End,
+	XLoader_DecompOut *Out)
+{
+	int Status = XST_FAILURE;
+	u32 BlkOfst = Ofst;
+	u32 BlkHdr;
+	u32 BlkLen;
+	const u8 *BlkData;
+
+	while (BlkOfst < End) {
+		BlkHdr = XPlmi_In32(BufAddr + BlkOfst);
+		BlkLen = BlkHdr & XLOADER_DECOMP_BLK_LEN_MASK;
+		BlkOfst += XLOADER_DECOMP_BLK_HDR_LEN;
+		BlkData = (const u8 *)(UINTPTR)(BufAddr + BlkOfst);
+		if ((BlkHdr & XLOADER_DECOMP_BLK_STORED_MASK) != 0U) {
+			if (BlkLen > (u32)(Out->End - Out->Next)) {
+				goto END;
+			}
+			Xil_MemCpy(Out->Next, BlkData, BlkLen);
+			Out->Next += BlkLen;
+		}
+		else if (XLoader_DecompBlock(BlkData, BlkLen, Out) != XST_SUCCESS) {
+			goto END;
+		}
+		else {
+			/* MISRA-C compliance */
+		}
+		BlkOfst += XLOADER_DECOMP_ALIGN_LEN(BlkLen);
+	}
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function copies a compressed partition from the boot device
+ * and decompresses it to the destination. Only non secure partitions without
+ * checksum are supported and the destination must be within 32 bit address
+ * range as it is written by the PMC processor.
+ *
+ * @param	PdiPtr is pointer to XilPdi instance
+ * @param	DeviceCopy is pointer to the copy parameters of the compressed
+ *		data
+ * @param	DecompLen is pointer to store the decompressed length in bytes
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+int XLoader_DecompPrtnCopy(const XilPdi* PdiPtr,
+	const XLoader_DeviceCopy* DeviceCopy, u32 *DecompLen)
+{
+	int Status = XST_FAILURE;
+	int DecompStatus = XST_FAILURE;
+	u32 BufAddr = XPLMI_PMCRAM_CHUNK_MEMORY;
+	u32 NextBufAddr = XPLMI_PMCRAM_CHUNK_MEMORY_1;
+	u32 TempAddr;
+	u64 SrcAddr = DeviceCopy->SrcAddr;
+	u64 SrcEnd = DeviceCopy->SrcAddr + DeviceCopy->Len;
+	u64 NextSrcAddr = 0U;
+	u32 BufLen;
+	u32 NextBufLen = 0U;
+	u32 Ofst = XLOADER_DECOMP_HDR_LEN;
+	u32 End;
+	u32 BlkHdr;
+	u32 BlkLen;
+	u32 Len;
+	u8 IsLast = (u8)FALSE;
+	XLoader_DecompOut Out;
+
+	BufLen = DeviceCopy->Len;
+	if (BufLen > XLOADER_DECOMP_BUF_LEN) {
+		BufLen = XLOADER_DECOMP_BUF_LEN;
+	}
+	if (BufLen < XLOADER_DECOMP_HDR_LEN) {
+		Status = XPlmi_UpdateStatus(XLOADER_ERR_DECOMP_INVALID_HDR, 0);
+		goto END;
+	}
+	Status = PdiPtr->MetaHdr.DeviceCopy(SrcAddr, BufAddr, BufLen,
+		DeviceCopy->Flags | XPLMI_DEVICE_COPY_STATE_BLK);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	Len = XPlmi_In32(BufAddr + XPLMI_WORD_LEN);
+	if ((XPlmi_In32(BufAddr) != XLOADER_DECOMP_MAGIC) || (Len == 0U)) {
+		Status = XPlmi_UpdateStatus(XLOADER_ERR_DECOMP_INVALID_HDR, 0);
+		goto END;
+	}
+	if ((DeviceCopy->DestAddr > XPLMI_4GB_END_ADDR) ||
+		(((u64)XPLMI_4GB_END_ADDR - DeviceCopy->DestAddr) < ((u64)Len - 1U))) {
+		Status = XPlmi_UpdateStatus(XLOADER_ERR_DECOMP_UNSUPPORTED, 0);
+		goto END;
+	}
+	Status = XPlmi_VerifyAddrRange(DeviceCopy->DestAddr,
+		DeviceCopy->DestAddr + Len - 1U);
+	if (Status != XST_SUCCESS) {
+		Status = XPlmi_UpdateStatus(XLOADER_ERR_DECOMP_UNSUPPORTED, Status);
+		goto END;
+	}
+	Out.Start = (u8 *)(UINTPTR)DeviceCopy->DestAddr;
+	Out.Next = Out.Start;
+	Out.End = Out.Start + Len;
+
+	while (IsLast == (u8)FALSE) {
+		/* Find the blocks that are complete in the current buffer */
+		End = Ofst;
+		while ((End + XLOADER_DECOMP_BLK_HDR_LEN) <= BufLen) {
+			BlkHdr = XPlmi_In32(BufAddr + End);
+			if (BlkHdr == 0U) {
+				IsLast = (u8)TRUE;
+				break;
+			}
+			BlkLen = XLOADER_DECOMP_ALIGN_LEN(BlkHdr &
+				XLOADER_DECOMP_BLK_LEN_MASK);
+			if (BlkLen > (BufLen - End - XLOADER_DECOMP_BLK_HDR_LEN)) {
+				break;
+			}
+			End += XLOADER_DECOMP_BLK_HDR_LEN + BlkLen;
+		}
+
+		/* Start reading the next buffer before decoding this one */
+		if (IsLast == (u8)FALSE) {
+			NextSrcAddr = SrcAddr + End;
+			if ((End == 0U) || (NextSrcAddr >= SrcEnd)) {
+				Status = XPlmi_UpdateStatus(XLOADER_ERR_DECOMP_CORRUPT, 0);
+				goto END;
+			}
+			NextBufLen = XLOADER_DECOMP_BUF_LEN;
+			if ((SrcEnd - NextSrcAddr) < NextBufLen) {
+				NextBufLen = (u32)(SrcEnd - NextSrcAddr);
+			}
+			Status = PdiPtr->MetaHdr.DeviceCopy(NextSrcAddr, NextBufAddr,
+				NextBufLen, DeviceCopy->Flags |
+				XPLMI_DEVICE_COPY_STATE_INITIATE);
+			if (Status != XST_SUCCESS) {
+				goto END;
+			}
+		}
+
+		DecompStatus = XLoader_DecompBuf(BufAddr, Ofst, End, &Out);
+
+		if (IsLast == (u8)FALSE) {
+			/* Next buffer is waited for even if decoding failed */
+			Status = PdiPtr->MetaHdr.DeviceCopy(NextSrcAddr, NextBufAddr,
+				NextBufLen, DeviceCopy->Flags |
+				XPLMI_DEVICE_COPY_STATE_WAIT_DONE);
+			if (Status != XST_SUCCESS) {
+				goto END;
+			}
+			SrcAddr = NextSrcAddr;
+			TempAddr = BufAddr;
+			BufAddr = NextBufAddr;
+			NextBufAddr = TempAddr;
+			BufLen = NextBufLen;
+			Ofst = 0U;
+		}
+		if (DecompStatus != XST_SUCCESS) {
+			Status = XPlmi_UpdateStatus(XLOADER_ERR_DECOMP_CORRUPT, 0);
+			goto END;
+		}
+	}
+
+	if (Out.Next != Out.End) {
+		Status = XPlmi_UpdateStatus(XLOADER_ERR_DECOMP_CORRUPT, 0);
+		goto END;
+	}
+	*DecompLen = Len;
+	XPlmi_Printf(DEBUG_INFO, "Decompressed 0x%0x bytes to 0x%0x bytes\n\r",
+		DeviceCopy->Len, Len);
+
+END:
+	return Status;
+}
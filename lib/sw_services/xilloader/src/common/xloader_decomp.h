@@ -0,0 +1,53 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xloader_decomp.h
+*
+* This is the header file which contains declarations for loading compressed
+* partitions.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  ag   10/14/2026 First release
+*
+* </pre>
+*
+* @note
+*
+******************************************************************************/
+
+#ifndef XLOADER_DECOMP_H
+#define XLOADER_DECOMP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xloader.h"
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+int XLoader_DecompPrtnCopy(const XilPdi* PdiPtr,
+	const XLoader_DeviceCopy* DeviceCopy, u32 *DecompLen);
+
+/************************** Variable Definitions *****************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* XLOADER_DECOMP_H */
@@ -33,6 +33,9 @@
 * 1.04  bsv  07/16/2021 Added Macronix flash support
 *       bsv  08/31/2021 Code clean up
 * 1.05  ma   01/17/2022 Enable SLVERR for OSPI registers
+* 1.06  ag   10/15/2026 Run DDR PHY mode at the highest prescaler that tunes
+*                       and reads back the boot header, else at the DDR
+*                       switch prescaler
 *
 * </pre>
 *
@@ -48,6 +51,7 @@
 #include "xplmi.h"
 #include "xparameters.h"	/* SDK generated parameters */
 #include "xplmi_status.h"	/* PLMI error codes */
+#include "xil_util.h"
 
 #ifdef XLOADER_OSPI
 #include "xospipsv.h"		/* OSPIPSV device driver */
@@ -64,6 +68,9 @@
 static int FlashReadID(XOspiPsv *OspiPsvPtr);
 static int XLoader_FlashEnterExit4BAddMode(XOspiPsv *OspiPsvPtr, u32 Enable);
 static int XLoader_FlashSetDDRMode(XOspiPsv *OspiPsvPtr);
+static void XLoader_OspiSetReadMsg(XOspiPsv_Msg *FlashMsg, u32 SrcAddr,
+	u64 DestAddr, u32 Length);
+static int XLoader_OspiSetMaxFreq(XOspiPsv *OspiPsvPtr);
 
 /************************** Variable Definitions *****************************/
 static XOspiPsv OspiPsvInstance;
@@ -332,8 +339,10 @@ int XLoader_OspiInit(u32 DeviceFlags)
 			}
 		}
 
-		XOspiPsv_SetClkPrescaler(&OspiPsvInstance,
-			XOSPIPSV_CLK_PRESCALE_2);
+		Status = XLoader_OspiSetMaxFreq(&OspiPsvInstance);
+		if (Status != XST_SUCCESS) {
+			goto END1;
+		}
 	}
 
 END1:
@@ -407,6 +416,135 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function fills the message of a flash read in the current
+ * edge mode of the controller.
+ *
+ * @param	FlashMsg is the message to fill
+ * @param	SrcAddr is the address of the flash to read from
+ * @param	DestAddr is the address of the destination
+ * @param	Length is the number of bytes to read
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XLoader_OspiSetReadMsg(XOspiPsv_Msg *FlashMsg, u32 SrcAddr,
+	u64 DestAddr, u32 Length)
+{
+	FlashMsg->Opcode = READ_CMD_OCTAL_4B;
+	FlashMsg->Addrsize = XLOADER_OSPI_READ_ADDR_SIZE;
+	FlashMsg->Addrvalid = TRUE;
+	FlashMsg->TxBfrPtr = NULL;
+	FlashMsg->ByteCount = Length;
+	FlashMsg->Flags = XOSPIPSV_MSG_FLAG_RX;
+	FlashMsg->Addr = SrcAddr;
+
+	if ((DestAddr >> 32U) == 0U) {
+		FlashMsg->RxBfrPtr = (u8*)(UINTPTR)DestAddr;
+	}
+	else {
+		FlashMsg->RxBfrPtr = NULL;
+		FlashMsg->RxAddr64bit = DestAddr;
+		FlashMsg->Xfer64bit = 1U;
+	}
+
+	if (OspiPsvInstance.SdrDdrMode == XOSPIPSV_EDGE_MODE_DDR_PHY) {
+		FlashMsg->Proto = XOSPIPSV_READ_8_8_8;
+		if (OspiFlashMake == MACRONIX_OCTAL_ID_BYTE0) {
+			FlashMsg->Dummy = XLOADER_MACRONIX_OSPI_DDR_DUMMY_CYCLES +
+				OspiPsvInstance.Extra_DummyCycle;
+			FlashMsg->Opcode = READ_CMD_OPI_MX;
+		}
+		else {
+			FlashMsg->Dummy = XLOADER_OSPI_DDR_DUMMY_CYCLES +
+				OspiPsvInstance.Extra_DummyCycle;
+		}
+	}
+	else {
+		if (OspiFlashMake == MACRONIX_OCTAL_ID_BYTE0) {
+			FlashMsg->Dummy = OspiPsvInstance.Extra_DummyCycle;
+			FlashMsg->Opcode = READ_CMD_4B;
+			FlashMsg->Proto = XOSPIPSV_READ_1_1_1;
+		}
+		else {
+			FlashMsg->Dummy = XLOADER_OSPI_SDR_DUMMY_CYCLES +
+				OspiPsvInstance.Extra_DummyCycle;
+			FlashMsg->Proto = XOSPIPSV_READ_1_1_8;
+		}
+	}
+
+	if (OspiPsvInstance.DualByteOpcodeEn != 0U) {
+		FlashMsg->ExtendedOpcode = (u8)(~FlashMsg->Opcode);
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function raises the OSPI clock in DDR PHY mode to the
+ * highest frequency at which the RX DLL tunes and the start of the flash,
+ * where the boot header is, reads back as it did at the prescaler used for
+ * the DDR switch. If no higher frequency passes, the controller is tuned
+ * again at that prescaler, so that a failed tuning does not leave a
+ * marginal delay behind.
+ *
+ * @param	OspiPsvPtr is a pointer to the OSPIPSV instance
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XLoader_OspiSetMaxFreq(XOspiPsv *OspiPsvPtr)
+{
+	int Status = XST_FAILURE;
+	u8 RefData[XLOADER_OSPI_TUNE_VERIFY_LEN] __attribute__ ((aligned(32U)));
+	u8 ReadData[XLOADER_OSPI_TUNE_VERIFY_LEN] __attribute__ ((aligned(32U)));
+	const u8 Prescaler[] = {XOSPIPSV_CLK_PRESCALE_2,
+		XOSPIPSV_CLK_PRESCALE_4};
+	XOspiPsv_Msg FlashMsg = {0U};
+	u32 Index;
+
+	XLoader_OspiSetReadMsg(&FlashMsg, XLOADER_OSPI_TUNE_VERIFY_ADDR,
+		(u64)(UINTPTR)RefData, XLOADER_OSPI_TUNE_VERIFY_LEN);
+	Status = (int)XOspiPsv_PollTransfer(OspiPsvPtr, &FlashMsg);
+	if (Status != XST_SUCCESS) {
+		Status = XPlmi_UpdateStatus(XLOADER_ERR_OSPI_READ, Status);
+		goto END;
+	}
+
+	for (Index = 0U; Index < (sizeof(Prescaler) / sizeof(Prescaler[0U]));
+		++Index) {
+		/* Changing the prescaler tunes the RX DLL again */
+		Status = (int)XOspiPsv_SetClkPrescaler(OspiPsvPtr,
+			Prescaler[Index]);
+		if (Status != XST_SUCCESS) {
+			continue;
+		}
+
+		XLoader_OspiSetReadMsg(&FlashMsg, XLOADER_OSPI_TUNE_VERIFY_ADDR,
+			(u64)(UINTPTR)ReadData, XLOADER_OSPI_TUNE_VERIFY_LEN);
+		Status = (int)XOspiPsv_PollTransfer(OspiPsvPtr, &FlashMsg);
+		if (Status != XST_SUCCESS) {
+			continue;
+		}
+
+		Status = Xil_SMemCmp(RefData, sizeof(RefData), ReadData,
+			sizeof(ReadData), XLOADER_OSPI_TUNE_VERIFY_LEN);
+		if (Status == XST_SUCCESS) {
+			XLoader_Printf(DEBUG_INFO, "OSPI DDR PHY prescaler %u\n\r",
+				(u32)Prescaler[Index]);
+			goto END;
+		}
+	}
+
+	XLoader_Printf(DEBUG_GENERAL, "OSPI tuning failed at higher "
+		"frequencies\n\r");
+	Status = (int)XOspiPsv_SetClkPrescaler(OspiPsvPtr,
+		XOSPIPSV_CLK_PRESCALE_6);
+
+END:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function is used to copy the data from OSPI flash to
@@ -429,9 +567,6 @@ int XLoader_OspiCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
 	u32 TrfLen;
 	u32 FlagsTmp;
 	u8 OspiMode = OspiPsvInstance.Config.ConnectionMode;
-	u8 ReadCmd = READ_CMD_OCTAL_4B;
-	u8 Proto;
-	u8 Dummy;
 	static u8 ChipSelect = XOSPIPSV_SELECT_FLASH_CS0;
 #ifdef PLM_PRINT_PERF_DMA
 	u64 OspiCopyTime = XPlmi_GetTimerValue();
@@ -509,53 +644,7 @@ int XLoader_OspiCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
 	/*
 	 * Read cmd
 	 */
-	FlashMsg.Addrsize = XLOADER_OSPI_READ_ADDR_SIZE;
-	FlashMsg.Addrvalid = TRUE;
-	FlashMsg.TxBfrPtr = NULL;
-	FlashMsg.ByteCount = TrfLen;
-	FlashMsg.Flags = XOSPIPSV_MSG_FLAG_RX;
-	FlashMsg.Addr = SrcAddrLow;
-
-	if ((DestAddr >> 32U) == 0U) {
-		FlashMsg.RxBfrPtr = (u8*)(UINTPTR)DestAddr;
-	}
-	else {
-		FlashMsg.RxBfrPtr = NULL;
-		FlashMsg.RxAddr64bit = DestAddr;
-		FlashMsg.Xfer64bit = 1U;
-	}
-
-	if (OspiPsvInstance.SdrDdrMode == XOSPIPSV_EDGE_MODE_DDR_PHY) {
-		Proto = XOSPIPSV_READ_8_8_8;
-		if (OspiFlashMake == MACRONIX_OCTAL_ID_BYTE0) {
-			Dummy = XLOADER_MACRONIX_OSPI_DDR_DUMMY_CYCLES +
-				OspiPsvInstance.Extra_DummyCycle;
-			ReadCmd = READ_CMD_OPI_MX;
-		}
-		else {
-			Dummy = XLOADER_OSPI_DDR_DUMMY_CYCLES +
-				OspiPsvInstance.Extra_DummyCycle;
-		}
-	}
-	else {
-		if (OspiFlashMake == MACRONIX_OCTAL_ID_BYTE0) {
-			Dummy = OspiPsvInstance.Extra_DummyCycle;
-			ReadCmd = READ_CMD_4B;
-			Proto = XOSPIPSV_READ_1_1_1;
-		}
-		else {
-			Dummy = XLOADER_OSPI_SDR_DUMMY_CYCLES +
-				OspiPsvInstance.Extra_DummyCycle;
-			Proto = XOSPIPSV_READ_1_1_8;
-		}
-	}
-
-	FlashMsg.Opcode = ReadCmd;
-	FlashMsg.Proto = Proto;
-	FlashMsg.Dummy = Dummy;
-	if (OspiPsvInstance.DualByteOpcodeEn != 0U) {
-		FlashMsg.ExtendedOpcode = (u8)(~FlashMsg.Opcode);
-	}
+	XLoader_OspiSetReadMsg(&FlashMsg, SrcAddrLow, DestAddr, TrfLen);
 
 	if (Flags == XPLMI_DEVICE_COPY_STATE_INITIATE) {
 		Status = (int)XOspiPsv_StartDmaTransfer(&OspiPsvInstance, &FlashMsg);
@@ -592,27 +681,8 @@ int XLoader_OspiCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
 			/*
 			 * Read cmd
 			 */
-			FlashMsg.Opcode = ReadCmd;
-			if (OspiPsvInstance.DualByteOpcodeEn != 0U) {
-				FlashMsg.ExtendedOpcode = (u8)(~FlashMsg.Opcode);
-			}
-			FlashMsg.Addrsize = XLOADER_OSPI_READ_ADDR_SIZE;
-			FlashMsg.Addrvalid = TRUE;
-			FlashMsg.TxBfrPtr = NULL;
-			FlashMsg.ByteCount = TrfLen;
-			FlashMsg.Flags = XOSPIPSV_MSG_FLAG_RX;
-			FlashMsg.Addr = SrcAddrLow;
-			FlashMsg.Proto = Proto;
-			FlashMsg.Dummy = Dummy;
-
-			if ((DestAddr >> 32U) == 0U) {
-				FlashMsg.RxBfrPtr = (u8*)(UINTPTR)DestAddr;
-			}
-			else {
-				FlashMsg.RxBfrPtr = NULL;
-				FlashMsg.RxAddr64bit = DestAddr;
-				FlashMsg.Xfer64bit = 1U;
-			}
+			XLoader_OspiSetReadMsg(&FlashMsg, SrcAddrLow, DestAddr,
+				TrfLen);
 
 			/* Check to call blocking or non-blocking DMA */
 			if (FlagsTmp == XPLMI_DEVICE_COPY_STATE_INITIATE) {
@@ -29,6 +29,7 @@
 *       bsv  10/13/2020 Code clean up
 * 1.03  bsv  07/16/2021 Added Macronix flash support
 *       bsv  08/31/2021 Code clean up
+* 1.04  ag   10/15/2026 Added macros for tuned DDR PHY frequency selection
 *
 * </pre>
 *
@@ -104,6 +105,8 @@ extern "C" {
 #define XLOADER_WRITE_CFG_REG_VAL		(0xE7U)
 #define XLOADER_MACRONIX_WRITE_CFG_REG_VAL		(0x02U)
 #define XLOADER_OSPI_WRITE_DONE_MASK	(0x80U)
+#define XLOADER_OSPI_TUNE_VERIFY_ADDR	(0x0U)
+#define XLOADER_OSPI_TUNE_VERIFY_LEN	(64U)
 
 /************************** Function Prototypes ******************************/
 int XLoader_OspiInit(u32 DeviceFlags);
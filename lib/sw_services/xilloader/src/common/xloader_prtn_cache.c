@@ -0,0 +1,526 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xloader_prtn_cache.c
+*
+* This file contains the partition cache used by XLoader_RestartImage.
+* When a DDR region is configured for an image, every non CDO partition of
+* that image is copied to the region after it is loaded, authenticated and
+* decrypted. The SHA3 hash of the partition is kept in PMC RAM. When the image
+* is restarted, the partition is copied back from the region and its hash is
+* verified at the destination, which avoids reading the partition from the
+* boot device and reprocessing it securely.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  ag   10/14/2026 First release
+*       ag   10/15/2026 Bind entries to the partition in the source PDI and
+*                       invalidate them when the image store changes
+*
+* </pre>
+*
+* @note
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xloader_prtn_cache.h"
+#include "xloader_ddr.h"
+#include "xplmi_dma.h"
+#include "xplmi_debug.h"
+#include "xplmi_plat.h"
+#include "xsecure_sha.h"
+#include "xil_util.h"
+#include "xsecure_init.h"
+#include "xloader_plat.h"
+
+/************************** Constant Definitions *****************************/
+#define XLOADER_PRTN_CACHE_MAX_IMGS	(4U) /**< Images that can be cached */
+#define XLOADER_PRTN_CACHE_MAX_PRTNS	(4U) /**< Partitions per image */
+#define XLOADER_PRTN_CACHE_ALIGN_MASK	(0xFU) /**< 16 byte alignment */
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	u32 PrtnId; /**< Partition ID */
+	u32 Len; /**< Length of cached data in bytes */
+	u32 AllocLen; /**< Length reserved in the cache region */
+	u32 PrtnHdrChecksum; /**< Checksum of the partition header */
+	u64 CacheAddr; /**< Address of cached data */
+	u64 PdiAddr; /**< Address of the PDI the partition is loaded from */
+	XSecure_Sha3Hash Hash; /**< SHA3 hash of the loaded partition */
+	XSecure_Sha3Hash SrcHash; /**< SHA3 hash of the partition in the PDI */
+	u8 IsValid; /**< TRUE if the entry holds valid data */
+} XLoader_PrtnCacheEntry;
+
+typedef struct {
+	u32 ImgId; /**< Image ID */
+	u32 Size; /**< Size of cache region in bytes, 0 if unused */
+	u64 BaseAddr; /**< Start address of cache region */
+	u32 UsedLen; /**< Bytes allocated in the cache region */
+	XLoader_PrtnCacheEntry Prtn[XLOADER_PRTN_CACHE_MAX_PRTNS];
+} XLoader_ImgCache;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+static XLoader_ImgCache* XLoader_GetImgCache(u32 ImgId);
+static int XLoader_PrtnCacheHash(u64 Addr, u32 Len, XSecure_Sha3Hash *Hash);
+static int XLoader_PrtnCacheSrcHash(const XilPdi* PdiPtr,
+	XSecure_Sha3Hash *Hash);
+
+/************************** Variable Definitions *****************************/
+static XLoader_ImgCache ImgCache[XLOADER_PRTN_CACHE_MAX_IMGS];
+static XLoader_PrtnCacheEntry *ActiveEntry = NULL;
+static u8 IsRestart = (u8)FALSE;
+
+/*****************************************************************************/
+/**
+ * @brief	This function returns the cache of the given image.
+ *
+ * @param	ImgId is the image ID
+ *
+ * @return	Pointer to image cache if configured, NULL otherwise
+ *
+ *****************************************************************************/
+static XLoader_ImgCache* XLoader_GetImgCache(u32 ImgId)
+{
+	XLoader_ImgCache *Cache = NULL;
+	u32 Index;
+
+	for (Index = 0U; Index < XLOADER_PRTN_CACHE_MAX_IMGS; ++Index) {
+		if ((ImgCache[Index].Size != 0U) &&
+			(ImgCache[Index].ImgId == ImgId)) {
+			Cache = &ImgCache[Index];
+			break;
+		}
+	}
+
+	return Cache;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function calculates SHA3 hash of the given memory.
+ *
+ * @param	Addr is the start address of the data
+ * @param	Len is the length of data in bytes
+ * @param	Hash is pointer to store the hash
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XLoader_PrtnCacheHash(u64 Addr, u32 Len, XSecure_Sha3Hash *Hash)
+{
+	int Status = XST_FAILURE;
+	XSecure_Sha3 *Sha3InstPtr = XSecure_GetSha3Instance();
+	XPmcDma *PmcDmaInstPtr = XPlmi_GetDmaInstance((u32)PMCDMA_0_DEVICE_ID);
+
+	if (PmcDmaInstPtr == NULL) {
+		goto END;
+	}
+
+	Status = XSecure_Sha3Initialize(Sha3InstPtr, PmcDmaInstPtr);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	Status = XSecure_Sha3Start(Sha3InstPtr);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	Status = XSecure_Sha3Update64Bit(Sha3InstPtr, Addr, Len);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	Status = XSecure_Sha3Finish(Sha3InstPtr, Hash);
+
+END:
+	if (Status != XST_SUCCESS) {
+		Status = XPlmi_UpdateStatus(XLOADER_ERR_PRTN_CACHE_HASH_CALC,
+			Status);
+	}
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function calculates SHA3 hash of the partition being loaded,
+ * as stored in the PDI including its authentication certificate. The PDI
+ * must be in DDR.
+ *
+ * @param	PdiPtr is pointer to XilPdi instance
+ * @param	Hash is pointer to store the hash
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XLoader_PrtnCacheSrcHash(const XilPdi* PdiPtr,
+	XSecure_Sha3Hash *Hash)
+{
+	const XilPdi_PrtnHdr *PrtnHdr = &(PdiPtr->MetaHdr.PrtnHdr[PdiPtr->PrtnNum]);
+	u64 SrcAddr = PdiPtr->MetaHdr.FlashOfstAddr +
+		((u64)PrtnHdr->DataWordOfst << XPLMI_WORD_LEN_SHIFT);
+
+	return XLoader_PrtnCacheHash(SrcAddr,
+		PrtnHdr->TotalDataWordLen << XPLMI_WORD_LEN_SHIFT, Hash);
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function configures or removes the partition cache region
+ * of an image. Partitions of the image are cached the next time the image is
+ * loaded.
+ *
+ * @param	ImgId is the image ID
+ * @param	Addr is the start address of the cache region in DDR
+ * @param	Size is the size of the cache region in bytes, 0 to remove
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+int XLoader_PrtnCacheConfig(u32 ImgId, u64 Addr, u32 Size)
+{
+	int Status = XST_FAILURE;
+	XLoader_ImgCache *Cache = XLoader_GetImgCache(ImgId);
+	u32 Index;
+
+	if (Size == 0U) {
+		if (Cache != NULL) {
+			Status = XPlmi_MemSetBytes(Cache, sizeof(XLoader_ImgCache),
+				0U, sizeof(XLoader_ImgCache));
+		}
+		else {
+			Status = XST_SUCCESS;
+		}
+		goto END;
+	}
+
+	if (((Addr & XLOADER_PRTN_CACHE_ALIGN_MASK) != 0U) ||
+		(XPlmi_VerifyAddrRange(Addr, Addr + Size - 1U) != XST_SUCCESS)) {
+		Status = XPlmi_UpdateStatus(XLOADER_ERR_PRTN_CACHE_INVALID_ADDR, 0);
+		goto END;
+	}
+
+	if (Cache == NULL) {
+		for (Index = 0U; Index < XLOADER_PRTN_CACHE_MAX_IMGS; ++Index) {
+			if (ImgCache[Index].Size == 0U) {
+				Cache = &ImgCache[Index];
+				break;
+			}
+		}
+	}
+	if (Cache == NULL) {
+		Status = XPlmi_UpdateStatus(XLOADER_ERR_PRTN_CACHE_FULL, 0);
+		goto END;
+	}
+
+	Status = XLoader_DdrInit(XLOADER_PDI_SRC_DDR);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	Status = XPlmi_MemSetBytes(Cache, sizeof(XLoader_ImgCache), 0U,
+		sizeof(XLoader_ImgCache));
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	Cache->ImgId = ImgId;
+	Cache->BaseAddr = Addr;
+	Cache->Size = Size;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function enables or disables restoring of partitions from the
+ * cache. Cached partitions are only used when an image is restarted, a fresh
+ * load of the image always reads the partitions from the PDI and refreshes
+ * the cache.
+ *
+ * @param	Enable is TRUE while an image is being restarted
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XLoader_PrtnCacheSetRestart(u8 Enable)
+{
+	IsRestart = Enable;
+	ActiveEntry = NULL;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function invalidates the cached partitions of all images.
+ * It is called when the image store changes, so that a restart never restores
+ * a partition of a PDI that was replaced. The cache regions stay configured.
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XLoader_PrtnCacheInvalidate(void)
+{
+	u32 Index;
+	u32 PrtnIndex;
+
+	for (Index = 0U; Index < XLOADER_PRTN_CACHE_MAX_IMGS; ++Index) {
+		for (PrtnIndex = 0U; PrtnIndex < XLOADER_PRTN_CACHE_MAX_PRTNS;
+			++PrtnIndex) {
+			ImgCache[Index].Prtn[PrtnIndex].IsValid = (u8)FALSE;
+		}
+	}
+	ActiveEntry = NULL;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function checks if the partition being loaded can be restored
+ * from the cache. An entry is used only if it was cached from the same
+ * partition of the same PDI: the PDI address and the partition header checksum
+ * must match, and the partition in the PDI must hash to the value recorded
+ * when it was authenticated and cached. If so, the secure parameters are
+ * initialized for a non secure copy and the cache entry is marked active for
+ * XLoader_PrtnCopy.
+ *
+ * @param	PdiPtr is pointer to XilPdi instance
+ * @param	SecureParams is pointer to the secure parameters of the partition
+ *
+ * @return	TRUE if the partition is restored from cache, FALSE otherwise
+ *
+ *****************************************************************************/
+u8 XLoader_PrtnCacheSetup(XilPdi* PdiPtr, XLoader_SecureParams* SecureParams)
+{
+	u8 IsCached = (u8)FALSE;
+	XilPdi_PrtnHdr *PrtnHdr = &(PdiPtr->MetaHdr.PrtnHdr[PdiPtr->PrtnNum]);
+	XLoader_ImgCache *Cache;
+	XLoader_SecureTempParams *SecureTempParams = XLoader_GetTempParams();
+	u32 Index;
+
+	XSecure_Sha3Hash SrcHash;
+
+	ActiveEntry = NULL;
+	if ((IsRestart == (u8)FALSE) ||
+		(PdiPtr->PdiSrc != XLOADER_PDI_SRC_DDR) ||
+		(PdiPtr->PdiType == XLOADER_PDI_TYPE_RESTORE) ||
+		(XilPdi_GetPrtnType(PrtnHdr) == XIH_PH_ATTRB_PRTN_TYPE_CDO)) {
+		goto END;
+	}
+
+	Cache = XLoader_GetImgCache(PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].ImgID);
+	if (Cache == NULL) {
+		goto END;
+	}
+
+	for (Index = 0U; Index < XLOADER_PRTN_CACHE_MAX_PRTNS; ++Index) {
+		if ((Cache->Prtn[Index].IsValid == (u8)TRUE) &&
+			(Cache->Prtn[Index].PrtnId == PrtnHdr->PrtnId) &&
+			(Cache->Prtn[Index].PdiAddr ==
+			PdiPtr->MetaHdr.FlashOfstAddr) &&
+			(Cache->Prtn[Index].PrtnHdrChecksum == PrtnHdr->Checksum) &&
+			(Cache->Prtn[Index].Len ==
+			(PrtnHdr->UnEncDataWordLen << XPLMI_WORD_LEN_SHIFT))) {
+			break;
+		}
+	}
+	if (Index == XLOADER_PRTN_CACHE_MAX_PRTNS) {
+		goto END;
+	}
+
+	/* The partition is loaded from the PDI if it changed since cached */
+	if (XLoader_PrtnCacheSrcHash(PdiPtr, &SrcHash) != XST_SUCCESS) {
+		goto END;
+	}
+	if (Xil_SMemCmp(SrcHash.Hash, sizeof(SrcHash.Hash),
+		Cache->Prtn[Index].SrcHash.Hash,
+		sizeof(Cache->Prtn[Index].SrcHash.Hash),
+		sizeof(SrcHash.Hash)) != XST_SUCCESS) {
+		XPlmi_Printf(DEBUG_INFO, "Partition 0x%0x changed in PDI\n\r",
+			PrtnHdr->PrtnId);
+		Cache->Prtn[Index].IsValid = (u8)FALSE;
+		goto END;
+	}
+
+	if ((XPlmi_MemSetBytes(SecureParams, sizeof(XLoader_SecureParams), 0U,
+		sizeof(XLoader_SecureParams)) != XST_SUCCESS) ||
+		(XPlmi_MemSetBytes(SecureTempParams, sizeof(XLoader_SecureTempParams),
+		0U, sizeof(XLoader_SecureTempParams)) != XST_SUCCESS)) {
+		goto END;
+	}
+	SecureParams->PdiPtr = PdiPtr;
+	SecureParams->PrtnHdr = PrtnHdr;
+	SecureParams->ChunkAddr = XPLMI_PMCRAM_CHUNK_MEMORY;
+
+	XPlmi_Printf(DEBUG_INFO, "Restoring partition 0x%0x from cache\n\r",
+		PrtnHdr->PrtnId);
+	ActiveEntry = &Cache->Prtn[Index];
+	IsCached = (u8)TRUE;
+
+END:
+	return IsCached;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function returns if the partition being copied is restored
+ * from the cache.
+ *
+ * @return	TRUE if a cache entry is active, FALSE otherwise
+ *
+ *****************************************************************************/
+u8 XLoader_PrtnCacheIsActive(void)
+{
+	u8 IsActive = (u8)FALSE;
+
+	if (ActiveEntry != NULL) {
+		IsActive = (u8)TRUE;
+	}
+
+	return IsActive;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function copies the active cache entry to the destination and
+ * verifies its hash at the destination. On mismatch the destination is
+ * cleared and the entry is invalidated, so that the next restart loads the
+ * partition from the PDI.
+ *
+ * @param	DestAddr is the load address of the partition
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+int XLoader_PrtnCacheRestore(u64 DestAddr)
+{
+	int Status = XST_FAILURE;
+	XLoader_PrtnCacheEntry *Entry = ActiveEntry;
+	XSecure_Sha3Hash Hash;
+
+	ActiveEntry = NULL;
+	if (Entry == NULL) {
+		goto END;
+	}
+
+	Status = XPlmi_DmaXfr(Entry->CacheAddr, DestAddr,
+		Entry->Len >> XPLMI_WORD_LEN_SHIFT, XPLMI_PMCDMA_0);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	Status = XLoader_PrtnCacheHash(DestAddr, Entry->Len, &Hash);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	Status = Xil_SMemCmp(Hash.Hash, sizeof(Hash.Hash), Entry->Hash.Hash,
+		sizeof(Entry->Hash.Hash), sizeof(Hash.Hash));
+	if (Status != XST_SUCCESS) {
+		XPlmi_Printf(DEBUG_GENERAL, "Partition cache hash mismatch\n\r");
+		Entry->IsValid = (u8)FALSE;
+		(void)XPlmi_MemSet(DestAddr, XPLMI_DATA_INIT_PZM,
+			Entry->Len >> XPLMI_WORD_LEN_SHIFT);
+		Status = XPlmi_UpdateStatus(XLOADER_ERR_PRTN_CACHE_HASH_MISMATCH, 0);
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function stores the partition that is just loaded to the
+ * cache region of its image, if one is configured. Partitions that do not fit
+ * in the region, and partitions of PDIs that are not in DDR, are not cached.
+ * The entry records the PDI address, the partition header checksum and the
+ * hash of the partition in the PDI, which identify it on restore.
+ *
+ * @param	PdiPtr is pointer to XilPdi instance
+ * @param	DestAddr is the load address of the partition
+ *
+ * @return	XST_SUCCESS if the partition is cached or caching is not
+ *		configured, error code otherwise
+ *
+ *****************************************************************************/
+int XLoader_PrtnCacheStore(const XilPdi* PdiPtr, u64 DestAddr)
+{
+	int Status = XST_FAILURE;
+	const XilPdi_PrtnHdr *PrtnHdr = &(PdiPtr->MetaHdr.PrtnHdr[PdiPtr->PrtnNum]);
+	u32 Len = PrtnHdr->UnEncDataWordLen << XPLMI_WORD_LEN_SHIFT;
+	u32 AllocLen = (Len + XLOADER_PRTN_CACHE_ALIGN_MASK) &
+		(~XLOADER_PRTN_CACHE_ALIGN_MASK);
+	XLoader_ImgCache *Cache;
+	XLoader_PrtnCacheEntry *Entry = NULL;
+	u32 Index;
+
+	Cache = XLoader_GetImgCache(PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].ImgID);
+	if ((Cache == NULL) || (Len == 0U) ||
+		(PdiPtr->PdiSrc != XLOADER_PDI_SRC_DDR) ||
+		(PdiPtr->PdiType == XLOADER_PDI_TYPE_RESTORE)) {
+		Status = XST_SUCCESS;
+		goto END;
+	}
+
+	/* Reuse the slot of this partition if the new data fits in it */
+	for (Index = 0U; Index < XLOADER_PRTN_CACHE_MAX_PRTNS; ++Index) {
+		if ((Cache->Prtn[Index].AllocLen != 0U) &&
+			(Cache->Prtn[Index].PrtnId == PrtnHdr->PrtnId)) {
+			Entry = &Cache->Prtn[Index];
+			Entry->IsValid = (u8)FALSE;
+			if (Entry->AllocLen < AllocLen) {
+				Entry = NULL;
+			}
+			break;
+		}
+	}
+	if (Entry == NULL) {
+		for (Index = 0U; Index < XLOADER_PRTN_CACHE_MAX_PRTNS; ++Index) {
+			if (Cache->Prtn[Index].AllocLen == 0U) {
+				break;
+			}
+		}
+		if ((Index == XLOADER_PRTN_CACHE_MAX_PRTNS) ||
+			(AllocLen > (Cache->Size - Cache->UsedLen))) {
+			Status = XPlmi_UpdateStatus(XLOADER_ERR_PRTN_CACHE_FULL, 0);
+			goto END;
+		}
+		Entry = &Cache->Prtn[Index];
+		Entry->PrtnId = PrtnHdr->PrtnId;
+		Entry->AllocLen = AllocLen;
+		Entry->CacheAddr = Cache->BaseAddr + Cache->UsedLen;
+		Cache->UsedLen += AllocLen;
+	}
+
+	Status = XLoader_PrtnCacheSrcHash(PdiPtr, &Entry->SrcHash);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	Status = XLoader_PrtnCacheHash(DestAddr, Len, &Entry->Hash);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	Status = XPlmi_DmaXfr(DestAddr, Entry->CacheAddr,
+		Len >> XPLMI_WORD_LEN_SHIFT, XPLMI_PMCDMA_0);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	Entry->Len = Len;
+	Entry->PdiAddr = PdiPtr->MetaHdr.FlashOfstAddr;
+	Entry->PrtnHdrChecksum = PrtnHdr->Checksum;
+	Entry->IsValid = (u8)TRUE;
+
+END:
+	return Status;
+}
@@ -0,0 +1,60 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xloader_prtn_cache.h
+*
+* This is the header file which contains declarations of the partition cache
+* used to restart images without reprocessing secure partitions.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  ag   10/14/2026 First release
+*       ag   10/15/2026 Added XLoader_PrtnCacheInvalidate
+*
+* </pre>
+*
+* @note
+*
+******************************************************************************/
+
+#ifndef XLOADER_PRTN_CACHE_H
+#define XLOADER_PRTN_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xloader.h"
+#include "xloader_secure.h"
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+int XLoader_PrtnCacheConfig(u32 ImgId, u64 Addr, u32 Size);
+void XLoader_PrtnCacheSetRestart(u8 Enable);
+void XLoader_PrtnCacheInvalidate(void);
+u8 XLoader_PrtnCacheSetup(XilPdi* PdiPtr, XLoader_SecureParams* SecureParams);
+u8 XLoader_PrtnCacheIsActive(void);
+int XLoader_PrtnCacheRestore(u64 DestAddr);
+int XLoader_PrtnCacheStore(const XilPdi* PdiPtr, u64 DestAddr);
+
+/************************** Variable Definitions *****************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* XLOADER_PRTN_CACHE_H */
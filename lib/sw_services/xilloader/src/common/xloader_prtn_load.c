@@ -90,6 +90,17 @@
 *       bm   07/06/2022 Refactor versal and versal_net code
 *       dc   07/19/2022 Added support for data measurement in VersalNet
 *       bm   07/24/2022 Set PlmLiveStatus during boot time
+*       ag   10/14/2026 Overlap copy of second chunk with first chunk
+*                       execution for secure CDO partitions
+*       ag   10/14/2026 Record partition load time break up in trace log
+*       ag   10/14/2026 Store and restore non CDO partitions in partition cache
+*       ag   10/14/2026 Added support for compressed partitions
+*       ag   10/15/2026 Stream delay load partitions out of SBI with a
+*                       single fixed destination DMA
+*       ag   10/15/2026 Wait for background ECC initialization of the
+*                       partition destination before copying
+*       ag   10/15/2026 Send slave SLR data of CDO partitions in the
+*                       background while the next commands are processed
 *
 * </pre>
 *
@@ -115,21 +126,35 @@
 #include "xplmi_plat.h"
 #include "xloader_plat.h"
 #include "xplmi_wdt.h"
+#include "xloader_prtn_cache.h"
+#include "xloader_decomp.h"
 
 /************************** Constant Definitions *****************************/
 
 /**************************** Type Definitions *******************************/
+/* Partition load time break up in PIT ticks */
+typedef struct {
+	u64 CopyTime; /**< Time spent waiting for device copy */
+	u64 SecureTime; /**< Time spent in authentication and decryption */
+	u64 ExecTime; /**< Time spent in CDO processing */
+} XLoader_PrtnPerf;
 
 /***************** Macros (Inline Functions) Definitions *********************/
 #define XLOADER_SUCCESS_NOT_PRTN_OWNER	(0x100U) /**< Indicates that PLM is not the partition owner */
+#define XLOADER_US_PER_SEC		(1000000U) /**< Microseconds in a second */
+#define XLOADER_SBI_DRAIN_MAX_LEN	(0x10000000U) /**< Max length in bytes
+						* drained from SBI in one DMA */
 
 /************************** Function Prototypes ******************************/
 static int XLoader_PrtnHdrValidation(const XilPdi_PrtnHdr* PrtnHdr, u32 PrtnNum);
 static int XLoader_ProcessPrtn(XilPdi* PdiPtr);
+static void XLoader_AddPerfTime(u64 *PerfTime, u64 StartTime);
+static void XLoader_TracePrtnPerf(const XilPdi* PdiPtr, u64 PrtnLoadTime);
 static int XLoader_ProcessCdo (const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCopy,
 	XLoader_SecureParams* SecureParams);
 
 /************************** Variable Definitions *****************************/
+static XLoader_PrtnPerf PrtnPerf; /**< Load time break up of current partition */
 
 /*****************************************************************************/
 /**
@@ -202,6 +227,9 @@ int XLoader_LoadImagePrtns(XilPdi* PdiPtr)
 			}
 		}
 
+		PrtnPerf.CopyTime = 0U;
+		PrtnPerf.SecureTime = 0U;
+		PrtnPerf.ExecTime = 0U;
 		PrtnLoadTime = XPlmi_GetTimerValue();
 		/* Prtn Hdr Validation */
 		Status = XLoader_PrtnHdrValidation(
@@ -228,6 +256,7 @@ int XLoader_LoadImagePrtns(XilPdi* PdiPtr)
 			(u32)PerfTime.TPerfMs, (u32)PerfTime.TPerfMsFrac, PdiPtr->PrtnNum,
 			(PdiPtr->MetaHdr.PrtnHdr[PdiPtr->PrtnNum].TotalDataWordLen) *
 			XPLMI_WORD_LEN);
+		XLoader_TracePrtnPerf(PdiPtr, PrtnLoadTime);
 
 		++PdiPtr->PrtnNum;
 		if (XPlmi_NpiOutOfReset() == (u8)TRUE) {
@@ -319,12 +348,51 @@ int XLoader_PrtnCopy(const XilPdi* PdiPtr, const XLoader_DeviceCopy* DeviceCopy,
 	XLoader_SecureParams *SecureParams = (XLoader_SecureParams *)SecureParamsPtr;
 	u32 PrtnNum = PdiPtr->PrtnNum;
 	const XilPdi_PrtnHdr * PrtnHdr = &(PdiPtr->MetaHdr.PrtnHdr[PrtnNum]);
+	u64 StartTime = XPlmi_GetTimerValue();
+	u8 IsCached = XLoader_PrtnCacheIsActive();
+	u8 IsCompressed = XilPdi_IsPrtnCompressed(PrtnHdr);
+	u32 Len = PrtnHdr->UnEncDataWordLen << XPLMI_WORD_LEN_SHIFT;
 
-	if ((SecureParams->SecureEn == (u8)FALSE) &&
+	/*
+	 * The partition is written by the flash drivers and the CPU as well,
+	 * so wait for the ECC initialization of its destination. The length
+	 * of a compressed partition is known only after decompression.
+	 */
+	if (IsCompressed == (u8)TRUE) {
+		Status = XPlmi_EccInitWaitAll();
+	}
+	else if (Len > DeviceCopy->Len) {
+		Status = XPlmi_EccInitWait(DeviceCopy->DestAddr, Len);
+	}
+	else {
+		Status = XPlmi_EccInitWait(DeviceCopy->DestAddr, DeviceCopy->Len);
+	}
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	Status = XST_FAILURE;
+
+	if (IsCached == (u8)TRUE) {
+		Status = XLoader_PrtnCacheRestore(DeviceCopy->DestAddr);
+		XLoader_AddPerfTime(&PrtnPerf.CopyTime, StartTime);
+	}
+	else if (IsCompressed == (u8)TRUE) {
+		if ((SecureParams->SecureEn == (u8)TRUE) ||
+			(SecureTempParams->SecureEn == (u8)TRUE) ||
+			(SecureParams->IsCheckSumEnabled == (u8)TRUE)) {
+			Status = XPlmi_UpdateStatus(XLOADER_ERR_DECOMP_UNSUPPORTED, 0);
+		}
+		else {
+			Status = XLoader_DecompPrtnCopy(PdiPtr, DeviceCopy, &Len);
+		}
+		XLoader_AddPerfTime(&PrtnPerf.CopyTime, StartTime);
+	}
+	else if ((SecureParams->SecureEn == (u8)FALSE) &&
 			(SecureTempParams->SecureEn == (u8)FALSE) &&
 			(SecureParams->IsCheckSumEnabled == (u8)FALSE)) {
 		Status = PdiPtr->MetaHdr.DeviceCopy(DeviceCopy->SrcAddr,
 			DeviceCopy->DestAddr,DeviceCopy->Len, DeviceCopy->Flags);
+		XLoader_AddPerfTime(&PrtnPerf.CopyTime, StartTime);
 	}
 	else {
 		XSECURE_TEMPORAL_IMPL(Status, StatusTmp, XLoader_SecureCopy,
@@ -333,17 +401,28 @@ int XLoader_PrtnCopy(const XilPdi* PdiPtr, const XLoader_DeviceCopy* DeviceCopy,
 		if ((XST_SUCCESS != Status) || (XST_SUCCESS != StatusTmp)) {
 			Status |= StatusTmp;
 		}
+		XLoader_AddPerfTime(&PrtnPerf.SecureTime, StartTime);
 	}
 	if (Status != XST_SUCCESS) {
 		XPlmi_Printf(DEBUG_GENERAL, "Device Copy Failed\n\r");
 	}
 	else {
 		/* Update the data for measurement, only VersalNet */
-		Status = XLoader_DataMeasurement(DeviceCopy->DestAddr,
-			PrtnHdr->UnEncDataWordLen << XPLMI_WORD_LEN_SHIFT,
+		Status = XLoader_DataMeasurement(DeviceCopy->DestAddr, Len,
 			0U, XLOADER_MEASURE_UPDATE);
 	}
+	/* Cache entries hold the uncompressed partition length */
+	if ((Status == XST_SUCCESS) && (IsCached == (u8)FALSE) &&
+		(IsCompressed == (u8)FALSE)) {
+		/* Failure to cache the partition does not fail the load */
+		if (XLoader_PrtnCacheStore(PdiPtr, DeviceCopy->DestAddr) !=
+			XST_SUCCESS) {
+			XPlmi_Printf(DEBUG_GENERAL, "Partition 0x%0x not cached\n\r",
+				PrtnHdr->PrtnId);
+		}
+	}
 
+END:
 	return Status;
 }
 
@@ -365,6 +444,7 @@ static int XLoader_ProcessCdo(const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCo
 		XLoader_SecureParams* SecureParams)
 {
 	int Status = XST_FAILURE;
+	int SStatus = XST_FAILURE;
 	u32 ChunkLen = XLOADER_SECURE_CHUNK_SIZE;
 	u32 ChunkLenTemp;
 	XPlmiCdo Cdo;
@@ -373,6 +453,7 @@ static int XLoader_ProcessCdo(const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCo
 	u8 LastChunk = (u8)FALSE;
 	u8 Flags;
 	XLoader_SecureTempParams *SecureTempParams = XLoader_GetTempParams();
+	u64 StartTime;
 #ifdef PLM_PRINT_PERF_CDO_PROCESS
 	u64 CdoProcessTimeStart;
 	u64 CdoProcessTimeEnd;
@@ -393,6 +474,12 @@ static int XLoader_ProcessCdo(const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCo
 	Cdo.NextChunkAddr = XPLMI_PMCRAM_CHUNK_MEMORY;
 	Cdo.SubsystemId = XPm_GetSubsystemId(
 		PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].ImgID);
+	/*
+	 * Key hole transfers to the slave SLRs out of the chunk memory are
+	 * left running on PMCDMA1. They are completed before a chunk is copied
+	 * again, by the SSIT sync commands and at the end of the partition.
+	 */
+	Cdo.Cmd.KeyHoleParams.IsSlrXfrNonBlk = (u8)TRUE;
 	SecureParams->IsCdo = (u8)TRUE;
 	if ((SecureParams->SecureEn == (u8)FALSE) &&
 		(SecureTempParams->SecureEn == (u8)FALSE) &&
@@ -421,9 +508,15 @@ static int XLoader_ProcessCdo(const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCo
 			}
 			else {
 				Flags = XPLMI_DEVICE_COPY_STATE_BLK;
+				Status = XPlmi_WaitForSlrDmaXfr();
+				if (Status != XST_SUCCESS) {
+					goto END;
+				}
 			}
+			StartTime = XPlmi_GetTimerValue();
 			Status = PdiPtr->MetaHdr.DeviceCopy(DeviceCopy->SrcAddr,
 				ChunkAddr, ChunkLen, (DeviceCopy->Flags | Flags));
+			XLoader_AddPerfTime(&PrtnPerf.CopyTime, StartTime);
 			if (Status != XST_SUCCESS) {
 					goto END;
 			}
@@ -452,6 +545,10 @@ static int XLoader_ProcessCdo(const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCo
 					LastChunk = (u8)TRUE;
 					ChunkLen = DeviceCopy->Len;
 				}
+				Status = XPlmi_WaitForSlrDmaXfr();
+				if (Status != XST_SUCCESS) {
+					goto END;
+				}
 				Cdo.Cmd.KeyHoleParams.IsNextChunkCopyStarted = (u8)TRUE;
 				Cdo.NextChunkAddr = ChunkAddr;
 				/* Initiate the data copy */
@@ -467,8 +564,20 @@ static int XLoader_ProcessCdo(const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCo
 		else {
 			SecureParams->RemainingDataLen = DeviceCopy->Len;
 
+			StartTime = XPlmi_GetTimerValue();
 			Status = SecureParams->ProcessPrtn(SecureParams,
 					SecureParams->SecureData, ChunkLen, LastChunk);
+			XLoader_AddPerfTime(&PrtnPerf.SecureTime, StartTime);
+			if (Status != XST_SUCCESS) {
+				goto END;
+			}
+
+			/*
+			 * Start the copy of second chunk, so that it happens
+			 * while the first chunk is being executed
+			 */
+			Status = XLoader_SecureStartFirstPrefetch(SecureParams,
+					ChunkLen);
 			if (Status != XST_SUCCESS) {
 				goto END;
 			}
@@ -485,7 +594,9 @@ static int XLoader_ProcessCdo(const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCo
 		CdoProcessTimeStart = XPlmi_GetTimerValue();
 #endif
 		/* Process the chunk */
+		StartTime = XPlmi_GetTimerValue();
 		Status = XPlmi_ProcessCdo(&Cdo);
+		XLoader_AddPerfTime(&PrtnPerf.ExecTime, StartTime);
 		if (Status != XST_SUCCESS) {
 			goto END;
 		}
@@ -510,7 +621,9 @@ static int XLoader_ProcessCdo(const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCo
 				Cdo.Cmd.KeyHoleParams.ExtraWords = 0x0U;
 				Cdo.Cmd.KeyHoleParams.SrcAddr = DeviceCopy->SrcAddr;
 				Cdo.Cmd.KeyHoleParams.IsNextChunkCopyStarted = (u8)FALSE;
+				StartTime = XPlmi_GetTimerValue();
 				Status = XPlmi_ProcessCdo(&Cdo);
+				XLoader_AddPerfTime(&PrtnPerf.ExecTime, StartTime);
 				if (Status != XST_SUCCESS) {
 					goto END;
 				}
@@ -547,6 +660,10 @@ static int XLoader_ProcessCdo(const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCo
 	Status = XST_SUCCESS;
 
 END:
+	SStatus = XPlmi_WaitForSlrDmaXfr();
+	if (Status == XST_SUCCESS) {
+		Status = SStatus;
+	}
 #ifdef PLM_PRINT_PERF_CDO_PROCESS
 	XPlmi_MeasurePerfTime((XPlmi_GetTimerValue() + CdoProcessTime),
 				&PerfTime);
@@ -631,15 +748,22 @@ static int XLoader_ProcessPrtn(XilPdi* PdiPtr)
 	}
 	else if (PdiPtr->DelayLoad == (u8)TRUE) {
 		if (PdiPtr->PdiIndex == XLOADER_SBI_INDEX) {
+			/*
+			 * The partition data is not needed now, so stream it out
+			 * of SBI to a fixed PMC RAM address instead of copying
+			 * it chunk by chunk. This keeps the SBI buffer drained
+			 * for the host without a DMA reprogram every chunk.
+			 */
 			while (PrtnParams.DeviceCopy.Len > 0U) {
-				if (PrtnParams.DeviceCopy.Len > XLOADER_CHUNK_SIZE) {
-					TrfLen = XLOADER_CHUNK_SIZE;
+				if (PrtnParams.DeviceCopy.Len > XLOADER_SBI_DRAIN_MAX_LEN) {
+					TrfLen = XLOADER_SBI_DRAIN_MAX_LEN;
 				}
 				else {
 					TrfLen = PrtnParams.DeviceCopy.Len;
 				}
 				Status = PdiPtr->MetaHdr.DeviceCopy(PrtnParams.DeviceCopy.SrcAddr,
-					XPLMI_PMCRAM_CHUNK_MEMORY, TrfLen, 0U);
+					XPLMI_PMCRAM_CHUNK_MEMORY, TrfLen,
+					XPLMI_DST_CH_AXI_FIXED);
 				if (Status != XST_SUCCESS) {
 					Status = XPlmi_UpdateStatus(XLOADER_ERR_DELAY_LOAD, Status);
 					goto END;
@@ -657,9 +781,12 @@ static int XLoader_ProcessPrtn(XilPdi* PdiPtr)
 		 */
 	}
 
-	Status = XLoader_SecureInit(&SecureParams, PdiPtr, PrtnNum);
-	if (Status != XST_SUCCESS) {
-		goto END;
+	/* Partitions restored from cache are already authenticated/decrypted */
+	if (XLoader_PrtnCacheSetup(PdiPtr, &SecureParams) == (u8)FALSE) {
+		Status = XLoader_SecureInit(&SecureParams, PdiPtr, PrtnNum);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
 	}
 
 	if (PdiPtr->PdiType == XLOADER_PDI_TYPE_RESTORE) {
@@ -695,7 +822,12 @@ static int XLoader_ProcessPrtn(XilPdi* PdiPtr)
 		goto END;
 	}
 
-	if (PrtnType == XIH_PH_ATTRB_PRTN_TYPE_CDO) {
+	if ((PrtnType == XIH_PH_ATTRB_PRTN_TYPE_CDO) &&
+		(XilPdi_IsPrtnCompressed(PrtnHdr) == (u8)TRUE)) {
+		/* CDO commands can read data from boot device using keyhole */
+		Status = XPlmi_UpdateStatus(XLOADER_ERR_DECOMP_UNSUPPORTED, 0);
+	}
+	else if (PrtnType == XIH_PH_ATTRB_PRTN_TYPE_CDO) {
 		Status = XLoader_ProcessCdo(PdiPtr, &PrtnParams.DeviceCopy, &SecureParams);
 	}
 	else if (PrtnType == XIH_PH_ATTRB_PRTN_TYPE_ELF) {
@@ -721,3 +853,55 @@ END:
 	}
 	return Status;
 }
+
+/*****************************************************************************/
+/**
+ * @brief	This function adds the time elapsed since StartTime to the given
+ * partition load time accumulator.
+ *
+ * @param	PerfTime is pointer to the accumulator in PIT ticks
+ * @param	StartTime is the PIT timer value at the start of the operation
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XLoader_AddPerfTime(u64 *PerfTime, u64 StartTime)
+{
+	/* PIT counts down */
+	*PerfTime += StartTime - XPlmi_GetTimerValue();
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function stores the load time break up of the partition
+ * that is just loaded as a binary record in the trace log buffer. The record
+ * can be read using the retrieve trace log event logging command.
+ *
+ * @param	PdiPtr is pointer to XilPdi instance
+ * @param	PrtnLoadTime is the PIT timer value at the start of the partition
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XLoader_TracePrtnPerf(const XilPdi* PdiPtr, u64 PrtnLoadTime)
+{
+	u32 TicksPerUs = *XPlmi_GetPmcIroFreq() / XLOADER_US_PER_SEC;
+	u64 TotalTime = PrtnLoadTime - XPlmi_GetTimerValue();
+	u32 TraceBuffer[] = {XPLMI_TRACE_LOG_PRTN_PERF, 0U, 0U,
+		PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].ImgID,
+		PdiPtr->PrtnNum,
+		PdiPtr->MetaHdr.PrtnHdr[PdiPtr->PrtnNum].TotalDataWordLen *
+			XPLMI_WORD_LEN, 0U, 0U, 0U, 0U};
+
+	if (TicksPerUs == 0U) {
+		TicksPerUs = 1U;
+	}
+	TraceBuffer[XPLMI_TRACE_PRTN_PERF_TOTAL_IDX] = (u32)(TotalTime / TicksPerUs);
+	TraceBuffer[XPLMI_TRACE_PRTN_PERF_COPY_IDX] =
+		(u32)(PrtnPerf.CopyTime / TicksPerUs);
+	TraceBuffer[XPLMI_TRACE_PRTN_PERF_SECURE_IDX] =
+		(u32)(PrtnPerf.SecureTime / TicksPerUs);
+	TraceBuffer[XPLMI_TRACE_PRTN_PERF_EXEC_IDX] =
+		(u32)(PrtnPerf.ExecTime / TicksPerUs);
+	XPlmi_StoreTraceLog(TraceBuffer, XPLMI_ARRAY_SIZE(TraceBuffer));
+}
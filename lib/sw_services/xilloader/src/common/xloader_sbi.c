@@ -33,6 +33,7 @@
 * 1.05  bsv  11/08/2021 Skip SbiRecovery for SMAP and PCIe boot modes
 *       ma   01/17/2022 Enable SLVERR for SLAVE_BOOT registers
 * 1.06  bm   07/06/2022 Refactor versal and versal_net code
+* 1.07  ag   10/15/2026 Pass fixed destination burst flag to SBI DMA
 *
 * </pre>
 *
@@ -129,7 +130,9 @@ END:
  * @param	DestAddr is the address of the destination to which the data
  *		should be copied to
  * @param	Length is number of bytes to be copied
- * @param	Flags indicate parameters for DMA transfer
+ * @param	Flags indicate parameters for DMA transfer. Along with the
+ *		device copy state, XPLMI_DST_CH_AXI_FIXED can be set to stream
+ *		data that need not be kept to a fixed destination address
  *
  * @return	XST_SUCCESS on success and error code on failure
  *
@@ -151,7 +154,7 @@ int XLoader_SbiCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
 	if (ReadFlags == XPLMI_DEVICE_COPY_STATE_INITIATE) {
 		ReadFlags = XPLMI_DMA_DST_NONBLK;
 	}
-	ReadFlags |= XPLMI_PMCDMA_1;
+	ReadFlags |= (Flags & XPLMI_DST_CH_AXI_FIXED) | XPLMI_PMCDMA_1;
 	Status = XPlmi_SbiDmaXfer(DestAddr, (Length >> XPLMI_WORD_LEN_SHIFT),
 		ReadFlags);
 
@@ -113,6 +113,11 @@
 *       bsv  02/14/22 Added comments for better readability
 *       kpt  02/18/22 Fixed copy to memory issue
 * 1.09  bm   07/06/22 Refactor versal and versal_net code
+*       ag   10/14/26 Added XLoader_SecureStartFirstPrefetch to overlap the
+*                     copy of second chunk with first chunk CDO execution
+*       ag   10/14/26 Added task yield point in XLoader_SecureCopy
+*       ag   10/15/26 Complete slave SLR transfers out of the chunk memory
+*                     before copying the next chunk into it
 *
 * </pre>
 *
@@ -289,6 +294,8 @@ int XLoader_SecureCopy(XLoader_SecureParams *SecurePtr, u64 DestAddr, u32 Size)
 		LoadAddr = LoadAddr + SecurePtr->SecureDataLen;
 		Len = Len - SecurePtr->ProcessedLen;
 		SecurePtr->ChunkAddr = SecurePtr->NextChunkAddr;
+		/* Let pending higher priority tasks run between chunks */
+		XPlmi_TaskYield();
 	}
 
 END:
@@ -334,6 +341,12 @@ static int XLoader_StartNextChunkCopy(XLoader_SecureParams *SecurePtr,
 		CopyLen = TotalLen;
 	}
 
+	/* The chunk memory may still be the source of a slave SLR transfer */
+	Status = XPlmi_WaitForSlrDmaXfr();
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
 	SecurePtr->IsNextChunkCopyStarted = (u8)TRUE;
 
 	/* Initiate the data copy */
@@ -345,6 +358,7 @@ static int XLoader_StartNextChunkCopy(XLoader_SecureParams *SecurePtr,
 				Status);
 	}
 
+END:
 	return Status;
 }
 
@@ -671,6 +685,13 @@ int XLoader_SecureChunkCopy(XLoader_SecureParams *SecurePtr, u64 SrcAddr,
 		SecurePtr->IsNextChunkCopyStarted = (u8)FALSE;
 		Flags = XPLMI_DEVICE_COPY_STATE_WAIT_DONE;
 	}
+	else {
+		/* The chunk memory may still be the source of a slave SLR transfer */
+		Status = XPlmi_WaitForSlrDmaXfr();
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
 
 	/* Wait for copy to get completed */
 	Status = SecurePtr->PdiPtr->MetaHdr.DeviceCopy(SrcAddr,
@@ -702,6 +723,46 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+* @brief	This function starts the copy of the second chunk of a CDO
+*		partition once the first chunk is authenticated/decrypted.
+*		The chunk memory at 0xf2008120 holds the authentication
+*		certificate and PufData only until the first chunk is
+*		processed, so by the time the first chunk CDO commands are
+*		being executed it is free and the second chunk can be copied
+*		into it. This lets the device copy of the second chunk
+*		overlap with the execution of the first chunk, the same way
+*		it is done for the rest of the chunks in
+*		XLoader_SecureChunkCopy.
+*
+* @param	SecurePtr is pointer to the XLoader_SecureParams instance
+* @param	BlockSize is size of the next data block to be processed
+*
+* @return	XST_SUCCESS on success and error code on failure
+*
+******************************************************************************/
+int XLoader_SecureStartFirstPrefetch(XLoader_SecureParams *SecurePtr,
+	u32 BlockSize)
+{
+	int Status = XST_SUCCESS;
+	u32 RemainingLen = SecurePtr->RemainingDataLen - SecurePtr->ProcessedLen;
+
+	/*
+	 * Prefetch only right after the first block is processed, if there is
+	 * data left and the PMC DMA0 is not used for the copy as it is
+	 * required by the crypto engines
+	 */
+	if ((SecurePtr->BlockNum == 1U) && (RemainingLen != 0U) &&
+		(SecurePtr->IsNextChunkCopyStarted == (u8)FALSE) &&
+		((SecurePtr->DmaFlags & XPLMI_PMCDMA_0) != XPLMI_PMCDMA_0)) {
+		Status = XLoader_StartNextChunkCopy(SecurePtr, RemainingLen,
+				SecurePtr->NextBlkAddr, BlockSize);
+	}
+
+	return Status;
+}
+
 /*****************************************************************************/
 /**
 * @brief	This function checks if PPK is programmed.
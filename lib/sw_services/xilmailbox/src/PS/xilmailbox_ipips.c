@@ -28,6 +28,7 @@
  * 1.6   sd   28/02/22    Add support for microblaze
  *       kpt  03/16/22    Fixed compilation warning on microblaze
  *       sd   01/04/22    Replace memset with Xil_SMemSet
+ * 1.7   ag   10/15/26    Added queued messages in shared memory
  *</pre>
  *
  *@note
@@ -50,7 +51,14 @@ static u32 XIpiPs_SendData(XMailbox *InstancePtr, void *MsgBufferPtr,
 static u32 XIpiPs_PollforDone(XMailbox *InstancePtr);
 static u32 XIpiPs_RecvData(XMailbox *InstancePtr, void *MsgBufferPtr,
 			   u32 MsgLen, u8 BufferType);
+static u32 XIpiPs_AsyncInit(XMailbox *InstancePtr);
+static u32 XIpiPs_SendAsync(XMailbox *InstancePtr, void *MsgBufferPtr,
+			    u32 MsgLen);
+static u32 XIpiPs_Flush(XMailbox *InstancePtr);
+static u32 XIpiPs_RecvAsync(XMailbox *InstancePtr, void *MsgBufferPtr,
+			    u32 MsgLen, u32 *RecvLenPtr);
 #ifndef __MICROBLAZE__
+static void XIpiPs_SendDoneHandler(void *XMailboxPtr, u32 NumDone);
 static XStatus XIpiPs_RegisterIrq(XScuGic *IntcInstancePtr,
 				  XMailbox *InstancePtr,
 				  u32 IpiIntrId);
@@ -84,6 +92,10 @@ u32 XMailbox_Initialize(XMailbox *InstancePtr, u8 DeviceId)
 	InstancePtr->XMbox_IPI_SendData = XIpiPs_SendData;
 	InstancePtr->XMbox_IPI_Send = XIpiPs_Send;
 	InstancePtr->XMbox_IPI_Recv = XIpiPs_RecvData;
+	InstancePtr->XMbox_IPI_AsyncInit = XIpiPs_AsyncInit;
+	InstancePtr->XMbox_IPI_SendAsync = XIpiPs_SendAsync;
+	InstancePtr->XMbox_IPI_Flush = XIpiPs_Flush;
+	InstancePtr->XMbox_IPI_RecvAsync = XIpiPs_RecvAsync;
 
 	Status = XIpiPs_Init(InstancePtr, DeviceId);
 	return Status;
@@ -263,6 +275,122 @@ static u32 XIpiPs_RecvData(XMailbox *InstancePtr, void *MsgBufferPtr,
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * This function sets up the message queues in the shared memory. Each half
+ * of the shared memory holds the ring of the messages sent by one agent, the
+ * agent with the lower mask sending on the first half.
+ *
+ * @param InstancePtr Pointer to the XMailbox instance
+ *
+ * @return
+ *	- XST_SUCCESS if successful
+ *	- XST_FAILURE if the shared memory is too small
+ *
+ ****************************************************************************/
+static u32 XIpiPs_AsyncInit(XMailbox *InstancePtr)
+{
+	XMailbox_Agent *DataPtr = &InstancePtr->Agent;
+	XIpiPsu *IpiInstancePtr = &DataPtr->IpiInst;
+	UINTPTR TxRingAddr;
+	UINTPTR RxRingAddr;
+	u32 RingSize;
+	u32 NumEntries = 1U;
+	s32 Status = (s32)XST_FAILURE;
+
+	RingSize = (InstancePtr->SharedMem.Size / 2U) &
+		~(XIPIPSU_QUEUE_ENTRY_SIZE - 1U);
+	if (XIPIPSU_QUEUE_RING_SIZE(NumEntries) > RingSize) {
+		return (u32)Status;
+	}
+	while (XIPIPSU_QUEUE_RING_SIZE(NumEntries * 2U) <= RingSize) {
+		NumEntries *= 2U;
+	}
+
+	if (IpiInstancePtr->Config.BitMask < DataPtr->RemoteId) {
+		TxRingAddr = (UINTPTR)InstancePtr->SharedMem.Address;
+		RxRingAddr = TxRingAddr + RingSize;
+	} else {
+		RxRingAddr = (UINTPTR)InstancePtr->SharedMem.Address;
+		TxRingAddr = RxRingAddr + RingSize;
+	}
+
+	Status = XIpiPsu_QueueInit(&DataPtr->Queue, IpiInstancePtr,
+				   DataPtr->RemoteId, TxRingAddr, RxRingAddr,
+				   NumEntries);
+	if (Status != (s32)XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+#ifndef __MICROBLAZE__
+	if (InstancePtr->SendDoneHandler != NULL) {
+		XIpiPsu_QueueSetAckHandler(&DataPtr->Queue,
+					   XIpiPs_SendDoneHandler,
+					   (void *)InstancePtr);
+	}
+#endif
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * This function queues a message to the remote agent
+ *
+ * @param InstancePtr Pointer to the XMailbox instance
+ * @param MsgBufferPtr is the pointer to Buffer which contains the message to
+ *	  be sent
+ * @param MsgLen is the length of the message
+ *
+ * @return
+ *	- XST_SUCCESS if successful
+ *	- XST_DEVICE_BUSY if the queue is full
+ *
+ ****************************************************************************/
+static u32 XIpiPs_SendAsync(XMailbox *InstancePtr, void *MsgBufferPtr,
+			    u32 MsgLen)
+{
+	return (u32)XIpiPsu_QueueSend(&InstancePtr->Agent.Queue,
+				      (const u32 *)MsgBufferPtr, MsgLen);
+}
+
+/*****************************************************************************/
+/**
+ * This function triggers a single IPI for the queued messages
+ *
+ * @param InstancePtr Pointer to the XMailbox instance
+ *
+ * @return	XST_SUCCESS
+ *
+ ****************************************************************************/
+static u32 XIpiPs_Flush(XMailbox *InstancePtr)
+{
+	return (u32)XIpiPsu_QueueKick(&InstancePtr->Agent.Queue);
+}
+
+/*****************************************************************************/
+/**
+ * This function reads a queued message
+ *
+ * @param InstancePtr Pointer to the XMailbox instance
+ * @param MsgBufferPtr is the pointer to Buffer to which the read message needs
+ *	  to be stored
+ * @param MsgLen is the length of the buffer
+ * @param RecvLenPtr is set to the length of the message
+ *
+ * @return
+ *	- XST_SUCCESS if successful
+ *	- XST_NO_DATA if no message is queued
+ *
+ ****************************************************************************/
+static u32 XIpiPs_RecvAsync(XMailbox *InstancePtr, void *MsgBufferPtr,
+			    u32 MsgLen, u32 *RecvLenPtr)
+{
+	return (u32)XIpiPsu_QueueReceive(&InstancePtr->Agent.Queue,
+					 (u32 *)MsgBufferPtr, MsgLen,
+					 RecvLenPtr);
+}
+
 /*****************************************************************************/
 /**
  * This function registers an irq
@@ -369,11 +497,37 @@ static void XIpiPs_IntrHandler(void *XMailboxPtr)
 
 	IntrStatus = XIpiPsu_GetInterruptStatus(IpiInstancePtr);
 	XIpiPsu_ClearInterruptStatus(IpiInstancePtr, IntrStatus);
+	if ((DataPtr->Queue.IsReady == XIL_COMPONENT_IS_READY) &&
+	    ((IntrStatus & DataPtr->Queue.RemoteCpuMask) != 0U)) {
+		/* Report the queued messages read by the remote */
+		XIpiPsu_QueueHandler(&DataPtr->Queue);
+	}
 	if (InstancePtr->RecvHandler != NULL) {
 		InstancePtr->RecvHandler(InstancePtr->RecvRefPtr);
 	}
 }
 
+/*****************************************************************************/
+/**
+ * This function passes the number of queued messages read by the remote to
+ * the send done callback
+ *
+ * @param XMailboxPtr Pointer to the XMailbox instance
+ * @param NumDone is the number of messages read
+ *
+ * @return	None
+ *
+ ****************************************************************************/
+static void XIpiPs_SendDoneHandler(void *XMailboxPtr, u32 NumDone)
+{
+	const XMailbox *InstancePtr = (XMailbox *)((void *)XMailboxPtr);
+
+	if (InstancePtr->SendDoneHandler != NULL) {
+		InstancePtr->SendDoneHandler(InstancePtr->SendDoneRefPtr,
+					     NumDone);
+	}
+}
+
 /*****************************************************************************/
 /**
  * This function implements the interrupt handler for errors
@@ -19,6 +19,7 @@
  * 1.0   adk  12/02/19    Initial Release
  * 1.3   sd   03/03/21    Doxygen Fixes
  * 1.6   sd   28/02/21    Add support for microblaze
+ * 1.7   ag   10/15/26    Added message queues to the agent
  *</pre>
  *
  *@note
@@ -33,6 +34,7 @@ extern "C" {
 /***************************** Include Files *********************************/
 #include "xilmailbox.h"
 #include "xipipsu.h"
+#include "xipipsu_queue.h"
 #ifndef __MICROBLAZE__
 #include "xscugic.h"
 #endif
@@ -48,6 +50,7 @@ typedef struct {
 #endif
 	u32 SourceId; /**< Source id */
 	u32 RemoteId; /**< Remote id */
+	XIpiPsu_Queue Queue; /**< Queued messages in shared memory */
 } XMailbox_Agent; /**< Xilmailbox agent */
 /************************** Constant Definitions *****************************/
 #define BIT(x)                 	(1 << (x)) /**< Bit position */
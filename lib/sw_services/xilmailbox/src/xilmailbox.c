@@ -24,6 +24,7 @@
  * 1.3   sd   03/03/21    Doxygen Fixes
  * 1.4   sd   23/06/21    Fix MISRA-C warnings
  * 1.6   kpt  03/16/22    Added shared memory API's for IPI utilization
+ * 1.7   ag   10/15/26    Added queued messages in shared memory
  *</pre>
  *
  *@note
@@ -143,6 +144,7 @@ u32 XMailbox_Recv(XMailbox *InstancePtr, u32 SourceId, void *BufferPtr,
 * -----------------------  --------------------------------------------------
 * XMAILBOX_RECV_HANDLER	   Recv handler
 * XMAILBOX_ERROR_HANDLER   Error handler
+* XMAILBOX_SEND_DONE_HANDLER Send done handler
 *
 * </pre>
 *
@@ -158,6 +160,8 @@ u32 XMailbox_Recv(XMailbox *InstancePtr, u32 SourceId, void *BufferPtr,
 *
 * @note		Invoking this function for a handler that already has been
 *		installed replaces it with the new handler.
+*		The send done handler has to be installed before
+*		XMailbox_AsyncInit().
 *
 ******************************************************************************/
 s32 XMailbox_SetCallBack(XMailbox *InstancePtr, XMailbox_Handler HandlerType,
@@ -168,7 +172,8 @@ s32 XMailbox_SetCallBack(XMailbox *InstancePtr, XMailbox_Handler HandlerType,
 	Xil_AssertNonvoid(CallBackFuncPtr != NULL);
 	Xil_AssertNonvoid(CallBackRefPtr != NULL);
 	Xil_AssertNonvoid((HandlerType == XMAILBOX_RECV_HANDLER) ||
-			  (HandlerType == XMAILBOX_ERROR_HANDLER));
+			  (HandlerType == XMAILBOX_ERROR_HANDLER) ||
+			  (HandlerType == XMAILBOX_SEND_DONE_HANDLER));
 
 	/*
 	 * Calls the respective callback function corresponding to
@@ -178,6 +183,10 @@ s32 XMailbox_SetCallBack(XMailbox *InstancePtr, XMailbox_Handler HandlerType,
 		InstancePtr->RecvHandler =
 			(XMailbox_RecvHandler)((void *)CallBackFuncPtr);
 		InstancePtr->RecvRefPtr = CallBackRefPtr;
+	} else if (HandlerType == XMAILBOX_SEND_DONE_HANDLER) {
+		InstancePtr->SendDoneHandler =
+			(XMailbox_SendDoneHandler)((void *)CallBackFuncPtr);
+		InstancePtr->SendDoneRefPtr = CallBackRefPtr;
 	} else {
 		InstancePtr->ErrorHandler =
 			(XMailbox_ErrorHandler)((void *)CallBackFuncPtr);
@@ -266,4 +275,122 @@ int XMailbox_ReleaseSharedMem(XMailbox *InstancePtr)
 	}
 
 	return Status;
-}
\ No newline at end of file
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief	This function sets up the message queues to a remote agent in
+*		the shared memory. The shared memory is split in a ring of
+*		messages for each direction, so the same region of the same
+*		size has to be set on both agents.
+*
+* @param	InstancePtr is a pointer to the XMailbox instance.
+* @param	RemoteId is the Mask of the remote CPU
+*
+* @return
+*	-	XST_SUCCESS - if the message queues are set up
+*	-	XST_FAILURE - if the shared memory is not set or too small
+*
+******************************************************************************/
+u32 XMailbox_AsyncInit(XMailbox *InstancePtr, u32 RemoteId)
+{
+	u32 Status = XST_FAILURE;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	if (InstancePtr->SharedMem.SharedMemState != XMAILBOX_SHARED_MEM_INITIALIZED) {
+		return Status;
+	}
+
+	InstancePtr->Agent.RemoteId = RemoteId;
+	Status = InstancePtr->XMbox_IPI_AsyncInit(InstancePtr);
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief	This function queues a message to the remote agent set by
+*		XMailbox_AsyncInit(). The remote is not notified until
+*		XMailbox_Flush() is called, so a batch of messages costs a
+*		single IPI.
+*
+* @param	InstancePtr is a pointer to the XMailbox instance.
+* @param	BufferPtr is the pointer to Buffer which contains the message
+*		to be sent
+* @param	MsgLen is the length of the message in words
+*
+* @return
+*	-	XST_SUCCESS - if the message is queued
+*	-	XST_DEVICE_BUSY - if the queue is full
+*
+******************************************************************************/
+u32 XMailbox_SendDataAsync(XMailbox *InstancePtr, void *BufferPtr, u32 MsgLen)
+{
+	u32 Status = XST_FAILURE;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(BufferPtr != NULL);
+	Xil_AssertNonvoid(MsgLen <= XMAILBOX_MAX_MSG_LEN);
+
+	Status = InstancePtr->XMbox_IPI_SendAsync(InstancePtr, BufferPtr, MsgLen);
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief	This function notifies the remote agent of the messages queued
+*		since the last call.
+*
+* @param	InstancePtr is a pointer to the XMailbox instance.
+*
+* @return
+*	-	XST_SUCCESS - if successful
+*	-	XST_FAILURE - if unsuccessful
+*
+******************************************************************************/
+u32 XMailbox_Flush(XMailbox *InstancePtr)
+{
+	u32 Status = XST_FAILURE;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	Status = InstancePtr->XMbox_IPI_Flush(InstancePtr);
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief	This function reads the next message queued by the remote agent
+*
+* @param	InstancePtr is a pointer to the XMailbox instance.
+* @param	BufferPtr is the pointer to Buffer to which the read message
+*		needs to be stored
+* @param	MsgLen is the length of the buffer in words
+* @param	RecvLenPtr is set to the length of the message read
+*
+* @return
+*	-	XST_SUCCESS - if a message is read
+*	-	XST_NO_DATA - if no message is queued
+*
+******************************************************************************/
+u32 XMailbox_RecvAsync(XMailbox *InstancePtr, void *BufferPtr, u32 MsgLen,
+		       u32 *RecvLenPtr)
+{
+	u32 Status = XST_FAILURE;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(BufferPtr != NULL);
+	Xil_AssertNonvoid(RecvLenPtr != NULL);
+
+	Status = InstancePtr->XMbox_IPI_RecvAsync(InstancePtr, BufferPtr, MsgLen,
+						  RecvLenPtr);
+	return Status;
+}
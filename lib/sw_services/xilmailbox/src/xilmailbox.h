@@ -21,6 +21,8 @@
  *      - Sending an IPI message to a remote agent.
  *      - Callbacks for error and recv IPI events.
  *      - Reading an IPI message.
+ *      - Queued messages in shared memory, sent without waiting for the
+ *        remote agent.
  *
  * <b> Software Initialization </b>
  * - IPI Initialization using XMailbox_Initalize() function. This step
@@ -33,6 +35,25 @@
  * - XMailbox_SetCallBack() using this function user can register call backs
  *   for recv and error events.
  *
+ * <b> Queued Messages </b>
+ * XMailbox_SendData() uses the single IPI message buffer of the remote agent,
+ * so each message has to be read by the remote before the next one is sent.
+ * For a higher throughput, the messages can be queued in shared memory:
+ * - XMailbox_SetSharedMem() sets the shared memory, which has to be the same
+ *   region of the same size on both agents, and not cached.
+ * - XMailbox_AsyncInit() splits it into a ring of messages for each
+ *   direction. Both agents have to be initialized before a message is sent.
+ * - XMailbox_SendDataAsync() queues a message of up to XMAILBOX_MAX_MSG_LEN
+ *   words and returns without waiting for the remote. XST_DEVICE_BUSY is
+ *   returned while the ring is full.
+ * - XMailbox_Flush() notifies the remote of all the queued messages with a
+ *   single IPI.
+ * - XMailbox_RecvAsync(), typically from the recv handler, reads the next
+ *   queued message until XST_NO_DATA is returned.
+ * - The XMAILBOX_SEND_DONE_HANDLER callback, set before XMailbox_AsyncInit(),
+ *   is called with the number of messages read by the remote, to refill the
+ *   ring. It needs the IPI interrupt, so it is not supported on MicroBlaze.
+ *
  * <pre>
  * MODIFICATION HISTORY:
  *
@@ -44,6 +65,7 @@
  * 1.3   sd   03/03/21    Doxygen Fixes
  * 1.6   sd   28/02/21    Add support for microblaze
  *       kpt  03/16/22    Added shared memory API's for IPI utilization
+ * 1.7   ag   10/15/26    Added queued messages in shared memory
  *</pre>
  *
  *@note
@@ -71,6 +93,7 @@ extern "C" {
 /**************************** Type Definitions *******************************/
 typedef void (*XMailbox_RecvHandler) (void *CallBackRefPtr); /**< Receive handler */
 typedef void (*XMailbox_ErrorHandler) (void *CallBackRefPtr, u32 ErrorMask); /**< Error handler */
+typedef void (*XMailbox_SendDoneHandler) (void *CallBackRefPtr, u32 NumDone); /**< Send done handler */
 
 /**
  * This typedef contains XMAILBOX shared memory state.
@@ -96,10 +119,18 @@ typedef struct XMboxTag {
 				  u32 MsgLen, u8 BufferType, u8 Is_Blocking); /**< Sends an IPI message to a destination CPU */
 	u32 (*XMbox_IPI_Recv)(struct XMboxTag *InstancePtr, void *BufferPtr,
 			      u32 MsgLen, u8 BufferType); /**< Reads an IPI message */
+	u32 (*XMbox_IPI_AsyncInit)(struct XMboxTag *InstancePtr); /**< Sets up the message queues */
+	u32 (*XMbox_IPI_SendAsync)(struct XMboxTag *InstancePtr, void *BufferPtr,
+				   u32 MsgLen); /**< Queues a message */
+	u32 (*XMbox_IPI_Flush)(struct XMboxTag *InstancePtr); /**< Notifies the queued messages */
+	u32 (*XMbox_IPI_RecvAsync)(struct XMboxTag *InstancePtr, void *BufferPtr,
+				   u32 MsgLen, u32 *RecvLenPtr); /**< Reads a queued message */
 	XMailbox_RecvHandler RecvHandler;   /**< Recieve handler */
 	XMailbox_ErrorHandler ErrorHandler; /**< Callback for rx IPI event */
 	void *ErrorRefPtr; /**<  To be passed to the error interrupt callback */
 	void *RecvRefPtr;  /**< To be passed to the receive interrupt callback */
+	XMailbox_SendDoneHandler SendDoneHandler; /**< Callback for queued messages read */
+	void *SendDoneRefPtr; /**< To be passed to the send done callback */
 	XMailbox_Agent Agent; /**< Agent to store IPI channel information */
 	XMailbox_IpiSharedMem SharedMem; /**< shared memory segment */
 } XMailbox; /**< XilMailbox structure */
@@ -110,6 +141,7 @@ typedef struct XMboxTag {
 typedef enum {
         XMAILBOX_RECV_HANDLER,     /**< For Recv Handler */
         XMAILBOX_ERROR_HANDLER,    /**< For Error Handler */
+        XMAILBOX_SEND_DONE_HANDLER, /**< For Send Done Handler */
 } XMailbox_Handler;
 
 /************************** Function Prototypes ******************************/
@@ -128,6 +160,11 @@ s32 XMailbox_SetCallBack(XMailbox *InstancePtr, XMailbox_Handler HandlerType,
 u32 XMailbox_SetSharedMem(XMailbox *InstancePtr, u64 Address, u32 Size);
 u32 XMailbox_GetSharedMem(XMailbox *InstancePtr, u64 **Address);
 int XMailbox_ReleaseSharedMem(XMailbox *InstancePtr);
+u32 XMailbox_AsyncInit(XMailbox *InstancePtr, u32 RemoteId);
+u32 XMailbox_SendDataAsync(XMailbox *InstancePtr, void *BufferPtr, u32 MsgLen);
+u32 XMailbox_Flush(XMailbox *InstancePtr);
+u32 XMailbox_RecvAsync(XMailbox *InstancePtr, void *BufferPtr, u32 MsgLen,
+		       u32 *RecvLenPtr);
 /** @} */
 
 #ifdef __cplusplus
@@ -21,6 +21,8 @@
 *       dc   08/29/2022 Changed u8 to u32 type
 *       kal  09/29/2022 Removed unlock and lock of eFuse controller
 *                       from the XNvm_EfuseCacheReload function
+*       ag   10/15/2026 Added eFuse cache shadow copy which is invalidated on
+*                       cache reload
 *
 * </pre>
 *
@@ -59,6 +61,8 @@
 #define XNVM_EFUSE_SEC_DEF_VAL_ALL_BIT_SET	(0xFFFFFFFFU)
 /**< Default secure value for 8 bit */
 #define XNVM_EFUSE_SEC_DEF_VAL_BYTE_SET		(0xFFU)
+/**< Number of words in eFuse cache shadow copy */
+#define XNVM_EFUSE_SHADOW_WORDS			((XNVM_EFUSE_SHADOW_END_OFFSET / XNVM_WORD_LEN) + 1U)
 /** @} */
 
 /***************************** Type Definitions *******************************/
@@ -69,6 +73,8 @@
 /*************************** Function Prototypes ******************************/
 
 /*************************** Variable Definitions *****************************/
+static u32 EfuseShadow[XNVM_EFUSE_SHADOW_WORDS];	/**< eFuse cache shadow copy */
+static u32 EfuseShadowValid = (u32)FALSE;	/**< Shadow copy matches eFuse cache */
 
 /*************************** Function Definitions *****************************/
 
@@ -90,6 +96,9 @@ int XNvm_EfuseCacheReload(void)
 	int Status = XST_FAILURE;
 	u32 CacheStatus;
 
+	/* Cache contents change with the reload, newly programmed bits appear */
+	XNvm_EfuseShadowInvalidate();
+
 	XNvm_EfuseWriteReg(XNVM_EFUSE_CTRL_BASEADDR,
 			XNVM_EFUSE_CACHE_LOAD_REG_OFFSET,
 			XNVM_EFUSE_CACHE_LOAD_MASK);
@@ -396,3 +405,61 @@ int XNvm_EfuseCheckForTBits(void)
 END :
 	return Status;
 }
+
+/******************************************************************************/
+/**
+ * @brief	This function copies the eFuse cache registers up to
+ *		XNVM_EFUSE_SHADOW_END_OFFSET in to the shadow copy, so that the
+ *		frequently read rows like DNA, IVs, PPK hashes and revocation
+ *		IDs are read from RAM.
+ *
+ ******************************************************************************/
+void XNvm_EfuseShadowLoad(void)
+{
+	u32 Idx;
+
+	for (Idx = 0U; Idx < XNVM_EFUSE_SHADOW_WORDS; Idx++) {
+		EfuseShadow[Idx] = XNvm_EfuseReadReg(XNVM_EFUSE_CACHE_BASEADDR,
+			Idx * XNVM_WORD_LEN);
+	}
+	EfuseShadowValid = (u32)TRUE;
+}
+
+/******************************************************************************/
+/**
+ * @brief	This function invalidates the eFuse cache shadow copy. It is
+ *		loaded again on the next read.
+ *
+ ******************************************************************************/
+void XNvm_EfuseShadowInvalidate(void)
+{
+	EfuseShadowValid = (u32)FALSE;
+}
+
+/******************************************************************************/
+/**
+ * @brief	This function reads a 32-bit eFuse cache register, from the
+ *		shadow copy when the offset is covered by it.
+ *
+ * @param	Offset - Word aligned offset of the eFuse cache register
+ *
+ * @return	Value of the eFuse cache register
+ *
+ ******************************************************************************/
+u32 XNvm_EfuseReadCache(u32 Offset)
+{
+	u32 RegData;
+
+	if ((Offset > XNVM_EFUSE_SHADOW_END_OFFSET) ||
+		((Offset % XNVM_WORD_LEN) != 0U)) {
+		RegData = XNvm_EfuseReadReg(XNVM_EFUSE_CACHE_BASEADDR, Offset);
+	}
+	else {
+		if (EfuseShadowValid != (u32)TRUE) {
+			XNvm_EfuseShadowLoad();
+		}
+		RegData = EfuseShadow[Offset / XNVM_WORD_LEN];
+	}
+
+	return RegData;
+}
@@ -20,6 +20,7 @@
 * Ver   Who  Date       Changes
 * ----- ---- ---------- --------------------------------------------------------
 * 3.0   kal  07/16/2022 Initial release
+*       ag   10/15/2026 Added eFuse cache shadow copy
 *
 * </pre>
 *
@@ -59,6 +60,11 @@ extern "C" {
 #define XNVM_EFUSE_CTRL_WR_LOCKED	(0x01U)
 #define XNVM_EFUSE_CTRL_WR_UNLOCKED	(0x00U)
 
+/* Last eFuse cache offset held in the shadow copy */
+#ifndef XNVM_EFUSE_SHADOW_END_OFFSET
+#define XNVM_EFUSE_SHADOW_END_OFFSET	(0x2FCU)
+#endif
+
 /***************************** Type Definitions *******************************/
 /**
  * @name  Operation mode
@@ -101,6 +107,9 @@ int XNvm_EfuseResetReadMode(void);
 void XNvm_EfuseInitTimers(void);
 int XNvm_EfuseSetupController(XNvm_EfuseOpMode Op, XNvm_EfuseRdMode RdMode);
 int XNvm_EfuseCheckForTBits(void);
+void XNvm_EfuseShadowLoad(void);
+void XNvm_EfuseShadowInvalidate(void);
+u32 XNvm_EfuseReadCache(u32 Offset);
 
 #ifdef __cplusplus
 }
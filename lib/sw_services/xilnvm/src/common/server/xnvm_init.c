@@ -18,6 +18,7 @@
 * ----- ---- -------- -------------------------------------------------------
 * 1.0   kal 07/05/2021 Initial release
 * 2.4   bsv  09/09/2021 Added PLM_NVM macro
+* 3.0   ag   10/15/2026 Load eFuse cache shadow copy
 *
 * </pre>
 *
@@ -31,6 +32,7 @@
 #ifdef PLM_NVM
 #include "xnvm_cmd.h"
 #include "xnvm_init.h"
+#include "xnvm_efuse_common.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -47,6 +49,7 @@
 /*****************************************************************************/
 /**
  * @brief	This function registers the handlers for Xilnvm IPI commands
+ *		and loads the eFuse cache shadow copy
  *
  * @return	- XST_SUCCESS - On success
  *
@@ -54,6 +57,7 @@
 void XNvm_Init(void)
 {
 	XNvm_CmdsInit();
+	XNvm_EfuseShadowLoad();
 }
 
 #endif
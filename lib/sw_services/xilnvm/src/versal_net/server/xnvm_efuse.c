@@ -16,6 +16,8 @@
 * Ver   Who  Date        Changes
 * ----- ---- --------   -------------------------------------------------------
 * 3.0   kal  07/12/2022 Initial release
+*       ag   10/15/2026 Read eFuse cache through shadow copy and verify
+*                       programmed bits once per row
 *
 * </pre>
 *
@@ -50,7 +52,7 @@ static int XNvm_EfuseComputeProgrammableBits(const u32 *ReqData, u32 *PrgmData,
 static int XNvm_EfusePgmAndVerifyData(XNvm_EfusePrgmInfo *EfusePrgmInfo,
 		const u32* RowData);
 static int XNvm_EfusePgmBit(XNvm_EfuseType Page, u32 Row, u32 Col);
-static int XNvm_EfuseVerifyBit(XNvm_EfuseType Page, u32 Row, u32 Col);
+static int XNvm_EfuseVerifyBits(XNvm_EfuseType Page, u32 Row, u32 ColMask);
 static int XNvm_EfusePgmAndVerifyBit(XNvm_EfuseType Page, u32 Row, u32 Col,
 		u32 SkipVerify);
 static int XNvm_EfuseCloseController(void);
@@ -1866,18 +1868,34 @@ END:
  *					   is to be stored.
  *
  * @return	- XST_SUCCESS	- On successful Read.
- *		- XNVM_EFUSE_ERR_CACHE_PARITY - Parity Error exist in cache.
+ *		- XNVM_EFUSE_ERR_INVALID_PARAM - On Invalid Parameter.
+ *		- XNVM_EFUSE_ERR_GLITCH_DETECTED - On glitch while reading.
  *
  ******************************************************************************/
 int XNvm_EfuseReadCacheRange(u32 StartOffset, u8 RegCount, u32* Data)
 {
 	volatile int Status = XST_FAILURE;
-	u32 RegAddress = XNVM_EFUSE_CACHE_BASEADDR + StartOffset;
-	u32 NumOfBytes = RegCount * XNVM_WORD_LEN;
+	u32 Offset = StartOffset;
+	u32 Idx;
+
+	if (Data == NULL) {
+		Status = (int)XNVM_EFUSE_ERR_INVALID_PARAM;
+		goto END;
+	}
+
+	for (Idx = 0U; Idx < (u32)RegCount; Idx++) {
+		Data[Idx] = XNvm_EfuseReadCache(Offset);
+		Offset += XNVM_WORD_LEN;
+	}
 
-	Status = Xil_SMemCpy((void *)Data, NumOfBytes,
-			(const void *)RegAddress, NumOfBytes, NumOfBytes);
+	if (Idx != (u32)RegCount) {
+		Status = (int)XNVM_EFUSE_ERR_GLITCH_DETECTED;
+	}
+	else {
+		Status = XST_SUCCESS;
+	}
 
+END:
 	return Status;
 }
 
@@ -2740,6 +2758,7 @@ static int XNvm_EfusePgmAndVerifyData(XNvm_EfusePrgmInfo *EfusePrgmInfo, const u
 	u32 Idx = 0U;
 	u32 Col = 0U;
 	u32 Data;
+	u32 ColMask;
 
 	if ((EfusePrgmInfo->EfuseType != XNVM_EFUSE_PAGE_0) &&
 		(EfusePrgmInfo->EfuseType != XNVM_EFUSE_PAGE_1) &&
@@ -2757,14 +2776,15 @@ static int XNvm_EfusePgmAndVerifyData(XNvm_EfusePrgmInfo *EfusePrgmInfo, const u
 	Data = *DataPtr;
 	while (Row < EndRow) {
 		Col = EfusePrgmInfo->ColStart;
+		ColMask = 0U;
 		while (Col <= EfusePrgmInfo->ColEnd) {
 			if ((Data & 0x01U) != 0U) {
-				Status = XNvm_EfusePgmAndVerifyBit(
-						EfusePrgmInfo->EfuseType, Row,
-						Col, EfusePrgmInfo->SkipVerify);
+				Status = XNvm_EfusePgmBit(
+						EfusePrgmInfo->EfuseType, Row, Col);
 				if (Status != XST_SUCCESS) {
 					goto END;
 				}
+				ColMask |= ((u32)1U << Col);
 			}
 			Col++;
 			Idx++;
@@ -2776,6 +2796,15 @@ static int XNvm_EfusePgmAndVerifyData(XNvm_EfusePrgmInfo *EfusePrgmInfo, const u
 				Data = Data >> 1U;
 			}
 		}
+		/* Verify all the bits programmed in the row with a single read */
+		if ((ColMask != 0U) && (EfusePrgmInfo->SkipVerify == 0U)) {
+			Status = XST_FAILURE;
+			Status = XNvm_EfuseVerifyBits(EfusePrgmInfo->EfuseType,
+					Row, ColMask);
+			if (Status != XST_SUCCESS) {
+				goto END;
+			}
+		}
 		Row++;
 	}
 
@@ -2840,11 +2869,11 @@ static int XNvm_EfusePgmBit(XNvm_EfuseType Page, u32 Row, u32 Col)
 
 /******************************************************************************/
 /**
- * @brief	This function verify the specified bit set in the eFUSE.
+ * @brief	This function verify the specified bits set in an eFUSE row.
  *
  * @param	Page - It is an enum variable of type XNvm_EfuseType.
  * @param	Row - It is an 32-bit Row number (0-based addressing).
- * @param	Col - It is an 32-bit Col number (0-based addressing).
+ * @param	ColMask - Mask of the columns to be verified in the row.
  *
  * @return	- XST_SUCCESS - Specified bit set in eFUSE.
  *		- XNVM_EFUSE_ERR_PGM_VERIFY  - Verification failed, specified bit
@@ -2853,7 +2882,7 @@ static int XNvm_EfusePgmBit(XNvm_EfuseType Page, u32 Row, u32 Col)
  *		- XST_FAILURE                - Unexpected error.
  *
  ******************************************************************************/
-static int XNvm_EfuseVerifyBit(XNvm_EfuseType Page, u32 Row, u32 Col)
+static int XNvm_EfuseVerifyBits(XNvm_EfuseType Page, u32 Row, u32 ColMask)
 {
 	int Status = XST_FAILURE;
 	u32 RdAddr;
@@ -2880,7 +2909,7 @@ static int XNvm_EfuseVerifyBit(XNvm_EfuseType Page, u32 Row, u32 Col)
 					== XNVM_EFUSE_ISR_RD_DONE) {
 		RegData = XNvm_EfuseReadReg(XNVM_EFUSE_CTRL_BASEADDR,
 					XNVM_EFUSE_RD_DATA_REG_OFFSET);
-		if ((RegData & (((u32)0x01U) << Col)) != 0U) {
+		if ((RegData & ColMask) == ColMask) {
 			Status = XST_SUCCESS;
 		}
 		else {
@@ -2923,7 +2952,8 @@ static int XNvm_EfusePgmAndVerifyBit(XNvm_EfuseType Page, u32 Row, u32 Col, u32
 	if(XST_SUCCESS == Status) {
 		if (SkipVerify == 0U) {
 			Status = XST_FAILURE;
-			Status = XNvm_EfuseVerifyBit(Page, Row, Col);
+			Status = XNvm_EfuseVerifyBits(Page, Row,
+					((u32)1U << Col));
 		}
 	}
 
@@ -18,6 +18,7 @@
 * Ver   Who  Date        Changes
 * ----- ---- -------- -------------------------------------------------------
 * 3.0  kal   07/12/2022 Initial release
+*      ag    10/15/2026 Read eFuse cache through shadow copy
 *
 * </pre>
 *
@@ -675,7 +676,7 @@ static int XNvm_EfuseWriteDiceUds(u32 EnvDisFlag, XNvm_Uds *Uds)
 	}
 
 	while(Offset < EndOffset){
-		RegData = XNvm_EfuseReadReg(XNVM_EFUSE_CACHE_BASEADDR, Offset);
+		RegData = XNvm_EfuseReadCache(Offset);
 
 		XPlmi_Out64(OutputBuffer, RegData);
 
@@ -56,6 +56,7 @@
 *       bsv  07/08/2022 Code changes related to Optional data in IHT
 *       bm   07/13/2022 Added compatibility check for In-Place PLM Update
 *       bm   09/13/2022 Reduce maximum number of partitions and images
+*       ag   10/14/2026 Added compressed partition attribute
 *
 * </pre>
 *
@@ -162,6 +163,7 @@ extern "C" {
 /**
  *  Prtn Attribute fields
  */
+#define XIH_PH_ATTRB_COMPRESSED_MASK		(0x20000000U)
 #define XIH_PH_ATTRB_DPA_CM_EN_MASK		(0x18000000U)
 #define XIH_PH_ATTRB_DPA_CM_EN_SHIFT		(27U)
 #define XIH_PH_ATTRB_PRTN_TYPE_MASK		(0x7000000U)
@@ -425,6 +427,21 @@ static inline u32 XilPdi_GetPufHdPh(const XilPdi_PrtnHdr *PrtnHdr)
 	return (PrtnHdr->PrtnAttrb & XIH_PH_ATTRB_PUFHD_MASK);
 }
 
+/****************************************************************************/
+/**
+* @brief	This function checks if the partition data is compressed.
+*
+* @param	PrtnHdr is pointer to the Partition Header
+*
+* @return	TRUE / FALSE
+*
+*****************************************************************************/
+static inline u8 XilPdi_IsPrtnCompressed(const XilPdi_PrtnHdr *PrtnHdr)
+{
+	return (u8)((PrtnHdr->PrtnAttrb & XIH_PH_ATTRB_COMPRESSED_MASK) ==
+		XIH_PH_ATTRB_COMPRESSED_MASK);
+}
+
 /****************************************************************************/
 /**
 * @brief	This function checks if DpaCm is enabled or not.
@@ -48,6 +48,8 @@
 *1.06   bm   07/06/2022 Refactor versal and versal_net code
 *       kpt  07/19/2022 Added APIs to update or get KAT status from RTC area
 *       bm   07/22/2022 Update EAM logic for In-Place PLM Update
+*       ag   10/15/2026 Do not print the early log to UART if it holds binary
+*                       log records
 *
 * </pre>
 *
@@ -243,6 +245,7 @@ void XPlmi_PrintPlmBanner(void)
 static void XPlmi_PrintEarlyLog(void)
 {
 	DebugLog->PrintToBuf = (u8)FALSE;
+#ifndef XPLMI_PRINT_BINLOG
 	/* Print early log */
 	if (DebugLog->LogBuffer.IsBufferFull == (u32)FALSE) {
 		XPlmi_OutByte64(DebugLog->LogBuffer.StartAddr +
@@ -253,6 +256,10 @@ static void XPlmi_PrintEarlyLog(void)
 	else {
 		XPlmi_PrintPlmBanner();
 	}
+#else
+	/* The early log holds binary log records, which are not printable */
+	XPlmi_PrintPlmBanner();
+#endif
 	DebugLog->PrintToBuf = (u8)TRUE;
 }
 
@@ -55,6 +55,7 @@
 *       kpt  07/05/2022 Added XPLMI_RTCFG_SECURE_CTRL_ADDR
 *       ma   07/08/2022 Added support for secure lockdown
 *       kpt  07/19/2022 Added APIs and macros related to KAT
+*       ag   10/15/2026 Added RTCA defines for trace ring address
 *
 * </pre>
 *
@@ -142,6 +143,8 @@ static inline u8 XPlmi_IsUartPrintInitialized(void)
 #define XPLMI_RTCFG_SIZE_ADDR			(XPLMI_RTCFG_BASEADDR + 0x8U)
 #define XPLMI_RTCFG_DBG_LOG_BUF_ADDR	(XPLMI_RTCFG_BASEADDR + 0x10U)
 #define XPLMI_RTCFG_SECURE_CTRL_ADDR		(XPLMI_RTCFG_BASEADDR + 0x28U)
+#define XPLMI_RTCFG_TRACE_RING_ADDRLOW_ADDR	(XPLMI_RTCFG_BASEADDR + 0x30U)
+#define XPLMI_RTCFG_TRACE_RING_ADDRHIGH_ADDR	(XPLMI_RTCFG_BASEADDR + 0x34U)
 #define XPLMI_RTCFG_IMGINFOTBL_ADDRLOW_ADDR	(XPLMI_RTCFG_BASEADDR + 0x40U)
 #define XPLMI_RTCFG_IMGINFOTBL_ADDRHIGH_ADDR	(XPLMI_RTCFG_BASEADDR + 0x44U)
 #define XPLMI_RTCFG_IMGINFOTBL_LEN_ADDR		(XPLMI_RTCFG_BASEADDR + 0x48U)
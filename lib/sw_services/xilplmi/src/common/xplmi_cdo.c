@@ -50,6 +50,7 @@
 *       ma   07/25/2022 Enhancements to secure lockdown code
 *       bm   08/24/2022 Support Begin, Break and End commands across chunk
 *                       boundaries
+*       ag   10/14/2026 Added task yield point before processing each chunk
 *
 * </pre>
 *
@@ -66,6 +67,7 @@
 #include "xplmi_generic.h"
 #include "xplmi_wdt.h"
 #include "xplmi_tamper.h"
+#include "xplmi_task.h"
 
 /************************** Constant Definitions *****************************/
 #define XPLMI_CMD_LEN_TEMPBUF		(0x8U) /**< This buffer is used to
@@ -386,6 +388,12 @@ int XPlmi_ProcessCdo(XPlmiCdo *CdoPtr)
 	u32 RemainingLen;
 	u32 SldInitiated = XPlmi_IsSldInitiated();
 
+	/*
+	 * Chunk boundary is a safe point to let the pending higher priority
+	 * tasks run while a long CDO is being processed
+	 */
+	XPlmi_TaskYield();
+
 	/* Verify the header for the first chunk of CDO */
 	if (CdoPtr->Cdo1stChunk == (u8)TRUE) {
 		Status = XPlmi_CdoVerifyHeader(CdoPtr);
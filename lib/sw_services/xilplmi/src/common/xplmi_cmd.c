@@ -22,6 +22,11 @@
 *       bm   10/14/2020 Code clean up
 *       td   10/19/2020 MISRA C Fixes
 * 1.03  td   07/08/2021 Fix doxygen warnings
+*       ag   10/14/2026 Added fast path for generic write, mask_write and
+*                       mask_poll commands, optional per command statistics
+*                       and check for unregistered modules
+*       ag   10/15/2026 Leave writes to the generic handlers while ECC
+*                       initializations are queued
 * </pre>
 *
 * @note
@@ -33,16 +38,206 @@
 #include "xplmi_debug.h"
 #include "xplmi_modules.h"
 #include "xil_assert.h"
+#include "xplmi_hw.h"
+#include "xplmi_util.h"
+#include "xplmi_dma.h"
 
 /************************** Constant Definitions *****************************/
+#define XPLMI_CMD_WRITE_LEN		(2U) /**< Payload length of write */
+#define XPLMI_CMD_MASK_WRITE_LEN	(3U) /**< Payload length of mask_write */
+#define XPLMI_CMD_MASK_POLL_LEN		(4U) /**< Payload length of mask_poll */
+#define XPLMI_CMD_MASK_POLL_LEN_EXT	(5U) /**< mask_poll length with flags */
+
+#ifdef PLM_CDO_CMD_STATS
+#define XPLMI_CMD_STATS_MAX		(64U) /**< Power of 2 */
+#define XPLMI_CMD_STATS_KEY_MASK	(0xFFFFU)
+#define XPLMI_CMD_STATS_HIST_CNT	(8U)
+#define XPLMI_CMD_STATS_HIST_BASE	(6U) /**< First bucket < 2^6 ticks */
+#define XPLMI_CMD_STATS_HIST_SHIFT	(2U) /**< Each bucket is 4x wider */
+#endif
 
 /**************************** Type Definitions *******************************/
+#ifdef PLM_CDO_CMD_STATS
+/* Per command execution statistics */
+typedef struct {
+	u32 CmdId; /**< Module and API ID, 0 if entry is free */
+	u32 Count; /**< Number of times the command is executed */
+	u64 TotalTicks; /**< Total PIT ticks spent in the command */
+	u32 Hist[XPLMI_CMD_STATS_HIST_CNT]; /**< Latency histogram */
+} XPlmi_CmdStats;
+#endif
 
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /************************** Function Prototypes ******************************/
+static u8 XPlmi_CmdFastPath(const XPlmi_Cmd *CmdPtr);
 
 /************************** Variable Definitions *****************************/
+#ifdef PLM_CDO_CMD_STATS
+static XPlmi_CmdStats CmdStats[XPLMI_CMD_STATS_MAX];
+#endif
+
+#ifdef PLM_CDO_CMD_STATS
+/*****************************************************************************/
+/**
+ * @brief	This function accounts the time taken by a command in the command
+ * statistics table. Entries are looked up by hashing the module and API ID
+ * with linear probing.
+ *
+ * @param	CmdId is the command ID
+ * @param	Ticks is the number of PIT ticks spent in the command
+ * @param	NewCmd is TRUE if this is the first invocation of the command
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XPlmi_CmdStatsUpdate(u32 CmdId, u64 Ticks, u8 NewCmd)
+{
+	u32 Key = CmdId & XPLMI_CMD_STATS_KEY_MASK;
+	u32 Index = (Key ^ (Key >> 6U)) & (XPLMI_CMD_STATS_MAX - 1U);
+	u32 Probe;
+	u32 Bucket = 0U;
+	u64 Limit = (u64)1U << XPLMI_CMD_STATS_HIST_BASE;
+	XPlmi_CmdStats *Stats = NULL;
+
+	/* Generic module, API 0 has key 0, so store key + 1 in the entry */
+	for (Probe = 0U; Probe < XPLMI_CMD_STATS_MAX; ++Probe) {
+		if ((CmdStats[Index].CmdId == (Key + 1U)) ||
+			(CmdStats[Index].CmdId == 0U)) {
+			Stats = &CmdStats[Index];
+			break;
+		}
+		Index = (Index + 1U) & (XPLMI_CMD_STATS_MAX - 1U);
+	}
+	if (Stats == NULL) {
+		/* Table is full, drop the sample */
+		goto END;
+	}
+
+	while ((Ticks >= Limit) && (Bucket < (XPLMI_CMD_STATS_HIST_CNT - 1U))) {
+		Limit <<= XPLMI_CMD_STATS_HIST_SHIFT;
+		++Bucket;
+	}
+
+	Stats->CmdId = Key + 1U;
+	Stats->TotalTicks += Ticks;
+	if (NewCmd == (u8)TRUE) {
+		++Stats->Count;
+		++Stats->Hist[Bucket];
+	}
+
+END:
+	return;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function prints the command statistics collected so far and
+ * optionally clears them.
+ *
+ * @param	Clear is non zero to reset the statistics after printing
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XPlmi_CmdStatsDump(u32 Clear)
+{
+	u32 Index;
+	u32 Bucket;
+	u32 TicksPerUs = *XPlmi_GetPmcIroFreq() / 1000000U;
+	XPlmi_CmdStats *Stats;
+
+	if (TicksPerUs == 0U) {
+		TicksPerUs = 1U;
+	}
+
+	XPlmi_Printf(DEBUG_PRINT_ALWAYS, "CmdId   Count      Total(us)  "
+		"Histogram (< 2^%u ticks, x%u per bucket)\n\r",
+		XPLMI_CMD_STATS_HIST_BASE, 1U << XPLMI_CMD_STATS_HIST_SHIFT);
+	for (Index = 0U; Index < XPLMI_CMD_STATS_MAX; ++Index) {
+		Stats = &CmdStats[Index];
+		if (Stats->CmdId == 0U) {
+			continue;
+		}
+		XPlmi_Printf(DEBUG_PRINT_ALWAYS, "0x%04x  %10u %10u ",
+			Stats->CmdId - 1U, Stats->Count,
+			(u32)(Stats->TotalTicks / TicksPerUs));
+		for (Bucket = 0U; Bucket < XPLMI_CMD_STATS_HIST_CNT; ++Bucket) {
+			XPlmi_Printf_WoTS(DEBUG_PRINT_ALWAYS, " %u",
+				Stats->Hist[Bucket]);
+		}
+		XPlmi_Printf_WoTS(DEBUG_PRINT_ALWAYS, "\n\r");
+		if (Clear != 0U) {
+			Stats->CmdId = 0U;
+			Stats->Count = 0U;
+			Stats->TotalTicks = 0U;
+			for (Bucket = 0U; Bucket < XPLMI_CMD_STATS_HIST_CNT; ++Bucket) {
+				Stats->Hist[Bucket] = 0U;
+			}
+		}
+	}
+}
+#endif
+
+/*****************************************************************************/
+/**
+ * @brief	This function executes the most frequent generic CDO commands
+ * (write, mask_write and mask_poll) without going through the module command
+ * table. Only commands whose complete payload is available are handled.
+ * mask_poll is handled only if the expected value is already present, so the
+ * timeout and error flag handling stays in the generic handler.
+ * write and mask_write are handled only while no ECC initialization is
+ * queued, otherwise the generic handlers wait for the initialization of the
+ * address before writing it.
+ *
+ * @param	CmdPtr is pointer to command structure
+ *
+ * @return	TRUE if the command is executed, FALSE otherwise
+ *
+ *****************************************************************************/
+static u8 XPlmi_CmdFastPath(const XPlmi_Cmd *CmdPtr)
+{
+	u8 Handled = (u8)FALSE;
+	const u32 *Payload = CmdPtr->Payload;
+
+	if (((CmdPtr->CmdId & XPLMI_CMD_MODULE_ID_MASK) != 0U) ||
+		(CmdPtr->PayloadLen != CmdPtr->Len)) {
+		goto END;
+	}
+
+	switch (CmdPtr->CmdId & XPLMI_CMD_API_ID_MASK) {
+		case XPLMI_WRITE_CMD_ID:
+			if ((CmdPtr->Len == XPLMI_CMD_WRITE_LEN) &&
+				(XPlmi_EccInitIsIdle() == (u8)TRUE)) {
+				XPlmi_Out32(Payload[0U], Payload[1U]);
+				Handled = (u8)TRUE;
+			}
+			break;
+		case XPLMI_MASK_WRITE_CMD_ID:
+			if ((CmdPtr->Len == XPLMI_CMD_MASK_WRITE_LEN) &&
+				(XPlmi_EccInitIsIdle() == (u8)TRUE)) {
+				XPlmi_UtilRMW(Payload[0U], Payload[1U], Payload[2U]);
+				Handled = (u8)TRUE;
+			}
+			break;
+#ifndef PLM_PRINT_PERF_POLL
+		case XPLMI_MASK_POLL_CMD_ID:
+			if (((CmdPtr->Len == XPLMI_CMD_MASK_POLL_LEN) ||
+				(CmdPtr->Len == XPLMI_CMD_MASK_POLL_LEN_EXT)) &&
+				((XPlmi_In32(Payload[0U]) & Payload[1U]) ==
+				Payload[2U])) {
+				Handled = (u8)TRUE;
+			}
+			break;
+#endif
+		default:
+			/* Not a fast path command */
+			break;
+	}
+
+END:
+	return Handled;
+}
 
 /*****************************************************************************/
 /*****************************************************************************/
@@ -63,13 +258,22 @@ int XPlmi_CmdExecute(XPlmi_Cmd *CmdPtr)
 	u32 ApiId = CmdPtr->CmdId & XPLMI_CMD_API_ID_MASK;
 	const XPlmi_Module *Module = NULL;
 	const XPlmi_ModuleCmd *ModuleCmd = NULL;
+#ifdef PLM_CDO_CMD_STATS
+	u64 StartTime = XPlmi_GetTimerValue();
+#endif
 
 	XPlmi_Printf(DEBUG_DETAILED, "CMD Execute \n\r");
+	if (XPlmi_CmdFastPath(CmdPtr) == (u8)TRUE) {
+		CmdPtr->ProcessedLen += CmdPtr->PayloadLen;
+		Status = XST_SUCCESS;
+		goto END;
+	}
+
 	/* Assign Module */
 	if (ModuleId < XPLMI_MAX_MODULES) {
 		Module = Modules[ModuleId];
 	}
-	else {
+	if (Module == NULL) {
 		Status = XPlmi_UpdateStatus(XPLMI_ERR_MODULE_MAX, 0);
 		goto END;
 	}
@@ -103,6 +307,10 @@ int XPlmi_CmdExecute(XPlmi_Cmd *CmdPtr)
 	CmdPtr->ResumeHandler = ModuleCmd->Handler;
 
 END:
+#ifdef PLM_CDO_CMD_STATS
+	XPlmi_CmdStatsUpdate(CmdPtr->CmdId, StartTime - XPlmi_GetTimerValue(),
+		(u8)TRUE);
+#endif
 	return Status;
 }
 
@@ -119,6 +327,9 @@ END:
 int XPlmi_CmdResume(XPlmi_Cmd * CmdPtr)
 {
 	int Status = XST_FAILURE;
+#ifdef PLM_CDO_CMD_STATS
+	u64 StartTime = XPlmi_GetTimerValue();
+#endif
 
 	XPlmi_Printf(DEBUG_DETAILED, "CMD Resume \n\r");
 	Xil_AssertNonvoid(CmdPtr->ResumeHandler != NULL);
@@ -132,5 +343,9 @@ int XPlmi_CmdResume(XPlmi_Cmd * CmdPtr)
 	CmdPtr->ProcessedLen += CmdPtr->PayloadLen;
 
 END:
+#ifdef PLM_CDO_CMD_STATS
+	XPlmi_CmdStatsUpdate(CmdPtr->CmdId, StartTime - XPlmi_GetTimerValue(),
+		(u8)FALSE);
+#endif
 	return Status;
 }
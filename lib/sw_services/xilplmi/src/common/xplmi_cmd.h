@@ -43,6 +43,8 @@
 *       bm   07/06/2022 Refactor versal and versal_net code
 *       bm   08/24/2022 Support Begin, Break and End commands across chunk
 *                       boundaries
+*       ag   10/14/2026 Added XPlmi_CmdStatsDump prototype
+*       ag   10/15/2026 Added IsSlrXfrNonBlk to the key hole parameters
 *
 * </pre>
 *
@@ -80,6 +82,7 @@ struct XPlmi_KeyHoleParams {
 	u32 ExtraWords; /**< Words that are directly DMAed to CFI */
 	int (*Func) (u64 SrcAddr, u64 DestAddress, u32 Length, u32 Flags);
 	u8 IsNextChunkCopyStarted; /**< Used to check if next chunk is copied or not */
+	u8 IsSlrXfrNonBlk; /**< Transfers to the slave SLRs are not waited for */
 };
 
 struct XPlmi_Cmd {
@@ -106,6 +109,7 @@ struct XPlmi_Cmd {
 /************************** Function Prototypes ******************************/
 int XPlmi_CmdExecute(XPlmi_Cmd * CmdPtr);
 int XPlmi_CmdResume(XPlmi_Cmd * CmdPtr);
+void XPlmi_CmdStatsDump(u32 Clear);
 
 /**
  * @}
@@ -38,6 +38,7 @@
 * 1.06  am   11/24/2021 Fixed doxygen warning
 * 1.07  skd  04/21/2022 Misra-C violation Rule 8.3 fixed
 * 1.08  bm   07/06/2022 Refactor versal and versal_net code
+*       ag   10/15/2026 Drain the binary log to the debug log buffer
 *
 * </pre>
 *
@@ -78,6 +79,11 @@
 #endif
 
 /************************** Function Prototypes ******************************/
+static void XPlmi_LogByte(u8 c);
+#ifdef XPLMI_PRINT_BINLOG
+static u32 XPlmi_BinLogOutput(void *Ref, const u8 *Buf, u32 Len);
+static void XPlmi_BinLogKick(void *Ref);
+#endif
 
 /************************** Variable Definitions *****************************/
 
@@ -221,7 +227,6 @@ END:
  *****************************************************************************/
 void outbyte(char c)
 {
-	u64 CurrentAddr;
 #if (XPLMI_UART_NUM_INSTANCES > 0U)
 	u32 *UartBaseAddr = XPlmi_GetUartBaseAddr();
 	if (XPlmi_IsUartPrintInitialized() == (u8)TRUE) {
@@ -229,6 +234,22 @@ void outbyte(char c)
 	}
 #endif
 
+	XPlmi_LogByte((u8)c);
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function logs a byte to the debug log buffer
+ *
+ * @param	c is the byte to be logged
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XPlmi_LogByte(u8 c)
+{
+	u64 CurrentAddr;
+
 	if (DebugLog->PrintToBuf == (u8)TRUE) {
 		CurrentAddr = DebugLog->LogBuffer.StartAddr +
 			DebugLog->LogBuffer.Offset;
@@ -239,11 +260,67 @@ void outbyte(char c)
 			CurrentAddr = DebugLog->LogBuffer.StartAddr;
 		}
 
-		XPlmi_OutByte64(CurrentAddr, (u8)c);
+		XPlmi_OutByte64(CurrentAddr, c);
 		++DebugLog->LogBuffer.Offset;
 	}
 }
 
+#ifdef XPLMI_PRINT_BINLOG
+/*****************************************************************************/
+/**
+ * @brief	This function copies binary log records to the debug log buffer,
+ * mixed with the prints formatted as text. The records are not sent to the
+ * UART.
+ *
+ * @param	Ref is unused
+ * @param	Buf is pointer to the record bytes
+ * @param	Len is number of bytes
+ *
+ * @return	Number of bytes accepted, always Len
+ *
+ *****************************************************************************/
+static u32 XPlmi_BinLogOutput(void *Ref, const u8 *Buf, u32 Len)
+{
+	u32 Index;
+
+	(void)Ref;
+	for (Index = 0U; Index < Len; ++Index) {
+		XPlmi_LogByte(Buf[Index]);
+	}
+
+	return Len;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function drains the binary log as soon as a record is added.
+ * Copying to memory is cheap, the time saved is the formatting.
+ *
+ * @param	Ref is unused
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XPlmi_BinLogKick(void *Ref)
+{
+	(void)Ref;
+	(void)Xil_BinLogDrain();
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function registers the debug log buffer as the output of the
+ * binary log.
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XPlmi_InitBinLog(void)
+{
+	Xil_BinLogSetSink(XPlmi_BinLogOutput, XPlmi_BinLogKick, NULL);
+}
+#endif
+
 /*****************************************************************************/
 /**
  * @brief   This function prints debug messages with timestamp
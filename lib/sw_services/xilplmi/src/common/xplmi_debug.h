@@ -32,6 +32,8 @@
 *       bm   08/12/2021 Added support to configure uart during run-time
 *       bsv  09/05/2021 Disable prints in slave boot modes in case of error
 * 1.06  bm   07/06/2022 Refactor versal and versal_net code
+*       ag   10/15/2026 Record only prints with integer arguments in the
+*                       binary log and format the others as text
 *
 * </pre>
 *
@@ -51,6 +53,10 @@ extern "C" {
 #include "xplmi_config.h"
 #include "xplmi_event_logging.h"
 #include "xplmi_proc.h"
+#if defined (PLM_PRINT_BINLOG) && defined (XIL_BINLOG_ENABLE)
+#define XPLMI_PRINT_BINLOG
+#include "xil_binlog.h"
+#endif
 
 /**@cond xplmi_internal
  * @{
@@ -74,6 +80,9 @@ extern "C" {
 int XPlmi_InitUart(void);
 void XPlmi_Print(u16 DebugType, const char8 *Ctrl1, ...);
 int XPlmi_ConfigUart(u8 UartSelect, u8 UartEnable);
+#ifdef XPLMI_PRINT_BINLOG
+void XPlmi_InitBinLog(void);
+#endif
 
 /***************** Macros (Inline Functions) Definitions *********************/
 #ifdef PLM_PRINT_PERF
@@ -98,6 +107,34 @@ int XPlmi_ConfigUart(u8 UartSelect, u8 UartEnable);
 
 #define XPLMI_DEBUG_PRINT_TIMESTAMP_MASK		(0x100U)
 
+#ifdef XPLMI_PRINT_BINLOG
+/*
+ * Record prints with integer arguments only in the binary log, the host tool
+ * expands them. Prints with strings or pointers are formatted as text.
+ */
+#define XPlmi_BinLogPrintf(DebugType, ...) \
+	if(((DebugType) & (DebugLog->LogLevel)) != 0U) { \
+		XIL_BINLOG_INT_ONLY(__VA_ARGS__);\
+	}
+
+#define XPlmi_Printf(DebugType, ...) \
+	if(((DebugType) & (XPlmiDbgCurrentTypes)) != (u8)FALSE) { \
+		if (XIL_BINLOG_IS_INT_ONLY(__VA_ARGS__) != 0U) { \
+			XPlmi_BinLogPrintf(DebugType, __VA_ARGS__);\
+		} else { \
+			XPlmi_Print((DebugType | XPLMI_DEBUG_PRINT_TIMESTAMP_MASK), __VA_ARGS__);\
+		} \
+	}
+
+#define XPlmi_Printf_WoTS(DebugType, ...) \
+	if(((DebugType) & (XPlmiDbgCurrentTypes)) != (u8)FALSE) { \
+		if (XIL_BINLOG_IS_INT_ONLY(__VA_ARGS__) != 0U) { \
+			XPlmi_BinLogPrintf(DebugType, __VA_ARGS__);\
+		} else { \
+			XPlmi_Print(DebugType, __VA_ARGS__);\
+		} \
+	}
+#else
 #define XPlmi_Printf(DebugType, ...) \
 	if(((DebugType) & (XPlmiDbgCurrentTypes)) != (u8)FALSE) { \
 		XPlmi_Print((DebugType | XPLMI_DEBUG_PRINT_TIMESTAMP_MASK), __VA_ARGS__);\
@@ -108,6 +145,7 @@ int XPlmi_ConfigUart(u8 UartSelect, u8 UartEnable);
 	if(((DebugType) & (XPlmiDbgCurrentTypes)) != (u8)FALSE) { \
 		XPlmi_Print(DebugType, __VA_ARGS__);\
 	}
+#endif
 
 /* Check if UART is present in design */
 #if defined (STDOUT_BASEADDRESS)
@@ -43,6 +43,10 @@
 *       bm   01/20/2022 Fix compilation warnings in Xil_SMemCpy
 *       skd  03/03/2022 Minor bug fix in XPlmi_MemCpy64
 * 1.07  bm   07/06/2022 Refactor versal and versal_net code
+*       ag   10/14/2026 Added XPlmi_DmaXfrBatch and XPlmi_DmaXfrSplit APIs
+*                       and tracking of outstanding non blocking transfers
+*       ag   10/15/2026 Added background ECC initialization queue
+*       ag   10/15/2026 Added non blocking transfers to the slave SLRs
 *
 * </pre>
 *
@@ -64,6 +68,20 @@
 #define XPLMI_XCSUDMA_DEST_CTRL_OFFSET		(0x80CU)
 
 /**************************** Type Definitions *******************************/
+/* Memory region queued for ECC initialization */
+typedef struct {
+	u64 Addr; /**< Start address of the region */
+	u32 Len; /**< Length of the region in bytes */
+} XPlmi_EccRegion;
+
+/* ECC initializations run in the background, in the order queued */
+typedef struct {
+	XPlmi_EccRegion Region[XPLMI_ECC_INIT_MAX_REGIONS]; /**< Queued regions */
+	u32 Head; /**< Index of the oldest region */
+	u32 Count; /**< Number of regions, including the one in flight */
+	u32 DmaFlags; /**< PMC DMA of the region in flight, 0 if none */
+	int Status; /**< First error not yet returned to a waiter */
+} XPlmi_EccInitQueue;
 
 /***************** Macros (Inline Functions) Definitions *********************/
 
@@ -76,12 +94,23 @@ static void XPlmi_SSSCfgDmaSbi(u32 Flags);
 static int XPlmi_DmaChXfer(u64 Addr, u32 Len, XPmcDma_Channel Channel, u32 Flags);
 static int XPlmi_StartDma(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags,
                 XPmcDma** DmaPtrAddr);
+static int XPlmi_WaitForDmaDesc(XPmcDma *DmaPtr, const XPlmi_DmaDesc *Desc);
+static int XPlmi_EccInitProgress(u8 Block, u32 AvoidDma);
+static int XPlmi_EccInitSync(u64 Addr, u32 Len, u32 Flags);
+static int XPlmi_SlrDmaXfrSync(u32 Flags);
 
 /************************** Variable Definitions *****************************/
 static XPmcDma PmcDma0;		/**<Instance of the Pmc_Dma Device */
 static XPmcDma PmcDma1;		/**<Instance of the Pmc_Dma Device */
 static XPmcDma_Configure DmaCtrl = {0x40U, 0U, 0U, 0U, 0xFFEU, 0x80U,
 			0U, 0U, 0U, 0xFFFU, 0x8U};  /* Default values of CTRL */
+/* PMC DMAs (XPLMI_PMCDMA_0/XPLMI_PMCDMA_1) with a non blocking transfer
+ * that is not yet waited for */
+static u32 NonBlkDmaPending = 0U;
+static XPlmi_EccInitQueue EccInitQueue;
+/* Destination of the transfer to a slave SLR in flight on PMCDMA1, 0 if
+ * none */
+static u64 SlrXfrDestAddr = 0U;
 
 /*****************************************************************************/
 /**
@@ -168,6 +197,17 @@ XPmcDma *XPlmi_GetDmaInstance(u32 DeviceId)
 {
 	XPmcDma *PmcDmaPtr = NULL;
 
+	/*
+	 * The caller drives the DMA directly, so move the ECC initialization
+	 * off it. An error is returned by the next ECC initialization wait.
+	 */
+	if (DeviceId == (u32)PMCDMA_0_DEVICE_ID) {
+		(void)XPlmi_EccInitSync(0U, 0U, XPLMI_PMCDMA_0);
+	} else {
+		(void)XPlmi_EccInitSync(0U, 0U, XPLMI_PMCDMA_1);
+		(void)XPlmi_SlrDmaXfrSync(XPLMI_PMCDMA_1);
+	}
+
 	if (DeviceId == (u32)PMCDMA_0_DEVICE_ID) {
 		if (PmcDma0.IsReady != (u32)FALSE) {
 			PmcDmaPtr = &PmcDma0;
@@ -322,6 +362,16 @@ static int XPlmi_DmaChXfer(u64 Addr, u32 Len, XPmcDma_Channel Channel, u32 Flags
 	XPmcDma *DmaPtr;
 	XPlmi_WaitForDmaDone_t XPlmi_WaitForDmaDone;
 
+	Status = XPlmi_SlrDmaXfrSync(Flags);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	Status = XPlmi_EccInitSync(Addr, Len * XPLMI_WORD_LEN, Flags);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	Status = XST_FAILURE;
+
 	/* Select DMA pointer */
 	if ((Flags & XPLMI_PMCDMA_0) == XPLMI_PMCDMA_0) {
 		XPlmi_Printf(DEBUG_INFO, "PMCDMA0\n\r");
@@ -345,6 +395,7 @@ static int XPlmi_DmaChXfer(u64 Addr, u32 Len, XPmcDma_Channel Channel, u32 Flags
 
 	if (((Flags & XPLMI_DMA_SRC_NONBLK) != 0U) ||
 		((Flags & XPLMI_DMA_DST_NONBLK) != 0U)) {
+		NonBlkDmaPending |= (Flags & (XPLMI_PMCDMA_0 | XPLMI_PMCDMA_1));
 		Status = XST_SUCCESS;
 		goto END;
 	}
@@ -392,9 +443,11 @@ int XPlmi_WaitForNonBlkDma(u32 DmaFlags)
 
 	if ((DmaFlags & XPLMI_PMCDMA_0) == XPLMI_PMCDMA_0) {
 		PmcDmaPtr = &PmcDma0;
+		NonBlkDmaPending &= ~XPLMI_PMCDMA_0;
 	}
 	else {
 		PmcDmaPtr = &PmcDma1;
+		NonBlkDmaPending &= ~XPLMI_PMCDMA_1;
 	}
 
 	XPmcDma_SetConfig(PmcDmaPtr, XPMCDMA_SRC_CHANNEL, &DmaCtrl);
@@ -442,9 +495,11 @@ int XPlmi_WaitForNonBlkSrcDma(u32 DmaFlags)
 
 	if ((DmaFlags & XPLMI_PMCDMA_0) == XPLMI_PMCDMA_0) {
 		PmcDmaPtr = &PmcDma0;
+		NonBlkDmaPending &= ~XPLMI_PMCDMA_0;
 	}
 	else {
 		PmcDmaPtr = &PmcDma1;
+		NonBlkDmaPending &= ~XPLMI_PMCDMA_1;
 	}
 
 	XPmcDma_SetConfig(PmcDmaPtr, XPMCDMA_SRC_CHANNEL, &DmaCtrl);
@@ -482,9 +537,11 @@ int XPlmi_WaitForNonBlkDestDma(u32 DmaFlags)
 
 	if ((DmaFlags & XPLMI_PMCDMA_0) == XPLMI_PMCDMA_0) {
 		PmcDmaPtr = &PmcDma0;
+		NonBlkDmaPending &= ~XPLMI_PMCDMA_0;
 	}
 	else {
 		PmcDmaPtr = &PmcDma1;
+		NonBlkDmaPending &= ~XPLMI_PMCDMA_1;
 	}
 
 	Status = XPmcDma_WaitForDone(PmcDmaPtr, XPMCDMA_DST_CHANNEL);
@@ -503,6 +560,98 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function starts a DMA to DMA transfer to a slave SLR on
+ * PMCDMA1 and returns without waiting for it, so that the master can carry
+ * on with its own commands while the data is sent. The transfer to a slave
+ * SLR in flight, if any, is completed first. Transfers are completed by
+ * XPlmi_WaitForSlrDmaXfr or by the next use of PMCDMA1. The source must not
+ * be modified until the transfer is completed.
+ *
+ * @param	SrcAddr for SRC channel to fetch data from
+ * @param	DestAddr is the slave SLR address to store the data
+ * @param	Len of the data in words
+ *
+ * @return	XST_SUCCESS on success and error codes on failure
+ *
+ *****************************************************************************/
+int XPlmi_SlrDmaXfr(u64 SrcAddr, u64 DestAddr, u32 Len)
+{
+	int Status = XST_FAILURE;
+
+	Status = XPlmi_WaitForSlrDmaXfr();
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	Status = XPlmi_DmaXfr(SrcAddr, DestAddr, Len,
+		XPLMI_PMCDMA_1 | XPLMI_DMA_SRC_NONBLK);
+	if ((Status == XST_SUCCESS) && (Len != 0U)) {
+		SlrXfrDestAddr = DestAddr;
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function waits for the transfer to a slave SLR started by
+ * XPlmi_SlrDmaXfr, if any, to complete.
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+int XPlmi_WaitForSlrDmaXfr(void)
+{
+	int Status = XST_FAILURE;
+	XPlmi_WaitForDmaDone_t XPlmi_WaitForDmaDone;
+
+	if (SlrXfrDestAddr == 0U) {
+		Status = XST_SUCCESS;
+		goto END;
+	}
+
+	/* Wait the way a blocking transfer to the same address would */
+	XPlmi_WaitForDmaDone = XPlmi_GetPlmiWaitForDone(SlrXfrDestAddr);
+	SlrXfrDestAddr = 0U;
+	if (XPlmi_WaitForDmaDone != NULL) {
+		Status = XPlmi_WaitForDmaDone(&PmcDma1, XPMCDMA_DST_CHANNEL);
+	}
+	if (Status != XST_SUCCESS) {
+		NonBlkDmaPending &= ~XPLMI_PMCDMA_1;
+		Status = XPlmi_UpdateStatus(XPLMI_ERR_DMA_XFER_WAIT_DEST, Status);
+		goto END;
+	}
+
+	Status = XPlmi_WaitForNonBlkDma(XPLMI_PMCDMA_1);
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function completes the transfer to a slave SLR in flight
+ * before PMCDMA1 is used for another transfer.
+ *
+ * @param	Flags to select the PMC DMA about to be used
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XPlmi_SlrDmaXfrSync(u32 Flags)
+{
+	int Status = XST_SUCCESS;
+
+	if ((Flags & XPLMI_PMCDMA_1) == XPLMI_PMCDMA_1) {
+		Status = XPlmi_WaitForSlrDmaXfr();
+	}
+
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function is used to transfer the data from SBI to DMA.
@@ -584,6 +733,20 @@ int XPlmi_DmaXfr(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags)
 		goto END;
 	}
 
+	Status = XPlmi_SlrDmaXfrSync(Flags);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	Status = XPlmi_EccInitSync(SrcAddr, Len * XPLMI_WORD_LEN, Flags);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	Status = XPlmi_EccInitSync(DestAddr, Len * XPLMI_WORD_LEN, Flags);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	Status = XST_FAILURE;
+
 	XPlmi_WaitForDmaDone = XPlmi_GetPlmiWaitForDone(DestAddr);
 	if (XPlmi_WaitForDmaDone == NULL) {
 		goto END;
@@ -594,6 +757,9 @@ int XPlmi_DmaXfr(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags)
 		goto END;
 	}
 
+	if ((Flags & (XPLMI_DMA_SRC_NONBLK | XPLMI_DMA_DST_NONBLK)) != (u32)FALSE) {
+		NonBlkDmaPending |= (Flags & (XPLMI_PMCDMA_0 | XPLMI_PMCDMA_1));
+	}
 	if ((Flags & XPLMI_DMA_SRC_NONBLK) != (u32)FALSE) {
 		goto END;
 	}
@@ -646,6 +812,204 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function waits for a DMA to DMA transfer started for the
+ * given descriptor to complete and acknowledges it.
+ *
+ * @param	DmaPtr is pointer to the DMA instance used for the transfer
+ * @param	Desc is pointer to the descriptor of the transfer
+ *
+ * @return	XST_SUCCESS on success and error codes on failure
+ *
+ *****************************************************************************/
+static int XPlmi_WaitForDmaDesc(XPmcDma *DmaPtr, const XPlmi_DmaDesc *Desc)
+{
+	int Status = XST_FAILURE;
+	XPlmi_WaitForDmaDone_t XPlmi_WaitForDmaDone =
+		XPlmi_GetPlmiWaitForDone(Desc->DestAddr);
+
+	if (XPlmi_WaitForDmaDone == NULL) {
+		goto END;
+	}
+	Status = XPlmi_WaitForDmaDone(DmaPtr, XPMCDMA_SRC_CHANNEL);
+	if (Status != XST_SUCCESS) {
+		Status = XPlmi_UpdateStatus(XPLMI_ERR_DMA_XFER_WAIT_SRC, Status);
+		goto END;
+	}
+	Status = XPlmi_WaitForDmaDone(DmaPtr, XPMCDMA_DST_CHANNEL);
+	if (Status != XST_SUCCESS) {
+		Status = XPlmi_UpdateStatus(XPLMI_ERR_DMA_XFER_WAIT_DEST, Status);
+		goto END;
+	}
+	/* To acknowledge the transfer has completed */
+	XPmcDma_IntrClear(DmaPtr, XPMCDMA_SRC_CHANNEL, XPMCDMA_IXR_DONE_MASK);
+	XPmcDma_IntrClear(DmaPtr, XPMCDMA_DST_CHANNEL, XPMCDMA_IXR_DONE_MASK);
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function performs a batch of DMA to DMA transfers. The
+ * descriptors are distributed alternately on PMCDMA0 and PMCDMA1 so that
+ * two transfers are always in flight, and the next descriptor of a DMA is
+ * started as soon as its previous transfer completes. A DMA that has a non
+ * blocking transfer outstanding is not used. If neither DMA is free, the
+ * batch is executed on the DMA selected in Flags one descriptor at a time.
+ * Data must not overlap between descriptors as their order of completion
+ * is not defined.
+ *
+ * @param	Desc is pointer to the array of transfer descriptors
+ * @param	Count is the number of descriptors in the array
+ * @param	Flags to select PMC DMA and DMA Burst type. Non blocking flags are
+ *		not supported and are ignored.
+ *
+ * @return	XST_SUCCESS on success and error codes on failure
+ *
+ *****************************************************************************/
+int XPlmi_DmaXfrBatch(const XPlmi_DmaDesc *Desc, u32 Count, u32 Flags)
+{
+	int Status = XST_FAILURE;
+	int SStatus = XST_FAILURE;
+	u32 Index;
+	u32 Dma;
+	u32 NumDma = 0U;
+	u32 DmaSel[2U];
+	XPmcDma *DmaPtr[2U] = {NULL, NULL};
+	const XPlmi_DmaDesc *InFlight[2U] = {NULL, NULL};
+	u32 XfrFlags = Flags & (~(XPLMI_DMA_SRC_NONBLK | XPLMI_DMA_DST_NONBLK |
+		XPLMI_PMCDMA_0 | XPLMI_PMCDMA_1));
+
+	if (Desc == NULL) {
+		goto END;
+	}
+
+	for (Index = 0U; Index < Count; ++Index) {
+		Status = XPlmi_EccInitSync(Desc[Index].SrcAddr,
+			Desc[Index].Len * XPLMI_WORD_LEN, 0U);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+		Status = XPlmi_EccInitSync(Desc[Index].DestAddr,
+			Desc[Index].Len * XPLMI_WORD_LEN, 0U);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+	Status = XST_FAILURE;
+
+	if ((NonBlkDmaPending & XPLMI_PMCDMA_0) == 0U) {
+		DmaSel[NumDma] = XPLMI_PMCDMA_0;
+		++NumDma;
+	}
+	if ((NonBlkDmaPending & XPLMI_PMCDMA_1) == 0U) {
+		DmaSel[NumDma] = XPLMI_PMCDMA_1;
+		++NumDma;
+	}
+
+	/*
+	 * AXI fixed burst updates the common DMA control configuration, so such
+	 * transfers are not overlapped
+	 */
+	if ((NumDma < 2U) || ((XfrFlags &
+		(XPLMI_SRC_CH_AXI_FIXED | XPLMI_DST_CH_AXI_FIXED)) != 0U)) {
+		if (NumDma == 0U) {
+			DmaSel[0U] = Flags & (XPLMI_PMCDMA_0 | XPLMI_PMCDMA_1);
+		}
+		Status = XST_SUCCESS;
+		for (Index = 0U; Index < Count; ++Index) {
+			Status = XPlmi_DmaXfr(Desc[Index].SrcAddr,
+				Desc[Index].DestAddr, Desc[Index].Len,
+				XfrFlags | DmaSel[0U]);
+			if (Status != XST_SUCCESS) {
+				break;
+			}
+		}
+		goto END;
+	}
+
+	Status = XST_SUCCESS;
+	for (Index = 0U; Index < Count; ++Index) {
+		Dma = Index & 1U;
+		if (InFlight[Dma] != NULL) {
+			Status = XPlmi_WaitForDmaDesc(DmaPtr[Dma], InFlight[Dma]);
+			InFlight[Dma] = NULL;
+			if (Status != XST_SUCCESS) {
+				break;
+			}
+		}
+		if (Desc[Index].Len == 0U) {
+			continue;
+		}
+		if (XPlmi_GetPlmiWaitForDone(Desc[Index].DestAddr) == NULL) {
+			Status = XST_FAILURE;
+			break;
+		}
+		Status = XPlmi_StartDma(Desc[Index].SrcAddr, Desc[Index].DestAddr,
+			Desc[Index].Len, XfrFlags | DmaSel[Dma], &DmaPtr[Dma]);
+		if (Status != XST_SUCCESS) {
+			break;
+		}
+		InFlight[Dma] = &Desc[Index];
+	}
+
+	/* Wait for the transfers which are still in flight */
+	for (Dma = 0U; Dma < 2U; ++Dma) {
+		if (InFlight[Dma] != NULL) {
+			SStatus = XPlmi_WaitForDmaDesc(DmaPtr[Dma], InFlight[Dma]);
+			if (Status == XST_SUCCESS) {
+				Status = SStatus;
+			}
+		}
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function performs a blocking DMA to DMA transfer and splits
+ * it in two halves transferred in parallel on PMCDMA0 and PMCDMA1. Short
+ * transfers, AXI fixed transfers and transfers for which one of the DMAs is
+ * busy with a non blocking transfer are done using XPlmi_DmaXfr.
+ *
+ * @param	SrcAddr for SRC channel to fetch data from
+ * @param	DestAddr for DST channel to store the data
+ * @param	Len of the data in words
+ * @param	Flags to select PMC DMA and DMA Burst type
+ *
+ * @return	XST_SUCCESS on success and error codes on failure
+ *
+ *****************************************************************************/
+int XPlmi_DmaXfrSplit(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags)
+{
+	int Status = XST_FAILURE;
+	XPlmi_DmaDesc Desc[2U];
+	/* Split on a 16 byte boundary to keep the AXI bursts aligned */
+	u32 FirstLen = (Len >> 1U) & ~(XPLMI_WORD_LEN - 1U);
+
+	if ((Len < XPLMI_DMA_SPLIT_MIN_LEN) || (NonBlkDmaPending != 0U) ||
+		((Flags & (XPLMI_SRC_CH_AXI_FIXED | XPLMI_DST_CH_AXI_FIXED |
+		XPLMI_DMA_SRC_NONBLK | XPLMI_DMA_DST_NONBLK)) != 0U)) {
+		Status = XPlmi_DmaXfr(SrcAddr, DestAddr, Len, Flags);
+		goto END;
+	}
+
+	Desc[0U].SrcAddr = SrcAddr;
+	Desc[0U].DestAddr = DestAddr;
+	Desc[0U].Len = FirstLen;
+	Desc[1U].SrcAddr = SrcAddr + ((u64)FirstLen * XPLMI_WORD_LEN);
+	Desc[1U].DestAddr = DestAddr + ((u64)FirstLen * XPLMI_WORD_LEN);
+	Desc[1U].Len = Len - FirstLen;
+	Status = XPlmi_DmaXfrBatch(Desc, 2U, Flags);
+
+END:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function is used initiate the DMA to DMA transfer.
@@ -708,28 +1072,348 @@ static int XPlmi_StartDma(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags,
 
 /*****************************************************************************/
 /**
- * @brief	This function is used to ECC initialize the memory.
+ * @brief	This function returns the PMC DMA instance selected in Flags.
  *
- * @param	Addr is  memory address to be initialized
- * @param	Len is size of memory to be initialized in bytes
+ * @param	DmaFlags is XPLMI_PMCDMA_0 or XPLMI_PMCDMA_1
  *
- * @return	Status of the DMA transfer
+ * @return	Pointer to the PMC DMA instance
  *
  *****************************************************************************/
-int XPlmi_EccInit(u64 Addr, u32 Len)
+static XPmcDma *XPlmi_EccInitDmaPtr(u32 DmaFlags)
+{
+	XPmcDma *DmaPtr = &PmcDma1;
+
+	if (DmaFlags == XPLMI_PMCDMA_0) {
+		DmaPtr = &PmcDma0;
+	}
+
+	return DmaPtr;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function starts the ECC initialization of the oldest queued
+ * region, from PZM on the DST channel of a PMC DMA. The DMA is marked as
+ * busy with a non blocking transfer so that batched and split transfers do
+ * not use it.
+ *
+ * @param	DmaFlags is XPLMI_PMCDMA_0 or XPLMI_PMCDMA_1
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XPlmi_EccInitStart(u32 DmaFlags)
 {
+	const XPlmi_EccRegion *Region = &EccInitQueue.Region[EccInitQueue.Head];
+
 	XPlmi_Printf(DEBUG_INFO, "PZM to Dma Xfer Dest 0x%0x%08x, Len 0x%0x: ",
-		(u32)(Addr >> 32U), (u32)Addr, Len / XPLMI_WORD_LEN);
+		(u32)(Region->Addr >> 32U), (u32)Region->Addr,
+		Region->Len / XPLMI_WORD_LEN);
 
 	/* Configure the secure stream switch */
-	XPlmi_SSSCfgDmaPzm(XPLMI_PMCDMA_0);
+	XPlmi_SSSCfgDmaPzm(DmaFlags);
 
 	/* Configure PZM length in 128bit */
-	XPlmi_Out32(PMC_GLOBAL_PRAM_ZEROIZE_SIZE, Len / XPLMI_PZM_WORD_LEN);
+	XPlmi_Out32(PMC_GLOBAL_PRAM_ZEROIZE_SIZE, Region->Len / XPLMI_PZM_WORD_LEN);
 
 	/* Receive the data from destination channel */
-	return XPlmi_DmaChXfer(Addr, Len / XPLMI_WORD_LEN, XPMCDMA_DST_CHANNEL,
-		XPLMI_PMCDMA_0);
+	XPmcDma_64BitTransfer(XPlmi_EccInitDmaPtr(DmaFlags), XPMCDMA_DST_CHANNEL,
+		(u32)(Region->Addr), (u32)(Region->Addr >> 32U),
+		Region->Len / XPLMI_WORD_LEN, 0U);
+
+	EccInitQueue.DmaFlags = DmaFlags;
+	NonBlkDmaPending |= DmaFlags;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function waits for the ECC initialization in flight and
+ * removes its region from the queue. The first error is kept for the next
+ * ECC initialization wait.
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XPlmi_EccInitComplete(void)
+{
+	int Status = XST_FAILURE;
+	const XPlmi_EccRegion *Region = &EccInitQueue.Region[EccInitQueue.Head];
+	XPmcDma *DmaPtr = XPlmi_EccInitDmaPtr(EccInitQueue.DmaFlags);
+	XPlmi_WaitForDmaDone_t XPlmi_WaitForDmaDone;
+
+	XPlmi_WaitForDmaDone = XPlmi_GetPlmiWaitForDone(Region->Addr);
+	if (XPlmi_WaitForDmaDone != NULL) {
+		Status = XPlmi_WaitForDmaDone(DmaPtr, XPMCDMA_DST_CHANNEL);
+	}
+	if (Status != XST_SUCCESS) {
+		Status = XPlmi_UpdateStatus(XPLMI_ERR_DMA_XFER_WAIT, 0);
+		if (EccInitQueue.Status == XST_SUCCESS) {
+			EccInitQueue.Status = Status;
+		}
+	}
+
+	/* To acknowledge the transfer has completed */
+	XPmcDma_IntrClear(DmaPtr, XPMCDMA_DST_CHANNEL, XPMCDMA_IXR_DONE_MASK);
+	NonBlkDmaPending &= ~EccInitQueue.DmaFlags;
+	EccInitQueue.DmaFlags = 0U;
+	EccInitQueue.Head = (EccInitQueue.Head + 1U) % XPLMI_ECC_INIT_MAX_REGIONS;
+	--EccInitQueue.Count;
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function completes the ECC initialization in flight, if
+ * any, and starts the next queued one. Regions run in the background on
+ * PMCDMA1 only, as PMCDMA0 is also driven directly through
+ * XPlmi_GetDmaInstance by the secure and loader code.
+ *
+ * @param	Block is TRUE to wait for the region in flight and, when PMCDMA1
+ *		can not be used, to initialize the next region before
+ *		returning, on PMCDMA0 if PMCDMA1 has a non blocking transfer
+ *		outstanding. If it is FALSE the region in flight is completed
+ *		only if the DMA is done.
+ * @param	AvoidDma is the PMC DMA the caller is about to use, 0 if none.
+ *		No region is left in flight on it.
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XPlmi_EccInitProgress(u8 Block, u32 AvoidDma)
+{
+	int Status = XST_SUCCESS;
+
+	if (EccInitQueue.DmaFlags != 0U) {
+		if ((Block == (u8)FALSE) && ((XPmcDma_IntrGetStatus(
+			XPlmi_EccInitDmaPtr(EccInitQueue.DmaFlags),
+			XPMCDMA_DST_CHANNEL) & XPMCDMA_IXR_DONE_MASK) == 0U)) {
+			goto END;
+		}
+		Status = XPlmi_EccInitComplete();
+	}
+
+	if (EccInitQueue.Count == 0U) {
+		goto END;
+	}
+	if (((NonBlkDmaPending | AvoidDma) & XPLMI_PMCDMA_1) == 0U) {
+		XPlmi_EccInitStart(XPLMI_PMCDMA_1);
+	} else if (Block == (u8)TRUE) {
+		if ((NonBlkDmaPending & XPLMI_PMCDMA_1) == 0U) {
+			XPlmi_EccInitStart(XPLMI_PMCDMA_1);
+		} else {
+			XPlmi_EccInitStart(XPLMI_PMCDMA_0);
+		}
+		Status = XPlmi_EccInitComplete();
+	} else {
+		/* Started by a later call */
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function checks if a memory range overlaps a region whose
+ * ECC initialization is not complete.
+ *
+ * @param	Addr is start address of the range
+ * @param	Len is length of the range in bytes
+ *
+ * @return	TRUE if the range overlaps a queued region, FALSE otherwise
+ *
+ *****************************************************************************/
+static u8 XPlmi_EccInitIsPending(u64 Addr, u32 Len)
+{
+	u8 IsPending = (u8)FALSE;
+	const XPlmi_EccRegion *Region;
+	u32 Index;
+
+	for (Index = 0U; Index < EccInitQueue.Count; ++Index) {
+		Region = &EccInitQueue.Region[(EccInitQueue.Head + Index) %
+			XPLMI_ECC_INIT_MAX_REGIONS];
+		if ((Addr < (Region->Addr + Region->Len)) &&
+			(Region->Addr < (Addr + Len))) {
+			IsPending = (u8)TRUE;
+			break;
+		}
+	}
+
+	return IsPending;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function prepares a PMC DMA transfer for the background ECC
+ * initialization. It waits for the regions the transfer overlaps and moves
+ * the ECC initialization off the DMAs selected in Flags.
+ *
+ * @param	Addr is the address accessed by the transfer
+ * @param	Len is length of the transfer in bytes
+ * @param	Flags to select the PMC DMA used by the transfer
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XPlmi_EccInitSync(u64 Addr, u32 Len, u32 Flags)
+{
+	int Status = XST_SUCCESS;
+	u32 DmaFlags = Flags & (XPLMI_PMCDMA_0 | XPLMI_PMCDMA_1);
+
+	if (EccInitQueue.Count == 0U) {
+		goto END;
+	}
+
+	while ((EccInitQueue.DmaFlags & DmaFlags) != 0U) {
+		Status = XPlmi_EccInitProgress((u8)TRUE, DmaFlags);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+	Status = XPlmi_EccInitWait(Addr, Len);
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function queues the ECC initialization of a memory region
+ * and returns without waiting for it. Regions are initialized one after the
+ * other from PZM on PMCDMA1 while it has no other transfer outstanding. PMC
+ * DMA transfers wait for the regions they access, other users of a region
+ * must call
+ * XPlmi_EccInitWait or XPlmi_EccInitWaitAll before they access it.
+ *
+ * @param	Addr is memory address to be initialized
+ * @param	Len is size of memory to be initialized in bytes, a multiple of
+ *		XPLMI_PZM_WORD_LEN
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+int XPlmi_EccInitAsync(u64 Addr, u32 Len)
+{
+	int Status = XST_SUCCESS;
+	XPlmi_EccRegion *Region;
+
+	if (Len == 0U) {
+		goto END;
+	}
+
+	/* Make room by completing the oldest region */
+	while (EccInitQueue.Count == XPLMI_ECC_INIT_MAX_REGIONS) {
+		Status = XPlmi_EccInitProgress((u8)TRUE, 0U);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+
+	Region = &EccInitQueue.Region[(EccInitQueue.Head + EccInitQueue.Count) %
+		XPLMI_ECC_INIT_MAX_REGIONS];
+	Region->Addr = Addr;
+	Region->Len = Len;
+	++EccInitQueue.Count;
+
+	Status = XPlmi_EccInitProgress((u8)FALSE, 0U);
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function waits for the ECC initialization of the regions
+ * overlapping a memory range.
+ *
+ * @param	Addr is start address of the range
+ * @param	Len is length of the range in bytes
+ *
+ * @return	XST_SUCCESS on success and error code of the first failed ECC
+ *		initialization otherwise
+ *
+ *****************************************************************************/
+int XPlmi_EccInitWait(u64 Addr, u32 Len)
+{
+	int Status = XST_SUCCESS;
+
+	while (XPlmi_EccInitIsPending(Addr, Len) == (u8)TRUE) {
+		(void)XPlmi_EccInitProgress((u8)TRUE, 0U);
+	}
+
+	if (EccInitQueue.Status != XST_SUCCESS) {
+		Status = EccInitQueue.Status;
+		EccInitQueue.Status = XST_SUCCESS;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function tells whether no ECC initialization is queued and
+ * no error of one is left to be returned to a waiter.
+ *
+ * @return	TRUE if the ECC initialization queue is idle, FALSE otherwise
+ *
+ *****************************************************************************/
+u8 XPlmi_EccInitIsIdle(void)
+{
+	u8 IsIdle = (u8)FALSE;
+
+	if ((EccInitQueue.Count == 0U) &&
+		(EccInitQueue.Status == XST_SUCCESS)) {
+		IsIdle = (u8)TRUE;
+	}
+
+	return IsIdle;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function waits for all queued ECC initializations.
+ *
+ * @return	XST_SUCCESS on success and error code of the first failed ECC
+ *		initialization otherwise
+ *
+ *****************************************************************************/
+int XPlmi_EccInitWaitAll(void)
+{
+	int Status = XST_SUCCESS;
+
+	while (EccInitQueue.Count != 0U) {
+		(void)XPlmi_EccInitProgress((u8)TRUE, 0U);
+	}
+
+	if (EccInitQueue.Status != XST_SUCCESS) {
+		Status = EccInitQueue.Status;
+		EccInitQueue.Status = XST_SUCCESS;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function is used to ECC initialize the memory.
+ *
+ * @param	Addr is  memory address to be initialized
+ * @param	Len is size of memory to be initialized in bytes
+ *
+ * @return	Status of the DMA transfer
+ *
+ *****************************************************************************/
+int XPlmi_EccInit(u64 Addr, u32 Len)
+{
+	int Status = XST_FAILURE;
+
+	Status = XPlmi_EccInitAsync(Addr, Len);
+	if (Status == XST_SUCCESS) {
+		Status = XPlmi_EccInitWait(Addr, Len);
+	}
+
+	return Status;
 }
 
 
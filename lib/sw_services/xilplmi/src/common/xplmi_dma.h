@@ -28,6 +28,9 @@
 *       bsv  08/13/2021 Code clean up to reduce elf size
 * 1.05  bm   01/20/2022 Fix compilation warnings in Xil_SMemCpy
 * 1.06  bm   07/06/2022 Refactor versal and versal_net code
+*       ag   10/14/2026 Added batched and split DMA transfer APIs
+*       ag   10/15/2026 Added background ECC initialization APIs
+*       ag   10/15/2026 Added XPlmi_SlrDmaXfr and XPlmi_WaitForSlrDmaXfr APIs
 *
 * </pre>
 *
@@ -82,23 +85,42 @@ extern "C" {
 #define XPLMI_SET_CHUNK_SIZE			(128U)
 #define XPLMI_WORD_LEN_MASK			(0x3U)
 #define XPLMI_WORD_LEN_SHIFT			(0x2U)
+#define XPLMI_DMA_SPLIT_MIN_LEN			(0x1000U) /**< Min length in words
+							to split a transfer across both DMAs */
+#define XPLMI_ECC_INIT_MAX_REGIONS		(8U) /**< Max regions queued for
+							background ECC initialization */
 
 /* Type Definition of XPlmi_WaitForDmaDone */
 typedef int (*XPlmi_WaitForDmaDone_t)(XPmcDma *DmaPtr, XPmcDma_Channel Channel);
 
+/* DMA to DMA transfer descriptor used by XPlmi_DmaXfrBatch */
+typedef struct {
+	u64 SrcAddr; /**< Source address */
+	u64 DestAddr; /**< Destination address */
+	u32 Len; /**< Length of the transfer in words */
+} XPlmi_DmaDesc;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /************************** Function Prototypes ******************************/
 int XPlmi_DmaInit(void);
 XPmcDma *XPlmi_GetDmaInstance(u32 DeviceId);
 int XPlmi_DmaXfr(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags);
+int XPlmi_DmaXfrBatch(const XPlmi_DmaDesc *Desc, u32 Count, u32 Flags);
+int XPlmi_DmaXfrSplit(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags);
 int XPlmi_SbiDmaXfer(u64 DestAddr, u32 Len, u32 Flags);
 int XPlmi_DmaSbiXfer(u64 SrcAddr, u32 Len, u32 Flags);
 int XPlmi_EccInit(u64 Addr, u32 Len);
+int XPlmi_EccInitAsync(u64 Addr, u32 Len);
+int XPlmi_EccInitWait(u64 Addr, u32 Len);
+int XPlmi_EccInitWaitAll(void);
+u8 XPlmi_EccInitIsIdle(void);
 int XPlmi_InitNVerifyMem(u64 Addr, u32 Len);
 int XPlmi_WaitForNonBlkSrcDma(u32 DmaFlags);
 int XPlmi_WaitForNonBlkDestDma(u32 DmaFlags);
 int XPlmi_WaitForNonBlkDma(u32 DmaFlags);
+int XPlmi_SlrDmaXfr(u64 SrcAddr, u64 DestAddr, u32 Len);
+int XPlmi_WaitForSlrDmaXfr(void);
 void XPlmi_SetMaxOutCmds(u8 Val);
 int XPlmi_MemSet(u64 DestAddr, u32 Val, u32 Len);
 int XPlmi_MemSetBytes(void *const DestPtr, u32 DestLen, u8 Val, u32 Len);
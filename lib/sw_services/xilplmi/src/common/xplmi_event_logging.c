@@ -47,6 +47,8 @@
 *                       XPlmi_InitDebugLogBuffer function
 * 1.06  bsv  06/03/2022 Add CommandInfo to a separate section in elf
 *       bm   07/06/2022 Refactor versal and versal_net code
+*       ag   10/14/2026 Added sub command to print command statistics
+*       ag   10/15/2026 Added shared memory trace ring read without commands
 *
 * </pre>
 *
@@ -65,10 +67,21 @@
 #include "xil_util.h"
 #include "xplmi_modules.h"
 #include "xplmi_plat.h"
+#include "mb_interface.h"
 
 /************************** Constant Definitions *****************************/
 
 /**************************** Type Definitions *******************************/
+/* PLM state of the trace ring, counters are as in XPlmi_TraceRingHdr */
+typedef struct {
+	u64 Addr;	/**< Address of the ring header, 0 if not configured */
+	u32 Len;	/**< Length of the ring data in bytes */
+	u32 Reserve;	/**< End of the space reserved by producers */
+	u32 Head;	/**< End of the newest complete record */
+	u32 Tail;	/**< Start of the oldest complete record */
+	u32 Pending;	/**< Records reserved and not yet written */
+	u32 Dropped;	/**< Records not stored */
+} XPlmi_TraceRing;
 
 /***************** Macros (Inline Functions) Definitions *********************/
 
@@ -97,6 +110,7 @@
  * @cond xplmi_internal
  */
 XPlmi_LogInfo *DebugLog = (XPlmi_LogInfo *)(UINTPTR)XPLMI_RTCFG_DBG_LOG_BUF_ADDR;
+static XPlmi_TraceRing TraceRing;
 
 
 /*****************************************************************************/
@@ -217,6 +231,130 @@ static void XPlmi_RetrieveBufferInfo(XPlmi_Cmd *Cmd,
 	Cmd->Response[5U] = LogBuffer->IsBufferFull;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function configures the trace ring and publishes its address
+ * in RTCA, so that trace records can be read without a PLM command.
+ *
+ * @param 	Addr is the address of the ring header, 0 to disable the ring
+ * @param 	Len is the length of the ring data in bytes, a power of two of
+ *		at least XPLMI_TRACE_RING_MIN_LEN
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XPlmi_ConfigureTraceRing(u64 Addr, u32 Len)
+{
+	int Status = XST_FAILURE;
+
+	TraceRing.Addr = 0U;
+	XPlmi_Out32(XPLMI_RTCFG_TRACE_RING_ADDRLOW_ADDR, 0U);
+	XPlmi_Out32(XPLMI_RTCFG_TRACE_RING_ADDRHIGH_ADDR, 0U);
+	if (Addr == 0U) {
+		Status = XST_SUCCESS;
+		goto END;
+	}
+
+	if ((Len < XPLMI_TRACE_RING_MIN_LEN) || ((Len & (Len - 1U)) != 0U)) {
+		Status = (int)XPLMI_ERR_INVALID_LOG_BUF_LEN;
+		goto END;
+	}
+	if (((Addr & XPLMI_WORD_LEN_MASK) != 0U) || (XPlmi_VerifyAddrRange(Addr,
+		Addr + XPLMI_TRACE_RING_DATA_OFFSET + Len - 1U) != XST_SUCCESS)) {
+		Status = (int)XPLMI_ERR_INVALID_LOG_BUF_ADDR;
+		goto END;
+	}
+
+	TraceRing.Len = Len;
+	TraceRing.Reserve = 0U;
+	TraceRing.Head = 0U;
+	TraceRing.Tail = 0U;
+	TraceRing.Pending = 0U;
+	TraceRing.Dropped = 0U;
+	Status = XPlmi_MemSet(Addr, 0U,
+		XPLMI_TRACE_RING_DATA_OFFSET >> XPLMI_WORD_LEN_SHIFT);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	XPlmi_Out64(Addr, XPLMI_TRACE_RING_MAGIC);
+	XPlmi_Out64(Addr + XPLMI_WORD_LEN, XPLMI_TRACE_RING_VERSION);
+	XPlmi_Out64(Addr + (2U * XPLMI_WORD_LEN), Len);
+
+	TraceRing.Addr = Addr;
+	XPlmi_Out32(XPLMI_RTCFG_TRACE_RING_ADDRLOW_ADDR, (u32)Addr);
+	XPlmi_Out32(XPLMI_RTCFG_TRACE_RING_ADDRHIGH_ADDR, (u32)(Addr >> 32U));
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function stores a trace record to the trace ring. Space is
+ * reserved with interrupts masked, the record is written with interrupts
+ * enabled, so a record stored by a nested task while another one is written
+ * does not corrupt it. Head moves only when no record is being written.
+ *
+ * @param	TraceData is the trace record, with its length in the header
+ * @param	Len is number of words in TraceData
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XPlmi_StoreTraceRing(const u32 *TraceData, u32 Len)
+{
+	u64 DataAddr = TraceRing.Addr + XPLMI_TRACE_RING_DATA_OFFSET;
+	u32 Mask = TraceRing.Len - 1U;
+	u32 Bytes = Len << XPLMI_WORD_LEN_SHIFT;
+	u32 Pos;
+	u32 RecLen;
+	u32 Index;
+
+	microblaze_disable_interrupts();
+	/* Drop the oldest complete records to make room */
+	while ((TraceRing.Reserve + Bytes - TraceRing.Tail) > TraceRing.Len) {
+		RecLen = XPlmi_In64(DataAddr + (TraceRing.Tail & Mask)) >>
+			XPLMI_TRACE_LOG_LEN_SHIFT;
+		if ((TraceRing.Tail == TraceRing.Head) || (RecLen == 0U)) {
+			break;
+		}
+		TraceRing.Tail += RecLen << XPLMI_WORD_LEN_SHIFT;
+	}
+	if ((TraceRing.Reserve + Bytes - TraceRing.Tail) > TraceRing.Len) {
+		/* Only records still being written are left */
+		++TraceRing.Dropped;
+		XPlmi_Out64(TraceRing.Addr + XPLMI_TRACE_RING_DROPPED_OFFSET,
+			TraceRing.Dropped);
+		microblaze_enable_interrupts();
+		goto END;
+	}
+	XPlmi_Out64(TraceRing.Addr + XPLMI_TRACE_RING_TAIL_OFFSET,
+		TraceRing.Tail);
+	Pos = TraceRing.Reserve;
+	TraceRing.Reserve += Bytes;
+	/* Header first, so that the record can be dropped by a nested store */
+	XPlmi_Out64(DataAddr + (Pos & Mask), TraceData[0U]);
+	++TraceRing.Pending;
+	microblaze_enable_interrupts();
+
+	for (Index = 1U; Index < Len; Index++) {
+		XPlmi_Out64(DataAddr + ((Pos + (Index << XPLMI_WORD_LEN_SHIFT)) &
+			Mask), TraceData[Index]);
+	}
+
+	microblaze_disable_interrupts();
+	--TraceRing.Pending;
+	if (TraceRing.Pending == 0U) {
+		TraceRing.Head = TraceRing.Reserve;
+		XPlmi_Out64(TraceRing.Addr + XPLMI_TRACE_RING_HEAD_OFFSET,
+			TraceRing.Head);
+	}
+	microblaze_enable_interrupts();
+
+END:
+	return;
+}
+
 /**
  * @}
  * @endcond
@@ -248,6 +386,12 @@ static void XPlmi_RetrieveBufferInfo(XPlmi_Cmd *Cmd,
  *		8 - Configure Uart
  *			Arg1 - Uart Select
  *			Arg2 - Uart Enable
+ *		9 - Print command statistics (requires PLM_CDO_CMD_STATS)
+ *			Arg1 - Clear statistics after printing if non zero
+ *		10 - Configure Trace ring memory, 0 address disables the ring
+ *			Arg1 - High Address
+ *			Arg2 - Low Address
+ *			Arg3 - Length of the ring data
  *
  * @param	Cmd is pointer to the command structure
 
@@ -305,6 +449,16 @@ int XPlmi_EventLogging(XPlmi_Cmd * Cmd)
 		case XPLMI_LOGGING_CMD_CONFIG_UART:
 			Status = XPlmi_ConfigUart((u8)Arg1, (u8)Arg2);
 			break;
+		case XPLMI_LOGGING_CMD_CONFIG_TRACE_RING:
+			Status = XPlmi_ConfigureTraceRing((Arg1 << 32U) | Arg2,
+					Arg3);
+			break;
+#ifdef PLM_CDO_CMD_STATS
+		case XPLMI_LOGGING_CMD_PRINT_CMD_STATS:
+			XPlmi_CmdStatsDump((u32)Arg1);
+			Status = XST_SUCCESS;
+			break;
+#endif
 		default:
 			XPlmi_Printf(DEBUG_GENERAL,
 				"Received invalid event logging command\n\r");
@@ -352,6 +506,10 @@ void XPlmi_StoreTraceLog(u32 *TraceData, u32 Len)
 		XPlmi_Out64((TraceLog->StartAddr + TraceLog->Offset), TraceData[Index]);
 		TraceLog->Offset += XPLMI_WORD_LEN;
 	}
+
+	if ((TraceRing.Addr != 0U) && (Len < (TraceRing.Len >> 1U))) {
+		XPlmi_StoreTraceRing(TraceData, Len);
+	}
 }
 
 /*****************************************************************************/
@@ -29,6 +29,9 @@
 *       bsv  07/19/2021 Disable UART prints when invalid header is encountered
 *                       in slave boot modes
 *       bm   08/12/2021 Added support to configure uart during run-time
+*       ag   10/14/2026 Added command statistics logging sub command
+*       ag   10/14/2026 Added partition load time trace event
+*       ag   10/15/2026 Added shared memory trace ring
 *
 *
 * </pre>
@@ -67,6 +70,38 @@ typedef struct {
 	u8 PrintToBuf;	/**< If set, log is also written to PMC_RAM */
 } XPlmi_LogInfo;
 
+/*
+ * Header of the trace ring configured with XPLMI_LOGGING_CMD_CONFIG_TRACE_RING
+ * and published in RTCA. The header is followed by Len bytes of trace
+ * records, in the TraceBuffer format below. Head and Tail are free running
+ * byte counters, a record starts at data offset (counter & (Len - 1)) and
+ * may wrap to the start of the data. Records in [Tail, Head) are complete.
+ *
+ * PLM updates Tail before it overwrites the oldest records and Head after
+ * the new records are written, and never waits for the reader. A reader
+ * keeps its own counter: it reads Head, copies the records from its counter
+ * (or from Tail if that is ahead) up to Head and reads Tail again. Records
+ * below the new Tail may have been overwritten during the copy and are
+ * discarded, the reader continues from Head.
+ */
+typedef struct {
+	u32 Magic;	/**< XPLMI_TRACE_RING_MAGIC */
+	u32 Version;	/**< XPLMI_TRACE_RING_VERSION */
+	u32 Len;	/**< Length of the data in bytes, a power of two */
+	u32 Head;	/**< End of the newest complete record */
+	u32 Tail;	/**< Start of the oldest complete record */
+	u32 Dropped;	/**< Records not stored as the ring was busy */
+	u32 Reserved[2U];	/**< Reserved */
+} XPlmi_TraceRingHdr;
+
+#define XPLMI_TRACE_RING_MAGIC		(0x474E5254U) /* "TRNG" */
+#define XPLMI_TRACE_RING_VERSION	(0x1U)
+#define XPLMI_TRACE_RING_HEAD_OFFSET	(0xCU)
+#define XPLMI_TRACE_RING_TAIL_OFFSET	(0x10U)
+#define XPLMI_TRACE_RING_DROPPED_OFFSET	(0x14U)
+#define XPLMI_TRACE_RING_DATA_OFFSET	(0x20U)
+#define XPLMI_TRACE_RING_MIN_LEN	(0x100U)
+
 /**@cond xplmi_internal
  * @{
  */
@@ -86,6 +121,8 @@ void XPlmi_InitDebugLogBuffer(void);
 #define XPLMI_LOGGING_CMD_RETRIEVE_TRACE_DATA	(0x6U)
 #define XPLMI_LOGGING_CMD_RETRIEVE_TRACE_BUFFER_INFO	(0x7U)
 #define XPLMI_LOGGING_CMD_CONFIG_UART			(0x8U)
+#define XPLMI_LOGGING_CMD_PRINT_CMD_STATS		(0x9U)
+#define XPLMI_LOGGING_CMD_CONFIG_TRACE_RING		(0xAU)
 #define XPLMI_LOG_LEVEL_SHIFT		(0x4U)
 
 /* Trace log buffer length shift */
@@ -93,6 +130,22 @@ void XPlmi_InitDebugLogBuffer(void);
 
 /* Trace event IDs */
 #define XPLMI_TRACE_LOG_LOAD_IMAGE		(0x1U)
+#define XPLMI_TRACE_LOG_PRTN_PERF		(0x2U)
+
+/*
+ * Partition load time trace record, all times are in microseconds
+ * 		3U - Image ID
+ * 		4U - Partition number
+ * 		5U - Partition size in bytes
+ * 		6U - Total partition load time
+ * 		7U - Time spent waiting for device copy
+ * 		8U - Time spent in authentication and decryption
+ * 		9U - Time spent in CDO processing
+ */
+#define XPLMI_TRACE_PRTN_PERF_TOTAL_IDX		(6U)
+#define XPLMI_TRACE_PRTN_PERF_COPY_IDX		(7U)
+#define XPLMI_TRACE_PRTN_PERF_SECURE_IDX	(8U)
+#define XPLMI_TRACE_PRTN_PERF_EXEC_IDX		(9U)
 
 /*
  * Trace log functions
@@ -79,6 +79,13 @@
 *       bm   08/30/2022 Ignore strings in begin command beyond 24 characters
 *                       instead of erroring out
 *       bm   09/14/2022 Move ScatterWrite commands from common to versal_net
+*       ag   10/14/2026 Added GetTaskStats command
+*       ag   10/14/2026 Split large DmaXfer command transfers across both DMAs
+*       ag   10/14/2026 Added IpiMboxConfig and IpiMboxProcess commands
+*       ag   10/15/2026 Wait for background ECC initialization in write
+*       ag   10/15/2026 Do not wait for key hole transfers to the slave SLRs
+*                       when the caller completes them
+*                       commands
 *
 * </pre>
 *
@@ -107,6 +114,8 @@
 #endif
 #include "xplmi_plat.h"
 #include "xplmi_tamper.h"
+#include "xplmi_task.h"
+#include "xplmi_ipi.h"
 
 /**@cond xplmi_internal
  * @{
@@ -146,9 +155,13 @@ static XPlmi_ReadBackProps* XPlmi_GetReadBackPropsInstance(void);
 static int XPlmi_DmaUnalignedXfer(u64* SrcAddr, u64* DestAddr, u32* Len,
 	u8 Flag);
 static int XPlmi_KeyHoleXfr(XPlmi_KeyHoleXfrParams* KeyHoleXfrParams);
+static int XPlmi_SlrKeyHoleXfr(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags);
 static int XPlmi_StackPush(u32 *Data);
 static int XPlmi_StackPop(u32 PopLevel, u32 *Data);
 static int XPlmi_TamperTrigger(XPlmi_Cmd *Cmd);
+static int XPlmi_GetTaskStats(XPlmi_Cmd *Cmd);
+static int XPlmi_IpiMboxCfg(XPlmi_Cmd *Cmd);
+static int XPlmi_IpiMboxProc(XPlmi_Cmd *Cmd);
 
 /************************** Variable Definitions *****************************/
 static u32 OffsetList[XPLMI_BEGIN_OFFSET_STACK_SIZE] = {0U};
@@ -359,7 +372,7 @@ static int XPlmi_MaskPoll(XPlmi_Cmd *Cmd)
  *
  * @param	Cmd is pointer to the command structure
  *
- * @return	XST_SUCCESS
+ * @return	XST_SUCCESS on success and error code on failure
  *
  *****************************************************************************/
 static int XPlmi_MaskWrite(XPlmi_Cmd *Cmd)
@@ -375,9 +388,14 @@ static int XPlmi_MaskWrite(XPlmi_Cmd *Cmd)
 		"%s, Addr: 0x%08x,  Mask 0x%08x, Value: 0x%08x\n\r",
 		__func__, Addr, Mask, Value);
 
+	Status = XPlmi_EccInitWait((u64)Addr, XPLMI_WORD_LEN);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
 	XPlmi_UtilRMW(Addr, Mask, Value);
-	Status = XST_SUCCESS;
 
+END:
 	return Status;
 }
 
@@ -390,7 +408,7 @@ static int XPlmi_MaskWrite(XPlmi_Cmd *Cmd)
  *
  * @param	Cmd is pointer to the command structure
  *
- * @return	XST_SUCCESS
+ * @return	XST_SUCCESS on success and error code on failure
  *
  *****************************************************************************/
 static int XPlmi_Write(XPlmi_Cmd *Cmd)
@@ -405,9 +423,14 @@ static int XPlmi_Write(XPlmi_Cmd *Cmd)
 		"%s, Addr: 0x%0x,  Val: 0x%0x\n\r",
 		__func__, Addr, Value);
 
+	Status = XPlmi_EccInitWait((u64)Addr, XPLMI_WORD_LEN);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
 	XPlmi_Out32(Addr, Value);
-	Status = XST_SUCCESS;
 
+END:
 	return Status;
 }
 
@@ -611,7 +634,7 @@ static int XPlmi_MaskPoll64(XPlmi_Cmd *Cmd)
  *
  * @param	Cmd is pointer to the command structure
  *
- * @return	XST_SUCCESS
+ * @return	XST_SUCCESS on success and error code on failure
  *
  *****************************************************************************/
 static int XPlmi_MaskWrite64(XPlmi_Cmd *Cmd)
@@ -628,14 +651,19 @@ static int XPlmi_MaskWrite64(XPlmi_Cmd *Cmd)
 		"%s, Addr: 0x%0x%08x,  Mask 0x%0x, Val: 0x%0x\n\r",
 		__func__, (u32)(Addr >> 32U), (u32)Addr, Mask, Value);
 
+	Status = XPlmi_EccInitWait(Addr, XPLMI_WORD_LEN);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
 	/*
 	 * Read the Register value
 	 */
 	ReadVal = XPlmi_In64(Addr);
 	ReadVal = (ReadVal & (~Mask)) | (Mask & Value);
 	XPlmi_Out64(Addr, ReadVal);
-	Status = XST_SUCCESS;
 
+END:
 	return Status;
 }
 
@@ -649,7 +677,7 @@ static int XPlmi_MaskWrite64(XPlmi_Cmd *Cmd)
  *
  * @param	Cmd is pointer to the command structure
  *
- * @return	XST_SUCCESS
+ * @return	XST_SUCCESS on success and error code on failure
  *
  *****************************************************************************/
 static int XPlmi_Write64(XPlmi_Cmd *Cmd)
@@ -664,9 +692,14 @@ static int XPlmi_Write64(XPlmi_Cmd *Cmd)
 		"%s, Addr: 0x%0x%08x,  Val: 0x%0x\n\r",
 		__func__, (u32)(Addr>>32), (u32)Addr, Value);
 
+	Status = XPlmi_EccInitWait(Addr, XPLMI_WORD_LEN);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
 	XPlmi_Out64(Addr, Value);
-	Status = XST_SUCCESS;
 
+END:
 	return Status;
 }
 
@@ -899,7 +932,7 @@ static int XPlmi_DmaXfer(XPlmi_Cmd *Cmd)
 		if ((Flags & XPLMI_DMA_SRC_NPI) == XPLMI_DMA_SRC_NPI) {
 			Status = XPlmi_NpiRead(SrcAddr, DestAddr, Len);
 		} else {
-			Status = XPlmi_DmaXfr(SrcAddr, DestAddr, Len, Flags);
+			Status = XPlmi_DmaXfrSplit(SrcAddr, DestAddr, Len, Flags);
 		}
 	}
 	if (Status != XST_SUCCESS) {
@@ -1173,6 +1206,16 @@ static int XPlmi_DmaWriteKeyHole(XPlmi_Cmd *Cmd)
 	KeyHoleXfrParams.Keyholesize = Keyholesize;
 	KeyHoleXfrParams.Flags = XPLMI_PMCDMA_0;
 	KeyHoleXfrParams.Func = NULL;
+	/*
+	 * Let the slave SLR data go out on PMCDMA1 while the next commands are
+	 * processed, if the caller completes the transfer before reusing the
+	 * command buffer
+	 */
+	if ((Cmd->KeyHoleParams.IsSlrXfrNonBlk == (u8)TRUE) &&
+		(XPlmi_IsSlrAddr(BaseAddr) == (u8)TRUE)) {
+		KeyHoleXfrParams.Flags = XPLMI_PMCDMA_1;
+		KeyHoleXfrParams.Func = XPlmi_SlrKeyHoleXfr;
+	}
 	Status = XPlmi_KeyHoleXfr(&KeyHoleXfrParams);
 	if (Status != XST_SUCCESS) {
 		XPlmi_Printf(DEBUG_GENERAL, "DMA WRITE Key Hole Failed\n\r");
@@ -1965,6 +2008,109 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function fills the response buffer with the execution
+ *		statistics of a PLM task.
+ *		Command: GetTaskStats
+ *		Reserved[31:24]=0 Length[23:16]=[1] PLM=1 CMD_TASK_STATS=36
+ *		Payload = Task index, 0 to XPLMI_TASK_MAX - 1
+ *		Response[1] = Task priority
+ *		Response[2] = Number of times the task handler is run
+ *		Response[3..4] = Total run time in timer ticks (low, high)
+ *		Response[5..6] = Longest run time in timer ticks (low, high)
+ *		Response[7] = Maximum number of tasks
+ *
+ * @param	Cmd is pointer to the command structure
+ *
+ * @return	XST_SUCCESS on success and XST_INVALID_PARAM if there is no
+ *		task at the given index
+ *
+ *****************************************************************************/
+static int XPlmi_GetTaskStats(XPlmi_Cmd *Cmd)
+{
+	int Status = XST_FAILURE;
+	const XPlmi_TaskNode *Task;
+	XPLMI_EXPORT_CMD(XPLMI_TASK_STATS_CMD_ID, XPLMI_MODULE_GENERIC_ID,
+		XPLMI_CMD_ARG_CNT_ONE, XPLMI_CMD_ARG_CNT_ONE);
+
+	Cmd->Response[7U] = XPLMI_TASK_MAX;
+	Task = XPlmi_GetTaskByIndex(Cmd->Payload[0U]);
+	if (Task == NULL) {
+		Status = XST_INVALID_PARAM;
+		goto END;
+	}
+
+	Cmd->Response[1U] = Task->Priority;
+	Cmd->Response[2U] = Task->RunCount;
+	Cmd->Response[3U] = (u32)Task->TotalTime;
+	Cmd->Response[4U] = (u32)(Task->TotalTime >> 32U);
+	Cmd->Response[5U] = (u32)Task->MaxTime;
+	Cmd->Response[6U] = (u32)(Task->MaxTime >> 32U);
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function configures the shared memory mailbox of an IPI
+ *		channel. It is allowed only from CDO.
+ *		Command: IpiMboxConfig
+ *		Reserved[31:24]=0 Length[23:16]=[4] PLM=1 CMD_IPI_MBOX_CONFIG=37
+ *		Payload = IPI mask, Address high, Address low, Size in bytes
+ *
+ * @param	Cmd is pointer to the command structure
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XPlmi_IpiMboxCfg(XPlmi_Cmd *Cmd)
+{
+	int Status = XST_FAILURE;
+	XPLMI_EXPORT_CMD(XPLMI_IPI_MBOX_CONFIG_CMD_ID, XPLMI_MODULE_GENERIC_ID,
+		XPLMI_CMD_ARG_CNT_FOUR, XPLMI_CMD_ARG_CNT_FOUR);
+
+#ifdef XPLMI_IPI_DEVICE_ID
+	Status = XPlmi_IpiMboxConfig(Cmd->Payload[0U],
+		((u64)Cmd->Payload[1U] << 32U) | (u64)Cmd->Payload[2U],
+		Cmd->Payload[3U]);
+#else
+	(void)Cmd;
+#endif
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function processes the batch of requests in the mailbox
+ *		of the IPI channel the command is received on.
+ *		Command: IpiMboxProcess
+ *		Reserved[31:24]=0 Length[23:16]=[0] PLM=1 CMD_IPI_MBOX_PROCESS=38
+ *		Response[1] = Number of requests processed
+ *
+ * @param	Cmd is pointer to the command structure
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XPlmi_IpiMboxProc(XPlmi_Cmd *Cmd)
+{
+	int Status = XST_FAILURE;
+	XPLMI_EXPORT_CMD(XPLMI_IPI_MBOX_PROCESS_CMD_ID, XPLMI_MODULE_GENERIC_ID,
+		XPLMI_CMD_ARG_CNT_ZERO, XPLMI_CMD_ARG_CNT_ZERO);
+
+#ifdef XPLMI_IPI_DEVICE_ID
+	Status = XPlmi_IpiMboxProcess(Cmd);
+#else
+	(void)Cmd;
+#endif
+
+	return Status;
+}
+
 /**
  * @{
  * @cond xplmi_internal
@@ -2020,6 +2166,9 @@ void XPlmi_GenericInit(void)
 		XPLMI_MODULE_COMMAND(XPlmi_ScatterWrite),
 		XPLMI_MODULE_COMMAND(XPlmi_ScatterWrite2),
 		XPLMI_MODULE_COMMAND(XPlmi_TamperTrigger),
+		XPLMI_MODULE_COMMAND(XPlmi_GetTaskStats),
+		XPLMI_MODULE_COMMAND(XPlmi_IpiMboxCfg),
+		XPLMI_MODULE_COMMAND(XPlmi_IpiMboxProc),
 	};
 	/* This is to store CMD_END in xplm_modules section */
 	XPLMI_EXPORT_CMD(XPLMI_END_CMD_ID, XPLMI_MODULE_GENERIC_ID,
@@ -2195,6 +2344,27 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function starts a key hole transfer to a slave SLR without
+ * waiting for it. It is completed by XPlmi_WaitForSlrDmaXfr, by the next
+ * transfer to a slave SLR or by the next use of PMCDMA1.
+ *
+ * @param	SrcAddr is the address to read the data from
+ * @param	DestAddr is the slave SLR address to write the data to
+ * @param	Len is length of the data in bytes
+ * @param	Flags is unused, the transfer is always done on PMCDMA1
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XPlmi_SlrKeyHoleXfr(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags)
+{
+	(void)Flags;
+
+	return XPlmi_SlrDmaXfr(SrcAddr, DestAddr, Len / XPLMI_WORD_LEN);
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function provides DMA transfer to CFI in chunks of
@@ -150,6 +150,8 @@ typedef struct {
 #define XPLMI_PLM_GENERIC_EVENT_LOGGING_VAL	(0x13U)
 #define XPLMI_PLM_MODULES_GET_BOARD_VAL		(0x15U)
 #define XPLMI_PLM_GENERIC_TAMP_TRIGGER_VAL	(0x23U)
+#define XPLMI_PLM_GENERIC_TASK_STATS_VAL	(0x24U)
+#define XPLMI_PLM_GENERIC_IPI_MBOX_PROCESS_VAL	(0x26U)
 #define XPLMI_PLM_LOADER_SET_IMG_INFO_VAL	(0x4U)
 
 /* Define related to break */
@@ -67,6 +67,7 @@
  *       bm   07/06/2022 Refactor versal and versal_net code
  *       bm   07/18/2022 Shutdown modules gracefully during update
  *       sk   08/08/2022 Set IPI task's to low priority
+ *       ag   10/14/2026 Added shared memory mailbox for batched IPI requests
  *
  * </pre>
  *
@@ -85,12 +86,20 @@
 /************************** Constant Definitions *****************************/
 
 /**************************** Type Definitions *******************************/
+/* Shared memory mailbox of an IPI channel */
+typedef struct {
+	u64 Addr; /**< Start address of the mailbox */
+	u32 Size; /**< Size of the mailbox in bytes, 0 if not configured */
+} XPlmi_IpiMbox;
 
 /***************** Macros (Inline Functions) Definitions *********************/
 #define XPLMI_IPI_XSDB_MASTER_MASK	IPI_PMC_ISR_IPI5_BIT_MASK
 #define XPLMI_PMC_IMAGE_ID		(0x1C000001U)
 #define XPLMI_IPI_PMC_IMR_MASK		(0xFCU)
 #define XPLMI_IPI_PMC_IMR_SHIFT		(0x2U)
+#define XPLMI_IPI_MBOX_RESP_IDX_COUNT	(1U)
+#define XPLMI_IPI_MBOX_MIN_SIZE		((XPLMI_CMD_RESP_SIZE + 1U) * \
+					XPLMI_WORD_LEN * 2U)
 
 /************************** Function Prototypes ******************************/
 static int XPlmi_ValidateIpiCmd(XPlmi_Cmd *Cmd, u32 SrcIndex);
@@ -98,6 +107,7 @@ static u32 XPlmi_GetIpiReqType(u32 CmdId, u32 SrcIndex);
 static XPlmi_SubsystemHandler XPlmi_GetPmSubsystemHandler(
 	XPlmi_SubsystemHandler SubsystemHandler);
 static int XPlmi_IpiDispatchHandler(void *Data);
+static u32 XPlmi_IpiGetMaskIndex(u32 IpiMask);
 
 /************************** Variable Definitions *****************************/
 
@@ -105,6 +115,7 @@ static int XPlmi_IpiDispatchHandler(void *Data);
 /* Instance of IPI Driver */
 static XIpiPsu IpiInst;
 static XIpiPsu_Config *IpiCfgPtr;
+static XPlmi_IpiMbox IpiMbox[XPLMI_IPI_MASK_COUNT];
 
 /*****************************************************************************/
 /**
@@ -568,4 +579,198 @@ static u32 XPlmi_GetIpiReqType(u32 CmdId, u32 SrcIndex)
 END:
 	return IpiReqType;
 }
+
+/*****************************************************************************/
+/**
+ * @brief	This function returns the index of the IPI channel with the
+ * given mask in the IPI target list.
+ *
+ * @param	IpiMask is the IPI mask of the channel
+ *
+ * @return	Index of the channel and XPLMI_IPI_MASK_COUNT if not found
+ *
+ *****************************************************************************/
+static u32 XPlmi_IpiGetMaskIndex(u32 IpiMask)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < XPLMI_IPI_MASK_COUNT; Index++) {
+		if (IpiInst.Config.TargetList[Index].Mask == IpiMask) {
+			break;
+		}
+	}
+
+	return Index;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function configures the shared memory mailbox of an IPI
+ * channel. The first half of the mailbox holds the requests and the second
+ * half the responses. A size of zero removes the mailbox.
+ *
+ * @param	IpiMask is the IPI mask of the channel
+ * @param	Addr is the start address of the mailbox
+ * @param	Size is the size of the mailbox in bytes
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+int XPlmi_IpiMboxConfig(u32 IpiMask, u64 Addr, u32 Size)
+{
+	int Status = XST_FAILURE;
+	u32 Index = XPlmi_IpiGetMaskIndex(IpiMask);
+
+	if (Index == XPLMI_IPI_MASK_COUNT) {
+		Status = XPlmi_UpdateStatus(XPLMI_ERR_IPI_MBOX_INVALID_ADDR, 0);
+		goto END;
+	}
+
+	if (Size == 0U) {
+		IpiMbox[Index].Size = 0U;
+		Status = XST_SUCCESS;
+		goto END;
+	}
+
+	if (((Addr & XPLMI_WORD_LEN_MASK) != 0U) ||
+		((Size & XPLMI_WORD_LEN_MASK) != 0U) ||
+		(Size < XPLMI_IPI_MBOX_MIN_SIZE)) {
+		Status = XPlmi_UpdateStatus(XPLMI_ERR_IPI_MBOX_INVALID_ADDR, 0);
+		goto END;
+	}
+	Status = XPlmi_VerifyAddrRange(Addr, Addr + Size - 1U);
+	if (Status != XST_SUCCESS) {
+		Status = XPlmi_UpdateStatus(XPLMI_ERR_IPI_MBOX_INVALID_ADDR, Status);
+		goto END;
+	}
+
+	IpiMbox[Index].Addr = Addr;
+	IpiMbox[Index].Size = Size;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function processes the batch of requests in the shared
+ * memory mailbox of the IPI channel the command is received on, so that
+ * several requests are served with a single IPI round trip.
+ *
+ * Request half of the mailbox: word 0 is the number of requests, followed
+ * by the requests. Each request is an IPI command header with the payload
+ * length in bits [23:16], followed by its payload.
+ * Response half of the mailbox: XPLMI_CMD_RESP_SIZE words for each request,
+ * in request order, with the status of the request in the first word.
+ *
+ * Every request goes through the same validation and access checks as a
+ * command received in the IPI buffer. Processing stops at the first request
+ * that fails. The mailbox must be flushed by the sender before the IPI and
+ * invalidated before reading the responses.
+ *
+ * @param	Cmd is pointer to the IPI command. Response[1] is updated with
+ *		the number of requests processed.
+ *
+ * @return	XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+int XPlmi_IpiMboxProcess(XPlmi_Cmd *Cmd)
+{
+	int Status = XST_FAILURE;
+	static u32 ReqPayload[XPLMI_IPI_MBOX_MAX_CMD_LEN];
+	XPlmi_Cmd Req;
+	u32 Index = XPlmi_IpiGetMaskIndex(Cmd->IpiMask);
+	u32 Count = 0U;
+	u32 ReqNum;
+	u64 ReqAddr;
+	u64 ReqEnd;
+	u64 RespAddr;
+	u32 Header = 0U;
+	u32 Len;
+
+	Cmd->Response[XPLMI_IPI_MBOX_RESP_IDX_COUNT] = 0U;
+	if ((Index == XPLMI_IPI_MASK_COUNT) || (IpiMbox[Index].Size == 0U)) {
+		Status = XPlmi_UpdateStatus(XPLMI_ERR_IPI_MBOX_NOT_CONFIGURED, 0);
+		goto END;
+	}
+
+	ReqAddr = IpiMbox[Index].Addr;
+	ReqEnd = ReqAddr + (IpiMbox[Index].Size >> 1U);
+	RespAddr = ReqEnd;
+	Status = XPlmi_MemCpy64((u64)(UINTPTR)&Count, ReqAddr, XPLMI_WORD_LEN);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	ReqAddr += XPLMI_WORD_LEN;
+	if (Count > ((IpiMbox[Index].Size >> 1U) /
+		(XPLMI_CMD_RESP_SIZE * XPLMI_WORD_LEN))) {
+		Status = XPlmi_UpdateStatus(XPLMI_ERR_IPI_MBOX_INVALID_REQ, 0);
+		goto END;
+	}
+
+	for (ReqNum = 0U; ReqNum < Count; ++ReqNum) {
+		Status = XST_FAILURE;
+		if ((ReqAddr + XPLMI_WORD_LEN) > ReqEnd) {
+			Status = XPlmi_UpdateStatus(XPLMI_ERR_IPI_MBOX_INVALID_REQ, 0);
+			break;
+		}
+		Status = XPlmi_MemCpy64((u64)(UINTPTR)&Header, ReqAddr,
+			XPLMI_WORD_LEN);
+		if (Status != XST_SUCCESS) {
+			break;
+		}
+		ReqAddr += XPLMI_WORD_LEN;
+		Len = (Header >> 16U) & 255U;
+		/* Nested mailbox requests are not allowed */
+		if ((Len > XPLMI_IPI_MBOX_MAX_CMD_LEN) ||
+			((ReqAddr + ((u64)Len * XPLMI_WORD_LEN)) > ReqEnd) ||
+			((Header & (XPLMI_CMD_MODULE_ID_MASK |
+			XPLMI_PLM_GENERIC_CMD_ID_MASK)) ==
+			(Cmd->CmdId & (XPLMI_CMD_MODULE_ID_MASK |
+			XPLMI_PLM_GENERIC_CMD_ID_MASK)))) {
+			Status = XPlmi_UpdateStatus(XPLMI_ERR_IPI_MBOX_INVALID_REQ, 0);
+			break;
+		}
+		Status = XPlmi_MemCpy64((u64)(UINTPTR)ReqPayload, ReqAddr,
+			Len * XPLMI_WORD_LEN);
+		if (Status != XST_SUCCESS) {
+			break;
+		}
+		ReqAddr += ((u64)Len * XPLMI_WORD_LEN);
+
+		Status = XPlmi_MemSetBytes(&Req, sizeof(Req), 0U, sizeof(Req));
+		if (Status != XST_SUCCESS) {
+			break;
+		}
+		Req.AckInPLM = (u8)TRUE;
+		Req.IpiMask = Cmd->IpiMask;
+		Req.CmdId = Header;
+		Req.Len = Len;
+		Req.Payload = ReqPayload;
+		Status = XPlmi_ValidateIpiCmd(&Req,
+			IpiInst.Config.TargetList[Index].BufferIndex);
+		if (Status == XST_SUCCESS) {
+			Status = XPlmi_CmdExecute(&Req);
+		}
+		Req.Response[0U] = (u32)Status;
+		(void)XPlmi_MemCpy64(RespAddr, (u64)(UINTPTR)Req.Response,
+			XPLMI_CMD_RESP_SIZE * XPLMI_WORD_LEN);
+		RespAddr += (XPLMI_CMD_RESP_SIZE * XPLMI_WORD_LEN);
+		Cmd->Response[XPLMI_IPI_MBOX_RESP_IDX_COUNT] = ReqNum + 1U;
+		/*
+		 * The handler acknowledges the IPI on its own, so no response is
+		 * to be sent for the mailbox command and processing has to stop
+		 */
+		if (Req.AckInPLM != (u8)TRUE) {
+			Cmd->AckInPLM = Req.AckInPLM;
+			break;
+		}
+		if (Status != XST_SUCCESS) {
+			break;
+		}
+	}
+
+END:
+	return Status;
+}
 #endif /* XPLMI_IPI_DEVICE_ID */
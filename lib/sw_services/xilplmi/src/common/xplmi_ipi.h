@@ -38,6 +38,7 @@
 *       skg  06/20/2022 Misra-C violation Rule 8.13 fixed
 *       bm   07/06/2022 Refactor versal and versal_net code
 *       bm   07/18/2022 Shutdown modules gracefully during update
+*       ag   10/14/2026 Added IPI mailbox APIs
 *
 * </pre>
 *
@@ -65,6 +66,8 @@ extern "C" {
 #define XPLMI_IPI_MASK_COUNT		XIPIPSU_MAX_TARGETS
 #define XPLMI_IPI_MAX_MSG_LEN		XIPIPSU_MAX_MSG_LEN
 #define XPLMI_MAX_IPI_CMD_LEN		(6U)
+#define XPLMI_IPI_MBOX_MAX_CMD_LEN	(64U) /**< Max payload length in words
+						of a mailbox request */
 
 /* IPI defines */
 #define IPI_PMC_ISR			(IPI_BASEADDR + 0x20010U)
@@ -90,6 +93,8 @@ int XPlmi_IpiRead(u32 SrcCpuMask, u32 *MsgPtr, u32 MsgLen, u8 Type);
 int XPlmi_IpiTrigger(u32 DestCpuMask);
 int XPlmi_IpiPollForAck(u32 DestCpuMask, u32 TimeOutCount);
 int XPlmi_IpiDrvInit(void);
+int XPlmi_IpiMboxConfig(u32 IpiMask, u64 Addr, u32 Size);
+int XPlmi_IpiMboxProcess(XPlmi_Cmd *Cmd);
 
 /************************** Variable Definitions *****************************/
 
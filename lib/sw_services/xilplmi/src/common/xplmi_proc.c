@@ -44,6 +44,7 @@
 *       bm   03/16/2022 Fix ROM time calculation
 * 1.07  skd  04/21/2022 Misra-C violation Rule 18.1 fixed
 * 1.08  bm   07/06/2022 Refactor versal and versal_net code
+*       ag   10/14/2026 Run PIT3 in one shot mode for the scheduler deadlines
 *
 * </pre>
 *
@@ -124,7 +125,7 @@ static void XPlmi_InitPitTimer(u8 Timer, u32 ResetValue)
 	 * When used in PIT1 prescalar to PIT2, PIT2 has least 32bits
 	 * So, PIT2 is reloaded to get 64bit timer value.
 	 */
-	if ((XPLMI_PIT2 == Timer) || (XPLMI_PIT3 == Timer)) {
+	if (XPLMI_PIT2 == Timer) {
 		XIOModule_Timer_SetOptions(&IOModule, Timer,
 				XTC_AUTO_RELOAD_OPTION);
 	}
@@ -144,6 +145,23 @@ static void XPlmi_InitPitTimer(u8 Timer, u32 ResetValue)
 	XIOModule_Timer_Start(&IOModule, Timer);
 }
 
+/*****************************************************************************/
+/**
+* @brief	It starts PIT3 in one shot mode to expire after the given number
+* of PMC IRO ticks. Scheduler uses it to program its next deadline.
+*
+* @param	Ticks is the number of ticks after which PIT3 interrupt is raised
+*
+* @return	None
+*
+*****************************************************************************/
+void XPlmi_SetSchedulerTimer(u32 Ticks)
+{
+	XIOModule_Timer_Stop(&IOModule, (u8)XPLMI_PIT3);
+	XIOModule_SetResetValue(&IOModule, (u8)XPLMI_PIT3, Ticks);
+	XIOModule_Timer_Start(&IOModule, (u8)XPLMI_PIT3);
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function is used to read the 64 bit timer value.
@@ -274,7 +292,6 @@ int XPlmi_StartTimer(void)
 	int Status =  XST_FAILURE;
 	u32 Pit1ResetValue;
 	u32 Pit2ResetValue;
-	u32 Pit3ResetValue;
 
 	/* Get Pit1 and Pit2 reset values */
 	Status = XPlmi_GetPitResetValues(&Pit1ResetValue, &Pit2ResetValue);
@@ -304,18 +321,6 @@ int XPlmi_StartTimer(void)
 		goto END;
 	}
 
-	/*
-	 * PLM scheduler is running too fast for QEMU, so increasing the
-	 * scheduler's poling time to 100ms for QEMU instead of 10ms
-	 */
-	if (XPLMI_PLATFORM == PMC_TAP_VERSION_QEMU) {
-		Pit3ResetValue = PmcIroFreq / XPLMI_PIT_FREQ_DIVISOR_QEMU;
-	} else {
-		Pit3ResetValue = PmcIroFreq / XPLMI_PIT_FREQ_DIVISOR;
-	}
-
-	XPlmi_SchedulerInit();
-
 	/* Initialize and start the timer
 	 *  Use PIT1 and PIT2 in prescaler mode
 	 *  Setting for Prescaler mode
@@ -324,7 +329,9 @@ int XPlmi_StartTimer(void)
 		MB_IOMODULE_GPO1_PIT1_PRESCALE_SRC_MASK);
 	XPlmi_InitPitTimer((u8)XPLMI_PIT2, Pit2ResetValue);
 	XPlmi_InitPitTimer((u8)XPLMI_PIT1, Pit1ResetValue);
-	XPlmi_InitPitTimer((u8)XPLMI_PIT3, Pit3ResetValue);
+
+	/* Scheduler arms PIT3 for its first deadline */
+	XPlmi_SchedulerInit();
 
 END:
 	return Status;
@@ -107,6 +107,7 @@ int XPlmi_StartTimer(void);
 u64 XPlmi_GetTimerValue(void);
 int XPlmi_SetUpInterruptSystem(void);
 void XPlmi_MeasurePerfTime(u64 TCur, XPlmi_PerfTime *PerfTime);
+void XPlmi_SetSchedulerTimer(u32 Ticks);
 void XPlmi_PlmIntrEnable(u32 IntrId);
 int XPlmi_PlmIntrDisable(u32 IntrId);
 int XPlmi_PlmIntrClear(u32 IntrId);
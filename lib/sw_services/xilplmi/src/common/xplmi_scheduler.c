@@ -43,6 +43,8 @@
 * 1.06  skg  06/20/2022 Misra-C violation Rule 10.4 fixed
 *       sk   06/27/2022 Updated logic in XPlmi_SchedulerAddTask to fix task
 *                       creation error
+*       ag   10/14/2026 Replaced fixed 10ms tick with PIT3 one shot deadlines
+*                       and added XPlmi_SchedulerAddTaskUs
 *
 * </pre>
 *
@@ -54,6 +56,8 @@
 #include "xplmi_scheduler.h"
 #include "xplmi_debug.h"
 #include "xplmi_wdt.h"
+#include "xplmi_proc.h"
+#include "xplmi_hw.h"
 
 /**@cond xplmi_internal
  * @{
@@ -65,7 +69,14 @@
 
 /***************** Macros (Inline Functions) Definitions *********************/
 
+/* WDT handler expects to be called at this period in ms */
 #define XPLMI_SCHED_TICK	(10U)
+#define XPLMI_SCHED_US_PER_MS	(1000U)
+#define XPLMI_SCHED_US_PER_SEC	(1000000U)
+/* Minimum ticks PIT3 is programmed with when a deadline is already due */
+#define XPLMI_SCHED_MIN_TICKS	(32U)
+#define XPLMI_SCHED_MAX_TICKS	(0xFFFFFFFFU)
+#define XPLMI_SCHED_NO_DEADLINE	(0xFFFFFFFFFFFFFFFFU)
 
 /**
  * @}
@@ -75,6 +86,9 @@
 /************************** Function Prototypes ******************************/
 static u8 XPlmi_IsTaskNonPeriodic(const XPlmi_Scheduler_t *SchedPtr,
 	u32 TaskListIndex);
+static u64 XPlmi_SchedGetTime(void);
+static u64 XPlmi_SchedUsToTicks(u32 MicroSeconds);
+static void XPlmi_SchedArmTimer(u64 Now);
 
 /************************** Variable Definitions *****************************/
 static XPlmi_Scheduler_t Sched;
@@ -83,16 +97,78 @@ static XPlmi_Scheduler_t Sched;
 
 /******************************************************************************/
 /**
-* @brief	The function checks the specified task is active or not, returns
+* @brief	The function returns the current time in PMC IRO ticks. PIT1 and
+* PIT2 count down, so the value is inverted to get an increasing time.
+*
+* @return	Current time in ticks
+*
+****************************************************************************/
+static u64 XPlmi_SchedGetTime(void)
+{
+	return ~XPlmi_GetTimerValue();
+}
+
+/******************************************************************************/
+/**
+* @brief	The function converts the time in microseconds to PMC IRO ticks.
+* On QEMU the time is scaled up as the PLM runs slower than the timer.
+*
+* @param	MicroSeconds is the time in microseconds
+*
+* @return	Time in ticks
+*
+****************************************************************************/
+static u64 XPlmi_SchedUsToTicks(u32 MicroSeconds)
+{
+	const u32 *PmcIroFreq = XPlmi_GetPmcIroFreq();
+
+	return ((u64)MicroSeconds * (*PmcIroFreq) * Sched.TimeScale) /
+		XPLMI_SCHED_US_PER_SEC;
+}
+
+/******************************************************************************/
+/**
+* @brief	The function programs PIT3 to expire at the earliest of the next
+* task deadline and the next WDT deadline. It must be called with interrupts
+* disabled.
+*
+* @param	Now is the current time in ticks
+*
+* @return	None
+*
+****************************************************************************/
+static void XPlmi_SchedArmTimer(u64 Now)
+{
+	u64 Deadline = Sched.NextTriggerTime;
+	u64 Ticks = XPLMI_SCHED_MIN_TICKS;
+
+	if (Sched.WdtTriggerTime < Deadline) {
+		Deadline = Sched.WdtTriggerTime;
+	}
+	if (Deadline > (Now + XPLMI_SCHED_MIN_TICKS)) {
+		Ticks = Deadline - Now;
+	}
+	if (Ticks > XPLMI_SCHED_MAX_TICKS) {
+		Ticks = XPLMI_SCHED_MAX_TICKS;
+	}
+
+	XPlmi_SetSchedulerTimer((u32)Ticks);
+}
+
+/******************************************************************************/
+/**
+* @brief	The function checks the specified task is due or not, returns
 * corresponding status of the task
 *
 * @param    	SchedPtr is Scheduler pointer
 * @param    	TaskListIndex is Task index
+* @param	Now is the current time in ticks
 *
 * @return	TRUE or FALSE based on the task active status
 *
 ****************************************************************************/
-static u8 XPlmi_IsTaskActive(XPlmi_Scheduler_t *SchedPtr, u32 TaskListIndex)
+static u8 XPlmi_IsTaskActive(const XPlmi_Scheduler_t *SchedPtr,
+	u32 TaskListIndex, u64 Now)
 {
 	u8 ReturnVal = (u8)FALSE;
 
@@ -100,18 +176,8 @@ static u8 XPlmi_IsTaskActive(XPlmi_Scheduler_t *SchedPtr, u32 TaskListIndex)
 		goto END;
 	}
 
-	if (XPlmi_IsTaskNonPeriodic(SchedPtr, TaskListIndex) == (u8)TRUE) {
-		if (SchedPtr->TaskList[TaskListIndex].TriggerTime <=
-			SchedPtr->Tick) {
-			ReturnVal = (u8)TRUE;
-		}
-	} else {
-		if ((0U != SchedPtr->TaskList[TaskListIndex].Interval)
-		&& (0U == (SchedPtr->Tick
-		% SchedPtr->TaskList[TaskListIndex].Interval))) {
-			/* Periodic */
-			ReturnVal = (u8)TRUE;
-		}
+	if (SchedPtr->TaskList[TaskListIndex].TriggerTime <= Now) {
+		ReturnVal = (u8)TRUE;
 	}
 
 END:
@@ -143,8 +209,8 @@ static u8 XPlmi_IsTaskNonPeriodic(const XPlmi_Scheduler_t *SchedPtr,
 
 /******************************************************************************/
 /**
-* @brief	The function initializes scheduler and returns the
-* initialization status.
+* @brief	The function initializes scheduler and arms PIT3 for the first
+* deadline. PIT1 and PIT2 must be running before this is called.
 *
 * @return	None
 *
@@ -152,6 +218,7 @@ static u8 XPlmi_IsTaskNonPeriodic(const XPlmi_Scheduler_t *SchedPtr,
 void XPlmi_SchedulerInit(void)
 {
 	u8 Idx;
+	u64 Now;
 
 	/* Disable all the tasks */
 	for (Idx = 0U; Idx < XPLMI_SCHED_MAX_TASK; Idx++) {
@@ -159,15 +226,30 @@ void XPlmi_SchedulerInit(void)
 		Sched.TaskList[Idx].CustomerFunc = NULL;
 	}
 
-	Sched.LastTimerTick = XPlmi_GetTimerValue();
-	Sched.Tick = 0U;
+	/*
+	 * PLM runs too slow on QEMU, so scale the scheduler time by
+	 * 10 for QEMU, which keeps the earlier 100ms tick behaviour
+	 */
+	if (XPLMI_PLATFORM == PMC_TAP_VERSION_QEMU) {
+		Sched.TimeScale = XPLMI_PIT_FREQ_DIVISOR /
+			XPLMI_PIT_FREQ_DIVISOR_QEMU;
+	} else {
+		Sched.TimeScale = 1U;
+	}
+
+	Now = XPlmi_SchedGetTime();
+	Sched.WdtPeriod = XPlmi_SchedUsToTicks(XPLMI_SCHED_TICK *
+		XPLMI_SCHED_US_PER_MS);
+	Sched.WdtTriggerTime = Now + Sched.WdtPeriod;
+	Sched.NextTriggerTime = XPLMI_SCHED_NO_DEADLINE;
+	XPlmi_SchedArmTimer(Now);
 }
 
 /******************************************************************************/
 /**
-* @brief	The function is scheduler handler and it is called at regular
-* intervals based on configured interval. Scheduler handler checks and adds the
-* user periodic task to PLM task queue.
+* @brief	The function is scheduler handler and it is called on PIT3 expiry
+* at the next deadline. Scheduler handler adds the due user tasks to PLM task
+* queue, calls WDT handler when it is due and programs the next deadline.
 *
 * @param	Data - Not used currently. Added as a part of generic interrupt
 *               handler
@@ -180,44 +262,66 @@ void XPlmi_SchedulerHandler(void *Data)
 	u8 Idx;
 	(void)Data;
 	XPlmi_TaskNode *Task = NULL;
+	u64 Now = XPlmi_SchedGetTime();
+	struct XPlmi_Task_t *SchedTask;
 
-	Sched.LastTimerTick = XPlmi_GetTimerValue();
-	Sched.Tick++;
 	XPlmi_UtilRMW(PMC_PMC_MB_IO_IRQ_ACK, PMC_PMC_MB_IO_IRQ_ACK, 0x20U);
-	for (Idx = 0U; Idx < XPLMI_SCHED_MAX_TASK; Idx++) {
-		/* Check if the task is active and has a valid Callback */
-		if (XPlmi_IsTaskActive(&Sched, Idx) == (u8)TRUE) {
-			Task = Sched.TaskList[Idx].Task;
-			/* Skip the task, if its already present in the queue */
-			if (metal_list_is_empty(&Task->TaskNode) == (int)TRUE) {
-				Task->State &= (u8)(~XPLMI_SCHED_TASK_MISSED);
-				XPlmi_TaskTriggerNow(Task);
-			} else {
-				/*
-				 * Check if a module has registered ErrorFunc for the task and
-				 * the previously scheduled task is executed or not
-				 */
-				if ((Sched.TaskList[Idx].ErrorFunc != NULL) &&
-					((Task->State & (u8)(XPLMI_SCHED_TASK_MISSED)) ==
-							(u8)0x0U)) {
-					/* Update scheduler task state with task missed flag */
-					Task->State |= (u8)XPLMI_SCHED_TASK_MISSED;
+	if (Sched.NextTriggerTime <= Now) {
+		Sched.NextTriggerTime = XPLMI_SCHED_NO_DEADLINE;
+		for (Idx = 0U; Idx < XPLMI_SCHED_MAX_TASK; Idx++) {
+			SchedTask = &Sched.TaskList[Idx];
+			/* Check if the task is due and has a valid Callback */
+			if (XPlmi_IsTaskActive(&Sched, Idx, Now) == (u8)TRUE) {
+				Task = SchedTask->Task;
+				/* Skip the task, if its already present in the queue */
+				if (metal_list_is_empty(&Task->TaskNode) == (int)TRUE) {
+					Task->State &= (u8)(~XPLMI_SCHED_TASK_MISSED);
+					XPlmi_TaskTriggerNow(Task);
+				} else {
 					/*
-					 * Call the task specific ErrorFunc if
-					 * previously scheduled task is not executed
+					 * Check if a module has registered ErrorFunc for the task and
+					 * the previously scheduled task is executed or not
 					 */
-					Sched.TaskList[Idx].ErrorFunc(XPLMI_ERR_SCHED_TASK_MISSED);
+					if ((SchedTask->ErrorFunc != NULL) &&
+						((Task->State & (u8)(XPLMI_SCHED_TASK_MISSED)) ==
+								(u8)0x0U)) {
+						/* Update scheduler task state with task missed flag */
+						Task->State |= (u8)XPLMI_SCHED_TASK_MISSED;
+						/*
+						 * Call the task specific ErrorFunc if
+						 * previously scheduled task is not executed
+						 */
+						SchedTask->ErrorFunc(XPLMI_ERR_SCHED_TASK_MISSED);
+					}
+				}
+				/* Remove the task from scheduler if it is non-periodic*/
+				if (XPlmi_IsTaskNonPeriodic(&Sched, Idx) == (u8)TRUE) {
+					SchedTask->OwnerId = 0U;
+					SchedTask->CustomerFunc = NULL;
+					SchedTask->ErrorFunc = NULL;
+				} else {
+					/* Move to next period, skip the missed periods */
+					SchedTask->TriggerTime += SchedTask->Period;
+					if (SchedTask->TriggerTime <= Now) {
+						SchedTask->TriggerTime = Now + SchedTask->Period;
+					}
 				}
 			}
-			/* Remove the task from scheduler if it is non-periodic*/
-			if (Sched.TaskList[Idx].Type == XPLMI_NON_PERIODIC_TASK) {
-				Sched.TaskList[Idx].OwnerId = 0U;
-				Sched.TaskList[Idx].CustomerFunc = NULL;
-				Sched.TaskList[Idx].ErrorFunc = NULL;
+			if ((SchedTask->CustomerFunc != NULL) &&
+				(SchedTask->TriggerTime < Sched.NextTriggerTime)) {
+				Sched.NextTriggerTime = SchedTask->TriggerTime;
 			}
 		}
 	}
-	XPlmi_WdtHandler();
+
+	if (Sched.WdtTriggerTime <= Now) {
+		XPlmi_WdtHandler();
+		Sched.WdtTriggerTime += Sched.WdtPeriod;
+		if (Sched.WdtTriggerTime <= Now) {
+			Sched.WdtTriggerTime = Now + Sched.WdtPeriod;
+		}
+	}
+	XPlmi_SchedArmTimer(Now);
 
 	return;
 }
@@ -233,7 +337,7 @@ void XPlmi_SchedulerHandler(void *Data)
 * 		on scheduled interval
 * @param	MilliSeconds For Periodic tasks, it's the Periodicity of the task.
 * 		For Non-Periodic tasks, it's the delay after which task has to
-* 		be scheduled. Value should be in multiples of 10ms
+* 		be scheduled.
 * @param	Priority is the priority of the task
 * @param	Data is the pointer to the private data of the task
 * @param	TaskType is the type of Task (periodic or non-periodic)
@@ -246,9 +350,46 @@ int XPlmi_SchedulerAddTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 		TaskPriority_t Priority, void *Data, u8 TaskType)
 {
 	int Status = XST_FAILURE;
-	XPlmi_PerfTime ExtraTime;
+
+	if (MilliSeconds > (XPLMI_SCHED_MAX_TICKS / XPLMI_SCHED_US_PER_MS)) {
+		Status = XPlmi_UpdateStatus(XPLMI_ERR_INVALID_TASK_PERIOD, 0);
+		goto END;
+	}
+
+	Status = XPlmi_SchedulerAddTaskUs(OwnerId, CallbackFn, ErrorFunc,
+		MilliSeconds * XPLMI_SCHED_US_PER_MS, Priority, Data, TaskType);
+
+END:
+	return Status;
+}
+
+/******************************************************************************/
+/**
+* @brief	The function adds user task to scheduler queue with microsecond
+* resolution. Task is triggered from PIT3 one shot deadline, so there is no
+* periodic tick and the period need not be a multiple of any tick.
+*
+* @param	OwnerId Id of the owner, used while removing the task.
+* @param	CallbackFn callback function that should be called
+* @param	ErrorFunc error function to be called when task does not execute
+* 		on scheduled interval
+* @param	MicroSeconds For Periodic tasks, it's the Periodicity of the task.
+* 		For Non-Periodic tasks, it's the delay after which task has to
+* 		be scheduled.
+* @param	Priority is the priority of the task
+* @param	Data is the pointer to the private data of the task
+* @param	TaskType is the type of Task (periodic or non-periodic)
+*
+* @return	XST_SUCCESS if scheduler task is registered properly
+*
+****************************************************************************/
+int XPlmi_SchedulerAddTaskUs(u32 OwnerId, XPlmi_Callback_t CallbackFn,
+		XPlmi_ErrorFunc_t ErrorFunc, u32 MicroSeconds,
+		TaskPriority_t Priority, void *Data, u8 TaskType)
+{
+	int Status = XST_FAILURE;
 	u8 Idx;
-	u32 TriggerTime = 0U;
+	u64 Now;
 	XPlmi_TaskNode *Task = NULL;
 	u8 TaskNodePresent = (u8)FALSE;
 
@@ -258,7 +399,7 @@ int XPlmi_SchedulerAddTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 		goto END;
 	}
 
-	if ((TaskType == XPLMI_PERIODIC_TASK) && (MilliSeconds == 0U)) {
+	if ((TaskType == XPLMI_PERIODIC_TASK) && (MicroSeconds == 0U)) {
 		Status = XPlmi_UpdateStatus(XPLMI_ERR_INVALID_TASK_PERIOD, 0);
 		goto END;
 	}
@@ -277,13 +418,6 @@ int XPlmi_SchedulerAddTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 	/* Get the Next Free Task Index */
 	for (Idx = 0U; Idx < XPLMI_SCHED_MAX_TASK; Idx++) {
 		if (NULL == Sched.TaskList[Idx].CustomerFunc) {
-			/* Add Interval as a factor of TICK_MILLISECONDS */
-			Sched.TaskList[Idx].Interval = MilliSeconds / XPLMI_SCHED_TICK;
-			Sched.TaskList[Idx].OwnerId = OwnerId;
-			Sched.TaskList[Idx].CustomerFunc = CallbackFn;
-			Sched.TaskList[Idx].ErrorFunc = ErrorFunc;
-			Sched.TaskList[Idx].Type = TaskType;
-			Sched.TaskList[Idx].Data = Data;
 			/* Create a new task if task instance not found */
 			if (TaskNodePresent == (u8)FALSE) {
 				Task = XPlmi_TaskCreate(Priority, CallbackFn, Data);
@@ -296,19 +430,25 @@ int XPlmi_SchedulerAddTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 				goto END;
 			}
 			Task->IntrId = XPLMI_INVALID_INTR_ID;
+
+			microblaze_disable_interrupts();
+			Sched.TaskList[Idx].Interval = MicroSeconds;
+			Sched.TaskList[Idx].Period = XPlmi_SchedUsToTicks(MicroSeconds);
+			Sched.TaskList[Idx].OwnerId = OwnerId;
+			Sched.TaskList[Idx].ErrorFunc = ErrorFunc;
+			Sched.TaskList[Idx].Type = TaskType;
+			Sched.TaskList[Idx].Data = Data;
 			Sched.TaskList[Idx].Task = Task;
-			if (TaskType != XPLMI_PERIODIC_TASK) {
-				microblaze_disable_interrupts();
-				XPlmi_MeasurePerfTime(Sched.LastTimerTick, &ExtraTime);
-				if (Sched.Tick == 0U) {
-					ExtraTime.TPerfMs %= XPLMI_SCHED_TICK;
-				}
-				TriggerTime = Sched.Tick +
-					   (((u32)ExtraTime.TPerfMs + MilliSeconds) /
-					   XPLMI_SCHED_TICK);
-				microblaze_enable_interrupts();
+			Now = XPlmi_SchedGetTime();
+			Sched.TaskList[Idx].TriggerTime = Now +
+				Sched.TaskList[Idx].Period;
+			Sched.TaskList[Idx].CustomerFunc = CallbackFn;
+			/* Pull in the PIT3 deadline if this task is due earlier */
+			if (Sched.TaskList[Idx].TriggerTime < Sched.NextTriggerTime) {
+				Sched.NextTriggerTime = Sched.TaskList[Idx].TriggerTime;
+				XPlmi_SchedArmTimer(Now);
 			}
-			Sched.TaskList[Idx].TriggerTime = TriggerTime;
+			microblaze_enable_interrupts();
 			Status = XST_SUCCESS;
 			break;
 		}
@@ -345,13 +485,13 @@ int XPlmi_SchedulerRemoveTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 			(Sched.TaskList[Idx].OwnerId == OwnerId) &&
 			(Sched.TaskList[Idx].Data == Data) &&
 			((Sched.TaskList[Idx].Interval ==
-				(MilliSeconds / XPLMI_SCHED_TICK)) ||
+				(MilliSeconds * XPLMI_SCHED_US_PER_MS)) ||
 				(0U == MilliSeconds))) {
+			microblaze_disable_interrupts();
 			Sched.TaskList[Idx].Interval = 0U;
 			Sched.TaskList[Idx].OwnerId = 0U;
 			Sched.TaskList[Idx].CustomerFunc = NULL;
 			Sched.TaskList[Idx].Data = NULL;
-			microblaze_disable_interrupts();
 			if (metal_list_is_empty(&Sched.TaskList[Idx].Task->TaskNode) ==
 				(int)FALSE) {
 				metal_list_del(&Sched.TaskList[Idx].Task->TaskNode);
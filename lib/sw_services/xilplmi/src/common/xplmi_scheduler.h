@@ -30,6 +30,7 @@
 *       bsv  07/16/2021 Fix doxygen warnings
 *       bsv  08/15/2021 Removed redundant element in structure
 * 1.04  bm   07/06/2022 Refactor versal and versal_net code
+*       ag   10/14/2026 Deadline based scheduler with microsecond resolution
 *
 * </pre>
 *
@@ -52,7 +53,7 @@ extern "C" {
  */
 
 /************************** Constant Definitions *****************************/
-#define XPLMI_SCHED_MAX_TASK		(10U)
+#define XPLMI_SCHED_MAX_TASK		(32U)
 #define XPLMI_PERIODIC_TASK		(0U)
 #define XPLMI_NON_PERIODIC_TASK		(1U)
 
@@ -62,7 +63,8 @@ typedef void (*XPlmi_ErrorFunc_t)(int Status);
 struct XPlmi_Task_t{
 	u32 Interval;
 	u32 OwnerId;
-	u32 TriggerTime;
+	u64 Period;
+	u64 TriggerTime;
 	XPlmi_Callback_t CustomerFunc;
 	XPlmi_ErrorFunc_t ErrorFunc;
 	XPlmi_TaskNode *Task;
@@ -72,9 +74,11 @@ struct XPlmi_Task_t{
 
 typedef struct {
 	struct XPlmi_Task_t TaskList[XPLMI_SCHED_MAX_TASK];
-	u64 LastTimerTick;
+	u64 NextTriggerTime;
+	u64 WdtTriggerTime;
+	u64 WdtPeriod;
 	u32 TaskCount;
-	u32 Tick;
+	u32 TimeScale;
 } XPlmi_Scheduler_t ;
 
 void XPlmi_SchedulerInit(void);
@@ -82,6 +86,9 @@ void XPlmi_SchedulerHandler(void *Data);
 int XPlmi_SchedulerAddTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 	XPlmi_ErrorFunc_t ErrorFunc, u32 MilliSeconds, TaskPriority_t Priority,
 	void *Data,	u8 TaskType);
+int XPlmi_SchedulerAddTaskUs(u32 OwnerId, XPlmi_Callback_t CallbackFn,
+	XPlmi_ErrorFunc_t ErrorFunc, u32 MicroSeconds, TaskPriority_t Priority,
+	void *Data, u8 TaskType);
 int XPlmi_SchedulerRemoveTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 	u32 MilliSeconds, const void *Data);
 
@@ -41,6 +41,8 @@
 *                       same priority
 *       bsv  03/11/2022 Restore race condition fix that got disturbed by
 *                       previous patch
+*       ag   10/14/2026 Use ready bitmap to select the priority queue, added
+*                       task execution time accounting and XPlmi_TaskYield
 *
 * </pre>
 *
@@ -62,9 +64,18 @@
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /************************** Function Prototypes ******************************/
+static XPlmi_TaskNode* XPlmi_GetNextTask(u32 Priority);
+static void XPlmi_TaskRun(XPlmi_TaskNode *Task);
 
 /************************** Variable Definitions *****************************/
 static struct metal_list TaskQueue[XPLMI_TASK_PRIORITIES];
+static struct metal_list *NextNode[XPLMI_TASK_PRIORITIES];
+static XPlmi_TaskNode Tasks[XPLMI_TASK_MAX];
+/* Bit N is set when TaskQueue[N] may have pending tasks */
+static u32 ReadyMask;
+static XPlmi_TaskNode *CurrentTask;
+/* Time spent in tasks run from XPlmi_TaskYield by the current task */
+static u64 YieldTime;
 
 /*****************************************************************************/
 
@@ -101,6 +112,9 @@ XPlmi_TaskNode* XPlmi_TaskCreate(TaskPriority_t Priority,
 	Task->Handler = Handler;
 	Task->PrivData = PrivData;
 	Task->State = (u8)0x0U;
+	Task->RunCount = 0U;
+	Task->MaxTime = 0U;
+	Task->TotalTime = 0U;
 
 END:
 	return Task;
@@ -122,7 +136,6 @@ XPlmi_TaskNode* XPlmi_GetTaskInstance(int (*Handler)(void *Arg),
 		const void *PrivData, const u32 IntrId)
 {
 	XPlmi_TaskNode *Task = NULL;
-	static XPlmi_TaskNode Tasks[XPLMI_TASK_MAX];
 	u8 Index;
 
 	for (Index = 0U; Index < XPLMI_TASK_MAX; Index++) {
@@ -163,9 +176,31 @@ void XPlmi_TaskTriggerNow(XPlmi_TaskNode *Task)
 	if (metal_list_is_empty(&Task->TaskNode) != (int)FALSE) {
 		metal_list_add_tail(&TaskQueue[Task->Priority],
 			&Task->TaskNode);
+		ReadyMask |= ((u32)1U << Task->Priority);
 	}
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function returns the task node at the given index of the
+ * task pool. It is used to report the task execution statistics.
+ *
+ * @param	Index is the index of the task in the task pool
+ *
+ * @return	Pointer to the task node if it is in use, NULL otherwise
+ *
+ *****************************************************************************/
+XPlmi_TaskNode* XPlmi_GetTaskByIndex(u32 Index)
+{
+	XPlmi_TaskNode *Task = NULL;
+
+	if ((Index < XPLMI_TASK_MAX) && (Tasks[Index].Handler != NULL)) {
+		Task = &Tasks[Index];
+	}
+
+	return Task;
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function initializes the task queues list.
@@ -181,79 +216,196 @@ void XPlmi_TaskInit(void)
 	/* Initialize the list pointers */
 	for (Index = 0U; Index < XPLMI_TASK_PRIORITIES; Index++) {
 		metal_list_init(&TaskQueue[Index]);
+		NextNode[Index] = &TaskQueue[Index];
 	}
+	ReadyMask = 0U;
 }
 
 /*****************************************************************************/
 /**
- * @brief	This function will be checking for tasks in the queue based on the
- * priority. After calling every task handlers, next high priority task will
- * be called.
+ * @brief	This function returns the next task to be run in round robin
+ * from the queue of given priority and removes it from the queue. It must be
+ * called with interrupts disabled.
+ *
+ * @param	Priority is the priority of the queue
+ *
+ * @return	Pointer to the task node, NULL if the queue is empty
+ *
+ *****************************************************************************/
+static XPlmi_TaskNode* XPlmi_GetNextTask(u32 Priority)
+{
+	XPlmi_TaskNode *Task = NULL;
+
+	if (metal_list_is_empty(&TaskQueue[Priority]) != (int)FALSE) {
+		ReadyMask &= ~((u32)1U << Priority);
+		goto END;
+	}
+
+	/* Skip the first element as it is not proper task */
+	if ((metal_list_is_empty(NextNode[Priority]) != (int)FALSE) ||
+		(NextNode[Priority] == &TaskQueue[Priority])) {
+		NextNode[Priority] = TaskQueue[Priority].next;
+	}
+	/* Get the next task in round robin */
+	Task = metal_container_of(NextNode[Priority], XPlmi_TaskNode, TaskNode);
+	NextNode[Priority] = NextNode[Priority]->next;
+	Xil_AssertNonvoid(Task->Handler != NULL);
+	metal_list_del(&Task->TaskNode);
+	if (metal_list_is_empty(&TaskQueue[Priority]) != (int)FALSE) {
+		ReadyMask &= ~((u32)1U << Priority);
+	}
+
+END:
+	return Task;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function runs the task handler with interrupts enabled and
+ * updates the execution time of the task. Time spent in the tasks run from
+ * XPlmi_TaskYield is not accounted to the yielding task.
+ *
+ * @param	Task is pointer to the task node
  *
  * @return	None
  *
  *****************************************************************************/
-void XPlmi_TaskDispatchLoop(void)
+static void XPlmi_TaskRun(XPlmi_TaskNode *Task)
 {
 	int Status = XST_FAILURE;
-	struct metal_list *Node[XPLMI_TASK_PRIORITIES];
-	XPlmi_TaskNode *Task;
-	u32 Index;
-#ifdef PLM_DEBUG_DETAILED
+	XPlmi_TaskNode *PrevTask = CurrentTask;
+	u64 PrevYieldTime = YieldTime;
 	u64 TaskStartTime;
+	u64 TaskTime;
+#ifdef PLM_DEBUG_DETAILED
 	XPlmi_PerfTime PerfTime = {0U};
 #endif
 
-	XPlmi_Printf(DEBUG_DETAILED, "%s\n\r", __func__);
-	for (Index = 0U; Index < XPLMI_TASK_PRIORITIES; Index++) {
-		Node[Index] = &TaskQueue[Index];
+	CurrentTask = Task;
+	YieldTime = 0U;
+	microblaze_enable_interrupts();
+
+	/* Call the task handler */
+	TaskStartTime = XPlmi_GetTimerValue();
+	Status = Task->Handler(Task->PrivData);
+	/* Timer counts down */
+	TaskTime = TaskStartTime - XPlmi_GetTimerValue();
+#ifdef PLM_DEBUG_DETAILED
+	XPlmi_MeasurePerfTime(TaskStartTime, &PerfTime);
+	XPlmi_Printf(DEBUG_PRINT_PERF, "%u.%03u ms: Task Time\n\r",
+		(u32)PerfTime.TPerfMs, (u32)PerfTime.TPerfMsFrac);
+#endif
+
+	microblaze_disable_interrupts();
+	++Task->RunCount;
+	Task->TotalTime += (TaskTime - YieldTime);
+	if ((TaskTime - YieldTime) > Task->MaxTime) {
+		Task->MaxTime = TaskTime - YieldTime;
+	}
+	CurrentTask = PrevTask;
+	YieldTime = PrevYieldTime + TaskTime;
+	microblaze_enable_interrupts();
+
+	if (Status != XST_SUCCESS) {
+		XPlmi_ErrMgr(Status);
 	}
+}
 
+/*****************************************************************************/
+/**
+ * @brief	This function is a cooperative yield point for long running task
+ * handlers like CDO processing. It runs the pending tasks which have higher
+ * priority than the current task and are marked with XPLMI_TASK_YIELD_SAFE,
+ * and updates the PLM live status. It does nothing when called outside of a
+ * task or from a task of the highest priority.
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XPlmi_TaskYield(void)
+{
+	XPlmi_TaskNode *Task;
+	struct metal_list *Node;
+	u32 Index;
+
+	if (CurrentTask == NULL) {
+		goto END;
+	}
+
+	XPlmi_SetPlmLiveStatus();
 	while (TRUE) {
 		Task = NULL;
-		XPlmi_SetPlmLiveStatus();
-
 		microblaze_disable_interrupts();
-		/* Priority based task handling */
-		for (Index = 0U; Index < XPLMI_TASK_PRIORITIES; Index++) {
-			/* If no pending tasks are present, go to sleep */
-			if (metal_list_is_empty(&TaskQueue[Index]) != (int)FALSE) {
-				XPlmi_Printf(DEBUG_DETAILED,
-				 "No pending tasks in Priority%d Queue\n\r",
-				 Index);
+		for (Index = 0U; Index < CurrentTask->Priority; Index++) {
+			if ((ReadyMask & ((u32)1U << Index)) == 0U) {
 				continue;
-			} else {
-				/* Skip the first element as it
-				 * is not proper task
-				 */
-				if ((metal_list_is_empty(Node[Index]) != (int)FALSE) ||
-					(Node[Index] == &TaskQueue[Index])) {
-					Node[Index] = TaskQueue[Index].next;
+			}
+			/* Pick the first yield safe task of this priority */
+			metal_list_for_each(&TaskQueue[Index], Node) {
+				Task = metal_container_of(Node, XPlmi_TaskNode,
+					TaskNode);
+				if ((Task->State & (u8)XPLMI_TASK_YIELD_SAFE) != 0U) {
+					break;
 				}
-				/* Get the next task in round robin */
-				Task = metal_container_of(Node[Index],
-					XPlmi_TaskNode, TaskNode);
-				Node[Index] = Node[Index]->next;
+				Task = NULL;
+			}
+			if (Task != NULL) {
 				break;
 			}
 		}
-		if (Task != NULL) {
-#ifdef PLM_DEBUG_DETAILED
-			/* Call the task handler */
-			TaskStartTime = XPlmi_GetTimerValue();
-#endif
-			Xil_AssertVoid(Task->Handler != NULL);
-			metal_list_del(&Task->TaskNode);
+		if (Task == NULL) {
 			microblaze_enable_interrupts();
-			Status = Task->Handler(Task->PrivData);
-#ifdef PLM_DEBUG_DETAILED
-			XPlmi_MeasurePerfTime(TaskStartTime, &PerfTime);
-			XPlmi_Printf(DEBUG_PRINT_PERF, "%u.%03u ms: Task Time\n\r",
-				(u32)PerfTime.TPerfMs, (u32)PerfTime.TPerfMsFrac);
-#endif
-			if (Status != XST_SUCCESS) {
-				XPlmi_ErrMgr(Status);
+			break;
+		}
+		if (NextNode[Index] == &Task->TaskNode) {
+			NextNode[Index] = Task->TaskNode.next;
+		}
+		metal_list_del(&Task->TaskNode);
+		if (metal_list_is_empty(&TaskQueue[Index]) != (int)FALSE) {
+			ReadyMask &= ~((u32)1U << Index);
+		}
+		XPlmi_TaskRun(Task);
+	}
+
+END:
+	return;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function will be checking for tasks in the queue based on the
+ * priority. After calling every task handlers, next high priority task will
+ * be called.
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XPlmi_TaskDispatchLoop(void)
+{
+	XPlmi_TaskNode *Task;
+	u32 Index;
+	u32 Mask;
+
+	XPlmi_Printf(DEBUG_DETAILED, "%s\n\r", __func__);
+
+	while (TRUE) {
+		Task = NULL;
+		XPlmi_SetPlmLiveStatus();
+
+		microblaze_disable_interrupts();
+		/*
+		 * Priority based task handling, lowest set bit in the ready
+		 * mask is the highest priority queue with pending tasks
+		 */
+		Mask = ReadyMask;
+		for (Index = 0U; (Mask != 0U) && (Task == NULL); Index++) {
+			if ((Mask & ((u32)1U << Index)) != 0U) {
+				Mask &= ~((u32)1U << Index);
+				Task = XPlmi_GetNextTask(Index);
 			}
+		}
+		if (Task != NULL) {
+			XPlmi_TaskRun(Task);
 			continue;
 		}
 
@@ -30,6 +30,8 @@
 *       bsv  08/15/2021 Replaced enums with macros
 * 1.05  bsv  03/05/2022 Fix exception while deleting two consecutive tasks of
 *                       same priority
+*       ag   10/14/2026 Added task execution time accounting and cooperative
+*                       yield support
 *
 * </pre>
 *
@@ -61,6 +63,7 @@ extern "C" {
 
 
 #define XPLMI_SCHED_TASK_MISSED				(0x1U)
+#define XPLMI_TASK_YIELD_SAFE				(0x2U)
 
 #define XPLM_TASK_PRIORITY_0		(0U)
 #define XPLM_TASK_PRIORITY_1		(1U)
@@ -77,6 +80,9 @@ struct XPlmi_TaskNode {
     struct metal_list TaskNode;
     int (*Handler)(void * PrivData);
     void * PrivData;
+    u32 RunCount;
+    u64 MaxTime;
+    u64 TotalTime;
 };
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -96,6 +102,8 @@ void XPlmi_TaskInit(void);
 void XPlmi_TaskDispatchLoop(void);
 XPlmi_TaskNode* XPlmi_GetTaskInstance(int (*Handler)(void *Arg),
 	const void *PrivData, const u32 IntrId);
+void XPlmi_TaskYield(void);
+XPlmi_TaskNode* XPlmi_GetTaskByIndex(u32 Index);
 
 /************************** Variable Definitions *****************************/
 
@@ -44,6 +44,9 @@
 *       ssc  03/05/2022 Moved default config definitions to xparameters.h
 *       ma   05/24/2022 Added PLM_ENABLE_PLM_TO_PLM_COMM macro for SSIT
 *                       PLM to PLM communication
+* 1.09  ag   10/14/2026 Added PLM_PRINT_BINLOG macro
+*       ag   10/15/2026 PLM_PRINT_BINLOG records go to the debug log buffer
+*       ag   10/14/2026 Added PLM_CDO_CMD_STATS macro
 *
 * </pre>
 *
@@ -103,6 +106,18 @@ extern "C" {
  */
 //#define PLM_PRINT_NO_UART
 
+/**
+ * Enable the below define to record XPlmi_Printf messages with integer
+ * arguments only in the BSP binary log (xil_binlog.h) instead of formatting
+ * them, to reduce the boot time spent on prints. It takes effect only if the
+ * BSP is built with the xil_printf_binlog parameter. The records are not
+ * timestamped and are written to the PLM debug log in memory, not to the
+ * UART, mixed with the messages that are still formatted as text. The log
+ * is expanded by misc/plm_binlog_parser.py.
+ * This definition is disabled by default (i.e. not defined).
+ */
+//#define PLM_PRINT_BINLOG
+
 /**
  * Enabling the PLM_PRINT_PERF prints the time taken for loading partitions,
  * images and tasks. This define can be enabled with any of the above
@@ -194,6 +209,13 @@ extern "C" {
 //#define PLM_PRINT_PERF_KEYHOLE
 //#define PLM_PRINT_PERF_PL
 
+/**
+ * Enable the below define to collect the execution count, total time and
+ * latency histogram of every CDO and IPI command. The statistics can be
+ * printed using event logging command with sub command 9.
+ */
+//#define PLM_CDO_CMD_STATS
+
 #define XPLMI_MJTAG_WA_GASKET_TOGGLE_CNT 10U /**< Number of clock cyles required
 					to change tap state to RESET */
 #define XPLMI_MJTAG_WA_DELAY_USED_IN_GASKET_TOGGLE 1U /**< Delay in usec in
@@ -23,6 +23,7 @@
 *       bm   07/22/2022 Shutdown modules gracefully during update
 *       ma   07/29/2022 Replaced XPAR_XIPIPSU_0_DEVICE_ID macro with
 *                       XPLMI_IPI_DEVICE_ID
+*       ag   10/15/2026 Added XPlmi_IsSlrAddr
 *
 * </pre>
 *
@@ -288,6 +289,28 @@ static int XPlmi_SsitWaitForDmaDone(XPmcDma *DmaPtr, XPmcDma_Channel Channel)
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function checks if an address is in the PMC alias range
+ * of one of the SSIT slave SLRs.
+ *
+ * @param	Addr is the address to be checked
+ *
+ * @return	TRUE if the address belongs to a slave SLR, FALSE otherwise
+ *
+ *****************************************************************************/
+u8 XPlmi_IsSlrAddr(u64 Addr)
+{
+	u8 IsSlrAddr = (u8)FALSE;
+
+	if ((Addr >= XPLMI_PMC_ALIAS1_BASEADDR) &&
+		(Addr < XPLMI_PMC_ALIAS_MAX_ADDR)) {
+		IsSlrAddr = (u8)TRUE;
+	}
+
+	return IsSlrAddr;
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function is used to check and wait for DMA done when sending
@@ -303,8 +326,7 @@ XPlmi_WaitForDmaDone_t XPlmi_GetPlmiWaitForDone(u64 DestAddr)
 {
 	XPlmi_WaitForDmaDone_t XPlmi_WaitForDmaDone;
 
-	if ((DestAddr >= XPLMI_PMC_ALIAS1_BASEADDR) &&
-		(DestAddr < XPLMI_PMC_ALIAS_MAX_ADDR)) {
+	if (XPlmi_IsSlrAddr(DestAddr) == (u8)TRUE) {
 		/*
 		 * Call XPlmi_SsitWaitForDmaDone() if DMA transfer is to
 		 * SSIT Slave SLRs
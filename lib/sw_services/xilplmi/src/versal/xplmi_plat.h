@@ -25,6 +25,7 @@
 *       bm   07/22/2022 Retain critical data structures after In-Place PLM Update
 *       bm   07/22/2022 Shutdown modules gracefully during update
 *       bm   09/14/2022 Move ScatterWrite commands from common to versal_net
+*       ag   10/15/2026 Added XPlmi_IsSlrAddr
 *
 * </pre>
 *
@@ -313,6 +314,7 @@ void XPlmi_RtcaPlatInit(void);
 void XPlmi_PrintRomVersion(void);
 void XPlmi_PreInit(void);
 XPlmi_WaitForDmaDone_t XPlmi_GetPlmiWaitForDone(u64 DestAddr);
+u8 XPlmi_IsSlrAddr(u64 Addr);
 XPlmi_CircularBuffer *XPlmi_GetTraceLogInst(void);
 u32 XPlmi_GetReadbackLen(u32 Len);
 void XPlmi_GetReadbackSrcDest(u32 SlrType, u64 *SrcAddr, u64 *DestAddrRead);
@@ -19,6 +19,8 @@
 * ====  ==== ======== ======================================================-
 * 1.00  bm   07/06/2022 Initial release
 *       ma   07/08/2022 Add support for Tamper Trigger over IPI
+*       ag   10/14/2026 Allow GetTaskStats command over IPI
+*       ag   10/14/2026 Allow IpiMboxProcess command over IPI
 *
 * </pre>
 *
@@ -102,15 +104,18 @@ int XPlmi_ValidateCmd(u32 ModuleId, u32 ApiId)
 	switch (ModuleId) {
 		case XPLMI_MODULE_GENERIC_ID:
 			/*
-			 * Only Device ID, Event Logging and Get Board
-			 * commands are allowed through IPI.
+			 * Only Device ID, Event Logging, Get Board, Get
+			 * Task Stats and IPI Mailbox Process commands are
+			 * allowed through IPI.
 			 * All other commands are allowed only from CDO file.
 			 */
 			if ((ApiId == XPLMI_PLM_GENERIC_DEVICE_ID_VAL) ||
 					(ApiId == XPLMI_PLM_GENERIC_EVENT_LOGGING_VAL) ||
 					(ApiId == XPLMI_PLM_MODULES_FEATURES_VAL) ||
 					(ApiId == XPLMI_PLM_MODULES_GET_BOARD_VAL) ||
-					(ApiId == XPLMI_PLM_GENERIC_TAMP_TRIGGER_VAL)) {
+					(ApiId == XPLMI_PLM_GENERIC_TAMP_TRIGGER_VAL) ||
+					(ApiId == XPLMI_PLM_GENERIC_TASK_STATS_VAL) ||
+					(ApiId == XPLMI_PLM_GENERIC_IPI_MBOX_PROCESS_VAL)) {
 				Status = XST_SUCCESS;
 			}
 			break;
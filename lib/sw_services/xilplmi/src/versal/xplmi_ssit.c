@@ -37,6 +37,8 @@
 *                       Slave SLRs after completing synchronization
 *       ma   09/17/2022 Check SlavesMask before checking for sync initiation
 *                       from Slave SLRs in XPlmi_SsitSyncEventHandler
+*       ag   10/15/2026 Complete the transfer to the slave SLRs in flight
+*                       before synchronizing with them
 *
 * </pre>
 *
@@ -51,6 +53,7 @@
 #include "sleep.h"
 #include "xplmi_modules.h"
 #include "xplmi_wdt.h"
+#include "xplmi_dma.h"
 
 /************************** Function Prototypes ******************************/
 static u32 XPlmi_SsitGetSlaveErrorMask(void);
@@ -1456,6 +1459,13 @@ int XPlmi_SsitSyncSlaves(XPlmi_Cmd *Cmd)
 
 	XPlmi_Printf(DEBUG_INFO, "%s %p\n\r", __func__, Cmd);
 
+	/* Slaves reach the sync point only after they receive their data */
+	Status = XPlmi_WaitForSlrDmaXfr();
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	Status = XST_FAILURE;
+
 #ifdef PLM_ENABLE_PLM_TO_PLM_COMM
 	/* If SSIT interrupts are enabled, treat SSIT sync command as event */
 	if (SsitEvents->IsIntrEnabled == (u8)TRUE) {
@@ -1550,6 +1560,13 @@ int XPlmi_SsitWaitSlaves(XPlmi_Cmd *Cmd)
 
 	XPlmi_Printf(DEBUG_INFO, "%s %p\n\r", __func__, Cmd);
 
+	/* Slaves reach the sync point only after they receive their data */
+	Status = XPlmi_WaitForSlrDmaXfr();
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	Status = XST_FAILURE;
+
 #ifdef PLM_ENABLE_PLM_TO_PLM_COMM
 	/* If SSIT interrupts are enabled, treat SSIT sync command as event */
 	if (SsitEvents->IsIntrEnabled == (u8)TRUE) {
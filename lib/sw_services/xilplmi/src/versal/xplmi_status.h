@@ -100,6 +100,9 @@
 *       ma   08/10/2022 Added error code XPLMI_SSIT_INTR_NOT_ENABLED
 *       bm   08/24/2022 Support Begin, Break and End commands across chunk
 *                       boundaries
+*       ag   10/14/2026 Added partition cache error codes
+*       ag   10/14/2026 Added IPI mailbox error codes
+*       ag   10/14/2026 Added compressed partition error codes
 *
 * </pre>
 *
@@ -296,6 +299,12 @@ typedef enum {
 		                TamperTrigger IPI call */
 	XPLMI_INVALID_BREAK_LENGTH, /**< 0x140 - Error when the break length required to jump
 				      is less than the processed CDO length */
+	XPLMI_ERR_IPI_MBOX_INVALID_ADDR, /**< 0x141 - Error when the IPI mailbox
+						address range is invalid */
+	XPLMI_ERR_IPI_MBOX_NOT_CONFIGURED, /**< 0x142 - Error when the IPI
+						mailbox is not configured for the channel */
+	XPLMI_ERR_IPI_MBOX_INVALID_REQ, /**< 0x143 - Error when a request in the
+						IPI mailbox is invalid */
 
 	/** Platform specific Status codes used in PLMI from 0x1A0 to 0x1FF */
 	XPLMI_SSIT_EVENT_VECTOR_TABLE_IS_FULL = 0x1A0, /**< 0x1A0 - Error when the SSIT event
@@ -590,6 +599,21 @@ typedef enum {
 	XLOADER_INVALID_BLOCKTYPE, /**< 0x36E - Invalid Blocktype to Cframe data clear check */
 	XLOADER_CFI_CFRAME_IS_BUSY, /**< 0x36F - CRAM self check failed as CFI CFrame is busy */
 	XLOADER_CFRAME_CRC_CHECK_FAILED, /**< 0x370 - CFRAME CRC check failed */
+	XLOADER_ERR_PRTN_CACHE_INVALID_ADDR, /**< 0x371 - Invalid partition cache
+							region */
+	XLOADER_ERR_PRTN_CACHE_FULL, /**< 0x372 - No free partition cache slot or
+							cache region is full */
+	XLOADER_ERR_PRTN_CACHE_HASH_CALC, /**< 0x373 - Partition cache hash
+							calculation failed */
+	XLOADER_ERR_PRTN_CACHE_HASH_MISMATCH, /**< 0x374 - Cached partition hash
+							mismatch */
+	XLOADER_ERR_DECOMP_UNSUPPORTED, /**< 0x375 - Compressed partition is
+							secure, checksum enabled, CDO or out of
+							32 bit address range */
+	XLOADER_ERR_DECOMP_INVALID_HDR, /**< 0x376 - Invalid compressed
+							partition header */
+	XLOADER_ERR_DECOMP_CORRUPT, /**< 0x377 - Corrupt compressed partition
+							data */
 
 	/* Xilloader error codes specific to platform are from 0x3A0 to 0x3FF */
 
@@ -24,6 +24,9 @@
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  bm   07/06/2022 Initial release
 *       dc   07/17/2022 Added PLM_OCP configuration
+*       ag   10/14/2026 Added PLM_PRINT_BINLOG macro
+*       ag   10/15/2026 PLM_PRINT_BINLOG records go to the debug log buffer
+*       ag   10/14/2026 Added PLM_CDO_CMD_STATS macro
 *
 * </pre>
 *
@@ -83,6 +86,17 @@ extern "C" {
  */
 //#define PLM_PRINT_NO_UART
 
+/**
+ * Enable the below define to record XPlmi_Printf messages with integer
+ * arguments only in the BSP binary log (xil_binlog.h) instead of formatting
+ * them, to reduce the boot time spent on prints. It takes effect only if the
+ * BSP is built with the xil_printf_binlog parameter. The records are
+ * written to the PLM debug log in memory, not to the UART, and expanded by
+ * misc/plm_binlog_parser.py.
+ * This definition is disabled by default (i.e. not defined).
+ */
+//#define PLM_PRINT_BINLOG
+
 /**
  * Enabling the PLM_PRINT_PERF prints the time taken for loading partitions,
  * images and tasks. This define can be enabled with any of the above
@@ -166,6 +180,13 @@ extern "C" {
 //#define PLM_PRINT_PERF_KEYHOLE
 //#define PLM_PRINT_PERF_PL
 
+/**
+ * Enable the below define to collect the execution count, total time and
+ * latency histogram of every CDO and IPI command. The statistics can be
+ * printed using event logging command with sub command 9.
+ */
+//#define PLM_CDO_CMD_STATS
+
 /************************** Function Prototypes ******************************/
 
 /************************** Variable Definitions *****************************/
@@ -22,6 +22,7 @@
 *       bm   07/22/2022 Update EAM logic for In-Place PLM Update
 *       bm   07/22/2022 Retain critical data structures after In-Place PLM Update
 *       bm   07/22/2022 Shutdown modules gracefully during update
+*       ag   10/15/2026 Added XPlmi_IsSlrAddr
 *
 * </pre>
 *
@@ -727,6 +728,23 @@ XPlmi_WaitForDmaDone_t XPlmi_GetPlmiWaitForDone(u64 DestAddr)
 	return (XPlmi_WaitForDmaDone_t)XPmcDma_WaitForDone;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function checks if an address belongs to a slave SLR.
+ *		Not applicable for VersalNet.
+ *
+ * @param	Addr is the address to be checked
+ *
+ * @return	FALSE
+ *
+ *****************************************************************************/
+u8 XPlmi_IsSlrAddr(u64 Addr)
+{
+	(void)Addr;
+
+	return (u8)FALSE;
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function provides Gic interrupt id
@@ -25,6 +25,7 @@
 *       bm   07/22/2022 Shutdown modules gracefully during update
 *       ma   07/27/2022 Added XPlmi_SsitEventsInit function
 *       bm   09/14/2022 Move ScatterWrite commands from common to versal_net
+*       ag   10/15/2026 Added XPlmi_IsSlrAddr
 *
 * </pre>
 *
@@ -387,6 +388,7 @@ int XPlmi_VerifyAddrRange(u64 StartAddr, u64 EndAddr);
 XInterruptHandler *XPlmi_GetTopLevelIntrTbl(void);
 u8 XPlmi_GetTopLevelIntrTblSize(void);
 XPlmi_WaitForDmaDone_t XPlmi_GetPlmiWaitForDone(u64 DestAddr);
+u8 XPlmi_IsSlrAddr(u64 Addr);
 void XPlmi_PrintRomVersion(void);
 u32 XPlmi_GetGicIntrId(u32 GicPVal, u32 GicPxVal);
 u32 XPlmi_GetIpiIntrId(u32 BufferIndex);
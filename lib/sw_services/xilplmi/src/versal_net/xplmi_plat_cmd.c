@@ -23,6 +23,8 @@
 *       ma   07/29/2022 Replaced XPAR_XIPIPSU_0_DEVICE_ID macro with
 *                       XPLMI_IPI_DEVICE_ID
 *       bm   09/14/2022 Move ScatterWrite commands from common to versal_net
+*       ag   10/14/2026 Allow GetTaskStats command over IPI
+*       ag   10/14/2026 Allow IpiMboxProcess command over IPI
 *
 * </pre>
 *
@@ -121,8 +123,9 @@ int XPlmi_ValidateCmd(u32 ModuleId, u32 ApiId)
 	switch (ModuleId) {
 		case XPLMI_MODULE_GENERIC_ID:
 			/*
-			 * Only Device ID, Event Logging and Get Board
-			 * commands are allowed through IPI.
+			 * Only Device ID, Event Logging, Get Board, Get
+			 * Task Stats and IPI Mailbox Process commands are
+			 * allowed through IPI.
 			 * All other commands are allowed only from CDO file.
 			 */
 			if ((ApiId == XPLMI_PLM_GENERIC_DEVICE_ID_VAL) ||
@@ -130,7 +133,9 @@ int XPlmi_ValidateCmd(u32 ModuleId, u32 ApiId)
 					(ApiId == XPLMI_PLM_MODULES_FEATURES_VAL) ||
 					(ApiId == XPLMI_PLM_GENERIC_PLMUPDATE) ||
 					(ApiId == XPLMI_PLM_MODULES_GET_BOARD_VAL) ||
-					(ApiId == XPLMI_PLM_GENERIC_TAMP_TRIGGER_VAL)) {
+					(ApiId == XPLMI_PLM_GENERIC_TAMP_TRIGGER_VAL) ||
+					(ApiId == XPLMI_PLM_GENERIC_TASK_STATS_VAL) ||
+					(ApiId == XPLMI_PLM_GENERIC_IPI_MBOX_PROCESS_VAL)) {
 				Status = XST_SUCCESS;
 			}
 			break;
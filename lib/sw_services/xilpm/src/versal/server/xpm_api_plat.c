@@ -108,7 +108,9 @@
 	(1ULL << (u64)XPM_QID_PINCTRL_GET_PIN_GROUPS) | \
 	(1ULL << (u64)XPM_QID_CLOCK_GET_NUM_CLOCKS) | \
 	(1ULL << (u64)XPM_QID_CLOCK_GET_MAX_DIVISOR) | \
-	(1ULL << (u64)XPM_QID_PLD_GET_PARENT))
+	(1ULL << (u64)XPM_QID_PLD_GET_PARENT) | \
+	(1ULL << (u64)XPM_QID_CLOCK_GET_RATES) | \
+	(1ULL << (u64)XPM_QID_DEVICE_GET_LATENCY_STATS))
 
 /****************************************************************************/
 /**
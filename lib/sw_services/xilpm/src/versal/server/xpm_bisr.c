@@ -163,6 +163,26 @@ typedef struct XPm_NidbEfuseGrpInfo {
 	u8 NpiOffset;
 } XPm_NidbEfuseGrpInfo;
 
+/* Maximum GT and DDRMC BISR instances in progress at the same time */
+#define XPM_BISR_MAX_PENDING		(32U)
+
+/*
+ * GT and DDRMC BISR which is triggered and not yet checked. BISR engines of
+ * different GT quads and DDRMCs are independent, so BISR is triggered for
+ * all matching tags first and completion is checked once the eFuse scan is
+ * over, instead of waiting for each instance before triggering the next.
+ */
+typedef struct XPm_BisrPendingRepair {
+	u32 BaseAddr;
+	u32 StatusOffset;
+	u32 DoneMask;
+	u32 PassMask;
+	u32 TagType;
+} XPm_BisrPendingRepair;
+
+static XPm_BisrPendingRepair PendingRepair[XPM_BISR_MAX_PENDING];
+static u32 NumPendingRepair;
+
 static void XPmBisr_InitTagIdList(
 		u32 (*XPmTagIdWhiteListiPtr)[TAG_ID_ARRAY_SIZE])
 {
@@ -263,10 +283,85 @@ done:
 	return TagDataAddr;
 }
 
+static XStatus XPmBisr_CompletePending(void)
+{
+	XStatus Status = XST_SUCCESS;
+	XStatus RepairStatus;
+	const XPm_BisrPendingRepair *Repair;
+	u32 RegValue;
+	u32 Idx;
+	u16 DbgErr = XPM_INT_ERR_UNDEFINED;
+
+	/*
+	 * All instances are already running, so waiting for them one after the
+	 * other takes as long as the slowest one. Every instance is completed
+	 * even after a failure so that its PCSR gets locked.
+	 */
+	for (Idx = 0U; Idx < NumPendingRepair; Idx++) {
+		Repair = &PendingRepair[Idx];
+
+		/* Wait for Bisr to finish */
+		RepairStatus = XPm_PollForMask(Repair->BaseAddr + Repair->StatusOffset,
+					       Repair->DoneMask, XPM_POLL_TIMEOUT);
+		if (XST_SUCCESS != RepairStatus) {
+			DbgErr = XPM_INT_ERR_BISR_DONE_TIMEOUT;
+		} else {
+			/* Check Bisr Status */
+			PmIn32(Repair->BaseAddr + Repair->StatusOffset, RegValue);
+			if ((RegValue & Repair->PassMask) != Repair->PassMask) {
+				DbgErr = XPM_INT_ERR_BISR_PASS;
+				RepairStatus = XST_FAILURE;
+			} else if (TAG_ID_TYPE_DDRMC == Repair->TagType) {
+				/* Disable Bisr Clock */
+				PmRmw32(Repair->BaseAddr + DDRMC_NPI_CLK_GATE_REGISTER_OFFSET,
+					DDRMC_NPI_CLK_GATE_BISREN_MASK,
+					~DDRMC_NPI_CLK_GATE_BISREN_MASK);
+			} else {
+				/* Nothing more to do for GT */
+			}
+		}
+
+		/* Lock PCSR */
+		XPm_LockPcsr(Repair->BaseAddr);
+
+		if ((XST_SUCCESS == Status) && (XST_SUCCESS != RepairStatus)) {
+			Status = RepairStatus;
+		}
+	}
+
+	NumPendingRepair = 0U;
+
+	XPm_PrintDbgErr(Status, DbgErr);
+	return Status;
+}
+
+static XStatus XPmBisr_AddPending(u32 BaseAddr, u32 StatusOffset, u32 DoneMask,
+				  u32 PassMask, u32 TagType)
+{
+	XStatus Status = XST_SUCCESS;
+	XPm_BisrPendingRepair *Repair;
+
+	/* Make room by completing the instances in progress */
+	if (XPM_BISR_MAX_PENDING == NumPendingRepair) {
+		Status = XPmBisr_CompletePending();
+	}
+
+	/* Track the new instance even on failure so that it gets completed */
+	Repair = &PendingRepair[NumPendingRepair];
+	Repair->BaseAddr = BaseAddr;
+	Repair->StatusOffset = StatusOffset;
+	Repair->DoneMask = DoneMask;
+	Repair->PassMask = PassMask;
+	Repair->TagType = TagType;
+	NumPendingRepair++;
+
+	return Status;
+}
+
 static XStatus XPmBisr_RepairGty(u32 EfuseTagAddr, u32 TagSize, u32 TagOptional, u32 *TagDataAddr, u32 TagType)
 {
 	XStatus Status = XST_FAILURE;
-	u32 RegValue, EfuseEndpointShift;
+	u32 EfuseEndpointShift;
 	u32 BaseAddr, BisrDataDestAddr;
 	u16 DbgErr = XPM_INT_ERR_UNDEFINED;
 
@@ -309,23 +404,10 @@ static XStatus XPmBisr_RepairGty(u32 EfuseTagAddr, u32 TagSize, u32 TagOptional,
 	PmOut32(BaseAddr + GTY_PCSR_MASK_OFFSET, GTY_PCSR_BISR_TRIGGER_MASK);
 	PmOut32(BaseAddr + GTY_PCSR_CONTROL_OFFSET, GTY_PCSR_BISR_TRIGGER_MASK);
 
-	/* Wait for Bisr to finish */
-	Status = XPm_PollForMask(BaseAddr + GTY_PCSR_STATUS_OFFSET, GTY_PCSR_STATUS_BISR_DONE_MASK, XPM_POLL_TIMEOUT);
-	if (XST_SUCCESS != Status) {
-		DbgErr = XPM_INT_ERR_BISR_DONE_TIMEOUT;
-		goto fail;
-	}
-
-	PmIn32(BaseAddr + GTY_PCSR_STATUS_OFFSET, RegValue);
-	if ((RegValue & GTY_PCSR_STATUS_BISR_PASS_MASK) != GTY_PCSR_STATUS_BISR_PASS_MASK) {
-		DbgErr = XPM_INT_ERR_BISR_PASS;
-		Status = XST_FAILURE;
-		goto fail;
-	}
-
-fail:
-	/* Lock PCSR */
-	XPm_LockPcsr(BaseAddr);
+	/* Completion is checked and PCSR is locked by XPmBisr_CompletePending */
+	Status = XPmBisr_AddPending(BaseAddr, GTY_PCSR_STATUS_OFFSET,
+				    GTY_PCSR_STATUS_BISR_DONE_MASK,
+				    GTY_PCSR_STATUS_BISR_PASS_MASK, TagType);
 
 done:
 	XPm_PrintDbgErr(Status, DbgErr);
@@ -605,7 +687,6 @@ done:
 static XStatus XPmBisr_RepairDdrMc(u32 EfuseTagAddr, u32 TagSize, u32 TagOptional, u32 *TagDataAddr)
 {
 	XStatus Status = XST_FAILURE;
-	u32 RegValue;
 	u32 BaseAddr, BisrDataDestAddr;
 	u16 DbgErr = XPM_INT_ERR_UNDEFINED;
 
@@ -626,28 +707,14 @@ static XStatus XPmBisr_RepairDdrMc(u32 EfuseTagAddr, u32 TagSize, u32 TagOptiona
 	PmOut32(BaseAddr + DDRMC_NPI_PCSR_MASK_REGISTER_OFFSET, DDRMC_NPI_PCSR_BISR_TRIGGER_MASK);
 	PmOut32(BaseAddr + DDRMC_NPI_PCSR_CONTROL_REGISTER_OFFSET, DDRMC_NPI_PCSR_BISR_TRIGGER_MASK);
 
-	/* Wait for Bisr to be done and check status */
-	Status = XPm_PollForMask(BaseAddr + DDRMC_NPI_CACHE_STATUS_REGISTER_OFFSET,
-				 DDRMC_NPI_CACHE_STATUS_BISR_DONE_MASK,
-				 XPM_POLL_TIMEOUT);
-	if (XST_SUCCESS != Status) {
-		DbgErr = XPM_INT_ERR_BISR_DONE_TIMEOUT;
-		goto fail;
-	}
-
-	PmIn32(BaseAddr + DDRMC_NPI_CACHE_STATUS_REGISTER_OFFSET, RegValue);
-	if ((RegValue & DDRMC_NPI_CACHE_STATUS_BISR_PASS_MASK) != DDRMC_NPI_CACHE_STATUS_BISR_PASS_MASK) {
-		DbgErr = XPM_INT_ERR_BISR_PASS;
-		Status = XST_FAILURE;
-		goto fail;
-	}
-
-	/* Disable Bisr Clock */
-	PmRmw32(BaseAddr + DDRMC_NPI_CLK_GATE_REGISTER_OFFSET, DDRMC_NPI_CLK_GATE_BISREN_MASK, ~DDRMC_NPI_CLK_GATE_BISREN_MASK);
-
-fail:
-	/* Lock PCSR */
-	XPm_LockPcsr(BaseAddr);
+	/*
+	 * Completion is checked, Bisr clock is disabled and PCSR is locked by
+	 * XPmBisr_CompletePending
+	 */
+	Status = XPmBisr_AddPending(BaseAddr, DDRMC_NPI_CACHE_STATUS_REGISTER_OFFSET,
+				    DDRMC_NPI_CACHE_STATUS_BISR_DONE_MASK,
+				    DDRMC_NPI_CACHE_STATUS_BISR_PASS_MASK,
+				    TAG_ID_TYPE_DDRMC);
 
 	XPm_PrintDbgErr(Status, DbgErr);
 	return Status;
@@ -1536,6 +1603,13 @@ XStatus XPmBisr_Repair(u32 TagId)
 	Status = XST_SUCCESS;
 
 done:
+	/* Check GT and DDRMC BISR still in progress, also on failure */
+	StatusTmp = XPmBisr_CompletePending();
+	if ((XST_SUCCESS == Status) && (XST_SUCCESS != StatusTmp)) {
+		DbgErr = XPM_INT_ERR_BISR_REPAIR;
+		Status = StatusTmp;
+	}
+
 	XPm_PrintDbgErr(Status, DbgErr);
 	return Status;
 }
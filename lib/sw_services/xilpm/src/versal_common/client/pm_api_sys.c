@@ -13,9 +13,19 @@
 #include "pm_api_sys.h"
 #include "pm_callbacks.h"
 #include "pm_client.h"
+#include "xil_cache.h"
 
 /** @cond INTERNAL */
 
+/* Notification ring registered with XPm_RegisterNotifyRing() */
+static XPm_NotifyRingHdr *NotifyRing = NULL;
+static u32 NotifyRingEntries;
+static u32 NotifyRingSize;
+
+/* Cache of immutable queries set up with XPm_QueryCacheInit() */
+static XPm_QueryCacheEntry *QueryCache = NULL;
+static u32 QueryCacheSize;
+
 /* Payload Packets */
 #define PACK_PAYLOAD(Payload, Arg0, Arg1, Arg2, Arg3, Arg4, Arg5)	\
 	Payload[0] = (u32)Arg0;						\
@@ -1759,38 +1769,21 @@ done:
 
 /****************************************************************************/
 /**
- * @brief  This function queries information about the platform resources.
+ * @brief  This function copies the IPI response of a query to the output
+ * data of XPm_Query()
  *
- * @param QueryId	The type of data to query
- * @param Arg1		Query argument 1
- * @param Arg2		Query argument 2
- * @param Arg3		Query argument 3
+ * @param QueryId	The type of data queried
+ * @param Status	Status word of the response
+ * @param Resp		Data words of the response
  * @param Data		Pointer to the output data
  *
  * @return XST_SUCCESS if successful else XST_FAILURE or an error code
  * or a reason code
  *
  ****************************************************************************/
-XStatus XPm_Query(const u32 QueryId, const u32 Arg1, const u32 Arg2,
-		  const u32 Arg3, u32 *const Data)
+static XStatus XPm_QueryUnpack(const u32 QueryId, XStatus Status,
+			       const u32 *const Resp, u32 *const Data)
 {
-
-	XStatus Status = (s32)XST_FAILURE;
-	u32 Payload[PAYLOAD_ARG_CNT];
-
-	if (NULL == Data) {
-		XPm_Err("Passing NULL pointer to %s\r\n", __func__);
-		goto done;
-	}
-
-	PACK_PAYLOAD4(Payload, PM_QUERY_DATA, QueryId, Arg1, Arg2, Arg3);
-
-	/* Send request to the target module */
-	Status = XPm_IpiSend(PrimaryProc, Payload);
-	if (XST_SUCCESS != Status) {
-		goto done;
-	}
-
 	switch (QueryId) {
 	case (u32)XPM_QID_CLOCK_GET_NAME:
 	case (u32)XPM_QID_PINCTRL_GET_FUNCTION_NAME:
@@ -1800,7 +1793,9 @@ XStatus XPm_Query(const u32 QueryId, const u32 Arg1, const u32 Arg2,
 		 * in response. So this value should not be treated as error code.
 		 * Consider error only if clock name is not found.
 		 */
-		Status = Xpm_IpiReadBuff32(PrimaryProc, &Data[1], &Data[2], &Data[3]);
+		Data[1] = Resp[0];
+		Data[2] = Resp[1];
+		Data[3] = Resp[2];
 		if (XST_SUCCESS != Status) {
 			Data[0] = (u32)('\0');
 			Status = (s32)XST_FAILURE;
@@ -1813,11 +1808,16 @@ XStatus XPm_Query(const u32 QueryId, const u32 Arg1, const u32 Arg2,
 	case (u32)XPM_QID_CLOCK_GET_MUXSOURCES:
 	case (u32)XPM_QID_PINCTRL_GET_FUNCTION_GROUPS:
 	case (u32)XPM_QID_PINCTRL_GET_PIN_GROUPS:
-		Status = Xpm_IpiReadBuff32(PrimaryProc, &Data[0], &Data[1], &Data[2]);
+	case (u32)XPM_QID_CLOCK_GET_RATES:
+	case (u32)XPM_QID_DEVICE_GET_LATENCY_STATS:
+		Data[0] = Resp[0];
+		Data[1] = Resp[1];
+		Data[2] = Resp[2];
 		break;
 
 	case (u32)XPM_QID_CLOCK_GET_FIXEDFACTOR_PARAMS:
-		Status = Xpm_IpiReadBuff32(PrimaryProc, &Data[0], &Data[1], NULL);
+		Data[0] = Resp[0];
+		Data[1] = Resp[1];
 		break;
 
 	case (u32)XPM_QID_CLOCK_GET_ATTRIBUTES:
@@ -1827,7 +1827,7 @@ XStatus XPm_Query(const u32 QueryId, const u32 Arg1, const u32 Arg2,
 	case (u32)XPM_QID_CLOCK_GET_NUM_CLOCKS:
 	case (u32)XPM_QID_CLOCK_GET_MAX_DIVISOR:
 	case (u32)XPM_QID_PLD_GET_PARENT:
-		Status = Xpm_IpiReadBuff32(PrimaryProc, &Data[0], NULL, NULL);
+		Data[0] = Resp[0];
 		break;
 
 	default:
@@ -1835,6 +1835,165 @@ XStatus XPm_Query(const u32 QueryId, const u32 Arg1, const u32 Arg2,
 		break;
 	}
 
+	return Status;
+}
+
+/****************************************************************************/
+/**
+ * @brief  This function looks up a query in the query cache
+ *
+ * @param QueryId	The type of data to query
+ * @param Arg1		Query argument 1
+ * @param Arg2		Query argument 2
+ * @param Arg3		Query argument 3
+ * @param Found		Set to 1 if the query is in the cache, else 0
+ *
+ * @return Pointer to the entry of the query if it is found, else to the free
+ * entry to add it to. NULL if the query is not cacheable or the cache is
+ * full.
+ *
+ * @note   Only queries of data that does not change after boot are cached
+ *
+ ****************************************************************************/
+static XPm_QueryCacheEntry *XPm_QueryCacheFind(const u32 QueryId,
+					       const u32 Arg1, const u32 Arg2,
+					       const u32 Arg3, u8 *const Found)
+{
+	XPm_QueryCacheEntry *Entry = NULL;
+	u32 Idx;
+	u32 Probe;
+
+	*Found = 0U;
+
+	switch (QueryId) {
+	case (u32)XPM_QID_CLOCK_GET_NAME:
+	case (u32)XPM_QID_CLOCK_GET_TOPOLOGY:
+	case (u32)XPM_QID_CLOCK_GET_FIXEDFACTOR_PARAMS:
+	case (u32)XPM_QID_CLOCK_GET_MUXSOURCES:
+	case (u32)XPM_QID_PINCTRL_GET_NUM_PINS:
+	case (u32)XPM_QID_PINCTRL_GET_NUM_FUNCTIONS:
+	case (u32)XPM_QID_PINCTRL_GET_NUM_FUNCTION_GROUPS:
+	case (u32)XPM_QID_PINCTRL_GET_FUNCTION_NAME:
+	case (u32)XPM_QID_PINCTRL_GET_FUNCTION_GROUPS:
+	case (u32)XPM_QID_PINCTRL_GET_PIN_GROUPS:
+	case (u32)XPM_QID_CLOCK_GET_NUM_CLOCKS:
+	case (u32)XPM_QID_CLOCK_GET_MAX_DIVISOR:
+		break;
+	default:
+		/* Attributes, rates, parents and statistics change */
+		goto done;
+	}
+
+	if (NULL == QueryCache) {
+		goto done;
+	}
+
+	/* Open addressing with linear probing */
+	Idx = ((((QueryId * 31U) + Arg1) * 31U) + Arg2) * 31U;
+	Idx = (Idx + Arg3) % QueryCacheSize;
+	for (Probe = 0U; Probe < QueryCacheSize; Probe++) {
+		Entry = &QueryCache[Idx];
+		if ((u32)XPM_QID_INVALID == Entry->QueryId) {
+			break;
+		}
+		if ((QueryId == Entry->QueryId) && (Arg1 == Entry->Args[0]) &&
+		    (Arg2 == Entry->Args[1]) && (Arg3 == Entry->Args[2])) {
+			*Found = 1U;
+			break;
+		}
+		Entry = NULL;
+		Idx = (Idx + 1U) % QueryCacheSize;
+	}
+
+done:
+	return Entry;
+}
+
+/****************************************************************************/
+/**
+ * @brief  This function adds the successful response of a query to the
+ * query cache if the query is cacheable
+ *
+ * @param QueryId	The type of data queried
+ * @param Args		Query arguments
+ * @param Resp		Data words of the response
+ *
+ * @return None
+ *
+ ****************************************************************************/
+static void XPm_QueryCacheAdd(const u32 QueryId, const u32 *const Args,
+			      const u32 *const Resp)
+{
+	XPm_QueryCacheEntry *Entry;
+	u8 Found;
+
+	Entry = XPm_QueryCacheFind(QueryId, Args[0], Args[1], Args[2], &Found);
+	if ((NULL == Entry) || (1U == Found)) {
+		return;
+	}
+
+	Entry->Args[0] = Args[0];
+	Entry->Args[1] = Args[1];
+	Entry->Args[2] = Args[2];
+	Entry->Resp[0] = Resp[0];
+	Entry->Resp[1] = Resp[1];
+	Entry->Resp[2] = Resp[2];
+	Entry->QueryId = QueryId;
+}
+
+/****************************************************************************/
+/**
+ * @brief  This function queries information about the platform resources.
+ *
+ * @param QueryId	The type of data to query
+ * @param Arg1		Query argument 1
+ * @param Arg2		Query argument 2
+ * @param Arg3		Query argument 3
+ * @param Data		Pointer to the output data
+ *
+ * @return XST_SUCCESS if successful else XST_FAILURE or an error code
+ * or a reason code
+ *
+ * @note   Queries of data that does not change after boot are answered from
+ * the query cache when it is set up with XPm_QueryCacheInit().
+ *
+ ****************************************************************************/
+XStatus XPm_Query(const u32 QueryId, const u32 Arg1, const u32 Arg2,
+		  const u32 Arg3, u32 *const Data)
+{
+
+	XStatus Status = (s32)XST_FAILURE;
+	u32 Payload[PAYLOAD_ARG_CNT];
+	const XPm_QueryCacheEntry *Entry;
+	u32 Args[3] = {Arg1, Arg2, Arg3};
+	u32 Resp[3] = {0U};
+	u8 Found;
+
+	if (NULL == Data) {
+		XPm_Err("Passing NULL pointer to %s\r\n", __func__);
+		goto done;
+	}
+
+	Entry = XPm_QueryCacheFind(QueryId, Arg1, Arg2, Arg3, &Found);
+	if (1U == Found) {
+		Status = XPm_QueryUnpack(QueryId, XST_SUCCESS, Entry->Resp, Data);
+		goto done;
+	}
+
+	PACK_PAYLOAD4(Payload, PM_QUERY_DATA, QueryId, Arg1, Arg2, Arg3);
+
+	/* Send request to the target module */
+	Status = XPm_IpiSend(PrimaryProc, Payload);
+	if (XST_SUCCESS != Status) {
+		goto done;
+	}
+
+	Status = Xpm_IpiReadBuff32(PrimaryProc, &Resp[0], &Resp[1], &Resp[2]);
+	if (XST_SUCCESS == Status) {
+		XPm_QueryCacheAdd(QueryId, Args, Resp);
+	}
+	Status = XPm_QueryUnpack(QueryId, Status, Resp, Data);
+
 done:
 	return Status;
 }
@@ -2135,6 +2294,101 @@ void XPm_AcknowledgeCb(const u32 Node, const XStatus Status, const u32 Oppoint)
 	pm_ack.received = 1U;
 }
 
+/****************************************************************************/
+/**
+ * @brief  This function processes all the events available in the
+ * notification ring
+ *
+ * @return None
+ *
+ * @note   Tail is written before Head is read back, so an event added by
+ * the platform management controller while draining is either processed
+ * here or followed by a new doorbell.
+ *
+ ****************************************************************************/
+static void XPm_NotifyRingDrain(void)
+{
+	const XPm_NotifyRingEntry *Entries =
+		(const XPm_NotifyRingEntry *)(NotifyRing + 1);
+	const XPm_NotifyRingEntry *Entry;
+	u32 Head;
+	u32 Tail = NotifyRing->Tail;
+
+	Xil_DCacheInvalidateRange((UINTPTR)NotifyRing, NotifyRingSize);
+	Head = NotifyRing->Head;
+	while (Head != Tail) {
+		Entry = &Entries[Tail & (NotifyRingEntries - 1U)];
+		XPm_NotifierProcessEvent(Entry->NodeId, Entry->Event,
+					 Entry->State);
+		Tail++;
+		if (Head == Tail) {
+			/* Publish consumed entries and check for new ones */
+			NotifyRing->Tail = Tail;
+			Xil_DCacheFlushRange((UINTPTR)&NotifyRing->Tail,
+					     sizeof(NotifyRing->Tail));
+			Xil_DCacheInvalidateRange((UINTPTR)NotifyRing,
+						  NotifyRingSize);
+			Head = NotifyRing->Head;
+		}
+	}
+}
+
+/****************************************************************************/
+/**
+ * @brief  This function registers a shared memory ring through which the
+ * platform management controller delivers notifications, so that bursts of
+ * events are handled with a single interrupt
+ *
+ * @param  Ring		Pointer to the ring, XPm_NotifyRingHdr followed by
+ *			NumEntries XPm_NotifyRingEntry entries. NULL
+ *			unregisters the ring.
+ * @param  NumEntries	Number of ring entries, power of two up to
+ *			XPM_NOTIFY_RING_MAX_ENTRIES
+ *
+ * @return XST_SUCCESS if successful else XST_FAILURE or an error code
+ * or a reason code
+ *
+ * @note   The ring must be in memory accessible by the platform management
+ * controller. Events registered with XPm_RegisterNotifier() are delivered to
+ * the notifier callbacks from the ring. Events dropped because the ring was
+ * full are counted in the Overflow field of the header.
+ *
+ ****************************************************************************/
+XStatus XPm_RegisterNotifyRing(XPm_NotifyRingHdr *const Ring,
+			       const u32 NumEntries)
+{
+	XStatus Status = (s32)XST_FAILURE;
+	u32 Payload[PAYLOAD_ARG_CNT];
+	u64 RingAddr = (u64)(UINTPTR)Ring;
+	u32 Entries = (NULL == Ring) ? 0U : NumEntries;
+
+	/* Stop draining before the ring is released */
+	NotifyRing = NULL;
+
+	PACK_PAYLOAD3(Payload, PM_REGISTER_NOTIFY_RING, (u32)RingAddr,
+		      (u32)(RingAddr >> 32U), Entries);
+
+	/* Send request to the target module */
+	Status = XPm_IpiSend(PrimaryProc, Payload);
+	if (XST_SUCCESS != Status) {
+		goto done;
+	}
+
+	/* Return result from IPI return buffer */
+	Status = Xpm_IpiReadBuff32(PrimaryProc, NULL, NULL, NULL);
+	if ((XST_SUCCESS != Status) || (0U == Entries)) {
+		goto done;
+	}
+
+	NotifyRingEntries = Entries;
+	NotifyRingSize = (u32)sizeof(XPm_NotifyRingHdr) +
+		(Entries * (u32)sizeof(XPm_NotifyRingEntry));
+	NotifyRing = Ring;
+
+done:
+	return Status;
+}
+
 /****************************************************************************/
 /**
  * @brief  This function is called by the power management controller if an
@@ -2151,7 +2405,11 @@ void XPm_AcknowledgeCb(const u32 Node, const XStatus Status, const u32 Oppoint)
 void XPm_NotifyCb(const u32 Node, const u32 Event, const u32 Oppoint)
 {
 	XPm_Dbg("%s (%d, %d, %d)\n", __func__, Node, Event, Oppoint);
-	XPm_NotifierProcessEvent(Node, Event, Oppoint);
+	if ((XPM_NOTIFY_RING_DOORBELL == Node) && (NULL != NotifyRing)) {
+		XPm_NotifyRingDrain();
+	} else {
+		XPm_NotifierProcessEvent(Node, Event, Oppoint);
+	}
 }
 
 /** @cond INTERNAL */
@@ -2230,3 +2488,166 @@ XStatus XPm_FeatureCheck(const u32 FeatureId, u32 *Version)
 done:
 	return Status;
 }
+
+/****************************************************************************/
+/**
+ * @brief  This function is used to execute a list of device, clock and
+ * reset operations with a single request to the platform management
+ * controller
+ *
+ * @param  Ops		Pointer to the list of operations. Supported APIs are
+ *			PM_REQUEST_NODE, PM_RELEASE_NODE, PM_SET_REQUIREMENT,
+ *			PM_CLOCK_ENABLE, PM_CLOCK_DISABLE and PM_RESET_ASSERT
+ * @param  NumOps	Number of operations, maximum XPM_BATCH_MAX_OPS
+ * @param  ProcessedOps	Returns number of operations completed successfully
+ *
+ * @return XST_SUCCESS if successful else XST_FAILURE or an error code
+ * or a reason code of the failed operation
+ *
+ * @note   Operations are executed in order and processing stops at the
+ * first failure. The list must be in memory accessible by the platform
+ * management controller.
+ *
+ ****************************************************************************/
+XStatus XPm_BatchOps(const XPm_BatchOp *const Ops, const u32 NumOps,
+		     u32 *const ProcessedOps)
+{
+	XStatus Status = (s32)XST_FAILURE;
+	u32 Payload[PAYLOAD_ARG_CNT];
+	u64 OpsAddr = (u64)(UINTPTR)Ops;
+
+	if ((NULL == Ops) || (NULL == ProcessedOps)) {
+		XPm_Err("Passing NULL pointer to %s\r\n", __func__);
+		goto done;
+	}
+
+	/* Make the operation list visible to the PLM */
+	Xil_DCacheFlushRange((UINTPTR)Ops, NumOps * sizeof(XPm_BatchOp));
+
+	PACK_PAYLOAD3(Payload, PM_BATCH_OPS, (u32)OpsAddr,
+		      (u32)(OpsAddr >> 32U), NumOps);
+
+	/* Send request to the target module */
+	Status = XPm_IpiSend(PrimaryProc, Payload);
+	if (XST_SUCCESS != Status) {
+		goto done;
+	}
+
+	/* Return result from IPI return buffer */
+	Status = Xpm_IpiReadBuff32(PrimaryProc, ProcessedOps, NULL, NULL);
+
+done:
+	return Status;
+}
+
+/****************************************************************************/
+/**
+ * @brief  This function sets up the cache of queries of data that does not
+ * change after boot, such as clock topology, clock names and pin functions,
+ * so that XPm_Query() sends a request to the platform management controller
+ * only the first time such a query is made
+ *
+ * @param  Entries	Pointer to the memory of the cache. NULL disables the
+ *			cache.
+ * @param  NumEntries	Number of cache entries
+ *
+ * @return XST_SUCCESS if successful else XST_INVALID_PARAM
+ *
+ * @note   The cache is empty after this call. When it is full, further
+ * queries are sent to the platform management controller.
+ *
+ ****************************************************************************/
+XStatus XPm_QueryCacheInit(XPm_QueryCacheEntry *const Entries,
+			   const u32 NumEntries)
+{
+	XStatus Status = (s32)XST_FAILURE;
+	u32 Idx;
+
+	QueryCache = NULL;
+
+	if (NULL == Entries) {
+		Status = XST_SUCCESS;
+		goto done;
+	}
+	if (0U == NumEntries) {
+		Status = (s32)XST_INVALID_PARAM;
+		goto done;
+	}
+
+	for (Idx = 0U; Idx < NumEntries; Idx++) {
+		Entries[Idx].QueryId = (u32)XPM_QID_INVALID;
+	}
+	QueryCacheSize = NumEntries;
+	QueryCache = Entries;
+	Status = XST_SUCCESS;
+
+done:
+	return Status;
+}
+
+/****************************************************************************/
+/**
+ * @brief  This function runs a table of queries with a single request to the
+ * platform management controller. Successful responses are added to the
+ * query cache, so that the table can be used to fill the cache at init.
+ *
+ * @param  Entries	Pointer to the table. QueryId and Args of each entry
+ *			are inputs, Response is written with the status and
+ *			data of the query, as in the IPI response.
+ * @param  NumEntries	Number of entries, maximum XPM_QUERY_BULK_MAX_ENTRIES
+ * @param  ProcessedEntries	Returns number of entries written back
+ *
+ * @return XST_SUCCESS if successful else XST_FAILURE or an error code
+ * or a reason code
+ *
+ * @note   A failed query does not stop the others. The table must be in
+ * memory accessible by the platform management controller.
+ *
+ ****************************************************************************/
+XStatus XPm_QueryBulk(XPm_QueryBulkEntry *const Entries, const u32 NumEntries,
+		      u32 *const ProcessedEntries)
+{
+	XStatus Status = (s32)XST_FAILURE;
+	u32 Payload[PAYLOAD_ARG_CNT];
+	u64 EntriesAddr = (u64)(UINTPTR)Entries;
+	u32 Idx;
+
+	if ((NULL == Entries) || (NULL == ProcessedEntries)) {
+		XPm_Err("Passing NULL pointer to %s\r\n", __func__);
+		goto done;
+	}
+
+	/* Make the table visible to the PLM */
+	Xil_DCacheFlushRange((UINTPTR)Entries,
+			     NumEntries * sizeof(XPm_QueryBulkEntry));
+
+	PACK_PAYLOAD3(Payload, PM_QUERY_BULK, (u32)EntriesAddr,
+		      (u32)(EntriesAddr >> 32U), NumEntries);
+
+	/* Send request to the target module */
+	Status = XPm_IpiSend(PrimaryProc, Payload);
+	if (XST_SUCCESS != Status) {
+		goto done;
+	}
+
+	/* Return result from IPI return buffer */
+	Status = Xpm_IpiReadBuff32(PrimaryProc, ProcessedEntries, NULL, NULL);
+	if (XST_SUCCESS != Status) {
+		goto done;
+	}
+
+	/* Responses are written by the PLM */
+	Xil_DCacheInvalidateRange((UINTPTR)Entries,
+				  NumEntries * sizeof(XPm_QueryBulkEntry));
+
+	for (Idx = 0U; Idx < *ProcessedEntries; Idx++) {
+		if ((u32)XST_SUCCESS == Entries[Idx].Response[0]) {
+			XPm_QueryCacheAdd(Entries[Idx].QueryId,
+					  Entries[Idx].Args,
+					  &Entries[Idx].Response[1]);
+		}
+	}
+
+done:
+	return Status;
+}
@@ -86,6 +86,16 @@ typedef struct XPm_Ntfier {
 	struct XPm_Ntfier* next;
 } XPm_Notifier;
 
+/**
+ * XPm_QueryCacheEntry - Entry of the query cache set up with
+ * XPm_QueryCacheInit(). Entries are managed by the library.
+ */
+typedef struct {
+	u32 QueryId;	/**< Query ID, XPM_QID_INVALID if the entry is free */
+	u32 Args[3];	/**< Query arguments */
+	u32 Resp[3];	/**< Data words of the query response */
+} XPm_QueryCacheEntry;
+
 /* Global data declarations */
 extern struct pm_init_suspend pm_susp;
 extern struct pm_acknowledge pm_ack;
@@ -158,6 +168,14 @@ void XPm_AcknowledgeCb(const u32 Node, const XStatus Status, const u32 Oppoint);
 XStatus XPm_ClockSetRate(const u32 ClockId, const u32 Rate);
 XStatus XPm_ClockGetRate(const u32 ClockId, u32 *const Rate);
 XStatus XPm_FeatureCheck(const u32 FeatureId, u32 *Version);
+XStatus XPm_BatchOps(const XPm_BatchOp *const Ops, const u32 NumOps,
+		     u32 *const ProcessedOps);
+XStatus XPm_RegisterNotifyRing(XPm_NotifyRingHdr *const Ring,
+			       const u32 NumEntries);
+XStatus XPm_QueryCacheInit(XPm_QueryCacheEntry *const Entries,
+			   const u32 NumEntries);
+XStatus XPm_QueryBulk(XPm_QueryBulkEntry *const Entries, const u32 NumEntries,
+		      u32 *const ProcessedEntries);
 
 /** @cond INTERNAL */
 XStatus XPm_SetConfiguration(const u32 Address);
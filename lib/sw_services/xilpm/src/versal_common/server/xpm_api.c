@@ -164,19 +164,14 @@ static XStatus XPm_GetClockRate(const u32 ClockId, u32 *ClkRate)
 {
 	XPM_EXPORT_CMD(PM_CLOCK_GETRATE, XPLMI_CMD_ARG_CNT_ONE, XPLMI_CMD_ARG_CNT_ONE);
 	XStatus Status = XST_SUCCESS;
-	const XPm_ClockNode *Clk = XPmClock_GetById(ClockId);
+	XPm_ClockNode *Clk = XPmClock_GetById(ClockId);
 
 	if (NULL == Clk) {
 		Status = XST_INVALID_PARAM;
 		goto done;
 	}
 
-	/* Get rate is allowed only for ref clocks */
-	if (!ISREFCLK(ClockId)) {
-		Status = XST_INVALID_PARAM;
-		goto done;
-	}
-
+	/* Rate of PLL and output clocks is derived from ref clocks */
 	Status = XPmClock_GetRate(Clk, ClkRate);
 
 done:
@@ -297,6 +292,244 @@ done:
 	return Status;
 }
 
+/****************************************************************************/
+/**
+ * @brief  This function checks if the given PM API is allowed in a batch.
+ *
+ * @param  ApiId	PM API ID of the batch operation
+ *
+ * @return XST_SUCCESS if allowed else XST_INVALID_PARAM
+ *
+ * @note   None
+ *
+ ****************************************************************************/
+static XStatus XPm_IsBatchOpSupported(const u32 ApiId)
+{
+	XStatus Status = XST_INVALID_PARAM;
+
+	switch (ApiId) {
+	case PM_API(PM_REQUEST_NODE):
+	case PM_API(PM_RELEASE_NODE):
+	case PM_API(PM_SET_REQUIREMENT):
+	case PM_API(PM_CLOCK_ENABLE):
+	case PM_API(PM_CLOCK_DISABLE):
+	case PM_API(PM_RESET_ASSERT):
+		Status = XST_SUCCESS;
+		break;
+	default:
+		Status = XST_INVALID_PARAM;
+		break;
+	}
+
+	return Status;
+}
+
+/****************************************************************************/
+/**
+ * @brief  This function executes a list of device, clock and reset operations
+ * for the subsystem with a single command, so that the subsystem does not
+ * need an IPI round trip for each operation.
+ *
+ * @param SubsystemId	Subsystem ID
+ * @param OpsAddrLow	Lower 32 bit address of the XPm_BatchOp list
+ * @param OpsAddrHigh	Upper 32 bit address of the XPm_BatchOp list
+ * @param NumOps	Number of operations in the list
+ * @param CmdType	IPI command request type
+ * @param ProcessedOps	Number of operations completed successfully
+ *
+ * @return XST_SUCCESS if all operations are successful else error code of
+ * the failed operation
+ *
+ * @note   All the operations are validated before executing any of them.
+ * Operations are executed in order, without processing other PM commands in
+ * between, and processing stops at the first failure. Operations completed
+ * before the failure are not reverted.
+ *
+ ****************************************************************************/
+static XStatus XPm_BatchOps(const u32 SubsystemId, const u32 OpsAddrLow,
+			    const u32 OpsAddrHigh, const u32 NumOps,
+			    const u32 CmdType, u32 *const ProcessedOps)
+{
+	XPM_EXPORT_CMD(PM_BATCH_OPS, XPLMI_CMD_ARG_CNT_THREE, XPLMI_CMD_ARG_CNT_THREE);
+	XStatus Status = XST_FAILURE;
+	u64 OpsAddr = ((u64)OpsAddrHigh << 32ULL) | (u64)OpsAddrLow;
+	u64 OpAddr;
+	u32 Op[XPM_BATCH_OP_WORDS];
+	u32 Idx;
+	u32 Word;
+
+	*ProcessedOps = 0U;
+
+	if ((0U == NumOps) || (XPM_BATCH_MAX_OPS < NumOps)) {
+		Status = XST_INVALID_PARAM;
+		goto done;
+	}
+
+	/* Validate all the operations before executing any of them */
+	OpAddr = OpsAddr;
+	for (Idx = 0U; Idx < NumOps; Idx++) {
+		Status = XPm_IsBatchOpSupported(XPm_In64(OpAddr));
+		if (XST_SUCCESS != Status) {
+			goto done;
+		}
+		OpAddr += (u64)XPM_BATCH_OP_WORDS * sizeof(u32);
+	}
+
+	OpAddr = OpsAddr;
+	for (Idx = 0U; Idx < NumOps; Idx++) {
+		for (Word = 0U; Word < XPM_BATCH_OP_WORDS; Word++) {
+			Op[Word] = XPm_In64(OpAddr + ((u64)Word * sizeof(u32)));
+		}
+		OpAddr += (u64)XPM_BATCH_OP_WORDS * sizeof(u32);
+
+		switch (Op[0]) {
+		case PM_API(PM_REQUEST_NODE):
+			Status = XPm_RequestDevice(SubsystemId, Op[1], Op[2],
+						   Op[3], Op[4], CmdType);
+			break;
+		case PM_API(PM_RELEASE_NODE):
+			Status = XPm_ReleaseDevice(SubsystemId, Op[1], CmdType);
+			break;
+		case PM_API(PM_SET_REQUIREMENT):
+			Status = XPm_SetRequirement(SubsystemId, Op[1], Op[2],
+						    Op[3], Op[4]);
+			break;
+		case PM_API(PM_CLOCK_ENABLE):
+			Status = XPm_SetClockState(SubsystemId, Op[1], 1U);
+			break;
+		case PM_API(PM_CLOCK_DISABLE):
+			Status = XPm_SetClockState(SubsystemId, Op[1], 0U);
+			break;
+		case PM_API(PM_RESET_ASSERT):
+			Status = XPm_SetResetState(SubsystemId, Op[1], Op[2],
+						   CmdType);
+			break;
+		default:
+			/* Operation changed after validation */
+			Status = XST_INVALID_PARAM;
+			break;
+		}
+		if (XST_SUCCESS != Status) {
+			PmErr("Batch operation %d (API 0x%x) failed\r\n", Idx, Op[0]);
+			goto done;
+		}
+		*ProcessedOps = Idx + 1U;
+	}
+
+done:
+	if (XST_SUCCESS != Status) {
+		PmErr("0x%x\n\r", Status);
+	}
+	return Status;
+}
+
+/****************************************************************************/
+/**
+ * @brief  Register shared memory ring used to deliver notifications of the
+ * subsystem, so that many events are drained with a single interrupt
+ *
+ * @param  SubsystemId	Subsystem to be notified
+ * @param  AddrLow	Lower 32 bit address of the ring
+ * @param  AddrHigh	Upper 32 bit address of the ring
+ * @param  NumEntries	Number of ring entries, power of two up to
+ *			XPM_NOTIFY_RING_MAX_ENTRIES. 0 unregisters the ring.
+ * @param  IpiMask	IPI mask of current subsystem
+ *
+ * @return XST_SUCCESS if successful else XST_FAILURE or an error code
+ * or a reason code
+ *
+ * @note   Ring layout is described by XPm_NotifyRingHdr
+ ****************************************************************************/
+static XStatus XPm_RegisterNotifyRing(const u32 SubsystemId, const u32 AddrLow,
+				      const u32 AddrHigh, const u32 NumEntries,
+				      const u32 IpiMask)
+{
+	XPM_EXPORT_CMD(PM_REGISTER_NOTIFY_RING, XPLMI_CMD_ARG_CNT_THREE,
+		XPLMI_CMD_ARG_CNT_THREE);
+	XStatus Status = XST_FAILURE;
+	const XPm_Subsystem* Subsystem = XPmSubsystem_GetById(SubsystemId);
+
+	if (NULL == Subsystem) {
+		Status = XPM_INVALID_SUBSYSID;
+		goto done;
+	}
+
+	Status = XPmNotifier_RegisterRing(Subsystem,
+					  ((u64)AddrHigh << 32ULL) | (u64)AddrLow,
+					  NumEntries, IpiMask);
+
+done:
+	if (XST_SUCCESS != Status) {
+		PmErr("0x%x\n\r", Status);
+	}
+	return Status;
+}
+
+/****************************************************************************/
+/**
+ * @brief  This function runs a table of PM_QUERY_DATA queries for the
+ * subsystem with a single command, so that a client can fetch data that
+ * does not change, such as the clock topology, in one transfer.
+ *
+ * @param AddrLow	Lower 32 bit address of the XPm_QueryBulkEntry table
+ * @param AddrHigh	Upper 32 bit address of the XPm_QueryBulkEntry table
+ * @param NumEntries	Number of entries in the table
+ * @param ProcessedEntries	Number of entries written back
+ *
+ * @return XST_SUCCESS if successful else XST_INVALID_PARAM
+ *
+ * @note   Each entry gets the status and data of its own query, a failed
+ * query does not stop the others.
+ *
+ ****************************************************************************/
+static XStatus XPm_QueryBulk(const u32 AddrLow, const u32 AddrHigh,
+			     const u32 NumEntries, u32 *const ProcessedEntries)
+{
+	XPM_EXPORT_CMD(PM_QUERY_BULK, XPLMI_CMD_ARG_CNT_THREE,
+		XPLMI_CMD_ARG_CNT_THREE);
+	XStatus Status = XST_FAILURE;
+	XStatus QueryStatus;
+	u64 EntryAddr = ((u64)AddrHigh << 32ULL) | (u64)AddrLow;
+	u32 Entry[4];
+	u32 Output[XPLMI_CMD_RESP_SIZE - 1U];
+	u32 Idx;
+	u32 Word;
+
+	*ProcessedEntries = 0U;
+
+	if ((0U == NumEntries) || (XPM_QUERY_BULK_MAX_ENTRIES < NumEntries)) {
+		Status = XST_INVALID_PARAM;
+		goto done;
+	}
+
+	for (Idx = 0U; Idx < NumEntries; Idx++) {
+		for (Word = 0U; Word < 4U; Word++) {
+			Entry[Word] = XPm_In64(EntryAddr +
+					       ((u64)Word * sizeof(u32)));
+			Output[Word] = 0U;
+		}
+
+		QueryStatus = XPm_Query(Entry[0], Entry[1], Entry[2], Entry[3],
+					Output);
+
+		/* Same layout as the IPI response of PM_QUERY_DATA */
+		XPm_Out64(EntryAddr + (4U * sizeof(u32)), (u32)QueryStatus);
+		for (Word = 0U; Word < 3U; Word++) {
+			XPm_Out64(EntryAddr + ((u64)(Word + 5U) * sizeof(u32)),
+				  Output[Word]);
+		}
+		EntryAddr += (u64)XPM_QUERY_BULK_ENTRY_WORDS * sizeof(u32);
+		*ProcessedEntries = Idx + 1U;
+	}
+	Status = XST_SUCCESS;
+
+done:
+	if (XST_SUCCESS != Status) {
+		PmErr("0x%x\n\r", Status);
+	}
+	return Status;
+}
+
 static int XPm_ProcessCmd(XPlmi_Cmd * Cmd)
 {
 	int Status = XST_FAILURE;
@@ -480,6 +713,17 @@ static int XPm_ProcessCmd(XPlmi_Cmd * Cmd)
 				      Pload[2], Pload[3], Pload[4],
 				      ApiResponse, Cmd->IpiReqType);
 		break;
+	case PM_API(PM_BATCH_OPS):
+		Status = XPm_BatchOps(SubsystemId, Pload[0], Pload[1], Pload[2],
+				      Cmd->IpiReqType, ApiResponse);
+		break;
+	case PM_API(PM_REGISTER_NOTIFY_RING):
+		Status = XPm_RegisterNotifyRing(SubsystemId, Pload[0], Pload[1],
+						Pload[2], Cmd->IpiMask);
+		break;
+	case PM_API(PM_QUERY_BULK):
+		Status = XPm_QueryBulk(Pload[0], Pload[1], Pload[2], ApiResponse);
+		break;
 	default:
 		Status = XPm_PlatProcessCmd(Cmd, ApiResponse);
 		break;
@@ -800,6 +1044,12 @@ XStatus XPm_Query(const u32 Qid, const u32 Arg1, const u32 Arg2,
 	case (u32)XPM_QID_CLOCK_GET_MAX_DIVISOR:
 		Status = XPmClock_GetMaxDivisor(Arg1, Arg2, Output);
 		break;
+	case (u32)XPM_QID_CLOCK_GET_RATES:
+		Status = XPmClock_QueryRates(Arg1, Output);
+		break;
+	case (u32)XPM_QID_DEVICE_GET_LATENCY_STATS:
+		Status = XPmDevice_QueryLatencyStats(Arg1, Arg2, Output);
+		break;
 	default:
 		Status = XPm_PlatQuery(Qid, Arg1, Arg2, Arg3, Output);
 		break;
@@ -2755,6 +3005,9 @@ XStatus XPm_FeatureCheck(const u32 ApiId, u32 *const Version)
 	case PM_API(PM_ADD_NODE_NAME):
 	case PM_API(PM_ADD_REQUIREMENT):
 	case PM_API(PM_INIT_NODE):
+	case PM_API(PM_BATCH_OPS):
+	case PM_API(PM_REGISTER_NOTIFY_RING):
+	case PM_API(PM_QUERY_BULK):
 		*Version = XST_API_BASE_VERSION;
 		Status = XST_SUCCESS;
 		break;
@@ -3204,6 +3457,12 @@ XStatus XPm_RequestWakeUp(u32 SubsystemId, const u32 DeviceId,
 		goto done;
 	}
 
+	/* Memories the core runs from must be ECC initialized */
+	Status = XPlmi_EccInitWaitAll();
+	if (XST_SUCCESS != Status) {
+		goto done;
+	}
+
 	switch (NODECLASS(DeviceId))
 	{
 		case (u32)XPM_NODECLASS_SUBSYSTEM:
@@ -22,6 +22,10 @@
 #define CLK_TOPOLOGY_PAYLOAD_LEN	12U
 #define CLK_CLKFLAGS_SHIFT		8U
 #define CLK_TYPEFLAGS_SHIFT		24U
+#define CLK_RATES_PAYLOAD_LEN		3U
+
+/* Maximum clock nodes between a clock and its reference clock */
+#define CLK_RATE_MAX_DEPTH		8U
 
 #define CLOCK_PARENT_INVALID		0U
 
@@ -112,6 +116,7 @@ static XStatus XPmClock_Init(XPm_ClockNode *Clk, u32 Id, u32 ControlReg,
 		OutClkPtr->ClkNode.UseCount = 0;
 		OutClkPtr->ClkNode.NumParents = NumParents;
 		OutClkPtr->ClkNode.Flags = ClkFlags;
+		OutClkPtr->RateValid = 0U;
 		if (TopologyType == TOPOLOGY_CUSTOM) {
 			OutClkPtr->Topology.Id = TOPOLOGY_CUSTOM;
 			OutClkPtr->Topology.NumNodes = NumCustomNodes;
@@ -1113,9 +1118,195 @@ XStatus XPmClock_SetRate(XPm_ClockNode *Clk, const u32 ClkRate)
 	return XST_SUCCESS;
 }
 
-XStatus XPmClock_GetRate(const XPm_ClockNode *Clk, u32 *ClkRate)
+static XStatus XPmClock_GetRateParent(const XPm_OutClockNode *Clk, u32 Ctrl,
+				      u32 *ParentIdx)
 {
-	*ClkRate = Clk->ClkRate;
+	XStatus Status = XST_FAILURE;
+	const struct XPm_ClkTopologyNode *Ptr;
+	u32 Val = Ctrl;
+	u32 Sel = 0U;
 
-	return XST_SUCCESS;
+	Ptr = XPmClock_GetTopologyNode(Clk, (u32)TYPE_MUX);
+	if (NULL != Ptr) {
+		if (TOPOLOGY_CUSTOM == Clk->Topology.Id) {
+			Val = XPm_Read32(Ptr->Reg);
+		}
+		Sel = (Val & BITNMASK(Ptr->Param1.Shift, Ptr->Param2.Width)) >>
+		      Ptr->Param1.Shift;
+	}
+
+	if (Sel >= Clk->ClkNode.NumParents) {
+		Status = XPM_INVALID_PARENT_CLKID;
+		goto done;
+	}
+
+	*ParentIdx = Clk->Topology.MuxSources[Sel];
+	Status = XST_SUCCESS;
+
+done:
+	return Status;
+}
+
+static u32 XPmClock_CalcOutRate(const XPm_OutClockNode *Clk, u32 Ctrl,
+				u32 ParentRate)
+{
+	const struct XPm_ClkTopologyNode *PtrNodes = *Clk->Topology.Nodes;
+	u64 Rate = ParentRate;
+	u32 Val, Divisor;
+	u32 i;
+
+	for (i = 0U; i < Clk->Topology.NumNodes; i++) {
+		if ((u8)TYPE_FIXEDFACTOR == PtrNodes[i].Type) {
+			if (0U != PtrNodes[i].Param2.Div) {
+				Rate = (Rate * PtrNodes[i].Param1.Mult) /
+				       PtrNodes[i].Param2.Div;
+			}
+		} else if (((u8)TYPE_DIV1 == PtrNodes[i].Type) ||
+			   ((u8)TYPE_DIV2 == PtrNodes[i].Type)) {
+			Val = (TOPOLOGY_CUSTOM == Clk->Topology.Id) ?
+			      XPm_Read32(PtrNodes[i].Reg) : Ctrl;
+			Val = (Val & BITNMASK(PtrNodes[i].Param1.Shift,
+					      PtrNodes[i].Param2.Width)) >>
+			      PtrNodes[i].Param1.Shift;
+			if (0U != (PtrNodes[i].Typeflags & CLK_DIVIDER_ONE_BASED)) {
+				Divisor = Val;
+			} else if (0U != (PtrNodes[i].Typeflags & CLK_DIVIDER_POWER_OF_TWO)) {
+				Divisor = (Val < 32U) ? ((u32)1U << Val) : 0U;
+			} else {
+				Divisor = Val + 1U;
+			}
+			/* Zero divider bypasses the divider */
+			if (0U != Divisor) {
+				Rate /= Divisor;
+			}
+		} else {
+			/* Mux and gate do not change the rate */
+		}
+	}
+
+	return (u32)Rate;
+}
+
+/*
+ * Rate of a reference clock is the one set by SetRate. Rate of a PLL or
+ * output clock is derived from its reference clock through the current mux,
+ * divider and PLL settings. Output clock rates are cached and reused as long
+ * as the control register and the parent rate are same as when the rate was
+ * computed, so a divider, mux or PLL change recomputes only the affected
+ * subtree. Control registers are compared instead of invalidating the cache
+ * from the PM APIs because CDO can program clocks with direct register writes.
+ */
+XStatus XPmClock_GetRate(XPm_ClockNode *Clk, u32 *ClkRate)
+{
+	XStatus Status = XST_FAILURE;
+	XPm_ClockNode *Chain[CLK_RATE_MAX_DEPTH];
+	u32 Ctrl[CLK_RATE_MAX_DEPTH];
+	XPm_ClockNode *Node = Clk;
+	XPm_OutClockNode *OutClk;
+	u32 Depth = 0U;
+	u32 ParentIdx = 0U;
+	u32 Rate;
+
+	/* Walk up to the reference clock through current parents */
+	while (!ISREFCLK(Node->Node.Id)) {
+		if (CLK_RATE_MAX_DEPTH == Depth) {
+			Status = XST_FAILURE;
+			goto done;
+		}
+
+		if ((NULL != Node->PwrDomain) &&
+		    ((u8)XPM_POWER_STATE_ON != Node->PwrDomain->Node.State)) {
+			Status = XST_NO_ACCESS;
+			goto done;
+		}
+
+		Ctrl[Depth] = XPm_Read32(Node->Node.BaseAddress);
+		if (ISOUTCLK(Node->Node.Id)) {
+			Status = XPmClock_GetRateParent((XPm_OutClockNode *)Node,
+							Ctrl[Depth], &ParentIdx);
+			if (XST_SUCCESS != Status) {
+				goto done;
+			}
+		} else if (ISPLL(Node->Node.Id)) {
+			ParentIdx = Node->ParentIdx;
+		} else {
+			Status = XPM_INVALID_CLKID;
+			goto done;
+		}
+
+		Chain[Depth] = Node;
+		Depth++;
+		Node = XPmClock_GetByIdx(ParentIdx);
+		if (NULL == Node) {
+			Status = XPM_INVALID_PARENT_CLKID;
+			goto done;
+		}
+	}
+
+	/* Walk back down, recomputing only the nodes which changed */
+	Rate = Node->ClkRate;
+	while (0U < Depth) {
+		Depth--;
+		Node = Chain[Depth];
+		if (ISPLL(Node->Node.Id)) {
+			Status = XPmClockPll_GetRate((XPm_PllClockNode *)Node,
+						     Rate, &Rate);
+			if (XST_SUCCESS != Status) {
+				goto done;
+			}
+		} else {
+			OutClk = (XPm_OutClockNode *)Node;
+			if ((1U == OutClk->RateValid) &&
+			    (Ctrl[Depth] == OutClk->RateCtrl) &&
+			    (Rate == OutClk->RateParent)) {
+				Rate = Node->ClkRate;
+			} else {
+				OutClk->RateCtrl = Ctrl[Depth];
+				OutClk->RateParent = Rate;
+				Rate = XPmClock_CalcOutRate(OutClk, Ctrl[Depth], Rate);
+				Node->ClkRate = Rate;
+				/* Custom topology nodes may use other registers */
+				OutClk->RateValid = (TOPOLOGY_CUSTOM != OutClk->Topology.Id) ?
+						    1U : 0U;
+			}
+		}
+	}
+
+	*ClkRate = Rate;
+	Status = XST_SUCCESS;
+
+done:
+	return Status;
+}
+
+/*
+ * Dump rates of CLK_RATES_PAYLOAD_LEN clocks starting from given index. Rate
+ * is 0 for clocks which do not exist or can not be read, e.g. when their
+ * power domain is off.
+ */
+XStatus XPmClock_QueryRates(u32 ClockIndex, u32 *Resp)
+{
+	XStatus Status = XST_FAILURE;
+	XPm_ClockNode *Clk;
+	u32 i;
+
+	if (ClockIndex >= MaxClkNodes) {
+		Status = XST_INVALID_PARAM;
+		goto done;
+	}
+
+	for (i = 0U; i < CLK_RATES_PAYLOAD_LEN; i++) {
+		Resp[i] = 0U;
+		Clk = XPmClock_GetByIdx(ClockIndex + i);
+		if (NULL != Clk) {
+			if (XST_SUCCESS != XPmClock_GetRate(Clk, &Resp[i])) {
+				Resp[i] = 0U;
+			}
+		}
+	}
+
+	Status = XST_SUCCESS;
+
+done:
+	return Status;
 }
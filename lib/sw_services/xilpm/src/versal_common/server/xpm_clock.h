@@ -91,6 +91,9 @@ struct XPm_ClockHandle {
 typedef struct XPm_OutClockNode {
 	XPm_ClockNode ClkNode;
 	XPm_ClkTopology Topology;
+	u32 RateCtrl;		/**< Control register value of cached rate */
+	u32 RateParent;		/**< Parent rate used for cached rate */
+	u8 RateValid;		/**< Cached rate in ClkNode.ClkRate is valid */
 }XPm_OutClockNode;
 
 /* Common topology definitions */
@@ -177,7 +180,8 @@ XStatus XPmClock_GetNumClocks(u32 *Resp);
 XStatus XPmClock_CheckPermissions(u32 SubsystemIdx, u32 ClockId);
 XStatus XPmClock_GetMaxDivisor(u32 ClockId, u32 DivType, u32 *Resp);
 XStatus XPmClock_SetRate(XPm_ClockNode *Clk, const u32 ClkRate);
-XStatus XPmClock_GetRate(const XPm_ClockNode *Clk, u32 *ClkRate);
+XStatus XPmClock_GetRate(XPm_ClockNode *Clk, u32 *ClkRate);
+XStatus XPmClock_QueryRates(u32 ClockIndex, u32 *Resp);
 
 #ifdef __cplusplus
 }
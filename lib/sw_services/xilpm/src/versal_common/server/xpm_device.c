@@ -115,6 +115,21 @@ static const XPm_StateTran XPmVirtDev_VirtDevTransitions[] = {
 	},
 };
 
+/* Number of device wake-up transitions whose latency is measured */
+#define XPM_LATENCY_STATS_MAX		(32U)
+
+/* Measured latency of a device transition to its highest state */
+typedef struct {
+	u32 DeviceId; /**< Device ID, 0 if the entry is free */
+	u32 FromState; /**< State from which the device was woken-up */
+	u32 Min; /**< Minimum measured latency in microseconds */
+	u32 Max; /**< Maximum measured latency in microseconds */
+	u64 Sum; /**< Sum of measured latencies in microseconds */
+	u32 Count; /**< Number of measurements */
+} XPm_LatencyStats;
+
+static XPm_LatencyStats LatencyStats[XPM_LATENCY_STATS_MAX];
+
 static XStatus SetPlDeviceNode(u32 Id, XPm_Device *Device)
 {
 	XStatus Status = XST_INVALID_PARAM;
@@ -177,17 +192,7 @@ static XStatus SetAieDeviceNode(u32 Id, XPm_Device *Device)
 
 static XPm_Requirement *FindReqm(const XPm_Device *Device, const XPm_Subsystem *Subsystem)
 {
-	XPm_Requirement *Reqm = NULL;
-
-	Reqm = Device->Requirements;
-	while (NULL != Reqm) {
-		if (Reqm->Subsystem == Subsystem) {
-			break;
-		}
-		Reqm = Reqm->NextSubsystem;
-	}
-
-	return Reqm;
+	return XPmRequirement_Find(Device, Subsystem);
 }
 
 struct XPm_Reqm *XPmDevice_FindRequirement(const u32 DeviceId, const u32 SubsystemId)
@@ -1793,6 +1798,124 @@ done:
 	return Status;
 }
 
+/****************************************************************************/
+/**
+ * @brief  Find the latency stats entry of a device wake-up transition
+ *
+ * @param  DeviceId	Device ID
+ * @param  FromState	State from which the device is woken-up
+ * @param  Alloc	Allocate a free entry if the transition is not found
+ *
+ * @return Pointer to the entry or NULL if not found and no entry is free
+ *
+ ****************************************************************************/
+static XPm_LatencyStats *GetLatencyStats(const u32 DeviceId,
+					 const u32 FromState, const u32 Alloc)
+{
+	XPm_LatencyStats *Stats = NULL;
+	u32 Idx;
+
+	for (Idx = 0U; Idx < XPM_LATENCY_STATS_MAX; Idx++) {
+		if (0U == LatencyStats[Idx].DeviceId) {
+			if (0U != Alloc) {
+				LatencyStats[Idx].DeviceId = DeviceId;
+				LatencyStats[Idx].FromState = FromState;
+				Stats = &LatencyStats[Idx];
+			}
+			/* Entries are allocated in order, no match beyond */
+			break;
+		}
+		if ((DeviceId == LatencyStats[Idx].DeviceId) &&
+		    (FromState == LatencyStats[Idx].FromState)) {
+			Stats = &LatencyStats[Idx];
+			break;
+		}
+	}
+
+	return Stats;
+}
+
+/****************************************************************************/
+/**
+ * @brief  Record the measured latency of a device wake-up transition
+ *
+ * @param  Device	Device which has been woken-up
+ * @param  FromState	State from which the device was woken-up
+ * @param  TStart	Timer value taken before the transition
+ *
+ * @note   PMC PIT counts down, so elapsed ticks are start minus end.
+ *
+ ****************************************************************************/
+static void RecordLatency(const XPm_Device *const Device, const u32 FromState,
+			  const u64 TStart)
+{
+	u64 TEnd = XPlmi_GetTimerValue();
+	u32 TicksPerUs = *XPlmi_GetPmcIroFreq() / 1000000U;
+	XPm_LatencyStats *Stats;
+	u32 Latency;
+
+	if ((0U == TicksPerUs) || (TStart < TEnd)) {
+		goto done;
+	}
+
+	Stats = GetLatencyStats(Device->Node.Id, FromState, 1U);
+	if (NULL == Stats) {
+		goto done;
+	}
+
+	Latency = (u32)((TStart - TEnd) / TicksPerUs);
+	if ((0U == Stats->Count) || (Latency < Stats->Min)) {
+		Stats->Min = Latency;
+	}
+	if (Latency > Stats->Max) {
+		Stats->Max = Latency;
+	}
+	Stats->Sum += Latency;
+	Stats->Count++;
+
+done:
+	return;
+}
+
+/****************************************************************************/
+/**
+ * @brief  Get measured wake-up latency stats of a device
+ *
+ * @param  DeviceId	Device ID
+ * @param  FromState	State from which the device is woken-up
+ * @param  Resp		Minimum, average and maximum latency in microseconds,
+ *			zeros if the transition has not been measured yet
+ *
+ * @return XST_SUCCESS if successful else XST_INVALID_PARAM
+ *
+ ****************************************************************************/
+XStatus XPmDevice_QueryLatencyStats(const u32 DeviceId, const u32 FromState,
+				    u32 *Resp)
+{
+	XStatus Status = XST_INVALID_PARAM;
+	const XPm_LatencyStats *Stats;
+
+	if (NULL == XPmDevice_GetById(DeviceId)) {
+		goto done;
+	}
+
+	Resp[0] = 0U;
+	Resp[1] = 0U;
+	Resp[2] = 0U;
+
+	Stats = GetLatencyStats(DeviceId, FromState, 0U);
+	if ((NULL != Stats) && (0U != Stats->Count)) {
+		Resp[0] = Stats->Min;
+		Resp[1] = (u32)(Stats->Sum / Stats->Count);
+		Resp[2] = Stats->Max;
+	}
+
+	Status = XST_SUCCESS;
+
+done:
+	return Status;
+}
+
 /****************************************************************************/
 /**
  * @brief	Change state of a device
@@ -1812,6 +1935,7 @@ XStatus XPmDevice_ChangeState(XPm_Device *Device, const u32 NextState)
 	const XPm_DeviceFsm* Fsm = Device->DeviceFsm;
 	u32 OldState = Device->Node.State;
 	u32 Trans;
+	u64 TStart;
 
 	if (0U == Fsm->TransCnt) {
 		/* Device's FSM has no transitions when it has only one state */
@@ -1828,7 +1952,12 @@ XStatus XPmDevice_ChangeState(XPm_Device *Device, const u32 NextState)
 
 		if (NULL != Device->DeviceFsm->EnterState) {
 			/* Execute transition action of device's FSM */
+			TStart = XPlmi_GetTimerValue();
 			Status = Device->DeviceFsm->EnterState(Device, NextState);
+			if ((XST_SUCCESS == Status) && (OldState != NextState) &&
+			    (NextState == Fsm->States[Fsm->StatesCnt - 1U].State)) {
+				RecordLatency(Device, OldState, TStart);
+			}
 		} else {
 			Status = XST_SUCCESS;
 		}
@@ -1928,6 +2057,7 @@ static u32 GetLatencyFromState(const XPm_Device *const Device, const u32 State)
 	u32 Latency = 0U;
 	u32 HighestStateIdx = Device->DeviceFsm->StatesCnt - (u32)1U;
 	u32 HighestState = Device->DeviceFsm->States[HighestStateIdx].State;
+	const XPm_LatencyStats *Stats;
 
 	for (Idx = 0U; Idx < Device->DeviceFsm->TransCnt; Idx++) {
 		if ((State == Device->DeviceFsm->Trans[Idx].FromState) &&
@@ -1937,6 +2067,12 @@ static u32 GetLatencyFromState(const XPm_Device *const Device, const u32 State)
 		}
 	}
 
+	/* Measured worst case takes precedence over the static value */
+	Stats = GetLatencyStats(Device->Node.Id, State, 0U);
+	if ((NULL != Stats) && (0U != Stats->Count)) {
+		Latency = Stats->Max;
+	}
+
 	return Latency;
 }
 
@@ -2214,7 +2350,7 @@ XStatus XPmDevice_GetWakeupLatency(const u32 DeviceId, u32 *Latency)
 
 	if (NULL != Device->Power) {
 		Status = XPmPower_GetWakeupLatency(Device->Power->Node.Id, &Lat);
-		if (XST_SUCCESS != Status) {
+		if (XST_SUCCESS == Status) {
 			*Latency += Lat;
 		}
 	}
@@ -182,6 +182,8 @@ u32 XPmDevice_GetUsageStatus(const XPm_Subsystem *Subsystem, const XPm_Device *D
 XStatus XPmDevice_IsClockActive(const XPm_Device *Device);
 XStatus XPmDevice_IsRequested(const u32 DeviceId, const u32 SubsystemId);
 XStatus XPmDevice_GetWakeupLatency(const u32 DeviceId, u32 *Latency);
+XStatus XPmDevice_QueryLatencyStats(const u32 DeviceId, const u32 FromState,
+				    u32 *Resp);
 XStatus XPmVirtDev_DeviceInit(XPm_Device *Device, u32 Id, XPm_Power *Power);
 XPm_Device *XPmDevice_GetPlDeviceByIndex(const u32 DeviceIndex);
 XPm_Device *XPmDevice_GetHbMonDeviceByIndex(const u32 DeviceIndex);
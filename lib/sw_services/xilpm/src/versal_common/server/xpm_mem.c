@@ -74,7 +74,8 @@ static void TcmEccInit(const XPm_MemDevice *Tcm, u32 Mode)
 	Base -= XPm_CombTcm(Id,Mode);
 
 	if (0U != Size) {
-		s32 Status = XPlmi_EccInit(Base, Size);
+		/* Runs in the background, users of the TCM wait for it */
+		s32 Status = XPlmi_EccInitAsync(Base, Size);
 		if (XST_SUCCESS != Status) {
 			PmWarn("Error %d in EccInit of 0x%x\r\n", Status, Tcm->Device.Node.Id);
 		}
@@ -123,6 +124,11 @@ static XStatus HandleTcmDeviceState(XPm_Device* const Device, u32 const NextStat
 		break;
 	case (u8)XPM_DEVSTATE_RUNNING:
 		if ((u32)XPM_DEVSTATE_UNUSED == NextState) {
+			/* Finish the ECC initialization before powering down */
+			if (XST_SUCCESS != XPlmi_EccInitWaitAll()) {
+				PmWarn("Error in EccInit of 0x%x\r\n", Id);
+			}
+
 			Status = Device->HandleEvent(&Device->Node,
 						     XPM_DEVEVENT_SHUTDOWN);
 			if (XST_SUCCESS != Status) {
@@ -63,9 +63,28 @@ typedef struct {
 
 static XPmNotifier PmNotifiers[XPM_NOTIFIERS_COUNT];
 
+#define XPM_NOTIFY_RINGS_COUNT	(8U)
+
+/* Offsets in the shared memory notification ring */
+#define XPM_NOTIFY_RING_HEAD_OFFSET	(0U)
+#define XPM_NOTIFY_RING_TAIL_OFFSET	(4U)
+#define XPM_NOTIFY_RING_OVF_OFFSET	(8U)
+#define XPM_NOTIFY_RING_ENTRY_OFFSET	((u32)sizeof(XPm_NotifyRingHdr))
+
+typedef struct {
+	const XPm_Subsystem* Subsystem;
+	u64 Addr;
+	u32 NumEntries;
+	u32 IpiMask;
+	u32 DoorbellPend;
+} XPmNotifyRing;
+
+static XPmNotifyRing PmNotifyRings[XPM_NOTIFY_RINGS_COUNT];
+
 static volatile u32 SchedulerTask = (u32)NOT_PRESENT;
 
 static int XPmNotifier_SchedulerTask(void *Arg);
+static XStatus XPmNotifier_StartTask(void);
 
 /****************************************************************************/
 /**
@@ -362,6 +381,93 @@ done:
 	return;
 }
 
+static XPmNotifyRing *XPmNotifier_GetRing(const XPm_Subsystem *Subsystem)
+{
+	XPmNotifyRing *Ring = NULL;
+	u32 Idx;
+
+	for (Idx = 0U; Idx < ARRAY_SIZE(PmNotifyRings); Idx++) {
+		if (Subsystem == PmNotifyRings[Idx].Subsystem) {
+			Ring = &PmNotifyRings[Idx];
+			break;
+		}
+	}
+
+	return Ring;
+}
+
+static void XPmNotifier_RingDoorbell(XPmNotifyRing *Ring)
+{
+	XStatus IpiAck;
+	u32 Payload[PAYLOAD_ARG_CNT] = {0};
+
+	IpiAck = XPm_IpiPollForAck(Ring->IpiMask, XPM_NOTIFY_TIMEOUTCOUNT);
+	if ((XST_SUCCESS == IpiAck) && (NULL != PmRequestCb)) {
+		Payload[0] = (u32)PM_NOTIFY_CB;
+		Payload[1] = XPM_NOTIFY_RING_DOORBELL;
+		(*PmRequestCb)(Ring->IpiMask, (u32)PM_NOTIFY_CB, Payload);
+		Ring->DoorbellPend = 0U;
+	} else {
+		/* Target is busy, doorbell is sent from the scheduler task */
+		Ring->DoorbellPend = 1U;
+		(void)XPmNotifier_StartTask();
+	}
+}
+
+static void XPmNotifier_SendPendingDoorbell(const XPm_Subsystem *SubSystem)
+{
+	XPmNotifyRing *Ring = XPmNotifier_GetRing(SubSystem);
+
+	if ((NULL != Ring) && (0U != Ring->DoorbellPend)) {
+		PendingEvent = (u32)PRESENT;
+		XPmNotifier_RingDoorbell(Ring);
+	}
+}
+
+/****************************************************************************/
+/**
+ * @brief  Add an event to the notification ring of a subsystem
+ *
+ * @param  Ring		Notification ring of the subsystem
+ * @param  Payload	Notify callback payload of the event
+ *
+ * @note   The doorbell is sent only if the ring was empty before the event
+ * was added. Head is written before Tail is read back, and the subsystem
+ * writes Tail before it reads back Head, so either the subsystem sees the
+ * new entry or PLM sees the ring drained and sends the doorbell.
+ *
+ ****************************************************************************/
+static void XPmNotifier_RingPush(XPmNotifyRing *Ring, const u32 *Payload)
+{
+	u64 EntryAddr;
+	u32 Head = XPm_In64(Ring->Addr + XPM_NOTIFY_RING_HEAD_OFFSET);
+	u32 Tail = XPm_In64(Ring->Addr + XPM_NOTIFY_RING_TAIL_OFFSET);
+	u32 Overflow;
+
+	if ((Head - Tail) >= Ring->NumEntries) {
+		/* Ring is full, subsystem already got the doorbell for it */
+		Overflow = XPm_In64(Ring->Addr + XPM_NOTIFY_RING_OVF_OFFSET);
+		XPm_Out64(Ring->Addr + XPM_NOTIFY_RING_OVF_OFFSET, Overflow + 1U);
+		goto done;
+	}
+
+	EntryAddr = Ring->Addr + XPM_NOTIFY_RING_ENTRY_OFFSET +
+		((u64)(Head & (Ring->NumEntries - 1U)) *
+		 sizeof(XPm_NotifyRingEntry));
+	XPm_Out64(EntryAddr, Payload[1]);
+	XPm_Out64(EntryAddr + 4U, Payload[2]);
+	XPm_Out64(EntryAddr + 8U, Payload[3]);
+	XPm_Out64(Ring->Addr + XPM_NOTIFY_RING_HEAD_OFFSET, Head + 1U);
+
+	Tail = XPm_In64(Ring->Addr + XPM_NOTIFY_RING_TAIL_OFFSET);
+	if (Tail == Head) {
+		XPmNotifier_RingDoorbell(Ring);
+	}
+
+done:
+	return;
+}
+
 static int XPmNotifier_SchedulerTask(void *Arg)
 {
 	(void)Arg;
@@ -398,6 +504,9 @@ static int XPmNotifier_SchedulerTask(void *Arg)
 			/* Send pending suspend callback */
 			XPmNotifier_SendPendingSuspendCb(SubSystem);
 		}
+
+		/* Send pending notification ring doorbell */
+		XPmNotifier_SendPendingDoorbell(SubSystem);
 	}
 
 	/*
@@ -420,6 +529,26 @@ done:
 	return Status;
 }
 
+static XStatus XPmNotifier_StartTask(void)
+{
+	XStatus Status = XST_SUCCESS;
+
+	if ((u32)NOT_PRESENT == SchedulerTask) {
+		Status = XPlmi_SchedulerAddTask(XPLMI_MODULE_XILPM_ID,
+						XPmNotifier_SchedulerTask, NULL,
+						XILPM_NOTIFIER_INTERVAL,
+						XPLM_TASK_PRIORITY_0,
+						NULL, XPLMI_PERIODIC_TASK);
+		if (Status != XST_SUCCESS) {
+			PmErr("[%s] Failed to create task\r\n",__func__);
+			goto done;
+		}
+		SchedulerTask = (u32)PRESENT;
+	}
+done:
+	return Status;
+}
+
 static XStatus XPmNotifier_AddSuspEvent(const u32 IpiMask, const u32 *Payload)
 {
 	XStatus Status = XST_FAILURE;
@@ -494,18 +623,7 @@ static XStatus XPmNotifier_AddPendingEvent(const u32 IpiMask, const u32 *Payload
 	if (XST_SUCCESS != Status) {
 		goto done;
 	}
-	if ((u32)NOT_PRESENT == SchedulerTask) {
-		Status = XPlmi_SchedulerAddTask(XPLMI_MODULE_XILPM_ID,
-						XPmNotifier_SchedulerTask, NULL,
-						XILPM_NOTIFIER_INTERVAL,
-						XPLM_TASK_PRIORITY_0,
-						NULL, XPLMI_PERIODIC_TASK);
-		if (Status != XST_SUCCESS) {
-			PmErr("[%s] Failed to create task\r\n",__func__);
-			goto done;
-		}
-		SchedulerTask = (u32)PRESENT;
-	}
+	Status = XPmNotifier_StartTask();
 done:
 	return Status;
 }
@@ -626,6 +744,66 @@ XStatus XPmNotifier_UnregisterAll(const XPm_Subsystem* const Subsystem)
 			}
 		}
 	}
+
+	Status = XPmNotifier_RegisterRing(Subsystem, 0U, 0U, 0U);
+
+done:
+	return Status;
+}
+
+/****************************************************************************/
+/**
+ * @brief  Register shared memory ring for delivering notifications of the
+ *         subsystem
+ *
+ * @param  Subsystem	Subsystem to be notified
+ * @param  Addr		Address of the ring, XPm_NotifyRingHdr followed by
+ *			the entries
+ * @param  NumEntries	Number of ring entries, power of two. 0 unregisters
+ *			the ring and notifications are sent one per IPI again.
+ * @param  IpiMask	IPI mask of the subsystem
+ *
+ * @return XST_SUCCESS if successful else XST_INVALID_PARAM or XST_FAILURE
+ *
+ ****************************************************************************/
+XStatus XPmNotifier_RegisterRing(const XPm_Subsystem* const Subsystem,
+				 const u64 Addr, const u32 NumEntries,
+				 const u32 IpiMask)
+{
+	XStatus Status = XST_FAILURE;
+	XPmNotifyRing *Ring = XPmNotifier_GetRing(Subsystem);
+
+	if (0U == NumEntries) {
+		if (NULL != Ring) {
+			Ring->Subsystem = NULL;
+			Ring->DoorbellPend = 0U;
+		}
+		Status = XST_SUCCESS;
+		goto done;
+	}
+
+	if ((0U == Addr) || (XPM_NOTIFY_RING_MAX_ENTRIES < NumEntries) ||
+	    (0U != (NumEntries & (NumEntries - 1U))) || (0U != (Addr & 3U))) {
+		Status = XST_INVALID_PARAM;
+		goto done;
+	}
+
+	if (NULL == Ring) {
+		Ring = XPmNotifier_GetRing(NULL);
+		if (NULL == Ring) {
+			goto done;
+		}
+	}
+
+	XPm_Out64(Addr + XPM_NOTIFY_RING_HEAD_OFFSET, 0U);
+	XPm_Out64(Addr + XPM_NOTIFY_RING_TAIL_OFFSET, 0U);
+	XPm_Out64(Addr + XPM_NOTIFY_RING_OVF_OFFSET, 0U);
+
+	Ring->Addr = Addr;
+	Ring->NumEntries = NumEntries;
+	Ring->IpiMask = IpiMask;
+	Ring->DoorbellPend = 0U;
+	Ring->Subsystem = Subsystem;
 	Status = XST_SUCCESS;
 
 done:
@@ -650,6 +828,7 @@ void XPmNotifier_Event(const u32 NodeId, const u32 Event)
 	u32 Payload[PAYLOAD_ARG_CNT] = {0};
 	const XPm_Device* Device;
 	const XPm_Power *Power;
+	XPmNotifyRing *Ring;
 	XStatus Status = XST_FAILURE;
 
 	for (Idx = 0U; Idx < ARRAY_SIZE(PmNotifiers); Idx++) {
@@ -706,7 +885,13 @@ void XPmNotifier_Event(const u32 NodeId, const u32 Event)
 		 */
 		if (((u8)OFFLINE != Notifier->Subsystem->State) ||
 		    (0U != (Event & Notifier->WakeMask))) {
-			XPmNotifier_NotifyTarget(Notifier->IpiMask, Payload);
+			Ring = XPmNotifier_GetRing(Notifier->Subsystem);
+			if (NULL != Ring) {
+				XPmNotifier_RingPush(Ring, Payload);
+			} else {
+				XPmNotifier_NotifyTarget(Notifier->IpiMask,
+							 Payload);
+			}
 		}
 	}
 
@@ -30,6 +30,10 @@ void XPmNotifier_Event(const u32 NodeId, const u32 Event);
 
 void XPmNotifier_NotifyTarget(u32 IpiMask, u32 *Payload);
 
+XStatus XPmNotifier_RegisterRing(const XPm_Subsystem* const Subsystem,
+				 const u64 Addr, const u32 NumEntries,
+				 const u32 IpiMask);
+
 #ifdef __cplusplus
 }
 #endif
@@ -461,6 +461,53 @@ done:
 	return Status;
 }
 
+/*
+ * Output rate is ParentRate * (FBDIV + DATA / 2^16) / 2^DIV2, where the
+ * fractional part is used only in fractional mode. Rate is 0 when the PLL
+ * is held in reset.
+ */
+XStatus XPmClockPll_GetRate(XPm_PllClockNode *Pll, u32 ParentRate, u32 *Rate)
+{
+	XStatus Status = XST_FAILURE;
+	u32 Mode, FbDiv, Div2;
+	u32 Data = 0U;
+	u64 PllRate;
+
+	Status = XPmClockPll_GetMode(Pll, &Mode);
+	if (XST_SUCCESS != Status) {
+		goto done;
+	}
+
+	if ((u32)PM_PLL_MODE_RESET == Mode) {
+		*Rate = 0U;
+		goto done;
+	}
+
+	Status = XPmClockPll_GetParam(Pll, (u32)PM_PLL_PARAM_ID_FBDIV, &FbDiv);
+	if (XST_SUCCESS != Status) {
+		goto done;
+	}
+
+	Status = XPmClockPll_GetParam(Pll, (u32)PM_PLL_PARAM_ID_DIV2, &Div2);
+	if (XST_SUCCESS != Status) {
+		goto done;
+	}
+
+	if ((u32)PM_PLL_MODE_FRACTIONAL == Mode) {
+		Status = XPmClockPll_GetParam(Pll, (u32)PM_PLL_PARAM_ID_DATA, &Data);
+		if (XST_SUCCESS != Status) {
+			goto done;
+		}
+	}
+
+	PllRate = ((u64)ParentRate * FbDiv) +
+		  (((u64)ParentRate * Data) >> PLL_FRAC_DATA_SHIFT);
+	*Rate = (u32)(PllRate >> Div2);
+
+done:
+	return Status;
+}
+
 XStatus XPmClockPll_QueryMuxSources(u32 Id, u32 Index, u32 *Resp)
 {
 	XStatus Status = XST_FAILURE;
@@ -137,6 +137,7 @@ struct XPm_PllClockNode {
 #define PM_PLL_STATE_SUSPENDED	2U
 
 #define PLL_FRAC_CFG_ENABLED_MASK	(0x80000000U)
+#define PLL_FRAC_DATA_SHIFT		(16U)
 
 /************************** Function Prototypes ******************************/
 XStatus XPmClockPll_AddNode(u32 Id, u32 ControlReg, u8 TopologyType,
@@ -151,6 +152,7 @@ XStatus XPmClockPll_Resume(XPm_PllClockNode *Pll);
 XStatus XPmClockPll_Reset(XPm_PllClockNode *Pll, uint8_t Flags);
 XStatus XPmClockPll_SetParam(const XPm_PllClockNode *Pll, u32 Param,u32 Value);
 XStatus XPmClockPll_GetParam(const XPm_PllClockNode *Pll, u32 Param,u32 *Val);
+XStatus XPmClockPll_GetRate(XPm_PllClockNode *Pll, u32 ParentRate, u32 *Rate);
 XStatus XPmClockPll_QueryMuxSources(u32 Id, u32 Index, u32 *Resp);
 XStatus XPmClockPll_GetWakeupLatency(const u32 Id, u32 *Latency);
 
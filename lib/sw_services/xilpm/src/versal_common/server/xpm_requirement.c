@@ -9,6 +9,26 @@
 #include "xpm_power.h"
 #include "xpm_api.h"
 
+/* Number of entries in requirement lookup cache, must be power of 2 */
+#define REQM_CACHE_SIZE			(64U)
+#define REQM_CACHE_IDX_SHIFT		(26U)
+#define REQM_CACHE_HASH_MULTIPLIER	(0x9E3779B1U)
+
+/*
+ * Direct mapped cache of requirements looked up by device and subsystem.
+ * Requirements are never removed from device and subsystem lists, so an
+ * entry stays valid once its device and subsystem are verified.
+ */
+static XPm_Requirement *PmReqmCache[REQM_CACHE_SIZE];
+
+static u32 XPmRequirement_CacheIdx(const XPm_Device *Device,
+				   const XPm_Subsystem *Subsystem)
+{
+	u32 Key = Device->Node.Id ^ Subsystem->Id;
+
+	return (Key * REQM_CACHE_HASH_MULTIPLIER) >> REQM_CACHE_IDX_SHIFT;
+}
+
 static void XPmRequirement_Init(XPm_Requirement *Reqm, XPm_Subsystem *Subsystem,
 				XPm_Device *Device, u32 Flags,
 				u32 PreallocCaps, u32 PreallocQoS)
@@ -23,6 +43,9 @@ static void XPmRequirement_Init(XPm_Requirement *Reqm, XPm_Subsystem *Subsystem,
 	Device->Requirements = Reqm;
 	Reqm->Device = Device;
 
+	/* New requirement is now the first match in device's list */
+	PmReqmCache[XPmRequirement_CacheIdx(Device, Subsystem)] = Reqm;
+
 	Reqm->Allocated = 0;
 	Reqm->SetLatReq = 0;
 	Reqm->Flags = (u16)(Flags & REG_FLAGS_MASK);
@@ -56,6 +79,30 @@ done:
 	return Status;
 }
 
+XPm_Requirement *XPmRequirement_Find(const XPm_Device *Device,
+				     const XPm_Subsystem *Subsystem)
+{
+	u32 Idx = XPmRequirement_CacheIdx(Device, Subsystem);
+	XPm_Requirement *Reqm = PmReqmCache[Idx];
+
+	if ((NULL != Reqm) && (Reqm->Device == Device) &&
+	    (Reqm->Subsystem == Subsystem)) {
+		goto done;
+	}
+
+	Reqm = Device->Requirements;
+	while (NULL != Reqm) {
+		if (Reqm->Subsystem == Subsystem) {
+			PmReqmCache[Idx] = Reqm;
+			break;
+		}
+		Reqm = Reqm->NextSubsystem;
+	}
+
+done:
+	return Reqm;
+}
+
 void XPm_RequiremntUpdate(XPm_Requirement *Reqm)
 {
 	if(NULL != Reqm)
@@ -180,6 +180,9 @@ enum pm_query_id {
 	XPM_QID_CLOCK_GET_NUM_CLOCKS,			/**< Get number of clocks */
 	XPM_QID_CLOCK_GET_MAX_DIVISOR,			/**< Get max clock divisor */
 	XPM_QID_PLD_GET_PARENT,				/**< Get PLD parent */
+	XPM_QID_CLOCK_GET_RATES,			/**< Get rates of clocks */
+	XPM_QID_DEVICE_GET_LATENCY_STATS,		/**< Get measured device
+							  wake-up latencies */
 };
 
 /**
@@ -680,9 +683,79 @@ typedef enum {
 	PM_ACTIVATE_SUBSYSTEM,				/**< 0x41 */
 	PM_BISR = 0x43,					/**< 0x43 */
 	PM_APPLY_TRIM,					/**< 0x44 */
-	PM_API_MAX					/**< 0x45 */
+	PM_BATCH_OPS = 0x47,				/**< 0x47 */
+	PM_REGISTER_NOTIFY_RING,			/**< 0x48 */
+	PM_QUERY_BULK,					/**< 0x49 */
+	PM_API_MAX					/**< 0x4A */
 } XPm_ApiId;
 
+/**
+ * @name Batch operations
+ * @{
+ */
+/**
+ * Operation of PM_BATCH_OPS command. ApiId is one of PM_REQUEST_NODE,
+ * PM_RELEASE_NODE, PM_SET_REQUIREMENT, PM_CLOCK_ENABLE, PM_CLOCK_DISABLE or
+ * PM_RESET_ASSERT and Args are the arguments of that API.
+ */
+typedef struct {
+	u32 ApiId;	/**< PM API ID of the operation */
+	u32 Args[4];	/**< Arguments of the PM API */
+} XPm_BatchOp;
+
+#define XPM_BATCH_OP_WORDS	(5U)	/**< Words in one batch operation */
+#define XPM_BATCH_MAX_OPS	(64U)	/**< Maximum operations in a batch */
+/** @} */
+
+/**
+ * @name Notification ring
+ * @{
+ */
+/**
+ * Shared memory ring registered with PM_REGISTER_NOTIFY_RING. The header is
+ * followed by a power of two number of XPm_NotifyRingEntry entries. PLM
+ * writes entries and Head, the subsystem consumes entries and writes Tail.
+ * Head and Tail are free running counters, entry index is counter modulo
+ * number of entries. PLM sends a PM_NOTIFY_CB with XPM_NOTIFY_RING_DOORBELL
+ * as node only when an entry is added to an empty ring, so the subsystem
+ * must drain the ring until Head equals Tail on every doorbell.
+ */
+typedef struct {
+	u32 Head;	/**< Number of entries added by PLM */
+	u32 Tail;	/**< Number of entries consumed by the subsystem */
+	u32 Overflow;	/**< Number of events dropped because ring was full */
+	u32 Reserved;	/**< Reserved */
+} XPm_NotifyRingHdr;
+
+typedef struct {
+	u32 NodeId;	/**< Node the event is related to */
+	u32 Event;	/**< Event ID */
+	u32 State;	/**< Node state when the event occurred */
+} XPm_NotifyRingEntry;
+
+#define XPM_NOTIFY_RING_DOORBELL	(0U)	/**< Node ID of ring doorbell */
+#define XPM_NOTIFY_RING_MAX_ENTRIES	(256U)	/**< Maximum ring entries */
+/** @} */
+
+/**
+ * @name Bulk query
+ * @{
+ */
+/**
+ * Entry of PM_QUERY_BULK command. The subsystem writes QueryId and Args, PLM
+ * runs the PM_QUERY_DATA query and writes Response in the layout of the IPI
+ * response: status followed by three words of data.
+ */
+typedef struct {
+	u32 QueryId;		/**< Query ID */
+	u32 Args[3];		/**< Query arguments */
+	u32 Response[4];	/**< Status and data written by PLM */
+} XPm_QueryBulkEntry;
+
+#define XPM_QUERY_BULK_ENTRY_WORDS	(8U)	/**< Words in one bulk entry */
+#define XPM_QUERY_BULK_MAX_ENTRIES	(64U)	/**< Maximum bulk entries */
+/** @} */
+
 #define CRP_RESET_REASON_ERR_POR_MASK				(0x00000008U)
 #define CRP_RESET_REASON_SLR_POR_MASK				(0x00000004U)
 #define CRP_RESET_REASON_SW_POR_MASK				(0x00000002U)
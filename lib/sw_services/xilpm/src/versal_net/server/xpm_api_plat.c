@@ -87,7 +87,9 @@
 	(1ULL << (u64)XPM_QID_CLOCK_GET_MUXSOURCES) | \
 	(1ULL << (u64)XPM_QID_CLOCK_GET_ATTRIBUTES) | \
 	(1ULL << (u64)XPM_QID_CLOCK_GET_NUM_CLOCKS) | \
-	(1ULL << (u64)XPM_QID_CLOCK_GET_MAX_DIVISOR))
+	(1ULL << (u64)XPM_QID_CLOCK_GET_MAX_DIVISOR) | \
+	(1ULL << (u64)XPM_QID_CLOCK_GET_RATES) | \
+	(1ULL << (u64)XPM_QID_DEVICE_GET_LATENCY_STATS))
 
 XStatus XPm_PlatAddDevRequirement(XPm_Subsystem *Subsystem, u32 DeviceId,
 				     u32 ReqFlags, const u32 *Args, u32 NumArgs)
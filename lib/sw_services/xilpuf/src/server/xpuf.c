@@ -51,6 +51,9 @@
 *                       Removed support for 12K mode
 *            08/02/2022 Modified if check for XPuf_ChangeIroFreq to avoid returning XST_SUCCESS
 *                       incase of glitch attack
+*       ag   10/15/2026 Split XPuf_Regeneration into start and complete APIs
+*                       and skipped regeneration when the PUF key from the
+*                       same helper data is still loaded
 *
 * </pre>
 *
@@ -192,9 +195,38 @@ static inline void XPuf_WriteIroFreq(u32 IroFreq)
 static void XPuf_CapturePufID(XPuf_Data *PufData);
 static int XPuf_ValidateAccessRules(const XPuf_Data *PufData);
 static int XPuf_UpdateHelperData(const XPuf_Data *PufData);
-static int XPuf_StartRegeneration(XPuf_Data *PufData);
+static int XPuf_StartRegeneration(const XPuf_Data *PufData);
+static int XPuf_CheckRegenerationStatus(XPuf_Data *PufData);
+static int XPuf_RegenerationRestore(void);
+static u32 XPuf_IsRegenCacheHit(const XPuf_Data *PufData);
+static void XPuf_UpdateRegenCache(const XPuf_Data *PufData);
 static int XPuf_ChangeIroFreq(u32 IroFreq, u8 *IroFreqUpdated);
 
+/**************************** Type Definitions *******************************/
+/** State of the PUF regeneration between start and complete */
+typedef struct {
+	u8 IsBusy;		/**< Regeneration is started and not completed */
+	u8 IsCached;		/**< Regeneration is served from the cache */
+	u8 IroFreqUpdated;	/**< IRO frequency is changed for regeneration */
+	u8 SlvErrReset;		/**< SLVERR is disabled for regeneration */
+} XPuf_RegenCtx;
+
+/** Helper data of the last successful on demand regeneration */
+typedef struct {
+	u32 IsValid;			/**< Cache is valid */
+	XPuf_ReadOption ReadOption;	/**< Helper data source */
+	u32 SyndromeAddr;		/**< Address of syndrome data */
+	u32 Chash;			/**< Chash used for regeneration */
+	u32 Aux;			/**< Auxiliary data used for regeneration */
+	u32 ShutterValue;		/**< Shutter value used for regeneration */
+	u8 GlobalVarFilter;		/**< Global variation filter option */
+	u32 PufID[XPUF_ID_LEN_IN_WORDS];/**< PUF ID of the regenerated key */
+} XPuf_RegenCache;
+
+/************************** Variable Definitions *****************************/
+static XPuf_RegenCtx RegenCtx = {0U};
+static XPuf_RegenCache RegenCache = {0U};
+
 /************************** Function Definitions *****************************/
 
 /*****************************************************************************/
@@ -256,6 +288,9 @@ int XPuf_Registration(XPuf_Data *PufData)
 		goto END;
 	}
 
+	/* Registration replaces the PUF key loaded by earlier regeneration */
+	XPuf_RegenerationCacheInvalidate();
+
 	XPuf_CfgGlobalVariationFilter(PufData->GlobalVarFilter);
 
 	XPuf_WriteReg(XPUF_PMC_GLOBAL_BASEADDR, XPUF_PMC_GLOBAL_PUF_CFG1_OFFSET,
@@ -345,36 +380,91 @@ END:
  *	-	XPUF_ERROR_PUF_DONE_ID_NT_RDY - Id ready bit is not set
  *	-	XPUF_IRO_FREQ_WRITE_MISMATCH - Mismatch in writing or reading
  *			IRO frequency at the time of PUF regeneration
+ *	-	XPUF_ERROR_REGEN_IN_PROGRESS - Regeneration is already started
  *	-	XST_FAILURE - Unexpected event
  *
  * @note	PUF is only supported when using a nominal VCC_PMC of 0.70V or
  *		IRO frequency of 320 MHz
+ *		On demand regeneration is skipped if the PUF key regenerated
+ *		from the same helper data is still loaded
  *
  *****************************************************************************/
 int XPuf_Regeneration(XPuf_Data *PufData)
+{
+	volatile int Status = XST_FAILURE;
+
+	Status = XPuf_RegenerationStart(PufData);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	Status = XST_FAILURE;
+	Status = XPuf_RegenerationComplete(PufData);
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function validates the inputs, configures the PUF and
+ *		triggers the regeneration without waiting for the PUF to
+ *		complete. Other work can be done till the regeneration is
+ *		completed with XPuf_RegenerationComplete.
+ *
+ * @param	PufData - Pointer to XPuf_Data structure which includes options
+ *                        to configure PUF
+ *
+ * @return
+ *	-	XST_SUCCESS - PUF regeneration is triggered
+ *	-	XPUF_ERROR_INVALID_PARAM - PufData is NULL
+ *	-	XPUF_ERROR_REGEN_IN_PROGRESS - Regeneration is already started
+ *	-	XPUF_ERROR_INVALID_REGENERATION_TYPE - Selection of invalid
+ *			regeneration type
+ *	-	XPUF_ERROR_CHASH_NOT_PROGRAMMED - Helper data not provided
+ *	-	XPUF_IRO_FREQ_WRITE_MISMATCH - Mismatch in writing or reading
+ *			IRO frequency at the time of PUF regeneration
+ *	-	XST_FAILURE - Unexpected event
+ *
+ * @note	PMC IRO frequency stays at 320 MHz till
+ *		XPuf_RegenerationComplete is called.
+ *
+ *****************************************************************************/
+int XPuf_RegenerationStart(XPuf_Data *PufData)
 {
 	volatile int Status = XST_FAILURE;
 	volatile int StatusTmp = XST_FAILURE;
 	u32 GlobalCntrlVal;
-	u32 Reset = FALSE;
-	u8 IroFreqUpdated = FALSE;
 
 	if (PufData == NULL) {
 		Status = XPUF_ERROR_INVALID_PARAM;
-		goto END;
+		goto RET;
 	}
 
 	if ((PufData->PufOperation != XPUF_REGEN_ON_DEMAND) &&
 		(PufData->PufOperation != XPUF_REGEN_ID_ONLY)) {
 		Status = XPUF_ERROR_INVALID_PARAM;
-		goto END;
+		goto RET;
+	}
+
+	if (RegenCtx.IsBusy == (u8)TRUE) {
+		Status = XPUF_ERROR_REGEN_IN_PROGRESS;
+		goto RET;
 	}
 
 	Status = XPuf_CheckGlobalVariationFilter(PufData);
 	if (Status != XST_SUCCESS) {
-		goto END;
+		goto RET;
 	}
 
+	if (XPuf_IsRegenCacheHit(PufData) == (u32)TRUE) {
+		RegenCtx.IsBusy = (u8)TRUE;
+		RegenCtx.IsCached = (u8)TRUE;
+		Status = XST_SUCCESS;
+		goto RET;
+	}
+	XPuf_RegenerationCacheInvalidate();
+
 	/**
 	 * When registering the PUF, the PMC internal ring oscillator (IRO) frequency must be set
 	 * to 320 MHz. When the Versal ACAP boots, it always uses the default frequency of
@@ -382,7 +472,7 @@ int XPuf_Regeneration(XPuf_Data *PufData)
 	 * does not match the IRO frequency during registration, there is a potential of reduced
 	 * stability which can impact the PUFs ability to regenerate properly.
 	 */
-	Status = XPuf_ChangeIroFreq(XPUF_IRO_FREQ_320MHZ, &IroFreqUpdated);
+	Status = XPuf_ChangeIroFreq(XPUF_IRO_FREQ_320MHZ, &RegenCtx.IroFreqUpdated);
 	if (Status != XST_SUCCESS) {
 		goto END;
 	}
@@ -414,7 +504,7 @@ int XPuf_Regeneration(XPuf_Data *PufData)
 		XPuf_WriteReg(XPUF_PMC_GLOBAL_BASEADDR,
 			XPUF_PMC_GLOBAL_GLOBAL_CNTRL_OFFSET,
 			GlobalCntrlVal & ~(XPUF_SLVERR_ENABLE_MASK));
-		Reset = TRUE;
+		RegenCtx.SlvErrReset = (u8)TRUE;
 	}
 
 	XPuf_SetRoSwap(PufData);
@@ -423,24 +513,96 @@ int XPuf_Regeneration(XPuf_Data *PufData)
 
 	Status = XPuf_StartRegeneration(PufData);
 
-	if (Reset == TRUE) {
-		GlobalCntrlVal = XPuf_ReadReg(XPUF_PMC_GLOBAL_BASEADDR,
-			XPUF_PMC_GLOBAL_GLOBAL_CNTRL_OFFSET);
-		XPuf_WriteReg(XPUF_PMC_GLOBAL_BASEADDR,
-			XPUF_PMC_GLOBAL_GLOBAL_CNTRL_OFFSET,
-			GlobalCntrlVal | XPUF_SLVERR_ENABLE_MASK);
-	}
 END:
-	if (IroFreqUpdated == TRUE) {
-		StatusTmp = XPuf_ChangeIroFreq(XPUF_IRO_FREQ_400MHZ, &IroFreqUpdated);
-		if ((Status == XST_SUCCESS) && (Status == XST_SUCCESS)) {
-			Status = StatusTmp;
+	if (Status == XST_SUCCESS) {
+		RegenCtx.IsBusy = (u8)TRUE;
+	}
+	else {
+		StatusTmp = XPuf_RegenerationRestore();
+		if (StatusTmp != XST_SUCCESS) {
+			XPuf_Printf(XPUF_DEBUG_GENERAL,
+				"Error: Restoring IRO frequency failed!! \r\n");
 		}
 	}
+RET:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function waits for the PUF regeneration triggered by
+ *		XPuf_RegenerationStart to complete and captures the PUF ID.
+ *
+ * @param	PufData - Pointer to the same XPuf_Data structure passed to
+ *                        XPuf_RegenerationStart
+ *
+ * @return
+ *	-	XST_SUCCESS - PUF Regeneration successful
+ *	-	XPUF_ERROR_INVALID_PARAM - PufData is NULL
+ *	-	XPUF_ERROR_REGEN_NOT_STARTED - Regeneration is not started
+ *	-	XPUF_ERROR_PUF_STATUS_DONE_TIMEOUT - Timeout occurred while
+ *			waiting for PUF done bit
+ *	-	XPUF_ERROR_PUF_DONE_KEY_NT_RDY - Key ready bit is not set
+ *	-	XPUF_ERROR_PUF_DONE_ID_NT_RDY - Id ready bit is not set
+ *	-	XPUF_IRO_FREQ_WRITE_MISMATCH - Mismatch in writing or reading
+ *			IRO frequency
+ *	-	XST_FAILURE - Unexpected event
+ *
+ *****************************************************************************/
+int XPuf_RegenerationComplete(XPuf_Data *PufData)
+{
+	volatile int Status = XST_FAILURE;
+	volatile int StatusTmp = XST_FAILURE;
+
+	if (PufData == NULL) {
+		Status = XPUF_ERROR_INVALID_PARAM;
+		goto RET;
+	}
 
+	if (RegenCtx.IsBusy != (u8)TRUE) {
+		Status = XPUF_ERROR_REGEN_NOT_STARTED;
+		goto RET;
+	}
+
+	if (RegenCtx.IsCached == (u8)TRUE) {
+		Status = Xil_SMemCpy(PufData->PufID, XPUF_ID_LEN_IN_BYTES,
+			RegenCache.PufID, XPUF_ID_LEN_IN_BYTES, XPUF_ID_LEN_IN_BYTES);
+		goto END;
+	}
+
+	Status = XPuf_CheckRegenerationStatus(PufData);
+
+	StatusTmp = XPuf_RegenerationRestore();
+	if ((Status == XST_SUCCESS) && (StatusTmp != XST_SUCCESS)) {
+		Status = StatusTmp;
+	}
+
+	if ((Status == XST_SUCCESS) &&
+		(PufData->PufOperation == XPUF_REGEN_ON_DEMAND)) {
+		XPuf_UpdateRegenCache(PufData);
+	}
+
+END:
+	RegenCtx.IsBusy = (u8)FALSE;
+	RegenCtx.IsCached = (u8)FALSE;
+RET:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function invalidates the regeneration cache, so that next
+ *		on demand regeneration is done on the PUF. It must be called
+ *		if the PUF key is zeroized outside of XilPuf.
+ *
+ *****************************************************************************/
+void XPuf_RegenerationCacheInvalidate(void)
+{
+	RegenCache.IsValid = (u32)FALSE;
+	(void)Xil_SMemSet(RegenCache.PufID, XPUF_ID_LEN_IN_BYTES, 0U,
+		XPUF_ID_LEN_IN_BYTES);
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function clears PUF ID
@@ -457,6 +619,8 @@ int XPuf_ClearPufID(void)
 	int Status = XST_FAILURE;
 	int WaitStatus = XST_FAILURE;
 
+	XPuf_RegenerationCacheInvalidate();
+
 	XPuf_WriteReg(XPUF_PMC_GLOBAL_BASEADDR, XPUF_PMC_GLOBAL_PUF_CLEAR_OFFSET,
 		XPUF_CLEAR_ID);
 
@@ -617,20 +781,14 @@ END:
  *                        to configure PUF
  *
  * @return
- *	-	XST_SUCCESS - On Successful Regeneration
+ *	-	XST_SUCCESS - Regeneration is triggered
  *	-	XPUF_ERROR_INVALID_REGENERATION_TYPE - On Selection of invalid
  *			regeneration type
- *	-	XPUF_ERROR_PUF_STATUS_DONE_TIMEOUT - Timeout occurred while
- *			waiting for PUF done bit
- *	-	XPUF_ERROR_PUF_DONE_KEY_ID_NT_RDY - Key ready bit and ID ready
- *			bit is not set
- *	-	XPUF_ERROR_PUF_DONE_ID_NT_RDY - Id ready bit is not set
  *
  *****************************************************************************/
-static int XPuf_StartRegeneration(XPuf_Data *PufData)
+static int XPuf_StartRegeneration(const XPuf_Data *PufData)
 {
 	volatile int Status = XST_FAILURE;
-	u32 PufStatus;
 
 	if(XPUF_REGEN_ID_ONLY == PufData->PufOperation) {
 		XPuf_WriteReg(XPUF_PMC_GLOBAL_BASEADDR, XPUF_PMC_GLOBAL_PUF_CMD_OFFSET,
@@ -645,6 +803,33 @@ static int XPuf_StartRegeneration(XPuf_Data *PufData)
 		goto END;
 	}
 
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief       This function waits for the PUF regeneration to complete and
+ *              captures the PUF ID
+ *
+ * @param       PufData - Pointer to XPuf_Data structure which includes options
+ *                        to configure PUF
+ *
+ * @return
+ *	-	XST_SUCCESS - On Successful Regeneration
+ *	-	XPUF_ERROR_PUF_STATUS_DONE_TIMEOUT - Timeout occurred while
+ *			waiting for PUF done bit
+ *	-	XPUF_ERROR_PUF_DONE_KEY_NT_RDY - Key ready bit is not set
+ *	-	XPUF_ERROR_PUF_DONE_ID_NT_RDY - Id ready bit is not set
+ *
+ *****************************************************************************/
+static int XPuf_CheckRegenerationStatus(XPuf_Data *PufData)
+{
+	volatile int Status = XST_FAILURE;
+	u32 PufStatus;
+
 	Status  = XPuf_WaitForPufDoneStatus();
 	if (Status != XST_SUCCESS) {
 		XPuf_Printf(XPUF_DEBUG_GENERAL,
@@ -937,3 +1122,120 @@ static int XPuf_ChangeIroFreq(u32 IroFreq, u8 *IroFreqUpdated)
 END:
 	return Status;
 }
+
+/*****************************************************************************/
+/**
+ * @brief	This function enables SLVERR and restores the IRO frequency
+ *		changed by XPuf_RegenerationStart.
+ *
+ * @return
+ *	-	XST_SUCCESS - Restored successfully
+ *	-	XPUF_IRO_FREQ_WRITE_MISMATCH - Mismatch in writing or reading
+ *			IRO frequency
+ *
+ *****************************************************************************/
+static int XPuf_RegenerationRestore(void)
+{
+	volatile int Status = XST_FAILURE;
+	u32 GlobalCntrlVal;
+
+	if (RegenCtx.SlvErrReset == (u8)TRUE) {
+		GlobalCntrlVal = XPuf_ReadReg(XPUF_PMC_GLOBAL_BASEADDR,
+			XPUF_PMC_GLOBAL_GLOBAL_CNTRL_OFFSET);
+		XPuf_WriteReg(XPUF_PMC_GLOBAL_BASEADDR,
+			XPUF_PMC_GLOBAL_GLOBAL_CNTRL_OFFSET,
+			GlobalCntrlVal | XPUF_SLVERR_ENABLE_MASK);
+		RegenCtx.SlvErrReset = (u8)FALSE;
+	}
+
+	Status = XST_SUCCESS;
+	if (RegenCtx.IroFreqUpdated == (u8)TRUE) {
+		Status = XST_FAILURE;
+		Status = XPuf_ChangeIroFreq(XPUF_IRO_FREQ_400MHZ,
+			&RegenCtx.IroFreqUpdated);
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function checks if the PUF key regenerated on demand from
+ *		the same helper data is still loaded. The PUF status and PUF ID
+ *		registers are checked, so that the cache is not used once the
+ *		PUF is cleared or used for other operation.
+ *
+ * @param	PufData - Pointer to XPuf_Data structure which includes options
+ *                        to configure PUF
+ *
+ * @return
+ *	-	TRUE - PUF key is loaded from the same helper data
+ *	-	FALSE - Regeneration is required
+ *
+ *****************************************************************************/
+static u32 XPuf_IsRegenCacheHit(const XPuf_Data *PufData)
+{
+	u32 IsHit = (u32)FALSE;
+	u32 PufStatus;
+	u32 Index;
+
+	if ((RegenCache.IsValid != (u32)TRUE) ||
+		(PufData->PufOperation != XPUF_REGEN_ON_DEMAND) ||
+		(PufData->ReadOption != RegenCache.ReadOption) ||
+		(PufData->ShutterValue != RegenCache.ShutterValue) ||
+		(PufData->GlobalVarFilter != RegenCache.GlobalVarFilter)) {
+		goto END;
+	}
+
+	if ((PufData->ReadOption != XPUF_READ_FROM_EFUSE_CACHE) &&
+		((PufData->SyndromeAddr != RegenCache.SyndromeAddr) ||
+		(PufData->Chash != RegenCache.Chash) ||
+		(PufData->Aux != RegenCache.Aux))) {
+		goto END;
+	}
+
+	PufStatus = XPuf_ReadReg(XPUF_PMC_GLOBAL_BASEADDR,
+		XPUF_PMC_GLOBAL_PUF_STATUS_OFFSET);
+	if ((PufStatus & (XPUF_STATUS_ID_RDY | XPUF_STATUS_KEY_RDY)) !=
+		(XPUF_STATUS_ID_RDY | XPUF_STATUS_KEY_RDY)) {
+		goto END;
+	}
+
+	for (Index = 0U; Index < XPUF_ID_LEN_IN_WORDS; Index++) {
+		if (XPuf_ReadReg(XPUF_PMC_GLOBAL_BASEADDR,
+			(XPUF_PMC_GLOBAL_PUF_ID_0_OFFSET + (Index * XPUF_WORD_LENGTH))) !=
+			RegenCache.PufID[Index]) {
+			goto END;
+		}
+	}
+
+	IsHit = (u32)TRUE;
+
+END:
+	return IsHit;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function records the helper data of successful on demand
+ *		regeneration.
+ *
+ * @param	PufData - Pointer to XPuf_Data structure which includes options
+ *                        to configure PUF
+ *
+ *****************************************************************************/
+static void XPuf_UpdateRegenCache(const XPuf_Data *PufData)
+{
+	u32 Index;
+
+	RegenCache.ReadOption = PufData->ReadOption;
+	RegenCache.SyndromeAddr = PufData->SyndromeAddr;
+	RegenCache.Chash = PufData->Chash;
+	RegenCache.Aux = PufData->Aux;
+	RegenCache.ShutterValue = PufData->ShutterValue;
+	RegenCache.GlobalVarFilter = PufData->GlobalVarFilter;
+	for (Index = 0U; Index < XPUF_ID_LEN_IN_WORDS; Index++) {
+		RegenCache.PufID[Index] = PufData->PufID[Index];
+	}
+	RegenCache.IsValid = (u32)TRUE;
+}
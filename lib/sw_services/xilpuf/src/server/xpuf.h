@@ -38,6 +38,7 @@
 * 1.5   kpt  03/23/2022 Added macro's and error code related to IRO frequency
 * 2.0   har  06/09/2022 Added support for Versal_Net
 *                       Removed support for 12K mode
+*       ag   10/15/2026 Added regeneration start/complete APIs and error codes
 *
 * </pre>
 *
@@ -116,6 +117,10 @@ extern "C" {
 		/** Error if PUF operation is done but ID Ready bit is not set */
 #define XPUF_ERROR_PUF_ID_ZERO_TIMEOUT			(0x19)
 		/** Error due to timeout while zeroizing PUF ID */
+#define XPUF_ERROR_REGEN_IN_PROGRESS			(0x1A)
+		/** Error if regeneration is started again before completion */
+#define XPUF_ERROR_REGEN_NOT_STARTED			(0x1B)
+		/** Error if regeneration is completed without starting it */
 
 /***************************** Type Definitions *******************************/
 typedef struct _XPuf_Data {
@@ -145,6 +150,9 @@ typedef struct _XPuf_Data {
 /*************************** Function Prototypes ******************************/
 int XPuf_Registration(XPuf_Data *PufData);
 int XPuf_Regeneration(XPuf_Data *PufData);
+int XPuf_RegenerationStart(XPuf_Data *PufData);
+int XPuf_RegenerationComplete(XPuf_Data *PufData);
+void XPuf_RegenerationCacheInvalidate(void);
 int XPuf_GenerateFuseFormat(XPuf_Data *PufData);
 int XPuf_ClearPufID(void);
 
@@ -49,6 +49,8 @@
 * 4.5   am   11/24/20 Resolved MISRA C violations
 * 4.6   gm   07/16/21 Added support for 64-bit address
 *       am   09/17/21 Resolved compiler warnings
+* 4.9   ag   10/15/26 Added RSA public key cache and batch signature
+*                     verification API
 *
 * </pre>
 *
@@ -61,14 +63,28 @@
 #include "xsecure_utils.h"
 
 /************************** Constant Definitions *****************************/
+#define XSECURE_RSA_KEY_CACHE_MAX_WORDS	(XSECURE_RSA_4096_KEY_SIZE / \
+					XSECURE_WORD_SIZE) /**< Words of
+							     *  largest key */
 
 /**************************** Type Definitions *******************************/
+/**
+ * Public key modulus along with its pre-calculated R^2 mod N value
+ */
+typedef struct {
+	u32 Mod[XSECURE_RSA_KEY_CACHE_MAX_WORDS]; /**< Copy of the modulus */
+	u32 ModExt[XSECURE_RSA_KEY_CACHE_MAX_WORDS]; /**< R^2 mod N */
+	u32 Size; /**< Key size in bytes, 0 if the entry is free */
+} XSecure_RsaKeyCacheEntry;
 
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /************************** Function Prototypes ******************************/
+static XSecure_RsaKeyCacheEntry* XSecure_RsaKeyCacheLookup(u64 Mod, u32 Size);
 
 /************************** Variable Definitions *****************************/
+static XSecure_RsaKeyCacheEntry RsaKeyCache[XSECURE_RSA_KEY_CACHE_ENTRIES];
+static u32 RsaKeyCacheNextIdx = 0U;
 
 /************************** Function Definitions *****************************/
 
@@ -308,6 +324,7 @@ int XSecure_RsaPublicEncrypt_64Bit(XSecure_Rsa *InstancePtr, u64 Input,
 	u32 Size, u64 Result)
 {
 	int Status = XST_FAILURE;
+	const XSecure_RsaKeyCacheEntry *Entry = NULL;
 
 	/* Validate the input arguments */
 	if ((InstancePtr == NULL) || (Result == 0x00U) || (Input == 0x00U) ||
@@ -321,12 +338,39 @@ int XSecure_RsaPublicEncrypt_64Bit(XSecure_Rsa *InstancePtr, u64 Input,
 		goto END;
 	}
 
+	/*
+	 * Use the cached R^2 mod N value of a known public key, so that
+	 * the core does not have to calculate it for every operation
+	 */
 #ifdef versal
+	if (InstancePtr->ModExtAddr == 0x00U) {
+		Entry = XSecure_RsaKeyCacheLookup(InstancePtr->ModAddr, Size);
+		if (Entry != NULL) {
+			InstancePtr->ModExtAddr = (u64)(UINTPTR)Entry->ModExt;
+		}
+	}
+
 	Status = XSecure_RsaOperation(InstancePtr, Input, Result,
 			XSECURE_RSA_SIGN_ENC, Size);
+
+	if (Entry != NULL) {
+		InstancePtr->ModExtAddr = 0x00U;
+	}
 #else
+	if (InstancePtr->ModExt == NULL) {
+		Entry = XSecure_RsaKeyCacheLookup(
+			(u64)(UINTPTR)InstancePtr->Mod, Size);
+		if (Entry != NULL) {
+			InstancePtr->ModExt = (u8 *)(UINTPTR)Entry->ModExt;
+		}
+	}
+
 	Status = (int)XSecure_RsaOperation(InstancePtr, (u8 *)(UINTPTR)Input,
 			(u8 *)(UINTPTR)Result, XSECURE_RSA_SIGN_ENC, Size);
+
+	if (Entry != NULL) {
+		InstancePtr->ModExt = NULL;
+	}
 #endif
 
 
@@ -367,6 +411,165 @@ int XSecure_RsaPublicEncrypt(XSecure_Rsa *InstancePtr, u8 *Input,
 			Size, (u64)(UINTPTR)Result);
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function adds a public key and its pre-calculated R^2 mod N
+ *		value located at 64-bit addresses to the RSA key cache
+ *
+ * @param	Mod	- Address of the key Modulus
+ * @param	ModExt	- Address of the pre-calculated exponential
+ *			  (R^2 Mod N) value
+ * @param	Size	- Key size in bytes
+ *
+ * @return
+ *	-	XST_SUCCESS - If the key is cached
+ *	-	XSECURE_RSA_INVALID_PARAM - On invalid arguments
+ *
+ * @note	Once cached, XSecure_RsaPublicEncrypt uses the cached R^2 mod N
+ *		value for this modulus whenever the instance is initialized
+ *		without ModExt. When the cache is full, the oldest added key
+ *		is replaced.
+ *
+ ******************************************************************************/
+int XSecure_RsaKeyCacheAdd_64Bit(u64 Mod, u64 ModExt, u32 Size)
+{
+	int Status = XST_FAILURE;
+	XSecure_RsaKeyCacheEntry *Entry = NULL;
+	u32 Index;
+
+	/* Validate the input arguments */
+	if ((Mod == 0x00U) || (ModExt == 0x00U) || (Size == 0x00U) ||
+		(Size > XSECURE_RSA_4096_KEY_SIZE) ||
+		((Size & XSECURE_WORD_ALIGN_MASK) != 0x00U)) {
+		Status = (int)XSECURE_RSA_INVALID_PARAM;
+		goto END;
+	}
+
+	Entry = XSecure_RsaKeyCacheLookup(Mod, Size);
+	if (Entry == NULL) {
+		for (Index = 0U; Index < XSECURE_RSA_KEY_CACHE_ENTRIES; Index++) {
+			if (RsaKeyCache[Index].Size == 0x00U) {
+				Entry = &RsaKeyCache[Index];
+				break;
+			}
+		}
+	}
+	if (Entry == NULL) {
+		Entry = &RsaKeyCache[RsaKeyCacheNextIdx];
+		RsaKeyCacheNextIdx = (RsaKeyCacheNextIdx + 1U) %
+			XSECURE_RSA_KEY_CACHE_ENTRIES;
+	}
+
+	XSecure_MemCpy64((u64)(UINTPTR)Entry->Mod, Mod, Size);
+	XSecure_MemCpy64((u64)(UINTPTR)Entry->ModExt, ModExt, Size);
+	Entry->Size = Size;
+
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function adds a public key and its pre-calculated R^2 mod N
+ *		value to the RSA key cache
+ *
+ * @param	Mod	- Pointer to the key Modulus
+ * @param	ModExt	- Pointer to the pre-calculated exponential
+ *			  (R^2 Mod N) value
+ * @param	Size	- Key size in bytes
+ *
+ * @return
+ *	-	XST_SUCCESS - If the key is cached
+ *	-	XSECURE_RSA_INVALID_PARAM - On invalid arguments
+ *
+ ******************************************************************************/
+int XSecure_RsaKeyCacheAdd(const u8 *Mod, const u8 *ModExt, u32 Size)
+{
+	return XSecure_RsaKeyCacheAdd_64Bit((u64)(UINTPTR)Mod,
+			(u64)(UINTPTR)ModExt, Size);
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function removes all keys from the RSA key cache
+ *
+ ******************************************************************************/
+void XSecure_RsaKeyCacheClear(void)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < XSECURE_RSA_KEY_CACHE_ENTRIES; Index++) {
+		RsaKeyCache[Index].Size = 0x00U;
+	}
+	RsaKeyCacheNextIdx = 0U;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function verifies the RSA signatures of multiple partitions
+ *		signed with the public key the instance is initialized with
+ *
+ * @param	InstancePtr	- Pointer to the XSecure_Rsa instance
+ * @param	Entries		- Pointer to the signatures and hashes to be
+ *				  verified
+ * @param	Count		- Number of entries
+ * @param	ScratchAddr	- Address of a XSECURE_FSBL_SIG_SIZE bytes buffer
+ *				  used to hold the decrypted signature
+ * @param	FailIdx		- Index of the entry which failed verification,
+ *				  updated only on failure. Can be NULL
+ *
+ * @return
+ *	-	XST_SUCCESS - If all signatures are verified
+ *	-	XSECURE_RSA_INVALID_PARAM - On invalid arguments
+ *	-	XSECURE_RSA_STATE_MISMATCH_ERROR - If State mismatch is occurred
+ *	-	XST_FAILURE - On RSA operation failure or signature mismatch
+ *
+ * @note	Only 4096 bit keys with SHA3 hashes are supported, as in
+ *		XSecure_RsaSignVerification. Verification stops at the first
+ *		failing entry.
+ *
+ ******************************************************************************/
+int XSecure_RsaSignVerifyBatch(XSecure_Rsa *InstancePtr,
+	const XSecure_RsaSignVerifyEntry *Entries, u32 Count, u64 ScratchAddr,
+	u32 *FailIdx)
+{
+	int Status = XST_FAILURE;
+	u32 Index;
+
+	/* Validate the input arguments */
+	if ((InstancePtr == NULL) || (Entries == NULL) || (Count == 0x00U) ||
+		(ScratchAddr == 0x00U)) {
+		Status = (int)XSECURE_RSA_INVALID_PARAM;
+		goto END;
+	}
+
+	for (Index = 0U; Index < Count; Index++) {
+		Status = XST_FAILURE;
+		Status = XSecure_RsaPublicEncrypt_64Bit(InstancePtr,
+			Entries[Index].SignatureAddr, XSECURE_RSA_4096_KEY_SIZE,
+			ScratchAddr);
+		if (Status != XST_SUCCESS) {
+			break;
+		}
+
+		Status = XST_FAILURE;
+		Status = XSecure_RsaSignVerification_64Bit(ScratchAddr,
+			Entries[Index].HashAddr, XSECURE_HASH_TYPE_SHA3);
+		if (Status != XST_SUCCESS) {
+			break;
+		}
+	}
+
+	if ((Status != XST_SUCCESS) && (FailIdx != NULL)) {
+		*FailIdx = Index;
+	}
+
+END:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function handles the RSA decryption for data available at
@@ -485,4 +688,40 @@ int XSecure_RsaPrivateDecrypt(XSecure_Rsa *InstancePtr, u8 *Input,
 {
 	return XSecure_RsaPrivateDecrypt_64Bit(InstancePtr, (u64)(UINTPTR)Input,
 			Size, (u64)(UINTPTR)Result);
-}
\ No newline at end of file
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function finds the RSA key cache entry of a modulus
+ *
+ * @param	Mod	- Address of the key Modulus
+ * @param	Size	- Key size in bytes
+ *
+ * @return	Pointer to the cache entry, NULL if the key is not cached
+ *
+ ******************************************************************************/
+static XSecure_RsaKeyCacheEntry* XSecure_RsaKeyCacheLookup(u64 Mod, u32 Size)
+{
+	XSecure_RsaKeyCacheEntry *Entry = NULL;
+	const u8 *CachedMod;
+	u32 Index;
+	u32 ByteIdx;
+
+	for (Index = 0U; Index < XSECURE_RSA_KEY_CACHE_ENTRIES; Index++) {
+		if (RsaKeyCache[Index].Size != Size) {
+			continue;
+		}
+		CachedMod = (const u8 *)RsaKeyCache[Index].Mod;
+		for (ByteIdx = 0U; ByteIdx < Size; ByteIdx++) {
+			if (CachedMod[ByteIdx] != XSecure_InByte64(Mod + ByteIdx)) {
+				break;
+			}
+		}
+		if (ByteIdx == Size) {
+			Entry = &RsaKeyCache[Index];
+			break;
+		}
+	}
+
+	return Entry;
+}
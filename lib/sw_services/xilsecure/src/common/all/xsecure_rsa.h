@@ -62,6 +62,8 @@
 *       ana  10/15/20 Updated doxygen tags
 * 4.6   har  07/14/21 Fixed doxygen warnings
 *       gm   07/16/21 Added APIs to support 64-bit address
+* 4.9   ag   10/15/26 Added RSA public key cache and batch signature
+*                     verification API
 *
 * </pre>
 *
@@ -89,8 +91,22 @@ extern "C" {
 #define XSECURE_RSA_INVALID_PARAM	 (0x82U)	/**< Invalid Argument */
 #define XSECURE_RSA_STATE_MISMATCH_ERROR (0x84U)	/**< State mismatch */
 
+#ifndef XSECURE_RSA_KEY_CACHE_ENTRIES
+#define XSECURE_RSA_KEY_CACHE_ENTRIES	(2U) /**< Number of public keys
+						  *  cached with their
+						  *  R^2 mod N value */
+#endif
+
 
 /***************************** Type Definitions ******************************/
+/**
+ * Signature and expected hash of one partition verified by
+ * XSecure_RsaSignVerifyBatch
+ */
+typedef struct {
+	u64 SignatureAddr; /**< Address of the RSA signature */
+	u64 HashAddr; /**< Address of the SHA3 hash calculated on the data */
+} XSecure_RsaSignVerifyEntry;
 
 /***************************** Function Prototypes ***************************/
 
@@ -112,6 +128,16 @@ int XSecure_RsaPublicEncrypt(XSecure_Rsa *InstancePtr, u8 *Input,
 int XSecure_RsaPublicEncrypt_64Bit(XSecure_Rsa *InstancePtr, u64 Input,
 	u32 Size, u64 Result);
 
+/* RSA public key cache */
+int XSecure_RsaKeyCacheAdd(const u8 *Mod, const u8 *ModExt, u32 Size);
+int XSecure_RsaKeyCacheAdd_64Bit(u64 Mod, u64 ModExt, u32 Size);
+void XSecure_RsaKeyCacheClear(void);
+
+/* RSA signature validation of multiple partitions signed with the same key */
+int XSecure_RsaSignVerifyBatch(XSecure_Rsa *InstancePtr,
+	const XSecure_RsaSignVerifyEntry *Entries, u32 Count, u64 ScratchAddr,
+	u32 *FailIdx);
+
 /* RSA Private Decryption operation */
 int XSecure_RsaPrivateDecrypt(XSecure_Rsa *InstancePtr, u8 *Input,
 	u32 Size, u8 *Result);
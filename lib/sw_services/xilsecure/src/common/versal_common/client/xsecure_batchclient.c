@@ -0,0 +1,513 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+*******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xsecure_batchclient.c
+*
+* This file contains the implementation of the client interface functions
+* which queue XilSecure requests in the PLM IPI mailbox and submit all of
+* them with a single IPI.
+*
+* Request half of the mailbox: number of requests, followed by the requests.
+* Each request is the command header with the argument count, followed by
+* the arguments. Parameter structures referenced by the requests are placed
+* from the end of the request half downwards.
+* Response half of the mailbox: XSECURE_BATCH_RESP_SIZE words per request
+* with the status of the request in the first word.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 5.0   ag   10/15/26 Initial release
+*
+* </pre>
+*
+* @note
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xsecure_batchclient.h"
+#include "xsecure_shaclient.h"
+#include "xil_mem.h"
+#include "sleep.h"
+
+/************************** Constant Definitions *****************************/
+#define XSECURE_BATCH_PLM_MODULE_ID		(1U)
+				/**< PLM generic module ID */
+#define XSECURE_BATCH_IPI_MBOX_PROCESS_CMD_ID	(38U)
+				/**< PLM IpiMboxProcess command ID */
+#define XSECURE_BATCH_IPI_MBOX_PROCESS_HEADER	\
+	((XSECURE_BATCH_PLM_MODULE_ID << 8U) | \
+	XSECURE_BATCH_IPI_MBOX_PROCESS_CMD_ID)
+				/**< Header of IpiMboxProcess command */
+#define XSECURE_BATCH_WORD_LEN			(4U)
+				/**< Word length in bytes */
+#define XSECURE_BATCH_PARAM_ALIGN_MASK		(7U)
+				/**< Parameters are double word aligned */
+#define XSECURE_BATCH_WAIT_TIMEOUT		(100000U)
+				/**< Wait timeout in 100us steps */
+#define XSECURE_BATCH_RESP_IDX_COUNT		(1U)
+				/**< Index of processed count in response */
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+static void XSecure_BatchStart(XSecure_BatchInstance *InstancePtr);
+
+/************************** Variable Definitions *****************************/
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+ * @brief	This function initializes the batch instance with the PLM IPI
+ *		mailbox of the channel
+ *
+ * @param	InstancePtr	Pointer to the batch instance
+ * @param	ClientPtr	Pointer to the client instance
+ * @param	MboxAddr	Address of the mailbox configured for the IPI
+ *				channel with the IpiMboxConfig CDO command
+ * @param	Size		Size of the mailbox in bytes
+ *
+ * @return
+ *	-	XST_SUCCESS - On success
+ *	-	XST_INVALID_PARAM - On invalid argument
+ *
+ ******************************************************************************/
+int XSecure_BatchInit(XSecure_BatchInstance *InstancePtr,
+	XSecure_ClientInstance *ClientPtr, u64 MboxAddr, u32 Size)
+{
+	int Status = XST_INVALID_PARAM;
+
+	if ((InstancePtr == NULL) || (ClientPtr == NULL) ||
+		(ClientPtr->MailboxPtr == NULL) || (MboxAddr == 0U) ||
+		((MboxAddr & XSECURE_BATCH_PARAM_ALIGN_MASK) != 0U) ||
+		((Size & XSECURE_BATCH_PARAM_ALIGN_MASK) != 0U) ||
+		(Size < (2U * XSECURE_BATCH_RESP_SIZE * XSECURE_BATCH_WORD_LEN))) {
+		goto END;
+	}
+
+	InstancePtr->ClientPtr = ClientPtr;
+	InstancePtr->MboxAddr = MboxAddr;
+	InstancePtr->ReqSize = Size >> 1U;
+	XSecure_BatchStart(InstancePtr);
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function adds a XilSecure request to the batch
+ *
+ * @param	InstancePtr	Pointer to the batch instance
+ * @param	ApiId		XilSecure API ID of the request
+ * @param	Args		Pointer to the arguments of the request, same
+ *				as the IPI payload following the header
+ * @param	ArgCnt		Number of arguments
+ *
+ * @return
+ *	-	XST_SUCCESS - On success
+ *	-	XST_INVALID_PARAM - On invalid argument
+ *	-	XST_FAILURE - If the batch is pending or there is no space left
+ *
+ ******************************************************************************/
+int XSecure_BatchAddReq(XSecure_BatchInstance *InstancePtr, u32 ApiId,
+	const u32 *Args, u32 ArgCnt)
+{
+	int Status = XST_INVALID_PARAM;
+	u32 *ReqPtr;
+	u32 Index;
+	u32 ReqLen = (ArgCnt + 1U) * XSECURE_BATCH_WORD_LEN;
+
+	if ((InstancePtr == NULL) || (InstancePtr->ClientPtr == NULL) ||
+		((Args == NULL) && (ArgCnt != 0U)) ||
+		(ArgCnt > XSECURE_BATCH_MAX_ARG_CNT) ||
+		(ApiId > XSECURE_API_ID_MASK)) {
+		goto END;
+	}
+
+	Status = XST_FAILURE;
+	if (InstancePtr->State == XSECURE_BATCH_PENDING) {
+		goto END;
+	}
+	if (InstancePtr->State == XSECURE_BATCH_DONE) {
+		XSecure_BatchStart(InstancePtr);
+	}
+
+	/* Every request needs its response words in the response half */
+	if (((InstancePtr->ReqCount + 1U) * XSECURE_BATCH_RESP_SIZE *
+		XSECURE_BATCH_WORD_LEN) > InstancePtr->ReqSize) {
+		goto END;
+	}
+	if ((InstancePtr->ParamOffset - InstancePtr->ReqOffset) < ReqLen) {
+		goto END;
+	}
+
+	ReqPtr = (u32 *)(UINTPTR)(InstancePtr->MboxAddr + InstancePtr->ReqOffset);
+	ReqPtr[0U] = HEADER(ArgCnt, ApiId);
+	for (Index = 0U; Index < ArgCnt; Index++) {
+		ReqPtr[Index + 1U] = Args[Index];
+	}
+	InstancePtr->ReqOffset += ReqLen;
+	InstancePtr->ReqCount++;
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function copies a parameter structure referenced by a
+ *		request into the mailbox, so that it stays valid until the
+ *		batch is processed
+ *
+ * @param	InstancePtr	Pointer to the batch instance
+ * @param	Param		Pointer to the parameter structure
+ * @param	Size		Size of the parameter structure in bytes
+ * @param	ParamAddr	Address of the copy to be passed in the request
+ *
+ * @return
+ *	-	XST_SUCCESS - On success
+ *	-	XST_INVALID_PARAM - On invalid argument
+ *	-	XST_FAILURE - If the batch is pending or there is no space left
+ *
+ ******************************************************************************/
+int XSecure_BatchAddParam(XSecure_BatchInstance *InstancePtr,
+	const void *Param, u32 Size, u64 *ParamAddr)
+{
+	int Status = XST_INVALID_PARAM;
+	u32 AlignedSize = (Size + XSECURE_BATCH_PARAM_ALIGN_MASK) &
+		~XSECURE_BATCH_PARAM_ALIGN_MASK;
+	u32 Offset;
+
+	if ((InstancePtr == NULL) || (InstancePtr->ClientPtr == NULL) ||
+		(Param == NULL) || (Size == 0U) || (ParamAddr == NULL) ||
+		(AlignedSize < Size)) {
+		goto END;
+	}
+
+	Status = XST_FAILURE;
+	if (InstancePtr->State == XSECURE_BATCH_PENDING) {
+		goto END;
+	}
+	if (InstancePtr->State == XSECURE_BATCH_DONE) {
+		XSecure_BatchStart(InstancePtr);
+	}
+
+	if ((InstancePtr->ParamOffset - InstancePtr->ReqOffset) < AlignedSize) {
+		goto END;
+	}
+
+	Offset = InstancePtr->ParamOffset - AlignedSize;
+	Xil_MemCpy((void *)(UINTPTR)(InstancePtr->MboxAddr + Offset), Param, Size);
+	InstancePtr->ParamOffset = Offset;
+	*ParamAddr = InstancePtr->MboxAddr + Offset;
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function adds the requests to calculate SHA3 hash of the
+ *		data to the batch
+ *
+ * @param	InstancePtr	Pointer to the batch instance
+ * @param	InDataAddr	Address of the input data
+ * @param	OutDataAddr	Address of the output buffer to store the hash
+ * @param	Size		Size of the input data in bytes
+ *
+ * @return
+ *	-	XST_SUCCESS - On success
+ *	-	XST_INVALID_PARAM - On invalid argument
+ *	-	XST_FAILURE - If the batch is pending or there is no space left
+ *
+ * @note	The SHA3 engine must not be used by other requests of this
+ *		processor until the batch is processed.
+ *
+ ******************************************************************************/
+int XSecure_BatchAddSha3Digest(XSecure_BatchInstance *InstancePtr,
+	u64 InDataAddr, u64 OutDataAddr, u32 Size)
+{
+	int Status = XST_FAILURE;
+	u32 Args[XSECURE_PAYLOAD_LEN_5U];
+
+	Args[0U] = (u32)InDataAddr;
+	Args[1U] = (u32)(InDataAddr >> 32);
+	Args[2U] = (u32)((1U << XSECURE_SHA_UPDATE_CONTINUE_SHIFT) |
+		(1U << XSECURE_SHA_FIRST_PACKET_SHIFT) | Size);
+	Args[3U] = XSECURE_IPI_UNUSED_PARAM;
+	Args[4U] = XSECURE_IPI_UNUSED_PARAM;
+	Status = XSecure_BatchAddReq(InstancePtr, XSECURE_API_SHA3_UPDATE,
+		Args, XSECURE_PAYLOAD_LEN_5U);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	Args[0U] = XSECURE_IPI_UNUSED_PARAM;
+	Args[1U] = XSECURE_IPI_UNUSED_PARAM;
+	Args[2U] = XSECURE_IPI_UNUSED_PARAM;
+	Args[3U] = (u32)OutDataAddr;
+	Args[4U] = (u32)(OutDataAddr >> 32);
+	Status = XSecure_BatchAddReq(InstancePtr, XSECURE_API_SHA3_UPDATE,
+		Args, XSECURE_PAYLOAD_LEN_5U);
+	if (Status != XST_SUCCESS) {
+		/* Do not leave an unfinished SHA3 operation in the batch */
+		InstancePtr->ReqCount--;
+		InstancePtr->ReqOffset -= ((XSECURE_PAYLOAD_LEN_5U + 1U) *
+			XSECURE_BATCH_WORD_LEN);
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function adds the request to verify an elliptic signature
+ *		to the batch
+ *
+ * @param	InstancePtr	Pointer to the batch instance
+ * @param	CurveType	Type of elliptic curve
+ * @param	HashAddr	Address of the hash
+ * @param	Size		Length of the hash in bytes
+ * @param	PubKeyAddr	Address of the public key
+ * @param	SignAddr	Address of the signature
+ *
+ * @return
+ *	-	XST_SUCCESS - On success
+ *	-	XST_INVALID_PARAM - On invalid argument
+ *	-	XST_FAILURE - If the batch is pending or there is no space left
+ *
+ ******************************************************************************/
+int XSecure_BatchAddEllipticVerifySign(XSecure_BatchInstance *InstancePtr,
+	u32 CurveType, u64 HashAddr, u32 Size, u64 PubKeyAddr, u64 SignAddr)
+{
+	int Status = XST_FAILURE;
+	XSecure_EllipticSignVerifyParams EcdsaParams;
+	u64 ParamAddr = 0U;
+	u32 Args[XSECURE_PAYLOAD_LEN_2U];
+
+	EcdsaParams.CurveType = CurveType;
+	EcdsaParams.HashAddr = HashAddr;
+	EcdsaParams.Size = Size;
+	EcdsaParams.PubKeyAddr = PubKeyAddr;
+	EcdsaParams.SignAddr = SignAddr;
+
+	Status = XSecure_BatchAddParam(InstancePtr, &EcdsaParams,
+		sizeof(EcdsaParams), &ParamAddr);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	Args[0U] = (u32)ParamAddr;
+	Args[1U] = (u32)(ParamAddr >> 32);
+	Status = XSecure_BatchAddReq(InstancePtr, XSECURE_API_ELLIPTIC_VERIFY_SIGN,
+		Args, XSECURE_PAYLOAD_LEN_2U);
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function submits all requests of the batch to PLM with a
+ *		single IPI and returns without waiting for them to complete
+ *
+ * @param	InstancePtr	Pointer to the batch instance
+ *
+ * @return
+ *	-	XST_SUCCESS - On success
+ *	-	XST_INVALID_PARAM - On invalid argument
+ *	-	XST_FAILURE - If the batch is empty, pending or the IPI fails
+ *
+ ******************************************************************************/
+int XSecure_BatchSubmit(XSecure_BatchInstance *InstancePtr)
+{
+	int Status = XST_INVALID_PARAM;
+	u32 Payload[XSECURE_PAYLOAD_LEN_1U];
+	u32 *CountPtr;
+
+	if ((InstancePtr == NULL) || (InstancePtr->ClientPtr == NULL)) {
+		goto END;
+	}
+
+	Status = XST_FAILURE;
+	if ((InstancePtr->State != XSECURE_BATCH_IDLE) ||
+		(InstancePtr->ReqCount == 0U)) {
+		goto END;
+	}
+
+	CountPtr = (u32 *)(UINTPTR)InstancePtr->MboxAddr;
+	*CountPtr = InstancePtr->ReqCount;
+	XSecure_DCacheFlushRange(CountPtr, InstancePtr->ReqSize);
+	/* Drop stale response lines before PLM writes the responses */
+	XSecure_DCacheInvalidateRange(CountPtr + (InstancePtr->ReqSize >> 2U),
+		InstancePtr->ReqSize);
+
+	Payload[0U] = XSECURE_BATCH_IPI_MBOX_PROCESS_HEADER;
+	Status = (int)XMailbox_SendData(InstancePtr->ClientPtr->MailboxPtr,
+		XSECURE_TARGET_IPI_INT_MASK, Payload, XSECURE_PAYLOAD_LEN_1U,
+		XILMBOX_MSG_TYPE_REQ, FALSE);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	InstancePtr->State = XSECURE_BATCH_PENDING;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function checks if PLM has processed the submitted batch
+ *
+ * @param	InstancePtr	Pointer to the batch instance
+ *
+ * @return
+ *	-	TRUE - If the batch is processed or not pending
+ *	-	FALSE - If PLM is still processing the batch
+ *
+ ******************************************************************************/
+u32 XSecure_BatchIsDone(const XSecure_BatchInstance *InstancePtr)
+{
+	u32 IsDone = TRUE;
+	XIpiPsu *IpiInstPtr;
+
+	if ((InstancePtr != NULL) &&
+		(InstancePtr->State == XSECURE_BATCH_PENDING)) {
+		IpiInstPtr = &InstancePtr->ClientPtr->MailboxPtr->Agent.IpiInst;
+		if ((XIpiPsu_GetObsStatus(IpiInstPtr) &
+			XSECURE_TARGET_IPI_INT_MASK) != 0U) {
+			IsDone = FALSE;
+		}
+	}
+
+	return IsDone;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function waits for PLM to process the submitted batch and
+ *		reads its response
+ *
+ * @param	InstancePtr	Pointer to the batch instance
+ *
+ * @return
+ *	-	XST_SUCCESS - If all requests are processed successfully
+ *	-	XST_INVALID_PARAM - On invalid argument
+ *	-	XST_FAILURE - If the batch is not pending or on timeout
+ *	-	Errorcode - Error of the mailbox processing or of the first
+ *			    failing request
+ *
+ ******************************************************************************/
+int XSecure_BatchWait(XSecure_BatchInstance *InstancePtr)
+{
+	int Status = XST_INVALID_PARAM;
+	u32 Response[RESPONSE_ARG_CNT];
+	u32 Timeout = XSECURE_BATCH_WAIT_TIMEOUT;
+
+	if ((InstancePtr == NULL) || (InstancePtr->ClientPtr == NULL)) {
+		goto END;
+	}
+
+	Status = XST_FAILURE;
+	if (InstancePtr->State != XSECURE_BATCH_PENDING) {
+		goto END;
+	}
+
+	while (XSecure_BatchIsDone(InstancePtr) != TRUE) {
+		if (Timeout == 0U) {
+			goto END;
+		}
+		usleep(100U);
+		Timeout--;
+	}
+
+	Status = (int)XMailbox_Recv(InstancePtr->ClientPtr->MailboxPtr,
+		XSECURE_TARGET_IPI_INT_MASK, Response, RESPONSE_ARG_CNT,
+		XILMBOX_MSG_TYPE_RESP);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	InstancePtr->DoneCount = Response[XSECURE_BATCH_RESP_IDX_COUNT];
+	if (InstancePtr->DoneCount > InstancePtr->ReqCount) {
+		InstancePtr->DoneCount = InstancePtr->ReqCount;
+	}
+	InstancePtr->State = XSECURE_BATCH_DONE;
+	XSecure_DCacheInvalidateRange((UINTPTR)(InstancePtr->MboxAddr +
+		InstancePtr->ReqSize), InstancePtr->ReqSize);
+	Status = (int)Response[0U];
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function returns the status of a request of the processed
+ *		batch
+ *
+ * @param	InstancePtr	Pointer to the batch instance
+ * @param	ReqIdx		Index of the request in the order it was added
+ *
+ * @return
+ *	-	Status of the request
+ *	-	XST_INVALID_PARAM - On invalid argument
+ *	-	XST_FAILURE - If the request is not processed
+ *
+ ******************************************************************************/
+int XSecure_BatchGetReqStatus(const XSecure_BatchInstance *InstancePtr,
+	u32 ReqIdx)
+{
+	int Status = XST_INVALID_PARAM;
+	const u32 *RespPtr;
+
+	if (InstancePtr == NULL) {
+		goto END;
+	}
+
+	Status = XST_FAILURE;
+	if ((InstancePtr->State != XSECURE_BATCH_DONE) ||
+		(ReqIdx >= InstancePtr->DoneCount)) {
+		goto END;
+	}
+
+	RespPtr = (const u32 *)(UINTPTR)(InstancePtr->MboxAddr +
+		InstancePtr->ReqSize);
+	Status = (int)RespPtr[ReqIdx * XSECURE_BATCH_RESP_SIZE];
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function empties the batch
+ *
+ * @param	InstancePtr	Pointer to the batch instance
+ *
+ ******************************************************************************/
+static void XSecure_BatchStart(XSecure_BatchInstance *InstancePtr)
+{
+	/* First word of the request half holds the number of requests */
+	InstancePtr->ReqOffset = XSECURE_BATCH_WORD_LEN;
+	InstancePtr->ParamOffset = InstancePtr->ReqSize;
+	InstancePtr->ReqCount = 0U;
+	InstancePtr->DoneCount = 0U;
+	InstancePtr->State = XSECURE_BATCH_IDLE;
+}
@@ -0,0 +1,97 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+*******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xsecure_batchclient.h
+* @addtogroup xsecure_batch_client_apis XilSecure Batch Client APIs
+* @{
+* @cond xsecure_internal
+* This file Contains the client function prototypes, defines and macros for
+* submitting multiple XilSecure requests to PLM with a single IPI.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 5.0   ag   10/15/26 Initial release
+*
+* </pre>
+*
+* @note
+*
+******************************************************************************/
+
+#ifndef XSECURE_BATCHCLIENT_H
+#define XSECURE_BATCHCLIENT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+#include "xsecure_mailbox.h"
+#include "xsecure_defs.h"
+
+/************************** Constant Definitions *****************************/
+#define XSECURE_BATCH_RESP_SIZE		(8U)
+	/**< Response words of each request, same as PLM command response */
+
+#define XSECURE_BATCH_MAX_ARG_CNT	(64U)
+	/**< Maximum arguments of a request, same as PLM mailbox limit */
+
+/**************************** Type Definitions *******************************/
+typedef enum {
+	XSECURE_BATCH_IDLE = 0,	/**< Requests can be added */
+	XSECURE_BATCH_PENDING,	/**< Submitted, waiting for PLM */
+	XSECURE_BATCH_DONE	/**< Responses are available */
+} XSecure_BatchState;
+
+/**
+ * The batch instance holds the requests added to the PLM IPI mailbox of the
+ * channel. The mailbox memory must be the one configured for the channel
+ * with the PLM IpiMboxConfig CDO command.
+ */
+typedef struct {
+	XSecure_ClientInstance *ClientPtr; /**< Client used to send the IPI */
+	u64 MboxAddr;		/**< Address of the PLM IPI mailbox */
+	u32 ReqSize;		/**< Size of the request half in bytes */
+	u32 ReqOffset;		/**< Offset of the next request */
+	u32 ParamOffset;	/**< Offset of the last added parameter */
+	u32 ReqCount;		/**< Number of requests added */
+	u32 DoneCount;		/**< Number of requests processed by PLM */
+	XSecure_BatchState State; /**< Batch state */
+} XSecure_BatchInstance;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+int XSecure_BatchInit(XSecure_BatchInstance *InstancePtr,
+	XSecure_ClientInstance *ClientPtr, u64 MboxAddr, u32 Size);
+int XSecure_BatchAddReq(XSecure_BatchInstance *InstancePtr, u32 ApiId,
+	const u32 *Args, u32 ArgCnt);
+int XSecure_BatchAddParam(XSecure_BatchInstance *InstancePtr,
+	const void *Param, u32 Size, u64 *ParamAddr);
+int XSecure_BatchAddSha3Digest(XSecure_BatchInstance *InstancePtr,
+	u64 InDataAddr, u64 OutDataAddr, u32 Size);
+int XSecure_BatchAddEllipticVerifySign(XSecure_BatchInstance *InstancePtr,
+	u32 CurveType, u64 HashAddr, u32 Size, u64 PubKeyAddr, u64 SignAddr);
+int XSecure_BatchSubmit(XSecure_BatchInstance *InstancePtr);
+u32 XSecure_BatchIsDone(const XSecure_BatchInstance *InstancePtr);
+int XSecure_BatchWait(XSecure_BatchInstance *InstancePtr);
+int XSecure_BatchGetReqStatus(const XSecure_BatchInstance *InstancePtr,
+	u32 ReqIdx);
+
+/************************** Variable Definitions *****************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* XSECURE_BATCHCLIENT_H */
+/* @} */
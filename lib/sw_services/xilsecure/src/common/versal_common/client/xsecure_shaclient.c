@@ -26,6 +26,7 @@
 *                     XSecure_Sha3Initialize API
 *       kpt  03/16/22 Removed IPI related code and added mailbox support
 * 5.0   kpt  07/24/22 Moved XSecure_Sha3Kat into xsecure_katclient.c
+*       ag   10/15/26 Moved SHA3 update payload macros to xsecure_shaclient.h
 *
 * </pre>
 *
@@ -41,8 +42,6 @@ static XSecure_ShaState Sha3State = XSECURE_SHA_UNINITIALIZED;
 /**************************** Type Definitions *******************************/
 
 /***************** Macros (Inline Functions) Definitions *********************/
-#define XSECURE_SHA_FIRST_PACKET_SHIFT		(30U)
-#define XSECURE_SHA_UPDATE_CONTINUE_SHIFT	(31U)
 
 /************************** Function Prototypes ******************************/
 
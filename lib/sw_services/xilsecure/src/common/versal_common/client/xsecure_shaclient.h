@@ -23,6 +23,7 @@
 *       kpt  04/28/21 Added enum XSecure_ShaState to update sha driver states
 *       kpt  03/16/22 Removed IPI related code and added mailbox support
 * 5.0   kpt  07/24/22 Moved XSecure_Sha3Kat into xsecure_katclient.c
+*       ag   10/15/26 Added SHA3 update payload macros
 *
 * </pre>
 *
@@ -43,6 +44,10 @@ extern "C" {
 #include "xsecure_defs.h"
 
 /************************** Constant Definitions *****************************/
+#define XSECURE_SHA_FIRST_PACKET_SHIFT		(30U)
+	/**< Shift of the first packet flag in SHA3 update payload */
+#define XSECURE_SHA_UPDATE_CONTINUE_SHIFT	(31U)
+	/**< Shift of the continue flag in SHA3 update payload */
 
 /**************************** Type Definitions *******************************/
 typedef enum {
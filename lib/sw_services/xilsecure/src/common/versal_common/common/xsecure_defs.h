@@ -21,6 +21,7 @@
 * 4.7   kpt  11/29/21 Added macro XSecure_DCacheFlushRange
 * 5.0   bm   07/06/22 Refactor versal and versal_net code
 *       kpt  07/24/22 Added XSecure_EccCrvClass
+*       ag   10/15/26 Added macro XSecure_DCacheInvalidateRange
 *
 * </pre>
 * @note
@@ -68,6 +69,16 @@ extern "C" {
 	#define XSecure_DCacheFlushRange(SrcAddr, Len) {}
 #endif /**< Cache Invalidate function */
 
+#ifndef XSECURE_CACHE_DISABLE
+	#if defined(__microblaze__)
+		#define XSecure_DCacheInvalidateRange(SrcAddr, Len) Xil_DCacheInvalidateRange((UINTPTR)SrcAddr, Len)
+	#else
+		#define XSecure_DCacheInvalidateRange(SrcAddr, Len) Xil_DCacheInvalidateRange((INTPTR)SrcAddr, Len)
+	#endif
+#else
+	#define XSecure_DCacheInvalidateRange(SrcAddr, Len) {}
+#endif /**< Cache Invalidate function */
+
 #define XSECURE_API(ApiId)	((u32)ApiId)
 				/**< Macro to typecast XILSECURE API ID */
 
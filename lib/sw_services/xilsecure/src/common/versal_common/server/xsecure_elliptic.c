@@ -45,6 +45,7 @@
 *                     to non static
 * 5.0   kpt  07/24/22 Moved XSecure_EllipticKat into xsecure_kat.c
 *       dc   08/26/22 Removed initializations of arrays
+*       ag   10/15/26 Added XSecure_EllipticVerifySignBatch_64Bit
 *
 *
 * </pre>
@@ -75,6 +76,8 @@
 EcdsaCrvInfo* XSecure_EllipticGetCrvData(XSecure_EllipticCrvTyp CrvTyp);
 static void XSecure_PutData(const u32 Size, u8 *Dst, const u64 SrcAddr);
 static void XSecure_GetData(const u32 Size, const u8 *Src, const u64 DstAddr);
+static int XSecure_EllipticVerifySignInt(const EcdsaCrvInfo *Crv, u8 *Hash,
+	const EcdsaKey *Key, const EcdsaSign *Sign);
 
 /************************** Variable Definitions *****************************/
 
@@ -528,8 +531,6 @@ int XSecure_EllipticVerifySign_64Bit(XSecure_EllipticCrvTyp CrvType,
 	XSecure_EllipticSignAddr *SignAddr)
 {
 	volatile int Status = (int)XSECURE_ELLIPTIC_NON_SUPPORTED_CRV;
-	volatile int VerifyStatus = XST_FAILURE;
-	volatile int VerifyStatusTmp = XST_FAILURE;
 	EcdsaCrvInfo *Crv = NULL;
 	u8 PaddedHash[XSECURE_ECC_P521_SIZE_IN_BYTES];
 	volatile u32 HashLenTmp = 0xFFFFFFFFU;
@@ -604,45 +605,126 @@ int XSecure_EllipticVerifySign_64Bit(XSecure_EllipticCrvTyp CrvType,
 
 	Crv = XSecure_EllipticGetCrvData(CrvType);
 	if(Crv != NULL) {
-		XSECURE_TEMPORAL_IMPL(VerifyStatus, VerifyStatusTmp, Ecdsa_VerifySign,
-			Crv, PaddedHash, Crv->Bits, (EcdsaKey *)&Key, (EcdsaSign *)&Sign);
+		Status = XSecure_EllipticVerifySignInt(Crv, PaddedHash, &Key, &Sign);
+	}
 
-		if ((ELLIPTIC_BAD_SIGN == VerifyStatus) ||
-			(ELLIPTIC_BAD_SIGN == VerifyStatusTmp)) {
-			Status = (int)XSECURE_ELLIPTIC_BAD_SIGN;
-		}
-		else if ((ELLIPTIC_VER_SIGN_INCORRECT_HASH_LEN == VerifyStatus) ||
-			(ELLIPTIC_VER_SIGN_INCORRECT_HASH_LEN == VerifyStatusTmp)) {
-			Status = (int)XSECURE_ELLIPTIC_VER_SIGN_INCORRECT_HASH_LEN;
-		}
-		else if ((ELLIPTIC_VER_SIGN_R_ZERO == VerifyStatus) ||
-			(ELLIPTIC_VER_SIGN_R_ZERO == VerifyStatusTmp)) {
-			Status = (int)XSECURE_ELLIPTIC_VER_SIGN_R_ZERO;
-		}
-		else if ((ELLIPTIC_VER_SIGN_S_ZERO == VerifyStatus) ||
-			(ELLIPTIC_VER_SIGN_S_ZERO == VerifyStatusTmp)) {
-			Status = (int)XSECURE_ELLIPTIC_VER_SIGN_S_ZERO;
-		}
-		else if ((ELLIPTIC_VER_SIGN_R_ORDER_ERROR == VerifyStatus) ||
-			(ELLIPTIC_VER_SIGN_R_ORDER_ERROR == VerifyStatusTmp)) {
-			Status = (int)XSECURE_ELLIPTIC_VER_SIGN_R_ORDER_ERROR;
-		}
-		else if ((ELLIPTIC_VER_SIGN_S_ORDER_ERROR == VerifyStatus) ||
-			(ELLIPTIC_VER_SIGN_S_ORDER_ERROR == VerifyStatusTmp)) {
-			Status = (int)XSECURE_ELLIPTIC_VER_SIGN_S_ORDER_ERROR;
+END:
+	XSecure_SetReset(XSECURE_ECDSA_RSA_BASEADDR,
+		XSECURE_ECDSA_RSA_RESET_OFFSET);
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function verifies the signatures of multiple hashes signed
+ *		by the same key. The key is read and the ECDSA core is taken out
+ *		of reset once for the whole batch.
+ *
+ * @param	CrvType - Type of elliptic curve
+ * @param	KeyAddr - Pointer to public key address
+ * @param	Entries - Pointer to the array of hash and signature addresses
+ * @param	Count   - Number of entries
+ * @param	FailIdx - Index of the entry which failed verification, set
+ *			  only on failure
+ *
+ * @return
+ *	-	XST_SUCCESS - If all signatures are verified successfully
+ *	-	XSECURE_ELLIPTIC_INVALID_PARAM - On invalid argument
+ *	-	Errorcode - Same as XSecure_EllipticVerifySign_64Bit for the
+ *			    first failing entry
+ *
+ *****************************************************************************/
+int XSecure_EllipticVerifySignBatch_64Bit(XSecure_EllipticCrvTyp CrvType,
+	XSecure_EllipticKeyAddr *KeyAddr, const XSecure_EllipticVerifyEntry *Entries,
+	u32 Count, u32 *FailIdx)
+{
+	volatile int Status = (int)XSECURE_ELLIPTIC_NON_SUPPORTED_CRV;
+	EcdsaCrvInfo *Crv = NULL;
+	u8 PaddedHash[XSECURE_ECC_P521_SIZE_IN_BYTES];
+	u8 PubKey[XSECURE_ECC_P521_SIZE_IN_BYTES +
+	XSECURE_ECDSA_P521_ALIGN_BYTES +
+	XSECURE_ECC_P521_SIZE_IN_BYTES];
+	u8 Signature[XSECURE_ECC_P521_SIZE_IN_BYTES +
+	XSECURE_ECDSA_P521_ALIGN_BYTES +
+	XSECURE_ECC_P521_SIZE_IN_BYTES];
+	EcdsaKey Key;
+	EcdsaSign Sign;
+	u32 OffSet = 0U;
+	u32 Size = 0U;
+	u32 Idx;
+
+	if ((KeyAddr == NULL) || (Entries == NULL) || (Count == 0U) ||
+		(FailIdx == NULL)) {
+		Status = (int)XSECURE_ELLIPTIC_INVALID_PARAM;
+		goto RET;
+	}
+
+	Status = XSecure_CryptoCheck();
+	if (Status != XST_SUCCESS) {
+		goto RET;
+	}
+
+	Status = XST_FAILURE;
+	if ((CrvType != XSECURE_ECC_NIST_P384) && (CrvType != XSECURE_ECC_NIST_P521)) {
+		Status = (int)XSECURE_ELLIPTIC_INVALID_PARAM;
+		goto RET;
+	}
+
+	Crv = XSecure_EllipticGetCrvData(CrvType);
+	if (Crv == NULL) {
+		Status = (int)XSECURE_ELLIPTIC_NON_SUPPORTED_CRV;
+		goto RET;
+	}
+
+	if (CrvType == XSECURE_ECC_NIST_P521) {
+		Size = XSECURE_ECC_P521_SIZE_IN_BYTES;
+		OffSet = Size + XSECURE_ECDSA_P521_ALIGN_BYTES;
+	} else {
+		Size = XSECURE_ECC_P384_SIZE_IN_BYTES;
+		OffSet = Size;
+	}
+
+	/* Public key is common for all the entries */
+	XSecure_PutData(Size, (u8 *)PubKey, KeyAddr->Qx);
+	XSecure_PutData(Size, (u8 *)(PubKey + OffSet), KeyAddr->Qy);
+	Key.Qx = (u8 *)(UINTPTR)PubKey;
+	Key.Qy = (u8 *)(UINTPTR)(PubKey + OffSet);
+	Sign.r = (u8 *)(UINTPTR)Signature;
+	Sign.s = (u8 *)(UINTPTR)(Signature + OffSet);
+
+	XSecure_ReleaseReset(XSECURE_ECDSA_RSA_BASEADDR,
+		XSECURE_ECDSA_RSA_RESET_OFFSET);
+
+	for (Idx = 0U; Idx < Count; Idx++) {
+		*FailIdx = Idx;
+		if (Entries[Idx].HashInfo.Len > XSECURE_ECC_P521_SIZE_IN_BYTES) {
+			Status = (int)XSECURE_ELLIPTIC_INVALID_PARAM;
+			goto END;
 		}
-		else if ((ELLIPTIC_SUCCESS != VerifyStatus) ||
-			(ELLIPTIC_SUCCESS != VerifyStatusTmp)) {
-			Status = XST_FAILURE;
+
+		Status = Xil_SMemSet(PaddedHash, XSECURE_ECC_P521_SIZE_IN_BYTES,
+				0U, XSECURE_ECC_P521_SIZE_IN_BYTES);
+		if (Status != XST_SUCCESS) {
+			goto END;
 		}
-		else {
-			Status = XST_SUCCESS;
+
+		XSecure_PutData(Size, (u8 *)Signature, Entries[Idx].SignAddr.SignR);
+		XSecure_PutData(Size, (u8 *)(Signature + OffSet),
+			Entries[Idx].SignAddr.SignS);
+		XSecure_PutData(Entries[Idx].HashInfo.Len, (u8 *)PaddedHash,
+			Entries[Idx].HashInfo.Addr);
+
+		Status = XST_FAILURE;
+		Status = XSecure_EllipticVerifySignInt(Crv, PaddedHash, &Key, &Sign);
+		if (Status != XST_SUCCESS) {
+			goto END;
 		}
 	}
 
 END:
 	XSecure_SetReset(XSECURE_ECDSA_RSA_BASEADDR,
 		XSECURE_ECDSA_RSA_RESET_OFFSET);
+RET:
 	return Status;
 }
 
@@ -750,3 +832,63 @@ static void XSecure_GetData(const u32 Size, const u8 *Src, const u64 DstAddr)
 		XSecure_OutByte64((DstAddr + Index), Src[Index]);
 	}
 }
+
+/*****************************************************************************/
+/**
+ * @brief	This function verifies the signature with the ECDSA core which
+ *		is already out of reset and maps the result to XilSecure error
+ *
+ * @param	Crv  - Pointer to the curve information
+ * @param	Hash - Pointer to the hash padded to the curve size
+ * @param	Key  - Pointer to the public key
+ * @param	Sign - Pointer to the signature
+ *
+ * @return
+ *	-	XST_SUCCESS - On success
+ *	-	Errorcode - Same as XSecure_EllipticVerifySign_64Bit
+ *
+ *****************************************************************************/
+static int XSecure_EllipticVerifySignInt(const EcdsaCrvInfo *Crv, u8 *Hash,
+	const EcdsaKey *Key, const EcdsaSign *Sign)
+{
+	volatile int Status = XST_FAILURE;
+	volatile int VerifyStatus = XST_FAILURE;
+	volatile int VerifyStatusTmp = XST_FAILURE;
+
+	XSECURE_TEMPORAL_IMPL(VerifyStatus, VerifyStatusTmp, Ecdsa_VerifySign,
+		Crv, Hash, Crv->Bits, (EcdsaKey *)Key, (EcdsaSign *)Sign);
+
+	if ((ELLIPTIC_BAD_SIGN == VerifyStatus) ||
+		(ELLIPTIC_BAD_SIGN == VerifyStatusTmp)) {
+		Status = (int)XSECURE_ELLIPTIC_BAD_SIGN;
+	}
+	else if ((ELLIPTIC_VER_SIGN_INCORRECT_HASH_LEN == VerifyStatus) ||
+		(ELLIPTIC_VER_SIGN_INCORRECT_HASH_LEN == VerifyStatusTmp)) {
+		Status = (int)XSECURE_ELLIPTIC_VER_SIGN_INCORRECT_HASH_LEN;
+	}
+	else if ((ELLIPTIC_VER_SIGN_R_ZERO == VerifyStatus) ||
+		(ELLIPTIC_VER_SIGN_R_ZERO == VerifyStatusTmp)) {
+		Status = (int)XSECURE_ELLIPTIC_VER_SIGN_R_ZERO;
+	}
+	else if ((ELLIPTIC_VER_SIGN_S_ZERO == VerifyStatus) ||
+		(ELLIPTIC_VER_SIGN_S_ZERO == VerifyStatusTmp)) {
+		Status = (int)XSECURE_ELLIPTIC_VER_SIGN_S_ZERO;
+	}
+	else if ((ELLIPTIC_VER_SIGN_R_ORDER_ERROR == VerifyStatus) ||
+		(ELLIPTIC_VER_SIGN_R_ORDER_ERROR == VerifyStatusTmp)) {
+		Status = (int)XSECURE_ELLIPTIC_VER_SIGN_R_ORDER_ERROR;
+	}
+	else if ((ELLIPTIC_VER_SIGN_S_ORDER_ERROR == VerifyStatus) ||
+		(ELLIPTIC_VER_SIGN_S_ORDER_ERROR == VerifyStatusTmp)) {
+		Status = (int)XSECURE_ELLIPTIC_VER_SIGN_S_ORDER_ERROR;
+	}
+	else if ((ELLIPTIC_SUCCESS != VerifyStatus) ||
+		(ELLIPTIC_SUCCESS != VerifyStatusTmp)) {
+		Status = XST_FAILURE;
+	}
+	else {
+		Status = XST_SUCCESS;
+	}
+
+	return Status;
+}
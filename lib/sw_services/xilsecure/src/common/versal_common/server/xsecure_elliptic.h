@@ -30,6 +30,7 @@
 * 4.6   har  07/14/21 Fixed doxygen warnings
 *       gm   07/16/21 Added support for 64-bit address
 * 5.0   kpt  07/24/22 Moved XSecure_EllipticKat into xsecure_kat.c
+*       ag   10/15/26 Added batch signature verification
 *
 * </pre>
 *
@@ -78,6 +79,11 @@ typedef struct {
 	u32 Len;		/**< Length of the hash */
 } XSecure_EllipticHashData;
 
+typedef struct {
+	XSecure_EllipticHashData HashInfo;	/**< Hash address and length */
+	XSecure_EllipticSignAddr SignAddr;	/**< Signature address */
+} XSecure_EllipticVerifyEntry;
+
 /***************************** Function Prototypes ***************************/
 int XSecure_EllipticGenerateKey(XSecure_EllipticCrvTyp CrvType, const u8* D,
 	XSecure_EllipticKey *Key);
@@ -99,6 +105,9 @@ int XSecure_EllipticValidateKey_64Bit(XSecure_EllipticCrvTyp CrvType,
 int XSecure_EllipticVerifySign_64Bit(XSecure_EllipticCrvTyp CrvType,
 	XSecure_EllipticHashData *HashInfo, XSecure_EllipticKeyAddr *KeyAddr,
 	XSecure_EllipticSignAddr *SignAddr);
+int XSecure_EllipticVerifySignBatch_64Bit(XSecure_EllipticCrvTyp CrvType,
+	XSecure_EllipticKeyAddr *KeyAddr, const XSecure_EllipticVerifyEntry *Entries,
+	u32 Count, u32 *FailIdx);
 
 #ifdef __cplusplus
 }
@@ -18,6 +18,7 @@
 * ----- ---- -------- -------------------------------------------------------
 * 5.0   am   06/13/22 Initial release
 *       kpt  07/24/22 moved XSecure_TrngKat into xsecure_katclient_plat.c
+*       ag   10/15/26 Added XSecure_BatchAddTrngGenerate
 *
 * </pre>
 *
@@ -65,3 +66,38 @@ int XSecure_TrngGenerareRandNum(XSecure_ClientInstance *InstancePtr, u64 RandBuf
 END:
 	return Status;
 }
+
+/*****************************************************************************/
+/**
+ *
+ * @brief	This function adds the request to generate random number to
+ *		the batch
+ *
+ * @param	InstancePtr - Pointer to the batch instance
+ * @param	RandBufAddr - Address of the buffer to store random number
+ * @param	Size - Size of the random number in bytes
+ *
+ * @return
+ *	-	XST_SUCCESS - On success
+ *	-	Errorcode - On failure
+ *
+ ******************************************************************************/
+int XSecure_BatchAddTrngGenerate(XSecure_BatchInstance *InstancePtr, u64 RandBufAddr, u32 Size)
+{
+	int Status = XST_FAILURE;
+	u32 Args[XSECURE_PAYLOAD_LEN_3U];
+
+	if (Size > XSECURE_TRNG_SEC_STRENGTH_IN_BYTES) {
+		goto END;
+	}
+
+	Args[0U] = (u32)RandBufAddr;
+	Args[1U] = (u32)(RandBufAddr >> 32);
+	Args[2U] = Size;
+
+	Status = XSecure_BatchAddReq(InstancePtr, XSECURE_API_TRNG_GENERATE, Args,
+		XSECURE_PAYLOAD_LEN_3U);
+
+END:
+	return Status;
+}
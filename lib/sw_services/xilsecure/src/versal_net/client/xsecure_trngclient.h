@@ -20,6 +20,7 @@
 * ----- ---- -------- -------------------------------------------------------
 * 5.0   am   06/13/22 Initial release
 *       kpt  07/24/22 moved XSecure_TrngKat into xsecure_katclient_plat.c
+*       ag   10/15/26 Added XSecure_BatchAddTrngGenerate
 *
 * </pre>
 *
@@ -38,6 +39,7 @@ extern "C" {
 #include "xil_types.h"
 #include "xsecure_mailbox.h"
 #include "xsecure_defs.h"
+#include "xsecure_batchclient.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -46,6 +48,7 @@ extern "C" {
 /************************** Function Prototypes ******************************/
 
 int XSecure_TrngGenerareRandNum(XSecure_ClientInstance *InstancePtr, u64 RandBufAddr, u32 Size);
+int XSecure_BatchAddTrngGenerate(XSecure_BatchInstance *InstancePtr, u64 RandBufAddr, u32 Size);
 
 /************************** Variable Definitions *****************************/
 
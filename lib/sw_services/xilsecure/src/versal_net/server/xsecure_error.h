@@ -32,6 +32,7 @@
  *       ma   07/08/2022 Added support for secure lockdown
  *       dc   07/13/2022 Added error codes for VersalNet
  *       kpt  07/24/2022 Added error codes for KAT
+ *       ag   10/15/2026 Added error code for TRNG pool
  *
  * </pre>
  *
@@ -181,6 +182,8 @@ typedef enum {
 							    doesn't match with expected o/p */
 	XSECURE_TRNG_WRITE_ERROR,			 /**< 0xB2 - Error occurred while writing in
 							    to the register */
+	XSECURE_TRNG_POOL_EMPTY_ERROR,			 /**< 0xB3 - Random number pool does not
+							    have enough random bytes */
 
 	XSECURE_ECC_PRVT_KEY_GEN_ERR = 0xBF, /**< = 0xBF - ECC private key generation error */
 	XSECURE_ELLIPTIC_KAT_KEY_NOTVALID_ERROR = 0xC0,   /**< 0xC0 -ECC key is not valid */
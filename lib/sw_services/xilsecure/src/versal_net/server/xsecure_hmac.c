@@ -17,6 +17,7 @@
 * ----- --- -------- -------------------------------------------------------
 * 5.0   vns 05/30/22 Initial release
 *       kpt 07/24/22 Moved XSecure_HmacKat into xsecure_kat_plat.c
+*       ag  10/15/26 Added precomputed key pads and counter mode KDF
 *
 * </pre>
 *
@@ -33,9 +34,13 @@
 #include "xil_util.h"
 
 /************************** Function Prototypes ******************************/
-static int XSecure_PreProcessKey(XSecure_Hmac *InstancePtr,
+static int XSecure_PreProcessKey(XSecure_Sha3 *Sha3InstancePtr,
 					u64 KeyAddr, u32 KeyLen, u64 KeyOut);
 static void XSecure_HmacXor(const u32 *Data, const u8 Value, u32 *Result);
+static int XSecure_HmacComputePads(XSecure_Sha3 *Sha3InstancePtr,
+					u64 KeyAddr, u32 KeyLen, u8 *IPadRes, u8 *OPadRes);
+static int XSecure_HmacOuterHash(XSecure_Sha3 *Sha3InstancePtr,
+					const u8 *OPadRes, const u8 *IntHash, u8 *Hmac);
 
 /************************** Variable Definitions *****************************/
 
@@ -68,7 +73,6 @@ int XSecure_HmacInit(XSecure_Hmac *InstancePtr,
 		XSecure_Sha3 *Sha3InstancePtr, u64 KeyAddr, u32 KeyLen)
 {
 	int Status = XST_FAILURE;
-	u8 K0[XSECURE_SHA3_BLOCK_LEN];
 
 	if ((InstancePtr == NULL) || (KeyLen == 0x0U)) {
 		Status = XSECURE_HMAC_INVALID_PARAM;
@@ -82,17 +86,11 @@ int XSecure_HmacInit(XSecure_Hmac *InstancePtr,
 
 	InstancePtr->Sha3InstPtr = Sha3InstancePtr;
 
-	Status = XSecure_PreProcessKey(InstancePtr, KeyAddr, KeyLen, (UINTPTR)K0);
+	Status = XSecure_HmacComputePads(Sha3InstancePtr, KeyAddr, KeyLen,
+				InstancePtr->IPadRes, InstancePtr->OPadRes);
 	if (Status != XST_SUCCESS) {
 		goto END;
 	}
-	/* Calculate K0 xor ipad  */
-	XSecure_HmacXor((const u32 *)K0, XSECURE_HMAC_IPAD_VALUE,
-					(u32 *)InstancePtr->IPadRes);
-
-	/* Calculate K0 Xor Opad */
-	XSecure_HmacXor((const u32 *)K0, XSECURE_HMAC_OPAD_VALUE,
-					(u32 *)InstancePtr->OPadRes);
 
 	Status = XSecure_Sha3Start(Sha3InstancePtr);
 	if (Status != XST_SUCCESS) {
@@ -108,7 +106,6 @@ END:
 		XSecure_SetReset(Sha3InstancePtr->BaseAddress,
 					XSECURE_SHA3_RESET_OFFSET);
 	}
-	(void)memset((void *)K0, (u32)0U, XSECURE_SHA3_BLOCK_LEN);
 RET:
 
 	return Status;
@@ -194,30 +191,241 @@ int XSecure_HmacFinal(XSecure_Hmac *InstancePtr, XSecure_HmacRes *Hmac)
 		goto END;
 	}
 
-	Status = XSecure_Sha3Start(Sha3InstancePtr);
+	Status = XSecure_HmacOuterHash(Sha3InstancePtr, InstancePtr->OPadRes,
+			IntHash, Hmac->Hash);
+END:
 	if (Status != XST_SUCCESS) {
+		XSecure_SetReset(InstancePtr->Sha3InstPtr->BaseAddress,
+			XSECURE_SHA3_RESET_OFFSET);
+	}
+	(void)memset((void *)InstancePtr->IPadRes, 0U, XSECURE_SHA3_BLOCK_LEN);
+	(void)memset((void *)InstancePtr->OPadRes, 0U, XSECURE_SHA3_BLOCK_LEN);
+	(void)memset((void *)IntHash, 0U, XSECURE_HASH_SIZE_IN_BYTES);
+RET:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * @brief
+ * This function precomputes the ipad and opad blocks of the provided key.
+ * The key can then be used for any number of HMACs with
+ * XSecure_HmacInitWithKey or XSecure_HmacKdfCounter, without pre processing
+ * the key again.
+ *
+ * @param	KeyPtr is the pointer to the XSecure_HmacKey to be filled
+ * @param	Sha3InstancePtr	is the pointer to the XSecure_Sha3 instance,
+ *		used when key is longer than SHA3 block length.
+ * @param	KeyAddr holds the address of HMAC key.
+ * @param	KeyLen variable holds the length of the key.
+ *
+ * @return	XST_SUCCESS if key pads are computed successfully.
+ * 		Error Code on failure.
+ *
+ * @note	Key pads are equivalent to the key, the user must call
+ *		XSecure_HmacKeyZeroize once the key is no longer required.
+ *
+ ******************************************************************************/
+int XSecure_HmacKeyInit(XSecure_HmacKey *KeyPtr,
+		XSecure_Sha3 *Sha3InstancePtr, u64 KeyAddr, u32 KeyLen)
+{
+	int Status = XST_FAILURE;
+
+	if ((KeyPtr == NULL) || (KeyLen == 0x0U)) {
+		Status = XSECURE_HMAC_INVALID_PARAM;
+		goto END;
+	}
+	if ((Sha3InstancePtr == NULL) ||
+			(Sha3InstancePtr->Sha3State == XSECURE_SHA3_UNINITIALIZED)) {
+		Status = XSECURE_HMAC_INVALID_PARAM;
 		goto END;
 	}
-	Status = XSecure_Sha3Update(Sha3InstancePtr, (UINTPTR)InstancePtr->OPadRes,
+
+	Status = XSecure_HmacComputePads(Sha3InstancePtr, KeyAddr, KeyLen,
+				KeyPtr->IPadRes, KeyPtr->OPadRes);
+	if (Status != XST_SUCCESS) {
+		XSecure_HmacKeyZeroize(KeyPtr);
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * @brief
+ * This function initializes the HMAC instance with the key pads precomputed
+ * by XSecure_HmacKeyInit.
+ *
+ * @param	InstancePtr	is the pointer to the XSecure_Hmac instance
+ * @param	Sha3InstancePtr	is the pointer to the XSecure_Sha3 instance.
+ * @param	KeyPtr is the pointer to the precomputed XSecure_HmacKey.
+ *
+ * @return	XST_SUCCESS if initialization was successful.
+ * 		Error Code on failure.
+ *
+ ******************************************************************************/
+int XSecure_HmacInitWithKey(XSecure_Hmac *InstancePtr,
+		XSecure_Sha3 *Sha3InstancePtr, const XSecure_HmacKey *KeyPtr)
+{
+	int Status = XST_FAILURE;
+
+	if ((InstancePtr == NULL) || (KeyPtr == NULL)) {
+		Status = XSECURE_HMAC_INVALID_PARAM;
+		goto RET;
+	}
+	if ((Sha3InstancePtr == NULL) ||
+			(Sha3InstancePtr->Sha3State == XSECURE_SHA3_UNINITIALIZED)) {
+		Status = XSECURE_HMAC_INVALID_PARAM;
+		goto RET;
+	}
+
+	InstancePtr->Sha3InstPtr = Sha3InstancePtr;
+	(void)memcpy((void *)InstancePtr->IPadRes, (const void *)KeyPtr->IPadRes,
+			XSECURE_SHA3_BLOCK_LEN);
+	(void)memcpy((void *)InstancePtr->OPadRes, (const void *)KeyPtr->OPadRes,
 			XSECURE_SHA3_BLOCK_LEN);
+
+	Status = XSecure_Sha3Start(Sha3InstancePtr);
 	if (Status != XST_SUCCESS) {
 		goto END;
 	}
-	Status = XSecure_Sha3Update(Sha3InstancePtr, (UINTPTR)IntHash,
-			XSECURE_HASH_SIZE_IN_BYTES);
+	Status = XSecure_Sha3Update(Sha3InstancePtr, (UINTPTR)InstancePtr->IPadRes,
+					XSECURE_SHA3_BLOCK_LEN);
+END:
 	if (Status != XST_SUCCESS) {
-		goto END;
+		(void)memset((void *)InstancePtr->IPadRes, 0U, XSECURE_SHA3_BLOCK_LEN);
+		(void)memset((void *)InstancePtr->OPadRes, 0U, XSECURE_SHA3_BLOCK_LEN);
+		/* Set SHA under reset */
+		XSecure_SetReset(Sha3InstancePtr->BaseAddress,
+					XSECURE_SHA3_RESET_OFFSET);
 	}
-	Status = XSecure_Sha3Finish(InstancePtr->Sha3InstPtr,
-			(XSecure_Sha3Hash *)Hmac->Hash);
+RET:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * @brief
+ * This function clears the precomputed key pads.
+ *
+ * @param	KeyPtr is the pointer to the XSecure_HmacKey
+ *
+ * @return	None.
+ *
+ ******************************************************************************/
+void XSecure_HmacKeyZeroize(XSecure_HmacKey *KeyPtr)
+{
+	if (KeyPtr != NULL) {
+		(void)memset((void *)KeyPtr->IPadRes, 0U, XSECURE_SHA3_BLOCK_LEN);
+		(void)memset((void *)KeyPtr->OPadRes, 0U, XSECURE_SHA3_BLOCK_LEN);
+	}
+}
+
+/*****************************************************************************/
+/**
+ *
+ * @brief
+ * This function derives key material with the NIST SP 800-108 KDF in counter
+ * mode using HMAC-SHA3-384 as PRF.
+ * K(i) = HMAC(Key, [i]_32 || FixedData), i = 1, 2, ...
+ * All the blocks are generated on the same SHA3 instance with the precomputed
+ * key pads, the key is not pre processed for every block.
+ *
+ * @param	Sha3InstancePtr	is the pointer to the XSecure_Sha3 instance.
+ * @param	KeyPtr is the pointer to the precomputed XSecure_HmacKey.
+ * @param	FixedDataAddr holds the address of the fixed input data
+ *		(Label || 0x00 || Context || [L]_32).
+ * @param	FixedDataLen is the length of the fixed input data.
+ * @param	OutAddr holds the address of the output buffer.
+ * @param	OutLen is the number of bytes to be derived.
+ *
+ * @return	XST_SUCCESS if key derivation was successful.
+ * 		Error Code on failure.
+ *
+ ******************************************************************************/
+int XSecure_HmacKdfCounter(XSecure_Sha3 *Sha3InstancePtr,
+		const XSecure_HmacKey *KeyPtr, u64 FixedDataAddr, u32 FixedDataLen,
+		u64 OutAddr, u32 OutLen)
+{
+	volatile int Status = XST_FAILURE;
+	u32 Counter = 1U;
+	u32 Offset = 0U;
+	u32 CopyLen;
+	u8 CounterBuf[XSECURE_HMAC_KDF_COUNTER_LEN];
+	u8 IntHash[XSECURE_HASH_SIZE_IN_BYTES];
+	u8 Hash[XSECURE_HASH_SIZE_IN_BYTES];
+
+	if ((KeyPtr == NULL) || (OutLen == 0x0U)) {
+		Status = XSECURE_HMAC_INVALID_PARAM;
+		goto RET;
+	}
+	if ((Sha3InstancePtr == NULL) ||
+			(Sha3InstancePtr->Sha3State == XSECURE_SHA3_UNINITIALIZED)) {
+		Status = XSECURE_HMAC_INVALID_PARAM;
+		goto RET;
+	}
+
+	while (Offset < OutLen) {
+		/* Counter is encoded as 32 bit big endian */
+		CounterBuf[0U] = (u8)(Counter >> XSECURE_HMAC_24BIT_SHIFT);
+		CounterBuf[1U] = (u8)(Counter >> XSECURE_HMAC_16BIT_SHIFT);
+		CounterBuf[2U] = (u8)(Counter >> XSECURE_HMAC_8BIT_SHIFT);
+		CounterBuf[3U] = (u8)Counter;
+
+		/* Calculate hash on IPAD || Counter || FixedData */
+		Status = XSecure_Sha3Start(Sha3InstancePtr);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+		Status = XSecure_Sha3Update(Sha3InstancePtr,
+				(UINTPTR)KeyPtr->IPadRes, XSECURE_SHA3_BLOCK_LEN);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+		Status = XSecure_Sha3Update(Sha3InstancePtr, (UINTPTR)CounterBuf,
+				XSECURE_HMAC_KDF_COUNTER_LEN);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+		if (FixedDataLen != 0x0U) {
+			Status = XSecure_Sha3Update64Bit(Sha3InstancePtr,
+					FixedDataAddr, FixedDataLen);
+			if (Status != XST_SUCCESS) {
+				goto END;
+			}
+		}
+		Status = XSecure_Sha3Finish(Sha3InstancePtr,
+				(XSecure_Sha3Hash *)IntHash);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+
+		Status = XSecure_HmacOuterHash(Sha3InstancePtr, KeyPtr->OPadRes,
+				IntHash, Hash);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+
+		CopyLen = OutLen - Offset;
+		if (CopyLen > XSECURE_HASH_SIZE_IN_BYTES) {
+			CopyLen = XSECURE_HASH_SIZE_IN_BYTES;
+		}
+		XSecure_MemCpy64(OutAddr + Offset, (u64)(UINTPTR)Hash, CopyLen);
+		Offset += CopyLen;
+		Counter++;
+	}
+
 END:
 	if (Status != XST_SUCCESS) {
-		XSecure_SetReset(InstancePtr->Sha3InstPtr->BaseAddress,
+		XSecure_SetReset(Sha3InstancePtr->BaseAddress,
 			XSECURE_SHA3_RESET_OFFSET);
 	}
-	(void)memset((void *)InstancePtr->IPadRes, 0U, XSECURE_SHA3_BLOCK_LEN);
-	(void)memset((void *)InstancePtr->OPadRes, 0U, XSECURE_SHA3_BLOCK_LEN);
 	(void)memset((void *)IntHash, 0U, XSECURE_HASH_SIZE_IN_BYTES);
+	(void)memset((void *)Hash, 0U, XSECURE_HASH_SIZE_IN_BYTES);
 RET:
 	return Status;
 }
@@ -229,7 +437,7 @@ RET:
  * This function pre process the key to SHA3 block length and the final key is
  * been stored into the K0 array.
  *
- * @param	InstancePtr	is the pointer to the XSecure_Hmac instance
+ * @param	Sha3InstancePtr	is the pointer to the XSecure_Sha3 instance
  * @param	Key is the variable which holds the key for HMAC
  * @param	KeyLen variable holds the length of the key
  * @param	KeyOut is the variable which holds the output key buffer's address
@@ -238,7 +446,7 @@ RET:
  *		Error Code on failure.
  *
  ******************************************************************************/
-static int XSecure_PreProcessKey(XSecure_Hmac *InstancePtr,
+static int XSecure_PreProcessKey(XSecure_Sha3 *Sha3InstancePtr,
 		u64 KeyAddr, u32 KeyLen, u64 KeyOut)
 {
 	int Status = XST_FAILURE;
@@ -267,7 +475,7 @@ static int XSecure_PreProcessKey(XSecure_Hmac *InstancePtr,
 		 * Calculate hash on key and append with zero to
 		 * make K0 to the length of SHA3 Block length
 		 */
-		 Status = XSecure_Sha3Digest(InstancePtr->Sha3InstPtr,
+		 Status = XSecure_Sha3Digest(Sha3InstancePtr,
 			(UINTPTR)KeyAddr, KeyLen, (XSecure_Sha3Hash *)K0);
 		if (Status != XST_SUCCESS) {
 			goto END;
@@ -317,3 +525,87 @@ static void XSecure_HmacXor(const u32 *Data, const u8 Value, u32 *Result)
 	}
 }
 
+
+/*****************************************************************************/
+/**
+ *
+ * @brief
+ * This function pre processes the key and computes K0 xor ipad and
+ * K0 xor opad.
+ *
+ * @param	Sha3InstancePtr	is the pointer to the XSecure_Sha3 instance
+ * @param	KeyAddr holds the address of HMAC key
+ * @param	KeyLen variable holds the length of the key
+ * @param	IPadRes is the pointer of SHA3 block length array which is
+ *		updated with K0 xor ipad
+ * @param	OPadRes is the pointer of SHA3 block length array which is
+ *		updated with K0 xor opad
+ *
+ * @return	XST_SUCCESS if pads are computed successfully.
+ *		Error Code on failure.
+ *
+ ******************************************************************************/
+static int XSecure_HmacComputePads(XSecure_Sha3 *Sha3InstancePtr,
+		u64 KeyAddr, u32 KeyLen, u8 *IPadRes, u8 *OPadRes)
+{
+	int Status = XST_FAILURE;
+	u8 K0[XSECURE_SHA3_BLOCK_LEN];
+
+	Status = XSecure_PreProcessKey(Sha3InstancePtr, KeyAddr, KeyLen,
+			(UINTPTR)K0);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	/* Calculate K0 xor ipad  */
+	XSecure_HmacXor((const u32 *)K0, XSECURE_HMAC_IPAD_VALUE,
+					(u32 *)IPadRes);
+
+	/* Calculate K0 Xor Opad */
+	XSecure_HmacXor((const u32 *)K0, XSECURE_HMAC_OPAD_VALUE,
+					(u32 *)OPadRes);
+
+END:
+	(void)memset((void *)K0, (u32)0U, XSECURE_SHA3_BLOCK_LEN);
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * @brief
+ * This function calculates the outer hash of HMAC on OPAD || inner hash.
+ *
+ * @param	Sha3InstancePtr	is the pointer to the XSecure_Sha3 instance
+ * @param	OPadRes is the pointer to K0 xor opad
+ * @param	IntHash is the pointer to the inner hash
+ * @param	Hmac is the pointer of 48 bytes which holds the resultant HMAC
+ *
+ * @return	XST_SUCCESS if hash calculation was successful.
+ *		Error Code on failure.
+ *
+ ******************************************************************************/
+static int XSecure_HmacOuterHash(XSecure_Sha3 *Sha3InstancePtr,
+		const u8 *OPadRes, const u8 *IntHash, u8 *Hmac)
+{
+	int Status = XST_FAILURE;
+
+	Status = XSecure_Sha3Start(Sha3InstancePtr);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	Status = XSecure_Sha3Update(Sha3InstancePtr, (UINTPTR)OPadRes,
+			XSECURE_SHA3_BLOCK_LEN);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	Status = XSecure_Sha3Update(Sha3InstancePtr, (UINTPTR)IntHash,
+			XSECURE_HASH_SIZE_IN_BYTES);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	Status = XSecure_Sha3Finish(Sha3InstancePtr, (XSecure_Sha3Hash *)Hmac);
+
+END:
+	return Status;
+}
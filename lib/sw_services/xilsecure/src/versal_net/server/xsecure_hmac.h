@@ -17,6 +17,7 @@
 * ----- ---- -------- -------------------------------------------------------
 * 5.0   vns 05/30/22 Initial release
 *       kpt 07/24/22 Moved XSecure_HmacKat into xsecure_kat_plat.c
+*       ag  10/15/26 Added precomputed key pads and counter mode KDF
 *
 * </pre>
 *
@@ -35,6 +36,7 @@ extern "C" {
 #include "xsecure_sha.h"
 
 /************************** Constant Definitions ****************************/
+#define XSECURE_HMAC_KDF_COUNTER_LEN	(4U) /**< Length of KDF counter */
 
 /************************** Type Definitions ********************************/
 
@@ -48,12 +50,31 @@ typedef struct {
 	u8 OPadRes[XSECURE_SHA3_BLOCK_LEN];
 } XSecure_Hmac;
 
+/**
+ * Key pads precomputed once per key, so that HMACs with the same key skip
+ * the key pre processing
+ */
+typedef struct {
+	u8 IPadRes[XSECURE_SHA3_BLOCK_LEN]; /**< K0 xor ipad */
+	u8 OPadRes[XSECURE_SHA3_BLOCK_LEN]; /**< K0 xor opad */
+} XSecure_HmacKey;
+
 /************************** Function Prototypes ******************************/
 int XSecure_HmacInit(XSecure_Hmac *InstancePtr,
 					XSecure_Sha3 *Sha3InstancePtr,
 					u64 KeyAddr, u32 KeyLen);
 int XSecure_HmacUpdate(XSecure_Hmac *InstancePtr, u64 DataAddr, u32 Len);
 int XSecure_HmacFinal(XSecure_Hmac *InstancePtr, XSecure_HmacRes *Hmac);
+int XSecure_HmacKeyInit(XSecure_HmacKey *KeyPtr,
+					XSecure_Sha3 *Sha3InstancePtr,
+					u64 KeyAddr, u32 KeyLen);
+int XSecure_HmacInitWithKey(XSecure_Hmac *InstancePtr,
+					XSecure_Sha3 *Sha3InstancePtr,
+					const XSecure_HmacKey *KeyPtr);
+void XSecure_HmacKeyZeroize(XSecure_HmacKey *KeyPtr);
+int XSecure_HmacKdfCounter(XSecure_Sha3 *Sha3InstancePtr,
+					const XSecure_HmacKey *KeyPtr, u64 FixedDataAddr,
+					u32 FixedDataLen, u64 OutAddr, u32 OutLen);
 
 #ifdef __cplusplus
 extern "C" }
@@ -21,6 +21,7 @@
 *       dc   07/13/22 Modified XSECURE_TRNG_DF_MIN_LENGTH to 2
 *       kpt  08/03/22 Added volatile keyword to avoid compiler optimization of loop redundancy checks
 *       dc   09/04/22 Add an API to set HRNG mode
+*       ag   10/15/26 Added random number pool served ahead of generate
 *
 * </pre>
 *
@@ -58,6 +59,12 @@
 #define XSECURE_TRNG_DF_2CLKS_WAIT			4U /** < delay after 1byte */
 #define XSECURE_TRNG_STATUS_QCNT_VAL			4U /** < QCNT value for single burst */
 
+/**************************** Type Definitions *******************************/
+typedef struct {
+	u8 Buf[XSECURE_TRNG_POOL_SIZE_IN_BYTES];	/**< Random bytes, consumed from the top */
+	u32 Level;					/**< Number of random bytes available */
+} XSecure_TrngPool;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 /************************** Function Prototypes ******************************/
 static int XSecure_TrngReseedInternal(XSecure_TrngInstance *InstancePtr, const u8 *Seed, u8 DLen,
@@ -80,6 +87,10 @@ static void XSecure_TrngCfgDfLen(u8 DfLen);
 static void XSecure_TrngCfgAdaptPropTestCutoff(u16 AdaptPropTestCutoff);
 static void XSecure_TrngCfgRepCountTestCutoff(u16 RepCountTestCutoff);
 static void XSecure_TrngCfgDIT(u8 DITValue);
+static int XSecure_TrngPoolClear(void);
+
+/************************** Variable Definitions *****************************/
+static XSecure_TrngPool TrngPool;
 
 /**************************************************************************************************/
 /**
@@ -591,6 +602,13 @@ int XSecure_TrngUninstantiate(XSecure_TrngInstance *InstancePtr) {
 		goto END;
 	}
 
+	/* Random bytes of the old instance must not be served any more */
+	Status = XSecure_TrngPoolClear();
+	if (Status != XST_SUCCESS) {
+		Status = XSECURE_TRNG_MEMSET_UNINSTANTIATE_ERROR;
+		goto END;
+	}
+
 	/* Bring cores in to reset state */
 	XSecure_TrngReset();
 	XSecure_TrngPrngReset();
@@ -633,6 +651,122 @@ XSecure_TrngInstance *XSecure_GetTrngInstance(void)
 	return &TrngInstance;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function fills the random number pool with the random numbers
+ *		generated by the TRNG
+ *
+ * @param	InstancePtr Pointer to XSecure_TrngInstance
+ * @param	MaxBlocks Maximum number of generate operations to be done, this
+ *		bounds the time spent in one call
+ *
+ * @return
+ * 		- XST_SUCCESS On success or if the pool is already full
+ * 		- XSECURE_TRNG_INVALID_PARAM If invalid parameter(s) passed to this function
+ * 		- XSECURE_TRNG_INVALID_MODE If TRNG is not in HRNG mode
+ * 		- Errorcode On generate failure
+ *
+ *****************************************************************************/
+int XSecure_TrngPoolFill(XSecure_TrngInstance *InstancePtr, u32 MaxBlocks)
+{
+	volatile int Status = XST_FAILURE;
+	u32 Blocks = 0U;
+
+	if (InstancePtr == NULL) {
+		Status = XSECURE_TRNG_INVALID_PARAM;
+		goto END;
+	}
+
+	/* Only HRNG output is pooled, DRNG output is deterministic per seed */
+	if (InstancePtr->UserCfg.Mode != XSECURE_TRNG_HRNG_MODE) {
+		Status = XSECURE_TRNG_INVALID_MODE;
+		goto END;
+	}
+
+	Status = XST_SUCCESS;
+	while ((Blocks < MaxBlocks) && ((TrngPool.Level +
+		XSECURE_TRNG_SEC_STRENGTH_IN_BYTES) <= XSECURE_TRNG_POOL_SIZE_IN_BYTES)) {
+		Status = XST_FAILURE;
+		Status = XSecure_TrngGenerate(InstancePtr, &TrngPool.Buf[TrngPool.Level],
+			XSECURE_TRNG_SEC_STRENGTH_IN_BYTES);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+		TrngPool.Level += XSECURE_TRNG_SEC_STRENGTH_IN_BYTES;
+		Blocks++;
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function serves random numbers from the random number pool.
+ *		The served bytes are removed from the pool and zeroized.
+ *
+ * @param	InstancePtr Pointer to XSecure_TrngInstance which filled the pool
+ * @param	RandBuf Pointer to buffer in which random data is stored
+ * @param	RandBufSize Size of the buffer in which random data is stored
+ *
+ * @return
+ * 		- XST_SUCCESS On success
+ * 		- XSECURE_TRNG_INVALID_PARAM If invalid parameter(s) passed to this function
+ * 		- XSECURE_TRNG_INVALID_BUF_SIZE If buffer size is not valid for generate
+ * 		- XSECURE_TRNG_UNHEALTHY_STATE If TRNG is not healthy
+ * 		- XSECURE_TRNG_POOL_EMPTY_ERROR If pool does not have enough random bytes
+ *
+ *****************************************************************************/
+int XSecure_TrngPoolGet(const XSecure_TrngInstance *InstancePtr, u8 *RandBuf, u32 RandBufSize)
+{
+	volatile int Status = XST_FAILURE;
+
+	if ((InstancePtr == NULL) || (RandBuf == NULL)) {
+		Status = XSECURE_TRNG_INVALID_PARAM;
+		goto END;
+	}
+
+	if ((RandBufSize == 0U) || (RandBufSize > XSECURE_TRNG_SEC_STRENGTH_IN_BYTES) ||
+		((RandBufSize % XSECURE_TRNG_WORD_LEN_IN_BYTES) != 0U)) {
+		Status = XSECURE_TRNG_INVALID_BUF_SIZE;
+		goto END;
+	}
+
+	if (InstancePtr->ErrorState != XSECURE_TRNG_HEALTHY) {
+		Status = XSECURE_TRNG_UNHEALTHY_STATE;
+		goto END;
+	}
+
+	if (TrngPool.Level < RandBufSize) {
+		Status = XSECURE_TRNG_POOL_EMPTY_ERROR;
+		goto END;
+	}
+
+	TrngPool.Level -= RandBufSize;
+	Status = Xil_SMemCpy(RandBuf, RandBufSize, &TrngPool.Buf[TrngPool.Level],
+		RandBufSize, RandBufSize);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	Status = Xil_SecureZeroize(&TrngPool.Buf[TrngPool.Level], RandBufSize);
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function returns the number of random bytes available in the
+ *		random number pool
+ *
+ * @return	Number of random bytes in the pool
+ *
+ *****************************************************************************/
+u32 XSecure_TrngPoolGetLevel(void)
+{
+	return TrngPool.Level;
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function sets the TRNG into HRNG mode of operation.
@@ -962,3 +1096,19 @@ static inline int XSecure_TrngWaitForEvent(u32 Addr, u32 EventMask, u32 Event,
 {
 	return (int)Xil_WaitForEvent(Addr, EventMask, Event, Timeout);
 }
+
+/*****************************************************************************/
+/**
+ * @brief	This function zeroizes the random number pool
+ *
+ * @return
+ * 		- XST_SUCCESS On success
+ * 		- XST_FAILURE If zeroization fails
+ *
+ *****************************************************************************/
+static int XSecure_TrngPoolClear(void)
+{
+	TrngPool.Level = 0U;
+
+	return Xil_SecureZeroize(TrngPool.Buf, XSECURE_TRNG_POOL_SIZE_IN_BYTES);
+}
@@ -23,6 +23,7 @@
 * 5.0   kpt  05/05/22 Initial release
 *       dc   07/12/22 Corrected comments
 *       kpt  07/24/22 Moved KAT related code to xsecure_kat_plat.c
+*       ag   10/15/26 Added random number pool
 *
 * </pre>
 *
@@ -60,6 +61,14 @@ extern "C" {
 #define XSECURE_TRNG_USER_CFG_REP_TEST_CUTOFF 33U
 #endif
 
+#if !defined(XSECURE_TRNG_POOL_SIZE_IN_BYTES)
+#define XSECURE_TRNG_POOL_SIZE_IN_BYTES 256U	/**< Random number pool size, multiple of 32 */
+#endif
+
+#if !defined(XSECURE_TRNG_POOL_WATERMARK_IN_BYTES)
+#define XSECURE_TRNG_POOL_WATERMARK_IN_BYTES 128U	/**< Pool is refilled below this level */
+#endif
+
 /**************************** Type Definitions *******************************/
 typedef enum {
 	XSECURE_TRNG_DRNG_MODE = 1,
@@ -109,6 +118,9 @@ int XSecure_TrngGenerate(XSecure_TrngInstance *InstancePtr, u8 *RandBuf, u32 Ran
 int XSecure_TrngUninstantiate(XSecure_TrngInstance *InstancePtr);
 XSecure_TrngInstance *XSecure_GetTrngInstance(void);
 int XSecure_TrngSetHrngMode(void);
+int XSecure_TrngPoolFill(XSecure_TrngInstance *InstancePtr, u32 MaxBlocks);
+int XSecure_TrngPoolGet(const XSecure_TrngInstance *InstancePtr, u8 *RandBuf, u32 RandBufSize);
+u32 XSecure_TrngPoolGetLevel(void);
 
 #ifdef __cplusplus
 }
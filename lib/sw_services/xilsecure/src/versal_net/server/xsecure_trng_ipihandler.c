@@ -19,6 +19,8 @@
 * ----- ---- -------- -------------------------------------------------------
 * 5.0   kpt  05/15/2022 Initial release
 *       kpt  07/24/2022 Moved XSecure_TrngKat to xsecure_kat_plat.c
+*       ag   10/15/2026 Serve requests from random number pool and refill
+*                       it from a scheduler task
 *
 * </pre>
 *
@@ -34,12 +36,23 @@
 #include "xsecure_trng_ipihandler.h"
 #include "xil_util.h"
 #include "xsecure_init.h"
+#include "xplmi_modules.h"
+#include "xplmi_scheduler.h"
 
 /************************** Constant Definitions *****************************/
+#define XSECURE_TRNG_POOL_REFILL_DELAY_MS	(1U)	/**< Refill task delay, lets the
+							  IPI response go first */
+#define XSECURE_TRNG_POOL_REFILL_BLOCKS		(2U)	/**< Generate operations per refill
+							  task run */
 
 /************************** Function Prototypes *****************************/
 static int XSecure_TrngGenerateRandNum(u32 SrcAddrLow, u32 SrcAddrHigh, u32 Size);
 static int XSecure_TrngSetOperationalMode(XSecure_TrngInstance *TrngInstance);
+static void XSecure_TrngPoolScheduleRefill(u32 Watermark);
+static int XSecure_TrngPoolRefillTask(void *Data);
+
+/************************** Variable Definitions *****************************/
+static u8 TrngPoolRefillScheduled = (u8)FALSE;
 
 /*****************************************************************************/
 /**
@@ -98,12 +111,17 @@ static int XSecure_TrngGenerateRandNum(u32 SrcAddrLow, u32 SrcAddrHigh, u32 Size
 		}
 	}
 
-	Status = XSecure_TrngGenerate(TrngInstance, RandBuf, Size);
+	/* Serve from the pool, generate only when the pool has run dry */
+	Status = XSecure_TrngPoolGet(TrngInstance, RandBuf, Size);
 	if (Status != XST_SUCCESS) {
-		goto END;
+		Status = XSecure_TrngGenerate(TrngInstance, RandBuf, Size);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
 	}
 
 	Status = XPlmi_DmaXfr((u64)(UINTPTR)&RandBuf, RandAddr, Size, XPLMI_PMCDMA_0);
+	XSecure_TrngPoolScheduleRefill(XSECURE_TRNG_POOL_WATERMARK_IN_BYTES);
 
 END:
 	return Status;
@@ -143,3 +161,74 @@ static int XSecure_TrngSetOperationalMode(XSecure_TrngInstance *TrngInstance)
 END:
 	return Status;
 }
+
+/*****************************************************************************/
+/**
+ * @brief       This function schedules the pool refill task if the random
+ *              number pool is below the watermark
+ *
+ * @param	Watermark	Pool level in bytes below which refill is needed
+ *
+ ******************************************************************************/
+static void XSecure_TrngPoolScheduleRefill(u32 Watermark)
+{
+	int Status = XST_FAILURE;
+
+	if ((TrngPoolRefillScheduled == (u8)TRUE) ||
+		(XSecure_TrngPoolGetLevel() >= Watermark)) {
+		goto END;
+	}
+
+	Status = XPlmi_SchedulerAddTask(XPLMI_MODULE_XILSECURE_ID,
+		XSecure_TrngPoolRefillTask, NULL, XSECURE_TRNG_POOL_REFILL_DELAY_MS,
+		XPLM_TASK_PRIORITY_1, NULL, XPLMI_NON_PERIODIC_TASK);
+	if (Status == XST_SUCCESS) {
+		TrngPoolRefillScheduled = (u8)TRUE;
+	}
+
+END:
+	return;
+}
+
+/*****************************************************************************/
+/**
+ * @brief       This function is the scheduler task which refills the random
+ *              number pool. Each run is limited to few generate operations
+ *              and the task reschedules itself until the pool is full.
+ *
+ * @param	Data	Not used
+ *
+ * @return	- XST_SUCCESS - If the refill is successful or not possible
+ * 		  in the current TRNG mode
+ * 		- ErrorCode - If there is a failure
+ *
+ ******************************************************************************/
+static int XSecure_TrngPoolRefillTask(void *Data)
+{
+	volatile int Status = XST_FAILURE;
+	XSecure_TrngInstance *TrngInstance = XSecure_GetTrngInstance();
+	(void)Data;
+
+	TrngPoolRefillScheduled = (u8)FALSE;
+
+	/* TRNG may be used in another mode by KAT or ECDSA key generation */
+	if ((TrngInstance->UserCfg.Mode != XSECURE_TRNG_HRNG_MODE) ||
+		(TrngInstance->ErrorState != XSECURE_TRNG_HEALTHY) ||
+		((TrngInstance->State != XSECURE_TRNG_RESEED_STATE) &&
+		(TrngInstance->State != XSECURE_TRNG_GENERATE_STATE))) {
+		Status = XST_SUCCESS;
+		goto END;
+	}
+
+	Status = XSecure_TrngPoolFill(TrngInstance, XSECURE_TRNG_POOL_REFILL_BLOCKS);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	/* Continue until no more generate output fits in to the pool */
+	XSecure_TrngPoolScheduleRefill(XSECURE_TRNG_POOL_SIZE_IN_BYTES -
+		XSECURE_TRNG_SEC_STRENGTH_IN_BYTES + 1U);
+
+END:
+	return Status;
+}
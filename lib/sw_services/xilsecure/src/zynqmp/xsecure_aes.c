@@ -58,6 +58,8 @@
 * 4.7   am  11/26/21 Resolved doxygen warnings
 *       am  12/14/21 Fixed input validation of InstancePtr in
 *                    XSecure_AesChunkDecrypt function
+* 4.9   ag  10/14/26 Added streaming mode in which encrypt and decrypt
+*                    updates return without waiting for the source DMA
 *
 * </pre>
 *
@@ -106,6 +108,7 @@ static s32 XSecure_ReadNPassChunkToAes(XSecure_Aes *InstancePtr, const u8* SrcAd
 	const u8* DestAddr, u32 Length, u8 EnLastFlag);
 static s32 XSecure_PassChunkToAes(XCsuDma *InstancePtr, const u8* SrcAddr,
 	u32 Length, u8 EnLastFlag);
+static u32 XSecure_AesWaitForSrcDma(XSecure_Aes *InstancePtr);
 
 /************************** Function Definitions *****************************/
 
@@ -165,6 +168,8 @@ s32 XSecure_AesInitialize(XSecure_Aes *InstancePtr, XCsuDma *CsuDmaPtr,
 	InstancePtr->Iv = IvPtr;
 	InstancePtr->Key = KeyPtr;
 	InstancePtr->IsChunkingEnabled = XSECURE_CSU_AES_CHUNKING_DISABLED;
+	InstancePtr->IsStreamingEnabled = XSECURE_CSU_AES_STREAMING_DISABLED;
+	InstancePtr->IsSrcDmaPending = FALSE;
 	InstancePtr->AesState = XSECURE_AES_INITIALIZED;
 #ifdef XSECURE_TPM_ENABLE
 	InstancePtr->IsPlDecryptToMemEnabled = XSECURE_PL_DEC_TO_MEM_DISABLED;
@@ -273,6 +278,8 @@ u32 XSecure_AesEncryptInit(XSecure_Aes *InstancePtr, u8 *EncData, u32 Size)
 
 	/* Update the size of data */
 	InstancePtr->SizeofData = Size;
+	InstancePtr->Destination = EncData;
+	InstancePtr->IsSrcDmaPending = FALSE;
 	InstancePtr->AesState = XSECURE_AES_ENCRYPT_INITIALIZED;
 END:
 	if (Status != (u32)XST_SUCCESS) {
@@ -322,20 +329,28 @@ u32 XSecure_AesEncryptUpdate(XSecure_Aes *InstancePtr, const u8 *Data, u32 Size)
 	if (Size == InstancePtr->SizeofData) {
 		IsFinal = TRUE;
 	}
+
+	/* Wait for Src DMA of previous update in streaming mode */
+	Status = XSecure_AesWaitForSrcDma(InstancePtr);
+	if (Status != (u32)XST_SUCCESS) {
+		goto END;
+	}
+
 	XCsuDma_Transfer(InstancePtr->CsuDmaPtr, XCSUDMA_SRC_CHANNEL,
 				(UINTPTR) Data,	Size/4U, IsFinal);
+	InstancePtr->IsSrcDmaPending = TRUE;
+	if ((IsFinal != TRUE) && (InstancePtr->IsStreamingEnabled ==
+			XSECURE_CSU_AES_STREAMING_ENABLED)) {
+		InstancePtr->SizeofData = InstancePtr->SizeofData - Size;
+		goto END;
+	}
 
 	/* Wait for Src DMA done. */
-	Status = XCsuDma_WaitForDoneTimeout(InstancePtr->CsuDmaPtr,
-						XCSUDMA_SRC_CHANNEL);
+	Status = XSecure_AesWaitForSrcDma(InstancePtr);
 	if (Status != (u32)XST_SUCCESS) {
 		goto END;
 	}
 
-	/* Acknowledge the transfer has completed */
-	XCsuDma_IntrClear(InstancePtr->CsuDmaPtr, XCSUDMA_SRC_CHANNEL,
-						XCSUDMA_IXR_DONE_MASK);
-
 
 	if (IsFinal == TRUE) {
 		/* Wait for Dst DMA done. */
@@ -367,6 +382,7 @@ u32 XSecure_AesEncryptUpdate(XSecure_Aes *InstancePtr, const u8 *Data, u32 Size)
 	Status = (u32)XST_SUCCESS;
 END:
 	if ((IsFinal == TRUE) || (Status != (u32)XST_SUCCESS)) {
+		InstancePtr->IsSrcDmaPending = FALSE;
 		KeyClearStatus = XSecure_AesKeyZero(InstancePtr);
 		if (KeyClearStatus != (u32)XST_SUCCESS) {
 			Status = Status | KeyClearStatus;
@@ -531,6 +547,7 @@ u32 XSecure_AesDecryptInit(XSecure_Aes *InstancePtr, u8 * DecData,
 	InstancePtr->SizeofData = Size;
 	InstancePtr->TotalSizeOfData = Size;
 	InstancePtr->Destination = DecData;
+	InstancePtr->IsSrcDmaPending = FALSE;
 	InstancePtr->AesState = XSECURE_AES_DECRYPT_INITIALIZED;
 END:
 	if (Status != (u32)XST_SUCCESS) {
@@ -591,25 +608,28 @@ s32 XSecure_AesDecryptUpdate(XSecure_Aes *InstancePtr, u8 *EncData, u32 Size)
 		IsFinalUpdate = TRUE;
 	}
 
+	/* Wait for Src DMA of previous update in streaming mode */
+	GcmStatus = XSecure_AesWaitForSrcDma(InstancePtr);
+	if (GcmStatus != (u32)XST_SUCCESS) {
+		goto END;
+	}
+
 	XCsuDma_Transfer(InstancePtr->CsuDmaPtr,
 				XCSUDMA_SRC_CHANNEL,
 				(UINTPTR)EncData, Size/4U, IsFinalUpdate);
-	/* Wait for the Src DMA completion. */
-	GcmStatus = XCsuDma_WaitForDoneTimeout(InstancePtr->CsuDmaPtr,
-						XCSUDMA_SRC_CHANNEL);
-	if (GcmStatus != (u32)XST_SUCCESS) {
+	InstancePtr->IsSrcDmaPending = TRUE;
+	if ((IsFinalUpdate != TRUE) && (InstancePtr->IsStreamingEnabled ==
+			XSECURE_CSU_AES_STREAMING_ENABLED)) {
+		InstancePtr->SizeofData = InstancePtr->SizeofData - Size;
 		goto END;
 	}
 
-	if (InstancePtr->Destination ==
-			(u8 *)XSECURE_DESTINATION_PCAP_ADDR) {
-		XSecure_PcapWaitForDone();
+	/* Wait for the Src DMA completion. */
+	GcmStatus = XSecure_AesWaitForSrcDma(InstancePtr);
+	if (GcmStatus != (u32)XST_SUCCESS) {
+		goto END;
 	}
 
-	/* Acknowledge the transfer has completed */
-	XCsuDma_IntrClear(InstancePtr->CsuDmaPtr, XCSUDMA_SRC_CHANNEL,
-							XCSUDMA_IXR_DONE_MASK);
-
 	/* If this is the last update for the data */
 	if (IsFinalUpdate == TRUE) {
 		XCsuDma_Transfer(InstancePtr->CsuDmaPtr, XCSUDMA_SRC_CHANNEL,
@@ -678,6 +698,7 @@ END:
 	 */
 	if(((IsFinalUpdate == TRUE) && (NextBlkLen == 0U)) ||
 		(GcmStatus != (u32)XST_SUCCESS)) {
+		InstancePtr->IsSrcDmaPending = FALSE;
 		KeyClearStatus = XSecure_AesKeyZero(InstancePtr);
 		if (KeyClearStatus != (u32)XST_SUCCESS) {
 			GcmStatus = GcmStatus | KeyClearStatus;
@@ -835,6 +856,36 @@ void XSecure_AesSetChunkConfig(XSecure_Aes *InstancePtr, u8 *ReadBuffer,
 	InstancePtr->DeviceCopy = DeviceCopy;
 }
 
+/*****************************************************************************/
+/**
+ * @brief
+ * This function enables or disables streaming mode. In streaming mode,
+ * XSecure_AesEncryptUpdate and XSecure_AesDecryptUpdate start the CSU DMA
+ * transfer of the data and return without waiting for it, except for the
+ * final update. The next update waits for the transfer of the previous one
+ * before starting its own, so the caller can prepare the next buffer while
+ * the AES engine processes the current one. The SSS routing and the
+ * destination DMA are configured once in the init call for all updates.
+ *
+ * @param	InstancePtr 	Pointer to the XSecure_Aes instance.
+ * @param	Streaming 	Used to enable or disable streaming mode.
+ *
+ * @return	None
+ *
+ * @note	In streaming mode, the buffer passed to an update must not be
+ *		modified until the next update call returns. Source and
+ *		destination buffers can be the same for in-place operation.
+ *
+ ******************************************************************************/
+void XSecure_AesSetStreaming(XSecure_Aes *InstancePtr, u8 Streaming)
+{
+	/* Assert validates the input arguments */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(InstancePtr->IsSrcDmaPending != TRUE);
+
+	InstancePtr->IsStreamingEnabled = Streaming;
+}
+
 /*****************************************************************************/
 /**
  * @brief
@@ -1746,3 +1797,44 @@ static s32 XSecure_PassChunkToAes(XCsuDma *InstancePtr, const u8* SrcAddr,
 END:
 	return Status;
 }
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function waits for the source DMA transfer of the previous update to
+ * complete, if it is in progress.
+ *
+ * @param	InstancePtr	Pointer to the XSecure_Aes instance.
+ *
+ * @return	XST_SUCCESS if no transfer is pending or the transfer is complete
+ *		XST_FAILURE if a timeout has occurred
+ *
+ ******************************************************************************/
+static u32 XSecure_AesWaitForSrcDma(XSecure_Aes *InstancePtr)
+{
+	u32 Status = (u32)XST_FAILURE;
+
+	if (InstancePtr->IsSrcDmaPending != TRUE) {
+		Status = (u32)XST_SUCCESS;
+		goto END;
+	}
+
+	Status = XCsuDma_WaitForDoneTimeout(InstancePtr->CsuDmaPtr,
+						XCSUDMA_SRC_CHANNEL);
+	if (Status != (u32)XST_SUCCESS) {
+		goto END;
+	}
+
+	if (InstancePtr->Destination ==
+			(u8 *)XSECURE_DESTINATION_PCAP_ADDR) {
+		XSecure_PcapWaitForDone();
+	}
+
+	/* Acknowledge the transfer has completed */
+	XCsuDma_IntrClear(InstancePtr->CsuDmaPtr, XCSUDMA_SRC_CHANNEL,
+				XCSUDMA_IXR_DONE_MASK);
+	InstancePtr->IsSrcDmaPending = FALSE;
+
+END:
+	return Status;
+}
@@ -69,6 +69,7 @@
 *       ana  10/15/20 Updated doxygen tags
 * 4.5   bsv  04/01/21 Added support to encrypt bitstream to memory in chunks
 *                     and then write to PCAP
+* 4.9   ag   10/14/26 Added streaming mode for encrypt and decrypt updates
 *
 * </pre>
 * @endcond
@@ -114,6 +115,9 @@ extern "C" {
 #define XSECURE_CSU_AES_CHUNKING_DISABLED (0x0U)
 #define XSECURE_CSU_AES_CHUNKING_ENABLED (0x1U)
 
+#define XSECURE_CSU_AES_STREAMING_DISABLED (0x0U)
+#define XSECURE_CSU_AES_STREAMING_ENABLED (0x1U)
+
 #ifdef XSECURE_TPM_ENABLE
 #define XSECURE_PL_DEC_TO_MEM_DISABLED		(0x0U)
 #define XSECURE_PL_DEC_TO_MEM_ENABLED		(0x1U)
@@ -215,6 +219,8 @@ typedef struct {
 	u32 SizeofData; /**< Size of Data to be encrypted or decrypted */
 	u8  *Destination; /**< Destination for decrypted/encrypted data */
 	u32 TotalSizeOfData; /**< Total size of the data */
+	u8 IsStreamingEnabled; /**< Non blocking updates enabled/disabled */
+	u8 IsSrcDmaPending; /**< Source DMA of previous update in progress */
 	XSecure_Sss SssInstance;
 	XSecure_AesState AesState; /**< Current Aes State  */
 } XSecure_Aes;
@@ -283,6 +289,9 @@ void XSecure_AesSetChunkConfig(XSecure_Aes *InstancePtr, u8 *ReadBuffer,
 /* Zerioze the Aes key */
 u32 XSecure_AesKeyZero(XSecure_Aes *InstancePtr);
 
+/* Enable/Disable non blocking updates */
+void XSecure_AesSetStreaming(XSecure_Aes *InstancePtr, u8 Streaming);
+
 /** @}
 @endcond */
 
@@ -51,6 +51,7 @@
 * 4.6   kal  08/11/21 Added EXPORT CONTROL eFuse check in Sha3Initialize
 *       am   09/17/21 Resolved compiler warnings
 * 4.7   am   11/26/21 Resolved doxygen warnings
+* 4.9   ag   10/14/26 Added scatter gather and asynchronous update APIs
 *
 * @note
 *
@@ -101,10 +102,15 @@ inline u32 XSecure_Sha3WaitForDone(XSecure_Sha3 *InstancePtr)
 
 /************************** Function Prototypes ******************************/
 
+static u32 XSecure_Sha3DmaStart(XSecure_Sha3 *InstancePtr, const u8 *Data,
+						const u32 Size, u8 IsLast);
+static u32 XSecure_Sha3DmaWait(const XSecure_Sha3 *InstancePtr);
 static u32 XSecure_Sha3DmaTransfer(XSecure_Sha3 *InstancePtr, const u8 *Data,
 						const u32 Size, u8 IsLast);
 static u32 XSecure_Sha3DataUpdate(XSecure_Sha3 *InstancePtr, const u8 *Data,
-					const u32 Size, u8 IsLastUpdate);
+					const u32 Size, u8 IsLastUpdate, u8 IsAsync);
+static u32 XSecure_Sha3UpdateData(XSecure_Sha3 *InstancePtr, const u8 *Data,
+					const u32 Size, u8 IsLastUpdate, u8 IsAsync);
 static void XSecure_Sha3KeccakPadd(XSecure_Sha3 *InstancePtr, u8 *Dst,
 					u32 MsgLen);
 static void XSecure_Sha3NistPadd(XSecure_Sha3 *InstancePtr, u8 *Dst,
@@ -322,35 +328,71 @@ void XSecure_Sha3Start(XSecure_Sha3 *InstancePtr)
 u32 XSecure_Sha3Update(XSecure_Sha3 *InstancePtr, const u8 *Data,
 						const u32 Size)
 {
-	u32 DataSize;
-	u32 TransferredBytes;
 	u32 Status = (u32)XST_FAILURE;
 
 	/* Asserts validate the input arguments */
 	Xil_AssertNonvoid(InstancePtr != NULL);
 	Xil_AssertNonvoid(InstancePtr->Sha3State == XSECURE_SHA3_ENGINE_STARTED);
 
-	InstancePtr->Sha3Len += Size;
-	DataSize = Size;
-	TransferredBytes = 0U;
-	/*
- 	 * CSU DMA can transfer Max 0x7FFFFFF no of words(0x1FFFFFFC bytes)
-	 * at a time .So if the data sent more than that will be handled
-	 * in the next update internally
-	 */
-	while (DataSize > XSECURE_CSU_DMA_MAX_TRANSFER) {
-		Status = XSecure_Sha3DataUpdate(InstancePtr,
-				(Data + TransferredBytes),
-				XSECURE_CSU_DMA_MAX_TRANSFER, 0);
-		if (Status != (u32)XST_SUCCESS){
+	Status = XSecure_Sha3UpdateData(InstancePtr, Data, Size,
+				(u8)InstancePtr->IsLastUpdate, FALSE);
+	if (Status != XST_SUCCESS) {
+		/* Set SHA under reset on failure condition */
+		XSecure_SetReset(InstancePtr->BaseAddress,
+					XSECURE_CSU_SHA3_RESET_OFFSET);
+		InstancePtr->Sha3State = XSECURE_SHA3_INITIALIZED;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function updates the SHA3 engine with a list of non contiguous
+ * input buffers, which are hashed as if they were one contiguous buffer.
+ * Data of consecutive buffers that does not fill a SHA3 block is combined
+ * before it is transferred to the SHA3 engine.
+ *
+ * @param	InstancePtr 	Pointer to the XSecure_Sha3 instance.
+ * @param	SgList 		Pointer to the list of input buffers.
+ * @param	Count 		Number of buffers in the list.
+ *
+ * @return	XST_SUCCESS if the update is successful
+ * 		XST_FAILURE if there is a failure in SSS config or DMA
+ *
+ * @note	If XSecure_Sha3LastUpdate is called, only the last buffer of
+ *		the list is marked as the last data.
+ *
+ ******************************************************************************/
+u32 XSecure_Sha3UpdateSg(XSecure_Sha3 *InstancePtr,
+			const XSecure_Sha3SgEntry *SgList, const u32 Count)
+{
+	u32 Status = (u32)XST_FAILURE;
+	u32 Index;
+	u8 IsLastUpdate = FALSE;
+
+	/* Asserts validate the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(SgList != NULL);
+	Xil_AssertNonvoid(InstancePtr->Sha3State == XSECURE_SHA3_ENGINE_STARTED);
+
+	for (Index = 0U; Index < Count; Index++) {
+		if ((SgList[Index].Data == NULL) && (SgList[Index].Size != 0U)) {
+			Status = (u32)XST_FAILURE;
+			goto END;
+		}
+		if (Index == (Count - 1U)) {
+			IsLastUpdate = (u8)InstancePtr->IsLastUpdate;
+		}
+		Status = XSecure_Sha3UpdateData(InstancePtr, SgList[Index].Data,
+				SgList[Index].Size, IsLastUpdate, FALSE);
+		if (Status != (u32)XST_SUCCESS) {
 			goto END;
 		}
-		DataSize = DataSize - XSECURE_CSU_DMA_MAX_TRANSFER;
-		TransferredBytes = TransferredBytes +
-			XSECURE_CSU_DMA_MAX_TRANSFER;
 	}
-	Status = XSecure_Sha3DataUpdate(InstancePtr, (Data + TransferredBytes),
-				DataSize, (u8)InstancePtr->IsLastUpdate);
+	Status = (u32)XST_SUCCESS;
+
 END:
 	if (Status != XST_SUCCESS) {
 		/* Set SHA under reset on failure condition */
@@ -362,6 +404,113 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief
+ * This function updates the SHA3 engine with the input data without
+ * waiting for the CSU DMA transfer of the data to complete. Data that
+ * does not fill a SHA3 block and data at non word aligned addresses is
+ * transferred before returning. XSecure_Sha3WaitForUpdate must be called
+ * before any other SHA3 API is called on the instance.
+ *
+ * @param	InstancePtr 	Pointer to the XSecure_Sha3 instance.
+ * @param	Data 		Pointer to the input data for hashing. It must
+ *		not be modified until the update is complete.
+ * @param	Size 		Size of the input data in bytes.
+ *
+ * @return	XST_SUCCESS if the update is started successfully
+ * 		XST_FAILURE if there is a failure in SSS config or DMA
+ *
+ ******************************************************************************/
+u32 XSecure_Sha3UpdateAsync(XSecure_Sha3 *InstancePtr, const u8 *Data,
+						const u32 Size)
+{
+	u32 Status = (u32)XST_FAILURE;
+
+	/* Asserts validate the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->Sha3State == XSECURE_SHA3_ENGINE_STARTED);
+
+	Status = XSecure_Sha3UpdateData(InstancePtr, Data, Size,
+				(u8)InstancePtr->IsLastUpdate, TRUE);
+	if (Status != XST_SUCCESS) {
+		/* Set SHA under reset on failure condition */
+		XSecure_SetReset(InstancePtr->BaseAddress,
+					XSECURE_CSU_SHA3_RESET_OFFSET);
+		InstancePtr->Sha3State = XSECURE_SHA3_INITIALIZED;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function checks if the update started by XSecure_Sha3UpdateAsync
+ * is complete, without waiting.
+ *
+ * @param	InstancePtr 	Pointer to the XSecure_Sha3 instance.
+ *
+ * @return	TRUE if no transfer is pending or the transfer is complete
+ * 		FALSE if the transfer is in progress
+ *
+ ******************************************************************************/
+u32 XSecure_Sha3IsUpdateDone(const XSecure_Sha3 *InstancePtr)
+{
+	u32 IsDone = TRUE;
+
+	/* Asserts validate the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	if ((InstancePtr->Sha3State == XSECURE_SHA3_UPDATE_PENDING) &&
+		((XCsuDma_IntrGetStatus(InstancePtr->CsuDmaPtr,
+		XCSUDMA_SRC_CHANNEL) & XCSUDMA_IXR_DONE_MASK) == 0U)) {
+		IsDone = FALSE;
+	}
+
+	return IsDone;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function waits for the update started by XSecure_Sha3UpdateAsync
+ * to complete.
+ *
+ * @param	InstancePtr 	Pointer to the XSecure_Sha3 instance.
+ *
+ * @return	XST_SUCCESS if the update is complete or no update is pending
+ * 		XST_FAILURE if a timeout has occurred
+ *
+ ******************************************************************************/
+u32 XSecure_Sha3WaitForUpdate(XSecure_Sha3 *InstancePtr)
+{
+	u32 Status = (u32)XST_FAILURE;
+
+	/* Asserts validate the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid((InstancePtr->Sha3State == XSECURE_SHA3_ENGINE_STARTED) ||
+		(InstancePtr->Sha3State == XSECURE_SHA3_UPDATE_PENDING));
+
+	if (InstancePtr->Sha3State == XSECURE_SHA3_ENGINE_STARTED) {
+		Status = (u32)XST_SUCCESS;
+		goto END;
+	}
+
+	Status = XSecure_Sha3DmaWait(InstancePtr);
+	if (Status != (u32)XST_SUCCESS) {
+		/* Set SHA under reset on failure condition */
+		XSecure_SetReset(InstancePtr->BaseAddress,
+					XSECURE_CSU_SHA3_RESET_OFFSET);
+		InstancePtr->Sha3State = XSECURE_SHA3_INITIALIZED;
+		goto END;
+	}
+	InstancePtr->Sha3State = XSECURE_SHA3_ENGINE_STARTED;
+
+END:
+	return Status;
+}
+
 
 /*****************************************************************************/
 /**
@@ -514,42 +663,90 @@ void XSecure_Sha3_ReadHash(XSecure_Sha3 *InstancePtr, u8 *Hash)
 /*****************************************************************************/
 /**
  * @brief
- * This function Transfers Data through Dma
+ * This function starts the transfer of data to the SHA3 engine through DMA.
  *
  * @param	InstancePtr 	Pointer to the XSecure_Sha3 instance.
  * @param	Data 		Pointer to the input data need to be transferred.
  * @param	Size 		Size of the input data in bytes.
+ * @param	IsLast 		Indicates if the data is the last data.
  *
- * @return	None
- *
+ * @return	XST_SUCCESS if the transfer is started
+ * 		XST_FAILURE if there is a failure in SSS config
  *
  ******************************************************************************/
-static u32 XSecure_Sha3DmaTransfer(XSecure_Sha3 *InstancePtr, const u8 *Data,
+static u32 XSecure_Sha3DmaStart(XSecure_Sha3 *InstancePtr, const u8 *Data,
 								const u32 Size, u8 IsLast)
 {
 	u32 Status = (u32)XST_FAILURE;
 
-	/* Asserts validate the input arguments */
-	Xil_AssertNonvoid(InstancePtr != NULL);
-
 	/* Configure the SSS for SHA3 hashing. */
 	Status = XSecure_SssSha(&(InstancePtr->SssInstance),
 				InstancePtr->CsuDmaPtr->Config.DeviceId);
 	if (Status != (u32)XST_SUCCESS){
-		goto ENDF;
+		goto END;
 	}
 	XCsuDma_Transfer(InstancePtr->CsuDmaPtr, XCSUDMA_SRC_CHANNEL,
 				(UINTPTR)Data, (u32)Size/4U, IsLast);
 
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function waits for the DMA transfer to the SHA3 engine to complete.
+ *
+ * @param	InstancePtr 	Pointer to the XSecure_Sha3 instance.
+ *
+ * @return	XST_SUCCESS if the transfer is complete
+ * 		XST_FAILURE if a timeout has occurred
+ *
+ ******************************************************************************/
+static u32 XSecure_Sha3DmaWait(const XSecure_Sha3 *InstancePtr)
+{
+	u32 Status = (u32)XST_FAILURE;
+
 	/* Checking the CSU DMA done bit should be enough. */
 	Status = XCsuDma_WaitForDoneTimeout(InstancePtr->CsuDmaPtr,
 						XCSUDMA_SRC_CHANNEL);
 	if (Status != (u32)XST_SUCCESS) {
-		goto ENDF;
+		goto END;
 	}
 	/* Acknowledge the transfer has completed */
 	XCsuDma_IntrClear(InstancePtr->CsuDmaPtr, XCSUDMA_SRC_CHANNEL,
 				XCSUDMA_IXR_DONE_MASK);
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function Transfers Data through Dma
+ *
+ * @param	InstancePtr 	Pointer to the XSecure_Sha3 instance.
+ * @param	Data 		Pointer to the input data need to be transferred.
+ * @param	Size 		Size of the input data in bytes.
+ *
+ * @return	None
+ *
+ *
+ ******************************************************************************/
+static u32 XSecure_Sha3DmaTransfer(XSecure_Sha3 *InstancePtr, const u8 *Data,
+								const u32 Size, u8 IsLast)
+{
+	u32 Status = (u32)XST_FAILURE;
+
+	/* Asserts validate the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	Status = XSecure_Sha3DmaStart(InstancePtr, Data, Size, IsLast);
+	if (Status != (u32)XST_SUCCESS){
+		goto ENDF;
+	}
+	Status = XSecure_Sha3DmaWait(InstancePtr);
 ENDF:
 	return Status;
 }
@@ -562,18 +759,22 @@ ENDF:
  * @param	InstancePtr 	Pointer to the XSecure_Sha3 instance.
  * @param	Data 		Pointer to the input data for hashing.
  * @param	Size 		Size of the input data in bytes.
+ * @param	IsLastUpdate 	Indicates if the data is the last data.
+ * @param	IsAsync 	Indicates if the transfer of the word aligned
+ *		data is to be started without waiting for completion.
  *
  * @return	None
  *
  *
  ******************************************************************************/
 static u32 XSecure_Sha3DataUpdate(XSecure_Sha3 *InstancePtr, const u8 *Data,
-		const u32 Size, u8 IsLastUpdate)
+		const u32 Size, u8 IsLastUpdate, u8 IsAsync)
 {
 	u32 RemainingDataLen;
 	u32 DmableDataLen;
 	const u8 *DmableData;
 	u8 IsLast;
+	u8 IsInputData;
 	u32 Status = (u32)XST_FAILURE;
 	u32 PrevPartialLen;
 	u8 *PartialData;
@@ -596,6 +797,7 @@ static u32 XSecure_Sha3DataUpdate(XSecure_Sha3 *InstancePtr, const u8 *Data,
 				XSECURE_SHA3_BLOCK_LEN - PrevPartialLen);
 			DmableData = PartialData;
 			DmableDataLen = XSECURE_SHA3_BLOCK_LEN;
+			IsInputData = FALSE;
 			Data += XSECURE_SHA3_BLOCK_LEN - PrevPartialLen;
 			RemainingDataLen = RemainingDataLen - DmableDataLen;
 		}
@@ -604,6 +806,7 @@ static u32 XSecure_Sha3DataUpdate(XSecure_Sha3 *InstancePtr, const u8 *Data,
 			DmableData = Data;
 			DmableDataLen = RemainingDataLen -
 				(RemainingDataLen % XSECURE_SHA3_BLOCK_LEN);
+			IsInputData = TRUE;
 			Data += DmableDataLen;
 			RemainingDataLen -= DmableDataLen;
 		}
@@ -612,8 +815,22 @@ static u32 XSecure_Sha3DataUpdate(XSecure_Sha3 *InstancePtr, const u8 *Data,
 			IsLast = TRUE;
 		}
 
-		Status = XSecure_Sha3DmaTransfer(InstancePtr, DmableData,
+		if ((IsAsync == TRUE) && (IsInputData == TRUE)) {
+			/*
+			 * Data is transferred from the input buffer itself, which
+			 * consumes all complete blocks, so this is the last
+			 * transfer of the update
+			 */
+			Status = XSecure_Sha3DmaStart(InstancePtr, DmableData,
+						DmableDataLen, IsLast);
+			if (Status == (u32)XST_SUCCESS) {
+				InstancePtr->Sha3State = XSECURE_SHA3_UPDATE_PENDING;
+			}
+		}
+		else {
+			Status = XSecure_Sha3DmaTransfer(InstancePtr, DmableData,
 						DmableDataLen, IsLast);
+		}
 		if (Status != (u32)XST_SUCCESS){
 			(void)memset(&InstancePtr->PartialData, 0,
 			            sizeof(InstancePtr->PartialData));
@@ -635,3 +852,53 @@ static u32 XSecure_Sha3DataUpdate(XSecure_Sha3 *InstancePtr, const u8 *Data,
 END:
 	return Status;
 }
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function updates the SHA3 engine with the input data of any size by
+ * splitting it into the transfers supported by the CSU DMA.
+ *
+ * @param	InstancePtr 	Pointer to the XSecure_Sha3 instance.
+ * @param	Data 		Pointer to the input data for hashing.
+ * @param	Size 		Size of the input data in bytes.
+ * @param	IsLastUpdate 	Indicates if the data is the last data.
+ * @param	IsAsync 	Indicates if the last transfer is to be started
+ *		without waiting for completion.
+ *
+ * @return	XST_SUCCESS if the update is successful
+ * 		XST_FAILURE if there is a failure in SSS config or DMA
+ *
+ ******************************************************************************/
+static u32 XSecure_Sha3UpdateData(XSecure_Sha3 *InstancePtr, const u8 *Data,
+		const u32 Size, u8 IsLastUpdate, u8 IsAsync)
+{
+	u32 DataSize;
+	u32 TransferredBytes;
+	u32 Status = (u32)XST_FAILURE;
+
+	InstancePtr->Sha3Len += Size;
+	DataSize = Size;
+	TransferredBytes = 0U;
+	/*
+ 	 * CSU DMA can transfer Max 0x7FFFFFF no of words(0x1FFFFFFC bytes)
+	 * at a time .So if the data sent more than that will be handled
+	 * in the next update internally
+	 */
+	while (DataSize > XSECURE_CSU_DMA_MAX_TRANSFER) {
+		Status = XSecure_Sha3DataUpdate(InstancePtr,
+				(Data + TransferredBytes),
+				XSECURE_CSU_DMA_MAX_TRANSFER, 0, FALSE);
+		if (Status != (u32)XST_SUCCESS){
+			goto END;
+		}
+		DataSize = DataSize - XSECURE_CSU_DMA_MAX_TRANSFER;
+		TransferredBytes = TransferredBytes +
+			XSECURE_CSU_DMA_MAX_TRANSFER;
+	}
+	Status = XSecure_Sha3DataUpdate(InstancePtr, (Data + TransferredBytes),
+				DataSize, IsLastUpdate, IsAsync);
+
+END:
+	return Status;
+}
@@ -49,6 +49,7 @@
 *       har  03/23/20 Moved to zynqmp directory
 *                     Replaced function like macro with inline function
 *       ana  10/15/20 Updated doxygen tags
+* 4.9   ag   10/14/26 Added scatter gather and asynchronous update APIs
 
 * </pre>
 *
@@ -103,9 +104,16 @@ typedef enum {
 typedef enum {
 	XSECURE_SHA3_UNINITIALIZED = 0,
 	XSECURE_SHA3_INITIALIZED,
-	XSECURE_SHA3_ENGINE_STARTED
+	XSECURE_SHA3_ENGINE_STARTED,
+	XSECURE_SHA3_UPDATE_PENDING
 } XSecure_Sha3State;
 
+/* Input buffer of scatter gather update */
+typedef struct {
+	const u8 *Data; /**< Pointer to the input data */
+	u32 Size; /**< Size of the input data in bytes */
+} XSecure_Sha3SgEntry;
+
 /**
  * The SHA-3 driver instance data structure. A pointer to an instance data
  * structure is passed around by functions to refer to a specific driver
@@ -135,6 +143,12 @@ void XSecure_Sha3Start(XSecure_Sha3 *InstancePtr);
 /* Data Transfer */
 u32 XSecure_Sha3Update(XSecure_Sha3 *InstancePtr, const u8 *Data,
 						const u32 Size);
+u32 XSecure_Sha3UpdateSg(XSecure_Sha3 *InstancePtr,
+			const XSecure_Sha3SgEntry *SgList, const u32 Count);
+u32 XSecure_Sha3UpdateAsync(XSecure_Sha3 *InstancePtr, const u8 *Data,
+						const u32 Size);
+u32 XSecure_Sha3IsUpdateDone(const XSecure_Sha3 *InstancePtr);
+u32 XSecure_Sha3WaitForUpdate(XSecure_Sha3 *InstancePtr);
 u32 XSecure_Sha3Finish(XSecure_Sha3 *InstancePtr, u8 *Hash);
 
 /* Complete SHA digest calculation */
@@ -48,6 +48,7 @@
 * 2.1	hv   08/15/2022   Updated APIs to read status of all SLRs seperately
 *						  in case of broadcast
 * 2.2	rama 08/28/2022   Updated CRAM & NPI status bit information
+* 2.3	ag   10/15/2026   Added prioritized CRAM frame range scan
 * </pre>
 *
 * @note
@@ -1265,6 +1266,251 @@ void XSem_CmdCfrGetTotalFrames(u32 RowIndex, u32 *FrameCntPtr)
 	FrameCntPtr[6] = (Buf[5] & CFRAME_BIT_40_59_MASK) >> \
 									CFRAME_BIT_40_59_SHIFT_R;
 }
+/*****************************************************************************/
+/**
+ * @brief	This function reads the Segment 0 and Segment 1 ECC values of
+ *		one frame of a prioritized scan range over IPI.
+ *
+ * @param[in]	IpiInst		Pointer to IPI driver instance
+ * @param[in]	Range		Pointer to the frame range
+ * @param[in]	FrameOff	Frame offset from the start of the range
+ * @param[out]	Ecc		Array of XSEM_CFR_PRIO_ECC_WORDS to hold the
+ *				ECC values
+ *
+ * @return	This API returns the success or failure.
+ *		- XST_FAILURE: On IPI failure or PLM read frame ECC failure
+ *		- XST_SUCCESS: On read frame ECC success
+ *****************************************************************************/
+static XStatus XSem_CfrPrioReadEcc(XIpiPsu *IpiInst,
+		const XSemCfrPrioRange *Range, u32 FrameOff, u32 *Ecc)
+{
+	XStatus Status = XST_FAILURE;
+	XSemIpiResp Resp = {0U};
+	u32 CframeAddr;
+
+	CframeAddr = (Range->BlockType << XSEM_CFR_BLOCK_TYPE_SHIFT) |
+			((Range->FrameStart + FrameOff) & CFRAME_BIT_0_19_MASK);
+
+	Status = XSem_CmdCfrReadFrameEcc(IpiInst, CframeAddr, Range->Row,
+			&Resp);
+	if (XST_SUCCESS != Status) {
+		goto END;
+	}
+	if ((CMD_ACK_SEM_READ_FRAME_ECC != Resp.RespMsg1) ||
+			((u32)XST_SUCCESS != Resp.RespMsg4)) {
+		XSem_Dbg("[%s] ERROR: Read ECC of Row 0x%x Frame 0x%x failed\n\r",
+				__func__, Range->Row, CframeAddr);
+		Status = XST_FAILURE;
+		goto END;
+	}
+	Ecc[0U] = Resp.RespMsg2;
+	Ecc[1U] = Resp.RespMsg3;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function is used to initialize a prioritized CRAM frame
+ *		range scan. It validates the frame ranges configured in Scan
+ *		against the total frames of each row and block type, then
+ *		captures the golden Segment 0 and Segment 1 ECC of every frame
+ *		in the ranges using XSem_CmdCfrReadFrameEcc.
+ *
+ * @param[in]	IpiInst		Pointer to IPI driver instance
+ * @param[in,out]	Scan	Pointer to the prioritized scan instance.
+ *		Range, NumRanges, FramesPerSlice, GoldenEccPtr and GoldenEccCnt
+ *		must be filled by the caller.
+ *
+ * @return	This API returns the success or failure.
+ *		- XST_FAILURE: On invalid configuration or golden ECC read failure
+ *		- XST_SUCCESS: On successful initialization
+ *
+ * @note
+ *	- GoldenEccPtr must hold XSEM_CFR_PRIO_ECC_WORDS words for every frame
+ * of every range.
+ *	- This must be called after the CRAM scan is initialized, while the
+ * configuration memory is known to be good.
+ *	- The background CRAM scan on PLM is not altered; the prioritized scan
+ * adds extra coverage for the configured ranges only.
+ *****************************************************************************/
+XStatus XSem_CmdCfrPrioScanInit(XIpiPsu *IpiInst, XSemCfrPrioScan *Scan)
+{
+	XStatus Status = XST_FAILURE;
+	u32 TotalFrames[CFRAME_MAX_TYPE];
+	u32 EccWords = 0U;
+	u32 Index;
+	u32 FrameOff;
+	XSemCfrPrioRange *Range;
+
+	/* Validate IPI instance structure pointer */
+	if (NULL == IpiInst) {
+		XSem_Dbg("[%s] ERROR: IpiInst is NULL\n\r", __func__);
+		goto END;
+	}
+	/* Validate scan instance and its configuration */
+	if ((NULL == Scan) || (NULL == Scan->GoldenEccPtr)) {
+		XSem_Dbg("[%s] ERROR: Scan or GoldenEccPtr is NULL\n\r", __func__);
+		goto END;
+	}
+	if ((0U == Scan->NumRanges) ||
+			(Scan->NumRanges > XSEM_CFR_PRIO_MAX_RANGES) ||
+			(0U == Scan->FramesPerSlice)) {
+		XSem_Dbg("[%s] ERROR: Invalid NumRanges or FramesPerSlice\n\r",
+				__func__);
+		goto END;
+	}
+
+	/* Validate each range and assign its golden ECC storage */
+	for (Index = 0U; Index < Scan->NumRanges; Index++) {
+		Range = &Scan->Range[Index];
+		if ((Range->BlockType >= CFRAME_MAX_TYPE) ||
+				(0U == Range->FrameCnt) || (0U == Range->Weight)) {
+			XSem_Dbg("[%s] ERROR: Invalid range %u\n\r", __func__, Index);
+			goto END;
+		}
+		XSem_CmdCfrGetTotalFrames(Range->Row, TotalFrames);
+		if ((Range->FrameCnt > TotalFrames[Range->BlockType]) ||
+				(Range->FrameStart >
+				(TotalFrames[Range->BlockType] - Range->FrameCnt))) {
+			XSem_Dbg("[%s] ERROR: Range %u exceeds frames in row\n\r",
+					__func__, Index);
+			goto END;
+		}
+		Range->EccIndex = EccWords;
+		EccWords += Range->FrameCnt * XSEM_CFR_PRIO_ECC_WORDS;
+		if (EccWords > Scan->GoldenEccCnt) {
+			XSem_Dbg("[%s] ERROR: GoldenEccCnt too small\n\r", __func__);
+			goto END;
+		}
+	}
+
+	/* Capture golden ECC of every frame in the ranges */
+	for (Index = 0U; Index < Scan->NumRanges; Index++) {
+		Range = &Scan->Range[Index];
+		for (FrameOff = 0U; FrameOff < Range->FrameCnt; FrameOff++) {
+			Status = XSem_CfrPrioReadEcc(IpiInst, Range, FrameOff,
+					&Scan->GoldenEccPtr[Range->EccIndex +
+					(FrameOff * XSEM_CFR_PRIO_ECC_WORDS)]);
+			if (XST_SUCCESS != Status) {
+				goto END;
+			}
+		}
+		Scan->NextFrame[Index] = 0U;
+	}
+
+	Scan->CurRange = 0U;
+	Scan->TurnCnt = 0U;
+	Scan->SliceCnt = 0U;
+	Scan->FrameChkCnt = 0U;
+	Scan->MismatchCnt = 0U;
+
+	/* Print API status */
+	XSem_Dbg("[%s] SUCCESS: 0x%x\n\r", __func__, Status);
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function runs one time slice of the prioritized CRAM frame
+ *		range scan. Up to FramesPerSlice frames are read over IPI and
+ *		compared against their golden ECC. Ranges are visited in
+ *		weighted round-robin order, Weight frames of a range per turn,
+ *		and each range resumes from where its previous turn stopped.
+ *
+ * @param[in]	IpiInst		Pointer to IPI driver instance
+ * @param[in,out]	Scan	Pointer to the prioritized scan instance
+ *		initialized with XSem_CmdCfrPrioScanInit
+ *
+ * @return	This API returns the success or failure.
+ *		- XST_FAILURE: On IPI failure or if any frame in the slice did
+ *		not match its golden ECC
+ *		- XST_SUCCESS: If all frames checked in the slice matched
+ *
+ * @note
+ *	- Call this from a periodic timer or scheduler task. The fraction of
+ * IPI bandwidth spent on the prioritized ranges is set by FramesPerSlice
+ * and the period of the caller.
+ *	- On mismatch, Handler (if registered) is called with the row, frame
+ * address and the ECC values read, and MismatchCnt is incremented. The
+ * remaining frames of the slice are still checked.
+ *	- An IPI failure stops the slice immediately.
+ *****************************************************************************/
+XStatus XSem_CmdCfrPrioScanSlice(XIpiPsu *IpiInst, XSemCfrPrioScan *Scan)
+{
+	XStatus Status = XST_FAILURE;
+	XStatus MatchStatus = XST_SUCCESS;
+	u32 Ecc[XSEM_CFR_PRIO_ECC_WORDS];
+	const u32 *Golden;
+	u32 Index;
+	u32 FrameOff;
+	XSemCfrPrioRange *Range;
+
+	/* Validate IPI instance structure pointer */
+	if (NULL == IpiInst) {
+		XSem_Dbg("[%s] ERROR: IpiInst is NULL\n\r", __func__);
+		goto END;
+	}
+	/* Validate scan instance */
+	if ((NULL == Scan) || (NULL == Scan->GoldenEccPtr) ||
+			(0U == Scan->NumRanges) ||
+			(Scan->NumRanges > XSEM_CFR_PRIO_MAX_RANGES)) {
+		XSem_Dbg("[%s] ERROR: Invalid Scan instance\n\r", __func__);
+		goto END;
+	}
+
+	for (Index = 0U; Index < Scan->FramesPerSlice; Index++) {
+		Range = &Scan->Range[Scan->CurRange];
+		FrameOff = Scan->NextFrame[Scan->CurRange];
+
+		Status = XSem_CfrPrioReadEcc(IpiInst, Range, FrameOff, Ecc);
+		if (XST_SUCCESS != Status) {
+			goto END;
+		}
+		Scan->FrameChkCnt++;
+
+		/* Compare against golden ECC */
+		Golden = &Scan->GoldenEccPtr[Range->EccIndex +
+				(FrameOff * XSEM_CFR_PRIO_ECC_WORDS)];
+		if ((Golden[0U] != Ecc[0U]) || (Golden[1U] != Ecc[1U])) {
+			Scan->MismatchCnt++;
+			MatchStatus = XST_FAILURE;
+			XSem_Dbg("[%s] ERROR: ECC mismatch Row 0x%x Type %u "
+					"Frame 0x%x\n\r", __func__, Range->Row,
+					Range->BlockType, Range->FrameStart + FrameOff);
+			if (NULL != Scan->Handler) {
+				Scan->Handler(Scan->CallBackRef, Range->Row,
+					(Range->BlockType << XSEM_CFR_BLOCK_TYPE_SHIFT) |
+					(Range->FrameStart + FrameOff), Ecc);
+			}
+		}
+
+		/* Advance within the range, wrapping at its end */
+		FrameOff++;
+		if (FrameOff >= Range->FrameCnt) {
+			FrameOff = 0U;
+		}
+		Scan->NextFrame[Scan->CurRange] = FrameOff;
+
+		/* Move to the next range once this one used its weight */
+		Scan->TurnCnt++;
+		if (Scan->TurnCnt >= Range->Weight) {
+			Scan->TurnCnt = 0U;
+			Scan->CurRange++;
+			if (Scan->CurRange >= Scan->NumRanges) {
+				Scan->CurRange = 0U;
+			}
+		}
+	}
+	Scan->SliceCnt++;
+	Status = MatchStatus;
+
+END:
+	return Status;
+}
 /** @} */
 #else
 /****************************************************************************/
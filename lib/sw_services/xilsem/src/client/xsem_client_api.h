@@ -44,6 +44,7 @@
 * 2.1	hv   07/24/2022   Added client interface to read Cfr Status
 * 2.2   hb   07/28/2022   Added macro for GT arbitration fail event
 * 2.3	hv   08/08/2022   Fixed Misra C violations
+* 2.4	ag   10/15/2026   Added prioritized frame range scan interface
 * </pre>
 *
 * @note
@@ -324,6 +325,64 @@ typedef struct {
 information: Contains descriptor attributes and golden SHA value */
 }XSem_DescriptorData;
 
+/** Maximum number of frame ranges in a prioritized CRAM scan */
+#define XSEM_CFR_PRIO_MAX_RANGES	(8U)
+/** Number of ECC words (Segment 0 and Segment 1) stored per frame */
+#define XSEM_CFR_PRIO_ECC_WORDS		(2U)
+/** Block type field shift in the CFRAME address */
+#define XSEM_CFR_BLOCK_TYPE_SHIFT	(20U)
+
+/**
+ * XSemCfrPrioRange - Frame range to be checked by the prioritized scan.
+ * Frames FrameStart to (FrameStart + FrameCnt - 1) of the given block type
+ * and row are read over IPI and compared against the golden ECC captured
+ * in XSem_CmdCfrPrioScanInit. Weight is the number of frames of this
+ * range checked in one round-robin turn, so a range with weight 4 is
+ * revisited four times as often as a range of the same size with weight 1.
+ */
+typedef struct {
+	u32 Row;        /**< Row Number */
+	u32 BlockType;  /**< Block Type 0...6 */
+	u32 FrameStart; /**< First frame number of the range */
+	u32 FrameCnt;   /**< Number of frames in the range */
+	u32 Weight;     /**< Frames checked per round-robin turn (Min: 1) */
+	u32 EccIndex;   /**< Offset of the range in GoldenEccPtr (internal) */
+} XSemCfrPrioRange;
+
+/**
+ * Callback invoked by the prioritized scan when the ECC of a frame does
+ * not match its golden value. CframeAddr carries the frame number in bits
+ * [0:19] and the block type in bits [20:22]; Ecc holds the Segment 0 and
+ * Segment 1 ECC values read back.
+ */
+typedef void (*XSemCfrPrioHandler)(void *CallBackRef, u32 Row,
+		u32 CframeAddr, const u32 *Ecc);
+
+/**
+ * XSemCfrPrioScan - Prioritized CRAM frame range scan instance.
+ * The application fills Range, NumRanges, FramesPerSlice, GoldenEccPtr,
+ * GoldenEccCnt and optionally Handler/CallBackRef, then calls
+ * XSem_CmdCfrPrioScanInit once and XSem_CmdCfrPrioScanSlice from its
+ * periodic timer or scheduler task. The scan duty cycle is controlled by
+ * FramesPerSlice and the period at which slices are issued.
+ */
+typedef struct {
+	XSemCfrPrioRange Range[XSEM_CFR_PRIO_MAX_RANGES]; /**< Frame ranges */
+	u32 NumRanges;      /**< Number of valid entries in Range */
+	u32 FramesPerSlice; /**< Frames checked per call of slice API */
+	u32 *GoldenEccPtr;  /**< Golden ECC storage, 2 words per frame */
+	u32 GoldenEccCnt;   /**< Number of words available in GoldenEccPtr */
+	XSemCfrPrioHandler Handler; /**< Mismatch callback, may be NULL */
+	void *CallBackRef;  /**< Argument passed to Handler */
+	u32 CurRange;       /**< Range being checked (internal) */
+	u32 TurnCnt;        /**< Frames checked in current turn (internal) */
+	u32 NextFrame[XSEM_CFR_PRIO_MAX_RANGES]; /**< Next frame offset of each
+	range (internal) */
+	u32 SliceCnt;       /**< Number of slices executed */
+	u32 FrameChkCnt;    /**< Number of frames checked */
+	u32 MismatchCnt;    /**< Number of ECC mismatches detected */
+} XSemCfrPrioScan;
+
 /** SEM CRAM Module Notification ID */
 #define XSEM_NOTIFY_CRAM	(0x0U)
 /** SEM NPI Module Notification ID */
@@ -470,6 +529,8 @@ XStatus XSem_CmdCfrReadFrameEcc(XIpiPsu *IpiInst, \
 		u32 CframeAddr, u32 RowLoc, XSemIpiResp *Resp);
 u32 XSem_CmdCfrGetCrc(u32 RowIndex);
 void XSem_CmdCfrGetTotalFrames(u32 RowIndex, u32 *FrameCntPtr);
+XStatus XSem_CmdCfrPrioScanInit(XIpiPsu *IpiInst, XSemCfrPrioScan *Scan);
+XStatus XSem_CmdCfrPrioScanSlice(XIpiPsu *IpiInst, XSemCfrPrioScan *Scan);
 
 /* NPI functions */
 XStatus XSem_CmdNpiStartScan(XIpiPsu *IpiInst, XSemIpiResp * Resp);
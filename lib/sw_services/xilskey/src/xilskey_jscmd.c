@@ -67,6 +67,10 @@
 * 7.1   kpt     04/08/21 Ignored product version of user defined IDCODE when comparing
 *                        with the tap code read from Jtag
 * 7.2   am      07/13/21 Fixed doxygen warnings
+* 7.3   ag      10/15/26 Shift scans and TAP navigation with one GPIO register
+*                        write per TCK edge when TDI, TMS and TCK share a GPIO
+*                        data register, with the TCK rate checked against
+*                        MAX_FREQUENCY
 *
 * </pre>
 *
@@ -120,6 +124,35 @@ void dummy_printf(const char *ctrl1, ...); /**< function prototype of dummy_prin
 #define ZYNQ_ULTRAPLUS_PL_DAP_ID	0x0484A093	/**< Zynq Ultrascale plus TAP ID */
 #define set_last_error(JS, ...) js_set_last_error(&(JS)->js.base, __VA_ARGS__)	/**< Set last error */
 
+/**
+ * TCK cycles clocked by JtagScanCheckTiming(). At MAX_FREQUENCY they take
+ * 1 us on ARM, where the unit of XilSKey_Efuse_SetTimeOut() is 100 ns, and
+ * 10 us on MicroBlaze, where TimerTicksfor1000ns holds the ticks of 10 us.
+ */
+#ifdef XSK_ARM_PLATFORM
+#define JTAG_TIMING_CYCLES	(MAX_FREQUENCY / 1000000)
+#define JTAG_TIMING_UNITS	10U
+#else
+#define JTAG_TIMING_CYCLES	(MAX_FREQUENCY / 100000)
+#endif
+
+/**
+ * GPIO registers of the JTAG pins, set up by JtagScanInit(). When TDI, TMS
+ * and TCK are driven through one GPIO data register, scans and TAP
+ * navigation are clocked with one register write per TCK edge instead of a
+ * setPin() call per pin change.
+ */
+typedef struct {
+	UINTPTR OutReg;	/**< Data register of TDI, TMS and TCK */
+	UINTPTR InReg;	/**< Data register of TDO */
+	u32 TdiMask;	/**< TDI bit in OutReg */
+	u32 TmsMask;	/**< TMS bit in OutReg */
+	u32 TckMask;	/**< TCK bit in OutReg */
+	u32 TdoMask;	/**< TDO bit in InReg */
+	u8 IsBatched;	/**< TDI, TMS and TCK share OutReg */
+	u8 Throttle;	/**< Wait for each write to reach the pins */
+} JtagScan_t;
+
 typedef struct js_port_impl_struct js_port_impl_t;
 typedef struct js_command_impl_struct js_command_impl_t;
 typedef struct ftd_async_transfer_struct ftd_async_transfer_t;
@@ -128,7 +161,12 @@ static js_port_t *g_port = NULL;
 static js_server_t *g_js = NULL;
 static js_port_descr_t *g_useport = NULL;
 u32 GpoOutValue = 0;
+static JtagScan_t JtagScan;
 extern XSKEfusePl_Fpga PlFpgaFlag;
+static void JtagScanInit(void);
+static void JtagScanTms(u32 TmsBits, u32 BitCount);
+static void JtagScanBits(const u8 *TdiBuf, u8 *TdoBuf, int BitCount,
+			 int ExitState);
 #ifndef XSK_ARM_PLATFORM
 static INLINE int JtagValidateMioPins_Efuse_Ultra(void);
 static INLINE int JtagValidateMioPins_Bbram_Ultra(void);
@@ -312,6 +350,7 @@ void JtagInitGpio (XilSKey_ModuleSelection Module)
 
 
 #endif
+	JtagScanInit();
 } /* initGpio() */
 
 /****************************************************************************/
@@ -667,6 +706,13 @@ void navigateTAP (unsigned char startState, unsigned char endState)
     js_printf ("navigate - start=%d, end=%d\n", startState, endState);
     js_printf ("tmsvalue = 0x%02X, bitCount = %d\n", tmsValue, bitCount);
 
+    if ((endState == JS_RESET) && JtagScan.IsBatched)
+    {
+	// initialize state to JS_RESET
+	JtagScanTms (0x1F, 5);
+	return;
+    }
+
     if (endState == JS_RESET)
     {
 	// initialize state to JS_RESET
@@ -686,7 +732,11 @@ void navigateTAP (unsigned char startState, unsigned char endState)
 	return;
     }
 
-    if (startState != endState)
+    if ((startState != endState) && JtagScan.IsBatched)
+    {
+	JtagScanTms (tmsValue, bitCount);
+    }
+    else if (startState != endState)
     {
 	while (bitCount)
 	{
@@ -741,6 +791,229 @@ int readPin (int pin)
 	return (retVal);
 }
 
+/****************************************************************************/
+/**
+*
+* This function writes the TDI, TMS and TCK data register of a batched scan.
+*
+*****************************************************************************/
+static INLINE void JtagScanWrite(u32 Value)
+{
+	Xil_Out32(JtagScan.OutReg, Value);
+	if (JtagScan.Throttle) {
+		/* The read completes after the write reached the GPIO */
+		(void)Xil_In32(JtagScan.InReg);
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* This function returns the value of the TDI, TMS and TCK data register with
+* the three pins low.
+*
+*****************************************************************************/
+static INLINE u32 JtagScanBase(void)
+{
+#ifdef XSK_ARM_PLATFORM
+	/* The upper half word masks the pins not written */
+	return ((~(JtagScan.TdiMask | JtagScan.TmsMask | JtagScan.TckMask))
+		<< 16U);
+#else
+	return (GpoOutValue &
+		~(JtagScan.TdiMask | JtagScan.TmsMask | JtagScan.TckMask));
+#endif
+}
+
+/****************************************************************************/
+/**
+*
+* This function records the state left on the pins by a batched scan, so
+* that setPin() keeps it.
+*
+*****************************************************************************/
+static INLINE void JtagScanDone(u32 Value)
+{
+#ifdef XSK_ARM_PLATFORM
+	(void)Value;
+#else
+	GpoOutValue = Value;
+#endif
+}
+
+/****************************************************************************/
+/**
+*
+* This function clocks a TMS sequence, LSB first, with TCK left low.
+*
+*****************************************************************************/
+static void JtagScanTms(u32 TmsBits, u32 BitCount)
+{
+	u32 Out = JtagScanBase();
+	u32 Index;
+
+	for (Index = 0U; Index < BitCount; Index++) {
+		Out = JtagScanBase();
+		if ((TmsBits & (1U << Index)) != 0U) {
+			Out |= JtagScan.TmsMask;
+		}
+		JtagScanWrite(Out);
+		JtagScanWrite(Out | JtagScan.TckMask);
+	}
+	JtagScanWrite(Out);
+	JtagScanDone(Out);
+}
+
+/****************************************************************************/
+/**
+*
+* This function shifts a scan vector, LSB of the first byte first, with one
+* register write per TCK edge. TMS is raised with the last bit when the
+* shift state is to be exited.
+*
+* @note		If TdiBuf is NULL ones are shifted in. If TdoBuf != NULL, TDO
+*		is sampled before each rising edge of TCK.
+*
+*****************************************************************************/
+static void JtagScanBits(const u8 *TdiBuf, u8 *TdoBuf, int BitCount,
+			 int ExitState)
+{
+	u32 Base = JtagScanBase();
+	u32 Out = Base;
+	u8 TdiByte = 0xFFU;
+	u8 TdoByte = 0U;
+	u8 Mask;
+	int Index;
+
+	for (Index = 0; Index < BitCount; Index++) {
+		Mask = (u8)(1U << (Index & 7));
+		if ((Mask == 0x01U) && (TdiBuf != NULL)) {
+			TdiByte = TdiBuf[Index >> 3];
+		}
+
+		Out = Base;
+		if ((TdiByte & Mask) != 0U) {
+			Out |= JtagScan.TdiMask;
+		}
+		if ((ExitState == 1) && (Index == (BitCount - 1))) {
+			Out |= JtagScan.TmsMask;
+		}
+		/* TCK low, TDI and TMS set up for the rising edge */
+		JtagScanWrite(Out);
+
+		if (TdoBuf != NULL) {
+			if ((Xil_In32(JtagScan.InReg) & JtagScan.TdoMask) != 0U) {
+				TdoByte |= Mask;
+			}
+			if ((Mask == 0x80U) || (Index == (BitCount - 1))) {
+				TdoBuf[Index >> 3] = TdoByte;
+				TdoByte = 0U;
+			}
+		}
+
+		JtagScanWrite(Out | JtagScan.TckMask);
+	}
+	JtagScanWrite(Out);
+	JtagScanDone(Out);
+}
+
+/****************************************************************************/
+/**
+*
+* This function checks that batched scans do not clock TCK faster than
+* MAX_FREQUENCY, and throttles them otherwise. The TAP is held in
+* Test-Logic-Reset by TMS while TCK is clocked.
+*
+*****************************************************************************/
+static void JtagScanCheckTiming(void)
+{
+	u32 Index;
+	u32 Out;
+#ifdef XSK_ARM_PLATFORM
+	volatile u64 Deadline = 0U;
+
+	XilSKey_Efuse_SetTimeOut(&Deadline, JTAG_TIMING_UNITS);
+#else
+	XilSKey_Efuse_StartTimer();
+#endif
+
+	Out = JtagScanBase() | JtagScan.TmsMask;
+	for (Index = 0U; Index < JTAG_TIMING_CYCLES; Index++) {
+		JtagScanWrite(Out);
+		JtagScanWrite(Out | JtagScan.TckMask);
+	}
+	JtagScanWrite(Out);
+	JtagScanDone(Out);
+
+#ifdef XSK_ARM_PLATFORM
+	if (XilSKey_Efuse_IsTimerExpired(Deadline) == 0U) {
+#else
+	if (XilSKey_Efuse_IsTimerExpired(TimerTicksfor1000ns) == 0U) {
+#endif
+		JtagScan.Throttle = 1U;
+	}
+
+	js_printf("JTAG scan: %s\n\r", JtagScan.Throttle ?
+		"throttled to MAX_FREQUENCY" : "within MAX_FREQUENCY");
+}
+
+/****************************************************************************/
+/**
+*
+* This function sets up the GPIO registers of the JTAG pins for batched
+* scans. Scans fall back to setPin() when TDI, TMS and TCK are not in one
+* data register, e.g. MIO pins in different banks or half banks.
+*
+*****************************************************************************/
+static void JtagScanInit(void)
+{
+#ifdef XSK_ARM_PLATFORM
+	UINTPTR BaseAddr = structXGpioPs.GpioConfig.BaseAddr;
+	UINTPTR Reg[3];
+	u32 PinMask[3];
+	u32 Pin[3] = {MIO_TDI, MIO_TMS, MIO_TCK};
+	u8 Bank;
+	u8 PinInBank;
+	u32 Index;
+
+	for (Index = 0U; Index < 3U; Index++) {
+		XGpioPs_GetBankPin((u8)Pin[Index], &Bank, &PinInBank);
+		Reg[Index] = BaseAddr + ((UINTPTR)Bank * XGPIOPS_DATA_MASK_OFFSET) +
+			((PinInBank > 15U) ? XGPIOPS_DATA_MSW_OFFSET :
+					     XGPIOPS_DATA_LSW_OFFSET);
+		PinMask[Index] = (u32)1U << (PinInBank % 16U);
+	}
+	XGpioPs_GetBankPin((u8)MIO_TDO, &Bank, &PinInBank);
+
+	JtagScan.OutReg = Reg[0];
+	JtagScan.InReg = BaseAddr + XGPIOPS_DATA_RO_OFFSET +
+			((UINTPTR)Bank * XGPIOPS_DATA_BANK_OFFSET);
+	JtagScan.TdiMask = PinMask[0];
+	JtagScan.TmsMask = PinMask[1];
+	JtagScan.TckMask = PinMask[2];
+	JtagScan.TdoMask = (u32)1U << PinInBank;
+	JtagScan.IsBatched = ((Reg[0] == Reg[1]) && (Reg[0] == Reg[2])) ?
+				1U : 0U;
+#else
+	UINTPTR BaseAddr = structXGpio.BaseAddress;
+
+	JtagScan.OutReg = BaseAddr + ((UINTPTR)(GpioOutPutCh - 1U) *
+			XGPIO_CHAN_OFFSET) + XGPIO_DATA_OFFSET;
+	JtagScan.InReg = BaseAddr + ((UINTPTR)(GpioInPutCh - 1U) *
+			XGPIO_CHAN_OFFSET) + XGPIO_DATA_OFFSET;
+	JtagScan.TdiMask = (u32)1U << MIO_TDI;
+	JtagScan.TmsMask = (u32)1U << MIO_TMS;
+	JtagScan.TckMask = (u32)1U << MIO_TCK;
+	JtagScan.TdoMask = (u32)1U << MIO_TDO;
+	JtagScan.IsBatched = 1U;
+#endif
+	JtagScan.Throttle = 0U;
+
+	if (JtagScan.IsBatched) {
+		JtagScanCheckTiming();
+	}
+}
+
 /****************************************************************************/
 /**
 *
@@ -817,6 +1090,20 @@ int jtagShiftTDIBits (unsigned char* tdiBuf, unsigned char* tdoBuf, int bitCount
 
 	TdiTemp = 0xFF;
 
+    if (JtagScan.IsBatched)
+    {
+	if (flags & JS_TO_IR)
+	{
+		exitState = (endState != JS_IRSHIFT) ? 1 : 0;
+	}
+	else
+	{
+		exitState = (endState != JS_DRSHIFT) ? 1 : 0;
+	}
+	JtagScanBits (tdiBuf, tdoBuf, bitCount, exitState);
+	return (exitState);
+    }
+
     while (index < byteCount)
     {
 	currentByteCount--;
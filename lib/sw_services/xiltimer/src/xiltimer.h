@@ -22,6 +22,8 @@
 *  			  selected as default timer.
 *  1.1	adk      08/08/22 Added support for versal net.
 *  	adk      08/08/22 Added doxygen tags.
+*  1.2	ag       15/10/26 Added software timers multiplexed on the tick
+*  			  timer and a 64 bit tick count.
 * </pre>
 ******************************************************************************/
 #ifndef XILTIMER_H
@@ -57,6 +59,37 @@ typedef enum {
 
 typedef void (*XTimer_TickHandler) (void *CallBackRef, u32 StatusEvent);
 
+typedef void (*XTimer_SwTimerHandler) (void *CallBackRef);
+
+/**
+ * Number of slots of the timing wheel of the software timers, a power of 2.
+ * Timers that expire within this many ticks never share a slot.
+ */
+#ifndef XTIMER_WHEEL_SLOTS
+#define XTIMER_WHEEL_SLOTS	64U
+#endif
+
+/**
+ * Software timer. The members are private to the library.
+ *
+ * @param Next Next timer of the wheel slot
+ * @param Prev Previous timer of the wheel slot
+ * @param Expiry Tick at which the timer expires
+ * @param Period Period in ticks, 0 for a one shot timer
+ * @param Handler Expiry handler
+ * @param CallBackRef Callback reference for handler
+ * @param IsActive TRUE while the timer is linked into the wheel
+ */
+typedef struct XTimer_SwTimerTag {
+	struct XTimer_SwTimerTag *Next;
+	struct XTimer_SwTimerTag *Prev;
+	u64 Expiry;
+	u32 Period;
+	XTimer_SwTimerHandler Handler;
+	void *CallBackRef;
+	u8 IsActive;
+} XTimer_SwTimer;
+
 /**
  * Structure to the XFpga instance.
  *
@@ -114,6 +147,14 @@ void XTimer_SetInterval(unsigned long delay);
 void XTimer_SetHandler(XTimer_TickHandler FuncPtr, void *CallBackRef,
 		       u8 Priority);
 void XTimer_ClearTickInterrupt( void );
+u32 XTimer_SwTimerInit(u32 TickMs, u8 Priority);
+void XTimer_SwTimerSetup(XTimer_SwTimer *TimerPtr,
+			 XTimer_SwTimerHandler FuncPtr, void *CallBackRef);
+void XTimer_SwTimerStart(XTimer_SwTimer *TimerPtr, u32 DelayMs, u32 PeriodMs);
+void XTimer_SwTimerStop(XTimer_SwTimer *TimerPtr);
+u8 XTimer_SwTimerIsActive(XTimer_SwTimer *TimerPtr);
+u64 XTimer_GetTicks(void);
+u64 XTimer_GetTimestampMs(void);
 
 #ifdef __cplusplus
 }
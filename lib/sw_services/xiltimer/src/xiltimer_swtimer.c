@@ -0,0 +1,400 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xiltimer_swtimer.c
+* @addtogroup xiltimer_api XilTimer APIs
+*
+* This file contains the software timer API's.
+* @{
+* @details
+*
+* Any number of one shot and periodic software timers are multiplexed on the
+* tick timer. The tick interrupt advances a 64 bit tick count and expires the
+* timers of one slot of a timing wheel of XTIMER_WHEEL_SLOTS slots. A timer is
+* linked into the slot of its expiry tick, sorted by expiry, so that the tick
+* handler only looks at the timers due in the current tick and calls them in
+* deadline order. Timers further away than one turn of the wheel stay in their
+* slot until their turn comes.
+*
+* The software timers own the tick timer: XTimer_SetHandler() and
+* XTimer_SetInterval() must not be used by the application at the same time,
+* and they can not be used with a BSP whose OS uses the tick timer.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who      Date     Changes
+* ----- -------- -------- -----------------------------------------------
+*  1.2  ag	 15/10/26 Initial release.
+* </pre>
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xil_exception.h"
+#include "xiltimer.h"
+
+/****************************  Constant Definitions  *************************/
+#define XTIMER_WHEEL_MASK	(XTIMER_WHEEL_SLOTS - 1U)
+
+#if ((XTIMER_WHEEL_SLOTS & XTIMER_WHEEL_MASK) != 0U)
+#error "XTIMER_WHEEL_SLOTS must be a power of 2"
+#endif
+
+/**************************** Type Definitions *******************************/
+/**
+ * Timing wheel state
+ */
+typedef struct {
+	XTimer_SwTimer *Slots[XTIMER_WHEEL_SLOTS]; /**< Timers by expiry slot */
+	volatile u64 Ticks;	/**< Ticks since XTimer_SwTimerInit() */
+	u32 TickMs;		/**< Tick period in milli seconds */
+	volatile u8 InTickHandler; /**< Set while the callbacks run */
+} XTimer_Wheel;
+
+/************************** Variable Definitions *****************************/
+static XTimer_Wheel TimerWheel;
+
+/************************** Function Prototypes ******************************/
+static void XTimer_SwTimerTickHandler(void *CallBackRef, u32 StatusEvent);
+
+/****************************************************************************/
+/**
+*
+* This routine enters the critical section of the timing wheel. Nothing is
+* done from the callbacks, which run with the tick interrupt masked.
+*
+* @param	None
+*
+* @return	None
+*
+*****************************************************************************/
+static inline void XTimer_WheelLock(void)
+{
+	if (TimerWheel.InTickHandler == 0U) {
+		Xil_ExceptionDisable();
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* This routine leaves the critical section of the timing wheel.
+*
+* @param	None
+*
+* @return	None
+*
+*****************************************************************************/
+static inline void XTimer_WheelUnlock(void)
+{
+	if (TimerWheel.InTickHandler == 0U) {
+		Xil_ExceptionEnable();
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* This routine links a timer into the slot of its expiry tick, after the
+* timers of the slot that expire at the same tick or earlier.
+*
+* @param	TimerPtr is a pointer to the software timer.
+*
+* @return	None
+*
+*****************************************************************************/
+static void XTimer_WheelInsert(XTimer_SwTimer *TimerPtr)
+{
+	XTimer_SwTimer **LinkPtr;
+	XTimer_SwTimer *PrevPtr = NULL;
+
+	LinkPtr = &TimerWheel.Slots[(u32)TimerPtr->Expiry & XTIMER_WHEEL_MASK];
+	while ((*LinkPtr != NULL) && ((*LinkPtr)->Expiry <= TimerPtr->Expiry)) {
+		PrevPtr = *LinkPtr;
+		LinkPtr = &PrevPtr->Next;
+	}
+
+	TimerPtr->Prev = PrevPtr;
+	TimerPtr->Next = *LinkPtr;
+	if (TimerPtr->Next != NULL) {
+		TimerPtr->Next->Prev = TimerPtr;
+	}
+	*LinkPtr = TimerPtr;
+	TimerPtr->IsActive = TRUE;
+}
+
+/****************************************************************************/
+/**
+*
+* This routine unlinks a timer from its slot.
+*
+* @param	TimerPtr is a pointer to the software timer.
+*
+* @return	None
+*
+*****************************************************************************/
+static void XTimer_WheelRemove(XTimer_SwTimer *TimerPtr)
+{
+	if (TimerPtr->Prev != NULL) {
+		TimerPtr->Prev->Next = TimerPtr->Next;
+	} else {
+		TimerWheel.Slots[(u32)TimerPtr->Expiry & XTIMER_WHEEL_MASK] =
+			TimerPtr->Next;
+	}
+	if (TimerPtr->Next != NULL) {
+		TimerPtr->Next->Prev = TimerPtr->Prev;
+	}
+	TimerPtr->Next = NULL;
+	TimerPtr->Prev = NULL;
+	TimerPtr->IsActive = FALSE;
+}
+
+/****************************************************************************/
+/**
+*
+* This routine converts milli seconds to ticks, rounded up.
+*
+* @param	Msec is the time in milli seconds.
+*
+* @return	Number of ticks
+*
+*****************************************************************************/
+static inline u64 XTimer_MsecToTicks(u32 Msec)
+{
+	return ((u64)Msec + TimerWheel.TickMs - 1U) / TimerWheel.TickMs;
+}
+
+/****************************************************************************/
+/**
+*
+* This routine is the tick handler of the software timers. It advances the
+* tick count and calls the handlers of the timers that expire at the new
+* tick, in deadline order. Periodic timers are linked again before their
+* handler is called, so that the handler can stop or restart them.
+*
+* @param	CallBackRef is unused.
+* @param	StatusEvent is unused.
+*
+* @return	None
+*
+*****************************************************************************/
+static void XTimer_SwTimerTickHandler(void *CallBackRef, u32 StatusEvent)
+{
+	XTimer_SwTimer *TimerPtr;
+	u64 Ticks;
+	u32 Slot;
+
+	(void)CallBackRef;
+	(void)StatusEvent;
+
+	Ticks = TimerWheel.Ticks + 1U;
+	TimerWheel.Ticks = Ticks;
+	Slot = (u32)Ticks & XTIMER_WHEEL_MASK;
+
+	TimerWheel.InTickHandler = 1U;
+	TimerPtr = TimerWheel.Slots[Slot];
+	while ((TimerPtr != NULL) && (TimerPtr->Expiry <= Ticks)) {
+		XTimer_WheelRemove(TimerPtr);
+		if (TimerPtr->Period != 0U) {
+			TimerPtr->Expiry += TimerPtr->Period;
+			XTimer_WheelInsert(TimerPtr);
+		}
+		TimerPtr->Handler(TimerPtr->CallBackRef);
+		TimerPtr = TimerWheel.Slots[Slot];
+	}
+	TimerWheel.InTickHandler = 0U;
+}
+
+/****************************************************************************/
+/**
+*
+* This API starts the software timers on the tick timer.
+*
+* @param	TickMs is the tick period in milli seconds. It is the
+*		resolution of the software timers.
+* @param	Priority is the priority of the tick interrupt.
+*
+* @return	XST_SUCCESS if the tick timer is started,
+*		XST_FAILURE if there is no tick timer.
+*
+* @note		Timers that are active are dropped.
+*
+*****************************************************************************/
+u32 XTimer_SwTimerInit(u32 TickMs, u8 Priority)
+{
+	XTimer *InstancePtr = &TimerInst;
+	u32 Index;
+
+	Xil_AssertNonvoid(TickMs != 0U);
+
+	if ((InstancePtr->XTimer_TickInterval == NULL) ||
+	    (InstancePtr->XTimer_TickIntrHandler == NULL)) {
+		return XST_FAILURE;
+	}
+
+	for (Index = 0U; Index < XTIMER_WHEEL_SLOTS; Index++) {
+		TimerWheel.Slots[Index] = NULL;
+	}
+	TimerWheel.Ticks = 0U;
+	TimerWheel.TickMs = TickMs;
+	TimerWheel.InTickHandler = 0U;
+
+	XTimer_SetHandler(XTimer_SwTimerTickHandler, &TimerWheel, Priority);
+	XTimer_SetInterval(TickMs);
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* This API sets the handler of a software timer. The timer must not be
+* active.
+*
+* @param	TimerPtr is a pointer to the software timer.
+* @param	FuncPtr is the function called when the timer expires, from
+*		the tick interrupt.
+* @param	CallBackRef is a user data item passed to FuncPtr.
+*
+* @return	None
+*
+*****************************************************************************/
+void XTimer_SwTimerSetup(XTimer_SwTimer *TimerPtr,
+			 XTimer_SwTimerHandler FuncPtr, void *CallBackRef)
+{
+	Xil_AssertVoid(TimerPtr != NULL);
+	Xil_AssertVoid(FuncPtr != NULL);
+
+	TimerPtr->Next = NULL;
+	TimerPtr->Prev = NULL;
+	TimerPtr->Expiry = 0U;
+	TimerPtr->Period = 0U;
+	TimerPtr->Handler = FuncPtr;
+	TimerPtr->CallBackRef = CallBackRef;
+	TimerPtr->IsActive = FALSE;
+}
+
+/****************************************************************************/
+/**
+*
+* This API starts a software timer, or restarts it when it is active.
+*
+* @param	TimerPtr is a pointer to the software timer.
+* @param	DelayMs is the time to the first expiry in milli seconds.
+* @param	PeriodMs is the period in milli seconds, 0 for a one shot
+*		timer.
+*
+* @return	None
+*
+* @note		Times are rounded up to whole ticks, and a delay is at least
+*		one tick. Periodic expiries do not drift.
+*
+*****************************************************************************/
+void XTimer_SwTimerStart(XTimer_SwTimer *TimerPtr, u32 DelayMs, u32 PeriodMs)
+{
+	u64 Delay;
+
+	Xil_AssertVoid(TimerPtr != NULL);
+	Xil_AssertVoid(TimerPtr->Handler != NULL);
+
+	Delay = XTimer_MsecToTicks(DelayMs);
+	if (Delay == 0U) {
+		Delay = 1U;
+	}
+
+	XTimer_WheelLock();
+	if (TimerPtr->IsActive == TRUE) {
+		XTimer_WheelRemove(TimerPtr);
+	}
+	TimerPtr->Expiry = TimerWheel.Ticks + Delay;
+	TimerPtr->Period = (u32)XTimer_MsecToTicks(PeriodMs);
+	XTimer_WheelInsert(TimerPtr);
+	XTimer_WheelUnlock();
+}
+
+/****************************************************************************/
+/**
+*
+* This API stops a software timer. Stopping a timer that is not active has no
+* effect.
+*
+* @param	TimerPtr is a pointer to the software timer.
+*
+* @return	None
+*
+*****************************************************************************/
+void XTimer_SwTimerStop(XTimer_SwTimer *TimerPtr)
+{
+	Xil_AssertVoid(TimerPtr != NULL);
+
+	XTimer_WheelLock();
+	if (TimerPtr->IsActive == TRUE) {
+		XTimer_WheelRemove(TimerPtr);
+	}
+	XTimer_WheelUnlock();
+}
+
+/****************************************************************************/
+/**
+*
+* This API returns whether a software timer is active.
+*
+* @param	TimerPtr is a pointer to the software timer.
+*
+* @return	TRUE if the timer is active, FALSE otherwise.
+*
+*****************************************************************************/
+u8 XTimer_SwTimerIsActive(XTimer_SwTimer *TimerPtr)
+{
+	Xil_AssertNonvoid(TimerPtr != NULL);
+
+	return TimerPtr->IsActive;
+}
+
+/****************************************************************************/
+/**
+*
+* This API returns the number of ticks since XTimer_SwTimerInit(). The count
+* is monotonic and does not wrap.
+*
+* @param	None
+*
+* @return	64 bit tick count
+*
+* @note		On 32 bit processors the count is read again when the tick
+*		interrupt updated it during the read, which is cheaper than
+*		masking interrupts.
+*
+*****************************************************************************/
+u64 XTimer_GetTicks(void)
+{
+	u64 Ticks;
+
+	do {
+		Ticks = TimerWheel.Ticks;
+	} while (Ticks != TimerWheel.Ticks);
+
+	return Ticks;
+}
+
+/****************************************************************************/
+/**
+*
+* This API returns the time since XTimer_SwTimerInit() in milli seconds, at
+* the resolution of the tick.
+*
+* @param	None
+*
+* @return	64 bit time in milli seconds
+*
+*****************************************************************************/
+u64 XTimer_GetTimestampMs(void)
+{
+	return XTimer_GetTicks() * TimerWheel.TickMs;
+}
+/*@}*/
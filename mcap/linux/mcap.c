@@ -30,9 +30,11 @@
 *
 ******************************************************************************/
 
+#include <unistd.h>
+
 #include "mcap_lib.h"
 
-static const char options[] = "x:pC:rmfdvHhDa::";
+static const char options[] = "x:p:C:rmfdvHhDa::FP";
 static char help_msg[] =
 "Usage: mcap [options]\n"
 "\n"
@@ -40,6 +42,8 @@ static char help_msg[] =
 "\t-x\t\tSpecify MCAP Device Id in hex (MANDATORY)\n"
 "\t-p    <file>\tProgram Bitstream (.bin/.bit/.rbt)\n"
 "\t-C    <file>\tPartial Reconfiguration Clear File(.bin/.bit/.rbt)\n"
+"\t-F\t\tFast programming through the mapped config space\n"
+"\t-P\t\tShow programming progress and throughput\n"
 "\t-r\t\tPerforms Simple Reset\n"
 "\t-m\t\tPerforms Module Reset\n"
 "\t-f\t\tPerforms Full Reset\n"
@@ -60,7 +64,8 @@ int main(int argc, char **argv)
 	int i, modreset = 0, fullreset = 0, reset = 0;
 	int program = 0, verbose = 0, device_id = 0;
 	int data_regs = 0, dump_regs = 0, access_config = 0;
-	int programconfigfile = 0;
+	int programconfigfile = 0, fast = 0, progress = 0;
+	char *bitfile = NULL, *clearfile = NULL;
 
 	while ((i = getopt(argc, argv, options)) != -1) {
 		switch (i) {
@@ -88,9 +93,17 @@ int main(int argc, char **argv)
 			return 1;
 		case 'C':
 			programconfigfile = 1;
+			clearfile = optarg;
 			break;
 		case 'p':
 			program = 1;
+			bitfile = optarg;
+			break;
+		case 'F':
+			fast = 1;
+			break;
+		case 'P':
+			progress = 1;
 			break;
 		case 'v':
 			verbose++;
@@ -114,6 +127,11 @@ int main(int argc, char **argv)
 	if (!mdev)
 		return 1;
 
+	if (fast && MCapSetFastMode(mdev, 1))
+		printf("Fast mode not available, using libpci accesses\n");
+
+	MCapSetProgress(mdev, progress);
+
 	if (verbose) {
 		MCapShowDevice(mdev, verbose);
 		goto free;
@@ -145,20 +163,17 @@ int main(int argc, char **argv)
 	}
 
 	if (programconfigfile) {
-		if (argc > 6)
+		if (program)
 			mdev->is_multiplebit = 1;
 
-		MCapConfigureFPGA(mdev, argv[4], EMCAP_PARTIALCONFIG_FILE);
+		MCapConfigureFPGA(mdev, clearfile, EMCAP_PARTIALCONFIG_FILE);
 
 		if(!mdev->is_multiplebit)
 			goto free;
 	}
 
 	if (program) {
-		if (argc > 6)
-			MCapConfigureFPGA(mdev, argv[6], EMCAP_CONFIG_FILE);
-		else
-			MCapConfigureFPGA(mdev, argv[4], EMCAP_CONFIG_FILE);
+		MCapConfigureFPGA(mdev, bitfile, EMCAP_CONFIG_FILE);
 		goto free;
 	}
 
@@ -30,11 +30,21 @@
 *
 ******************************************************************************/
 
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/mman.h>
+
 #include "mcap_lib.h"
 
 /* Library Specific Definitions */
 #define MCAP_VENDOR_ID	0x10EE
 
+#define MCAP_IOMEM_FILE		"/proc/iomem"
+#define MCAP_DEVMEM_FILE	"/dev/mem"
+#define MCAP_ECAM_NAME		"PCI MMCONFIG "
+#define MCAP_ECAM_FUNC_SIZE	4096
+
 #define MCAP_LOOP_COUNT	1000000
 
 #define MCAP_SYNC_DWORD	0xFFFFFFFF
@@ -220,11 +230,81 @@ static int Checkforcompletion(struct mcap_dev *mdev)
 	return 0;
 }
 
+static double MCapElapsed(struct timespec *start)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (now.tv_sec - start->tv_sec) +
+		(now.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+static void MCapShowProgress(int done, int len, double secs)
+{
+	double bytes = (double)done * 4;
+
+	pr_info("\rProgramming: %3d%% %8.0f KB %7.2f MB/s",
+		(int)((long long)done * 100 / len), bytes / 1024,
+		secs > 0 ? bytes / secs / 1e6 : 0.0);
+	fflush(stdout);
+}
+
+/*
+ * Writes the bitstream to the MCAP Write Data register. With the config
+ * space mapped (fast mode) each word is a single store instead of a
+ * pwrite() on the sysfs config file, and the status register is read
+ * after every MCAP_FAST_FLUSH_WORDS words so that no more writes than the
+ * MCAP FIFO holds are in flight.
+ */
+static void MCapWriteData(struct mcap_dev *mdev, u32 *data, int len, u8 bswap)
+{
+	volatile u32 *wr_data = NULL, *status = NULL;
+	struct timespec start;
+	int count, next, i;
+
+	if (mdev->cfg_map) {
+		wr_data = &mdev->cfg_map[(mdev->reg_base + MCAP_DATA) / 4];
+		status = &mdev->cfg_map[(mdev->reg_base + MCAP_STATUS) / 4];
+	}
+
+	if (mdev->progress)
+		clock_gettime(CLOCK_MONOTONIC, &start);
+
+	for (count = 0; count < len; count = next) {
+		next = count + MCAP_PROGRESS_BYTES / 4;
+		if (next > len)
+			next = len;
+
+		if (wr_data) {
+			for (i = count; i < next; i++) {
+				*wr_data = bswap ? __bswap_32(data[i]) : data[i];
+				if ((i % MCAP_FAST_FLUSH_WORDS) ==
+				    MCAP_FAST_FLUSH_WORDS - 1)
+					(void)*status;
+			}
+		} else if (!bswap) {
+			for (i = count; i < next; i++)
+				MCapRegWrite(mdev, MCAP_DATA, data[i]);
+		} else {
+			for (i = count; i < next; i++)
+				MCapRegWrite(mdev, MCAP_DATA,
+					     __bswap_32(data[i]));
+		}
+
+		if (mdev->progress)
+			MCapShowProgress(next, len, MCapElapsed(&start));
+	}
+
+	if (mdev->progress)
+		pr_info("\n");
+}
+
 static int MCapWritePartialBitStream(struct mcap_dev *mdev, u32 *data,
 					int len, u8 bswap)
 {
 	u32 set, restore;
-	int err, count = 0, i;
+	int err, i;
 
 	if (!data || !len) {
 		pr_err("Invalid Arguments\n");
@@ -254,13 +334,7 @@ static int MCapWritePartialBitStream(struct mcap_dev *mdev, u32 *data,
 	MCapRegWrite(mdev, MCAP_CONTROL, set);
 
 	/* Write Data */
-	if (!bswap) {
-		for (count = 0; count < len; count++)
-			MCapRegWrite(mdev, MCAP_DATA, data[count]);
-	} else {
-		for (count = 0; count < len; count++)
-			MCapRegWrite(mdev, MCAP_DATA, __bswap_32(data[count]));
-	}
+	MCapWriteData(mdev, data, len, bswap);
 
 	for (i = 0 ; i < EMCAP_EOS_LOOP_COUNT; i++) {
 		MCapRegWrite(mdev, MCAP_DATA, EMCAP_NOOP_VAL);
@@ -287,7 +361,7 @@ static int MCapWriteBitStream(struct mcap_dev *mdev, u32 *data,
 			      int len, u8 bswap)
 {
 	u32 set, restore;
-	int err, count = 0;
+	int err;
 
 	if (!data || !len) {
 		pr_err("Invalid Arguments\n");
@@ -319,13 +393,7 @@ static int MCapWriteBitStream(struct mcap_dev *mdev, u32 *data,
 	}
 
 	/* Write Data */
-	if (!bswap) {
-		for (count = 0; count < len; count++)
-			MCapRegWrite(mdev, MCAP_DATA, data[count]);
-	} else {
-		for (count = 0; count < len; count++)
-			MCapRegWrite(mdev, MCAP_DATA, __bswap_32(data[count]));
-	}
+	MCapWriteData(mdev, data, len, bswap);
 
 	/* Check for Completion */
 	err = Checkforcompletion(mdev);
@@ -347,9 +415,113 @@ static int MCapWriteBitStream(struct mcap_dev *mdev, u32 *data,
 	return 0;
 }
 
+static int MCapMapConfigSpace(struct mcap_dev *mdev)
+{
+	struct pci_dev *pdev = mdev->pdev;
+	unsigned long long start, end, addr;
+	unsigned int domain, bus_start, bus_end;
+	char line[256], *name;
+	int fd, found = 0;
+	void *map;
+	FILE *fptr;
+
+	/* Find the ECAM window of the bus, e.g. "PCI MMCONFIG 0000 [bus 00-ff]" */
+	fptr = fopen(MCAP_IOMEM_FILE, "r");
+	if (fptr == NULL) {
+		pr_err("Failed to open %s\n", MCAP_IOMEM_FILE);
+		return -EMCAPMAP;
+	}
+
+	while (fgets(line, sizeof(line), fptr)) {
+		if (sscanf(line, " %llx-%llx :", &start, &end) != 2)
+			continue;
+		name = strstr(line, MCAP_ECAM_NAME);
+		if (!name)
+			continue;
+		if (sscanf(name, MCAP_ECAM_NAME "%x [bus %x-%x]", &domain,
+			   &bus_start, &bus_end) != 3)
+			continue;
+		if (domain == (unsigned int)pdev->domain &&
+		    pdev->bus >= bus_start && pdev->bus <= bus_end) {
+			found = 1;
+			break;
+		}
+	}
+	fclose(fptr);
+
+	/* Addresses read as 0 without root permissions */
+	if (!found || !start) {
+		pr_err("ECAM config space of the MCAP device not found\n");
+		return -EMCAPMAP;
+	}
+
+	addr = start + ((unsigned long long)(pdev->bus - bus_start) << 20) +
+		(pdev->dev << 15) + (pdev->func << 12);
+	if (addr + MCAP_ECAM_FUNC_SIZE - 1 > end) {
+		pr_err("ECAM config space of the MCAP device not found\n");
+		return -EMCAPMAP;
+	}
+
+	fd = open(MCAP_DEVMEM_FILE, O_RDWR | O_SYNC);
+	if (fd < 0) {
+		pr_err("Failed to open %s\n", MCAP_DEVMEM_FILE);
+		return -EMCAPMAP;
+	}
+
+	map = mmap(NULL, MCAP_ECAM_FUNC_SIZE, PROT_READ | PROT_WRITE,
+		   MAP_SHARED, fd, (off_t)addr);
+	close(fd);
+	if (map == MAP_FAILED) {
+		pr_err("Failed to map the config space at 0x%llx\n", addr);
+		return -EMCAPMAP;
+	}
+
+	/* Make sure the mapping is the config space of the device */
+	mdev->cfg_map = map;
+	if (mdev->cfg_map[0] != pci_read_long(pdev, 0) ||
+	    mdev->cfg_map[(mdev->reg_base + MCAP_EXT_CAP_HEADER) / 4] !=
+	    MCapRegRead(mdev, MCAP_EXT_CAP_HEADER)) {
+		pr_err("Mapped config space does not match the device\n");
+		munmap(map, MCAP_ECAM_FUNC_SIZE);
+		mdev->cfg_map = NULL;
+		return -EMCAPMAP;
+	}
+
+	pr_dbg("Config space mapped at 0x%llx\n", addr);
+
+	return 0;
+}
+
+static void MCapUnmapConfigSpace(struct mcap_dev *mdev)
+{
+	if (mdev->cfg_map) {
+		munmap((void *)mdev->cfg_map, MCAP_ECAM_FUNC_SIZE);
+		mdev->cfg_map = NULL;
+	}
+}
+
+int MCapSetFastMode(struct mcap_dev *mdev, int enable)
+{
+	if (!enable) {
+		MCapUnmapConfigSpace(mdev);
+		return 0;
+	}
+
+	if (mdev->cfg_map)
+		return 0;
+
+	return MCapMapConfigSpace(mdev);
+}
+
+void MCapSetProgress(struct mcap_dev *mdev, int enable)
+{
+	mdev->progress = enable ? 1 : 0;
+}
+
 void MCapLibFree(struct mcap_dev *mdev)
 {
 	if (mdev) {
+		MCapUnmapConfigSpace(mdev);
 		pci_cleanup(mdev->pacc);
 		free(mdev);
 	}
@@ -369,6 +541,8 @@ struct mcap_dev *MCapLibInit(int device_id)
 	mdev->pacc = pci_alloc();
 
 	mdev->is_multiplebit = 0;
+	mdev->cfg_map = NULL;
+	mdev->progress = 0;
 
 	/* Initialize the PCI library */
 	pci_init(mdev->pacc);
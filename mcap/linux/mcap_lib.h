@@ -85,6 +85,7 @@
 #define EMCAPCFG	126
 #define EMCAPBUSWALK	127
 #define EMCAPCFGACC	128
+#define EMCAPMAP	129
 
 #define EMCAP_EOS_RETRY_COUNT 10
 #define EMCAP_EOS_LOOP_COUNT 100
@@ -104,12 +105,20 @@
 #define pr_info printf
 #define pr_err	printf
 
+/* Bitstream words written between two FIFO flushes in fast mode */
+#define MCAP_FAST_FLUSH_WORDS	MCAP_FIFO_DEPTH
+
+/* Progress is reported each time this many bytes are written */
+#define MCAP_PROGRESS_BYTES	(1024 * 1024)
+
 /* MCAP Device Information */
 struct mcap_dev {
 	struct pci_dev *pdev;
 	struct pci_access *pacc;
 	unsigned int reg_base;
 	u32 is_multiplebit;
+	volatile u32 *cfg_map;	/* ECAM config space, NULL if not mapped */
+	u32 progress;		/* Report progress and throughput */
 };
 
 #define MCapRegWrite(mdev, offset, value) \
@@ -158,3 +167,5 @@ int MCapShowDevice(struct mcap_dev *mdev, int verbose);
 int MCapConfigureFPGA(struct mcap_dev *mdev, char *file_path, u32 bitfile_type);
 int MCapReadRegisters(struct mcap_dev *mdev, u32 *data);
 int MCapAccessConfigSpace(struct mcap_dev *mdev, int argc, char **argv);
+int MCapSetFastMode(struct mcap_dev *mdev, int enable);
+void MCapSetProgress(struct mcap_dev *mdev, int enable);